@@ -0,0 +1,232 @@
+/*
+*******************************************************************************
+\file batch.c
+\brief Execute commands in one process
+\project bee2/cmd
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "../cmd.h"
+#include <bee2/core/dec.h>
+#include <bee2/core/err.h>
+#include <bee2/core/str.h>
+#include <bee2/core/util.h>
+#include <stdio.h>
+
+/*
+*******************************************************************************
+Утилита batch
+
+Функционал:
+- выполнение команд bee2cmd, записанных построчно в файле-сценарии или
+  передаваемых через стандартный поток ввода, в одном процессе.
+
+Пустые строки и строки, начинающиеся с символа '#', пропускаются. Каждая
+непустая строка разбирается функцией cmdArgCreate() и выполняется как
+командная строка bee2cmd без имени программы. По завершении команды
+печатается строка состояния с номером строки и кодом возврата команды.
+Строка состояния позволяет использовать команду как строчный протокол:
+клиент передает команду и ожидает строку состояния.
+
+Между командами сохраняются:
+- запущенный ГСЧ (cmdRngStart() не повторяет проверки источников);
+- личные ключи, прочитанные из контейнеров (см. cmdPrivkeyCacheStart()),
+  в течение времени, заданного опцией -keep;
+- результаты проверки пар сертификатов в цепочках (см. cmdSigCacheStart()).
+
+Пример:
+  echo "kg print -pass pass:alice privkey2" > script
+  echo "sig sign -pass pass:alice privkey2 file1 sig_file1" >> script
+  echo "sig sign -pass pass:alice privkey2 file2 sig_file2" >> script
+  bee2cmd batch -keep 300 script
+  bee2cmd batch < script
+*******************************************************************************
+*/
+
+static const char _name[] = "batch";
+static const char _descr[] = "execute commands in one process";
+
+static int batchUsage()
+{
+	printf(
+		"bee2cmd/%s: %s\n"
+		"Usage:\n"
+		"  batch [-keep <sec>] [<script>]\n"
+		"    execute commands listed in <script> (stdin by default)\n"
+		"  options:\n"
+		"    -keep <sec> -- lifetime of cached private keys: 0 <= <sec> <= 86400\n"
+		"                   (60 by default, 0 -- do not cache)\n",
+		_name, _descr
+	);
+	return -1;
+}
+
+/*
+*******************************************************************************
+Выполнение сценария
+*******************************************************************************
+*/
+
+#define BATCH_LINE_MAX 4096
+
+static err_t batchRunLine(int* ret, const char* line)
+{
+	err_t code;
+	int argc;
+	char** argv;
+	// разобрать строку
+	code = cmdArgCreate(&argc, &argv, line);
+	ERR_CALL_CHECK(code);
+	if (argc == 0)
+	{
+		*ret = 0;
+		return ERR_OK;
+	}
+	// вложенный пакет?
+	if (strEq(argv[0], _name))
+		code = ERR_CMD_PARAMS;
+	// выполнить команду
+	else
+	{
+		*ret = cmdRun(argc, argv);
+		fflush(stdout);
+	}
+	cmdArgClose(argv);
+	return code;
+}
+
+static err_t batchRun(size_t* failed, FILE* fp)
+{
+	err_t code;
+	char* line;
+	char* cmd;
+	size_t len;
+	size_t num;
+	int ret;
+	// выделить память
+	code = cmdBlobCreate(line, BATCH_LINE_MAX + 1);
+	ERR_CALL_CHECK(code);
+	// цикл по строкам
+	*failed = 0;
+	for (num = 1; fgets(line, BATCH_LINE_MAX + 1, fp); ++num)
+	{
+		len = strLen(line);
+		// слишком длинная строка?
+		if (len == BATCH_LINE_MAX && line[len - 1] != '\n' && !feof(fp))
+		{
+			int ch;
+			while ((ch = fgetc(fp)) != EOF && ch != '\n');
+			code = ERR_CMD_PARAMS, ret = -1;
+		}
+		else
+		{
+			// отбросить завершающие \r\n
+			while (len && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+				line[--len] = '\0';
+			// пропустить пустые строки и комментарии
+			for (cmd = line; *cmd == ' ' || *cmd == '\t'; ++cmd);
+			if (!*cmd || *cmd == '#')
+				continue;
+			// выполнить
+			ret = -1;
+			code = batchRunLine(&ret, cmd);
+		}
+		// напечатать строку состояния
+		if (code != ERR_OK)
+			printf("bee2cmd/%s: line %u: %s\n", _name, (unsigned)num,
+				errMsg(code));
+		printf("bee2cmd/%s: line %u: %d\n", _name, (unsigned)num, ret);
+		fflush(stdout);
+		if (ret != 0)
+			++*failed;
+	}
+	code = ferror(fp) ? ERR_FILE_READ : ERR_OK;
+	cmdBlobClose(line);
+	return code;
+}
+
+/*
+*******************************************************************************
+Главная функция
+*******************************************************************************
+*/
+
+static int batchMain(int argc, char* argv[])
+{
+	err_t code = ERR_OK;
+	size_t keep = SIZE_MAX;
+	size_t failed = 0;
+	FILE* fp = stdin;
+	// разбор опций
+	--argc, ++argv;
+	while (argc && strStartsWith(*argv, "-"))
+	{
+		if (strEq(*argv, "-keep"))
+		{
+			if (keep != SIZE_MAX)
+			{
+				code = ERR_CMD_DUPLICATE;
+				break;
+			}
+			++argv, --argc;
+			if (!argc || !decIsValid(*argv) || strLen(*argv) > 5 ||
+				(keep = (size_t)decToU32(*argv)) > 86400)
+			{
+				code = ERR_CMD_PARAMS;
+				break;
+			}
+			++argv, --argc;
+		}
+		else
+		{
+			code = ERR_CMD_PARAMS;
+			break;
+		}
+	}
+	if (code == ERR_OK && argc > 1)
+		code = ERR_CMD_PARAMS;
+	if (code == ERR_CMD_PARAMS)
+		return batchUsage();
+	if (keep == SIZE_MAX)
+		keep = 60;
+	// открыть сценарий
+	if (code == ERR_OK && argc)
+	{
+		code = cmdFileValExist(1, argv);
+		if (code == ERR_OK)
+			code = (fp = fopen(argv[0], "r")) ? ERR_OK : ERR_FILE_OPEN;
+	}
+	// запустить кэши
+	if (code == ERR_OK)
+		code = cmdPrivkeyCacheStart(keep);
+	if (code == ERR_OK)
+	{
+		cmdSigCacheStart();
+		// выполнить сценарий
+		code = batchRun(&failed, fp);
+		// закрыть кэши
+		cmdSigCacheClose();
+		cmdPrivkeyCacheClose();
+	}
+	if (fp && fp != stdin)
+		fclose(fp);
+	// завершить
+	if (code != ERR_OK)
+		printf("bee2cmd/%s: %s\n", _name, errMsg(code));
+	return (code != ERR_OK || failed) ? -1 : 0;
+}
+
+/*
+*******************************************************************************
+Инициализация
+*******************************************************************************
+*/
+
+err_t batchInit()
+{
+	return cmdReg(_name, _descr, batchMain);
+}
@@ -0,0 +1,504 @@
+/*
+*******************************************************************************
+\file bench.c
+\brief Measure performance of cryptographic primitives
+\project bee2/cmd
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "../cmd.h"
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/rng.h>
+#include <bee2/core/str.h>
+#include <bee2/core/tm.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bash.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bign.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+*******************************************************************************
+Утилита bench
+
+Функционал:
+- замер скорости симметричных алгоритмов belt и bash (такты на октет);
+- замер скорости алгоритмов bign на всех уровнях стойкости (операции
+  в секунду);
+- замер скорости штатного ГСЧ (октеты в секунду);
+- печать описания платформы (см. utilPlatform()), по которому можно
+  определить действующие реализации алгоритмов.
+
+Эксперимент -- это функция fn(arg, reps), которая reps раз выполняет
+измеряемую операцию над units единицами данных (октетами или операциями).
+Число повторов reps удваивается, пока время выполнения fn(arg, reps) не
+достигнет BENCH_TIME миллисекунд (одновременно выполняется разогрев).
+Затем проводится BENCH_SAMPLES замеров, и в качестве результата берется
+медиана. Время измеряется функцией tmTicks(), ее частота -- функцией
+tmFreq().
+
+Эксперименты совпадают с частью экспериментов тестовой программы
+(файлы *_bench.c каталога test/crypto), но в отличие от тестовой программы
+утилита входит в поставку и может запускаться на целевом оборудовании.
+
+Пример:
+  bee2cmd bench
+  bee2cmd bench -json belt bign-sign > bench.json
+*******************************************************************************
+*/
+
+static const char _name[] = "bench";
+static const char _descr[] = "measure performance of cryptographic primitives";
+
+static int benchUsage()
+{
+	printf(
+		"bee2cmd/%s: %s\n"
+		"Usage:\n"
+		"  bench [-json] [<filter> ...]\n"
+		"    run benchmarks whose names contain one of <filter>\n"
+		"  bench -list\n"
+		"    list benchmarks\n"
+		"  options:\n"
+		"    -json -- print results in JSON\n",
+		_name, _descr
+	);
+	return -1;
+}
+
+/*
+*******************************************************************************
+Замер
+*******************************************************************************
+*/
+
+#define BENCH_TIME 5
+#define BENCH_SAMPLES 7
+
+static int _argc;					/*< число фильтров */
+static char** _argv;				/*< фильтры */
+static bool_t _json;				/*< печать в формате JSON? */
+static bool_t _list;				/*< режим перечисления? */
+static size_t _count;				/*< число напечатанных результатов */
+static tm_ticks_t _freq;			/*< частота таймера */
+
+static bool_t benchIsSelected(const char* name)
+{
+	int i;
+	if (_argc == 0)
+		return TRUE;
+	for (i = 0; i < _argc; ++i)
+		if (strstr(name, _argv[i]))
+			return TRUE;
+	return FALSE;
+}
+
+static int benchCmp(const void* a, const void* b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static tm_ticks_t benchSample(void (*fn)(void*, size_t), void* arg,
+	size_t reps)
+{
+	tm_ticks_t ticks = tmTicks();
+	fn(arg, reps);
+	return tmTicks() - ticks;
+}
+
+static double benchMeasure(size_t units, void (*fn)(void*, size_t),
+	void* arg)
+{
+	double t[BENCH_SAMPLES];
+	tm_ticks_t target = MAX2(_freq / 1000 * BENCH_TIME, 1);
+	size_t reps;
+	size_t i;
+	// калибровка (и разогрев)
+	for (reps = 1; reps < SIZE_MAX / 2; reps *= 2)
+		if (benchSample(fn, arg, reps) >= target)
+			break;
+	// замеры
+	for (i = 0; i < BENCH_SAMPLES; ++i)
+		t[i] = (double)benchSample(fn, arg, reps) / reps / units;
+	qsort(t, BENCH_SAMPLES, sizeof(double), benchCmp);
+	return t[BENCH_SAMPLES / 2];
+}
+
+static void benchPrint(const char* name, const char* unit, double ticks)
+{
+	double speed = ticks > 0 ? (double)_freq / ticks : 0;
+	if (_json)
+		printf("%s\n    {\"name\": \"%s\", \"unit\": \"%s\", "
+			"\"ticks\": %.3f, \"speed\": %.0f}",
+			_count ? "," : "", name, unit, ticks, speed);
+	else if (strEq(unit, "B"))
+		printf("%s: %.2f cpb [%.0f kBytes/sec]\n", name, ticks,
+			speed / 1024);
+	else
+		printf("%s: %.0f cycles/%s [%.0f %ss/sec]\n", name, ticks, unit,
+			speed, unit);
+	++_count;
+	fflush(stdout);
+}
+
+static void benchDo(const char* name, const char* unit, size_t units,
+	void (*fn)(void*, size_t), void* arg)
+{
+	if (!benchIsSelected(name))
+		return;
+	if (_list)
+		printf("%s\n", name);
+	else
+		benchPrint(name, unit, benchMeasure(units, fn, arg));
+}
+
+/*
+*******************************************************************************
+Симметричные алгоритмы
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet state[1024];		/*!< состояние алгоритма */
+	octet buf[1024];		/*!< данные */
+	octet key[32];			/*!< ключ */
+	octet iv[16];			/*!< синхропосылка */
+	octet hash[64];			/*!< хэш-значение / имитовставка */
+	size_t l;				/*!< уровень стойкости bash */
+} bench_sym_st;
+
+static void benchECB(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltECBStepE(b->buf, 1024, b->state);
+}
+
+static void benchCBC(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltCBCStepE(b->buf, 1024, b->state);
+}
+
+static void benchCFB(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltCFBStepE(b->buf, 1024, b->state);
+}
+
+static void benchCTR(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltCTRStepE(b->buf, 1024, b->state);
+}
+
+static void benchMAC(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltMACStepA(b->buf, 1024, b->state);
+	beltMACStepG(b->hash, b->state);
+}
+
+static void benchCHE(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltCHEStepE(b->buf, 1024, b->state),
+		beltCHEStepA(b->buf, 1024, b->state);
+	beltCHEStepG(b->hash, b->state);
+}
+
+static void benchHash(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		beltHashStepH(b->buf, 1024, b->state);
+	beltHashStepG(b->hash, b->state);
+}
+
+static void benchBash(void* arg, size_t reps)
+{
+	bench_sym_st* b = (bench_sym_st*)arg;
+	while (reps--)
+		bashHashStepH(b->buf, 1024, b->state);
+	bashHashStepG(b->hash, b->l / 4, b->state);
+}
+
+static err_t benchSym()
+{
+	static const char* bash_names[] = { "bash256", "bash384", "bash512" };
+	octet combo_state[256];
+	bench_sym_st* b;
+	size_t i;
+	// подготовить память
+	if (!(b = (bench_sym_st*)blobCreate(sizeof(bench_sym_st))))
+		return ERR_OUTOFMEMORY;
+	// псевдослучайная генерация объектов
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	prngCOMBOStepR(b->buf, sizeof(b->buf), combo_state);
+	prngCOMBOStepR(b->key, sizeof(b->key), combo_state);
+	prngCOMBOStepR(b->iv, sizeof(b->iv), combo_state);
+	// belt
+	ASSERT(beltECB_keep() <= sizeof(b->state));
+	beltECBStart(b->state, b->key, 32);
+	benchDo("belt-ecb", "B", 1024, benchECB, b);
+	ASSERT(beltCBC_keep() <= sizeof(b->state));
+	beltCBCStart(b->state, b->key, 32, b->iv);
+	benchDo("belt-cbc", "B", 1024, benchCBC, b);
+	ASSERT(beltCFB_keep() <= sizeof(b->state));
+	beltCFBStart(b->state, b->key, 32, b->iv);
+	benchDo("belt-cfb", "B", 1024, benchCFB, b);
+	ASSERT(beltCTR_keep() <= sizeof(b->state));
+	beltCTRStart(b->state, b->key, 32, b->iv);
+	benchDo("belt-ctr", "B", 1024, benchCTR, b);
+	ASSERT(beltMAC_keep() <= sizeof(b->state));
+	beltMACStart(b->state, b->key, 32);
+	benchDo("belt-mac", "B", 1024, benchMAC, b);
+	ASSERT(beltCHE_keep() <= sizeof(b->state));
+	beltCHEStart(b->state, b->key, 32, b->iv);
+	benchDo("belt-che", "B", 2048, benchCHE, b);
+	ASSERT(beltHash_keep() <= sizeof(b->state));
+	beltHashStart(b->state);
+	benchDo("belt-hash", "B", 1024, benchHash, b);
+	// bash
+	ASSERT(bashHash_keep() <= sizeof(b->state));
+	for (i = 0; i < COUNT_OF(bash_names); ++i)
+	{
+		b->l = 128 + 64 * i;
+		bashHashStart(b->state, b->l);
+		benchDo(bash_names[i], "B", 1024, benchBash, b);
+	}
+	// завершить
+	blobClose(b);
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+bign
+*******************************************************************************
+*/
+
+typedef struct
+{
+	bign_params params[1];	/*!< долговременные параметры */
+	octet combo_state[256];	/*!< состояние генератора */
+	octet oid_der[16];		/*!< DER-код идентификатора хэш-алгоритма */
+	size_t oid_len;			/*!< длина oid_der */
+	octet privkey[64];		/*!< личный ключ */
+	octet pubkey[128];		/*!< открытый ключ */
+	octet hash[64];			/*!< хэш-значение */
+	octet sig[96];			/*!< подпись */
+	octet key[32];			/*!< общий ключ */
+	err_t code;				/*!< код ошибки */
+} bench_bign_st;
+
+static void benchBignSetCode(bench_bign_st* b, err_t code)
+{
+	if (b->code == ERR_OK)
+		b->code = code;
+}
+
+static void benchBignGen(void* arg, size_t reps)
+{
+	bench_bign_st* b = (bench_bign_st*)arg;
+	while (reps--)
+		benchBignSetCode(b, bignGenKeypair(b->privkey, b->pubkey, b->params,
+			prngCOMBOStepR, b->combo_state));
+}
+
+static void benchBignSign(void* arg, size_t reps)
+{
+	bench_bign_st* b = (bench_bign_st*)arg;
+	while (reps--)
+		benchBignSetCode(b, bignSign(b->sig, b->params, b->oid_der,
+			b->oid_len, b->hash, b->privkey, prngCOMBOStepR, b->combo_state));
+}
+
+static void benchBignVerify(void* arg, size_t reps)
+{
+	bench_bign_st* b = (bench_bign_st*)arg;
+	while (reps--)
+		benchBignSetCode(b, bignVerify(b->params, b->oid_der, b->oid_len,
+			b->hash, b->sig, b->pubkey));
+}
+
+static void benchBignDH(void* arg, size_t reps)
+{
+	bench_bign_st* b = (bench_bign_st*)arg;
+	while (reps--)
+		benchBignSetCode(b, bignDH(b->key, b->params, b->privkey, b->pubkey,
+			32));
+}
+
+static err_t benchBign()
+{
+	static const struct
+	{
+		const char* params;
+		const char* sign;
+		const char* verify;
+		const char* dh;
+		const char* gen;
+	} levels[] =
+	{
+		{
+			"1.2.112.0.2.0.34.101.45.3.1",
+			"bign-sign[128]", "bign-verify[128]", "bign-dh[128]",
+			"bign-gen[128]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.2",
+			"bign-sign[192]", "bign-verify[192]", "bign-dh[192]",
+			"bign-gen[192]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.3",
+			"bign-sign[256]", "bign-verify[256]", "bign-dh[256]",
+			"bign-gen[256]",
+		},
+	};
+	err_t code = ERR_OK;
+	bench_bign_st* b;
+	size_t i;
+	// подготовить память
+	if (!(b = (bench_bign_st*)blobCreate(sizeof(bench_bign_st))))
+		return ERR_OUTOFMEMORY;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->hash, sizeof(b->hash), b->combo_state);
+	b->oid_len = sizeof(b->oid_der);
+	code = bignOidToDER(b->oid_der, &b->oid_len,
+		"1.2.112.0.2.0.34.101.31.81");
+	// цикл по уровням стойкости
+	for (i = 0; code == ERR_OK && i < COUNT_OF(levels); ++i)
+	{
+		b->code = ERR_OK;
+		code = bignStdParams(b->params, levels[i].params);
+		if (code == ERR_OK)
+			code = bignGenKeypair(b->privkey, b->pubkey, b->params,
+				prngCOMBOStepR, b->combo_state);
+		if (code == ERR_OK)
+			code = bignSign2(b->sig, b->params, b->oid_der, b->oid_len,
+				b->hash, b->privkey, 0, 0);
+		if (code != ERR_OK)
+			break;
+		benchDo(levels[i].sign, "op", 1, benchBignSign, b);
+		benchDo(levels[i].verify, "op", 1, benchBignVerify, b);
+		benchDo(levels[i].dh, "op", 1, benchBignDH, b);
+		benchDo(levels[i].gen, "op", 1, benchBignGen, b);
+		code = b->code;
+	}
+	// завершить
+	blobClose(b);
+	return code;
+}
+
+/*
+*******************************************************************************
+ГСЧ
+
+ГСЧ запускается без обращения к клавиатурному источнику (см. cmdRngStart()),
+чтобы замер не требовал участия оператора. Если источников энтропии
+недостаточно, то эксперимент не проводится.
+*******************************************************************************
+*/
+
+static void benchRng(void* arg, size_t reps)
+{
+	while (reps--)
+		rngStepR(arg, 1024, 0);
+}
+
+static err_t benchRngDo()
+{
+	err_t code;
+	octet buf[1024];
+	if (!benchIsSelected("rng"))
+		return ERR_OK;
+	if (!_list && !rngIsValid())
+	{
+		code = rngESHealth();
+		ERR_CALL_CHECK(code);
+		code = rngCreate(0, 0);
+		ERR_CALL_CHECK(code);
+	}
+	benchDo("rng", "B", sizeof(buf), benchRng, buf);
+	memWipe(buf, sizeof(buf));
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Главная функция
+*******************************************************************************
+*/
+
+static int benchMain(int argc, char* argv[])
+{
+	err_t code;
+	// разбор опций
+	--argc, ++argv;
+	_json = _list = FALSE;
+	while (argc && strStartsWith(*argv, "-"))
+	{
+		if (strEq(*argv, "-json") && !_json && !_list)
+			_json = TRUE;
+		else if (strEq(*argv, "-list") && !_json && !_list)
+			_list = TRUE;
+		else
+			return benchUsage();
+		++argv, --argc;
+	}
+	if (_list && argc)
+		return benchUsage();
+	_argc = argc, _argv = argv, _count = 0;
+	_freq = tmFreq();
+	// заголовок
+	if (_json)
+		printf("{\n  \"platform\": \"%s\",\n  \"freq\": %.0f,\n"
+			"  \"results\": [", utilPlatform(), (double)_freq);
+	else if (!_list)
+		printf("platform: %s\nfreq: %.0f\n", utilPlatform(), (double)_freq);
+	// эксперименты
+	code = benchSym();
+	if (code == ERR_OK)
+		code = benchBign();
+	if (code == ERR_OK)
+		code = benchRngDo();
+	// завершить
+	if (_json)
+		printf("\n  ],\n  \"code\": \"%s\"\n}\n", errMsg(code));
+	else if (code != ERR_OK)
+		printf("bee2cmd/%s: %s\n", _name, errMsg(code));
+	return code == ERR_OK ? 0 : -1;
+}
+
+/*
+*******************************************************************************
+Инициализация
+*******************************************************************************
+*/
+
+err_t benchInit()
+{
+	return cmdReg(_name, _descr, benchMain);
+}
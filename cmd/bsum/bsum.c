@@ -4,16 +4,25 @@
 \brief Hash files using belt-hash / bash-hash
 \project bee2/cmd 
 \created 2014.10.28
-\version 2022.07.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#ifndef _FILE_OFFSET_BITS
+	#define _FILE_OFFSET_BITS 64
+#endif
+
 #include "../cmd.h"
+#include <bee2/core/blob.h>
 #include <bee2/core/dec.h>
+#include <bee2/core/err.h>
 #include <bee2/core/hex.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
 #include <bee2/core/str.h>
+#include <bee2/core/u64.h>
 #include <bee2/core/util.h>
 #include <bee2/crypto/bash.h>
 #include <bee2/crypto/belt.h>
@@ -29,6 +38,19 @@
 
 Максимально точно поддержан интерфейс командной строки утилиты sha1sum.
 
+Алгоритмы -bashNNN-tree хэшируют файлы в режиме дерева (см. раздел
+"Хэширование в режиме дерева"). Хэш-значения этих алгоритмов отличаются от
+хэш-значений -bashNNN и записываются в checksum_file в формате
+"BASHNNN-TREE (<file>) = <hash>".
+
+Опция -j включает параллельное хэширование нескольких файлов (см. раздел
+"Параллельное хэширование"). Опция не влияет на формат и порядок вывода.
+
+Можно указать несколько алгоритмов -belt-hash, -bashNNN (см. раздел
+"Мультихэширование"). Тогда каждый файл прочитывается один раз, а для
+каждого алгоритма в checksum_file записывается строка в формате
+"BELT-HASH (<file>) = <hash>" или "BASHNNN (<file>) = <hash>".
+
 \warning В Windows имена файлов на русском языке будут записаны в checksum_file
 в кодировке cp1251. В Linux -- в кодировке UTF8.
 
@@ -44,11 +66,15 @@ int bsumUsage()
 	printf(
 		"bee2cmd/%s: %s\n"
 		"Usage:\n" 
-		"  bsum [hash_alg] <file_to_hash> <file_to_hash> ...\n"
-		"  bsum [hash_alg] -c <checksum_file>\n"
+		"  bsum [hash_alg...] [-j[N]] <file_to_hash> <file_to_hash> ...\n"
+		"  bsum [hash_alg...] [-j[N]] -c <checksum_file>\n"
 		"  hash_alg:\n" 
 		"    -belt-hash (STB 34.101.31, by default)\n"
-		"    -bash32, -bash64, ..., -bash512 (STB 34.101.77)\n",
+		"    -bash32, -bash64, ..., -bash512 (STB 34.101.77)\n"
+		"    -bash32-tree, ..., -bash512-tree (parallel tree mode over bash)\n"
+		"  several -belt-hash/-bashNNN: all digests from a single read\n"
+		"  -j[N]:\n"
+		"    hash N files concurrently (N = number of CPUs by default)\n",
 		_name, _descr
 	);
 	return -1;
@@ -60,6 +86,9 @@ int bsumUsage()
 *******************************************************************************
 */
 
+#define BSUM_TREE ((size_t)1 << 16)
+#define BSUM_ALGS 8
+
 size_t bsumParseHid(const char* alg_name)
 {
 	if (strEq(alg_name, "-belt-hash"))
@@ -67,93 +96,517 @@ size_t bsumParseHid(const char* alg_name)
 	if (strStartsWith(alg_name, "-bash"))
 	{
 		size_t hid;
+		size_t len;
+		size_t tree = 0;
 		alg_name += strLen("-bash");
-		if (!decIsValid(alg_name) || !strLen(alg_name) || 
-			strLen(alg_name) > 3 || decCLZ(alg_name) || 
-			(hid = (size_t)decToU32(alg_name)) % 32 || hid > 512)
-			hid = SIZE_MAX;
-		return hid;
+		len = strLen(alg_name);
+		if (strEndsWith(alg_name, "-tree"))
+			tree = BSUM_TREE, len -= strLen("-tree");
+		if (len == 0 || len > 3)
+			return SIZE_MAX;
+		{
+			char dec[4];
+			memCopy(dec, alg_name, len), dec[len] = 0;
+			if (!decIsValid(dec) || decCLZ(dec) || 
+				(hid = (size_t)decToU32(dec)) % 32 || hid == 0 || hid > 512)
+				return SIZE_MAX;
+		}
+		return hid | tree;
 	}
 	return SIZE_MAX;
 }
 
+#define BSUM_JOBS_MAX 256
+
+size_t bsumParseJobs(const char* opt)
+{
+	size_t jobs;
+	if (!strStartsWith(opt, "-j"))
+		return SIZE_MAX;
+	opt += strLen("-j");
+	if (!*opt)
+		return MAX2(mtProcCount(), 1);
+	if (strLen(opt) > 3 || !decIsValid(opt) || decCLZ(opt) ||
+		(jobs = (size_t)decToU32(opt)) == 0 || jobs > BSUM_JOBS_MAX)
+		return SIZE_MAX;
+	return jobs;
+}
+
 /*
 *******************************************************************************
 Хэширование
 *******************************************************************************
 */
 
+static err_t bsumHashStream(octet hash[], size_t hid, const char* filename)
+{
+	MEM_ALIGNED(MEM_ALIGN) octet state[4096];
+	err_t code;
+	// хэшировать
+	ASSERT(beltHash_keep() <= sizeof(state));
+	ASSERT(bashHash_keep() <= sizeof(state));
+	if (hid)
+	{
+		bashHashStart(state, hid / 2);
+		code = cmdFileStream(filename, SIZE_MAX, bashHashStepH, state);
+	}
+	else
+	{
+		beltHashStart(state);
+		code = cmdFileStream(filename, SIZE_MAX, beltHashStepH, state);
+	}
+	ERR_CALL_CHECK(code);
+	// завершить
+	hid ? bashHashStepG(hash, hid / 8, state) : beltHashStepG(hash, state);
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Мультихэширование
+
+Если задано несколько алгоритмов, то файл прочитывается один раз и каждый
+фрагмент передается всем алгоритмам с помощью связки bashMD. Хэш-значения
+алгоритмов записываются подряд в порядке их следования в командной строке.
+*******************************************************************************
+*/
+
+static size_t bsumHashLen(size_t hid)
+{
+	return hid ? hid / 8 : 32;
+}
+
+static size_t bsumMDAlg(size_t hid)
+{
+	return hid ? hid / 2 : BASH_MD_BELT_HASH;
+}
+
+static void bsumTag(char tag[], size_t hid)
+{
+	if (hid)
+		sprintf(tag, "BASH%u", (unsigned)hid);
+	else
+		strCopy(tag, "BELT-HASH");
+}
+
+static err_t bsumHashStreamMD(octet hash[], size_t algs, const size_t hid[],
+	const char* filename)
+{
+	size_t alg[BSUM_ALGS];
+	void* state;
+	err_t code;
+	size_t i;
+	ASSERT(0 < algs && algs <= BSUM_ALGS);
+	// подготовить состояние
+	for (i = 0; i < algs; ++i)
+		alg[i] = bsumMDAlg(hid[i]);
+	state = blobCreate(bashMD_keep(algs));
+	if (!state)
+		return ERR_OUTOFMEMORY;
+	code = bashMDStart(state, algs, alg, 0, 0);
+	// хэшировать
+	if (code == ERR_OK)
+		code = cmdFileStream(filename, SIZE_MAX, bashMDStepH, state);
+	if (code == ERR_OK)
+		bashMDStepG(hash, state);
+	// завершить
+	blobClose(state);
+	return code;
+}
+
 int bsumHashFile(octet hash[], size_t hid, const char* filename)
 {
+	err_t code;
+	code = bsumHashStream(hash, hid, filename);
+	if (code != ERR_OK)
+	{
+		printf("%s: FAILED [%s]\n", filename,
+			code == ERR_FILE_OPEN ? "open" : "read");
+		return -1;
+	}
+	return 0;
+}
+
+/*
+*******************************************************************************
+Хэширование в режиме дерева
+
+Файл X разбивается на фрагменты X_0, X_1,..., X_{n-1} длины
+BSUM_CHUNK = 2^18 октетов (последний фрагмент может быть короче, пустой
+файл состоит из одного пустого фрагмента). Хэш-значение файла:
+	Y = bash-hash_l("BSUM-TREE" || <BSUM_CHUNK>_64 || <|X|>_64 ||
+		bash-hash_l(X_0) || bash-hash_l(X_1) || ... || bash-hash_l(X_{n-1})),
+где l = hid / 2, <u>_64 -- 8-октетное представление числа u
+(от младших октетов к старшим).
+
+Фрагменты объединяются в пачки по BSUM_BATCH = 8 фрагментов. Пачки
+распределяются между потоками через атомарный счетчик. Каждый поток
+открывает файл самостоятельно, читает пачку целиком (одним вызовом fread)
+и хэширует фрагменты пачки одновременно с помощью bashHashMulti().
+Число потоков равно числу процессоров, но не превосходит BSUM_THREADS.
+Если потоки не создаются, то все пачки обрабатываются в вызывающем потоке.
+*******************************************************************************
+*/
+
+#define BSUM_CHUNK ((size_t)1 << 18)
+#define BSUM_BATCH 8
+#define BSUM_THREADS 16
+
+#ifdef OS_WIN
+	#define bsumSeek(fp, offset) _fseeki64(fp, (__int64)(offset), SEEK_SET)
+	#define bsumTell(fp) _ftelli64(fp)
+#else
+	#define bsumSeek(fp, offset) fseeko(fp, (off_t)(offset), SEEK_SET)
+	#define bsumTell(fp) ftello(fp)
+#endif
+
+typedef struct
+{
+	const char* filename;	/*< имя файла */
+	size_t hid;				/*< длина хэш-значения в битах */
+	size_t size;			/*< размер файла */
+	size_t n;				/*< число фрагментов */
+	octet* leaves;			/*< хэш-значения фрагментов */
+	size_t next;			/*< номер следующей пачки (+1) */
+	size_t failed;			/*< число ошибок */
+} bsum_tree_st;
+
+static void bsumTreeWorker(void* arg)
+{
+	bsum_tree_st* st = (bsum_tree_st*)arg;
+	const size_t hash_len = st->hid / 8;
+	const void* src[BSUM_BATCH];
+	size_t count[BSUM_BATCH];
+	octet* buf;
+	FILE* fp;
+	size_t first, k, len, i;
+	// подготовить ресурсы
+	buf = (octet*)blobCreate(BSUM_CHUNK * BSUM_BATCH);
+	fp = buf ? fopen(st->filename, "rb") : 0;
+	if (!fp)
+	{
+		blobClose(buf);
+		mtAtomicIncr(&st->failed);
+		return;
+	}
+	// обрабатывать пачки
+	while ((first = (mtAtomicIncr(&st->next) - 1) * BSUM_BATCH) < st->n)
+	{
+		k = MIN2(st->n - first, BSUM_BATCH);
+		len = MIN2(st->size - first * BSUM_CHUNK, k * BSUM_CHUNK);
+		if (bsumSeek(fp, first * BSUM_CHUNK) != 0 ||
+			fread(buf, 1, len, fp) != len)
+		{
+			mtAtomicIncr(&st->failed);
+			break;
+		}
+		for (i = 0; i < k; ++i)
+		{
+			src[i] = buf + i * BSUM_CHUNK;
+			count[i] = MIN2(len - i * BSUM_CHUNK, BSUM_CHUNK);
+		}
+		if (bashHashMulti(st->leaves + first * hash_len, st->hid / 2, k,
+			src, count) != ERR_OK)
+		{
+			mtAtomicIncr(&st->failed);
+			break;
+		}
+	}
+	// завершить
+	fclose(fp);
+	blobClose(buf);
+}
+
+int bsumHashFileTree(octet hash[], size_t hid, const char* filename)
+{
+	bsum_tree_st st[1];
+	mt_thrd_t thrd[BSUM_THREADS];
+	bool_t created[BSUM_THREADS];
+	MEM_ALIGNED(MEM_ALIGN) octet state[4096];
+	octet len[16];
+	size_t threads, i;
 	FILE* fp;
-	octet state[4096];
-	octet buf[4096];
-	size_t count;
-	// открыть файл
+	ASSERT(hid % 32 == 0 && 0 < hid && hid <= 512);
+	// определить размер файла
 	fp = fopen(filename, "rb");
 	if (!fp)
 	{
 		printf("%s: FAILED [open]\n", filename);
 		return -1;
 	}
-	// хэшировать
-	ASSERT(beltHash_keep() <= sizeof(state));
+	if (fseek(fp, 0, SEEK_END) != 0 || bsumTell(fp) < 0)
+	{
+		fclose(fp);
+		printf("%s: FAILED [read]\n", filename);
+		return -1;
+	}
+	memSetZero(st, sizeof(st));
+	st->filename = filename;
+	st->hid = hid;
+	st->size = (size_t)bsumTell(fp);
+	fclose(fp);
+	// подготовить хэш-значения фрагментов
+	st->n = st->size ? (st->size + BSUM_CHUNK - 1) / BSUM_CHUNK : 1;
+	st->leaves = (octet*)blobCreate(st->n * hid / 8);
+	if (!st->leaves)
+	{
+		printf("%s: FAILED [memory]\n", filename);
+		return -1;
+	}
+	// запустить потоки
+	threads = MIN3(mtProcCount(), BSUM_THREADS,
+		(st->n + BSUM_BATCH - 1) / BSUM_BATCH);
+	for (i = 1; i < threads; ++i)
+		created[i] = mtThrdCreate(thrd + i, bsumTreeWorker, st);
+	bsumTreeWorker(st);
+	for (i = 1; i < threads; ++i)
+		if (created[i])
+			mtThrdJoin(thrd + i);
+	if (st->failed)
+	{
+		blobClose(st->leaves);
+		printf("%s: FAILED [read]\n", filename);
+		return -1;
+	}
+	// хэшировать вершину
 	ASSERT(bashHash_keep() <= sizeof(state));
-	hid ? bashHashStart(state, hid / 2) : beltHashStart(state);
-	while (1)
+	bashHashStart(state, hid / 2);
+	bashHashStepH("BSUM-TREE", 9, state);
+	{
+		u64 t[2];
+		t[0] = (u64)BSUM_CHUNK, t[1] = (u64)st->size;
+		u64To(len, 16, t);
+	}
+	bashHashStepH(len, 16, state);
+	bashHashStepH(st->leaves, st->n * hid / 8, state);
+	bashHashStepG(hash, hid / 8, state);
+	// завершить
+	blobClose(st->leaves);
+	return 0;
+}
+
+/*
+*******************************************************************************
+Параллельное хэширование
+
+Файлы обрабатываются окнами по BSUM_WINDOW файлов. Файлы окна
+разбиваются на участки mtPoolFor() в пуле из N - 1 рабочих потоков
+(N задается опцией -j). Без опции -j окно обрабатывается в вызывающем
+потоке. Результаты окна печатаются в исходном порядке файлов.
+
+Внутри участка файлы длины не более BSUM_SMALL прочитываются целиком
+и хэшируются по BSUM_LANES файлов одновременно с помощью beltHashMulti()
+или bashHashMulti(). Длинные файлы хэшируются потоково по одному.
+
+При мультихэшировании все файлы хэшируются потоково с помощью
+bsumHashStreamMD().
+
+Режим дерева в окна не включается: файлы хэшируются последовательно, 
+поскольку каждый из них уже обрабатывается параллельно.
+*******************************************************************************
+*/
+
+#define BSUM_WINDOW 256
+#define BSUM_SMALL ((size_t)1 << 16)
+#define BSUM_LANES 8
+
+typedef struct
+{
+	const char* name;		/*< имя файла */
+	const char* hex;		/*< ожидаемое хэш-значение (режим -c) */
+	char line[1024];		/*< строка checksum_file (режим -c) */
+	octet hash[BSUM_ALGS * 64];	/*< хэш-значения */
+	err_t code;				/*< код ошибки */
+} bsum_job_t;
+
+typedef struct
+{
+	size_t hid;				/*< длина хэш-значения в битах */
+	size_t algs;			/*< число алгоритмов мультихэширования */
+	const size_t* hids;		/*< длины хэш-значений алгоритмов */
+	bsum_job_t* jobs;		/*< задания окна */
+} bsum_par_st;
+
+static void bsumParFlush(bsum_par_st* st, size_t k, const void* src[],
+	const size_t count[], const size_t idx[])
+{
+	octet hashes[BSUM_LANES * 64];
+	const size_t hash_len = st->hid ? st->hid / 8 : 32;
+	err_t code;
+	size_t i;
+	if (k == 0)
+		return;
+	if (st->hid)
+		code = bashHashMulti(hashes, st->hid / 2, k, src, count);
+	else
+		code = beltHashMulti(hashes, k, src, count);
+	for (i = 0; i < k; ++i)
+	{
+		st->jobs[idx[i]].code = code;
+		memCopy(st->jobs[idx[i]].hash, hashes + i * hash_len, hash_len);
+	}
+}
+
+static void bsumParRange(size_t from, size_t to, void* arg)
+{
+	bsum_par_st* st = (bsum_par_st*)arg;
+	const void* src[BSUM_LANES];
+	size_t count[BSUM_LANES];
+	size_t idx[BSUM_LANES];
+	octet* buf;
+	size_t k = 0;
+	// подготовить буфер
+	buf = (octet*)blobCreate(BSUM_LANES * BSUM_SMALL);
+	// обработать файлы
+	for (; from < to; ++from)
 	{
-		count = fread(buf, 1, sizeof(buf), fp);
-		if (count == 0)
+		bsum_job_t* job = st->jobs + from;
+		size_t size;
+		// мультихэширование?
+		if (st->algs > 1)
 		{
-			if (ferror(fp))
-			{
-				fclose(fp);
-				printf("%s: FAILED [read]\n", filename);
-				return -1;
-			}
-			break;
+			job->code = bsumHashStreamMD(job->hash, st->algs, st->hids,
+				job->name);
+			continue;
+		}
+		size = cmdFileSize(job->name);
+		// короткий файл?
+		if (buf && size != SIZE_MAX && size <= BSUM_SMALL)
+		{
+			job->code = cmdFileReadAll(buf + k * BSUM_SMALL, &size, job->name);
+			if (job->code != ERR_OK)
+				continue;
+			src[k] = buf + k * BSUM_SMALL, count[k] = size, idx[k++] = from;
+			if (k == BSUM_LANES)
+				bsumParFlush(st, k, src, count, idx), k = 0;
+			continue;
 		}
-		hid ? bashHashStepH(buf, count, state) : 
-			beltHashStepH(buf, count, state);
+		// длинный файл
+		job->code = bsumHashStream(job->hash, st->hid, job->name);
 	}
+	bsumParFlush(st, k, src, count, idx);
 	// завершить
-	fclose(fp);
-	hid ? bashHashStepG(hash, hid / 8, state) : beltHashStepG(hash, state);
-	return 0;
+	blobClose(buf);
+}
+
+static void bsumParRun(mt_pool_t pool, bsum_par_st* st, size_t n)
+{
+	if (pool)
+		mtPoolFor(pool, n, bsumParRange, st);
+	else
+		bsumParRange(0, n, st);
+}
+
+static void bsumParReport(const bsum_job_t* job)
+{
+	printf("%s: FAILED [%s]\n", job->name,
+		job->code == ERR_FILE_OPEN ? "open" :
+		job->code == ERR_OUTOFMEMORY ? "memory" : "read");
 }
 
-int bsumPrint(size_t hid, int argc, char* argv[])
+int bsumPrint(size_t algs, const size_t hids[], size_t jobs, int argc,
+	char* argv[])
 {
+	const size_t hid = hids[0];
 	octet hash[64];
 	char str[64 * 2 + 8];
+	char tag[16];
 	int ret = 0;
-	for (; argc--; argv++)
+	mt_pool_t pool = 0;
+	bsum_par_st st[1];
+	size_t n, i, j, pos;
+	ASSERT(0 < algs && algs <= BSUM_ALGS);
+	// режим дерева
+	if (hid & BSUM_TREE)
 	{
-		if (bsumHashFile(hash, hid, argv[0]) != 0)
+		for (; argc--; argv++)
 		{
-			ret = -1;
-			continue;
+			if (bsumHashFileTree(hash, hid & ~BSUM_TREE, argv[0]) != 0)
+			{
+				ret = -1;
+				continue;
+			}
+			hexFrom(str, hash, (hid & ~BSUM_TREE) / 8);
+			hexLower(str);
+			printf("BASH%u-TREE (%s) = %s\n", (unsigned)(hid & ~BSUM_TREE),
+				argv[0], str);
+		}
+		return ret;
+	}
+	// подготовить окно
+	st->hid = hid;
+	st->algs = algs;
+	st->hids = hids;
+	st->jobs = (bsum_job_t*)blobCreate(BSUM_WINDOW * sizeof(bsum_job_t));
+	if (!st->jobs)
+	{
+		printf("bee2cmd/%s: FAILED [memory]\n", _name);
+		return -1;
+	}
+	if (jobs > 1)
+		pool = mtPoolCreate(jobs - 1);
+	// цикл по окнам
+	for (; argc > 0; argc -= (int)n, argv += n)
+	{
+		n = MIN2((size_t)argc, BSUM_WINDOW);
+		for (i = 0; i < n; ++i)
+			st->jobs[i].name = argv[i];
+		bsumParRun(pool, st, n);
+		for (i = 0; i < n; ++i)
+		{
+			if (st->jobs[i].code != ERR_OK)
+			{
+				bsumParReport(st->jobs + i);
+				ret = -1;
+				continue;
+			}
+			if (algs == 1)
+			{
+				hexFrom(str, st->jobs[i].hash, bsumHashLen(hid));
+				hexLower(str);
+				printf("%s  %s\n", str, st->jobs[i].name);
+				continue;
+			}
+			for (j = pos = 0; j < algs; pos += bsumHashLen(hids[j++]))
+			{
+				hexFrom(str, st->jobs[i].hash + pos, bsumHashLen(hids[j]));
+				hexLower(str);
+				bsumTag(tag, hids[j]);
+				printf("%s (%s) = %s\n", tag, st->jobs[i].name, str);
+			}
 		}
-		hexFrom(str, hash, hid ? hid / 8 : 32);
-		hexLower(str);
-		printf("%s  %s\n", str, argv[0]);
 	}
+	// завершить
+	if (pool)
+		mtPoolClose(pool);
+	blobClose(st->jobs);
 	return ret;
 }
 
-int bsumCheck(size_t hid, const char* filename)
+int bsumCheck(size_t hid, size_t jobs, const char* filename)
 {
 	octet hash[64];
 	size_t hash_len;
-	char str[1024];
+	char* str;
 	size_t str_len;
+	char tag[32];
+	size_t tag_len;
+	char* name;
+	char* hex;
 	FILE* fp;
+	mt_pool_t pool = 0;
+	bsum_par_st st[1];
+	size_t n = 0, i;
+	bool_t eof = FALSE;
 	size_t all_lines = 0;
 	size_t bad_lines = 0;
 	size_t bad_files = 0;
 	size_t bad_hashes = 0;
 	// длина хэш-значения в байтах
-	hash_len = hid ? hid / 8 : 32;
+	hash_len = (hid & ~BSUM_TREE) ? (hid & ~BSUM_TREE) / 8 : 32;
+	// префикс строк в режиме дерева
+	sprintf(tag, "BASH%u-TREE (", (unsigned)(hid & ~BSUM_TREE));
+	tag_len = strLen(tag);
 	// открыть checksum_file
 	fp = fopen(filename, "rb");
 	if (!fp)
@@ -161,37 +614,264 @@ int bsumCheck(size_t hid, const char* filename)
 		printf("%s: No such file\n", filename);
 		return -1;
 	}
-	for (; fgets(str, sizeof(str), fp); ++all_lines)
+	// подготовить окно
+	st->hid = hid;
+	st->algs = 1;
+	st->hids = 0;
+	st->jobs = (bsum_job_t*)blobCreate(BSUM_WINDOW * sizeof(bsum_job_t));
+	if (!st->jobs)
 	{
-		// проверить строку
-		str_len = strLen(str);
-		if (str_len < hash_len * 2 + 2 || 
-			str[2 * hash_len] != ' ' || 
-			str[2 * hash_len + 1] != ' ' ||
-			(str[hash_len * 2] = 0, !hexIsValid(str)))
+		fclose(fp);
+		printf("bee2cmd/%s: FAILED [memory]\n", _name);
+		return -1;
+	}
+	if (jobs > 1 && !(hid & BSUM_TREE))
+		pool = mtPoolCreate(jobs - 1);
+	while (!eof)
+	{
+		// прочитать строку
+		str = st->jobs[n].line;
+		if (!fgets(str, sizeof(st->jobs[n].line), fp))
+			eof = TRUE;
+		else
 		{
-			bad_lines++;
-			continue;
+			++all_lines;
+			str_len = strLen(str);
+			// режим дерева: "BASHNNN-TREE (<file>) = <hash>"
+			if (hid & BSUM_TREE)
+			{
+				if (str_len && str[str_len - 1] == '\n')
+					str[--str_len] = 0;
+				if (str_len && str[str_len - 1] == '\r')
+					str[--str_len] = 0;
+				if (!strStartsWith(str, tag) ||
+					str_len < tag_len + 4 + 2 * hash_len ||
+					!strStartsWith(str + str_len - 2 * hash_len - 4, ") = ") ||
+					!hexIsValid(str + str_len - 2 * hash_len))
+				{
+					bad_lines++;
+					continue;
+				}
+				name = str + tag_len;
+				hex = str + str_len - 2 * hash_len;
+				hex[-4] = 0;
+				// хэшировать
+				if (bsumHashFileTree(hash, hid & ~BSUM_TREE, name) == -1)
+				{
+					bad_files++;
+					continue;
+				}
+				if (!hexEq(hash, hex))
+				{
+					bad_hashes++;
+					printf("%s: FAILED [checksum]\n", name);
+					continue;
+				}
+				printf("%s: OK\n", name);
+				continue;
+			}
+			// проверить строку
+			if (str_len < hash_len * 2 + 2 || 
+				str[2 * hash_len] != ' ' || 
+				str[2 * hash_len + 1] != ' ' ||
+				(str[hash_len * 2] = 0, !hexIsValid(str)))
+			{
+				bad_lines++;
+				continue;
+			}
+			// выделить имя файла
+			if(str[str_len - 1] == '\n') 
+				str[--str_len] = 0;
+			if(str[str_len - 1] == '\r') 
+				str[--str_len] = 0;
+			// поставить задание
+			st->jobs[n].name = str + 2 * hash_len + 2;
+			st->jobs[n].hex = str;
+			if (++n < BSUM_WINDOW)
+				continue;
+		}
+		// обработать окно
+		bsumParRun(pool, st, n);
+		for (i = 0; i < n; ++i)
+		{
+			if (st->jobs[i].code != ERR_OK)
+			{
+				bsumParReport(st->jobs + i);
+				bad_files++;
+				continue;
+			}
+			if (!hexEq(st->jobs[i].hash, st->jobs[i].hex))
+			{
+				bad_hashes++;
+				printf("%s: FAILED [checksum]\n", st->jobs[i].name);
+				continue;
+			}
+			printf("%s: OK\n", st->jobs[i].name);
+		}
+		n = 0;
+	}
+	// завершить
+	if (pool)
+		mtPoolClose(pool);
+	blobClose(st->jobs);
+	fclose(fp);
+	if (bad_lines)
+		fprintf(stderr, bad_lines == 1 ? 
+			"WARNING: %lu input line (out of %lu) is improperly formatted\n" :
+			"WARNING: %lu input lines (out of %lu) are improperly formatted\n",
+			(unsigned long)bad_lines, (unsigned long)all_lines);
+	if (bad_files)
+		fprintf(stderr, bad_files == 1 ? 
+			"WARNING: %lu listed file could not be opened or read\n" :
+			"WARNING: %lu listed files could not be opened or read\n", 
+			(unsigned long)bad_files);
+	if (bad_hashes)
+		fprintf(stderr, bad_hashes == 1 ? 
+			"WARNING: %lu computed checksum did not match\n":  
+			"WARNING: %lu computed checksums did not match\n",  
+			(unsigned long)bad_hashes);
+	return (bad_lines || bad_files || bad_hashes) ? -1 : 0;
+}
+
+/*
+*******************************************************************************
+Проверка при мультихэшировании
+
+Строки checksum_file имеют формат "<tag> (<file>) = <hash>", где tag ---
+метка одного из заданных алгоритмов. Подряд идущие строки с одинаковыми
+именами файлов объединяются в группу, файл группы прочитывается один раз.
+Группы обрабатываются последовательно, опция -j в этом режиме
+не используется.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	char line[1024];		/*< строка checksum_file */
+	size_t hid;				/*< длина хэш-значения в битах */
+	char* name;				/*< имя файла */
+	char* hex;				/*< ожидаемое хэш-значение */
+} bsum_md_line_t;
+
+static bool_t bsumParseTagged(bsum_md_line_t* line, size_t algs,
+	const size_t hids[])
+{
+	char* str = line->line;
+	size_t str_len = strLen(str);
+	char tag[32];
+	size_t tag_len, hash_len, i;
+	// отбросить конец строки
+	if (str_len && str[str_len - 1] == '\n')
+		str[--str_len] = 0;
+	if (str_len && str[str_len - 1] == '\r')
+		str[--str_len] = 0;
+	// найти алгоритм
+	for (i = 0; i < algs; ++i)
+	{
+		bsumTag(tag, hids[i]);
+		tag_len = strLen(tag);
+		tag[tag_len++] = ' ', tag[tag_len++] = '(', tag[tag_len] = 0;
+		if (strStartsWith(str, tag))
+			break;
+	}
+	if (i == algs)
+		return FALSE;
+	// разобрать строку
+	hash_len = bsumHashLen(hids[i]);
+	if (str_len < tag_len + 4 + 2 * hash_len ||
+		!strStartsWith(str + str_len - 2 * hash_len - 4, ") = ") ||
+		!hexIsValid(str + str_len - 2 * hash_len))
+		return FALSE;
+	line->hid = hids[i];
+	line->name = str + tag_len;
+	line->hex = str + str_len - 2 * hash_len;
+	line->hex[-4] = 0;
+	return TRUE;
+}
+
+static void bsumCheckGroup(const bsum_md_line_t lines[], size_t k,
+	size_t* bad_files, size_t* bad_hashes)
+{
+	size_t hids[BSUM_ALGS];
+	octet hash[BSUM_ALGS * 64];
+	err_t code;
+	size_t i, pos;
+	if (k == 0)
+		return;
+	// хэшировать файл
+	for (i = 0; i < k; ++i)
+		hids[i] = lines[i].hid;
+	code = bsumHashStreamMD(hash, k, hids, lines[0].name);
+	if (code != ERR_OK)
+	{
+		printf("%s: FAILED [%s]\n", lines[0].name,
+			code == ERR_FILE_OPEN ? "open" :
+			code == ERR_OUTOFMEMORY ? "memory" : "read");
+		++*bad_files;
+		return;
+	}
+	// проверить хэш-значения
+	for (i = pos = 0; i < k; pos += bsumHashLen(hids[i++]))
+		if (!hexEq(hash + pos, lines[i].hex))
+		{
+			++*bad_hashes;
+			printf("%s: FAILED [checksum]\n", lines[i].name);
 		}
-		// выделить имя файла
-		if(str[str_len - 1] == '\n') 
-			str[--str_len] = 0;
-		if(str[str_len - 1] == '\r') 
-			str[--str_len] = 0;
-		// хэшировать
-		if (bsumHashFile(hash, hid, str + 2 * hash_len + 2) == -1)
+		else
+			printf("%s: OK\n", lines[i].name);
+}
+
+int bsumCheckMD(size_t algs, const size_t hids[], const char* filename)
+{
+	bsum_md_line_t* lines;
+	FILE* fp;
+	size_t k = 0;
+	size_t all_lines = 0;
+	size_t bad_lines = 0;
+	size_t bad_files = 0;
+	size_t bad_hashes = 0;
+	ASSERT(1 < algs && algs <= BSUM_ALGS);
+	// открыть checksum_file
+	fp = fopen(filename, "rb");
+	if (!fp)
+	{
+		printf("%s: No such file\n", filename);
+		return -1;
+	}
+	// подготовить группу (+1 строка для чтения)
+	lines = (bsum_md_line_t*)blobCreate((BSUM_ALGS + 1) *
+		sizeof(bsum_md_line_t));
+	if (!lines)
+	{
+		fclose(fp);
+		printf("bee2cmd/%s: FAILED [memory]\n", _name);
+		return -1;
+	}
+	// цикл по строкам
+	while (fgets(lines[k].line, sizeof(lines[k].line), fp))
+	{
+		++all_lines;
+		if (!bsumParseTagged(lines + k, algs, hids))
 		{
-			bad_files++;
+			bad_lines++;
 			continue;
 		}
-		if (!hexEq(hash, str))
+		// продолжить группу?
+		if (k == 0 || (k < BSUM_ALGS && strEq(lines[k].name, lines[0].name)))
 		{
-			bad_hashes++;
-			printf("%s: FAILED [checksum]\n", str + 2 * hash_len + 2);
+			++k;
 			continue;
 		}
-		printf("%s: OK\n", str + 2 * hash_len + 2);
+		// обработать группу и начать новую
+		bsumCheckGroup(lines, k, &bad_files, &bad_hashes);
+		memCopy(lines, lines + k, sizeof(bsum_md_line_t));
+		lines[0].name = lines[0].line + (lines[k].name - lines[k].line);
+		lines[0].hex = lines[0].line + (lines[k].hex - lines[k].line);
+		k = 1;
 	}
+	bsumCheckGroup(lines, k, &bad_files, &bad_hashes);
+	// завершить
+	blobClose(lines);
 	fclose(fp);
 	if (bad_lines)
 		fprintf(stderr, bad_lines == 1 ? 
@@ -219,33 +899,47 @@ int bsumCheck(size_t hid, const char* filename)
 
 int bsumMain(int argc, char* argv[])
 {
-	size_t hid = 0;
+	size_t hids[BSUM_ALGS];
+	size_t algs = 0;
+	size_t jobs = 0;
+	size_t t, i;
 #ifdef OS_WIN
 	setlocale(LC_ALL, "russian_belarus.1251");
 #endif
 	if (argc < 2)
 		return bsumUsage();
-	// check mode?
-	if (3 <= argc && argc <= 4 && strEq(argv[argc - 2], "-c"))
+	--argc, ++argv;
+	// hash_alg...
+	while (argc > 1 && (t = bsumParseHid(argv[0])) != SIZE_MAX)
 	{
-		if (argc == 4)
-		{
-			hid = bsumParseHid(argv[1]);
-			if (hid == SIZE_MAX)
+		if (algs == BSUM_ALGS)
+			return bsumUsage();
+		for (i = 0; i < algs; ++i)
+			if (hids[i] == t)
 				return bsumUsage();
-		}
-		return bsumCheck(hid, argv[argc - 1]);
+		hids[algs++] = t, --argc, ++argv;
 	}
-	// print mode
-	if (argc > 2)
+	if (algs == 0)
+		hids[algs++] = 0;
+	// режим дерева -- только для одного алгоритма
+	if (algs > 1)
+		for (i = 0; i < algs; ++i)
+			if (hids[i] & BSUM_TREE)
+				return bsumUsage();
+	// -j
+	if (argc > 1 && (t = bsumParseJobs(argv[0])) != SIZE_MAX)
+		jobs = t, --argc, ++argv;
+	// check mode?
+	if (argc >= 2 && strEq(argv[argc - 2], "-c"))
 	{
-		hid = bsumParseHid(argv[1]);
-		if (hid != SIZE_MAX)
-			argc--, argv++;
-		else
-			hid = 0;
+		if (argc != 2)
+			return bsumUsage();
+		if (algs > 1)
+			return bsumCheckMD(algs, hids, argv[1]);
+		return bsumCheck(hids[0], jobs, argv[1]);
 	}
-	return bsumPrint(hid, argc - 1, argv + 1);
+	// print mode
+	return bsumPrint(algs, hids, jobs, argc, argv);
 }
 
 /*
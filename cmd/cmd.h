@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2
 \project bee2/cmd
 \created 2022.06.09
-\version 2022.10.31
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -64,6 +64,20 @@ err_t cmdReg(
 	cmd_main_i fn			/*!< [in] главная функция команды */
 );
 
+/*!	\brief Выполнение команды
+
+	Выполняется зарегистрированная команда с именем argv[0]. Команде
+	передаются параметры [argc]argv.
+	\return Код возврата главной функции команды или -1, если команда
+	не найдена.
+	\remark Функция используется как в main(), так и в пакетном режиме
+	(см. команду batch).
+*/
+int cmdRun(
+	int argc,				/*!< [in] число параметров */
+	char* argv[]			/*!< [in] параметры */
+);
+
 /*
 *******************************************************************************
 Терминал
@@ -173,6 +187,43 @@ err_t cmdFileReadAll(
 	const char* file	/*!< [in] файл */
 );
 
+/*!	\brief Потоковое чтение файла
+
+	Первые size октетов файла file (весь файл, если size == SIZE_MAX)
+	последовательно передаются обработчику step: выполняются вызовы
+	step(buf, count, state) для последовательных фрагментов [count]buf.
+	Длинные файлы отображаются в память, короткие прочитываются через
+	большой выровненный буфер. Подготовка следующего фрагмента
+	(подкачка страниц или чтение) выполняется во вспомогательном
+	потоке параллельно с обработкой текущего.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark Функции beltHashStepH(), bashHashStepH() и подобные им
+	можно передавать в качестве обработчика непосредственно.
+*/
+err_t cmdFileStream(
+	const char* file,	/*!< [in] файл */
+	size_t size,		/*!< [in] число обрабатываемых октетов */
+	void (*step)(const void* buf, size_t count, void* state),
+						/*!< [in] обработчик фрагментов */
+	void* state			/*!< [in,out] состояние обработчика */
+);
+
+/*!	\brief Потоковая обработка отображения файла
+
+	Буфер [count]buf, который является отображением файла в память,
+	передается обработчику step фрагментами. Пока обрабатывается текущий
+	фрагмент, вспомогательный поток подкачивает страницы следующего.
+	\remark Результат совпадает с результатом вызова step(buf, count, state)
+	для обработчиков, подобных beltHashStepH().
+*/
+void cmdMemStream(
+	const void* buf,	/*!< [in] отображение */
+	size_t count,		/*!< [in] длина отображения */
+	void (*step)(const void* buf, size_t count, void* state),
+						/*!< [in] обработчик фрагментов */
+	void* state			/*!< [in,out] состояние обработчика */
+);
+
 /*!	\brief Проверка отсутствия файлов
 
 	Проверяется, что файлы списка [count]files отсутствуют и, таким образом,
@@ -388,6 +439,26 @@ err_t cmdPrivkeyRead(
 	const cmd_pwd_t pwd				/*!< [in] пароль защиты */
 );
 
+/*!	\brief Запуск кэша личных ключей
+
+	Запускается кэш личных ключей, прочитанных функцией cmdPrivkeyRead().
+	Повторное чтение того же контейнера на том же пароле обслуживается
+	кэшем без снятия защиты. Ключ удаляется из кэша через timeout секунд
+	после занесения.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark Кэш предназначен для пакетного режима (см. команду batch).
+	При timeout == 0 кэш не запускается.
+*/
+err_t cmdPrivkeyCacheStart(
+	size_t timeout					/*!< [in] время жизни ключей (с) */
+);
+
+/*!	\brief Закрытие кэша личных ключей
+
+	Кэш личных ключей закрывается, сохраненные в нем ключи уничтожаются.
+*/
+void cmdPrivkeyCacheClose();
+
 /*
 *******************************************************************************
 CV-сертификаты
@@ -400,7 +471,7 @@ CV-сертификаты
 	\return ERR_OK, если печать успешно выполнена, и код ошибки
 	в противном случае. 
 */
-err_t cmdCVCPrint(btok_cvc_t* cvc);
+err_t cmdCVCPrint(const btok_cvc_t* cvc);
 
 /*
 *******************************************************************************
@@ -472,6 +543,31 @@ err_t cmdSigSign(
 	size_t privkey_len			/*!< [in] длина личного ключа */
 );
 
+/*!	\brief Пакетная подпись файлов
+
+	Для каждой пары <file> <sig_file> из списка [argc]argv содержимое
+	файла file подписывается на личном ключе [privkey_len]privkey, подпись
+	сохраняется в файле sig_file вместе с сертификатами цепочки certs
+	(см. cmdSigSign()).
+	\expect{ERR_BAD_KEYPAIR} Если цепочка certs непуста, то ее первый
+	сертификат соответствует privkey.
+	\expect{ERR_BAD_CERT} Если цепочка certs непуста, то каждый ее сертификат,
+	начиная со второго, -- это сертификат удостоверяющего центра, выпустившего
+	предыдущий сертификат.
+	\return ERR_OK, если все файлы успешно подписаны, и код ошибки первой
+	необработанной пары в противном случае.
+	\remark Цепочка certs собирается и проверяется один раз. Пары
+	обрабатываются параллельно (см. mtPoolFor()). Ошибка при обработке
+	одной пары не прерывает обработку других.
+*/
+err_t cmdSigSignBatch(
+	int argc,					/*!< [in] число имен (четное) */
+	char* argv[],				/*!< [in] пары <file> <sig_file> */
+	const char* certs,			/*!< [in] цепочка сертификатов */
+	const octet privkey[],		/*!< [in] личный ключ */
+	size_t privkey_len			/*!< [in] длина личного ключа */
+);
+
 /*!	\brief Проверка подписи файла на открытом ключе
 
 	Подпись содержимого файла file, размещенная в sig_file, проверяется
@@ -504,6 +600,11 @@ err_t cmdSigVerify(
 	  сертификат удостоверяющего центра, выпустившего предыдущий сертификат;
 	- подпись признается корректной на первом сертификате цепочки;
 	- один из сертификатов цепочки совпадает с [anchor_len]anchor.
+	Буфер [anchor_len]anchor может содержать набор из нескольких
+	последовательно записанных доверенных сертификатов. Тогда один из
+	сертификатов цепочки должен совпасть с одним из сертификатов набора.
+	Набор загружается в хранилище (см. btokCVCStoreStart()), и поиск
+	в нем не зависит от числа доверенных сертификатов.
 	В качестве файла подписи может указывать подписываемый файл, и тогда подпись
 	прочитывается из его конца и исключается из содержимого файла при проверке.
 	\expect{ERR_BAD_FORMAT} Если подпись размещается в отдельном файле, то этот
@@ -513,10 +614,32 @@ err_t cmdSigVerify(
 err_t cmdSigVerify2(
 	const char* file,			/*!< [in] подписанный файл */
 	const char* sig_file,		/*!< [in] файл подписи */
-	const octet anchor[],		/*!< [in] доверенный сертификат */
+	const octet anchor[],		/*!< [in] доверенные сертификаты */
 	size_t anchor_len			/*!< [in] длина anchor */
 );
 
+/*!	\brief Пакетная проверка подписей файлов на доверенном сертификате
+
+	Для каждой пары <file> <sig_file> из списка [argc]argv подпись
+	содержимого файла file, размещенная в sig_file, проверяется на доверенном
+	сертификате [anchor_len]anchor (см. cmdSigVerify2()). Если codes != 0,
+	то в codes[i] возвращается результат проверки i-ой пары.
+	\return ERR_OK, если все подписи корректны, и код ошибки первой
+	непрошедшей проверку пары в противном случае.
+	\remark Набор доверенных сертификатов [anchor_len]anchor загружается
+	в хранилище один раз для всех пар.
+	\remark Совпадающие цепочки сертификатов проверяются один раз. Файлы
+	хэшируются параллельно (см. mtPoolFor()). Подписи проверяются
+	пакетами (см. bignVerifyBatch()).
+*/
+err_t cmdSigVerifyBatch(
+	int argc,					/*!< [in] число имен (четное) */
+	char* argv[],				/*!< [in] пары <file> <sig_file> */
+	const octet anchor[],		/*!< [in] доверенный сертификат */
+	size_t anchor_len,			/*!< [in] длина anchor */
+	err_t codes[]				/*!< [out] результаты проверки */
+);
+
 /*!	\brief Самопроверка подписи на открытом ключе
 
 	Подпись исполнимого файла, в котором вызывается данная функция,
@@ -553,6 +676,19 @@ err_t cmdSigPrint(
 	const char* sig_file		/*!< [in] файл подписи */
 );
 
+/*!	\brief Запуск кэша сертификатов
+
+	Запускается кэш пар сертификатов (эмитент, издатель), успешно
+	проверенных при разборе цепочек в функциях cmdSigVerify(),
+	cmdSigVerify2() и cmdSigVerifyBatch(). Подпись сертификата из пары,
+	найденной в кэше, повторно не проверяется.
+	\remark Кэш предназначен для пакетного режима (см. команду batch).
+*/
+void cmdSigCacheStart();
+
+/*!	\brief Закрытие кэша сертификатов */
+void cmdSigCacheClose();
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2: main
 \project bee2/cmd
 \created 2022.06.07
-\version 2022.11.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -54,6 +54,17 @@ err_t cmdReg(const char* name, const char* descr, cmd_main_i fn)
 	return ERR_OK;
 }
 
+int cmdRun(int argc, char* argv[])
+{
+	size_t pos;
+	ASSERT(argc > 0);
+	for (pos = 0; pos < _count; ++pos)
+		if (strEq(argv[0], _cmds[pos].name))
+			return _cmds[pos].fn(argc, argv);
+	printf("bee2cmd: %s\n", errMsg(ERR_CMD_NOT_FOUND));
+	return -1;
+}
+
 /*
 *******************************************************************************
 Справка
@@ -116,6 +127,9 @@ extern err_t kgInit();
 extern err_t cvcInit();
 extern err_t sigInit();
 extern err_t esInit();
+extern err_t envInit();
+extern err_t batchInit();
+extern err_t benchInit();
 #ifdef OS_WIN
 extern err_t stampInit();
 #endif
@@ -138,6 +152,12 @@ err_t cmdInit()
 	ERR_CALL_CHECK(code);
     code = esInit();
 	ERR_CALL_CHECK(code);
+	code = envInit();
+	ERR_CALL_CHECK(code);
+	code = batchInit();
+	ERR_CALL_CHECK(code);
+	code = benchInit();
+	ERR_CALL_CHECK(code);
 #ifdef OS_WIN
 	code = stampInit();
 	ERR_CALL_CHECK(code);
@@ -154,7 +174,6 @@ err_t cmdInit()
 int main(int argc, char* argv[])
 {
 	err_t code;
-	size_t pos;
 	// старт
 	code = cmdInit();
 	if (code != ERR_OK)
@@ -168,9 +187,5 @@ int main(int argc, char* argv[])
 	// демонстрационный контроль целостности (результат игнорируется!)
 	cmdSelfCheck();
 	// обработка команды
-	for (pos = 0; pos < _count; ++pos)
-		if (strEq(argv[1], _cmds[pos].name))
-			return _cmds[pos].fn(argc - 1,  argv + 1);
-	printf("bee2cmd: %s\n", errMsg(ERR_CMD_NOT_FOUND));
-	return -1;
+	return cmdRun(argc - 1, argv + 1);
 }
@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2: manage files
 \project bee2/cmd 
 \created 2022.06.08
-\version 2022.10.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -14,6 +14,7 @@
 #include <bee2/core/blob.h>
 #include <bee2/core/err.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
 #include <stdio.h>
@@ -92,6 +93,354 @@ err_t cmdFileReadAll(octet buf[], size_t* count, const char* file)
 	return code;
 }
 
+/*
+*******************************************************************************
+Потоковое чтение
+
+Файлы, длина которых не меньше CMD_FILE_MAP_MIN, отображаются в память
+окнами по CMD_FILE_VIEW октетов (mmap() в Unix, MapViewOfFile() в Windows).
+Системе сообщается, что доступ к окнам будет последовательным
+(madvise(MADV_SEQUENTIAL)). Если отобразить окно не удается, то оставшаяся
+часть файла прочитывается через буфер.
+
+Короткие файлы, а также файлы, которые не удалось отобразить, прочитываются
+в буфер длины CMD_FILE_BUF, выровненный на границу страницы. Системе
+сообщается о последовательном чтении (posix_fadvise(POSIX_FADV_SEQUENTIAL)
+в Unix, флаг FILE_FLAG_SEQUENTIAL_SCAN в Windows).
+
+Чтение и обработка совмещаются: пока обработчик step обрабатывает текущий
+фрагмент, вспомогательный поток готовит следующий. Окна отображения
+обрабатываются фрагментами по CMD_FILE_CHUNK октетов (см. cmdMemStream()),
+поток подкачивает страницы следующего фрагмента, обращаясь к ним. При
+чтении через буфер используются два буфера: поток прочитывает следующий
+фрагмент во второй буфер. Поток создается на каждый фрагмент, что
+при длине фрагмента не менее CMD_FILE_BUF обходится дешевле синхронизации
+постоянного потока. Если поток создать не удается, то следующий фрагмент
+готовится после обработки текущего. В результате длинные файлы
+обрабатываются за время max(I/O, CPU) вместо I/O + CPU.
+
+\warning Если файл укорачивается другим процессом во время чтения через
+отображение, то в Unix процесс может получить сигнал SIGBUS.
+*******************************************************************************
+*/
+
+#define CMD_FILE_MAP_MIN ((size_t)1 << 20)
+#define CMD_FILE_VIEW ((size_t)1 << 26)
+#define CMD_FILE_BUF ((size_t)1 << 20)
+#define CMD_FILE_ALIGN ((size_t)4096)
+#define CMD_FILE_CHUNK ((size_t)1 << 22)
+
+typedef struct
+{
+	const octet* buf;	/*!< фрагмент */
+	size_t count;		/*!< длина фрагмента */
+	octet sum;			/*!< сумма прочитанных октетов */
+} cmd_file_touch_st;
+
+static void cmdFileTouch(void* arg)
+{
+	cmd_file_touch_st* st = (cmd_file_touch_st*)arg;
+	const volatile octet* buf = st->buf;
+	octet sum = 0;
+	size_t pos;
+	for (pos = 0; pos < st->count; pos += CMD_FILE_ALIGN)
+		sum ^= buf[pos];
+	st->sum = sum;
+}
+
+void cmdMemStream(const void* buf, size_t count,
+	void (*step)(const void* buf, size_t count, void* state), void* state)
+{
+	cmd_file_touch_st st[1];
+	mt_thrd_t thrd[1];
+	const octet* ptr = (const octet*)buf;
+	size_t len;
+	bool_t ahead;
+	// pre
+	ASSERT(memIsValid(buf, count));
+	// цикл по фрагментам
+	for (; count; ptr += len, count -= len)
+	{
+		len = MIN2(count, CMD_FILE_CHUNK);
+		// подкачать следующий фрагмент
+		ahead = FALSE;
+		if (count > len)
+		{
+			st->buf = ptr + len;
+			st->count = MIN2(count - len, CMD_FILE_CHUNK);
+			ahead = mtThrdCreate(thrd, cmdFileTouch, st);
+		}
+		// обработать текущий
+		step(ptr, len, state);
+		if (ahead)
+			mtThrdJoin(thrd);
+	}
+}
+
+#if defined OS_UNIX || defined OS_WIN
+
+typedef struct
+{
+	void* file;			/*!< описание файла */
+	octet* buf;			/*!< буфер */
+	size_t count;		/*!< число октетов для чтения */
+	size_t read;		/*!< число прочитанных октетов */
+	err_t code;			/*!< код ошибки */
+} cmd_file_chunk_st;
+
+static err_t cmdFileStreamBuf(void* file, size_t offset, size_t size,
+	void (*reader)(void* arg),
+	void (*step)(const void* buf, size_t count, void* state), void* state)
+{
+	cmd_file_chunk_st chunks[2];
+	mt_thrd_t thrd[1];
+	void* blob;
+	size_t len;
+	size_t i;
+	bool_t ahead;
+	// выделить буферы (второй -- только если данные не умещаются в первом)
+	len = MIN2(size - offset, CMD_FILE_BUF);
+	blob = blobCreate((size - offset > len ? 2 : 1) * len + CMD_FILE_ALIGN);
+	if (!blob)
+		return ERR_OUTOFMEMORY;
+	chunks[0].buf = (octet*)blob + CMD_FILE_ALIGN -
+		(size_t)blob % CMD_FILE_ALIGN;
+	chunks[1].buf = chunks[0].buf + len;
+	chunks[0].file = chunks[1].file = file;
+	// прочитать первый фрагмент
+	chunks[0].count = len;
+	reader(chunks);
+	// цикл по фрагментам
+	for (i = 0; offset < size; i ^= 1)
+	{
+		if (chunks[i].code != ERR_OK)
+			break;
+		offset += chunks[i].read;
+		// прочитать следующий фрагмент
+		ahead = FALSE;
+		if (offset < size)
+		{
+			chunks[i ^ 1].count = MIN2(size - offset, CMD_FILE_BUF);
+			ahead = mtThrdCreate(thrd, reader, chunks + (i ^ 1));
+		}
+		// обработать текущий
+		step(chunks[i].buf, chunks[i].read, state);
+		if (ahead)
+			mtThrdJoin(thrd);
+		else if (offset < size)
+			reader(chunks + (i ^ 1));
+	}
+	blobClose(blob);
+	return offset == size ? ERR_OK : ERR_FILE_READ;
+}
+
+#endif
+
+#if defined OS_UNIX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static void cmdFileReadChunk(void* arg)
+{
+	cmd_file_chunk_st* chunk = (cmd_file_chunk_st*)arg;
+	int fd = *(int*)chunk->file;
+	ssize_t count;
+	chunk->read = 0, chunk->code = ERR_OK;
+	while (chunk->read < chunk->count)
+	{
+		count = read(fd, chunk->buf + chunk->read,
+			chunk->count - chunk->read);
+		if (count == -1 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			break;
+		chunk->read += (size_t)count;
+	}
+	if (chunk->read == 0)
+		chunk->code = ERR_FILE_READ;
+}
+
+err_t cmdFileStream(const char* file, size_t size,
+	void (*step)(const void* buf, size_t count, void* state), void* state)
+{
+	err_t code;
+	struct stat st;
+	int fd;
+	size_t offset = 0;
+	// pre
+	ASSERT(strIsValid(file));
+	// открыть файл
+	fd = open(file, O_RDONLY);
+	if (fd == -1)
+		return ERR_FILE_OPEN;
+	if (fstat(fd, &st) != 0 || st.st_size < 0 ||
+		(size != SIZE_MAX && (u64)size > (u64)st.st_size))
+	{
+		close(fd);
+		return ERR_FILE_READ;
+	}
+	if (size == SIZE_MAX)
+	{
+		if ((u64)st.st_size >= (u64)SIZE_MAX)
+		{
+			close(fd);
+			return ERR_FILE_READ;
+		}
+		size = (size_t)st.st_size;
+	}
+	// отображать окна
+	if (size >= CMD_FILE_MAP_MIN)
+		while (offset < size)
+		{
+			size_t len = MIN2(size - offset, CMD_FILE_VIEW);
+			void* view = mmap(0, len, PROT_READ, MAP_PRIVATE, fd,
+				(off_t)offset);
+			if (view == MAP_FAILED)
+				break;
+			madvise(view, len, MADV_SEQUENTIAL);
+			cmdMemStream(view, len, step, state);
+			munmap(view, len);
+			offset += len;
+		}
+	if (offset == size)
+	{
+		close(fd);
+		return ERR_OK;
+	}
+	// читать через буфер
+#ifdef POSIX_FADV_SEQUENTIAL
+	posix_fadvise(fd, (off_t)offset, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+	if (lseek(fd, (off_t)offset, SEEK_SET) == (off_t)-1)
+		code = ERR_FILE_READ;
+	else
+		code = cmdFileStreamBuf(&fd, offset, size, cmdFileReadChunk, step,
+			state);
+	close(fd);
+	return code;
+}
+
+#elif defined OS_WIN
+
+#include <windows.h>
+
+static void cmdFileReadChunk(void* arg)
+{
+	cmd_file_chunk_st* chunk = (cmd_file_chunk_st*)arg;
+	DWORD count;
+	chunk->read = 0, chunk->code = ERR_OK;
+	while (chunk->read < chunk->count)
+	{
+		if (!ReadFile((HANDLE)chunk->file, chunk->buf + chunk->read,
+			(DWORD)(chunk->count - chunk->read), &count, 0) || count == 0)
+			break;
+		chunk->read += (size_t)count;
+	}
+	if (chunk->read == 0)
+		chunk->code = ERR_FILE_READ;
+}
+
+err_t cmdFileStream(const char* file, size_t size,
+	void (*step)(const void* buf, size_t count, void* state), void* state)
+{
+	err_t code;
+	HANDLE fh;
+	HANDLE mh;
+	LARGE_INTEGER fsize;
+	size_t offset = 0;
+	// pre
+	ASSERT(strIsValid(file));
+	// открыть файл
+	fh = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+		FILE_FLAG_SEQUENTIAL_SCAN, 0);
+	if (fh == INVALID_HANDLE_VALUE)
+		return ERR_FILE_OPEN;
+	if (!GetFileSizeEx(fh, &fsize) ||
+		(u64)fsize.QuadPart >= (u64)SIZE_MAX ||
+		(size != SIZE_MAX && (u64)size > (u64)fsize.QuadPart))
+	{
+		CloseHandle(fh);
+		return ERR_FILE_READ;
+	}
+	if (size == SIZE_MAX)
+		size = (size_t)fsize.QuadPart;
+	// отображать окна
+	if (size >= CMD_FILE_MAP_MIN &&
+		(mh = CreateFileMappingA(fh, 0, PAGE_READONLY, 0, 0, 0)) != 0)
+	{
+		while (offset < size)
+		{
+			size_t len = MIN2(size - offset, CMD_FILE_VIEW);
+			void* view = MapViewOfFile(mh, FILE_MAP_READ,
+				(DWORD)((u64)offset >> 32), (DWORD)offset, len);
+			if (!view)
+				break;
+			cmdMemStream(view, len, step, state);
+			UnmapViewOfFile(view);
+			offset += len;
+		}
+		CloseHandle(mh);
+	}
+	if (offset == size)
+	{
+		CloseHandle(fh);
+		return ERR_OK;
+	}
+	// читать через буфер
+	fsize.QuadPart = (LONGLONG)offset;
+	if (!SetFilePointerEx(fh, fsize, 0, FILE_BEGIN))
+		code = ERR_FILE_READ;
+	else
+		code = cmdFileStreamBuf(fh, offset, size, cmdFileReadChunk, step,
+			state);
+	CloseHandle(fh);
+	return code;
+}
+
+#else
+
+err_t cmdFileStream(const char* file, size_t size,
+	void (*step)(const void* buf, size_t count, void* state), void* state)
+{
+	err_t code = ERR_OK;
+	FILE* fp;
+	octet* buf;
+	size_t count;
+	// pre
+	ASSERT(strIsValid(file));
+	// открыть файл
+	if (!(fp = fopen(file, "rb")))
+		return ERR_FILE_OPEN;
+	if (!(buf = (octet*)blobCreate(CMD_FILE_BUF)))
+	{
+		fclose(fp);
+		return ERR_OUTOFMEMORY;
+	}
+	// читать через буфер
+	while (size)
+	{
+		count = fread(buf, 1, MIN2(size, CMD_FILE_BUF), fp);
+		if (count == 0)
+		{
+			if (ferror(fp) || size != SIZE_MAX)
+				code = ERR_FILE_READ;
+			break;
+		}
+		step(buf, count, state);
+		if (size != SIZE_MAX)
+			size -= count;
+	}
+	blobClose(buf);
+	fclose(fp);
+	return code;
+}
+
+#endif // OS
+
 /*
 *******************************************************************************
 Проверки
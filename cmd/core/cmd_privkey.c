@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2: managing private keys
 \project bee2/cmd 
 \created 2022.06.20
-\version 2022.10.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -18,7 +18,9 @@
 #include <bee2/core/mem.h>
 #include <bee2/core/rng.h>
 #include <bee2/core/str.h>
+#include <bee2/core/tm.h>
 #include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
 #include <bee2/crypto/bign.h>
 #include <bee2/crypto/bpki.h>
 #include <stdio.h>
@@ -72,6 +74,104 @@ err_t cmdPrivkeyWrite(const octet privkey[], size_t privkey_len,
 	return code;
 }
 
+/*
+*******************************************************************************
+Кэш личных ключей
+
+Элемент кэша содержит личный ключ и метку hmac-hbelt(pwd, epki), где
+epki -- содержимое контейнера. Повторное чтение того же контейнера на том
+же пароле приводит к попаданию в кэш и обходится без построения ключа
+защиты (см. bpkiPrivkeyUnwrap()), изменение контейнера или другой пароль
+приводят к промаху.
+
+Элемент устаревает через _timeout секунд после занесения. Устаревшие
+элементы уничтожаются при каждом обращении к кэшу. При переполнении
+вытесняется самый старый элемент. Кэш размещается в блобе.
+*******************************************************************************
+*/
+
+#define CMD_PRIVKEY_CACHE 16
+
+typedef struct
+{
+	octet tag[32];			/*< метка */
+	octet privkey[64];		/*< личный ключ */
+	size_t len;				/*< длина ключа (0 -- элемент свободен) */
+	tm_time_t time;			/*< время занесения */
+} cmd_privkey_item_t;
+
+static cmd_privkey_item_t* _cache;	/*< элементы кэша */
+static size_t _timeout;				/*< время жизни элементов */
+
+err_t cmdPrivkeyCacheStart(size_t timeout)
+{
+	cmdPrivkeyCacheClose();
+	if (timeout == 0)
+		return ERR_OK;
+	_timeout = timeout;
+	return cmdBlobCreate(_cache,
+		CMD_PRIVKEY_CACHE * sizeof(cmd_privkey_item_t));
+}
+
+void cmdPrivkeyCacheClose()
+{
+	cmdBlobClose(_cache);
+	_cache = 0, _timeout = 0;
+}
+
+static void cmdPrivkeyCachePurge(tm_time_t now)
+{
+	size_t pos;
+	ASSERT(_cache);
+	for (pos = 0; pos < CMD_PRIVKEY_CACHE; ++pos)
+		if (_cache[pos].len && (now == TIME_ERR || now < _cache[pos].time ||
+			(size_t)(now - _cache[pos].time) >= _timeout))
+			memWipe(_cache + pos, sizeof(cmd_privkey_item_t));
+}
+
+static bool_t cmdPrivkeyCacheGet(octet privkey[], size_t len,
+	const octet tag[32])
+{
+	size_t pos;
+	ASSERT(_cache);
+	cmdPrivkeyCachePurge(tmTime());
+	for (pos = 0; pos < CMD_PRIVKEY_CACHE; ++pos)
+		if (_cache[pos].len == len && memEq(_cache[pos].tag, tag, 32))
+		{
+			memCopy(privkey, _cache[pos].privkey, len);
+			return TRUE;
+		}
+	return FALSE;
+}
+
+static void cmdPrivkeyCachePut(const octet privkey[], size_t len,
+	const octet tag[32])
+{
+	size_t pos;
+	size_t oldest;
+	tm_time_t now = tmTime();
+	ASSERT(_cache);
+	ASSERT(len <= 64);
+	if (now == TIME_ERR)
+		return;
+	cmdPrivkeyCachePurge(now);
+	// найти свободный или самый старый элемент
+	for (pos = oldest = 0; pos < CMD_PRIVKEY_CACHE; ++pos)
+	{
+		if (!_cache[pos].len)
+			break;
+		if (_cache[pos].time < _cache[oldest].time)
+			oldest = pos;
+	}
+	if (pos == CMD_PRIVKEY_CACHE)
+		pos = oldest;
+	// занести ключ
+	memCopy(_cache[pos].tag, tag, 32);
+	memCopy(_cache[pos].privkey, privkey, len);
+	_cache[pos].len = len;
+	_cache[pos].time = now;
+}
+
 /*
 *******************************************************************************
 Чтение личного ключа
@@ -88,6 +188,7 @@ err_t cmdPrivkeyRead(octet privkey[], size_t* privkey_len, const char* file,
 	size_t epki_len_max;
 	void* stack;
 	octet* epki;
+	octet* tag;
 	FILE* fp;
 	// pre
 	ASSERT(memIsNullOrValid(privkey_len, sizeof(size_t)));
@@ -131,9 +232,10 @@ err_t cmdPrivkeyRead(octet privkey[], size_t* privkey_len, const char* file,
 	ASSERT(len % 16 == 0 && 32 <= len && len <= 64);
 	ASSERT(memIsValid(privkey, len));
 	// выделить память и разметить ее
-	code = cmdBlobCreate(stack, epki_len_max + 1);
+	code = cmdBlobCreate(stack, 32 + epki_len_max + 1);
 	ERR_CALL_CHECK(code);
-	epki = (octet*)stack;
+	tag = (octet*)stack;
+	epki = tag + 32;
 	// прочитать контейнер
 	code = (fp = fopen(file, "rb")) ? ERR_OK : ERR_FILE_OPEN;
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
@@ -142,11 +244,26 @@ err_t cmdPrivkeyRead(octet privkey[], size_t* privkey_len, const char* file,
 	code = (epki_len_min <= epki_len && epki_len <= epki_len_max) ?
 		ERR_OK : ERR_BAD_FORMAT;
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// ключ в кэше?
+	if (_cache)
+	{
+		code = beltHMAC(tag, epki, epki_len, (const octet*)pwd,
+			cmdPwdLen(pwd));
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		if (cmdPrivkeyCacheGet(privkey, len, tag))
+		{
+			cmdBlobClose(stack);
+			return ERR_OK;
+		}
+	}
 	// снять защиту
 	code = bpkiPrivkeyUnwrap(privkey, &epki_len_min, epki, epki_len,
 		(const octet*)pwd, cmdPwdLen(pwd));
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	ASSERT(epki_len_min == len);
+	// занести ключ в кэш
+	if (_cache)
+		cmdPrivkeyCachePut(privkey, len, tag);
 	cmdBlobClose(stack);
 	return code;
 }
@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2: random number generation
 \project bee2/cmd 
 \created 2022.06.08
-\version 2022.10.28
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -75,6 +75,12 @@ static bool_t cmdTermEcho(bool_t on)
 объявлен порог в 600 МГц. При соблюдении этого порога оценка энтропии
 клавиатурного источника не падала ниже 27.1 битов на наблюдение.
 Следует уточнить оценки энтропии при снижения порога частоты.
+
+Генератор создается с политикой быстрого запуска (см. rngSetStartPolicy()):
+медленный источник timer не опрашивается, если данных быстрых источников 
+достаточно. Проверка работоспособности источников выполняется до создания 
+генератора, поскольку ее результат определяет, требуется ли клавиатурный 
+источник.
 *******************************************************************************
 */
 
@@ -140,6 +146,9 @@ static err_t prngEchoRead(size_t* read, void* buf, size_t count, void* state)
 err_t cmdRngStart(bool_t verbose)
 {
 	err_t code;
+	// ГСЧ уже запущен (пакетный режим)?
+	if (rngIsValid())
+		return ERR_OK;
 	if (verbose)
 	{
 		const char* sources[] = { "trng", "trng2", "sys", "timer" };
@@ -153,6 +162,7 @@ err_t cmdRngStart(bool_t verbose)
 		printf("]... ");
 	}
 	code = rngESHealth();
+	rngSetStartPolicy(TRUE);
 	if (code == ERR_OK)
 		code = rngCreate(0, 0);
 	else if (code == ERR_NOT_ENOUGH_ENTROPY)
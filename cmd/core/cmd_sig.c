@@ -4,7 +4,7 @@
 \brief Command-line interface to Bee2: signing files
 \project bee2/cmd
 \created 2022.08.20
-\version 2022.10.31
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include <bee2/core/blob.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
 #include <bee2/core/rng.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
@@ -259,32 +260,28 @@ static err_t cmdSigRead(cmd_sig_t* sig, size_t* der_len, const char* file)
 сертификатов [certs_len]certs, т.е. буфер
   file[:-drop] || [certs_len]certs.
 Алгоритм хэширования определяется по длине возвращаемого хэш-значения.
+
+Хэширование разбито на два шага. Функция cmdSigHashBody() хэширует
+file[:-drop] и возвращает снимок состояния хэширования. Функция
+cmdSigHashCerts() завершает хэширование копии снимка цепочкой certs.
+Снимок не изменяется, поэтому его можно завершить несколькими цепочками,
+не перечитывая файл.
 *******************************************************************************
 */
 
-static err_t cmdSigHash(octet hash[], size_t hash_len, const char* file,
-	size_t drop, const octet certs[], size_t certs_len)
+#define CMD_SIG_HASH_KEEP 512
+
+static err_t cmdSigHashBody(octet state[CMD_SIG_HASH_KEEP], size_t hash_len,
+	const char* file, size_t drop)
 {
-	const size_t buf_size = 4096;
 	err_t code;
-	octet* stack;
-	octet* hash_state;
 	size_t file_size;
-	FILE* fp;
 	// pre
 	ASSERT(hash_len == 32 || hash_len == 48 || hash_len == 64);
-	ASSERT(memIsValid(hash, hash_len));
+	ASSERT(beltHash_keep() <= CMD_SIG_HASH_KEEP);
+	ASSERT(bashHash_keep() <= CMD_SIG_HASH_KEEP);
+	ASSERT(memIsValid(state, CMD_SIG_HASH_KEEP));
 	ASSERT(strIsValid(file));
-	// выделить память
-	code = cmdBlobCreate(stack, buf_size +
-		(hash_len == 32 ? beltHash_keep() : bashHash_keep()));
-	ERR_CALL_CHECK(code);
-	// запустить хэширование
-	hash_state = stack + buf_size;
-	if (hash_len == 32)
-		beltHashStart(hash_state);
-	else
-		bashHashStart(hash_state, hash_len * 4);
 	// определить размер файла
 	file_size = cmdFileSize(file);
 	code = file_size != SIZE_MAX ? ERR_OK : ERR_FILE_READ;
@@ -293,26 +290,36 @@ static err_t cmdSigHash(octet hash[], size_t hash_len, const char* file,
 	code = drop <= file_size ? ERR_OK : ERR_BAD_FORMAT;
 	ERR_CALL_CHECK(code);
 	file_size -= drop;
-	// открыть файл для чтения
-	fp = fopen(file, "rb");
-	code = fp ? ERR_OK : ERR_FILE_OPEN;
-	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// хэшировать файл
-	while (file_size)
-	{
-		// прочитать фрагмент
-		size_t count = MIN2(file_size, buf_size);
-		code = fread(stack, 1, count, fp) == count ? ERR_OK : ERR_FILE_READ;
-		ERR_CALL_HANDLE(code, (fclose(fp), cmdBlobClose(stack)));
-		file_size -= count;
-		// хэшировать фрагмент
-		if (hash_len == 32)
-			beltHashStepH(stack, count, hash_state);
-		else
-			bashHashStepH(stack, count, hash_state);
+	if (hash_len == 32)
+	{
+		beltHashStart(state);
+		code = cmdFileStream(file, file_size, beltHashStepH, state);
 	}
+	else
+	{
+		bashHashStart(state, hash_len * 4);
+		code = cmdFileStream(file, file_size, bashHashStepH, state);
+	}
+	return code;
+}
+
+static err_t cmdSigHashCerts(octet hash[], size_t hash_len,
+	const octet state[CMD_SIG_HASH_KEEP], const octet certs[],
+	size_t certs_len)
+{
+	err_t code;
+	octet* hash_state;
+	// pre
+	ASSERT(hash_len == 32 || hash_len == 48 || hash_len == 64);
+	ASSERT(memIsValid(hash, hash_len));
+	ASSERT(memIsValid(state, CMD_SIG_HASH_KEEP));
+	ASSERT(memIsValid(certs, certs_len));
+	// скопировать снимок
+	code = cmdBlobCreate(hash_state, CMD_SIG_HASH_KEEP);
+	ERR_CALL_CHECK(code);
+	memCopy(hash_state, state, CMD_SIG_HASH_KEEP);
 	// завершить
-	fclose(fp);
 	if (hash_len == 32)
 	{
 		beltHashStepH(certs, certs_len, hash_state);
@@ -323,10 +330,74 @@ static err_t cmdSigHash(octet hash[], size_t hash_len, const char* file,
 		bashHashStepH(certs, certs_len, hash_state);
 		bashHashStepG(hash, hash_len, hash_state);
 	}
-	cmdBlobClose(stack);
+	cmdBlobClose(hash_state);
+	return ERR_OK;
+}
+
+static err_t cmdSigHash(octet hash[], size_t hash_len, const char* file,
+	size_t drop, const octet certs[], size_t certs_len)
+{
+	err_t code;
+	octet* state;
+	// pre
+	ASSERT(memIsValid(hash, hash_len));
+	// выделить память
+	code = cmdBlobCreate(state, CMD_SIG_HASH_KEEP);
+	ERR_CALL_CHECK(code);
+	// хэшировать
+	code = cmdSigHashBody(state, hash_len, file, drop);
+	if (code == ERR_OK)
+		code = cmdSigHashCerts(hash, hash_len, state, certs, certs_len);
+	// завершить
+	cmdBlobClose(state);
 	return code;
 }
 
+/*
+*******************************************************************************
+Кэш сертификатов
+
+В кэше хранятся метки belt-hash(cert || certa) пар сертификатов (эмитент,
+издатель), успешно проверенных функцией btokCVCVal2(). В цепочке сертификат
+эмитента cert непосредственно предшествует сертификату издателя certa,
+а DER-коды однозначно разделяются, поэтому метка вычисляется по
+непрерывному фрагменту цепочки. Пары проверяются без учета текущей даты,
+и результат проверки не устаревает. При переполнении кэша вытесняется
+самая старая метка.
+*******************************************************************************
+*/
+
+#define CMD_SIG_PAIRS 64
+
+static bool_t _pairs_on;						/*< кэш запущен? */
+static size_t _pairs_count;						/*< число занесений */
+static octet _pairs[CMD_SIG_PAIRS][32];			/*< метки пар */
+
+void cmdSigCacheStart()
+{
+	_pairs_on = TRUE, _pairs_count = 0;
+}
+
+void cmdSigCacheClose()
+{
+	memWipe(_pairs, sizeof(_pairs));
+	_pairs_on = FALSE, _pairs_count = 0;
+}
+
+static bool_t cmdSigCacheHas(const octet tag[32])
+{
+	size_t pos;
+	for (pos = 0; pos < MIN2(_pairs_count, CMD_SIG_PAIRS); ++pos)
+		if (memEq(_pairs[pos], tag, 32))
+			return TRUE;
+	return FALSE;
+}
+
+static void cmdSigCachePut(const octet tag[32])
+{
+	memCopy(_pairs[_pairs_count++ % CMD_SIG_PAIRS], tag, 32);
+}
+
 /*
 *******************************************************************************
 Цепочка сертификатов
@@ -343,6 +414,7 @@ static err_t cmdSigCertsVal(const cmd_sig_t* sig)
 	const octet* certa;
 	size_t certa_len;
 	btok_cvc_t cvca[1];
+	octet tag[32];
 	// pre
 	ASSERT(memIsValid(sig, sizeof(cmd_sig_t)));
 	// нет сертификатов?
@@ -375,8 +447,22 @@ static err_t cmdSigCertsVal(const cmd_sig_t* sig)
 			ASSERT(cert_len != SIZE_MAX);
 			certs_len -= cert_len;
 		}
+		// пара уже проверена?
+		ASSERT(cert + cert_len == certa);
+		if (_pairs_on)
+		{
+			code = beltHash(tag, cert, cert_len + certa_len);
+			ERR_CALL_CHECK(code);
+		}
+		if (_pairs_on && cmdSigCacheHas(tag))
+			code = btokCVCUnwrap(cvc, cert, cert_len, 0, 0);
 		// проверить пару
-		code = btokCVCVal2(cvc, cert, cert_len, cvca, 0);
+		else
+		{
+			code = btokCVCVal2(cvc, cert, cert_len, cvca, 0);
+			if (code == ERR_OK && _pairs_on)
+				cmdSigCachePut(tag);
+		}
 		ERR_CALL_CHECK(code);
 		// издатель <- эмитент
 		certa = cert, certa_len = cert_len;
@@ -385,22 +471,20 @@ static err_t cmdSigCertsVal(const cmd_sig_t* sig)
 	return ERR_OK;
 }
 
-static err_t cmdSigCertsVal2(const cmd_sig_t* sig, const octet anchor[],
-	size_t anchor_len)
+static err_t cmdSigCertsVal2(const cmd_sig_t* sig, void* anchors)
 {
 	size_t certs_len;
 	const octet* cert;
 	size_t cert_len;
 	// pre
 	ASSERT(memIsValid(sig, sizeof(cmd_sig_t)));
-	ASSERT(memIsValid(anchor, anchor_len));
-	// один из сертификатов совпадает с anchor?
+	// один из сертификатов найден среди доверенных?
 	for (certs_len = sig->certs_len, cert = sig->certs; certs_len; )
 	{
 		cert_len = btokCVCLen(cert, certs_len);
 		if (cert_len == SIZE_MAX)
 			return ERR_BAD_CERT;
-		if (cert_len == anchor_len && memEq(cert, anchor, cert_len))
+		if (btokCVCStoreFind(anchors, cert, cert_len))
 			break;
 		cert += cert_len, certs_len -= cert_len;
 	}
@@ -410,6 +494,26 @@ static err_t cmdSigCertsVal2(const cmd_sig_t* sig, const octet anchor[],
 	return cmdSigCertsVal(sig); 
 }
 
+static err_t cmdSigAnchorsCreate(void** anchors, const octet anchor[],
+	size_t anchor_len)
+{
+	err_t code;
+	size_t count;
+	// pre
+	ASSERT(memIsValid(anchors, sizeof(void*)));
+	ASSERT(memIsValid(anchor, anchor_len));
+	// разобрать набор доверенных сертификатов
+	count = btokCVCStoreCount(anchor, anchor_len);
+	if (count == SIZE_MAX)
+		return ERR_BAD_CERT;
+	code = cmdBlobCreate(*anchors, btokCVCStore_keep(count, anchor_len));
+	ERR_CALL_CHECK(code);
+	code = btokCVCStoreStart(*anchors, anchor, anchor_len);
+	if (code != ERR_OK)
+		cmdBlobClose(*anchors), *anchors = 0;
+	return code;
+}
+
 static err_t cmdSigCertsCollect(cmd_sig_t* sig, const char* certs)
 {
 	err_t code;
@@ -585,6 +689,186 @@ err_t cmdSigSign(const char* sig_file, const char* file, const char* certs,
 	return code;
 }
 
+/*
+*******************************************************************************
+Параметры пакетной обработки
+
+Долговременные параметры и идентификатор хэш-алгоритма определяются по
+длине открытого ключа pubkey_len (64, 96 или 128 октетов).
+*******************************************************************************
+*/
+
+static err_t cmdSigStd(bign_params* params, octet oid_der[16],
+	size_t* oid_len, size_t pubkey_len)
+{
+	err_t code;
+	// pre
+	ASSERT(memIsValid(params, sizeof(bign_params)));
+	ASSERT(memIsValid(oid_der, 16));
+	ASSERT(memIsValid(oid_len, sizeof(size_t)));
+	// загрузить параметры
+	*oid_len = 16;
+	if (pubkey_len == 64)
+	{
+		code = bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1");
+		ERR_CALL_CHECK(code);
+		code = bignOidToDER(oid_der, oid_len, "1.2.112.0.2.0.34.101.31.81");
+	}
+	else if (pubkey_len == 96)
+	{
+		code = bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.2");
+		ERR_CALL_CHECK(code);
+		code = bignOidToDER(oid_der, oid_len, "1.2.112.0.2.0.34.101.77.12");
+	}
+	else if (pubkey_len == 128)
+	{
+		code = bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.3");
+		ERR_CALL_CHECK(code);
+		code = bignOidToDER(oid_der, oid_len, "1.2.112.0.2.0.34.101.77.13");
+	}
+	else
+		code = ERR_BAD_PUBKEY;
+	ASSERT(code != ERR_OK || *oid_len == 11);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетная выработка подписи
+
+Сертификаты собираются и проверяются один раз для всего пакета.
+Долговременные параметры загружаются в контекст bign, который используется
+всеми потоками одновременно (см. bignCtxStart()).
+
+Пары <file> <sig> обрабатываются параллельно участками mtPoolFor(): каждый
+участок хэширует свои файлы, подписывает хэш-значения и записывает подписи.
+Результат обработки i-ой пары сохраняется в codes[i]. Возвращается первый
+из ненулевых кодов.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	char** argv;				/*!< пары <file> <sig> */
+	const cmd_sig_t* sig;		/*!< шаблон подписи (сертификаты) */
+	const void* ctx;			/*!< контекст bign */
+	octet oid_der[16];			/*!< идентификатор хэш-алгоритма */
+	size_t oid_len;				/*!< длина oid_der */
+	const octet* privkey;		/*!< личный ключ */
+	size_t privkey_len;			/*!< длина личного ключа */
+	err_t* codes;				/*!< результаты обработки пар */
+} cmd_sig_batch_st;
+
+static void cmdSigSignRange(size_t from, size_t to, void* arg)
+{
+	cmd_sig_batch_st* st = (cmd_sig_batch_st*)arg;
+	err_t code;
+	void* stack;
+	cmd_sig_t* sig;
+	octet* hash;
+	octet* t;
+	size_t t_len;
+	// создать и разметить стек
+	code = cmdBlobCreate(stack, sizeof(cmd_sig_t) + 2 * st->privkey_len);
+	if (code != ERR_OK)
+	{
+		for (; from < to; ++from)
+			st->codes[from] = code;
+		return;
+	}
+	sig = (cmd_sig_t*)stack;
+	hash = (octet*)(sig + 1);
+	t = hash + st->privkey_len;
+	memCopy(sig, st->sig, sizeof(cmd_sig_t));
+	// цикл по парам
+	for (; from < to; ++from)
+	{
+		const char* file = st->argv[2 * from];
+		const char* sig_file = st->argv[2 * from + 1];
+		// хэшировать
+		code = cmdSigHash(hash, st->privkey_len, file, 0, sig->certs,
+			sig->certs_len);
+		// подписать
+		if (code == ERR_OK)
+		{
+			if (rngIsValid())
+				rngStepR(t, t_len = st->privkey_len, 0);
+			else
+				t_len = 0;
+			code = bignCtxSign2(sig->sig, st->ctx, st->oid_der, st->oid_len,
+				hash, st->privkey, t, t_len);
+			sig->sig_len = st->privkey_len / 2 * 3;
+		}
+		// сохранить подпись
+		if (code == ERR_OK)
+		{
+			if (cmdFileAreSame(file, sig_file))
+				code = cmdSigAppend(sig_file, sig);
+			else
+				code = cmdSigWrite(sig_file, sig);
+		}
+		st->codes[from] = code;
+	}
+	// завершить
+	cmdBlobClose(stack);
+}
+
+err_t cmdSigSignBatch(int argc, char* argv[], const char* certs,
+	const octet privkey[], size_t privkey_len)
+{
+	err_t code;
+	void* stack;
+	cmd_sig_batch_st* st;
+	cmd_sig_t* sig;
+	bign_params* params;
+	void* ctx;
+	size_t count;
+	size_t i;
+	// входной контроль
+	if (argc <= 0 || argc % 2 != 0 ||
+		!(privkey_len == 32 || privkey_len == 48 || privkey_len == 64) ||
+		!memIsValid(privkey, privkey_len))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < (size_t)argc; ++i)
+		if (!strIsValid(argv[i]))
+			return ERR_BAD_INPUT;
+	count = (size_t)argc / 2;
+	// создать и разметить стек
+	code = cmdBlobCreate(stack, bignCtx_keep(privkey_len * 4) +
+		sizeof(cmd_sig_batch_st) + sizeof(cmd_sig_t) + sizeof(bign_params) +
+		count * sizeof(err_t));
+	ERR_CALL_CHECK(code);
+	ctx = stack;
+	st = (cmd_sig_batch_st*)((octet*)ctx + bignCtx_keep(privkey_len * 4));
+	sig = (cmd_sig_t*)(st + 1);
+	params = (bign_params*)(sig + 1);
+	st->codes = (err_t*)(params + 1);
+	// собрать сертификаты
+	code = cmdSigCertsCollect(sig, certs);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// проверить соответствие личному ключу
+	code = cmdSigCertsMatch(sig, privkey, privkey_len);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// загрузить параметры
+	code = cmdSigStd(params, st->oid_der, &st->oid_len, privkey_len * 2);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// создать контекст
+	code = bignCtxStart(ctx, params);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// обработать пары
+	st->argv = argv;
+	st->sig = sig;
+	st->ctx = ctx;
+	st->privkey = privkey;
+	st->privkey_len = privkey_len;
+	mtPoolFor(0, count, cmdSigSignRange, st);
+	// определить результат
+	for (i = 0; i < count && (code = st->codes[i]) == ERR_OK; ++i);
+	// завершить
+	cmdBlobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Проверка подписи
@@ -686,6 +970,7 @@ err_t cmdSigVerify2(const char* file, const char* sig_file,
 	err_t code;
 	void* stack;
 	cmd_sig_t* sig;
+	void* anchors;
 	btok_cvc_t* cvc;
 	bign_params* params;
 	octet* oid_der;
@@ -716,7 +1001,10 @@ err_t cmdSigVerify2(const char* file, const char* sig_file,
 		der_len = 0;
 	}
 	// проверить сертификаты
-	code = cmdSigCertsVal2(sig, anchor, anchor_len);	
+	code = cmdSigAnchorsCreate(&anchors, anchor, anchor_len);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	code = cmdSigCertsVal2(sig, anchors);
+	cmdBlobClose(anchors);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// выделить первый сертификат
 	code = cmdSigCertsGet(cvc, 0, sig, 0);
@@ -762,6 +1050,268 @@ err_t cmdSigVerify2(const char* file, const char* sig_file,
 	return code;
 }
 
+/*
+*******************************************************************************
+Пакетная проверка подписи
+
+Проверка выполняется в три этапа:
+1) пары <file> <sig> обрабатываются параллельно участками mtPoolFor():
+   читается подпись, из первого сертификата цепочки извлекается открытый
+   ключ, хэшируется файл. Если один файл сопровождается несколькими 
+   отдельными подписями одного уровня стойкости (например, подписями 
+   нескольких подписантов), то файл хэшируется один раз, а снимок
+   состояния хэширования завершается цепочкой каждой подписи
+   (см. cmdSigHashBody(), cmdSigHashCerts());
+2) доверенные сертификаты однократно загружаются в хранилище
+   (см. btokCVCStoreStart()), и поиск в нем сертификатов цепочек не
+   зависит от числа доверенных сертификатов. Цепочки сертификатов
+   проверяются последовательно. Проверенные цепочки
+   запоминаются в кэше из CMD_SIG_CACHE_SIZE элементов, и совпадающие
+   цепочки повторно не проверяются. Вместе с цепочкой проверяется открытый
+   ключ подписанта;
+3) подписи группируются по уровням стойкости и проверяются функцией
+   bignVerifyBatch(). Группы разбиваются на участки mtPoolFor().
+*******************************************************************************
+*/
+
+#define CMD_SIG_CACHE_SIZE 8
+
+typedef struct
+{
+	cmd_sig_t sig[1];			/*!< подпись и цепочка сертификатов */
+	octet hash[64];				/*!< хэш-значение */
+	octet pubkey[128];			/*!< открытый ключ подписанта */
+	size_t pubkey_len;			/*!< длина открытого ключа */
+	size_t drop;				/*!< длина встроенной подписи */
+	size_t primary;				/*!< пара, в которой хэшируется файл */
+	octet state[CMD_SIG_HASH_KEEP];	/*!< снимок хэширования файла */
+} cmd_sig_item_t;
+
+typedef struct
+{
+	char** argv;				/*!< пары <file> <sig> */
+	cmd_sig_item_t* items;		/*!< элементы пакета */
+	err_t* codes;				/*!< результаты проверки */
+	const bign_params* params;	/*!< параметры группы */
+	const octet* oid_der;		/*!< идентификатор хэш-алгоритма группы */
+	size_t oid_len;				/*!< длина oid_der */
+	octet* hashes;				/*!< хэш-значения группы */
+	octet* sigs;				/*!< подписи группы */
+	octet* pubkeys;				/*!< открытые ключи группы */
+	err_t* gcodes;				/*!< результаты проверки группы */
+} cmd_sig_vfy_st;
+
+static void cmdSigVfyRange(size_t from, size_t to, void* arg)
+{
+	cmd_sig_vfy_st* st = (cmd_sig_vfy_st*)arg;
+	err_t code;
+	btok_cvc_t cvc[1];
+	size_t der_len;
+	for (; from < to; ++from)
+	{
+		const char* file = st->argv[2 * from];
+		const char* sig_file = st->argv[2 * from + 1];
+		cmd_sig_item_t* item = st->items + from;
+		// читать подпись
+		code = cmdSigRead(item->sig, &der_len, sig_file);
+		// подпись в отдельном файле?
+		if (code == ERR_OK && !cmdFileAreSame(file, sig_file))
+		{
+			code = der_len == cmdFileSize(sig_file) ? ERR_OK : ERR_BAD_FORMAT;
+			der_len = 0;
+		}
+		// выделить первый сертификат
+		if (code == ERR_OK)
+			code = item->sig->certs_len ? ERR_OK : ERR_NO_TRUST;
+		if (code == ERR_OK)
+			code = cmdSigCertsGet(cvc, 0, item->sig, 0);
+		if (code == ERR_OK)
+		{
+			item->pubkey_len = cvc->pubkey_len;
+			memCopy(item->pubkey, cvc->pubkey, cvc->pubkey_len);
+			code = item->pubkey_len * 3 / 4 == item->sig->sig_len ?
+				ERR_OK : ERR_BAD_SIG;
+		}
+		item->drop = der_len;
+		st->codes[from] = code;
+	}
+	memSetZero(cvc, sizeof(btok_cvc_t));
+}
+
+static void cmdSigVfyHashRange(size_t from, size_t to, void* arg)
+{
+	cmd_sig_vfy_st* st = (cmd_sig_vfy_st*)arg;
+	err_t code;
+	for (; from < to; ++from)
+	{
+		cmd_sig_item_t* item = st->items + from;
+		if (st->codes[from] != ERR_OK || item->primary != from)
+			continue;
+		code = cmdSigHashBody(item->state, item->pubkey_len / 2,
+			st->argv[2 * from], item->drop);
+		if (code == ERR_OK)
+			code = cmdSigHashCerts(item->hash, item->pubkey_len / 2,
+				item->state, item->sig->certs, item->sig->certs_len);
+		st->codes[from] = code;
+	}
+}
+
+static void cmdSigVfyBatchRange(size_t from, size_t to, void* arg)
+{
+	cmd_sig_vfy_st* st = (cmd_sig_vfy_st*)arg;
+	const size_t l = st->params->l;
+	bignVerifyBatch(st->params, st->oid_der, st->oid_len, to - from,
+		st->hashes + from * l / 4, st->sigs + from * l / 8 * 3,
+		st->pubkeys + from * l / 2, st->gcodes + from);
+}
+
+err_t cmdSigVerifyBatch(int argc, char* argv[], const octet anchor[],
+	size_t anchor_len, err_t codes[])
+{
+	err_t code;
+	void* stack;
+	cmd_sig_vfy_st* st;
+	void* anchors;
+	bign_params* params;
+	octet* oid_der;
+	size_t* idx;
+	size_t cache[CMD_SIG_CACHE_SIZE];
+	size_t cached;
+	size_t count;
+	size_t i, j, n, l;
+	// входной контроль
+	if (argc <= 0 || argc % 2 != 0 ||
+		!memIsValid(anchor, anchor_len) ||
+		!memIsNullOrValid(codes, (size_t)argc / 2 * sizeof(err_t)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < (size_t)argc; ++i)
+		if (!strIsValid(argv[i]))
+			return ERR_BAD_INPUT;
+	count = (size_t)argc / 2;
+	// создать и разметить стек
+	code = cmdBlobCreate(stack, sizeof(cmd_sig_vfy_st) +
+		count * sizeof(cmd_sig_item_t) + count * sizeof(size_t) +
+		sizeof(bign_params) + 16 + count * (64 + 96 + 128) +
+		2 * count * sizeof(err_t));
+	ERR_CALL_CHECK(code);
+	st = (cmd_sig_vfy_st*)stack;
+	st->items = (cmd_sig_item_t*)(st + 1);
+	idx = (size_t*)(st->items + count);
+	params = (bign_params*)(idx + count);
+	st->codes = (err_t*)(params + 1);
+	st->gcodes = st->codes + count;
+	oid_der = (octet*)(st->gcodes + count);
+	st->hashes = oid_der + 16;
+	st->argv = argv;
+	// этап 1: прочитать подписи
+	mtPoolFor(0, count, cmdSigVfyRange, st);
+	// этап 1: найти файлы с несколькими отдельными подписями
+	for (i = 0; i < count; ++i)
+	{
+		cmd_sig_item_t* item = st->items + i;
+		item->primary = i;
+		if (st->codes[i] != ERR_OK || item->drop)
+			continue;
+		for (j = 0; j < i; ++j)
+			if (st->items[j].primary == j && st->codes[j] == ERR_OK &&
+				st->items[j].drop == 0 &&
+				st->items[j].pubkey_len == item->pubkey_len &&
+				strEq(argv[2 * j], argv[2 * i]))
+			{
+				item->primary = j;
+				break;
+			}
+	}
+	// этап 1: хэшировать файлы
+	mtPoolFor(0, count, cmdSigVfyHashRange, st);
+	for (i = 0; i < count; ++i)
+	{
+		cmd_sig_item_t* item = st->items + i;
+		if (st->codes[i] != ERR_OK || item->primary == i)
+			continue;
+		st->codes[i] = st->codes[item->primary];
+		if (st->codes[i] == ERR_OK)
+			st->codes[i] = cmdSigHashCerts(item->hash, item->pubkey_len / 2,
+				st->items[item->primary].state, item->sig->certs,
+				item->sig->certs_len);
+	}
+	// этап 2: загрузить доверенные сертификаты
+	code = cmdSigAnchorsCreate(&anchors, anchor, anchor_len);
+	if (code != ERR_OK)
+		for (i = 0; i < count; ++i)
+			if (st->codes[i] == ERR_OK)
+				st->codes[i] = code;
+	// этап 2: проверить цепочки сертификатов
+	for (i = cached = 0; i < count; ++i)
+	{
+		cmd_sig_item_t* item = st->items + i;
+		if (st->codes[i] != ERR_OK)
+			continue;
+		// цепочка уже проверена?
+		for (j = 0; j < MIN2(cached, CMD_SIG_CACHE_SIZE); ++j)
+		{
+			const cmd_sig_t* sig = st->items[cache[j]].sig;
+			if (sig->certs_len == item->sig->certs_len &&
+				memEq(sig->certs, item->sig->certs, sig->certs_len))
+				break;
+		}
+		if (j < MIN2(cached, CMD_SIG_CACHE_SIZE))
+			continue;
+		// проверить цепочку и открытый ключ
+		code = cmdSigCertsVal2(item->sig, anchors);
+		if (code == ERR_OK)
+			code = cmdSigStd(params, oid_der, &st->oid_len, item->pubkey_len);
+		if (code == ERR_OK)
+			code = bignValPubkey(params, item->pubkey);
+		st->codes[i] = code;
+		// запомнить цепочку
+		if (code == ERR_OK)
+			cache[cached++ % CMD_SIG_CACHE_SIZE] = i;
+	}
+	cmdBlobClose(anchors);
+	// этап 3: проверить подписи по уровням стойкости
+	for (l = 128; l <= 256; l += 64)
+	{
+		// собрать группу
+		for (i = n = 0; i < count; ++i)
+			if (st->codes[i] == ERR_OK && st->items[i].pubkey_len == l / 2)
+				idx[n++] = i;
+		if (n == 0)
+			continue;
+		code = cmdSigStd(params, oid_der, &st->oid_len, l / 2);
+		if (code != ERR_OK)
+		{
+			for (i = 0; i < n; ++i)
+				st->codes[idx[i]] = code;
+			continue;
+		}
+		st->params = params;
+		st->oid_der = oid_der;
+		st->sigs = st->hashes + n * l / 4;
+		st->pubkeys = st->sigs + n * l / 8 * 3;
+		for (i = 0; i < n; ++i)
+		{
+			const cmd_sig_item_t* item = st->items + idx[i];
+			memCopy(st->hashes + i * l / 4, item->hash, l / 4);
+			memCopy(st->sigs + i * l / 8 * 3, item->sig->sig, l / 8 * 3);
+			memCopy(st->pubkeys + i * l / 2, item->pubkey, l / 2);
+		}
+		// проверить подписи
+		mtPoolFor(0, n, cmdSigVfyBatchRange, st);
+		for (i = 0; i < n; ++i)
+			st->codes[idx[i]] = st->gcodes[i];
+	}
+	// возвратить результаты
+	for (i = 0, code = ERR_OK; i < count; ++i)
+		if (code == ERR_OK)
+			code = st->codes[i];
+	if (codes)
+		memCopy(codes, st->codes, count * sizeof(err_t));
+	// завершить
+	cmdBlobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Самопроверка
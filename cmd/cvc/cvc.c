@@ -4,7 +4,7 @@
 \brief Manage CV-certificates
 \project bee2/cmd 
 \created 2022.07.12
-\version 2022.10.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -31,7 +31,7 @@
 Функционал:
 - выпуск самоподписанного сертификата;
 - создание предсертификата (запроса на выпуск);
-- выпуск сертификата;
+- выпуск сертификатов (в том числе пакетный);
 - проверка цепочки сертификатов;
 - проверка соответствия между сертификатом и личным ключом;
 - печать полей сертификата.
@@ -49,6 +49,7 @@
   bee2cmd cvc req -authority BYCA1000 -from 220712 -until 391231 -esign 1111 \
 	-holder "590082394654" -pass pass:alice -eid 8888888888 privkey2 req2
   bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert2
+  bee2cmd cvc iss -pass pass:trent privkey1 cert1 req3 cert3 req4 cert4
   bee2cmd cvc match -pass pass:alice privkey2 cert2
   bee2cmd cvc val cert0 cert0
   bee2cmd cvc val -date 220712 cert0 cert1
@@ -68,8 +69,9 @@ static int cvcUsage()
 		"    issue a self-signed certificate <certa>\n"
 		"  cvc req options <privkey> <req>\n"
 		"    generate a pre-certificate <req>\n"
-		"  cvc iss options <privkeya> <certa> <req> <cert>\n"
+		"  cvc iss options <privkeya> <certa> <req> <cert> ...\n"
 		"    issue <cert> based on <req> and subordinate to <certa>\n"
+		"    (several pairs <req> <cert> are processed in one run)\n"
 		"  cvc val options <certa> <certb> ... <cert>\n"
 		"    validate <certb> ... <cert> using <certa> as an anchor\n"
 		"  cvc match options <privkey> <cert>\n"
@@ -534,9 +536,15 @@ static err_t cvcReq(int argc, char* argv[])
 
 /*
 *******************************************************************************
-Выпуск сертификата
+Выпуск сертификатов
+
+cvc iss options <privkeya> <certa> <req> <cert> [<req> <cert> ...]
 
-cvc iss options <privkeya> <certa> <req> <cert>
+Сертификаты выпускаются по запросам из пар (<req>, <cert>). Личный ключ 
+издателя читается и сертификат издателя разбирается один раз, подписи 
+сертификатов вырабатываются в общем контексте bign (см. btokCVCIssStart()).
+Сертификаты выпускаются в порядке перечисления запросов. При ошибке выпуск
+прекращается, ранее выпущенные сертификаты сохраняются.
 *******************************************************************************
 */
 
@@ -545,12 +553,16 @@ static err_t cvcIss(int argc, char* argv[])
 	err_t code;
 	cmd_pwd_t pwd;
 	int readc;
+	int i;
 	size_t privkeya_len;
 	octet* privkeya;
+	size_t state_len;
 	size_t certa_len;
 	size_t req_len;
+	size_t req_max;
 	size_t cert_len;
 	void* stack;
+	void* state;
 	octet* certa;
 	octet* req;
 	octet* cert;
@@ -562,14 +574,19 @@ static err_t cvcIss(int argc, char* argv[])
 	code = cvcParseOptions(0, &pwd, 0, &readc, argc, argv);
 	ERR_CALL_CHECK(code);
 	argc -= readc, argv += readc;
-	if (argc != 4)
+	if (argc < 4 || argc % 2)
 		code = ERR_CMD_PARAMS;
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
 	// проверить наличие/отсутствие файлов
-	code = cmdFileValExist(3, argv);
-	ERR_CALL_CHECK(code);
-	code = cmdFileValNotExist(1, argv + 3);
-	ERR_CALL_CHECK(code);
+	code = cmdFileValExist(2, argv);
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	for (i = 2; i < argc; i += 2)
+	{
+		code = cmdFileValExist(1, argv + i);
+		ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+		code = cmdFileValNotExist(1, argv + i + 1);
+		ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	}
 	// прочитать личный ключ
 	privkeya_len = 0;
 	code = cmdPrivkeyRead(0, &privkeya_len, argv[0], pwd);
@@ -579,38 +596,53 @@ static err_t cvcIss(int argc, char* argv[])
 	code = cmdPrivkeyRead(privkeya, 0, argv[0], pwd);
 	cmdPwdClose(pwd);
 	ERR_CALL_HANDLE(code, cmdBlobClose(privkeya));
-	// определить длины входных сертификата и запроса
+	// определить длины сертификата издателя и запросов
 	code = cmdFileReadAll(0, &certa_len, argv[1]);
 	ERR_CALL_HANDLE(code, cmdBlobClose(privkeya));
-	code = cmdFileReadAll(0, &req_len, argv[2]);
-	ERR_CALL_HANDLE(code, cmdBlobClose(privkeya));
+	for (req_max = 0, i = 2; i < argc; i += 2)
+	{
+		code = cmdFileReadAll(0, &req_len, argv[i]);
+		ERR_CALL_HANDLE(code, cmdBlobClose(privkeya));
+		req_max = MAX2(req_max, req_len);
+	}
 	// построить оценку сверху для cert_len: req_len + расширение_подписи
-	cert_len = req_len + (96 - 48);
+	cert_len = req_max + (96 - 48);
 	// выделить память и разметить ее
-	code = cmdBlobCreate(stack, certa_len + req_len + cert_len +
+	state_len = btokCVCIss_keep(privkeya_len);
+	code = cmdBlobCreate(stack, state_len + certa_len + req_max + cert_len +
 		sizeof(btok_cvc_t));
 	ERR_CALL_HANDLE(code, cmdBlobClose(privkeya));
-	certa = (octet*)stack;
+	state = stack;
+	certa = (octet*)state + state_len;
 	req = certa + certa_len;
-	cert = req + req_len;
+	cert = req + req_max;
 	cvc = (btok_cvc_t*)(cert + cert_len);
-	// прочитать сертификат
+	// прочитать сертификат издателя
 	code = cmdFileReadAll(certa, &certa_len, argv[1]);
 	ERR_CALL_HANDLE(code, (cmdBlobClose(privkeya), cmdBlobClose(stack)));
-	// прочитать запрос
-	code = cmdFileReadAll(req, &req_len, argv[2]);
-	ERR_CALL_HANDLE(code, (cmdBlobClose(privkeya), cmdBlobClose(stack)));
-	// разобрать запрос
-	code = btokCVCUnwrap(cvc, req, req_len, cvc->pubkey, 0);
-	ERR_CALL_HANDLE(code, (cmdBlobClose(privkeya), cmdBlobClose(stack)));
-	// выпустить сертификат
-	code = btokCVCIss(cert, &cert_len, cvc, certa, certa_len, privkeya,
-		privkeya_len);
-	ASSERT(cert_len <= req_len + 96 - 48);
+	// начать выпуск
+	code = btokCVCIssStart(state, certa, certa_len, privkeya, privkeya_len);
 	cmdBlobClose(privkeya);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
-	// записать сертификат
-	code = cmdFileWrite(argv[3], cert, cert_len);
+	// цикл по запросам
+	for (i = 2; i < argc; i += 2)
+	{
+		// прочитать запрос
+		code = cmdFileReadAll(0, &req_len, argv[i]);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		code = cmdFileReadAll(req, &req_len, argv[i]);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		// разобрать запрос
+		code = btokCVCUnwrap(cvc, req, req_len, cvc->pubkey, 0);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		// выпустить сертификат
+		code = btokCVCIssStep(cert, &cert_len, cvc, state);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		ASSERT(cert_len <= req_len + 96 - 48);
+		// записать сертификат
+		code = cmdFileWrite(argv[i + 1], cert, cert_len);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	}
 	// завершить
 	cmdBlobClose(stack);
 	return code;
@@ -633,8 +665,9 @@ static err_t cvcVal(int argc, char* argv[])
 	size_t cert_len;
 	void* stack;
 	octet* cert;
-	btok_cvc_t* cvc;
-	btok_cvc_t* cvc1;
+	void* h;
+	void* h1;
+	void* t;
 	// самотестирование
 	code = cvcSelfTest();
 	ERR_CALL_CHECK(code);
@@ -653,11 +686,11 @@ static err_t cvcVal(int argc, char* argv[])
 	code = cmdFileValExist(argc, argv);
 	ERR_CALL_CHECK(code);
 	// выделить память и разметить ее
-	code = cmdBlobCreate(stack, cert_max_len + 2 * sizeof(btok_cvc_t));
+	code = cmdBlobCreate(stack, cert_max_len + 2 * btokCVCH_keep());
 	ERR_CALL_CHECK(code);
 	cert = (octet*)stack;
-	cvc = (btok_cvc_t*)(cert + cert_max_len);
-	cvc1 = cvc + 1;
+	h = cert + cert_max_len;
+	h1 = (octet*)h + btokCVCH_keep();
 	// прочитать первый сертификат
 	code = cmdFileReadAll(0, &cert_len, argv[0]);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
@@ -666,7 +699,7 @@ static err_t cvcVal(int argc, char* argv[])
 	code = cmdFileReadAll(cert, &cert_len, argv[0]);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// разобрать первый сертификат
-	code = btokCVCUnwrap(cvc, cert, cert_len, 0, 0);
+	code = btokCVCHStart(h, cert, cert_len);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// цикл по сертификатам
 	for (--argc, ++argv; argc--; ++argv)
@@ -678,12 +711,13 @@ static err_t cvcVal(int argc, char* argv[])
 		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 		code = cmdFileReadAll(cert, &cert_len, *argv);
 		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
-		// проверить очередной сертификат
-		code = btokCVCVal2(cvc1, cert, cert_len, cvc, 
-			argc == 0 ? date : 0);
+		// разобрать и проверить очередной сертификат
+		code = btokCVCHStart(h1, cert, cert_len);
+		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+		code = btokCVCHVal(h1, h, argc == 0 ? date : 0);
 		ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 		// подготовиться к проверке следующего сертификата
-		memCopy(cvc, cvc1, sizeof(btok_cvc_t));
+		t = h, h = h1, h1 = t;
 	}
 	// завершить
 	cmdBlobClose(stack);
@@ -707,6 +741,7 @@ static err_t cvcMatch(int argc, char* argv[])
 	octet* privkey;
 	size_t cert_len;
 	octet* cert;
+	void* h;
 	// самотестирование
 	code = cvcSelfTest();
 	ERR_CALL_CHECK(code);
@@ -733,12 +768,15 @@ static err_t cvcMatch(int argc, char* argv[])
 	code = cmdFileReadAll(0, &cert_len, argv[1]);
 	ERR_CALL_HANDLE(code, cmdBlobClose(privkey));
 	// прочитать сертификат
-	code = cmdBlobCreate(cert, cert_len);
+	code = cmdBlobCreate(cert, cert_len + btokCVCH_keep());
 	ERR_CALL_HANDLE(code, cmdBlobClose(privkey));
+	h = cert + cert_len;
 	code = cmdFileReadAll(cert, &cert_len, argv[1]);
 	ERR_CALL_HANDLE(code, (cmdBlobClose(privkey), cmdBlobClose(cert)));
-	// проверить соответствие
-	code = btokCVCMatch(cert, cert_len, privkey, privkey_len);
+	// разобрать сертификат и проверить соответствие
+	code = btokCVCHStart(h, cert, cert_len);
+	if (code == ERR_OK)
+		code = btokCVCHMatch(h, privkey, privkey_len);
 	// завершить
 	cmdBlobClose(cert);
 	cmdBlobClose(privkey);
@@ -759,7 +797,7 @@ static err_t cvcPrint(int argc, char* argv[])
 	size_t cert_len;
 	void* stack;
 	octet* cert;
-	btok_cvc_t* cvc;
+	void* h;
 	// обработать опции
 	if (argc != 1)
 		return ERR_CMD_PARAMS;
@@ -770,18 +808,18 @@ static err_t cvcPrint(int argc, char* argv[])
 	code = cmdFileReadAll(0, &cert_len, argv[0]);
 	ERR_CALL_CHECK(code);
 	// выделить память и разметить ее
-	code = cmdBlobCreate(stack, cert_len + sizeof(btok_cvc_t));
+	code = cmdBlobCreate(stack, cert_len + btokCVCH_keep());
 	ERR_CALL_CHECK(code);
 	cert = (octet*)stack;
-	cvc = (btok_cvc_t*)(cert + cert_len);
+	h = cert + cert_len;
 	// прочитать сертификат
 	code = cmdFileReadAll(cert, &cert_len, argv[0]);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// разобрать сертификат
-	code = btokCVCUnwrap(cvc, cert, cert_len, 0, 0);
+	code = btokCVCHStart(h, cert, cert_len);
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// печатать содержимое
-	code = cmdCVCPrint(cvc);
+	code = cmdCVCPrint(btokCVCHCvc(h));
 	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
 	// завершить
 	cmdBlobClose(stack);
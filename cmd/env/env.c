@@ -0,0 +1,529 @@
+/*
+*******************************************************************************
+\file env.c
+\brief Encrypt files to public keys
+\project bee2/cmd
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "../cmd.h"
+#include <bee2/core/blob.h>
+#include <bee2/core/dec.h>
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/rng.h>
+#include <bee2/core/str.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bign.h>
+#include <stdio.h>
+
+/*
+*******************************************************************************
+Утилита env
+
+Функционал:
+- зашифрование файла на открытом ключе (создание конверта);
+- расшифрование конверта на личном ключе.
+
+Конверт создается функциями bignEnvXXX(): случайный ключ конверта
+упаковывается в токен bign, данные защищаются фрагментами в режиме
+belt-che. Файлы обрабатываются потоково: в памяти размещается окно
+из нескольких фрагментов, фрагменты окна обрабатываются параллельно.
+
+Пример:
+  bee2cmd kg gen -pass pass:alice privkey
+  bee2cmd kg pub -pass pass:alice privkey pubkey
+  bee2cmd env enc -pubkey pubkey file file.env
+  bee2cmd env dec -pass pass:alice privkey file.env file1
+  bee2cmd env enc -chunk 4096 -j4 -pubkey pubkey file file.env
+*******************************************************************************
+*/
+
+static const char _name[] = "env";
+static const char _descr[] = "encrypt files to public keys";
+
+#define ENV_CHUNK_DEFAULT 65536
+#define ENV_CHUNK_MAX ((size_t)1 << 30)
+#define ENV_JOBS_MAX 256
+#define ENV_WINDOW 4
+
+/*
+*******************************************************************************
+Справка по использованию
+*******************************************************************************
+*/
+
+static int envUsage()
+{
+	printf(
+		"bee2cmd/%s: %s\n"
+		"Usage:\n"
+		"  env enc [-chunk <size>] [-j[<N>]] -pubkey <pubkey> <file> <env>\n"
+		"    encrypt <file> using <pubkey> and store the envelope in <env>\n"
+		"  env dec [-j[<N>]] -pass <scheme> <privkey> <env> <file>\n"
+		"    decrypt <env> using <privkey> and store the result in <file>\n"
+		"  .\n"
+		"  <pubkey>\n"
+		"    file with a public key\n"
+		"  <privkey>\n"
+		"    container with a private key\n"
+		"  options:\n"
+		"    -chunk <size> -- chunk size in octets (default %u)\n"
+		"    -j[<N>] -- number of parallel jobs (default all processors)\n"
+		"    -pass <scheme> -- password description\n",
+		_name, _descr, (unsigned)ENV_CHUNK_DEFAULT
+	);
+	return -1;
+}
+
+/*
+*******************************************************************************
+Самотестирование
+*******************************************************************************
+*/
+
+static err_t envSelfTest()
+{
+	octet state[1024];
+	octet env_state[512];
+	bign_params params[1];
+	octet privkey[32];
+	octet pubkey[64];
+	octet head[96];
+	octet buf[16 + 8];
+	// подготовить ключи
+	ASSERT(sizeof(state) >= prngEcho_keep());
+	ASSERT(sizeof(env_state) >= bignEnv_keep());
+	memCopy(privkey, beltH(), 32);
+	prngEchoStart(state, privkey, 32);
+	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
+		bignGenKeypair(privkey, pubkey, params, prngEchoStepR,
+			state) != ERR_OK)
+		return ERR_SELFTEST;
+	// создать конверт
+	if (bignEnvWrapStart(head, env_state, params, 17, pubkey, prngEchoStepR,
+			state) != ERR_OK ||
+		bignEnvChunkWrap(buf, beltH(), 16, 0, TRUE, env_state) != ERR_OK)
+		return ERR_SELFTEST;
+	// разобрать конверт
+	memSetZero(env_state, sizeof(env_state));
+	if (bignEnvUnwrapStart(env_state, params, head, privkey) != ERR_OK ||
+		bignEnvChunkUnwrap(buf, buf, 16, 0, TRUE, env_state) != ERR_OK ||
+		!memEq(buf, beltH(), 16))
+		return ERR_SELFTEST;
+	// нарушить целостность
+	if (bignEnvChunkWrap(buf, beltH(), 16, 0, TRUE, env_state) != ERR_OK)
+		return ERR_SELFTEST;
+	buf[0] ^= 1;
+	if (bignEnvChunkUnwrap(buf, buf, 16, 0, TRUE, env_state) != ERR_BAD_MAC)
+		return ERR_SELFTEST;
+	// все нормально
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Обработка фрагментов
+
+Окно содержит до jobs * ENV_WINDOW записей по chunk + 8 октетов.
+Фрагменты окна прочитываются из входного файла, обрабатываются
+параллельно функцией mtPoolFor() и записываются в выходной файл.
+Фрагмент занимает начало записи, имитовставка -- последние 8 октетов.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet* state;			/*< состояние конверта */
+	bool_t enc;				/*< зашифрование? */
+	size_t chunk;			/*< длина фрагмента */
+	size_t total;			/*< общее число фрагментов */
+	size_t last_len;		/*< длина последнего фрагмента */
+	size_t first;			/*< номер первого фрагмента окна */
+	err_t* codes;			/*< коды ошибок обработки фрагментов окна */
+	octet* buf;				/*< записи окна */
+} env_st;
+
+static void envRange(size_t from, size_t to, void* arg)
+{
+	env_st* st = (env_st*)arg;
+	size_t index;
+	bool_t last;
+	octet* rec;
+	for (; from < to; ++from)
+	{
+		index = st->first + from;
+		last = index + 1 == st->total;
+		rec = st->buf + from * (st->chunk + 8);
+		st->codes[from] = st->enc ?
+			bignEnvChunkWrap(rec, rec, last ? st->last_len : st->chunk,
+				index, last, st->state) :
+			bignEnvChunkUnwrap(rec, rec, last ? st->last_len : st->chunk,
+				index, last, st->state);
+	}
+}
+
+static err_t envStream(FILE* in, FILE* out, env_st* st, size_t jobs)
+{
+	err_t code = ERR_OK;
+	mt_pool_t pool = 0;
+	size_t window = jobs * ENV_WINDOW;
+	size_t n, i, len;
+	// создать окно
+	code = cmdBlobCreate(st->codes, window * (sizeof(err_t) + st->chunk + 8));
+	ERR_CALL_CHECK(code);
+	st->buf = (octet*)(st->codes + window);
+	if (jobs > 1)
+		pool = mtPoolCreate(jobs - 1);
+	// цикл по окнам
+	for (st->first = 0; code == ERR_OK && st->first < st->total;
+		st->first += n)
+	{
+		n = MIN2(window, st->total - st->first);
+		// прочитать фрагменты
+		for (i = 0; code == ERR_OK && i < n; ++i)
+		{
+			len = st->first + i + 1 == st->total ? st->last_len : st->chunk;
+			len += st->enc ? 0 : 8;
+			if (fread(st->buf + i * (st->chunk + 8), 1, len, in) != len)
+				code = ERR_FILE_READ;
+		}
+		if (code != ERR_OK)
+			break;
+		// обработать фрагменты
+		if (pool)
+			mtPoolFor(pool, n, envRange, st);
+		else
+			envRange(0, n, st);
+		for (i = 0; code == ERR_OK && i < n; ++i)
+			code = st->codes[i];
+		if (code != ERR_OK)
+			break;
+		// записать фрагменты
+		for (i = 0; code == ERR_OK && i < n; ++i)
+		{
+			len = st->first + i + 1 == st->total ? st->last_len : st->chunk;
+			len += st->enc ? 8 : 0;
+			if (fwrite(st->buf + i * (st->chunk + 8), 1, len, out) != len)
+				code = ERR_FILE_WRITE;
+		}
+	}
+	// завершить
+	if (pool)
+		mtPoolClose(pool);
+	cmdBlobClose(st->codes);
+	return code;
+}
+
+/*
+*******************************************************************************
+Разбор опций
+*******************************************************************************
+*/
+
+static err_t envParseJobs(size_t* jobs, const char* opt)
+{
+	ASSERT(strStartsWith(opt, "-j"));
+	if (*jobs)
+		return ERR_CMD_DUPLICATE;
+	opt += strLen("-j");
+	if (!*opt)
+		*jobs = MAX2(mtProcCount(), 1);
+	else if (strLen(opt) > 3 || !decIsValid(opt) || decCLZ(opt) ||
+		(*jobs = (size_t)decToU32(opt)) == 0 || *jobs > ENV_JOBS_MAX)
+		return ERR_CMD_PARAMS;
+	return ERR_OK;
+}
+
+static err_t envParseChunk(size_t* chunk, const char* opt)
+{
+	if (*chunk)
+		return ERR_CMD_DUPLICATE;
+	if (strLen(opt) > 10 || !decIsValid(opt) || decCLZ(opt) ||
+		(*chunk = (size_t)decToU32(opt)) == 0 || *chunk > ENV_CHUNK_MAX)
+		return ERR_CMD_PARAMS;
+	return ERR_OK;
+}
+
+static err_t envParams(bign_params* params, size_t l)
+{
+	if (l == 128)
+		return bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1");
+	if (l == 192)
+		return bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.2");
+	if (l == 256)
+		return bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.3");
+	return ERR_BAD_PARAMS;
+}
+
+/*
+*******************************************************************************
+Зашифрование
+
+  env enc [-chunk <size>] [-j[<N>]] -pubkey <pubkey> <file> <env>
+
+Число фрагментов и длина последнего фрагмента определяются по размеру
+<file>. Если длина <file> кратна длине фрагмента, то последний фрагмент
+пустой.
+*******************************************************************************
+*/
+
+static err_t envEnc(int argc, char* argv[])
+{
+	err_t code = ERR_OK;
+	char* pubkey_name = 0;
+	size_t chunk = 0;
+	size_t jobs = 0;
+	bign_params params[1];
+	octet pubkey[128];
+	size_t pubkey_len;
+	size_t size;
+	octet* head;
+	env_st st[1];
+	FILE* in;
+	FILE* out;
+	// самотестирование
+	code = envSelfTest();
+	ERR_CALL_CHECK(code);
+	// разобрать опции
+	while (code == ERR_OK && argc && strStartsWith(*argv, "-"))
+	{
+		if (strStartsWith(*argv, "-j"))
+			code = envParseJobs(&jobs, *argv), ++argv, --argc;
+		else if (argc < 2)
+			code = ERR_CMD_PARAMS;
+		else if (strEq(*argv, "-chunk"))
+			code = envParseChunk(&chunk, argv[1]), argv += 2, argc -= 2;
+		else if (strEq(*argv, "-pubkey"))
+		{
+			if (pubkey_name)
+				code = ERR_CMD_DUPLICATE;
+			pubkey_name = argv[1], argv += 2, argc -= 2;
+		}
+		else
+			code = ERR_CMD_PARAMS;
+	}
+	ERR_CALL_CHECK(code);
+	if (!pubkey_name || argc != 2)
+		return ERR_CMD_PARAMS;
+	if (!chunk)
+		chunk = ENV_CHUNK_DEFAULT;
+	if (!jobs)
+		jobs = MAX2(mtProcCount(), 1);
+	// проверить файлы
+	code = cmdFileValExist(1, &pubkey_name);
+	ERR_CALL_CHECK(code);
+	code = cmdFileValExist(1, argv);
+	ERR_CALL_CHECK(code);
+	if (cmdFileAreSame(argv[0], argv[1]))
+		return ERR_CMD_PARAMS;
+	code = cmdFileValNotExist(1, argv + 1);
+	ERR_CALL_CHECK(code);
+	// прочитать открытый ключ
+	pubkey_len = sizeof(pubkey);
+	code = cmdFileReadAll(0, &pubkey_len, pubkey_name);
+	ERR_CALL_CHECK(code);
+	if (pubkey_len != 64 && pubkey_len != 96 && pubkey_len != 128)
+		return ERR_BAD_PUBKEY;
+	code = cmdFileReadAll(pubkey, &pubkey_len, pubkey_name);
+	ERR_CALL_CHECK(code);
+	code = envParams(params, pubkey_len * 2);
+	ERR_CALL_CHECK(code);
+	// определить число фрагментов
+	if ((size = cmdFileSize(argv[0])) == SIZE_MAX)
+		return ERR_FILE_READ;
+	st->enc = TRUE;
+	st->chunk = chunk;
+	st->total = size / chunk + 1;
+	st->last_len = size % chunk;
+	// создать заголовок
+	code = cmdRngStart(FALSE);
+	ERR_CALL_CHECK(code);
+	code = cmdBlobCreate(head, params->l / 4 + 64 + bignEnv_keep());
+	ERR_CALL_CHECK(code);
+	st->state = head + params->l / 4 + 64;
+	code = bignEnvWrapStart(head, st->state, params, chunk, pubkey,
+		rngStepR, 0);
+	ERR_CALL_HANDLE(code, cmdBlobClose(head));
+	// открыть файлы
+	if (!(in = fopen(argv[0], "rb")))
+	{
+		cmdBlobClose(head);
+		return ERR_FILE_OPEN;
+	}
+	if (!(out = fopen(argv[1], "wb")))
+	{
+		fclose(in), cmdBlobClose(head);
+		return ERR_FILE_CREATE;
+	}
+	// записать заголовок и фрагменты
+	if (fwrite(head, 1, params->l / 4 + 64, out) != params->l / 4 + 64)
+		code = ERR_FILE_WRITE;
+	else
+		code = envStream(in, out, st, jobs);
+	// завершить
+	fclose(in), fclose(out);
+	if (code != ERR_OK)
+		remove(argv[1]);
+	cmdBlobClose(head);
+	return code;
+}
+
+/*
+*******************************************************************************
+Расшифрование
+
+  env dec [-j[<N>]] -pass <scheme> <privkey> <env> <file>
+
+Уровень стойкости определяется по длине личного ключа. Число фрагментов
+определяется по размеру <env>: после заголовка должны следовать полные
+защищенные фрагменты и защищенный последний фрагмент, который короче
+полного. В случае ошибки частично расшифрованный <file> удаляется.
+*******************************************************************************
+*/
+
+static err_t envDec(int argc, char* argv[])
+{
+	err_t code = ERR_OK;
+	cmd_pwd_t pwd = 0;
+	size_t jobs = 0;
+	bign_params params[1];
+	size_t privkey_len;
+	octet* privkey;
+	octet* head;
+	size_t head_len;
+	size_t size;
+	env_st st[1];
+	FILE* in;
+	FILE* out;
+	// самотестирование
+	code = envSelfTest();
+	ERR_CALL_CHECK(code);
+	// разобрать опции
+	while (code == ERR_OK && argc && strStartsWith(*argv, "-"))
+	{
+		if (strStartsWith(*argv, "-j"))
+			code = envParseJobs(&jobs, *argv), ++argv, --argc;
+		else if (argc < 2)
+			code = ERR_CMD_PARAMS;
+		else if (strEq(*argv, "-pass"))
+		{
+			if (pwd)
+				code = ERR_CMD_DUPLICATE;
+			else
+				code = cmdPwdRead(&pwd, argv[1]);
+			argv += 2, argc -= 2;
+		}
+		else
+			code = ERR_CMD_PARAMS;
+	}
+	if (code == ERR_OK && (!pwd || argc != 3))
+		code = ERR_CMD_PARAMS;
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	if (!jobs)
+		jobs = MAX2(mtProcCount(), 1);
+	// проверить файлы
+	code = cmdFileValExist(2, argv);
+	if (code == ERR_OK && cmdFileAreSame(argv[1], argv[2]))
+		code = ERR_CMD_PARAMS;
+	if (code == ERR_OK)
+		code = cmdFileValNotExist(1, argv + 2);
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	// прочитать личный ключ
+	privkey_len = 0;
+	code = cmdPrivkeyRead(0, &privkey_len, argv[0], pwd);
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	code = envParams(params, privkey_len * 4);
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	head_len = params->l / 4 + 64;
+	code = cmdBlobCreate(privkey, privkey_len + head_len + bignEnv_keep());
+	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	head = privkey + privkey_len;
+	st->state = head + head_len;
+	code = cmdPrivkeyRead(privkey, &privkey_len, argv[0], pwd);
+	cmdPwdClose(pwd);
+	ERR_CALL_HANDLE(code, cmdBlobClose(privkey));
+	// определить число фрагментов
+	code = ERR_BAD_FORMAT;
+	if ((size = cmdFileSize(argv[1])) == SIZE_MAX)
+		code = ERR_FILE_READ;
+	else if (size >= head_len + 8 && (in = fopen(argv[1], "rb")))
+	{
+		// разобрать заголовок
+		if (fread(head, 1, head_len, in) != head_len)
+			code = ERR_FILE_READ;
+		else
+			code = bignEnvUnwrapStart(st->state, params, head,
+				privkey);
+		if (code == ERR_OK)
+		{
+			st->enc = FALSE;
+			st->chunk = bignEnvChunk(st->state);
+			size -= head_len;
+			st->total = size / (st->chunk + 8) + 1;
+			st->last_len = size % (st->chunk + 8);
+			if (st->last_len < 8)
+				code = ERR_BAD_FORMAT;
+			else
+				st->last_len -= 8;
+		}
+		// расшифровать фрагменты
+		if (code == ERR_OK)
+		{
+			if (!(out = fopen(argv[2], "wb")))
+				code = ERR_FILE_CREATE;
+			else
+			{
+				code = envStream(in, out, st, jobs);
+				fclose(out);
+				if (code != ERR_OK)
+					remove(argv[2]);
+			}
+		}
+		fclose(in);
+	}
+	// завершить
+	cmdBlobClose(privkey);
+	return code;
+}
+
+/*
+*******************************************************************************
+Главная функция
+*******************************************************************************
+*/
+
+static int envMain(int argc, char* argv[])
+{
+	err_t code;
+	// справка
+	if (argc < 2)
+		return envUsage();
+	// разбор команды
+	--argc, ++argv;
+	if (strEq(argv[0], "enc"))
+		code = envEnc(argc - 1, argv + 1);
+	else if (strEq(argv[0], "dec"))
+		code = envDec(argc - 1, argv + 1);
+	else
+		code = ERR_CMD_NOT_FOUND;
+	// завершить (коды вида 256 * k не должны превращаться в статус 0)
+	if (code != ERR_OK)
+	{
+		printf("bee2cmd/%s: %s\n", _name, errMsg(code));
+		return -1;
+	}
+	return 0;
+}
+
+err_t envInit()
+{
+	return cmdReg(_name, _descr, envMain);
+}
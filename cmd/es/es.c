@@ -4,13 +4,14 @@
 \brief Dealing with entropy sources
 \project bee2/cmd 
 \created 2021.04.20
-\version 2022.11.04
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "../cmd.h"
+#include <bee2/core/blob.h>
 #include <bee2/core/err.h>
 #include <bee2/core/dec.h>
 #include <bee2/core/mem.h>
@@ -18,6 +19,7 @@
 #include <bee2/core/str.h>
 #include <bee2/core/mt.h>
 #include <bee2/core/tm.h>
+#include <bee2/core/u32.h>
 #include <bee2/core/util.h>
 #include <bee2/core/word.h>
 #include <stdio.h>
@@ -31,11 +33,13 @@
 - перечень доступных источников энтропии;
 - проверка работоспосбности источников энтропии;
 - выгрузка данных от стандартных источников энтропии;
+- потоковая выгрузка данных от нескольких источников с тестами FIPS;
 - эксперименты с источником timer.
 
 Пример:
   bee2cmd es print
   bee2cmd es read trng2 128 file
+  bee2cmd es stream -stat 204800 trng file1 timer file2
 *******************************************************************************
 */
 
@@ -51,6 +55,10 @@ static int esUsage()
 		"    list available entropy sources and determine their health\n"
 		"  es read <source> <count> <file>\n"
 		"    read <count> Kbytes from <source> and store them in <file>\n"
+		"  es stream [-stat] <count> <source> <file> [<source> <file>...]\n"
+		"    read <count> Kbytes from each <source> in parallel threads\n"
+		"    and store them in the corresponding <file>\n"
+		"    -stat -- run FIPS 140-2 tests on the fly\n"
 		"  <source> in {trng, trng2, sys, timer, timerNN}\n"
 		"    timerNNN -- use NNN sleep delays to produce one output bit\n",
 		_name, _descr
@@ -143,37 +151,45 @@ static err_t rngReadSourceEx(size_t* read, void* buf, size_t count,
 	return ERR_OK;
 }
 
-static err_t esRead(int argc, char *argv[])
+static err_t esParseSource(char source[6], size_t* par, const char* arg)
 {
-	err_t code;
-	char source[6];
-	size_t par = 0;
-	size_t count;
-	FILE* fp;
-	octet buf[2048];
-	// разбор командной строки: число параметров
-	if (argc != 3)
-		return ERR_CMD_PARAMS;
-	// разбор командной строки: источник энтропии
-	if (strEq(argv[0], "trng"))
+	*par = 0;
+	if (strEq(arg, "trng"))
 		strCopy(source, "trng");
-	else if (strEq(argv[0], "trng2"))
+	else if (strEq(arg, "trng2"))
 		strCopy(source, "trng2");
-	else if (strEq(argv[0], "sys"))
+	else if (strEq(arg, "sys"))
 		strCopy(source, "sys");
-	else if (strEq(argv[0], "timer"))
+	else if (strEq(arg, "timer"))
 		strCopy(source, "timer");
-	else if (strStartsWith(argv[0], "timer"))
+	else if (strStartsWith(arg, "timer"))
 	{
 		strCopy(source, "timer");
-		argv[0]	+= strLen("timer");
-		if (!decIsValid(argv[0]) || !strLen(argv[0]) || 
-			strLen(argv[0]) > 3 || decCLZ(argv[0]))
+		arg += strLen("timer");
+		if (!decIsValid(arg) || !strLen(arg) || 
+			strLen(arg) > 3 || decCLZ(arg))
 			return ERR_CMD_PARAMS;
-		par = (size_t)decToU32(argv[0]);
+		*par = (size_t)decToU32(arg);
 	}
 	else
 		return ERR_CMD_PARAMS;
+	return ERR_OK;
+}
+
+static err_t esRead(int argc, char *argv[])
+{
+	err_t code;
+	char source[6];
+	size_t par;
+	size_t count;
+	FILE* fp;
+	octet buf[2048];
+	// разбор командной строки: число параметров
+	if (argc != 3)
+		return ERR_CMD_PARAMS;
+	// разбор командной строки: источник энтропии
+	code = esParseSource(source, &par, argv[0]);
+	ERR_CALL_CHECK(code);
 	// разбор командной строки: число Кбайтов
 	if (!decIsValid(argv[1]) || !strLen(argv[1]) || 
 		strLen(argv[1]) > 4 || decCLZ(argv[1]))
@@ -208,6 +224,283 @@ static err_t esRead(int argc, char *argv[])
 	return ERR_OK;
 }
 
+/*
+*******************************************************************************
+Потоковая выгрузка
+
+es stream [-stat] <count> <source> <file> [<source> <file>...]
+
+Каждая пара (источник, файл) обрабатывается в отдельном потоке. Данные
+читаются и записываются блоками по ES_STREAM_BUF октетов.
+
+При указании опции -stat к выгружаемым данным применяются тесты
+FIPS 140-2 (см. rngTestFIPS1() -- rngTestFIPS4()). Данные разбиваются
+на последовательные блоки из 2500 октетов, тесты применяются к каждому
+блоку. Статистики тестов накапливаются по мере поступления данных,
+без копирования блоков. Неполный последний блок не тестируется.
+*******************************************************************************
+*/
+
+#define ES_STREAM_MAX 8
+#define ES_STREAM_BUF ((size_t)1 << 20)
+
+typedef struct
+{
+	size_t pos;				/*!< число октетов текущего блока */
+	size_t ones;			/*!< число единиц (FIPS1) */
+	u32 nibbles[16];		/*!< частоты тетрад (FIPS2) */
+	size_t runs[2][7];		/*!< частоты серий (FIPS3) */
+	octet bit;				/*!< бит текущей серии */
+	size_t len;				/*!< длина текущей серии */
+	bool_t long_run;		/*!< была серия длины >= 26 (FIPS4)? */
+	size_t blocks;			/*!< число протестированных блоков */
+	size_t fails[4];		/*!< число непройденных тестов */
+} es_fips_st;
+
+static void esFipsRun(es_fips_st* st)
+{
+	++st->runs[st->bit][MIN2(st->len, 6)];
+	if (st->len >= 26)
+		st->long_run = TRUE;
+}
+
+static void esFipsFinish(es_fips_st* st)
+{
+	u32 s;
+	size_t b, i;
+	// закрыть последнюю серию
+	esFipsRun(st);
+	// FIPS1
+	if (!(9725 < st->ones && st->ones < 10275))
+		++st->fails[0];
+	// FIPS2
+	for (s = 0, i = 0; i < 16; ++i)
+		s += st->nibbles[i] * st->nibbles[i];
+	s = 16 * s - 5000 * 5000;
+	if (!(10800 < s && s < 230850))
+		++st->fails[1];
+	// FIPS3
+	for (b = 0; b < 2; ++b)
+		if (st->runs[b][1] < 2315 || st->runs[b][1] > 2685 ||
+			st->runs[b][2] < 1114 || st->runs[b][2] > 1386 ||
+			st->runs[b][3] < 527 || st->runs[b][3] > 723 ||
+			st->runs[b][4] < 240 || st->runs[b][4] > 384 ||
+			st->runs[b][5] < 103 || st->runs[b][5] > 209 ||
+			st->runs[b][6] < 103 || st->runs[b][6] > 209)
+		{
+			++st->fails[2];
+			break;
+		}
+	// FIPS4
+	if (st->long_run)
+		++st->fails[3];
+	// начать новый блок
+	++st->blocks;
+	st->pos = st->ones = 0;
+	memSetZero(st->nibbles, sizeof(st->nibbles));
+	memSetZero(st->runs, sizeof(st->runs));
+	st->long_run = FALSE;
+}
+
+/*
+	Серии внутри октета o описываются элементом таблицы _es_runs[o]:
+	длина начальной серии (от младшего бита), длина завершающей серии 
+	(к старшему биту) и список внутренних серий. Элемент списка 8 * b + l 
+	указывает на ячейку runs[b][l]. Если октет образует одну серию, то 
+	prefix = 8 и список пуст.
+*/
+
+typedef struct
+{
+	octet prefix;			/*!< длина начальной серии */
+	octet suffix;			/*!< длина завершающей серии */
+	octet count;			/*!< число внутренних серий */
+	octet inner[6];			/*!< внутренние серии */
+} es_runs_t;
+
+static es_runs_t _es_runs[256];
+
+static void esFipsInit()
+{
+	size_t o, j;
+	for (o = 0; o < 256; ++o)
+	{
+		es_runs_t* r = _es_runs + o;
+		size_t b = o & 1, l = 1, first = 1;
+		memSetZero(r, sizeof(es_runs_t));
+		for (j = 1; j < 8; ++j)
+			if ((o >> j & 1) == b)
+				++l;
+			else
+			{
+				if (first)
+					r->prefix = (octet)l, first = 0;
+				else
+					r->inner[r->count++] = (octet)(b << 3 | l);
+				b = o >> j & 1, l = 1;
+			}
+		if (first)
+			r->prefix = 8;
+		else
+			r->suffix = (octet)l;
+	}
+}
+
+static void esFipsStep(es_fips_st* st, const octet buf[], size_t count)
+{
+	for (; count--; ++buf)
+	{
+		const es_runs_t* r = _es_runs + *buf;
+		size_t j;
+		// начало блока?
+		if (st->pos == 0)
+			st->bit = *buf & 1, st->len = 0;
+		// FIPS1, FIPS2
+		st->ones += u32Weight(*buf);
+		++st->nibbles[*buf & 15], ++st->nibbles[*buf >> 4];
+		// FIPS3, FIPS4: начальная серия
+		if ((*buf & 1) == st->bit)
+			st->len += r->prefix;
+		else
+			esFipsRun(st), st->bit = *buf & 1, st->len = r->prefix;
+		// FIPS3: внутренние и завершающая серии
+		if (r->prefix < 8)
+		{
+			esFipsRun(st);
+			for (j = 0; j < r->count; ++j)
+				++st->runs[r->inner[j] >> 3][r->inner[j] & 7];
+			st->bit = *buf >> 7, st->len = r->suffix;
+		}
+		// конец блока?
+		if (++st->pos == 2500)
+			esFipsFinish(st);
+	}
+}
+
+typedef struct
+{
+	char source[6];			/*!< источник */
+	size_t par;				/*!< параметр источника timer */
+	const char* file;		/*!< выходной файл */
+	size_t count;			/*!< число октетов */
+	bool_t stat;			/*!< выполнять тесты? */
+	es_fips_st fips[1];		/*!< статистики тестов */
+	err_t code;				/*!< код ошибки */
+} es_stream_job_t;
+
+static void esStreamJob(void* arg)
+{
+	es_stream_job_t* job = (es_stream_job_t*)arg;
+	size_t count = job->count;
+	octet* buf;
+	FILE* fp;
+	// подготовить буфер и файл
+	if (!(buf = (octet*)blobCreate(ES_STREAM_BUF)))
+	{
+		job->code = ERR_OUTOFMEMORY;
+		return;
+	}
+	if (!(fp = fopen(job->file, "wb")))
+	{
+		blobClose(buf);
+		job->code = ERR_FILE_OPEN;
+		return;
+	}
+	// выгрузка данных
+	job->code = ERR_OK;
+	while (count && job->code == ERR_OK)
+	{
+		size_t read;
+		size_t chunk = MIN2(ES_STREAM_BUF, count);
+		// читать
+		job->code = rngReadSourceEx(&read, buf, chunk, job->source, 
+			job->par);
+		if (job->code == ERR_OK && read != chunk)
+			job->code = ERR_FILE_READ;
+		if (job->code != ERR_OK)
+			break;
+		// тестировать
+		if (job->stat)
+			esFipsStep(job->fips, buf, read);
+		// писать
+		if (fwrite(buf, 1, read, fp) != read)
+			job->code = ERR_FILE_WRITE;
+		count -= read;
+	}
+	// завершение
+	if (fclose(fp) != 0 && job->code == ERR_OK)
+		job->code = ERR_FILE_WRITE;
+	blobClose(buf);
+}
+
+static err_t esStream(int argc, char *argv[])
+{
+	err_t code = ERR_OK;
+	es_stream_job_t* jobs;
+	char* files[ES_STREAM_MAX];
+	bool_t stat = FALSE;
+	size_t count;
+	size_t n, i;
+	mt_pool_t pool;
+	// разбор командной строки: опции
+	if (argc && strEq(argv[0], "-stat"))
+		stat = TRUE, --argc, ++argv;
+	// разбор командной строки: число параметров
+	if (argc < 3 || argc % 2 == 0 || (size_t)argc / 2 > ES_STREAM_MAX)
+		return ERR_CMD_PARAMS;
+	n = (size_t)argc / 2;
+	// разбор командной строки: число Кбайтов
+	if (!decIsValid(argv[0]) || !strLen(argv[0]) || 
+		strLen(argv[0]) > 8 || decCLZ(argv[0]))
+		return ERR_CMD_PARAMS;
+	count = (size_t)decToU32(argv[0]);
+	if (((count << 10) >> 10) != count)
+		return ERR_OUTOFRANGE;
+	count <<= 10, --argc, ++argv;
+	// подготовить задания
+	code = cmdBlobCreate(jobs, n * sizeof(es_stream_job_t));
+	ERR_CALL_CHECK(code);
+	for (i = 0; code == ERR_OK && i < n; ++i)
+	{
+		code = esParseSource(jobs[i].source, &jobs[i].par, argv[2 * i]);
+		jobs[i].file = files[i] = argv[2 * i + 1];
+		jobs[i].count = count, jobs[i].stat = stat;
+	}
+	if (code == ERR_OK)
+		code = cmdFileValNotExist((int)n, files);
+	ERR_CALL_HANDLE(code, cmdBlobClose(jobs));
+	// выгрузка данных
+	if (stat)
+		esFipsInit();
+	pool = n > 1 ? mtPoolCreate(n - 1) : 0;
+	for (i = 1; pool && i < n; ++i)
+		mtPoolSubmit(pool, esStreamJob, jobs + i);
+	esStreamJob(jobs);
+	if (pool)
+		mtPoolWait(pool), mtPoolClose(pool);
+	else
+		for (i = 1; i < n; ++i)
+			esStreamJob(jobs + i);
+	// печать результатов
+	for (i = 0; i < n; ++i)
+	{
+		if (jobs[i].code != ERR_OK)
+		{
+			printf("%s: %s\n", jobs[i].file, errMsg(jobs[i].code));
+			code = jobs[i].code;
+			continue;
+		}
+		if (!stat)
+			continue;
+		printf("%s [%s]: %u blocks, FIPS failures %u/%u/%u/%u\n", 
+			jobs[i].file, jobs[i].source, (unsigned)jobs[i].fips->blocks,
+			(unsigned)jobs[i].fips->fails[0], (unsigned)jobs[i].fips->fails[1],
+			(unsigned)jobs[i].fips->fails[2], (unsigned)jobs[i].fips->fails[3]);
+	}
+	cmdBlobClose(jobs);
+	return code;
+}
+
 /*
 *******************************************************************************
 Главная функция
@@ -226,6 +519,8 @@ int esMain(int argc, char* argv[])
 		code = esPrint(argc - 1, argv + 1);
 	else if (strEq(argv[0], "read"))
 		code = esRead(argc - 1, argv + 1);
+	else if (strEq(argv[0], "stream"))
+		code = esStream(argc - 1, argv + 1);
 	else
 		code = ERR_CMD_NOT_FOUND;
 	// завершить
@@ -4,7 +4,7 @@
 \brief Generate and manage private keys
 \project bee2/cmd 
 \created 2022.06.08
-\version 2022.10.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include <bee2/core/err.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
 #include <bee2/core/prng.h>
 #include <bee2/core/rng.h>
 #include <bee2/core/str.h>
@@ -40,6 +41,7 @@
 Пример:
   bee2cmd pwd gen share:"-l256 -t3 -pass pass:zed s1 s2 s3 s4 s5"
   bee2cmd kg gen -l256 -pass share:"-pass pass:zed s2 s3 s4" privkey
+  bee2cmd kg gen -j -pass pass:zed -count 1000 dev
   bee2cmd kg val -pass share:"-pass pass:zed s1 s2 s4" privkey
   bee2cmd kg chp -passin share:"-pass pass:zed s3 s1 s4"
     -passout pass:"1?23&aaA..." privkey
@@ -58,6 +60,9 @@ static int kgUsage()
 		"Usage:\n"
 		"  kg gen [-lnnn] -pass <scheme> <privkey>\n"
 		"    generate a private key and store it in <privkey>\n"
+		"  kg gen [-lnnn] [-j[N]] -pass <scheme> -count <n> <prefix>\n"
+		"    generate <n> private keys and store them in <prefix>1,...\n"
+		"    (public keys are listed in <prefix>.idx)\n"
 		"  kg val -pass <scheme> <privkey>\n"
 		"    validate <privkey>\n"
 		"  kg pub -pass <scheme> <privkey> <pubkey>\n"
@@ -68,6 +73,8 @@ static int kgUsage()
 		"    change the password used to protect <privkey>\n"
 		"  options:\n"
 		"    -lnnn -- security level: -l128 (by default), -l192 or -l256\n"
+		"    -j[N] -- protect keys in N threads (default: all cores)\n"
+		"    -count <n> -- number of keys: 1 <= <n> <= 999999\n"
 		"    -pass <scheme> -- description of a password\n"
 		"    -passin <scheme> -- description of an input password\n"
 		"    -passout <scheme> -- description of an output password\n",
@@ -153,11 +160,173 @@ static err_t kgSelfTest()
 	return ERR_OK;
 }
 
+/*
+*******************************************************************************
+Пакетная генерация ключей
+
+gen [-lnnn] [-j[N]] -pass <scheme> -count <n> <prefix>
+
+Генерируются n ключей, которые сохраняются в контейнерах <prefix>1,...,
+<prefix>n (номера дополняются слева нулями до одинаковой длины). Открытые
+ключи записываются в индексный файл <prefix>.idx: i-я строка файла содержит
+имя i-го контейнера и открытый ключ в шестнадцатеричной записи.
+
+Ключи генерируются в контексте bign с таблицей предвычислений. Генерация
+и защита контейнеров (PBKDF2) выполняются в потоках пула. Ключи
+обрабатываются окнами по KG_WINDOW штук, индексный файл дописывается
+после обработки очередного окна.
+*******************************************************************************
+*/
+
+#define KG_COUNT_MAX 999999
+#define KG_JOBS_MAX 256
+#define KG_WINDOW 256
+
+typedef struct
+{
+	const void* ctx;		/*!< контекст bign */
+	size_t len;				/*!< длина личного ключа */
+	cmd_pwd_t pwd;			/*!< пароль */
+	const char* prefix;		/*!< префикс имен контейнеров */
+	size_t digits;			/*!< число цифр в номерах */
+	char* names;			/*!< имена контейнеров окна */
+	size_t name_len;		/*!< длина буфера имени */
+	octet* pubkeys;			/*!< открытые ключи окна */
+	err_t codes[KG_WINDOW];	/*!< коды ошибок окна */
+} kg_batch_st;
+
+static size_t kgParseJobs(const char* opt)
+{
+	size_t jobs;
+	if (!strStartsWith(opt, "-j"))
+		return SIZE_MAX;
+	opt += strLen("-j");
+	if (!*opt)
+		return MAX2(mtProcCount(), 1);
+	if (strLen(opt) > 3 || !decIsValid(opt) || decCLZ(opt) ||
+		(jobs = (size_t)decToU32(opt)) == 0 || jobs > KG_JOBS_MAX)
+		return SIZE_MAX;
+	return jobs;
+}
+
+static char* kgBatchName(kg_batch_st* st, size_t i, size_t num)
+{
+	char* name = st->names + i * st->name_len;
+	size_t len = strLen(st->prefix);
+	strCopy(name, st->prefix);
+	decFromU32(name + len, st->digits, (u32)num);
+	return name;
+}
+
+static void kgBatchRange(size_t from, size_t to, void* arg)
+{
+	kg_batch_st* st = (kg_batch_st*)arg;
+	octet privkey[64];
+	for (; from < to; ++from)
+	{
+		octet* pubkey = st->pubkeys + from * 2 * st->len;
+		err_t code;
+		code = bignCtxGenKeypair(privkey, pubkey, st->ctx, rngStepR, 0);
+		if (code == ERR_OK)
+			code = cmdPrivkeyWrite(privkey, st->len,
+				st->names + from * st->name_len, st->pwd);
+		st->codes[from] = code;
+	}
+	memWipe(privkey, sizeof(privkey));
+}
+
+static err_t kgGenBatch(const bign_params* params, size_t len,
+	const cmd_pwd_t pwd, size_t count, size_t jobs, const char* prefix)
+{
+	err_t code;
+	size_t name_len;
+	void* stack;
+	kg_batch_st* st;
+	void* ctx;
+	char* idx_name;
+	char* hex;
+	FILE* fp;
+	mt_pool_t pool = 0;
+	size_t pos, n, i;
+	// pre
+	ASSERT(1 <= count && count <= KG_COUNT_MAX);
+	ASSERT(strIsValid(prefix));
+	// выделить память и разметить ее
+	name_len = strLen(prefix) + 6 + 1;
+	code = cmdBlobCreate(stack, sizeof(kg_batch_st) +
+		bignCtx_keep(len * 4) + KG_WINDOW * (name_len + 2 * len) +
+		name_len + 4 * len + 1);
+	ERR_CALL_CHECK(code);
+	st = (kg_batch_st*)stack;
+	ctx = st + 1;
+	st->names = (char*)ctx + bignCtx_keep(len * 4);
+	st->pubkeys = (octet*)(st->names + KG_WINDOW * name_len);
+	idx_name = (char*)(st->pubkeys + KG_WINDOW * 2 * len);
+	hex = idx_name + name_len;
+	st->ctx = ctx, st->len = len, st->pwd = pwd, st->prefix = prefix;
+	st->name_len = name_len;
+	for (st->digits = 1, n = count; n >= 10; n /= 10, ++st->digits);
+	// проверить отсутствие индексного файла и контейнеров
+	strCopy(idx_name, prefix), strCopy(idx_name + strLen(prefix), ".idx");
+	if (cmdFileValExist(1, &idx_name) == ERR_OK)
+		code = cmdFileValNotExist(1, &idx_name);
+	else for (i = 1; i <= count; ++i)
+	{
+		char* name = kgBatchName(st, 0, i);
+		if (cmdFileValExist(1, &name) == ERR_OK)
+		{
+			code = cmdFileValNotExist(1, &name);
+			break;
+		}
+	}
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// построить контекст
+	code = bignCtxStart(ctx, params);
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// открыть индексный файл
+	fp = fopen(idx_name, "w");
+	code = fp ? ERR_OK : ERR_FILE_CREATE;
+	ERR_CALL_HANDLE(code, cmdBlobClose(stack));
+	// цикл по окнам
+	if (jobs > 1)
+		pool = mtPoolCreate(jobs - 1);
+	for (pos = 1; code == ERR_OK && pos <= count; pos += n)
+	{
+		n = MIN2(count - pos + 1, KG_WINDOW);
+		for (i = 0; i < n; ++i)
+			kgBatchName(st, i, pos + i);
+		if (pool)
+			mtPoolFor(pool, n, kgBatchRange, st);
+		else
+			kgBatchRange(0, n, st);
+		for (i = 0; code == ERR_OK && i < n; ++i)
+		{
+			code = st->codes[i];
+			if (code != ERR_OK)
+				break;
+			hexFrom(hex, st->pubkeys + i * 2 * len, 2 * len);
+			if (fprintf(fp, "%s %s\n", st->names + i * name_len, hex) < 0)
+				code = ERR_FILE_WRITE;
+		}
+	}
+	if (pool)
+		mtPoolClose(pool);
+	// обновить ключ ГСЧ
+	rngRekey();
+	// завершить
+	if (fclose(fp) != 0 && code == ERR_OK)
+		code = ERR_FILE_WRITE;
+	cmdBlobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Генерация ключа
 
-gen [-lnnn] -pass <scheme> <privkey>
+gen [-lnnn] [-j[N]] [-count <n>] -pass <scheme> <privkey|prefix>
+
+При указании опции -count выполняется пакетная генерация.
 *******************************************************************************
 */
 
@@ -165,6 +334,8 @@ static err_t kgGen(int argc, char* argv[])
 {
 	err_t code = ERR_OK;
 	size_t len = 0;
+	size_t count = 0;
+	size_t jobs = 0;
 	cmd_pwd_t pwd = 0;
 	bign_params params[1];
 	void* stack = 0;
@@ -192,6 +363,36 @@ static err_t kgGen(int argc, char* argv[])
 			}
 			len /= 4, ++argv, --argc;
 		}
+		else if (strStartsWith(*argv, "-j"))
+		{
+			if (jobs)
+			{
+				code = ERR_CMD_DUPLICATE;
+				break;
+			}
+			if ((jobs = kgParseJobs(*argv)) == SIZE_MAX)
+			{
+				code = ERR_CMD_PARAMS;
+				break;
+			}
+			++argv, --argc;
+		}
+		else if (strEq(*argv, "-count"))
+		{
+			if (count)
+			{
+				code = ERR_CMD_DUPLICATE;
+				break;
+			}
+			++argv, --argc;
+			if (!argc || !decIsValid(*argv) || decCLZ(*argv) ||
+				strLen(*argv) > 6 || (count = (size_t)decToU32(*argv)) == 0)
+			{
+				code = ERR_CMD_PARAMS;
+				break;
+			}
+			++argv, --argc;
+		}
 		else if (strEq(*argv, "-pass"))
 		{
 			if (pwd)
@@ -217,12 +418,15 @@ static err_t kgGen(int argc, char* argv[])
 			break;
 		}
 	}
-	if (code == ERR_OK && (!pwd || argc != 1))
+	if (code == ERR_OK && (!pwd || argc != 1 || jobs && !count))
 		code = ERR_CMD_PARAMS;
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
 	// проверить файл-контейнер
-	code = cmdFileValNotExist(1, argv);
-	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	if (!count)
+	{
+		code = cmdFileValNotExist(1, argv);
+		ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	}
 	// загрузить параметры
 	if (len == 0)
 		len = 32;
@@ -236,6 +440,13 @@ static err_t kgGen(int argc, char* argv[])
 	// запустить ГСЧ
 	code = cmdRngStart(TRUE);
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+	// пакетная генерация?
+	if (count)
+	{
+		code = kgGenBatch(params, len, pwd, count, MAX2(jobs, 1), argv[0]);
+		cmdPwdClose(pwd);
+		return code;
+	}
 	// выделить память
 	code = cmdBlobCreate(stack, 3 * len);
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
@@ -4,7 +4,7 @@
 \brief Sign files and verify signatures
 \project bee2/cmd
 \created 2022.08.01
-\version 2022.10.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -53,6 +53,15 @@
   bee2cmd sig vfy -anchor cert0 file sig_file
   bee2cmd sig vfy -pubkey pubkey2 file sig_file
   bee2cmd sig print sig_file
+[пакетная подпись]
+  bee2cmd sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 \
+    file1 sig_file1 file2 sig_file2
+  echo "file1 sig_file1" > list
+  echo "file2 sig_file2" >> list
+  bee2cmd sig sign -certs "cert2 cert1 cert0" -pass pass:alice \
+    -list list privkey2
+  bee2cmd sig vfy -anchor cert0 file1 sig_file1 file2 sig_file2
+  bee2cmd sig vfy -anchor cert0 -list list
 [встроенная подпись]
   bee2cmd sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 \
     file file
@@ -76,9 +85,16 @@ static int sigUsage()
         "bee2cmd/%s: %s\n"
         "Usage:\n"
         "  sig sign [-certs <certs>] -pass <scheme> <privkey> <file> <sig>\n"
+        "    [<file> <sig> ...]\n"
         "    sign <file> using <privkey> and store the signature in <sig>\n"
+        "    (the container is unlocked once for all pairs <file> <sig>)\n"
+        "  sig sign [-certs <certs>] -pass <scheme> -list <list> <privkey>\n"
+        "    sign all pairs <file> <sig> listed in <list>\n"
 		"  sig vfy {-pubkey <pubkey> | -anchor <anchor>} <file> <sig>\n"
 		"    verify <sig> of <file> using either <pubkey> or <anchor>\n"
+		"  sig vfy -anchor <anchor> <file> <sig> <file> <sig> [...]\n"
+		"  sig vfy -anchor <anchor> -list <list>\n"
+		"    verify all pairs <file> <sig> using <anchor>\n"
 		"  sig print <sig>\n"
 		"    print a signature stored in <sig>\n"
 		"  .\n"
@@ -87,9 +103,12 @@ static int sigUsage()
 		"  <pubkey>\n"
 		"    file with a public key in hex\n"
 		"  <anchor>\n"
-		"    file with a trusted sertificate\n"
+		"    file with a trusted certificate or a bundle of certificates\n"
+		"  <list>\n"
+		"    text file with pairs <file> <sig> separated by whitespaces\n"
 		"  options:\n"
         "    -certs <certs> -- certificate chain\n"
+        "    -list <list> -- list of files to sign\n"
         "    -pass <scheme> -- password description\n",
         _name, _descr
     );
@@ -155,17 +174,62 @@ static err_t sigSelfTest()
 *******************************************************************************
 Выработка подписи
 
- sig sign [-certs <certs>] -pass <scheme> <file> <sig>
+ sig sign [-certs <certs>] -pass <scheme> <privkey> <file> <sig>
+   [<file> <sig> ...]
+ sig sign [-certs <certs>] -pass <scheme> -list <list> <privkey>
+
+Пары <file> <sig> подписываются функцией cmdSigSignBatch(): контейнер
+<privkey> открывается один раз, сертификаты собираются один раз, файлы
+хэшируются и подписи записываются параллельно.
+
+В списке <list> имена разделяются пробельными символами, в том числе
+символами перевода строки. Имена с пробелами окаймляются кавычками.
 *******************************************************************************
 */
 
+static err_t sigListRead(int* argc, char*** argv, const char* list)
+{
+	err_t code;
+	size_t count;
+	char* buf;
+	size_t i;
+	// прочитать список
+	code = cmdFileReadAll(0, &count, list);
+	ERR_CALL_CHECK(code);
+	code = cmdBlobCreate(buf, count + 1);
+	ERR_CALL_CHECK(code);
+	code = cmdFileReadAll((octet*)buf, &count, list);
+	ERR_CALL_HANDLE(code, cmdBlobClose(buf));
+	// заменить пробельные символы пробелами
+	for (i = 0; i < count; ++i)
+		if (buf[i] == '\n' || buf[i] == '\r' || buf[i] == '\t')
+			buf[i] = ' ';
+		else if (buf[i] == '\0')
+			break;
+	buf[i] = '\0';
+	// разобрать список
+	code = cmdArgCreate(argc, argv, buf);
+	cmdBlobClose(buf);
+	ERR_CALL_CHECK(code);
+	if (*argc == 0 || *argc % 2)
+	{
+		cmdArgClose(*argv);
+		code = ERR_CMD_PARAMS;
+	}
+	return code;
+}
+
 static err_t sigSign(int argc, char* argv[])
 {
 	err_t code;
 	const char* certs = 0;
+	char* list = 0;
 	cmd_pwd_t pwd = 0;
+	int pairc;
+	char** pairv = 0;
 	size_t privkey_len;
 	octet* privkey;
+	size_t i;
 	// самотестирование
 	code = sigSelfTest();
 	ERR_CALL_CHECK(code);
@@ -189,6 +253,18 @@ static err_t sigSign(int argc, char* argv[])
 			certs = *argv;
 			++argv, --argc;
 		}
+		else if (strStartsWith(*argv, "-list"))
+		{
+			if (list)
+			{
+				code = ERR_CMD_DUPLICATE;
+				break;
+			}
+			++argv, --argc;
+			ASSERT(argc > 0);
+			list = *argv;
+			++argv, --argc;
+		}
 		else if (strStartsWith(*argv, "-pass"))
 		{
 			if (pwd)
@@ -210,31 +286,51 @@ static err_t sigSign(int argc, char* argv[])
 			break;
 		}
 	}
-	if (code == ERR_OK && (!pwd || argc != 3))
+	if (code == ERR_OK && (!pwd || 
+		(list ? argc != 1 : argc < 3 || argc % 2 == 0)))
 		code = ERR_CMD_PARAMS;
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
-	// проверить наличие <privkey> и <file>
-	code = cmdFileValExist(2, argv);
+	// проверить наличие <privkey>
+	code = cmdFileValExist(1, argv);
 	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
-	// получить разрешение на перезапись <sig>
-	if (!cmdFileAreSame(argv[1], argv[2]))
+	// составить список пар <file> <sig>
+	if (list)
 	{
-		code = cmdFileValNotExist(1, argv + 2);
+		code = cmdFileValExist(1, &list);
+		ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
+		code = sigListRead(&pairc, &pairv, list);
 		ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
 	}
+	else
+		pairc = argc - 1, pairv = argv + 1;
+	// цикл по парам <file> <sig>
+	for (i = 0; code == ERR_OK && i < (size_t)pairc; i += 2)
+	{
+		// проверить наличие <file>
+		code = cmdFileValExist(1, pairv + i);
+		// получить разрешение на перезапись <sig>
+		if (code == ERR_OK && !cmdFileAreSame(pairv[i], pairv[i + 1]))
+			code = cmdFileValNotExist(1, pairv + i + 1);
+	}
 	// прочитать личный ключ
 	privkey_len = 0;
-	code = cmdPrivkeyRead(0, &privkey_len, argv[0], pwd);
-	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
-	code = cmdBlobCreate(privkey, privkey_len);
-	ERR_CALL_HANDLE(code, cmdPwdClose(pwd));
-	code = cmdPrivkeyRead(privkey, 0, argv[0], pwd);
-	cmdPwdClose(pwd);
-	ERR_CALL_HANDLE(code, cmdBlobClose(privkey));
-	// подписать
-	code = cmdSigSign(argv[2], argv[1], certs, privkey, privkey_len);
+	if (code == ERR_OK)
+		code = cmdPrivkeyRead(0, &privkey_len, argv[0], pwd);
+	if (code == ERR_OK)
+		code = cmdBlobCreate(privkey, privkey_len);
+	if (code == ERR_OK)
+	{
+		code = cmdPrivkeyRead(privkey, 0, argv[0], pwd);
+		// подписать
+		if (code == ERR_OK)
+			code = cmdSigSignBatch(pairc, pairv, certs, privkey, 
+				privkey_len);
+		cmdBlobClose(privkey);
+	}
 	// завершить
-	cmdBlobClose(privkey);
+	cmdPwdClose(pwd);
+	if (list)
+		cmdArgClose(pairv);
 	return code;
 }
 
@@ -243,9 +339,66 @@ static err_t sigSign(int argc, char* argv[])
 Проверка подписи
 
  sig vfy {-pubkey <pubkey> | -anchor <anchor>} <file> <sig>
+ sig vfy -anchor <anchor> <file> <sig> <file> <sig> [<file> <sig> ...]
+ sig vfy -anchor <anchor> -list <list>
+
+Пары <file> <sig> проверяются функцией cmdSigVerifyBatch(). Результат
+проверки печатается для каждой пары.
 *******************************************************************************
 */
 
+static err_t sigVfyBatch(int argc, char* argv[])
+{
+	err_t code;
+	int pairc;
+	char** pairv;
+	size_t count;
+	octet* anchor;
+	err_t* codes;
+	size_t i;
+	// составить список пар <file> <sig>
+	ASSERT(argc >= 3);
+	code = cmdFileValExist(1, argv);
+	ERR_CALL_CHECK(code);
+	if (strEq(argv[1], "-list"))
+	{
+		if (argc != 3)
+			return ERR_CMD_PARAMS;
+		code = cmdFileValExist(1, argv + 2);
+		ERR_CALL_CHECK(code);
+		code = sigListRead(&pairc, &pairv, argv[2]);
+		ERR_CALL_CHECK(code);
+	}
+	else if (argc % 2 == 0)
+		return ERR_CMD_PARAMS;
+	else
+		pairc = argc - 1, pairv = argv + 1;
+	// проверить наличие файлов
+	code = cmdFileValExist(pairc, pairv);
+	// прочитать anchor
+	if (code == ERR_OK)
+		code = cmdFileReadAll(0, &count, argv[0]);
+	if (code == ERR_OK)
+		code = cmdBlobCreate(anchor, count + (size_t)pairc / 2 * sizeof(err_t));
+	if (code == ERR_OK)
+	{
+		codes = (err_t*)(anchor + count);
+		code = cmdFileReadAll(anchor, &count, argv[0]);
+		// проверить подписи
+		if (code == ERR_OK)
+		{
+			code = cmdSigVerifyBatch(pairc, pairv, anchor, count, codes);
+			for (i = 0; i < (size_t)pairc / 2; ++i)
+				printf("%s: %s\n", pairv[2 * i], errMsg(codes[i]));
+		}
+		cmdBlobClose(anchor);
+	}
+	// завершить
+	if (pairv != argv + 1)
+		cmdArgClose(pairv);
+	return code;
+}
+
 static err_t sigVfy(int argc, char* argv[])
 {
 	err_t code;
@@ -254,6 +407,10 @@ static err_t sigVfy(int argc, char* argv[])
 	// самотестирование
 	code = sigSelfTest();
 	ERR_CALL_CHECK(code);
+	// пакетная проверка?
+	if (argc >= 4 && strEq(argv[0], "-anchor") &&
+		(argc > 4 || strEq(argv[2], "-list")))
+		return sigVfyBatch(argc - 1, argv + 1);
 	// проверить опции
 	if (argc != 4 ||
 		!strEq(argv[0], "-pubkey") && !strEq(argv[0], "-anchor"))
@@ -4,7 +4,7 @@
 \brief Integrity control of Windows PE Executables
 \project bee2/cmd
 \created 2011.10.18
-\version 2022.06.23
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -38,6 +38,9 @@
 
 Контрольная сумма представляет собой строку из STAMP_SIZE октетов, которая
 добавляется в исполнимый файл как строковый ресурс с идентификатором STAMP_ID.
+
+В командной строке можно указать несколько файлов и каталогов. Каталоги
+обходятся рекурсивно, обрабатываются файлы с расширениями exe и dll.
 *******************************************************************************
 */
 
@@ -49,11 +52,12 @@ static int stampUsage()
 	printf(
 		"bee2cmd/%s: %s\n"
 		"Usage:\n"
-		"  stamp -s filename\n"
-		"    set a stamp on filename\n"
-		"  stamp -c filename\n"
-		"    check a stamp of filename\n"
-		"\\pre  filename is a PE-module (exe or dll)\n"
+		"  stamp -s path [path...]\n"
+		"    set stamps on PE-modules\n"
+		"  stamp -c path [path...]\n"
+		"    check stamps of PE-modules\n"
+		"\\pre path is a PE-module (exe or dll) or a directory\n"
+		"  (exe and dll modules of the directory tree are processed)\n"
 		"\\pre resource file of the target module must contains the string\n"
 		"  %d %d {\"0123456789ABCDEF0123456789ABCDEF\"}\n",
 		_name, _descr,
@@ -71,7 +75,7 @@ static int stampUsage()
 
 //! Разбор командной строки
 /*! Разбирается командная строка:
-		stamp -{s|с} name
+		stamp -{s|с} path [path...]
 	\return 
 	- 0 -- set;
 	- 1 -- create;
@@ -80,7 +84,7 @@ static int stampUsage()
 static int stampParse(int argc, const char* argv[])
 {
 	// проверяем число аргументов
-	if (argc != 3)
+	if (argc < 3)
 		return stampUsage(argv[0]);
 	// проверяем режим
 	if (strEq(argv[1], "-s"))
@@ -272,7 +276,76 @@ static int stampCheck(const char* name)
 	UnmapViewOfFile(image);
 	CloseHandle(hMapping);
 	CloseHandle(hFile);
-	return 0;
+	return success ? 0 : -1;
+}
+
+/*
+*******************************************************************************
+Обход каталогов
+
+Каталог dir обходится рекурсивно. Точки повторной обработки (символические 
+ссылки, точки подключения) пропускаются. Обработка продолжается после 
+ошибок в отдельных файлах, возвращается -1, если ошибки были.
+*******************************************************************************
+*/
+
+static bool_t stampIsModule(const char* name)
+{
+	size_t len = strLen(name);
+	return len > 4 && (_stricmp(name + len - 4, ".exe") == 0 ||
+		_stricmp(name + len - 4, ".dll") == 0);
+}
+
+static int stampPath(const char* path, bool_t set);
+
+static int stampDir(const char* dir, bool_t set)
+{
+	WIN32_FIND_DATAA fd;
+	HANDLE hFind;
+	char* path;
+	int ret = 0;
+	// начать поиск
+	path = (char*)blobCreate(strLen(dir) + MAX_PATH + 2);
+	if (!path)
+	{
+		printf("Insufficient memory.\n");
+		return -1;
+	}
+	strCopy(path, dir), strCopy(path + strLen(dir), "\\*");
+	hFind = FindFirstFileA(path, &fd);
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		blobClose(path);
+		printf("Directory \"%s\" could not be open.\n", dir);
+		return -1;
+	}
+	// обойти каталог
+	do
+	{
+		if (strEq(fd.cFileName, ".") || strEq(fd.cFileName, "..") ||
+			(fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+			continue;
+		if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) &&
+			!stampIsModule(fd.cFileName))
+			continue;
+		strCopy(path + strLen(dir) + 1, fd.cFileName);
+		if (stampPath(path, set) != 0)
+			ret = -1;
+	}
+	while (FindNextFileA(hFind, &fd));
+	// завершение
+	FindClose(hFind);
+	blobClose(path);
+	return ret;
+}
+
+static int stampPath(const char* path, bool_t set)
+{
+	DWORD attrs = GetFileAttributesA(path);
+	if (attrs != INVALID_FILE_ATTRIBUTES &&
+		(attrs & FILE_ATTRIBUTE_DIRECTORY))
+		return stampDir(path, set);
+	return set ? stampSet(path) : stampCheck(path);
 }
 
 /*
@@ -284,15 +357,16 @@ static int stampCheck(const char* name)
 int stampMain(int argc, char* argv[])
 {
 	int d;
+	int ret = 0;
 	// разобрать командную строку
 	d = stampParse(argc, argv);
-	// set?
-	if (d == 0)
-		return stampSet(argv[2]);
-	// create?
-	else if (d == 1)
-		return stampCheck(argv[2]);
-	return -1;
+	if (d != 0 && d != 1)
+		return -1;
+	// обработать пути (set при d == 0, check при d == 1)
+	for (argc -= 2, argv += 2; argc--; ++argv)
+		if (stampPath(argv[0], d == 0) != 0)
+			ret = -1;
+	return ret;
 }
 
 /*
@@ -3,7 +3,7 @@ rem ===========================================================================
 rem \brief Testing command-line interface
 rem \project bee2evp/cmd
 rem \created 2022.06.24
-rem \version 2022.11.04
+rem \version 2026.10.15
 rem ===========================================================================
 
 rem ===========================================================================
@@ -110,7 +110,7 @@ rem ===========================================================================
 
 echo ****** Testing bee2cmd/kg...
 
-del /q privkey0 privkey1 privkey2 pubkey0 pubkey2 2> nul
+del /q privkey0 privkey1 privkey2 pubkey0 pubkey2 kk1 kk2 kk3 kk.idx 2> nul
 
 bee2cmd kg gen -l256 -pass share:"-pass pass:zed s2 s3 s4"
 if %ERRORLEVEL% equ 0 goto Error
@@ -149,6 +149,18 @@ if %ERRORLEVEL% neq 0 goto Error
 for %%A in (pubkey2) do set pubkey2_len=%%~zA
 if %pubkey2_len% neq 64 goto Error
 
+bee2cmd kg gen -j2 -pass pass:bulk kk1
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd kg gen -j2 -pass pass:bulk -count 3 kk
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd kg print -pass pass:bulk kk2
+if %ERRORLEVEL% neq 0 goto Error
+
+findstr /b /c:"kk3 " kk.idx
+if %ERRORLEVEL% neq 0 goto Error
+
 echo ****** OK
 
 rem ===========================================================================
@@ -157,7 +169,7 @@ rem ===========================================================================
 
 echo ****** Testing bee2cmd/cvc...
 
-del /q cert0 cert1 cert2 req1 req2 2> nul
+del /q cert0 cert1 cert2 cert3 cert4 req1 req2 req3 2> nul
 
 bee2cmd cvc root -authority BYCA0000 -from 220707 -until 990707 ^
 -pass pass:root -eid EEEEEEEEEE -esign 7777 privkey0 cert0
@@ -186,6 +198,25 @@ if %ERRORLEVEL% neq 0 goto Error
 bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert2
 if %ERRORLEVEL% neq 0 goto Error
 
+bee2cmd cvc req -authority BYCA1000 -holder "590082394655" -from 220712 ^
+-until 391231 -pass pass:alice privkey2 req3
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert3 req3
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert3 req3 cert4
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd cvc val -date 220712 cert0 cert1 cert3
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd cvc val -date 220712 cert0 cert1 cert4
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd cvc match -pass pass:alice privkey2 cert4
+if %ERRORLEVEL% neq 0 goto Error
+
 bee2cmd cvc match -pass pass:alice privkey2 cert2
 if %ERRORLEVEL% neq 0 goto Error
 
@@ -267,6 +298,23 @@ if %ERRORLEVEL% neq 0 goto Error
 bee2cmd sig vfy -anchor cert0 ff ss
 if %ERRORLEVEL% equ 0 goto Error
 
+copy /b cert0+cert1 aa > nul
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor aa ff ss
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor aa ff ss ff ss
+if %ERRORLEVEL% neq 0 goto Error
+
+copy /b cert0+cert0 aa > nul
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor aa ff ss
+if %ERRORLEVEL% equ 0 goto Error
+
+del /q aa 2> nul
+
 bee2cmd sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 ff ff
 if %ERRORLEVEL% neq 0 goto Error
 
@@ -296,6 +344,63 @@ if %ERRORLEVEL% neq 0 goto Error
 bee2cmd sig vfy -anchor cert1 ff ss
 if %ERRORLEVEL% equ 0 goto Error
 
+del /q ss ss1 ff1 2> nul
+copy ff ff1 > nul
+
+bee2cmd sig sign -certs cert2 -pass pass:alice privkey2 ff ss ff1
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd sig sign -certs cert2 -pass pass:alice privkey2 ff ss ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -pubkey pubkey2 ff ss
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -pubkey pubkey2 ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor cert2 ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+del /q ss ss1 2> nul
+echo ff ss> ll
+echo ff1 ss1>> ll
+
+bee2cmd sig sign -certs cert2 -pass pass:alice -list ll privkey2 ff ss
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd sig sign -certs cert2 -pass pass:alice -list ll privkey2
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -pubkey pubkey2 ff ss
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor cert2 ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor cert2 ff ss ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor cert1 -list ll
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd sig vfy -anchor cert2 -list ll
+if %ERRORLEVEL% neq 0 goto Error
+
+del /q sss 2> nul
+bee2cmd sig sign -certs "cert2 cert1" -pass pass:alice privkey2 ff sss
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd sig vfy -anchor cert2 ff ss ff sss ff1 ss1
+if %ERRORLEVEL% neq 0 goto Error
+
+del /q sss 2> nul
+echo 1 >> ff1
+bee2cmd sig vfy -anchor cert2 ff ss ff1 ss1
+if %ERRORLEVEL% equ 0 goto Error
+
+del /q ss ss1 ff1 ll 2> nul
+
 bee2cmd sig sign -pass pass:alice privkey2 ff ff
 if %ERRORLEVEL% neq 0 goto Error
 
@@ -322,6 +427,112 @@ if %ERRORLEVEL% neq 0 goto Error
 for %%A in (dd) do set dd_len=%%~zA
 if %dd_len% neq 1024 goto Error
 
+del /q dd1 dd2 2> nul
+
+bee2cmd es stream -stat 16 sys dd1 timer1 dd2
+if %ERRORLEVEL% neq 0 goto Error
+
+for %%A in (dd2) do set dd2_len=%%~zA
+if %dd2_len% neq 16384 goto Error
+
+echo ****** OK
+
+rem ===========================================================================
+rem  bee2cmd/env
+rem ===========================================================================
+
+echo ****** Testing bee2cmd/env...
+
+del /q ff ff1 ff2 ee 2> nul
+
+bee2cmd es read sys 5 ff
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd env enc -chunk 1000 -j2 -pubkey pubkey2 ff ee
+if %ERRORLEVEL% neq 0 goto Error
+
+for %%A in (ee) do set ee_len=%%~zA
+if %ee_len% neq 5264 goto Error
+
+bee2cmd env dec -pass pass:alice privkey2 ee ff1
+if %ERRORLEVEL% neq 0 goto Error
+
+fc /b ff ff1 > nul
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd env dec -pass pass:bob privkey2 ee ff2
+if %ERRORLEVEL% equ 0 goto Error
+
+echo ****** OK
+
+rem ===========================================================================
+rem  bee2cmd/batch
+rem ===========================================================================
+
+echo ****** Testing bee2cmd/batch...
+
+del /q bb b1 b2 sb1 sb2 2> nul
+
+echo test1> b1
+echo test2> b2
+echo # sign twice with the same key> bb
+echo sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 b1 sb1>> bb
+echo sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 b2 sb2>> bb
+
+bee2cmd batch bb
+if %ERRORLEVEL% neq 0 goto Error
+
+echo sig vfy -anchor cert0 b1 sb1> bb
+echo sig vfy -anchor cert0 b2 sb2>> bb
+
+bee2cmd batch < bb
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd batch -keep 0 bb
+if %ERRORLEVEL% neq 0 goto Error
+
+echo kg print -pass pass:alice privkey2> bb
+echo kg print -pass pass:bob privkey2>> bb
+
+bee2cmd batch bb
+if %ERRORLEVEL% equ 0 goto Error
+
+echo batch bb> bb
+
+bee2cmd batch bb
+if %ERRORLEVEL% equ 0 goto Error
+
+echo ver> bb
+
+bee2cmd batch -keep 86401 bb
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd batch -keep 86400 bb
+if %ERRORLEVEL% neq 0 goto Error
+
+echo ****** OK
+
+rem ===========================================================================
+rem  bee2cmd/bench
+rem ===========================================================================
+
+echo ****** Testing bee2cmd/bench...
+
+bee2cmd bench -list
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd bench -list belt
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd bench -json -json belt-ecb
+if %ERRORLEVEL% equ 0 goto Error
+
+bee2cmd bench belt-ecb bash256
+if %ERRORLEVEL% neq 0 goto Error
+
+bee2cmd bench -json belt-ctr bign-verify[128]
+if %ERRORLEVEL% neq 0 goto Error
+
 echo ****** OK
 
 rem ===========================================================================
@@ -3,7 +3,7 @@
 # \brief Testing command-line interface
 # \project bee2evp/cmd
 # \created 2022.06.24
-# \version 2022.11.04
+# \version 2026.10.15
 # =============================================================================
 
 bee2cmd=./bee2cmd
@@ -109,11 +109,24 @@ test_kg() {
   if [ "$(wc -c pubkey2 | awk '{print $1}')" != "64" ]; then
     return 1
   fi
+  rm -rf kk1 kk2 kk3 kk.idx \
+    || return 2
+  $bee2cmd kg gen -j2 -pass pass:bulk kk1 \
+    && return 1
+  $bee2cmd kg gen -j2 -pass pass:bulk -count 3 kk \
+    || return 1
+  if [ "$(wc -l < kk.idx)" != "3" ]; then
+    return 1
+  fi
+  if [ "$(sed -n 2p kk.idx)" != \
+    "kk2 $($bee2cmd kg print -pass pass:bulk kk2)" ]; then
+    return 1
+  fi
   return 0
 }
 
 test_cvc() {
-  rm -rf cert0 cert1 cert2 req1 req2 \
+  rm -rf cert0 cert1 cert2 cert3 cert4 req1 req2 req3 \
     || return 2
   $bee2cmd cvc root -authority BYCA0000 -from 220707 -until 990707 \
     -pass pass:root -eid EEEEEEEEEE -esign 7777 privkey0 cert0 \
@@ -134,6 +147,19 @@ test_cvc() {
     || return 1
   $bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert2 \
     || return 1
+  $bee2cmd cvc req -authority BYCA1000 -from 220712 -until 391231 \
+    -holder "590082394655" -pass pass:alice privkey2 req3 \
+    || return 1
+  $bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert3 req3 \
+    && return 1
+  $bee2cmd cvc iss -pass pass:trent privkey1 cert1 req2 cert3 req3 cert4 \
+    || return 1
+  $bee2cmd cvc val -date 220712 cert0 cert1 cert3 \
+    || return 1
+  $bee2cmd cvc val -date 220712 cert0 cert1 cert4 \
+    || return 1
+  $bee2cmd cvc match -pass pass:alice privkey2 cert4 \
+    || return 1
   $bee2cmd cvc match -pass pass:alice privkey2 cert2 \
     || return 1
   $bee2cmd cvc match -pass pass:alisa privkey2 cert2 \
@@ -192,6 +218,17 @@ test_sig(){
 
   $bee2cmd sig vfy -anchor cert0 ff ss \
     && return 1
+  cat cert0 cert1 > aa \
+    || return 2
+  $bee2cmd sig vfy -anchor aa ff ss \
+    || return 1
+  $bee2cmd sig vfy -anchor aa ff ss ff ss \
+    || return 1
+  cat cert0 cert0 > aa \
+    || return 2
+  $bee2cmd sig vfy -anchor aa ff ss \
+    && return 1
+  rm -rf aa
   $bee2cmd sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 ff ff \
     || return 1
   $bee2cmd sig vfy -pubkey pubkey2 ff ff \
@@ -216,6 +253,48 @@ test_sig(){
   $bee2cmd sig vfy -anchor cert1 ff ss \
     && return 1
 
+  rm -rf ss ss1 ff1
+  cp ff ff1 \
+    || return 2
+  $bee2cmd sig sign -certs cert2 -pass pass:alice privkey2 ff ss ff1 \
+    && return 1
+  $bee2cmd sig sign -certs cert2 -pass pass:alice privkey2 ff ss ff1 ss1 \
+    || return 1
+  $bee2cmd sig vfy -pubkey pubkey2 ff ss \
+    || return 1
+  $bee2cmd sig vfy -pubkey pubkey2 ff1 ss1 \
+    || return 1
+  $bee2cmd sig vfy -anchor cert2 ff1 ss1 \
+    || return 1
+  rm -rf ss ss1
+  printf "ff ss\nff1 ss1\n" > ll \
+    || return 2
+  $bee2cmd sig sign -certs cert2 -pass pass:alice -list ll privkey2 ff ss \
+    && return 1
+  $bee2cmd sig sign -certs cert2 -pass pass:alice -list ll privkey2 \
+    || return 1
+  $bee2cmd sig vfy -pubkey pubkey2 ff ss \
+    || return 1
+  $bee2cmd sig vfy -anchor cert2 ff1 ss1 \
+    || return 1
+  $bee2cmd sig vfy -anchor cert2 ff ss ff1 ss1 \
+    || return 1
+  $bee2cmd sig vfy -anchor cert1 -list ll \
+    && return 1
+  $bee2cmd sig vfy -anchor cert2 -list ll \
+    || return 1
+  rm -rf sss
+  $bee2cmd sig sign -certs "cert2 cert1" -pass pass:alice privkey2 ff sss \
+    || return 1
+  $bee2cmd sig vfy -anchor cert2 ff ss ff sss ff1 ss1 \
+    || return 1
+  rm -rf sss
+  echo 1 >> ff1 \
+    || return 2
+  $bee2cmd sig vfy -anchor cert2 ff ss ff1 ss1 \
+    && return 1
+  rm -rf ss ss1 ff1 ll
+
   $bee2cmd sig sign -pass pass:alice privkey2 ff ff \
     || return 1
   $bee2cmd sig vfy -pubkey pubkey2 ff ff \
@@ -239,6 +318,190 @@ test_es() {
   if [ "$(wc -c dd | awk '{print $1}')" != "1024" ]; then
     return 1
   fi
+  rm -rf dd1 dd2 \
+    || return 2
+  $bee2cmd es stream -stat 64 sys dd1 \
+    || return 1
+  $bee2cmd es stream 16 sys dd1 timer1 \
+    && return 1
+  rm -rf dd1 \
+    || return 2
+  $bee2cmd es stream -stat 16 sys dd1 timer1 dd2 \
+    || return 1
+  if [ "$(wc -c dd2 | awk '{print $1}')" != "16384" ]; then
+    return 1
+  fi
+
+  return 0
+}
+
+test_env() {
+  rm -rf ff ff1 ff2 ff3 ee ee1\
+    || return 2
+
+  $bee2cmd es read sys 5 ff \
+    || return 1
+  $bee2cmd env enc -chunk 1000 -j2 -pubkey pubkey2 ff ee \
+    || return 1
+  if [ "$(wc -c ee | awk '{print $1}')" != "5264" ]; then
+    return 1
+  fi
+  $bee2cmd env dec -pass pass:alice privkey2 ee ff1 \
+    || return 1
+  cmp -s ff ff1 \
+    || return 1
+  $bee2cmd env dec -j3 -pass pass:alice privkey2 ee ff2 \
+    || return 1
+  cmp -s ff ff2 \
+    || return 1
+  $bee2cmd env dec -pass pass:bob privkey2 ee ff3 \
+    && return 1
+  head -c 4232 ee > ee1
+  $bee2cmd env dec -pass pass:alice privkey2 ee1 ff3 \
+    && return 1
+  if [ -f ff3 ]; then
+    return 1
+  fi
+
+  rm -rf ff1 ff2 ee ee1
+  head -c 3000 ff > ff1
+  $bee2cmd env enc -chunk 1000 -pubkey pubkey2 ff1 ee \
+    || return 1
+  $bee2cmd env dec -j -pass pass:alice privkey2 ee ff2 \
+    || return 1
+  cmp -s ff1 ff2 \
+    || return 1
+  $bee2cmd env enc -chunk 0 -pubkey pubkey2 ff1 ee1 \
+    && return 1
+
+  return 0
+}
+
+test_bsum() {
+  rm -rf dd dd0 dd1 sums sums1\
+    || return 2
+
+  $bee2cmd es read sys 2000 dd \
+    || return 1
+  touch dd0 \
+    || return 2
+  $bee2cmd bsum -bash256 dd dd0 > sums \
+    || return 1
+  $bee2cmd bsum -bash256 -c sums \
+    || return 1
+  $bee2cmd bsum -bash256 -j4 -c sums \
+    || return 1
+  $bee2cmd bsum -j dd dd0 dd > sums \
+    || return 1
+  $bee2cmd bsum -c sums \
+    || return 1
+  $bee2cmd bsum -j2 -c sums \
+    || return 1
+  $bee2cmd bsum -bash256 -j2 -c sums \
+    && return 1
+  $bee2cmd bsum -bash384-tree dd dd0 > sums \
+    || return 1
+  $bee2cmd bsum -bash384-tree -c sums \
+    || return 1
+  $bee2cmd bsum -bash384 -c sums \
+    && return 1
+  $bee2cmd bsum -bash-tree dd \
+    && return 1
+  $bee2cmd bsum -belt-hash -bash256 -bash512 -j2 dd dd0 > sums \
+    || return 1
+  $bee2cmd bsum -belt-hash -bash256 -bash512 -c sums \
+    || return 1
+  $bee2cmd bsum -bash512 -belt-hash -c sums \
+    && return 1
+  $bee2cmd bsum -bash256 dd > sums1 \
+    || return 1
+  grep -q "^BASH256 (dd) = $(cut -d' ' -f1 sums1)\$" sums \
+    || return 1
+  $bee2cmd bsum -bash256 -bash384-tree dd \
+    && return 1
+  $bee2cmd bsum -bash256 -bash256 dd \
+    && return 1
+  head -c 9437185 /dev/zero > dd1 \
+    || return 2
+  $bee2cmd bsum -belt-hash dd1 > sums \
+    || return 1
+  grep -qi "^68183F965E2112A15F219058F40F288B7CD63FE6DB9A0AB463F88CC96412D032" \
+    sums || return 1
+
+  return 0
+}
+
+test_batch() {
+  rm -rf bb b1 b2 s1 s2 s3 \
+    || return 2
+
+  echo test1 > b1
+  echo test2 > b2
+  cat > bb <<EOT
+# sign twice with the same key
+sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 b1 s1
+
+sig sign -certs "cert2 cert1 cert0" -pass pass:alice privkey2 b2 s2
+EOT
+  $bee2cmd batch bb \
+    || return 1
+  $bee2cmd sig vfy -anchor cert0 b1 s1 \
+    || return 1
+  $bee2cmd sig vfy -anchor cert0 b2 s2 \
+    || return 1
+  cat > bb <<EOT
+sig vfy -anchor cert0 b1 s1
+sig vfy -anchor cert0 b2 s2
+  sig vfy -pubkey pubkey2 b2 s2
+EOT
+  $bee2cmd batch < bb | grep -c ": line [1-3]: 0\$" | grep -q "^3\$" \
+    || return 1
+  $bee2cmd batch -keep 0 bb \
+    || return 1
+  cat > bb <<EOT
+kg print -pass pass:alice privkey2
+kg print -pass pass:bob privkey2
+EOT
+  $bee2cmd batch bb \
+    && return 1
+  $bee2cmd batch bb | grep -q ": line 1: 0\$" \
+    || return 1
+  echo "sig vfy -anchor cert0 b1 s2" > bb
+  $bee2cmd batch bb \
+    && return 1
+  echo "batch bb" > bb
+  $bee2cmd batch bb \
+    && return 1
+  echo "ver" > bb
+  $bee2cmd batch -keep 86401 bb \
+    && return 1
+  $bee2cmd batch -keep 1 -keep 1 bb \
+    && return 1
+  $bee2cmd batch bb bb \
+    && return 1
+  $bee2cmd batch -keep 86400 bb \
+    || return 1
+
+  return 0
+}
+
+test_bench() {
+  $bee2cmd bench -list | grep -q "^bign-verify\[256\]\$" \
+    || return 1
+  $bee2cmd bench -list belt \
+    && return 1
+  $bee2cmd bench -json -json belt-ecb \
+    && return 1
+  $bee2cmd bench -jsn belt-ecb \
+    && return 1
+  $bee2cmd bench belt-ecb bash256 | grep -q "^bash256: .* cpb" \
+    || return 1
+  $bee2cmd bench -json belt-ctr "bign-verify[128]" > bench.json \
+    || return 1
+  grep -q "\"name\": \"bign-verify\[128\]\", \"unit\": \"op\"" bench.json \
+    || return 1
+  grep -q "\"platform\": \"version=" bench.json \
+    || return 1
 
   return 0
 }
@@ -254,4 +517,5 @@ run_test() {
 } 
 
 run_test ver && run_test pwd && run_test kg && run_test cvc \
-  && run_test sig && run_test es
\ No newline at end of file
+  && run_test sig && run_test es && run_test env && run_test bsum \
+  && run_test batch && run_test bench
\ No newline at end of file
@@ -4,7 +4,7 @@
 \brief Version and build information
 \project bee2/cmd 
 \created 2022.06.22
-\version 2022.10.21
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,6 +12,7 @@
 
 #include "../cmd.h"
 #include <bee2/core/util.h>
+#include <bee2/crypto/bash.h>
 #include <stdio.h>
 
 /*
@@ -22,7 +23,8 @@
 - печать версии Bee2 и даты сборки;
 - печать опций сборки:
   - SAFE_FAST vs SAFE_SAFE;
-  - bash_platform.
+  - bash_platform;
+- печать описания платформы (см. utilPlatform()).
 *******************************************************************************
 */
 
@@ -47,8 +49,6 @@ static int verUsage()
 *******************************************************************************
 */
 
-extern const char bash_platform[];
-
 static void verPrint()
 {
 	printf(
@@ -56,14 +56,16 @@ static void verPrint()
 		"  version: %s [%s]\n"
 		"  build options\n"
 		"    safe (constant-time): %s\n"
-		"    bash_platform: %s\n",
+		"    bash_platform: %s\n"
+		"  platform: %s\n",
 		utilVersion(), __DATE__,
 #ifdef SAFE_SAFE
 		"ON",
 #else
 		"OFF",
 #endif
-		bash_platform
+		bashPlatform(),
+		utilPlatform()
 	);
 }
 
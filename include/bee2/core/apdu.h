@@ -4,7 +4,7 @@
 \brief Smart card Application Protocol Data Unit
 \project bee2 [cryptographic library]
 \created 2022.10.31
-\version 2022.11.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -126,6 +126,38 @@ size_t apduCmdDec(
 	size_t count			/*!< [in] длина apdu в октетах */
 );
 
+/*!	\brief Представление команды APDU
+
+	Представление содержит поля заголовка команды и ссылку на данные
+	команды внутри ее кода. Данные не копируются.
+	\remark Представление действительно, пока не изменен и не освобожден
+	код, на который оно ссылается.
+*/
+typedef struct {
+	octet cla;			/*!< класс команды */
+	octet ins;			/*!< инструкция команды */
+	octet p1;			/*!< первый параметр команды */
+	octet p2;			/*!< второй параметр команды */
+	size_t rdf_len;		/*!< максимальная длина данных ответа */
+	size_t cdf_len;		/*!< длина данных команды */
+	const octet* cdf;	/*!< данные команды (внутри кода) */
+} apdu_cmd_view_t;
+
+/*!	\brief Представление кода команды
+
+	Код команды [count]apdu декодируется без копирования данных. Если
+	view != 0, то в view размещаются поля заголовка, длины и указатель
+	view->cdf на данные команды внутри apdu.
+	\pre Буфер [count]apdu корректен.
+	\return Признак успеха (корректности кода).
+	\remark Правила декодирования совпадают с правилами apduCmdDec().
+*/
+bool_t apduCmdView(
+	apdu_cmd_view_t* view,	/*!< [out] представление команды */
+	const octet apdu[],		/*!< [in] код команды */
+	size_t count			/*!< [in] длина apdu в октетах */
+);
+
 /*!
 *******************************************************************************
 \file apdu.h
@@ -195,6 +227,34 @@ size_t apduRespDec(
 	size_t count				/*!< [in] длина apdu в октетах */
 );
 
+/*!	\brief Представление ответа APDU
+
+	Представление содержит статусы ответа и ссылку на данные ответа внутри
+	его кода. Данные не копируются.
+	\remark Представление действительно, пока не изменен и не освобожден
+	код, на который оно ссылается.
+*/
+typedef struct {
+	octet sw1;			/*!< первый статус ответа */
+	octet sw2;			/*!< второй статус ответа */
+	size_t rdf_len;		/*!< длина данных ответа */
+	const octet* rdf;	/*!< данные ответа (внутри кода) */
+} apdu_resp_view_t;
+
+/*!	\brief Представление кода ответа
+
+	Код ответа [count]apdu декодируется без копирования данных. Если
+	view != 0, то в view размещаются статусы, длина и указатель view->rdf
+	на данные ответа внутри apdu.
+	\pre Буфер [count]apdu корректен.
+	\return Признак успеха (корректности кода).
+*/
+bool_t apduRespView(
+	apdu_resp_view_t* view,		/*!< [out] представление ответа */
+	const octet apdu[],			/*!< [in] код ответа */
+	size_t count				/*!< [in] длина apdu в октетах */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
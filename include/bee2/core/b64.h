@@ -4,7 +4,7 @@
 \brief The Base64 encoding
 \project bee2 [cryptographic library]
 \created 2016.06.16
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -102,6 +102,120 @@ void b64To(
 	const char* src		/*!< [in] строка-источник */
 );
 
+/*!
+*******************************************************************************
+\file b64.h
+
+\section b64-stream Потоковое кодирование
+
+Функции b64FromXXX и b64ToXXX кодируют и декодируют данные, которые
+поступают фрагментами произвольной длины. Неполные тройки октетов
+(при кодировании) и четверки символов (при декодировании) сохраняются
+в состоянии и дополняются следующими фрагментами. Тем самым большие
+данные (например, файлы) обрабатываются при ограниченной памяти.
+Результат кодирования (декодирования) совпадает с результатом функции
+b64From() (b64To()), примененной к объединению фрагментов.
+
+Функции потокового декодирования не требуют корректности входных данных:
+каждый символ проверяется. Обнаружив ошибку, функция b64ToStep() 
+возвращает SIZE_MAX, и состояние становится непригодным для дальнейшего
+декодирования. Символы после четверки с паддингом ('=') запрещены.
+Кодовые слова не разбиваются на строки, и пробельные символы
+не допускаются.
+*******************************************************************************
+*/
+
+/*!	\brief Длина состояния кодирования
+
+	Возвращается длина состояния (в октетах) функций потокового
+	кодирования.
+	\return Длина состояния.
+*/
+size_t b64From_keep();
+
+/*!	\brief Инициализация кодирования
+
+	По адресу state формируется состояние потокового кодирования.
+	\pre По адресу state зарезервировано b64From_keep() октетов.
+*/
+void b64FromStart(
+	void* state			/*!< [out] состояние */
+);
+
+/*!	\brief Кодирование фрагмента
+
+	Фрагмент [count]src кодируется символами base64, которые записываются
+	в dest. Неполная тройка октетов в конце фрагмента сохраняется
+	в state.
+	\pre Буфер dest вмещает 4 * ((count + 2) / 3) символов.
+	\pre Буферы dest и src не пересекаются.
+	\return Число записанных символов (кратно 4).
+	\remark Завершающий нулевой символ не записывается.
+*/
+size_t b64FromStep(
+	char* dest,			/*!< [out] символы base64 */
+	const void* src,	/*!< [in] фрагмент данных */
+	size_t count,		/*!< [in] длина фрагмента в октетах */
+	void* state			/*!< [in,out] состояние */
+);
+
+/*!	\brief Завершение кодирования
+
+	Неполная тройка октетов, сохраненная в state, кодируется символами
+	base64 (с паддингом), которые записываются в dest. Состояние
+	очищается.
+	\pre Буфер dest вмещает 4 символа.
+	\return Число записанных символов: 0 или 4.
+	\remark Завершающий нулевой символ не записывается.
+*/
+size_t b64FromStop(
+	char* dest,			/*!< [out] символы base64 */
+	void* state			/*!< [in,out] состояние */
+);
+
+/*!	\brief Длина состояния декодирования
+
+	Возвращается длина состояния (в октетах) функций потокового
+	декодирования.
+	\return Длина состояния.
+*/
+size_t b64To_keep();
+
+/*!	\brief Инициализация декодирования
+
+	По адресу state формируется состояние потокового декодирования.
+	\pre По адресу state зарезервировано b64To_keep() октетов.
+*/
+void b64ToStart(
+	void* state			/*!< [out] состояние */
+);
+
+/*!	\brief Декодирование фрагмента
+
+	Фрагмент [count]src base64-строки декодируется в dest. Неполная
+	четверка символов в конце фрагмента сохраняется в state.
+	\pre Буфер dest вмещает 3 * ((count + 3) / 4) октетов.
+	\pre Буферы dest и src не пересекаются.
+	\return Число записанных октетов или SIZE_MAX в случае ошибки формата.
+	\remark Фрагмент src может не заканчиваться нулевым символом.
+*/
+size_t b64ToStep(
+	void* dest,			/*!< [out] декодированные данные */
+	const char* src,	/*!< [in] фрагмент base64-строки */
+	size_t count,		/*!< [in] длина фрагмента в символах */
+	void* state			/*!< [in,out] состояние */
+);
+
+/*!	\brief Завершение декодирования
+
+	Проверяется, что в состоянии state base64-строка декодирована
+	полностью: ошибок формата не было и неполной четверки символов нет.
+	\return Признак корректного завершения.
+*/
+bool_t b64ToStop(
+	const void* state	/*!< [in] состояние */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Blobs
 \project bee2 [cryptographic library]
 \created 2012.04.01
-\version 2022.06.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -41,6 +41,20 @@ memcpy, memset. Дополнительно по указателю можно о
 например, через файл подкачки. Поэтому в блобах рекомендуется размещать
 ключи и другие критические объекты.
 
+Память для блобов может выделяться в арене -- области памяти, 
+зафиксированной в оперативной памяти (см. blobArenaCreate()). Арена 
+нарезается на фрагменты размера 1, 2, 4, ..., 64 Кб, фрагменты 
+повторно используются после очистки. Использование арены позволяет 
+не обращаться к куче при создании и закрытии блобов и предотвращает 
+попадание содержимого блобов в файл подкачки. Если арена не создана 
+или исчерпана, то память выделяется в куче.
+
+Память, выделенная в куче, после закрытия блоба может сохраняться в кэше 
+потока (см. blobCacheSetMax()) и использоваться при последующем создании 
+блоба в этом же потоке. Кэш позволяет высокоуровневым функциям, которые 
+при каждом вызове создают и закрывают блоб для состояния и стека, 
+не обращаться к куче.
+
 \pre В функциях работы с блобами дескрипторы входных блобов корректны.
 *******************************************************************************
 */
@@ -104,6 +118,55 @@ void blobClose(
 	blob_t blob		/*!< [in] блоб */
 );
 
+/*!	\brief Создание арены
+
+	Создается арена из (не менее чем) size октетов. Память арены 
+	фиксируется в оперативной памяти.
+	\return Признак успеха. FALSE возвращается, если арена уже создана,
+	при нулевом size, при нехватке памяти и если память не удалось 
+	зафиксировать (например, из-за ограничения RLIMIT_MEMLOCK).
+	\remark Размер арены округляется вверх до числа, кратного 64 Кб.
+	\remark Арена используется функциями blobCreate(), blobResize(), 
+	blobCopy() и, следовательно, всеми функциями библиотеки, которые 
+	выделяют память с помощью блобов.
+	\warning Функцию нельзя вызывать, если другие потоки работают 
+	с блобами.
+*/
+bool_t blobArenaCreate(
+	size_t size		/*!< [in] размер */
+);
+
+/*!	\brief Арена создана?
+
+	Проверяется, что арена создана.
+	\return Признак создания.
+*/
+bool_t blobArenaIsValid();
+
+/*!	\brief Закрытие арены
+
+	Выполняется очистка и освобождение памяти арены.
+	\expect Все блобы, размещенные в арене, закрыты.
+	\warning Функцию нельзя вызывать, если другие потоки работают 
+	с блобами.
+*/
+void blobArenaClose();
+
+/*!	\brief Настройка кэша потоков
+
+	Устанавливается максимальный размер max фрагмента памяти, который 
+	может сохраняться в кэше потока после закрытия блоба. В кэше каждого 
+	потока хранится не более одного фрагмента, размер которого 
+	не уменьшается. Фрагмент освобождается при завершении потока.
+	\return Признак успеха. FALSE возвращается, если не удалось создать 
+	локальную память потоков.
+	\remark При max == 0 кэш не используется (по умолчанию).
+	\remark Кэш используется только для блобов, размещенных в куче.
+*/
+bool_t blobCacheSetMax(
+	size_t max		/*!< [in] максимальный размер фрагмента */
+);
+
 /*!	\brief Размер блоба
 
 	Определяется размер блоба blob.
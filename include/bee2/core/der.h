@@ -4,7 +4,7 @@
 \brief Distinguished Encoding Rules
 \project bee2 [cryptographic library]
 \created 2014.04.21
-\version 2022.11.01
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -274,6 +274,205 @@ size_t derDec4(
 	size_t len				/*!< [in] длина значения */
 );
 
+/*!
+*******************************************************************************
+\file der.h
+
+\section der-index Индекс
+
+Функция derIndex() за один проход по DER-коду строит плоский индекс --
+массив узлов, описывающих вложенные TLV-структуры в порядке их следования
+в коде (в глубину). Узел содержит тег, глубину вложенности, смещение
+TLV-кода и смещение значения относительно начала DER-кода, длину значения,
+а также номер узла, следующего за поддеревом данного узла.
+
+После построения индекса обращение к узлам не требует повторного
+декодирования тегов и длин. Значения узлов не копируются: функция
+derIndexVal() возвращает указатель на значение внутри DER-кода.
+
+Номер узла, следующего за поддеревом узла i, равняется nodes[i].next.
+Если этот номер меньше числа узлов и глубина соответствующего узла
+совпадает с nodes[i].depth, то он является соседом узла i. Первый потомок
+конструктивного узла i с ненулевой длиной значения имеет номер i + 1.
+
+Индекс действителен, пока не изменяется DER-код.
+*******************************************************************************
+*/
+
+/*!	\brief Узел индекса */
+typedef struct
+{
+	u32 tag;			/*!< тег */
+	size_t depth;		/*!< глубина вложенности (0 для корня) */
+	size_t pos;			/*!< смещение TLV-кода */
+	size_t val;			/*!< смещение значения */
+	size_t len;			/*!< длина значения */
+	size_t next;		/*!< номер узла, следующего за поддеревом */
+} der_node_t;
+
+/*!	\brief Построение индекса
+
+	По DER-коду [<=count]der строится индекс [max]nodes. Проверяется
+	корректность кодирования тегов и длин всех вложенных структур и то, что
+	вложенные структуры в точности заполняют значения конструктивных
+	структур.
+	\return Число узлов индекса или SIZE_MAX в случае ошибки формата или
+	нехватки узлов.
+	\remark Точная длина DER-кода равняется nodes[0].val + nodes[0].len.
+	\remark Любая TLV-структура занимает не менее двух октетов, поэтому
+	индексу требуется не более count / 2 узлов.
+*/
+size_t derIndex(
+	der_node_t nodes[],		/*!< [out] узлы */
+	size_t max,				/*!< [in] число узлов */
+	const octet der[],		/*!< [in] DER-код */
+	size_t count			/*!< [in] длина der в октетах */
+);
+
+/*!	\brief Потомок узла
+
+	В индексе [count]nodes определяется номер k-го (начиная с 0) потомка
+	узла i.
+	\return Номер потомка или SIZE_MAX, если потомка нет.
+	\remark Сложность пропорциональна k.
+*/
+size_t derIndexChild(
+	const der_node_t nodes[],	/*!< [in] узлы */
+	size_t count,				/*!< [in] число узлов */
+	size_t i,					/*!< [in] номер узла */
+	size_t k					/*!< [in] номер потомка */
+);
+
+/*!	\brief Значение узла
+
+	В индексе [count]nodes, построенном по DER-коду der, проверяется, что
+	узел i имеет тег tag и, если это так, определяется указатель на значение
+	узла внутри der и длина значения len.
+	\return Указатель на значение или 0 в случае ошибки.
+	\remark Указатель len может быть нулевым.
+*/
+const octet* derIndexVal(
+	size_t* len,				/*!< [out] длина значения */
+	const der_node_t nodes[],	/*!< [in] узлы */
+	size_t count,				/*!< [in] число узлов */
+	size_t i,					/*!< [in] номер узла */
+	const octet der[],			/*!< [in] DER-код */
+	u32 tag						/*!< [in] тег */
+);
+
+/*!
+*******************************************************************************
+\file der.h
+
+\section der-stream Потоковое декодирование
+
+Функции derStreamXXX декодируют DER-код, который поступает фрагментами
+произвольной длины, без накопления кода целиком. Потоковое декодирование
+позволяет обрабатывать большие контейнеры и последовательности сертификатов
+при ограниченной памяти.
+
+Очередной фрагмент кода передается функции derStreamStepI(). После этого
+функция derStreamStepG() вызывается до тех пор, пока не вернет
+DER_STREAM_MORE (фрагмент исчерпан) или DER_STREAM_ERR (ошибка формата).
+Каждый вызов derStreamStepG() возвращает событие:
+-	DER_STREAM_OPEN -- декодирована пара TL очередного узла;
+-	DER_STREAM_DATA -- получен фрагмент значения примитивного узла;
+-	DER_STREAM_CLOSE -- обработано значение узла.
+.
+Вместе с событием возвращаются описание узла и фрагмент DER-кода. Узел
+описывается так же, как в индексе (см. der_node_t), причем смещения
+отсчитываются от начала потока, а поле next не используется (равняется
+SIZE_MAX). Фрагмент события OPEN -- это код TL, фрагмент события DATA --
+очередная часть значения, фрагмент события CLOSE пуст. Фрагменты всех
+событий в порядке выдачи в точности составляют поступивший DER-код.
+Поэтому хэш-значение TLV-кода любого узла (например, подписываемой части
+сертификата) вычисляется по ходу декодирования обработкой фрагментов
+событий от OPEN этого узла до соответствующего CLOSE.
+
+Поток может содержать несколько корневых TLV-структур, следующих друг за
+другом. Функция derStreamIsOver() проверяет, что поток остановлен на
+границе корневых структур.
+
+Как и при построении индекса, проверяется корректность кодирования тегов и
+длин и то, что вложенные структуры в точности заполняют значения
+конструктивных структур. Дополнительно ограничивается глубина вложенности.
+После ошибки формата состояние становится непригодным для дальнейшего
+декодирования.
+
+\pre Фрагмент, переданный derStreamStepI(), остается доступным до тех
+пор, пока derStreamStepG() не вернет DER_STREAM_MORE. Фрагмент события
+действителен до следующего вызова derStreamStepG().
+*******************************************************************************
+*/
+
+#define DER_STREAM_MORE		0			/*!< нужен следующий фрагмент */
+#define DER_STREAM_OPEN		1			/*!< начало узла */
+#define DER_STREAM_DATA		2			/*!< фрагмент значения */
+#define DER_STREAM_CLOSE	3			/*!< конец узла */
+#define DER_STREAM_ERR		SIZE_MAX	/*!< ошибка формата */
+
+/*!	\brief Длина состояния потокового декодирования
+
+	Возвращается длина состояния (в октетах) функций потокового
+	декодирования с глубиной вложенности не более depth.
+	\return Длина состояния.
+*/
+size_t derStream_keep(
+	size_t depth			/*!< [in] глубина вложенности */
+);
+
+/*!	\brief Инициализация потокового декодирования
+
+	По адресу state формируется состояние потокового декодирования. Глубина
+	вложенности узлов не должна превышать depth: корень имеет глубину 0,
+	узлы с глубиной depth и более запрещаются.
+	\pre depth > 0.
+	\pre По адресу state зарезервировано derStream_keep(depth) октетов.
+*/
+void derStreamStart(
+	void* state,			/*!< [out] состояние */
+	size_t depth			/*!< [in] глубина вложенности */
+);
+
+/*!	\brief Поступление фрагмента
+
+	В состояние state передается очередной фрагмент [count]der DER-кода.
+	\pre Предыдущий фрагмент полностью обработан: derStreamStepG()
+	вернула DER_STREAM_MORE.
+*/
+void derStreamStepI(
+	const void* der,		/*!< [in] фрагмент DER-кода */
+	size_t count,			/*!< [in] длина фрагмента в октетах */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Очередное событие
+
+	Из состояния state извлекается очередное событие. Для событий
+	DER_STREAM_OPEN, DER_STREAM_DATA, DER_STREAM_CLOSE возвращаются описание
+	узла node и фрагмент [*len]*frag DER-кода.
+	\return Событие: DER_STREAM_MORE, DER_STREAM_OPEN, DER_STREAM_DATA,
+	DER_STREAM_CLOSE или DER_STREAM_ERR.
+	\remark Любой из указателей node, frag, len может быть нулевым.
+*/
+size_t derStreamStepG(
+	der_node_t* node,		/*!< [out] узел */
+	const octet** frag,		/*!< [out] фрагмент */
+	size_t* len,			/*!< [out] длина фрагмента */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Завершенность потока
+
+	Проверяется, что в состоянии state поток обработан до конца: ошибок
+	формата не было, поступивший DER-код полностью обработан и образует
+	одну или несколько законченных TLV-структур.
+	\return Признак завершенности.
+*/
+bool_t derStreamIsOver(
+	const void* state		/*!< [in] состояние */
+);
+
 /*!
 *******************************************************************************
 \file der.h DER-кодирование
@@ -4,7 +4,7 @@
 \brief Hexadecimal strings
 \project bee2 [cryptographic library]
 \created 2015.10.29
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -171,6 +171,73 @@ void hexToRev(
 	const char* src		/*!< [in] строка-источник */
 );
 
+/*!
+*******************************************************************************
+\file hex.h
+
+\section hex-stream Потоковое декодирование
+
+Функции hexToXXX декодируют шестнадцатеричную строку, которая поступает
+фрагментами произвольной длины. Символ неполной пары в конце фрагмента
+сохраняется в состоянии и дополняется первым символом следующего
+фрагмента. Результат совпадает с результатом функции hexTo(), примененной
+к объединению фрагментов.
+
+Функции потокового декодирования не требуют корректности входных данных:
+каждый символ проверяется. Обнаружив ошибку, функция hexToStep()
+возвращает SIZE_MAX, и состояние становится непригодным для дальнейшего
+декодирования.
+
+Для потокового кодирования состояние не требуется: фрагменты данных
+кодируются функцией hexFrom() по отдельности, результаты записываются
+друг за другом.
+*******************************************************************************
+*/
+
+/*!	\brief Длина состояния декодирования
+
+	Возвращается длина состояния (в октетах) функций потокового
+	декодирования.
+	\return Длина состояния.
+*/
+size_t hexTo_keep();
+
+/*!	\brief Инициализация декодирования
+
+	По адресу state формируется состояние потокового декодирования.
+	\pre По адресу state зарезервировано hexTo_keep() октетов.
+*/
+void hexToStart(
+	void* state			/*!< [out] состояние */
+);
+
+/*!	\brief Декодирование фрагмента
+
+	Фрагмент [count]src шестнадцатеричной строки декодируется в dest.
+	Символ неполной пары в конце фрагмента сохраняется в state.
+	\pre Буфер dest вмещает (count + 1) / 2 октетов.
+	\pre Буферы dest и src не пересекаются.
+	\return Число записанных октетов или SIZE_MAX в случае ошибки формата.
+	\remark Фрагмент src может не заканчиваться нулевым символом.
+*/
+size_t hexToStep(
+	void* dest,			/*!< [out] декодированные данные */
+	const char* src,	/*!< [in] фрагмент строки */
+	size_t count,		/*!< [in] длина фрагмента в символах */
+	void* state			/*!< [in,out] состояние */
+);
+
+/*!	\brief Завершение декодирования
+
+	Проверяется, что в состоянии state шестнадцатеричная строка
+	декодирована полностью: ошибок формата не было и неполной пары
+	символов нет.
+	\return Признак корректного завершения.
+*/
+bool_t hexToStop(
+	const void* state	/*!< [in] состояние */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Memory management
 \project bee2 [cryptographic library]
 \created 2012.07.16
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -176,6 +176,39 @@ bool_t memIsAligned(
 	size_t size			/*!< [in] длина блока */
 );
 
+/*!	\brief Рекомендуемое выравнивание состояний
+
+	Состояния криптографических алгоритмов (см., например, bashHash_keep(),
+	beltHash_keep()) рекомендуется размещать по адресам, кратным MEM_ALIGN.
+	Граница MEM_ALIGN совпадает с длиной кэш-линии и с длиной регистров
+	AVX512.
+*/
+#define MEM_ALIGN 64
+
+/*!	\def MEM_ALIGNED
+	\brief Выравнивание объявляемой переменной на границу n
+
+	Объявляемая переменная (или поле структуры) выравнивается на границу
+	n-байтового блока. Например:
+	\code
+		MEM_ALIGNED(MEM_ALIGN) octet state[1024];
+	\endcode
+	\pre n -- степень 2.
+	\remark Если компилятор не поддерживает выравнивание, то макрос пуст
+	и выравнивание не гарантируется.
+	\remark Выравнивание динамически выделенной памяти (например, памяти
+	под структуру с выровненным полем) определяется распределителем.
+*/
+#if defined(_MSC_VER)
+	#define MEM_ALIGNED(n) __declspec(align(n))
+#elif defined(__GNUC__) || defined(__clang__)
+	#define MEM_ALIGNED(n) __attribute__((aligned(n)))
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+	#define MEM_ALIGNED(n) _Alignas(n)
+#else
+	#define MEM_ALIGNED(n)
+#endif
+
 
 /*!	\brief Проверка совпадения
 
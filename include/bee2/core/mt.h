@@ -4,7 +4,7 @@
 \brief Multithreading
 \project bee2 [cryptographic library]
 \created 2014.10.10
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -130,6 +130,115 @@ void mtMtxClose(
 *******************************************************************************
 \file mt.h
 
+\section mt-rwl Блокировки чтения-записи
+
+Блокировка чтения-записи допускает одновременный доступ к общему объекту
+нескольких читателей либо монопольный доступ одного писателя. Читатель
+захватывает блокировку с помощью функции mtRwlRdLock() и освобождает ее
+с помощью mtRwlRdUnlock(), писатель -- с помощью функций mtRwlWrLock() и
+mtRwlWrUnlock().
+
+Блокировки чтения-записи удобны для защиты объектов, которые часто читаются
+и редко изменяются, например, разделяемых между потоками контекстов.
+
+Как и для мьютексов, ошибки при захвате и освобождении блокировки
+не предполагаются. Повторный захват блокировки в том же потоке
+не допускается.
+
+Если операционная система не распознана, то блокировки будут
+"положительно пустыми".
+
+\remark В реализации для Windows используются облегченные блокировки
+SRW (slim reader/writer locks).
+
+\typedef mt_rwl_t
+\brief Блокировка чтения-записи
+*******************************************************************************
+*/
+
+#ifdef OS_WIN
+	typedef SRWLOCK mt_rwl_t;
+#elif defined OS_UNIX
+	typedef pthread_rwlock_t mt_rwl_t;
+#else
+	typedef bool_t mt_rwl_t;
+#endif
+
+/*!	\brief Создание блокировки чтения-записи
+
+	Создается блокировка чтения-записи rwl.
+	\return Признак успеха.
+	\post В случае успеха блокировка корректна.
+*/
+bool_t mtRwlCreate(
+	mt_rwl_t* rwl		/*!< [out] блокировка */
+);
+
+/*!	\brief Корректная блокировка чтения-записи?
+
+	Проверяется корректность блокировки чтения-записи rwl.
+	\return Признак корректности.
+*/
+bool_t mtRwlIsValid(
+	const mt_rwl_t* rwl	/*!< [in] блокировка */
+);
+
+/*!	\brief Захват блокировки на чтение
+
+	Блокировка rwl захватывается на чтение.
+	\pre Блокировка корректна.
+	\remark Если блокировка захвачена на запись в момент вызова, то
+	ожидается ее освобождение (в другом потоке).
+*/
+void mtRwlRdLock(
+	mt_rwl_t* rwl		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Освобождение блокировки после чтения
+
+	Освобождается блокировка rwl, захваченная на чтение.
+	\pre mtRwlRdUnlock() < mtRwlRdLock().
+	\pre Блокировка корректна.
+*/
+void mtRwlRdUnlock(
+	mt_rwl_t* rwl		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Захват блокировки на запись
+
+	Блокировка rwl захватывается на запись.
+	\pre Блокировка корректна.
+	\remark Если блокировка захвачена (на чтение или запись) в момент
+	вызова, то ожидается ее освобождение (в других потоках).
+*/
+void mtRwlWrLock(
+	mt_rwl_t* rwl		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Освобождение блокировки после записи
+
+	Освобождается блокировка rwl, захваченная на запись.
+	\pre mtRwlWrUnlock() < mtRwlWrLock().
+	\pre Блокировка корректна.
+*/
+void mtRwlWrUnlock(
+	mt_rwl_t* rwl		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Закрытие блокировки чтения-записи
+
+	Блокировка чтения-записи rwl закрывается.
+	\pre Блокировка корректна и не захвачена.
+	\pre mtRwlClose() < mtRwlCreate().
+*/
+void mtRwlClose(
+	mt_rwl_t* rwl		/*!< [in,out] блокировка */
+);
+
+/*!
+*******************************************************************************
+\file mt.h
+
 \section mt-thrd Управление потоками
 
 Управление потоками реализуется по схемам, заданным в стандарте языка Си
@@ -163,6 +272,156 @@ bool_t mtCallOnce(
 	void (*fn)()	/*!< [in] функция */
 );
 
+/*!	\typedef mt_thrd_t
+	\brief Поток
+
+	Описатель потока содержит, кроме системного идентификатора, функцию
+	потока и ее аргумент.
+*/
+#ifdef OS_WIN
+	typedef struct
+	{
+		HANDLE handle;			/*!< системный описатель */
+		void (*fn)(void*);		/*!< функция потока */
+		void* arg;				/*!< аргумент функции */
+	} mt_thrd_t;
+#elif defined OS_UNIX
+	typedef struct
+	{
+		pthread_t id;			/*!< системный идентификатор */
+		void (*fn)(void*);		/*!< функция потока */
+		void* arg;				/*!< аргумент функции */
+	} mt_thrd_t;
+#else
+	typedef struct
+	{
+		void (*fn)(void*);		/*!< функция потока */
+		void* arg;				/*!< аргумент функции */
+	} mt_thrd_t;
+#endif
+
+/*!	\brief Создание потока
+
+	Создается поток thrd, в котором выполняется вызов fn(arg).
+	\return Признак успеха.
+	\expect Описатель thrd не меняется и не освобождается вплоть до
+	вызова mtThrdJoin().
+	\remark Если операционная система не распознана, то потоки
+	не создаются (возвращается FALSE).
+*/
+bool_t mtThrdCreate(
+	mt_thrd_t* thrd,		/*!< [out] поток */
+	void (*fn)(void*),		/*!< [in] функция потока */
+	void* arg				/*!< [in] аргумент функции */
+);
+
+/*!	\brief Ожидание завершения потока
+
+	Ожидается завершение потока thrd, после чего освобождаются ресурсы
+	потока.
+	\pre Поток thrd создан с помощью mtThrdCreate().
+*/
+void mtThrdJoin(
+	mt_thrd_t* thrd			/*!< [in,out] поток */
+);
+
+/*!	\brief Число процессоров
+
+	Определяется число логических процессоров, доступных процессу.
+	\return Число процессоров (не менее 1).
+*/
+size_t mtProcCount();
+
+/*!	\brief Узел NUMA
+
+	Определяется номер узла NUMA, которому принадлежит процессор,
+	выполняющий вызывающий поток.
+	\return Номер узла или 0, если узел определить не удалось (в том числе
+	в системах без NUMA).
+	\remark Планировщик может перенести поток на процессор другого узла
+	сразу после вызова. Поэтому результат является подсказкой: его можно
+	использовать для выбора памяти, но не для синхронизации.
+*/
+size_t mtNumaNode();
+
+/*!
+*******************************************************************************
+\file mt.h
+
+\section mt-tls Локальная память потоков
+
+Ключ локальной памяти связывает с каждым потоком собственный указатель.
+Первоначально указатель нулевой. При завершении потока, который установил 
+ненулевой указатель, вызывается деструктор, заданный при создании ключа.
+
+Деструкторы объявляются с модификатором MT_CALLBACK, который задает 
+соглашение о вызовах, принятое в операционной системе.
+
+\remark Деструктор не вызывается для потока, который завершает процесс 
+(например, для основного потока при выходе из main()). Такой поток должен 
+освободить свои ресурсы самостоятельно.
+
+\remark Если операционная система не распознана, то указатель 
+хранится в самом ключе и является общим для всех потоков (потоки в этом 
+случае не создаются).
+
+\typedef mt_tls_t
+\brief Ключ локальной памяти потоков
+*******************************************************************************
+*/
+
+#ifdef OS_WIN
+	#define MT_CALLBACK NTAPI
+	typedef DWORD mt_tls_t;
+#elif defined OS_UNIX
+	#define MT_CALLBACK
+	typedef pthread_key_t mt_tls_t;
+#else
+	#define MT_CALLBACK
+	typedef void* mt_tls_t;
+#endif
+
+/*!	\brief Создание ключа локальной памяти
+
+	Создается ключ tls локальной памяти потоков с деструктором dtor.
+	\return Признак успеха.
+	\remark Деструктор dtor может быть нулевым.
+*/
+bool_t mtTlsCreate(
+	mt_tls_t* tls,					/*!< [out] ключ */
+	void (MT_CALLBACK* dtor)(void*)	/*!< [in] деструктор */
+);
+
+/*!	\brief Указатель потока
+
+	Определяется указатель, связанный с ключом tls в текущем потоке.
+	\pre Ключ tls создан.
+	\return Указатель (возможно, нулевой).
+*/
+void* mtTlsGet(
+	const mt_tls_t* tls		/*!< [in] ключ */
+);
+
+/*!	\brief Установка указателя потока
+
+	С ключом tls в текущем потоке связывается указатель ptr.
+	\pre Ключ tls создан.
+	\return Признак успеха.
+*/
+bool_t mtTlsSet(
+	mt_tls_t* tls,			/*!< [in] ключ */
+	void* ptr				/*!< [in] указатель */
+);
+
+/*!	\brief Закрытие ключа локальной памяти
+
+	Закрывается ключ tls. Деструкторы при этом не вызываются.
+	\pre Ключ tls создан.
+*/
+void mtTlsClose(
+	mt_tls_t* tls			/*!< [in] ключ */
+);
+
 /*!
 *******************************************************************************
 \file mt.h
@@ -210,6 +469,216 @@ size_t mtAtomicCmpSwap(
 	size_t swap		/*!< [in] новое значение */
 );
 
+/*!	\brief Атомарное чтение
+
+	Атомарно читается значение счетчика ctr. Чтение имеет семантику
+	захвата (acquire): последующие обращения к памяти в текущем потоке
+	не переупорядочиваются перед ним.
+	\return Значение счетчика.
+*/
+size_t mtAtomicLoad(
+	const size_t* ctr	/*!< [in] счетчик */
+);
+
+/*!	\brief Атомарная запись
+
+	Счетчик ctr атомарно устанавливается равным val. Запись имеет семантику
+	освобождения (release): предшествующие обращения к памяти в текущем
+	потоке не переупорядочиваются после нее.
+*/
+void mtAtomicStore(
+	size_t* ctr,	/*!< [out] счетчик */
+	size_t val		/*!< [in] новое значение */
+);
+
+/*!
+*******************************************************************************
+\file mt.h
+
+\section mt-spin Спин-блокировки
+
+Спин-блокировка -- это счетчик типа size_t, нулевое значение которого
+означает, что блокировка свободна. Поток, ожидающий освобождения блокировки,
+не приостанавливается, а повторяет попытки захвата, постепенно увеличивая
+паузы между ними. Если ожидание затягивается, то поток уступает процессор
+другим потокам.
+
+Спин-блокировки предназначены для защиты очень коротких критических секций,
+в которых не выполняются системные вызовы. Блокировки не требуют создания
+и закрытия: достаточно обнулить счетчик.
+
+\warning Повторный захват блокировки в том же потоке приводит к взаимной
+блокировке (deadlock).
+
+\typedef mt_spin_t
+\brief Спин-блокировка
+*******************************************************************************
+*/
+
+typedef size_t mt_spin_t;
+
+/*!	\brief Захват спин-блокировки без ожидания
+
+	Предпринимается попытка захвата спин-блокировки spin.
+	\return TRUE, если блокировка была свободна (и стала захваченной),
+	и FALSE в противном случае.
+*/
+bool_t mtSpinTryLock(
+	mt_spin_t* spin		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Захват спин-блокировки
+
+	Захватывается спин-блокировка spin.
+	\remark Если блокировка захвачена в момент вызова, то ожидается ее
+	освобождение (в другом потоке).
+*/
+void mtSpinLock(
+	mt_spin_t* spin		/*!< [in,out] блокировка */
+);
+
+/*!	\brief Освобождение спин-блокировки
+
+	Освобождается спин-блокировка spin.
+	\pre mtSpinUnlock() < mtSpinLock().
+*/
+void mtSpinUnlock(
+	mt_spin_t* spin		/*!< [in,out] блокировка */
+);
+
+/*!
+*******************************************************************************
+\file mt.h
+
+\section mt-pool Пул потоков
+
+Пул потоков -- это набор рабочих потоков, которые выполняют задания,
+поставленные в очередь функцией mtPoolSubmit(). Каждый рабочий поток
+владеет собственной очередью заданий и, опустошив ее, забирает задания
+из очередей других потоков (work stealing). Функция mtPoolWait() ожидает
+завершения всех поставленных заданий. Ожидающий поток не простаивает,
+а сам выполняет задания из очередей.
+
+Функция mtPoolFor() разбивает диапазон номеров [0, count) на участки и
+обрабатывает их параллельно. Функция mtPoolFor() может вызываться
+одновременно из разных потоков, а также изнутри заданий: каждый вызов
+ожидает завершения только своих участков.
+
+Для нулевого пула используется пул по умолчанию. Он создается при первом
+обращении и содержит mtProcCount() - 1 рабочих потоков (вызывающий поток
+также участвует в обработке). Пул по умолчанию закрывается при завершении
+программы.
+
+С помощью функции mtExecSet() можно подключить внешний исполнитель
+(executor), например, пул потоков вызывающего приложения. После
+подключения вызовы mtPoolFor() с нулевым пулом перенаправляются
+исполнителю, а пул по умолчанию не создается.
+
+\remark Если рабочие потоки не создаются (например, операционная система
+не распознана) или процесс был клонирован после создания пула, то
+задания выполняются в вызывающем потоке.
+
+\typedef mt_pool_t
+\brief Пул потоков
+*******************************************************************************
+*/
+
+typedef void* mt_pool_t;
+
+/*!	\brief Создание пула потоков
+
+	Создается пул из threads рабочих потоков.
+	\return Созданный пул или 0 в случае нехватки памяти.
+	\remark При threads == 0 или при ошибках создания потоков пул содержит
+	меньше рабочих потоков (возможно, ни одного).
+*/
+mt_pool_t mtPoolCreate(
+	size_t threads		/*!< [in] число рабочих потоков */
+);
+
+/*!	\brief Число рабочих потоков
+
+	Определяется число рабочих потоков пула pool.
+	\return Число рабочих потоков.
+	\remark Если pool == 0, то используется пул по умолчанию.
+*/
+size_t mtPoolThreads(
+	mt_pool_t pool		/*!< [in] пул */
+);
+
+/*!	\brief Постановка задания
+
+	В очередь пула pool ставится задание fn(arg).
+	\remark Если pool == 0, то используется пул по умолчанию.
+	\remark Если очереди переполнены или рабочих потоков нет, то задание
+	выполняется немедленно в вызывающем потоке.
+*/
+void mtPoolSubmit(
+	mt_pool_t pool,			/*!< [in] пул */
+	void (*fn)(void*),		/*!< [in] задание */
+	void* arg				/*!< [in] аргумент задания */
+);
+
+/*!	\brief Ожидание завершения заданий
+
+	Ожидается завершение всех заданий, поставленных в очередь пула pool
+	функцией mtPoolSubmit().
+	\remark Если pool == 0, то используется пул по умолчанию.
+*/
+void mtPoolWait(
+	mt_pool_t pool		/*!< [in] пул */
+);
+
+/*!	\brief Параллельная обработка диапазона
+
+	Номера 0, 1,..., count - 1 разбиваются на последовательные участки
+	[from, to), которые обрабатываются вызовами fn(from, to, arg) в потоках
+	пула pool и в вызывающем потоке. Функция возвращает управление после
+	обработки всех участков.
+	\remark Если pool == 0, то используется внешний исполнитель или, если
+	он не подключен, пул по умолчанию.
+*/
+void mtPoolFor(
+	mt_pool_t pool,			/*!< [in] пул */
+	size_t count,			/*!< [in] число номеров */
+	void (*fn)(size_t from, size_t to, void* arg),	/*!< [in] обработчик */
+	void* arg				/*!< [in] аргумент обработчика */
+);
+
+/*!	\brief Закрытие пула потоков
+
+	Пул pool закрывается: ожидается выполнение поставленных заданий,
+	завершаются рабочие потоки, освобождаются ресурсы.
+	\pre Пул pool создан с помощью mtPoolCreate().
+*/
+void mtPoolClose(
+	mt_pool_t pool		/*!< [in] пул */
+);
+
+/*!	\brief Внешний исполнитель
+
+	Функция run исполнителя должна обработать номера 0, 1,..., count - 1
+	вызовами fn(from, to, arg) для участков [from, to), покрывающих
+	диапазон, и вернуть управление после обработки всех участков.
+*/
+typedef struct
+{
+	void* ctx;		/*!< контекст исполнителя */
+	void (*run)(void* ctx, size_t count,
+		void (*fn)(size_t from, size_t to, void* arg), void* arg);
+					/*!< функция обработки диапазона */
+} mt_exec_t;
+
+/*!	\brief Подключение внешнего исполнителя
+
+	Подключается внешний исполнитель exec. Если exec == 0, то
+	восстанавливается использование пула по умолчанию.
+	\expect Функция вызывается до начала параллельных вычислений.
+*/
+void mtExecSet(
+	const mt_exec_t* exec	/*!< [in] исполнитель */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Compound objects
 \project bee2 [cryptographic library]
 \created 2014.04.14
-\version 2014.04.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -146,6 +146,101 @@ void objAppend(
 	size_t i			/*!< [in] номер присоединяемого объекта */
 );
 
+/*
+*******************************************************************************
+Реплики объекта
+
+Объект, который только читается в нескольких потоках (например, контекст
+с таблицей предвычислений), на многопроцессорной системе с неоднородным
+доступом к памяти (NUMA) размещается на одном из узлов. Потоки других
+узлов читают его через межузловые связи с повышенной задержкой.
+
+Набор реплик позволяет завести для каждого узла NUMA собственную копию
+(реплику) объекта. Набор создается функцией objRepsStart(). Функция
+objRepsGet() возвращает реплику узла, на котором выполняется вызывающий
+поток (см. mtNumaNode()). Реплика узла создается при первом обращении
+из потока этого узла: память выделяется в куче и заполняется этим же
+потоком. Поэтому при стандартной политике размещения ОС (first touch)
+страницы реплики оказываются на узле потока.
+
+Реплика строится функцией clone, которая по объекту src заполняет объект
+dest. Если clone == 0, то реплика строится функцией objCopy(). Внешние
+ссылки объекта objCopy() не копирует. Поэтому объекты с внешними
+ссылками на большие фрагменты (например, на таблицы предвычислений)
+следует реплицировать с помощью собственной функции clone, которая
+переносит такие фрагменты в реплику.
+
+Узлы с номерами OBJ_REPS_MAX и выше разделяют реплики узлов с номерами
+по модулю OBJ_REPS_MAX. Если реплику не удалось создать (не хватило
+памяти), то возвращается исходный объект.
+
+Реплики не изменяются после создания. Функцию objRepsGet() можно
+вызывать одновременно в нескольких потоках. Вызов включает системный
+запрос номера узла, поэтому реплику лучше получать один раз на поток
+или на серию операций.
+*******************************************************************************
+*/
+
+/*! \brief Максимальное число реплик */
+#define OBJ_REPS_MAX 8
+
+/*!	\brief Функция построения реплики
+
+	По объекту src строится объект dest.
+	\pre По адресу dest зарезервировано столько октетов, сколько указано
+	при создании набора реплик.
+*/
+typedef void (*obj_clone_i)(
+	void* dest,			/*!< [out] реплика */
+	const void* src		/*!< [in] объект */
+);
+
+/*!	\brief Длина набора реплик
+
+	Возвращается длина набора реплик (в октетах).
+	\return Длина набора.
+*/
+size_t objReps_keep();
+
+/*!	\brief Создание набора реплик
+
+	Создается набор reps реплик объекта obj. Каждая реплика занимает keep
+	октетов и строится функцией clone (или objCopy(), если clone == 0).
+	Реплики создаются позже, при обращениях к objRepsGet().
+	\pre По адресу reps зарезервировано objReps_keep() октетов.
+	\pre Объект obj работоспособен.
+	\pre keep >= objKeep(obj), если clone == 0.
+	\remark Объект obj не копируется и должен оставаться доступным до
+	вызова objRepsClose().
+*/
+void objRepsStart(
+	void* reps,			/*!< [out] набор реплик */
+	const void* obj,	/*!< [in] объект */
+	size_t keep,		/*!< [in] длина реплики */
+	obj_clone_i clone	/*!< [in] функция построения реплики */
+);
+
+/*!	\brief Реплика узла
+
+	Возвращается реплика из набора reps для узла NUMA вызывающего потока.
+	Если реплики еще нет, то она создается.
+	\pre Набор reps создан функцией objRepsStart().
+	\return Реплика узла или исходный объект, если реплику не удалось
+	создать.
+*/
+const void* objRepsGet(
+	void* reps			/*!< [in,out] набор реплик */
+);
+
+/*!	\brief Закрытие набора реплик
+
+	Освобождается память реплик из набора reps.
+	\pre Реплики набора больше не используются.
+*/
+void objRepsClose(
+	void* reps			/*!< [in,out] набор реплик */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
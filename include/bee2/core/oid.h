@@ -4,7 +4,7 @@
 \brief Object identifiers
 \project bee2 [cryptographic library]
 \created 2013.02.04
-\version 2022.07.06
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -112,6 +112,29 @@ size_t oidFromDER(
 	size_t count		/*!< [in] длина DER-код */
 );
 
+/*
+*******************************************************************************
+Реестр
+*******************************************************************************
+*/
+
+/*!	\brief Поиск в реестре
+
+	Идентификатор oid ищется в реестре идентификаторов, известных библиотеке
+	(алгоритмы и параметры СТБ 34.101, СТБ 1176.2, ДСТУ 4145, ГОСТ Р 34.10,
+	PKCS#5). Если идентификатор найден, то возвращается указатель на его
+	готовый DER-код, а длина кода возвращается в count.
+	\pre Строка oid корректна.
+	\return Указатель на DER-код или 0, если идентификатор не найден.
+	\remark Функции oidToDER() и oidFromDER() обращаются к реестру и 
+	разбирают или собирают идентификатор только в том случае, если его 
+	нет в реестре.
+*/
+const octet* oidLookup(
+	size_t* count,		/*!< [out] длина DER-кода */
+	const char* oid		/*!< [in] идентификатор объекта */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Entropy sources and random number generators
 \project bee2 [cryptographic library]
 \created 2014.10.13
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -192,6 +192,33 @@ err_t rngESHealth();
 */
 err_t rngESHealth2();
 
+/*!	\brief Запуск фоновой проверки работоспособности
+
+	В отдельном потоке запускается функция rngESHealth(). Результат 
+	проверки можно получить с помощью функции rngESHealthResult().
+	\return ERR_OK.
+	\remark Проверка запускается не более одного раза. Повторные вызовы 
+	игнорируются.
+	\remark Если поток создать не удалось, то проверка выполняется 
+	в вызывающем потоке до возврата из функции.
+	\remark Функция позволяет не задерживать запуск приложения 
+	тестированием медленных источников (в первую очередь, timer): 
+	генератор создается сразу (см. rngSetStartPolicy()), а результат 
+	проверки анализируется позже, до выработки критических объектов.
+*/
+err_t rngESHealthStart();
+
+/*!	\brief Результат фоновой проверки работоспособности
+
+	Возвращается результат проверки, запущенной функцией 
+	rngESHealthStart(). Если wait == TRUE, то ожидается завершение проверки.
+	\return ERR_NOT_READY, если проверка не запускалась или, при 
+	wait == FALSE, еще не завершена. Иначе -- результат rngESHealth().
+*/
+err_t rngESHealthResult(
+	bool_t wait				/*!< [in] ожидать завершения? */
+);
+
 
 /*!
 *******************************************************************************
@@ -204,7 +231,14 @@ err_t rngESHealth2();
 
 Генератор является единственным в библиотеке. 
 
-Генератор можно использовать в многопоточных приложениях.
+Генератор можно использовать в многопоточных приложениях. Каждый поток 
+получает собственный экземпляр механизма brngCTR, ключ которого 
+вырабатывается общим генератором. Поэтому при генерации потоки 
+не блокируют друг друга: общая блокировка захватывается только при 
+получении потоком ключа (при первом обращении и после изменения 
+общего генератора функциями rngCreate() и rngRekey()). Экземпляр 
+потока самостоятельно обновляет ключ после выработки каждого 
+мегабайта данных и уничтожается при завершении потока.
 
 При создании генератора опрашиваются все доступные источники случайности. 
 Данные от источников объединяются и хэшируются с помощью механизма
@@ -221,10 +255,26 @@ brngCTR (см. crypto/brng.h).
 (например, во время согласования общего ключа перед передачей данных), 
 вторую -- регулярно (в процессе передачи данных).
 
+В функции rngStepR() источники опрашиваются не при каждом обращении, 
+а в соответствии с политикой обновления энтропии (см. 
+rngSetReseedPolicy()): после выработки потоком заданного числа октетов 
+или по истечении заданного времени. Данные от источников добавляются 
+в общий генератор, после чего экземпляры потоков получают новые ключи. 
+Опрос источников можно выполнить явно с помощью функции rngReseed().
+
 С помощью функции rngRekey() можно обновить ключ генератора. После обновления
 ключа случайные числа, сгенерированные ранее, будет невозможно определить
 даже если при их генерации не использовались источники энтропии, а новый ключ
 стал известен противнику.
+При обновлении ключа общего генератора экземпляры потоков получают
+новые ключи при следующем обращении.
+
+Генератор можно использовать в приложениях, которые порождают процессы 
+с помощью fork() после вызова rngCreate(). В ОС Unix ветвление процесса 
+отслеживается, и при первом обращении к генератору в дочернем процессе 
+общий генератор обновляется данными источника sys, идентификатором 
+процесса и показаниями таймера. Повторно вызывать rngClose() 
+и rngCreate() в дочернем процессе не требуется.
 *******************************************************************************
 */
 
@@ -243,6 +293,8 @@ brngCTR (см. crypto/brng.h).
 	к ним добавляются данные, полученные от дополнительного источника source.
 	\remark У каждого источника	запрашивается 32 октета данных, но он может
 	выдать меньше. Данные не запрашиваются, если источник отсутствует.
+	\remark При политике быстрого запуска (см. rngSetStartPolicy()) 
+	источники опрашиваются только до получения 64 октетов.
 	\remark Поддерживается счетчик обращений к rngCreate(). Счетчик
 	уменьшается функцией rngClose(). При достижении счетчиком нулевого
 	значения накопленные энтропийные данные (в том числе ключ
@@ -263,15 +315,14 @@ bool_t rngIsValid();
 /*!	\brief Генерация случайных чисел
 
 	В буфер [count]buf записываются случайные октеты, построенные с помощью 
-	генератора случайных чисел. При формировании выходных октетов используются 
-	данные от источников случайности. 
+	генератора случайных чисел. Перед генерацией проверяется политика 
+	обновления энтропии и, если наступил момент обновления, вызывается 
+	rngReseed().
 	\expect rngСreate() < rngStepR()*.
 	\pre Генератор корректен.
 	\remark Поддержан интерфейс gen_i (defs.h).
 	\remark Состояние state не используется. Оно передается в функцию только 
 	для того, чтобы поддержать интерфейс gen_i.
-	\remark Запрашивается count октетов от источников. Будет возвращено 
-	меньше октетов только если все источники отказали.
 */
 void rngStepR(
 	void* buf,				/*!< [out] буфер */
@@ -306,6 +357,56 @@ void rngStepR2(
 */
 void rngRekey();
 
+/*!	\brief Обновление энтропии
+
+	Опрашиваются источники, поддерживаемые функцией rngESRead(), до 
+	получения 32 октетов данных. Полученные данные добавляются в состояние 
+	генератора, после чего его ключ обновляется.
+	\expect rngСreate() < rngReseed()*.
+	\pre Генератор корректен.
+	\remark Источники опрашиваются без блокировки других потоков.
+*/
+void rngReseed();
+
+/*!	\brief Политика обновления энтропии
+
+	Устанавливается политика обновления энтропии в функции rngStepR():
+	функция rngReseed() вызывается, если с момента последнего получения 
+	потоком ключа выработано не менее bytes октетов или прошло не менее
+	ms миллисекунд.
+	\remark Нулевое значение bytes (ms) отключает соответствующее условие.
+	Если bytes == 0 и ms == 0, то rngReseed() вызывается при каждом 
+	обращении к rngStepR().
+	\remark По умолчанию bytes = 65536, ms = 1000.
+*/
+void rngSetReseedPolicy(
+	size_t bytes,			/*!< [in] порог по объему (в октетах) */
+	u32 ms					/*!< [in] порог по времени (в миллисекундах) */
+);
+
+/*!	\brief Политика запуска генератора
+
+	Устанавливается политика опроса источников в функции rngCreate().
+	Если fast == TRUE, то источники опрашиваются в порядке trng, trng2, sys, 
+	timer до получения 64 октетов данных. Если fast == FALSE, то 
+	опрашиваются все источники.
+	\remark По умолчанию fast == FALSE.
+	\remark Быстрый запуск не заменяет проверку работоспособности 
+	источников, которую можно выполнить в фоновом режиме (см. 
+	rngESHealthStart()).
+*/
+void rngSetStartPolicy(
+	bool_t fast				/*!< [in] быстрый запуск? */
+);
+
+/*!	\brief Число обновлений энтропии
+
+	Возвращается число вызовов rngReseed() (явных или по политике 
+	обновления) с момента создания генератора.
+	\return Число обновлений.
+*/
+size_t rngReseedCount();
+
 /*!	\brief Закрытие генератора
 
 	Генератор случайных чисел закрывается.
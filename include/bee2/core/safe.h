@@ -4,7 +4,7 @@
 \brief Safe (regular) calculations
 \project bee2 [cryptographic library]
 \created 2013.10.07
-\version 2019.06.13
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -61,6 +61,17 @@ extern "C" {
 	SAFE(f) == f_safe && FAST(f) == f.
 Базовое имя f всегда поддержано и является именем по умолчанию.
 
+Обе редакции компилируются всегда, независимо от директивы SAFE_FAST.
+Поэтому выбор между ними делается в точке вызова: если обрабатываются
+только открытые данные (проверка подписи, проверка и распаковка открытого
+ключа), то явно вызывается FAST(f), иначе -- редакция по умолчанию.
+Например, проверка подписи bign (а с ней и проверка CV-сертификатов btok)
+и dstu использует нерегулярные ecAddMulA(), ecHasOrderA(), FAST(qrPower),
+тогда как выработка подписи -- регулярные функции той же кривой.
+Редакции функций уровня поля (zzAddMod(), zzRedCrand(), zzMulMont() и др.)
+по скорости практически не различаются (эксперименты 2026.10.15), поэтому
+описания полей и кривых не делятся на регулярные и ускоренные.
+
 Директива SAFE_FAST дополнительно используется для нерегулярного ускорения обычных
 (одноредакционных) функций. Основное назначение директивы -- анализ падения 
 производительности при регуляризации. Директиву следует включать только тогда, 
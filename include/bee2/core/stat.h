@@ -0,0 +1,315 @@
+/*
+*******************************************************************************
+\file stat.h
+\brief Instrumentation counters
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+/*!
+*******************************************************************************
+\file stat.h
+\brief Счетчики инструментирования
+*******************************************************************************
+*/
+
+#ifndef __BEE2_STAT_H
+#define __BEE2_STAT_H
+
+#include "bee2/defs.h"
+#include "bee2/core/tm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+*******************************************************************************
+\file stat.h
+
+Счетчики инструментирования показывают, какая доля процессорного времени
+приходится на основные семейства примитивов библиотеки. Для каждого
+семейства учитываются число обращений, число обработанных октетов и число
+тактов таймера tmTicks(), затраченных на обработку.
+
+Учитываются следующие семейства:
+--	STAT_BELT_BLOCK: beltBlockEncr(), beltBlockDecr() и их варианты
+	(2, 3, N), по 16 октетов на блок;
+--	STAT_BASH_F: bashF(), по 192 октета на обращение;
+--	STAT_EC_MULA: ecMulA();
+--	STAT_EC_ADDMULA: ecAddMulA(), ecAddMulAV();
+--	STAT_ZZ_POWERMOD: zzPowerMod();
+--	STAT_RNG: rngStepR(), rngStepR2().
+
+Для семейств EC и ZZ октеты не учитываются. Семейства могут вкладываться
+друг в друга: например, время rngStepR() включает время обращений
+к beltBlockEncr().
+
+Счетчики включаются при сборке библиотеки с опцией BUILD_STAT (директива
+STAT_ENABLED). Без этой опции точки учета не компилируются, а функции
+модуля возвращают нулевые счетчики.
+
+Счетчики ведутся отдельно для каждого потока и изменяются только
+потоком-владельцем, без блокировок и атомарных операций. Функция
+statGet() суммирует счетчики всех потоков, в том числе завершившихся.
+Функция statReset() не изменяет счетчики, а запоминает их текущие
+значения в качестве точки отсчета. Чтение счетчиков других потоков
+не синхронизировано с их обновлением, поэтому снимок statGet() является
+приближенным: значения одного семейства могут относиться к немного
+разным моментам времени.
+
+Дополнительно для каждого потока ведется учет памяти, которая выделяется
+в блобах (см. blob.h): число выделений и освобождений, объем выделенной
+памяти и пиковый прирост объема используемой памяти. В блобах библиотека
+размещает состояния и стеки (см. _keep- и _deep-функции), поэтому
+пиковый прирост после вызова statReset() перед обращением к функции
+верхнего уровня (например, bignSign()) показывает, сколько памяти
+требуется этой функции. Учет памяти начинается после первого обращения
+к функциям модуля или к учитываемым примитивам. Память, выделенная
+в одном потоке и освобожденная в другом, учитывается неточно.
+
+\warning В режиме STAT_ENABLED каждая точка учета дважды обращается
+к таймеру и к локальной памяти потока (около 50-100 тактов на x86-64).
+Режим предназначен для профилирования, а не для штатной эксплуатации.
+*******************************************************************************
+*/
+
+#define STAT_BELT_BLOCK		0
+#define STAT_BASH_F			1
+#define STAT_EC_MULA		2
+#define STAT_EC_ADDMULA		3
+#define STAT_ZZ_POWERMOD	4
+#define STAT_RNG			5
+#define STAT_MAX			6
+
+/*!	\brief Счетчики семейства */
+typedef struct
+{
+	size_t calls;		/*!< число обращений */
+	size_t bytes;		/*!< число обработанных октетов */
+	tm_ticks_t ticks;	/*!< число тактов */
+} stat_ctr_t;
+
+/*!	\brief Счетчики памяти */
+typedef struct
+{
+	size_t allocs;		/*!< число выделений */
+	size_t frees;		/*!< число освобождений */
+	size_t bytes;		/*!< объем выделенной памяти */
+	size_t peak;		/*!< пиковый прирост объема используемой памяти */
+} stat_mem_t;
+
+/*!	\brief Счетчики включены?
+
+	Проверяется, что библиотека собрана с поддержкой счетчиков
+	инструментирования.
+	\return Признак поддержки.
+*/
+bool_t statIsEnabled();
+
+/*!	\brief Имя семейства
+
+	Возвращается имя семейства family (например, "belt-block").
+	\return Имя или 0, если family >= STAT_MAX.
+*/
+const char* statName(
+	size_t family			/*!< [in] семейство */
+);
+
+/*!	\brief Снимок счетчиков всех потоков
+
+	В ctrs записываются суммы счетчиков всех потоков (в том числе
+	завершившихся), накопленные после последнего вызова statReset().
+*/
+void statGet(
+	stat_ctr_t ctrs[STAT_MAX]	/*!< [out] счетчики */
+);
+
+/*!	\brief Снимок счетчиков текущего потока
+
+	В ctrs записываются счетчики текущего потока, накопленные после
+	последнего вызова statReset().
+*/
+void statGetThread(
+	stat_ctr_t ctrs[STAT_MAX]	/*!< [out] счетчики */
+);
+
+/*!	\brief Счетчики памяти текущего потока
+
+	В mem записываются счетчики памяти текущего потока, накопленные после
+	последнего вызова statReset(). Пиковый прирост отсчитывается от объема
+	памяти, который использовался в момент сброса.
+*/
+void statGetMem(
+	stat_mem_t* mem			/*!< [out] счетчики памяти */
+);
+
+/*!	\brief Сброс счетчиков
+
+	Счетчики всех потоков (в том числе счетчики памяти) и гистограммы
+	задержек сбрасываются: последующие снимки учитывают только обращения,
+	выполненные после сброса.
+*/
+void statReset();
+
+/*!
+*******************************************************************************
+\file stat.h
+
+\section stat-api Гистограммы задержек и точки трассировки
+
+Для функций верхнего уровня (API) ведутся гистограммы задержек: сколько
+обращений к функции завершились за заданное число тактов tmTicks().
+Учитываются следующие API:
+--	STAT_API_BIGN_SIGN: bignSign(), bignSign2();
+--	STAT_API_BIGN_VERIFY: bignVerify();
+--	STAT_API_BIGN_DH: bignDH();
+--	STAT_API_BIGN_CTX_SIGN: bignCtxSign(), bignCtxSign2() и их
+	W- и Sk-варианты;
+--	STAT_API_BIGN_CTX_VERIFY: bignCtxVerify(), bignCtxVerifyW(),
+	bignCtxVerifyPk();
+--	STAT_API_BIGN_CTX_DH: bignCtxDH(), bignCtxDHW(), bignCtxDHPk(),
+	bignCtxDHSk();
+--	STAT_API_BAKE_BMQV2 -- STAT_API_BAKE_BMQV5: bakeBMQVStep2() --
+	bakeBMQVStep5();
+--	STAT_API_BAKE_BSTS2 -- STAT_API_BAKE_BSTS5: bakeBSTSStep2() --
+	bakeBSTSStep5();
+--	STAT_API_BAKE_BPACE2 -- STAT_API_BAKE_BPACE6: bakeBPACEStep2() --
+	bakeBPACEStep6();
+--	STAT_API_BTOK_BAUTH2 -- STAT_API_BTOK_BAUTH5: btokBAuthCTStep2(),
+	btokBAuthTStep3(), btokBAuthCTStep4(), btokBAuthTStep5();
+--	STAT_API_RNG: rngStepR(), rngStepR2().
+
+Гистограмма логарифмически-линейная: каждый интервал [2^e, 2^{e + 1})
+делится на STAT_HIST_SUB равных корзин, поэтому граница корзины
+определяет задержку с относительной погрешностью не более 1 /
+STAT_HIST_SUB. Задержки до STAT_HIST_SUB тактов учитываются
+в отдельных корзинах, задержки от 2^33 тактов -- в последней корзине.
+Гистограммы общие для всех потоков и пополняются атомарными операциями.
+
+Гистограммы ведутся в режиме STAT_ENABLED (опция BUILD_STAT). Без него
+функция statHistGet() возвращает пустые гистограммы.
+
+При сборке с опцией BUILD_TRACE (директива TRACE_ENABLED) на входе и
+выходе из функций API срабатывают точки трассировки:
+--	в Linux -- точки USDT bee2:api__entry(api, name) и
+	bee2:api__return(api, name, code), где api -- номер API, name -- его
+	имя (см. statApiName()), code -- код возврата (для rngStepR() --
+	ERR_OK); точки доступны perf, bpftrace, SystemTap;
+--	в Windows -- события ETW "ApiEntry" и "ApiReturn" провайдера
+	TraceLogging "Bee2" с полями api, name и code.
+.
+Неподключенная точка USDT -- это одна инструкция nop. Без опции
+BUILD_TRACE точки не компилируются.
+*******************************************************************************
+*/
+
+#define STAT_API_BIGN_SIGN			0
+#define STAT_API_BIGN_VERIFY		1
+#define STAT_API_BIGN_DH			2
+#define STAT_API_BIGN_CTX_SIGN		3
+#define STAT_API_BIGN_CTX_VERIFY	4
+#define STAT_API_BIGN_CTX_DH		5
+#define STAT_API_BAKE_BMQV2			6
+#define STAT_API_BAKE_BMQV3			7
+#define STAT_API_BAKE_BMQV4			8
+#define STAT_API_BAKE_BMQV5			9
+#define STAT_API_BAKE_BSTS2			10
+#define STAT_API_BAKE_BSTS3			11
+#define STAT_API_BAKE_BSTS4			12
+#define STAT_API_BAKE_BSTS5			13
+#define STAT_API_BAKE_BPACE2		14
+#define STAT_API_BAKE_BPACE3		15
+#define STAT_API_BAKE_BPACE4		16
+#define STAT_API_BAKE_BPACE5		17
+#define STAT_API_BAKE_BPACE6		18
+#define STAT_API_BTOK_BAUTH2		19
+#define STAT_API_BTOK_BAUTH3		20
+#define STAT_API_BTOK_BAUTH4		21
+#define STAT_API_BTOK_BAUTH5		22
+#define STAT_API_RNG				23
+#define STAT_API_MAX				24
+
+#define STAT_HIST_SUB				4
+#define STAT_HIST_MAX				128
+
+/*!	\brief Гистограмма задержек */
+typedef struct
+{
+	size_t calls;					/*!< число обращений */
+	size_t errors;					/*!< число обращений с ошибкой */
+	size_t buckets[STAT_HIST_MAX];	/*!< корзины */
+} stat_hist_t;
+
+/*!	\brief Точки трассировки включены?
+
+	Проверяется, что библиотека собрана с точками трассировки.
+	\return Признак поддержки.
+*/
+bool_t statTraceIsEnabled();
+
+/*!	\brief Имя API
+
+	Возвращается имя API api (например, "bign-sign").
+	\return Имя или 0, если api >= STAT_API_MAX.
+*/
+const char* statApiName(
+	size_t api				/*!< [in] API */
+);
+
+/*!	\brief Корзина гистограммы
+
+	Определяется номер корзины, в которую попадает задержка ticks.
+	\return Номер корзины (меньше STAT_HIST_MAX).
+*/
+size_t statHistBucket(
+	tm_ticks_t ticks		/*!< [in] задержка */
+);
+
+/*!	\brief Граница корзины
+
+	Определяется нижняя граница корзины bucket: наименьшая задержка,
+	которая попадает в корзину.
+	\pre bucket < STAT_HIST_MAX.
+	\return Граница в тактах.
+*/
+tm_ticks_t statHistBound(
+	size_t bucket			/*!< [in] корзина */
+);
+
+/*!	\brief Снимок гистограммы
+
+	В hist записывается гистограмма задержек API api, накопленная после
+	последнего вызова statReset().
+	\pre api < STAT_API_MAX.
+	\remark Корзины читаются по одной без остановки потоков. Поэтому
+	снимок приближенный: корзины могут относиться к немного разным
+	моментам времени.
+*/
+void statHistGet(
+	stat_hist_t* hist,		/*!< [out] гистограмма */
+	size_t api				/*!< [in] API */
+);
+
+/*!	\brief Квантиль гистограммы
+
+	Определяется квантиль уровня permille / 1000 гистограммы hist: нижняя
+	граница корзины, до которой (включительно) накоплено не менее
+	permille / 1000 обращений.
+	\pre permille <= 1000.
+	\return Квантиль в тактах или 0, если гистограмма пуста.
+*/
+tm_ticks_t statHistQuantile(
+	const stat_hist_t* hist,	/*!< [in] гистограмма */
+	size_t permille				/*!< [in] уровень (в промилле) */
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_STAT_H */
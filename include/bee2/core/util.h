@@ -4,7 +4,7 @@
 \brief Utilities
 \project bee2 [cryptographic library]
 \created 2012.07.16
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -133,6 +133,43 @@ extern "C" {
 */
 const char* utilVersion();
 
+/*!	\brief Платформа
+
+	Определяется описание платформы: параметры сборки библиотеки,
+	действующие реализации алгоритмов, возможности процессора и доступные
+	источники энтропии. Описание -- это последовательность пар key=value,
+	разделенных пробелами:
+	-	version: версия библиотеки (см. utilVersion());
+	-	word: длина машинного слова в битах (B_PER_W);
+	-	safe: SAFE (регулярные функции) или FAST (быстрые, SAFE_FAST);
+	-	stat: ON, если собраны счетчики инструментирования (см. stat.h);
+	-	lean: ON, если собран профиль с низким потреблением памяти
+		(директива LEAN_ENABLED);
+	-	bash: реализация bash-f (см. bashPlatform());
+	-	bash-dispatch: ON, если реализация bash-f выбирается динамически;
+	-	belt: реализация belt-block (см. beltPlatform());
+	-	belt-wide: AVX512, если доступна широкая реализация belt-block;
+	-	zm: редукции, которые zmCreate() выбирает для модулей вида 
+		B^n - c длины 256, 384 и 512 битов (см. zmTuned());
+	-	cpu: возможности процессора через запятую (например,
+		sse2,ssse3,pclmul,avx2);
+	-	rng: доступные источники энтропии через запятую (см. rngESRead()).
+	.
+	Например:
+	\code
+	version=2.1.6 word=64 safe=SAFE stat=OFF lean=OFF bash=BASH_AVX2
+	bash-dispatch=ON belt=BELT_TABLE belt-wide=OFF
+	zm=256:CRAND,384:CRAND,512:CRAND cpu=sse2,ssse3,pclmul,avx2
+	rng=trng,sys,timer
+	\endcode
+	(в одну строку). Пустые списки задаются пустыми значениями.
+	\return Описание платформы.
+	\remark Описание строится при первом вызове функции и далее
+	не меняется. В частности, не учитываются последующие обращения
+	к beltBlockCT() и zmTune().
+*/
+const char* utilPlatform();
+
 /*
 *******************************************************************************
 Деструкторы
@@ -4,7 +4,7 @@
 \brief STB 34.101.66 (bake): authenticated key establishment (AKE) protocols
 \project bee2 [cryptographic library]
 \created 2014.04.14
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -68,6 +68,15 @@ bignStdParams(), проверить --- с помощью функции bignVal
 задается функцией с суффиксом keep. Состояние включает указатели на внутренние
 фрагменты памяти, и поэтому его нельзя копировать как обычный блок памяти.
 
+Состояние включает также стек низкоуровневых функций. Поэтому
+низкоуровневые функции не выделяют память: все необходимое размещается
+в состоянии или (для пакетных функций) во вспомогательной памяти, длина
+которой задается функцией с суффиксом deep. Исключение составляют шаги
+4 и 5 протокола BSTS, которые выделяют память для сертификатов длиннее
+BAKE_BSTS_CERT_MAX октетов. Память для состояния можно готовить заранее
+(например, в пуле соединений) и использовать повторно, вызывая функцию
+Start для нового сеанса.
+
 В описаниях низкоуровневых функций StepX фигурируют данные, которые задаются в
 инициализирующей функции Start: 
 -	уровень стойкости l из перечня долговременных параметров;
@@ -90,7 +99,31 @@ bignStdParams(), проверить --- с помощью функции bignVal
 *******************************************************************************
 */
 
-/*!	\brief Настройки bake */
+/*!	\brief Поставщик одноразовых ключей
+
+	Поставщик с состоянием state возвращает одноразовый личный ключ 
+	[l / 4]u из {1, 2,..., q - 1} и соответствующий ему открытый ключ 
+	[l / 2]V = u G.
+	\return ERR_OK, если ключи получены, и код ошибки в противном случае.
+	\remark Поставщик может извлекать заранее подготовленные ключи, 
+	например, из пула bign (см. bignCtxPoolTake()). Это сокращает время 
+	выполнения шагов протоколов в режиме реального времени.
+*/
+typedef err_t (*bake_eph_i)(
+	octet u[],				/*!< [out] одноразовый личный ключ */
+	octet V[],				/*!< [out] одноразовый открытый ключ */
+	void* state				/*!< [in,out] состояние поставщика */
+);
+
+/*!	\brief Настройки bake
+
+	Если eph != 0, то в протоколах BMQV и BSTS одноразовые ключи (u, V) 
+	получаются от поставщика eph с состоянием eph_state, а не вырабатываются 
+	с помощью rng. Поставщик должен работать с теми же долговременными 
+	параметрами, что и протокол. Ключ u проверяется на принадлежность 
+	{1, 2,..., q - 1}, точка V -- на принадлежность кривой. Соответствие 
+	V = u G не проверяется.
+*/
 typedef struct
 {
 	bool_t kca;				/*!< сторона A подтверждает ключ */
@@ -101,6 +134,8 @@ typedef struct
 	size_t hellob_len;		/*!< длина hellob в октетах */
 	gen_i rng;				/*!< генератор случайных чисел */
 	void* rng_state;		/*!< состояние rng */
+	bake_eph_i eph;			/*!< поставщик одноразовых ключей */
+	void* eph_state;		/*!< состояние eph */
 } bake_settings;
 
 /*!
@@ -167,6 +202,28 @@ err_t bakeKDF(
 	size_t num				/*!< [in] номер ключа */
 );
 
+/*!	\brief Построение нескольких ключей
+
+	По секретному слову [secret_len]secret, дополнительному слову [iv_len]iv
+	и номерам num, num + 1,..., num + n - 1 строятся ключи
+	[32](key + 32 * i), i = 0, 1,..., n - 1.
+	\return ERR_OK, если ключи успешно построены, и код ошибки в противном
+	случае.
+	\remark Результат совпадает с результатом вызовов
+	bakeKDF(key + 32 * i, secret, secret_len, iv, iv_len, num + i).
+	Хэширование secret || iv выполняется однократно, ключи строятся
+	функцией beltKRPStepGMulti().
+*/
+err_t bakeKDFMulti(
+	octet key[],			/*!< [out] ключи */
+	const octet secret[],	/*!< [in] секретное слово */
+	size_t secret_len,		/*!< [in] длина secret */
+	const octet iv[],		/*!< [in] дополнительное слово */
+	size_t iv_len,			/*!< [in] длина iv */
+	size_t num,				/*!< [in] номер первого ключа */
+	size_t n				/*!< [in] число ключей */
+);
+
 /*!	\brief Построение точки эллиптической кривой
 
 	При долговременных параметрах params по сообщению [l / 4]msg строится 
@@ -234,6 +291,37 @@ err_t bakeBMQVStart(
 	const bake_cert* cert			/*!< [in] сертификат */
 );
 
+/*!	\brief Максимальный размер кэша BMQV */
+#define BAKE_BMQV_CACHE_MAX 65536
+
+/*!	\brief Размер кэша предвычислений BMQV
+
+	Устанавливается число max ячеек кэша предвычислений для долговременных
+	открытых ключей противоположной стороны протокола BMQV. На шагах 3 и 4
+	открытый ключ из сертификата умножается на открытую кратность. Если
+	ключ встречается повторно, то для него строится таблица
+	предвычислений, которая сохраняется в кэше и ускоряет умножение
+	в последующих сеансах. Нулевое значение max отключает кэш. По умолчанию
+	кэш отключен.
+	\return Признак успеха. Если max > BAKE_BMQV_CACHE_MAX или не удалось
+	выделить память, то возвращается FALSE, а прежний кэш сохраняется.
+	\remark При изменении размера кэш очищается.
+	\remark Каждая ячейка занимает около 4 Кб. Ячейка выбирается по
+	хэш-значению ключа и перезаписывается при коллизиях.
+	\remark Кэш не заменяет проверку сертификатов: функция проверки
+	bake_cert::val вызывается в каждом сеансе.
+*/
+bool_t bakeBMQVCacheSetMax(
+	size_t max						/*!< [in] число ячеек */
+);
+
+/*!	\brief Очистка кэша предвычислений BMQV
+
+	Из кэша предвычислений BMQV удаляются все таблицы. Размер кэша
+	не меняется.
+*/
+void bakeBMQVCacheFlush();
+
 /*!	\brief Шаг 2 протокола BMQV
 
 	Выполняется шаг 2 протокола BMQV с состоянием state. Сторона B формирует
@@ -365,6 +453,14 @@ err_t bakeBMQVRunA(
 *******************************************************************************
 */
 
+/*!	\brief Максимальная длина сертификата BSTS без выделения памяти
+
+	Шаги 4 и 5 протокола BSTS расшифровывают сертификаты длины не более
+	BAKE_BSTS_CERT_MAX октетов в памяти состояния. Для более длинных
+	сертификатов выделяется дополнительная память.
+*/
+#define BAKE_BSTS_CERT_MAX 512
+
 /*!	\brief Длина состояния функций BSTS
 
 	Возвращается длина состояния (в октетах) функций протокола BSTS.
@@ -430,6 +526,49 @@ err_t bakeBSTSStep3(
 	void* state				/*!< [in,out] состояние */
 );
 
+/*!	\brief Пакетный шаг 3 протокола BSTS
+
+	Шаг 3 протокола BSTS выполняется для count независимых сеансов:
+	для каждого i выполняется аналог вызова
+	\code
+		codes[i] = bakeBSTSStep3(outs[i], ins[i], states[i]).
+	\endcode
+	Кратные точки сеансов с одинаковыми долговременными параметрами
+	вычисляются совместно: переходы к аффинным координатам выполняются
+	пакетами с одним обращением в базовом поле на пакет
+	(см. ecMulARecBatch()).
+	\expect Для каждого i выполнены условия вызова bakeBSTSStep3().
+	\return ERR_OK, если шаг успешно выполнен во всех сеансах, и код
+	первой ошибки в противном случае. Результаты отдельных сеансов
+	возвращаются в codes.
+	\pre По адресу stack зарезервировано bakeBSTSStep3Batch_deep(l, count)
+	октетов, где l -- наибольший уровень стойкости сеансов.
+	\remark Сообщения outs[i] и состояния states[i] совпадают
+	с теми, которые были бы получены при вызове bakeBSTSStep3().
+	Пакетная обработка не меняет протокол.
+*/
+err_t bakeBSTSStep3Batch(
+	octet* outs[],			/*!< [out] выходные сообщения M2 */
+	const octet* ins[],		/*!< [in] входные сообщения M1 */
+	void* states[],			/*!< [in,out] состояния */
+	size_t count,			/*!< [in] число сеансов */
+	err_t codes[],			/*!< [out] коды результатов */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Глубина стека пакетного шага 3 протокола BSTS
+
+	Возвращается длина вспомогательной памяти (в октетах) функции
+	bakeBSTSStep3Batch(), которая обрабатывает не более count сеансов
+	на уровне стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина вспомогательной памяти.
+*/
+size_t bakeBSTSStep3Batch_deep(
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t count			/*!< [in] число сеансов */
+);
+
 /*!	\brief Шаг 4 протокола BSTS
 
 	Выполняется шаг 4 протокола BSTS с состоянием state. Сторона B 
@@ -696,6 +835,152 @@ err_t bakeBPACERunA(
 	void* file						/*!< [in,out] канал связи */
 );
 
+/*!
+*******************************************************************************
+\file bake.h
+
+\section bake-sm Неблокирующее выполнение
+
+Функции RunA и RunB используют блокирующие функции чтения и записи.
+Для выполнения большого числа протоколов в одном потоке (например,
+в цикле обработки событий сервера) предназначена машина состояний,
+которая управляет шагами протоколов BMQV, BSTS, BPACE.
+
+Машина подключается к состоянию протокола, подготовленному функцией
+Start (bakeBMQVStart(), bakeBSTSStart(), bakeBPACEStart()), и сообщает,
+какое действие ожидается (см. bakeSMWant()):
+-	BAKE_SM_READ: прочитать входящее сообщение и передать его в функцию
+	bakeSMStepR();
+-	BAKE_SM_WRITE: получить исходящее сообщение с помощью функции
+	bakeSMStepW() и отправить его;
+-	BAKE_SM_DONE: протокол завершен, ключ можно получить с помощью функции
+	bakeSMStepG().
+
+Машина не выполняет ввод-вывод и не выделяет память. Входящие сообщения
+передаются целиком. Длины сообщений известны заранее, за исключением
+сообщений M2 и M3 протокола BSTS, которые содержат сертификаты сторон.
+Границы этих сообщений должен определять канал связи.
+
+Пример (сторона A протокола BSTS):
+\code
+	code = bakeBSTSStart(state, params, settings, privkeya, certa);
+	code = bakeSMStart(sm, state, BAKE_BSTS, FALSE, 0, valb);
+	while (code == ERR_OK &&
+		(want = bakeSMWant(&len, sm)) != BAKE_SM_DONE)
+		if (want == BAKE_SM_READ)
+			// дождаться сообщения [in_len]in (in_len == len,
+			// если len != SIZE_MAX)
+			code = bakeSMStepR(sm, in, in_len);
+		else
+			// отправить [len]out
+			code = bakeSMStepW(out, sm);
+	if (code == ERR_OK)
+		code = bakeSMStepG(key, sm);
+\endcode
+В цикле обработки событий каждое действие выполняется по готовности
+канала, а между действиями обрабатываются другие соединения.
+*******************************************************************************
+*/
+
+#define BAKE_BMQV		1	/*!< протокол BMQV */
+#define BAKE_BSTS		2	/*!< протокол BSTS */
+#define BAKE_BPACE		3	/*!< протокол BPACE */
+
+#define BAKE_SM_READ	1	/*!< ожидается входящее сообщение */
+#define BAKE_SM_WRITE	2	/*!< ожидается отправка сообщения */
+#define BAKE_SM_DONE	3	/*!< протокол завершен */
+
+/*!	\brief Длина состояния машины
+
+	Возвращается длина состояния (в октетах) машины, которая управляет
+	протоколом уровня стойкости l, в котором собственный сертификат
+	стороны имеет длину cert_len октетов.
+	\remark Для протоколов BMQV и BPACE можно использовать cert_len == 0.
+	\return Длина состояния.
+*/
+size_t bakeSM_keep(
+	size_t l,					/*!< [in] уровень стойкости */
+	size_t cert_len				/*!< [in] длина собственного сертификата */
+);
+
+/*!	\brief Запуск машины
+
+	Машина sm подключается к состоянию state протокола proto
+	(BAKE_BMQV, BAKE_BSTS или BAKE_BPACE) и работает от лица стороны B,
+	если b == TRUE, или стороны A, если b == FALSE. Для протокола BMQV
+	дополнительно задается сертификат cert стороны-партнера, для протокола
+	BSTS -- функция val проверки сертификата стороны-партнера. Сторона B
+	сразу выполняет шаг 2 и формирует первое исходящее сообщение.
+	\pre По адресу sm зарезервировано bakeSM_keep() октетов.
+	\expect Состояние state подготовлено функцией Start протокола proto
+	и не используется другими функциями на протяжении работы машины.
+	\return ERR_OK, если машина успешно запущена, и код ошибки
+	в противном случае.
+*/
+err_t bakeSMStart(
+	void* sm,					/*!< [out] состояние машины */
+	void* state,				/*!< [in,out] состояние протокола */
+	size_t proto,				/*!< [in] протокол */
+	bool_t b,					/*!< [in] сторона B? */
+	const bake_cert* cert,		/*!< [in] сертификат партнера (BMQV) */
+	bake_certval_i val			/*!< [in] проверка сертификата (BSTS) */
+);
+
+/*!	\brief Ожидаемое действие
+
+	Определяется действие, которое ожидает машина sm. Если len != 0, то
+	в len возвращается длина исходящего сообщения (BAKE_SM_WRITE) или
+	входящего сообщения (BAKE_SM_READ). Для входящих сообщений
+	переменной длины возвращается SIZE_MAX.
+	\return BAKE_SM_READ, BAKE_SM_WRITE или BAKE_SM_DONE. После ошибки
+	возвращается BAKE_SM_DONE.
+*/
+size_t bakeSMWant(
+	size_t* len,				/*!< [out] длина сообщения */
+	const void* sm				/*!< [in] состояние машины */
+);
+
+/*!	\brief Обработка входящего сообщения
+
+	Машина sm обрабатывает входящее сообщение [in_len]in: выполняет
+	очередной шаг протокола и, возможно, формирует исходящее сообщение.
+	\expect{ERR_BAD_LOGIC} bakeSMWant() == BAKE_SM_READ.
+	\expect{ERR_BAD_INPUT} Длина in_len совпадает с длиной,
+	возвращаемой bakeSMWant(), если эта длина отлична от SIZE_MAX.
+	\return ERR_OK, если шаг успешно выполнен, и код ошибки в противном
+	случае. После ошибки машина останавливается: все последующие
+	вызовы возвращают тот же код.
+*/
+err_t bakeSMStepR(
+	void* sm,					/*!< [in,out] состояние машины */
+	const octet in[],			/*!< [in] входящее сообщение */
+	size_t in_len				/*!< [in] длина in */
+);
+
+/*!	\brief Получение исходящего сообщения
+
+	Исходящее сообщение машины sm копируется в буфер out, длина которого
+	возвращается функцией bakeSMWant().
+	\expect{ERR_BAD_LOGIC} bakeSMWant() == BAKE_SM_WRITE.
+	\return ERR_OK, если сообщение получено, и код ошибки в противном
+	случае.
+*/
+err_t bakeSMStepW(
+	octet out[],				/*!< [out] исходящее сообщение */
+	void* sm					/*!< [in,out] состояние машины */
+);
+
+/*!	\brief Извлечение ключа
+
+	Определяется общий ключ key протокола, которым управляет машина sm.
+	\expect{ERR_BAD_LOGIC} bakeSMWant() == BAKE_SM_DONE.
+	\return ERR_OK, если ключ получен, и код ошибки в противном случае.
+*/
+err_t bakeSMStepG(
+	octet key[32],				/*!< [out] общий ключ */
+	void* sm					/*!< [in,out] состояние машины */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
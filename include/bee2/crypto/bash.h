@@ -4,7 +4,7 @@
 \brief STB 34.101.77 (bash): sponge-based algorithms
 \project bee2 [cryptographic library]
 \created 2014.07.15
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -50,6 +50,13 @@ sponge-функции bash-f, реализованной в bashF(). Sponge-фу
 По умолчанию используется реализация для платформы BASH_64 либо, если
 64-разрядные регистры не поддерживаются, BASH_32.
 
+При сборке с опцией BASH_DISPATCH (включена по умолчанию для платформы 
+x86-64 и компиляторов GCC / Clang и отключается при явном указании 
+BASH_PLATFORM) в библиотеку включаются реализации BASH_64, BASH_SSE2,
+BASH_AVX2, BASH_AVX512, и при первом обращении к bashF() выбирается
+наиболее быстрая из тех, которые поддерживаются процессором. Название
+выбранной реализации возвращает функция bashPlatform().
+
 Глубина стека bashF() определяется с помощью функции bashF_deep().
 
 Конкретный алгоритм хэширования bashHashNNN возвращает NNN-битовые хэш-значения,
@@ -70,6 +77,14 @@ sponge-функции bash-f, реализованной в bashF(). Sponge-фу
 низкоуровневыми --- в них не проверяются входные данные. 
 Связка покрывается высокоуровневой функцией bashHash().
 
+Хэш-состояние (как и состояние автомата, см. ниже) рекомендуется выравнивать
+на границу MEM_ALIGN (см. mem.h), например, объявлять буфер для него
+с помощью макроса MEM_ALIGNED. В выровненном состоянии 192-октетный блок
+bash-f выровнен на границу 64 байт, и векторные реализации bash-f (AVX2,
+AVX512) загружают и выгружают его выровненными инструкциями, а реализация
+NEON не копирует блок во вспомогательный буфер. Невыровненное состояние
+также допускается.
+
 Стандартные уровни l = 128, 192, 256 поддержаны макросами bashNNNXXX.
 
 Кроме алгоритмов хэширования, СТБ 34.101.77 определяет криптографический
@@ -98,6 +113,11 @@ bashPrgCmdStep(), где Cmd -- имя команды. Обратим внима
 отсутствует. Он не нужен, потому что команды автомата выполняются в отложенной
 манере --- команда завершается при запуске следующей.
 
+Состояние автомата не содержит указателей и может копироваться как
+блок памяти. Функция bashPrgClone() копирует автомат, не затрагивая
+служебную память, и позволяет однократно выполнить ключевую инициализацию,
+а затем порождать от нее копии для обработки отдельных сообщений.
+
 В функциях, реализующих команды, автомат программируемых алгоритмов
 отождествляется со своим состоянием. Используется приемлемый (и отражающий
 суть дела) жаргон: "загрузить в автомат", "выгрузить из автомата".
@@ -116,6 +136,9 @@ bashPrgCmdStep(), где Cmd -- имя команды. Обратим внима
 \safe Реализация для платформ BASH_SSE2, BASH_AVX2, BASH_AVX512 могут 
 оставлять в стеке данные, которые не помещаются в расширенные регистры 
 соответствующих архитектур.
+
+\safe Функции bashF2(), bashF4(), bashF8() оставляют в стеке копии
+преобразуемых состояний.
 *******************************************************************************
 */
 
@@ -126,6 +149,16 @@ bashPrgCmdStep(), где Cmd -- имя команды. Обратим внима
 */
 size_t bashF_deep();
 
+/*!	\brief Реализация sponge-функции
+
+	Возвращается название реализации bashF(): "BASH_64", "BASH_32",
+	"BASH_SSE2", "BASH_AVX2", "BASH_AVX512" или "BASH_NEON".
+	\remark При сборке с опцией BASH_DISPATCH реализация выбирается
+	во время выполнения.
+	\return Название реализации.
+*/
+const char* bashPlatform();
+
 /*!	\brief Sponge-функция
 
 	Буфер block преобразуется с помощью sponge-функции bash-f.
@@ -136,6 +169,84 @@ void bashF(
 	void* stack			/*!< [in,out] стек */
 );
 
+/*!	\brief Поглощение блоков sponge-функцией
+
+	Буфер [count]buf разбивается на блоки из rate октетов. Для каждого
+	блока первые rate октетов block заменяются октетами блока, после чего
+	block преобразуется с помощью sponge-функции bash-f. Результат
+	совпадает с результатом последовательных вызовов memCopy()
+	и bashF(), но в реализациях BASH_AVX2 и BASH_AVX512 достигается
+	быстрее: состояние удерживается в регистрах, а блоки загружаются
+	в регистры непосредственно из buf.
+	\pre rate % 8 == 0 && 0 < rate && rate <= 192.
+	\pre count % rate == 0.
+	\pre Буферы block и buf не пересекаются.
+	\remark Глубина стека -- bashF_deep().
+*/
+void bashFAbsorb(
+	octet block[192],	/*!< [in,out] прообраз/образ */
+	const void* buf,	/*!< [in] блоки */
+	size_t count,		/*!< [in] число октетов в блоках */
+	size_t rate,		/*!< [in] длина блока */
+	void* stack			/*!< [in,out] стек */
+);
+
+/*!	\brief Глубина стека sponge-функции на двух состояниях
+
+	Возвращается глубина стека (в октетах) функции bashF2().
+	\return Глубина стека.
+*/
+size_t bashF2_deep();
+
+/*!	\brief Sponge-функция на двух состояниях
+
+	Буферы block[0..192), block[192..384) независимо преобразуются
+	с помощью sponge-функции bash-f. Результат совпадает с результатом
+	двух вызовов bashF(), но достигается быстрее за счет одновременной
+	обработки буферов.
+	\pre Буфер block корректен.
+*/
+void bashF2(
+	octet block[384],	/*!< [in,out] прообразы/образы */
+	void* stack			/*!< [in,out] стек */
+);
+
+/*!	\brief Глубина стека sponge-функции на четырех состояниях
+
+	Возвращается глубина стека (в октетах) функции bashF4().
+	\return Глубина стека.
+*/
+size_t bashF4_deep();
+
+/*!	\brief Sponge-функция на четырех состояниях
+
+	Буферы block[192 * i..192 * (i + 1)), i = 0, 1, 2, 3, независимо
+	преобразуются с помощью sponge-функции bash-f.
+	\pre Буфер block корректен.
+*/
+void bashF4(
+	octet block[768],	/*!< [in,out] прообразы/образы */
+	void* stack			/*!< [in,out] стек */
+);
+
+/*!	\brief Глубина стека sponge-функции на восьми состояниях
+
+	Возвращается глубина стека (в октетах) функции bashF8().
+	\return Глубина стека.
+*/
+size_t bashF8_deep();
+
+/*!	\brief Sponge-функция на восьми состояниях
+
+	Буферы block[192 * i..192 * (i + 1)), i = 0, 1,..., 7, независимо
+	преобразуются с помощью sponge-функции bash-f.
+	\pre Буфер block корректен.
+*/
+void bashF8(
+	octet block[1536],	/*!< [in,out] прообразы/образы */
+	void* stack			/*!< [in,out] стек */
+);
+
 /*
 *******************************************************************************
 Алгоритмы хэширования (bashHash)
@@ -173,6 +284,20 @@ void bashHashStepH(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Хэширование списка фрагментов
+
+	Выполняются последовательные вызовы bashHashStepH(vec[i].buf,
+	vec[i].count, state), i = 0, 1,..., n - 1.
+	\remark Данные фрагментов не копируются во вспомогательный буфер.
+	Неполные блоки на стыках фрагментов накапливаются в state, полные
+	блоки обрабатываются непосредственно в фрагментах.
+*/
+void bashHashStepHv(
+	const mem_vec_t vec[],	/*!< [in] список фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Определение хэш-значения
 
 	Определяются первые октеты [hash_len]hash окончательного хэш-значения 
@@ -205,6 +330,35 @@ bool_t bashHashStepV(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Сохранение состояния хэширования
+
+	Состояние хэширования state сохраняется в буфере buf в формате,
+	который не зависит от платформы и включает идентификатор и версию.
+	Сохраненное состояние можно восстановить функцией bashHashLoad()
+	и продолжить хэширование.
+	\expect bashHashStart() < bashHashSave().
+	\remark Сохраненное состояние содержит последние обработанные данные.
+*/
+void bashHashSave(
+	octet buf[196],		/*!< [out] сохраненное состояние */
+	const void* state	/*!< [in] состояние */
+);
+
+/*!	\brief Восстановление состояния хэширования
+
+	Состояние хэширования state восстанавливается по буферу buf,
+	подготовленному функцией bashHashSave().
+	\expect{ERR_BAD_INPUT} Буферы buf и state корректны.
+	\return ERR_OK, если состояние восстановлено, ERR_BAD_FORMAT, если
+	формат buf не распознан, и код ошибки в других случаях.
+	\remark По адресу state должно быть зарезервировано bashHash_keep()
+	октетов.
+*/
+err_t bashHashLoad(
+	void* state,			/*!< [out] состояние */
+	const octet buf[196]	/*!< [in] сохраненное состояние */
+);
+
 /*!	\brief Хэширование
 
 	С помощью алгоритма bash уровня стойкости l определяется хэш-значение 
@@ -222,6 +376,26 @@ err_t bashHash(
 	size_t count		/*!< [in] число октетов данных */
 );
 
+/*!	\brief Хэширование нескольких сообщений
+
+	С помощью алгоритма bash уровня стойкости l определяются хэш-значения
+	[l / 4](hash + l / 4 * i) буферов [count[i]]src[i], i = 0, 1,..., n - 1.
+	\expect{ERR_BAD_PARAM} l > 0 && l % 16 == 0 && l <= 256.
+	\expect{ERR_BAD_INPUT} Буферы hash, src, count, src[i] корректны.
+	\return ERR_OK, если хэширование завершено успешно, и код ошибки
+	в противном случае.
+	\remark Сообщения обрабатываются группами по 8 с помощью bashF8().
+	Ускорение по сравнению с последовательными вызовами bashHash()
+	максимально, если сообщения группы имеют близкие длины.
+*/
+err_t bashHashMulti(
+	octet hash[],			/*!< [out] хэш-значения */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t n,				/*!< [in] число сообщений */
+	const void* src[],		/*!< [in] сообщения */
+	const size_t count[]	/*!< [in] длины сообщений */
+);
+
 /*
 *******************************************************************************
 bash256
@@ -328,6 +502,21 @@ void bashPrgRestart(
 	void* state			/*!< [out] автомат */
 );
 
+/*!	\brief Копирование автомата
+
+	Автомат src копируется в автомат dest. Продолжение работы с dest
+	эквивалентно продолжению работы с src.
+	\pre По адресам dest и src зарезервировано bashPrg_keep() октетов.
+	\pre Буферы dest и src не пересекаются.
+	\expect bashPrgStart(src) < bashPrgClone().
+	\remark Копируется только состояние автомата, служебная память
+	(стек sponge-функции) не копируется.
+*/
+void bashPrgClone(
+	void* dest,			/*!< [out] копия автомата */
+	const void* src		/*!< [in] автомат */
+);
+
 /*!	\brief Начало загрузки данных
 
 	Инициализируется загрузка данных в автомат state.
@@ -471,6 +660,417 @@ void bashPrgRatchet(
 	void* state			/*!< [in,out] автомат */
 );
 
+/*!	\brief Установка защиты (AEAD)
+
+	На ключе [key_len]key с анонсом [ann_len]ann устанавливается защита
+	критических данных [count1]src1 и открытых данных [count2]src2.
+	Критические данные зашифровываются и сохраняются в буфере [count1]dest.
+	Кроме этого определяется имитовставка [l / 8]mac пары (src1, src2).
+	Используется автомат с уровнем стойкости l и емкостью d, который
+	последовательно выполняет команды start, absorb(src2), encr(src1),
+	squeeze.
+	\expect{ERR_BAD_PARAMS} l == 128 || l == 192 || l == 256, d == 1 || d == 2.
+	\expect{ERR_BAD_INPUT}
+	-	ann_len % 4 == 0 && ann_len <= 60;
+	-	key_len % 4 == 0 && l / 8 <= key_len <= 60;
+	-	буферы dest и mac не пересекаются.
+	.
+	\return ERR_OK, если защита успешно установлена, и код ошибки
+	в противном случае.
+	\remark Буферы могут пересекаться, за исключением пересечения dest и mac.
+*/
+err_t bashPrgAEADWrap(
+	void* dest,				/*!< [out] зашифрованные критические данные */
+	octet mac[],			/*!< [out] имитовставка */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t d,				/*!< [in] емкость */
+	const void* src1,		/*!< [in] критические данные */
+	size_t count1,			/*!< [in] число октетов критических данных */
+	const void* src2,		/*!< [in] открытые данные */
+	size_t count2,			/*!< [in] число октетов открытых данных */
+	const octet ann[],		/*!< [in] анонс */
+	size_t ann_len,			/*!< [in] длина анонса в октетах */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
+/*!	\brief Снятие защиты (AEAD)
+
+	На ключе [key_len]key с анонсом [ann_len]ann снимается защита
+	критических данных [count1]src1 и открытых данных [count2]src2
+	с проверкой имитовставки [l / 8]mac. Критические данные
+	расшифровываются и сохраняются в буфере [count1]dest.
+	\expect{ERR_BAD_PARAMS} l == 128 || l == 192 || l == 256, d == 1 || d == 2.
+	\expect{ERR_BAD_INPUT}
+	-	ann_len % 4 == 0 && ann_len <= 60;
+	-	key_len % 4 == 0 && l / 8 <= key_len <= 60.
+	.
+	\return ERR_OK, если защита успешно снята, ERR_BAD_MAC, если
+	имитовставка не совпала, и другой код ошибки в иных случаях.
+	\remark Имитовставка вычисляется после расшифрования. При ошибке
+	ERR_BAD_MAC буфер dest обнуляется.
+	\remark Буферы могут пересекаться.
+*/
+err_t bashPrgAEADUnwrap(
+	void* dest,				/*!< [out] расшифрованные критические данные */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t d,				/*!< [in] емкость */
+	const void* src1,		/*!< [in] зашифрованные критические данные */
+	size_t count1,			/*!< [in] число октетов критических данных */
+	const void* src2,		/*!< [in] открытые данные */
+	size_t count2,			/*!< [in] число октетов открытых данных */
+	const octet mac[],		/*!< [in] имитовставка */
+	const octet ann[],		/*!< [in] анонс */
+	size_t ann_len,			/*!< [in] длина анонса в октетах */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
+/*
+*******************************************************************************
+Поблочная защита (bashPrgChunk)
+
+Критические данные разбиваются на фрагменты (chunks) длины chunk_len, 
+последний фрагмент может быть короче (и пустым, если пусты сами 
+данные). Число фрагментов n = max(1, ceil(count / chunk_len)) определяет функция 
+bashPrgChunkCount(). 
+
+Защита строится с помощью автомата M, который выполняет команды
+start(ann, key), absorb(<chunk_len>_64 || src2). Фрагмент с номером i 
+обрабатывается копией M, которая выполняет команды restart(<i>_64 || 
+<last>_32), encr (или decr), squeeze. Здесь last = 1 для последнего 
+фрагмента и last = 0 для остальных. Результатом обработки является 
+имитовставка фрагмента tag_i длины l / 8 октетов. Общая имитовставка 
+mac длины l / 8 октетов вырабатывается еще одной копией M, которая 
+выполняет команды absorb(tag_0 || tag_1 || ... || tag_{n - 1}), squeeze.
+
+Фрагменты обрабатываются независимо. Функции bashPrgChunkWrap(),
+bashPrgChunkUnwrap() обрабатывают их параллельно: группы из 8 
+фрагментов распределяются по потокам пула по умолчанию (см. 
+mtPoolFor()), внутри группы состояния автоматов преобразуются 
+одновременно с помощью bashF8(). 
+
+Функции bashPrgChunkStart(), bashPrgChunkEncr(), bashPrgChunkDecr(),
+bashPrgChunkStepG(), bashPrgChunkStepV() позволяют обрабатывать 
+фрагменты по одному: потоково либо в произвольном порядке. При потоковом 
+снятии защиты общую имитовставку можно проверить до обработки 
+фрагментов, если имитовставки фрагментов известны заранее. При 
+произвольном доступе к фрагменту i достаточно проверить tag_i: 
+имитовставка фрагмента зависит от ключа, анонса, открытых данных, 
+длины фрагментов, номера фрагмента и признака last. Общая имитовставка 
+защищает от удаления, перестановки и усечения фрагментов.
+
+Имитовставки фрагментов передаются получателю вместе с зашифрованными 
+данными, что увеличивает объем защищенных данных на n * l / 8 октетов.
+*******************************************************************************
+*/
+
+/*!	\brief Число фрагментов
+
+	Определяется число фрагментов, на которые разбиваются данные 
+	длины count при длине фрагментов chunk_len.
+	\pre chunk_len > 0.
+	\return max(1, ceil(count / chunk_len)).
+*/
+size_t bashPrgChunkCount(
+	size_t count,			/*!< [in] длина данных */
+	size_t chunk_len		/*!< [in] длина фрагментов */
+);
+
+/*!	\brief Длина состояния поблочной защиты
+
+	Возвращается длина состояния (в октетах) поблочной защиты.
+	\return Длина состояния.
+*/
+size_t bashPrgChunk_keep();
+
+/*!	\brief Инициализация поблочной защиты
+
+	По уровню стойкости l, емкости d, длине фрагментов chunk_len, 
+	открытым данным [count2]src2, анонсу [ann_len]ann и ключу 
+	[key_len]key инициализуется состояние state поблочной защиты.
+	\pre l == 128 || l == 192 || l == 256.
+	\pre d == 1 || d == 2.
+	\pre chunk_len > 0.
+	\pre ann_len % 4 == 0 && ann_len <= 60.
+	\pre key_len % 4 == 0 && l / 8 <= key_len <= 60.
+	\pre По адресу state зарезервировано bashPrgChunk_keep() октетов.
+*/
+void bashPrgChunkStart(
+	void* state,			/*!< [out] состояние */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t d,				/*!< [in] емкость */
+	size_t chunk_len,		/*!< [in] длина фрагментов */
+	const void* src2,		/*!< [in] открытые данные */
+	size_t count2,			/*!< [in] число октетов открытых данных */
+	const octet ann[],		/*!< [in] анонс */
+	size_t ann_len,			/*!< [in] длина анонса в октетах */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
+/*!	\brief Зашифрование фрагмента
+
+	Зашифровывается фрагмент [count]buf с номером i. Определяется 
+	имитовставка фрагмента [l / 8]tag.
+	\pre last || count == chunk_len.
+	\pre !last || count <= chunk_len.
+	\expect bashPrgChunkStart() < bashPrgChunkEncr()*.
+*/
+void bashPrgChunkEncr(
+	void* buf,				/*!< [in,out] фрагмент */
+	size_t count,			/*!< [in] длина фрагмента */
+	size_t i,				/*!< [in] номер фрагмента */
+	bool_t last,			/*!< [in] признак последнего фрагмента */
+	octet tag[],			/*!< [out] имитовставка фрагмента */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Расшифрование фрагмента
+
+	Расшифровывается фрагмент [count]buf с номером i с проверкой 
+	имитовставки [l / 8]tag.
+	\pre last || count == chunk_len.
+	\pre !last || count <= chunk_len.
+	\expect bashPrgChunkStart() < bashPrgChunkDecr()*.
+	\return Признак успеха проверки.
+	\remark При ошибке проверки буфер buf обнуляется.
+*/
+bool_t bashPrgChunkDecr(
+	void* buf,				/*!< [in,out] фрагмент */
+	size_t count,			/*!< [in] длина фрагмента */
+	size_t i,				/*!< [in] номер фрагмента */
+	bool_t last,			/*!< [in] признак последнего фрагмента */
+	const octet tag[],		/*!< [in] имитовставка фрагмента */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Выработка общей имитовставки
+
+	По имитовставкам [n * l / 8]tags фрагментов определяется общая 
+	имитовставка [l / 8]mac.
+	\expect bashPrgChunkStart() < bashPrgChunkStepG()*.
+*/
+void bashPrgChunkStepG(
+	octet mac[],			/*!< [out] общая имитовставка */
+	const octet tags[],		/*!< [in] имитовставки фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Проверка общей имитовставки
+
+	Проверяется, что общая имитовставка для имитовставок [n * l / 8]tags 
+	фрагментов совпадает с [l / 8]mac.
+	\expect bashPrgChunkStart() < bashPrgChunkStepV()*.
+	\return Признак успеха проверки.
+*/
+bool_t bashPrgChunkStepV(
+	const octet mac[],		/*!< [in] общая имитовставка */
+	const octet tags[],		/*!< [in] имитовставки фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Установка поблочной защиты
+
+	На ключе [key_len]key с анонсом [ann_len]ann устанавливается 
+	поблочная защита критических данных [count1]src1 и открытых данных 
+	[count2]src2. Критические данные разбиваются на фрагменты длины 
+	chunk_len, зашифровываются и сохраняются в буфере [count1]dest. 
+	Кроме этого определяются имитовставки фрагментов [n * l / 8]tags,
+	где n = bashPrgChunkCount(count1, chunk_len), и общая имитовставка 
+	[l / 8]mac.
+	\expect{ERR_BAD_PARAMS} l == 128 || l == 192 || l == 256, d == 1 || d == 2.
+	\expect{ERR_BAD_INPUT}
+	-	chunk_len > 0;
+	-	ann_len % 4 == 0 && ann_len <= 60;
+	-	key_len % 4 == 0 && l / 8 <= key_len <= 60;
+	-	буферы dest, tags и mac не пересекаются.
+	.
+	\return ERR_OK, если защита успешно установлена, и код ошибки
+	в противном случае.
+	\remark Фрагменты обрабатываются параллельно.
+	\remark Буфер dest может совпадать с src1.
+*/
+err_t bashPrgChunkWrap(
+	void* dest,				/*!< [out] зашифрованные критические данные */
+	octet tags[],			/*!< [out] имитовставки фрагментов */
+	octet mac[],			/*!< [out] общая имитовставка */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t d,				/*!< [in] емкость */
+	size_t chunk_len,		/*!< [in] длина фрагментов */
+	const void* src1,		/*!< [in] критические данные */
+	size_t count1,			/*!< [in] число октетов критических данных */
+	const void* src2,		/*!< [in] открытые данные */
+	size_t count2,			/*!< [in] число октетов открытых данных */
+	const octet ann[],		/*!< [in] анонс */
+	size_t ann_len,			/*!< [in] длина анонса в октетах */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
+/*!	\brief Снятие поблочной защиты
+
+	На ключе [key_len]key с анонсом [ann_len]ann снимается поблочная 
+	защита критических данных [count1]src1 и открытых данных [count2]src2
+	с проверкой имитовставок [n * l / 8]tags фрагментов, 
+	где n = bashPrgChunkCount(count1, chunk_len), и общей имитовставки 
+	[l / 8]mac. Критические данные расшифровываются и сохраняются 
+	в буфере [count1]dest.
+	\expect{ERR_BAD_PARAMS} l == 128 || l == 192 || l == 256, d == 1 || d == 2.
+	\expect{ERR_BAD_INPUT}
+	-	chunk_len > 0;
+	-	ann_len % 4 == 0 && ann_len <= 60;
+	-	key_len % 4 == 0 && l / 8 <= key_len <= 60.
+	.
+	\return ERR_OK, если защита успешно снята, ERR_BAD_MAC, если
+	не совпала общая имитовставка или имитовставка хотя бы одного 
+	фрагмента, и другой код ошибки в иных случаях.
+	\remark Общая имитовставка проверяется до расшифрования. 
+	\remark При ошибке ERR_BAD_MAC буфер dest обнуляется.
+	\remark Фрагменты обрабатываются параллельно.
+	\remark Буфер dest может совпадать с src1.
+*/
+err_t bashPrgChunkUnwrap(
+	void* dest,				/*!< [out] расшифрованные критические данные */
+	size_t l,				/*!< [in] уровень стойкости */
+	size_t d,				/*!< [in] емкость */
+	size_t chunk_len,		/*!< [in] длина фрагментов */
+	const void* src1,		/*!< [in] зашифрованные критические данные */
+	size_t count1,			/*!< [in] число октетов критических данных */
+	const void* src2,		/*!< [in] открытые данные */
+	size_t count2,			/*!< [in] число октетов открытых данных */
+	const octet tags[],		/*!< [in] имитовставки фрагментов */
+	const octet mac[],		/*!< [in] общая имитовставка */
+	const octet ann[],		/*!< [in] анонс */
+	size_t ann_len,			/*!< [in] длина анонса в октетах */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
+/*
+*******************************************************************************
+Мультихэширование (bashMD)
+
+Функции bashMDStart(), bashMDStepH(), bashMDStepG() образуют связку,
+в которой одни и те же данные передаются сразу нескольким алгоритмам
+хэширования и имитозащиты. Данные прочитываются из памяти один раз:
+каждый поступивший фрагмент разбивается на короткие порции, которые
+остаются в кэше процессора, пока обрабатываются всеми алгоритмами.
+
+Алгоритмы задаются идентификаторами:
+-	BASH_MD_BELT_HASH --- belt-hash (32 октета хэш-значения);
+-	BASH_MD_BELT_MAC --- belt-mac (8 октетов имитовставки);
+-	l, где l > 0 && l % 16 == 0 && l <= 256, --- bash уровня стойкости l
+	(l / 4 октетов хэш-значения).
+.
+*******************************************************************************
+*/
+
+#define BASH_MD_BELT_HASH	((size_t)0)
+#define BASH_MD_BELT_MAC	((size_t)1)
+
+/*!	rief Длина состояния мультихэширования
+
+	Возвращается длина состояния (в октетах) мультихэширования с помощью
+	n алгоритмов.
+	
+eturn Длина состояния.
+*/
+size_t bashMD_keep(
+	size_t n			/*!< [in] число алгоритмов */
+);
+
+/*!	rief Длина результата мультихэширования
+
+	Определяется суммарная длина (в октетах) хэш-значений и имитовставок
+	алгоритмов [n]alg.
+	
+eturn Суммарная длина или SIZE_MAX, если среди идентификаторов alg
+	есть недопустимые.
+*/
+size_t bashMDLen(
+	size_t n,				/*!< [in] число алгоритмов */
+	const size_t alg[]		/*!< [in] идентификаторы алгоритмов */
+);
+
+/*!	rief Инициализация мультихэширования
+
+	В state формируются состояния алгоритмов [n]alg. Если среди алгоритмов
+	есть belt-mac, то он использует ключ [len]key.
+	\expect{ERR_BAD_INPUT} Буферы alg, state корректны, n > 0.
+	\expect{ERR_BAD_PARAMS} Идентификаторы alg допустимы.
+	\expect{ERR_BAD_INPUT} Если среди алгоритмов есть belt-mac,
+	то len == 16 || len == 24 || len == 32 и буфер key корректен.
+	
+eturn ERR_OK, если состояние подготовлено, и код ошибки в противном
+	случае.
+	
+emark По адресу state должно быть зарезервировано bashMD_keep(n)
+	октетов.
+*/
+err_t bashMDStart(
+	void* state,			/*!< [out] состояние */
+	size_t n,				/*!< [in] число алгоритмов */
+	const size_t alg[],		/*!< [in] идентификаторы алгоритмов */
+	const octet key[],		/*!< [in] ключ belt-mac */
+	size_t len				/*!< [in] длина ключа в октетах */
+);
+
+/*!	rief Мультихэширование фрагмента данных
+
+	Фрагмент [count]buf передается всем алгоритмам state.
+	\expect bashMDStart() < bashMDStepH()*.
+	
+emark Функцию можно передавать в качестве обработчика фрагментов
+	в функции потокового чтения.
+*/
+void bashMDStepH(
+	const void* buf,		/*!< [in] данные */
+	size_t count,			/*!< [in] число октетов данных */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	rief Получение результатов мультихэширования
+
+	Определяются хэш-значения и имитовставки всех алгоритмов state.
+	Результаты записываются в hash подряд, в порядке следования
+	алгоритмов в bashMDStart(). Общая длина результатов равняется
+	bashMDLen().
+	\expect bashMDStepH()* < bashMDStepG().
+	
+emark Состояние state не изменяется: после вызова bashMDStepG()
+	можно продолжить обработку данных.
+*/
+void bashMDStepG(
+	octet hash[],			/*!< [out] хэш-значения и имитовставки */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	rief Мультихэширование
+
+	Буфер [count]src обрабатывается алгоритмами [n]alg (belt-mac ---
+	на ключе [len]key). Хэш-значения и имитовставки записываются
+	в [bashMDLen(n, alg)]hash подряд, в порядке следования алгоритмов.
+	\expect{ERR_BAD_INPUT} Буферы alg, hash, src корректны, n > 0.
+	\expect{ERR_BAD_PARAMS} Идентификаторы alg допустимы.
+	\expect{ERR_BAD_INPUT} Если среди алгоритмов есть belt-mac,
+	то len == 16 || len == 24 || len == 32 и буфер key корректен.
+	
+eturn ERR_OK, если хэширование завершено успешно, и код ошибки
+	в противном случае.
+*/
+err_t bashMD(
+	octet hash[],			/*!< [out] хэш-значения и имитовставки */
+	size_t n,				/*!< [in] число алгоритмов */
+	const size_t alg[],		/*!< [in] идентификаторы алгоритмов */
+	const octet key[],		/*!< [in] ключ belt-mac */
+	size_t len,				/*!< [in] длина ключа в октетах */
+	const void* src,		/*!< [in] данные */
+	size_t count			/*!< [in] число октетов данных */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief STB 34.101.60 (bels): secret sharing algorithms
 \project bee2 [cryptographic library]
 \created 2013.05.14
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -325,6 +325,156 @@ err_t belsRecover2(
 	const octet si[]		/*!< [in] частичные секреты */
 );
 
+/*!	\brief Длина состояния восстановления на фиксированных номерах
+
+	Возвращается длина состояния (в октетах) функций восстановления
+	секрета длины len по count частичным секретам на стандартных
+	открытых ключах с фиксированными номерами.
+	\remark Состояние содержит план восстановления: count матриц
+	из 8 * len строк по len октетов (с выравниванием на границу слова).
+	Поэтому длина состояния растет как count * 8 * len^2.
+	\pre len == 16 || len == 24 || len == 32.
+	\pre 0 < count <= 16.
+	\return Длина состояния.
+*/
+size_t belsRecover2_keep(
+	size_t count,			/*!< [in] число пользователей */
+	size_t len				/*!< [in] длина секретов в октетах */
+);
+
+/*!	\brief Инициализация восстановления на фиксированных номерах
+
+	По номерам [count]ids стандартных открытых ключей, которые используются
+	при восстановлении секрета длины len, в state формируется план
+	восстановления. Секрет линейно (над F_2) зависит от частичных секретов,
+	и план состоит из матриц этой зависимости. Матрицы строятся по
+	интерполяционным коэффициентам китайской теоремы об остатках.
+	\expect{ERR_BAD_INPUT} len == 16 || len == 24 || len == 32.
+	\expect{ERR_BAD_INPUT} 0 < count <= 16.
+	\expect{ERR_BAD_PUBKEY} Номера ids принадлежат интервалу
+	{1, 2, ..., 16} и отличаются друг от друга.
+	\return ERR_OK, если состояние успешно сформировано, и код ошибки
+	в противном случае.
+	\remark План строится однократно и затем используется при каждом
+	вызове belsRecover2StepR(), belsRecover2StepRS(). Восстановление
+	сводится к сложению строк матриц, которые соответствуют ненулевым
+	битам частичных секретов. Это выгодно при многократном восстановлении
+	секретов по частичным секретам одних и тех же пользователей.
+*/
+err_t belsRecover2Start(
+	void* state,			/*!< [out] состояние */
+	size_t count,			/*!< [in] число пользователей */
+	size_t len,				/*!< [in] длина секретов в октетах */
+	const octet ids[]		/*!< [in] номера открытых ключей */
+);
+
+/*!	\brief Восстановление на фиксированных номерах
+
+	Секрет [len]s восстанавливается по count частичным секретам из массива
+	si с использованием данных state. Частичные секреты размещаются в si
+	так же, как в функции belsRecover2(). Параметры count и len, а также
+	номера открытых ключей, определены при вызове belsRecover2Start().
+	\expect belsRecover2Start() < belsRecover2StepR().
+	\expect{ERR_BAD_PUBKEY} Номера открытых ключей, указанные в первых
+	октетах частичных секретов, совпадают с номерами ids, переданными
+	в belsRecover2Start(), и следуют в том же порядке.
+	\return ERR_OK, если секрет успешно восстановлен, и код ошибки
+	в противном случае.
+	\remark Результат совпадает с результатом belsRecover2().
+	\remark Время восстановления не зависит от частичных секретов.
+*/
+err_t belsRecover2StepR(
+	octet s[],				/*!< [out] восстановленный секрет */
+	const octet si[],		/*!< [in] частичные секреты */
+	void* state				/*!< [in/out] состояние */
+);
+
+/*!	\brief Восстановление потока на фиксированных номерах
+
+	Данные [s_len]s восстанавливаются по count потокам частичных секретов
+	[s_len]si[0], [s_len]si[1],..., [s_len]si[count - 1] с использованием
+	данных state. Потоки si[i] строятся функцией belsShare2StreamStepS()
+	для пользователя с номером ids[i], заданным в belsRecover2Start().
+	Данные восстанавливаются поблочно, длина блока -- len октетов.
+	\expect belsRecover2Start() < belsRecover2StepRS().
+	\expect{ERR_BAD_INPUT} s_len делится на len.
+	\return ERR_OK, если данные успешно восстановлены, и код ошибки
+	в противном случае.
+*/
+err_t belsRecover2StepRS(
+	octet s[],				/*!< [out] восстановленные данные */
+	size_t s_len,			/*!< [in] длина данных в октетах */
+	const octet* const si[],/*!< [in] потоки частичных секретов */
+	void* state				/*!< [in/out] состояние */
+);
+
+/*
+*******************************************************************************
+Потоковое разделение
+*******************************************************************************
+*/
+
+/*!	\brief Длина состояния потокового разделения
+
+	Возвращается длина состояния (в октетах) функций потокового разделения
+	данных на count потоков частичных секретов с порогом threshold
+	и длиной блока len.
+	\pre len == 16 || len == 24 || len == 32.
+	\pre 0 < threshold <= count <= 16.
+	\return Длина состояния.
+*/
+size_t belsShare2Stream_keep(
+	size_t count,			/*!< [in] число пользователей */
+	size_t threshold,		/*!< [in] пороговое число */
+	size_t len				/*!< [in] длина блока в октетах */
+);
+
+/*!	\brief Инициализация потокового разделения
+
+	В state формируются данные, необходимые для потокового разделения
+	данных на count потоков частичных секретов с порогом threshold.
+	Данные разделяются поблочно, длина блока -- len октетов. Каждый блок
+	разделяется на стандартных открытых ключах так же, как в belsShare2().
+	Одноразовые ключи блоков берутся из ключевого потока belt-ctr, ключ
+	и синхропосылка которого вырабатываются генератором rng.
+	\expect{ERR_BAD_INPUT} len == 16 || len == 24 || len == 32.
+	\expect{ERR_BAD_INPUT} 0 < threshold <= count <= 16.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\return ERR_OK, если состояние успешно сформировано, и код ошибки
+	в противном случае.
+	\remark Генератор rng вызывается однократно, а не для каждого блока.
+	При этом стойкость разделения определяется стойкостью belt-ctr.
+*/
+err_t belsShare2StreamStart(
+	void* state,			/*!< [out] состояние */
+	size_t count,			/*!< [in] число пользователей */
+	size_t threshold,		/*!< [in] пороговое число */
+	size_t len,				/*!< [in] длина блока в октетах */
+	gen_i rng,				/*!< [in] генератор случайных чисел */
+	void* rng_state			/*!< [in/out] состояние генератора */
+);
+
+/*!	\brief Потоковое разделение
+
+	Фрагмент [s_len]s разделяемых данных разделяется на count фрагментов
+	[s_len]si[0], [s_len]si[1],..., [s_len]si[count - 1] потоков частичных
+	секретов. Поток si[i] предназначен для пользователя, открытый ключ
+	которого -- belsStdM(m, len, i + 1). Длинные данные могут разделяться
+	при нескольких последовательных обращениях к функции.
+	\expect belsShare2StreamStart() < belsShare2StreamStepS()*.
+	\expect{ERR_BAD_INPUT} s_len делится на len.
+	\return ERR_OK, если фрагмент успешно разделен, и код ошибки
+	в противном случае.
+	\remark Неполный последний блок данных следует дополнить, например,
+	нулями, а длину данных сохранить отдельно.
+*/
+err_t belsShare2StreamStepS(
+	octet* const si[],		/*!< [out] потоки частичных секретов */
+	const octet s[],		/*!< [in] фрагмент данных */
+	size_t s_len,			/*!< [in] длина фрагмента в октетах */
+	void* state				/*!< [in/out] состояние */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): data encryption and integrity algorithms
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -95,6 +95,11 @@ ZZ_mod = {0, 1,..., mod - 1}. Здесь mod -- размер алфавита и
 
 Состояние можно копировать как фрагмент памяти.
 
+Состояние рекомендуется выравнивать на границу MEM_ALIGN (см. mem.h),
+например, объявлять буфер для него с помощью макроса MEM_ALIGNED.
+В выровненном состоянии блоки данных выровнены на границу 16 байт.
+Невыровненное состояние также допускается.
+
 В связке обязательно имеется функция инициализации механизма (Start)
 и одна или несколько функций обработки фрагментов данных и получения
 результатов обработки (StepX).
@@ -177,6 +182,33 @@ void beltKeyExpand2(
 	size_t len			/*!< [in] длина ключа в октетах */
 );
 
+/*!	\brief Длина объекта ключа
+
+	Возвращается длина (в октетах) объекта ключа.
+	\return Длина объекта.
+*/
+size_t beltKey_keep();
+
+/*!	\brief Инициализация объекта ключа
+
+	По ключу [len]key в state формируется объект ключа: ключ расширяется
+	и форматируется однократно. Объект передается функциям
+	beltECBStartK(), beltCBCStartK(), beltCFBStartK(), beltCTRStartK(),
+	beltMACStartK(), beltDWPStartK(), beltCHEStartK().
+	\pre len == 16 || len == 24 || len == 32.
+	\pre По адресу state зарезервировано beltKey_keep() октетов.
+	\remark Состояния, инициализированные функциями beltXXXStartK(),
+	не копируют ключ, а ссылаются на объект state. Объект должен
+	существовать и не изменяться, пока используются эти состояния.
+	\remark После инициализации объект только читается. Его можно
+	одновременно использовать в нескольких потоках.
+*/
+void beltKeyStart(
+	void* state,		/*!< [out] объект ключа */
+	const octet key[],	/*!< [in] ключ */
+	size_t len			/*!< [in] длина ключа в октетах */
+);
+
 
 /*
 *******************************************************************************
@@ -254,6 +286,70 @@ void beltBlockDecr3(
 	const u32 key[8]	/*!< [in] ключ */
 );
 
+/*!	\brief Зашифрование нескольких блоков
+
+	Выполняется зашифрование count блоков данных [16 * count]blocks 
+	на форматированном ключе key. Результат зашифрования возвращается 
+	по адресу blocks.
+	\remark Блоки зашифровываются независимо друг от друга. Четверки блоков
+	обрабатываются одновременно, с перемежением тактовых вычислений.
+	\remark На платформах с поддержкой AVX512VBMI пакеты из 16 блоков
+	обрабатываются одновременно в регистрах AVX512.
+*/
+void beltBlockEncrN(
+	octet blocks[],			/*!< [in,out] блоки */
+	size_t count,			/*!< [in] число блоков */
+	const u32 key[8]		/*!< [in] ключ */
+);
+
+/*!	\brief Расшифрование нескольких блоков
+
+	Выполняется расшифрование count блоков данных [16 * count]blocks 
+	на форматированном ключе key. Результат расшифрования возвращается 
+	по адресу blocks.
+	\remark Блоки расшифровываются независимо друг от друга. Четверки блоков
+	обрабатываются одновременно, с перемежением тактовых вычислений.
+	\remark На платформах с поддержкой AVX512VBMI пакеты из 16 блоков
+	обрабатываются одновременно в регистрах AVX512.
+*/
+void beltBlockDecrN(
+	octet blocks[],			/*!< [in,out] блоки */
+	size_t count,			/*!< [in] число блоков */
+	const u32 key[8]		/*!< [in] ключ */
+);
+
+/*!	\brief Выбор реализации belt-block
+
+	Включается (ct == TRUE) или выключается (ct == FALSE) реализация
+	belt-block без табличных подстановок. В этой реализации отсутствуют
+	обращения к памяти по адресам, которые зависят от ключа или данных.
+	\return Признак того, что реализация без таблиц включена.
+	\remark Реализация без таблиц использует инструкции SSSE3. Если эти
+	инструкции не поддерживаются, то сохраняется табличная реализация
+	и возвращается FALSE.
+	\remark Реализация без таблиц медленнее табличной и включается только
+	по запросу. На инструкциях SSSE3 режимы со сцеплением блоков (CBC, MAC,
+	hash) замедляются примерно в 4 раза. При поддержке AVX512VBMI
+	замедление этих режимов сокращается до 1.5 раз, а пакеты из 16 и более
+	блоков (ECB, CTR) обрабатываются со скоростью табличной реализации.
+	\remark Выбор распространяется на все функции belt-block и на все
+	алгоритмы belt, которые эти функции используют.
+	\remark Реализацию следует выбирать до обращения к алгоритмам belt
+	из нескольких потоков.
+*/
+bool_t beltBlockCT(
+	bool_t ct			/*!< [in] признак реализации без таблиц */
+);
+
+/*!	\brief Реализация belt-block
+
+	Возвращается имя действующей реализации belt-block: "BELT_TABLE"
+	(табличная), "BELT_SSSE3" или "BELT_AVX512" (без таблиц,
+	см. beltBlockCT()).
+	\return Имя реализации.
+*/
+const char* beltPlatform();
+
 /*
 *******************************************************************************
 Шифрование широкого блока (belt-wbl, WBL)
@@ -345,6 +441,45 @@ void beltWBLStepR(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Зашифрование нескольких широких блоков в режиме WBL
+
+	Буферы [count](buf + count * i), i = 0, 1,..., n - 1, зашифровываются
+	на ключе, размещенном в state. Результаты зашифрования сохраняются
+	на месте буферов.
+	\pre count >= 32.
+	\expect beltWBLStart() < beltWBLStepEMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltWBLStepE(). Блоки разных буферов, которые зашифровываются
+	на одном такте, обрабатываются одновременно.
+	\remark Состояние state не изменяется и может одновременно
+	использоваться в нескольких потоках.
+*/
+void beltWBLStepEMulti(
+	void* buf,			/*!< [in,out] открытые тексты / шифртексты */
+	size_t count,		/*!< [in] число октетов каждого текста */
+	size_t n,			/*!< [in] число текстов */
+	void* state			/*!< [in] состояние */
+);
+
+/*!	\brief Расшифрование нескольких широких блоков в режиме WBL
+
+	Буферы [count](buf + count * i), i = 0, 1,..., n - 1, расшифровываются
+	на ключе, размещенном в state. Результаты расшифрования сохраняются
+	на месте буферов.
+	\pre count >= 32.
+	\expect beltWBLStart() < beltWBLStepDMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltWBLStepD().
+	\remark Состояние state не изменяется и может одновременно
+	использоваться в нескольких потоках.
+*/
+void beltWBLStepDMulti(
+	void* buf,			/*!< [in,out] шифртексты / открытые тексты */
+	size_t count,		/*!< [in] число октетов каждого текста */
+	size_t n,			/*!< [in] число текстов */
+	void* state			/*!< [in] состояние */
+);
+
 /*
 *******************************************************************************
 Сжатие (belt-compress)
@@ -412,6 +547,19 @@ void beltECBStart(
 	size_t len				/*!< [in] длина ключа в октетах */
 );
 
+/*!	\brief Инициализация функций ECB с объектом ключа
+
+	Действует аналогично beltECBStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltECB_keep() октетов.
+	\expect beltKeyStart(key) < beltECBStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltECBStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key			/*!< [in] объект ключа */
+);
+
 /*!	\brief Зашифрование фрагмента в режиме ECB
 
 	Буфер [count]buf зашифровывается в режиме ECB на ключе, размещенном 
@@ -512,6 +660,20 @@ void beltCBCStart(
 	const octet iv[16]		/*!< [in] синхропосылка */
 );
 
+/*!	\brief Инициализация шифрования в режиме CBC с объектом ключа
+
+	Действует аналогично beltCBCStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltCBC_keep() октетов.
+	\expect beltKeyStart(key) < beltCBCStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltCBCStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key,		/*!< [in] объект ключа */
+	const octet iv[16]		/*!< [in] синхропосылка */
+);
+
 /*!	\brief Зашифрование в режиме CBC
 
 	Буфер [count]buf зашифровывается в режиме CBC на ключе, размещенном 
@@ -546,6 +708,24 @@ void beltCBCStepD(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Параллельное расшифрование в режиме CBC
+
+	Буфер [count]buf расшифровывается в режиме CBC на ключе, размещенном
+	в state. Длинный буфер разбивается на участки, которые
+	расшифровываются одновременно в нескольких потоках.
+	\pre count >= 16.
+	\expect beltCBCStart() < beltCBCStepDMulti()*.
+	\remark Результат и итоговое состояние совпадают с результатом
+	и состоянием beltCBCStepD(buf, count, state).
+	\remark Потоки создаются, если длина буфера не меньше 256 Кбайт.
+	Число потоков не превосходит число процессоров и 16.
+*/
+void beltCBCStepDMulti(
+	void* buf,			/*!< [in,out] шифртекст / открытый текст */
+	size_t count,		/*!< [in] число октетов текста */
+	void* state			/*!< [in,out] состояние */
+);
+
 /*!	\brief Зашифрование в режиме CBC
 
 	Буфер [count]src зашифровывается на ключе [len]key с использованием 
@@ -616,6 +796,20 @@ void beltCFBStart(
 	const octet iv[16]		/*!< [in] синхропосылка */
 );
 
+/*!	\brief Инициализация шифрования в режиме CFB с объектом ключа
+
+	Действует аналогично beltCFBStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltCFB_keep() октетов.
+	\expect beltKeyStart(key) < beltCFBStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltCFBStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key,		/*!< [in] объект ключа */
+	const octet iv[16]		/*!< [in] синхропосылка */
+);
+
 /*!	\brief Зашифрование в режиме CFB
 
 	Буфер [count]buf зашифровывается в режиме CFB на ключе, размещенном 
@@ -640,6 +834,24 @@ void beltCFBStepD(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Параллельное расшифрование в режиме CFB
+
+	Буфер [count]buf расшифровывается в режиме CFB на ключе, размещенном
+	в state. Длинный буфер разбивается на участки, которые
+	расшифровываются одновременно в нескольких потоках.
+	\expect beltCFBStart() < beltCFBStepDMulti()*.
+	\remark Результат и итоговое состояние совпадают с результатом
+	и состоянием beltCFBStepD(buf, count, state). Вызовы beltCFBStepD()
+	и beltCFBStepDMulti() можно чередовать.
+	\remark Потоки создаются, если длина буфера не меньше 256 Кбайт.
+	Число потоков не превосходит число процессоров и 16.
+*/
+void beltCFBStepDMulti(
+	void* buf,			/*!< [in,out] шифртекст / открытый текст */
+	size_t count,		/*!< [in] число октетов текста */
+	void* state			/*!< [in,out] состояние */
+);
+
 /*!	\brief Зашифрование в режиме CFB
 
 	Буфер [count]src зашифровывается на ключе [len]key с использованием 
@@ -704,6 +916,20 @@ void beltCTRStart(
 	const octet iv[16]		/*!< [in] синхропосылка */
 );
 
+/*!	\brief Инициализация шифрования в режиме CTR с объектом ключа
+
+	Действует аналогично beltCTRStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltCTR_keep() октетов.
+	\expect beltKeyStart(key) < beltCTRStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltCTRStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key,		/*!< [in] объект ключа */
+	const octet iv[16]		/*!< [in] синхропосылка */
+);
+
 /*!	\brief Зашифрование фрагмента в режиме CTR
 
 	Буфер [count]buf зашифровывается в режиме CTR на ключе, размещенном 
@@ -721,6 +947,44 @@ void beltCTRStepE(
 */
 #define beltCTRStepD beltCTRStepE
 
+/*!	\brief Позиционирование в режиме CTR
+
+	Состояние state настраивается так, что очередной вызов beltCTRStepE()
+	обработает фрагмент текста, начинающийся с октета с номером offset
+	(нумерация от 0 с момента вызова beltCTRStart()).
+	\expect beltCTRStart() < beltCTRSeek().
+	\remark Время позиционирования не зависит от offset. Чтение фрагмента
+	[count](X + offset) шифртекста X сводится к вызовам
+	beltCTRSeek(state, offset) и beltCTRStepD(buf, count, state).
+*/
+void beltCTRSeek(
+	void* state,		/*!< [in,out] состояние */
+	size_t offset		/*!< [in] номер октета */
+);
+
+/*!	\brief Параллельное зашифрование фрагмента в режиме CTR
+
+	Буфер [count]buf зашифровывается в режиме CTR на ключе, размещенном
+	в state. Длинный буфер разбивается на участки, которые зашифровываются
+	одновременно в нескольких потоках.
+	\expect beltCTRStart() < beltCTRStepEMulti()*.
+	\remark Результат и итоговое состояние совпадают с результатом
+	и состоянием beltCTRStepE(buf, count, state). Вызовы beltCTRStepE()
+	и beltCTRStepEMulti() можно чередовать.
+	\remark Потоки создаются, если длина буфера не меньше 256 Кбайт.
+	Число потоков не превосходит число процессоров и 16.
+*/
+void beltCTRStepEMulti(
+	void* buf,			/*!< [in,out] открытый текст / шифртекст */
+	size_t count,		/*!< [in] число октетов текста */
+	void* state			/*!< [in,out] состояние */
+);
+
+/*!	\brief Параллельное расшифрование фрагмента в режиме CTR
+	\remark Зашифрование в режиме CTR не отличается от расшифрования.
+*/
+#define beltCTRStepDMulti beltCTRStepEMulti
+
 /*!	\brief Шифрование в режиме CTR
 
 	Буфер [count]src зашифровывается или расшифровывается на ключе
@@ -767,6 +1031,19 @@ void beltMACStart(
 	size_t len				/*!< [in] длина ключа в октетах */
 );
 
+/*!	\brief Инициализация функций MAC с объектом ключа
+
+	Действует аналогично beltMACStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltMAC_keep() октетов.
+	\expect beltKeyStart(key) < beltMACStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltMACStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key			/*!< [in] объект ключа */
+);
+
 /*!	\brief Имитозащита фрагмента данных в режиме MAC
 
 	Текущая имитовставка, размещенная в state, пересчитывается с учетом нового
@@ -780,6 +1057,20 @@ void beltMACStepA(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Имитозащита списка фрагментов
+
+	Выполняются последовательные вызовы beltMACStepA(vec[i].buf,
+	vec[i].count, state), i = 0, 1,..., n - 1.
+	\remark Данные фрагментов не копируются во вспомогательный буфер.
+	Неполные блоки на стыках фрагментов накапливаются в state, полные
+	блоки обрабатываются непосредственно в фрагментах.
+*/
+void beltMACStepAv(
+	const mem_vec_t vec[],	/*!< [in] список фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Определение имитовставки в режиме MAC
 
 	Определяется окончательная имитовставка mac всех данных,
@@ -851,6 +1142,30 @@ err_t beltMAC(
 	size_t len				/*!< [in] длина ключа */
 );
 
+/*!	\brief Имитозащита нескольких сообщений
+
+	На ключах [len]key[i] определяются имитовставки [8](mac + 8 * i)
+	буферов [count[i]]src[i], i = 0, 1,..., n - 1.
+	\expect{ERR_BAD_INPUT} len == 16 || len == 24 || len == 32.
+	\expect{ERR_BAD_INPUT} Буферы mac, src, count, key, src[i], key[i]
+	корректны.
+	\return ERR_OK, если имитовставки успешно вычислены, и код ошибки
+	в противном случае.
+	\remark Сообщения обрабатываются четверками: цепочки зашифрований
+	четырех сообщений выполняются одновременно с помощью четырехключевого
+	варианта belt-block. Ключи key[i] могут совпадать. Ускорение по сравнению
+	с последовательными вызовами beltMAC() максимально, если сообщения
+	четверки имеют близкие длины.
+*/
+err_t beltMACMulti(
+	octet mac[],			/*!< [out] имитовставки */
+	size_t n,				/*!< [in] число сообщений */
+	const void* src[],		/*!< [in] сообщения */
+	const size_t count[],	/*!< [in] длины сообщений */
+	const octet* key[],		/*!< [in] ключи */
+	size_t len				/*!< [in] длина ключей */
+);
+
 /*
 *******************************************************************************
 Аутентифицированное шифрование по схеме DWP (belt-dwp, DWP)
@@ -880,6 +1195,20 @@ void beltDWPStart(
 	const octet iv[16]		/*!< [in] синхропосылка */
 );
 
+/*!	\brief Инициализация функций DWP с объектом ключа
+
+	Действует аналогично beltDWPStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltDWP_keep() октетов.
+	\expect beltKeyStart(key) < beltDWPStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltDWPStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key,		/*!< [in] объект ключа */
+	const octet iv[16]		/*!< [in] синхропосылка */
+);
+
 /*!	\brief Зашифрование критического фрагмента в режиме DWP
 
 	Фрагмент критических данных [count]buf зашифровывается на ключе,
@@ -905,6 +1234,20 @@ void beltDWPStepI(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Имитозащита списка открытых фрагментов
+
+	Выполняются последовательные вызовы beltDWPStepI(vec[i].buf,
+	vec[i].count, state), i = 0, 1,..., n - 1.
+	\remark Данные фрагментов не копируются во вспомогательный буфер.
+	Неполные блоки на стыках фрагментов накапливаются в state, полные
+	блоки обрабатываются непосредственно в фрагментах.
+*/
+void beltDWPStepIv(
+	const mem_vec_t vec[],	/*!< [in] список фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Имитозащита критического фрагмента в режиме DWP
 
 	Текущая имитовставка, размещенная в state, пересчитывается с учетом нового
@@ -920,6 +1263,36 @@ void beltDWPStepA(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Имитозащита списка критических фрагментов
+
+	Выполняются последовательные вызовы beltDWPStepA(vec[i].buf,
+	vec[i].count, state), i = 0, 1,..., n - 1.
+	\remark Данные фрагментов не копируются во вспомогательный буфер.
+	Неполные блоки на стыках фрагментов накапливаются в state, полные
+	блоки обрабатываются непосредственно в фрагментах.
+*/
+void beltDWPStepAv(
+	const mem_vec_t vec[],	/*!< [in] список фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Зашифрование и имитозащита критического фрагмента в режиме DWP
+
+	Фрагмент критических данных [count]buf зашифровывается на ключе,
+	размещенном в state, и текущая имитовставка пересчитывается с учетом
+	зашифрованного фрагмента. Результат зашифрования сохраняется в buf.
+	\expect beltDWPStepI()* < beltDWPStepEA()*.
+	\remark Вызов beltDWPStepEA(buf, count, state) эквивалентен вызовам
+	beltDWPStepE(buf, count, state), beltDWPStepA(buf, count, state), но буфер
+	просматривается один раз.
+*/
+void beltDWPStepEA(
+	void* buf,			/*!< [in,out] критические данные */
+	size_t count,		/*!< [in] число октетов данных */
+	void* state			/*!< [in,out] состояние */
+);
+
 /*!	\brief Определение имитовставки в режиме DWP
 
 	Определяется окончательная имитовставка mac всех данных,
@@ -1045,6 +1418,20 @@ void beltCHEStart(
 	const octet iv[16]		/*!< [in] синхропосылка */
 );
 
+/*!	\brief Инициализация функций CHE с объектом ключа
+
+	Действует аналогично beltCHEStart(), но ключ не расширяется, а берется
+	из объекта key, подготовленного функцией beltKeyStart().
+	\pre По адресу state зарезервировано beltCHE_keep() октетов.
+	\expect beltKeyStart(key) < beltCHEStartK().
+	\remark Объект key должен существовать, пока используется state.
+*/
+void beltCHEStartK(
+	void* state,			/*!< [out] состояние */
+	const void* key,		/*!< [in] объект ключа */
+	const octet iv[16]		/*!< [in] синхропосылка */
+);
+
 /*!	\brief Зашифрование критического фрагмента в режиме CHE
 
 	Фрагмент критических данных [count]buf зашифровывается на ключе,
@@ -1085,6 +1472,22 @@ void beltCHEStepA(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Зашифрование и имитозащита критического фрагмента в режиме CHE
+
+	Фрагмент критических данных [count]buf зашифровывается на ключе,
+	размещенном в state, и текущая имитовставка пересчитывается с учетом
+	зашифрованного фрагмента. Результат зашифрования сохраняется в buf.
+	\expect beltCHEStepI()* < beltCHEStepEA()*.
+	\remark Вызов beltCHEStepEA(buf, count, state) эквивалентен вызовам
+	beltCHEStepE(buf, count, state), beltCHEStepA(buf, count, state), но буфер
+	просматривается один раз.
+*/
+void beltCHEStepEA(
+	void* buf,			/*!< [in,out] критические данные */
+	size_t count,		/*!< [in] число октетов данных */
+	void* state			/*!< [in,out] состояние */
+);
+
 /*!	\brief Определение имитовставки в режиме CHE
 
 	Определяется окончательная имитовставка mac всех данных,
@@ -1196,6 +1599,8 @@ err_t beltCHEUnwrap(
 #define beltKWPStepE beltWBLStepE
 #define beltKWPStepD beltWBLStepD
 #define beltKWPStepD2 beltWBLStepD2
+#define beltKWPStepEMulti beltWBLStepEMulti
+#define beltKWPStepDMulti beltWBLStepDMulti
 /*!	@} */
 
 
@@ -1242,6 +1647,44 @@ err_t beltKWPUnwrap(
 	size_t len				/*!< [in] длина key в октетах */
 );
 
+/*!	\brief Перезащита нескольких ключей в режиме KWP
+
+	С защищенных ключей [count](src + count * i), i = 0, 1,..., n - 1,
+	снимается защита на ключе [len_old]key_old. Затем на ключ с тем же
+	заголовком устанавливается защита на ключе [len_new]key_new.
+	Результат перезащиты i-го ключа размещается в [count](dest + count * i).
+	Заголовок i-го ключа должен совпадать с [16](header + 16 * i).
+	\expect{ERR_BAD_INPUT}
+	-	len_old == 16 || len_old == 24 || len_old == 32;
+	-	len_new == 16 || len_new == 24 || len_new == 32;
+	-	count >= 32.
+	.
+	\return ERR_OK, если все ключи успешно перезащищены, ERR_BAD_KEYTOKEN,
+	если защиту некоторых ключей снять не удалось, и другой код ошибки
+	в иных случаях.
+	\remark При ошибке ERR_BAD_KEYTOKEN перезащищаются все остальные
+	ключи, а буферы [count](dest + count * i) ключей, защиту которых
+	снять не удалось, обнуляются.
+	\remark При нулевом указателе header для всех ключей используется
+	нулевой заголовок.
+	\remark Ключи key_old и key_new расширяются однократно. Ключи
+	обрабатываются группами с помощью beltWBLStepDMulti()
+	и beltWBLStepEMulti(), большие пакеты дополнительно разбиваются на
+	участки, которые обрабатываются в нескольких потоках.
+	\remark Буферы src и dest могут совпадать.
+*/
+err_t beltKWPRewrapMulti(
+	octet dest[],			/*!< [out] перезащищенные ключи */
+	const octet src[],		/*!< [in] защищенные ключи */
+	size_t count,			/*!< [in] длина каждого защищенного ключа */
+	size_t n,				/*!< [in] число ключей */
+	const octet header[],	/*!< [in] заголовки ключей */
+	const octet key_old[],	/*!< [in] прежний ключ защиты */
+	size_t len_old,			/*!< [in] длина key_old в октетах */
+	const octet key_new[],	/*!< [in] новый ключ защиты */
+	size_t len_new			/*!< [in] длина key_new в октетах */
+);
+
 /*
 *******************************************************************************
 Хэширование (belt-hash, Hash)
@@ -1276,6 +1719,20 @@ void beltHashStepH(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Хэширование списка фрагментов
+
+	Выполняются последовательные вызовы beltHashStepH(vec[i].buf,
+	vec[i].count, state), i = 0, 1,..., n - 1.
+	\remark Данные фрагментов не копируются во вспомогательный буфер.
+	Неполные блоки на стыках фрагментов накапливаются в state, полные
+	блоки обрабатываются непосредственно в фрагментах.
+*/
+void beltHashStepHv(
+	const mem_vec_t vec[],	/*!< [in] список фрагментов */
+	size_t n,				/*!< [in] число фрагментов */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Определение хэш-значения
 
 	Определяется окончательное хэш-значение hash всех данных,
@@ -1331,6 +1788,35 @@ bool_t beltHashStepV2(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Сохранение состояния хэширования
+
+	Состояние хэширования state сохраняется в буфере buf в формате,
+	который не зависит от платформы и включает идентификатор и версию.
+	Сохраненное состояние можно восстановить функцией beltHashLoad()
+	и продолжить хэширование.
+	\expect beltHashStart() < beltHashSave().
+	\remark Сохраненное состояние содержит последние обработанные данные.
+*/
+void beltHashSave(
+	octet buf[99],		/*!< [out] сохраненное состояние */
+	const void* state	/*!< [in] состояние */
+);
+
+/*!	\brief Восстановление состояния хэширования
+
+	Состояние хэширования state восстанавливается по буферу buf,
+	подготовленному функцией beltHashSave().
+	\expect{ERR_BAD_INPUT} Буферы buf и state корректны.
+	\return ERR_OK, если состояние восстановлено, ERR_BAD_FORMAT, если
+	формат buf не распознан, и код ошибки в других случаях.
+	\remark По адресу state должно быть зарезервировано beltHash_keep()
+	октетов.
+*/
+err_t beltHashLoad(
+	void* state,			/*!< [out] состояние */
+	const octet buf[99]		/*!< [in] сохраненное состояние */
+);
+
 /*!	\brief Хэширование
 
 	Определяется хэш-значение hash буфера [count]src.
@@ -1344,6 +1830,25 @@ err_t beltHash(
 	size_t count		/*!< [in] число октетов данных */
 );
 
+/*!	\brief Хэширование нескольких сообщений
+
+	Определяются хэш-значения [32](hash + 32 * i) буферов [count[i]]src[i],
+	i = 0, 1,..., n - 1.
+	\expect{ERR_BAD_INPUT} Буферы hash, src, count, src[i] корректны.
+	\return ERR_OK, если хэширование завершено успешно, и код ошибки
+	в противном случае.
+	\remark Сообщения обрабатываются четверками: цепочки сжатий четырех
+	сообщений выполняются одновременно, с перемежением зашифрований
+	belt-block. Ускорение по сравнению с последовательными вызовами
+	beltHash() максимально, если сообщения четверки имеют близкие длины.
+*/
+err_t beltHashMulti(
+	octet hash[],			/*!< [out] хэш-значения */
+	size_t n,				/*!< [in] число сообщений */
+	const void* src[],		/*!< [in] сообщения */
+	const size_t count[]	/*!< [in] длины сообщений */
+);
+
 /*
 *******************************************************************************
 Блоковое дисковое шифрование (belt-bde, BDE)
@@ -1398,6 +1903,56 @@ void beltBDEStepD(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Параллельное зашифрование нескольких секторов в режиме BDE
+
+	Секторы [size](buf + size * i), i = 0, 1,..., n - 1, зашифровываются
+	в режиме BDE на ключе, размещенном в state. Синхропосылкой сектора i
+	служит iv + i: iv интерпретируется как 128-битовое число (первый октет
+	-- младший), сложение выполняется по модулю 2^128.
+	\pre size % 16 == 0 && size >= 16.
+	\expect beltBDEStart() < beltBDEStepEMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltBDEStart(state1, key, len, iv + i) и beltBDEStepE(buf + size * i,
+	size, state1). Маскированные блоки сектора зашифровываются
+	одновременно с помощью beltBlockEncrN().
+	Состояние state не меняется.
+	\remark Секторы обрабатываются в нескольких потоках, если их общая
+	длина не меньше 256 Кбайт. Число потоков не превосходит число
+	процессоров и 16.
+*/
+void beltBDEStepEMulti(
+	void* buf,			/*!< [in,out] открытый текст / шифртекст */
+	size_t size,		/*!< [in] длина сектора в октетах */
+	size_t n,			/*!< [in] число секторов */
+	const octet iv[16],	/*!< [in] синхропосылка первого сектора */
+	const void* state	/*!< [in] состояние */
+);
+
+/*!	\brief Параллельное расшифрование нескольких секторов в режиме BDE
+
+	Секторы [size](buf + size * i), i = 0, 1,..., n - 1, расшифровываются
+	в режиме BDE на ключе, размещенном в state. Синхропосылкой сектора i
+	служит iv + i: iv интерпретируется как 128-битовое число (первый октет
+	-- младший), сложение выполняется по модулю 2^128.
+	\pre size % 16 == 0 && size >= 16.
+	\expect beltBDEStart() < beltBDEStepDMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltBDEStart(state1, key, len, iv + i) и beltBDEStepD(buf + size * i,
+	size, state1). Маскированные блоки сектора расшифровываются
+	одновременно с помощью beltBlockDecrN().
+	Состояние state не меняется.
+	\remark Секторы обрабатываются в нескольких потоках, если их общая
+	длина не меньше 256 Кбайт. Число потоков не превосходит число
+	процессоров и 16.
+*/
+void beltBDEStepDMulti(
+	void* buf,			/*!< [in,out] шифртекст / открытый текст */
+	size_t size,		/*!< [in] длина сектора в октетах */
+	size_t n,			/*!< [in] число секторов */
+	const octet iv[16],	/*!< [in] синхропосылка первого сектора */
+	const void* state	/*!< [in] состояние */
+);
+
 /*!	\brief Зашифрование в режиме BDE
 
 	Буфер [count]src зашифровывается на ключе [len]key с использованием 
@@ -1495,6 +2050,52 @@ void beltSDEStepD(
 	void* state			/*!< [in,out] состояние */
 );
 
+/*!	\brief Параллельное зашифрование нескольких секторов в режиме SDE
+
+	Секторы [size](buf + size * i), i = 0, 1,..., n - 1, зашифровываются
+	в режиме SDE на ключе, размещенном в state. Синхропосылкой сектора i
+	служит iv + i: iv интерпретируется как 128-битовое число (первый октет
+	-- младший), сложение выполняется по модулю 2^128.
+	\pre size % 16 == 0 && size >= 32.
+	\expect beltSDEStart() < beltSDEStepEMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltSDEStepE(buf + size * i, size, iv + i, state).
+	Состояние state не меняется.
+	\remark Секторы обрабатываются в нескольких потоках, если их общая
+	длина не меньше 256 Кбайт. Число потоков не превосходит число
+	процессоров и 16.
+*/
+void beltSDEStepEMulti(
+	void* buf,			/*!< [in,out] открытый текст / шифртекст */
+	size_t size,		/*!< [in] длина сектора в октетах */
+	size_t n,			/*!< [in] число секторов */
+	const octet iv[16],	/*!< [in] синхропосылка первого сектора */
+	const void* state	/*!< [in] состояние */
+);
+
+/*!	\brief Параллельное расшифрование нескольких секторов в режиме SDE
+
+	Секторы [size](buf + size * i), i = 0, 1,..., n - 1, расшифровываются
+	в режиме SDE на ключе, размещенном в state. Синхропосылкой сектора i
+	служит iv + i: iv интерпретируется как 128-битовое число (первый октет
+	-- младший), сложение выполняется по модулю 2^128.
+	\pre size % 16 == 0 && size >= 32.
+	\expect beltSDEStart() < beltSDEStepDMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltSDEStepD(buf + size * i, size, iv + i, state).
+	Состояние state не меняется.
+	\remark Секторы обрабатываются в нескольких потоках, если их общая
+	длина не меньше 256 Кбайт. Число потоков не превосходит число
+	процессоров и 16.
+*/
+void beltSDEStepDMulti(
+	void* buf,			/*!< [in,out] шифртекст / открытый текст */
+	size_t size,		/*!< [in] длина сектора в октетах */
+	size_t n,			/*!< [in] число секторов */
+	const octet iv[16],	/*!< [in] синхропосылка первого сектора */
+	const void* state	/*!< [in] состояние */
+);
+
 /*!	\brief Зашифрование в режиме SDE
 
 	Сектор [count]src зашифровывается на ключе [len]key с использованием 
@@ -1608,6 +2209,45 @@ void beltFMTStepD(
 	void* state				/*!< [in,out] состояние */
 );
 
+/*!	\brief Зашифрование нескольких строк в режиме FMT
+
+	Строки [count](buf + count * i), i = 0, 1,..., n - 1, зашифровываются
+	на ключе, размещенном в state, и синхропосылках [16](iv + 16 * i).
+	Здесь count -- длина строки, предварительно установленная в state
+	функцией beltFMTStart().
+	\expect beltFMTStart() < beltFMTStepEMulti()*.
+	\expect Символы строк принадлежат алфавиту {0,1,..., mod - 1}.
+	\remark При нулевом указателе iv для всех строк используется нулевая
+	синхропосылка.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltFMTStepE(). Если половинки строки умещаются в 64-битовые блоки
+	(например, при mod == 10 и count <= 38), то блоки группы строк
+	зашифровываются одновременно.
+*/
+void beltFMTStepEMulti(
+	u16 buf[],				/*!< [in,out] открытые тексты / шифртексты */
+	size_t n,				/*!< [in] число строк */
+	const octet iv[],		/*!< [in] синхропосылки */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Расшифрование нескольких строк в режиме FMT
+
+	Строки [count](buf + count * i), i = 0, 1,..., n - 1, расшифровываются
+	на ключе, размещенном в state, и синхропосылках [16](iv + 16 * i).
+	\expect beltFMTStart() < beltFMTStepDMulti()*.
+	\remark При нулевом указателе iv для всех строк используется нулевая
+	синхропосылка.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltFMTStepD().
+*/
+void beltFMTStepDMulti(
+	u16 buf[],				/*!< [in,out] шифртексты / открытые тексты */
+	size_t n,				/*!< [in] число строк */
+	const octet iv[],		/*!< [in] синхропосылки */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Зашифрование в режиме FMT
 
 	Строка [count]src в алфавите {0, 1,..., mod - 1} зашифровывается на ключе 
@@ -1704,6 +2344,26 @@ void beltKRPStepG(
 	void* state				/*!< [in,out] состояние */
 );
 
+/*!	\brief Генерация нескольких преобразованных ключей
+
+	Ключи [key_len](key_ + key_len * i), которые имеют заголовки
+	[16](header + 16 * i), i = 0, 1,..., n - 1, строятся по ключу
+	и уровню, размещенным в state.
+	\pre key_len == 16 || key_len == 24 || key_len == 32.
+	\pre key_len <= len, где len -- длина первоначального ключа.
+	\expect beltKRPStart() < beltKRPStepGMulti()*.
+	\remark Результат совпадает с результатом последовательных вызовов
+	beltKRPStepG(). Сжатия belt-compr для четверок ключей выполняются
+	одновременно.
+*/
+void beltKRPStepGMulti(
+	octet key_[],			/*!< [out] преобразованные ключи */
+	size_t key_len,			/*!< [in] длина ключа в октетах */
+	const octet header[],	/*!< [in] заголовки */
+	size_t n,				/*!< [in] число ключей */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Преобразование ключа
 
 	По ключу [n]src, который имеет уровень level, строится ключ [m]dest, 
@@ -1752,6 +2412,44 @@ void beltHMACStart(
 	size_t len				/*!< [in] длина ключа в октетах */
 );
 
+/*!	\brief Длина объекта ключа HMAC
+
+	Возвращается длина (в октетах) объекта ключа HMAC.
+	\return Длина объекта.
+*/
+size_t beltHMACKey_keep();
+
+/*!	\brief Инициализация объекта ключа HMAC
+
+	По ключу [len]key в hkey формируется объект ключа HMAC: блоки
+	key ^ ipad и key ^ opad сжимаются однократно. Объект передается функции
+	beltHMACStartK().
+	\pre По адресу hkey зарезервировано beltHMACKey_keep() октетов.
+	\remark После инициализации объект только читается. Его можно
+	одновременно использовать в нескольких потоках.
+*/
+void beltHMACKeyStart(
+	void* hkey,				/*!< [out] объект ключа */
+	const octet key[],		/*!< [in] ключ */
+	size_t len				/*!< [in] длина ключа в октетах */
+);
+
+/*!	\brief Инициализация функций HMAC по объекту ключа
+
+	В state формируются структуры данных, необходимые для имитозащиты
+	в режиме HMAC на ключе, подготовленном в объекте hkey. Результат
+	совпадает с результатом beltHMACStart() на том же ключе, но сжатия
+	не выполняются: из hkey копируются переменные хэширования.
+	\pre По адресу state зарезервировано beltHMAC_keep() октетов.
+	\expect beltHMACKeyStart(hkey) < beltHMACStartK().
+	\remark Для коротких сообщений использование beltHMACStartK() вместо
+	beltHMACStart() примерно вдвое снижает время выработки имитовставки.
+*/
+void beltHMACStartK(
+	void* state,			/*!< [out] состояние */
+	const void* hkey		/*!< [in] объект ключа */
+);
+
 /*!	\brief Имитозащита фрагмента данных в режиме HMAC
 
 	Текущая имитовставка, размещенная в state, пересчитывается с учетом нового
@@ -1860,6 +2558,27 @@ err_t beltPBKDF2(
 	size_t salt_len			/*!< [in] длина синхропосылки (в октетах) */
 );
 
+/*!	\brief Построение нескольких ключей по паролям
+
+	По паролям [pwd_len[i]]pwd[i] и синхропосылкам [salt_len[i]]salt[i]
+	строятся ключи [32](key + 32 * i), i = 0, 1,..., n - 1. Каждый ключ
+	строится так же, как в функции beltPBKDF2(), с числом итераций iter.
+	\expect{ERR_BAD_INPUT} iter != 0.
+	\return ERR_OK, если ключи успешно построены, и код ошибки в противном
+	случае.
+	\remark Итерации выполняются одновременно для четверок ключей.
+	Большие пакеты дополнительно обрабатываются в нескольких потоках.
+*/
+err_t beltPBKDF2Multi(
+	octet key[],				/*!< [out] ключи */
+	size_t n,					/*!< [in] число ключей */
+	const octet* pwd[],			/*!< [in] пароли */
+	const size_t pwd_len[],		/*!< [in] длины паролей */
+	size_t iter,				/*!< [in] число итераций */
+	const octet* salt[],		/*!< [in] синхропосылки */
+	const size_t salt_len[]		/*!< [in] длины синхропосылок */
+);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
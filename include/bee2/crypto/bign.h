@@ -4,7 +4,7 @@
 \brief STB 34.101.45 (bign): digital signature and key transport algorithms
 \project bee2 [cryptographic library]
 \created 2012.04.27
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -95,11 +95,64 @@ err_t bignStdParams(
 	\return ERR_OK, если параметры корректны, и код ошибки
 	в противном случае.
 	\remark Реализован алгоритм 6.1.4.
+	\remark Параметры, которые совпадают с одним из наборов 
+	bignStdParams() (включая seed), признаются корректными без вычислений. 
+	Хэш-значения других успешно проверенных параметров сохраняются 
+	в кэше, и повторная проверка таких параметров не выполняется.
 */
 err_t bignValParams(
 	const bign_params* params	/*!< [in] долговременные параметры */
 );
 
+/*!	\brief Число шагов пошаговой проверки параметров */
+#define BIGN_VAL_STEPS 4
+
+/*!	\brief Длина состояния пошаговой проверки параметров
+
+	Возвращается длина состояния (в октетах) функций пошаговой проверки
+	долговременных параметров уровня стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина состояния.
+*/
+size_t bignValParams_keep(
+	size_t l				/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Начало пошаговой проверки параметров
+
+	В state подготавливается проверка долговременных параметров params.
+	Параметры копируются в state.
+	\pre По адресу state зарезервировано bignValParams_keep(params->l)
+	октетов.
+	\return ERR_OK, если проверка подготовлена, и код ошибки в противном
+	случае.
+	\remark Стандартные параметры и параметры, сохраненные в кэше
+	(см. bignValParams()), признаются корректными на первом шаге без
+	вычислений.
+*/
+err_t bignValParamsStart(
+	void* state,				/*!< [out] состояние */
+	const bign_params* params	/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Шаг проверки параметров
+
+	Выполняется очередной шаг проверки параметров в состоянии state.
+	Проверка завершается не более чем за BIGN_VAL_STEPS шагов. На шагах
+	проверяются простота p, простота q и условие MOV, координаты
+	базовой точки и, наконец, ее порядок.
+	\expect bignValParamsStart() < bignValParamsStep()*.
+	\return ERR_NOT_READY, если проверка не завершена, ERR_OK, если
+	параметры корректны, и код ошибки в противном случае.
+	\remark Результат проверки совпадает с результатом bignValParams().
+	Успешно проверенные параметры сохраняются в кэше.
+	\remark Для отказа от проверки достаточно прекратить вызывать шаги
+	и освободить state.
+*/
+err_t bignValParamsStep(
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!
 *******************************************************************************
 \file bign.h
@@ -163,6 +216,36 @@ err_t bignGenKeypair(
 	void* rng_state				/*!< [in,out] состояние генератора */
 );
 
+/*!	\brief Пакетная генерация пар ключей
+
+	При долговременных параметрах params генерируются личные
+	[count * l / 4]privkeys и открытые [count * l / 2]pubkeys ключи.
+	Элементы массивов записаны последовательно: i-й личный ключ
+	privkeys + l / 4 * i соответствует открытому pubkeys + l / 2 * i.
+	При генерации используется генератор rng и его состояние rng_state.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect{ERR_BAD_INPUT} Буферы privkeys и pubkeys не пересекаются.
+	\expect Используется криптографически стойкий генератор rng.
+	\return ERR_OK, если ключи успешно сгенерированы, и код ошибки
+	в противном случае.
+	\remark Личные ключи генерируются в порядке следования пар. Поэтому
+	результат совпадает с результатом последовательных вызовов
+	bignGenKeypair() с тем же генератором.
+	\remark Ускорение достигается за счет однократной подготовки
+	контекста (см. bignCtxStart()), вычисления открытых ключей по таблице
+	предвычислений контекста и совместного перехода к аффинным
+	координатам (см. ecCombMulABatch()).
+*/
+err_t bignGenKeypairBatch(
+	octet privkeys[],			/*!< [out] личные ключи */
+	octet pubkeys[],			/*!< [out] открытые ключи */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	size_t count,				/*!< [in] число пар */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
 /*!	\brief Проверка пары ключей
 
 	При долговременных параметрах params проверяется корректность
@@ -190,6 +273,30 @@ err_t bignValPubkey(
 	const octet pubkey[]		/*!< [in] проверяемый ключ */
 );
 
+/*!	\brief Пакетная проверка открытых ключей
+
+	При долговременных параметрах params проверяется корректность открытых
+	ключей [count * l / 2]pubkeys. Элементы массива записаны
+	последовательно: i-й ключ -- это pubkeys + l / 2 * i. Результаты
+	проверки возвращаются в битовой карте [(count + 7) / 8]valid: бит
+	i % 8 октета valid[i / 8] равняется 1, если i-й ключ корректен,
+	и 0 в противном случае. Неиспользуемые биты последнего октета
+	обнуляются.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если все ключи корректны, ERR_BAD_PUBKEY, если
+	некорректен хотя бы один ключ, и другой код ошибки, если проверка
+	не проводилась.
+	\remark Ключи проверяются так же, как в bignValPubkey(). Ускорение по
+	сравнению с вызовами bignValPubkey() достигается за счет однократной
+	подготовки описания кривой и памяти.
+*/
+err_t bignValPubkeyBatch(
+	octet valid[],				/*!< [out] битовая карта корректных ключей */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	size_t count,				/*!< [in] число ключей */
+	const octet pubkeys[]		/*!< [in] проверяемые ключи */
+);
+
 /*!	\brief Построение открытого ключа по личному
 
 	При долговременных параметрах params по личному ключу [l / 4]privkey 
@@ -205,6 +312,68 @@ err_t bignCalcPubkey(
 	const octet privkey[]		/*!< [in] личный ключ */
 );
 
+/*!	\brief Сжатие открытого ключа
+
+	При долговременных параметрах params открытый ключ [l / 2]pubkey 
+	сжимается в ключ [l / 4 + 1]xpubkey. Сжатый ключ состоит из 
+	x-координаты (первые l / 4 октетов pubkey) и октета y mod 2, где 
+	y -- y-координата (последние l / 4 октетов pubkey).
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если ключ сжат, и код ошибки в противном случае.
+	\remark Ключ pubkey предварительно проверяется так же, как 
+	в bignValPubkey().
+	\remark Буферы pubkey и xpubkey могут пересекаться.
+*/
+err_t bignPubkeyCompress(
+	octet xpubkey[],			/*!< [out] сжатый ключ */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Восстановление открытого ключа
+
+	При долговременных параметрах params открытый ключ [l / 2]pubkey 
+	восстанавливается по сжатому ключу [l / 4 + 1]xpubkey.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если ключ восстановлен, и код ошибки в противном 
+	случае (ERR_BAD_PUBKEY, если xpubkey не является сжатым 
+	представлением точки кривой).
+	\remark Восстановленный ключ лежит на кривой и, так как порядок группы
+	точек простой, удовлетворяет требованиям bignValPubkey().
+	\remark Квадратный корень извлекается с помощью gfpSqrt().
+	\remark Буферы pubkey и xpubkey могут пересекаться.
+*/
+err_t bignPubkeyDecompress(
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet xpubkey[]		/*!< [in] сжатый ключ */
+);
+
+/*!	\brief Пакетное восстановление открытых ключей
+
+	При долговременных параметрах params восстанавливаются открытые ключи
+	[count * l / 2]pubkeys по сжатым ключам [count * (l / 4 + 1)]xpubkeys.
+	Элементы массивов записаны последовательно: i-й ключ 
+	pubkeys + l / 2 * i восстанавливается по ключу 
+	xpubkeys + (l / 4 + 1) * i. Если codes != 0, то в codes[i] 
+	возвращается результат восстановления i-го ключа.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_INPUT} Буферы pubkeys и xpubkeys не пересекаются.
+	\return ERR_OK, если все ключи восстановлены, и код первой ошибки 
+	в противном случае.
+	\remark Если codes == 0, то восстановление прекращается на первом
+	некорректном ключе.
+	\remark Ускорение по сравнению с вызовами bignPubkeyDecompress()
+	достигается за счет однократной подготовки описания кривой и памяти.
+*/
+err_t bignPubkeyDecompressBatch(
+	octet pubkeys[],			/*!< [out] открытые ключи */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	size_t count,				/*!< [in] число ключей */
+	const octet xpubkeys[],		/*!< [in] сжатые ключи */
+	err_t codes[]				/*!< [out] результаты (или 0) */
+);
+
 /*!	\brief Построение общего ключа протокола Диффи -- Хеллмана 
 
 	При долговременных параметрах params по личному ключу [l / 4]privkey 
@@ -226,6 +395,36 @@ err_t bignDH(
 	size_t key_len				/*!< [in] длина key в октетах */
 );
 
+/*!	\brief Пакетное построение общих ключей
+
+	При долговременных параметрах params строятся общие ключи
+	[count * key_len]keys на личном ключе [l / 4]privkey и открытых ключах
+	[count * l / 2]pubkeys других сторон. Элементы массивов записаны
+	последовательно: i-й общий ключ keys + key_len * i строится по
+	открытому ключу pubkeys + l / 2 * i.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_PRIVKEY} Личный ключ privkey корректен.
+	\expect{ERR_BAD_INPUT} Буферы keys и pubkeys не пересекаются.
+	\return ERR_OK, если общие ключи успешно построены, и код ошибки
+	в противном случае (в частности, ERR_BAD_PUBKEY, если хотя бы один
+	открытый ключ некорректен).
+	\remark Результат совпадает с результатами вызовов bignDH().
+	\remark В отличие от bignDH(), проверяется принадлежность открытых
+	ключей кривой. Ускорение достигается за счет однократной подготовки
+	описания кривой, однократного перекодирования личного ключа
+	(см. ecRecode()) и совместных переходов к аффинным координатам
+	кратных точек (см. ecMulARecBatch1()).
+	\remark При ошибке часть общих ключей может быть построена.
+*/
+err_t bignDHBatch(
+	octet keys[],				/*!< [out] общие ключи */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet privkey[],		/*!< [in] личный ключ */
+	size_t count,				/*!< [in] число других сторон */
+	const octet pubkeys[],		/*!< [in] открытые ключи других сторон */
+	size_t key_len				/*!< [in] длина общего ключа в октетах */
+);
+
 /*
 *******************************************************************************
 Электронная цифровая подпись (ЭЦП)
@@ -288,6 +487,41 @@ err_t bignSign2(
 	size_t t_len				/*!< [in] размер дополнительных данных */
 );
 
+/*!	\brief Пакетная выработка ЭЦП
+
+	Вырабатываются подписи [count * 3 * l / 8]sigs сообщений 
+	с хэш-значениями [count * l / 4]hashes, полученными с помощью алгоритма 
+	с идентификатором [oid_len]oid_der. Подписи вырабатываются на личном 
+	ключе [l / 4]privkey. Элементы массивов записаны последовательно: 
+	i-я подпись sigs + 3 * l / 8 * i вырабатывается для хэш-значения 
+	hashes + l / 4 * i. При выработке ЭЦП используются долговременные 
+	параметры params и генератор rng с состоянием rng_state.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_OID} Идентификатор oid_der корректен.
+	\expect{ERR_BAD_INPUT} Буферы sigs и hashes не пересекаются.
+	\expect{ERR_BAD_PRIVKEY} Личный ключ privkey корректен.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect Генератор rng является криптографически стойким.
+	\return ERR_OK, если подписи выработаны, и код ошибки в противном
+	случае.
+	\remark Одноразовые личные ключи генерируются в порядке следования 
+	подписей. Поэтому результат совпадает с результатом последовательных 
+	вызовов bignSign() с тем же генератором.
+	\remark На уровне стойкости 128 при сборке с поддержкой AVX2 подписи
+	вырабатываются пакетами по 4 с помощью ecpAddMulAX4().
+*/
+err_t bignSignBatch(
+	octet sigs[],				/*!< [out] подписи */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	size_t count,				/*!< [in] число подписей */
+	const octet hashes[],		/*!< [in] хэш-значения */
+	const octet privkey[],		/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
 /*!	\brief Проверка ЭЦП
 
 	Проверяется ЭЦП [3 * l / 8]sig сообщения с хэш-значением [l / 4]hash. При 
@@ -311,6 +545,41 @@ err_t bignVerify(
 	const octet pubkey[]		/*!< [in] открытый ключ */
 );
 
+/*!	\brief Пакетная проверка ЭЦП
+
+	Проверяются count подписей [count * 3 * l / 8]sigs сообщений 
+	с хэш-значениями [count * l / 4]hashes на открытых ключах
+	[count * l / 2]pubkeys. Элементы массивов записаны последовательно:
+	i-я подпись sigs + 3 * l / 8 * i проверяется для хэш-значения
+	hashes + l / 4 * i на открытом ключе pubkeys + l / 2 * i. Все
+	хэш-значения получены с помощью алгоритма с идентификатором 
+	[oid_len]oid_der. Если codes != 0, то в codes[i] возвращается
+	результат проверки i-й подписи.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_OID} Идентификатор oid_der корректен.
+	\return ERR_OK, если все подписи корректны, и код ошибки первой 
+	некорректной подписи (или первой ошибки другого рода) в противном случае.
+	\remark Если codes == 0, то проверка прекращается на первой 
+	некорректной подписи. Если codes != 0, то проверяются все подписи.
+	\remark Подпись bign не содержит точку R, а только часть хэш-значения
+	от ее координаты. Поэтому подписи нельзя проверить с помощью общей 
+	случайной линейной комбинации. Ускорение по сравнению с вызовами 
+	bignVerify() достигается за счет однократной подготовки описания 
+	кривой и памяти.
+	\remark На уровне стойкости 128 при сборке с поддержкой AVX2 подписи
+	проверяются пакетами по 4 с помощью ecpAddMulAX4().
+*/
+err_t bignVerifyBatch(
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	size_t count,				/*!< [in] число подписей */
+	const octet hashes[],		/*!< [in] хэш-значения */
+	const octet sigs[],			/*!< [in] подписи */
+	const octet pubkeys[],		/*!< [in] открытые ключи */
+	err_t codes[]				/*!< [out] результаты проверок */
+);
+
 /*
 *******************************************************************************
 Транспорт ключа
@@ -345,6 +614,46 @@ err_t bignKeyWrap(
 	void* rng_state				/*!< [in,out] состояние генератора */
 );
 
+/*!	\brief Пакетное создание токенов ключа
+
+	Создаются токены [count * (l / 4 + 16 + len)]tokens ключа [len]key
+	с заголовком [16]header для count получателей с открытыми ключами
+	[count * l / 2]pubkeys. Элементы массивов записаны последовательно:
+	i-й токен tokens + (l / 4 + 16 + len) * i создается для открытого
+	ключа pubkeys + l / 2 * i. При создании токенов используются
+	долговременные параметры params и генератор rng с состоянием rng_state.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_INPUT} len >= 16.
+	\expect{ERR_BAD_INPUT} Буфер tokens не пересекается с key и header.
+	\expect{ERR_BAD_PUBKEY} Открытые ключи pubkeys корректны.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect Используется криптографически стойкий генератор rng.
+	\return ERR_OK, если токены успешно созданы, и код ошибки в противном
+	случае.
+	\remark Одноразовые личные ключи генерируются в порядке следования 
+	токенов. Поэтому результат совпадает с результатом последовательных 
+	вызовов bignKeyWrap() с тем же генератором.
+	\remark В отличие от bignKeyWrap(), проверяется принадлежность
+	открытых ключей кривой. Ускорение достигается за счет однократной 
+	подготовки контекста (см. bignCtxStart()), вычисления кратных базовой
+	точки по таблице предвычислений контекста и совместного перехода
+	к аффинным координатам кратных точек открытых ключей
+	(см. ecMulARecBatch()).
+	\remark Может передаваться нулевой указатель header. В этом случае будет
+	использоваться заголовок из всех нулей.
+*/
+err_t bignKeyWrapBatch(
+	octet tokens[],				/*!< [out] токены ключа */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet key[],			/*!< [in] транспортируемый ключ */
+	size_t len,					/*!< [in] длина ключа в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	size_t count,				/*!< [in] число получателей */
+	const octet pubkeys[],		/*!< [in] открытые ключи получателей */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
 /*!	\brief Разбор токена ключа
 
 	Определяется ключ [len - (l / 4 + 16)]key, который имеет заголовок 
@@ -369,6 +678,153 @@ err_t bignKeyUnwrap(
 	const octet privkey[]		/*!< [in] личный ключ получателя */
 );
 
+/*
+*******************************************************************************
+Конверты
+
+Конверт предназначен для зашифрования на открытом ключе данных большого
+объема. Конверт состоит из заголовка [l / 4 + 64]head и последовательности
+защищенных фрагментов. Заголовок включает описание [16]hdr и токен
+[l / 4 + 48] случайного ключа [32]key (см. bignKeyWrap()). При создании
+токена hdr используется в качестве заголовка ключа. Описание hdr состоит
+из признака "benv" (4 октета), длины фрагмента chunk (4 октета,
+little-endian) и 8 нулевых октетов. Длина chunk не превосходит 2^30.
+
+Данные разбиваются на фрагменты из chunk октетов. Последний фрагмент
+содержит от 0 до chunk - 1 октетов и присутствует всегда, в том числе
+когда длина данных кратна chunk. Фрагмент с номером index (нумерация
+с нуля) защищается в режиме CHE на ключе key с синхропосылкой, которая
+составлена из index (8 октетов, little-endian), признака последнего
+фрагмента (1 октет, 0 или 1) и 7 нулевых октетов. В качестве открытых
+данных используется hdr. Защищенный фрагмент дополняется имитовставкой
+из 8 октетов и начинается в конверте со смещения
+l / 4 + 64 + index * (chunk + 8).
+
+Фрагменты защищаются независимо друг от друга, поэтому их можно
+обрабатывать потоково с ограниченным расходом памяти, параллельно
+и в произвольном порядке, в том числе расшифровывать выборочно.
+Признак последнего фрагмента не позволяет незаметно усечь конверт.
+
+Состояние [bignEnv_keep()]state, подготовленное функцией
+bignEnvWrapStart() или bignEnvUnwrapStart(), функции bignEnvChunkWrap()
+и bignEnvChunkUnwrap() используют только для чтения. Поэтому состояние
+может одновременно использоваться в нескольких потоках.
+*******************************************************************************
+*/
+
+/*!	\brief Длина состояния конверта
+
+	Возвращается длина состояния (в октетах) функций обработки конвертов.
+	\return Длина состояния.
+*/
+size_t bignEnv_keep();
+
+/*!	\brief Начало создания конверта
+
+	Создается заголовок [l / 4 + 64]head конверта с фрагментами длины chunk,
+	адресованного владельцу открытого ключа pubkey. Случайный ключ конверта
+	вырабатывается генератором rng с состоянием rng_state. В state
+	формируются структуры данных, необходимые для защиты фрагментов.
+	\pre По адресу state зарезервировано bignEnv_keep() октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_INPUT} 0 < chunk <= 2^30.
+	\expect{ERR_BAD_PUBKEY} Открытый ключ pubkey корректен.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect Используется криптографически стойкий генератор rng.
+	\return ERR_OK, если заголовок успешно создан, и код ошибки
+	в противном случае.
+*/
+err_t bignEnvWrapStart(
+	octet head[],				/*!< [out] заголовок конверта */
+	void* state,				/*!< [out] состояние */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	size_t chunk,				/*!< [in] длина фрагмента */
+	const octet pubkey[],		/*!< [in] открытый ключ получателя */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Начало разбора конверта
+
+	Разбирается заголовок [l / 4 + 64]head конверта: из токена с помощью
+	личного ключа privkey извлекается ключ конверта. В state формируются
+	структуры данных, необходимые для снятия защиты с фрагментов.
+	\pre По адресу state зарезервировано bignEnv_keep() октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_PRIVKEY} Личный ключ privkey корректен.
+	\return ERR_OK, если заголовок успешно разобран, и код ошибки
+	в противном случае.
+	\remark При некорректном описании конверта возвращается код
+	ERR_BAD_FORMAT, при нарушении целостности токена -- ERR_BAD_KEYTOKEN.
+*/
+err_t bignEnvUnwrapStart(
+	void* state,				/*!< [out] состояние */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet head[],			/*!< [in] заголовок конверта */
+	const octet privkey[]		/*!< [in] личный ключ получателя */
+);
+
+/*!	\brief Длина фрагмента конверта
+
+	Возвращается длина фрагмента конверта, заданная при создании
+	или прочитанная при разборе заголовка.
+	\expect bignEnvWrapStart() < bignEnvChunk() или
+	bignEnvUnwrapStart() < bignEnvChunk().
+	\return Длина фрагмента.
+*/
+size_t bignEnvChunk(
+	const void* state			/*!< [in] состояние */
+);
+
+/*!	\brief Защита фрагмента конверта
+
+	Фрагмент [count]src с номером index зашифровывается и сохраняется
+	в буфере [count + 8]dest вместе с имитовставкой. Признак last
+	указывает на последний фрагмент.
+	\expect{ERR_BAD_INPUT}
+	-	count == bignEnvChunk(state), если !last;
+	-	count < bignEnvChunk(state), если last;
+	-	буферы src и dest либо не пересекаются, либо начинаются
+		с одного адреса.
+	.
+	\expect bignEnvWrapStart() < bignEnvChunkWrap()*.
+	\return ERR_OK, если защита успешно установлена, и код ошибки
+	в противном случае.
+*/
+err_t bignEnvChunkWrap(
+	octet dest[],				/*!< [out] защищенный фрагмент */
+	const void* src,			/*!< [in] фрагмент */
+	size_t count,				/*!< [in] длина фрагмента */
+	size_t index,				/*!< [in] номер фрагмента */
+	bool_t last,				/*!< [in] последний фрагмент? */
+	const void* state			/*!< [in] состояние */
+);
+
+/*!	\brief Снятие защиты с фрагмента конверта
+
+	С защищенного фрагмента [count + 8]src с номером index снимается
+	защита. Если целостность фрагмента не нарушена, то он расшифровывается
+	в буфер [count]dest. Признак last указывает на последний фрагмент.
+	\expect{ERR_BAD_INPUT}
+	-	count == bignEnvChunk(state), если !last;
+	-	count < bignEnvChunk(state), если last;
+	-	буферы src и dest либо не пересекаются, либо начинаются
+		с одного адреса.
+	.
+	\expect bignEnvUnwrapStart() < bignEnvChunkUnwrap()*.
+	\return ERR_OK, если защита успешно снята, и код ошибки
+	в противном случае.
+	\remark При нарушении целостности возвращается код ERR_BAD_MAC.
+*/
+err_t bignEnvChunkUnwrap(
+	void* dest,					/*!< [out] фрагмент */
+	const octet src[],			/*!< [in] защищенный фрагмент */
+	size_t count,				/*!< [in] длина фрагмента */
+	size_t index,				/*!< [in] номер фрагмента */
+	bool_t last,				/*!< [in] последний фрагмент? */
+	const void* state			/*!< [in] состояние */
+);
+
 /*!
 *******************************************************************************
 \file bign.h
@@ -502,6 +958,1095 @@ err_t bignIdVerify(
 	const octet pubkey[]		/*!< [in] открытый ключ доверенной стороны */
 );
 
+/*!
+*******************************************************************************
+\file bign.h
+
+\section bign-ctx Контекст
+
+Контекст содержит описание эллиптической кривой, построенное по
+долговременным параметрам: базовое поле (вместе с константами Монтгомери),
+кривую, базовую точку и ее порядок. Кроме этого, в контексте размещается
+таблица предвычисленных кратных базовой точки. Контекст создается один раз 
+и затем используется функциями bignCtxXXX(), которые являются аналогами 
+функций bignXXX(). Функции bignCtxXXX() не перестраивают описание кривой, 
+а лишь выделяют память для стека, глубина которого определяется по описанию.
+
+Кратные базовой точки (при выработке ключей и подписей, при построении
+токенов) функции bignCtxXXX() определяют по таблице предвычислений
+гребенчатым методом. Это в несколько раз быстрее, чем в функциях bignXXX().
+Кроме того, точки таблицы выбираются регулярно, без ветвлений, зависящих 
+от кратности.
+
+Контекст создается по следующей схеме:
+-	определить длину контекста с помощью функции bignCtx_keep();
+-	подготовить память для контекста;
+-	инициализировать контекст с помощью функции bignCtxStart().
+.
+
+Построение таблицы предвычислений -- самая затратная часть создания
+контекста. Чтобы не повторять его в каждом процессе (например, при 
+нестандартных параметрах), контекст можно сохранить в образ функцией 
+bignCtxSave() и затем загружать функцией bignCtxLoad(). Загруженный 
+контекст ссылается на таблицу внутри образа.
+
+Функции bignCtxXXX() не изменяют контекст. Поэтому один контекст может
+одновременно использоваться в нескольких потоках.
+
+Функции bignXXX() сами используют контексты, которые хранятся во 
+внутреннем кэше библиотеки. Ключом кэша служит хэш-значение параметров 
+params. Контекст стандартных параметров помещается в кэш при первом 
+обращении, остальных параметров -- при повторном. Поэтому приложения, 
+которые многократно вызывают bignXXX() с одними и теми же параметрами, 
+получают ускорение без перехода к bignCtxXXX(). Кэш потокобезопасен. 
+Его размер устанавливается функцией bignCtxCacheSetMax(), по умолчанию 
+равняется BIGN_CTX_CACHE_DEFAULT (4, в профиле LEAN_ENABLED -- 0) и 
+может быть изменен при сборке (например, директива 
+-DBIGN_CTX_CACHE_DEFAULT=0 отключает кэш).
+
+На системах с неоднородным доступом к памяти (NUMA) потоки, которые
+выполняются на узлах, отличных от узла контекста, читают таблицу
+предвычислений с повышенной задержкой. Для таких систем по контексту
+можно создать набор реплик функцией bignCtxRepsStart() (см. obj.h).
+Каждый поток получает реплику своего узла вызовом objRepsGet() и
+передает ее функциям bignCtxXXX() вместо исходного контекста.
+
+Если один и тот же открытый ключ другой стороны используется многократно 
+(повторные сеансы, проверка серии подписей), то его можно один раз 
+проверить и перевести в машинное представление функцией 
+bignCtxPubkeyStart(). Полученный описатель ключа принимают функции 
+bignCtxDHPk(), bignCtxVerifyPk(), bignCtxKeyWrapPk(), bignCtxIdExtractPk() 
+и bignCtxIdVerifyPk().
+
+Если ключ используется особенно интенсивно (например, открытый ключ 
+доверенной стороны при проверке миллионов идентификационных подписей), 
+то описатель можно создать функцией bignCtxPubkeyPreStart(). Такой 
+описатель дополнительно содержит таблицу предвычислений для точки ключа, 
+и в функциях bignCtxVerifyPk(), bignCtxIdExtractPk(), bignCtxIdVerifyPk() 
+кратные базовой точки и точки ключа определяются по двум таблицам.
+
+Если многократно используется собственный личный ключ (подпись серии 
+сообщений, разбор серии токенов), то его можно один раз загрузить и 
+проверить функцией bignCtxPrivkeyStart(). Полученный описатель ключа 
+принимают функции bignCtxSignSk(), bignCtxSign2Sk(), bignCtxDHSk() 
+и bignCtxKeyUnwrapSk(). Описатель содержит личный ключ и должен 
+размещаться в блобе (см. blob.h), лучше всего -- в арене, 
+зафиксированной в оперативной памяти (см. blobArenaCreate()). После 
+завершения работы описатель очищается функцией bignPrivkeyStop().
+
+Функции bignCtxXXX() выделяют память для стека при каждом вызове.
+Некоторые из них имеют аналоги bignCtxXXXW(), которые используют стек, 
+подготовленный вызывающей программой. Длина стека (одна для всех функций 
+bignCtxXXXW()) определяется с помощью функции bignCtxStack_keep(). 
+Выделив стек один раз (например, для каждого соединения или потока), 
+программа может выполнять операции без обращений к куче. Один стек 
+нельзя одновременно использовать в нескольких потоках.
+
+\pre В функциях bignCtxXXXW() по адресу stack зарезервировано 
+bignCtxStack_keep(l) октетов, где l -- уровень стойкости контекста. 
+Адрес stack выровнен на границу машинного слова.
+
+Контекст содержит ссылки на собственные фрагменты. Поэтому контекст нельзя
+перемещать в памяти или копировать. Память контекста освобождается
+вызывающей программой после завершения работы со всеми функциями,
+которые его используют.
+
+\expect{ERR_BAD_INPUT} Контекст ctx инициализирован с помощью bignCtxStart().
+*******************************************************************************
+*/
+
+/*!	\brief Длина контекста
+
+	Возвращается длина контекста (в октетах) для уровня стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина контекста.
+*/
+size_t bignCtx_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Длина стека
+
+	Возвращается длина стека (в октетах) функций bignCtxXXXW() 
+	для уровня стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина стека.
+*/
+size_t bignCtxStack_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Инициализация контекста
+
+	По долговременным параметрам params инициализируется контекст ctx.
+	\pre По адресу ctx зарезервировано bignCtx_keep(params->l) октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если контекст успешно инициализирован, и код ошибки
+	в противном случае.
+	\remark Проводится та же минимальная проверка параметров, что и
+	в функциях bignXXX(). Полная проверка выполняется функцией 
+	bignValParams().
+*/
+err_t bignCtxStart(
+	void* ctx,					/*!< [out] контекст */
+	const bign_params* params	/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Сохранение контекста
+
+	Контекст ctx сохраняется в образ [count]image. Образ содержит таблицу 
+	предвычислений контекста и может быть загружен функцией bignCtxLoad().
+	Если image == 0, то определяется только длина образа count.
+	\return ERR_OK, если образ успешно построен, и код ошибки в противном 
+	случае.
+	\remark Образ не содержит указателей и не зависит от адреса 
+	размещения. Образ зависит от длины машинного слова, порядка октетов 
+	в слове и редукции в базовом поле (см. zmRed()). Образ снабжается 
+	версией формата и контрольным хэш-значением.
+*/
+err_t bignCtxSave(
+	octet image[],				/*!< [out] образ */
+	size_t* count,				/*!< [out] длина образа */
+	const void* ctx				/*!< [in] контекст */
+);
+
+/*!	\brief Длина загружаемого контекста
+
+	Возвращается длина контекста (в октетах), который загружается 
+	функцией bignCtxLoad() для уровня стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина контекста.
+	\remark Длина меньше bignCtx_keep(l): таблица предвычислений остается 
+	в образе.
+*/
+size_t bignCtxLoad_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Загрузка контекста
+
+	По долговременным параметрам params и образу [count]image, построенному
+	функцией bignCtxSave(), инициализируется контекст ctx. Описание кривой 
+	строится заново, а таблица предвычислений не копируется: контекст 
+	ссылается на нее внутри образа.
+	\pre По адресу ctx зарезервировано bignCtxLoad_keep(params->l) октетов.
+	\expect{ERR_BAD_INPUT} Адрес image выровнен на границу машинного слова.
+	\expect{ERR_BAD_FORMAT} Образ построен для params->l на платформе
+	с такими же длиной машинного слова и порядком октетов, версия формата 
+	поддерживается.
+	\expect{ERR_BAD_HASH} Контрольное хэш-значение образа корректно.
+	\expect{ERR_BAD_PARAMS} Образ построен для параметров params.
+	\return ERR_OK, если контекст успешно загружен, и код ошибки в 
+	противном случае.
+	\remark Образ не изменяется и должен оставаться доступным, пока 
+	используется контекст. Образ можно отобразить в память только для 
+	чтения и разделить между процессами.
+	\remark Контрольное хэш-значение защищает только от случайных 
+	искажений. Дополнительно проверяется, что точки таблицы лежат на 
+	кривой, а первая и опорные точки таблицы совпадают с заново 
+	вычисленными кратными базовой. Остальные точки сверяются с кривой, 
+	но не с базовой точкой. Поэтому образ, подмененный преднамеренно, 
+	может быть загружен, а подписи на нем окажутся неверными. Образ 
+	следует получать из доверенного источника и хранить так, чтобы 
+	исключить его подмену.
+*/
+err_t bignCtxLoad(
+	void* ctx,					/*!< [out] контекст */
+	const bign_params* params,	/*!< [in] долговременные параметры */
+	const octet image[],		/*!< [in] образ */
+	size_t count				/*!< [in] длина образа */
+);
+
+/*!	\brief Создание набора реплик контекста
+
+	Для контекста ctx создается набор reps реплик для узлов NUMA.
+	Реплика -- это контекст с собственной копией таблицы предвычислений
+	(даже если ctx ссылается на встроенную таблицу или на образ, см.
+	bignCtxLoad()). Реплика узла вызывающего потока возвращается функцией
+	objRepsGet(reps) и принимается всеми функциями bignCtxXXX().
+	\pre По адресу reps зарезервировано objReps_keep() октетов.
+	\return ERR_OK, если набор создан, и код ошибки в противном случае.
+	\remark Контекст ctx должен оставаться доступным, а реплики не должны
+	использоваться после вызова objRepsClose(reps), который освобождает
+	память реплик.
+*/
+err_t bignCtxRepsStart(
+	void* reps,					/*!< [out] набор реплик */
+	const void* ctx				/*!< [in] контекст */
+);
+
+/*!	\brief Максимальный размер кэша контекстов */
+#define BIGN_CTX_CACHE_MAX 16
+
+/*!	\brief Размер кэша контекстов по умолчанию
+
+	Размер можно переопределить при сборке библиотеки. Нулевое значение
+	отключает кэш до вызова bignCtxCacheSetMax().
+*/
+#ifndef BIGN_CTX_CACHE_DEFAULT
+	#ifdef LEAN_ENABLED
+		#define BIGN_CTX_CACHE_DEFAULT 0
+	#else
+		#define BIGN_CTX_CACHE_DEFAULT 4
+	#endif
+#endif
+
+/*!	\brief Размер кэша контекстов
+
+	Устанавливается максимальное число max контекстов во внутреннем кэше,
+	который используют функции bignXXX(). Нулевое значение max отключает
+	кэш.
+	\return Признак успеха. Если max > BIGN_CTX_CACHE_MAX или не удалось
+	инициализировать кэш, то возвращается FALSE, а прежний кэш сохраняется.
+	\remark При изменении размера кэш очищается.
+	\remark Контекст уровня стойкости l занимает bignCtx_keep(l) октетов.
+	\remark Контексты, которые используются в других потоках в момент
+	вызова, освобождаются после завершения вычислений.
+*/
+bool_t bignCtxCacheSetMax(
+	size_t max					/*!< [in] число контекстов */
+);
+
+/*!	\brief Очистка кэша контекстов
+
+	Из кэша контекстов удаляются все контексты. Размер кэша не меняется.
+*/
+void bignCtxCacheFlush();
+
+/*!	\brief Генерация пары ключей в контексте
+
+	Аналог bignGenKeypair() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxGenKeypair(
+	octet privkey[],			/*!< [out] личный ключ */
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Пакетная генерация пар ключей в контексте
+
+	Аналог bignGenKeypairBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxGenKeypairBatch(
+	octet privkeys[],			/*!< [out] личные ключи */
+	octet pubkeys[],			/*!< [out] открытые ключи */
+	const void* ctx,			/*!< [in] контекст */
+	size_t count,				/*!< [in] число пар */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Проверка пары ключей в контексте
+
+	Аналог bignValKeypair() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxValKeypair(
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Проверка открытого ключа в контексте
+
+	Аналог bignValPubkey() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxValPubkey(
+	const void* ctx,			/*!< [in] контекст */
+	const octet pubkey[]		/*!< [in] проверяемый ключ */
+);
+
+/*!	\brief Проверка открытого ключа в контексте (внешний стек)
+
+	Аналог bignCtxValPubkey() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxValPubkeyW(
+	const void* ctx,			/*!< [in] контекст */
+	const octet pubkey[],		/*!< [in] проверяемый ключ */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Пакетная проверка открытых ключей в контексте
+
+	Аналог bignValPubkeyBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxValPubkeyBatch(
+	octet valid[],				/*!< [out] битовая карта корректных ключей */
+	const void* ctx,			/*!< [in] контекст */
+	size_t count,				/*!< [in] число ключей */
+	const octet pubkeys[]		/*!< [in] проверяемые ключи */
+);
+
+/*!	\brief Длина описателя открытого ключа
+
+	Возвращается длина описателя открытого ключа (в октетах) для уровня 
+	стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина описателя.
+*/
+size_t bignPubkey_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Создание описателя открытого ключа
+
+	Открытый ключ pubkey проверяется в контексте ctx так же, как в 
+	bignCtxValPubkey(), и по адресу pk создается описатель ключа. Описатель 
+	содержит точку ключа в машинном представлении и признак ее 
+	корректности. Функции bignCtxXXXPk() принимают описатель вместо 
+	открытого ключа и не повторяют загрузку и проверку.
+	\pre По адресу pk зарезервировано bignPubkey_keep(l) октетов, где 
+	l -- уровень стойкости контекста.
+	\expect{ERR_BAD_PUBKEY} Открытый ключ корректен.
+	\return ERR_OK, если ключ корректен, и код ошибки в противном случае.
+	\remark Описатель создается и для некорректного ключа. Функции 
+	bignCtxXXXPk() с таким описателем возвращают ERR_BAD_PUBKEY.
+	\remark Описатель привязан к контексту ctx и допускается только с ним.
+	Описатель не содержит указателей на собственные фрагменты и может 
+	копироваться.
+*/
+err_t bignCtxPubkeyStart(
+	void* pk,					/*!< [out] описатель ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Длина описателя открытого ключа с таблицей
+
+	Возвращается длина описателя открытого ключа с таблицей предвычислений 
+	(в октетах) для уровня стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина описателя.
+*/
+size_t bignPubkeyPre_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Создание описателя открытого ключа с таблицей
+
+	Аналог bignCtxPubkeyStart(), который дополнительно строит в описателе 
+	pk таблицу предвычислений для точки открытого ключа pubkey. Таблица 
+	имеет тот же формат, что и таблица для базовой точки в контексте ctx.
+	Описатель принимают все функции bignCtxXXXPk(). Функции 
+	bignCtxVerifyPk(), bignCtxIdExtractPk() и bignCtxIdVerifyPk()
+	используют таблицу.
+	\pre По адресу pk зарезервировано bignPubkeyPre_keep(l) октетов, где 
+	l -- уровень стойкости контекста.
+	\expect{ERR_BAD_PUBKEY} Открытый ключ корректен.
+	\return ERR_OK, если ключ корректен, и код ошибки в противном случае.
+	\remark Построение таблицы стоит примерно как несколько проверок 
+	подписи и окупается при многократном использовании ключа.
+*/
+err_t bignCtxPubkeyPreStart(
+	void* pk,					/*!< [out] описатель ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Длина описателя личного ключа
+
+	Возвращается длина описателя личного ключа (в октетах) для уровня 
+	стойкости l.
+	\pre l == 128 || l == 192 || l == 256.
+	\return Длина описателя.
+*/
+size_t bignPrivkey_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Создание описателя личного ключа
+
+	Личный ключ privkey загружается и проверяется в контексте ctx, и по 
+	адресу sk создается описатель ключа. Описатель содержит ключ 
+	в машинном представлении и признак его корректности. Функции 
+	bignCtxXXXSk() принимают описатель вместо личного ключа и не 
+	повторяют загрузку и проверку.
+	\pre По адресу sk зарезервировано bignPrivkey_keep(l) октетов, где 
+	l -- уровень стойкости контекста.
+	\expect{ERR_BAD_PRIVKEY} Личный ключ корректен.
+	\return ERR_OK, если ключ корректен, и код ошибки в противном случае.
+	\remark Описатель создается и для некорректного ключа (без копии 
+	ключа). Функции bignCtxXXXSk() с таким описателем возвращают 
+	ERR_BAD_PRIVKEY.
+	\remark Описатель привязан к контексту ctx и допускается только с ним.
+	\remark Описатель рекомендуется размещать в блобе (см. blobCreate()).
+*/
+err_t bignCtxPrivkeyStart(
+	void* sk,					/*!< [out] описатель ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[]		/*!< [in] личный ключ */
+);
+
+/*!	\brief Очистка описателя личного ключа
+
+	Описатель sk, созданный функцией bignCtxPrivkeyStart(), очищается.
+	\pre Описатель sk создан функцией bignCtxPrivkeyStart().
+	\post Описатель sk нельзя использовать в функциях bignCtxXXXSk().
+*/
+void bignPrivkeyStop(
+	void* sk					/*!< [in,out] описатель ключа */
+);
+
+/*!	\brief Построение открытого ключа по личному в контексте
+
+	Аналог bignCalcPubkey() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxCalcPubkey(
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[]		/*!< [in] личный ключ */
+);
+
+/*!	\brief Построение открытого ключа по личному в контексте (внешний стек)
+
+	Аналог bignCtxCalcPubkey() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxCalcPubkeyW(
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Сжатие открытого ключа в контексте
+
+	Аналог bignPubkeyCompress() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxPubkeyCompress(
+	octet xpubkey[],			/*!< [out] сжатый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Восстановление открытого ключа в контексте
+
+	Аналог bignPubkeyDecompress() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxPubkeyDecompress(
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet xpubkey[]		/*!< [in] сжатый ключ */
+);
+
+/*!	\brief Пакетное восстановление открытых ключей в контексте
+
+	Аналог bignPubkeyDecompressBatch() с долговременными параметрами, 
+	заданными контекстом ctx.
+*/
+err_t bignCtxPubkeyDecompressBatch(
+	octet pubkeys[],			/*!< [out] открытые ключи */
+	const void* ctx,			/*!< [in] контекст */
+	size_t count,				/*!< [in] число ключей */
+	const octet xpubkeys[],		/*!< [in] сжатые ключи */
+	err_t codes[]				/*!< [out] результаты (или 0) */
+);
+
+/*!	\brief Построение общего ключа в контексте
+
+	Аналог bignDH() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxDH(
+	octet key[],				/*!< [out] общий ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const octet pubkey[],		/*!< [in] открытый ключ (другой стороны) */
+	size_t key_len				/*!< [in] длина key в октетах */
+);
+
+/*!	\brief Построение общего ключа в контексте (внешний стек)
+
+	Аналог bignCtxDH() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxDHW(
+	octet key[],				/*!< [out] общий ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const octet pubkey[],		/*!< [in] открытый ключ (другой стороны) */
+	size_t key_len,				/*!< [in] длина key в октетах */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Пакетное построение общих ключей в контексте
+
+	Аналог bignDHBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxDHBatch(
+	octet keys[],				/*!< [out] общие ключи */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	size_t count,				/*!< [in] число других сторон */
+	const octet pubkeys[],		/*!< [in] открытые ключи других сторон */
+	size_t key_len				/*!< [in] длина общего ключа в октетах */
+);
+
+/*!	\brief Построение общего ключа в контексте по описателю
+
+	Аналог bignCtxDH() с открытым ключом, заданным описателем pk
+	(см. bignCtxPubkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель pk создан в контексте ctx.
+*/
+err_t bignCtxDHPk(
+	octet key[],				/*!< [out] общий ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const void* pk,				/*!< [in] описатель открытого ключа */
+	size_t key_len				/*!< [in] длина key в октетах */
+);
+
+/*!	\brief Построение общего ключа в контексте по описателю личного ключа
+
+	Аналог bignCtxDH() с личным ключом, заданным описателем sk
+	(см. bignCtxPrivkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель sk создан в контексте ctx.
+*/
+err_t bignCtxDHSk(
+	octet key[],				/*!< [out] общий ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const void* sk,				/*!< [in] описатель личного ключа */
+	const octet pubkey[],		/*!< [in] открытый ключ (другой стороны) */
+	size_t key_len				/*!< [in] длина key в октетах */
+);
+
+/*!	\brief Выработка ЭЦП в контексте
+
+	Аналог bignSign() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxSign(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[],		/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Выработка ЭЦП в контексте (внешний стек)
+
+	Аналог bignCtxSign() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxSignW(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[],		/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state,			/*!< [in,out] состояние генератора */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Выработка ЭЦП в контексте по описателю личного ключа
+
+	Аналог bignCtxSign() с личным ключом, заданным описателем sk
+	(см. bignCtxPrivkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель sk создан в контексте ctx.
+*/
+err_t bignCtxSignSk(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const void* sk,				/*!< [in] описатель личного ключа */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Детерминированная выработка ЭЦП в контексте
+
+	Аналог bignSign2() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxSign2(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const void* t,				/*!< [in] дополнительные данные */
+	size_t t_len				/*!< [in] размер дополнительных данных */
+);
+
+/*!	\brief Детерминированная выработка ЭЦП в контексте (внешний стек)
+
+	Аналог bignCtxSign2() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxSign2W(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[],		/*!< [in] личный ключ */
+	const void* t,				/*!< [in] дополнительные данные */
+	size_t t_len,				/*!< [in] размер дополнительных данных */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Детерминированная выработка ЭЦП в контексте по описателю 
+	личного ключа
+
+	Аналог bignCtxSign2() с личным ключом, заданным описателем sk
+	(см. bignCtxPrivkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель sk создан в контексте ctx.
+	\remark Подпись совпадает с подписью bignCtxSign2() на том же 
+	личном ключе.
+*/
+err_t bignCtxSign2Sk(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const void* sk,				/*!< [in] описатель личного ключа */
+	const void* t,				/*!< [in] дополнительные данные */
+	size_t t_len				/*!< [in] размер дополнительных данных */
+);
+
+/*!	\brief Пакетная выработка ЭЦП в контексте
+
+	Аналог bignSignBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+	\remark Кратные базовой точки определяются с помощью таблицы 
+	предвычислений контекста, а не пакетами.
+*/
+err_t bignCtxSignBatch(
+	octet sigs[],				/*!< [out] подписи */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	size_t count,				/*!< [in] число подписей */
+	const octet hashes[],		/*!< [in] хэш-значения */
+	const octet privkey[],		/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Длина пула одноразовых ключей
+
+	Определяется длина в октетах пула, который рассчитан на size 
+	одноразовых ключей ЭЦП на уровне стойкости l.
+	\return Длина пула.
+*/
+size_t bignPool_keep(
+	size_t l,					/*!< [in] уровень стойкости */
+	size_t size					/*!< [in] емкость пула */
+);
+
+/*!	\brief Запуск пула одноразовых ключей
+
+	В буфере [bignPool_keep(l, size)]pool запускается пул из size 
+	одноразовых ключей ЭЦП для контекста ctx. Элементами пула являются
+	пары (k, R = k G), которые вырабатываются заранее, до поступления
+	хэш-значений. Если threads > 0, то пул пополняется в фоновом режиме
+	threads рабочими потоками. Одноразовые ключи генерируются с помощью
+	генератора rng с состоянием rng_state.
+	\expect{ERR_BAD_INPUT} size > 0, threads <= 16.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect Используется криптографически стойкий генератор rng.
+	\expect Контекст ctx не меняется и не закрывается, а буфер pool
+	не перемещается вплоть до вызова bignCtxPoolStop().
+	\return ERR_OK, если пул запущен, и код ошибки в противном случае.
+	\remark Генератор rng вызывается под мьютексом пула и может не быть
+	потокобезопасным. Другие программы не должны обращаться к rng_state 
+	вплоть до вызова bignCtxPoolStop().
+	\remark Если рабочие потоки создать не удалось (например, операционная
+	система не поддерживает многозадачность), то пул работает без них. 
+	Его можно пополнять вызовами bignCtxPoolFill().
+*/
+err_t bignCtxPoolStart(
+	void* pool,					/*!< [out] пул */
+	const void* ctx,			/*!< [in] контекст */
+	size_t size,				/*!< [in] емкость пула */
+	size_t threads,				/*!< [in] число рабочих потоков */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Пополнение пула одноразовых ключей
+
+	Пул pool контекста ctx пополняется в вызывающем потоке до полной
+	емкости.
+	\expect{ERR_BAD_INPUT} Пул pool запущен в контексте ctx.
+	\return ERR_OK, если пул пополнен, и код ошибки в противном случае.
+*/
+err_t bignCtxPoolFill(
+	void* pool,					/*!< [in,out] пул */
+	const void* ctx				/*!< [in] контекст */
+);
+
+/*!	\brief Число готовых одноразовых ключей
+
+	Определяется число готовых элементов пула pool.
+	\pre Пул pool запущен.
+	\return Число готовых элементов.
+*/
+size_t bignCtxPoolCount(
+	void* pool					/*!< [in] пул */
+);
+
+/*!	\brief Выработка ЭЦП с помощью пула
+
+	Аналог bignCtxSign(), в котором одноразовый личный ключ k и точка 
+	R = k G извлекаются из пула pool. Извлеченный элемент сразу 
+	удаляется из пула. Поэтому в режиме реального времени выполняются 
+	только хэширование и несколько операций по модулю q.
+	\expect{ERR_BAD_INPUT} Пул pool запущен в контексте ctx.
+	\return ERR_OK, если подпись выработана, и код ошибки в противном
+	случае.
+	\remark Если пул пуст, то элемент вырабатывается в вызывающем потоке
+	с помощью генератора пула.
+	\remark Без рабочих потоков и при заполнении пула только функцией
+	bignCtxPoolFill() одноразовые ключи используются в порядке генерации.
+	Поэтому результат совпадает с результатом последовательных вызовов 
+	bignCtxSign() с тем же генератором.
+*/
+err_t bignCtxSignPool(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	void* pool,					/*!< [in,out] пул */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[]		/*!< [in] личный ключ */
+);
+
+/*!	\brief Извлечение одноразового ключа из пула
+
+	Из пула pool извлекается одноразовый личный ключ [l / 4]k и 
+	соответствующий ему открытый ключ [l / 2]R = k G. Извлеченный элемент 
+	сразу удаляется из пула.
+	\expect{ERR_BAD_INPUT} Пул pool запущен.
+	\return ERR_OK, если ключи извлечены, и код ошибки в противном
+	случае.
+	\remark Если пул пуст, то элемент вырабатывается в вызывающем потоке
+	с помощью генератора пула.
+	\remark Функция может служить поставщиком одноразовых ключей 
+	протоколов bake (см. bake_eph_i).
+*/
+err_t bignCtxPoolTake(
+	octet k[],					/*!< [out] одноразовый личный ключ */
+	octet R[],					/*!< [out] одноразовый открытый ключ */
+	void* pool					/*!< [in,out] пул */
+);
+
+/*!	\brief Остановка пула одноразовых ключей
+
+	Останавливаются рабочие потоки пула pool, обнуляются неиспользованные 
+	элементы, освобождаются ресурсы.
+	\pre Пул pool запущен.
+	\return ERR_OK или код ошибки, на которой завершился один из рабочих 
+	потоков (например, ERR_BAD_RNG).
+*/
+err_t bignCtxPoolStop(
+	void* pool					/*!< [in,out] пул */
+);
+
+/*!	\brief Проверка ЭЦП в контексте
+
+	Аналог bignVerify() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxVerify(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet sig[],			/*!< [in] подпись */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
+/*!	\brief Проверка ЭЦП в контексте (внешний стек)
+
+	Аналог bignCtxVerify() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxVerifyW(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet sig[],			/*!< [in] подпись */
+	const octet pubkey[],		/*!< [in] открытый ключ */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Проверка ЭЦП в контексте по описателю ключа
+
+	Аналог bignCtxVerify() с открытым ключом, заданным описателем pk
+	(см. bignCtxPubkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель pk создан в контексте ctx.
+*/
+err_t bignCtxVerifyPk(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet sig[],			/*!< [in] подпись */
+	const void* pk				/*!< [in] описатель открытого ключа */
+);
+
+/*!	\brief Пакетная проверка ЭЦП в контексте
+
+	Аналог bignVerifyBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+	\remark При пакетной обработке (см. bignVerifyBatch()) таблица 
+	предвычислений контекста не используется.
+*/
+err_t bignCtxVerifyBatch(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	size_t count,				/*!< [in] число подписей */
+	const octet hashes[],		/*!< [in] хэш-значения */
+	const octet sigs[],			/*!< [in] подписи */
+	const octet pubkeys[],		/*!< [in] открытые ключи */
+	err_t codes[]				/*!< [out] результаты проверок */
+);
+
+/*!	\brief Создание токена ключа в контексте
+
+	Аналог bignKeyWrap() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxKeyWrap(
+	octet token[],				/*!< [out] токен ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet key[],			/*!< [in] транспортируемый ключ */
+	size_t len,					/*!< [in] длина ключа в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const octet pubkey[],		/*!< [in] открытый ключ получателя */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Создание токена ключа в контексте (внешний стек)
+
+	Аналог bignCtxKeyWrap() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxKeyWrapW(
+	octet token[],				/*!< [out] токен ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet key[],			/*!< [in] транспортируемый ключ */
+	size_t len,					/*!< [in] длина ключа в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const octet pubkey[],		/*!< [in] открытый ключ получателя */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state,			/*!< [in,out] состояние генератора */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Создание токена ключа в контексте по описателю ключа
+
+	Аналог bignCtxKeyWrap() с открытым ключом получателя, заданным 
+	описателем pk (см. bignCtxPubkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель pk создан в контексте ctx.
+	\remark В отличие от bignCtxKeyWrap(), ключ получателя гарантированно 
+	проверен: принадлежность точки кривой установлена при создании 
+	описателя.
+*/
+err_t bignCtxKeyWrapPk(
+	octet token[],				/*!< [out] токен ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet key[],			/*!< [in] транспортируемый ключ */
+	size_t len,					/*!< [in] длина ключа в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const void* pk,				/*!< [in] описатель ключа получателя */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Пакетное создание токенов ключа в контексте
+
+	Аналог bignKeyWrapBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+	\remark Кратные базовой точки определяются с помощью таблицы 
+	предвычислений контекста.
+*/
+err_t bignCtxKeyWrapBatch(
+	octet tokens[],				/*!< [out] токены ключа */
+	const void* ctx,			/*!< [in] контекст */
+	const octet key[],			/*!< [in] транспортируемый ключ */
+	size_t len,					/*!< [in] длина ключа в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	size_t count,				/*!< [in] число получателей */
+	const octet pubkeys[],		/*!< [in] открытые ключи получателей */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Разбор токена ключа в контексте
+
+	Аналог bignKeyUnwrap() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxKeyUnwrap(
+	octet key[],				/*!< [out] ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet token[],		/*!< [in] токен ключа */
+	size_t len,					/*!< [in] длина токена в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const octet privkey[]		/*!< [in] личный ключ получателя */
+);
+
+/*!	\brief Разбор токена ключа в контексте (внешний стек)
+
+	Аналог bignCtxKeyUnwrap() со стеком stack, подготовленным вызывающей 
+	программой.
+*/
+err_t bignCtxKeyUnwrapW(
+	octet key[],				/*!< [out] ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet token[],		/*!< [in] токен ключа */
+	size_t len,					/*!< [in] длина токена в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const octet privkey[],		/*!< [in] личный ключ получателя */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Разбор токена ключа в контексте по описателю личного ключа
+
+	Аналог bignCtxKeyUnwrap() с личным ключом получателя, заданным 
+	описателем sk (см. bignCtxPrivkeyStart()).
+	\expect{ERR_BAD_INPUT} Описатель sk создан в контексте ctx.
+*/
+err_t bignCtxKeyUnwrapSk(
+	octet key[],				/*!< [out] ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet token[],		/*!< [in] токен ключа */
+	size_t len,					/*!< [in] длина токена в октетах */
+	const octet header[16],		/*!< [in] заголовок ключа */
+	const void* sk				/*!< [in] описатель личного ключа */
+);
+
+/*!	\brief Извлечение пары ключей в контексте
+
+	Аналог bignIdExtract() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxIdExtract(
+	octet id_privkey[],			/*!< [out] личный ключ */
+	octet id_pubkey[],			/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet sig[],			/*!< [in] подпись идентификатора */
+	const octet pubkey[]		/*!< [in] открытый ключ доверенной стороны */
+);
+
+/*!	\brief Извлечение пары ключей в контексте по описателю ключа
+
+	Аналог bignCtxIdExtract() с открытым ключом доверенной стороны, 
+	заданным описателем pk (см. bignCtxPubkeyStart(), 
+	bignCtxPubkeyPreStart()).
+	\expect{ERR_BAD_INPUT} Описатель pk создан в контексте ctx.
+*/
+err_t bignCtxIdExtractPk(
+	octet id_privkey[],			/*!< [out] личный ключ */
+	octet id_pubkey[],			/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet sig[],			/*!< [in] подпись идентификатора */
+	const void* pk				/*!< [in] описатель ключа доверенной стороны */
+);
+
+/*!	\brief Выработка идентификационной ЭЦП в контексте
+
+	Аналог bignIdSign() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxIdSign(
+	octet id_sig[],				/*!< [out] идентификационная подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet hash[],			/*!< [in] хэш-значение сообщения */
+	const octet id_privkey[],	/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Детерминированная выработка идентификационной ЭЦП в контексте
+
+	Аналог bignIdSign2() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxIdSign2(
+	octet id_sig[],				/*!< [out] идентификационная подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet hash[],			/*!< [in] хэш-значение сообщения */
+	const octet id_privkey[],	/*!< [in] личный ключ */
+	const void* t,				/*!< [in] дополнительные данные */
+	size_t t_len				/*!< [in] длина t в октетах */
+);
+
+/*!	\brief Проверка идентификационной ЭЦП в контексте
+
+	Аналог bignIdVerify() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t bignCtxIdVerify(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet hash[],			/*!< [in] хэш-значение сообщения */
+	const octet id_sig[],		/*!< [in] подпись */
+	const octet id_pubkey[],	/*!< [in] открытый ключ */
+	const octet pubkey[]		/*!< [in] открытый ключ доверенной стороны */
+);
+
+/*!	\brief Проверка идентификационной ЭЦП в контексте по описателю ключа
+
+	Аналог bignCtxIdVerify() с открытым ключом доверенной стороны, 
+	заданным описателем pk (см. bignCtxPubkeyStart(), 
+	bignCtxPubkeyPreStart()).
+	\expect{ERR_BAD_INPUT} Описатель pk создан в контексте ctx.
+	\remark Если описатель создан функцией bignCtxPubkeyPreStart(), то 
+	из трех кратных точек s1 G + (s0 + 2^l) R + t Q две (G и Q) 
+	определяются по таблицам предвычислений. Число удвоений уменьшается 
+	примерно вдвое.
+*/
+err_t bignCtxIdVerifyPk(
+	const void* ctx,			/*!< [in] контекст */
+	const octet oid_der[],		/*!< [in] идентификатор хэш-алгоритма */
+	size_t oid_len,				/*!< [in] длина oid_der в октетах */
+	const octet id_hash[],		/*!< [in] хэш-значение идентификатора */
+	const octet hash[],			/*!< [in] хэш-значение сообщения */
+	const octet id_sig[],		/*!< [in] подпись */
+	const octet id_pubkey[],	/*!< [in] открытый ключ */
+	const void* pk				/*!< [in] описатель ключа доверенной стороны */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief STB 34.101.47/botp: OTP algorithms
 \project bee2 [cryptographic library]
 \created 2015.11.02
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -125,6 +125,11 @@ void botpCtrNext(
 botpHOTPStepV() счетчик, размещенный в состоянии, инкрементируется. 
 Обновленный счетчик можно использовать для генерации или проверки нового 
 пароля. Выгрузить счетчик из состояния можно с помощью функции botpHOTPStepG().
+
+Функции botpHOTPStepW(), botpHOTPVerifyW() проверяют пароль в окне
+счетчиков ctr, ctr + 1,..., ctr + window. Ключ обрабатывается однократно,
+проверка каждого счетчика окна требует одного вычисления beltHMAC
+над 8 октетами. Возвращается смещение счетчика, на котором пароль подошел.
 *******************************************************************************
 */
 
@@ -187,6 +192,26 @@ bool_t botpHOTPStepV(
 	void* state				/*!< [in,out] состояние */
 );
 
+/*!	\brief Проверка пароля в окне счетчиков в режиме HOTP
+
+	По числу digit и ключу, размещенным в state, для счетчиков ctr + i,
+	i = 0, 1,..., window, где ctr -- счетчик, размещенный в state, строятся
+	одноразовые пароли из digit десятичных цифр. Построенные пароли
+	последовательно сравниваются с otp. При первом совпадении в offset
+	возвращается смещение i (если offset != 0), а в state устанавливается
+	счетчик ctr + i + 1. Если совпадений нет, то счетчик в state
+	не меняется.
+	\expect botpHOTPStepS() < botpHOTPStepW()*.
+	\return Признак совпадения паролей.
+	\remark Число проверяемых паролей -- window + 1.
+*/
+bool_t botpHOTPStepW(
+	size_t* offset,			/*!< [out] смещение счетчика */
+	const char* otp,		/*!< [in] контрольный пароль */
+	size_t window,			/*!< [in] окно */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Возврат счетчика
 
 	В ctr возвращается текущий счетчик, размещенный в state.
@@ -228,6 +253,26 @@ err_t botpHOTPVerify(
 	const octet ctr[8]		/*!< [in] счетчик */
 );
 
+/*!	\brief Проверка пароля в окне счетчиков в режиме HOTP
+
+	По ключу [key_len]key и счетчикам ctr + i, i = 0, 1,..., window,
+	строятся одноразовые пароли из strLen(otp) символов. Построенные
+	пароли сравниваются с otp. При совпадении в offset возвращается
+	смещение i (если offset != 0).
+	\expect{ERR_BAD_PWD} 6 <= strLen(otp) && strLen(otp) <= 8.
+	\expect{ERR_BAD_PWD} Пароль otp совпадает с одним из построенных.
+	\return ERR_OK в случае успеха или код ошибки.
+	\remark Ключ обрабатывается однократно (см. botpHOTPStepW()).
+*/
+err_t botpHOTPVerifyW(
+	size_t* offset,			/*!< [out] смещение счетчика */
+	const char* otp,		/*!< [in] контрольный пароль */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len,			/*!< [in] длина ключа в октетах */
+	const octet ctr[8],		/*!< [in] счетчик */
+	size_t window			/*!< [in] окно */
+);
+
 /*!
 *******************************************************************************
 \file botp.h
@@ -246,6 +291,18 @@ tmTimeRound(). Эта функция возвращает TIME_ERR при оши
 
 Отметка времени представляется типом tm_time_t. Отметка преобразуется в счетчик
 режима HOTP, т.е. в 64-разрядное беззнаковое число. 
+
+Функции botpTOTPStepW(), botpTOTPVerifyW() проверяют пароль в окне
+отметок t - back,..., t + ahead, учитывая расхождение часов клиента
+и сервера. Отметки перебираются в порядке t, t - 1, t + 1, t - 2,...
+Отрицательные отметки пропускаются. Возвращается отметка, на которой
+пароль подошел.
+
+Функции botpTOTPStepVMulti(), botpTOTPVerifyMulti() проверяют пакет
+паролей разных пользователей: каждый пароль проверяется на своем ключе
+и своей отметке времени. Вычисления beltHMAC для четырех паролей
+выполняются одновременно. Функция botpTOTPStepVMulti() использует
+заранее подготовленное состояние и не выделяет память.
 *******************************************************************************
 */
 
@@ -300,6 +357,27 @@ bool_t botpTOTPStepV(
 	void* state				/*!< [in,out] состояние */
 );
 
+/*!	\brief Проверка пароля в окне отметок времени в режиме TOTP
+
+	По числу digit и ключу, размещенным в state, для округленных отметок
+	времени t - back,..., t + ahead строятся одноразовые пароли из digit
+	символов. Отметки перебираются в порядке t, t - 1, t + 1, t - 2,...
+	Построенные пароли сравниваются с otp. При первом совпадении в t1
+	возвращается отметка, на которой пароль подошел (если t1 != 0).
+	\pre t != TIME_ERR.
+	\pre Отметка t + ahead представима типом tm_time_t.
+	\expect botpTOTPStart() < botpTOTPStepW()*.
+	\return TRUE, если пароль подошел, и FALSE в противном случае.
+*/
+bool_t botpTOTPStepW(
+	tm_time_t* t1,			/*!< [out] отметка совпадения */
+	const char* otp,		/*!< [in] контрольный пароль */
+	tm_time_t t,			/*!< [in] округленная отметка времени */
+	size_t back,			/*!< [in] окно в прошлое */
+	size_t ahead,			/*!< [in] окно в будущее */
+	void* state				/*!< [in,out] состояние */
+);
+
 /*!	\brief Генерация пароля в режиме TOTP
 
 	По числу digit, ключу [key_len]key и округленной отметке t текущего 
@@ -334,6 +412,77 @@ err_t botpTOTPVerify(
 	tm_time_t t				/*!< [in] округленная отметка времени */
 );
 
+/*!	\brief Проверка пароля в окне отметок времени в режиме TOTP
+
+	По ключу [key_len]key и округленным отметкам времени t - back,...,
+	t + ahead строятся одноразовые пароли из strLen(otp) символов.
+	Построенные пароли сравниваются с otp. При совпадении в t1
+	возвращается отметка, на которой пароль подошел (если t1 != 0).
+	\expect{ERR_BAD_PWD} 6 <= strLen(otp) && strLen(otp) <= 8.
+	\expect{ERR_BAD_TIME} t != TIME_ERR.
+	\expect{ERR_BAD_PWD} Пароль otp подошел.
+	\return ERR_OK в случае успеха или код ошибки.
+	\remark Ключ обрабатывается однократно (см. botpTOTPStepW()).
+*/
+err_t botpTOTPVerifyW(
+	tm_time_t* t1,			/*!< [out] отметка совпадения */
+	const char* otp,		/*!< [in] контрольный пароль */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len,			/*!< [in] длина ключа в октетах */
+	tm_time_t t,			/*!< [in] округленная отметка времени */
+	size_t back,			/*!< [in] окно в прошлое */
+	size_t ahead			/*!< [in] окно в будущее */
+);
+
+/*!	\brief Длина состояния пакетной проверки TOTP
+
+	Возвращается длина состояния (в октетах) функции botpTOTPStepVMulti().
+	\return Длина состояния.
+*/
+size_t botpTOTPMulti_keep();
+
+/*!	\brief Пакетная проверка паролей в режиме TOTP
+
+	Для i = 0, 1,..., n - 1 по ключу [key_lens[i]]keys[i] и округленной
+	отметке времени ts[i] строится одноразовый пароль из strLen(otps[i])
+	символов. Построенный пароль сравнивается с otps[i]. Признак совпадения
+	возвращается в rets[i].
+	\pre По адресу state зарезервировано botpTOTPMulti_keep() октетов.
+	\pre Буферы rets, keys, key_lens, otps, ts корректны, строки otps[i]
+	корректны.
+	\remark Если strLen(otps[i]) < 6, strLen(otps[i]) > 8 или
+	ts[i] == TIME_ERR, то rets[i] = FALSE.
+	\remark Состояние state не зависит от ключей и может использоваться
+	повторно для разных пакетов.
+*/
+void botpTOTPStepVMulti(
+	bool_t rets[],			/*!< [out] признаки совпадения */
+	size_t n,				/*!< [in] число паролей */
+	const octet* keys[],	/*!< [in] ключи */
+	const size_t key_lens[],/*!< [in] длины ключей в октетах */
+	const char* otps[],		/*!< [in] контрольные пароли */
+	const tm_time_t ts[],	/*!< [in] округленные отметки времени */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Пакетная проверка паролей в режиме TOTP с созданием состояния
+
+	Выполняется botpTOTPStepVMulti() с состоянием, которое создается
+	однократно для всего пакета.
+	\expect{ERR_BAD_INPUT} Входные буферы и строки корректны.
+	\return ERR_OK, если пароли проверены, и код ошибки в противном случае.
+	\remark При возврате ERR_OK результаты проверки паролей размещаются
+	в rets.
+*/
+err_t botpTOTPVerifyMulti(
+	bool_t rets[],			/*!< [out] признаки совпадения */
+	size_t n,				/*!< [in] число паролей */
+	const octet* keys[],	/*!< [in] ключи */
+	const size_t key_lens[],/*!< [in] длины ключей в октетах */
+	const char* otps[],		/*!< [in] контрольные пароли */
+	const tm_time_t ts[]	/*!< [in] округленные отметки времени */
+);
+
 /*!
 *******************************************************************************
 \file botp.h
@@ -363,6 +512,13 @@ strIsAlphanumeric(), decIsValid(), hexIsValid().
 длина лежит в пределах от 4 до q_max, где q_max -- максимальная длина, 
 указанная в suite. Если q -- двойной, то его длина лежит в пределах от 8 до
 2 * q_max. За подготовку составного запроса отвечает вызывающая программа.
+
+Описатель suite можно разобрать однократно с помощью функции
+botpOCRASuiteStart(). Полученный объект описателя не зависит от ключа,
+не изменяется функциями OCRA и может одновременно использоваться
+несколькими потоками. Функции botpOCRAStartS(), botpOCRARandS(),
+botpOCRAVerifyS() принимают объект описателя вместо строки и выполняют
+только ключезависимую часть инициализации.
 *******************************************************************************
 */
 
@@ -373,6 +529,25 @@ strIsAlphanumeric(), decIsValid(), hexIsValid().
 */
 size_t botpOCRA_keep();
 
+/*!	\brief Длина объекта описателя OCRA
+
+	Возвращается длина объекта описателя (в октетах).
+	\return Длина объекта описателя.
+*/
+size_t botpOCRASuite_keep();
+
+/*!	\brief Разбор описателя OCRA
+
+	Описатель suite разбирается, его параметры размещаются в объекте
+	hsuite.
+	\pre По адресу hsuite зарезервировано botpOCRASuite_keep() октетов.
+	\return TRUE, если описатель корректен, и FALSE в противном случае.
+*/
+bool_t botpOCRASuiteStart(
+	void* hsuite,			/*!< [out] объект описателя */
+	const char* suite		/*!< [in] описатель */
+);
+
 /*!	\brief Инициализация режима OCRA
 
 	По описателю suite и ключу [key_len]key в state формируются структуры данных, 
@@ -388,6 +563,22 @@ bool_t botpOCRAStart(
 	size_t key_len			/*!< [in] длина ключа в октетах */
 );
 
+/*!	\brief Инициализация режима OCRA по объекту описателя
+
+	По объекту описателя hsuite и ключу [key_len]key в state формируются
+	структуры данных, необходимые для управления паролями в режиме OCRA.
+	\pre По адресу state зарезервировано botpOCRA_keep() октетов.
+	\expect botpOCRASuiteStart(hsuite) < botpOCRAStartS().
+	\remark Вызов эквивалентен botpOCRAStart() с исходным описателем,
+	но описатель повторно не разбирается.
+*/
+void botpOCRAStartS(
+	void* state,			/*!< [out] состояние */
+	const void* hsuite,		/*!< [in] объект описателя */
+	const octet key[],		/*!< [in] ключ */
+	size_t key_len			/*!< [in] длина ключа в октетах */
+);
+
 /*!	\brief Установка данных сеанса режима OCRA
 
 	В state устанавливаются счетчик ctr, хэш-значение p статического пароля,
@@ -484,6 +675,28 @@ err_t botpOCRARand(
 	tm_time_t t			/*!< [in] округленная отметка времени */
 );
 
+/*!	\brief Генерация пароля в режиме OCRA по объекту описателя
+
+	Выполняется botpOCRARand() с описателем, заданным объектом hsuite.
+	\expect{ERR_BAD_FORMAT} Объект hsuite подготовлен botpOCRASuiteStart().
+	\expect{ERR_BAD_PARAMS} 4 <= q_len && q_len < = 2 * q_max.
+	\expect{ERR_BAD_TIME} Если suite задает использование t, то t != TIME_ERR.
+	\return ERR_OK, если пароль успешно сгенерирован, и код ошибки
+	в противном случае.
+*/
+err_t botpOCRARandS(
+	char* otp,			/*!< [out] одноразовый пароль */
+	const void* hsuite,	/*!< [in] объект описателя */
+	const octet key[],	/*!< [in] ключ */
+	size_t key_len,		/*!< [in] длина ключа в октетах */
+	const octet q[],	/*!< [in] запрос */
+	size_t q_len,		/*!< [in] длина запроса в октетах */
+	const octet ctr[8],	/*!< [in] счетчик */
+	const octet p[],	/*!< [in] хэш-значение статического пароля */
+	const octet s[],	/*!< [in] идентификатор сеанса */
+	tm_time_t t			/*!< [in] округленная отметка времени */
+);
+
 /*!	\brief Проверка пароля в режиме TOTP
 
 	По описателю suite, ключу [key_len]key, запросам [q_len]q, счетчику ctr, 
@@ -511,6 +724,28 @@ err_t botpOCRAVerify(
 	tm_time_t t			/*!< [in] округленная отметка времени */
 );
 
+/*!	\brief Проверка пароля в режиме OCRA по объекту описателя
+
+	Выполняется botpOCRAVerify() с описателем, заданным объектом hsuite.
+	\expect{ERR_BAD_FORMAT} Объект hsuite подготовлен botpOCRASuiteStart().
+	\expect{ERR_BAD_PARAMS} 4 <= q_len && q_len < = 2 * q_max.
+	\expect{ERR_BAD_TIME} Если suite задает использование t, то t != TIME_ERR.
+	\expect{ERR_BAD_PWD} Пароль otp подошел.
+	\return ERR_OK в случае успеха или код ошибки.
+*/
+err_t botpOCRAVerifyS(
+	const char* otp,	/*!< [in] контрольный пароль */
+	const void* hsuite,	/*!< [in] объект описателя */
+	const octet key[],	/*!< [in] ключ */
+	size_t key_len,		/*!< [in] длина ключа в октетах */
+	const octet q[],	/*!< [in] запрос */
+	size_t q_len,		/*!< [in] длина запроса в октетах */
+	const octet ctr[8],	/*!< [in] счетчик */
+	const octet p[],	/*!< [in] хэш-значение статического пароля */
+	const octet s[],	/*!< [in] идентификатор сеанса */
+	tm_time_t t			/*!< [in] округленная отметка времени */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
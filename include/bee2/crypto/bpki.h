@@ -4,7 +4,7 @@
 \brief STB 34.101.78 (bpki): PKI helpers
 \project bee2/apps/bpki
 \created 2021.04.03
-\version 2022.07.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -55,9 +55,44 @@ EncryptedPrivateKeyInfo будучи защищенными на обычных
 составляют случаи, когда нулевой указатель передается как запрос на определение
 объема памяти, которую требуется зарезервировать при повторном вызове
 (конструкция [len?]ptr).  
+
+Построение ключа защиты контейнера по паролю (PBKDF2) требует значительного
+времени. При многократном разборе одних и тех же контейнеров ключи защиты
+можно сохранять в кэше в памяти процесса (см. bpkiCacheStart()).
 *******************************************************************************
 */
 
+/*!	\brief Включение кэша ключей защиты
+
+	Включается кэш ключей защиты контейнеров. Ключ защиты, построенный
+	при успешном разборе контейнера функциями bpkiPrivkeyUnwrap()
+	и bpkiShareUnwrap(), сохраняется в кэше на ttl секунд. При повторном
+	разборе контейнера (с той же "солью" и тем же числом итераций PBKDF2)
+	на том же пароле ключ защиты берется из кэша. Пароли в кэше
+	не сохраняются: записи связываются с паролями с помощью меток,
+	которые вычисляются по ключу, вырабатываемому генератором rng.
+	Если кэш уже включен, то изменяется только время жизни новых записей.
+	\expect{ERR_BAD_RNG} Генератор rng (с состоянием rng_state) корректен.
+	\expect{ERR_BAD_INPUT} ttl > 0.
+	\return ERR_OK, если кэш успешно включен, и код ошибки в противном
+	случае.
+	\remark Кэш размещается в защищенной памяти (блобе) и стирается
+	при выключении кэша и при завершении программы.
+	\remark Кэш является общим для всех потоков. Функции работы с кэшем
+	потокобезопасны.
+*/
+err_t bpkiCacheStart(
+	size_t ttl,				/*!< [in] время жизни записей (в секундах) */
+	gen_i rng,				/*!< [in] генератор случайных чисел */
+	void* rng_state			/*!< [in/out] состояние генератора */
+);
+
+/*!	\brief Выключение кэша ключей защиты
+
+	Кэш ключей защиты стирается и выключается.
+*/
+void bpkiCacheStop();
+
 /*!	\brief Создание контейнера с личным ключом
 
 	Создается  контейнер [epki_len?]epki с защищенным личным ключом
@@ -4,7 +4,7 @@
 \brief STB 34.101.79 (btok): cryptographic tokens
 \project bee2 [cryptographic library]
 \created 2022.07.04
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -368,6 +368,10 @@ err_t btokCVCWrap(
 	контролируется. Неверная длина расценивается как ошибка формата.
 	\remark Длина cert должна в точности равняться cert_len. Противное
 	считается ошибкой формата.
+	\remark Если включен кэш проверенных сертификатов
+	(см. btokCVCCacheSetMax()), то результат успешного разбора сохраняется
+	в кэше, а при повторном разборе cert на том же ключе pubkey берется
+	из кэша без декодирования и проверки подписи.
 */
 err_t btokCVCUnwrap(
 	btok_cvc_t* cvc,			/*!< [out] содержание сертификата */
@@ -401,6 +405,66 @@ err_t btokCVCIss(
 	size_t privkeya_len			/*!< [in] длина privkeya в октетах */
 );
 
+/*!	\brief Длина состояния пакетного выпуска CV-сертификатов
+
+	Возвращается длина состояния (в октетах) пакетного выпуска 
+	CV-сертификатов на личном ключе издателя длины privkeya_len.
+	\pre privkeya_len == 32 || privkeya_len == 48 || privkeya_len == 64.
+	\return Длина состояния.
+*/
+size_t btokCVCIss_keep(
+	size_t privkeya_len			/*!< [in] длина личного ключа издателя */
+);
+
+/*!	\brief Начало пакетного выпуска CV-сертификатов
+
+	По сертификату [certa_len]certa и личному ключу [privkeya_len]privkeya
+	издателя инициализируется состояние state пакетного выпуска. 
+	Сертификат издателя разбирается, для уровня стойкости его ключа 
+	строится контекст bign (см. bignCtxStart()), проверяется 
+	соответствие открытого ключа из certa личному ключу privkeya.
+	\pre По адресу state зарезервировано btokCVCIss_keep(privkeya_len)
+	октетов.
+	\return ERR_OK, если состояние успешно инициализировано, и код 
+	ошибки в противном случае.
+	\remark Состояние содержит личный ключ издателя. После завершения
+	выпуска состояние следует очистить (memWipe()).
+	\remark Состояние содержит контекст bign и поэтому не может 
+	перемещаться в памяти.
+*/
+err_t btokCVCIssStart(
+	void* state,				/*!< [out] состояние */
+	const octet certa[],		/*!< [in] сертификат издателя */
+	size_t certa_len,			/*!< [in] длина certa в октетах */
+	const octet privkeya[],		/*!< [in] личный ключ издателя */
+	size_t privkeya_len			/*!< [in] длина privkeya в октетах */
+);
+
+/*!	\brief Шаг пакетного выпуска CV-сертификатов
+
+	Выпускается CV-сертификат [cert_len?]cert с содержанием cvc. 
+	Используются сертификат и личный ключ издателя, сохраненные 
+	в состоянии state. Подпись сертификата сохраняется 
+	в [cvc->sig_len]cvc->sig. Перед выпуском проверяется, что 
+	btokCVCCheck2(cvc, cvca) == ERR_OK, где cvca -- содержание 
+	сертификата издателя.
+	\expect btokCVCIssStart() < btokCVCIssStep()*.
+	\return ERR_OK, если сертификат успешно выпущен, и код ошибки 
+	в противном случае.
+	\remark Сертификат выпускается так же, как в btokCVCIss(). Но 
+	сертификат издателя не разбирается повторно, ключи 
+	издателя не проверяются повторно, а подпись вырабатывается 
+	в контексте bign.
+	\remark Состояние не изменяется, и функцию можно вызывать 
+	одновременно в нескольких потоках.
+*/
+err_t btokCVCIssStep(
+	octet cert[],				/*!< [out] сертификат */
+	size_t* cert_len,			/*!< [out] длина cert в октетах */
+	btok_cvc_t* cvc,			/*!< [in,out] содержание сертификата */
+	const void* state			/*!< [in] состояние */
+);
+
 /*!	\brief Точная длина CV-сертификата
 
 	Определяется точная длина CV-сертификата, размещенного в префиксе
@@ -474,6 +538,45 @@ err_t btokCVCVal2(
 	const octet* date			/*!< [in] дата проверки */
 );
 
+/*!	\brief Проверка цепочки CV-сертификатов
+
+	Проверяется корректность цепочки CV-сертификатов, записанных
+	последовательно в [certs_len]certs. Первый сертификат цепочки выпущен
+	доверенным издателем с содержанием cvca, каждый следующий -- владельцем
+	предыдущего. Если cvca == 0, то первый сертификат считается
+	самоподписанным, и его подпись проверяется на собственном открытом
+	ключе. Проверка завершается успешно, если:
+	- все сертификаты имеют корректный формат;
+	- для каждого сертификата и его издателя выполняются условия
+	  btokCVCCheck2();
+	- подпись каждого сертификата признается корректной на открытом ключе
+	  издателя;
+	- date попадает в срок действия последнего сертификата.
+	Указатель date может быть нулевым, и тогда последняя проверка не
+	выполняется. Указатель cvc может быть нулевым, и тогда содержание
+	последнего сертификата не возвращается.
+	\return ERR_OK, если цепочка признана корректной, и код ошибки в
+	противном случае.
+	\remark Если bad != 0, то при ошибке в bad возвращается номер (от 0)
+	первого сертификата, который не прошел проверку, либо SIZE_MAX, если
+	ошибка не относится к конкретному сертификату. При успехе bad
+	принимает значение SIZE_MAX.
+	\remark Все сертификаты разбираются однократно, а подписи, выработанные
+	на ключах одного уровня стойкости, проверяются одним обращением
+	к bignVerifyBatch(). Поэтому функция работает быстрее, чем
+	последовательность вызовов btokCVCVal2().
+	\remark Кэш проверенных сертификатов (см. btokCVCCacheSetMax())
+	не используется.
+*/
+err_t btokCVCValChain(
+	size_t* bad,				/*!< [out] номер ошибочного сертификата */
+	btok_cvc_t* cvc,			/*!< [out] содержание последнего сертификата */
+	const octet certs[],		/*!< [in] цепочка сертификатов */
+	size_t certs_len,			/*!< [in] длина certs в октетах */
+	const btok_cvc_t* cvca,		/*!< [in] содержание доверенного издателя */
+	const octet* date			/*!< [in] дата проверки */
+);
+
 /*!	\brief Проверка соответствия CV-сертификата
 
 	Проверяется соответствие между CV-сертификатом [cert_len]cert и личным
@@ -491,6 +594,223 @@ err_t btokCVCMatch(
 	size_t privkey_len			/*!< [in] длина privkey в октетах */
 );
 
+/*!	\brief Максимальный размер кэша CV-сертификатов */
+#define BTOK_CVC_CACHE_MAX 4096
+
+/*!	\brief Размер кэша CV-сертификатов
+
+	Устанавливается максимальное число max записей в кэше проверенных
+	CV-сертификатов. Кэш используется функцией btokCVCUnwrap() и,
+	следовательно, функциями btokCVCVal(), btokCVCVal2() и функциями
+	проверки сертификатов в протоколах bake. Запись кэша содержит
+	содержание сертификата и идентифицируется хэш-значением сертификата
+	и открытого ключа, на котором проверялась его подпись. При переполнении
+	вытесняется запись, к которой дольше всего не обращались.
+	Нулевое значение max отключает кэш. По умолчанию кэш отключен.
+	\return Признак успеха. Если max > BTOK_CVC_CACHE_MAX или не удалось
+	выделить память, то возвращается FALSE, а прежний кэш сохраняется.
+	\remark При изменении размера кэш очищается.
+	\remark Кэш не учитывает даты: проверка даты в btokCVCVal()
+	и btokCVCVal2() выполняется при каждом обращении.
+	\remark Отзыв сертификата или ключа издателя требует явной очистки
+	кэша с помощью функции btokCVCCacheFlush().
+*/
+bool_t btokCVCCacheSetMax(
+	size_t max					/*!< [in] максимальное число записей */
+);
+
+/*!	\brief Очистка кэша CV-сертификатов
+
+	Из кэша проверенных CV-сертификатов удаляются все записи. Размер кэша
+	не меняется.
+*/
+void btokCVCCacheFlush();
+
+/*!	\brief Длина дескриптора CV-сертификата
+
+	Возвращается длина (в октетах) дескриптора CV-сертификата.
+	\return Длина дескриптора.
+*/
+size_t btokCVCH_keep();
+
+/*!	\brief Разбор CV-сертификата в дескриптор
+
+	CV-сертификат [cert_len]cert разбирается, его содержание, основная
+	часть и результаты проверок сохраняются в дескрипторе h. Подпись
+	сертификата не проверяется.
+	\pre По адресу h зарезервировано btokCVCH_keep() октетов.
+	\return ERR_OK, если сертификат успешно разобран, и код ошибки
+	в противном случае.
+	\remark Дескриптор позволяет многократно проверять сертификат
+	(btokCVCHVal()), использовать его в качестве сертификата издателя,
+	проверять соответствие личному ключу (btokCVCHMatch()) и обращаться
+	к его содержанию (btokCVCHCvc()) без повторного разбора. Результаты
+	выполненных проверок запоминаются, и повторные проверки не повторяют
+	криптографических вычислений.
+	\remark Дескриптор не ссылается на cert и может перемещаться в памяти.
+*/
+err_t btokCVCHStart(
+	void* h,					/*!< [out] дескриптор */
+	const octet cert[],			/*!< [in] сертификат */
+	size_t cert_len				/*!< [in] длина cert в октетах */
+);
+
+/*!	\brief Содержание CV-сертификата в дескрипторе
+
+	Возвращается содержание сертификата, разобранного в дескриптор h.
+	\expect btokCVCHStart() < btokCVCHCvc().
+	\return Указатель на содержание или 0, если h некорректен.
+*/
+const btok_cvc_t* btokCVCHCvc(
+	const void* h				/*!< [in] дескриптор */
+);
+
+/*!	\brief Проверка CV-сертификата в дескрипторе
+
+	Проверяется сертификат, разобранный в дескриптор h, с использованием
+	сертификата издателя, разобранного в дескриптор ha. Проверка
+	завершается успешно, если:
+	- btokCVCCheck2(btokCVCHCvc(h), btokCVCHCvc(ha)) == ERR_OK;
+	- подпись сертификата корректна на открытом ключе ha;
+	- дата date (если date != 0) лежит в интервале действия сертификата.
+	Если ha == 0 или ha == h, то сертификат считается самоподписанным,
+	а его подпись проверяется на собственном открытом ключе.
+	\expect btokCVCHStart() < btokCVCHVal().
+	\return ERR_OK, если проверка прошла успешно, и код ошибки в противном
+	случае.
+	\remark Открытый ключ, на котором подпись проверена успешно,
+	запоминается в h. Последующие проверки на том же ключе не проверяют
+	подпись повторно.
+*/
+err_t btokCVCHVal(
+	void* h,					/*!< [in,out] дескриптор */
+	const void* ha,				/*!< [in] дескриптор издателя */
+	const octet* date			/*!< [in] дата проверки (YYMMDD) */
+);
+
+/*!	\brief Проверка соответствия CV-сертификата в дескрипторе
+
+	Проверяется соответствие сертификата, разобранного в дескриптор h,
+	личному ключу [privkey_len]privkey.
+	\expect btokCVCHStart() < btokCVCHMatch().
+	\return ERR_OK, если сертификат соответствует privkey, и код ошибки
+	в противном случае.
+	\remark Хэш-значение privkey, соответствие которому установлено,
+	запоминается в h. Повторная проверка с тем же privkey не вычисляет
+	открытый ключ. Поскольку дескриптор содержит хэш-значение личного
+	ключа, его рекомендуется очищать (memWipe()) после использования.
+*/
+err_t btokCVCHMatch(
+	void* h,					/*!< [in,out] дескриптор */
+	const octet privkey[],		/*!< [in] личный ключ */
+	size_t privkey_len			/*!< [in] длина privkey в октетах */
+);
+
+/*!	\brief Число CV-сертификатов в наборе
+
+	Определяется число сертификатов в наборе [certs_len]certs,
+	составленном из последовательно записанных (конкатенированных)
+	сертификатов.
+	\return Число сертификатов или SIZE_MAX в случае ошибки формата.
+	\remark Подписи и содержание сертификатов не проверяются.
+*/
+size_t btokCVCStoreCount(
+	const octet certs[],		/*!< [in] набор сертификатов */
+	size_t certs_len			/*!< [in] длина certs в октетах */
+);
+
+/*!	\brief Длина хранилища CV-сертификатов
+
+	Возвращается длина (в октетах) хранилища для набора из count
+	сертификатов общей длины certs_len.
+	\return Длина хранилища.
+*/
+size_t btokCVCStore_keep(
+	size_t count,				/*!< [in] число сертификатов */
+	size_t certs_len			/*!< [in] длина набора в октетах */
+);
+
+/*!	\brief Загрузка набора CV-сертификатов в хранилище
+
+	Набор сертификатов [certs_len]certs копируется в хранилище store.
+	Каждый сертификат набора разбирается в дескриптор (см. btokCVCHStart()),
+	дескрипторы индексируются по владельцу, издателю и DER-коду
+	сертификата.
+	\pre По адресу store зарезервировано
+	btokCVCStore_keep(btokCVCStoreCount(certs, certs_len), certs_len)
+	октетов.
+	\return ERR_OK, если набор успешно загружен, и код ошибки в противном
+	случае (в частности, ERR_BAD_CERT, если набор не удалось разбить
+	на сертификаты).
+	\remark Подписи сертификатов не проверяются. Проверить сертификат
+	хранилища можно функцией btokCVCHVal().
+	\remark Хранилище не ссылается на certs и может перемещаться в памяти.
+	Дескрипторы, возвращаемые функциями поиска, действительны до
+	перемещения или освобождения хранилища.
+*/
+err_t btokCVCStoreStart(
+	void* store,				/*!< [out] хранилище */
+	const octet certs[],		/*!< [in] набор сертификатов */
+	size_t certs_len			/*!< [in] длина certs в октетах */
+);
+
+/*!	\brief Поиск CV-сертификата в хранилище
+
+	В хранилище store ищется сертификат, DER-код которого совпадает
+	с [cert_len]cert.
+	\expect btokCVCStoreStart() < btokCVCStoreFind().
+	\return Дескриптор найденного сертификата или 0, если сертификат
+	не найден.
+	\remark Поиск выполняется за время, которое в среднем не зависит от
+	числа сертификатов в хранилище. Сертификат cert не разбирается.
+*/
+void* btokCVCStoreFind(
+	void* store,				/*!< [in] хранилище */
+	const octet cert[],			/*!< [in] сертификат */
+	size_t cert_len				/*!< [in] длина cert в октетах */
+);
+
+/*!	\brief Поиск CV-сертификатов хранилища по владельцу
+
+	В хранилище store ищется сертификат владельца holder, следующий
+	за сертификатом с дескриптором prev. Если prev == 0, то ищется первый
+	такой сертификат.
+	\expect btokCVCStoreStart() < btokCVCStoreByHolder().
+	\expect prev == 0 или prev -- дескриптор, ранее возвращенный функцией
+	btokCVCStoreByHolder() с тем же владельцем.
+	\return Дескриптор найденного сертификата или 0, если сертификатов
+	больше нет.
+	\remark Сертификаты одного владельца перечисляются в порядке их
+	следования в наборе.
+	\remark При построении цепочки сертификат издателя сертификата
+	с дескриптором h ищется как btokCVCStoreByHolder(store,
+	btokCVCHCvc(h)->authority, 0) и проверяется вызовом btokCVCHVal().
+*/
+void* btokCVCStoreByHolder(
+	void* store,				/*!< [in] хранилище */
+	const char* holder,			/*!< [in] владелец */
+	const void* prev			/*!< [in] предыдущий дескриптор */
+);
+
+/*!	\brief Поиск CV-сертификатов хранилища по издателю
+
+	В хранилище store ищется сертификат, выпущенный издателем authority
+	и следующий за сертификатом с дескриптором prev. Если prev == 0,
+	то ищется первый такой сертификат.
+	\expect btokCVCStoreStart() < btokCVCStoreByAuthority().
+	\expect prev == 0 или prev -- дескриптор, ранее возвращенный функцией
+	btokCVCStoreByAuthority() с тем же издателем.
+	\return Дескриптор найденного сертификата или 0, если сертификатов
+	больше нет.
+	\remark Сертификаты одного издателя перечисляются в порядке их
+	следования в наборе.
+*/
+void* btokCVCStoreByAuthority(
+	void* store,				/*!< [in] хранилище */
+	const char* authority,		/*!< [in] издатель */
+	const void* prev			/*!< [in] предыдущий дескриптор */
+);
+
 /*!
 *******************************************************************************
 \file btok.h
@@ -606,6 +926,105 @@ err_t btokSMCmdUnwrap(
 	void* state					/*!< [in,out] состояние SM */
 );
 
+/*!	\brief Снятие защиты команды на месте
+
+	Код команды [count]apdu декодируется и одновременно с него снимается
+	защита с помощью объектов SM, размещенных в state. В отличие от
+	btokSMCmdUnwrap(), данные команды не копируются: они расшифровываются
+	на месте, внутри apdu, а в cmd возвращается представление команды
+	со ссылкой cmd->cdf на расшифрованные данные. Указатель state может быть
+	нулевым, и тогда выполняется только декодирование (см. apduCmdView()),
+	код не изменяется. Указатель cmd может быть нулевым, и тогда выполняется
+	только проверка формата кода, без контроля целостности.
+	\pre По адресу state зарезервировано btokSM_keep() октетов.
+	\expect btokSMStart() < btokSMCmdUnwrapView()*.
+	\expect{ERR_BAD_APDU} Если state != 0, то в cmd->cla установлен бит 0x04
+	(признак защиты). Если state == 0, то бит снят.
+	\expect{ERR_BAD_LOGIC} Непосредственно а момент снятия защиты
+	(cmd != 0 && state != 0) счетчик SM принимает нечетное значение.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark После снятия защиты код apdu перестает быть корректным
+	защищенным кодом. При ошибке ERR_BAD_MAC фрагмент apdu с шифртекстом
+	данных команды обнуляется.
+	\remark Функция экономит две копии данных команды по сравнению со
+	связкой apduCmdDec() / btokSMCmdUnwrap().
+*/
+err_t btokSMCmdUnwrapView(
+	apdu_cmd_view_t* cmd,		/*!< [out] представление команды */
+	octet apdu[],				/*!< [in,out] код команды */
+	size_t count,				/*!< [in] длина кода команды */
+	void* state					/*!< [in,out] состояние SM */
+);
+
+/*!	\brief Кодирование и установка защиты цепочки команд с помощью SM
+
+	Команды cmds[0],..., cmds[n - 1] кодируются и защищаются с помощью
+	объектов SM, размещенных в state. Коды команд последовательно
+	записываются в буфер apdu, длина кода cmds[i] возвращается в counts[i].
+	Указатель apdu может быть нулевым, и тогда определяются только длины
+	кодов. Указатель state может быть нулевым, и тогда выполняется только
+	кодирование, без защиты.
+	\pre По адресу state зарезервировано btokSM_keep() октетов.
+	\expect btokSMStart() < btokSMCmdWrapChain()*.
+	\expect{ERR_BAD_APDU} В cmds[i]->cla снят бит 0x04 (признак защиты).
+	\expect{ERR_BAD_LOGIC} Перед установкой защиты (apdu != 0 && 
+	state != 0) счетчик SM принимает четное значение.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark Функция инкрементирует счетчик самостоятельно: команда cmds[i]
+	защищается на значении ctr + 2i + 1, где ctr -- значение счетчика
+	перед вызовом. Четные значения ctr + 2i + 2, i < n - 1, пропускаются
+	(резервируются за ответами на промежуточные команды). Таким образом,
+	вызов эквивалентен последовательности
+	\code
+		for (i = 0; i < n; ++i)
+		{
+			if (i > 0)
+				btokSMCtrInc(state);
+			btokSMCtrInc(state);
+			btokSMCmdWrap(apdu, counts + i, cmds[i], state);
+			apdu += counts[i];
+		}
+	\endcode
+	После успешного вызова счетчик принимает значение ctr + 2n - 1, ответ
+	на последнюю команду обрабатывается обычным образом.
+	\remark При ошибке обработка цепочки прекращается. Счетчик сохраняет
+	значение, на котором выполнялась защита ошибочной команды.
+*/
+err_t btokSMCmdWrapChain(
+	octet apdu[],				/*!< [out] коды команд */
+	size_t counts[],			/*!< [out] длины кодов команд */
+	const apdu_cmd_t* const cmds[],	/*!< [in] команды */
+	size_t n,					/*!< [in] число команд */
+	void* state					/*!< [in,out] состояние SM */
+);
+
+/*!	\brief Декодирование и снятие защиты цепочки команд с помощью SM
+
+	Коды команд [counts[0]]apdu, [counts[1]](apdu + counts[0]),... 
+	декодируются и одновременно с них снимается защита с помощью объектов
+	SM, размещенных в state. Результаты возвращаются в буферах cmds[0],...,
+	cmds[n - 1]. Указатель state может быть нулевым, и тогда выполняется
+	только декодирование, без снятия защиты.
+	\pre Буфер cmds[i] имеет размер не меньше того, который возвращает
+	вызов btokSMCmdUnwrap(0, &size, apdu_i, counts[i], state) для i-го кода 
+	apdu_i.
+	\pre По адресу state зарезервировано btokSM_keep() октетов.
+	\expect btokSMStart() < btokSMCmdUnwrapChain()*.
+	\expect{ERR_BAD_LOGIC} Перед снятием защиты (state != 0) счетчик SM
+	принимает четное значение.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark Счетчик обрабатывается так же, как в функции
+	btokSMCmdWrapChain(): команда с номером i снимается с защиты на значении
+	ctr + 2i + 1.
+*/
+err_t btokSMCmdUnwrapChain(
+	apdu_cmd_t* const cmds[],	/*!< [out] команды */
+	const octet apdu[],			/*!< [in] коды команд */
+	const size_t counts[],		/*!< [in] длины кодов команд */
+	size_t n,					/*!< [in] число команд */
+	void* state					/*!< [in,out] состояние SM */
+);
+
 /*!	\brief Кодирование и установка защиты ответа с помощью SM
 
 	Ответ resp кодируется и защищается с помощью объектов SM, размещенных
@@ -646,6 +1065,31 @@ err_t btokSMRespUnwrap(
 	void* state					/*!< [in,out] состояние SM */
 );
 
+/*!	\brief Снятие защиты ответа на месте
+
+	Код ответа [count]apdu декодируется и одновременно с него снимается
+	защита с помощью объектов SM, размещенных в state. Данные ответа
+	расшифровываются на месте, внутри apdu, а в resp возвращается
+	представление ответа со ссылкой resp->rdf на расшифрованные данные.
+	Указатель state может быть нулевым, и тогда выполняется только
+	декодирование (см. apduRespView()), код не изменяется. Указатель resp
+	может быть нулевым, и тогда выполняется только проверка формата кода,
+	без контроля целостности.
+	\pre По адресу state зарезервировано btokSM_keep() октетов.
+	\expect btokSMStart() < btokSMRespUnwrapView()*.
+	\expect{ERR_BAD_LOGIC} Непосредственно а момент снятия защиты
+	(resp != 0 && state != 0) счетчик SM принимает четное значение.
+	\return ERR_OK в случае успеха и код ошибки в противном случае.
+	\remark Имитовставка проверяется до расшифрования. При ошибке
+	ERR_BAD_MAC код apdu не изменяется.
+*/
+err_t btokSMRespUnwrapView(
+	apdu_resp_view_t* resp,		/*!< [out] представление ответа */
+	octet apdu[],				/*!< [in,out] код ответа */
+	size_t count,				/*!< [in] длина кода ответа */
+	void* state					/*!< [in,out] состояние SM */
+);
+
 /*!
 *******************************************************************************
 \file btok.h
@@ -712,6 +1156,69 @@ err_t btokBAuthTStart(
 	const bake_cert* cert			/*!< [in] сертификат */
 );
 
+/*!	\brief Длина контекста терминала BAUTH
+
+	Определяется длина контекста (в октетах), который терминал использует
+	для запуска сеансов протокола BAUTH на уровне стойкости l.
+	\return Длина контекста.
+*/
+size_t btokBAuthTCtx_keep(
+	size_t l						/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Построение контекста терминала BAUTH
+
+	По параметрам params, личному ключу [l / 4]privkey и сертификату cert
+	соответствующего открытого ключа в ctx формируются данные, которые
+	разделяются сеансами протокола BAUTH на стороне T: описание
+	эллиптической кривой, личный ключ, его перекодированное представление
+	и таблица предвычислений для базовой точки. Сертификат cert проверяется
+	один раз, при построении контекста.
+	\pre По адресу ctx зарезервировано btokBAuthTCtx_keep() октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\expect{ERR_BAD_CERT} Сертификат cert корректен.
+	\expect Ключ privkey и сертификат cert согласованы.
+	\return ERR_OK, если контекст успешно построен, и код ошибки
+	в противном случае.
+	\remark Контекст не изменяется сеансами и может использоваться
+	несколькими сеансами одновременно, в том числе в разных потоках.
+*/
+err_t btokBAuthTCtxStart(
+	void* ctx,						/*!< [out] контекст */
+	const bign_params* params,		/*!< [in] долговременные параметры */
+	const octet privkey[],			/*!< [in] личный ключ */
+	const bake_cert* cert			/*!< [in] сертификат */
+);
+
+/*!	\brief Запуск сеанса BAUTH на стороне Т в контексте
+
+	По контексту ctx и настройкам settings в state формируются структуры
+	данных, необходимые для выполнения протокола BAUTH на стороне T.
+	Состояние state ссылается на ctx и используется функциями
+	btokBAuthTStep3(), btokBAuthTStep5(), btokBAuthTStepG() так же, как
+	состояние, построенное функцией btokBAuthTStart(). При этом на шаге 3
+	используется перекодированный личный ключ, а на шаге 5 -- таблица
+	предвычислений контекста.
+	\pre По адресу state зарезервировано btokBAuthT_keep() октетов.
+	\expect{ERR_BAD_INPUT} Контекст ctx построен функцией
+	btokBAuthTCtxStart().
+	\expect{ERR_BAD_INPUT} settings->kca == TRUE.
+	\expect{ERR_BAD_INPUT} Указатель settings->helloa нулевой, либо буфер
+	[settings->helloa_len]settings->helloa корректен. Аналогичное требование
+	касается полей settings->hellob, settings->hellob_len.
+	\expect{ERR_BAD_RNG} Генератор settings->rng (с состоянием
+	settings->rng_state) корректен.
+	\expect Контекст ctx остается корректным и постоянным на протяжении
+	всего выполнения протокола.
+	\return ERR_OK, если сеанс успешно запущен, и код ошибки
+	в противном случае.
+*/
+err_t btokBAuthTCtxSession(
+	void* state,					/*!< [out] состояние */
+	const void* ctx,				/*!< [in] контекст */
+	const bake_settings* settings	/*!< [in] настройки */
+);
+
 /*!	\brief Длина состояния функций BAUTH на стороне КТ
 
 	Определяется длина состояния (в октетах) функций протокола BAUTH на
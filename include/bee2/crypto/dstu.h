@@ -4,7 +4,7 @@
 \brief DSTU 4145-2002 (Ukraine): digital signature algorithms
 \project bee2 [cryptographic library]
 \created 2012.04.27
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -170,6 +170,30 @@ err_t dstuValPoint(
 	const octet point[]				/*!< [in] проверяемая точка */
 );
 
+/*!	\brief Пакетная проверка точек
+
+	Проверяется, что точки [count * 2 * no]points эллиптической кривой,
+	заданной долговременными параметрами params, удовлетворяют требованиям
+	ДСТУ (no -- длина координаты точки в октетах). Точки записаны
+	последовательно. Результаты проверки возвращаются в битовой карте
+	[(count + 7) / 8]valid: бит i % 8 октета valid[i / 8] равняется 1,
+	если i-я точка корректна, и 0 в противном случае. Неиспользуемые биты
+	последнего октета обнуляются.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если все точки корректны, ERR_BAD_POINT, если
+	некорректна хотя бы одна точка, и другой код ошибки, если проверка
+	не проводилась.
+	\remark Точки проверяются так же, как в dstuValPoint(). Ускорение по
+	сравнению с вызовами dstuValPoint() достигается за счет однократной
+	подготовки описания кривой и памяти.
+*/
+err_t dstuValPointBatch(
+	octet valid[],					/*!< [out] битовая карта */
+	const dstu_params* params,		/*!< [in] долговременные параметры */
+	size_t count,					/*!< [in] число точек */
+	const octet points[]			/*!< [in] проверяемые точки */
+);
+
 /*!	\brief Сжатие точки
 
 	Точка point эллиптической кривой, заданной долговременными
@@ -279,6 +303,156 @@ err_t dstuVerify(
 	const octet pubkey[]			/*!< [in] открытый ключ */
 );
 
+/*
+*******************************************************************************
+Контекст
+
+Контекст содержит описание эллиптической кривой (базовое поле, кривую,
+базовую точку и ее порядок), построенное по долговременным параметрам,
+и таблицу предвычисленных кратных базовой точки. Контекст создается 
+один раз и затем используется функциями dstuCtxXXX(), которые являются 
+аналогами функций dstuXXX(). Функции dstuCtxXXX() не перестраивают 
+описание кривой, а лишь выделяют память для стека.
+
+Кратные базовой точки (при выработке ключей и подписей) функции
+dstuCtxXXX() определяют по таблице предвычислений гребенчатым методом, 
+точки таблицы выбираются регулярно. При проверке подписи кратная базовой 
+точки и кратная открытого ключа определяются в одном цикле удвоений.
+
+Контекст создается по следующей схеме:
+-	определить длину контекста с помощью функции dstuCtx_keep();
+-	подготовить память для контекста;
+-	инициализировать контекст с помощью функции dstuCtxStart().
+.
+
+Функции dstuCtxXXX() не изменяют контекст. Поэтому один контекст может
+одновременно использоваться в нескольких потоках.
+
+Контекст содержит ссылки на собственные фрагменты. Поэтому контекст нельзя
+перемещать в памяти или копировать.
+
+\expect{ERR_BAD_INPUT} Контекст ctx инициализирован с помощью dstuCtxStart().
+*******************************************************************************
+*/
+
+/*!	\brief Длина контекста
+
+	Возвращается длина контекста (в октетах) для базового поля GF(2^m).
+	\pre 160 <= m <= 509.
+	\return Длина контекста.
+*/
+size_t dstuCtx_keep(
+	size_t m						/*!< [in] степень расширения */
+);
+
+/*!	\brief Инициализация контекста
+
+	По долговременным параметрам params инициализируется контекст ctx.
+	\pre По адресу ctx зарезервировано dstuCtx_keep(params->p[0]) октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если контекст успешно инициализирован, и код ошибки
+	в противном случае.
+	\remark Проводится та же минимальная проверка параметров, что и
+	в функциях dstuXXX(). Полная проверка выполняется функцией 
+	dstuValParams().
+*/
+err_t dstuCtxStart(
+	void* ctx,						/*!< [out] контекст */
+	const dstu_params* params		/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Генерация пары ключей в контексте
+
+	Аналог dstuGenKeypair() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t dstuCtxGenKeypair(
+	octet privkey[],				/*!< [out] личный ключ */
+	octet pubkey[],					/*!< [out] открытый ключ */
+	const void* ctx,				/*!< [in] контекст */
+	gen_i rng,						/*!< [in] генератор случайных чисел */
+	void* rng_state					/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Выработка ЭЦП в контексте
+
+	Аналог dstuSign() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t dstuCtxSign(
+	octet sig[],					/*!< [out] подпись */
+	const void* ctx,				/*!< [in] контекст */
+	size_t ld,						/*!< [in] длина подписи в битах */
+	const octet hash[],				/*!< [in] хэш-значение */
+	size_t hash_len,				/*!< [in] длина хэш-значения в октетах */
+	const octet privkey[],			/*!< [in] личный ключ */
+	gen_i rng,						/*!< [in] генератор случайных чисел */
+	void* rng_state					/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Проверка ЭЦП в контексте
+
+	Аналог dstuVerify() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t dstuCtxVerify(
+	const void* ctx,				/*!< [in] контекст */
+	size_t ld,						/*!< [in] длина подписи в битах */
+	const octet hash[],				/*!< [in] хэш-значение */
+	size_t hash_len,				/*!< [in] длина хэш-значения в октетах */
+	const octet sig[],				/*!< [in] подпись */
+	const octet pubkey[]			/*!< [in] открытый ключ */
+);
+
+/*
+*******************************************************************************
+Пакетная проверка подписи
+*******************************************************************************
+*/
+
+/*!	\brief Пакетная проверка ЭЦП
+
+	Проверяются подписи [count * ld / 8]sigs сообщений с хэш-значениями
+	[count * hash_len]hashes. При проверке используются долговременные
+	параметры params и открытые ключи в сжатом представлении 
+	[count * O_OF_B(m)]xpubkeys, где m -- степень расширения базового поля.
+	i-ая подпись проверяется на i-ом открытом ключе. Если codes != 0, то
+	в codes[i] возвращается результат проверки i-ой подписи.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если все подписи корректны, и код ошибки первой 
+	некорректной подписи в противном случае. Если codes == 0, то проверка 
+	прекращается после обнаружения первой некорректной подписи.
+	\remark Открытые ключи восстанавливаются порциями (см. dstuRecoverPoint()),
+	при этом обращения в базовом поле выполняются одновременно для всех 
+	ключей порции.
+*/
+err_t dstuVerifyBatch(
+	const dstu_params* params,		/*!< [in] долговременные параметры */
+	size_t ld,						/*!< [in] длина подписи в битах */
+	size_t count,					/*!< [in] число подписей */
+	const octet hashes[],			/*!< [in] хэш-значения */
+	size_t hash_len,				/*!< [in] длина хэш-значения в октетах */
+	const octet sigs[],				/*!< [in] подписи */
+	const octet xpubkeys[],			/*!< [in] сжатые открытые ключи */
+	err_t codes[]					/*!< [out] результаты проверки */
+);
+
+/*!	\brief Пакетная проверка ЭЦП в контексте
+
+	Аналог dstuVerifyBatch() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t dstuCtxVerifyBatch(
+	const void* ctx,				/*!< [in] контекст */
+	size_t ld,						/*!< [in] длина подписи в битах */
+	size_t count,					/*!< [in] число подписей */
+	const octet hashes[],			/*!< [in] хэш-значения */
+	size_t hash_len,				/*!< [in] длина хэш-значения в октетах */
+	const octet sigs[],				/*!< [in] подписи */
+	const octet xpubkeys[],			/*!< [in] сжатые открытые ключи */
+	err_t codes[]					/*!< [out] результаты проверки */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
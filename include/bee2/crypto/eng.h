@@ -0,0 +1,170 @@
+/*
+*******************************************************************************
+\file eng.h
+\brief Engines: offloading belt and bign to external implementations
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+/*!
+*******************************************************************************
+\file eng.h
+\brief Движки: передача belt и bign внешним реализациям
+*******************************************************************************
+*/
+
+#ifndef __BEE2_ENG_H
+#define __BEE2_ENG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bee2/defs.h"
+#include "bee2/crypto/bign.h"
+
+/*!
+*******************************************************************************
+\file eng.h
+
+Движок -- это таблица функций (перехватчиков), которые реализуют
+алгоритмы belt и bign вне библиотеки: на криптографическом ускорителе,
+в HSM (например, через интерфейс PKCS#11) и т.д. Движок регистрируется
+функцией engReg() и назначается действующим функцией engSelect().
+
+Высокоуровневые функции библиотеки обращаются к перехватчикам
+действующего движка:
+-	beltECBEncr(), beltECBDecr() -- к belt_ecb_encr, belt_ecb_decr;
+-	beltCBCEncr(), beltCBCDecr() -- к belt_cbc_encr, belt_cbc_decr;
+-	beltCTR() -- к belt_ctr;
+-	beltMAC() -- к belt_mac;
+-	beltHash() -- к belt_hash;
+-	bignSign() -- к bign_sign;
+-	bignVerify() -- к bign_verify;
+-	bignDH() -- к bign_dh.
+.
+Первым параметром перехватчику передается состояние движка state,
+остальные параметры повторяют параметры высокоуровневой функции и
+передаются без предварительной проверки: перехватчик проверяет их сам
+(перехватчики эталонного движка делают это так же, как программные
+реализации). Код ошибки, возвращаемый перехватчиком, возвращается и
+высокоуровневой функцией. Если перехватчик отсутствует (нулевой
+указатель) или возвращает ERR_NOT_IMPLEMENTED (например, движок не
+поддерживает запрошенную длину ключа или уровень стойкости), то
+выполняется программная реализация библиотеки. Тем самым прикладные
+программы переводятся на движок без изменения вызовов.
+
+Дополнительно движок может предоставить источник случайности rng_read.
+При назначении движка этот источник передается функции rngCreate():
+его данные добавляются к энтропийным данным штатного генератора
+rngStepR(). При смене движка генератор освобождается через rngClose().
+
+Функции низкого уровня (beltBlockEncr(), связки Start/Step и т.д.)
+движками не перехватываются.
+
+В библиотеку встроен эталонный программный движок "soft" (см. engSoft()),
+который реализует все перехватчики средствами библиотеки. Эталонный
+движок служит образцом при разработке движков и точкой отсчета при
+сравнении их производительности.
+
+\pre Регистрация и назначение движков выполняются до того, как
+высокоуровневые функции начнут вызываться в нескольких потоках.
+Перехватчики действующего движка должны быть потокобезопасными.
+*******************************************************************************
+*/
+
+/*!	\brief Движок */
+typedef struct
+{
+	const char* name;		/*!< имя движка */
+	void* state;			/*!< состояние движка */
+	/*! \brief Перехватчик beltECBEncr() */
+	err_t (*belt_ecb_encr)(void* state, void* dest, const void* src,
+		size_t count, const octet key[], size_t len);
+	/*! \brief Перехватчик beltECBDecr() */
+	err_t (*belt_ecb_decr)(void* state, void* dest, const void* src,
+		size_t count, const octet key[], size_t len);
+	/*! \brief Перехватчик beltCBCEncr() */
+	err_t (*belt_cbc_encr)(void* state, void* dest, const void* src,
+		size_t count, const octet key[], size_t len, const octet iv[16]);
+	/*! \brief Перехватчик beltCBCDecr() */
+	err_t (*belt_cbc_decr)(void* state, void* dest, const void* src,
+		size_t count, const octet key[], size_t len, const octet iv[16]);
+	/*! \brief Перехватчик beltCTR() */
+	err_t (*belt_ctr)(void* state, void* dest, const void* src,
+		size_t count, const octet key[], size_t len, const octet iv[16]);
+	/*! \brief Перехватчик beltMAC() */
+	err_t (*belt_mac)(void* state, octet mac[8], const void* src,
+		size_t count, const octet key[], size_t len);
+	/*! \brief Перехватчик beltHash() */
+	err_t (*belt_hash)(void* state, octet hash[32], const void* src,
+		size_t count);
+	/*! \brief Перехватчик bignSign() */
+	err_t (*bign_sign)(void* state, octet sig[], const bign_params* params,
+		const octet oid_der[], size_t oid_len, const octet hash[],
+		const octet privkey[], gen_i rng, void* rng_state);
+	/*! \brief Перехватчик bignVerify() */
+	err_t (*bign_verify)(void* state, const bign_params* params,
+		const octet oid_der[], size_t oid_len, const octet hash[],
+		const octet sig[], const octet pubkey[]);
+	/*! \brief Перехватчик bignDH() */
+	err_t (*bign_dh)(void* state, octet key[], const bign_params* params,
+		const octet privkey[], const octet pubkey[], size_t key_len);
+	read_i rng_read;		/*!< источник случайности (с состоянием state) */
+} eng_t;
+
+/*!	\brief Регистрация движка
+
+	Регистрируется движок eng.
+	\expect{ERR_BAD_INPUT} Имя eng->name непусто и содержит не более 16
+	символов.
+	\return ERR_OK, если движок зарегистрирован, и код ошибки в противном
+	случае (в частности, ERR_BAD_INPUT, если движок с таким же именем уже
+	зарегистрирован, и ERR_OUTOFMEMORY, если исчерпан лимит
+	регистраций).
+	\remark Таблица eng не копируется и должна оставаться доступной на
+	протяжении всего времени работы с движком.
+	\remark Эталонный движок "soft" регистрировать не нужно.
+*/
+err_t engReg(
+	const eng_t* eng		/*!< [in] движок */
+);
+
+/*!	\brief Назначение движка
+
+	Действующим назначается зарегистрированный движок с именем name.
+	Если name == 0, то действующий движок снимается и высокоуровневые
+	функции выполняют только программные реализации.
+	\return ERR_OK, если движок назначен, и код ошибки в противном случае
+	(в частности, ERR_BAD_INPUT, если движок не найден).
+	\remark Если движок предоставляет источник rng_read, то источник
+	подключается к штатному генератору (см. rngCreate()). Ошибка
+	подключения приводит к ошибке назначения.
+*/
+err_t engSelect(
+	const char* name		/*!< [in] имя движка */
+);
+
+/*!	\brief Действующий движок
+
+	Возвращается действующий движок.
+	\return Действующий движок или 0, если движок не назначен.
+*/
+const eng_t* engActive();
+
+/*!	\brief Эталонный программный движок
+
+	Возвращается эталонный движок "soft".
+	\return Эталонный движок.
+*/
+const eng_t* engSoft();
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_ENG_H */
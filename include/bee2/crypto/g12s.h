@@ -4,7 +4,7 @@
 \brief GOST R 34.10-94 (Russia): digital signature algorithms
 \project bee2 [cryptographic library]
 \created 2012.04.27
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -225,6 +225,161 @@ err_t g12sVerify(
 	const octet pubkey[]		/*!< [in] открытый ключ */
 );
 
+/*!
+*******************************************************************************
+\file g12s.h
+
+\section g12s-ctx Контекст
+
+Контекст содержит описание эллиптической кривой, построенное по
+долговременным параметрам, и таблицу предвычисленных кратных базовой 
+точки P. Контекст создается один раз и затем используется функциями 
+g12sCtxXXX(), которые являются аналогами функций g12sXXX(). Функции 
+g12sCtxXXX() не перестраивают описание кривой, а лишь выделяют память
+для стека.
+
+Кратные P (при выработке ключей и подписей) функции g12sCtxXXX() определяют
+по таблице предвычислений гребенчатым методом, точки таблицы выбираются
+регулярно. При проверке подписи кратная P по таблице и кратная открытого 
+ключа определяются в одном цикле удвоений.
+
+Контекст создается по следующей схеме:
+-	определить длину контекста с помощью функции g12sCtx_keep();
+-	подготовить память для контекста;
+-	инициализировать контекст с помощью функции g12sCtxStart().
+.
+
+Контекст можно сохранить в образ функцией g12sCtxSave() и затем 
+загружать функцией g12sCtxLoad() без повторного построения таблицы 
+предвычислений (см. bign.h).
+
+Функции g12sCtxXXX() не изменяют контекст. Поэтому один контекст может
+одновременно использоваться в нескольких потоках.
+
+Контекст содержит ссылки на собственные фрагменты. Поэтому контекст нельзя
+перемещать в памяти или копировать. Память контекста освобождается
+вызывающей программой после завершения работы со всеми функциями,
+которые его используют.
+
+\expect{ERR_BAD_INPUT} Контекст ctx инициализирован с помощью g12sCtxStart().
+*******************************************************************************
+*/
+
+/*!	\brief Длина контекста
+
+	Возвращается длина контекста (в октетах) для уровня стойкости l.
+	\pre l == 256 || l == 512.
+	\return Длина контекста.
+*/
+size_t g12sCtx_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Инициализация контекста
+
+	По долговременным параметрам params инициализируется контекст ctx.
+	\pre По адресу ctx зарезервировано g12sCtx_keep(params->l) октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если контекст успешно инициализирован, и код ошибки
+	в противном случае.
+	\remark Проводится та же минимальная проверка параметров, что и
+	в функциях g12sXXX(). Полная проверка выполняется функцией 
+	g12sValParams().
+*/
+err_t g12sCtxStart(
+	void* ctx,					/*!< [out] контекст */
+	const g12s_params* params	/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Сохранение контекста
+
+	Контекст ctx сохраняется в образ [count]image, который может быть 
+	загружен функцией g12sCtxLoad(). Если image == 0, то определяется 
+	только длина образа count.
+	\return ERR_OK, если образ успешно построен, и код ошибки в противном 
+	случае.
+	\remark Формат образа такой же, как в bignCtxSave().
+*/
+err_t g12sCtxSave(
+	octet image[],				/*!< [out] образ */
+	size_t* count,				/*!< [out] длина образа */
+	const void* ctx				/*!< [in] контекст */
+);
+
+/*!	\brief Длина загружаемого контекста
+
+	Возвращается длина контекста (в октетах), который загружается 
+	функцией g12sCtxLoad() для уровня стойкости l.
+	\pre l == 256 || l == 512.
+	\return Длина контекста.
+*/
+size_t g12sCtxLoad_keep(
+	size_t l					/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Загрузка контекста
+
+	По долговременным параметрам params и образу [count]image, построенному
+	функцией g12sCtxSave(), инициализируется контекст ctx. Контекст 
+	ссылается на таблицу предвычислений внутри образа.
+	\pre По адресу ctx зарезервировано g12sCtxLoad_keep(params->l) октетов.
+	\expect{ERR_BAD_INPUT} Адрес image выровнен на границу машинного слова.
+	\expect{ERR_BAD_FORMAT} Образ построен для params->l на платформе
+	с такими же длиной машинного слова и порядком октетов, версия формата 
+	поддерживается.
+	\expect{ERR_BAD_HASH} Контрольное хэш-значение образа корректно.
+	\expect{ERR_BAD_PARAMS} Образ построен для параметров params.
+	\return ERR_OK, если контекст успешно загружен, и код ошибки в 
+	противном случае.
+	\remark Образ должен оставаться доступным, пока используется контекст
+	(см. также bignCtxLoad()).
+*/
+err_t g12sCtxLoad(
+	void* ctx,					/*!< [out] контекст */
+	const g12s_params* params,	/*!< [in] долговременные параметры */
+	const octet image[],		/*!< [in] образ */
+	size_t count				/*!< [in] длина образа */
+);
+
+/*!	\brief Генерация пары ключей в контексте
+
+	Аналог g12sGenKeypair() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t g12sCtxGenKeypair(
+	octet privkey[],			/*!< [out] личный ключ */
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Выработка ЭЦП в контексте
+
+	Аналог g12sSign() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t g12sCtxSign(
+	octet sig[],				/*!< [out] подпись */
+	const void* ctx,			/*!< [in] контекст */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet privkey[],		/*!< [in] личный ключ */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Проверка ЭЦП в контексте
+
+	Аналог g12sVerify() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t g12sCtxVerify(
+	const void* ctx,			/*!< [in] контекст */
+	const octet hash[],			/*!< [in] хэш-значение */
+	const octet sig[],			/*!< [in] подпись */
+	const octet pubkey[]		/*!< [in] открытый ключ */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
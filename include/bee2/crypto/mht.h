@@ -0,0 +1,314 @@
+/*
+*******************************************************************************
+\file mht.h
+\brief Merkle hash trees over belt-hash and bash
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+/*!
+*******************************************************************************
+\file mht.h
+\brief Хэш-деревья Меркла на основе belt-hash и bash
+*******************************************************************************
+*/
+
+#ifndef __BEE2_MHT_H
+#define __BEE2_MHT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bee2/defs.h"
+
+/*!
+*******************************************************************************
+\file mht.h
+
+\section mht-common Общие положения
+
+Реализованы хэш-деревья Меркла в редакции RFC 9162 (Certificate
+Transparency 2.0). Дерево строится над упорядоченным списком записей
+D[n] = (d_0, d_1,..., d_{n - 1}). Хэш-значение дерева (корень) MTH
+определяется рекурсивно:
+-	MTH({}) = H(пустое слово);
+-	MTH({d_0}) = H(00 || d_0) (хэш-значение листа);
+-	MTH(D[n]) = H(01 || MTH(D[0:k]) || MTH(D[k:n])), где k -- наибольшая
+	степень двойки, меньшая n.
+.
+Здесь H -- алгоритм хэширования, который задается идентификатором alg:
+-	MHT_BELT -- belt-hash (32 октета хэш-значения);
+-	l, где l > 0 && l % 16 == 0 && l <= 256, -- bash уровня стойкости l
+	(l / 4 октетов хэш-значения).
+.
+Функции mhtStart(), mhtAppend(), mhtAppendH(), mhtRoot() поддерживают
+растущее дерево (например, журнал прозрачности). Состояние дерева -- это
+его фронт: число листьев n и корни полных поддеревьев, соответствующих
+единичным битам n. Добавление листа требует O(log n) хэширований, фронт
+занимает O(log n) хэш-значений и сохраняется компактно функцией mhtSave().
+
+Функции mhtRootOf(), mhtProve(), mhtProveC() работают с полным списком
+хэш-значений листьев, который хранит владелец журнала. Функции mhtVerify()
+и mhtVerifyC() проверяют доказательства включения записи в дерево и
+согласованности двух версий дерева (RFC 9162, 2.1.3, 2.1.4).
+
+Внутренние узлы одного уровня хэшируются пакетами с помощью функций
+beltHashMulti() и bashHashMulti(), которые обрабатывают несколько сообщений
+одновременно. Хэш-значения листьев вычисляются последовательно.
+
+\expect{ERR_BAD_INPUT} Все входные указатели корректны.
+*******************************************************************************
+*/
+
+#define MHT_BELT		((size_t)0)	/*!< belt-hash */
+#define MHT_HASH_MAX	64			/*!< максимальная длина хэш-значения */
+
+/*!	\brief Длина хэш-значения
+
+	Определяется длина (в октетах) хэш-значения алгоритма alg.
+	\return Длина хэш-значения или SIZE_MAX, если идентификатор alg
+	недопустим.
+*/
+size_t mhtHashLen(
+	size_t alg				/*!< [in] алгоритм хэширования */
+);
+
+/*!	\brief Хэш-значение листа
+
+	Определяется хэш-значение листа H(00 || [count]src), построенное
+	с помощью алгоритма alg.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\return ERR_OK, если хэш-значение определено, и код ошибки
+	в противном случае.
+*/
+err_t mhtLeaf(
+	octet hash[],			/*!< [out] хэш-значение листа */
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const void* src,		/*!< [in] запись */
+	size_t count			/*!< [in] длина записи в октетах */
+);
+
+/*!
+*******************************************************************************
+\file mht.h
+
+\section mht-tree Растущее дерево
+*******************************************************************************
+*/
+
+/*!	\brief Длина состояния
+
+	Возвращается длина состояния (в октетах) растущего дерева.
+	\return Длина состояния.
+*/
+size_t mht_keep();
+
+/*!	\brief Инициализация
+
+	В state формируется пустое дерево с алгоритмом хэширования alg.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\return ERR_OK, если дерево создано, и код ошибки в противном случае.
+	\remark По адресу state должно быть зарезервировано mht_keep() октетов.
+*/
+err_t mhtStart(
+	void* state,			/*!< [out] состояние */
+	size_t alg				/*!< [in] алгоритм хэширования */
+);
+
+/*!	\brief Добавление листьев по хэш-значениям
+
+	В дерево state добавляются n листьев с хэш-значениями leaves.
+	\expect{ERR_BAD_INPUT} Буфер leaves содержит n хэш-значений.
+	\return ERR_OK, если листья добавлены, и код ошибки в противном случае
+	(в частности, ERR_BAD_INPUT, если число листьев превысит SIZE_MAX).
+	\remark Для добавления пакета из n листьев требуется менее
+	n + log n хэширований внутренних узлов. Узлы одного уровня
+	хэшируются одновременно.
+	\remark При ошибке дерево не изменяется.
+*/
+err_t mhtAppendH(
+	void* state,			/*!< [in,out] состояние */
+	const octet leaves[],	/*!< [in] хэш-значения листьев */
+	size_t n				/*!< [in] число листьев */
+);
+
+/*!	\brief Добавление записей
+
+	В дерево state добавляются листья, построенные по записям
+	[count[i]]src[i], i = 0, 1,..., n - 1.
+	\expect{ERR_BAD_INPUT} Буферы src, count, src[i] корректны.
+	\return ERR_OK, если листья добавлены, и код ошибки в противном случае.
+	\remark Хэш-значения листьев вычисляются функцией mhtLeaf(), после чего
+	листья добавляются функцией mhtAppendH().
+*/
+err_t mhtAppend(
+	void* state,			/*!< [in,out] состояние */
+	const void* src[],		/*!< [in] записи */
+	const size_t count[],	/*!< [in] длины записей */
+	size_t n				/*!< [in] число записей */
+);
+
+/*!	\brief Число листьев
+
+	Определяется число листьев дерева state.
+	\return Число листьев.
+*/
+size_t mhtSize(
+	const void* state		/*!< [in] состояние */
+);
+
+/*!	\brief Корень
+
+	Определяется корень root дерева state.
+	\return ERR_OK, если корень определен, и код ошибки в противном
+	случае.
+	\remark Корень содержит mhtHashLen(alg) октетов.
+*/
+err_t mhtRoot(
+	octet root[],			/*!< [out] корень */
+	const void* state		/*!< [in] состояние */
+);
+
+/*!	\brief Сохранение фронта
+
+	Фронт дерева state сохраняется в буфере buf. Если buf == 0, то
+	определяется только длина сохраненного фронта.
+	\return Длина сохраненного фронта в октетах.
+	\remark Длина равняется 11 + w * mhtHashLen(alg), где w -- число
+	единичных битов в числе листьев.
+*/
+size_t mhtSave(
+	octet buf[],			/*!< [out] сохраненный фронт */
+	const void* state		/*!< [in] состояние */
+);
+
+/*!	\brief Восстановление фронта
+
+	Дерево state восстанавливается по фронту [count]buf, подготовленному
+	функцией mhtSave().
+	\return ERR_OK, если дерево восстановлено, ERR_BAD_FORMAT, если
+	формат buf не распознан, и код ошибки в других случаях.
+	\remark По адресу state должно быть зарезервировано mht_keep() октетов.
+*/
+err_t mhtLoad(
+	void* state,			/*!< [out] состояние */
+	const octet buf[],		/*!< [in] сохраненный фронт */
+	size_t count			/*!< [in] длина buf в октетах */
+);
+
+/*!
+*******************************************************************************
+\file mht.h
+
+\section mht-proof Доказательства
+
+Доказательство -- это список хэш-значений, записанных подряд. Длина
+доказательства задается числом хэш-значений и не превышает B_PER_S + 1.
+Доказательство включения записи m в дерево D[n] строится по правилу
+PATH(m, D[n]), доказательство согласованности деревьев D[m] и D[n] -- по
+правилу PROOF(m, D[n]) (RFC 9162, 2.1.3.1, 2.1.4.1).
+*******************************************************************************
+*/
+
+/*!	\brief Корень по листьям
+
+	Определяется корень root дерева с хэш-значениями листьев [n]leaves.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\return ERR_OK, если корень определен, и код ошибки в противном
+	случае.
+*/
+err_t mhtRootOf(
+	octet root[],			/*!< [out] корень */
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const octet leaves[],	/*!< [in] хэш-значения листьев */
+	size_t n				/*!< [in] число листьев */
+);
+
+/*!	\brief Построение доказательства включения
+
+	Для дерева с хэш-значениями листьев [n]leaves строится доказательство
+	[*len]proof включения листа с номером index. Если proof == 0, то
+	определяется только длина доказательства.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\expect{ERR_BAD_INPUT} index < n.
+	\return ERR_OK, если доказательство построено, и код ошибки
+	в противном случае.
+*/
+err_t mhtProve(
+	octet proof[],			/*!< [out] доказательство */
+	size_t* len,			/*!< [out] число хэш-значений в proof */
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const octet leaves[],	/*!< [in] хэш-значения листьев */
+	size_t n,				/*!< [in] число листьев */
+	size_t index			/*!< [in] номер листа */
+);
+
+/*!	\brief Проверка доказательства включения
+
+	Проверяется доказательство [len]proof того, что лист с хэш-значением
+	leaf имеет номер index в дереве из n листьев с корнем root.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\expect{ERR_BAD_INPUT} index < n.
+	\return ERR_OK, если доказательство верно, ERR_BAD_HASH, если
+	доказательство неверно, и код ошибки в других случаях.
+*/
+err_t mhtVerify(
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const octet root[],		/*!< [in] корень */
+	size_t n,				/*!< [in] число листьев */
+	size_t index,			/*!< [in] номер листа */
+	const octet leaf[],		/*!< [in] хэш-значение листа */
+	const octet proof[],	/*!< [in] доказательство */
+	size_t len				/*!< [in] число хэш-значений в proof */
+);
+
+/*!	\brief Построение доказательства согласованности
+
+	Для дерева с хэш-значениями листьев [n]leaves строится доказательство
+	[*len]proof того, что дерево из первых m листьев является его
+	префиксом. Если proof == 0, то определяется только длина
+	доказательства.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\expect{ERR_BAD_INPUT} 0 < m && m <= n.
+	\return ERR_OK, если доказательство построено, и код ошибки
+	в противном случае.
+	\remark При m == n доказательство пусто.
+*/
+err_t mhtProveC(
+	octet proof[],			/*!< [out] доказательство */
+	size_t* len,			/*!< [out] число хэш-значений в proof */
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const octet leaves[],	/*!< [in] хэш-значения листьев */
+	size_t n,				/*!< [in] число листьев */
+	size_t m				/*!< [in] число листьев префикса */
+);
+
+/*!	\brief Проверка доказательства согласованности
+
+	Проверяется доказательство [len]proof того, что дерево из m листьев
+	с корнем root_m является префиксом дерева из n листьев с корнем root_n.
+	\expect{ERR_BAD_PARAMS} Идентификатор alg допустим.
+	\expect{ERR_BAD_INPUT} 0 < m && m <= n.
+	\return ERR_OK, если доказательство верно, ERR_BAD_HASH, если
+	доказательство неверно, и код ошибки в других случаях.
+*/
+err_t mhtVerifyC(
+	size_t alg,				/*!< [in] алгоритм хэширования */
+	const octet root_m[],	/*!< [in] корень префикса */
+	size_t m,				/*!< [in] число листьев префикса */
+	const octet root_n[],	/*!< [in] корень дерева */
+	size_t n,				/*!< [in] число листьев дерева */
+	const octet proof[],	/*!< [in] доказательство */
+	size_t len				/*!< [in] число хэш-значений в proof */
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_MHT_H */
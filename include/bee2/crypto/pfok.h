@@ -4,7 +4,7 @@
 \brief Draft of RD_RB: key establishment protocols based on finite fields
 \project bee2 [cryptographic library]
 \created 2014.06.30
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -96,6 +96,14 @@ extern "C" {
 в функцию генерации параметров можно передавать указатель на функцию
 интерфейса pfok_on_q_i, которая получает управление при построении каждого 
 нового кандидата q.
+
+Генерацию параметров можно выполнять пошагово: функция pfokGenParamsStart()
+подготавливает состояние генерации, а каждый вызов pfokGenParamsStep()
+выполняет ограниченный объем работы (строит одно простое число цепочки
+или проверяет одного кандидата) и возвращает управление. Между шагами
+вызывающая программа может обработать события, показать ход генерации
+(см. pfokGenParamsNum()) или прервать генерацию, просто прекратив
+вызывать шаги.
 *******************************************************************************
 */
 
@@ -169,6 +177,87 @@ err_t pfokGenParams(
 	pfok_on_q_i on_q		/*!< [in] обработчик */
 );
 
+/*!	\brief Многопоточная генерация долговременных параметров
+
+	По затравочным данным seed генерируются долговременные параметры params.
+	Выполняются те же действия, что и в функции pfokGenParams(), но простые
+	числа строятся с помощью функции priExtendPrimeMT(), которая проверяет
+	кандидатов в threads потоках.
+	\return ERR_OK, если параметры успешно сгенерированы, и код ошибки
+	в противном случае.
+	\remark Параметры совпадают с параметрами, которые строит функция
+	pfokGenParams(). Функция on_q вызывается в вызывающем потоке.
+	\remark Число потоков можно выбрать равным mtProcCount().
+*/
+err_t pfokGenParamsMT(
+	pfok_params* params,	/*!< [out] долговременные параметры */
+	const pfok_seed* seed,	/*!< [in] затравочные данные */
+	pfok_on_q_i on_q,		/*!< [in] обработчик */
+	size_t threads			/*!< [in] число потоков */
+);
+
+/*!	\brief Длина состояния пошаговой генерации параметров
+
+	Возвращается длина состояния (в октетах) функций пошаговой генерации
+	долговременных параметров по затравочным данным seed в threads потоках.
+	\return Длина состояния.
+	\remark Если цепочка seed->lt некорректна, то возвращается длина, 
+	достаточная для того, чтобы pfokGenParamsStart() вернула код ошибки.
+*/
+size_t pfokGenParams_keep(
+	const pfok_seed* seed,	/*!< [in] затравочные данные */
+	size_t threads			/*!< [in] число потоков */
+);
+
+/*!	\brief Начало пошаговой генерации параметров
+
+	В state подготавливается генерация долговременных параметров по
+	затравочным данным seed. При построении очередного числа q
+	вызывается функция on_q, простые числа строятся в threads потоках
+	(см. pfokGenParamsMT()).
+	\pre По адресу state зарезервировано pfokGenParams_keep(seed, threads)
+	октетов.
+	\return ERR_OK, если генерация подготовлена, и код ошибки в противном
+	случае.
+*/
+err_t pfokGenParamsStart(
+	void* state,			/*!< [out] состояние */
+	const pfok_seed* seed,	/*!< [in] затравочные данные */
+	pfok_on_q_i on_q,		/*!< [in] обработчик */
+	size_t threads			/*!< [in] число потоков */
+);
+
+/*!	\brief Шаг генерации параметров
+
+	Выполняется шаг генерации параметров в состоянии state. Шаг строит одно
+	простое число цепочки lt, проверяет одного кандидата p или одного
+	кандидата g. Если генерация завершена, то параметры возвращаются
+	в params.
+	\expect pfokGenParamsStart() < pfokGenParamsStep()*.
+	\return ERR_NOT_READY, если генерация не завершена, ERR_OK, если
+	параметры построены, и код ошибки в противном случае.
+	\remark Параметры совпадают с параметрами, которые строит функция
+	pfokGenParams().
+	\remark Продолжительность шага ограничена временем построения одного
+	простого числа функцией priExtendPrimeMT().
+*/
+err_t pfokGenParamsStep(
+	pfok_params* params,	/*!< [out] долговременные параметры */
+	void* state				/*!< [in,out] состояние */
+);
+
+/*!	\brief Ход пошаговой генерации параметров
+
+	Определяется число кандидатов q, построенных в состоянии state.
+	\expect pfokGenParamsStart() < pfokGenParamsNum().
+	\return Число кандидатов q (номер num последнего вызова on_q).
+	\remark Ожидаемое число кандидатов q -- примерно 0.52 l, где l --
+	битовая длина p.
+*/
+size_t pfokGenParamsNum(
+	const void* state		/*!< [in] состояние */
+);
+
 /*!	\brief Проверка долговременных параметров
 
 	Проверяется, что долговременные параметры params корректны. Для полей 
@@ -205,6 +294,11 @@ err_t pfokValParams(
 	\return ERR_OK, если ключи успешно сгенерированы, и код ошибки
 	в противном случае.
 	\remark pubkey = g^(privkey).
+	\remark При первом вызове с новыми параметрами для них строится
+	контекст (см. pfokCtxStart()), который сохраняется в кэше модуля
+	и используется при следующих вызовах pfokGenKeypair() и pfokCalcPubkey().
+	Кэш рассчитан на несколько наборов параметров. Когда он заполнен,
+	вычисления ведутся без контекста.
 */
 err_t pfokGenKeypair(
 	octet privkey[],			/*!< [out] личный ключ */
@@ -235,6 +329,7 @@ err_t pfokValPubkey(
 	\return ERR_OK, если открытый ключ успешно построен, и код ошибки
 	в противном случае.
 	\remark pubkey = g^(privkey).
+	\remark Используется кэш контекстов (см. pfokGenKeypair()).
 */
 err_t pfokCalcPubkey(
 	octet pubkey[],				/*!< [out] открытый ключ */
@@ -307,6 +402,115 @@ err_t pfokMTI(
 	const octet pubkey1[]		/*!< [in] однораз. откр. ключ (др. стороны) */
 );
 
+/*!
+*******************************************************************************
+\file pfok.h
+
+\section pfok-ctx Контекст
+
+Контекст содержит описание кольца Монтгомери, построенное по долговременным
+параметрам, и таблицу предвычисленных степеней образующего g. Контекст 
+создается один раз и затем используется функциями pfokCtxXXX(), которые 
+являются аналогами функций pfokXXX(). Функции pfokCtxXXX() не перестраивают
+описание кольца, а лишь выделяют память для стека.
+
+Степени g (при выработке и построении открытых ключей) функции pfokCtxXXX()
+определяют по таблице предвычислений гребенчатым методом (см. qrCombPower()).
+Это в несколько раз быстрее, чем в функциях pfokXXX(). Элементы таблицы
+выбираются регулярно, без ветвлений, зависящих от личного ключа.
+
+Контекст создается по следующей схеме:
+-	определить длину контекста с помощью функции pfokCtx_keep();
+-	подготовить память для контекста;
+-	инициализировать контекст с помощью функции pfokCtxStart().
+.
+
+Функции pfokCtxXXX() не изменяют контекст. Поэтому один контекст может
+одновременно использоваться в нескольких потоках.
+
+На системах с неоднородным доступом к памяти (NUMA) по контексту можно
+создать набор реплик для узлов функцией pfokCtxRepsStart() (см. obj.h).
+Каждый поток получает реплику своего узла вызовом objRepsGet() и
+передает ее функциям pfokCtxXXX() вместо исходного контекста. Контексты
+из кэша модуля (см. pfokGenKeypair()) реплицируются автоматически.
+
+Контекст содержит ссылки на собственные фрагменты. Поэтому контекст нельзя
+перемещать в памяти или копировать. Память контекста освобождается
+вызывающей программой после завершения работы со всеми функциями,
+которые его используют.
+
+\expect{ERR_BAD_INPUT} Контекст ctx инициализирован с помощью pfokCtxStart().
+*******************************************************************************
+*/
+
+/*!	\brief Длина контекста
+
+	Возвращается длина контекста (в октетах) для битовой длины l модуля p.
+	\pre l выбирается из таблицы 5.1.
+	\return Длина контекста.
+*/
+size_t pfokCtx_keep(
+	size_t l					/*!< [in] битовая длина p */
+);
+
+/*!	\brief Инициализация контекста
+
+	По долговременным параметрам params инициализируется контекст ctx.
+	\pre По адресу ctx зарезервировано pfokCtx_keep(params->l) октетов.
+	\expect{ERR_BAD_PARAMS} Параметры params корректны.
+	\return ERR_OK, если контекст успешно инициализирован, и код ошибки
+	в противном случае.
+	\remark Проводится та же минимальная проверка параметров, что и
+	в функциях pfokXXX(). Полная проверка выполняется функцией 
+	pfokValParams().
+*/
+err_t pfokCtxStart(
+	void* ctx,					/*!< [out] контекст */
+	const pfok_params* params	/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Создание набора реплик контекста
+
+	Для контекста ctx создается набор reps реплик для узлов NUMA.
+	Реплика -- это контекст с собственной копией таблицы предвычислений
+	(даже если ctx ссылается на встроенную таблицу). Реплика узла
+	вызывающего потока возвращается функцией objRepsGet(reps) и
+	принимается всеми функциями pfokCtxXXX().
+	\pre По адресу reps зарезервировано objReps_keep() октетов.
+	\return ERR_OK, если набор создан, и код ошибки в противном случае.
+	\remark Контекст ctx должен оставаться доступным, а реплики не должны
+	использоваться после вызова objRepsClose(reps), который освобождает
+	память реплик.
+*/
+err_t pfokCtxRepsStart(
+	void* reps,					/*!< [out] набор реплик */
+	const void* ctx				/*!< [in] контекст */
+);
+
+/*!	\brief Генерация пары ключей в контексте
+
+	Аналог pfokGenKeypair() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t pfokCtxGenKeypair(
+	octet privkey[],			/*!< [out] личный ключ */
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	gen_i rng,					/*!< [in] генератор случайных чисел */
+	void* rng_state				/*!< [in,out] состояние генератора */
+);
+
+/*!	\brief Построение открытого ключа по личному в контексте
+
+	Аналог pfokCalcPubkey() с долговременными параметрами, заданными
+	контекстом ctx.
+*/
+err_t pfokCtxCalcPubkey(
+	octet pubkey[],				/*!< [out] открытый ключ */
+	const void* ctx,			/*!< [in] контекст */
+	const octet privkey[]		/*!< [in] личный ключ */
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Basic definitions
 \project bee2 [cryptographic library]
 \created 2012.04.01
-\version 2023.02.02
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -480,6 +480,23 @@ typedef u32 err_t;
 
 #define B_PER_IMPOSSIBLE 64
 
+/*!
+*******************************************************************************
+\brief Фрагмент памяти
+
+Описание фрагмента [count]buf. Списки фрагментов передаются функциям
+обработки данных, которые собраны из нескольких несмежных буферов
+(например, из заголовков и полезной нагрузки сетевых пакетов). Фрагменты
+списка обрабатываются так, как будто они записаны друг за другом.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const void* buf;	/*!< адрес фрагмента */
+	size_t count;		/*!< длина фрагмента в октетах */
+} mem_vec_t;
+
 /*!
 *******************************************************************************
 \brief Интерфейс генерации
@@ -95,7 +95,8 @@ mkdir build
 cd build
 cmake [-DCMAKE_BUILD_TYPE={Release|Debug|Coverage|ASan|ASanDbg|MemSan|MemSanDbg|Check}]\
       [-DBUILD_FAST=ON]\
-      [-DBASH_PLATFORM={BASH_32|BASH_64|BASH_AVX2|BASH_AVX512|BASH_NEON}] ..
+      [-DBASH_PLATFORM={BASH_32|BASH_64|BASH_AVX2|BASH_AVX512|BASH_NEON}]\
+      [-DBASH_DISPATCH=OFF] ..
 \endverbatim
 
 Конфигурации:
@@ -110,6 +111,11 @@ cmake [-DCMAKE_BUILD_TYPE={Release|Debug|Coverage|ASan|ASanDbg|MemSan|MemSanDbg|
 Опция BUILD_FAST (по умолчанию отключена) переключает между безопасными 
 (constant-time) и быстрыми (non-constant-time) редакциями функций.
 
+Опция BASH_DISPATCH (по умолчанию включена) разрешает выбирать реализацию
+sponge-функции bash-f во время выполнения, по возможностям процессора.
+Опция действует на платформе x86-64 при сборке компиляторами GCC и Clang и
+игнорируется, если реализация явно указана в BASH_PLATFORM.
+
 Сборка:
 
 \verbatim
@@ -4,7 +4,7 @@
 \brief Elliptic curves
 \project bee2 [cryptographic library]
 \created 2012.04.19
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -60,7 +60,10 @@ ecX, ecY, ecZ поддерживают извлечение именованны
 pt = (X : Y : Z :...) с тремя и более координатами -- проективными.
 Бесконечно удаленную точку O нельзя представить аффинной, но можно проективной:
 точке O соответствует точка pt, у которой Z == 0. Макросы ecSetO, ecIsO
-выполняют присваивание pt = O и проверку pt == O.
+выполняют присваивание pt = O и проверку pt == O. Макрос ecSetO строит 
+точку (0 : 1 : 0), которая представляет O во всех поддерживаемых системах 
+координат, в том числе в однородных (полные формулы сложения требуют 
+именно такого представления).
 
 Для организации вычислений требуется, чтобы среди точек эллиптической 
 кривой имелась бесконечно удаленная. Поэтому должны обязательно использоваться 
@@ -95,10 +98,12 @@ ec->order задается 2 * ec->f->n + 1 машинным словом. Ко
 
 По адресу ec->params могут размещаться дополнительные данные, например, 
 определенные кратные базовой точки, с помощью которых можно ускорить 
-криптографические вычисления на эллиптической кривой. 
+криптографические вычисления на эллиптической кривой. Функция 
+ecCreateGroupBarr() размещает по этому адресу параметр Барретта 
+для порядка группы точек.
 
 Описание ec эллиптической кривой включает указатели на функции арифметики 
-в группе точек этой кривой. Функцию интерфейса ec_tpl_i
+в группе точек этой кривой. Функции интерфейсов ec_tpl_i и ec_toab_i
 можно не поддерживать. Указатель на неподдерживаемую функцию 
 должен быть нулевым.
 
@@ -352,6 +357,30 @@ typedef void (*ec_tpl_i)(
 	void* stack				/*!< [in] вспомогательная память */
 );
 
+/*!	\brief Пакетный переход к аффинным координатам
+
+	Проективные точки [count * ec->d * ec->f->n]a эллиптической кривой ec
+	преобразуются в аффинные точки [count * 2 * ec->f->n]b. Используется 
+	одновременное обращение Z-координат (см. qrInvBatch()).
+	\pre Описание ec работоспособно.
+	\pre Буферы a и b не пересекаются.
+	\pre Координаты точек a лежат в базовом поле.
+	\expect Описание ec корректно.
+	\expect Точки a лежат на кривой.
+	\return TRUE, если все аффинные точки построены, и FALSE, если среди
+	точек a есть бесконечно удаленная (соответствующие точки b
+	не определены).
+	\remark Функция интерфейса использует стек глубины не более 
+	ecToABatch_deep(ec->f->n, ec->deep, count).
+*/
+typedef bool_t (*ec_toab_i)(
+	word b[],				/*!< [out] аффинные точки */
+	const word a[],			/*!< [in] входные точки */
+	size_t count,			/*!< [in] число точек */
+	const struct ec_o* ec,	/*!< [in] описание эллиптической кривой */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
 /*!	\brief Описание эллиптической кривой
 
 	Описывается эллиптическая кривая, правила представления ее элементов, 
@@ -383,6 +412,7 @@ typedef struct ec_o
 	ec_dbla_i dbla;			/*!< функция удвоения аффинной точки */
 	ec_tpl_i tpl;			/*!< функция утроения */
 	size_t deep;			/*!< максимальная глубина стека функций */
+	ec_toab_i toab;			/*!< функция пакетного экспорта */
 	octet descr[];			/*!< память для размещения данных */
 } ec_o;
 
@@ -440,7 +470,9 @@ typedef struct ec_o
 	(ec)->dbla(b, a, ec, stack)
 
 #define ecSetO(a, ec)\
-	wwSetZero(ecZ(a, (ec)->f->n), (ec)->f->n)
+	(qrSetZero(ecX(a), (ec)->f),\
+		qrSetUnity(ecY(a, (ec)->f->n), (ec)->f),\
+		qrSetZero(ecZ(a, (ec)->f->n), (ec)->f))
 
 #define ecIsO(a, ec)\
 	wwIsZero(ecZ(a, (ec)->f->n), (ec)->f->n)
@@ -521,6 +553,31 @@ bool_t ecCreateGroup(
 
 size_t ecCreateGroup_deep(size_t f_deep);
 
+/*!	\brief Создание группы точек с параметром Барретта
+
+	Группа точек эллиптической кривой ec создается так же, как
+	в функции ecCreateGroup(). Дополнительно рассчитывается параметр 
+	Барретта для порядка группы, который размещается по адресу ec->params 
+	и используется в функции ecModOrder().
+	\pre Описание ec создано функцией ecpCreateJ(), ecpCreateP() или 
+	ec2CreateLD(): эти функции резервируют за буфером ec->order
+	ec->f->n + 3 машинных слова для параметра Барретта.
+	\return Признак успеха.
+	\remark Ранее установленное значение ec->params теряется.
+	\deep{stack} ecCreateGroupBarr_deep(ec->f->n, f_deep).
+*/
+bool_t ecCreateGroupBarr(
+	ec_o* ec,				/*!< [in,out] описание кривой */
+	const octet xbase[],	/*!< [in] x-координата базовой точки */
+	const octet ybase[],	/*!< [in] y-координата базовой точки */
+	const octet order[],	/*!< [in] порядок группы точек */
+	size_t order_len,		/*!< [in] длина order */
+	u32 cofactor,			/*!< [in] кофактор группы точек */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+size_t ecCreateGroupBarr_deep(size_t n, size_t f_deep);
+
 /*!	\brief Группа точек эллиптической кривой работоспособна?
 
 	Проверяется работоспособность описания группы точек эллиптической 
@@ -536,6 +593,30 @@ bool_t ecIsOperableGroup(
 	const ec_o* ec			/*!< [in] описание кривой */
 );
 
+/*!	\brief Приведение по модулю порядка
+
+	Определяется остаток [m]b от деления числа [na]a на порядок группы
+	точек эллиптической кривой ec. Здесь m -- длина ec->order в машинных
+	словах без учета старших нулевых слов.
+	\pre Описание группы точек ec работоспособно.
+	\pre Группа точек создана функцией ecCreateGroupBarr().
+	\pre Буфер b либо не пересекается с буфером a, либо совпадает с ним.
+	\remark Используется редукция Барретта с параметром ec->params, поэтому
+	деление не выполняется. Если na > 2m, то a обрабатывается блоками
+	по m слов, начиная со старших.
+	\deep{stack} ecModOrder_deep(n).
+	\safe Функция регулярна.
+*/
+void ecModOrder(
+	word b[],				/*!< [out] остаток */
+	const word a[],			/*!< [in] делимое */
+	size_t na,				/*!< [in] длина a в машинных словах */
+	const ec_o* ec,			/*!< [in] описание кривой */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+size_t ecModOrder_deep(size_t n);
+
 /*
 *******************************************************************************
 Макрооперации с аффинными точками
@@ -555,7 +636,13 @@ bool_t ecIsOperableGroup(
 	\expect Точка a лежит на ec.
 	\return TRUE, если кратная точка является аффинной, и FALSE в противном
 	случае (b == O).
-	\deep{stack} ecpMulA_deep(ec->f->n, ec->d, ec->f->deep, m).
+	\safe Имеется ускоренная нерегулярная редакция. В регулярной редакции 
+	последовательность операций и обращений к памяти зависит только от m, 
+	за исключением редких ситуаций сложения равных или противоположных точек. 
+	Ускоренную редакцию FAST(ecMulA) следует явно вызывать, если кратность 
+	не является секретной.
+	\deep{stack} ecMulA_deep(ec->f->n, ec->d, ec->deep, m).
+	\remark Глубина стека ecMulA_deep() подходит для обеих редакций.
 */
 bool_t ecMulA(
 	word b[],			/*!< [out] кратная точка */
@@ -566,8 +653,161 @@ bool_t ecMulA(
 	void* stack			/*!< [in] вспомогательная память */
 );
 
+bool_t SAFE(ecMulA)(word b[], const word a[], const ec_o* ec, 
+	const word d[], size_t m, void* stack);
+bool_t FAST(ecMulA)(word b[], const word a[], const ec_o* ec, 
+	const word d[], size_t m, void* stack);
+
 size_t ecMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m);
 
+/*!	\brief Длина перекодированной кратности
+
+	Определяется длина в октетах перекодированной кратности, которая
+	строится по кратности из m машинных слов.
+	\return Длина перекодированной кратности.
+*/
+size_t ecRecode_keep(
+	size_t m			/*!< [in] длина кратности в машинных словах */
+);
+
+/*!	\brief Перекодирование кратности
+
+	Кратность [m]d перекодируется в [ecRecode_keep(m)]rec. Перекодированная
+	кратность затем используется в функции ecMulARec(). Перекодирование
+	выполняется так же, как в регулярной редакции ecMulA().
+	\safe Функция регулярна.
+	\deep{stack} ecRecode_deep(m).
+	\remark Перекодирование имеет смысл выполнять, если кратность d
+	используется для вычисления нескольких кратных точек.
+	\warning Перекодированная кратность является секретной, если
+	секретной является d.
+*/
+void ecRecode(
+	octet rec[],		/*!< [out] перекодированная кратность */
+	const word d[],		/*!< [in] кратность */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecRecode_deep(size_t m);
+
+/*!	\brief Кратная точка по перекодированной кратности
+
+	Определяется аффинная точка [2 * ec->f->n]b эллиптической кривой ec, 
+	которая является d-кратной аффинной точки [2 * ec->f->n]a. Кратность d
+	из m машинных слов задается перекодированным представлением rec, 
+	построенным с помощью ecRecode().
+	\pre Описание ec работоспособно.
+	\pre Координаты a лежат в базовом поле.
+	\pre rec построено вызовом ecRecode(rec, d, m, stack).
+	\expect Описание ec корректно.
+	\expect Точка a лежит на ec.
+	\return TRUE, если кратная точка является аффинной, и FALSE в противном
+	случае (b == O).
+	\safe Функция регулярна в том же смысле, что и ecMulA().
+	\deep{stack} ecMulARec_deep(ec->f->n, ec->d, ec->deep, m).
+	\remark Результат совпадает с результатом ecMulA(b, a, ec, d, m, stack).
+*/
+bool_t ecMulARec(
+	word b[],			/*!< [out] кратная точка */
+	const word a[],		/*!< [in] базовая точка */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const octet rec[],	/*!< [in] перекодированная кратность */
+	size_t m,			/*!< [in] длина кратности в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecMulARec_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m);
+
+/*!	\brief Пакет кратных точек по перекодированным кратностям
+
+	Определяются аффинные точки [count * 2 * ec->f->n]b эллиптической
+	кривой ec: i-я точка b является кратной i-й аффинной точки
+	[count * 2 * ec->f->n]a. Кратности из m машинных слов задаются
+	перекодированными представлениями [count * ecRecode_keep(m)]rec.
+	\pre Описание ec работоспособно.
+	\pre Координаты точек a лежат в базовом поле.
+	\pre Буферы a и b не пересекаются.
+	\pre i-е представление rec построено вызовом ecRecode().
+	\expect Описание ec корректно.
+	\expect Точки a лежат на ec.
+	\return TRUE, если все кратные точки являются аффинными, и FALSE
+	в противном случае (точки b не определены).
+	\safe Функция регулярна в том же смысле, что и ecMulARec().
+	\deep{stack} ecMulARecBatch_deep(ec->f->n, ec->d, ec->deep, m, count).
+	\remark Результат совпадает с результатами count вызовов ecMulARec().
+	Переходы к аффинным координатам выполняются пакетами (см. ecToABatch()),
+	что экономит 2(count - 1) обращений в базовом поле.
+*/
+bool_t ecMulARecBatch(
+	word b[],			/*!< [out] кратные точки */
+	const word a[],		/*!< [in] базовые точки */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const octet rec[],	/*!< [in] перекодированные кратности */
+	size_t m,			/*!< [in] длина кратностей в машинных словах */
+	size_t count,		/*!< [in] число точек */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecMulARecBatch_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m,
+	size_t count);
+
+/*!	\brief Пакет кратных точек с общей кратностью
+
+	Определяются аффинные точки [count * 2 * ec->f->n]b эллиптической
+	кривой ec: i-я точка b является d-кратной i-й аффинной точки
+	[count * 2 * ec->f->n]a. Кратность d из m машинных слов задается
+	перекодированным представлением [ecRecode_keep(m)]rec.
+	\pre Описание ec работоспособно.
+	\pre Координаты точек a лежат в базовом поле.
+	\pre Буферы a и b не пересекаются.
+	\pre rec построено вызовом ecRecode(rec, d, m, stack).
+	\expect Описание ec корректно.
+	\expect Точки a лежат на ec.
+	\return TRUE, если все кратные точки являются аффинными, и FALSE
+	в противном случае (точки b не определены).
+	\safe Функция регулярна в том же смысле, что и ecMulARec().
+	\deep{stack} ecMulARecBatch_deep(ec->f->n, ec->d, ec->deep, m, count).
+	\remark Результат совпадает с результатом ecMulARecBatch(), в котором
+	все представления rec одинаковы.
+*/
+bool_t ecMulARecBatch1(
+	word b[],			/*!< [out] кратные точки */
+	const word a[],		/*!< [in] базовые точки */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const octet rec[],	/*!< [in] перекодированная кратность */
+	size_t m,			/*!< [in] длина кратности в машинных словах */
+	size_t count,		/*!< [in] число точек */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Пакетный переход к аффинным координатам
+
+	Проективные точки [count * ec->d * ec->f->n]a эллиптической кривой ec
+	преобразуются в аффинные точки [count * 2 * ec->f->n]b. Если 
+	поддерживается интерфейс ec->toab, то выполняется одно обращение
+	в базовом поле и 3(count - 1) дополнительных умножений. Иначе точки 
+	преобразуются по отдельности с помощью ec->toa.
+	\pre Описание ec работоспособно.
+	\pre Буферы a и b не пересекаются.
+	\pre Координаты точек a лежат в базовом поле.
+	\expect Описание ec корректно.
+	\expect Точки a лежат на кривой.
+	\return TRUE, если все аффинные точки построены, и FALSE, если среди
+	точек a есть бесконечно удаленная (соответствующие точки b
+	не определены).
+	\deep{stack} ecToABatch_deep(ec->f->n, ec->deep, count).
+*/
+bool_t ecToABatch(
+	word b[],			/*!< [out] аффинные точки */
+	const word a[],		/*!< [in] проективные точки */
+	size_t count,		/*!< [in] число точек */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecToABatch_deep(size_t n, size_t ec_deep, size_t count);
+
 /*!	\brief Имеет порядок?
 
 	Проверяется, что аффинная точка [2 * ec->f->n]a имеет порядок [m]q 
@@ -620,6 +860,203 @@ bool_t ecAddMulA(
 
 size_t ecAddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t k,...);
 
+/*!	\brief Сумма кратных точек: массивы
+
+	Определяется точка [2n]b эллиптической кривой ec, которая является
+	суммой [m]d[i]-кратных точек [2n]a[i], i = 0, 1,..., k - 1:
+	\code
+		b <- d[0] a[0] + d[1] a[1] + ... + d[k - 1] a[k - 1].
+	\endcode
+	Точки a[i] записаны в массиве [2n * k]a последовательно друг за другом,
+	кратности d[i] -- в массиве [m * k]d.
+	\pre Описание ec работоспособно.
+	\pre k > 0 && m > 0.
+	\pre Координаты точек a[i] лежат в базовом поле.
+	\expect Описание ec корректно.
+	\expect Точки a[i] лежат на ec.
+	\return TRUE, если полученная точка является аффинной, и FALSE
+	в противном случае (b == O).
+	\remark При небольших k используется тот же алгоритм, что и в 
+	ecAddMulA(), при больших -- метод Пиппенджера. Выбор алгоритма 
+	зависит только от k и m.
+	\deep{stack} ecAddMulAV_deep(ec->f->n, ec->d, ec->deep, k, m).
+*/
+bool_t ecAddMulAV(
+	word b[],			/*!< [out] сумма кратных точек */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t k,			/*!< [in] число слагаемых */
+	const word a[],		/*!< [in] точки */
+	const word d[],		/*!< [in] кратности */
+	size_t m,			/*!< [in] длина каждой кратности в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecAddMulAV_deep(size_t n, size_t ec_d, size_t ec_deep, size_t k, 
+	size_t m);
+
+/*!	\brief Предвычисления для гребенчатого метода
+
+	Для аффинной точки [2 * ec->f->n]a эллиптической кривой ec 
+	рассчитывается таблица [ec->f->n << w]pre, которая затем используется
+	в функции ecCombMulA() для быстрого определения кратных a.
+	\pre Описание ec и группы точек ec работоспособны.
+	\pre 2 <= w <= 8.
+	\pre Буферы pre и a не пересекаются.
+	\expect Описание ec корректно.
+	\expect Точка a лежит на ec и имеет порядок ec->order.
+	\return TRUE, если таблица построена, и FALSE, если при построении
+	получена бесконечно удаленная точка (порядок a мал).
+	\remark Размер таблицы в октетах определяется функцией 
+	ecCombPrecA_keep(ec->f->n, w).
+	\deep{stack} ecCombPrecA_deep(ec->f->n, ec->d, ec->deep).
+*/
+bool_t ecCombPrecA(
+	word pre[],			/*!< [out] таблица предвычислений */
+	const word a[],		/*!< [in] базовая точка */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t w,			/*!< [in] ширина гребня */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecCombPrecA_keep(size_t n, size_t w);
+size_t ecCombPrecA_deep(size_t n, size_t ec_d, size_t ec_deep);
+
+/*!	\brief Кратная точка по таблице предвычислений
+
+	Определяется аффинная точка [2 * ec->f->n]b эллиптической кривой ec, 
+	которая является [m]d-кратной точки a, для которой была построена
+	таблица [ec->f->n << w]pre:
+	\code
+		b <- d a.
+	\endcode
+	\pre Описание ec и группы точек ec работоспособны.
+	\pre Таблица pre построена функцией ecCombPrecA() с тем же ec и w.
+	\pre d < ec->order.
+	\return TRUE, если кратная точка является аффинной, и FALSE в противном
+	случае (b == O).
+	\safe Точки таблицы выбираются без ветвлений и обращений к памяти,
+	зависящих от d. Регулярность может нарушаться только в исключительных 
+	ситуациях сложения равных или противоположных точек.
+	\deep{stack} ecCombMulA_deep(ec->f->n, ec->d, ec->deep, w).
+*/
+bool_t ecCombMulA(
+	word b[],			/*!< [out] кратная точка */
+	const word pre[],	/*!< [in] таблица предвычислений */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t w,			/*!< [in] ширина гребня */
+	const word d[],		/*!< [in] кратность */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecCombMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w);
+
+/*!	\brief Пакет кратных точек по таблице предвычислений
+
+	Определяются аффинные точки [count * 2 * ec->f->n]b эллиптической
+	кривой ec: i-я точка b является [m]d_i-кратной точки a, для которой
+	была построена таблица [ec->f->n << w]pre. Кратности записаны
+	последовательно: d_i = d + m * i.
+	\pre Описание ec и группы точек ec работоспособны.
+	\pre Таблица pre построена функцией ecCombPrecA() с тем же ec и w.
+	\pre d_i < ec->order.
+	\pre Буферы b и d не пересекаются.
+	\return TRUE, если все кратные точки являются аффинными, и FALSE
+	в противном случае (точки b не определены).
+	\safe Функция регулярна в том же смысле, что и ecCombMulA().
+	\deep{stack} ecCombMulABatch_deep(ec->f->n, ec->d, ec->deep, w, count).
+	\remark Результат совпадает с результатами count вызовов ecCombMulA().
+	Переход к аффинным координатам выполняется пакетом (см. ecToABatch()),
+	что экономит count - 1 обращений в базовом поле.
+*/
+bool_t ecCombMulABatch(
+	word b[],			/*!< [out] кратные точки */
+	const word pre[],	/*!< [in] таблица предвычислений */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t w,			/*!< [in] ширина гребня */
+	const word d[],		/*!< [in] кратности */
+	size_t m,			/*!< [in] длина каждой кратности в машинных словах */
+	size_t count,		/*!< [in] число кратностей */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecCombMulABatch_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w,
+	size_t count);
+
+/*!	\brief Сумма кратных точек с таблицей предвычислений
+
+	Определяется аффинная точка [2 * ec->f->n]b эллиптической кривой ec:
+	\code
+		b <- d G + e a,
+	\endcode
+	где G -- точка, для которой построена таблица [ec->f->n << w]pre.
+	Гребень для d и NAF для e обрабатываются в одном цикле удвоений.
+	\pre Описание ec и группы точек ec работоспособны.
+	\pre Таблица pre построена функцией ecCombPrecA() с тем же ec и w.
+	\pre d < ec->order.
+	\expect Точка a лежит на ec.
+	\return TRUE, если сумма является аффинной точкой, и FALSE в противном
+	случае (b == O).
+	\warning Функция нерегулярна: время выполнения зависит от d и e.
+	Используется только с открытыми кратностями.
+	\deep{stack} ecCombAddMulA_deep(ec->f->n, ec->d, ec->deep, w, k).
+*/
+bool_t ecCombAddMulA(
+	word b[],			/*!< [out] сумма кратных точек */
+	const word pre[],	/*!< [in] таблица предвычислений для G */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t w,			/*!< [in] ширина гребня */
+	const word d[],		/*!< [in] кратность G */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	const word a[],		/*!< [in] вторая точка */
+	const word e[],		/*!< [in] кратность a */
+	size_t k,			/*!< [in] длина e в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecCombAddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w,
+	size_t k);
+
+/*!	\brief Сумма кратных точек с двумя таблицами предвычислений
+
+	Определяется аффинная точка [2 * ec->f->n]b эллиптической кривой ec:
+	\code
+		b <- d G + d2 Q + e a,
+	\endcode
+	где G и Q -- точки, для которых построены таблицы [ec->f->n << w]pre
+	и [ec->f->n << w]pre2. Гребни для d и d2 и NAF для e обрабатываются
+	в одном цикле удвоений. Если k == 0, то слагаемое e a отсутствует,
+	и указатели a и e могут быть нулевыми.
+	\pre Описание ec и группы точек ec работоспособны.
+	\pre Таблицы pre и pre2 построены функцией ecCombPrecA() с тем же ec 
+	и w.
+	\pre d < ec->order и d2 < ec->order.
+	\expect Точка a лежит на ec.
+	\return TRUE, если сумма является аффинной точкой, и FALSE в противном
+	случае (b == O).
+	\warning Функция нерегулярна: время выполнения зависит от d, d2 и e.
+	Используется только с открытыми кратностями.
+	\deep{stack} ecComb2AddMulA_deep(ec->f->n, ec->d, ec->deep, w, k).
+*/
+bool_t ecComb2AddMulA(
+	word b[],			/*!< [out] сумма кратных точек */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	size_t w,			/*!< [in] ширина гребня */
+	const word pre[],	/*!< [in] таблица предвычислений для G */
+	const word d[],		/*!< [in] кратность G */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	const word pre2[],	/*!< [in] таблица предвычислений для Q */
+	const word d2[],	/*!< [in] кратность Q */
+	size_t m2,			/*!< [in] длина d2 в машинных словах */
+	const word a[],		/*!< [in] третья точка */
+	const word e[],		/*!< [in] кратность a */
+	size_t k,			/*!< [in] длина e в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecComb2AddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w,
+	size_t k);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
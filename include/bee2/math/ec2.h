@@ -4,7 +4,7 @@
 \brief Elliptic curves over binary fields
 \project bee2 [cryptographic library]
 \created 2012.04.19
-\version 2021.06.30
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -228,6 +228,89 @@ bool_t ec2SubAA(
 
 size_t ec2SubAA_deep(size_t n, size_t f_deep);
 
+/*
+*******************************************************************************
+Кратная точка
+*******************************************************************************
+*/
+
+/*!	\brief Кратная точка: лестница Монтгомери в x-координатах
+
+	Определяется кратная точка [2 * ec->f->n]b = d [2 * ec->f->n]a 
+	эллиптической кривой ec. Используется лестница Монтгомери 
+	над x-координатами точек в проективной форме (алгоритм Лопеса -- 
+	Дахаба) с восстановлением y-координаты в конце. 
+	\pre Описание ec (включая описание группы точек) работоспособно 
+	и ec->d == 3 (LD-координаты).
+	\pre Координаты a лежат в базовом поле.
+	\expect Описание ec (включая описание группы точек) корректно.
+	\expect Точка a лежит на ec, ее порядок делит ec->order.
+	\return TRUE, если кратная точка является аффинной, и FALSE в противном
+	случае (b == O).
+	\safe При d < ec->order последовательность операций и обращений 
+	к памяти в цикле по битам кратности зависит только от ec->order.
+	При d >= ec->order, а также для точки a порядка 2, вызывается 
+	SAFE(ecMulA).
+	\deep{stack} ec2MulAX_deep(ec->f->n, ec->f->deep, ec->deep, m).
+*/
+bool_t ec2MulAX(
+	word b[],			/*!< [out] кратная точка */
+	const word a[],		/*!< [in] базовая точка */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const word d[],		/*!< [in] кратность */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ec2MulAX_deep(size_t n, size_t f_deep, size_t ec_deep, size_t m);
+
+/*
+*******************************************************************************
+Кривые Коблица
+*******************************************************************************
+*/
+
+/*!	\brief Кривая Коблица?
+
+	Проверяется, что эллиптическая кривая ec является кривой Коблица:
+	A \in {0, 1}, B == 1.
+	\pre Описание ec работоспособно и ec->d == 3 (LD-координаты).
+	\return Признак кривой Коблица.
+*/
+bool_t ec2IsKoblitz(
+	const ec_o* ec		/*!< [in] описание кривой */
+);
+
+/*!	\brief Кратная точка кривой Коблица
+
+	Определяется кратная точка [2 * ec->f->n]b = d [2 * ec->f->n]a 
+	кривой Коблица ec. Кратность d редуцируется в кольце Z[\tau], 
+	где \tau -- эндоморфизм Фробениуса, и представляется оконным 
+	\tau-адическим NAF. Удвоения точек заменяются применениями \tau,
+	т.е. возведениями координат в квадрат.
+	\pre Описание ec работоспособно и ec->d == 3 (LD-координаты).
+	\pre ec2IsKoblitz(ec) == TRUE.
+	\pre Координаты a лежат в базовом поле.
+	\expect Описание ec корректно.
+	\expect Точка a лежит на ec.
+	\return TRUE, если кратная точка является аффинной, и FALSE в противном
+	случае (b == O).
+	\safe Функция нерегулярна (как FAST(ecMulA)).
+	\remark Если a имеет малый порядок, то вызывается FAST(ecMulA).
+	\deep{stack} ec2MulAKoblitz_deep(ec->f->n, ec->f->deep, ec->deep, m).
+*/
+bool_t ec2MulAKoblitz(
+	word b[],			/*!< [out] кратная точка */
+	const word a[],		/*!< [in] базовая точка */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const word d[],		/*!< [in] кратность */
+	size_t m,			/*!< [in] длина d в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ec2MulAKoblitz_deep(size_t n, size_t f_deep, size_t ec_deep, 
+	size_t m);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
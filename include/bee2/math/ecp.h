@@ -4,7 +4,7 @@
 \brief Elliptic curves over prime fields
 \project bee2 [cryptographic library]
 \created 2012.06.24
-\version 2021.06.30
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -36,8 +36,8 @@ extern "C" {
 E(GF(p)) -- множество аффинных точек E (решений E в GF(p)),
 O -- бесконечно удаленная точка.
 
-Поддерживаются якобиановы координаты (с помощью структуры ec_o) 
-и аффинные координаты (прямые функции).
+Поддерживаются якобиановы и однородные проективные координаты (с помощью 
+структуры ec_o) и аффинные координаты (прямые функции).
 
 \pre Все указатели, передаваемые в функции, действительны.
 
@@ -76,6 +76,34 @@ bool_t ecpCreateJ(
 size_t ecpCreateJ_keep(size_t n);
 size_t ecpCreateJ_deep(size_t n, size_t f_deep);
 
+/*!	\brief Создание эллиптической кривой в однородных координатах
+
+	Создается описание ec эллиптической кривой в однородных проективных 
+	координатах над полем f с коэффициентами [f->no]A и [f->no]B. 
+	Сложение и удвоение точек выполняются по полным формулам, которые не 
+	требуют обработки исключительных ситуаций.
+	\return Признак успеха.
+	\pre gfpIsOperable(f) == TRUE.
+	\expect{FALSE} f->mod > 3.
+	\expect{FALSE} A == -3.
+	\expect Порядок группы точек нечетен (в частности, кривая не содержит 
+	точек порядка 2). Иначе полные формулы могут давать неверный результат.
+	\post ec->d == 3.
+	\post Буферы ec->order и ec->base подготовлены для ecCreateGroup().
+	\keep{ec} ecpCreateP_keep(f->n).
+	\deep{stack} ecpCreateP_deep(f->n, f->deep).
+*/
+bool_t ecpCreateP(
+	ec_o* ec,			/*!< [in] описание кривой */
+	const qr_o* f,		/*!< [in] базовое поле */
+	const octet A[],	/*!< [in] коэффициент A */
+	const octet B[],	/*!< [in] коэффициент B */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecpCreateP_keep(size_t n);
+size_t ecpCreateP_deep(size_t n, size_t f_deep);
+
 /*
 *******************************************************************************
 Свойства кривой и группы точек
@@ -239,7 +267,9 @@ size_t ecpSubAA_deep(size_t n, size_t f_deep);
 	\expect Описание ec корректно.
 	\expect B -- квадратичный вычет по модулю p. Если это условие 
 	нарушается, то точка b не будет лежать на ec для a \in {0, p - 1}.
-	\remark Реализован алгоритм SWU в редакции СТБ 34.101.66.
+	\remark Реализован алгоритм SWU в редакции СТБ 34.101.66. Обращение
+	и извлечение квадратного корня объединены в одно возведение в степень
+	(p - 3) / 4.
 	\deep{stack} ecpSWU_deep(ec->f->n, ec->f->deep).
 */
 void ecpSWU(
@@ -251,6 +281,59 @@ void ecpSWU(
 
 size_t ecpSWU_deep(size_t n, size_t f_deep);
 
+/*
+*******************************************************************************
+Пакетные вычисления
+*******************************************************************************
+*/
+
+/*!	\brief Поддерживается 4-полосная арифметика?
+
+	Проверяется, что для кривой ec можно использовать 4-полосную
+	арифметику (см. ecpAddMulAX4()): ec->d == 3, ec->f -- поле GF(p), 
+	p = 2^256 - c, 0 < c < 2^16, A = -3.
+	\return Признак поддержки.
+	\remark Условиям удовлетворяет кривая bign-curve256v1.
+	\remark 4-полосная арифметика не поддерживается на платформах
+	без 64-битовых слов (U64_SUPPORT не определен).
+*/
+bool_t ecpIsOperableX4(
+	const ec_o* ec		/*!< [in] описание кривой */
+);
+
+/*!	\brief Пакетная сумма кратных точек
+
+	Для j = 0, 1, 2, 3 определяется аффинная точка
+	\code
+		b + 2 * ec->f->n * j <- (d + ec->f->n * j)(a + 2 * ec->f->n * j) + 
+			(e + m * j)(c + 2 * ec->f->n * j).
+	\endcode
+	Четыре независимые суммы вычисляются одновременно в 4 полосах
+	векторной арифметики поля. Сложение выполняется по полным формулам.
+	\pre ecpIsOperableX4(ec) == TRUE.
+	\pre Координаты точек a и c лежат в базовом поле.
+	\expect Описание ec корректно, порядок группы точек ec нечетен.
+	\expect Точки a и c лежат на ec.
+	\return Маска: j-й бит равен 1, если j-я сумма является аффинной 
+	точкой, и 0, если j-я сумма равняется O (в этом случае содержимое 
+	соответствующего фрагмента b не определено).
+	\safe Последовательность операций и обращений к памяти зависит 
+	только от ec->f->n и m.
+	\deep{stack} ecpAddMulAX4_deep(ec->f->n, ec->f->deep, m).
+*/
+size_t ecpAddMulAX4(
+	word b[],			/*!< [out] 4 суммы */
+	const ec_o* ec,		/*!< [in] описание кривой */
+	const word a[],		/*!< [in] 4 первые точки */
+	const word d[],		/*!< [in] 4 первые кратности */
+	const word c[],		/*!< [in] 4 вторые точки */
+	const word e[],		/*!< [in] 4 вторые кратности */
+	size_t m,			/*!< [in] длина e[j] в машинных словах */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t ecpAddMulAX4_deep(size_t n, size_t f_deep, size_t m);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Prime fields
 \project bee2 [cryptographic library]
 \created 2012.07.11
-\version 2014.04.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -99,6 +99,40 @@ bool_t gfpIsValid(
 
 size_t gfpIsValid_deep(size_t n);
 
+/*
+*******************************************************************************
+Квадратный корень
+*******************************************************************************
+*/
+
+/*!	\brief Квадратный корень
+
+	В поле f определяется элемент [f->n]b, квадрат которого равняется 
+	[f->n]a:
+	\code
+		b <- \sqrt(a).
+	\endcode
+	\pre Описание f работоспособно.
+	\pre Элемент a принадлежит f.
+	\expect Описание f корректно.
+	\return TRUE, если корень существует, и FALSE в противном случае.
+	\remark Если корень не существует, то b не изменяется.
+	\remark Если f->mod = 2^k - c, c < 2^B_PER_W, то используется 
+	аддитивная цепочка возведения в степень. Если f->mod \equiv 3 \mod 4,
+	то используется qrPower(). Если f->mod \equiv 1 \mod 4, то 
+	используется алгоритм Тонелли -- Шенкса.
+	\remark Буферы a и b могут совпадать.
+	\deep{stack} gfpSqrt_deep(f->n, f->deep).
+*/
+bool_t gfpSqrt(
+	word b[],			/*!< [out] корень */
+	const word a[],		/*!< [in] квадрат */
+	const qr_o* f,		/*!< [in] описание поля */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t gfpSqrt_deep(size_t n, size_t f_deep);
+
 /*
 *******************************************************************************
 Псевдонимы
@@ -4,7 +4,7 @@
 \brief Primes
 \project bee2 [cryptographic library]
 \created 2012.08.13
-\version 2015.04.28
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -232,11 +232,20 @@ size_t priNextPrimeW_deep();
 	чисел-кандидатов (или все возможные кандидаты при trials == SIZE_MAX). 
 	Сначала проверяется, что кандидат не делится на base_count простых из 
 	факторной базы. Затем применяется тест Рабина -- Миллера с iter итерациями.
+	Делимость на простые из факторной базы проверяется решетом: кандидаты
+	просеиваются окнами, в каждом окне отмечаются все кандидаты, кратные
+	элементам базы.
 	\pre Буфер p либо не пересекается с буфером a, либо указатели a и p
 	совпадают.
 	\pre base_count <= priBaseSize().
 	\return TRUE, если искомое простое найдено, и FALSE в противном случае.
 	\deep{stack} priNextPrime_deep(n, base_count).
+	\remark Если поиск прекращен из-за исчерпания trials, то в p
+	возвращается первый непроверенный кандидат. Поиск можно продолжить
+	вызовом priNextPrime(p, p, n, trials,...). Серия таких вызовов находит
+	то же простое, что и один вызов с trials == SIZE_MAX, но каждый вызов
+	выполняет ограниченный объем работы. Если кандидаты исчерпаны, то
+	битовая длина p отличается от битовой длины a.
 */
 
 bool_t priNextPrime(
@@ -251,6 +260,36 @@ bool_t priNextPrime(
 
 size_t priNextPrime_deep(size_t n, size_t base_count);
 
+/*!	\brief Следующее простое (многопоточная версия)
+
+	Выполняются те же действия, что и в функции priNextPrime(). Кандидаты,
+	которые не отсеяны по факторной базе, проверяются тестом Рабина --
+	Миллера в threads потоках.
+	\pre Буфер p либо не пересекается с буфером a, либо указатели a и p
+	совпадают.
+	\pre base_count <= priBaseSize().
+	\return TRUE, если искомое простое найдено, и FALSE в противном случае.
+	\deep{stack} priNextPrimeMT_deep(n, base_count, threads).
+	\remark Найденное простое совпадает с простым, которое находит
+	функция priNextPrime(): при обнаружении простого потоки завершают
+	проверку кандидатов, которые больше найденного, и дожидаются результатов
+	по меньшим кандидатам.
+	\remark Используется не более 16 потоков. При threads == 0 используется
+	один поток.
+*/
+bool_t priNextPrimeMT(
+	word p[],			/*!< [out] простое число */
+	const word a[],		/*!< [in] начальное значение */
+	size_t n,			/*!< [in] длина a и p в машинных словах */
+	size_t trials,		/*!< [in] число кандидатов */
+	size_t base_count,	/*!< [in] число элементов факторной базы */
+	size_t iter,		/*!< [in] число итераций теста Рабина -- Миллера */
+	size_t threads,		/*!< [in] число потоков */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t priNextPrimeMT_deep(size_t n, size_t base_count, size_t threads);
+
 /*!	\brief Расширение простого
 
 	По базовому нечетному простому [n]q определяется расширенное 
@@ -258,7 +297,8 @@ size_t priNextPrime_deep(size_t n, size_t base_count);
 	Число r выбирается с помощью генератора rng с состоянием rng_state.
 	Простота построенного числа p проверяется в два этапа. Сначала
 	проверяется, что p не делится на base_count простых из факторной
-	базы. Затем проверяется условие теоремы Демитко. Если число p не подходит,
+	базы (с помощью решета, как в функции priNextPrime()). Затем
+	проверяется условие теоремы Демитко. Если число p не подходит,
 	то оно увеличивается на 2 и проверка повторяется. Если при увеличении p
 	его битовая длина становится больше l, то генерируется новое r, 
 	затем p пересчитывается. Всего используется не более trials кандидатов p.
@@ -273,6 +313,10 @@ size_t priNextPrime_deep(size_t n, size_t base_count);
 	\remark Для применения теоремы Демитко требуется выполнение условия 
 	2 * r < 4 * q + 1. Ограничение l <= 2 * wwBitSize(q, n) гарантирует
 	выполнение этого условия.
+	\remark Попытки (выбор r и проверка кандидатов p) независимы. Поэтому
+	поиск можно вести серией вызовов с ограниченным trials (и тем же
+	генератором rng), каждый из которых выполняет ограниченный объем
+	работы.
 	\deep{stack} priExtendPrime_deep(l, n, base_count).
 */
 
@@ -290,6 +334,40 @@ bool_t priExtendPrime(
 
 size_t priExtendPrime_deep(size_t l, size_t n, size_t base_count);
 
+/*!	\brief Расширение простого (многопоточная версия)
+
+	Выполняются те же действия, что и в функции priExtendPrime(). Кандидаты,
+	которые не отсеяны по факторной базе, проверяются по теореме Демитко
+	в threads потоках.
+	\pre Буфер p не пересекается с буфером q.
+	\pre q -- нечетное && q >= 3.
+	\pre wwBitSize(q, n) + 1 <= l && l <= 2 * wwBitSize(q, n).
+	\pre base_count <= priBaseSize().
+	\expect q -- простое.
+	\return TRUE, если искомое простое найдено, и FALSE в противном случае.
+	\deep{stack} priExtendPrimeMT_deep(l, n, base_count, threads).
+	\remark При одинаковых входных данных (в том числе при одинаковом
+	состоянии rng_state) результат совпадает с результатом priExtendPrime().
+	Генератор rng вызывается только в вызывающем потоке.
+	\remark Используется не более 16 потоков. При threads == 0 используется
+	один поток.
+*/
+bool_t priExtendPrimeMT(
+	word p[],			/*!< [out] расширенное простое число */
+	size_t l,			/*!< [in] длина p в битах */
+	const word q[],		/*!< [in] базовое простое число */
+	size_t n,			/*!< [in] длина q в машинных словах */
+	size_t trials,		/*!< [in] число кандидатов */
+	size_t base_count,	/*!< [in] число элементов факторной базы */
+	size_t threads,		/*!< [in] число потоков */
+	gen_i rng,			/*!< [in] генератор случайных чисел */
+	void* rng_state,	/*!< [in] состояние rng */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+size_t priExtendPrimeMT_deep(size_t l, size_t n, size_t base_count,
+	size_t threads);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
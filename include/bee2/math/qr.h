@@ -4,7 +4,7 @@
 \brief Quotient rings
 \project bee2 [cryptographic library]
 \created 2013.08.09
-\version 2015.09.01
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -22,6 +22,7 @@
 
 #include "bee2/defs.h"
 #include "bee2/core/obj.h"
+#include "bee2/core/safe.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -432,7 +433,12 @@ bool_t qrIsOperable(
 	\pre Элемент a принадлежит r.
 	\expect Описание кольца r корректно.
 	\remark При b == 0 возвращается r->unity.
+	\safe Имеется ускоренная нерегулярная редакция. В регулярной редакции 
+	последовательность операций и обращений к памяти зависит только от m.
+	Ускоренную редакцию FAST(qrPower) следует явно вызывать, если показатель
+	не является секретным.
 	\deep{stack} qrPower_deep(r->n, m, r->deep).
+	\remark Глубина стека qrPower_deep() подходит для обеих редакций.
 */
 void qrPower(
 	word c[],				/*!< [out] степень */
@@ -445,6 +451,91 @@ void qrPower(
 
 size_t qrPower_deep(size_t n, size_t m, size_t r_deep);
 
+void SAFE(qrPower)(word c[], const word a[], const word b[], size_t m, 
+	const qr_o* r, void* stack);
+void FAST(qrPower)(word c[], const word a[], const word b[], size_t m, 
+	const qr_o* r, void* stack);
+
+/*!	\brief Предвычисления для гребенчатого возведения в степень
+
+	Для элемента [r->n]a кольца r рассчитывается таблица [r->n << w]pre,
+	которая затем используется в функции qrCombPower() для быстрого
+	возведения a в степени битовой длины не более l.
+	\pre Описание кольца r работоспособно.
+	\pre Элемент a принадлежит r.
+	\pre l > 0 && 2 <= w <= 8.
+	\pre Буферы pre и a не пересекаются.
+	\expect Описание кольца r корректно.
+	\remark Размер таблицы в октетах определяется функцией 
+	qrCombPrec_keep(r->n, w).
+	\deep{stack} qrCombPrec_deep(r->n, r->deep).
+*/
+void qrCombPrec(
+	word pre[],				/*!< [out] таблица предвычислений */
+	const word a[],			/*!< [in] основание */
+	size_t l,				/*!< [in] граница битовой длины показателей */
+	size_t w,				/*!< [in] ширина гребня */
+	const qr_o* r,			/*!< [in] описание кольца */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+size_t qrCombPrec_keep(size_t n, size_t w);
+size_t qrCombPrec_deep(size_t n, size_t r_deep);
+
+/*!	\brief Возведение в степень по таблице предвычислений
+
+	В кольце вычетов r определяется элемент [r->n]c, который является [m]b-ой 
+	степенью элемента a, для которого была построена таблица 
+	[r->n << w]pre:
+	\code
+		c <- a^b.
+	\endcode
+	\pre Описание кольца r работоспособно.
+	\pre Таблица pre построена функцией qrCombPrec() с теми же l, w и r.
+	\pre wwBitSize(b, m) <= l.
+	\remark При b == 0 возвращается r->unity.
+	\safe Последовательность операций и обращений к памяти зависит только
+	от l, w и m.
+	\deep{stack} qrCombPower_deep(r->n, r->deep).
+*/
+void qrCombPower(
+	word c[],				/*!< [out] степень */
+	const word pre[],		/*!< [in] таблица предвычислений */
+	size_t l,				/*!< [in] граница битовой длины показателей */
+	size_t w,				/*!< [in] ширина гребня */
+	const word b[],			/*!< [in] показатель */
+	size_t m,				/*!< [in] длина b в машинных словах */
+	const qr_o* r,			/*!< [in] описание кольца */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+size_t qrCombPower_deep(size_t n, size_t r_deep);
+
+/*!	\brief Одновременное обращение
+
+	В кольце вычетов r определяются мультипликативно обратные [count * r->n]b
+	к элементам [count * r->n]a:
+	\code
+		b[i] <- a[i]^{-1}, i = 0, 1,..., count - 1.
+	\endcode
+	Здесь a[i] и b[i] -- i-ые элементы r в массивах a и b.
+	\pre Описание кольца r работоспособно.
+	\pre Буферы a и b либо не пересекаются, либо совпадают.
+	\pre Элементы a[i] принадлежат r и обратимы.
+	\expect Описание кольца r корректно.
+	\remark Выполняется одно обращение и 3(count - 1) умножений.
+	\deep{stack} qrInvBatch_deep(r->n, count, r->deep).
+*/
+void qrInvBatch(
+	word b[],				/*!< [out] обратные элементы */
+	const word a[],			/*!< [in] обращаемые элементы */
+	size_t count,			/*!< [in] число элементов */
+	const qr_o* r,			/*!< [in] описание кольца */
+	void* stack				/*!< [in] вспомогательная память */
+);
+
+size_t qrInvBatch_deep(size_t n, size_t count, size_t r_deep);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Arbitrary length words
 \project bee2 [cryptographic library]
 \created 2012.04.18
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -125,6 +125,29 @@ void wwSwap(
 	size_t n		/*!< [in] длина a и b в машинных словах */
 );
 
+/*!	\brief Регулярный выбор из таблицы
+
+	В слово [n]c записывается элемент с номером index таблицы 
+	[count * n]table, составленной из count элементов по n машинных слов:
+	\code
+		c <- table[index * n..(index + 1) * n).
+	\endcode
+	Если index >= count, то c обнуляется.
+	\pre Буфер c не пересекается с буфером table.
+	\safe Функция регулярна: просматриваются все элементы таблицы, 
+	неподходящие элементы маскируются. Последовательность операций и 
+	обращений к памяти зависит только от count и n.
+	\remark При наличии AVX2, SSE2 или NEON элементы обрабатываются 
+	блоками по 32 или 16 октетов.
+*/
+void wwSelect(
+	word c[],			/*!< [out] выбранный элемент */
+	const word table[],	/*!< [in] таблица */
+	size_t count,		/*!< [in] число элементов таблицы */
+	size_t index,		/*!< [in] номер выбираемого элемента */
+	size_t n			/*!< [in] длина элемента в машинных словах */
+);
+
 /*!	\brief Проверка совпадения слов
 
 	Проверяется совпадение слов [n]a и [n]b.
@@ -483,6 +506,30 @@ size_t wwNAF(
 	size_t w				/*!< [in] длина окна */
 );
 
+/*!	\brief Символы NAF
+
+	Определяются символы a_0, a_1,..., a_{l-1} оконной NAF слова [n]a
+	с длиной окна w (см. wwNAF()). Символ a_i записывается в октет naf[i]:
+	-	нулевой символ -- значением 0;
+	-	положительный символ -- значением a_i;
+	-	отрицательный символ -- значением 2^{w - 1} + |a_i|.
+	.
+	\pre 2 <= w <= 8.
+	\pre Буфер naf состоит из B_OF_W(n) + 1 октетов и не пересекается
+	с буфером a.
+	\return Размер naf (число символов l).
+	\remark Коды символов совпадают с кодами в упакованном представлении
+	wwNAF(), но не требуют извлечения с помощью wwGetBits(): символ a_i
+	читается непосредственно из naf[i].
+	\safe Функция нерегулярна.
+*/
+size_t wwNAFDigits(
+	octet naf[],			/*!< [out] символы NAF */
+	const word a[],			/*!< [in] слово */
+	size_t n,				/*!< [in] длина a в машинных словах */
+	size_t w				/*!< [in] длина окна */
+);
+
 /*
 *******************************************************************************
 Сдвиги и очистка
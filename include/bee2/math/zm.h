@@ -4,7 +4,7 @@
 \brief Quotient rings of integers modulo m
 \project bee2 [cryptographic library]
 \created 2013.09.14
-\version 2023.02.02
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -171,6 +171,8 @@ size_t zmCreateMont_deep(size_t no);
 	-	редукция Крэндалла примерно в 2 раза быстрее редукции Монтгомери;
 	-	редукция Монтгомери примерно в 2 раза быстрее редукции Барретта;
 	-	редукция Барретта несколько опережает обычную редукцию при r->n >= 4.
+	\remark Если включена настройка (см. zmTune()), то для нечетных модулей
+	длины no > 2 * O_PER_W редукция выбирается по результатам замеров.
 	\keep{r} zmCreate_keep(no).
 	\deep{stack} zmCreate_deep(no).
 */
@@ -184,6 +186,109 @@ void zmCreate(
 size_t zmCreate_keep(size_t no);
 size_t zmCreate_deep(size_t no);
 
+/*
+*******************************************************************************
+Выбор редукции
+
+Функция zmCreate() выбирает редукцию по структуре модуля: Крэндалла для
+модулей вида B^n - c, Монтгомери для остальных нечетных модулей, Барретта
+или обычную для четных. Выбор оптимален не на всех платформах: например,
+при наличии инструкции MULX редукция Монтгомери может опережать редукцию
+Крэндалла. Поэтому предусмотрены:
+-	явный выбор редукции (zmCreateRed());
+-	настройка zmCreate() по результатам замеров (zmTune()).
+.
+При настройке для каждой длины модуля в словах (не более ZM_TUNE_MAX_N) 
+и каждого признака "модуль имеет вид B^n - c" однократно измеряется время 
+умножения в кольцах с допустимыми редукциями. Редукция, на которой 
+достигнут минимум, запоминается и далее используется в zmCreate() для 
+всех модулей с такими же характеристиками.
+
+Все редукции дают одинаковые результаты арифметических операций (с учетом 
+преобразований qrFrom() / qrTo()) и являются регулярными. Поэтому выбор 
+влияет только на производительность.
+*******************************************************************************
+*/
+
+#define ZM_RED_AUTO		0	/*!< выбор zmCreate() */
+#define ZM_RED_PLAIN	1	/*!< обычная редукция */
+#define ZM_RED_CRAND	2	/*!< редукция Крэндалла */
+#define ZM_RED_BARR		3	/*!< редукция Барретта */
+#define ZM_RED_MONT		4	/*!< редукция Монтгомери */
+
+/*!	\brief Максимальная длина модуля (в словах) при настройке */
+#define ZM_TUNE_MAX_N	(4096 / B_PER_W)
+
+/*!	\brief Создание описания кольца с заданной редукцией
+
+	По модулю [no]mod, представленному строкой октетов, создается описание r 
+	кольца Z / (mod), в котором используется редукция red. При 
+	red == ZM_RED_AUTO вызывается zmCreate().
+	\pre no > 0 && mod[no - 1] > 0.
+	\return Признак успеха. Функция завершается неудачей, если редукция 
+	red неизвестна или не применима к mod (см. предусловия 
+	zmCreateCrand(), zmCreateMont()).
+	\keep{r} zmCreate_keep(no).
+	\deep{stack} zmCreate_deep(no).
+*/
+bool_t zmCreateRed(
+	qr_o* r,			/*!< [out] описание кольца */
+	const octet mod[],	/*!< [in] модуль */
+	size_t no,			/*!< [in] длина mod в октетах */
+	size_t red,			/*!< [in] редукция */
+	void* stack			/*!< [in] вспомогательная память */
+);
+
+/*!	\brief Редукция кольца
+
+	Определяется редукция, которая используется в кольце r.
+	\return ZM_RED_PLAIN, ZM_RED_CRAND, ZM_RED_BARR или ZM_RED_MONT
+	(в том числе для колец, построенных zmMontCreate()).
+*/
+size_t zmRed(
+	const qr_o* r		/*!< [in] описание кольца */
+);
+
+/*!	\brief Имя редукции
+
+	Возвращается имя редукции red: "PLAIN", "CRAND", "BARR", "MONT"
+	или "AUTO".
+	\return Имя редукции или 0, если редукция red неизвестна.
+*/
+const char* zmRedName(
+	size_t red			/*!< [in] редукция */
+);
+
+/*!	\brief Настройка zmCreate()
+
+	Включается (tune == TRUE) или выключается (tune == FALSE) выбор 
+	редукции в zmCreate() по результатам замеров.
+	\return Признак того, что настройка включена.
+	\remark Замеры выполняются при первом создании кольца с новыми 
+	характеристиками модуля. Для замеров выделяется память. Если выделить 
+	память не удалось или длина модуля превышает ZM_TUNE_MAX_N слов, то 
+	редукция выбирается по структуре модуля.
+	\remark Настройку следует включать до создания колец в нескольких 
+	потоках.
+*/
+bool_t zmTune(
+	bool_t tune			/*!< [in] признак настройки */
+);
+
+/*!	\brief Результат настройки
+
+	Определяется редукция, которую zmCreate() выбирает для нечетных модулей 
+	длины n слов вида B^n - c (crand == TRUE) или другого вида 
+	(crand == FALSE). Если настройка включена, но замеры для указанных 
+	характеристик еще не выполнялись, то они выполняются.
+	\return ZM_RED_CRAND, ZM_RED_BARR, ZM_RED_MONT или ZM_RED_PLAIN.
+	\remark Функция позволяет сообщить о выборе, не создавая колец.
+*/
+size_t zmTuned(
+	size_t n,			/*!< [in] длина модуля в словах */
+	bool_t crand		/*!< [in] модуль имеет вид B^n - c */
+);
+
 /*
 *******************************************************************************
 Создание описания кольца Монтгомери
@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers
 \project bee2 [cryptographic library]
 \created 2012.04.22
-\version 2023.02.10
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -372,7 +372,6 @@ size_t zzMul_deep(size_t n, size_t m);
 
 size_t zzMulADK(word c[], const word a[], const word b[], size_t n, void* stack);
 
-
 /*!	\brief Возведение числа в квадрат
 
 	Определяется квадрат [2n]b числа [n]a:
@@ -630,7 +629,7 @@ size_t zzExGCD_deep(size_t n, size_t m);
 	и равняется -1 в остальных случаях.
 	\return Символ Якоби (a / b): 0, 1 или -1.
 	\deep{stack} zzJacobi_deep(n, m).
-	\safe Функция нерегулярна.
+	\safe Функция регулярна: время выполнения зависит только от n и m.
 */
 int zzJacobi(
 	const word a[],		/*!< [in] первое число */
@@ -820,7 +819,7 @@ size_t zzSqrMod_deep(size_t n);
 	\expect \gcd(a, mod) == 1.
 	\remark Если \gcd(a, mod) != 1, то b <- 0.
 	\deep{stack} zzInvMod_deep(n).
-	\safe Функция нерегулярна.
+	\safe Функция регулярна (см. zzDivMod()).
 */
 void zzInvMod(
 	word b[],			/*!< [out] обратное число */
@@ -845,7 +844,8 @@ size_t zzInvMod_deep(size_t n);
 	\expect \gcd(a, mod) = 1.
 	\remark Если \gcd(a, mod) != 1, то b <- 0.
 	\deep{stack} zzDivMod_deep(n).
-	\safe Функция нерегулярна.
+	\safe Функция регулярна: число итераций и обращения к памяти
+	определяются только длиной mod.
 */
 void zzDivMod(
 	word b[],				/*!< [out] частное */
@@ -1120,6 +1120,68 @@ void FAST(zzRedMont)(word a[], const word mod[], size_t n,
 
 size_t zzRedMont_deep(size_t n);
 
+/*!	\brief Умножение Монтгомери
+
+	Определяется произведение Монтгомери [n]c чисел [n]a и [n]b по
+	модулю [n]mod:
+	\code
+		c <- a * b * R^{-1} \mod mod, R == B^n.
+	\endcode
+	При вычислениях используется параметр Монтгомери mont_param.
+	Умножение и редукция выполняются одновременно (алгоритм CIOS).
+	\pre mod -- нечетное && mod[n - 1] != 0.
+	\pre a, b < mod.
+	\pre mont_param рассчитан с помощью функции wordNegInv().
+	\remark Буфер c может пересекаться с буферами a и b.
+	\deep{stack} zzMulMont_deep(n).
+	\safe Имеется ускоренная нерегулярная редакция.
+*/
+void zzMulMont(
+	word c[],					/*!< [out] произведение */
+	const word a[],				/*!< [in] первый множитель */
+	const word b[],				/*!< [in] второй множитель */
+	const word mod[],			/*!< [in] модуль */
+	size_t n,					/*!< [in] длина mod в машинных словах */
+	register word mont_param,	/*!< [in] параметр Монтгомери */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+void SAFE(zzMulMont)(word c[], const word a[], const word b[],
+	const word mod[], size_t n, register word mont_param, void* stack);
+void FAST(zzMulMont)(word c[], const word a[], const word b[],
+	const word mod[], size_t n, register word mont_param, void* stack);
+
+size_t zzMulMont_deep(size_t n);
+
+/*!	\brief Возведение в квадрат Монтгомери
+
+	Определяется квадрат Монтгомери [n]b числа [n]a по модулю [n]mod:
+	\code
+		b <- a * a * R^{-1} \mod mod, R == B^n.
+	\endcode
+	\pre mod -- нечетное && mod[n - 1] != 0.
+	\pre a < mod.
+	\pre mont_param рассчитан с помощью функции wordNegInv().
+	\remark Буфер b может пересекаться с буфером a.
+	\deep{stack} zzSqrMont_deep(n).
+	\safe Имеется ускоренная нерегулярная редакция.
+*/
+void zzSqrMont(
+	word b[],					/*!< [out] квадрат */
+	const word a[],				/*!< [in] основание */
+	const word mod[],			/*!< [in] модуль */
+	size_t n,					/*!< [in] длина mod в машинных словах */
+	register word mont_param,	/*!< [in] параметр Монтгомери */
+	void* stack					/*!< [in] вспомогательная память */
+);
+
+void SAFE(zzSqrMont)(word b[], const word a[], const word mod[], size_t n,
+	register word mont_param, void* stack);
+void FAST(zzSqrMont)(word b[], const word a[], const word mod[], size_t n,
+	register word mont_param, void* stack);
+
+size_t zzSqrMont_deep(size_t n);
+
 /*!	\brief Редукция Монтгомери по модулю Крэндалла
 
 	Определяется результат [n]a редукции Монтгомери числа [2n]a по
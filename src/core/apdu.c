@@ -4,7 +4,7 @@
 \brief Smart card Application Protocol Data Unit
 \project bee2 [cryptographic library]
 \created 2022.10.31
-\version 2022.11.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -122,24 +122,19 @@ size_t apduCmdEnc(octet apdu[], const apdu_cmd_t* cmd)
 	return count;
 }
 
-size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
+bool_t apduCmdView(apdu_cmd_view_t* view, const octet apdu[], size_t count)
 {
+	const octet* hdr = apdu;
 	size_t cdf_len_len;
 	size_t cdf_len;
+	const octet* cdf;
 	size_t rdf_len;
 	// pre
 	ASSERT(memIsValid(apdu, count));
-	ASSERT(memIsNullOrValid(cmd, sizeof(apdu_cmd_t)));
-	// декодировать заголовок
+	ASSERT(memIsNullOrValid(view, sizeof(apdu_cmd_view_t)));
+	// пропустить заголовок
 	if (count < 4)
-		return SIZE_MAX;
-	if (cmd)
-	{
-		ASSERT(memIsDisjoint2(cmd, sizeof(apdu_cmd_t), apdu, count));
-		memSetZero(cmd, sizeof(apdu_cmd_t));
-		cmd->cla = apdu[0], cmd->ins = apdu[1];
-		cmd->p1 = apdu[2], cmd->p2 = apdu[3];
-	}
+		return FALSE;
 	apdu += 4, count -= 4;
 	// декодировать cdf_len
 	if (count == 0 || count == 1 || count == 3 && apdu[0] == 0)
@@ -154,7 +149,7 @@ size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
 		else
 		{
 			if (count < 3)
-				return SIZE_MAX;
+				return FALSE;
 			cdf_len_len = 3;
 			cdf_len = apdu[1], cdf_len *= 256, cdf_len += apdu[2];
 		}
@@ -162,9 +157,8 @@ size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
 	}
 	// декодировать cdf
 	if (cdf_len > count)
-		return SIZE_MAX;
-	if (cmd)
-		memCopy(cmd->cdf, apdu, cdf_len);
+		return FALSE;
+	cdf = apdu;
 	apdu += cdf_len, count -= cdf_len;
 	// декодировать rdf_len
 	switch (count)
@@ -178,7 +172,7 @@ size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
 		if (rdf_len == 0)
 			rdf_len = 256;
 		if (cdf_len_len == 3)
-			return SIZE_MAX;
+			return FALSE;
 		break;
 	case 2:
 		// длинная форма, 2 октета
@@ -186,7 +180,7 @@ size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
 		if (rdf_len == 0)
 			rdf_len = 65536;
 		if (cdf_len_len <= 1 || cdf_len < 256 && rdf_len <= 256)
-			return SIZE_MAX;
+			return FALSE;
 		break;
 	case 3:
 		// длинная форма, 3 октета
@@ -194,16 +188,47 @@ size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
 		if (rdf_len == 0)
 			rdf_len = 65536;
 		if (apdu[0] != 0 || cdf_len_len != 0 || rdf_len <= 256)
-			return SIZE_MAX;
+			return FALSE;
 		break;
 	default:
-		return SIZE_MAX;
+		return FALSE;
+	}
+	// заполнить представление
+	if (view)
+	{
+		ASSERT(memIsDisjoint2(view, sizeof(apdu_cmd_view_t), hdr, 4));
+		view->cla = hdr[0], view->ins = hdr[1];
+		view->p1 = hdr[2], view->p2 = hdr[3];
+		view->rdf_len = rdf_len;
+		view->cdf_len = cdf_len;
+		view->cdf = cdf;
 	}
-	// сохранить длины
+	return TRUE;
+}
+
+size_t apduCmdDec(apdu_cmd_t* cmd, const octet apdu[], size_t count)
+{
+	apdu_cmd_view_t view[1];
+	// pre
+	ASSERT(memIsValid(apdu, count));
+	ASSERT(memIsNullOrValid(cmd, sizeof(apdu_cmd_t)));
+	// декодировать
+	if (!apduCmdView(view, apdu, count))
+		return SIZE_MAX;
+	// скопировать
 	if (cmd)
-		cmd->cdf_len = cdf_len, cmd->rdf_len = rdf_len;
+	{
+		ASSERT(memIsDisjoint2(cmd, sizeof(apdu_cmd_t) + view->cdf_len,
+			apdu, count));
+		memSetZero(cmd, sizeof(apdu_cmd_t));
+		cmd->cla = view->cla, cmd->ins = view->ins;
+		cmd->p1 = view->p1, cmd->p2 = view->p2;
+		cmd->rdf_len = view->rdf_len;
+		cmd->cdf_len = view->cdf_len;
+		memCopy(cmd->cdf, view->cdf, view->cdf_len);
+	}
 	// возвратить размер cmd
-	return sizeof(apdu_cmd_t) + cdf_len;
+	return sizeof(apdu_cmd_t) + view->cdf_len;
 }
 
 /*
@@ -234,6 +259,24 @@ size_t apduRespEnc(octet apdu[], const apdu_resp_t* resp)
 	return resp->rdf_len + 2;
 }
 
+bool_t apduRespView(apdu_resp_view_t* view, const octet apdu[],
+	size_t count)
+{
+	// pre
+	ASSERT(memIsValid(apdu, count));
+	ASSERT(memIsNullOrValid(view, sizeof(apdu_resp_view_t)));
+	// декодировать
+	if (count < 2)
+		return FALSE;
+	if (view)
+	{
+		view->sw1 = apdu[count - 2], view->sw2 = apdu[count - 1];
+		view->rdf_len = count - 2;
+		view->rdf = apdu;
+	}
+	return TRUE;
+}
+
 size_t apduRespDec(apdu_resp_t* resp, const octet apdu[], size_t count)
 {
 	// pre
@@ -4,7 +4,7 @@
 \brief The Base64 encoding
 \project bee2 [cryptographic library]
 \created 2016.06.16
-\version 2016.09.01
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,6 +12,7 @@
 
 #include "bee2/core/b64.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/str.h"
 #include "bee2/core/util.h"
 
@@ -47,6 +48,393 @@ static const octet b64_dec_table[256] = {
 	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
 };
 
+/*
+*******************************************************************************
+Векторная обработка
+
+Функции b64FromV(), b64ToV() и b64IsValidV() обрабатывают префикс данных
+блоками и возвращают длину обработанного префикса (в октетах для
+b64FromV() и в символах для остальных функций). Остаток данных
+обрабатывается побайтово.
+
+Используются алгоритмы В. Мулы и Д. Лемира [Mula W., Lemire D. Faster
+Base64 Encoding and Decoding Using AVX2 Instructions, 2018]:
+- при кодировании тройки октетов переставляются командой pshufb,
+  6-ки битов выделяются умножениями, номера символов переводятся в символы
+  прибавлением смещения, которое выбирается по таблице из 16 элементов;
+- при декодировании символ c разбивается на тетрады hi и lo, допустимость
+  символа проверяется по битовой маске mask_lut[lo] & bit_lut[hi], значение
+  6-ки определяется прибавлением к c смещения shift_lut[hi] (для символа
+  '/' смещение особое), 6-ки объединяются умножениями и перестановкой.
+
+На платформе x86 команда pshufb входит в набор SSSE3, который не является
+обязательным. Поэтому реализации SSSE3 и AVX2 компилируются с атрибутом
+target и выбираются при первом обращении по результатам cpuid (как в
+belt_lcl.c). На платформе AArch64 используются команды NEON.
+
+Функции b64FromV() и b64ToV() пишут в приемник полными векторами,
+поэтому обработка завершается до того, как векторная запись может
+выйти за границы приемника.
+*******************************************************************************
+*/
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+#define B64_SSSE3 __attribute__((target("ssse3")))
+#define B64_AVX2 __attribute__((target("avx2")))
+
+B64_SSSE3 static inline __m128i b64EncSSSE3(__m128i in)
+{
+	__m128i t0, t1;
+	// переставить октеты: (s_0, s_1, s_2) -> (s_1, s_0, s_2, s_1)
+	in = _mm_shuffle_epi8(in,
+		_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	// выделить 6-ки
+	t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+		_mm_set1_epi32(0x04000040));
+	t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+		_mm_set1_epi32(0x01000010));
+	in = _mm_or_si128(t0, t1);
+	// перейти к символам
+	t0 = _mm_subs_epu8(in, _mm_set1_epi8(51));
+	t1 = _mm_cmpgt_epi8(_mm_set1_epi8(26), in);
+	t0 = _mm_or_si128(t0, _mm_and_si128(t1, _mm_set1_epi8(13)));
+	t0 = _mm_shuffle_epi8(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), t0);
+	return _mm_add_epi8(t0, in);
+}
+
+B64_SSSE3 static inline __m128i b64DecSSSE3(__m128i c, __m128i* bad)
+{
+	__m128i hi, lo, sh, eq;
+	hi = _mm_and_si128(_mm_srli_epi32(c, 4), _mm_set1_epi8(15));
+	lo = _mm_and_si128(c, _mm_set1_epi8(15));
+	// проверить символы
+	eq = _mm_and_si128(
+		_mm_shuffle_epi8(_mm_setr_epi8(
+			(char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF0, 0x54, 0x50, 0x50, 0x50, 0x54), lo),
+		_mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128,
+			0, 0, 0, 0, 0, 0, 0, 0), hi));
+	*bad = _mm_or_si128(*bad, _mm_cmpeq_epi8(eq, _mm_setzero_si128()));
+	// определить смещения
+	sh = _mm_shuffle_epi8(_mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71,
+		0, 0, 0, 0, 0, 0, 0, 0), hi);
+	eq = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+	sh = _mm_or_si128(_mm_andnot_si128(eq, sh),
+		_mm_and_si128(eq, _mm_set1_epi8(16)));
+	return _mm_add_epi8(c, sh);
+}
+
+B64_SSSE3 static inline __m128i b64PackSSSE3(__m128i v)
+{
+	v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+	v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+	return _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+		14, 13, 12, -1, -1, -1, -1));
+}
+
+B64_SSSE3 static size_t b64FromSSSE3(char* dest, const octet* src,
+	size_t count)
+{
+	size_t done = 0;
+	for (; done + 16 <= count; done += 12, dest += 16)
+		_mm_storeu_si128((__m128i*)dest,
+			b64EncSSSE3(_mm_loadu_si128((const __m128i*)(src + done))));
+	return done;
+}
+
+B64_SSSE3 static size_t b64ToSSSE3(octet* dest, const char* src, size_t len)
+{
+	size_t done = 0;
+	__m128i bad = _mm_setzero_si128();
+	for (; done + 24 <= len; done += 16, dest += 12)
+		_mm_storeu_si128((__m128i*)dest, b64PackSSSE3(b64DecSSSE3(
+			_mm_loadu_si128((const __m128i*)(src + done)), &bad)));
+	ASSERT(_mm_movemask_epi8(bad) == 0);
+	return done;
+}
+
+B64_SSSE3 static size_t b64IsValidSSSE3(const char* b64, size_t len)
+{
+	size_t done = 0;
+	for (; done + 16 <= len; done += 16)
+	{
+		__m128i bad = _mm_setzero_si128();
+		b64DecSSSE3(_mm_loadu_si128((const __m128i*)(b64 + done)), &bad);
+		if (_mm_movemask_epi8(bad))
+			break;
+	}
+	return done;
+}
+
+B64_AVX2 static inline __m256i b64EncAVX2(__m256i in)
+{
+	__m256i t0, t1;
+	in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+		10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+		10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	t0 = _mm256_mulhi_epu16(
+		_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)),
+		_mm256_set1_epi32(0x04000040));
+	t1 = _mm256_mullo_epi16(
+		_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)),
+		_mm256_set1_epi32(0x01000010));
+	in = _mm256_or_si256(t0, t1);
+	t0 = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+	t1 = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), in);
+	t0 = _mm256_or_si256(t0, _mm256_and_si256(t1, _mm256_set1_epi8(13)));
+	t0 = _mm256_shuffle_epi8(_mm256_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0,
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0), t0);
+	return _mm256_add_epi8(t0, in);
+}
+
+B64_AVX2 static inline __m256i b64DecAVX2(__m256i c, __m256i* bad)
+{
+	__m256i hi, lo, sh, eq;
+	hi = _mm256_and_si256(_mm256_srli_epi32(c, 4), _mm256_set1_epi8(15));
+	lo = _mm256_and_si256(c, _mm256_set1_epi8(15));
+	eq = _mm256_and_si256(
+		_mm256_shuffle_epi8(_mm256_setr_epi8(
+			(char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF0, 0x54, 0x50, 0x50, 0x50, 0x54,
+			(char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+			(char)0xF0, 0x54, 0x50, 0x50, 0x50, 0x54), lo),
+		_mm256_shuffle_epi8(_mm256_setr_epi8(
+			1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0), hi));
+	*bad = _mm256_or_si256(*bad,
+		_mm256_cmpeq_epi8(eq, _mm256_setzero_si256()));
+	sh = _mm256_shuffle_epi8(_mm256_setr_epi8(
+		0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), hi);
+	eq = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+	sh = _mm256_blendv_epi8(sh, _mm256_set1_epi8(16), eq);
+	return _mm256_add_epi8(c, sh);
+}
+
+B64_AVX2 static inline __m256i b64PackAVX2(__m256i v)
+{
+	v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+	v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+	v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+	return _mm256_permutevar8x32_epi32(v,
+		_mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+
+B64_AVX2 static size_t b64FromAVX2(char* dest, const octet* src,
+	size_t count)
+{
+	size_t done = 0;
+	for (; done + 28 <= count; done += 24, dest += 32)
+	{
+		__m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(
+			_mm_loadu_si128((const __m128i*)(src + done))),
+			_mm_loadu_si128((const __m128i*)(src + done + 12)), 1);
+		_mm256_storeu_si256((__m256i*)dest, b64EncAVX2(in));
+	}
+	return done;
+}
+
+B64_AVX2 static size_t b64ToAVX2(octet* dest, const char* src, size_t len)
+{
+	size_t done = 0;
+	__m256i bad = _mm256_setzero_si256();
+	for (; done + 48 <= len; done += 32, dest += 24)
+		_mm256_storeu_si256((__m256i*)dest, b64PackAVX2(b64DecAVX2(
+			_mm256_loadu_si256((const __m256i*)(src + done)), &bad)));
+	ASSERT(_mm256_testz_si256(bad, bad));
+	return done;
+}
+
+B64_AVX2 static size_t b64IsValidAVX2(const char* b64, size_t len)
+{
+	size_t done = 0;
+	for (; done + 32 <= len; done += 32)
+	{
+		__m256i bad = _mm256_setzero_si256();
+		b64DecAVX2(_mm256_loadu_si256((const __m256i*)(b64 + done)), &bad);
+		if (!_mm256_testz_si256(bad, bad))
+			break;
+	}
+	return done;
+}
+
+static size_t b64FromNone(char* dest, const octet* src, size_t count)
+{
+	return 0;
+}
+
+static size_t b64ToNone(octet* dest, const char* src, size_t len)
+{
+	return 0;
+}
+
+static size_t b64IsValidNone(const char* b64, size_t len)
+{
+	return 0;
+}
+
+static size_t _once;
+static size_t (*_b64_from)(char*, const octet*, size_t) = b64FromNone;
+static size_t (*_b64_to)(octet*, const char*, size_t) = b64ToNone;
+static size_t (*_b64_is_valid)(const char*, size_t) = b64IsValidNone;
+
+static void b64SelectV()
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		_b64_from = b64FromAVX2;
+		_b64_to = b64ToAVX2;
+		_b64_is_valid = b64IsValidAVX2;
+	}
+	else if (__builtin_cpu_supports("ssse3"))
+	{
+		_b64_from = b64FromSSSE3;
+		_b64_to = b64ToSSSE3;
+		_b64_is_valid = b64IsValidSSSE3;
+	}
+}
+
+static size_t b64FromV(char* dest, const octet* src, size_t count)
+{
+	mtCallOnce(&_once, b64SelectV);
+	return _b64_from(dest, src, count);
+}
+
+static size_t b64ToV(octet* dest, const char* src, size_t len)
+{
+	mtCallOnce(&_once, b64SelectV);
+	return _b64_to(dest, src, len);
+}
+
+static size_t b64IsValidV(const char* b64, size_t len)
+{
+	mtCallOnce(&_once, b64SelectV);
+	return _b64_is_valid(b64, len);
+}
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+static inline uint8x16_t b64DecNEON(uint8x16_t c, uint8x16_t* bad)
+{
+	static const octet mask_lut[16] = {
+		0xA8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+		0xF8, 0xF8, 0xF0, 0x54, 0x50, 0x50, 0x50, 0x54,
+	};
+	static const octet bit_lut[16] = {
+		1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+	static const octet shift_lut[16] = {
+		0, 0, 19, 4, 191, 191, 185, 185, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+	uint8x16_t hi = vshrq_n_u8(c, 4);
+	uint8x16_t lo = vandq_u8(c, vdupq_n_u8(15));
+	uint8x16_t sh;
+	*bad = vorrq_u8(*bad, vceqq_u8(vandq_u8(
+		vqtbl1q_u8(vld1q_u8(mask_lut), lo),
+		vqtbl1q_u8(vld1q_u8(bit_lut), hi)), vdupq_n_u8(0)));
+	sh = vqtbl1q_u8(vld1q_u8(shift_lut), hi);
+	sh = vbslq_u8(vceqq_u8(c, vdupq_n_u8('/')), vdupq_n_u8(16), sh);
+	return vaddq_u8(c, sh);
+}
+
+static size_t b64FromV(char* dest, const octet* src, size_t count)
+{
+	uint8x16x4_t lut, out;
+	uint8x16x3_t in;
+	size_t done = 0;
+	lut = vld1q_u8_x4((const uint8_t*)b64_alphabet);
+	for (; done + 48 <= count; done += 48, dest += 64)
+	{
+		in = vld3q_u8(src + done);
+		out.val[0] = vshrq_n_u8(in.val[0], 2);
+		out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+			vshrq_n_u8(in.val[1], 4)), vdupq_n_u8(63));
+		out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+			vshrq_n_u8(in.val[2], 6)), vdupq_n_u8(63));
+		out.val[3] = vandq_u8(in.val[2], vdupq_n_u8(63));
+		out.val[0] = vqtbl4q_u8(lut, out.val[0]);
+		out.val[1] = vqtbl4q_u8(lut, out.val[1]);
+		out.val[2] = vqtbl4q_u8(lut, out.val[2]);
+		out.val[3] = vqtbl4q_u8(lut, out.val[3]);
+		vst4q_u8((uint8_t*)dest, out);
+	}
+	return done;
+}
+
+static size_t b64ToV(octet* dest, const char* src, size_t len)
+{
+	uint8x16x4_t in;
+	uint8x16x3_t out;
+	uint8x16_t bad = vdupq_n_u8(0);
+	size_t done = 0;
+	for (; done + 64 <= len; done += 64, dest += 48)
+	{
+		in = vld4q_u8((const uint8_t*)src + done);
+		in.val[0] = b64DecNEON(in.val[0], &bad);
+		in.val[1] = b64DecNEON(in.val[1], &bad);
+		in.val[2] = b64DecNEON(in.val[2], &bad);
+		in.val[3] = b64DecNEON(in.val[3], &bad);
+		out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2),
+			vshrq_n_u8(in.val[1], 4));
+		out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4),
+			vshrq_n_u8(in.val[2], 2));
+		out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+		vst3q_u8(dest, out);
+	}
+	ASSERT(vmaxvq_u8(bad) == 0);
+	return done;
+}
+
+static size_t b64IsValidV(const char* b64, size_t len)
+{
+	size_t done = 0;
+	for (; done + 16 <= len; done += 16)
+	{
+		uint8x16_t bad = vdupq_n_u8(0);
+		b64DecNEON(vld1q_u8((const uint8_t*)b64 + done), &bad);
+		if (vmaxvq_u8(bad))
+			break;
+	}
+	return done;
+}
+
+#else
+
+static size_t b64FromV(char* dest, const octet* src, size_t count)
+{
+	return 0;
+}
+
+static size_t b64ToV(octet* dest, const char* src, size_t len)
+{
+	return 0;
+}
+
+static size_t b64IsValidV(const char* b64, size_t len)
+{
+	return 0;
+}
+
+#endif
+
 /*
 *******************************************************************************
 Проверка
@@ -56,6 +444,7 @@ static const octet b64_dec_table[256] = {
 bool_t b64IsValid(const char* b64)
 {
 	size_t len;
+	size_t t;
 	if (!strIsValid(b64))
 		return FALSE;
 	// проверить длину
@@ -80,6 +469,8 @@ bool_t b64IsValid(const char* b64)
 		--len;
 	}
 	// проверить остальные символы 
+	t = b64IsValidV(b64, len);
+	b64 += t, len -= t;
 	for (; len--; ++b64)
 		if (b64_dec_table[(octet)*b64] == 0xFF)
 			return FALSE;
@@ -92,41 +483,80 @@ bool_t b64IsValid(const char* b64)
 *******************************************************************************
 */
 
-void b64From(char* dest, const void* src, size_t count)
+static void b64FromBlocks(char* dest, const octet* src, size_t count)
 {
 	register u32 block;
-	ASSERT(memIsDisjoint2(src, count, dest, 4 * ((count + 2) / 3) + 1));
-	for (; count >= 3; count -= 3)
+	size_t done;
+	ASSERT(count % 3 == 0);
+	done = b64FromV(dest, src, count);
+	dest += done / 3 * 4, src += done, count -= done;
+	for (; count; count -= 3)
 	{
-		block  = ((const octet*)src)[0], block <<= 8;
-		block |= ((const octet*)src)[1], block <<= 8;
-		block |= ((const octet*)src)[2];
+		block  = src[0], block <<= 8;
+		block |= src[1], block <<= 8;
+		block |= src[2];
 		dest[3] = b64_alphabet[block & 63], block >>= 6;
 		dest[2] = b64_alphabet[block & 63], block >>= 6;
 		dest[1] = b64_alphabet[block & 63], block >>= 6;
 		dest[0] = b64_alphabet[block];
-		src = (const octet*)src + 3;
+		src += 3;
 		dest += 4;
 	}
+	block = 0;
+}
+
+static void b64FromTail(char* dest, const octet* src, size_t count)
+{
+	register u32 block;
+	ASSERT(count == 1 || count == 2);
 	if (count == 2)
 	{
-		block  = ((const octet*)src)[0], block <<= 8;
-		block |= ((const octet*)src)[1], block <<= 2;
+		block  = src[0], block <<= 8;
+		block |= src[1], block <<= 2;
 		dest[3] = '=';
 		dest[2] = b64_alphabet[block & 63], block >>= 6;
 		dest[1] = b64_alphabet[block & 63], block >>= 6;
 		dest[0] = b64_alphabet[block];
-		dest += 4;
 	}
-	else if (count == 1)
+	else
 	{
-		block  = ((const octet*)src)[0], block <<= 4;
+		block  = src[0], block <<= 4;
 		dest[3] = dest[2] = '=';
 		dest[1] = b64_alphabet[block & 63], block >>= 6;
 		dest[0] = b64_alphabet[block];
-		dest += 4;
 	}
+	block = 0;
+}
+
+void b64From(char* dest, const void* src, size_t count)
+{
+	ASSERT(memIsDisjoint2(src, count, dest, 4 * ((count + 2) / 3) + 1));
+	b64FromBlocks(dest, (const octet*)src, count / 3 * 3);
+	dest += count / 3 * 4, src = (const octet*)src + count / 3 * 3;
+	if (count %= 3)
+		b64FromTail(dest, (const octet*)src, count), dest += 4;
 	*dest = '\0';
+}
+
+static void b64ToBlocks(octet* dest, const char* src, size_t len)
+{
+	register u32 block;
+	size_t done;
+	ASSERT(len % 4 == 0);
+	done = b64ToV(dest, src, len);
+	dest += done / 4 * 3, src += done, len -= done;
+	for (; len; len -= 4)
+	{
+		block  = b64_dec_table[(octet)src[0]], block <<= 6;
+		block |= b64_dec_table[(octet)src[1]], block <<= 6;
+		block |= b64_dec_table[(octet)src[2]], block <<= 6;
+		block |= b64_dec_table[(octet)src[3]];
+		dest[2] = block & 255, block >>= 8;
+		dest[1] = block & 255, block >>= 8;
+		dest[0] = block;
+		src += 4;
+		dest += 3;
+	}
 	block = 0;
 }
 
@@ -147,18 +577,8 @@ void b64To(void* dest, size_t* count, const char* src)
 		return;
 	// декодировать
 	ASSERT(memIsDisjoint2(src, strLen(src) + 1, dest, *count));
-	for (; len >= 4; len -= 4)
-	{
-		block  = b64_dec_table[(octet)src[0]], block <<= 6;
-		block |= b64_dec_table[(octet)src[1]], block <<= 6;
-		block |= b64_dec_table[(octet)src[2]], block <<= 6;
-		block |= b64_dec_table[(octet)src[3]];
-		((octet*)dest)[2] = block & 255, block >>= 8;
-		((octet*)dest)[1] = block & 255, block >>= 8;
-		((octet*)dest)[0] = block;
-		src += 4;
-		dest = (octet*)dest + 3;
-	}
+	b64ToBlocks((octet*)dest, src, len / 4 * 4);
+	dest = (octet*)dest + len / 4 * 3, src += len / 4 * 4, len %= 4;
 	if (len == 3)
 	{
 		block  = b64_dec_table[(octet)src[0]], block <<= 6;
@@ -175,3 +595,193 @@ void b64To(void* dest, size_t* count, const char* src)
 	}
 	block = 0;
 }
+
+/*
+*******************************************************************************
+Потоковое кодирование
+
+В состоянии кодирования накапливается неполная тройка октетов, в состоянии
+декодирования -- неполная четверка символов (в виде 6-к). Полные тройки
+и четверки внутри фрагмента обрабатываются функциями b64FromBlocks() и
+b64ToBlocks() (с векторной обработкой). Перед декодированием определяется
+наибольший префикс фрагмента из символов алфавита (b64IsValidV() и
+побайтовое продолжение). Остаток фрагмента -- не более 3 символов
+алфавита и символ за пределами алфавита -- обрабатывается посимвольно
+функцией b64ToPush(): символ '=' допускается только на позициях 2 и 3
+четверки, после '=' допускается только '=', четверка с '=' завершает
+поток.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t n;				/*!< число октетов в buf */
+	octet buf[3];			/*!< неполная тройка */
+} b64_from_st;
+
+typedef struct
+{
+	size_t n;				/*!< число 6-к в buf */
+	size_t eq;				/*!< число символов '=' в buf */
+	bool_t over;			/*!< поток завершен паддингом? */
+	bool_t err;				/*!< ошибка формата? */
+	octet buf[4];			/*!< неполная четверка */
+} b64_to_st;
+
+size_t b64From_keep()
+{
+	return sizeof(b64_from_st);
+}
+
+void b64FromStart(void* state)
+{
+	ASSERT(memIsValid(state, b64From_keep()));
+	memSetZero(state, b64From_keep());
+}
+
+size_t b64FromStep(char* dest, const void* src, size_t count, void* state)
+{
+	b64_from_st* st = (b64_from_st*)state;
+	size_t len = 0;
+	size_t t;
+	ASSERT(memIsValid(state, b64From_keep()));
+	ASSERT(st->n < 3);
+	ASSERT(memIsDisjoint2(src, count, dest, 4 * ((st->n + count) / 3)));
+	// дополнить неполную тройку
+	if (st->n)
+	{
+		t = MIN2(3 - st->n, count);
+		memCopy(st->buf + st->n, src, t);
+		st->n += t, src = (const octet*)src + t, count -= t;
+		if (st->n < 3)
+			return 0;
+		b64FromBlocks(dest, st->buf, 3);
+		dest += 4, len = 4, st->n = 0;
+	}
+	// полные тройки
+	t = count / 3 * 3;
+	b64FromBlocks(dest, (const octet*)src, t);
+	len += t / 3 * 4;
+	// сохранить остаток
+	st->n = count - t;
+	memCopy(st->buf, (const octet*)src + t, st->n);
+	return len;
+}
+
+size_t b64FromStop(char* dest, void* state)
+{
+	b64_from_st* st = (b64_from_st*)state;
+	size_t len = 0;
+	ASSERT(memIsValid(state, b64From_keep()));
+	ASSERT(st->n < 3);
+	ASSERT(memIsValid(dest, st->n ? 4 : 0));
+	if (st->n)
+		b64FromTail(dest, st->buf, st->n), len = 4;
+	memSetZero(st, sizeof(b64_from_st));
+	return len;
+}
+
+size_t b64To_keep()
+{
+	return sizeof(b64_to_st);
+}
+
+void b64ToStart(void* state)
+{
+	ASSERT(memIsValid(state, b64To_keep()));
+	memSetZero(state, b64To_keep());
+}
+
+static size_t b64ToPush(octet* dest, char c, b64_to_st* st)
+{
+	register u32 block;
+	octet v = b64_dec_table[(octet)c];
+	// проверить символ
+	if (st->over)
+		return SIZE_MAX;
+	if (c == '=')
+	{
+		if (st->n < 2)
+			return SIZE_MAX;
+		++st->eq, v = 0;
+	}
+	else if (v == 0xFF || st->eq)
+		return SIZE_MAX;
+	st->buf[st->n++] = v;
+	if (st->n < 4)
+		return 0;
+	// обработать четверку
+	st->n = 0;
+	block  = st->buf[0], block <<= 6;
+	block |= st->buf[1], block <<= 6;
+	block |= st->buf[2], block <<= 6;
+	block |= st->buf[3];
+	if (st->eq == 0)
+	{
+		dest[2] = block & 255, block >>= 8;
+		dest[1] = block & 255, block >>= 8;
+		dest[0] = block;
+		return 3;
+	}
+	st->over = TRUE;
+	if (st->eq == 1)
+	{
+		if (st->buf[2] & 3)
+			return block = 0, SIZE_MAX;
+		block >>= 8;
+		dest[1] = block & 255, block >>= 8;
+		dest[0] = block;
+		return 2;
+	}
+	if (st->buf[1] & 15)
+		return block = 0, SIZE_MAX;
+	dest[0] = block >> 16;
+	block = 0;
+	return 1;
+}
+
+size_t b64ToStep(void* dest, const char* src, size_t count, void* state)
+{
+	b64_to_st* st = (b64_to_st*)state;
+	size_t len = 0;
+	size_t t;
+	ASSERT(memIsValid(state, b64To_keep()));
+	ASSERT(memIsValid(src, count));
+	ASSERT(memIsDisjoint2(src, count, dest, 3 * ((count + 3) / 4)));
+	if (st->err)
+		return SIZE_MAX;
+	// дополнить неполную четверку
+	for (; count && st->n; ++src, --count)
+	{
+		t = b64ToPush((octet*)dest + len, *src, st);
+		if (t == SIZE_MAX)
+			return st->err = TRUE, SIZE_MAX;
+		len += t;
+	}
+	// полные четверки из символов алфавита
+	if (!st->over)
+	{
+		t = b64IsValidV(src, count);
+		while (t < count && b64_dec_table[(octet)src[t]] != 0xFF)
+			++t;
+		t = t / 4 * 4;
+		b64ToBlocks((octet*)dest + len, src, t);
+		len += t / 4 * 3, src += t, count -= t;
+	}
+	// остаток
+	for (; count; ++src, --count)
+	{
+		t = b64ToPush((octet*)dest + len, *src, st);
+		if (t == SIZE_MAX)
+			return st->err = TRUE, SIZE_MAX;
+		len += t;
+	}
+	return len;
+}
+
+bool_t b64ToStop(const void* state)
+{
+	const b64_to_st* st = (const b64_to_st*)state;
+	ASSERT(memIsValid(state, b64To_keep()));
+	return !st->err && st->n == 0;
+}
@@ -4,7 +4,7 @@
 \brief Blobs
 \project bee2 [cryptographic library]
 \created 2012.04.01
-\version 2015.12.09
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,18 +12,37 @@
 
 #include "bee2/core/blob.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/util.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
 Блоб: реализация
 
-В куче выделяется память под указатель ptr. Память выделяется страницами.
+В куче (или в арене, или в кэше потока, см. ниже) выделяется память под 
+указатель ptr. Память выделяется страницами.
 
-Первые sizeof(size_t) октетов по адресу ptr --- размер блоба,
-следующие октеты --- собственно блоб.
+Первые sizeof(size_t) октетов по адресу ptr --- размер выделенной памяти
+(вместе с заголовком), следующие sizeof(size_t) октетов --- размер блоба,
+следующие октеты --- собственно блоб. Размер выделенной памяти может 
+превышать blobActualSize() от размера блоба, если память получена 
+из арены или из кэша.
 
-\todo Обеспечить защиту памяти блоба от утечек.
+Блоб при создании обнуляется, а высокоуровневые функции, которые 
+размещают в блобе состояние и стек, рассчитывают стек по максимальной 
+глубине вызовов (см. _deep) и обычно используют только его начальную 
+часть. Поэтому при закрытии блоба очищается только его загрязненная 
+часть: префикс до последней страницы (BLOB_PAGE_SIZE октетов от начала 
+блоба), содержащей ненулевые октеты. Страницы за ней уже нулевые, и их 
+очистка ничего не меняет, но вытесняет данные из кэша процессора. 
+Границу определяет blobDirtySize(): страницы проверяются с конца 
+функцией memIsZero(), время проверки страницы не зависит от ее 
+содержимого. Утечка по времени ограничена номером последней 
+загрязненной страницы, т.е. объемом использованного стека. Чтение 
+нулевой страницы, которая находится в кэше L1, не быстрее ее очистки, 
+поэтому первые BLOB_DIRTY_MIN октетов блоба не проверяются и 
+очищаются всегда.
 
 \todo Полноценная проверка корректности блоба.
 *******************************************************************************
@@ -32,36 +51,379 @@
 // память для блобов выделяется страницами
 #define BLOB_PAGE_SIZE 1024
 
+// длина заголовка
+#define BLOB_HDR_SIZE (2 * sizeof(size_t))
+
 // требуется страниц
 #define blobPageCount(size)\
-	(((size) + sizeof(size_t) + BLOB_PAGE_SIZE - 1) / BLOB_PAGE_SIZE)
+	(((size) + BLOB_HDR_SIZE + BLOB_PAGE_SIZE - 1) / BLOB_PAGE_SIZE)
 
 // требуется памяти на страницах
 #define blobActualSize(size)\
 	(blobPageCount(size) * BLOB_PAGE_SIZE)
 
 // heap-указатель для блоба
-#define blobPtrOf(blob) ((size_t*)blob - 1)
+#define blobPtrOf(blob) ((size_t*)blob - 2)
 
 // размер блоба
-#define blobSizeOf(blob) (*blobPtrOf(blob))
+#define blobSizeOf(blob) (blobPtrOf(blob)[1])
 
-// страничный размер блоба
-#define blobActualSizeOf(blob) (blobActualSize(blobSizeOf(blob)))
+// размер выделенной памяти
+#define blobActualSizeOf(blob) (blobPtrOf(blob)[0])
 
 // блоб для heap-указателя
-#define blobValueOf(ptr) ((blob_t)((size_t*)ptr + 1))
+#define blobValueOf(ptr) ((blob_t)((size_t*)ptr + 2))
+
+// блобы меньшего размера очищаются полностью
+#define BLOB_DIRTY_MIN (16 * BLOB_PAGE_SIZE)
+
+// размер загрязненной части блоба
+static size_t blobDirtySize(const blob_t blob)
+{
+	size_t size = blobSizeOf(blob);
+	size_t pos;
+	while (size > BLOB_DIRTY_MIN)
+	{
+		pos = (size - 1) / BLOB_PAGE_SIZE * BLOB_PAGE_SIZE;
+		if (!memIsZero((const octet*)blob + pos, size - pos))
+			break;
+		size = pos;
+	}
+	return size;
+}
+
+/*
+*******************************************************************************
+Арена
+
+Арена -- непрерывная область памяти, выделенная страницами ОС и 
+зафиксированная в оперативной памяти (mlock() / VirtualLock()). Поэтому 
+содержимое блобов, размещенных в арене, не попадает в файл подкачки.
+В ОС Linux область дополнительно исключается из дампов памяти.
+
+Арена нарезается на фрагменты BLOB_ARENA_CLASSES классов: фрагмент 
+класса c содержит (BLOB_PAGE_SIZE << c) октетов. Блоб размещается во 
+фрагменте минимального подходящего класса. Фрагменты выделяются из 
+арены последовательно (указатель _arena_top) и после освобождения 
+блоба не возвращаются в арену, а помещаются в список свободных 
+фрагментов своего класса. Список организован через первые октеты 
+фрагментов. Свободный фрагмент (кроме первых sizeof(size_t) октетов) 
+всегда обнулен. Поэтому при создании блоба в арене обнуление не 
+требуется, а при закрытии достаточно обнулить заголовок и загрязненную 
+часть блоба (октеты за пределами блоба обнуляются в blobResize()). Обнуление 
+здесь заменяет memWipe(): фрагмент остается в списке и его содержимое 
+будет прочитано, поэтому оптимизатор не может исключить запись.
+
+Если подходящего фрагмента нет (арена не создана, исчерпана или блоб 
+слишком велик), то память выделяется в куче.
+
+Доступ к спискам защищен мьютексом _arena_mtx. Указатель _arena 
+читается без блокировки: арена создается и закрывается тогда, когда 
+другие потоки не работают с блобами.
+*******************************************************************************
+*/
+
+#define BLOB_ARENA_CLASSES 7
+
+// размер фрагмента класса c
+#define blobArenaChunkSize(c) ((size_t)BLOB_PAGE_SIZE << (c))
+
+static octet* _arena;				/*< арена */
+static size_t _arena_size;			/*< размер арены */
+static size_t _arena_top;			/*< начало невыделенной части */
+static void* _arena_free[BLOB_ARENA_CLASSES];	/*< свободные фрагменты */
+static mt_mtx_t _arena_mtx[1];		/*< мьютекс */
+
+#if defined OS_WIN
+
+#include <windows.h>
+
+static void* blobArenaMap(size_t size)
+{
+	void* p = VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+	if (p && !VirtualLock(p, size))
+	{
+		VirtualFree(p, 0, MEM_RELEASE);
+		p = 0;
+	}
+	return p;
+}
+
+static void blobArenaUnmap(void* p, size_t size)
+{
+	VirtualUnlock(p, size);
+	VirtualFree(p, 0, MEM_RELEASE);
+}
+
+#elif defined OS_UNIX
+
+#include <sys/mman.h>
+
+static void* blobArenaMap(size_t size)
+{
+	void* p = mmap(0, size, PROT_READ | PROT_WRITE, 
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return 0;
+	if (mlock(p, size) != 0)
+	{
+		munmap(p, size);
+		return 0;
+	}
+#ifdef MADV_DONTDUMP
+	madvise(p, size, MADV_DONTDUMP);
+#endif
+	return p;
+}
+
+static void blobArenaUnmap(void* p, size_t size)
+{
+	munlock(p, size);
+	munmap(p, size);
+}
+
+#else
+
+static void* blobArenaMap(size_t size)
+{
+	return 0;
+}
+
+static void blobArenaUnmap(void* p, size_t size)
+{
+}
+
+#endif
+
+static size_t blobArenaClass(size_t actual_size)
+{
+	size_t c = 0;
+	while (c < BLOB_ARENA_CLASSES && blobArenaChunkSize(c) < actual_size)
+		++c;
+	return c;
+}
+
+static bool_t blobArenaOwns(const void* ptr)
+{
+	return _arena && (const octet*)ptr >= _arena && 
+		(const octet*)ptr < _arena + _arena_size;
+}
+
+static size_t* blobArenaAlloc(size_t actual_size)
+{
+	size_t c;
+	void* ptr = 0;
+	// арена не создана? блоб слишком велик?
+	if (!_arena)
+		return 0;
+	c = blobArenaClass(actual_size);
+	if (c >= BLOB_ARENA_CLASSES)
+		return 0;
+	// взять свободный фрагмент или выделить новый
+	mtMtxLock(_arena_mtx);
+	if (_arena_free[c])
+	{
+		ptr = _arena_free[c];
+		_arena_free[c] = *(void**)ptr;
+	}
+	else if (_arena_size - _arena_top >= blobArenaChunkSize(c))
+	{
+		ptr = _arena + _arena_top;
+		_arena_top += blobArenaChunkSize(c);
+	}
+	mtMtxUnlock(_arena_mtx);
+	if (ptr)
+		*(size_t*)ptr = blobArenaChunkSize(c);
+	return (size_t*)ptr;
+}
+
+static void blobArenaFree(size_t* ptr)
+{
+	size_t c = blobArenaClass(ptr[0]);
+	ASSERT(blobArenaOwns(ptr) && c < BLOB_ARENA_CLASSES);
+	memSetZero(ptr + 1, sizeof(size_t) + blobDirtySize(blobValueOf(ptr)));
+	mtMtxLock(_arena_mtx);
+	*(void**)ptr = _arena_free[c];
+	_arena_free[c] = ptr;
+	mtMtxUnlock(_arena_mtx);
+}
+
+bool_t blobArenaCreate(size_t size)
+{
+	const size_t max_chunk = blobArenaChunkSize(BLOB_ARENA_CLASSES - 1);
+	size_t c;
+	// арена уже создана?
+	if (_arena || size == 0)
+		return FALSE;
+	// округлить размер
+	size = (size + max_chunk - 1) / max_chunk * max_chunk;
+	// создать мьютекс
+	if (!mtMtxCreate(_arena_mtx))
+		return FALSE;
+	// выделить и зафиксировать память
+	_arena = (octet*)blobArenaMap(size);
+	if (!_arena)
+	{
+		mtMtxClose(_arena_mtx);
+		return FALSE;
+	}
+	memSetZero(_arena, size);
+	_arena_size = size, _arena_top = 0;
+	for (c = 0; c < BLOB_ARENA_CLASSES; ++c)
+		_arena_free[c] = 0;
+	return TRUE;
+}
+
+void blobArenaClose()
+{
+	if (!_arena)
+		return;
+	memWipe(_arena, _arena_top);
+	blobArenaUnmap(_arena, _arena_size);
+	_arena = 0, _arena_size = _arena_top = 0;
+	mtMtxClose(_arena_mtx);
+}
+
+bool_t blobArenaIsValid()
+{
+	return _arena != 0;
+}
+
+/*
+*******************************************************************************
+Кэш потока
+
+Кэш потока -- один фрагмент памяти, выделенный в куче и сохраненный 
+в локальной памяти потока (ключ _cache_tls) после закрытия блоба. 
+Фрагмент используется при следующем создании блоба в том же потоке, если 
+его размер достаточен. Поэтому высокоуровневые функции, которые создают 
+и закрывают блоб для состояния и стека при каждом вызове, в повторных 
+вызовах не обращаются к куче.
+
+Кэш не уменьшается: при закрытии блоба его память помещается в кэш, только 
+если она больше кэшированной (и не больше _cache_max), меньший фрагмент 
+при этом освобождается. Память, помещаемая в кэш, обнуляется (заголовок 
+и загрязненная часть блоба). Во вторых sizeof(size_t) октетах фрагмента 
+сохраняется размер закрытого блоба: октеты блоба с меньшими номерами 
+нулевые, и при повторном использовании фрагмента обнулять их не нужно. Как и в арене, обнуление заменяет memWipe(): 
+фрагмент остается доступным через локальную память потока, поэтому 
+оптимизатор не может исключить запись. Фрагмент освобождается (с 
+очисткой) при завершении потока. Фрагмент основного потока освобождается 
+при завершении программы.
+
+Блоб можно закрыть в другом потоке: его память попадет в кэш этого потока 
+или будет освобождена.
+*******************************************************************************
+*/
+
+static size_t _cache_once;			/*< триггер однократности */
+static bool_t _cache_inited;		/*< ключ создан? */
+static mt_tls_t _cache_tls[1];		/*< ключ кэша */
+static size_t _cache_max;			/*< максимальный размер фрагмента */
+
+static void MT_CALLBACK blobCacheClose(void* chunk)
+{
+	if (chunk)
+	{
+		memWipe(chunk, *(size_t*)chunk);
+		memFree(chunk);
+	}
+}
+
+static void blobCacheDestroy()
+{
+	if (_cache_inited)
+	{
+		blobCacheClose(mtTlsGet(_cache_tls)), mtTlsSet(_cache_tls, 0);
+		mtTlsClose(_cache_tls), _cache_inited = FALSE;
+	}
+}
+
+static void blobCacheInit()
+{
+	ASSERT(!_cache_inited);
+	if (!mtTlsCreate(_cache_tls, blobCacheClose))
+		return;
+	if (!utilOnExit(blobCacheDestroy))
+	{
+		mtTlsClose(_cache_tls);
+		return;
+	}
+	_cache_inited = TRUE;
+}
+
+static size_t* blobCacheTake(size_t actual_size)
+{
+	size_t* chunk;
+	if (!_cache_max || !_cache_inited)
+		return 0;
+	chunk = (size_t*)mtTlsGet(_cache_tls);
+	if (!chunk || chunk[0] < actual_size || !mtTlsSet(_cache_tls, 0))
+		return 0;
+	return chunk;
+}
+
+static bool_t blobCachePut(size_t* ptr)
+{
+	size_t* chunk;
+	if (!_cache_max || !_cache_inited || ptr[0] > _cache_max)
+		return FALSE;
+	chunk = (size_t*)mtTlsGet(_cache_tls);
+	if (chunk && chunk[0] >= ptr[0])
+		return FALSE;
+	memSetZero(ptr + 2, blobDirtySize(blobValueOf(ptr)));
+	if (!mtTlsSet(_cache_tls, ptr))
+	{
+		ptr[1] = 0;
+		return FALSE;
+	}
+	blobCacheClose(chunk);
+	return TRUE;
+}
+
+bool_t blobCacheSetMax(size_t max)
+{
+	if (!mtCallOnce(&_cache_once, blobCacheInit) || !_cache_inited)
+		return FALSE;
+	_cache_max = max;
+	return TRUE;
+}
+
+/*
+*******************************************************************************
+Блоб: функции
+
+При сборке с директивой STAT_ENABLED выделение и освобождение памяти
+блобов учитываются в счетчиках памяти (см. stat.h).
+*******************************************************************************
+*/
 
 blob_t blobCreate(size_t size)
 {
 	size_t* ptr;
 	if (size == 0)
 		return 0;
-	ptr = (size_t*)memAlloc(blobActualSize(size));
+	// фрагмент арены уже обнулен
+	ptr = blobArenaAlloc(blobActualSize(size));
+	if (ptr)
+	{
+		ptr[1] = size;
+		STAT_ALLOC(size);
+		return blobValueOf(ptr);
+	}
+	// память из кэша (первые ptr[1] октетов обнулены) или кучи
+	ptr = blobCacheTake(blobActualSize(size));
 	if (ptr == 0)
-		return 0;
-	*ptr = size;
-	memSetZero(blobValueOf(ptr), size);
+	{
+		ptr = (size_t*)memAlloc(blobActualSize(size));
+		if (ptr == 0)
+			return 0;
+		ptr[0] = blobActualSize(size), ptr[1] = 0;
+	}
+	if (ptr[1] < size)
+		memSetZero((octet*)blobValueOf(ptr) + ptr[1], size - ptr[1]);
+	ptr[1] = size;
+	STAT_ALLOC(size);
 	return blobValueOf(ptr);
 }
 
@@ -74,7 +436,7 @@ void blobWipe(blob_t blob)
 {
 	ASSERT(blobIsValid(blob));
 	if (blob != 0)
-		memWipe(blob, blobSizeOf(blob));
+		memWipe(blob, blobDirtySize(blob));
 }
 
 void blobClose(blob_t blob)
@@ -82,8 +444,14 @@ void blobClose(blob_t blob)
 	ASSERT(blobIsValid(blob));
 	if (blob)
 	{
-		memWipe(blobPtrOf(blob), blobActualSizeOf(blob));
-		memFree(blobPtrOf(blob));
+		STAT_FREE(blobSizeOf(blob));
+		if (blobArenaOwns(blobPtrOf(blob)))
+			blobArenaFree(blobPtrOf(blob));
+		else if (!blobCachePut(blobPtrOf(blob)))
+		{
+			memWipe(blobPtrOf(blob), BLOB_HDR_SIZE + blobDirtySize(blob));
+			memFree(blobPtrOf(blob));
+		}
 	}
 }
 
@@ -104,16 +472,38 @@ blob_t blobResize(blob_t blob, size_t size)
 	}
 	// сохранить размер
 	old_size = blobSizeOf(blob);
-	// перераспределить память?
 	ptr = blobPtrOf(blob);
-	if (blobActualSizeOf(blob) != blobActualSize(size))
+	// блоб в арене: фрагмент мал?
+	if (blobArenaOwns(ptr))
+	{
+		if (ptr[0] < blobActualSize(size))
+		{
+			blob_t blob1 = blobCreate(size);
+			if (blob1 == 0)
+				return 0;
+			memCopy(blob1, blob, old_size);
+			blobClose(blob);
+			return blob1;
+		}
+		if (size < old_size)
+			memSetZero((octet*)blob + size, old_size - size);
+	}
+	// блоб в куче: перераспределить память?
+	else if (ptr[0] != blobActualSize(size))
 	{
+		if (size < old_size)
+			memWipe((octet*)blob + size, old_size - size);
 		ptr = (size_t*)memRealloc(ptr, blobActualSize(size));
 		if (ptr == 0)
 			return 0;
+		ptr[0] = blobActualSize(size);
 	}
+	else if (size < old_size)
+		memWipe((octet*)blob + size, old_size - size);
 	// настроить и возвратить блоб
-	*ptr = size;
+	STAT_FREE(old_size);
+	STAT_ALLOC(size);
+	ptr[1] = size;
 	blob = blobValueOf(ptr);
 	if (size > old_size)
 		memSetZero((octet*)blob + old_size, size - old_size);
@@ -4,7 +4,7 @@
 \brief Distinguished Encoding Rules
 \project bee2 [cryptographic library]
 \created 2014.04.21
-\version 2022.11.01
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -457,6 +457,288 @@ size_t derDec4(const octet der[], size_t count, u32 tag, const void* val,
 	return count;
 }
 
+/*
+*******************************************************************************
+Индекс
+
+При построении индекса в поле next незакрытого конструктивного узла
+временно хранится номер его родителя (SIZE_MAX для корня). Незакрытые узлы
+образуют цепочку от текущего родителя к корню, поэтому дополнительная
+память для стека не требуется. При закрытии узла в next записывается
+номер следующего добавляемого узла.
+
+Признак конструктивности определяется по 6-му биту первого октета тега.
+*******************************************************************************
+*/
+
+size_t derIndex(der_node_t nodes[], size_t max, const octet der[],
+	size_t count)
+{
+	size_t n = 0;
+	size_t open = SIZE_MAX;
+	size_t depth = 0;
+	size_t pos = 0;
+	size_t end = count;
+	size_t tl;
+	ASSERT(memIsValid(der, count));
+	ASSERT(memIsValid(nodes, max * sizeof(der_node_t)));
+	while (1)
+	{
+		der_node_t* node;
+		// закрыть заполненные узлы
+		while (open != SIZE_MAX && pos == end)
+		{
+			node = nodes + open;
+			open = node->next, node->next = n, --depth;
+			end = open == SIZE_MAX ? count : nodes[open].val + nodes[open].len;
+		}
+		// корень обработан?
+		if (n > 0 && open == SIZE_MAX)
+			break;
+		// декодировать TL
+		if (n == max)
+			return SIZE_MAX;
+		node = nodes + n;
+		tl = derTLDec(&node->tag, &node->len, der + pos, end - pos);
+		if (tl == SIZE_MAX || node->len > end - pos - tl)
+			return SIZE_MAX;
+		node->depth = depth, node->pos = pos, node->val = pos + tl;
+		// конструктивный узел: спуститься
+		if (der[pos] & 32)
+		{
+			node->next = open, open = n, ++depth;
+			pos = node->val, end = node->val + node->len;
+		}
+		// примитивный узел
+		else
+			node->next = n + 1, pos = node->val + node->len;
+		++n;
+	}
+	return n;
+}
+
+size_t derIndexChild(const der_node_t nodes[], size_t count, size_t i,
+	size_t k)
+{
+	size_t j;
+	ASSERT(memIsValid(nodes, count * sizeof(der_node_t)));
+	if (i >= count || nodes[i].next == i + 1)
+		return SIZE_MAX;
+	for (j = i + 1; k--; j = nodes[j].next)
+		if (nodes[j].next >= nodes[i].next)
+			return SIZE_MAX;
+	return j;
+}
+
+const octet* derIndexVal(size_t* len, const der_node_t nodes[], size_t count,
+	size_t i, const octet der[], u32 tag)
+{
+	ASSERT(memIsValid(nodes, count * sizeof(der_node_t)));
+	ASSERT(len == 0 || memIsValid(len, O_PER_S));
+	if (i >= count || nodes[i].tag != tag)
+		return 0;
+	if (len)
+		*len = nodes[i].len;
+	return der + nodes[i].val;
+}
+
+/*
+*******************************************************************************
+Потоковое декодирование
+
+Состояние хранит стек открытых узлов: корень находится на дне стека,
+последний декодированный узел -- на вершине. Примитивный узел остается на
+вершине, пока не будет выдано его значение.
+
+Пара TL, которая не уместилась в остатке фрагмента, накапливается в буфере
+tl. После добавления в буфер очередного октета выполняется попытка
+декодирования. Если попытка успешна, то TL декодирована точно: при
+нехватке октетов derTLDec() возвращает ошибку. Если попытка неудачна,
+то функция derStreamTLIsBad() отличает ошибку формата от нехватки
+октетов: по префиксу TL определяется ее ожидаемая длина, и ошибкой
+считается неудача при достаточном числе октетов. Длина корректной TL не
+превышает 3 + 1 + O_PER_S октетов, поэтому ошибкой считается также
+ожидаемая длина, большая 16, и неудача на 16 октетах.
+
+Признак примитивности определяется по 6-му биту первого октета тега.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t max;				/*< максимальная глубина вложенности */
+	size_t depth;			/*< число открытых узлов */
+	size_t pos;				/*< смещение очередного октета в потоке */
+	const octet* der;		/*< необработанный остаток фрагмента */
+	size_t count;			/*< длина остатка */
+	size_t tl_count;		/*< число октетов в буфере tl */
+	octet tl[16];			/*< буфер пары TL */
+	bool_t err;				/*< признак ошибки формата */
+	der_node_t nodes[];		/*< открытые узлы */
+} der_stream_st;
+
+size_t derStream_keep(size_t depth)
+{
+	return sizeof(der_stream_st) + depth * sizeof(der_node_t);
+}
+
+void derStreamStart(void* state, size_t depth)
+{
+	der_stream_st* st = (der_stream_st*)state;
+	ASSERT(depth > 0);
+	ASSERT(memIsValid(state, derStream_keep(depth)));
+	memSetZero(st, sizeof(der_stream_st));
+	st->max = depth;
+}
+
+void derStreamStepI(const void* der, size_t count, void* state)
+{
+	der_stream_st* st = (der_stream_st*)state;
+	ASSERT(memIsValid(state, sizeof(der_stream_st)));
+	ASSERT(memIsValid(der, count));
+	ASSERT(st->err || st->count == 0);
+	st->der = (const octet*)der, st->count = count;
+}
+
+static void derStreamSkip(der_stream_st* st, size_t count)
+{
+	ASSERT(count <= st->count);
+	st->der += count, st->count -= count, st->pos += count;
+}
+
+static bool_t derStreamIsPrimitive(u32 tag)
+{
+	for (; tag > 255; tag >>= 8);
+	return (tag & 32) == 0;
+}
+
+static bool_t derStreamTLIsBad(const octet der[], size_t count)
+{
+	size_t need = 1;
+	ASSERT(memIsValid(der, count));
+	if (count >= 16)
+		return TRUE;
+	// длина тега
+	if (count && (der[0] & 31) == 31)
+		while (need < count && (der[need++] & 128));
+	if (need >= count)
+		return FALSE;
+	// длина TL
+	if (der[need] > 128 && der[need] != 255)
+		need += der[need] - 128;
+	++need;
+	return need <= count || need > 16;
+}
+
+static size_t derStreamEvent(size_t event, der_node_t* node,
+	const octet** frag, size_t* len, const der_node_t* n, const octet* f,
+	size_t l)
+{
+	ASSERT(node == 0 || memIsValid(node, sizeof(der_node_t)));
+	ASSERT(frag == 0 || memIsValid(frag, sizeof(const octet*)));
+	ASSERT(len == 0 || memIsValid(len, O_PER_S));
+	if (node)
+		memCopy(node, n, sizeof(der_node_t));
+	if (frag)
+		*frag = f;
+	if (len)
+		*len = l;
+	return event;
+}
+
+size_t derStreamStepG(der_node_t* node, const octet** frag, size_t* len,
+	void* state)
+{
+	der_stream_st* st = (der_stream_st*)state;
+	der_node_t* top = 0;
+	const octet* f;
+	size_t end = SIZE_MAX;
+	size_t tl;
+	u32 tag;
+	size_t l;
+	ASSERT(memIsValid(state, sizeof(der_stream_st)));
+	ASSERT(memIsValid(state, derStream_keep(st->max)));
+	// ошибка формата?
+	if (st->err)
+		return DER_STREAM_ERR;
+	// обработать открытый узел
+	if (st->depth)
+	{
+		top = st->nodes + st->depth - 1;
+		end = top->val + top->len;
+		// узел заполнен?
+		if (st->pos == end)
+		{
+			--st->depth;
+			return derStreamEvent(DER_STREAM_CLOSE, node, frag, len, top,
+				0, 0);
+		}
+		// фрагмент значения примитивного узла
+		if (derStreamIsPrimitive(top->tag))
+		{
+			if (st->count == 0)
+				return DER_STREAM_MORE;
+			f = st->der, l = MIN2(st->count, end - st->pos);
+			derStreamSkip(st, l);
+			return derStreamEvent(DER_STREAM_DATA, node, frag, len, top,
+				f, l);
+		}
+	}
+	// декодировать TL внутри фрагмента
+	if (st->count == 0)
+		return DER_STREAM_MORE;
+	if (st->tl_count == 0)
+	{
+		tl = derTLDec(&tag, &l, st->der, st->count);
+		if (tl == SIZE_MAX)
+		{
+			if (derStreamTLIsBad(st->der, st->count))
+				return st->err = TRUE, DER_STREAM_ERR;
+			memCopy(st->tl, st->der, st->count);
+			st->tl_count = st->count;
+			derStreamSkip(st, st->count);
+			return DER_STREAM_MORE;
+		}
+		f = st->der;
+		derStreamSkip(st, tl);
+	}
+	// декодировать TL на стыке фрагментов
+	else
+	{
+		do
+		{
+			if (st->count == 0)
+				return DER_STREAM_MORE;
+			st->tl[st->tl_count++] = st->der[0];
+			derStreamSkip(st, 1);
+			tl = derTLDec(&tag, &l, st->tl, st->tl_count);
+			if (tl == SIZE_MAX && derStreamTLIsBad(st->tl, st->tl_count))
+				return st->err = TRUE, DER_STREAM_ERR;
+		}
+		while (tl == SIZE_MAX);
+		ASSERT(tl == st->tl_count);
+		f = st->tl, st->tl_count = 0;
+	}
+	// TLV не укладывается в родителя? переполнение? превышена глубина?
+	if ((top && (st->pos > end || l > end - st->pos)) ||
+		l > SIZE_MAX - st->pos || st->depth == st->max)
+		return st->err = TRUE, DER_STREAM_ERR;
+	// открыть узел
+	top = st->nodes + st->depth++;
+	top->tag = tag, top->depth = st->depth - 1;
+	top->pos = st->pos - tl, top->val = st->pos, top->len = l;
+	top->next = SIZE_MAX;
+	return derStreamEvent(DER_STREAM_OPEN, node, frag, len, top, f, tl);
+}
+
+bool_t derStreamIsOver(const void* state)
+{
+	const der_stream_st* st = (const der_stream_st*)state;
+	ASSERT(memIsValid(state, sizeof(der_stream_st)));
+	return !st->err && st->depth == 0 && st->tl_count == 0 &&
+		st->count == 0 && st->pos > 0;
+}
+
 /*
 *******************************************************************************
 Тип SIZE (беззнаковый INTEGER):
@@ -860,10 +1142,14 @@ size_t derOIDDec2(const octet der[], size_t count, const char* oid)
 	u32 d1 = 3;
 	u32 val = 0;
 	size_t len, pos, oid_delta;
+	const octet* reg;
 	// проверить входной буфер
 	if (count == SIZE_MAX)
 		return SIZE_MAX;
 	ASSERT(memIsValid(der, count));
+	// идентификатор из реестра? сравнить с готовым кодом
+	if ((reg = oidLookup(&len, oid)) != 0)
+		return count >= len && memEq(der, reg, len) ? len : SIZE_MAX;
 	// проверить тег и определить значение
 	count = derDec2(&der, &len, der, count, 0x06);
 	if (count == SIZE_MAX)
@@ -978,8 +1264,10 @@ size_t derTPSTRDec(char* val, size_t* len, const octet der[], size_t count,
 
 Длина V становится окончательно известна только в конце кодирования структуры.
 В начале кодирования структура пуста и поэтому длина L = |V| устанавливается
-равной нулю. В конце кодирования длина уточняется, вложенное содержимое
-сдвигается при необходимости.
+равной нулю. В конце кодирования длина уточняется. Вложенное содержимое
+сдвигается, только если уточненная длина не укладывается в один октет.
+Поэтому структуры с короткими (< 128) длинами кодируются за один проход
+без перемещения данных.
 *******************************************************************************
 */
 
@@ -1021,7 +1309,8 @@ size_t derTSEQEncStop(octet der[], size_t pos, const der_anchor_t* anchor)
 	if (anchor->der)
 	{
 		ASSERT(anchor->der + t_count == der - len - l_count);
-		memMove(der - len + pos, der - len, len);
+		if (pos)
+			memMove(der - len + pos, der - len, len);
 		derLEnc(der - len - l_count, len);
 	}
 	return pos;
@@ -4,7 +4,7 @@
 \brief Hexadecimal strings
 \project bee2 [cryptographic library]
 \created 2015.10.29
-\version 2016.06.19
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,21 @@
 #include "bee2/core/util.h"
 #include "bee2/core/word.h"
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#ifndef __SSE2__
+		#define __SSE2__
+	#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#ifndef __ARM_NEON
+		#define __ARM_NEON
+	#endif
+#endif
+
 /*
 *******************************************************************************
 Таблицы
@@ -77,6 +92,272 @@ static void hexFromOLower(char* hex, register octet o)
 	o = 0;
 }
 
+/*
+*******************************************************************************
+Векторная обработка
+
+Функции hexFromV(), hexToV() и hexIsValidV() обрабатывают префикс данных
+блоками по 32 (AVX2) или 16 (SSE2, NEON) октетов и возвращают длину
+обработанного префикса. Остаток данных обрабатывается побайтово.
+
+Символ c переводится в тетраду по правилам:
+- c - '0', если '0' <= c <= '9';
+- (c | 0x20) - 'a' + 10, если 'a' <= (c | 0x20) <= 'f'.
+Остальные символы недопустимы. Тетрада n переводится в символ
+n + '0' + (n > 9 ? 7 : 0).
+
+Знаковые сравнения SSE2/AVX2 корректно отбраковывают символы
+с установленным старшим битом: такие символы отрицательны.
+*******************************************************************************
+*/
+
+#if defined(__AVX2__)
+
+static inline __m256i hexEncV(__m256i n)
+{
+	__m256i t = _mm256_cmpgt_epi8(n, _mm256_set1_epi8(9));
+	t = _mm256_and_si256(t, _mm256_set1_epi8(7));
+	return _mm256_add_epi8(_mm256_add_epi8(n, _mm256_set1_epi8('0')), t);
+}
+
+static inline __m256i hexDecV(__m256i c, __m256i* bad)
+{
+	__m256i lc = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+	__m256i digit = _mm256_and_si256(
+		_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+	__m256i alpha = _mm256_and_si256(
+		_mm256_cmpgt_epi8(lc, _mm256_set1_epi8('a' - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lc));
+	*bad = _mm256_or_si256(*bad, _mm256_cmpeq_epi8(
+		_mm256_or_si256(digit, alpha), _mm256_setzero_si256()));
+	return _mm256_or_si256(
+		_mm256_and_si256(digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+		_mm256_and_si256(alpha,
+			_mm256_sub_epi8(lc, _mm256_set1_epi8('a' - 10))));
+}
+
+// (n_0, n_1, n_2, n_3,...) -> (n_0 << 4 | n_1, n_2 << 4 | n_3,...)
+static inline __m256i hexPackV(__m256i n)
+{
+	n = _mm256_or_si256(_mm256_slli_epi16(n, 4), _mm256_srli_epi16(n, 8));
+	return _mm256_and_si256(n, _mm256_set1_epi16(0x00FF));
+}
+
+static size_t hexFromV(char* dest, const octet* src, size_t count)
+{
+	size_t done = 0;
+	const __m256i m = _mm256_set1_epi8(15);
+	for (; done + 32 <= count; done += 32)
+	{
+		__m256i x = _mm256_loadu_si256((const __m256i*)(src + done));
+		__m256i hi = hexEncV(_mm256_and_si256(_mm256_srli_epi16(x, 4), m));
+		__m256i lo = hexEncV(_mm256_and_si256(x, m));
+		x = _mm256_unpacklo_epi8(hi, lo);
+		hi = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i*)(dest + 2 * done),
+			_mm256_permute2x128_si256(x, hi, 0x20));
+		_mm256_storeu_si256((__m256i*)(dest + 2 * done + 32),
+			_mm256_permute2x128_si256(x, hi, 0x31));
+	}
+	return done;
+}
+
+static size_t hexToV(octet* dest, const char* src, size_t count)
+{
+	size_t done = 0;
+	__m256i bad = _mm256_setzero_si256();
+	for (; done + 64 <= count; done += 64)
+	{
+		__m256i x = hexPackV(hexDecV(
+			_mm256_loadu_si256((const __m256i*)(src + done)), &bad));
+		__m256i y = hexPackV(hexDecV(
+			_mm256_loadu_si256((const __m256i*)(src + done + 32)), &bad));
+		x = _mm256_permute4x64_epi64(_mm256_packus_epi16(x, y), 0xD8);
+		_mm256_storeu_si256((__m256i*)(dest + done / 2), x);
+	}
+	ASSERT(_mm256_testz_si256(bad, bad));
+	return done;
+}
+
+static size_t hexIsValidV(const char* hex, size_t count)
+{
+	size_t done = 0;
+	for (; done + 32 <= count; done += 32)
+	{
+		__m256i bad = _mm256_setzero_si256();
+		hexDecV(_mm256_loadu_si256((const __m256i*)(hex + done)), &bad);
+		if (!_mm256_testz_si256(bad, bad))
+			break;
+	}
+	return done;
+}
+
+#elif defined(__SSE2__)
+
+static inline __m128i hexEncV(__m128i n)
+{
+	__m128i t = _mm_cmpgt_epi8(n, _mm_set1_epi8(9));
+	t = _mm_and_si128(t, _mm_set1_epi8(7));
+	return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), t);
+}
+
+static inline __m128i hexDecV(__m128i c, __m128i* bad)
+{
+	__m128i lc = _mm_or_si128(c, _mm_set1_epi8(0x20));
+	__m128i digit = _mm_and_si128(
+		_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+		_mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+	__m128i alpha = _mm_and_si128(
+		_mm_cmpgt_epi8(lc, _mm_set1_epi8('a' - 1)),
+		_mm_cmplt_epi8(lc, _mm_set1_epi8('f' + 1)));
+	*bad = _mm_or_si128(*bad, _mm_cmpeq_epi8(_mm_or_si128(digit, alpha),
+		_mm_setzero_si128()));
+	return _mm_or_si128(
+		_mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+		_mm_and_si128(alpha, _mm_sub_epi8(lc, _mm_set1_epi8('a' - 10))));
+}
+
+// (n_0, n_1, n_2, n_3,...) -> (n_0 << 4 | n_1, n_2 << 4 | n_3,...)
+static inline __m128i hexPackV(__m128i n)
+{
+	n = _mm_or_si128(_mm_slli_epi16(n, 4), _mm_srli_epi16(n, 8));
+	return _mm_and_si128(n, _mm_set1_epi16(0x00FF));
+}
+
+static size_t hexFromV(char* dest, const octet* src, size_t count)
+{
+	size_t done = 0;
+	const __m128i m = _mm_set1_epi8(15);
+	for (; done + 16 <= count; done += 16)
+	{
+		__m128i x = _mm_loadu_si128((const __m128i*)(src + done));
+		__m128i hi = hexEncV(_mm_and_si128(_mm_srli_epi16(x, 4), m));
+		__m128i lo = hexEncV(_mm_and_si128(x, m));
+		_mm_storeu_si128((__m128i*)(dest + 2 * done),
+			_mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128((__m128i*)(dest + 2 * done + 16),
+			_mm_unpackhi_epi8(hi, lo));
+	}
+	return done;
+}
+
+static size_t hexToV(octet* dest, const char* src, size_t count)
+{
+	size_t done = 0;
+	__m128i bad = _mm_setzero_si128();
+	for (; done + 32 <= count; done += 32)
+	{
+		__m128i x = hexPackV(hexDecV(
+			_mm_loadu_si128((const __m128i*)(src + done)), &bad));
+		__m128i y = hexPackV(hexDecV(
+			_mm_loadu_si128((const __m128i*)(src + done + 16)), &bad));
+		_mm_storeu_si128((__m128i*)(dest + done / 2),
+			_mm_packus_epi16(x, y));
+	}
+	ASSERT(_mm_movemask_epi8(bad) == 0);
+	return done;
+}
+
+static size_t hexIsValidV(const char* hex, size_t count)
+{
+	size_t done = 0;
+	for (; done + 16 <= count; done += 16)
+	{
+		__m128i bad = _mm_setzero_si128();
+		hexDecV(_mm_loadu_si128((const __m128i*)(hex + done)), &bad);
+		if (_mm_movemask_epi8(bad))
+			break;
+	}
+	return done;
+}
+
+#elif defined(__ARM_NEON)
+
+static inline uint8x16_t hexEncV(uint8x16_t n)
+{
+	uint8x16_t t = vandq_u8(vcgtq_u8(n, vdupq_n_u8(9)), vdupq_n_u8(7));
+	return vaddq_u8(vaddq_u8(n, vdupq_n_u8('0')), t);
+}
+
+static inline uint8x16_t hexDecV(uint8x16_t c, uint8x16_t* bad)
+{
+	uint8x16_t d = vsubq_u8(c, vdupq_n_u8('0'));
+	uint8x16_t a = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+	uint8x16_t digit = vcleq_u8(d, vdupq_n_u8(9));
+	uint8x16_t alpha = vcleq_u8(a, vdupq_n_u8(5));
+	*bad = vorrq_u8(*bad, vmvnq_u8(vorrq_u8(digit, alpha)));
+	return vorrq_u8(vandq_u8(digit, d),
+		vandq_u8(alpha, vaddq_u8(a, vdupq_n_u8(10))));
+}
+
+static inline bool_t hexIsZeroV(uint8x16_t x)
+{
+	uint64x2_t t = vreinterpretq_u64_u8(x);
+	return (vgetq_lane_u64(t, 0) | vgetq_lane_u64(t, 1)) == 0;
+}
+
+static size_t hexFromV(char* dest, const octet* src, size_t count)
+{
+	size_t done = 0;
+	for (; done + 16 <= count; done += 16)
+	{
+		uint8x16_t x = vld1q_u8(src + done);
+		uint8x16x2_t y;
+		y.val[0] = hexEncV(vshrq_n_u8(x, 4));
+		y.val[1] = hexEncV(vandq_u8(x, vdupq_n_u8(15)));
+		vst2q_u8((uint8_t*)dest + 2 * done, y);
+	}
+	return done;
+}
+
+static size_t hexToV(octet* dest, const char* src, size_t count)
+{
+	size_t done = 0;
+	uint8x16_t bad = vdupq_n_u8(0);
+	for (; done + 32 <= count; done += 32)
+	{
+		uint8x16x2_t x = vld2q_u8((const uint8_t*)src + done);
+		uint8x16_t hi = hexDecV(x.val[0], &bad);
+		uint8x16_t lo = hexDecV(x.val[1], &bad);
+		vst1q_u8(dest + done / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+	}
+	ASSERT(hexIsZeroV(bad));
+	return done;
+}
+
+static size_t hexIsValidV(const char* hex, size_t count)
+{
+	size_t done = 0;
+	for (; done + 16 <= count; done += 16)
+	{
+		uint8x16_t bad = vdupq_n_u8(0);
+		hexDecV(vld1q_u8((const uint8_t*)hex + done), &bad);
+		if (!hexIsZeroV(bad))
+			break;
+	}
+	return done;
+}
+
+#else
+
+static size_t hexFromV(char* dest, const octet* src, size_t count)
+{
+	return 0;
+}
+
+static size_t hexToV(octet* dest, const char* src, size_t count)
+{
+	return 0;
+}
+
+static size_t hexIsValidV(const char* hex, size_t count)
+{
+	return 0;
+}
+
+#endif
+
 /*
 *******************************************************************************
 Проверка
@@ -85,8 +366,10 @@ static void hexFromOLower(char* hex, register octet o)
 
 bool_t hexIsValid(const char* hex)
 {
-	if (!strIsValid(hex) || strLen(hex) % 2)
+	size_t count;
+	if (!strIsValid(hex) || (count = strLen(hex)) % 2)
 		return FALSE;
+	hex += hexIsValidV(hex, count);
 	for (; *hex; ++hex)
 		if (hex_dec_table[(octet)*hex] == 0xFF)
 			return FALSE;
@@ -177,7 +460,10 @@ bool_t FAST(hexEqRev)(const void* buf, const char* hex)
 
 void hexFrom(char* dest, const void* src, size_t count)
 {
+	size_t done;
 	ASSERT(memIsDisjoint2(src, count, dest, 2 * count + 1));
+	done = hexFromV(dest, (const octet*)src, count);
+	dest += 2 * done, src = (const octet*)src + done, count -= done;
 	for (; count--; dest += 2, src = (const octet*)src + 1)
 		hexFromOUpper(dest, *(const octet*)src);
 	*dest = '\0';
@@ -195,9 +481,12 @@ void hexFromRev(char* dest, const void* src, size_t count)
 void hexTo(void* dest, const char* src)
 {
 	size_t count;
+	size_t done;
 	ASSERT(hexIsValid(src));
 	ASSERT(memIsDisjoint2(src, strLen(src) + 1, dest, strLen(src) / 2));
 	count = strLen(src);
+	done = hexToV((octet*)dest, src, count);
+	dest = (octet*)dest + done / 2, src += done, count -= done;
 	for (; count; count -= 2, src += 2, dest = (octet*)dest + 1)
 		*(octet*)dest = hexToO(src);
 }
@@ -212,3 +501,79 @@ void hexToRev(void* dest, const char* src)
 	for (; count; count -= 2, dest = (octet*)dest + 1)
 		*(octet*)dest = hexToO(src -= 2);
 }
+
+/*
+*******************************************************************************
+Потоковое декодирование
+
+В состоянии сохраняется тетрада, полученная по последнему символу
+фрагмента нечетной длины. Пары символов внутри фрагмента сначала
+проверяются (hexIsValidV() и побайтовое продолжение), затем
+декодируются (hexToV() и побайтовое продолжение).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	bool_t half;			/*!< есть неполная пара? */
+	bool_t err;				/*!< ошибка формата? */
+	octet hi;				/*!< старшая тетрада неполной пары */
+} hex_to_st;
+
+size_t hexTo_keep()
+{
+	return sizeof(hex_to_st);
+}
+
+void hexToStart(void* state)
+{
+	ASSERT(memIsValid(state, hexTo_keep()));
+	memSetZero(state, hexTo_keep());
+}
+
+size_t hexToStep(void* dest, const char* src, size_t count, void* state)
+{
+	hex_to_st* st = (hex_to_st*)state;
+	size_t len = 0;
+	size_t t;
+	octet o;
+	ASSERT(memIsValid(state, hexTo_keep()));
+	ASSERT(memIsValid(src, count));
+	ASSERT(memIsDisjoint2(src, count, dest, (count + 1) / 2));
+	if (st->err)
+		return SIZE_MAX;
+	// дополнить неполную пару
+	if (st->half && count)
+	{
+		if ((o = hex_dec_table[(octet)*src]) == 0xFF)
+			return st->err = TRUE, SIZE_MAX;
+		*(octet*)dest = st->hi << 4 | o;
+		dest = (octet*)dest + 1, ++src, --count, len = 1;
+		st->half = FALSE, st->hi = 0;
+	}
+	// проверить полные пары
+	t = hexIsValidV(src, count & ~(size_t)1);
+	for (; t < (count & ~(size_t)1); ++t)
+		if (hex_dec_table[(octet)src[t]] == 0xFF)
+			return st->err = TRUE, SIZE_MAX;
+	// декодировать полные пары
+	t = hexToV((octet*)dest, src, count & ~(size_t)1);
+	for (; t + 2 <= count; t += 2)
+		((octet*)dest)[t / 2] = hexToO(src + t);
+	len += t / 2;
+	// сохранить неполную пару
+	if (count & 1)
+	{
+		if ((o = hex_dec_table[(octet)src[count - 1]]) == 0xFF)
+			return st->err = TRUE, SIZE_MAX;
+		st->half = TRUE, st->hi = o;
+	}
+	return len;
+}
+
+bool_t hexToStop(const void* state)
+{
+	const hex_to_st* st = (const hex_to_st*)state;
+	ASSERT(memIsValid(state, hexTo_keep()));
+	return !st->err && !st->half;
+}
@@ -4,7 +4,7 @@
 \brief Memory management
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2019.07.09
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -24,6 +24,21 @@
 	#include <windows.h>
 #endif
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#ifndef __SSE2__
+		#define __SSE2__
+	#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#ifndef __ARM_NEON
+		#define __ARM_NEON
+	#endif
+#endif
+
 /*
 *******************************************************************************
 Проверка
@@ -131,25 +146,30 @@ void memFree(void* buf)
 *******************************************************************************
 Дополнительные функции
 
+Функции memEq(), memIsZero(), memXor(), memXor2() обрабатывают данные 
+векторами по 32 (AVX2), 16 (SSE2, NEON) октетов, затем словами, затем 
+октетами. В SAFE(memEq) и SAFE(memIsZero) векторы SSE2 / NEON 
+используются, если длина буфера не меньше 32: для более коротких 
+буферов свертка вектора в слово не окупается. Векторы загружаются и сохраняются без требований к выравниванию 
+(loadu / storeu, vld1q / vst1q): на современных процессорах такие 
+инструкции не медленнее выровненных, а отдельная обработка невыровненного 
+начала буфера лишь удлиняет короткие вызовы (типичная длина -- блок belt 
+или bash).
+
+В функциях SAFE(memEq) и SAFE(memIsZero) разности векторов накапливаются 
+без ветвлений и сворачиваются в слово один раз после обработки буфера. 
+Время работы не зависит от содержимого буферов. В SAFE(memIsZero) 
+векторы SSE2 обрабатываются по четыре с двумя накопителями: длинные 
+буферы (см. blobClose()) проверяются за время, сопоставимое с 
+их очисткой.
+
 \remark Функция memWipe() повторяет функцию OPENSSL_cleanse()
-из библиотеки OpenSSL:
-\code
-	unsigned char cleanse_ctr = 0;
-	void OPENSSL_cleanse(void *ptr, size_t len)
-	{
-		unsigned char *p = ptr;
-		size_t loop = len, ctr = cleanse_ctr;
-		while(loop--)
-		{
-			*(p++) = (unsigned char)ctr;
-			ctr += (17 + ((size_t)p & 0xF));
-		}
-		p=memchr(ptr, (unsigned char)ctr, len);
-		if(p)
-			ctr += (63 + (size_t)p);
-		cleanse_ctr = (unsigned char)ctr;
-	}
-\endcode
+из библиотеки OpenSSL (версии 1.1.0 и выше): memset() вызывается через 
+volatile-указатель, поэтому компилятор не может заменить вызов или 
+исключить его как бесполезный. Дополнительно (GCC, Clang) после вызова 
+ставится барьер памяти. Функция memset() стандартной библиотеки использует 
+векторные инструкции, поэтому очистка выполняется в несколько раз быстрее, 
+чем при побайтовой записи с volatile-указателем (прежняя реализация).
 
 \remark На платформе Windows есть функции SecureZeroMemory()
 и RtlSecureZeroMemory(), которые, как и memWipe(), выполняют
@@ -162,6 +182,54 @@ bool_t SAFE(memEq)(const void* buf1, const void* buf2, size_t count)
 	register word diff = 0;
 	ASSERT(memIsValid(buf1, count));
 	ASSERT(memIsValid(buf2, count));
+#if defined(__AVX2__)
+	if (count >= 32)
+	{
+		__m256i acc = _mm256_setzero_si256();
+		for (; count >= 32; count -= 32)
+		{
+			acc = _mm256_or_si256(acc, _mm256_xor_si256(
+				_mm256_loadu_si256((const __m256i*)buf1),
+				_mm256_loadu_si256((const __m256i*)buf2)));
+			buf1 = (const octet*)buf1 + 32;
+			buf2 = (const octet*)buf2 + 32;
+		}
+		diff |= (word)!_mm256_testz_si256(acc, acc);
+	}
+#endif
+#if defined(__SSE2__)
+	if (count >= 32)
+	{
+		__m128i acc = _mm_setzero_si128();
+		for (; count >= 16; count -= 16)
+		{
+			acc = _mm_or_si128(acc, _mm_xor_si128(
+				_mm_loadu_si128((const __m128i*)buf1),
+				_mm_loadu_si128((const __m128i*)buf2)));
+			buf1 = (const octet*)buf1 + 16;
+			buf2 = (const octet*)buf2 + 16;
+		}
+		diff |= (word)(_mm_movemask_epi8(
+			_mm_cmpeq_epi8(acc, _mm_setzero_si128())) ^ 0xFFFF);
+	}
+#elif defined(__ARM_NEON)
+	if (count >= 32)
+	{
+		uint8x16_t acc = vdupq_n_u8(0);
+		uint64x2_t acc64;
+		for (; count >= 16; count -= 16)
+		{
+			acc = vorrq_u8(acc, veorq_u8(vld1q_u8((const octet*)buf1),
+				vld1q_u8((const octet*)buf2)));
+			buf1 = (const octet*)buf1 + 16;
+			buf2 = (const octet*)buf2 + 16;
+		}
+		acc64 = vreinterpretq_u64_u8(acc);
+		diff |= (word)(vgetq_lane_u64(acc64, 0) | vgetq_lane_u64(acc64, 1));
+		diff |= (word)((vgetq_lane_u64(acc64, 0) | 
+			vgetq_lane_u64(acc64, 1)) >> 32);
+	}
+#endif
 	for (; count >= O_PER_W; count -= O_PER_W)
 	{
 		diff |= *(const word*)buf1 ^ *(const word*)buf2;
@@ -278,26 +346,76 @@ int FAST(memCmpRev)(const void* buf1, const void* buf2, size_t count)
 	return 0;
 }
 
+static void* (* volatile const memWipeSet)(void*, int, size_t) = memset;
+
 void memWipe(void* buf, size_t count)
 {
-	static octet wipe_ctr = 0;
-	volatile octet* p = (octet*)buf;
-	size_t ctr = wipe_ctr;
-	size_t i = count;
 	ASSERT(memIsValid(buf, count));
-	// вычисления, которые должны показаться полезными оптимизатору
-	while (i--)
-		*(p++) = (octet)ctr, ctr += 17 + ((size_t)p & 15);
-	p = memchr(buf, (octet)ctr, count);
-	if (p)
-		ctr += (63 + (size_t)p);
-	wipe_ctr = (octet)ctr;
+	if (count == 0)
+		return;
+	memWipeSet(buf, 0, count);
+#if defined(__GNUC__)
+	__asm__ __volatile__("" : : "r"(buf) : "memory");
+#endif
 }
 
 bool_t SAFE(memIsZero)(const void* buf, size_t count)
 {
 	register word diff = 0;
 	ASSERT(memIsValid(buf, count));
+#if defined(__AVX2__)
+	if (count >= 32)
+	{
+		__m256i acc = _mm256_setzero_si256();
+		for (; count >= 32; count -= 32)
+		{
+			acc = _mm256_or_si256(acc, 
+				_mm256_loadu_si256((const __m256i*)buf));
+			buf = (const octet*)buf + 32;
+		}
+		diff |= (word)!_mm256_testz_si256(acc, acc);
+	}
+#endif
+#if defined(__SSE2__)
+	if (count >= 32)
+	{
+		__m128i acc = _mm_setzero_si128();
+		__m128i acc1 = _mm_setzero_si128();
+		for (; count >= 64; count -= 64)
+		{
+			acc = _mm_or_si128(acc, _mm_or_si128(
+				_mm_loadu_si128((const __m128i*)buf),
+				_mm_loadu_si128((const __m128i*)buf + 1)));
+			acc1 = _mm_or_si128(acc1, _mm_or_si128(
+				_mm_loadu_si128((const __m128i*)buf + 2),
+				_mm_loadu_si128((const __m128i*)buf + 3)));
+			buf = (const octet*)buf + 64;
+		}
+		acc = _mm_or_si128(acc, acc1);
+		for (; count >= 16; count -= 16)
+		{
+			acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i*)buf));
+			buf = (const octet*)buf + 16;
+		}
+		diff |= (word)(_mm_movemask_epi8(
+			_mm_cmpeq_epi8(acc, _mm_setzero_si128())) ^ 0xFFFF);
+	}
+#elif defined(__ARM_NEON)
+	if (count >= 32)
+	{
+		uint8x16_t acc = vdupq_n_u8(0);
+		uint64x2_t acc64;
+		for (; count >= 16; count -= 16)
+		{
+			acc = vorrq_u8(acc, vld1q_u8((const octet*)buf));
+			buf = (const octet*)buf + 16;
+		}
+		acc64 = vreinterpretq_u64_u8(acc);
+		diff |= (word)(vgetq_lane_u64(acc64, 0) | vgetq_lane_u64(acc64, 1));
+		diff |= (word)((vgetq_lane_u64(acc64, 0) | 
+			vgetq_lane_u64(acc64, 1)) >> 32);
+	}
+#endif
 	for (; count >= O_PER_W; count -= O_PER_W)
 	{
 		diff |= *(const word*)buf;
@@ -461,6 +579,37 @@ void memXor(void* dest, const void* src1, const void* src2, size_t count)
 {
 	ASSERT(memIsSameOrDisjoint(src1, dest, count));
 	ASSERT(memIsSameOrDisjoint(src2, dest, count));
+#if defined(__AVX2__)
+	for (; count >= 32; count -= 32)
+	{
+		_mm256_storeu_si256((__m256i*)dest, _mm256_xor_si256(
+			_mm256_loadu_si256((const __m256i*)src1),
+			_mm256_loadu_si256((const __m256i*)src2)));
+		src1 = (const octet*)src1 + 32;
+		src2 = (const octet*)src2 + 32;
+		dest = (octet*)dest + 32;
+	}
+#endif
+#if defined(__SSE2__)
+	for (; count >= 16; count -= 16)
+	{
+		_mm_storeu_si128((__m128i*)dest, _mm_xor_si128(
+			_mm_loadu_si128((const __m128i*)src1),
+			_mm_loadu_si128((const __m128i*)src2)));
+		src1 = (const octet*)src1 + 16;
+		src2 = (const octet*)src2 + 16;
+		dest = (octet*)dest + 16;
+	}
+#elif defined(__ARM_NEON)
+	for (; count >= 16; count -= 16)
+	{
+		vst1q_u8((octet*)dest, veorq_u8(vld1q_u8((const octet*)src1),
+			vld1q_u8((const octet*)src2)));
+		src1 = (const octet*)src1 + 16;
+		src2 = (const octet*)src2 + 16;
+		dest = (octet*)dest + 16;
+	}
+#endif
 	for (; count >= O_PER_W; count -= O_PER_W)
 	{
 		*(word*)dest = *(const word*)src1 ^ *(const word*)src2;
@@ -480,6 +629,34 @@ void memXor(void* dest, const void* src1, const void* src2, size_t count)
 void memXor2(void* dest, const void* src, size_t count)
 {
 	ASSERT(memIsSameOrDisjoint(src, dest, count));
+#if defined(__AVX2__)
+	for (; count >= 32; count -= 32)
+	{
+		_mm256_storeu_si256((__m256i*)dest, _mm256_xor_si256(
+			_mm256_loadu_si256((const __m256i*)dest),
+			_mm256_loadu_si256((const __m256i*)src)));
+		src = (const octet*)src + 32;
+		dest = (octet*)dest + 32;
+	}
+#endif
+#if defined(__SSE2__)
+	for (; count >= 16; count -= 16)
+	{
+		_mm_storeu_si128((__m128i*)dest, _mm_xor_si128(
+			_mm_loadu_si128((const __m128i*)dest),
+			_mm_loadu_si128((const __m128i*)src)));
+		src = (const octet*)src + 16;
+		dest = (octet*)dest + 16;
+	}
+#elif defined(__ARM_NEON)
+	for (; count >= 16; count -= 16)
+	{
+		vst1q_u8((octet*)dest, veorq_u8(vld1q_u8((const octet*)dest),
+			vld1q_u8((const octet*)src)));
+		src = (const octet*)src + 16;
+		dest = (octet*)dest + 16;
+	}
+#endif
 	for (; count >= O_PER_W; count -= O_PER_W)
 	{
 		*(word*)dest ^= *(const word*)src;
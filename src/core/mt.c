@@ -4,7 +4,7 @@
 \brief Multithreading
 \project bee2 [cryptographic library]
 \created 2014.10.10
-\version 2021.05.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -113,6 +113,137 @@ void mtMtxClose(mt_mtx_t* mtx)
 
 #endif // OS
 
+/*
+*******************************************************************************
+Блокировки чтения-записи
+*******************************************************************************
+*/
+
+#ifdef OS_WIN
+
+bool_t mtRwlCreate(mt_rwl_t* rwl)
+{
+	ASSERT(memIsValid(rwl, sizeof(mt_rwl_t)));
+	InitializeSRWLock(rwl);
+	return TRUE;
+}
+
+bool_t mtRwlIsValid(const mt_rwl_t* rwl)
+{
+	return memIsValid(rwl, sizeof(mt_rwl_t));
+}
+
+void mtRwlRdLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	AcquireSRWLockShared(rwl);
+}
+
+void mtRwlRdUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	ReleaseSRWLockShared(rwl);
+}
+
+void mtRwlWrLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	AcquireSRWLockExclusive(rwl);
+}
+
+void mtRwlWrUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	ReleaseSRWLockExclusive(rwl);
+}
+
+void mtRwlClose(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+#elif defined OS_UNIX
+
+bool_t mtRwlCreate(mt_rwl_t* rwl)
+{
+	ASSERT(memIsValid(rwl, sizeof(mt_rwl_t)));
+	return pthread_rwlock_init(rwl, 0) == 0;
+}
+
+bool_t mtRwlIsValid(const mt_rwl_t* rwl)
+{
+	return memIsValid(rwl, sizeof(mt_rwl_t));
+}
+
+void mtRwlRdLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	pthread_rwlock_rdlock(rwl);
+}
+
+void mtRwlRdUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	pthread_rwlock_unlock(rwl);
+}
+
+void mtRwlWrLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	pthread_rwlock_wrlock(rwl);
+}
+
+void mtRwlWrUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	pthread_rwlock_unlock(rwl);
+}
+
+void mtRwlClose(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+	pthread_rwlock_destroy(rwl);
+}
+
+#else
+
+bool_t mtRwlCreate(mt_rwl_t* rwl)
+{
+	return TRUE;
+}
+
+bool_t mtRwlIsValid(const mt_rwl_t* rwl)
+{
+	return TRUE;
+}
+
+void mtRwlRdLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+void mtRwlRdUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+void mtRwlWrLock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+void mtRwlWrUnlock(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+void mtRwlClose(mt_rwl_t* rwl)
+{
+	ASSERT(mtRwlIsValid(rwl));
+}
+
+#endif // OS
+
 /*
 *******************************************************************************
 Потоки
@@ -171,6 +302,201 @@ bool_t mtCallOnce(size_t* once, void (*fn)())
 	return TRUE;
 }
 
+#ifdef OS_WIN
+
+static DWORD WINAPI mtThrdStart(LPVOID arg)
+{
+	mt_thrd_t* thrd = (mt_thrd_t*)arg;
+	thrd->fn(thrd->arg);
+	return 0;
+}
+
+bool_t mtThrdCreate(mt_thrd_t* thrd, void (*fn)(void*), void* arg)
+{
+	ASSERT(memIsValid(thrd, sizeof(mt_thrd_t)));
+	thrd->fn = fn, thrd->arg = arg;
+	thrd->handle = CreateThread(0, 0, mtThrdStart, thrd, 0, 0);
+	return thrd->handle != 0;
+}
+
+void mtThrdJoin(mt_thrd_t* thrd)
+{
+	ASSERT(memIsValid(thrd, sizeof(mt_thrd_t)));
+	WaitForSingleObject(thrd->handle, INFINITE);
+	CloseHandle(thrd->handle);
+}
+
+size_t mtProcCount()
+{
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors ? (size_t)info.dwNumberOfProcessors : 1;
+}
+
+size_t mtNumaNode()
+{
+	PROCESSOR_NUMBER proc;
+	USHORT node;
+	GetCurrentProcessorNumberEx(&proc);
+	return GetNumaProcessorNodeEx(&proc, &node) ? (size_t)node : 0;
+}
+
+#elif defined OS_UNIX
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+static void* mtThrdStart(void* arg)
+{
+	mt_thrd_t* thrd = (mt_thrd_t*)arg;
+	thrd->fn(thrd->arg);
+	return 0;
+}
+
+bool_t mtThrdCreate(mt_thrd_t* thrd, void (*fn)(void*), void* arg)
+{
+	ASSERT(memIsValid(thrd, sizeof(mt_thrd_t)));
+	thrd->fn = fn, thrd->arg = arg;
+	return pthread_create(&thrd->id, 0, mtThrdStart, thrd) == 0;
+}
+
+void mtThrdJoin(mt_thrd_t* thrd)
+{
+	ASSERT(memIsValid(thrd, sizeof(mt_thrd_t)));
+	pthread_join(thrd->id, 0);
+}
+
+size_t mtProcCount()
+{
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (size_t)count : 1;
+}
+
+size_t mtNumaNode()
+{
+#ifdef SYS_getcpu
+	unsigned cpu, node;
+	if (syscall(SYS_getcpu, &cpu, &node, 0) == 0)
+		return (size_t)node;
+#endif
+	return 0;
+}
+
+#else
+
+bool_t mtThrdCreate(mt_thrd_t* thrd, void (*fn)(void*), void* arg)
+{
+	return FALSE;
+}
+
+void mtThrdJoin(mt_thrd_t* thrd)
+{
+}
+
+size_t mtProcCount()
+{
+	return 1;
+}
+
+size_t mtNumaNode()
+{
+	return 0;
+}
+
+#endif // OS
+
+/*
+*******************************************************************************
+Локальная память потоков
+
+В Windows используются слоты FLS (Fiber Local Storage), которые, в отличие
+от слотов TLS, поддерживают деструкторы.
+*******************************************************************************
+*/
+
+#ifdef OS_WIN
+
+bool_t mtTlsCreate(mt_tls_t* tls, void (MT_CALLBACK* dtor)(void*))
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	*tls = FlsAlloc(dtor);
+	return *tls != FLS_OUT_OF_INDEXES;
+}
+
+void* mtTlsGet(const mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return FlsGetValue(*tls);
+}
+
+bool_t mtTlsSet(mt_tls_t* tls, void* ptr)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return FlsSetValue(*tls, ptr) != 0;
+}
+
+void mtTlsClose(mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	FlsFree(*tls);
+}
+
+#elif defined OS_UNIX
+
+bool_t mtTlsCreate(mt_tls_t* tls, void (MT_CALLBACK* dtor)(void*))
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return pthread_key_create(tls, dtor) == 0;
+}
+
+void* mtTlsGet(const mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return pthread_getspecific(*tls);
+}
+
+bool_t mtTlsSet(mt_tls_t* tls, void* ptr)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return pthread_setspecific(*tls, ptr) == 0;
+}
+
+void mtTlsClose(mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	pthread_key_delete(*tls);
+}
+
+#else
+
+bool_t mtTlsCreate(mt_tls_t* tls, void (MT_CALLBACK* dtor)(void*))
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	*tls = 0;
+	return TRUE;
+}
+
+void* mtTlsGet(const mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	return *tls;
+}
+
+bool_t mtTlsSet(mt_tls_t* tls, void* ptr)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	*tls = ptr;
+	return TRUE;
+}
+
+void mtTlsClose(mt_tls_t* tls)
+{
+	ASSERT(memIsValid(tls, sizeof(mt_tls_t)));
+	*tls = 0;
+}
+
+#endif // OS
+
 /*
 *******************************************************************************
 Атомарные операции
@@ -257,6 +583,19 @@ size_t mtAtomicCmpSwap(size_t* ctr, size_t cmp, size_t swap)
 
 #endif // O_PER_S
 
+size_t mtAtomicLoad(const size_t* ctr)
+{
+	size_t t = *(const volatile size_t*)ctr;
+	MemoryBarrier();
+	return t;
+}
+
+void mtAtomicStore(size_t* ctr, size_t val)
+{
+	MemoryBarrier();
+	*(volatile size_t*)ctr = val;
+}
+
 #elif defined OS_UNIX
 
 #include <time.h>
@@ -276,6 +615,16 @@ size_t mtAtomicCmpSwap(size_t* ctr, size_t cmp, size_t swap)
 	return __sync_val_compare_and_swap(ctr, cmp, swap);
 }
 
+size_t mtAtomicLoad(const size_t* ctr)
+{
+	return __atomic_load_n(ctr, __ATOMIC_ACQUIRE);
+}
+
+void mtAtomicStore(size_t* ctr, size_t val)
+{
+	__atomic_store_n(ctr, val, __ATOMIC_RELEASE);
+}
+
 #else
 
 size_t mtAtomicIncr(size_t* ctr)
@@ -298,4 +647,580 @@ size_t mtAtomicCmpSwap(size_t* ctr, size_t cmp, size_t swap)
 	return t;
 }
 
+size_t mtAtomicLoad(const size_t* ctr)
+{
+	ASSERT(memIsValid(ctr, O_PER_S));
+	return *ctr;
+}
+
+void mtAtomicStore(size_t* ctr, size_t val)
+{
+	ASSERT(memIsValid(ctr, O_PER_S));
+	*ctr = val;
+}
+
 #endif // OS
+
+/*
+*******************************************************************************
+Спин-блокировки
+
+Ожидание реализовано по схеме test-and-test-and-set: захват предпринимается
+только после того, как блокировка будет прочитана свободной. Между чтениями
+выполняются паузы, число которых удваивается с каждой неудачной попыткой.
+После MT_SPIN_MAX пауз поток уступает процессор (mtSleep(0)).
+
+Пауза реализуется инструкцией pause (x86) или yield (ARM), которая снижает
+энергопотребление и нагрузку на шину памяти при ожидании.
+*******************************************************************************
+*/
+
+#define MT_SPIN_MAX 64
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define mtSpinPause() _mm_pause()
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define mtSpinPause() __asm__ __volatile__("pause")
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+	#define mtSpinPause() __asm__ __volatile__("yield")
+#else
+	#define mtSpinPause()
+#endif
+
+bool_t mtSpinTryLock(mt_spin_t* spin)
+{
+	ASSERT(memIsValid(spin, sizeof(mt_spin_t)));
+	return mtAtomicLoad(spin) == 0 && mtAtomicCmpSwap(spin, 0, 1) == 0;
+}
+
+void mtSpinLock(mt_spin_t* spin)
+{
+	size_t pauses = 1;
+	size_t i;
+	ASSERT(memIsValid(spin, sizeof(mt_spin_t)));
+	while (!mtSpinTryLock(spin))
+		do
+		{
+			if (pauses > MT_SPIN_MAX)
+				mtSleep(0);
+			else
+			{
+				for (i = 0; i < pauses; ++i)
+					mtSpinPause();
+				pauses <<= 1;
+			}
+		}
+		while (mtAtomicLoad(spin) != 0);
+}
+
+void mtSpinUnlock(mt_spin_t* spin)
+{
+	ASSERT(memIsValid(spin, sizeof(mt_spin_t)));
+	ASSERT(mtAtomicLoad(spin) == 1);
+	mtAtomicStore(spin, 0);
+}
+
+/*
+*******************************************************************************
+Пул потоков: условные переменные
+
+Условная переменная используется вместе с мьютексом пула. Реализация
+закрыта: условные переменные нужны только пулу.
+*******************************************************************************
+*/
+
+#ifdef OS_WIN
+
+typedef CONDITION_VARIABLE mt_cond_t;
+
+static void mtCondCreate(mt_cond_t* cond)
+{
+	InitializeConditionVariable(cond);
+}
+
+static void mtCondWait(mt_cond_t* cond, mt_mtx_t* mtx)
+{
+	SleepConditionVariableCS(cond, mtx, INFINITE);
+}
+
+static void mtCondBroadcast(mt_cond_t* cond)
+{
+	WakeAllConditionVariable(cond);
+}
+
+static void mtCondClose(mt_cond_t* cond)
+{
+}
+
+static u32 mtPid()
+{
+	return 0;
+}
+
+#elif defined OS_UNIX
+
+typedef pthread_cond_t mt_cond_t;
+
+static void mtCondCreate(mt_cond_t* cond)
+{
+	pthread_cond_init(cond, 0);
+}
+
+static void mtCondWait(mt_cond_t* cond, mt_mtx_t* mtx)
+{
+	pthread_cond_wait(cond, mtx);
+}
+
+static void mtCondBroadcast(mt_cond_t* cond)
+{
+	pthread_cond_broadcast(cond);
+}
+
+static void mtCondClose(mt_cond_t* cond)
+{
+	pthread_cond_destroy(cond);
+}
+
+static u32 mtPid()
+{
+	return (u32)getpid();
+}
+
+#else
+
+typedef bool_t mt_cond_t;
+
+static void mtCondCreate(mt_cond_t* cond)
+{
+}
+
+static void mtCondWait(mt_cond_t* cond, mt_mtx_t* mtx)
+{
+}
+
+static void mtCondBroadcast(mt_cond_t* cond)
+{
+}
+
+static void mtCondClose(mt_cond_t* cond)
+{
+}
+
+static u32 mtPid()
+{
+	return 0;
+}
+
+#endif // OS
+
+/*
+*******************************************************************************
+Пул потоков
+
+Каждый рабочий поток владеет деком заданий фиксированной емкости
+MT_POOL_QUEUE. Задания ставятся в деки по кругу. Поток извлекает задания
+из конца своего дека, а опустошив его, забирает задания из начала деков
+других потоков. Деки защищаются спин-блокировками: операции над деком
+занимают несколько тактов.
+
+Задание сопровождается счетчиком незавершенных заданий своей группы
+(все задания mtPoolSubmit() или участки одного вызова mtPoolFor()).
+Ожидающий поток выполняет задания из деков до тех пор, пока счетчик его
+группы не обнулится. Если деки пусты, то поток засыпает на условной
+переменной.
+
+Счетчик queued -- число заданий в деках, sleepers -- число потоков,
+которые засыпают или спят на условной переменной. Постановщик задания
+сначала увеличивает queued, затем читает sleepers, засыпающий поток --
+наоборот. Атомарные операции являются полными барьерами, поэтому хотя бы
+один из потоков увидит изменение, сделанное другим, и пробуждение
+не будет потеряно. Так же согласуются обнуление счетчика группы и
+засыпание ожидающего потока.
+
+Пул запоминает идентификатор создавшего его процесса. В клонированном
+процессе (после fork()) рабочих потоков нет, и задания выполняются
+в вызывающем потоке.
+*******************************************************************************
+*/
+
+#define MT_POOL_QUEUE 256
+#define MT_POOL_THREADS 64
+#define MT_POOL_PARTS 4
+
+typedef struct
+{
+	void (*fn)(void*);		/*!< задание */
+	void* arg;				/*!< аргумент задания */
+	size_t* ctr;			/*!< счетчик группы */
+} mt_job_st;
+
+typedef struct
+{
+	mt_spin_t spin;			/*!< блокировка */
+	size_t top;				/*!< начало (для заимствования) */
+	size_t bottom;			/*!< конец (для владельца) */
+	mt_job_st jobs[MT_POOL_QUEUE];	/*!< задания */
+} mt_deque_st;
+
+typedef struct mt_pool_st mt_pool_st;
+
+typedef struct
+{
+	mt_pool_st* pool;		/*!< пул */
+	size_t index;			/*!< номер потока */
+	mt_thrd_t thrd;			/*!< поток */
+} mt_worker_st;
+
+struct mt_pool_st
+{
+	size_t threads;			/*!< число рабочих потоков */
+	size_t next;			/*!< следующий дек для постановки */
+	size_t queued;			/*!< число заданий в деках */
+	size_t sleepers;		/*!< число спящих потоков */
+	size_t active;			/*!< число незавершенных заданий mtPoolSubmit() */
+	bool_t stop;			/*!< признак закрытия */
+	u32 pid;				/*!< идентификатор процесса */
+	mt_mtx_t mtx[1];		/*!< мьютекс */
+	mt_cond_t cond[1];		/*!< условная переменная */
+	mt_deque_st* deques;	/*!< деки */
+	mt_worker_st* workers;	/*!< рабочие потоки */
+};
+
+static bool_t mtDequePush(mt_deque_st* deque, const mt_job_st* job)
+{
+	bool_t ret = FALSE;
+	mtSpinLock(&deque->spin);
+	if (deque->bottom - deque->top < MT_POOL_QUEUE)
+	{
+		deque->jobs[deque->bottom % MT_POOL_QUEUE] = *job;
+		++deque->bottom, ret = TRUE;
+	}
+	mtSpinUnlock(&deque->spin);
+	return ret;
+}
+
+static bool_t mtDequePop(mt_deque_st* deque, mt_job_st* job)
+{
+	bool_t ret = FALSE;
+	mtSpinLock(&deque->spin);
+	if (deque->bottom != deque->top)
+	{
+		--deque->bottom, ret = TRUE;
+		*job = deque->jobs[deque->bottom % MT_POOL_QUEUE];
+	}
+	mtSpinUnlock(&deque->spin);
+	return ret;
+}
+
+static bool_t mtDequeSteal(mt_deque_st* deque, mt_job_st* job)
+{
+	bool_t ret = FALSE;
+	mtSpinLock(&deque->spin);
+	if (deque->bottom != deque->top)
+	{
+		*job = deque->jobs[deque->top % MT_POOL_QUEUE];
+		++deque->top, ret = TRUE;
+	}
+	mtSpinUnlock(&deque->spin);
+	return ret;
+}
+
+static bool_t mtPoolIsAlive(const mt_pool_st* pool)
+{
+	return pool->threads > 0 && pool->pid == mtPid();
+}
+
+static void mtPoolWake(mt_pool_st* pool)
+{
+	if (mtAtomicLoad(&pool->sleepers))
+	{
+		mtMtxLock(pool->mtx);
+		mtCondBroadcast(pool->cond);
+		mtMtxUnlock(pool->mtx);
+	}
+}
+
+static void mtPoolRun(mt_pool_st* pool, const mt_job_st* job)
+{
+	job->fn(job->arg);
+	if (mtAtomicDecr(job->ctr) == 0)
+		mtPoolWake(pool);
+}
+
+// self == pool->threads -- сторонний поток
+static bool_t mtPoolTake(mt_pool_st* pool, size_t self, mt_job_st* job)
+{
+	size_t i;
+	if (mtAtomicLoad(&pool->queued) == 0)
+		return FALSE;
+	if (self < pool->threads && mtDequePop(pool->deques + self, job))
+	{
+		mtAtomicDecr(&pool->queued);
+		return TRUE;
+	}
+	for (i = 1; i <= pool->threads; ++i)
+		if (mtDequeSteal(pool->deques + (self + i) % pool->threads, job))
+		{
+			mtAtomicDecr(&pool->queued);
+			return TRUE;
+		}
+	return FALSE;
+}
+
+static void mtPoolPush(mt_pool_st* pool, void (*fn)(void*), void* arg,
+	size_t* ctr)
+{
+	mt_job_st job[1];
+	size_t i, j;
+	job->fn = fn, job->arg = arg, job->ctr = ctr;
+	mtAtomicIncr(ctr);
+	if (mtPoolIsAlive(pool))
+	{
+		i = mtAtomicIncr(&pool->next);
+		for (j = 0; j < pool->threads; ++j)
+			if (mtDequePush(pool->deques + (i + j) % pool->threads, job))
+			{
+				mtAtomicIncr(&pool->queued);
+				mtPoolWake(pool);
+				return;
+			}
+	}
+	mtPoolRun(pool, job);
+}
+
+static void mtPoolWaitCtr(mt_pool_st* pool, size_t self, size_t* ctr)
+{
+	mt_job_st job[1];
+	while (mtAtomicLoad(ctr))
+	{
+		if (mtPoolTake(pool, self, job))
+		{
+			mtPoolRun(pool, job);
+			continue;
+		}
+		mtMtxLock(pool->mtx);
+		mtAtomicIncr(&pool->sleepers);
+		if (mtAtomicLoad(ctr) && mtAtomicLoad(&pool->queued) == 0)
+			mtCondWait(pool->cond, pool->mtx);
+		mtAtomicDecr(&pool->sleepers);
+		mtMtxUnlock(pool->mtx);
+	}
+}
+
+static void mtPoolWorker(void* arg)
+{
+	mt_worker_st* worker = (mt_worker_st*)arg;
+	mt_pool_st* pool = worker->pool;
+	mt_job_st job[1];
+	bool_t stop;
+	while (1)
+	{
+		if (mtPoolTake(pool, worker->index, job))
+		{
+			mtPoolRun(pool, job);
+			continue;
+		}
+		mtMtxLock(pool->mtx);
+		mtAtomicIncr(&pool->sleepers);
+		if (!pool->stop && mtAtomicLoad(&pool->queued) == 0)
+			mtCondWait(pool->cond, pool->mtx);
+		mtAtomicDecr(&pool->sleepers);
+		stop = pool->stop && mtAtomicLoad(&pool->queued) == 0;
+		mtMtxUnlock(pool->mtx);
+		if (stop)
+			break;
+	}
+}
+
+mt_pool_t mtPoolCreate(size_t threads)
+{
+	mt_pool_st* pool;
+	size_t i;
+	threads = MIN2(threads, MT_POOL_THREADS);
+	pool = (mt_pool_st*)memAlloc(sizeof(mt_pool_st) +
+		threads * (sizeof(mt_deque_st) + sizeof(mt_worker_st)));
+	if (!pool)
+		return 0;
+	memSetZero(pool, sizeof(mt_pool_st));
+	pool->deques = (mt_deque_st*)(pool + 1);
+	pool->workers = (mt_worker_st*)(pool->deques + threads);
+	memSetZero(pool->deques, threads * sizeof(mt_deque_st));
+	pool->pid = mtPid();
+	if (!mtMtxCreate(pool->mtx))
+	{
+		memFree(pool);
+		return 0;
+	}
+	mtCondCreate(pool->cond);
+	// запустить потоки (число потоков фиксируется до запуска)
+	for (i = 0; i < threads; ++i)
+		pool->workers[i].pool = pool, pool->workers[i].index = i;
+	pool->threads = threads;
+	for (i = 0; i < threads; ++i)
+		if (!mtThrdCreate(&pool->workers[i].thrd, mtPoolWorker,
+			pool->workers + i))
+			break;
+	// не все потоки созданы?
+	if (i < threads)
+	{
+		mtMtxLock(pool->mtx);
+		pool->stop = TRUE;
+		mtCondBroadcast(pool->cond);
+		mtMtxUnlock(pool->mtx);
+		while (i--)
+			mtThrdJoin(&pool->workers[i].thrd);
+		pool->stop = FALSE, pool->threads = 0;
+	}
+	return pool;
+}
+
+void mtPoolClose(mt_pool_t p)
+{
+	mt_pool_st* pool = (mt_pool_st*)p;
+	size_t i;
+	ASSERT(memIsValid(pool, sizeof(mt_pool_st)));
+	if (mtPoolIsAlive(pool))
+	{
+		mtPoolWaitCtr(pool, pool->threads, &pool->active);
+		mtMtxLock(pool->mtx);
+		pool->stop = TRUE;
+		mtCondBroadcast(pool->cond);
+		mtMtxUnlock(pool->mtx);
+		for (i = 0; i < pool->threads; ++i)
+			mtThrdJoin(&pool->workers[i].thrd);
+	}
+	// дочерний процесс? примитивы унаследованы вместе с состоянием
+	// потоков родителя (захваченный мьютекс, ожидающие потоки), поэтому
+	// перед освобождением они инициализируются заново
+	else if (pool->pid != mtPid())
+	{
+		mtCondCreate(pool->cond);
+		if (!mtMtxCreate(pool->mtx))
+		{
+			mtCondClose(pool->cond);
+			memFree(pool);
+			return;
+		}
+	}
+	mtCondClose(pool->cond);
+	mtMtxClose(pool->mtx);
+	memFree(pool);
+}
+
+/*
+*******************************************************************************
+Пул потоков по умолчанию и внешний исполнитель
+*******************************************************************************
+*/
+
+static size_t _pool_once;
+static mt_pool_t _pool;
+static mt_exec_t _exec[1];
+
+static void mtPoolDefaultClose()
+{
+	if (_pool)
+		mtPoolClose(_pool), _pool = 0;
+}
+
+static void mtPoolDefaultInit()
+{
+	size_t threads = mtProcCount();
+	_pool = mtPoolCreate(threads - 1);
+	if (_pool && !utilOnExit(mtPoolDefaultClose))
+		mtPoolClose(_pool), _pool = 0;
+}
+
+static mt_pool_st* mtPoolGet(mt_pool_t pool)
+{
+	if (pool)
+		return (mt_pool_st*)pool;
+	mtCallOnce(&_pool_once, mtPoolDefaultInit);
+	return (mt_pool_st*)_pool;
+}
+
+size_t mtPoolThreads(mt_pool_t p)
+{
+	mt_pool_st* pool = mtPoolGet(p);
+	return pool && mtPoolIsAlive(pool) ? pool->threads : 0;
+}
+
+void mtPoolSubmit(mt_pool_t p, void (*fn)(void*), void* arg)
+{
+	mt_pool_st* pool = mtPoolGet(p);
+	if (!pool)
+		fn(arg);
+	else
+		mtPoolPush(pool, fn, arg, &pool->active);
+}
+
+void mtPoolWait(mt_pool_t p)
+{
+	mt_pool_st* pool = mtPoolGet(p);
+	if (pool)
+		mtPoolWaitCtr(pool, pool->threads, &pool->active);
+}
+
+typedef struct
+{
+	void (*fn)(size_t from, size_t to, void* arg);
+	void* arg;
+	size_t from;
+	size_t to;
+} mt_range_st;
+
+static void mtPoolRange(void* arg)
+{
+	mt_range_st* range = (mt_range_st*)arg;
+	range->fn(range->from, range->to, range->arg);
+}
+
+void mtPoolFor(mt_pool_t p, size_t count,
+	void (*fn)(size_t from, size_t to, void* arg), void* arg)
+{
+	mt_pool_st* pool;
+	mt_range_st range[MT_POOL_PARTS * (MT_POOL_THREADS + 1)];
+	size_t ctr[1] = { 0 };
+	size_t parts, i;
+	// внешний исполнитель?
+	if (!p && _exec->run)
+	{
+		if (count)
+			_exec->run(_exec->ctx, count, fn, arg);
+		return;
+	}
+	// последовательная обработка?
+	pool = mtPoolGet(p);
+	if (!pool || !mtPoolIsAlive(pool) || count < 2)
+	{
+		if (count)
+			fn(0, count, arg);
+		return;
+	}
+	// разбить на участки
+	parts = MIN2(count, MT_POOL_PARTS * (pool->threads + 1));
+	for (i = 0; i < parts; ++i)
+	{
+		range[i].fn = fn, range[i].arg = arg;
+		range[i].from = count / parts * i + MIN2(i, count % parts);
+		range[i].to = range[i].from + count / parts + (i < count % parts);
+	}
+	// обработать участки
+	for (i = parts - 1; i > 0; --i)
+		mtPoolPush(pool, mtPoolRange, range + i, ctr);
+	mtPoolRange(range);
+	mtPoolWaitCtr(pool, pool->threads, ctr);
+}
+
+void mtExecSet(const mt_exec_t* exec)
+{
+	if (exec)
+	{
+		ASSERT(memIsValid(exec, sizeof(mt_exec_t)));
+		ASSERT(exec->run != 0);
+		_exec->ctx = exec->ctx, _exec->run = exec->run;
+	}
+	else
+		_exec->ctx = 0, _exec->run = 0;
+}
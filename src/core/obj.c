@@ -4,13 +4,14 @@
 \brief Compound objects
 \project bee2 [cryptographic library]
 \created 2014.04.14
-\version 2015.05.22
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/obj.h"
 #include "bee2/core/util.h"
 
@@ -66,8 +67,8 @@ static void objShiftPtrs(void* obj, ptrdiff_t diff)
 		if ((octet*)obj <= objPtr(obj, i, octet) + diff && 
 			objPtr(obj, i, octet) + diff < objEnd(obj, octet))
 		{
-			objShiftPtrs(objPtr(obj, i, void), diff);
 			objPtr(obj, i, octet) += diff;
+			objShiftPtrs(objPtr(obj, i, void), diff);
 		}
 	// просмотреть оставшиеся указатели
 	for (; i < objPCount(obj); ++i)
@@ -104,3 +105,77 @@ void objAppend(void* dest, const void* src, size_t i)
 	// расширить dest
 	objHdr(dest)->keep += t;
 }
+
+/*
+*******************************************************************************
+Реплики
+
+Указатели на реплики хранятся в ячейках типа size_t, которые заполняются
+функцией mtAtomicCmpSwap(). Если два потока одного узла одновременно
+построят реплики, то в набор попадет только одна из них, а другая будет
+освобождена.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const void* obj;			/*< исходный объект */
+	size_t keep;				/*< длина реплики */
+	obj_clone_i clone;			/*< функция построения реплики */
+	size_t reps[OBJ_REPS_MAX];	/*< реплики узлов */
+} obj_reps_st;
+
+size_t objReps_keep()
+{
+	return sizeof(obj_reps_st);
+}
+
+void objRepsStart(void* reps, const void* obj, size_t keep,
+	obj_clone_i clone)
+{
+	obj_reps_st* r = (obj_reps_st*)reps;
+	ASSERT(memIsValid(r, sizeof(obj_reps_st)));
+	ASSERT(objIsOperable(obj));
+	ASSERT(clone || keep >= objKeep(obj));
+	memSetZero(r, sizeof(obj_reps_st));
+	r->obj = obj;
+	r->keep = keep;
+	r->clone = clone;
+}
+
+const void* objRepsGet(void* reps)
+{
+	obj_reps_st* r = (obj_reps_st*)reps;
+	size_t* slot;
+	size_t t;
+	void* rep;
+	ASSERT(memIsValid(r, sizeof(obj_reps_st)));
+	// реплика уже создана?
+	slot = r->reps + mtNumaNode() % OBJ_REPS_MAX;
+	if ((t = mtAtomicLoad(slot)) != 0)
+		return (const void*)t;
+	// создать реплику в текущем потоке
+	if (!(rep = memAlloc(r->keep)))
+		return r->obj;
+	if (r->clone)
+		r->clone(rep, r->obj);
+	else
+		objCopy(rep, r->obj);
+	// опубликовать реплику
+	if ((t = mtAtomicCmpSwap(slot, 0, (size_t)rep)) != 0)
+	{
+		memFree(rep);
+		return (const void*)t;
+	}
+	return rep;
+}
+
+void objRepsClose(void* reps)
+{
+	obj_reps_st* r = (obj_reps_st*)reps;
+	size_t i;
+	ASSERT(memIsValid(r, sizeof(obj_reps_st)));
+	for (i = 0; i < OBJ_REPS_MAX; ++i)
+		if (r->reps[i])
+			memFree((void*)r->reps[i]), r->reps[i] = 0;
+}
@@ -4,7 +4,7 @@
 \brief Object identifiers
 \project bee2 [cryptographic library]
 \created 2013.02.04
-\version 2021.04.12
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -81,6 +81,229 @@ bool_t oidIsValid(const char* oid)
 	return n >= 2;
 }
 
+/*
+*******************************************************************************
+Реестр
+
+Реестр содержит идентификаторы, известные библиотеке (алгоритмы и параметры
+СТБ 34.101, СТБ 1176.2, ДСТУ 4145, ГОСТ Р 34.10, PKCS#5), вместе с их
+готовыми DER-кодами.
+
+Поиск в реестре выполняется с помощью совершенных хэш-функций: номер ячейки
+таблицы _oid_by_str (_oid_by_der) определяется как старшие 6 битов
+хэш-значения oidHash(oid, seed) (oidHash(der, seed)). В ячейке хранится
+номер элемента реестра, увеличенный на 1, или 0 для пустой ячейки.
+Значения seed подобраны так, что элементы реестра попадают в разные ячейки.
+Найденный элемент сравнивается с искомым, поэтому после изменения реестра
+без пересчета таблиц поиск остается корректным, теряется только скорость.
+
+Таблицы построены с помощью функции:
+\code
+	void oidBuildSlots(octet slots[64], u32 seed, bool_t by_der)
+	{
+		size_t i;
+		memSetZero(slots, 64);
+		for (i = 0; i < COUNT_OF(_oids); ++i)
+		{
+			size_t pos = by_der ? 
+				oidHash(_oids[i].der, _oids[i].der[1] + 2, seed) :
+				oidHash(_oids[i].oid, strLen(_oids[i].oid), seed);
+			ASSERT(slots[pos] == 0);
+			slots[pos] = (octet)(i + 1);
+		}
+	}
+\endcode
+Значения seed подобраны перебором: минимальные значения, при которых
+в oidBuildSlots() не срабатывает ASSERT.
+*******************************************************************************
+*/
+
+static const struct
+{
+	const char* oid;	/*!< идентификатор */
+	octet der[16];		/*!< DER-код */
+} _oids[] =
+{
+	// СТБ 34.101.31, СТБ 34.101.47, СТБ 34.101.77
+	{"1.2.112.0.2.0.34.101.31.81",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x1F, 0x51}},
+	{"1.2.112.0.2.0.34.101.31.73",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x1F, 0x49}},
+	{"1.2.112.0.2.0.34.101.77.12",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x4D, 0x0C}},
+	{"1.2.112.0.2.0.34.101.77.13",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x4D, 0x0D}},
+	{"1.2.112.0.2.0.34.101.47.12",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x2F, 0x0C}},
+	// СТБ 34.101.45
+	{"1.2.112.0.2.0.34.101.45.2.1",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x2D, 0x02, 0x01}},
+	{"1.2.112.0.2.0.34.101.45.3.1",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x2D, 0x03, 0x01}},
+	{"1.2.112.0.2.0.34.101.45.3.2",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x2D, 0x03, 0x02}},
+	{"1.2.112.0.2.0.34.101.45.3.3",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x2D, 0x03, 0x03}},
+	// СТБ 34.101.60
+	{"1.2.112.0.2.0.34.101.60.11",
+		{0x06, 0x09, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x3C, 0x0B}},
+	{"1.2.112.0.2.0.34.101.60.2.1",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x3C, 0x02, 0x01}},
+	{"1.2.112.0.2.0.34.101.60.2.2",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x3C, 0x02, 0x02}},
+	{"1.2.112.0.2.0.34.101.60.2.3",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x3C, 0x02, 0x03}},
+	// СТБ 34.101.79
+	{"1.2.112.0.2.0.34.101.79.6.1",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x4F, 0x06, 0x01}},
+	{"1.2.112.0.2.0.34.101.79.6.2",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x4F, 0x06, 0x02}},
+	{"1.2.112.0.2.0.34.101.79.8.1",
+		{0x06, 0x0A, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x22,
+			0x65, 0x4F, 0x08, 0x01}},
+	// СТБ 1176.2
+	{"1.2.112.0.2.0.1176.2.3.3.2",
+		{0x06, 0x0B, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x89,
+			0x18, 0x02, 0x03, 0x03, 0x02}},
+	{"1.2.112.0.2.0.1176.2.3.6.2",
+		{0x06, 0x0B, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x89,
+			0x18, 0x02, 0x03, 0x06, 0x02}},
+	{"1.2.112.0.2.0.1176.2.3.10.2",
+		{0x06, 0x0B, 0x2A, 0x70, 0x00, 0x02, 0x00, 0x89,
+			0x18, 0x02, 0x03, 0x0A, 0x02}},
+	// PKCS#5
+	{"1.2.840.113549.1.5.12",
+		{0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+			0x01, 0x05, 0x0C}},
+	{"1.2.840.113549.1.5.13",
+		{0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+			0x01, 0x05, 0x0D}},
+	// ДСТУ 4145
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.0",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x00}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.1",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.2",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.3",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x03}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.4",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x04}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.5",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x05}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.6",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x06}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.7",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x07}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.8",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x08}},
+	{"1.2.804.2.1.1.1.1.3.1.1.1.2.9",
+		{0x06, 0x0E, 0x2A, 0x86, 0x24, 0x02, 0x01, 0x01,
+			0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x09}},
+	// ГОСТ Р 34.10
+	{"1.2.643.2.2.35.0",
+		{0x06, 0x07, 0x2A, 0x85, 0x03, 0x02, 0x02, 0x23,
+			0x00}},
+	{"1.2.643.2.2.35.1",
+		{0x06, 0x07, 0x2A, 0x85, 0x03, 0x02, 0x02, 0x23,
+			0x01}},
+	{"1.2.643.2.2.35.2",
+		{0x06, 0x07, 0x2A, 0x85, 0x03, 0x02, 0x02, 0x23,
+			0x02}},
+	{"1.2.643.2.2.35.3",
+		{0x06, 0x07, 0x2A, 0x85, 0x03, 0x02, 0x02, 0x23,
+			0x03}},
+	{"1.2.643.7.1.2.1.2.0",
+		{0x06, 0x09, 0x2A, 0x85, 0x03, 0x07, 0x01, 0x02,
+			0x01, 0x02, 0x00}},
+	{"1.2.643.7.1.2.1.2.1",
+		{0x06, 0x09, 0x2A, 0x85, 0x03, 0x07, 0x01, 0x02,
+			0x01, 0x02, 0x01}},
+	{"1.2.643.7.1.2.1.2.2",
+		{0x06, 0x09, 0x2A, 0x85, 0x03, 0x07, 0x01, 0x02,
+			0x01, 0x02, 0x02}},
+	{"1.2.643.2.9.1.8.1",
+		{0x06, 0x08, 0x2A, 0x85, 0x03, 0x02, 0x09, 0x01,
+			0x08, 0x01}},
+};
+
+#define OID_SEED_STR 3291479
+#define OID_SEED_DER 397100
+
+static const octet _oid_by_str[64] =
+{
+	 0, 39, 27,  0,  6,  4, 14,  0, 16,  0,  0, 36,  0, 13, 32, 29,
+	30, 20, 26, 23, 33,  2,  0,  0,  0,  0,  0,  0,  0,  0,  8,  5,
+	24,  0, 18, 21,  7, 11,  0,  0, 34, 25,  9,  1,  0, 17, 31, 15,
+	 0,  3, 28, 19, 37, 38, 35,  0,  0, 12,  0, 10,  0,  0, 22,  0,
+};
+static const octet _oid_by_der[64] =
+{
+	36, 29, 25, 39, 22, 20,  0, 24,  6, 18,  5, 19,  2, 17,  8,  0,
+	 0,  0,  0,  0,  0,  0, 28, 14,  0,  0,  0,  0,  7, 38,  4,  0,
+	12, 31, 23, 15,  0, 35, 33, 26,  0,  0,  0, 21,  0,  3,  0, 16,
+	27,  9,  0,  0, 32, 30,  0, 13, 37,  1,  0, 10, 34,  0,  0, 11,
+};
+
+static size_t oidHash(const void* buf, size_t count, u32 seed)
+{
+	register u32 h = seed;
+	for (; count--; buf = (const octet*)buf + 1)
+		h ^= *(const octet*)buf, h *= 16777619;
+	h ^= h >> 15, h *= 0x2C1B3C6D, h ^= h >> 12;
+	return (size_t)(h >> 26);
+}
+
+const octet* oidLookup(size_t* count, const char* oid)
+{
+	size_t len;
+	size_t i;
+	ASSERT(memIsValid(count, O_PER_S));
+	ASSERT(strIsValid(oid));
+	len = strLen(oid);
+	i = _oid_by_str[oidHash(oid, len, OID_SEED_STR)];
+	if (i-- == 0 || !strEq(_oids[i].oid, oid))
+		return 0;
+	*count = (size_t)_oids[i].der[1] + 2;
+	return _oids[i].der;
+}
+
+static const char* oidLookupDER(const octet der[], size_t count)
+{
+	size_t i;
+	ASSERT(memIsValid(der, count));
+	if (count < 2 || count > 16 || der[1] + 2u != count)
+		return 0;
+	i = _oid_by_der[oidHash(der, count, OID_SEED_DER)];
+	if (i-- == 0 || !memEq(_oids[i].der, der, count))
+		return 0;
+	return _oids[i].oid;
+}
+
 /*
 *******************************************************************************
 Кодирование
@@ -89,12 +312,36 @@ bool_t oidIsValid(const char* oid)
 
 size_t oidToDER(octet der[], const char* oid)
 {
+	const octet* reg;
+	size_t count;
+	// идентификатор из реестра?
+	if (strIsValid(oid) && (reg = oidLookup(&count, oid)) != 0)
+	{
+		if (der)
+		{
+			ASSERT(memIsValid(der, count));
+			memCopy(der, reg, count);
+		}
+		return count;
+	}
 	return derOIDEnc(der, oid);
 }
 
 size_t oidFromDER(char* oid, const octet der[], size_t count)
 {
+	const char* reg;
 	size_t len, c;
+	// идентификатор из реестра?
+	if ((reg = oidLookupDER(der, count)) != 0)
+	{
+		len = strLen(reg);
+		if (oid)
+		{
+			ASSERT(memIsValid(oid, len + 1));
+			strCopy(oid, reg);
+		}
+		return len;
+	}
 	c = derOIDDec(oid, &len, der, count);
 	if (len == SIZE_MAX || c != count)
 		return SIZE_MAX;
@@ -4,7 +4,7 @@
 \brief Entropy sources and random number generators
 \project bee2 [cryptographic library]
 \created 2014.10.13
-\version 2023.02.08
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -24,6 +24,7 @@
 #include "bee2/crypto/belt.h"
 #include "bee2/crypto/brng.h"
 #include "bee2/math/ww.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -137,11 +138,22 @@ bool_t rngTestFIPS4(const octet buf[2500])
 *******************************************************************************
 */
 
-#if	(_MSC_VER >= 1600) && (defined(_M_IX86) || defined(_M_X64))
+#if	(_MSC_VER >= 1600) && defined(_M_X64)
 
 #include <intrin.h>
 #include <immintrin.h>
 
+typedef u64 rng_rd_t;
+#define rngCPUID(info, id) __cpuidex((int*)info, id, 0)
+#define rngRDStep(val) _rdseed64_step(val)
+#define rngRDStep2(val) _rdrand64_step(val)
+
+#elif (_MSC_VER >= 1600) && defined(_M_IX86)
+
+#include <intrin.h>
+#include <immintrin.h>
+
+typedef u32 rng_rd_t;
 #define rngCPUID(info, id) __cpuidex((int*)info, id, 0)
 #define rngRDStep(val) _rdseed32_step(val)
 #define rngRDStep2(val) _rdrand32_step(val)
@@ -152,6 +164,8 @@ bool_t rngTestFIPS4(const octet buf[2500])
 #define rdseed_eax	__asm _emit 0x0F __asm _emit 0xC7 __asm _emit 0xF8
 #define rdrand_eax	__asm _emit 0x0F __asm _emit 0xC7 __asm _emit 0xF0
 
+typedef u32 rng_rd_t;
+
 static void rngCPUID(u32 info[4], u32 id)
 {
 	u32 a, b, c, d;
@@ -201,17 +215,23 @@ err:
 
 #include <cpuid.h>
 
+#if defined(__x86_64__)
+	typedef u64 rng_rd_t;
+#else
+	typedef u32 rng_rd_t;
+#endif
+
 #define rngCPUID(info, id) \
 	__cpuid_count(id, 0, info[0], info[1], info[2], info[3])
 
-static int rngRDStep(u32* val)
+static int rngRDStep(rng_rd_t* val)
 {
 	octet ok;
 	asm volatile("rdseed %0; setc %1" : "=r" (*val), "=qm" (ok));
 	return ok;
 }
 
-static int rngRDStep2(u32* val)
+static int rngRDStep2(rng_rd_t* val)
 {
 	octet ok;
 	asm volatile("rdrand %0; setc %1" : "=r" (*val), "=qm" (ok));
@@ -220,13 +240,36 @@ static int rngRDStep2(u32* val)
 
 #else
 
+typedef u32 rng_rd_t;
 #define rngCPUID(info, id) memSetZero(info, 16)
 #define rngRDStep(val) 0
 #define rngRDStep2(val) 0
 
 #endif
 
-static bool_t rngTRNGIsAvail()
+/*
+*******************************************************************************
+Наличие инструкций определяется один раз (инструкция cpuid под 
+виртуальной машиной может перехватываться гипервизором и выполняться долго).
+
+Инструкции rdrand и rdseed могут завершаться неудачей, если исчерпан 
+внутренний буфер ГСЧ. По рекомендациям Intel вызов rdrand повторяется 
+до RNG_RDRAND_RETRY раз. Инструкция rdseed исчерпывает буфер быстрее, 
+поэтому для нее допускается RNG_RDSEED_RETRY попыток.
+
+Данные вырабатываются словами rng_rd_t (на 64-разрядных платформах -- 
+по 8 октетов за инструкцию). Последнее неполное слово усекается.
+*******************************************************************************
+*/
+
+#define RNG_RDRAND_RETRY 10
+#define RNG_RDSEED_RETRY 100
+
+static size_t _rd_once;			/*< триггер однократности */
+static bool_t _rd_seed;			/*< есть rdseed? */
+static bool_t _rd_rand;			/*< есть rdrand? */
+
+static void rngRDInit()
 {
 	u32 info[4];
 	// Intel?
@@ -234,80 +277,88 @@ static bool_t rngTRNGIsAvail()
 	if (!memEq(info + 1, "Genu", 4) ||
 		!memEq(info + 3, "ineI", 4) ||
 		!memEq(info + 2, "ntel", 4))
-		return FALSE;
-	/* rdseed? */
+		return;
+	// rdseed?
 	rngCPUID(info, 7);
-	return (info[1] & 0x00040000) != 0;
+	_rd_seed = (info[1] & 0x00040000) != 0;
+	// rdrand?
+	rngCPUID(info, 1);
+	_rd_rand = (info[2] & 0x40000000) != 0;
+}
+
+static bool_t rngTRNGIsAvail()
+{
+	return mtCallOnce(&_rd_once, rngRDInit) && _rd_seed;
 }
 
 static bool_t rngTRNG2IsAvail()
 {
-	u32 info[4];
-	// Intel?
-	rngCPUID(info, 0);
-	if (!memEq(info + 1, "Genu", 4) ||
-		!memEq(info + 3, "ineI", 4) ||
-		!memEq(info + 2, "ntel", 4))
-		return FALSE;
-	// rdrand?
-	rngCPUID(info, 1);
-	return (info[2] & 0x40000000) != 0;
+	return mtCallOnce(&_rd_once, rngRDInit) && _rd_rand;
 }
 
-static err_t rngTRNGRead(void* buf, size_t* read, size_t count)
+static bool_t rngRDSeed(rng_rd_t* val)
 {
-	u32* rand = (u32*)buf;
-	// pre
-	ASSERT(memIsValid(read, O_PER_S));
-	ASSERT(memIsValid(buf, count));
-	// есть источник?
-	if (!rngTRNGIsAvail())
-		return ERR_FILE_NOT_FOUND;
-	// короткий буфер?
-	*read = 0;
-	if (count < 4)
-		return ERR_OK;
+	size_t i;
+	for (i = 0; i < RNG_RDSEED_RETRY; ++i)
+		if (rngRDStep(val))
+			return TRUE;
+	return FALSE;
+}
+
+static bool_t rngRDRand(rng_rd_t* val)
+{
+	size_t i;
+	for (i = 0; i < RNG_RDRAND_RETRY; ++i)
+		if (rngRDStep2(val))
+			return TRUE;
+	return FALSE;
+}
+
+static err_t rngRDRead(void* buf, size_t* read, size_t count, 
+	bool_t (*step)(rng_rd_t*))
+{
+	rng_rd_t rand;
 	// генерация
-	for (; *read + 4 <= count; *read += 4, ++rand)
-		if (!rngRDStep(rand))
+	for (*read = 0; *read + sizeof(rand) <= count; *read += sizeof(rand))
+	{
+		if (!step(&rand))
 			return ERR_BAD_ENTROPY;
-	// неполный блок
+		memCopy((octet*)buf + *read, &rand, sizeof(rand));
+	}
+	// неполное слово
 	if (*read < count)
 	{
-		rand = (u32*)((octet*)buf + count - 4);
-		if (!rngRDStep(rand))
+		if (!step(&rand))
 			return ERR_BAD_ENTROPY;
+		memCopy((octet*)buf + *read, &rand, count - *read);
 		*read = count;
 	}
+	rand = 0;
 	return ERR_OK;
 }
 
+static err_t rngTRNGRead(void* buf, size_t* read, size_t count)
+{
+	// pre
+	ASSERT(memIsValid(read, O_PER_S));
+	ASSERT(memIsValid(buf, count));
+	// есть источник?
+	if (!rngTRNGIsAvail())
+		return ERR_FILE_NOT_FOUND;
+	// генерация
+	return rngRDRead(buf, read, count, rngRDSeed);
+}
+
 static err_t rngTRNG2Read(void* buf, size_t* read, size_t count)
 {
-	u32* rand = (u32*)buf;
 	// pre
 	ASSERT(memIsValid(read, O_PER_S));
 	ASSERT(memIsValid(buf, count));
 	// есть источник?
 	if (!rngTRNG2IsAvail())
 		return ERR_FILE_NOT_FOUND;
-	// короткий буфер?
-	*read = 0;
-	if (count < 4)
-		return ERR_OK;
 	// генерация
-	for (; *read + 4 <= count; *read += 4, ++rand)
-		if (!rngRDStep2(rand))
-			return ERR_BAD_ENTROPY;
-	// неполный блок
-	if (*read < count)
-	{
-		rand = (u32*)((octet*)buf + count - 4);
-		if (!rngRDStep2(rand))
-			return ERR_BAD_ENTROPY;
-		*read = count;
-	}
-	return ERR_OK;
+	return rngRDRead(buf, read, count, rngRDRand);
 }
 
 /*
@@ -386,9 +437,20 @@ static err_t rngTimerRead(void* buf, size_t* read, size_t count)
 *******************************************************************************
 Системный источник
 
-Системный источник Windows -- это функция CryptGenRandom() поверх
-стандартного криптопровайдера PROV_RSA_FULL. Системный источник Unix -- 
-это файл dev/urandom. 
+Системный источник Windows -- это функция BCryptGenRandom() с алгоритмом
+BCRYPT_RNG_ALGORITHM. Системный источник Unix -- это функция getrandom() 
+(Linux) или getentropy() (macOS, OpenBSD), а при их отсутствии или 
+неработоспособности -- файл dev/urandom.
+
+Источник опрашивается в rngStepR() при каждом запросе. Поэтому ресурсы 
+источника (описатель алгоритма Windows, дескриптор файла dev/urandom) 
+открываются один раз, при первом обращении, и закрываются при завершении 
+работы (см. utilOnExit()). Функции getrandom() и getentropy() не требуют 
+ресурсов и обходятся одним системным вызовом на запрос.
+
+Функции BCrypt размещены в библиотеке bcrypt. В сборке CMake она 
+подключается явно, в проектах Visual Studio -- директивой компоновщику 
+в тексте модуля.
 
 Обсуждение (и критика) источников:
 [1]	http://citeseerx.ist.psu.edu/viewdoc/download?doi=10.1.1.124.6557
@@ -403,9 +465,12 @@ static err_t rngTimerRead(void* buf, size_t* read, size_t count)
 выполнялось экстремально долго (возможно это связано с тем, что программы 
 запускались под виртуальной машиной). Поэтому было решено использовать файл 
 dev/urandom. Это неблокирующий источник, который всегда выдает данные.
+Функция getrandom() без флагов блокируется только до инициализации 
+пула энтропии ядра, т.е. ведет себя "правильнее" dev/urandom.
 
-\remark Установка флагов CRYPT_VERIFYCONTEXT и CRYPT_SILENT при вызове
-CryptAcquireContextW() снижает риск ошибочного завершения функции.
+\remark Дескриптор файла dev/urandom открывается с флагом O_CLOEXEC и 
+не наследуется процессами, запущенными с помощью exec(). После fork() 
+дескриптор наследуется и остается работоспособным.
 
 \todo http://www.2uo.de/myths-about-urandom/
 *******************************************************************************
@@ -414,48 +479,153 @@ CryptAcquireContextW() снижает риск ошибочного заверш
 #if defined OS_WIN
 
 #include <windows.h>
-#include <wincrypt.h>
+#include <bcrypt.h>
+
+#if defined(_MSC_VER)
+	#pragma comment(lib, "bcrypt")
+#endif
+
+static size_t _sys_once;			/*< триггер однократности */
+static BCRYPT_ALG_HANDLE _sys_alg;	/*< описатель алгоритма */
+
+static void rngSysClose()
+{
+	if (_sys_alg)
+		BCryptCloseAlgorithmProvider(_sys_alg, 0), _sys_alg = 0;
+}
+
+static void rngSysInit()
+{
+	if (!BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&_sys_alg, 
+		BCRYPT_RNG_ALGORITHM, 0, 0)))
+		_sys_alg = 0;
+	else if (!utilOnExit(rngSysClose))
+		rngSysClose();
+}
 
 static err_t rngSysRead(void* buf, size_t* read, size_t count)
 {
-	HCRYPTPROV hprov = 0;
 	// pre
 	ASSERT(memIsValid(read, sizeof(size_t)));
 	ASSERT(memIsValid(buf, count));
-	// открыть провайдер
-	if (!CryptAcquireContextW(&hprov, 0, 0, PROV_RSA_FULL,
-		CRYPT_VERIFYCONTEXT | CRYPT_SILENT))
-	{
-		*read = 0;
+	// открыть алгоритм
+	*read = 0;
+	if (!mtCallOnce(&_sys_once, rngSysInit) || !_sys_alg)
 		return ERR_FILE_NOT_FOUND;
-	}
-	// получить данные (count == 0 считается ошибкой)
-	if (count && !CryptGenRandom(hprov, (DWORD)count, (octet*)buf))
+	// получить данные (порциями, которые укладываются в ULONG)
+	while (*read < count)
 	{
-		*read = 0;
-		CryptReleaseContext(hprov, 0);
-		return ERR_BAD_ENTROPY;
+		ULONG len = (ULONG)MIN2(count - *read, 0x7FFFFFFF);
+		if (!BCRYPT_SUCCESS(BCryptGenRandom(_sys_alg, 
+			(octet*)buf + *read, len, 0)))
+			return ERR_BAD_ENTROPY;
+		*read += len;
 	}
-	// завершение
-	CryptReleaseContext(hprov, 0);
-	*read = count;
 	return ERR_OK;
 }
 
 #elif defined OS_UNIX
 
-#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(OS_LINUX) && defined(__GLIBC__) &&\
+	(__GLIBC__ > 2 || __GLIBC__ == 2 && __GLIBC_MINOR__ >= 25)
+	#include <sys/random.h>
+	#define RNG_GETRANDOM
+#elif defined(OS_APPLE) || defined(__OpenBSD__)
+	#include <sys/random.h>
+	#define RNG_GETENTROPY
+#endif
+
+#ifndef O_CLOEXEC
+	#define O_CLOEXEC 0
+#endif
+
+static size_t _sys_once;			/*< триггер однократности */
+static int _sys_fd = -1;			/*< дескриптор dev/urandom */
+
+static void rngSysClose()
+{
+	if (_sys_fd >= 0)
+		close(_sys_fd), _sys_fd = -1;
+}
+
+static void rngSysInit()
+{
+	do
+		_sys_fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+	while (_sys_fd < 0 && errno == EINTR);
+	if (_sys_fd >= 0 && !utilOnExit(rngSysClose))
+		rngSysClose();
+}
+
+static size_t rngSysReadFile(octet* buf, size_t count)
+{
+	size_t done = 0;
+	ssize_t r;
+	ASSERT(_sys_fd >= 0);
+	while (done < count)
+		if ((r = read(_sys_fd, buf + done, count - done)) > 0)
+			done += (size_t)r;
+		else if (r < 0 && errno == EINTR)
+			continue;
+		else
+			break;
+	return done;
+}
+
+#if defined(RNG_GETRANDOM)
+
+static size_t rngSysReadCall(octet* buf, size_t count)
+{
+	size_t done = 0;
+	ssize_t r;
+	while (done < count)
+		if ((r = getrandom(buf + done, count - done, 0)) > 0)
+			done += (size_t)r;
+		else if (r < 0 && errno == EINTR)
+			continue;
+		else
+			break;
+	return done;
+}
+
+#elif defined(RNG_GETENTROPY)
+
+static size_t rngSysReadCall(octet* buf, size_t count)
+{
+	size_t done = 0;
+	// не более 256 октетов за вызов
+	while (done < count)
+	{
+		size_t len = MIN2(count - done, 256);
+		if (getentropy(buf + done, len) != 0)
+			break;
+		done += len;
+	}
+	return done;
+}
+
+#else
+
+#define rngSysReadCall(buf, count) 0
+
+#endif
 
 static err_t rngSysRead(void* buf, size_t* read, size_t count)
 {
-	FILE* fp;
 	ASSERT(memIsValid(read, sizeof(size_t)));
 	ASSERT(memIsValid(buf, count));
-	fp = fopen("/dev/urandom", "r");
-	if (!fp)
-		return ERR_FILE_OPEN;
-	*read = fread(buf, 1, count, fp);
-	fclose(fp);
+	// системный вызов
+	*read = rngSysReadCall((octet*)buf, count);
+	if (*read == count)
+		return ERR_OK;
+	// файл dev/urandom
+	if (!mtCallOnce(&_sys_once, rngSysInit) || _sys_fd < 0)
+		return *read ? ERR_OK : ERR_FILE_OPEN;
+	*read += rngSysReadFile((octet*)buf + *read, count - *read);
 	return ERR_OK;
 }
 
@@ -545,13 +715,118 @@ err_t rngESHealth()
 	return ERR_BAD_ENTROPY;
 }
 
+/*
+*******************************************************************************
+Фоновая проверка работоспособности
+
+Функция rngESHealthStart() запускает rngESHealth() в отдельном потоке 
+_health_thrd. Проверка запускается не более одного раза (триггер 
+_health_state). Поток записывает результат в _health_code и взводит флаг 
+_health_done. Запускающий поток после создания _health_thrd взводит флаг 
+_health_ready, после чего завершенный поток _health_thrd может быть 
+присоединен. Присоединение выполняется однократно (триггер _health_joined)
+в rngESHealthResult().
+
+Если поток создать не удалось, то проверка выполняется в вызывающем потоке.
+Поток, не присоединенный к моменту завершения процесса, не ожидается.
+*******************************************************************************
+*/
+
+static size_t _health_state;		/*< проверка запущена? */
+static size_t _health_done;			/*< проверка завершена? */
+static size_t _health_ready;		/*< поток можно присоединять? */
+static size_t _health_joined;		/*< поток присоединен? */
+static bool_t _health_created;		/*< поток создан? */
+static mt_thrd_t _health_thrd[1];	/*< поток */
+static err_t _health_code;			/*< результат проверки */
+
+static void rngESHealthThrd(void* arg)
+{
+	_health_code = rngESHealth();
+	mtAtomicStore(&_health_done, 1);
+}
+
+err_t rngESHealthStart()
+{
+	if (mtAtomicCmpSwap(&_health_state, 0, 1) != 0)
+		return ERR_OK;
+	_health_created = mtThrdCreate(_health_thrd, rngESHealthThrd, 0);
+	if (!_health_created)
+		rngESHealthThrd(0);
+	mtAtomicStore(&_health_ready, 1);
+	return ERR_OK;
+}
+
+err_t rngESHealthResult(bool_t wait)
+{
+	// проверка не запускалась?
+	if (!mtAtomicLoad(&_health_state))
+		return ERR_NOT_READY;
+	// ожидать завершения
+	if (!mtAtomicLoad(&_health_done))
+	{
+		if (!wait)
+			return ERR_NOT_READY;
+		while (!mtAtomicLoad(&_health_done))
+			mtSleep(1);
+	}
+	// присоединить поток
+	if (mtAtomicLoad(&_health_ready) &&
+		mtAtomicCmpSwap(&_health_joined, 0, 1) == 0 && _health_created)
+		mtThrdJoin(_health_thrd);
+	return _health_code;
+}
+
 /*
 *******************************************************************************
 Создание / закрытие генератора
 
+Общий генератор (состояние _state) защищен мьютексом _mtx. Кроме общего 
+генератора, каждый поток, который обращается к rngStepR() или rngStepR2(),
+получает собственный экземпляр brngCTR (состояние rng_thrd_st), ключ 
+которого вырабатывается общим генератором. Указатель на экземпляр хранится 
+в локальной памяти потока (ключ _tls). Экземпляр освобождается при 
+завершении потока.
+
+Общий генератор имеет номер эпохи _epoch, который увеличивается при 
+изменении его состояния: создании, добавлении энтропии в rngCreate(), 
+обновлении ключа в rngRekey(), закрытии. Экземпляр потока запоминает эпоху 
+общего генератора, от которого получен ключ, и, если эпоха изменилась, 
+получает ключ заново. Кроме этого, экземпляр самостоятельно обновляет ключ 
+после выработки каждых RNG_THRD_REKEY октетов.
+
+При создании генератора источники опрашиваются в порядке trng, trng2, sys, 
+timer. Если установлена политика быстрого запуска (_start_fast), то опрос 
+прекращается, как только получено 64 октета данных. В частности, не 
+опрашивается медленный источник timer, если данных быстрых источников 
+достаточно.
+
+Источники случайности опрашиваются не при каждом обращении к rngStepR(), 
+а в соответствии с политикой обновления энтропии: после выработки 
+_reseed_bytes октетов или по истечении _reseed_ms миллисекунд с момента 
+получения ключа от общего генератора. Опрос выполняет функция rngReseed(),
+которая добавляет полученные данные в общий генератор и меняет эпоху.
+
+Если локальную память потоков создать не удалось, то используется только 
+общий генератор.
+
+После ветвления процесса (fork) дочерний процесс наследует состояние 
+общего генератора и экземпляров потоков. Чтобы выходные данные родителя 
+и потомка не совпадали, в ОС Unix с помощью pthread_atfork() 
+регистрируется обработчик, который в дочернем процессе взводит флаг 
+_forked и меняет эпоху. При первом же получении ключа флаг (а также 
+смена идентификатора процесса _pid) обнаруживается и общий генератор 
+обновляется функцией rngForkReseed(): в него добавляются 32 октета 
+источника sys, идентификатор процесса и показания таймера. Полный опрос 
+источников и тесты работоспособности, как в rngCreate(), не выполняются.
+Обработчики pthread_atfork() также удерживают _mtx на время ветвления, 
+чтобы потомок не унаследовал мьютекс, захваченный другим потоком.
+
 \warning CoverityScan выдает предупреждение по функции rngCreate(): 
 	"Call to rngESRead might sleep while holding lock _mtx".
-См. пояснения в комментариях к функции rngStepR().
+Проблема в том, что в источнике timer многократно вызывается функция
+mtSleep(0). В rngStepR() (точнее, в rngReseed()) источники опрашиваются 
+без блокировки.
 
 \warning Функция rngDestroy(), зарегистрированная как деструктор,
 не обязательно будет вызвана позже rngClose(). Например, rngClose()
@@ -566,19 +841,61 @@ typedef struct
 	octet alg_state[];			/*< [MAX(beltHash_keep(), brngCTR_keep())] */
 } rng_state_st;
 
+typedef struct 
+{
+	size_t epoch;				/*< эпоха общего генератора */
+	size_t total;				/*< число октетов после обновления ключа */
+	size_t since;				/*< число октетов после получения ключа */
+	tm_ticks_t stamp;			/*< момент получения ключа */
+	octet block[32];			/*< ключ brngCTR */
+	octet alg_state[];			/*< [brngCTR_keep()] */
+} rng_thrd_st;
+
+#define RNG_THRD_REKEY ((size_t)1 << 20)
+#define RNG_RESEED_BYTES ((size_t)1 << 16)
+#define RNG_RESEED_MS 1000
+
 static size_t _once;			/*< триггер однократности */
 static mt_mtx_t _mtx[1];		/*< мьютекс */
 static bool_t _inited;			/*< мьютекс создан? */
 static size_t _ctr;				/*< счетчик обращений */
 static rng_state_st* _state;	/*< состояние */
+static mt_tls_t _tls[1];		/*< ключ экземпляров потоков */
+static bool_t _tls_inited;		/*< ключ создан? */
+static size_t _epoch;			/*< эпоха общего генератора */
+static size_t _reseed_bytes = RNG_RESEED_BYTES;	/*< порог по объему */
+static u32 _reseed_ms = RNG_RESEED_MS;			/*< порог по времени */
+static tm_ticks_t _reseed_ticks;	/*< порог по времени в тактах */
+static size_t _reseeds;			/*< число опросов источников */
+static size_t _since;			/*< число октетов после опроса */
+static tm_ticks_t _stamp;		/*< момент опроса */
+static bool_t _start_fast;		/*< политика быстрого запуска */
+static size_t _forked;			/*< было ветвление процесса? */
+static u32 _pid;				/*< идентификатор процесса */
 
 size_t rngCreate_keep()
 {
 	return sizeof(rng_state_st) + MAX2(beltHash_keep(), brngCTR_keep());
 }
 
+static size_t rngThrd_keep()
+{
+	return sizeof(rng_thrd_st) + brngCTR_keep();
+}
+
+static void MT_CALLBACK rngThrdClose(void* thrd)
+{
+	blobClose(thrd);
+}
+
 static void rngDestroy()
 {
+	// закрыть экземпляр текущего потока
+	if (_tls_inited)
+	{
+		rngThrdClose(mtTlsGet(_tls)), mtTlsSet(_tls, 0);
+		mtTlsClose(_tls), _tls_inited = FALSE;
+	}
 	// закрыть состояние (могли забыть)
 	mtMtxLock(_mtx);
 	blobClose(_state), _state = 0, _ctr = 0;
@@ -587,15 +904,93 @@ static void rngDestroy()
 	mtMtxClose(_mtx);
 }
 
+#ifdef OS_UNIX
+
+#include <pthread.h>
+#include <unistd.h>
+
+static u32 rngPid()
+{
+	return (u32)getpid();
+}
+
+static void rngForkPrepare()
+{
+	if (_inited)
+		mtMtxLock(_mtx);
+}
+
+static void rngForkParent()
+{
+	if (_inited)
+		mtMtxUnlock(_mtx);
+}
+
+static void rngForkChild()
+{
+	if (_inited)
+	{
+		_forked = 1;
+		++_epoch;
+		mtMtxUnlock(_mtx);
+	}
+}
+
+static void rngForkInit()
+{
+	pthread_atfork(rngForkPrepare, rngForkParent, rngForkChild);
+}
+
+#else
+
+#define rngPid() 0
+#define rngForkInit()
+
+#endif
+
+static void rngForkReseed()
+{
+	size_t read;
+	u32 pid;
+	tm_ticks_t ticks;
+	ASSERT(_state);
+	// процесс не менялся?
+	pid = rngPid();
+	if (!_forked && pid == _pid)
+		return;
+	// прочитать данные источника sys
+	memSetZero(_state->block, 32);
+	if (rngESRead(&read, _state->block, 32 - 8, "sys") != ERR_OK)
+		read = 0;
+	// добавить идентификатор процесса и показания таймера
+	ticks = tmTicks();
+	u32To(_state->block + 24, 4, &pid);
+	memXor2(_state->block + 28, &ticks, MIN2(4, sizeof(ticks)));
+	// обновить общий генератор
+	brngCTRStepR(_state->block, 32, _state->alg_state);
+	brngCTRStart(_state->alg_state, _state->block, 0);
+	memWipe(_state->block, 32);
+	_forked = 0, _pid = pid;
+	_since = 0, _stamp = tmTicks();
+	mtAtomicIncr(&_epoch);
+	read = 0, pid = 0, ticks = 0;
+}
+
 static void rngInit()
 {
 	ASSERT(!_inited);
 	// создать мьютекс
 	if (!mtMtxCreate(_mtx))
 		return;
+	// создать ключ экземпляров потоков
+	_tls_inited = mtTlsCreate(_tls, rngThrdClose);
+	// отслеживать ветвление процесса
+	rngForkInit();
 	// зарегистрировать деструктор
 	if (!utilOnExit(rngDestroy))
 	{
+		if (_tls_inited)
+			mtTlsClose(_tls), _tls_inited = FALSE;
 		mtMtxClose(_mtx);
 		return;
 	}
@@ -616,7 +1011,10 @@ err_t rngCreate(read_i source, void* source_state)
 	{
 		// учесть дополнительный источник
 		if (source && source(&read, _state->block, 32, source_state) == ERR_OK)
+		{
 			brngCTRStepR(_state->block, 32, _state->alg_state);
+			mtAtomicIncr(&_epoch);
+		}
 		// увеличить счетчик обращений и завершить
 		++_ctr;
 		mtMtxUnlock(_mtx);
@@ -632,7 +1030,8 @@ err_t rngCreate(read_i source, void* source_state)
 	// опрос источников случайности
 	count = 0;
 	beltHashStart(_state->alg_state);
-	for (pos = 0; pos < COUNT_OF(sources); ++pos)
+	for (pos = 0; pos < COUNT_OF(sources) && !(_start_fast && count >= 64);
+		++pos)
 		if (rngESRead(&read, _state->block, 32, sources[pos]) == ERR_OK)
 		{
 			beltHashStepH(_state->block, read, _state->alg_state);
@@ -655,6 +1054,10 @@ err_t rngCreate(read_i source, void* source_state)
 	memWipe(_state->block, 32);
 	// завершить
 	_ctr = 1;
+	_reseeds = _since = 0, _stamp = tmTicks();
+	_forked = 0, _pid = rngPid();
+	_reseed_ticks = (tm_ticks_t)_reseed_ms * (tmFreq() / 1000);
+	mtAtomicIncr(&_epoch);
 	mtMtxUnlock(_mtx);
 	return ERR_OK;
 }
@@ -670,58 +1073,235 @@ void rngClose()
 	if (mtAtomicCmpSwap(&_ctr, 1, 0) > 0)
 	{
 		mtMtxLock(_mtx);
-		(_ctr) ? --_ctr : blobClose(_state), _state = 0;
+		if (_ctr)
+			--_ctr;
+		else
+		{
+			blobClose(_state), _state = 0;
+			mtAtomicIncr(&_epoch);
+			// закрыть экземпляр текущего потока
+			if (_tls_inited)
+				rngThrdClose(mtTlsGet(_tls)), mtTlsSet(_tls, 0);
+		}
 		mtMtxUnlock(_mtx);
 	}
 }
 
 /*
 *******************************************************************************
-Генерация
+Экземпляры потоков
 
-\warning CoverityScan выдает предупреждение по функции rngStepR(): 
-	"Call to RngESRead might sleep while holding lock _mtx"
-с объяснениями: 
-	"The lock will prevent other threads from making progress for 
-	an indefinite period of time; may be mistaken for deadlock. In rngStepR: 
-	A lock is held while waiting for a long running or blocking operation 
-	to complete (CWE-667)".
-Проблема в том, что в источнике timer многократно вызывается функция
-mtSleep(0).
+Функция rngThrdGet() возвращает экземпляр текущего потока, при 
+необходимости создавая его и (или) получая для него ключ от общего 
+генератора. Блокировка _mtx захватывается только при получении ключа.
+Если экземпляр получить не удалось, то возвращается 0 и вызывающая 
+функция использует общий генератор.
 *******************************************************************************
 */
 
-void rngStepR2(void* buf, size_t count, void* state)
+static rng_thrd_st* rngThrdGet()
 {
-	ASSERT(rngIsValid());
+	rng_thrd_st* thrd;
+	if (!_tls_inited)
+		return 0;
+	// экземпляр актуален?
+	thrd = (rng_thrd_st*)mtTlsGet(_tls);
+	if (thrd && thrd->epoch == mtAtomicLoad(&_epoch))
+		return thrd;
+	// создать экземпляр
+	if (!thrd)
+	{
+		thrd = (rng_thrd_st*)blobCreate(rngThrd_keep());
+		if (!thrd)
+			return 0;
+		if (!mtTlsSet(_tls, thrd))
+		{
+			blobClose(thrd);
+			return 0;
+		}
+	}
+	// получить ключ от общего генератора
 	mtMtxLock(_mtx);
-	brngCTRStepR(buf, count, _state->alg_state);
+	if (!_state)
+	{
+		mtMtxUnlock(_mtx);
+		return 0;
+	}
+	rngForkReseed();
+	memSetZero(thrd->block, 32);
+	brngCTRStepR(thrd->block, 32, _state->alg_state);
+	thrd->epoch = _epoch;
 	mtMtxUnlock(_mtx);
+	// запустить brngCTR
+	brngCTRStart(thrd->alg_state, thrd->block, 0);
+	memWipe(thrd->block, 32);
+	thrd->total = thrd->since = 0, thrd->stamp = tmTicks();
+	return thrd;
 }
 
-void rngStepR(void* buf, size_t count, void* state)
+static void rngThrdStepR(void* buf, size_t count, rng_thrd_st* thrd)
+{
+	brngCTRStepR(buf, count, thrd->alg_state);
+	// обновить ключ?
+	thrd->total += count, thrd->since += count;
+	if (thrd->total >= RNG_THRD_REKEY)
+	{
+		memSetZero(thrd->block, 32);
+		brngCTRStepR(thrd->block, 32, thrd->alg_state);
+		brngCTRStart(thrd->alg_state, thrd->block, 0);
+		memWipe(thrd->block, 32);
+		thrd->total = 0;
+	}
+}
+
+/*
+*******************************************************************************
+Обновление энтропии
+
+Функция rngReseedIsDue() проверяет, наступил ли момент опроса источников
+для экземпляра (или общего генератора), который выработал since октетов 
+после получения ключа в момент stamp. При нулевых порогах опрос 
+выполняется при каждом обращении к rngStepR().
+
+Источники опрашиваются без блокировки _mtx до тех пор, пока не будет 
+получено 32 октета. Блокировка захватывается только для обновления 
+состояния общего генератора.
+*******************************************************************************
+*/
+
+static bool_t rngReseedIsDue(size_t since, tm_ticks_t stamp)
+{
+	if (_reseed_bytes == 0 && _reseed_ms == 0)
+		return TRUE;
+	return (_reseed_bytes && since >= _reseed_bytes) ||
+		(_reseed_ticks && tmTicks() - stamp >= _reseed_ticks);
+}
+
+void rngReseed()
 {
 	const char* sources[] = {"trng", "trng2", "sys", "timer"};
-	octet* buf1;
+	octet block[32];
 	size_t read, r, pos;
 	ASSERT(rngIsValid());
-	// блокировать генератор
-	mtMtxLock(_mtx);
 	// опросить источники
-	buf1 = (octet*)buf, read = pos = 0;
-	while (read < count && pos < COUNT_OF(sources))
+	memSetZero(block, 32);
+	read = pos = 0;
+	while (read < 32 && pos < COUNT_OF(sources))
 	{
-		if (rngESRead(&r, buf1, count - read, sources[pos]) != ERR_OK)
+		if (rngESRead(&r, block + read, 32 - read, sources[pos]) != ERR_OK)
 			r = 0;
-		buf1 += r, ++pos, read += r;
+		++pos, read += r;
 	}
-	// генерация
+	// обновить общий генератор
+	mtMtxLock(_mtx);
+	memCopy(_state->block, block, 32);
+	brngCTRStepR(_state->block, 32, _state->alg_state);
+	brngCTRStart(_state->alg_state, _state->block, 0);
+	memWipe(_state->block, 32);
+	++_reseeds, _since = 0, _stamp = tmTicks();
+	mtAtomicIncr(&_epoch);
+	mtMtxUnlock(_mtx);
+	// очистка
+	memWipe(block, 32);
+	read = r = pos = 0;
+}
+
+void rngSetReseedPolicy(size_t bytes, u32 ms)
+{
+	if (_inited)
+		mtMtxLock(_mtx);
+	_reseed_bytes = bytes, _reseed_ms = ms;
+	if (_inited && _ctr)
+		_reseed_ticks = (tm_ticks_t)ms * (tmFreq() / 1000);
+	if (_inited)
+		mtMtxUnlock(_mtx);
+}
+
+void rngSetStartPolicy(bool_t fast)
+{
+	if (_inited)
+		mtMtxLock(_mtx);
+	_start_fast = fast;
+	if (_inited)
+		mtMtxUnlock(_mtx);
+}
+
+size_t rngReseedCount()
+{
+	return mtAtomicLoad(&_reseeds);
+}
+
+/*
+*******************************************************************************
+Генерация
+
+Выходные данные вырабатывает экземпляр текущего потока без блокировки
+_mtx. В rngStepR() перед генерацией проверяется политика обновления 
+энтропии.
+
+Дополнительная буферизация выходных данных (выработка порциями по 
+несколько килобайт с последующим копированием) не используется. 
+Механизм brngCTR уже буферизует данные в пределах блока из 32 октетов, 
+а трудоемкость выработки пропорциональна объему данных: примерно 110 
+тактов на октет как для 32, так и для 4096 октетов (x86-64). Накладные 
+расходы обращения к экземпляру потока (локальная память потока, 
+атомарное чтение эпохи, показания таймера) составляют около 50 тактов.
+*******************************************************************************
+*/
+
+static void rngGen(void* buf, size_t count)
+{
+	rng_thrd_st* thrd;
+	// генерация экземпляром потока
+	thrd = rngThrdGet();
+	if (thrd)
+	{
+		rngThrdStepR(buf, count, thrd);
+		return;
+	}
+	// генерация общим генератором
+	mtMtxLock(_mtx);
+	rngForkReseed();
 	brngCTRStepR(buf, count, _state->alg_state);
-	read = r = pos = 0, buf1 = 0;
-	// снять блокировку
+	_since += count;
 	mtMtxUnlock(_mtx);
 }
 
+void rngStepR2(void* buf, size_t count, void* state)
+{
+	STAT_BEGIN;
+	STAT_API_BEGIN(STAT_API_RNG);
+	ASSERT(rngIsValid());
+	rngGen(buf, count);
+	STAT_API_END(STAT_API_RNG, ERR_OK);
+	STAT_END(STAT_RNG, count);
+}
+
+void rngStepR(void* buf, size_t count, void* state)
+{
+	rng_thrd_st* thrd;
+	bool_t due;
+	STAT_BEGIN;
+	STAT_API_BEGIN(STAT_API_RNG);
+	ASSERT(rngIsValid());
+	// пора опросить источники?
+	thrd = rngThrdGet();
+	if (thrd)
+		due = rngReseedIsDue(thrd->since, thrd->stamp);
+	else
+	{
+		mtMtxLock(_mtx);
+		due = rngReseedIsDue(_since, _stamp);
+		mtMtxUnlock(_mtx);
+	}
+	if (due)
+		rngReseed();
+	// генерация
+	rngGen(buf, count);
+	STAT_API_END(STAT_API_RNG, ERR_OK);
+	STAT_END(STAT_RNG, count);
+}
+
 void rngRekey()
 {
 	ASSERT(rngIsValid());
@@ -732,6 +1312,8 @@ void rngRekey()
 	// пересоздать brngCTR
 	brngCTRStart(_state->alg_state, _state->block, 0);
 	memWipe(_state->block, 32);
+	// сменить эпоху (экземпляры потоков получат новые ключи)
+	mtAtomicIncr(&_epoch);
 	// снять блокировку
 	mtMtxUnlock(_mtx);
 }
@@ -0,0 +1,497 @@
+/*
+*******************************************************************************
+\file stat.c
+\brief Instrumentation counters
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/stat.h"
+#include "bee2/core/util.h"
+#include "core/stat_lcl.h"
+
+/*
+*******************************************************************************
+Имена семейств
+*******************************************************************************
+*/
+
+static const char* const _names[STAT_MAX] =
+{
+	"belt-block", "bash-f", "ec-mula", "ec-addmula", "zz-powermod", "rng",
+};
+
+const char* statName(size_t family)
+{
+	return family < STAT_MAX ? _names[family] : 0;
+}
+
+static const char* const _api_names[STAT_API_MAX] =
+{
+	"bign-sign", "bign-verify", "bign-dh",
+	"bign-ctx-sign", "bign-ctx-verify", "bign-ctx-dh",
+	"bake-bmqv-step2", "bake-bmqv-step3", "bake-bmqv-step4",
+	"bake-bmqv-step5",
+	"bake-bsts-step2", "bake-bsts-step3", "bake-bsts-step4",
+	"bake-bsts-step5",
+	"bake-bpace-step2", "bake-bpace-step3", "bake-bpace-step4",
+	"bake-bpace-step5", "bake-bpace-step6",
+	"btok-bauth-step2", "btok-bauth-step3", "btok-bauth-step4",
+	"btok-bauth-step5",
+	"rng",
+};
+
+const char* statApiName(size_t api)
+{
+	return api < STAT_API_MAX ? _api_names[api] : 0;
+}
+
+/*
+*******************************************************************************
+Корзины гистограмм
+
+Задержка t < STAT_HIST_SUB попадает в корзину t. Задержка
+t \in [2^e, 2^{e + 1}), e >= 2, попадает в корзину 4(e - 1) + m, где
+m -- два старших бита t после ведущей единицы. Граница корзины 4(e - 1) + m
+равна (4 + m) 2^{e - 2}. Задержки от 2^33 попадают в последнюю корзину.
+*******************************************************************************
+*/
+
+#if (STAT_HIST_SUB != 4 || STAT_HIST_MAX != 128)
+	#error "Unsupported histogram layout"
+#endif
+
+size_t statHistBucket(tm_ticks_t ticks)
+{
+	tm_ticks_t t;
+	size_t e;
+	if (ticks < STAT_HIST_SUB)
+		return (size_t)ticks;
+	for (t = ticks, e = 0; t > 1; t >>= 1, ++e);
+	if (e >= 33)
+		return STAT_HIST_MAX - 1;
+	return 4 * (e - 1) + (size_t)(ticks >> (e - 2) & 3);
+}
+
+tm_ticks_t statHistBound(size_t bucket)
+{
+	size_t e;
+	ASSERT(bucket < STAT_HIST_MAX);
+	if (bucket < STAT_HIST_SUB)
+		return (tm_ticks_t)bucket;
+	// граница не помещается в tm_ticks_t?
+	e = bucket / 4 + 1;
+	if (e >= 8 * sizeof(tm_ticks_t))
+		return (tm_ticks_t)-1;
+	return (tm_ticks_t)(4 + bucket % 4) << (e - 2);
+}
+
+tm_ticks_t statHistQuantile(const stat_hist_t* hist, size_t permille)
+{
+	size_t bucket;
+	size_t sum;
+	ASSERT(memIsValid(hist, sizeof(stat_hist_t)));
+	ASSERT(permille <= 1000);
+	if (hist->calls == 0)
+		return 0;
+	for (bucket = sum = 0; bucket < STAT_HIST_MAX; ++bucket)
+	{
+		sum += hist->buckets[bucket];
+		if (sum * 1000 >= hist->calls * permille && sum)
+			return statHistBound(bucket);
+	}
+	return statHistBound(STAT_HIST_MAX - 1);
+}
+
+/*
+*******************************************************************************
+Точки трассировки
+*******************************************************************************
+*/
+
+#if defined(TRACE_ENABLED) && defined(OS_WIN)
+
+#include <TraceLoggingProvider.h>
+
+/* {bde4674f-b37c-405e-ab11-72357768bd14} */
+TRACELOGGING_DEFINE_PROVIDER(_provider, "Bee2",
+	(0xbde4674f, 0xb37c, 0x405e,
+	0xab, 0x11, 0x72, 0x35, 0x77, 0x68, 0xbd, 0x14));
+
+static size_t _trace_once;	/*< триггер однократности */
+
+static void statTraceDestroy()
+{
+	TraceLoggingUnregister(_provider);
+}
+
+static void statTraceInit()
+{
+	if (TraceLoggingRegister(_provider) == 0 &&
+		!utilOnExit(statTraceDestroy))
+		TraceLoggingUnregister(_provider);
+}
+
+void statTraceEntry(size_t api)
+{
+	ASSERT(api < STAT_API_MAX);
+	if (mtAtomicLoad(&_trace_once) != 1)
+		mtCallOnce(&_trace_once, statTraceInit);
+	TraceLoggingWrite(_provider, "ApiEntry",
+		TraceLoggingUInt32((UINT32)api, "api"),
+		TraceLoggingString(_api_names[api], "name"));
+}
+
+void statTraceReturn(size_t api, err_t code)
+{
+	ASSERT(api < STAT_API_MAX);
+	TraceLoggingWrite(_provider, "ApiReturn",
+		TraceLoggingUInt32((UINT32)api, "api"),
+		TraceLoggingString(_api_names[api], "name"),
+		TraceLoggingUInt32((UINT32)code, "code"));
+}
+
+#elif defined(TRACE_ENABLED)
+
+#include <sys/sdt.h>
+
+void statTraceEntry(size_t api)
+{
+	ASSERT(api < STAT_API_MAX);
+	DTRACE_PROBE2(bee2, api__entry, api, _api_names[api]);
+}
+
+void statTraceReturn(size_t api, err_t code)
+{
+	ASSERT(api < STAT_API_MAX);
+	DTRACE_PROBE3(bee2, api__return, api, _api_names[api], code);
+}
+
+#endif
+
+bool_t statTraceIsEnabled()
+{
+#ifdef TRACE_ENABLED
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+#ifdef STAT_ENABLED
+
+/*
+*******************************************************************************
+Экземпляры потоков
+
+Каждый поток при первом обращении к statAdd() создает экземпляр счетчиков
+и включает его в список _head. При завершении потока (деструктор ключа
+_tls) счетчики экземпляра переносятся в _retired, а экземпляр исключается
+из списка. Список, _retired и точки отсчета base, mem_base, live_base
+защищены мьютексом _mtx. Остальные поля изменяет только поток-владелец.
+
+Экземпляры размещаются не в блобах, а в памяти memAlloc(), поскольку
+операции с блобами сами учитываются (см. statAlloc()).
+
+Пиковый объем используемой памяти peak относится к эпохе epoch. При сбросе
+эпоха _epoch увеличивается, и поток-владелец при очередном выделении
+памяти начинает отсчет peak заново. Поэтому сброс не изменяет поля,
+которые принадлежат потоку-владельцу.
+*******************************************************************************
+*/
+
+typedef struct stat_thrd_st
+{
+	stat_ctr_t ctrs[STAT_MAX];		/*< счетчики */
+	stat_ctr_t base[STAT_MAX];		/*< точка отсчета */
+	stat_mem_t mem[1];				/*< счетчики памяти */
+	stat_mem_t mem_base[1];			/*< точка отсчета счетчиков памяти */
+	size_t live;					/*< объем используемой памяти */
+	size_t live_base;				/*< точка отсчета live */
+	size_t epoch;					/*< эпоха peak */
+	struct stat_thrd_st* prev;		/*< предыдущий экземпляр */
+	struct stat_thrd_st* next;		/*< следующий экземпляр */
+} stat_thrd_st;
+
+static size_t _once;				/*< триггер однократности */
+static mt_mtx_t _mtx[1];			/*< мьютекс */
+static bool_t _inited;				/*< мьютекс и ключ созданы? */
+static mt_tls_t _tls[1];			/*< ключ экземпляров потоков */
+static stat_thrd_st* _head;			/*< список экземпляров */
+static stat_ctr_t _retired[STAT_MAX];	/*< счетчики завершенных потоков */
+static size_t _epoch;				/*< эпоха сброса */
+static size_t _hist[STAT_API_MAX][STAT_HIST_MAX];	/*< гистограммы */
+static size_t _hist_errors[STAT_API_MAX];	/*< число ошибок */
+
+static void statCtrAdd(stat_ctr_t* dest, const stat_ctr_t* ctr,
+	const stat_ctr_t* base)
+{
+	dest->calls += ctr->calls - base->calls;
+	dest->bytes += ctr->bytes - base->bytes;
+	dest->ticks += ctr->ticks - base->ticks;
+}
+
+static void MT_CALLBACK statThrdClose(void* ptr)
+{
+	stat_thrd_st* thrd = (stat_thrd_st*)ptr;
+	size_t i;
+	if (!thrd)
+		return;
+	mtMtxLock(_mtx);
+	for (i = 0; i < STAT_MAX; ++i)
+		statCtrAdd(_retired + i, thrd->ctrs + i, thrd->base + i);
+	if (thrd->prev)
+		thrd->prev->next = thrd->next;
+	else
+		_head = thrd->next;
+	if (thrd->next)
+		thrd->next->prev = thrd->prev;
+	mtMtxUnlock(_mtx);
+	memFree(thrd);
+}
+
+static void statDestroy()
+{
+	// закрыть экземпляр текущего потока
+	statThrdClose(mtTlsGet(_tls)), mtTlsSet(_tls, 0);
+	mtTlsClose(_tls);
+	_inited = FALSE;
+	// закрыть мьютекс
+	mtMtxClose(_mtx);
+}
+
+static void statInit()
+{
+	ASSERT(!_inited);
+	if (!mtMtxCreate(_mtx))
+		return;
+	if (!mtTlsCreate(_tls, statThrdClose))
+	{
+		mtMtxClose(_mtx);
+		return;
+	}
+	if (!utilOnExit(statDestroy))
+	{
+		mtTlsClose(_tls);
+		mtMtxClose(_mtx);
+		return;
+	}
+	_inited = TRUE;
+}
+
+static stat_thrd_st* statThrdGet()
+{
+	stat_thrd_st* thrd;
+	mtCallOnce(&_once, statInit);
+	if (!_inited)
+		return 0;
+	thrd = (stat_thrd_st*)mtTlsGet(_tls);
+	if (thrd)
+		return thrd;
+	// создать экземпляр
+	thrd = (stat_thrd_st*)memAlloc(sizeof(stat_thrd_st));
+	if (!thrd)
+		return 0;
+	memSetZero(thrd, sizeof(stat_thrd_st));
+	if (!mtTlsSet(_tls, thrd))
+	{
+		memFree(thrd);
+		return 0;
+	}
+	// включить в список
+	mtMtxLock(_mtx);
+	thrd->epoch = _epoch;
+	thrd->next = _head;
+	if (_head)
+		_head->prev = thrd;
+	_head = thrd;
+	mtMtxUnlock(_mtx);
+	return thrd;
+}
+
+/*
+*******************************************************************************
+Учет и снимки
+
+Функции statAlloc() и statFree() вызываются из blob.c, в том числе при
+инициализации модуля (utilOnExit() расширяет блоб). Чтобы не войти
+повторно в mtCallOnce(), эти функции не инициализируют модуль, а
+пропускают учет до завершения инициализации.
+*******************************************************************************
+*/
+
+void statAdd(size_t family, size_t bytes, tm_ticks_t ticks)
+{
+	stat_thrd_st* thrd;
+	ASSERT(family < STAT_MAX);
+	if ((thrd = statThrdGet()) != 0)
+	{
+		++thrd->ctrs[family].calls;
+		thrd->ctrs[family].bytes += bytes;
+		thrd->ctrs[family].ticks += ticks;
+	}
+}
+
+void statAlloc(size_t size)
+{
+	stat_thrd_st* thrd;
+	size_t epoch;
+	if (mtAtomicLoad(&_once) != 1 || !(thrd = statThrdGet()))
+		return;
+	// новая эпоха?
+	epoch = mtAtomicLoad(&_epoch);
+	if (thrd->epoch != epoch)
+		thrd->epoch = epoch, thrd->mem->peak = thrd->live;
+	// учесть выделение
+	++thrd->mem->allocs;
+	thrd->mem->bytes += size;
+	thrd->live += size;
+	if (thrd->mem->peak < thrd->live)
+		thrd->mem->peak = thrd->live;
+}
+
+void statFree(size_t size)
+{
+	stat_thrd_st* thrd;
+	if (mtAtomicLoad(&_once) != 1 || !(thrd = statThrdGet()))
+		return;
+	++thrd->mem->frees;
+	thrd->live -= MIN2(thrd->live, size);
+}
+
+void statApiAdd(size_t api, err_t code, tm_ticks_t ticks)
+{
+	ASSERT(api < STAT_API_MAX);
+	mtAtomicIncr(_hist[api] + statHistBucket(ticks));
+	if (code != ERR_OK)
+		mtAtomicIncr(_hist_errors + api);
+}
+
+bool_t statIsEnabled()
+{
+	return TRUE;
+}
+
+void statGet(stat_ctr_t ctrs[STAT_MAX])
+{
+	stat_thrd_st* thrd;
+	size_t i;
+	memSetZero(ctrs, sizeof(stat_ctr_t) * STAT_MAX);
+	mtCallOnce(&_once, statInit);
+	if (!_inited)
+		return;
+	mtMtxLock(_mtx);
+	memCopy(ctrs, _retired, sizeof(_retired));
+	for (thrd = _head; thrd; thrd = thrd->next)
+		for (i = 0; i < STAT_MAX; ++i)
+			statCtrAdd(ctrs + i, thrd->ctrs + i, thrd->base + i);
+	mtMtxUnlock(_mtx);
+}
+
+void statGetThread(stat_ctr_t ctrs[STAT_MAX])
+{
+	stat_thrd_st* thrd;
+	size_t i;
+	memSetZero(ctrs, sizeof(stat_ctr_t) * STAT_MAX);
+	if (!(thrd = statThrdGet()))
+		return;
+	mtMtxLock(_mtx);
+	for (i = 0; i < STAT_MAX; ++i)
+		statCtrAdd(ctrs + i, thrd->ctrs + i, thrd->base + i);
+	mtMtxUnlock(_mtx);
+}
+
+void statGetMem(stat_mem_t* mem)
+{
+	stat_thrd_st* thrd;
+	size_t peak;
+	memSetZero(mem, sizeof(stat_mem_t));
+	if (!(thrd = statThrdGet()))
+		return;
+	mtMtxLock(_mtx);
+	mem->allocs = thrd->mem->allocs - thrd->mem_base->allocs;
+	mem->frees = thrd->mem->frees - thrd->mem_base->frees;
+	mem->bytes = thrd->mem->bytes - thrd->mem_base->bytes;
+	peak = thrd->epoch == _epoch ? thrd->mem->peak : thrd->live;
+	mem->peak = peak > thrd->live_base ? peak - thrd->live_base : 0;
+	mtMtxUnlock(_mtx);
+}
+
+void statReset()
+{
+	stat_thrd_st* thrd;
+	size_t api, i;
+	// сбросить гистограммы
+	for (api = 0; api < STAT_API_MAX; ++api)
+	{
+		for (i = 0; i < STAT_HIST_MAX; ++i)
+			mtAtomicStore(_hist[api] + i, 0);
+		mtAtomicStore(_hist_errors + api, 0);
+	}
+	// сбросить счетчики
+	mtCallOnce(&_once, statInit);
+	if (!_inited)
+		return;
+	mtMtxLock(_mtx);
+	memSetZero(_retired, sizeof(_retired));
+	for (thrd = _head; thrd; thrd = thrd->next)
+	{
+		memCopy(thrd->base, thrd->ctrs, sizeof(thrd->ctrs));
+		memCopy(thrd->mem_base, thrd->mem, sizeof(stat_mem_t));
+		thrd->live_base = thrd->live;
+	}
+	mtAtomicIncr(&_epoch);
+	mtMtxUnlock(_mtx);
+}
+
+void statHistGet(stat_hist_t* hist, size_t api)
+{
+	size_t i;
+	ASSERT(memIsValid(hist, sizeof(stat_hist_t)));
+	ASSERT(api < STAT_API_MAX);
+	hist->calls = 0;
+	for (i = 0; i < STAT_HIST_MAX; ++i)
+		hist->calls += hist->buckets[i] = mtAtomicLoad(_hist[api] + i);
+	hist->errors = mtAtomicLoad(_hist_errors + api);
+}
+
+#else
+
+bool_t statIsEnabled()
+{
+	return FALSE;
+}
+
+void statGet(stat_ctr_t ctrs[STAT_MAX])
+{
+	memSetZero(ctrs, sizeof(stat_ctr_t) * STAT_MAX);
+}
+
+void statGetThread(stat_ctr_t ctrs[STAT_MAX])
+{
+	memSetZero(ctrs, sizeof(stat_ctr_t) * STAT_MAX);
+}
+
+void statGetMem(stat_mem_t* mem)
+{
+	memSetZero(mem, sizeof(stat_mem_t));
+}
+
+void statReset()
+{
+}
+
+void statHistGet(stat_hist_t* hist, size_t api)
+{
+	ASSERT(memIsValid(hist, sizeof(stat_hist_t)));
+	ASSERT(api < STAT_API_MAX);
+	memSetZero(hist, sizeof(stat_hist_t));
+}
+
+#endif
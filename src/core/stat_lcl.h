@@ -0,0 +1,122 @@
+/*
+*******************************************************************************
+\file stat_lcl.h
+\brief Instrumentation counters: local definitions
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifndef __BEE2_STAT_LCL_H
+#define __BEE2_STAT_LCL_H
+
+#include "bee2/core/stat.h"
+#include "bee2/core/tm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*******************************************************************************
+Точки учета
+
+Макрос STAT_BEGIN объявляет переменную с начальными показаниями таймера
+и должен следовать за последним объявлением функции. Макрос
+STAT_END(family, bytes) учитывает обращение к семейству family, при
+котором обработано bytes октетов, и должен предшествовать каждому выходу
+из функции.
+
+Макросы STAT_ALLOC(size) и STAT_FREE(size) учитывают выделение
+и освобождение size октетов памяти блобов.
+
+Без директивы STAT_ENABLED макросы раскрываются в пустые инструкции.
+*******************************************************************************
+*/
+
+#ifdef STAT_ENABLED
+
+void statAdd(size_t family, size_t bytes, tm_ticks_t ticks);
+void statAlloc(size_t size);
+void statFree(size_t size);
+
+#define STAT_BEGIN\
+	tm_ticks_t stat_start = tmTicks()
+
+#define STAT_END(family, bytes)\
+	statAdd(family, bytes, tmTicks() - stat_start)
+
+#define STAT_ALLOC(size) statAlloc(size)
+#define STAT_FREE(size) statFree(size)
+
+#else
+
+#define STAT_BEGIN
+#define STAT_END(family, bytes)
+#define STAT_ALLOC(size)
+#define STAT_FREE(size)
+
+#endif
+
+/*
+*******************************************************************************
+Точки API
+
+Макрос STAT_API_BEGIN(api) отмечает вход в функцию API api и должен
+следовать за последним объявлением функции. Макрос STAT_API_END(api, code)
+отмечает выход из функции с кодом возврата code и должен предшествовать
+каждому выходу из функции. Функции API с несколькими выходами
+оформляются как обертки над статическими функциями-исполнителями.
+
+В режиме STAT_ENABLED задержка учитывается в гистограмме api, в режиме
+TRACE_ENABLED срабатывают точки трассировки. Без этих директив макросы
+раскрываются в пустые инструкции.
+*******************************************************************************
+*/
+
+#ifdef STAT_ENABLED
+	void statApiAdd(size_t api, err_t code, tm_ticks_t ticks);
+#endif
+
+#ifdef TRACE_ENABLED
+	void statTraceEntry(size_t api);
+	void statTraceReturn(size_t api, err_t code);
+#endif
+
+#if defined(STAT_ENABLED) && defined(TRACE_ENABLED)
+
+#define STAT_API_BEGIN(api)\
+	tm_ticks_t stat_api_start = (statTraceEntry(api), tmTicks())
+
+#define STAT_API_END(api, code)\
+	statApiAdd(api, code, tmTicks() - stat_api_start),\
+	statTraceReturn(api, code)
+
+#elif defined(STAT_ENABLED)
+
+#define STAT_API_BEGIN(api)\
+	tm_ticks_t stat_api_start = tmTicks()
+
+#define STAT_API_END(api, code)\
+	statApiAdd(api, code, tmTicks() - stat_api_start)
+
+#elif defined(TRACE_ENABLED)
+
+#define STAT_API_BEGIN(api) statTraceEntry(api)
+#define STAT_API_END(api, code) statTraceReturn(api, code)
+
+#else
+
+#define STAT_API_BEGIN(api)
+#define STAT_API_END(api, code)
+
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_STAT_LCL_H */
@@ -4,7 +4,7 @@
 \brief Utilities
 \project bee2 [cryptographic library]
 \created 2012.05.10
-\version 2021.05.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -18,8 +18,23 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/mem.h"
 #include "bee2/core/mt.h"
+#include "bee2/core/rng.h"
+#include "bee2/core/stat.h"
+#include "bee2/core/str.h"
 #include "bee2/core/tm.h"
 #include "bee2/core/util.h"
+#include "bee2/crypto/bash.h"
+#include "bee2/crypto/belt.h"
+#include "bee2/math/zm.h"
+#include "crypto/belt/belt_lcl.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#include <cpuid.h>
+	#define UTIL_CPUID
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(OS_LINUX)
+	#include <sys/auxv.h>
+	#define UTIL_AUXV
+#endif
 
 /*
 *******************************************************************************
@@ -32,6 +47,166 @@ const char* utilVersion()
 	return BEE2_VERSION;
 }
 
+/*
+*******************************************************************************
+Платформа
+
+Описание платформы строится однократно, при первом обращении
+к utilPlatform(). Возможности процессора определяются с помощью cpuid
+(x86, x86-64) или getauxval() (AArch64, Linux). Поддержка регистров
+AVX и AVX512 операционной системой проверяется с помощью xgetbv.
+Источники энтропии считаются доступными, если из них удалось прочитать
+8 октетов.
+*******************************************************************************
+*/
+
+static size_t _platform_once;		/*< триггер однократности */
+static char _platform[512];			/*< описание платформы */
+
+static void utilPlatformAdd(const char* str)
+{
+	size_t len = strLen(_platform);
+	if (len + strLen(str) < sizeof(_platform))
+		strCopy(_platform + len, str);
+}
+
+static void utilPlatformItem(const char* item)
+{
+	size_t len = strLen(_platform);
+	if (len && _platform[len - 1] != '=')
+		utilPlatformAdd(",");
+	utilPlatformAdd(item);
+}
+
+static void utilPlatformCPU()
+{
+#if defined(UTIL_CPUID)
+	unsigned info[4];
+	unsigned lo = 0, hi = 0;
+	bool_t ymm = FALSE, zmm = FALSE;
+	if (!__get_cpuid(1, info, info + 1, info + 2, info + 3))
+		return;
+	if (info[3] & 0x04000000)
+		utilPlatformItem("sse2");
+	if (info[2] & 0x00000200)
+		utilPlatformItem("ssse3");
+	if (info[2] & 0x00080000)
+		utilPlatformItem("sse4.1");
+	if (info[2] & 0x00000002)
+		utilPlatformItem("pclmul");
+	if (info[2] & 0x02000000)
+		utilPlatformItem("aes");
+	if (info[2] & 0x40000000)
+		utilPlatformItem("rdrand");
+	// OSXSAVE и AVX?
+	if ((info[2] & 0x18000000) == 0x18000000)
+	{
+		__asm__ volatile("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+		ymm = (lo & 0x06) == 0x06, zmm = (lo & 0xE6) == 0xE6;
+		if (ymm)
+			utilPlatformItem("avx");
+	}
+	if (__get_cpuid_max(0, 0) < 7)
+		return;
+	__cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+	if (ymm && (info[1] & 0x00000020))
+		utilPlatformItem("avx2");
+	if (zmm && (info[1] & 0x00010000))
+		utilPlatformItem("avx512f");
+	if (zmm && (info[1] & 0x40000000))
+		utilPlatformItem("avx512bw");
+	if (zmm && (info[2] & 0x00000002))
+		utilPlatformItem("avx512vbmi");
+	if (info[1] & 0x00040000)
+		utilPlatformItem("rdseed");
+#elif defined(UTIL_AUXV)
+	if (getauxval(AT_HWCAP) & (1 << 1))
+		utilPlatformItem("neon");
+	if (getauxval(AT_HWCAP) & (1 << 4))
+		utilPlatformItem("pmull");
+	if (getauxval(AT_HWCAP) & (1 << 22))
+		utilPlatformItem("sve");
+	if (getauxval(AT_HWCAP2) & (1 << 1))
+		utilPlatformItem("sve2");
+#endif
+}
+
+static void utilPlatformZm()
+{
+	const size_t bits[] = {256, 384, 512};
+	char item[16];
+	size_t pos;
+	for (pos = 0; pos < COUNT_OF(bits); ++pos)
+	{
+		item[0] = (char)('0' + bits[pos] / 100);
+		item[1] = (char)('0' + bits[pos] / 10 % 10);
+		item[2] = (char)('0' + bits[pos] % 10);
+		item[3] = ':', item[4] = '\0';
+		strCopy(item + 4, zmRedName(zmTuned(bits[pos] / B_PER_W, TRUE)));
+		utilPlatformItem(item);
+	}
+}
+
+static void utilPlatformBuild()
+{
+	const char* sources[] = {"trng", "trng2", "sys", "timer"};
+	octet buf[8];
+	size_t read;
+	size_t pos;
+	// версия и сборка
+	utilPlatformAdd("version=");
+	utilPlatformAdd(utilVersion());
+#if (B_PER_W == 16)
+	utilPlatformAdd(" word=16");
+#elif (B_PER_W == 32)
+	utilPlatformAdd(" word=32");
+#else
+	utilPlatformAdd(" word=64");
+#endif
+#ifdef SAFE_FAST
+	utilPlatformAdd(" safe=FAST");
+#else
+	utilPlatformAdd(" safe=SAFE");
+#endif
+	utilPlatformAdd(statIsEnabled() ? " stat=ON" : " stat=OFF");
+	utilPlatformAdd(statTraceIsEnabled() ? " trace=ON" : " trace=OFF");
+#ifdef LEAN_ENABLED
+	utilPlatformAdd(" lean=ON");
+#else
+	utilPlatformAdd(" lean=OFF");
+#endif
+	// реализации
+	utilPlatformAdd(" bash=");
+	utilPlatformAdd(bashPlatform());
+#ifdef BASH_DISPATCH
+	utilPlatformAdd(" bash-dispatch=ON");
+#else
+	utilPlatformAdd(" bash-dispatch=OFF");
+#endif
+	utilPlatformAdd(" belt=");
+	utilPlatformAdd(beltPlatform());
+	utilPlatformAdd(beltBlockWideIsAvail() ? " belt-wide=AVX512" :
+		" belt-wide=OFF");
+	utilPlatformAdd(" zm=");
+	utilPlatformZm();
+	// возможности процессора
+	utilPlatformAdd(" cpu=");
+	utilPlatformCPU();
+	// источники энтропии
+	utilPlatformAdd(" rng=");
+	for (pos = 0; pos < COUNT_OF(sources); ++pos)
+		if (rngESRead(&read, buf, sizeof(buf), sources[pos]) == ERR_OK &&
+			read == sizeof(buf))
+			utilPlatformItem(sources[pos]);
+	memWipe(buf, sizeof(buf));
+}
+
+const char* utilPlatform()
+{
+	mtCallOnce(&_platform_once, utilPlatformBuild);
+	return _platform;
+}
+
 /*
 *******************************************************************************
 Деструкторы
@@ -221,11 +396,280 @@ static const u32 crc32_table[] = {
 	0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
 };
 
+/*
+*******************************************************************************
+CRC32: slicing-by-8
+
+Таблица crc32_tables[k] описывает сдвиг байта на k дополнительных
+октетов: crc32_tables[k][x] = crc32_tables[0][crc32_tables[k - 1][x] & 0xFF] ^
+(crc32_tables[k - 1][x] >> 8), crc32_tables[0] = crc32_table. За один шаг
+обрабатываются 8 октетов: 8 независимых обращений к таблицам вместо
+цепочки из 8 зависимых обращений. Таблицы рассчитываются однократно,
+при первом обращении к utilCRC32().
+
+Октеты собираются в слова явно, поэтому реализация не зависит от
+порядка октетов платформы и выравнивания buf.
+*******************************************************************************
+*/
+
+static u32 crc32_tables[8][256];
+
+static void utilCRC32Tables()
+{
+	size_t x, k;
+	for (x = 0; x < 256; ++x)
+		crc32_tables[0][x] = crc32_table[x];
+	for (k = 1; k < 8; ++k)
+		for (x = 0; x < 256; ++x)
+			crc32_tables[k][x] = crc32_table[crc32_tables[k - 1][x] & 0xFF] ^
+				crc32_tables[k - 1][x] >> 8;
+}
+
+static u32 utilCRC32Slice(const octet* octets, size_t count, u32 state)
+{
+	for (; count >= 8; count -= 8, octets += 8)
+	{
+		u32 lo = state ^ ((u32)octets[0] | (u32)octets[1] << 8 |
+			(u32)octets[2] << 16 | (u32)octets[3] << 24);
+		u32 hi = (u32)octets[4] | (u32)octets[5] << 8 |
+			(u32)octets[6] << 16 | (u32)octets[7] << 24;
+		state = crc32_tables[7][lo & 0xFF] ^
+			crc32_tables[6][lo >> 8 & 0xFF] ^
+			crc32_tables[5][lo >> 16 & 0xFF] ^
+			crc32_tables[4][lo >> 24] ^
+			crc32_tables[3][hi & 0xFF] ^
+			crc32_tables[2][hi >> 8 & 0xFF] ^
+			crc32_tables[1][hi >> 16 & 0xFF] ^
+			crc32_tables[0][hi >> 24];
+	}
+	while (count--)
+		state = crc32_table[(state ^ *octets++) & 0xFF] ^ (state >> 8);
+	return state;
+}
+
+/*
+*******************************************************************************
+CRC32: свертка с помощью умножения многочленов
+
+При сборке компиляторами GCC и Clang на платформе x86-64 дополнительно
+реализован расчет CRC32 с помощью инструкции PCLMULQDQ, на платформе
+AArch64 (Linux) -- с помощью инструкции PMULL. Инструкция crc32 SSE4.2
+не подходит: в ней используется многочлен Castagnoli, а не многочлен
+ISO 3309 (IEEE 802.3).
+
+Алгоритм -- свертка (folding) из работы
+	Gopal V. et al. Fast CRC Computation for Generic Polynomials Using
+	PCLMULQDQ Instruction. Intel, 2009.
+Данные обрабатываются 128-битовыми блоками в четырех независимых
+накопителях. На каждом шаге половины накопителя умножаются на константы
+k1, k2 (вычеты степеней x по модулю P, см. статью), и к результату
+прибавляется очередной блок. Затем накопители сворачиваются в один
+(константы k3, k4), к нему присоединяются оставшиеся полные блоки,
+результат сворачивается до 64 битов (константа k5) и приводится
+по модулю P с помощью редукции Барретта (P и mu = floor(x^64 / P)).
+Константы представлены в отраженном порядке битов.
+
+Свертка применяется к префиксу buf длины, кратной 16, если длина
+не меньше 64. Остаток обрабатывается slicing-by-8. Реализация
+выбирается при первом обращении к utilCRC32() по результатам cpuid
+или getauxval().
+*******************************************************************************
+*/
+
+#if defined(__GNUC__) && (defined(__x86_64__) ||\
+	defined(__aarch64__) && defined(OS_LINUX))
+
+static const u64 crc32_k1k2[2] = { 0x0154442BD4ull, 0x01C6E41596ull };
+static const u64 crc32_k3k4[2] = { 0x01751997D0ull, 0x00CCAA009Eull };
+static const u64 crc32_k5k0[2] = { 0x0163CD6124ull, 0 };
+static const u64 crc32_poly[2] = { 0x01DB710641ull, 0x01F7011641ull };
+
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#define UTIL_CRC32_CL
+#define UTIL_CLMUL __attribute__((target("pclmul,sse2")))
+
+UTIL_CLMUL static inline __m128i utilCRC32Fold(__m128i x, __m128i k,
+	__m128i y)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+		_mm_clmulepi64_si128(x, k, 0x11)), y);
+}
+
+UTIL_CLMUL static u32 utilCRC32CL(const octet* octets, size_t count,
+	u32 state)
+{
+	const __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);
+	__m128i x0, x1, x2, x3, x4;
+	ASSERT(count >= 64 && count % 16 == 0);
+	// загрузить 4 блока
+	x1 = _mm_loadu_si128((const __m128i*)octets);
+	x2 = _mm_loadu_si128((const __m128i*)(octets + 16));
+	x3 = _mm_loadu_si128((const __m128i*)(octets + 32));
+	x4 = _mm_loadu_si128((const __m128i*)(octets + 48));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)state));
+	// свертка четверками блоков
+	x0 = _mm_loadu_si128((const __m128i*)crc32_k1k2);
+	for (octets += 64, count -= 64; count >= 64; octets += 64, count -= 64)
+	{
+		x1 = utilCRC32Fold(x1, x0, _mm_loadu_si128((const __m128i*)octets));
+		x2 = utilCRC32Fold(x2, x0,
+			_mm_loadu_si128((const __m128i*)(octets + 16)));
+		x3 = utilCRC32Fold(x3, x0,
+			_mm_loadu_si128((const __m128i*)(octets + 32)));
+		x4 = utilCRC32Fold(x4, x0,
+			_mm_loadu_si128((const __m128i*)(octets + 48)));
+	}
+	// свертка в один накопитель
+	x0 = _mm_loadu_si128((const __m128i*)crc32_k3k4);
+	x1 = utilCRC32Fold(x1, x0, x2);
+	x1 = utilCRC32Fold(x1, x0, x3);
+	x1 = utilCRC32Fold(x1, x0, x4);
+	// оставшиеся блоки
+	for (; count; octets += 16, count -= 16)
+		x1 = utilCRC32Fold(x1, x0, _mm_loadu_si128((const __m128i*)octets));
+	// 128 -> 64 бита
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x0 = _mm_loadu_si128((const __m128i*)crc32_k5k0);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	// редукция Барретта
+	x0 = _mm_loadu_si128((const __m128i*)crc32_poly);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	return (u32)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+
+static bool_t utilCRC32HasCL()
+{
+	unsigned info[4];
+	// PCLMULQDQ и SSE2?
+	return __get_cpuid(1, info, info + 1, info + 2, info + 3) &&
+		(info[2] & 0x00000002) && (info[3] & 0x04000000);
+}
+
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(OS_LINUX)
+
+#include <arm_neon.h>
+
+#define UTIL_CRC32_CL
+#define UTIL_CLMUL __attribute__((target("+crypto")))
+
+UTIL_CLMUL static inline uint64x2_t utilClMulLo(uint64x2_t a, uint64x2_t b)
+{
+	return vreinterpretq_u64_p128(vmull_p64(
+		(poly64_t)vgetq_lane_u64(a, 0), (poly64_t)vgetq_lane_u64(b, 0)));
+}
+
+UTIL_CLMUL static inline uint64x2_t utilClMulHi(uint64x2_t a, uint64x2_t b)
+{
+	return vreinterpretq_u64_p128(vmull_high_p64(
+		vreinterpretq_p64_u64(a), vreinterpretq_p64_u64(b)));
+}
+
+UTIL_CLMUL static inline uint64x2_t utilCRC32Fold(uint64x2_t x,
+	uint64x2_t k, uint64x2_t y)
+{
+	return veorq_u64(veorq_u64(utilClMulLo(x, k), utilClMulHi(x, k)), y);
+}
+
+#define utilShr(x, bytes)\
+	vreinterpretq_u64_u8(vextq_u8(vreinterpretq_u8_u64(x), vdupq_n_u8(0),\
+		bytes))
+
+UTIL_CLMUL static u32 utilCRC32CL(const octet* octets, size_t count,
+	u32 state)
+{
+	const uint64x2_t mask = vdupq_n_u64(0xFFFFFFFF);
+	uint64x2_t x0, x1, x2, x3, x4;
+	ASSERT(count >= 64 && count % 16 == 0);
+	// загрузить 4 блока
+	x1 = vreinterpretq_u64_u8(vld1q_u8(octets));
+	x2 = vreinterpretq_u64_u8(vld1q_u8(octets + 16));
+	x3 = vreinterpretq_u64_u8(vld1q_u8(octets + 32));
+	x4 = vreinterpretq_u64_u8(vld1q_u8(octets + 48));
+	x1 = veorq_u64(x1, vsetq_lane_u64((u64)state, vdupq_n_u64(0), 0));
+	// свертка четверками блоков
+	x0 = vld1q_u64(crc32_k1k2);
+	for (octets += 64, count -= 64; count >= 64; octets += 64, count -= 64)
+	{
+		x1 = utilCRC32Fold(x1, x0, vreinterpretq_u64_u8(vld1q_u8(octets)));
+		x2 = utilCRC32Fold(x2, x0,
+			vreinterpretq_u64_u8(vld1q_u8(octets + 16)));
+		x3 = utilCRC32Fold(x3, x0,
+			vreinterpretq_u64_u8(vld1q_u8(octets + 32)));
+		x4 = utilCRC32Fold(x4, x0,
+			vreinterpretq_u64_u8(vld1q_u8(octets + 48)));
+	}
+	// свертка в один накопитель
+	x0 = vld1q_u64(crc32_k3k4);
+	x1 = utilCRC32Fold(x1, x0, x2);
+	x1 = utilCRC32Fold(x1, x0, x3);
+	x1 = utilCRC32Fold(x1, x0, x4);
+	// оставшиеся блоки
+	for (; count; octets += 16, count -= 16)
+		x1 = utilCRC32Fold(x1, x0, vreinterpretq_u64_u8(vld1q_u8(octets)));
+	// 128 -> 64 бита
+	x2 = utilClMulLo(x1, vextq_u64(x0, x0, 1));
+	x1 = veorq_u64(utilShr(x1, 8), x2);
+	x0 = vld1q_u64(crc32_k5k0);
+	x2 = utilShr(x1, 4);
+	x1 = utilClMulLo(vandq_u64(x1, mask), x0);
+	x1 = veorq_u64(x1, x2);
+	// редукция Барретта
+	x0 = vld1q_u64(crc32_poly);
+	x2 = utilClMulLo(vandq_u64(x1, mask), vextq_u64(x0, x0, 1));
+	x2 = utilClMulLo(vandq_u64(x2, mask), x0);
+	x1 = veorq_u64(x1, x2);
+	return vgetq_lane_u32(vreinterpretq_u32_u64(x1), 1);
+}
+
+static bool_t utilCRC32HasCL()
+{
+	// HWCAP_PMULL
+	return (getauxval(AT_HWCAP) & (1 << 4)) != 0;
+}
+
+#endif
+
+/*
+*******************************************************************************
+CRC32: выбор реализации
+*******************************************************************************
+*/
+
+static size_t _crc32_once;
+static bool_t _crc32_cl;
+
+static void utilCRC32Select()
+{
+	utilCRC32Tables();
+#if defined(UTIL_CRC32_CL)
+	_crc32_cl = utilCRC32HasCL();
+#endif
+}
+
 u32 utilCRC32(const void* buf, size_t count, u32 state)
 {
 	const octet* octets = (const octet*)buf;
-	for (state ^= 0xFFFFFFFF; count--; )
-		state = crc32_table[(state ^ *octets++) & 0xFF] ^ (state >> 8);
+	mtCallOnce(&_crc32_once, utilCRC32Select);
+	state ^= 0xFFFFFFFF;
+#if defined(UTIL_CRC32_CL)
+	if (_crc32_cl && count >= 64)
+	{
+		state = utilCRC32CL(octets, count & ~(size_t)15, state);
+		octets += count & ~(size_t)15, count &= 15;
+	}
+#endif
+	state = utilCRC32Slice(octets, count, state);
 	return state ^ 0xFFFFFFFF;
 }
 
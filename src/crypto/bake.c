@@ -4,7 +4,7 @@
 \brief STB 34.101.66 (bake): authenticated key establishment (AKE) protocols
 \project bee2 [cryptographic library]
 \created 2014.04.14
-\version 2022.11.10
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,6 +13,7 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/obj.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/bake.h"
@@ -22,6 +23,7 @@
 #include "bee2/math/ecp.h"
 #include "bee2/math/ww.h"
 #include "bee2/math/zz.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -70,6 +72,54 @@ err_t bakeKDF(octet key[32], const octet secret[], size_t secret_len,
 	return ERR_OK;
 }
 
+err_t bakeKDFMulti(octet key[], const octet secret[], size_t secret_len,
+	const octet iv[], size_t iv_len, size_t num, size_t n)
+{
+	const size_t batch = 64;
+	void* state;
+	octet* y;
+	octet* block;
+	size_t i, j;
+	// проверить входные данные
+	if (!memIsValid(secret, secret_len) ||
+		!memIsValid(iv, iv_len) ||
+		!memIsValid(key, 32 * n))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(utilMax(2, beltHash_keep(), beltKRP_keep()) +
+		32 + 16 * batch);
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	y = (octet*)state + utilMax(2, beltHash_keep(), beltKRP_keep());
+	block = y + 32;
+	// y <- beltHash(secret || iv)
+	beltHashStart(state);
+	beltHashStepH(secret, secret_len, state);
+	beltHashStepH(iv, iv_len, state);
+	beltHashStepG(y, state);
+	// key_i <- beltKRP(y, 1^96, num + i)
+	memSet(block, 0xFF, 12);
+	beltKRPStart(state, y, 32, block);
+	CASSERT(B_PER_S <= 128);
+	for (i = 0; i < n; i += batch)
+	{
+		size_t m = MIN2(batch, n - i);
+		memSetZero(block, 16 * m);
+		for (j = 0; j < m; ++j)
+		{
+			size_t t = num + i + j;
+			memCopy(block + 16 * j, &t, sizeof(size_t));
+#if (OCTET_ORDER == BIG_ENDIAN)
+			memRev(block + 16 * j, sizeof(size_t));
+#endif
+		}
+		beltKRPStepGMulti(key + 32 * i, 32, block, m, state);
+	}
+	// завершить
+	blobClose(state);
+	return ERR_OK;
+}
+
 /*
 *******************************************************************************
 Алгоритм bakeSWU
@@ -141,6 +191,249 @@ err_t bakeSWU(octet pt[], const bign_params* params, const octet msg[])
 	return ERR_OK;
 }
 
+/*
+*******************************************************************************
+Одноразовые ключи
+
+Функция bakeEph() определяет одноразовый личный ключ u и, если V != 0,
+точку V = u G. Если в настройках задан поставщик eph, то u и V
+получаются от него и проверяются: u -- на принадлежность {1,..., q - 1},
+V -- на принадлежность кривой. Иначе u вырабатывается с помощью rng,
+а V вычисляется.
+*******************************************************************************
+*/
+
+static err_t bakeEph(word u[], word V[], const ec_o* ec,
+	const bake_settings* settings, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t no = ec->f->no;
+	err_t code;
+	// стек
+	octet* uo;		/* [no] */
+	octet* Vo;		/* [2 * no] */
+	// выработать u и V
+	if (settings->eph == 0)
+	{
+		if (!zzRandNZMod(u, ec->order, n, settings->rng, settings->rng_state))
+			return ERR_BAD_RNG;
+		if (V && !ecMulA(V, ec->base, ec, u, n, stack))
+			return ERR_BAD_PARAMS;
+		return ERR_OK;
+	}
+	// раскладка стека
+	uo = (octet*)stack;
+	Vo = uo + no;
+	stack = Vo + 2 * no;
+	// получить u и V от поставщика
+	code = settings->eph(uo, Vo, settings->eph_state);
+	if (code == ERR_OK)
+	{
+		wwFrom(u, uo, no);
+		if (wwIsZero(u, n) || wwCmp(u, ec->order, n) >= 0)
+			code = ERR_BAD_RNG;
+		else if (V && (!qrFrom(ecX(V), Vo, ec->f, stack) ||
+			!qrFrom(ecY(V, n), Vo + no, ec->f, stack) ||
+			!ecpIsOnA(V, ec, stack)))
+			code = ERR_BAD_POINT;
+	}
+	memWipe(uo, no);
+	return code;
+}
+
+static size_t bakeEph_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(3 * n) +
+		utilMax(3,
+			f_deep,
+			ecpIsOnA_deep(n, f_deep),
+			ecMulA_deep(n, ec_d, ec_deep, n));
+}
+
+/*
+*******************************************************************************
+Кэш предвычислений BMQV
+
+В протоколе BMQV на шагах 3 и 4 долговременный открытый ключ Q
+противоположной стороны умножается на открытую кратность 2^l + t.
+Если одни и те же ключи встречаются многократно (например, шлюз
+обслуживает фиксированное множество клиентов), то для Q выгодно
+построить таблицу гребенчатого метода (ecCombPrecA()) и затем
+использовать ecCombMulA(). Таблицы хранятся в кэше.
+
+Кэш содержит _cache_max ячеек прямого отображения. Ячейка выбирается по
+ключу beltHash(params || Q), где Q -- точка во внутреннем представлении.
+При первом обращении к ключу в ячейку записывается только ключ, таблица
+не строится: ключи, которые встречаются однократно, не замедляют протокол.
+При повторном обращении таблица строится и сохраняется, при последующих --
+копируется из кэша в стек и используется. Ячейка с другим ключом
+перезаписывается.
+
+Кэш защищен мьютексом _cache_mtx. Таблица строится без блокировки,
+после чего сохраняется, если ячейка за это время не была перезаписана.
+*******************************************************************************
+*/
+
+#ifdef LEAN_ENABLED
+	#define BAKE_BMQV_COMB_W 4
+#else
+	#define BAKE_BMQV_COMB_W 5
+#endif
+
+typedef struct
+{
+	octet key[32];				/*< ключ ячейки */
+	size_t state;				/*< 0 -- пусто, 1 -- ключ, 2 -- таблица */
+	word pre[];					/*< [W_OF_B(512) << BAKE_BMQV_COMB_W] */
+} bake_bmqv_slot_st;
+
+static size_t _cache_once;				/*< триггер однократности */
+static mt_mtx_t _cache_mtx[1];			/*< мьютекс */
+static bool_t _cache_inited;			/*< мьютекс создан? */
+static octet* _cache;					/*< ячейки */
+static size_t _cache_max;				/*< число ячеек */
+
+static size_t bakeBMQVSlot_keep()
+{
+	return sizeof(bake_bmqv_slot_st) +
+		O_OF_W(W_OF_B(512) << BAKE_BMQV_COMB_W);
+}
+
+static void bakeBMQVCacheDestroy()
+{
+	blobClose(_cache), _cache = 0;
+	_cache_max = 0;
+	mtMtxClose(_cache_mtx);
+	_cache_inited = FALSE;
+}
+
+static void bakeBMQVCacheInit()
+{
+	ASSERT(!_cache_inited);
+	if (!mtMtxCreate(_cache_mtx))
+		return;
+	if (!utilOnExit(bakeBMQVCacheDestroy))
+	{
+		mtMtxClose(_cache_mtx);
+		return;
+	}
+	_cache_inited = TRUE;
+}
+
+bool_t bakeBMQVCacheSetMax(size_t max)
+{
+	octet* cache = 0;
+	// входной контроль
+	if (max > BAKE_BMQV_CACHE_MAX)
+		return FALSE;
+	// инициализировать однократно
+	if (!mtCallOnce(&_cache_once, bakeBMQVCacheInit) || !_cache_inited)
+		return FALSE;
+	// выделить память (blobCreate() обнуляет ячейки)
+	if (max)
+	{
+		cache = (octet*)blobCreate(max * bakeBMQVSlot_keep());
+		if (!cache)
+			return FALSE;
+	}
+	// заменить кэш
+	mtMtxLock(_cache_mtx);
+	blobClose(_cache);
+	_cache = cache;
+	mtAtomicStore(&_cache_max, max);
+	mtMtxUnlock(_cache_mtx);
+	return TRUE;
+}
+
+void bakeBMQVCacheFlush()
+{
+	if (!mtAtomicLoad(&_cache_max))
+		return;
+	mtMtxLock(_cache_mtx);
+	memWipe(_cache, _cache_max * bakeBMQVSlot_keep());
+	mtMtxUnlock(_cache_mtx);
+}
+
+/*
+*******************************************************************************
+Умножение с кэшем
+
+Функция bakeBMQVMulA() определяет b <- d a так же, как ecMulA(), но
+при включенном кэше использует таблицу предвычислений для a.
+*******************************************************************************
+*/
+
+static bool_t bakeBMQVMulA(word b[], const word a[], const bign_params* params,
+	const ec_o* ec, const word d[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	bake_bmqv_slot_st* slot;
+	size_t pos, state;
+	// переменные в stack
+	octet* key;		/* [32] */
+	word* pre;		/* [n << BAKE_BMQV_COMB_W] */
+	// кэш отключен?
+	if (!mtAtomicLoad(&_cache_max))
+		return ecMulA(b, a, ec, d, m, stack);
+	// раскладка stack
+	key = (octet*)stack;
+	pre = (word*)(key + 32);
+	stack = pre + (n << BAKE_BMQV_COMB_W);
+	// key <- beltHash(params || a)
+	beltHashStart(stack);
+	beltHashStepH(params, sizeof(bign_params), stack);
+	beltHashStepH(a, O_OF_W(2 * n), stack);
+	beltHashStepG(key, stack);
+	memCopy(&pos, key, sizeof(size_t));
+	// найти ячейку
+	mtMtxLock(_cache_mtx);
+	if (!_cache_max)
+	{
+		mtMtxUnlock(_cache_mtx);
+		return ecMulA(b, a, ec, d, m, stack);
+	}
+	slot = (bake_bmqv_slot_st*)(_cache + pos % _cache_max *
+		bakeBMQVSlot_keep());
+	state = memEq(slot->key, key, 32) ? slot->state : 0;
+	if (state == 2)
+		wwCopy(pre, slot->pre, n << BAKE_BMQV_COMB_W);
+	else if (state == 0)
+		memCopy(slot->key, key, 32), slot->state = 1;
+	mtMtxUnlock(_cache_mtx);
+	// первое обращение?
+	if (state == 0)
+		return ecMulA(b, a, ec, d, m, stack);
+	// построить таблицу
+	if (state == 1)
+	{
+		if (!ecCombPrecA(pre, a, ec, BAKE_BMQV_COMB_W, stack))
+			return ecMulA(b, a, ec, d, m, stack);
+		mtMtxLock(_cache_mtx);
+		if (_cache_max && slot == (bake_bmqv_slot_st*)(_cache +
+				pos % _cache_max * bakeBMQVSlot_keep()) &&
+			memEq(slot->key, key, 32))
+		{
+			wwCopy(slot->pre, pre, n << BAKE_BMQV_COMB_W);
+			slot->state = 2;
+		}
+		mtMtxUnlock(_cache_mtx);
+	}
+	// умножить по таблице
+	return ecCombMulA(b, pre, ec, BAKE_BMQV_COMB_W, d, m, stack);
+}
+
+static size_t bakeBMQVMulA_deep(size_t n, size_t ec_d, size_t ec_deep,
+	size_t m)
+{
+	return 32 + O_OF_W(n << BAKE_BMQV_COMB_W) +
+		utilMax(4,
+			beltHash_keep(),
+			ecMulA_deep(n, ec_d, ec_deep, m),
+			ecCombPrecA_deep(n, ec_d, ec_deep),
+			ecCombMulA_deep(n, ec_d, ec_deep, BAKE_BMQV_COMB_W));
+}
+
 /*
 *******************************************************************************
 Шаги протокола BMQV
@@ -250,8 +543,9 @@ static size_t bakeBMQVStart_deep(size_t n, size_t f_deep, size_t ec_d,
 			ecpIsOnA_deep(n, f_deep));
 }
 
-err_t bakeBMQVStep2(octet out[], void* state)
+static err_t bakeBMQVStep2Body(octet out[], void* state)
 {
+	err_t code;
 	bake_bmqv_o* s = (bake_bmqv_o*)state;
 	size_t n, no;
 	// стек
@@ -267,13 +561,9 @@ err_t bakeBMQVStep2(octet out[], void* state)
 	// раскладка стека
 	Vb = objEnd(s, word);
 	stack = Vb + 2 * n;
-	// ub <-R {1, 2, ..., q - 1}
-	if (!zzRandNZMod(s->u, s->ec->order, n, s->settings->rng,
-		s->settings->rng_state))
-		return ERR_BAD_RNG;
-	// Vb <- ub G
-	if (!ecMulA(Vb, s->ec->base, s->ec, s->u, n, stack))
-		return ERR_BAD_PARAMS;
+	// ub <-R {1, 2, ..., q - 1}, Vb <- ub G
+	code = bakeEph(s->u, Vb, s->ec, s->settings, stack);
+	ERR_CALL_CHECK(code);
 	// out <- <Vb>
 	qrTo(out, ecX(Vb), s->ec->f, stack);
 	qrTo(out + no, ecY(Vb, n), s->ec->f, stack);
@@ -283,17 +573,26 @@ err_t bakeBMQVStep2(octet out[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBMQVStep2(octet out[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BMQV2);
+	code = bakeBMQVStep2Body(out, state);
+	STAT_API_END(STAT_API_BAKE_BMQV2, code);
+	return code;
+}
+
 static size_t bakeBMQVStep2_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(2 * n) +
 		utilMax(2,
 			f_deep,
-			ecMulA_deep(n, ec_d, ec_deep, n));
+			bakeEph_deep(n, f_deep, ec_d, ec_deep));
 }
 
-err_t bakeBMQVStep3(octet out[], const octet in[], const bake_cert* certb,
-	void* state)
+static err_t bakeBMQVStep3Body(octet out[], const octet in[],
+	const bake_cert* certb, void* state)
 {
 	err_t code;
 	bake_bmqv_o* s = (bake_bmqv_o*)state;
@@ -343,13 +642,9 @@ err_t bakeBMQVStep3(octet out[], const octet in[], const bake_cert* certb,
 		!qrFrom(ecY(Vb, n), in + no, s->ec->f, stack) ||
 		!ecpIsOnA(Vb, s->ec, stack))
 		return ERR_BAD_POINT;
-	// ua <-R {1, 2, ..., q - 1}
-	if (!zzRandNZMod(s->u, s->ec->order, n, s->settings->rng,
-		s->settings->rng_state))
-		return ERR_BAD_RNG;
-	// Va <- ua G
-	if (!ecMulA(Va, s->ec->base, s->ec, s->u, n, stack))
-		return ERR_BAD_PARAMS;
+	// ua <-R {1, 2, ..., q - 1}, Va <- ua G
+	code = bakeEph(s->u, Va, s->ec, s->settings, stack);
+	ERR_CALL_CHECK(code);
 	qrTo((octet*)Va, ecX(Va), s->ec->f, stack);
 	qrTo((octet*)Va + no, ecY(Va, n), s->ec->f, stack);
 	// t <- <beltHash(<Va>_2l || <Vb>_2l)>_l
@@ -363,11 +658,11 @@ err_t bakeBMQVStep3(octet out[], const octet in[], const bake_cert* certb,
 	// sa <- (ua - (2^l + t)da) \mod q
 	zzMul(sa, t, n / 2, s->d, n, stack);
 	sa[n + n / 2] = zzAdd2(sa + n / 2, s->d, n);
-	zzMod(sa, sa, n + n / 2 + 1, s->ec->order, n, stack);
+	ecModOrder(sa, sa, n + n / 2 + 1, s->ec, stack);
 	zzSubMod(sa, s->u, sa, s->ec->order, n);
 	// K <- sa(Vb - (2^l + t)Qb), K == O => K <- G
 	t[n / 2] = 1;
-	if (!ecMulA(Qb, Qb, s->ec, t, n / 2 + 1, stack))
+	if (!bakeBMQVMulA(Qb, Qb, s->params, s->ec, t, n / 2 + 1, stack))
 		return ERR_BAD_PARAMS;
 	if (!ecpSubAA(Vb, Vb, Qb, s->ec, stack))
 		qrTo(K, s->ec->base, s->ec->f, stack);
@@ -410,24 +705,35 @@ err_t bakeBMQVStep3(octet out[], const octet in[], const bake_cert* certb,
 	return ERR_OK;
 }
 
+err_t bakeBMQVStep3(octet out[], const octet in[], const bake_cert* certb,
+	void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BMQV3);
+	code = bakeBMQVStep3Body(out, in, certb, state);
+	STAT_API_END(STAT_API_BAKE_BMQV3, code);
+	return code;
+}
+
 static size_t bakeBMQVStep3_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(8 * n + 2) +
-		utilMax(9,
+		utilMax(10,
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			bakeEph_deep(n, f_deep, ec_d, ec_deep),
+			bakeBMQVMulA_deep(n, ec_d, ec_deep, n / 2 + 1),
 			beltHash_keep(),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n),
+			ecModOrder_deep(n),
 			ecpSubAA_deep(n, f_deep),
 			beltKRP_keep(),
 			beltMAC_keep());
 }
 
-err_t bakeBMQVStep4(octet out[], const octet in[], const bake_cert* certa,
-	void* state)
+static err_t bakeBMQVStep4Body(octet out[], const octet in[],
+	const bake_cert* certa, void* state)
 {
 	err_t code;
 	bake_bmqv_o* s = (bake_bmqv_o*)state;
@@ -483,11 +789,11 @@ err_t bakeBMQVStep4(octet out[], const octet in[], const bake_cert* certa,
 	// sb <- (ub - (2^l + t)db) \mod q
 	zzMul(sb, t, n / 2, s->d, n, stack);
 	sb[n + n / 2] = zzAdd2(sb + n / 2, s->d, n);
-	zzMod(sb, sb, n + n / 2 + 1, s->ec->order, n, stack);
+	ecModOrder(sb, sb, n + n / 2 + 1, s->ec, stack);
 	zzSubMod(sb, s->u, sb, s->ec->order, n);
 	// K <- sb(Va - (2^l + t)Qa), K == O => K <- G
 	t[n / 2] = 1;
-	if (!ecMulA(Qa, Qa, s->ec, t, n / 2 + 1, stack))
+	if (!bakeBMQVMulA(Qa, Qa, s->params, s->ec, t, n / 2 + 1, stack))
 		return ERR_BAD_PARAMS;
 	if (!ecpSubAA(Va, Va, Qa, s->ec, stack))
 		qrTo(K, s->ec->base, s->ec->f, stack);
@@ -538,23 +844,34 @@ err_t bakeBMQVStep4(octet out[], const octet in[], const bake_cert* certa,
 	return ERR_OK;
 }
 
+err_t bakeBMQVStep4(octet out[], const octet in[], const bake_cert* certa,
+	void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BMQV4);
+	code = bakeBMQVStep4Body(out, in, certa, state);
+	STAT_API_END(STAT_API_BAKE_BMQV4, code);
+	return code;
+}
+
 static size_t bakeBMQVStep4_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(6 * n + 2) +
-		utilMax(9,
+		utilMax(10,
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
 			ecMulA_deep(n, ec_d, ec_deep, n),
+			bakeBMQVMulA_deep(n, ec_d, ec_deep, n / 2 + 1),
 			beltHash_keep(),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n),
+			ecModOrder_deep(n),
 			ecpSubAA_deep(n, f_deep),
 			beltKRP_keep(),
 			beltMAC_keep());
 }
 
-err_t bakeBMQVStep5(const octet in[8], void* state)
+static err_t bakeBMQVStep5Body(const octet in[8], void* state)
 {
 	bake_bmqv_o* s = (bake_bmqv_o*)state;
 	// стек
@@ -580,6 +897,15 @@ err_t bakeBMQVStep5(const octet in[8], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBMQVStep5(const octet in[8], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BMQV5);
+	code = bakeBMQVStep5Body(in, state);
+	STAT_API_END(STAT_API_BAKE_BMQV5, code);
+	return code;
+}
+
 static size_t bakeBMQVStep5_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -819,8 +1145,9 @@ static size_t bakeBSTSStart_deep(size_t n, size_t f_deep, size_t ec_d,
 			ecpIsOnA_deep(n, f_deep));
 }
 
-err_t bakeBSTSStep2(octet out[], void* state)
+static err_t bakeBSTSStep2Body(octet out[], void* state)
 {
+	err_t code;
 	bake_bsts_o* s = (bake_bsts_o*)state;
 	size_t n, no;
 	// стек
@@ -833,13 +1160,9 @@ err_t bakeBSTSStep2(octet out[], void* state)
 		return ERR_BAD_INPUT;
 	// раскладка стека
 	stack = objEnd(s, void);
-	// ub <-R {1, 2, ..., q - 1}
-	if (!zzRandNZMod(s->u, s->ec->order, n, s->settings->rng,
-		s->settings->rng_state))
-		return ERR_BAD_RNG;
-	// Vb <- ub G
-	if (!ecMulA(s->Vb, s->ec->base, s->ec, s->u, n, stack))
-		return ERR_BAD_PARAMS;
+	// ub <-R {1, 2, ..., q - 1}, Vb <- ub G
+	code = bakeEph(s->u, s->Vb, s->ec, s->settings, stack);
+	ERR_CALL_CHECK(code);
 	// out <- <Vb>
 	qrTo(out, ecX(s->Vb), s->ec->f, stack);
 	qrTo(out + no, ecY(s->Vb, n), s->ec->f, stack);
@@ -847,26 +1170,71 @@ err_t bakeBSTSStep2(octet out[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBSTSStep2(octet out[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BSTS2);
+	code = bakeBSTSStep2Body(out, state);
+	STAT_API_END(STAT_API_BAKE_BSTS2, code);
+	return code;
+}
+
 static size_t bakeBSTSStep2_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return utilMax(2,
 			f_deep,
-			ecMulA_deep(n, ec_d, ec_deep, n));
+			bakeEph_deep(n, f_deep, ec_d, ec_deep));
 }
 
-err_t bakeBSTSStep3(octet out[], const octet in[], void* state)
+/*
+*******************************************************************************
+Шаг 3 BSTS выполняется в три этапа. Функция bakeBSTSStep3Pre() проверяет
+входные данные, вырабатывает и перекодирует ua. Затем определяются кратные
+точки Va = ua G и W = ua Vb. Функция bakeBSTSStep3Post() завершает шаг.
+Кратные точки и перекодированный ключ ua размещаются в стеке состояния
+(раскладка задается функцией bakeBSTSStep3Layout()). Этапы разделены для
+пакетной обработки (см. bakeBSTSStep3Batch()).
+
+Если задан поставщик одноразовых ключей, то точка Va получается от него
+на этапе Pre и на этапе Mul не вычисляется. При пакетной обработке Va
+вычисляется повторно вместе с W (результат совпадает).
+*******************************************************************************
+*/
+
+typedef struct
 {
-	bake_bsts_o* s = (bake_bsts_o*)state;
-	size_t n, no;
-	// стек
 	word* Va;			/* [2 * n] */
+	word* W;			/* [2 * n] */
 	word* t;			/* [n / 2 + 1] */
 	word* sa;			/* [n + n / 2 + 1] */
-	octet* K;			/* [no] (совпадает с Va) */
+	octet* K;			/* [no] (совпадает с W) */
 	octet* block0;		/* [16] (следует за sa) */
 	octet* block1;		/* [16] (следует за block0) */
+	octet* ua;			/* [ecRecode_keep(n)] (следует за block1) */
 	void* stack;
+} bake_bsts_step3_st;
+
+static void bakeBSTSStep3Layout(bake_bsts_step3_st* l, bake_bsts_o* s)
+{
+	const size_t n = s->ec->f->n;
+	l->Va = objEnd(s, word);
+	l->W = l->Va + 2 * n;
+	l->t = l->W + 2 * n;
+	l->sa = l->t + n / 2 + 1;
+	l->K = (octet*)l->W;
+	l->block0 = (octet*)(l->sa + n + n / 2 + 1);
+	l->block1 = l->block0 + 16;
+	l->ua = l->block1 + 16;
+	l->stack = l->ua + O_OF_W(W_OF_O(ecRecode_keep(n)));
+}
+
+static err_t bakeBSTSStep3Pre(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	bake_bsts_o* s = (bake_bsts_o*)state;
+	bake_bsts_step3_st l[1];
+	size_t n, no;
 	// проверить входные данные
 	if (!objIsOperable(s))
 		return ERR_BAD_INPUT;
@@ -876,98 +1244,301 @@ err_t bakeBSTSStep3(octet out[], const octet in[], void* state)
 		return ERR_BAD_INPUT;
 	ASSERT(memIsDisjoint2(out, 3 * no + s->cert->len + 8, s, objKeep(s)));
 	// раскладка стека
-	Va = objEnd(s, word);
-	t = Va + 2 * n;
-	sa = t + n / 2 + 1;
-	K = (octet*)Va;
-	block0 = (octet*)(sa + n + n / 2 + 1);
-	block1 = block0 + 16;
-	stack = block1 + 16;
+	bakeBSTSStep3Layout(l, s);
 	// Vb <- in, Vb \in E*?
-	if (!qrFrom(ecX(s->Vb), in, s->ec->f, stack) ||
-		!qrFrom(ecY(s->Vb, n), in + no, s->ec->f, stack) ||
-		!ecpIsOnA(s->Vb, s->ec, stack))
+	if (!qrFrom(ecX(s->Vb), in, s->ec->f, l->stack) ||
+		!qrFrom(ecY(s->Vb, n), in + no, s->ec->f, l->stack) ||
+		!ecpIsOnA(s->Vb, s->ec, l->stack))
 		return ERR_BAD_POINT;
-	// ua <-R {1, 2, ..., q - 1}
-	if (!zzRandNZMod(s->u, s->ec->order, n, s->settings->rng,
-		s->settings->rng_state))
-		return ERR_BAD_RNG;
-	// Va <- ua G
-	if (!ecMulA(Va, s->ec->base, s->ec, s->u, n, stack))
-		return ERR_BAD_PARAMS;
-	qrTo((octet*)Va, ecX(Va), s->ec->f, stack);
-	qrTo((octet*)Va + no, ecY(Va, n), s->ec->f, stack);
+	// ua <-R {1, 2, ..., q - 1} (Va <- ua G, если задан поставщик)
+	code = bakeEph(s->u, s->settings->eph ? l->Va : 0, s->ec, s->settings,
+		l->stack);
+	ERR_CALL_CHECK(code);
+	// ua перекодируется один раз для двух умножений
+	ecRecode(l->ua, s->u, n, l->stack);
+	return ERR_OK;
+}
+
+static err_t bakeBSTSStep3Post(octet out[], const octet in[], void* state)
+{
+	bake_bsts_o* s = (bake_bsts_o*)state;
+	bake_bsts_step3_st l[1];
+	size_t n, no;
+	// раскладка стека
+	n = s->ec->f->n, no = s->ec->f->no;
+	bakeBSTSStep3Layout(l, s);
+	memSetZero(l->ua, ecRecode_keep(n));
+	// Va <- <Va>_4l
+	qrTo((octet*)l->Va, ecX(l->Va), s->ec->f, l->stack);
+	qrTo((octet*)l->Va + no, ecY(l->Va, n), s->ec->f, l->stack);
 	// t <- <beltHash(<Va>_2l || <Vb>_2l)>_l
-	beltHashStart(stack);
-	beltHashStepH(Va, no, stack);
-	beltHashStepH(in, no, stack);
-	beltHashStepG2((octet*)t, no / 2, stack);
-	wwFrom(t, t, no / 2);
+	beltHashStart(l->stack);
+	beltHashStepH(l->Va, no, l->stack);
+	beltHashStepH(in, no, l->stack);
+	beltHashStepG2((octet*)l->t, no / 2, l->stack);
+	wwFrom(l->t, l->t, no / 2);
 	// out ||.. <- <Va>_4l
-	memCopy(out, Va, 2 * no);
+	memCopy(out, l->Va, 2 * no);
 	// sa <- (ua - (2^l + t)da) \mod q
-	zzMul(sa, t, n / 2, s->d, n, stack);
-	sa[n + n / 2] = zzAdd2(sa + n / 2, s->d, n);
-	zzMod(sa, sa, n + n / 2 + 1, s->ec->order, n, stack);
-	zzSubMod(sa, s->u, sa, s->ec->order, n);
+	zzMul(l->sa, l->t, n / 2, s->d, n, l->stack);
+	l->sa[n + n / 2] = zzAdd2(l->sa + n / 2, s->d, n);
+	ecModOrder(l->sa, l->sa, n + n / 2 + 1, s->ec, l->stack);
+	zzSubMod(l->sa, s->u, l->sa, s->ec->order, n);
 	// ..|| out ||.. <- sa || certa
-	wwTo(out + 2 * no, no, sa);
+	wwTo(out + 2 * no, no, l->sa);
 	memCopy(out + 3 * no, s->cert->data, s->cert->len);
 	// K <- beltHash(<ua Vb>_2l || helloa || hellob)
-	if (!ecMulA(Va, s->Vb, s->ec, s->u, n, stack))
-		return ERR_BAD_PARAMS;
-	qrTo(K, ecX(Va), s->ec->f, stack);
-	beltHashStart(stack);
-	beltHashStepH(K, no, stack);
+	qrTo(l->K, ecX(l->W), s->ec->f, l->stack);
+	beltHashStart(l->stack);
+	beltHashStepH(l->K, no, l->stack);
 	if (s->settings->helloa)
-		beltHashStepH(s->settings->helloa, s->settings->helloa_len, stack);
+		beltHashStepH(s->settings->helloa, s->settings->helloa_len,
+			l->stack);
 	if (s->settings->hellob)
-		beltHashStepH(s->settings->hellob, s->settings->hellob_len, stack);
-	beltHashStepG(K, stack);
+		beltHashStepH(s->settings->hellob, s->settings->hellob_len,
+			l->stack);
+	beltHashStepG(l->K, l->stack);
 	// K0 <- beltKRP(K, 1^96, 0)
-	memSetZero(block0, 16);
-	memSet(block1, 0xFF, 16);
-	beltKRPStart(stack, K, 32, block1);
-	beltKRPStepG(s->K0, 32, block0, stack);
+	memSetZero(l->block0, 16);
+	memSet(l->block1, 0xFF, 16);
+	beltKRPStart(l->stack, l->K, 32, l->block1);
+	beltKRPStepG(s->K0, 32, l->block0, l->stack);
 	// K1 <- beltKRP(K, 1^96, 1)
-	block0[0] = 1;
-	beltKRPStepG(s->K1, 32, block0, stack);
+	l->block0[0] = 1;
+	beltKRPStepG(s->K1, 32, l->block0, l->stack);
 	// K2 <- beltKRP(K, 1^96, 2)
-	block0[0] = 2;
-	beltKRPStepG(s->K2, 32, block0, stack);
+	l->block0[0] = 2;
+	beltKRPStepG(s->K2, 32, l->block0, l->stack);
 	// ..|| out ||.. <- beltCFBEncr(sa || certa)
-	block0[0] = 0;
-	beltCFBStart(stack, s->K2, 32, block0);
-	beltCFBStepE(out + 2 * no, no + s->cert->len, stack);
+	l->block0[0] = 0;
+	beltCFBStart(l->stack, s->K2, 32, l->block0);
+	beltCFBStepE(out + 2 * no, no + s->cert->len, l->stack);
 	// ..|| out <- beltMAC(beltCFBEncr(sa || certa) || 0^128)
-	beltMACStart(stack, s->K1, 32);
-	beltMACStepA(out + 2 * no, no + s->cert->len, stack);
-	beltMACStepA(block0, 16, stack);
-	beltMACStepG(out + 3 * no + s->cert->len, stack);
+	beltMACStart(l->stack, s->K1, 32);
+	beltMACStepA(out + 2 * no, no + s->cert->len, l->stack);
+	beltMACStepA(l->block0, 16, l->stack);
+	beltMACStepG(out + 3 * no + s->cert->len, l->stack);
 	// сохранить t
-	wwCopy(s->t, t, n / 2);
+	wwCopy(s->t, l->t, n / 2);
 	s->t[n / 2] = 1;
 	// все нормально
 	return ERR_OK;
 }
 
+static err_t bakeBSTSStep3Mul(void* state)
+{
+	bake_bsts_o* s = (bake_bsts_o*)state;
+	bake_bsts_step3_st l[1];
+	bakeBSTSStep3Layout(l, s);
+	// Va <- ua G (если не получена от поставщика), W <- ua Vb
+	if (!s->settings->eph && !ecMulARec(l->Va, s->ec->base, s->ec, l->ua,
+			s->ec->f->n, l->stack) ||
+		!ecMulARec(l->W, s->Vb, s->ec, l->ua, s->ec->f->n, l->stack))
+	{
+		memSetZero(l->ua, ecRecode_keep(s->ec->f->n));
+		return ERR_BAD_PARAMS;
+	}
+	return ERR_OK;
+}
+
+static err_t bakeBSTSStep3Body(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	code = bakeBSTSStep3Pre(out, in, state);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStep3Mul(state);
+	ERR_CALL_CHECK(code);
+	return bakeBSTSStep3Post(out, in, state);
+}
+
+err_t bakeBSTSStep3(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BSTS3);
+	code = bakeBSTSStep3Body(out, in, state);
+	STAT_API_END(STAT_API_BAKE_BSTS3, code);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетный шаг 3 BSTS
+
+Состояния, которые прошли подготовку и имеют те же долговременные
+параметры, что и первое из них, обрабатываются одним пакетом: 2k кратных
+точек (ua_i G, ua_i Vb_i) определяются вызовом ecMulARecBatch(). Остальные
+состояния, а также все состояния пакета, если в нем получена бесконечно
+удаленная точка, обрабатываются по отдельности. Пакет размещается
+в стеке, который готовит вызывающая программа.
+*******************************************************************************
+*/
+
+static bool_t bakeBSTSStep3MulBatch(void* states[], const err_t codes[],
+	size_t count, const bake_bsts_o* s0, size_t k, void* stack)
+{
+	const size_t n = s0->ec->f->n;
+	const size_t keep = ecRecode_keep(n);
+	bake_bsts_step3_st l[1];
+	size_t i, j;
+	word* a;			/* [2 * k * 2 * n] */
+	word* b;			/* [2 * k * 2 * n] */
+	octet* rec;			/* [2 * k * keep] */
+	// раскладка стека
+	a = (word*)stack;
+	b = a + 4 * k * n;
+	rec = (octet*)(b + 4 * k * n);
+	stack = rec + 2 * k * keep;
+	// собрать пакет
+	for (i = j = 0; i < count; ++i)
+	{
+		bake_bsts_o* s = (bake_bsts_o*)states[i];
+		if (codes[i] != ERR_OK ||
+			!memEq(s->params, s0->params, sizeof(bign_params)))
+			continue;
+		bakeBSTSStep3Layout(l, s);
+		wwCopy(a + 4 * j * n, s0->ec->base, 2 * n);
+		wwCopy(a + (4 * j + 2) * n, s->Vb, 2 * n);
+		memCopy(rec + 2 * j * keep, l->ua, keep);
+		memCopy(rec + (2 * j + 1) * keep, l->ua, keep);
+		++j;
+	}
+	ASSERT(j == k);
+	// умножить
+	if (!ecMulARecBatch(b, a, s0->ec, rec, n, 2 * k, stack))
+	{
+		memWipe(rec, 2 * k * keep);
+		return FALSE;
+	}
+	memWipe(rec, 2 * k * keep);
+	// разобрать пакет
+	for (i = j = 0; i < count; ++i)
+	{
+		bake_bsts_o* s = (bake_bsts_o*)states[i];
+		if (codes[i] != ERR_OK ||
+			!memEq(s->params, s0->params, sizeof(bign_params)))
+			continue;
+		bakeBSTSStep3Layout(l, s);
+		wwCopy(l->Va, b + 4 * j * n, 2 * n);
+		wwCopy(l->W, b + (4 * j + 2) * n, 2 * n);
+		++j;
+	}
+	return TRUE;
+}
+
+err_t bakeBSTSStep3Batch(octet* outs[], const octet* ins[], void* states[],
+	size_t count, err_t codes[], void* stack)
+{
+	const bake_bsts_o* s0 = 0;
+	bool_t batched = FALSE;
+	size_t i, k;
+	// проверить входные данные
+	if (!memIsValid(outs, count * sizeof(octet*)) ||
+		!memIsValid(ins, count * sizeof(const octet*)) ||
+		!memIsValid(states, count * sizeof(void*)) ||
+		!memIsValid(codes, count * sizeof(err_t)) ||
+		stack == 0)
+		return ERR_BAD_INPUT;
+	// подготовка
+	for (i = k = 0; i < count; ++i)
+	{
+		codes[i] = bakeBSTSStep3Pre(outs[i], ins[i], states[i]);
+		if (codes[i] != ERR_OK)
+			continue;
+		if (!s0)
+			s0 = (const bake_bsts_o*)states[i];
+		if (memEq(((bake_bsts_o*)states[i])->params, s0->params,
+				sizeof(bign_params)))
+			++k;
+	}
+	// пакетное умножение
+	if (k > 1)
+	{
+		ASSERT(memIsValid(stack, bakeBSTSStep3Batch_deep(s0->params->l, k)));
+		batched = bakeBSTSStep3MulBatch(states, codes, count, s0, k, stack);
+	}
+	// умножение по отдельности и завершение
+	for (i = 0; i < count; ++i)
+	{
+		if (codes[i] != ERR_OK)
+			continue;
+		if (!batched || !memEq(((bake_bsts_o*)states[i])->params,
+				s0->params, sizeof(bign_params)))
+			codes[i] = bakeBSTSStep3Mul(states[i]);
+		if (codes[i] == ERR_OK)
+			codes[i] = bakeBSTSStep3Post(outs[i], ins[i], states[i]);
+	}
+	// первая ошибка
+	for (i = 0; i < count; ++i)
+		if (codes[i] != ERR_OK)
+			return codes[i];
+	return ERR_OK;
+}
+
+size_t bakeBSTSStep3Batch_deep(size_t l, size_t count)
+{
+	// размерности (см. bignStart_keep())
+	const size_t n = W_OF_B(2 * l);
+	const size_t f_deep = gfpCreate_deep(O_OF_B(2 * l));
+	const size_t ec_d = 3;
+	const size_t ec_deep = ecpCreateJ_deep(n, f_deep);
+	// расчет
+	return O_OF_W(8 * count * n) + 2 * count * ecRecode_keep(n) +
+		ecMulARecBatch_deep(n, ec_d, ec_deep, n, 2 * count);
+}
+
 static size_t bakeBSTSStep3_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return O_OF_W(4 * n + 2) + 32 +
-		utilMax(9,
+	return O_OF_W(6 * n + 2) + 32 + O_OF_W(W_OF_O(ecRecode_keep(n))) +
+		utilMax(11,
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			bakeEph_deep(n, f_deep, ec_d, ec_deep),
+			ecRecode_deep(n),
+			ecMulARec_deep(n, ec_d, ec_deep, n),
 			beltHash_keep(),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n),
+			ecModOrder_deep(n),
 			beltKRP_keep(),
 			beltCFB_keep(),
 			beltMAC_keep());
 }
 
-err_t bakeBSTSStep4(octet out[], const octet in[], size_t in_len,
+/*
+*******************************************************************************
+Буфер сертификата
+
+Зашифрованный сертификат стороны-партнера расшифровывается в буфере.
+Функция bakeBSTSBufCreate() размещает буфер длины len в стеке stack,
+если len <= no + BAKE_BSTS_CERT_MAX, и выделяет блоб в противном случае.
+Потребности в стеке шагов 4 и 5 учитывают максимальную длину буфера
+в стеке.
+*******************************************************************************
+*/
+
+static octet* bakeBSTSBufCreate(size_t len, size_t no, void* stack)
+{
+	if (len <= no + BAKE_BSTS_CERT_MAX)
+		return (octet*)stack;
+	return (octet*)blobCreate(len);
+}
+
+static void bakeBSTSBufClose(octet* buf, void* stack)
+{
+	if (buf != (octet*)stack)
+		blobClose(buf);
+}
+
+static size_t bakeBSTSBuf_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(n) + BAKE_BSTS_CERT_MAX +
+		utilMax(3,
+			beltCFB_keep(),
+			f_deep,
+			ecpIsOnA_deep(n, f_deep));
+}
+
+static err_t bakeBSTSStep4Body(octet out[], const octet in[], size_t in_len,
 	bake_certval_i vala, void* state)
 {
 	err_t code;
@@ -1039,28 +1610,30 @@ err_t bakeBSTSStep4(octet out[], const octet in[], size_t in_len,
 	// обработать Ya = [in_len - 2 * no - 8]in
 	in_len -= 2 * no + 8;
 	{
-		blob_t Ya;
+		octet* Ya;
+		void* stack1;
 		// sa || certa <- beltCFBDecr(Ya, K2, 0^128)
-		if ((Ya = blobCreate(in_len)) == 0)
+		if ((Ya = bakeBSTSBufCreate(in_len, no, stack)) == 0)
 			return ERR_OUTOFMEMORY;
+		stack1 = Ya == (octet*)stack ? Ya + O_OF_W(W_OF_O(in_len)) : stack;
 		memCopy(Ya, in + 2 * no, in_len);
-		beltCFBStart(stack, s->K2, 32, block0);
-		beltCFBStepD(Ya, in_len, stack);
+		beltCFBStart(stack1, s->K2, 32, block0);
+		beltCFBStepD(Ya, in_len, stack1);
 		// sa \in {0, 1,..., q - 1}?
 		wwFrom(sa, Ya, no);
 		if (wwCmp(sa, s->ec->order, n) >= 0)
 		{
-			blobClose(Ya);
+			bakeBSTSBufClose(Ya, stack);
 			return ERR_AUTH;
 		}
 		// проверить certa
-		code = vala((octet*)Qa, s->params, (octet*)Ya + no, in_len - no);
-		ERR_CALL_HANDLE(code, blobClose(Ya));
-		if (!qrFrom(ecX(Qa), (octet*)Qa, s->ec->f, stack) ||
-			!qrFrom(ecY(Qa, n), (octet*)Qa + no, s->ec->f, stack) ||
-			!ecpIsOnA(Qa, s->ec, stack))
+		code = vala((octet*)Qa, s->params, Ya + no, in_len - no);
+		ERR_CALL_HANDLE(code, bakeBSTSBufClose(Ya, stack));
+		if (!qrFrom(ecX(Qa), (octet*)Qa, s->ec->f, stack1) ||
+			!qrFrom(ecY(Qa, n), (octet*)Qa + no, s->ec->f, stack1) ||
+			!ecpIsOnA(Qa, s->ec, stack1))
 			code = ERR_BAD_CERT;
-		blobClose(Ya);
+		bakeBSTSBufClose(Ya, stack);
 		ERR_CALL_CHECK(code);
 	}
 	// t <- <beltHash(<Va>_2l || <Vb>_2l)>_l
@@ -1079,7 +1652,7 @@ err_t bakeBSTSStep4(octet out[], const octet in[], size_t in_len,
 	// sb <- (ub - (2^l + t)db) \mod q
 	zzMul(sb, t, n / 2, s->d, n, stack);
 	sb[n + n / 2] = zzAdd2(sb + n / 2, s->d, n);
-	zzMod(sb, sb, n + n / 2 + 1, s->ec->order, n, stack);
+	ecModOrder(sb, sb, n + n / 2 + 1, s->ec, stack);
 	zzSubMod(sb, s->u, sb, s->ec->order, n);
 	// out ||.. <- beltCFBEncr(sb || certb)
 	wwTo(out, no, sb);
@@ -1095,25 +1668,36 @@ err_t bakeBSTSStep4(octet out[], const octet in[], size_t in_len,
 	return ERR_OK;
 }
 
+err_t bakeBSTSStep4(octet out[], const octet in[], size_t in_len,
+	bake_certval_i vala, void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BSTS4);
+	code = bakeBSTSStep4Body(out, in, in_len, vala, state);
+	STAT_API_END(STAT_API_BAKE_BSTS4, code);
+	return code;
+}
+
 static size_t bakeBSTSStep4_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(6 * n + 2) + 32 +
-		utilMax(10,
+		utilMax(11,
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
 			ecMulA_deep(n, ec_d, ec_deep, n),
 			beltHash_keep(),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n),
+			ecModOrder_deep(n),
 			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1),
 			beltKRP_keep(),
 			beltCFB_keep(),
-			beltMAC_keep());
+			beltMAC_keep(),
+			bakeBSTSBuf_deep(n, f_deep));
 }
 
-err_t bakeBSTSStep5(const octet in[], size_t in_len, bake_certval_i valb,
-	void* state)
+static err_t bakeBSTSStep5Body(const octet in[], size_t in_len,
+	bake_certval_i valb, void* state)
 {
 	err_t code;
 	bake_bsts_o* s = (bake_bsts_o*)state;
@@ -1149,28 +1733,30 @@ err_t bakeBSTSStep5(const octet in[], size_t in_len, bake_certval_i valb,
 	// обработать Yb = [in_len - 8]in
 	in_len -= 8;
 	{
-		blob_t Yb;
+		octet* Yb;
+		void* stack1;
 		// sb || certb <- beltCFBDecr(Yb, K2, 1^128)
-		if ((Yb = blobCreate(in_len)) == 0)
+		if ((Yb = bakeBSTSBufCreate(in_len, no, stack)) == 0)
 			return ERR_OUTOFMEMORY;
+		stack1 = Yb == (octet*)stack ? Yb + O_OF_W(W_OF_O(in_len)) : stack;
 		memCopy(Yb, in, in_len);
-		beltCFBStart(stack, s->K2, 32, block1);
-		beltCFBStepD(Yb, in_len, stack);
+		beltCFBStart(stack1, s->K2, 32, block1);
+		beltCFBStepD(Yb, in_len, stack1);
 		// sb \in {0, 1,..., q - 1}?
 		wwFrom(sb, Yb, no);
 		if (wwCmp(sb, s->ec->order, n) >= 0)
 		{
-			blobClose(Yb);
+			bakeBSTSBufClose(Yb, stack);
 			return ERR_AUTH;
 		}
-		// проверить certa
-		code = valb((octet*)Qb, s->params, (octet*)Yb + no, in_len - no);
-		ERR_CALL_HANDLE(code, blobClose(Yb));
-		if (!qrFrom(ecX(Qb), (octet*)Qb, s->ec->f, stack) ||
-			!qrFrom(ecY(Qb, n), (octet*)Qb + no, s->ec->f, stack) ||
-			!ecpIsOnA(Qb, s->ec, stack))
+		// проверить certb
+		code = valb((octet*)Qb, s->params, Yb + no, in_len - no);
+		ERR_CALL_HANDLE(code, bakeBSTSBufClose(Yb, stack));
+		if (!qrFrom(ecX(Qb), (octet*)Qb, s->ec->f, stack1) ||
+			!qrFrom(ecY(Qb, n), (octet*)Qb + no, s->ec->f, stack1) ||
+			!ecpIsOnA(Qb, s->ec, stack1))
 			code = ERR_BAD_CERT;
-		blobClose(Yb);
+		bakeBSTSBufClose(Yb, stack);
 		ERR_CALL_CHECK(code);
 	}
 	// sb G + (2^l + t)Qa == Vb?
@@ -1183,16 +1769,27 @@ err_t bakeBSTSStep5(const octet in[], size_t in_len, bake_certval_i valb,
 	return ERR_OK;
 }
 
+err_t bakeBSTSStep5(const octet in[], size_t in_len, bake_certval_i valb,
+	void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BSTS5);
+	code = bakeBSTSStep5Body(in, in_len, valb, state);
+	STAT_API_END(STAT_API_BAKE_BSTS5, code);
+	return code;
+}
+
 static size_t bakeBSTSStep5_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(3 * n) +
-		utilMax(5,
+		utilMax(6,
 			beltMAC_keep(),
 			beltCFB_keep(),
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
-			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1));
+			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1),
+			bakeBSTSBuf_deep(n, f_deep));
 }
 
 err_t bakeBSTSStepG(octet key[32], void* state)
@@ -1482,7 +2079,7 @@ static size_t bakeBPACEStart_deep(size_t n, size_t f_deep, size_t ec_d,
 	return beltHash_keep();
 }
 
-err_t bakeBPACEStep2(octet out[], void* state)
+static err_t bakeBPACEStep2Body(octet out[], void* state)
 {
 	bake_bpace_o* s = (bake_bpace_o*)state;
 	size_t no;
@@ -1506,13 +2103,22 @@ err_t bakeBPACEStep2(octet out[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBPACEStep2(octet out[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BPACE2);
+	code = bakeBPACEStep2Body(out, state);
+	STAT_API_END(STAT_API_BAKE_BPACE2, code);
+	return code;
+}
+
 static size_t bakeBPACEStep2_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return beltECB_keep();
 }
 
-err_t bakeBPACEStep3(octet out[], const octet in[], void* state)
+static err_t bakeBPACEStep3Body(octet out[], const octet in[], void* state)
 {
 	bake_bpace_o* s = (bake_bpace_o*)state;
 	size_t n, no;
@@ -1558,6 +2164,15 @@ err_t bakeBPACEStep3(octet out[], const octet in[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBPACEStep3(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BPACE3);
+	code = bakeBPACEStep3Body(out, in, state);
+	STAT_API_END(STAT_API_BAKE_BPACE3, code);
+	return code;
+}
+
 static size_t bakeBPACEStep3_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -1569,7 +2184,7 @@ static size_t bakeBPACEStep3_deep(size_t n, size_t f_deep, size_t ec_d,
 			f_deep);
 }
 
-err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
+static err_t bakeBPACEStep4Body(octet out[], const octet in[], void* state)
 {
 	bake_bpace_o* s = (bake_bpace_o*)state;
 	size_t n, no;
@@ -1580,6 +2195,7 @@ err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
 	word* Vb;		/* [2 * n] (смещен на n относительно Va) */
 	octet* block0;	/* [16] (совпадает с Vb) */
 	octet* block1;	/* [16] (следует за block1) */
+	octet* ub;		/* [ecRecode_keep(n)] (следует за Vb) */
 	void* stack;
 	// проверить входные данные
 	if (!objIsOperable(s))
@@ -1596,7 +2212,8 @@ err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
 	Vb = K + n;
 	block0 = (octet*)Vb;
 	block1 = block0 + 16;
-	stack = Vb + 2 * n;
+	ub = (octet*)(Vb + 2 * n);
+	stack = ub + O_OF_W(W_OF_O(ecRecode_keep(n)));
 	ASSERT(32 <= no);
 	// Va <- ... || in, Va \in E*?
 	if (!qrFrom(ecX(Va), in + no / 2, s->ec->f, stack) ||
@@ -1613,13 +2230,15 @@ err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
 	if (!zzRandNZMod(s->u, s->ec->order, n, s->settings->rng,
 		s->settings->rng_state))
 		return ERR_BAD_RNG;
-	// K <- ub Va
-	if (!ecMulA(K, Va, s->ec, s->u, n, stack))
+	// K <- ub Va (ub перекодируется один раз для двух умножений)
+	ecRecode(ub, s->u, n, stack);
+	if (!ecMulARec(K, Va, s->ec, ub, n, stack))
 		return ERR_BAD_PARAMS;
 	qrTo((octet*)K, ecX(K), s->ec->f, stack);
 	// Vb <- ub W
-	if (!ecMulA(Vb, s->W, s->ec, s->u, n, stack))
+	if (!ecMulARec(Vb, s->W, s->ec, ub, n, stack))
 		return ERR_BAD_PARAMS;
+	memSetZero(ub, ecRecode_keep(n));
 	qrTo((octet*)ecX(Vb), ecX(Vb), s->ec->f, stack);
 	qrTo((octet*)ecY(Vb, n), ecY(Vb, n), s->ec->f, stack);
 	// Y <- beltHash(<K>_2l || <Va>_2l || <Vb>_2l || helloa || hellob)
@@ -1657,21 +2276,31 @@ err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBPACEStep4(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BPACE4);
+	code = bakeBPACEStep4Body(out, in, state);
+	STAT_API_END(STAT_API_BAKE_BPACE4, code);
+	return code;
+}
+
 static size_t bakeBPACEStep4_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return O_OF_W(3 * n) +
-		utilMax(7,
+	return O_OF_W(3 * n) + O_OF_W(W_OF_O(ecRecode_keep(n))) +
+		utilMax(8,
 			f_deep,
 			beltECB_keep(),
 			bakeSWU2_deep(n, f_deep, ec_d, ec_deep),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			ecRecode_deep(n),
+			ecMulARec_deep(n, ec_d, ec_deep, n),
 			beltHash_keep(),
 			beltKRP_keep(),
 			beltMAC_keep());
 }
 
-err_t bakeBPACEStep5(octet out[], const octet in[], void* state)
+static err_t bakeBPACEStep5Body(octet out[], const octet in[], void* state)
 {
 	bake_bpace_o* s = (bake_bpace_o*)state;
 	size_t n, no;
@@ -1750,6 +2379,15 @@ err_t bakeBPACEStep5(octet out[], const octet in[], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBPACEStep5(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BPACE5);
+	code = bakeBPACEStep5Body(out, in, state);
+	STAT_API_END(STAT_API_BAKE_BPACE5, code);
+	return code;
+}
+
 static size_t bakeBPACEStep5_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -1762,7 +2400,7 @@ static size_t bakeBPACEStep5_deep(size_t n, size_t f_deep, size_t ec_d,
 			beltMAC_keep());
 }
 
-err_t bakeBPACEStep6(const octet in[8], void* state)
+static err_t bakeBPACEStep6Body(const octet in[8], void* state)
 {
 	bake_bpace_o* s = (bake_bpace_o*)state;
 	// стек
@@ -1788,6 +2426,15 @@ err_t bakeBPACEStep6(const octet in[8], void* state)
 	return ERR_OK;
 }
 
+err_t bakeBPACEStep6(const octet in[8], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BAKE_BPACE6);
+	code = bakeBPACEStep6Body(in, state);
+	STAT_API_END(STAT_API_BAKE_BPACE6, code);
+	return code;
+}
+
 static size_t bakeBPACEStep6_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -1927,3 +2574,266 @@ err_t bakeBPACERunA(octet key[32], const bign_params* params,
 	blobClose(blob);
 	return code;
 }
+
+/*
+*******************************************************************************
+Неблокирующее выполнение
+
+Машина состояний bake_sm_o управляет состоянием протокола state, которое
+подготовлено вызывающей программой (функцией Start). В поле step
+указывается номер шага протокола, который сформировал исходящее сообщение
+(want == BAKE_SM_WRITE), или номер шага, который обработает входящее
+сообщение (want == BAKE_SM_READ). Длины сообщений выражены через
+no = l / 4.
+
+После ошибки машина переходит в состояние BAKE_SM_DONE и сохраняет код
+ошибки в поле code. Этот код возвращают все последующие вызовы.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t proto;				/*< протокол */
+	bool_t b;					/*< сторона B? */
+	size_t step;				/*< номер шага */
+	size_t want;				/*< ожидаемое действие */
+	size_t len;					/*< длина сообщения */
+	void* state;				/*< состояние протокола */
+	const bake_cert* cert;		/*< сертификат стороны-партнера (BMQV) */
+	bake_certval_i val;			/*< проверка сертификата (BSTS) */
+	err_t code;					/*< код ошибки */
+	octet out[];				/*< исходящее сообщение */
+} bake_sm_o;
+
+size_t bakeSM_keep(size_t l, size_t cert_len)
+{
+	return sizeof(bake_sm_o) + 3 * l / 4 + cert_len + 8;
+}
+
+static const bake_settings* bakeSMSettings(const bake_sm_o* sm)
+{
+	if (sm->proto == BAKE_BMQV)
+		return ((const bake_bmqv_o*)sm->state)->settings;
+	if (sm->proto == BAKE_BSTS)
+		return ((const bake_bsts_o*)sm->state)->settings;
+	return ((const bake_bpace_o*)sm->state)->settings;
+}
+
+static size_t bakeSMNo(const bake_sm_o* sm)
+{
+	if (sm->proto == BAKE_BMQV)
+		return ((const bake_bmqv_o*)sm->state)->ec->f->no;
+	if (sm->proto == BAKE_BSTS)
+		return ((const bake_bsts_o*)sm->state)->ec->f->no;
+	return ((const bake_bpace_o*)sm->state)->ec->f->no;
+}
+
+static void bakeSMSet(bake_sm_o* sm, size_t want, size_t step, size_t len)
+{
+	sm->want = want, sm->step = step, sm->len = len;
+}
+
+static err_t bakeSMFail(bake_sm_o* sm, err_t code)
+{
+	if (code != ERR_OK)
+		sm->code = code, bakeSMSet(sm, BAKE_SM_DONE, 0, 0);
+	return code;
+}
+
+err_t bakeSMStart(void* sm, void* state, size_t proto, bool_t b,
+	const bake_cert* cert, bake_certval_i val)
+{
+	bake_sm_o* s = (bake_sm_o*)sm;
+	size_t no;
+	// проверить входные данные
+	if (proto != BAKE_BMQV && proto != BAKE_BSTS && proto != BAKE_BPACE)
+		return ERR_BAD_INPUT;
+	if (!objIsOperable(state) ||
+		!memIsValid(s, sizeof(bake_sm_o)) ||
+		(proto == BAKE_BMQV && !memIsValid(cert, sizeof(bake_cert))) ||
+		(proto == BAKE_BSTS && val == 0))
+		return ERR_BAD_INPUT;
+	// настроить машину
+	memSetZero(s, sizeof(bake_sm_o));
+	s->proto = proto, s->b = b, s->state = state;
+	s->cert = cert, s->val = val;
+	no = bakeSMNo(s);
+	// сторона A ожидает первое сообщение
+	if (!b)
+	{
+		bakeSMSet(s, BAKE_SM_READ, 3, proto == BAKE_BPACE ? no / 2 : 2 * no);
+		return ERR_OK;
+	}
+	// сторона B выполняет шаг 2
+	if (proto == BAKE_BMQV)
+		s->code = bakeBMQVStep2(s->out, state);
+	else if (proto == BAKE_BSTS)
+		s->code = bakeBSTSStep2(s->out, state);
+	else
+		s->code = bakeBPACEStep2(s->out, state);
+	bakeSMSet(s, BAKE_SM_WRITE, 2, proto == BAKE_BPACE ? no / 2 : 2 * no);
+	return bakeSMFail(s, s->code);
+}
+
+size_t bakeSMWant(size_t* len, const void* sm)
+{
+	const bake_sm_o* s = (const bake_sm_o*)sm;
+	ASSERT(memIsValid(s, sizeof(bake_sm_o)));
+	ASSERT(memIsNullOrValid(len, sizeof(size_t)));
+	if (len)
+		*len = s->len;
+	return s->want;
+}
+
+err_t bakeSMStepR(void* sm, const octet in[], size_t in_len)
+{
+	bake_sm_o* s = (bake_sm_o*)sm;
+	const bake_settings* settings;
+	size_t no;
+	err_t code;
+	// проверить входные данные
+	if (!memIsValid(s, sizeof(bake_sm_o)))
+		return ERR_BAD_INPUT;
+	if (s->code != ERR_OK)
+		return s->code;
+	if (s->want != BAKE_SM_READ)
+		return ERR_BAD_LOGIC;
+	if (!memIsValid(in, in_len) ||
+		(s->len != SIZE_MAX && in_len != s->len))
+		return ERR_BAD_INPUT;
+	settings = bakeSMSettings(s);
+	no = bakeSMNo(s);
+	// сторона A: шаг 3
+	if (s->step == 3)
+	{
+		if (s->proto == BAKE_BMQV)
+		{
+			code = bakeBMQVStep3(s->out, in, s->cert, s->state);
+			bakeSMSet(s, BAKE_SM_WRITE, 3, 2 * no + (settings->kca ? 8 : 0));
+		}
+		else if (s->proto == BAKE_BSTS)
+		{
+			code = bakeBSTSStep3(s->out, in, s->state);
+			bakeSMSet(s, BAKE_SM_WRITE, 3, 3 * no +
+				((const bake_bsts_o*)s->state)->cert->len + 8);
+		}
+		else
+		{
+			code = bakeBPACEStep3(s->out, in, s->state);
+			bakeSMSet(s, BAKE_SM_WRITE, 3, 5 * no / 2);
+		}
+	}
+	// сторона B: шаг 4
+	else if (s->step == 4)
+	{
+		if (s->proto == BAKE_BMQV)
+		{
+			code = bakeBMQVStep4(s->out, in, s->cert, s->state);
+			if (settings->kcb)
+				bakeSMSet(s, BAKE_SM_WRITE, 4, 8);
+			else
+				bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+		}
+		else if (s->proto == BAKE_BSTS)
+		{
+			code = bakeBSTSStep4(s->out, in, in_len, s->val, s->state);
+			bakeSMSet(s, BAKE_SM_WRITE, 4, no +
+				((const bake_bsts_o*)s->state)->cert->len + 8);
+		}
+		else
+		{
+			code = bakeBPACEStep4(s->out, in, s->state);
+			bakeSMSet(s, BAKE_SM_WRITE, 4, 2 * no + (settings->kcb ? 8 : 0));
+		}
+	}
+	// сторона A: шаг 5
+	else if (s->step == 5)
+	{
+		if (s->proto == BAKE_BMQV)
+		{
+			code = bakeBMQVStep5(in, s->state);
+			bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+		}
+		else if (s->proto == BAKE_BSTS)
+		{
+			code = bakeBSTSStep5(in, in_len, s->val, s->state);
+			bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+		}
+		else
+		{
+			code = bakeBPACEStep5(s->out, in, s->state);
+			if (settings->kca)
+				bakeSMSet(s, BAKE_SM_WRITE, 5, 8);
+			else
+				bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+		}
+	}
+	// сторона B: шаг 6 (BPACE)
+	else
+	{
+		ASSERT(s->step == 6 && s->proto == BAKE_BPACE);
+		code = bakeBPACEStep6(in, s->state);
+		bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+	}
+	return bakeSMFail(s, code);
+}
+
+err_t bakeSMStepW(octet out[], void* sm)
+{
+	bake_sm_o* s = (bake_sm_o*)sm;
+	const bake_settings* settings;
+	size_t no;
+	// проверить входные данные
+	if (!memIsValid(s, sizeof(bake_sm_o)))
+		return ERR_BAD_INPUT;
+	if (s->code != ERR_OK)
+		return s->code;
+	if (s->want != BAKE_SM_WRITE)
+		return ERR_BAD_LOGIC;
+	if (!memIsValid(out, s->len))
+		return ERR_BAD_INPUT;
+	settings = bakeSMSettings(s);
+	no = bakeSMNo(s);
+	// выдать сообщение
+	memCopy(out, s->out, s->len);
+	// сторона B: после шага 2 ожидается ответ на шаге 4
+	if (s->step == 2)
+		bakeSMSet(s, BAKE_SM_READ, 4,
+			s->proto == BAKE_BMQV ? 2 * no + (settings->kca ? 8 : 0) :
+			s->proto == BAKE_BSTS ? SIZE_MAX : 5 * no / 2);
+	// сторона A: после шага 3 ожидается ответ на шаге 5
+	else if (s->step == 3)
+	{
+		if (s->proto == BAKE_BMQV && !settings->kcb)
+			bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+		else
+			bakeSMSet(s, BAKE_SM_READ, 5,
+				s->proto == BAKE_BMQV ? 8 :
+				s->proto == BAKE_BSTS ? SIZE_MAX :
+				2 * no + (settings->kcb ? 8 : 0));
+	}
+	// сторона B: после шага 4 BPACE ожидается ответ на шаге 6
+	else if (s->step == 4 && s->proto == BAKE_BPACE && settings->kca)
+		bakeSMSet(s, BAKE_SM_READ, 6, 8);
+	else
+		bakeSMSet(s, BAKE_SM_DONE, 0, 0);
+	return ERR_OK;
+}
+
+err_t bakeSMStepG(octet key[32], void* sm)
+{
+	bake_sm_o* s = (bake_sm_o*)sm;
+	// проверить входные данные
+	if (!memIsValid(s, sizeof(bake_sm_o)))
+		return ERR_BAD_INPUT;
+	if (s->code != ERR_OK)
+		return s->code;
+	if (s->want != BAKE_SM_DONE)
+		return ERR_BAD_LOGIC;
+	// извлечь ключ
+	if (s->proto == BAKE_BMQV)
+		return bakeBMQVStepG(key, s->state);
+	if (s->proto == BAKE_BSTS)
+		return bakeBSTSStepG(key, s->state);
+	return bakeBPACEStepG(key, s->state);
+}
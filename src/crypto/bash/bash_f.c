@@ -4,13 +4,14 @@
 \brief STB 34.101.77 (bash): bash-f
 \project bee2 [cryptographic library]
 \created 2019.06.25
-\version 2021.03.25
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/defs.h"
+#include "core/stat_lcl.h"
 
 #if !defined(__ARM_NEON__) && (defined(__ARM_NEON) ||\
 	defined(__ARM_FP16_FORMAT_IEEE) || defined(__ARM_FP16_FORMAT_ALTERNATIVE) ||\
@@ -23,7 +24,36 @@
 	#define __SSE2__
 #endif
 
-#if defined(__AVX512F__) && defined(BASH_AVX512)
+#if defined(STAT_ENABLED) && !defined(BASH_DISPATCH)
+	#include "bee2/crypto/bash.h"
+	static void bashFRaw(octet block[192], void* stack);
+	static void bashFAbsorbRaw(octet block[192], const void* buf,
+		size_t count, size_t rate, void* stack);
+	#define bashF bashFRaw
+	#define bashFAbsorb bashFAbsorbRaw
+#endif
+
+#if defined(BASH_DISPATCH) && defined(__aarch64__)
+	#include "bee2/crypto/bash.h"
+	void bashFNEON(octet block[192], void* stack);
+	size_t bashFNEON_deep();
+	#define bashF bashFNEON
+	#define bashF_deep bashFNEON_deep
+	#include "bash_fneon.c"
+	#undef bashF
+	#undef bashF_deep
+	const char bash_platform[] = "BASH_DISPATCH";
+#elif defined(BASH_DISPATCH)
+	#include "bee2/crypto/bash.h"
+	void bashF64(octet block[192], void* stack);
+	size_t bashF64_deep();
+	#define bashF bashF64
+	#define bashF_deep bashF64_deep
+	#include "bash_f64.c"
+	#undef bashF
+	#undef bashF_deep
+	const char bash_platform[] = "BASH_DISPATCH";
+#elif defined(__AVX512F__) && defined(BASH_AVX512)
 	#include "bash_favx512.c"
 	const char bash_platform[] = "BASH_AVX512";
 #elif defined(__AVX2__) && defined(BASH_AVX2)
@@ -32,6 +62,9 @@
 #elif defined(__SSE2__) && defined(BASH_SSE2)
 	#include "bash_fsse2.c"
 	const char bash_platform[] = "BASH_SSE2";
+#elif defined(__ARM_FEATURE_SVE2) && defined(BASH_SVE2)
+	#include "bash_fsve2.c"
+	const char bash_platform[] = "BASH_SVE2";
 #elif defined(__ARM_NEON__) && defined(BASH_NEON)
 	#include "bash_fneon.c"
 	const char bash_platform[] = "BASH_NEON";
@@ -42,3 +75,272 @@
 	#include "bash_f64.c"
 	const char bash_platform[] = "BASH_64";
 #endif
+
+/*
+*******************************************************************************
+Поглощение блоков
+
+Реализации BASH_AVX2 и BASH_AVX512 содержат собственные версии
+bashFAbsorb(), в которых состояние удерживается в регистрах между
+вызовами bash-f, а блоки загружаются в регистры непосредственно из buf
+(см. bash_favx2.c, bash_favx512.c). Для остальных реализаций блоки
+копируются в block и обрабатываются функцией bashF() в цикле
+bashFAbsorbLoop().
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+
+#if defined(BASH_DISPATCH) || !defined(BASH_F_ABSORB)
+
+static void bashFAbsorbLoop(void (*f)(octet block[192], void* stack),
+	octet block[192], const void* buf, size_t count, size_t rate,
+	void* stack)
+{
+	ASSERT(rate % 8 == 0 && 0 < rate && rate <= 192);
+	ASSERT(count % rate == 0);
+	ASSERT(memIsValid(block, 192));
+	ASSERT(memIsDisjoint2(block, 192, buf, count));
+	for (; count; count -= rate, buf = (const octet*)buf + rate)
+	{
+		memCopy(block, buf, rate);
+		f(block, stack);
+	}
+}
+
+#endif
+
+#if !defined(BASH_DISPATCH) && !defined(BASH_F_ABSORB)
+
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
+{
+	bashFAbsorbLoop(bashF, block, buf, count, rate, stack);
+}
+
+#endif
+
+/*
+*******************************************************************************
+Выбор реализации
+
+При сборке с опцией BASH_DISPATCH в библиотеку включаются все реализации
+bash-f для платформы x86-64: BASH_64, BASH_SSE2, BASH_AVX2, BASH_AVX512.
+Выбор реализации выполняется при первом обращении к bashF() или
+bashPlatform() по результатам инструкции cpuid. Реализации AVX2 и AVX512
+выбираются только тогда, когда операционная система сохраняет при
+переключении контекста соответствующие регистры (проверяется с помощью
+инструкции xgetbv).
+
+На платформе AArch64 при сборке с опцией BASH_DISPATCH в библиотеку
+включаются реализации BASH_NEON и BASH_SVE2. Реализация BASH_SVE2
+выбирается, если ядро операционной системы сообщает о поддержке SVE2
+(флаг HWCAP2_SVE2 вектора getauxval(AT_HWCAP2)).
+
+Выбор выполняется однократно с помощью mtCallOnce(). До завершения выбора
+указатель _bash_f ссылается на функцию bashFFirst(), которая дожидается
+выбора и перенаправляет вызов. Вместе с bashF() выбирается реализация
+bashFAbsorb() (указатель _bash_f_absorb).
+
+При сборке с директивой STAT_ENABLED функция bashF() ведет учет обращений
+(см. stat.h). Без BASH_DISPATCH выбранная реализация для этого
+переименовывается в bashFRaw().
+*******************************************************************************
+*/
+
+#if defined(BASH_DISPATCH) && defined(__aarch64__)
+
+#include <sys/auxv.h>
+#include "bee2/core/mt.h"
+
+#ifndef HWCAP2_SVE2
+	#define HWCAP2_SVE2 (1 << 1)
+#endif
+
+extern void bashFSVE2(octet block[192], void* stack);
+extern size_t bashFSVE2_deep();
+
+static void bashFFirst(octet block[192], void* stack);
+
+static size_t _once;
+static void (*_bash_f)(octet block[192], void* stack) = bashFFirst;
+static const char* _bash_platform = "BASH_NEON";
+
+static void bashFSelect()
+{
+	if (getauxval(AT_HWCAP2) & HWCAP2_SVE2)
+		_bash_platform = "BASH_SVE2", _bash_f = bashFSVE2;
+	else
+		_bash_platform = "BASH_NEON", _bash_f = bashFNEON;
+}
+
+static void bashFFirst(octet block[192], void* stack)
+{
+	mtCallOnce(&_once, bashFSelect);
+	_bash_f(block, stack);
+}
+
+void bashF(octet block[192], void* stack)
+{
+	STAT_BEGIN;
+	_bash_f(block, stack);
+	STAT_END(STAT_BASH_F, 192);
+}
+
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
+{
+	STAT_BEGIN;
+	mtCallOnce(&_once, bashFSelect);
+	bashFAbsorbLoop(_bash_f, block, buf, count, rate, stack);
+	STAT_END(STAT_BASH_F, 192 * (count / rate));
+}
+
+size_t bashF_deep()
+{
+	return utilMax(2, bashFNEON_deep(), bashFSVE2_deep());
+}
+
+const char* bashPlatform()
+{
+	mtCallOnce(&_once, bashFSelect);
+	return _bash_platform;
+}
+
+#elif defined(BASH_DISPATCH)
+
+#include <cpuid.h>
+#include "bee2/core/mt.h"
+
+extern void bashFSSE2(octet block[192], void* stack);
+extern void bashFAVX2(octet block[192], void* stack);
+extern void bashFAVX512(octet block[192], void* stack);
+extern size_t bashFSSE2_deep();
+extern size_t bashFAVX2_deep();
+extern size_t bashFAVX512_deep();
+extern void bashFAbsorbAVX2(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack);
+extern void bashFAbsorbAVX512(octet block[192], const void* buf,
+	size_t count, size_t rate, void* stack);
+
+static void bashFFirst(octet block[192], void* stack);
+
+static size_t _once;
+static void (*_bash_f)(octet block[192], void* stack) = bashFFirst;
+static const char* _bash_platform = "BASH_64";
+static void bashFAbsorbStd(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack);
+static void (*_bash_f_absorb)(octet block[192], const void* buf,
+	size_t count, size_t rate, void* stack) = bashFAbsorbStd;
+
+static u64 bashXGetBV()
+{
+	u32 lo, hi;
+	__asm__ volatile("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+	return (u64)hi << 32 | lo;
+}
+
+static void bashFSelect()
+{
+	u32 info[4];
+	u64 xcr0;
+	void (*f)(octet block[192], void* stack) = bashF64;
+	void (*fa)(octet block[192], const void* buf, size_t count, size_t rate,
+		void* stack) = bashFAbsorbStd;
+	const char* platform = "BASH_64";
+	// SSE2?
+	if (__get_cpuid(1, info, info + 1, info + 2, info + 3) &&
+		(info[3] & 0x04000000))
+	{
+		f = bashFSSE2, platform = "BASH_SSE2";
+		// OSXSAVE и AVX?
+		if ((info[2] & 0x18000000) == 0x18000000 &&
+			__get_cpuid_max(0, 0) >= 7)
+		{
+			xcr0 = bashXGetBV();
+			__cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+			// AVX2 + состояния XMM/YMM?
+			if ((xcr0 & 0x06) == 0x06 && (info[1] & 0x00000020))
+				f = bashFAVX2, fa = bashFAbsorbAVX2, platform = "BASH_AVX2";
+			// AVX512F + состояния opmask/ZMM?
+			if ((xcr0 & 0xE6) == 0xE6 && (info[1] & 0x00010000))
+				f = bashFAVX512, fa = bashFAbsorbAVX512,
+					platform = "BASH_AVX512";
+		}
+	}
+	_bash_platform = platform;
+	_bash_f_absorb = fa;
+	_bash_f = f;
+}
+
+static void bashFFirst(octet block[192], void* stack)
+{
+	mtCallOnce(&_once, bashFSelect);
+	_bash_f(block, stack);
+}
+
+void bashF(octet block[192], void* stack)
+{
+	STAT_BEGIN;
+	_bash_f(block, stack);
+	STAT_END(STAT_BASH_F, 192);
+}
+
+static void bashFAbsorbStd(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
+{
+	bashFAbsorbLoop(_bash_f, block, buf, count, rate, stack);
+}
+
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
+{
+	STAT_BEGIN;
+	mtCallOnce(&_once, bashFSelect);
+	_bash_f_absorb(block, buf, count, rate, stack);
+	STAT_END(STAT_BASH_F, 192 * (count / rate));
+}
+
+size_t bashF_deep()
+{
+	return utilMax(4, bashF64_deep(), bashFSSE2_deep(),
+		bashFAVX2_deep(), bashFAVX512_deep());
+}
+
+const char* bashPlatform()
+{
+	mtCallOnce(&_once, bashFSelect);
+	return _bash_platform;
+}
+
+#else
+
+const char* bashPlatform()
+{
+	return bash_platform;
+}
+
+#ifdef STAT_ENABLED
+
+#undef bashF
+
+void bashF(octet block[192], void* stack)
+{
+	STAT_BEGIN;
+	bashFRaw(block, stack);
+	STAT_END(STAT_BASH_F, 192);
+}
+
+#undef bashFAbsorb
+
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
+{
+	STAT_BEGIN;
+	bashFAbsorbRaw(block, buf, count, rate, stack);
+	STAT_END(STAT_BASH_F, 192 * (count / rate));
+}
+
+#endif
+
+#endif
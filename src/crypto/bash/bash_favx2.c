@@ -4,12 +4,22 @@
 \brief STB 34.101.77 (bash): bash-f optimized for AVX2
 \project bee2 [cryptographic library]
 \created 2019.04.03
-\version 2021.03.26
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#ifdef BASH_DISPATCH
+	#include "bee2/defs.h"
+	#define bashF bashFAVX2
+	#define bashF_deep bashFAVX2_deep
+	#define bashFA bashFAAVX2
+	#define bashFAbsorb bashFAbsorbAVX2
+#endif
+
+#define BASH_F_ABSORB
+
 #ifndef __AVX2__
 	#error "The compiler does not support AVX2 intrinsics"
 #endif
@@ -309,25 +319,74 @@ Bash-f
 	bashR0(23);\
 	bashR1(24)
 
+/*
+*******************************************************************************
+Загрузка и выгрузка состояния
+
+Макрос bashLoad загружает состояние block в регистры W0,..., W5 с помощью
+инструкции LD (LOAD или LOADU), макрос bashStore выгружает регистры
+в block с помощью инструкции ST (STORE или STOREU).
+*******************************************************************************
+*/
+
+#define bashLoad(LD, block)\
+	W0 = LD((block) + 0);\
+	W1 = LD((block) + 32);\
+	W2 = LD((block) + 64);\
+	W3 = LD((block) + 96);\
+	W4 = LD((block) + 128);\
+	W5 = LD((block) + 160)
+
+#define bashStore(ST, block)\
+	ST((block) + 0, W0);\
+	ST((block) + 32, W1);\
+	ST((block) + 64, W2);\
+	ST((block) + 96, W3);\
+	ST((block) + 128, W4);\
+	ST((block) + 160, W5)
+
+/*
+*******************************************************************************
+Bash-f на выровненной памяти
+*******************************************************************************
+*/
+
+void bashFA(octet block[192])
+{
+	register __m256i Z1, Z2, T0, T1, T2, U0, U1, U2;
+	register __m256i W0, W1, W2, W3, W4, W5;
+
+	ASSERT(memIsValid(block, 192));
+	ASSERT(memIsAligned(block, 32));
+	bashLoad(LOAD, block);
+	bashF0;
+	bashStore(STORE, block);
+	ZEROALL;
+}
+
+/*
+*******************************************************************************
+Bash-f
+
+Если block выровнен на границу 32 байт (в частности, если выровнено
+на границу MEM_ALIGN состояние bashHash, bashPrg), то вызывается bashFA().
+*******************************************************************************
+*/
+
 void bashF(octet block[192], void* stack)
 {
 	register __m256i Z1, Z2, T0, T1, T2, U0, U1, U2;
 	register __m256i W0, W1, W2, W3, W4, W5;
 
 	ASSERT(memIsValid(block, 192));
-	W0 = LOADU(block + 0);
-	W1 = LOADU(block + 32);
-	W2 = LOADU(block + 64);
-	W3 = LOADU(block + 96);
-	W4 = LOADU(block + 128);
-	W5 = LOADU(block + 160);
+	if (memIsAligned(block, 32))
+	{
+		bashFA(block);
+		return;
+	}
+	bashLoad(LOADU, block);
 	bashF0;
-	STOREU(block + 0, W0);
-	STOREU(block + 32, W1);
-	STOREU(block + 64, W2);
-	STOREU(block + 96, W3);
-	STOREU(block + 128, W4);
-	STOREU(block + 160, W5);
+	bashStore(STOREU, block);
 	ZEROALL;
 }
 
@@ -338,29 +397,64 @@ size_t bashF_deep()
 
 /*
 *******************************************************************************
-Bash-f на выровненной памяти
+Поглощение блоков
+
+Состояние загружается в регистры W0,..., W5 однократно. Перед каждым
+вызовом bash-f первые rate / 8 слов состояния заменяются словами
+очередного блока buf: слова регистра Wj загружаются по маске M[j]
+(_mm256_maskload_epi64() не обращается к памяти за пределами блока)
+и подставляются в Wj по той же маске.
 *******************************************************************************
 */
 
-void bashF2(octet block[192])
+#define LOADM(W, s, M)\
+	W = _mm256_blendv_epi8(W,\
+		_mm256_maskload_epi64((long long const*)(s), M), M)
+
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
 {
 	register __m256i Z1, Z2, T0, T1, T2, U0, U1, U2;
 	register __m256i W0, W1, W2, W3, W4, W5;
+	const octet* src = (const octet*)buf;
+	__m256i M[6];
+	bool_t aligned;
+	size_t j;
 
+	ASSERT(rate % 8 == 0 && 0 < rate && rate <= 192);
+	ASSERT(count % rate == 0);
 	ASSERT(memIsValid(block, 192));
-	ASSERT(memIsAligned(block, 32));
-	W0 = LOAD(block +   0);
-	W1 = LOAD(block +  32);
-	W2 = LOAD(block +  64);
-	W3 = LOAD(block +  96);
-	W4 = LOAD(block + 128);
-	W5 = LOAD(block + 160);
-	bashF0;
-	STORE(block +   0, W0);
-	STORE(block +  32, W1);
-	STORE(block +  64, W2);
-	STORE(block +  96, W3);
-	STORE(block + 128, W4);
-	STORE(block + 160, W5);
+	ASSERT(memIsValid(buf, count));
+	for (j = 0; j < 6; ++j)
+		M[j] = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(rate / 8)),
+			_mm256_setr_epi64x((long long)(4 * j), (long long)(4 * j + 1),
+				(long long)(4 * j + 2), (long long)(4 * j + 3)));
+	aligned = memIsAligned(block, 32);
+	if (aligned)
+	{
+		bashLoad(LOAD, block);
+	}
+	else
+	{
+		bashLoad(LOADU, block);
+	}
+	for (; count; count -= rate, src += rate)
+	{
+		LOADM(W0, src + 0, M[0]);
+		LOADM(W1, src + 32, M[1]);
+		LOADM(W2, src + 64, M[2]);
+		LOADM(W3, src + 96, M[3]);
+		LOADM(W4, src + 128, M[4]);
+		LOADM(W5, src + 160, M[5]);
+		bashF0;
+	}
+	if (aligned)
+	{
+		bashStore(STORE, block);
+	}
+	else
+	{
+		bashStore(STOREU, block);
+	}
 	ZEROALL;
 }
@@ -5,7 +5,7 @@
 \remark AVX512 is interpreted here only as AVX512F
 \project bee2 [cryptographic library]
 \created 2019.04.03
-\version 2021.03.25
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -17,6 +17,16 @@
 *******************************************************************************
 */
 
+#ifdef BASH_DISPATCH
+	#include "bee2/defs.h"
+	#define bashF bashFAVX512
+	#define bashF_deep bashFAVX512_deep
+	#define bashFA bashFAAVX512
+	#define bashFAbsorb bashFAbsorbAVX512
+#endif
+
+#define BASH_F_ABSORB
+
 #if !defined(__AVX512F__)
 	#error "The compiler does not support AVX512 intrinsics"
 #endif
@@ -233,19 +243,68 @@ Bash-s
 	bashR1(23);\
 	bashR2(24)
 
+/*
+*******************************************************************************
+Загрузка и выгрузка состояния
+
+Макрос bashLoad загружает состояние block в регистры W0, W1, W2 с помощью
+инструкции LD (LOAD или LOADU), макрос bashStore выгружает регистры
+в block с помощью инструкции ST (STORE или STOREU).
+*******************************************************************************
+*/
+
+#define bashLoad(LD, block)\
+	W0 = LD((block) + 0);\
+	W1 = LD((block) + 64);\
+	W2 = LD((block) + 128)
+
+#define bashStore(ST, block)\
+	ST((block) + 0, W0);\
+	ST((block) + 64, W1);\
+	ST((block) + 128, W2)
+
+/*
+*******************************************************************************
+Алгоритм bash-f на выровненной памяти
+*******************************************************************************
+*/
+
+void bashFA(octet block[192])
+{
+	register __m512i U0, U1, U2;
+	register __m512i W0, W1, W2;
+		
+	ASSERT(memIsValid(block, 192));
+	ASSERT(memIsAligned(block, 64));
+	bashLoad(LOAD, block);
+	bashF0;
+	bashStore(STORE, block);
+	ZEROALL;
+}
+
+/*
+*******************************************************************************
+Алгоритм bash-f
+
+Если block выровнен на границу 64 байт (в частности, если выровнено
+на границу MEM_ALIGN состояние bashHash, bashPrg), то вызывается bashFA().
+*******************************************************************************
+*/
+
 void bashF(octet block[192], void* stack)
 {
 	register __m512i U0, U1, U2;
 	register __m512i W0, W1, W2;
 
 	ASSERT(memIsValid(block, 192));
-	W0 = LOADU(block + 0);
-	W1 = LOADU(block + 64);
-	W2 = LOADU(block + 128);
+	if (memIsAligned(block, 64))
+	{
+		bashFA(block);
+		return;
+	}
+	bashLoad(LOADU, block);
 	bashF0;
-	STOREU(block + 0, W0);
-	STOREU(block + 64, W1);
-	STOREU(block + 128, W2);
+	bashStore(STOREU, block);
 	ZEROALL;
 }
 
@@ -256,23 +315,55 @@ size_t bashF_deep()
 
 /*
 *******************************************************************************
-Алгоритм bash-f на выровненной памяти
+Поглощение блоков
+
+Состояние загружается в регистры W0, W1, W2 однократно. Перед каждым
+вызовом bash-f первые rate / 8 слов состояния заменяются словами
+очередного блока buf с помощью загрузок по маске: i-й бит маски
+регистра Wj установлен, если слово 8j + i входит в блок. Загрузки
+по маске не обращаются к памяти за пределами блока.
 *******************************************************************************
 */
 
-void bashF2(octet block[192])
+void bashFAbsorb(octet block[192], const void* buf, size_t count,
+	size_t rate, void* stack)
 {
 	register __m512i U0, U1, U2;
 	register __m512i W0, W1, W2;
-		
+	const octet* src = (const octet*)buf;
+	const size_t r = rate / 8;
+	const __mmask8 m0 = (__mmask8)((1u << MIN2(r, 8)) - 1);
+	const __mmask8 m1 = (__mmask8)(r > 8 ? (1u << MIN2(r - 8, 8)) - 1 : 0);
+	const __mmask8 m2 = (__mmask8)(r > 16 ? (1u << (r - 16)) - 1 : 0);
+	bool_t aligned;
+
+	ASSERT(rate % 8 == 0 && 0 < rate && rate <= 192);
+	ASSERT(count % rate == 0);
 	ASSERT(memIsValid(block, 192));
-	ASSERT(memIsAligned(block, 64));
-	W0 = LOAD(block + 0);
-	W1 = LOAD(block + 64);
-	W2 = LOAD(block + 128);
-	bashF0;
-	STORE(block + 0, W0);
-	STORE(block + 64, W1);
-	STORE(block + 128, W2);
+	ASSERT(memIsValid(buf, count));
+	aligned = memIsAligned(block, 64);
+	if (aligned)
+	{
+		bashLoad(LOAD, block);
+	}
+	else
+	{
+		bashLoad(LOADU, block);
+	}
+	for (; count; count -= rate, src += rate)
+	{
+		W0 = _mm512_mask_loadu_epi64(W0, m0, src);
+		W1 = _mm512_mask_loadu_epi64(W1, m1, src + 64);
+		W2 = _mm512_mask_loadu_epi64(W2, m2, src + 128);
+		bashF0;
+	}
+	if (aligned)
+	{
+		bashStore(STORE, block);
+	}
+	else
+	{
+		bashStore(STOREU, block);
+	}
 	ZEROALL;
 }
@@ -0,0 +1,244 @@
+/*
+*******************************************************************************
+\file bash_fn.c
+\brief STB 34.101.77 (bash): bash-f on several states
+\project bee2 [cryptographic library]
+\created 2026.10.14
+\version 2026.10.14
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/u64.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/bash.h"
+
+/*
+*******************************************************************************
+Несколько состояний
+
+Состояния block[0..n) обрабатываются одновременно: слова с одинаковыми
+номерами объединяются в строки s[24][n], и такт bash-f выполняется над
+строками целиком. Обработка строк не содержит зависимостей между
+состояниями (дорожками) и векторизуется компилятором: на платформе x86-64
+8 дорожек размещаются в одном регистре AVX512, 4 -- в регистре AVX2,
+2 -- в регистре SSE2.
+
+Перестановка P не выполняется явно: вместо этого после каждого такта
+меняется таблица bash_p размещения слов (см. макросы Pi в bash_f64.c).
+Строка bash_p[k] задает действие P^k: слово x после k тактов находится
+в строке bash_p[k][x].
+
+При сборке с опцией BASH_DISPATCH на платформе x86-64 функция
+bashFLanes() клонируется для платформ AVX512, AVX2 и базовой платформы,
+клон выбирается во время выполнения.
+*******************************************************************************
+*/
+
+#ifdef U64_SUPPORT
+
+/*
+*******************************************************************************
+Тактовые константы и перестановка P
+
+Константы и макросы Pi повторяют одноименные объекты из bash_f64.c.
+*******************************************************************************
+*/
+
+#define c1  0x3BF5080AC8BA94B1ull
+#define c2  0xC1D1659C1BBD92F6ull
+#define c3  0x60E8B2CE0DDEC97Bull
+#define c4  0xEC5FB8FE790FBC13ull
+#define c5  0xAA043DE6436706A7ull
+#define c6  0x8929FF6A5E535BFDull
+#define c7  0x98BF1E2C50C97550ull
+#define c8  0x4C5F8F162864BAA8ull
+#define c9  0x262FC78B14325D54ull
+#define c10 0x1317E3C58A192EAAull
+#define c11 0x098BF1E2C50C9755ull
+#define c12 0xD8EE19681D669304ull
+#define c13 0x6C770CB40EB34982ull
+#define c14 0x363B865A0759A4C1ull
+#define c15 0xC73622B47C4C0ACEull
+#define c16 0x639B115A3E260567ull
+#define c17 0xEDE6693460F3DA1Dull
+#define c18 0xAAD8D5034F9935A0ull
+#define c19 0x556C6A81A7CC9AD0ull
+#define c20 0x2AB63540D3E64D68ull
+#define c21 0x155B1AA069F326B4ull
+#define c22 0x0AAD8D5034F9935Aull
+#define c23 0x0556C6A81A7CC9ADull
+#define c24 0xDE8082CD72DEBC78ull
+
+#define P0(x) x
+
+#define P1(x)\
+	((x < 8) ? 8 + (x + 2 * (x & 1) + 7) % 8 :\
+		((x < 16) ? 8 + (x ^ 1) : (5 * x + 6) % 8))
+
+#define P2(x) P1(P1(x))
+
+#define P3(x)\
+	(8 * (x / 8) + ( x % 8 + 4) % 8)
+
+#define P4(x) P1(P3(x))
+#define P5(x) P2(P3(x))
+
+/*
+*******************************************************************************
+Такт
+
+Макрос bashS повторяет одноименный макрос из bash_f64.c, но обрабатывает
+строки s[x][0..n) целиком. Номера строк и сдвиги -- константы, поэтому
+цикл по дорожкам векторизуется.
+*******************************************************************************
+*/
+
+#define bashS(s, x0, x1, x2, m1, n1, m2, n2, n)\
+	for (j = 0; j < n; ++j)\
+	{\
+		register u64 w0 = s[x0][j], w1 = s[x1][j], w2 = s[x2][j];\
+		register u64 t0, t1, t2;\
+		t2 = u64RotHi(w0, m1);\
+		w0 ^= w1 ^ w2;\
+		t1 = w1 ^ u64RotHi(w0, n1);\
+		w1 = t1 ^ t2;\
+		w2 ^= u64RotHi(w2, m2) ^ u64RotHi(t1, n2);\
+		t1 = w0 | w2;\
+		t2 = w0 & w1;\
+		t0 = ~w2;\
+		t0 |= w1;\
+		s[x0][j] = w0 ^ t0;\
+		s[x1][j] = w1 ^ t1;\
+		s[x2][j] = w2 ^ t2;\
+	}
+
+#define bashR(s, p, p_next, i, n)\
+	bashS(s, p( 0), p( 8), p(16),  8, 53, 14,  1, n);\
+	bashS(s, p( 1), p( 9), p(17), 56, 51, 34,  7, n);\
+	bashS(s, p( 2), p(10), p(18),  8, 37, 46, 49, n);\
+	bashS(s, p( 3), p(11), p(19), 56,  3,  2, 23, n);\
+	bashS(s, p( 4), p(12), p(20),  8, 21, 14, 33, n);\
+	bashS(s, p( 5), p(13), p(21), 56, 19, 34, 39, n);\
+	bashS(s, p( 6), p(14), p(22),  8,  5, 46, 17, n);\
+	bashS(s, p( 7), p(15), p(23), 56, 35,  2, 55, n);\
+	for (j = 0; j < n; ++j)\
+		s[p_next(23)][j] ^= c##i
+
+#if defined(BASH_DISPATCH) && defined(__GNUC__) && defined(__x86_64__)
+	#define BASH_CLONES\
+		__attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+	#define BASH_CLONES
+#endif
+
+#define bashFLanes(name, n)\
+BASH_CLONES \
+static void name(u64 s[24][n])\
+{\
+	size_t j;\
+	bashR(s, P0, P1,  1, n);\
+	bashR(s, P1, P2,  2, n);\
+	bashR(s, P2, P3,  3, n);\
+	bashR(s, P3, P4,  4, n);\
+	bashR(s, P4, P5,  5, n);\
+	bashR(s, P5, P0,  6, n);\
+	bashR(s, P0, P1,  7, n);\
+	bashR(s, P1, P2,  8, n);\
+	bashR(s, P2, P3,  9, n);\
+	bashR(s, P3, P4, 10, n);\
+	bashR(s, P4, P5, 11, n);\
+	bashR(s, P5, P0, 12, n);\
+	bashR(s, P0, P1, 13, n);\
+	bashR(s, P1, P2, 14, n);\
+	bashR(s, P2, P3, 15, n);\
+	bashR(s, P3, P4, 16, n);\
+	bashR(s, P4, P5, 17, n);\
+	bashR(s, P5, P0, 18, n);\
+	bashR(s, P0, P1, 19, n);\
+	bashR(s, P1, P2, 20, n);\
+	bashR(s, P2, P3, 21, n);\
+	bashR(s, P3, P4, 22, n);\
+	bashR(s, P4, P5, 23, n);\
+	bashR(s, P5, P0, 24, n);\
+}
+
+bashFLanes(bashFLanes2, 2)
+bashFLanes(bashFLanes4, 4)
+bashFLanes(bashFLanes8, 8)
+
+static void bashFN(octet block[], size_t n, void* stack)
+{
+	u64* s = (u64*)stack;
+	u64* t = s + 24 * n;
+	size_t i, j;
+	ASSERT(memIsDisjoint2(block, 192 * n, stack, 384 * n));
+	// перегруппировать слова
+	u64From(t, block, 192 * n);
+	for (j = 0; j < n; ++j)
+		for (i = 0; i < 24; ++i)
+			s[n * i + j] = t[24 * j + i];
+	// такты
+	if (n == 2)
+		bashFLanes2((u64(*)[2])s);
+	else if (n == 4)
+		bashFLanes4((u64(*)[4])s);
+	else
+		bashFLanes8((u64(*)[8])s);
+	// вернуть слова на место
+	for (j = 0; j < n; ++j)
+		for (i = 0; i < 24; ++i)
+			t[24 * j + i] = s[n * i + j];
+	u64To(block, 192 * n, t);
+}
+
+#else
+
+static void bashFN(octet block[], size_t n, void* stack)
+{
+	for (; n--; block += 192)
+		bashF(block, stack);
+}
+
+#endif // U64_SUPPORT
+
+/*
+*******************************************************************************
+Интерфейс
+*******************************************************************************
+*/
+
+size_t bashF2_deep()
+{
+	return utilMax(2, 384 * 2, bashF_deep());
+}
+
+void bashF2(octet block[384], void* stack)
+{
+	ASSERT(memIsValid(block, 384));
+	bashFN(block, 2, stack);
+}
+
+size_t bashF4_deep()
+{
+	return utilMax(2, 384 * 4, bashF_deep());
+}
+
+void bashF4(octet block[768], void* stack)
+{
+	ASSERT(memIsValid(block, 768));
+	bashFN(block, 4, stack);
+}
+
+size_t bashF8_deep()
+{
+	return utilMax(2, 384 * 8, bashF_deep());
+}
+
+void bashF8(octet block[1536], void* stack)
+{
+	ASSERT(memIsValid(block, 1536));
+	bashFN(block, 8, stack);
+}
@@ -4,7 +4,7 @@
 \brief STB 34.101.77 (bash): bash-f optimized for ARM NEON
 \project bee2 [cryptographic library]
 \created 2020.10.26
-\version 2021.03.26
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -305,7 +305,7 @@ Bash-f на памяти, выровненной на границу 8 байт,
 *******************************************************************************
 */
 
-static void bashF2(octet block[192], void* stack)
+static void bashFA(octet block[192], void* stack)
 {
 	register uint64x2_t Z1, Z2, T0, T1, T2, U0, U1, U2;
 	register uint64x2_t W0, W1, W2, W3, W4, W5, W6, W7, W8, W9, W10, W11;
@@ -344,8 +344,14 @@ void bashF(octet block_unaligned[192], void* stack)
 	octet *block_aligned = (octet*)((((uintptr_t)stack) + 7) & ~((uintptr_t)7));
 
 	ASSERT(memIsDisjoint2(block_unaligned, 192, stack, bashF_deep()));
+	// выровненный блок обрабатывается на месте
+	if (memIsAligned(block_unaligned, 8))
+	{
+		bashFA(block_unaligned, stack);
+		return;
+	}
 	memCopy(block_aligned, block_unaligned, 192);
-	bashF2(block_aligned, (octet*)stack + bashF_deep());
+	bashFA(block_aligned, (octet*)stack + bashF_deep());
 	memCopy(block_unaligned, block_aligned, 192);
 }
 
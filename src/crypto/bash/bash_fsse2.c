@@ -4,12 +4,19 @@
 \brief STB 34.101.77 (bash): bash-f optimized for SSE2
 \project bee2 [cryptographic library]
 \created 2019.07.12
-\version 2021.03.26
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#ifdef BASH_DISPATCH
+	#include "bee2/defs.h"
+	#define bashF bashFSSE2
+	#define bashF_deep bashFSSE2_deep
+	#define bashFA bashFASSE2
+#endif
+
 #ifndef __SSE2__
 	#error "The compiler does not support SSE2 intrinsics"
 #endif
@@ -395,7 +402,7 @@ Bash-f на выровненной памяти
 *******************************************************************************
 */
 
-void bashF2(octet block[192], void* stack)
+void bashFA(octet block[192], void* stack)
 {
 	register __m128i Z1, Z2, T0, T1, T2, U0, U1, U2;
 	register __m128i W0, W1, W2, W3, W4, W5, W6, W7, W8, W9, W10, W11;
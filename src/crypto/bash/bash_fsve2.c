@@ -0,0 +1,180 @@
+/*
+*******************************************************************************
+\file bash_fsve2.c
+\brief STB 34.101.77 (bash): bash-f optimized for ARM SVE2
+\project bee2 [cryptographic library]
+\created 2026.10.14
+\version 2026.10.14
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifdef BASH_DISPATCH
+	#include "bee2/defs.h"
+	#define bashF bashFSVE2
+	#define bashF_deep bashFSVE2_deep
+#endif
+
+#ifndef __ARM_FEATURE_SVE2
+	#error "The compiler does not support SVE2 intrinsics"
+#endif
+
+#if (OCTET_ORDER == BIG_ENDIAN)
+	#error "SVE2 implementation assumes little-endianness"
+#endif
+
+#include <arm_sve.h>
+
+#include "bee2/core/mem.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/bash.h"
+
+/*
+*******************************************************************************
+Сокращения для используемых intrinsic
+
+Длина векторного регистра SVE (VL) не известна при компиляции и
+составляет от 128 до 2048 битов. Поэтому строки состояния обрабатываются
+участками по svcntd() 64-разрядных слов под управлением предиката,
+который исключает лишние дорожки (слова за пределами строки).
+
+Нотация:
+- W (прописные буквы) -- векторный регистр (участок строки);
+- pg -- предикат активных дорожек.
+
+Циклические сдвиги слов участка выполняются на разное для разных
+дорожек число позиций. Поэтому вместо инструкции XAR используются
+сдвиги LSL и LSR на векторы сдвиговых констант.
+*******************************************************************************
+*/
+
+#define LOAD(s) svld1_u64(pg, (const uint64_t*)(s))
+#define STORE(s, W) svst1_u64(pg, (uint64_t*)(s), W)
+
+#define X2(W1, W2) sveor_u64_x(pg, W1, W2)
+#define X3(W1, W2, W3) sveor3_u64(W1, W2, W3)
+#define O2(W1, W2) svorr_u64_x(pg, W1, W2)
+#define A2(W1, W2) svand_u64_x(pg, W1, W2)
+#define NO2(W1, W2) svorr_u64_x(pg, svnot_u64_x(pg, W1), W2)
+
+#define R(W, M)\
+	svorr_u64_x(pg, svlsl_u64_x(pg, W, M),\
+		svlsr_u64_x(pg, W, svsubr_n_u64_x(pg, M, 64)))
+
+/*
+*******************************************************************************
+Тактовые константы, сдвиги, перестановка P
+
+Строки bash_m1, bash_n1, bash_m2, bash_n2 содержат сдвиговые константы
+bash-S для столбцов 0, 1,..., 7.
+
+Перестановка P реализуется сбором слов: после преобразования столбцов
+слово t[bash_pi[x]] становится словом s[x] (ср. с макросом P1 в bash_fn.c:
+bash_pi[x] = P1(x)).
+*******************************************************************************
+*/
+
+static const uint64_t bash_c[24] = {
+	0x3BF5080AC8BA94B1ull, 0xC1D1659C1BBD92F6ull, 0x60E8B2CE0DDEC97Bull,
+	0xEC5FB8FE790FBC13ull, 0xAA043DE6436706A7ull, 0x8929FF6A5E535BFDull,
+	0x98BF1E2C50C97550ull, 0x4C5F8F162864BAA8ull, 0x262FC78B14325D54ull,
+	0x1317E3C58A192EAAull, 0x098BF1E2C50C9755ull, 0xD8EE19681D669304ull,
+	0x6C770CB40EB34982ull, 0x363B865A0759A4C1ull, 0xC73622B47C4C0ACEull,
+	0x639B115A3E260567ull, 0xEDE6693460F3DA1Dull, 0xAAD8D5034F9935A0ull,
+	0x556C6A81A7CC9AD0ull, 0x2AB63540D3E64D68ull, 0x155B1AA069F326B4ull,
+	0x0AAD8D5034F9935Aull, 0x0556C6A81A7CC9ADull, 0xDE8082CD72DEBC78ull,
+};
+
+static const uint64_t bash_m1[8] = { 8, 56,  8, 56,  8, 56,  8, 56};
+static const uint64_t bash_n1[8] = {53, 51, 37,  3, 21, 19,  5, 35};
+static const uint64_t bash_m2[8] = {14, 34, 46,  2, 14, 34, 46,  2};
+static const uint64_t bash_n2[8] = { 1,  7, 49, 23, 33, 39, 17, 55};
+
+static const uint64_t bash_pi[24] = {
+	15, 10,  9, 12, 11, 14, 13,  8,
+	17, 16, 19, 18, 21, 20, 23, 22,
+	 6,  3,  0,  5,  2,  7,  4,  1,
+};
+
+/*
+*******************************************************************************
+Bash-S
+
+Макрос повторяет одноименный макрос из bash_fneon.c, но сдвиговые
+константы задаются векторами M1, N1, M2, N2.
+*******************************************************************************
+*/
+
+#define bashS(W0, W1, W2, M1, N1, M2, N2)\
+	Z2 = R(W0, M1);\
+	U0 = X3(W0, W1, W2);\
+	Z1 = X2(W1, R(U0, N1));\
+	U2 = X3(W2, R(W2, M2), R(Z1, N2));\
+	U1 = X2(Z1, Z2);\
+	T1 = O2(U0, U2);\
+	T2 = A2(U0, U1);\
+	T0 = NO2(U2, U1);\
+	W1 = X2(U1, T1);\
+	W2 = X2(U2, T2);\
+	W0 = X2(U0, T0)
+
+/*
+*******************************************************************************
+Такты
+*******************************************************************************
+*/
+
+static void bashFSVE2Round(uint64_t s[24], uint64_t t[24], size_t i)
+{
+	svbool_t pg;
+	svuint64_t W0, W1, W2, Z1, Z2, T0, T1, T2, U0, U1, U2;
+	uint64_t j;
+	// bash-S на столбцах
+	for (j = 0; j < 8; j += svcntd())
+	{
+		pg = svwhilelt_b64_u64(j, 8);
+		W0 = LOAD(s + j);
+		W1 = LOAD(s + 8 + j);
+		W2 = LOAD(s + 16 + j);
+		bashS(W0, W1, W2, LOAD(bash_m1 + j), LOAD(bash_n1 + j),
+			LOAD(bash_m2 + j), LOAD(bash_n2 + j));
+		STORE(t + j, W0);
+		STORE(t + 8 + j, W1);
+		STORE(t + 16 + j, W2);
+	}
+	// перестановка P
+	for (j = 0; j < 24; j += svcntd())
+	{
+		pg = svwhilelt_b64_u64(j, 24);
+		W0 = svld1_gather_u64index_u64(pg, t, LOAD(bash_pi + j));
+		STORE(s + j, W0);
+	}
+	// тактовая константа
+	s[23] ^= bash_c[i];
+}
+
+/*
+*******************************************************************************
+Bash-f
+
+Стек содержит состояние s[24] и вспомогательный буфер t[24].
+*******************************************************************************
+*/
+
+void bashF(octet block[192], void* stack)
+{
+	uint64_t* s = (uint64_t*)stack;
+	uint64_t* t = s + 24;
+	size_t i;
+	ASSERT(memIsDisjoint2(block, 192, stack, bashF_deep()));
+	memCopy(s, block, 192);
+	for (i = 0; i < 24; ++i)
+		bashFSVE2Round(s, t, i);
+	memCopy(block, s, 192);
+}
+
+size_t bashF_deep()
+{
+	return 2 * 192;
+}
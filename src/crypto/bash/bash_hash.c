@@ -4,7 +4,7 @@
 \brief STB 34.101.77 (bash): hashing algorithms
 \project bee2 [cryptographic library]
 \created 2014.07.15
-\version 2021.02.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -19,6 +19,9 @@
 /*
 *******************************************************************************
 Хэширование
+
+Поля s и s1 размещаются по смещениям, кратным 64. Поэтому при выравнивании
+состояния на границу MEM_ALIGN bash-f обрабатывает выровненную память.
 *******************************************************************************
 */
 
@@ -60,24 +63,34 @@ void bashHashStepH(const void* buf, size_t count, void* state)
 		st->pos += count;
 		return;
 	}
-	// новый полный буфер
-	memCopy(st->s + st->pos, buf, st->buf_len - st->pos);
-	buf = (const octet*)buf + st->buf_len - st->pos;
-	count -= st->buf_len - st->pos;
-	bashF(st->s, st->stack);
-	// цикл по полным блокам
-	while (count >= st->buf_len)
+	// завершить накопленный буфер
+	if (st->pos)
 	{
-		memCopy(st->s, buf, st->buf_len);
-		buf = (const octet*)buf + st->buf_len;
-		count -= st->buf_len;
+		memCopy(st->s + st->pos, buf, st->buf_len - st->pos);
+		buf = (const octet*)buf + st->buf_len - st->pos;
+		count -= st->buf_len - st->pos;
 		bashF(st->s, st->stack);
 	}
+	// полные блоки: загрузка непосредственно из buf
+	if (count >= st->buf_len)
+	{
+		size_t len = count - count % st->buf_len;
+		bashFAbsorb(st->s, buf, len, st->buf_len, st->stack);
+		buf = (const octet*)buf + len;
+		count -= len;
+	}
 	// неполный блок?
 	if (st->pos = count)
 		memCopy(st->s, buf, count);
 }
 
+void bashHashStepHv(const mem_vec_t vec[], size_t n, void* state)
+{
+	ASSERT(memIsValid(vec, n * sizeof(mem_vec_t)));
+	for (; n--; ++vec)
+		bashHashStepH(vec->buf, vec->count, state);
+}
+
 static void bashHashStepG_internal(size_t hash_len, void* state)
 {
 	bash_hash_st* st = (bash_hash_st*)state;
@@ -115,6 +128,56 @@ bool_t bashHashStepV(const octet hash[], size_t hash_len, void* state)
 	return memEq(hash, st->s1, hash_len);
 }
 
+/*
+*******************************************************************************
+Сохранение и восстановление состояния
+
+Формат сохраненного состояния (196 октетов):
+-	[1] идентификатор BASH_HASH_SAVE_ID;
+-	[1] версия формата BASH_HASH_SAVE_VER;
+-	[1] l / 16, где l -- уровень стойкости;
+-	[1] pos -- число накопленных в буфере октетов;
+-	[192] s -- состояние sponge-функции.
+
+Длина буфера buf_len однозначно определяется по l. Копия s1 и стек
+не сохраняются.
+*******************************************************************************
+*/
+
+#define BASH_HASH_SAVE_ID	0x42	/* 'B' */
+#define BASH_HASH_SAVE_VER	1
+
+void bashHashSave(octet buf[196], const void* state)
+{
+	const bash_hash_st* st = (const bash_hash_st*)state;
+	ASSERT(memIsValid(st, bashHash_keep()));
+	ASSERT(memIsDisjoint2(buf, 196, st, bashHash_keep()));
+	buf[0] = BASH_HASH_SAVE_ID;
+	buf[1] = BASH_HASH_SAVE_VER;
+	buf[2] = (octet)((192 - st->buf_len) / 8);
+	buf[3] = (octet)st->pos;
+	memCopy(buf + 4, st->s, 192);
+}
+
+err_t bashHashLoad(void* state, const octet buf[196])
+{
+	bash_hash_st* st = (bash_hash_st*)state;
+	size_t l;
+	// проверить входные данные
+	if (!memIsValid(buf, 196) || !memIsValid(state, bashHash_keep()))
+		return ERR_BAD_INPUT;
+	// разобрать заголовок
+	l = 16 * (size_t)buf[2];
+	if (buf[0] != BASH_HASH_SAVE_ID || buf[1] != BASH_HASH_SAVE_VER ||
+		l == 0 || l > 256 || buf[3] >= 192 - l / 2)
+		return ERR_BAD_FORMAT;
+	// восстановить состояние
+	memMove(st->s, buf + 4, 192);
+	st->buf_len = 192 - l / 2;
+	st->pos = buf[3];
+	return ERR_OK;
+}
+
 err_t bashHash(octet hash[], size_t l, const void* src, size_t count)
 {
 	void* state;
@@ -135,3 +198,79 @@ err_t bashHash(octet hash[], size_t l, const void* src, size_t count)
 	blobClose(state);
 	return ERR_OK;
 }
+
+/*
+*******************************************************************************
+Хэширование нескольких сообщений
+
+Сообщения обрабатываются группами по 8. Состояния группы размещаются
+подряд и преобразуются одним вызовом bashF8(). На такте t в состояние
+сообщения src[j] загружается t-й полный блок, если он есть, либо последний
+(дополненный) блок, после чего хэш-значение src[j] снимается со состояния.
+Состояния сообщений, которые обработаны раньше других, и неиспользуемые
+состояния неполной группы продолжают преобразовываться вхолостую.
+*******************************************************************************
+*/
+
+err_t bashHashMulti(octet hash[], size_t l, size_t n, const void* src[],
+	const size_t count[])
+{
+	const size_t buf_len = 192 - l / 2;
+	octet* s;
+	void* stack;
+	size_t t, steps, j, k;
+	// проверить входные данные
+	if (l == 0 || l % 16 != 0 || l > 256)
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(src, sizeof(const void*) * n) ||
+		!memIsValid(count, sizeof(size_t) * n) ||
+		!memIsValid(hash, l / 4 * n))
+		return ERR_BAD_INPUT;
+	for (j = 0; j < n; ++j)
+		if (!memIsValid(src[j], count[j]))
+			return ERR_BAD_INPUT;
+	// одно сообщение?
+	if (n == 1)
+		return bashHash(hash, l, src[0], count[0]);
+	// создать состояние
+	s = (octet*)blobCreate(192 * 8 + bashF8_deep());
+	if (s == 0)
+		return ERR_OUTOFMEMORY;
+	stack = s + 192 * 8;
+	// цикл по группам
+	for (; n; n -= k, src += k, count += k, hash += l / 4 * k)
+	{
+		k = MIN2(n, 8);
+		// s[j] <- 0^{1536 - 64} || <l / 4>_{64}
+		memSetZero(s, 192 * 8);
+		for (j = 0; j < k; ++j)
+			s[192 * j + 192 - 8] = (octet)(l / 4);
+		// число тактов
+		for (steps = j = 0; j < k; ++j)
+			steps = MAX2(steps, count[j] / buf_len);
+		// такты
+		for (t = 0; t <= steps; ++t)
+		{
+			for (j = 0; j < k; ++j)
+				// полный блок?
+				if (t < count[j] / buf_len)
+					memCopy(s + 192 * j, (const octet*)src[j] + t * buf_len,
+						buf_len);
+				// последний блок?
+				else if (t == count[j] / buf_len)
+				{
+					size_t r = count[j] % buf_len;
+					memCopy(s + 192 * j, (const octet*)src[j] + t * buf_len, r);
+					memSetZero(s + 192 * j + r, buf_len - r);
+					s[192 * j + r] = 0x40;
+				}
+			bashF8(s, stack);
+			for (j = 0; j < k; ++j)
+				if (t == count[j] / buf_len)
+					memCopy(hash + l / 4 * j, s + 192 * j, l / 4);
+		}
+	}
+	// завершить
+	blobClose(s);
+	return ERR_OK;
+}
@@ -0,0 +1,214 @@
+/*
+*******************************************************************************
+\file bash_md.c
+\brief STB 34.101.77 (bash): multi-digest hashing
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/blob.h"
+#include "bee2/core/err.h"
+#include "bee2/core/mem.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/bash.h"
+#include "bee2/crypto/belt.h"
+
+/*
+*******************************************************************************
+Состояние
+
+Состояние содержит число алгоритмов n, их идентификаторы alg[n] и n слотов
+одинаковой длины, в которых размещаются состояния алгоритмов. Длина слота
+выбирается по наибольшему из состояний beltHash, beltMAC, bashHash и
+округляется вверх до длины кэш-линии. Смещения слотов также кратны длине
+кэш-линии, поэтому при выровненном state (например, созданном функцией
+blobCreate()) состояния разных алгоритмов не делят линии.
+
+Состояние не содержит указателей и может копироваться побайтово.
+
+Фрагменты данных обрабатываются порциями по BASH_MD_PORTION октетов:
+порция прочитывается из памяти первым алгоритмом и остается в кэше L1,
+пока ее обрабатывают остальные алгоритмы. Длина порции кратна длинам
+блоков belt (16, 32 октета) и bash стандартных уровней (128, 96, 64 октета),
+поэтому разбиение на порции не приводит к дополнительному буферизованию
+в состояниях этих алгоритмов.
+*******************************************************************************
+*/
+
+#define BASH_MD_LINE 64
+#define BASH_MD_PORTION ((size_t)24576)
+
+typedef struct
+{
+	size_t n;			/*< число алгоритмов */
+	size_t slot;		/*< длина слота */
+	size_t hdr;			/*< смещение первого слота */
+	size_t alg[];		/*< идентификаторы алгоритмов */
+} bash_md_st;
+
+#define bashMDState(st, i) ((octet*)(st) + (st)->hdr + (i) * (st)->slot)
+
+static size_t bashMDSlot()
+{
+	size_t slot = MAX2(beltHash_keep(), beltMAC_keep());
+	slot = MAX2(slot, bashHash_keep());
+	return (slot + BASH_MD_LINE - 1) / BASH_MD_LINE * BASH_MD_LINE;
+}
+
+static size_t bashMDHdr(size_t n)
+{
+	size_t hdr = sizeof(bash_md_st) + n * sizeof(size_t);
+	return (hdr + BASH_MD_LINE - 1) / BASH_MD_LINE * BASH_MD_LINE;
+}
+
+size_t bashMD_keep(size_t n)
+{
+	return bashMDHdr(n) + n * bashMDSlot();
+}
+
+static bool_t bashMDAlgIsValid(size_t alg)
+{
+	return alg == BASH_MD_BELT_HASH || alg == BASH_MD_BELT_MAC ||
+		(alg % 16 == 0 && alg <= 256);
+}
+
+static size_t bashMDAlgLen(size_t alg)
+{
+	if (alg == BASH_MD_BELT_HASH)
+		return 32;
+	if (alg == BASH_MD_BELT_MAC)
+		return 8;
+	return alg / 4;
+}
+
+size_t bashMDLen(size_t n, const size_t alg[])
+{
+	size_t len = 0;
+	ASSERT(memIsValid(alg, n * sizeof(size_t)));
+	for (; n--; ++alg)
+	{
+		if (!bashMDAlgIsValid(*alg))
+			return SIZE_MAX;
+		len += bashMDAlgLen(*alg);
+	}
+	return len;
+}
+
+/*
+*******************************************************************************
+Связка
+*******************************************************************************
+*/
+
+err_t bashMDStart(void* state, size_t n, const size_t alg[],
+	const octet key[], size_t len)
+{
+	bash_md_st* st = (bash_md_st*)state;
+	size_t i;
+	// проверить входные данные
+	if (n == 0 || !memIsValid(alg, n * sizeof(size_t)) ||
+		!memIsValid(st, bashMD_keep(n)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < n; ++i)
+	{
+		if (!bashMDAlgIsValid(alg[i]))
+			return ERR_BAD_PARAMS;
+		if (alg[i] == BASH_MD_BELT_MAC &&
+			((len != 16 && len != 24 && len != 32) ||
+			!memIsValid(key, len)))
+			return ERR_BAD_INPUT;
+	}
+	// разметить состояние
+	st->n = n;
+	st->slot = bashMDSlot();
+	st->hdr = bashMDHdr(n);
+	memCopy(st->alg, alg, n * sizeof(size_t));
+	// запустить алгоритмы
+	for (i = 0; i < n; ++i)
+	{
+		void* s = bashMDState(st, i);
+		if (alg[i] == BASH_MD_BELT_HASH)
+			beltHashStart(s);
+		else if (alg[i] == BASH_MD_BELT_MAC)
+			beltMACStart(s, key, len);
+		else
+			bashHashStart(s, alg[i]);
+	}
+	return ERR_OK;
+}
+
+void bashMDStepH(const void* buf, size_t count, void* state)
+{
+	bash_md_st* st = (bash_md_st*)state;
+	size_t i;
+	ASSERT(memIsValid(st, bashMD_keep(st->n)));
+	ASSERT(memIsValid(buf, count));
+	while (count)
+	{
+		size_t portion = MIN2(count, BASH_MD_PORTION);
+		for (i = 0; i < st->n; ++i)
+		{
+			void* s = bashMDState(st, i);
+			if (st->alg[i] == BASH_MD_BELT_HASH)
+				beltHashStepH(buf, portion, s);
+			else if (st->alg[i] == BASH_MD_BELT_MAC)
+				beltMACStepA(buf, portion, s);
+			else
+				bashHashStepH(buf, portion, s);
+		}
+		buf = (const octet*)buf + portion;
+		count -= portion;
+	}
+}
+
+void bashMDStepG(octet hash[], void* state)
+{
+	bash_md_st* st = (bash_md_st*)state;
+	size_t i;
+	ASSERT(memIsValid(st, bashMD_keep(st->n)));
+	ASSERT(memIsValid(hash, bashMDLen(st->n, st->alg)));
+	for (i = 0; i < st->n; ++i)
+	{
+		void* s = bashMDState(st, i);
+		if (st->alg[i] == BASH_MD_BELT_HASH)
+			beltHashStepG(hash, s);
+		else if (st->alg[i] == BASH_MD_BELT_MAC)
+			beltMACStepG(hash, s);
+		else
+			bashHashStepG(hash, st->alg[i] / 4, s);
+		hash += bashMDAlgLen(st->alg[i]);
+	}
+}
+
+err_t bashMD(octet hash[], size_t n, const size_t alg[], const octet key[],
+	size_t len, const void* src, size_t count)
+{
+	err_t code;
+	void* state;
+	size_t hash_len;
+	// проверить входные данные
+	if (n == 0 || !memIsValid(alg, n * sizeof(size_t)))
+		return ERR_BAD_INPUT;
+	if ((hash_len = bashMDLen(n, alg)) == SIZE_MAX)
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(hash, hash_len) || !memIsValid(src, count))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bashMD_keep(n));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// хэшировать
+	code = bashMDStart(state, n, alg, key, len);
+	if (code == ERR_OK)
+	{
+		bashMDStepH(src, count, state);
+		bashMDStepG(hash, state);
+	}
+	// завершить
+	blobClose(state);
+	return code;
+}
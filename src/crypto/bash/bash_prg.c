@@ -4,14 +4,17 @@
 \brief STB 34.101.77 (bash): programmable algorithms
 \project bee2 [cryptographic library]
 \created 2018.10.30
-\version 2020.08.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/core/blob.h"
+#include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/u64.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/bash.h"
 
@@ -45,6 +48,10 @@
 
 6-битовые коды NULL, KEY, DATA, TEXT, OUT дополнены (справа) парой битов 01
 и объявлены как BASH_PRG_XXX.
+
+Поля s и t состояния размещаются по смещениям, кратным 64. Поэтому при
+выравнивании состояния на границу MEM_ALIGN bash-f обрабатывает выровненную
+память.
 *******************************************************************************
 */
 
@@ -55,12 +62,12 @@
 #define BASH_PRG_OUT		0x11	/* 000100 01 */
 
 typedef struct {
+	octet s[192];		/*< состояние */
+	octet t[192];		/*< копия состояния (для ratchet) */
 	size_t l;			/*< уровень стойкости */
 	size_t d;			/*< емкость */
-	octet s[192];		/*< состояние */
 	size_t buf_len;		/*< длина буфера */
 	size_t pos;			/*< позиция в буфере */
-	octet t[192];		/*< копия состояния (для ratchet) */
 	octet stack[];		/*< [bashF_deep()] стек bashF */
 } bash_prg_st;
 
@@ -83,6 +90,49 @@ static bool_t bashPrgIsKeymode(const void* state)
 	return 16 * (192 - st->buf_len) == st->l * (2 + st->d);
 }
 
+/*
+*******************************************************************************
+Зашифрование и расшифрование за один проход
+
+Функция bashPrgXorCopy() выполняет действия s ^= buf, buf <- s,
+функция bashPrgCopyXor() -- действия buf ^= s, s ^= buf (s получает
+исходное содержимое buf). Каждое слово буфера читается и записывается
+однократно, без промежуточного копирования.
+*******************************************************************************
+*/
+
+static void bashPrgXorCopy(octet s[], void* buf, size_t count)
+{
+	for (; count >= O_PER_W; count -= O_PER_W)
+	{
+		*(word*)buf = *(word*)s ^= *(const word*)buf;
+		s += O_PER_W, buf = (octet*)buf + O_PER_W;
+	}
+	while (count--)
+	{
+		*(octet*)buf = *s ^= *(const octet*)buf;
+		++s, buf = (octet*)buf + 1;
+	}
+}
+
+static void bashPrgCopyXor(octet s[], void* buf, size_t count)
+{
+	for (; count >= O_PER_W; count -= O_PER_W)
+	{
+		register word w = *(const word*)buf;
+		*(word*)buf = w ^ *(const word*)s;
+		*(word*)s = w;
+		s += O_PER_W, buf = (octet*)buf + O_PER_W;
+	}
+	while (count--)
+	{
+		register octet o = *(const octet*)buf;
+		*(octet*)buf = o ^ *s;
+		*s = o;
+		++s, buf = (octet*)buf + 1;
+	}
+}
+
 /*
 *******************************************************************************
 Commit: завершить предыдущую команду и начать новую с кодом code
@@ -171,6 +221,22 @@ void bashPrgRestart(const octet ann[], size_t ann_len,
 	memXor2(st->s + 1 + ann_len, key, key_len);
 }
 
+/*
+*******************************************************************************
+Clone: копировать
+
+Копируются все поля bash_prg_st, кроме стека: sizeof(bash_prg_st)
+не учитывает гибкое поле stack.
+*******************************************************************************
+*/
+
+void bashPrgClone(void* dest, const void* src)
+{
+	ASSERT(memIsValid(src, bashPrg_keep()));
+	ASSERT(memIsDisjoint2(dest, bashPrg_keep(), src, bashPrg_keep()));
+	memCopy(dest, src, sizeof(bash_prg_st));
+}
+
 /*
 *******************************************************************************
 Absorb: загрузить
@@ -282,32 +348,26 @@ void bashPrgEncrStep(void* buf, size_t count, void* state)
 	// остатка буфера достаточно?
 	if (count < st->buf_len - st->pos)
 	{
-		memXor2(st->s + st->pos, buf, count);
-		memCopy(buf, st->s + st->pos, count);
+		bashPrgXorCopy(st->s + st->pos, buf, count);
 		st->pos += count;
 		return;
 	}
 	// новый буфер
-	memXor2(st->s + st->pos, buf, st->buf_len - st->pos);
-	memCopy(buf, st->s + st->pos, st->buf_len - st->pos);
+	bashPrgXorCopy(st->s + st->pos, buf, st->buf_len - st->pos);
 	buf = (octet*)buf + st->buf_len - st->pos;
 	count -= st->buf_len - st->pos;
 	bashF(st->s, st->stack);
 	// цикл по полным блокам
 	while (count >= st->buf_len)
 	{
-		memXor2(st->s, buf, st->buf_len);
-		memCopy(buf, st->s, st->buf_len);
+		bashPrgXorCopy(st->s, buf, st->buf_len);
 		buf = (octet*)buf + st->buf_len;
 		count -= st->buf_len;
 		bashF(st->s, st->stack);
 	}
 	// неполный блок
 	if (st->pos = count)
-	{
-		memXor2(st->s, buf, count);
-		memCopy(buf, st->s, count);
-	}
+		bashPrgXorCopy(st->s, buf, count);
 }
 
 void bashPrgEncr(void* buf, size_t count, void* state)
@@ -335,32 +395,26 @@ void bashPrgDecrStep(void* buf, size_t count, void* state)
 	// остатка буфера достаточно?
 	if (count < st->buf_len - st->pos)
 	{
-		memXor2(buf, st->s + st->pos, count);
-		memXor2(st->s + st->pos, buf, count);
+		bashPrgCopyXor(st->s + st->pos, buf, count);
 		st->pos += count;
 		return;
 	}
 	// новый буфер
-	memXor2(buf, st->s + st->pos, st->buf_len - st->pos);
-	memXor2(st->s + st->pos, buf, st->buf_len - st->pos);
+	bashPrgCopyXor(st->s + st->pos, buf, st->buf_len - st->pos);
 	buf = (octet*)buf + st->buf_len - st->pos;
 	count -= st->buf_len - st->pos;
 	bashF(st->s, st->stack);
 	// цикл по полным блокам
 	while (count >= st->buf_len)
 	{
-		memXor2(buf, st->s, st->buf_len);
-		memXor2(st->s, buf, st->buf_len);
+		bashPrgCopyXor(st->s, buf, st->buf_len);
 		buf = (octet*)buf + st->buf_len;
 		count -= st->buf_len;
 		bashF(st->s, st->stack);
 	}
 	// неполный блок
 	if (st->pos = count)
-	{
-		memXor2(buf, st->s, count);
-		memXor2(st->s, buf, count);
-	}
+		bashPrgCopyXor(st->s, buf, count);
 }
 
 void bashPrgDecr(void* buf, size_t count, void* state)
@@ -386,3 +440,432 @@ void bashPrgRatchet(void* state)
 	// необратимо изменить
 	memXor2(st->s, st->t, 192);
 }
+
+/*
+*******************************************************************************
+AEAD: аутентифицированное шифрование
+
+Последовательность команд: start(ann, key), absorb(src2), encr(src1)
+(или decr), squeeze(mac). Длина имитовставки -- l / 8 октетов.
+При снятии защиты данные расшифровываются до проверки имитовставки
+(имитовставка вырабатывается после расшифрования). Поэтому при ошибке
+проверки расшифрованные данные обнуляются.
+*******************************************************************************
+*/
+
+static err_t bashPrgAEADCheck(size_t l, size_t d, const octet ann[],
+	size_t ann_len, const octet key[], size_t key_len)
+{
+	if (l != 128 && l != 192 && l != 256 || d != 1 && d != 2)
+		return ERR_BAD_PARAMS;
+	if (ann_len % 4 != 0 || ann_len > 60 ||
+		key_len % 4 != 0 || key_len > 60 || key_len < l / 8 ||
+		!memIsValid(ann, ann_len) || !memIsValid(key, key_len))
+		return ERR_BAD_INPUT;
+	return ERR_OK;
+}
+
+err_t bashPrgAEADWrap(void* dest, octet mac[], size_t l, size_t d,
+	const void* src1, size_t count1, const void* src2, size_t count2,
+	const octet ann[], size_t ann_len, const octet key[], size_t key_len)
+{
+	void* state;
+	err_t code;
+	// проверить входные данные
+	code = bashPrgAEADCheck(l, d, ann, ann_len, key, key_len);
+	ERR_CALL_CHECK(code);
+	if (!memIsValid(src1, count1) ||
+		!memIsValid(src2, count2) ||
+		!memIsValid(dest, count1) ||
+		!memIsValid(mac, l / 8) ||
+		!memIsDisjoint2(dest, count1, mac, l / 8))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bashPrg_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// установить защиту
+	bashPrgStart(state, l, d, ann, ann_len, key, key_len);
+	bashPrgAbsorb(src2, count2, state);
+	memMove(dest, src1, count1);
+	bashPrgEncr(dest, count1, state);
+	bashPrgSqueeze(mac, l / 8, state);
+	// завершить
+	blobClose(state);
+	return ERR_OK;
+}
+
+err_t bashPrgAEADUnwrap(void* dest, size_t l, size_t d, const void* src1,
+	size_t count1, const void* src2, size_t count2, const octet mac[],
+	const octet ann[], size_t ann_len, const octet key[], size_t key_len)
+{
+	void* state;
+	octet* mac1;
+	err_t code;
+	// проверить входные данные
+	code = bashPrgAEADCheck(l, d, ann, ann_len, key, key_len);
+	ERR_CALL_CHECK(code);
+	if (!memIsValid(src1, count1) ||
+		!memIsValid(src2, count2) ||
+		!memIsValid(mac, l / 8) ||
+		!memIsValid(dest, count1))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bashPrg_keep() + 32);
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	mac1 = (octet*)state + bashPrg_keep();
+	// снять защиту
+	bashPrgStart(state, l, d, ann, ann_len, key, key_len);
+	bashPrgAbsorb(src2, count2, state);
+	memMove(dest, src1, count1);
+	bashPrgDecr(dest, count1, state);
+	bashPrgSqueeze(mac1, l / 8, state);
+	if (!memEq(mac, mac1, l / 8))
+	{
+		memSetZero(dest, count1);
+		blobClose(state);
+		return ERR_BAD_MAC;
+	}
+	// завершить
+	blobClose(state);
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Поблочная защита
+
+Состояние поблочной защиты -- это пара автоматов: M (после команд start,
+absorb) и рабочий автомат. 
+
+Фрагмент i обрабатывается копией M, которая выполняет команды 
+restart(<i>_64 || <last>_32), encr (или decr), squeeze. Первая часть 
+restart -- завершение команды absorb -- не зависит от i. Поэтому при 
+групповой обработке она выполняется один раз (автомат W), после чего 
+состояния фрагментов группы отличаются только анонсами restart.
+
+В функции bashPrgChunkGroup() до 8 фрагментов группы обрабатываются 
+одновременно: их состояния размещаются подряд и преобразуются одним 
+вызовом bashF8(). На такте t в состояние фрагмента j загружается t-й 
+полный блок, если он есть, либо последний неполный блок и код команды 
+squeeze, после чего имитовставка фрагмента снимается с состояния (так же 
+устроена функция bashHashMulti()). 
+*******************************************************************************
+*/
+
+size_t bashPrgChunkCount(size_t count, size_t chunk_len)
+{
+	ASSERT(chunk_len > 0);
+	return count ? (count + chunk_len - 1) / chunk_len : 1;
+}
+
+size_t bashPrgChunk_keep()
+{
+	return 2 * bashPrg_keep();
+}
+
+static void bashPrgChunkAnn(octet ann[12], size_t i, bool_t last)
+{
+	u64 w = (u64)i;
+	u64To(ann, 8, &w);
+	memSetZero(ann + 8, 4);
+	ann[8] = last ? 1 : 0;
+}
+
+void bashPrgChunkStart(void* state, size_t l, size_t d, size_t chunk_len,
+	const void* src2, size_t count2, const octet ann[], size_t ann_len,
+	const octet key[], size_t key_len)
+{
+	octet len[8];
+	u64 w = (u64)chunk_len;
+	ASSERT(chunk_len > 0);
+	ASSERT(key_len >= l / 8);
+	// M <- start(ann, key), absorb(<chunk_len>_64 || src2)
+	bashPrgStart(state, l, d, ann, ann_len, key, key_len);
+	u64To(len, 8, &w);
+	bashPrgAbsorbStart(state);
+	bashPrgAbsorbStep(len, 8, state);
+	bashPrgAbsorbStep(src2, count2, state);
+}
+
+static void* bashPrgChunkClone(size_t i, bool_t last, void* state)
+{
+	void* st = (octet*)state + bashPrg_keep();
+	octet ann[12];
+	bashPrgClone(st, state);
+	bashPrgChunkAnn(ann, i, last);
+	bashPrgRestart(ann, 12, 0, 0, st);
+	return st;
+}
+
+void bashPrgChunkEncr(void* buf, size_t count, size_t i, bool_t last,
+	octet tag[], void* state)
+{
+	void* st;
+	ASSERT(memIsValid(state, bashPrgChunk_keep()));
+	ASSERT(memIsValid(tag, ((bash_prg_st*)state)->l / 8));
+	st = bashPrgChunkClone(i, last, state);
+	bashPrgEncr(buf, count, st);
+	bashPrgSqueeze(tag, ((bash_prg_st*)st)->l / 8, st);
+}
+
+bool_t bashPrgChunkDecr(void* buf, size_t count, size_t i, bool_t last,
+	const octet tag[], void* state)
+{
+	bash_prg_st* st;
+	octet tag1[32];
+	bool_t ret;
+	ASSERT(memIsValid(state, bashPrgChunk_keep()));
+	ASSERT(memIsValid(tag, ((bash_prg_st*)state)->l / 8));
+	st = (bash_prg_st*)bashPrgChunkClone(i, last, state);
+	bashPrgDecr(buf, count, st);
+	bashPrgSqueeze(tag1, st->l / 8, st);
+	ret = memEq(tag, tag1, st->l / 8);
+	if (!ret)
+		memSetZero(buf, count);
+	memSetZero(tag1, sizeof(tag1));
+	return ret;
+}
+
+void bashPrgChunkStepG(octet mac[], const octet tags[], size_t n,
+	void* state)
+{
+	void* st = (octet*)state + bashPrg_keep();
+	ASSERT(memIsValid(state, bashPrgChunk_keep()));
+	bashPrgClone(st, state);
+	bashPrgAbsorb(tags, n * ((bash_prg_st*)st)->l / 8, st);
+	bashPrgSqueeze(mac, ((bash_prg_st*)st)->l / 8, st);
+}
+
+bool_t bashPrgChunkStepV(const octet mac[], const octet tags[], size_t n,
+	void* state)
+{
+	octet mac1[32];
+	bool_t ret;
+	bashPrgChunkStepG(mac1, tags, n, state);
+	ret = memEq(mac, mac1, ((bash_prg_st*)state)->l / 8);
+	memSetZero(mac1, sizeof(mac1));
+	return ret;
+}
+
+/*
+*******************************************************************************
+Поблочная защита: параллельная обработка
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const bash_prg_st* w;	/*< автомат W */
+	octet* buf;				/*< данные */
+	size_t count;			/*< длина данных */
+	size_t chunk_len;		/*< длина фрагментов */
+	size_t n;				/*< число фрагментов */
+	octet* tags;			/*< имитовставки фрагментов (выход encr) */
+	const octet* tags_in;	/*< имитовставки фрагментов (вход decr) */
+	bool_t decr;			/*< расшифрование? */
+	size_t bad;				/*< число ошибок проверки */
+	size_t fail;			/*< число ошибок выделения памяти */
+} bash_prg_chunk_par;
+
+static void bashPrgChunkGroup(const bash_prg_chunk_par* par, size_t g,
+	octet s[1536], void* stack, bool_t* ok)
+{
+	const size_t buf_len = par->w->buf_len;
+	const size_t tag_len = par->w->l / 8;
+	size_t count[8];
+	octet* buf[8];
+	size_t k, j, t, steps;
+	octet ann[12];
+	// подготовить состояния
+	k = MIN2(par->n - 8 * g, 8);
+	for (steps = j = 0; j < k; ++j)
+	{
+		size_t i = 8 * g + j;
+		buf[j] = par->buf + i * par->chunk_len;
+		count[j] = (i + 1 < par->n) ? par->chunk_len :
+			par->count - i * par->chunk_len;
+		steps = MAX2(steps, count[j] / buf_len);
+		// restart(<i>_64 || <last>_32), начало encr / decr
+		memCopy(s + 192 * j, par->w->s, 192);
+		bashPrgChunkAnn(ann, i, i + 1 == par->n);
+		s[192 * j] ^= (octet)(12 * 4);
+		memXor2(s + 192 * j + 1, ann, 12);
+		s[192 * j + 13] ^= BASH_PRG_TEXT;
+		s[192 * j + buf_len] ^= 0x80;
+	}
+	bashF8(s, stack);
+	// такты
+	for (t = 0; t <= steps; ++t)
+	{
+		for (j = 0; j < k; ++j)
+			// полный блок?
+			if (t < count[j] / buf_len)
+			{
+				if (par->decr)
+					bashPrgCopyXor(s + 192 * j, buf[j] + t * buf_len, 
+						buf_len);
+				else
+					bashPrgXorCopy(s + 192 * j, buf[j] + t * buf_len, 
+						buf_len);
+			}
+			// последний блок: squeeze
+			else if (t == count[j] / buf_len)
+			{
+				size_t r = count[j] % buf_len;
+				if (par->decr)
+					bashPrgCopyXor(s + 192 * j, buf[j] + t * buf_len, r);
+				else
+					bashPrgXorCopy(s + 192 * j, buf[j] + t * buf_len, r);
+				s[192 * j + r] ^= BASH_PRG_OUT;
+				s[192 * j + buf_len] ^= 0x80;
+			}
+		bashF8(s, stack);
+		for (j = 0; j < k; ++j)
+			if (t == count[j] / buf_len)
+			{
+				const size_t pos = (8 * g + j) * tag_len;
+				if (!par->decr)
+					memCopy(par->tags + pos, s + 192 * j, tag_len);
+				else if (!memEq(par->tags_in + pos, s + 192 * j, tag_len))
+					*ok = FALSE;
+			}
+	}
+}
+
+static void bashPrgChunkRange(size_t from, size_t to, void* arg)
+{
+	bash_prg_chunk_par* par = (bash_prg_chunk_par*)arg;
+	octet* s;
+	bool_t ok = TRUE;
+	// создать состояния
+	s = (octet*)blobCreate(192 * 8 + bashF8_deep());
+	if (s == 0)
+	{
+		mtAtomicIncr(&par->fail);
+		return;
+	}
+	// обработать группы
+	for (; from < to; ++from)
+		bashPrgChunkGroup(par, from, s, s + 192 * 8, &ok);
+	if (!ok)
+		mtAtomicIncr(&par->bad);
+	// завершить
+	blobClose(s);
+}
+
+static err_t bashPrgChunkCheck(size_t l, size_t d, size_t chunk_len,
+	size_t count1, const octet ann[], size_t ann_len, const octet key[],
+	size_t key_len)
+{
+	err_t code;
+	code = bashPrgAEADCheck(l, d, ann, ann_len, key, key_len);
+	ERR_CALL_CHECK(code);
+	if (chunk_len == 0 ||
+		bashPrgChunkCount(count1, chunk_len) > SIZE_MAX / (l / 8))
+		return ERR_BAD_INPUT;
+	return ERR_OK;
+}
+
+static err_t bashPrgChunkRun(bash_prg_chunk_par* par, void* state)
+{
+	bash_prg_st* w = (bash_prg_st*)((octet*)state + bashPrg_keep());
+	// W <- M, завершить absorb
+	bashPrgClone(w, state);
+	bashPrgCommit(BASH_PRG_NULL, w);
+	// обработать группы фрагментов
+	par->w = w;
+	par->n = bashPrgChunkCount(par->count, par->chunk_len);
+	par->bad = par->fail = 0;
+	mtPoolFor(0, (par->n + 7) / 8, bashPrgChunkRange, par);
+	if (par->fail)
+		return ERR_OUTOFMEMORY;
+	return par->bad ? ERR_BAD_MAC : ERR_OK;
+}
+
+err_t bashPrgChunkWrap(void* dest, octet tags[], octet mac[], size_t l, 
+	size_t d, size_t chunk_len, const void* src1, size_t count1, 
+	const void* src2, size_t count2, const octet ann[], size_t ann_len, 
+	const octet key[], size_t key_len)
+{
+	bash_prg_chunk_par par[1];
+	void* state;
+	size_t n;
+	err_t code;
+	// проверить входные данные
+	code = bashPrgChunkCheck(l, d, chunk_len, count1, ann, ann_len, key, 
+		key_len);
+	ERR_CALL_CHECK(code);
+	n = bashPrgChunkCount(count1, chunk_len);
+	if (!memIsValid(src1, count1) ||
+		!memIsValid(src2, count2) ||
+		!memIsValid(dest, count1) ||
+		!memIsValid(tags, n * l / 8) ||
+		!memIsValid(mac, l / 8) ||
+		!memIsDisjoint3(dest, count1, tags, n * l / 8, mac, l / 8))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bashPrgChunk_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// установить защиту
+	bashPrgChunkStart(state, l, d, chunk_len, src2, count2, ann, ann_len,
+		key, key_len);
+	memMove(dest, src1, count1);
+	par->buf = (octet*)dest, par->count = count1;
+	par->chunk_len = chunk_len, par->tags = tags, par->tags_in = 0;
+	par->decr = FALSE;
+	code = bashPrgChunkRun(par, state);
+	if (code == ERR_OK)
+		bashPrgChunkStepG(mac, tags, n, state);
+	// завершить
+	blobClose(state);
+	return code;
+}
+
+err_t bashPrgChunkUnwrap(void* dest, size_t l, size_t d, size_t chunk_len,
+	const void* src1, size_t count1, const void* src2, size_t count2,
+	const octet tags[], const octet mac[], const octet ann[], 
+	size_t ann_len, const octet key[], size_t key_len)
+{
+	bash_prg_chunk_par par[1];
+	void* state;
+	size_t n;
+	err_t code;
+	// проверить входные данные
+	code = bashPrgChunkCheck(l, d, chunk_len, count1, ann, ann_len, key, 
+		key_len);
+	ERR_CALL_CHECK(code);
+	n = bashPrgChunkCount(count1, chunk_len);
+	if (!memIsValid(src1, count1) ||
+		!memIsValid(src2, count2) ||
+		!memIsValid(tags, n * l / 8) ||
+		!memIsValid(mac, l / 8) ||
+		!memIsValid(dest, count1) ||
+		!memIsDisjoint2(dest, count1, tags, n * l / 8))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bashPrgChunk_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить общую имитовставку
+	bashPrgChunkStart(state, l, d, chunk_len, src2, count2, ann, ann_len,
+		key, key_len);
+	memMove(dest, src1, count1);
+	if (!bashPrgChunkStepV(mac, tags, n, state))
+		code = ERR_BAD_MAC;
+	// снять защиту
+	else
+	{
+		par->buf = (octet*)dest, par->count = count1;
+		par->chunk_len = chunk_len, par->tags = 0, par->tags_in = tags;
+		par->decr = TRUE;
+		code = bashPrgChunkRun(par, state);
+	}
+	if (code != ERR_OK)
+		memSetZero(dest, count1);
+	// завершить
+	blobClose(state);
+	return code;
+}
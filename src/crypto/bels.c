@@ -4,7 +4,7 @@
 \brief STB 34.101.60 (bels): secret sharing algorithms
 \project bee2 [cryptographic library]
 \created 2013.05.14
-\version 2021.04.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -15,6 +15,7 @@
 #include "bee2/core/mem.h"
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
+#include "bee2/core/word.h"
 #include "bee2/crypto/bels.h"
 #include "bee2/crypto/belt.h"
 #include "bee2/math/pp.h"
@@ -71,6 +72,13 @@ err_t belsStdM(octet m[], size_t len, size_t num)
 	return ERR_OK;
 }
 
+static u32 belsStdMW(size_t len, size_t num)
+{
+	ASSERT(len == 16 || len == 24 || len == 32);
+	ASSERT(num <= 16);
+	return len == 16 ? m_16[num] : (len == 24 ? m_24[num] : m_32[num]);
+}
+
 err_t belsValM(const octet m0[], size_t len)
 {
 	size_t n;
@@ -258,6 +266,78 @@ err_t belsGenMid(octet mid[], size_t len, const octet m0[], const octet id[],
 	return reps != SIZE_MAX ? ERR_OK : ERR_BAD_PUBKEY;
 }
 
+/*
+*******************************************************************************
+Быстрая редукция
+
+Стандартные открытые ключи (и вообще ключи m, для которых deg(m) < 32)
+задают модули f(x) = x^l + m(x) с "короткой" младшей частью. Для таких
+модулей вычет c(x) mod f(x) определяется заменой x^l на m(x): слова c
+обрабатываются от старших к младшим, старшее слово h обнуляется, а к словам
+на n позиций ниже добавляется произведение h * m(x). Произведение
+вычисляется сдвигами h на степени ненулевых мономов m(x). Степени
+определяются однократно (они образуют таблицу редукции). Мономов
+у стандартных ключей не больше пяти, поэтому обработка одного слова c
+требует не более пяти сдвигов.
+
+Функция belsRedM() заменяет [cn]c на остаток от деления на x^l + m(x),
+размещенный в первых n словах c. Функция belsRedMTab() строит таблицу
+редукции (число мономов и их степени), функция belsRedMT() выполняет
+редукцию по готовой таблице. Функция belsMIsShort() проверяет, что
+deg(m) < 32, и загружает m в слово.
+*******************************************************************************
+*/
+
+static void belsRedMTab(octet tab[32], u32 m)
+{
+	size_t j;
+	for (tab[0] = 0, j = 1; j < 32; ++j)
+		if (m >> j & 1)
+			tab[++tab[0]] = (octet)j;
+}
+
+static void belsRedMT(word c[], size_t cn, size_t n, const octet tab[32])
+{
+	size_t pos[31];
+	size_t k, i, j;
+	register word h;
+	ASSERT(n >= 2);
+	ASSERT(wwIsValid(c, cn));
+	ASSERT(tab[0] < 32);
+	// загрузить таблицу (c и tab могут пересекаться с точки зрения
+	// компилятора)
+	for (k = tab[0], j = 0; j < k; ++j)
+		pos[j] = tab[j + 1];
+	// редукция
+	for (i = cn; i-- > n;)
+	{
+		h = c[i], c[i] = 0;
+		c[i - n] ^= h;
+		for (j = 0; j < k; ++j)
+		{
+			c[i - n] ^= h << pos[j];
+			c[i - n + 1] ^= h >> (B_PER_W - pos[j]);
+		}
+	}
+	h = 0;
+}
+
+static void belsRedM(word c[], size_t cn, size_t n, u32 m)
+{
+	octet tab[32];
+	belsRedMTab(tab, m);
+	belsRedMT(c, cn, n, tab);
+}
+
+static bool_t belsMIsShort(u32* mw, const octet m[], size_t len)
+{
+	ASSERT(len >= 4);
+	if (!memIsZero(m + 4, len - 4))
+		return FALSE;
+	u32From(mw, m, 4);
+	return TRUE;
+}
+
 /*
 *******************************************************************************
 Генерация одноразового ключа
@@ -316,10 +396,12 @@ err_t belsShare(octet si[], size_t count, size_t threshold, size_t len,
 	gen_i rng, void* rng_state)
 {
 	size_t n, i;
+	u32 mw;
 	void* state;
 	word* f;
 	word* k;
 	word* c;
+	word* t;
 	void* stack;
 	// проверить генератор
 	if (rng == 0)
@@ -333,7 +415,7 @@ err_t belsShare(octet si[], size_t count, size_t threshold, size_t len,
 	EXPECT(belsValM(m0, len) == ERR_OK);
 	// создать состояние
 	n = W_OF_O(len);
-	state = blobCreate(O_OF_W(2 * threshold * n + 1) + 
+	state = blobCreate(O_OF_W(3 * threshold * n + 1) + 
 		utilMax(2, 
 			ppMul_deep(threshold * n - n, n),
 			ppMod_deep(threshold * n, n + 1)));
@@ -343,7 +425,8 @@ err_t belsShare(octet si[], size_t count, size_t threshold, size_t len,
 	f = (word*)state;
 	k = f + n + 1;
 	c = k + threshold * n - n;
-	stack = c + threshold * n;
+	t = c + threshold * n;
+	stack = t + threshold * n;
 	// сгенерировать k
 	rng(k, threshold * len - len, rng_state);
 	wwFrom(k, k, threshold * len - len);
@@ -358,6 +441,15 @@ err_t belsShare(octet si[], size_t count, size_t threshold, size_t len,
 	{
 		// f(x) <- x^l + mi(x)
 		EXPECT(belsValM(mi + i * len, len) == ERR_OK);
+		// si(x) <- c(x) mod f(x) [быстрая редукция]
+		if (belsMIsShort(&mw, mi + i * len, len))
+		{
+			wwCopy(t, c, threshold * n);
+			belsRedM(t, threshold * n, n, mw);
+			wwTo(si + i * len, len, t);
+			continue;
+		}
+		// f(x) <- x^l + mi(x)
 		wwFrom(f, mi + i * len, len);
 		f[n] = 1;
 		// si(x) <- c(x) mod f(x)
@@ -377,6 +469,7 @@ err_t belsShare2(octet si[], size_t count, size_t threshold, size_t len,
 	word* f;
 	word* k;
 	word* c;
+	word* t;
 	void* stack;
 	// проверить генератор
 	if (rng == 0)
@@ -388,7 +481,7 @@ err_t belsShare2(octet si[], size_t count, size_t threshold, size_t len,
 		return ERR_BAD_INPUT;
 	// создать состояние
 	n = W_OF_O(len);
-	state = blobCreate(O_OF_W(2 * threshold * n + 1) +
+	state = blobCreate(O_OF_W(3 * threshold * n + 1) +
 		utilMax(2,
 			ppMul_deep(threshold * n - n, n),
 			ppMod_deep(threshold * n, n + 1)));
@@ -398,7 +491,8 @@ err_t belsShare2(octet si[], size_t count, size_t threshold, size_t len,
 	f = (word*)state;
 	k = f + n + 1;
 	c = k + threshold * n - n;
-	stack = c + threshold * n;
+	t = c + threshold * n;
+	stack = t + threshold * n;
 	// сгенерировать k
 	rng(k, threshold * len - len, rng_state);
 	wwFrom(k, k, threshold * len - len);
@@ -412,13 +506,10 @@ err_t belsShare2(octet si[], size_t count, size_t threshold, size_t len,
 	// цикл по пользователям
 	for (i = 0; i < count; ++i)
 	{
-		// f(x) <- x^l + mi(x)
-		belsStdM(stack, len, i + 1);
-		wwFrom(f, stack, len);
-		f[n] = 1;
-		// si(x) <- c(x) mod f(x)
-		ppMod(f, c, threshold * n, f, n + 1, stack);
-		wwTo(si + i * (len + 1) + 1, len, f);
+		// si(x) <- c(x) mod (x^l + mi(x)) [быстрая редукция]
+		wwCopy(t, c, threshold * n);
+		belsRedM(t, threshold * n, n, belsStdMW(len, i + 1));
+		wwTo(si + i * (len + 1) + 1, len, t);
 		si[i * (len + 1)] = (octet)(i + 1);
 	}
 	// завершение
@@ -460,6 +551,7 @@ err_t belsRecover(octet s[], size_t count, size_t len, const octet si[],
 	const octet m0[], const octet mi[])
 {
 	size_t n, i, deep;
+	u32 mw;
 	void* state;
 	word* f;
 	word* g;
@@ -551,9 +643,14 @@ err_t belsRecover(octet s[], size_t count, size_t len, const octet si[],
 		ASSERT(c[(i + 1) * n] == 0);
 	}
 	// [n]s(x) <- c(x) mod (x^l + m0(x))
-	wwFrom(f, m0, len), f[n] = 1;
-	ppMod(c, c, count * n, f, n + 1, stack);
-	ASSERT(c[n] == 0);
+	if (belsMIsShort(&mw, m0, len))
+		belsRedM(c, count * n, n, mw);
+	else
+	{
+		wwFrom(f, m0, len), f[n] = 1;
+		ppMod(c, c, count * n, f, n + 1, stack);
+		ASSERT(c[n] == 0);
+	}
 	wwTo(s, len, c);
 	// завершение
 	blobClose(state);
@@ -662,13 +759,391 @@ err_t belsRecover2(octet s[], size_t count, size_t len, const octet si[])
 		ppMod(c, c, (2 * i + 1) * n, g, (i + 1) * n + 1, stack);
 		ASSERT(c[(i + 1) * n] == 0);
 	}
-	// [n]s(x) <- c(x) mod (x^l + m0(x))
-	belsStdM((octet*)f, len, 0);
-	wwFrom(f, f, len), f[n] = 1;
-	ppMod(c, c, count * n, f, n + 1, stack);
-	ASSERT(c[n] == 0);
+	// [n]s(x) <- c(x) mod (x^l + m0(x)) [быстрая редукция]
+	belsRedM(c, count * n, n, belsStdMW(len, 0));
 	wwTo(s, len, c);
 	// завершение
 	blobClose(state);
 	return ERR_OK;
 }
+
+/*
+*******************************************************************************
+Восстановление по фиксированному набору номеров (план восстановления)
+
+Пусть f_i(x) = x^l + m_i(x) -- модули частичных секретов, M(x) -- их
+произведение, M_i(x) = M(x) / f_i(x). Тогда (китайская теорема об остатках)
+	s(x) = (\sum_i s_i(x) e_i(x) \mod M(x)) \mod f_0(x),
+где e_i(x) = M_i(x) (M_i(x)^{-1} \mod f_i(x)).
+
+Отображение s_i(x) -> (s_i(x) e_i(x) \mod M(x)) \mod f_0(x) линейно над F_2.
+Оно задается матрицей L_i из l строк по l битов: строка b -- это образ
+монома x^b. Матрицы L_i зависят только от номеров частичных секретов и
+составляют план восстановления. План строится в belsRecover2Start():
+коэффициенты e_i(x) определяются делением M(x) на f_i(x) и обращением
+M_i(x) по модулю f_i(x), образы мономов -- последовательным умножением
+e_i(x) на x по модулю M(x) с быстрой редукцией по модулю f_0(x).
+
+При восстановлении остается сложить строки L_i, которые соответствуют
+ненулевым битам s_i. Строки складываются по маске, без ветвлений, которые
+зависят от частичных секретов.
+
+В bels_recover2_st::L размещаются матрицы L_0, L_1,..., L_{count - 1},
+по l * n слов. Строка b матрицы L_i начинается со слова (i * l + b) * n.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t count;		/*< число частичных секретов */
+	size_t len;			/*< длина секрета в октетах */
+	octet ids[16];		/*< номера открытых ключей */
+	word L[];			/*< план восстановления */
+} bels_recover2_st;
+
+size_t belsRecover2_keep(size_t count, size_t len)
+{
+	ASSERT(len == 16 || len == 24 || len == 32);
+	ASSERT(1 <= count && count <= 16);
+	return sizeof(bels_recover2_st) + O_OF_W(count * 8 * len * W_OF_O(len));
+}
+
+err_t belsRecover2Start(void* state, size_t count, size_t len,
+	const octet ids[])
+{
+	bels_recover2_st* st = (bels_recover2_st*)state;
+	size_t n, l, i, j, deep;
+	void* tmp;
+	word* M;
+	word* Mi;
+	word* r;
+	word* v;
+	word* e;
+	word* t;
+	word* L;
+	void* stack;
+	// проверить входные данные
+	if ((len != 16 && len != 24 && len != 32) || count == 0 || count > 16 ||
+		!memIsValid(ids, count) ||
+		!memIsValid(state, belsRecover2_keep(count, len)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < count; ++i)
+	{
+		if (ids[i] == 0 || ids[i] > 16)
+			return ERR_BAD_PUBKEY;
+		for (j = i + 1; j < count; ++j)
+			if (ids[i] == ids[j])
+				return ERR_BAD_PUBKEY;
+	}
+	// расчет глубины стека
+	n = W_OF_O(len), l = 8 * len;
+	deep = utilMax(3,
+		ppDiv_deep(count * n + 1, n + 1),
+		ppInvMod_deep(n + 1),
+		ppMul_deep((count - 1) * n + 1, n));
+	for (i = 1; i < count; ++i)
+		deep = utilMax(2,
+			deep,
+			ppMul_deep(i * n + 1, n + 1));
+	// создать вспомогательное состояние
+	tmp = blobCreate(O_OF_W(count * n + 1 + (count - 1) * n + 1 +
+		2 * (n + 1) + count * n + 1 + (count + 1) * n + 2) + deep);
+	if (tmp == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка вспомогательного состояния
+	M = (word*)tmp;
+	Mi = M + count * n + 1;
+	r = Mi + (count - 1) * n + 1;
+	v = r + n + 1;
+	e = v + n + 1;
+	t = e + count * n + 1;
+	stack = t + (count + 1) * n + 2;
+	// запомнить параметры
+	st->count = count, st->len = len;
+	memSetZero(st->ids, sizeof(st->ids));
+	memCopy(st->ids, ids, count);
+	// [count * n + 1]M(x) <- \prod_i (x^l + m_i(x))
+	wwSetZero(M, count * n + 1);
+	wwSetW(M, n + 1, belsStdMW(len, ids[0])), M[n] = 1;
+	for (i = 1; i < count; ++i)
+	{
+		wwSetW(r, n + 1, belsStdMW(len, ids[i])), r[n] = 1;
+		ppMul(t, M, i * n + 1, r, n + 1, stack);
+		ASSERT(wwIsZero(t + (i + 1) * n + 1, 1));
+		wwCopy(M, t, (i + 1) * n + 1);
+	}
+	// цикл по частичным секретам
+	for (i = 0; i < count; ++i)
+	{
+		// [(count - 1) * n + 1]Mi(x) <- M(x) / (x^l + m_i(x))
+		wwSetW(r, n + 1, belsStdMW(len, ids[i])), r[n] = 1;
+		ppDiv(Mi, v, M, count * n + 1, r, n + 1, stack);
+		ASSERT(wwIsZero(v, n + 1));
+		// [n + 1]r(x) <- Mi(x) mod (x^l + m_i(x))
+		wwCopy(t, Mi, (count - 1) * n + 1);
+		wwSetZero(t + (count - 1) * n + 1, n);
+		belsRedM(t, MAX2(count * n, (count - 1) * n + 1), n,
+			belsStdMW(len, ids[i]));
+		wwCopy(r, t, n), r[n] = 0;
+		// [n + 1]v(x) <- r(x)^{-1} mod (x^l + m_i(x))
+		wwSetW(t, n + 1, belsStdMW(len, ids[i])), t[n] = 1;
+		ppInvMod(v, r, t, n + 1, stack);
+		ASSERT(v[n] == 0);
+		// [count * n]e(x) <- Mi(x) v(x)
+		ppMul(e, Mi, (count - 1) * n + 1, v, n, stack);
+		ASSERT(e[count * n] == 0);
+		// строки L_i: образы x^b e(x) mod M(x) mod f_0(x)
+		L = st->L + i * l * n;
+		for (j = 0; j < l; ++j)
+		{
+			bool_t carry;
+			// строка j
+			wwCopy(t, e, count * n);
+			belsRedM(t, count * n, n, belsStdMW(len, 0));
+			wwCopy(L + j * n, t, n);
+			// e(x) <- x e(x) mod M(x)
+			carry = wwTestBit(e, count * l - 1);
+			wwShHi(e, count * n, 1);
+			if (carry)
+				wwXor2(e, M, count * n);
+		}
+	}
+	// завершение
+	blobClose(tmp);
+	return ERR_OK;
+}
+
+static void belsRecover2Block(octet s[], const octet* const si[],
+	bels_recover2_st* st)
+{
+	word acc[W_OF_O(32)];
+	word w[W_OF_O(32)];
+	size_t n, l, i, j, b, k;
+	const word* L;
+	register word wj;
+	register word mask;
+	// подготовка
+	n = W_OF_O(st->len), l = 8 * st->len;
+	ASSERT(n <= COUNT_OF(acc));
+	wwSetZero(acc, n);
+	// acc <- \sum_i L_i s_i
+	for (i = 0; i < st->count; ++i)
+	{
+		wwFrom(w, si[i], st->len);
+		L = st->L + i * l * n;
+		for (j = 0; j < n; ++j)
+			for (wj = w[j], b = 0; b < B_PER_W; ++b, wj >>= 1, L += n)
+			{
+				mask = WORD_0 - (wj & WORD_1);
+				for (k = 0; k < n; ++k)
+					acc[k] ^= L[k] & mask;
+			}
+	}
+	wwTo(s, st->len, acc);
+	// завершение
+	wj = mask = 0;
+	wwSetZero(acc, n);
+	wwSetZero(w, n);
+}
+
+err_t belsRecover2StepR(octet s[], const octet si[], void* state)
+{
+	bels_recover2_st* st = (bels_recover2_st*)state;
+	const octet* sj[16];
+	size_t i;
+	// проверить входные данные
+	if (!memIsValid(st, sizeof(bels_recover2_st)) ||
+		!memIsValid(si, st->count * (st->len + 1)) ||
+		!memIsValid(s, st->len))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < st->count; ++i)
+	{
+		if (si[i * (st->len + 1)] != st->ids[i])
+			return ERR_BAD_PUBKEY;
+		sj[i] = si + i * (st->len + 1) + 1;
+	}
+	// восстановить
+	belsRecover2Block(s, sj, st);
+	return ERR_OK;
+}
+
+err_t belsRecover2StepRS(octet s[], size_t s_len, const octet* const si[],
+	void* state)
+{
+	bels_recover2_st* st = (bels_recover2_st*)state;
+	const octet* sj[16];
+	size_t i, j;
+	// проверить входные данные
+	if (!memIsValid(st, sizeof(bels_recover2_st)) ||
+		s_len % st->len != 0 || !memIsValid(s, s_len) ||
+		!memIsValid(si, st->count * sizeof(const octet*)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < st->count; ++i)
+		if (!memIsValid(si[i], s_len))
+			return ERR_BAD_INPUT;
+	// цикл по блокам
+	for (j = 0; j < s_len; j += st->len)
+	{
+		for (i = 0; i < st->count; ++i)
+			sj[i] = si[i] + j;
+		belsRecover2Block(s + j, sj, st);
+	}
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Потоковое разделение
+
+Длинные данные разбиваются на блоки длины l / 8 октетов, и каждый блок
+разделяется как в belsShare2(): c(x) = (x^l + m0(x))k(x) + s(x),
+s_i(x) = c(x) mod (x^l + m_i(x)). Одноразовые ключи k(x) всех блоков
+берутся из ключевого потока belt-ctr, ключ и синхропосылка которого
+однократно вырабатываются генератором rng в belsShare2StreamStart().
+Ключевой поток вырабатывается сразу для групп из BELS_STREAM_BLOCKS блоков.
+
+Поскольку deg(m0) < 32, умножение на x^l + m0(x) выполняется сдвигами
+(функция belsMulMT()), а вычеты по модулям x^l + m_i(x) определяются быстрой
+редукцией belsRedMT(). Таблицы редукции всех модулей строятся однократно
+в belsShare2StreamStart(). Поэтому на каждый блок не тратится ни выделение
+памяти, ни обращение к rng, ни общая полиномиальная арифметика.
+
+В bels_stream_st::data размещаются:
+-	[BELS_STREAM_BLOCKS * (threshold - 1) * n]k -- одноразовые ключи;
+-	[threshold * n]c, [threshold * n]t -- вспомогательные многочлены;
+-	[beltCTR_keep()]ctr -- состояние belt-ctr.
+*******************************************************************************
+*/
+
+static void belsMulMT(word c[], const word k[], size_t kn, size_t n,
+	const octet tab[32])
+{
+	size_t i, j;
+	register word h;
+	ASSERT(n >= 2);
+	ASSERT(wwIsValid(c, kn + n) && wwIsValid(k, kn));
+	ASSERT(wwIsDisjoint2(c, kn + n, k, kn));
+	ASSERT(tab[0] < 32);
+	// c(x) <- x^l k(x) + k(x)
+	wwSetZero(c, n);
+	wwCopy(c + n, k, kn);
+	wwXor2(c, k, kn);
+	// c(x) <- c(x) + k(x) (m(x) - 1)
+	for (j = 1; j <= tab[0]; ++j)
+	{
+		const size_t pos = tab[j];
+		for (i = 0; i < kn; ++i)
+		{
+			h = k[i];
+			c[i] ^= h << pos;
+			c[i + 1] ^= h >> (B_PER_W - pos);
+		}
+	}
+	h = 0;
+}
+
+#define BELS_STREAM_BLOCKS 8
+
+typedef struct
+{
+	size_t count;		/*< число пользователей */
+	size_t threshold;	/*< пороговое число */
+	size_t len;			/*< длина блока в октетах */
+	octet tab[17][32];	/*< таблицы редукции */
+	word data[];		/*< данные */
+} bels_stream_st;
+
+size_t belsShare2Stream_keep(size_t count, size_t threshold, size_t len)
+{
+	const size_t n = W_OF_O(len);
+	ASSERT(len == 16 || len == 24 || len == 32);
+	ASSERT(0 < threshold && threshold <= count && count <= 16);
+	return sizeof(bels_stream_st) + beltCTR_keep() +
+		O_OF_W((BELS_STREAM_BLOCKS * (threshold - 1) + 2 * threshold) * n);
+}
+
+err_t belsShare2StreamStart(void* state, size_t count, size_t threshold,
+	size_t len, gen_i rng, void* rng_state)
+{
+	bels_stream_st* st = (bels_stream_st*)state;
+	octet key[32 + 16];
+	size_t i;
+	// проверить генератор
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// проверить входные данные
+	if ((len != 16 && len != 24 && len != 32) ||
+		threshold == 0 || count < threshold || count > 16 ||
+		!memIsValid(state, belsShare2Stream_keep(count, threshold, len)))
+		return ERR_BAD_INPUT;
+	// запомнить параметры
+	st->count = count, st->threshold = threshold, st->len = len;
+	// построить таблицы редукции
+	for (i = 0; i <= count; ++i)
+		belsRedMTab(st->tab[i], belsStdMW(len, i));
+	// сгенерировать ключ и синхропосылку belt-ctr
+	rng(key, sizeof(key), rng_state);
+	beltCTRStart(st->data +
+		(BELS_STREAM_BLOCKS * (threshold - 1) + 2 * threshold) * W_OF_O(len),
+		key, 32, key + 32);
+	memWipe(key, sizeof(key));
+	return ERR_OK;
+}
+
+err_t belsShare2StreamStepS(octet* const si[], const octet s[], size_t s_len,
+	void* state)
+{
+	bels_stream_st* st = (bels_stream_st*)state;
+	size_t count, threshold, len, n, i, j, b, nb;
+	void* ctr;
+	word* k;
+	word* c;
+	word* t;
+	// проверить входные данные
+	if (!memIsValid(st, sizeof(bels_stream_st)) ||
+		s_len % st->len != 0 || !memIsValid(s, s_len) ||
+		!memIsValid(si, st->count * sizeof(octet*)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < st->count; ++i)
+		if (!memIsValid(si[i], s_len))
+			return ERR_BAD_INPUT;
+	// раскладка состояния
+	count = st->count, threshold = st->threshold, len = st->len;
+	n = W_OF_O(len);
+	k = st->data;
+	c = k + BELS_STREAM_BLOCKS * (threshold - 1) * n;
+	t = c + threshold * n;
+	ctr = t + threshold * n;
+	// цикл по группам блоков
+	for (j = 0; j < s_len; j += nb * len)
+	{
+		// k <- belt-ctr
+		nb = MIN2(BELS_STREAM_BLOCKS, (s_len - j) / len);
+		memSetZero(k, nb * (threshold - 1) * len);
+		beltCTRStepE(k, nb * (threshold - 1) * len, ctr);
+		wwFrom(k, k, nb * (threshold - 1) * len);
+		// цикл по блокам группы
+		for (b = 0; b < nb; ++b)
+		{
+			// c(x) <- (x^l + m0(x))k(x) + s(x)
+			if (threshold > 1)
+				belsMulMT(c, k + b * (threshold - 1) * n,
+					(threshold - 1) * n, n, st->tab[0]);
+			else
+				wwSetZero(c, n);
+			wwFrom(t, s + j + b * len, len);
+			wwXor2(c, t, n);
+			// цикл по пользователям
+			for (i = 0; i < count; ++i)
+			{
+				// si(x) <- c(x) mod (x^l + mi(x)) [быстрая редукция]
+				wwCopy(t, c, threshold * n);
+				belsRedMT(t, threshold * n, n, st->tab[i + 1]);
+				wwTo(si[i] + j + b * len, len, t);
+			}
+		}
+	}
+	// завершение
+	wwSetZero(k, BELS_STREAM_BLOCKS * (threshold - 1) * n + 2 * threshold * n);
+	return ERR_OK;
+}
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): BDE (Blockwise Disk Encryption)
 \project bee2 [cryptographic library]
 \created 2018.06.28
-\version 2020.03.24
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -81,6 +81,112 @@ void beltBDEStepD(void* buf, size_t count, void* state)
 	}
 }
 
+/*
+*******************************************************************************
+Шифрование нескольких секторов в режиме BDE
+
+Сектор зашифровывается (расшифровывается) за три прохода: сначала к блокам
+сектора добавляются маски s * C^i, затем блоки зашифровываются
+(расшифровываются) функцией beltBlockEncrN() (beltBlockDecrN()), наконец
+маски добавляются повторно. Синхропосылки секторов получаются увеличением
+синхропосылки первого сектора как 128-битового числа. Последовательность
+секторов разбивается на участки, которые обрабатываются в нескольких
+потоках (см. beltParRun()).
+*******************************************************************************
+*/
+typedef struct
+{
+	u32 key[8];			/*< форматированный ключ */
+	u32 iv[4];			/*< синхропосылка очередного сектора */
+	u32 s[4];			/*< переменная s */
+	u32 t[4];			/*< маска */
+	octet block[16];	/*< вспомогательный блок */
+	size_t size;		/*< длина сектора */
+	bool_t encr;		/*< зашифрование? */
+} belt_bde_sec_st;
+
+static void beltBDESectorXor(void* buf, belt_bde_sec_st* st)
+{
+	size_t count;
+	beltBlockCopy(st->t, st->s);
+	for (count = st->size; count; count -= 16)
+	{
+		beltBlockMulC(st->t);
+		u32To(st->block, 16, st->t);
+		beltBlockXor2(buf, st->block);
+		buf = (octet*)buf + 16;
+	}
+}
+
+static void beltBDESectors(void* buf, size_t count, void* state)
+{
+	belt_bde_sec_st* st = (belt_bde_sec_st*)state;
+	ASSERT(count % st->size == 0);
+	for (; count; count -= st->size)
+	{
+		// s <- beltBlock(iv, key)
+		beltBlockCopy(st->s, st->iv);
+		beltBlockEncr2(st->s, st->key);
+		// маскирование и шифрование
+		beltBDESectorXor(buf, st);
+		if (st->encr)
+			beltBlockEncrN(buf, st->size / 16, st->key);
+		else
+			beltBlockDecrN(buf, st->size / 16, st->key);
+		beltBDESectorXor(buf, st);
+		// следующий сектор
+		beltBlockIncU32(st->iv);
+		buf = (octet*)buf + st->size;
+	}
+}
+
+static void beltBDEStepMulti(void* buf, size_t size, size_t n,
+	const octet iv[16], const void* state, bool_t encr)
+{
+	const belt_bde_st* st = (const belt_bde_st*)state;
+	belt_bde_sec_st part[BELT_PAR_THREADS];
+	void* bufs[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	size_t parts, offset, i;
+	ASSERT(size % 16 == 0 && size >= 16);
+	ASSERT(memIsDisjoint2(buf, size * n, state, beltBDE_keep()));
+	ASSERT(memIsValid(iv, 16));
+	if (n == 0)
+		return;
+	// разбить секторы на участки
+	parts = MIN2(beltParCount(size * n), n);
+	for (i = offset = 0; i < parts; ++i)
+	{
+		size_t len = n / parts + (i < n % parts);
+		memCopy(part[i].key, st->key, 32);
+		u32From(part[i].iv, iv, 16);
+		beltBlockAddU32(part[i].iv, offset);
+		part[i].size = size, part[i].encr = encr;
+		bufs[i] = (octet*)buf + size * offset;
+		counts[i] = size * len;
+		states[i] = part + i;
+		offset += len;
+	}
+	ASSERT(offset == n);
+	// обработать участки
+	beltParRun(beltBDESectors, bufs, counts, states, parts);
+	// завершить
+	memWipe(part, sizeof(part));
+}
+
+void beltBDEStepEMulti(void* buf, size_t size, size_t n, const octet iv[16],
+	const void* state)
+{
+	beltBDEStepMulti(buf, size, n, iv, state, TRUE);
+}
+
+void beltBDEStepDMulti(void* buf, size_t size, size_t n, const octet iv[16],
+	const void* state)
+{
+	beltBDEStepMulti(buf, size, n, iv, state, FALSE);
+}
+
 err_t beltBDEEncr(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): block encryption
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2019.06.26
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -14,8 +14,43 @@
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "core/stat_lcl.h"
 #include "belt_lcl.h"
 
+/*
+*******************************************************************************
+Инструментирование
+
+При сборке с директивой STAT_ENABLED функции зашифрования и расшифрования
+реализуются внутренними функциями с суффиксом Raw, а открытые функции
+(см. конец файла) ведут учет обращений и вызывают внутренние. Обращения
+одних функций файла к другим не учитываются повторно.
+*******************************************************************************
+*/
+
+#ifdef STAT_ENABLED
+	static void beltBlockEncrRaw(octet block[16], const u32 key[8]);
+	static void beltBlockEncr2Raw(u32 block[4], const u32 key[8]);
+	static void beltBlockEncr3Raw(u32* a, u32* b, u32* c, u32* d,
+		const u32 key[8]);
+	static void beltBlockDecrRaw(octet block[16], const u32 key[8]);
+	static void beltBlockDecr2Raw(u32 block[4], const u32 key[8]);
+	static void beltBlockDecr3Raw(u32* a, u32* b, u32* c, u32* d,
+		const u32 key[8]);
+	static void beltBlockEncrNRaw(octet blocks[], size_t count,
+		const u32 key[8]);
+	static void beltBlockDecrNRaw(octet blocks[], size_t count,
+		const u32 key[8]);
+	#define beltBlockEncr beltBlockEncrRaw
+	#define beltBlockEncr2 beltBlockEncr2Raw
+	#define beltBlockEncr3 beltBlockEncr3Raw
+	#define beltBlockDecr beltBlockDecrRaw
+	#define beltBlockDecr2 beltBlockDecr2Raw
+	#define beltBlockDecr3 beltBlockDecr3Raw
+	#define beltBlockEncrN beltBlockEncrNRaw
+	#define beltBlockDecrN beltBlockDecrNRaw
+#endif
+
 /*
 *******************************************************************************
 H-блок
@@ -87,6 +122,28 @@ void beltKeyExpand2(u32 key_[8], const octet key[], size_t len)
 	}
 }
 
+/*
+*******************************************************************************
+Ключ
+
+Объект ключа содержит только форматированный ключ и после инициализации
+не изменяется. Поэтому его можно одновременно использовать в нескольких
+потоках.
+*******************************************************************************
+*/
+
+size_t beltKey_keep()
+{
+	return sizeof(belt_key_st);
+}
+
+void beltKeyStart(void* state, const octet key[], size_t len)
+{
+	belt_key_st* st = (belt_key_st*)state;
+	ASSERT(memIsValid(state, beltKey_keep()));
+	beltKeyExpand2(st->key, key, len);
+}
+
 /*
 *******************************************************************************
 Расширенные H-блоки
@@ -349,6 +406,14 @@ void beltBlockEncr(octet block[16], const u32 key[8])
 {
 	u32* t = (u32*)block;
 	ASSERT(memIsDisjoint2(block, 16, key, 32));
+	if (belt_ct)
+	{
+		u32 w[4];
+		u32From(w, block, 16);
+		beltBlockEncrCT(w, 1, key);
+		u32To(block, 16, w);
+		return;
+	}
 #if (OCTET_ORDER == BIG_ENDIAN)
 	t[0] = u32Rev(t[0]);
 	t[1] = u32Rev(t[1]);
@@ -366,11 +431,24 @@ void beltBlockEncr(octet block[16], const u32 key[8])
 
 void beltBlockEncr2(u32 block[4], const u32 key[8])
 {
+	if (belt_ct)
+	{
+		beltBlockEncrCT(block, 1, key);
+		return;
+	}
 	E((block + 0), (block + 1), (block + 2), (block + 3), key);
 }
 
 void beltBlockEncr3(u32* a, u32* b, u32* c, u32* d, const u32 key[8])
 {
+	if (belt_ct)
+	{
+		u32 w[4];
+		w[0] = *a, w[1] = *b, w[2] = *c, w[3] = *d;
+		beltBlockEncrCT(w, 1, key);
+		*a = w[0], *b = w[1], *c = w[2], *d = w[3];
+		return;
+	}
 	E(a, b, c, d, key);
 }
 
@@ -383,6 +461,14 @@ void beltBlockDecr(octet block[16], const u32 key[8])
 {
 	u32* t = (u32*)block;
 	ASSERT(memIsDisjoint2(block, 16, key, 32));
+	if (belt_ct)
+	{
+		u32 w[4];
+		u32From(w, block, 16);
+		beltBlockDecrCT(w, 1, key);
+		u32To(block, 16, w);
+		return;
+	}
 #if (OCTET_ORDER == BIG_ENDIAN)
 	t[0] = u32Rev(t[0]);
 	t[1] = u32Rev(t[1]);
@@ -400,10 +486,333 @@ void beltBlockDecr(octet block[16], const u32 key[8])
 
 void beltBlockDecr2(u32 block[4], const u32 key[8])
 {
+	if (belt_ct)
+	{
+		beltBlockDecrCT(block, 1, key);
+		return;
+	}
 	D((block + 0), (block + 1), (block + 2), (block + 3), key);
 }
 
 void beltBlockDecr3(u32* a, u32* b, u32* c, u32* d, const u32 key[8])
 {
+	if (belt_ct)
+	{
+		u32 w[4];
+		w[0] = *a, w[1] = *b, w[2] = *c, w[3] = *d;
+		beltBlockDecrCT(w, 1, key);
+		*a = w[0], *b = w[1], *c = w[2], *d = w[3];
+		return;
+	}
 	D(a, b, c, d, key);
 }
+
+/*
+*******************************************************************************
+Обработка нескольких блоков
+
+Независимые блоки обрабатываются четверками. Макросы R4, E4, D4 повторяют
+макросы R, E, D, но каждый шаг тактовой подстановки выполняется сразу для 
+четырех блоков. Четверка блоков загружается в массив t[16] так, что 
+j-й блок занимает слова t[4j], t[4j + 1], t[4j + 2], t[4j + 3], а параметры 
+a, b, c, d макросов указывают на t, t + 1, t + 2, t + 3. Перемежение 
+независимых цепочек вычислений позволяет процессору совмещать обращения 
+к таблицам H5, H13, H21, H29.
+*******************************************************************************
+*/
+
+#define L4(S, ...)\
+	S(0, __VA_ARGS__); S(1, __VA_ARGS__); S(2, __VA_ARGS__); S(3, __VA_ARGS__)
+
+#define XorG(j, x, y, G, k) x[4 * j] ^= G(y[4 * j] + (k))
+#define AddG(j, x, y, G, k) x[4 * j] += G(y[4 * j] + (k))
+#define SubG(j, x, y, G, k) x[4 * j] -= G(y[4 * j] + (k))
+#define AddGi(j, x, y, G, k, i) x[4 * j] += G(y[4 * j] + (k)) ^ (i)
+#define Add(j, x, y) x[4 * j] += y[4 * j]
+#define Sub(j, x, y) x[4 * j] -= y[4 * j]
+#define Swap(j, x, y)\
+	x[4 * j] ^= y[4 * j], y[4 * j] ^= x[4 * j], x[4 * j] ^= y[4 * j]
+
+#define R4(a, b, c, d, K, i, subkey)\
+	L4(XorG, b, a, G5, subkey(K, i, 0));\
+	L4(XorG, c, d, G21, subkey(K, i, 1));\
+	L4(SubG, a, b, G13, subkey(K, i, 2));\
+	L4(Add, c, b);\
+	L4(AddGi, b, c, G21, subkey(K, i, 3), i);\
+	L4(Sub, c, b);\
+	L4(AddG, d, c, G13, subkey(K, i, 4));\
+	L4(XorG, b, a, G21, subkey(K, i, 5));\
+	L4(XorG, c, d, G5, subkey(K, i, 6));\
+
+#define E4(a, b, c, d, K)\
+	R4(a, b, c, d, K, 1, subkey_e);\
+	R4(b, d, a, c, K, 2, subkey_e);\
+	R4(d, c, b, a, K, 3, subkey_e);\
+	R4(c, a, d, b, K, 4, subkey_e);\
+	R4(a, b, c, d, K, 5, subkey_e);\
+	R4(b, d, a, c, K, 6, subkey_e);\
+	R4(d, c, b, a, K, 7, subkey_e);\
+	R4(c, a, d, b, K, 8, subkey_e);\
+	L4(Swap, a, b);\
+	L4(Swap, c, d);\
+	L4(Swap, b, c);\
+
+#define D4(a, b, c, d, K)\
+	R4(a, b, c, d, K, 8, subkey_d);\
+	R4(c, a, d, b, K, 7, subkey_d);\
+	R4(d, c, b, a, K, 6, subkey_d);\
+	R4(b, d, a, c, K, 5, subkey_d);\
+	R4(a, b, c, d, K, 4, subkey_d);\
+	R4(c, a, d, b, K, 3, subkey_d);\
+	R4(d, c, b, a, K, 2, subkey_d);\
+	R4(b, d, a, c, K, 1, subkey_d);\
+	L4(Swap, a, b);\
+	L4(Swap, c, d);\
+	L4(Swap, a, d);\
+
+void beltBlockEncrN(octet blocks[], size_t count, const u32 key[8])
+{
+	u32 t[16];
+	ASSERT(memIsDisjoint2(blocks, 16 * count, key, 32));
+	if (count >= BELT_WIDE_MIN && beltBlockWideIsAvail())
+	{
+		beltBlockEncrWide(blocks, count / 16 * 16, key);
+		blocks += count / 16 * 256, count %= 16;
+	}
+	if (belt_ct)
+	{
+		for (; count; count -= MIN2(count, 4), blocks += 64)
+		{
+			u32From(t, blocks, 16 * MIN2(count, 4));
+			beltBlockEncrCT(t, MIN2(count, 4), key);
+			u32To(blocks, 16 * MIN2(count, 4), t);
+		}
+		return;
+	}
+	for (; count >= 4; count -= 4, blocks += 64)
+	{
+		u32From(t, blocks, 64);
+		E4((t + 0), (t + 1), (t + 2), (t + 3), key);
+		u32To(blocks, 64, t);
+	}
+	for (; count; --count, blocks += 16)
+		beltBlockEncr(blocks, key);
+}
+
+void beltBlockDecrN(octet blocks[], size_t count, const u32 key[8])
+{
+	u32 t[16];
+	ASSERT(memIsDisjoint2(blocks, 16 * count, key, 32));
+	if (count >= BELT_WIDE_MIN && beltBlockWideIsAvail())
+	{
+		beltBlockDecrWide(blocks, count / 16 * 16, key);
+		blocks += count / 16 * 256, count %= 16;
+	}
+	if (belt_ct)
+	{
+		for (; count; count -= MIN2(count, 4), blocks += 64)
+		{
+			u32From(t, blocks, 16 * MIN2(count, 4));
+			beltBlockDecrCT(t, MIN2(count, 4), key);
+			u32To(blocks, 16 * MIN2(count, 4), t);
+		}
+		return;
+	}
+	for (; count >= 4; count -= 4, blocks += 64)
+	{
+		u32From(t, blocks, 64);
+		D4((t + 0), (t + 1), (t + 2), (t + 3), key);
+		u32To(blocks, 64, t);
+	}
+	for (; count; --count, blocks += 16)
+		beltBlockDecr(blocks, key);
+}
+
+/*
+*******************************************************************************
+Четыре блока на четырех ключах
+
+Макрос R4K повторяет макрос R4, но каждый из четырех блоков обрабатывается
+на своем ключе. Ключи размещаются в массиве keys[32] с перемежением:
+i-е слово j-го ключа -- это keys[4 * i + j]. Тактовый ключ выбирается
+макросами subkey_e4 и subkey_d4 как строка из четырех слов keys,
+нужное слово строки выбирается по номеру блока.
+*******************************************************************************
+*/
+
+#define subkey_e4(K, i, j) ((K) + 4 * ((7 * i - 7 + j) % 8))
+
+#define XorGK(j, x, y, G, k) x[4 * j] ^= G(y[4 * j] + (k)[j])
+#define AddGK(j, x, y, G, k) x[4 * j] += G(y[4 * j] + (k)[j])
+#define SubGK(j, x, y, G, k) x[4 * j] -= G(y[4 * j] + (k)[j])
+#define AddGiK(j, x, y, G, k, i) x[4 * j] += G(y[4 * j] + (k)[j]) ^ (i)
+
+#define R4K(a, b, c, d, K, i, subkey)\
+	L4(XorGK, b, a, G5, subkey(K, i, 0));\
+	L4(XorGK, c, d, G21, subkey(K, i, 1));\
+	L4(SubGK, a, b, G13, subkey(K, i, 2));\
+	L4(Add, c, b);\
+	L4(AddGiK, b, c, G21, subkey(K, i, 3), i);\
+	L4(Sub, c, b);\
+	L4(AddGK, d, c, G13, subkey(K, i, 4));\
+	L4(XorGK, b, a, G21, subkey(K, i, 5));\
+	L4(XorGK, c, d, G5, subkey(K, i, 6));\
+
+#define E4K(a, b, c, d, K)\
+	R4K(a, b, c, d, K, 1, subkey_e4);\
+	R4K(b, d, a, c, K, 2, subkey_e4);\
+	R4K(d, c, b, a, K, 3, subkey_e4);\
+	R4K(c, a, d, b, K, 4, subkey_e4);\
+	R4K(a, b, c, d, K, 5, subkey_e4);\
+	R4K(b, d, a, c, K, 6, subkey_e4);\
+	R4K(d, c, b, a, K, 7, subkey_e4);\
+	R4K(c, a, d, b, K, 8, subkey_e4);\
+	L4(Swap, a, b);\
+	L4(Swap, c, d);\
+	L4(Swap, b, c);\
+
+void beltBlockEncr4(u32 blocks[16], const u32 keys[32])
+{
+	ASSERT(memIsDisjoint2(blocks, 64, keys, 128));
+	if (belt_ct)
+	{
+		beltBlockEncr4CT(blocks, keys);
+		return;
+	}
+	E4K((blocks + 0), (blocks + 1), (blocks + 2), (blocks + 3), keys);
+}
+
+/*
+*******************************************************************************
+Два блока на двух ключах
+
+Макросы R2K, E2K повторяют макросы R4K, E4K для двух блоков. Блоки
+размещаются в массиве blocks[8] (j-й блок занимает слова blocks[4j],...,
+blocks[4j + 3]), ключи -- в массиве keys[16] с перемежением: i-е слово
+j-го ключа -- это keys[2 * i + j]. Перемежение двух независимых цепочек
+вычислений позволяет процессору совмещать обращения к таблицам H5, H13,
+H21, H29 и скрывает их латентность.
+*******************************************************************************
+*/
+
+#define L2(S, ...)\
+	S(0, __VA_ARGS__); S(1, __VA_ARGS__)
+
+#define subkey_e2(K, i, j) ((K) + 2 * ((7 * i - 7 + j) % 8))
+
+#define R2K(a, b, c, d, K, i, subkey)\
+	L2(XorGK, b, a, G5, subkey(K, i, 0));\
+	L2(XorGK, c, d, G21, subkey(K, i, 1));\
+	L2(SubGK, a, b, G13, subkey(K, i, 2));\
+	L2(Add, c, b);\
+	L2(AddGiK, b, c, G21, subkey(K, i, 3), i);\
+	L2(Sub, c, b);\
+	L2(AddGK, d, c, G13, subkey(K, i, 4));\
+	L2(XorGK, b, a, G21, subkey(K, i, 5));\
+	L2(XorGK, c, d, G5, subkey(K, i, 6));\
+
+#define E2K(a, b, c, d, K)\
+	R2K(a, b, c, d, K, 1, subkey_e2);\
+	R2K(b, d, a, c, K, 2, subkey_e2);\
+	R2K(d, c, b, a, K, 3, subkey_e2);\
+	R2K(c, a, d, b, K, 4, subkey_e2);\
+	R2K(a, b, c, d, K, 5, subkey_e2);\
+	R2K(b, d, a, c, K, 6, subkey_e2);\
+	R2K(d, c, b, a, K, 7, subkey_e2);\
+	R2K(c, a, d, b, K, 8, subkey_e2);\
+	L2(Swap, a, b);\
+	L2(Swap, c, d);\
+	L2(Swap, b, c);\
+
+void beltBlockEncr2K(u32 blocks[8], const u32 keys[16])
+{
+	ASSERT(memIsDisjoint2(blocks, 32, keys, 64));
+	if (belt_ct)
+	{
+		u32 key[8];
+		size_t i, j;
+		for (j = 0; j < 2; ++j)
+		{
+			for (i = 0; i < 8; ++i)
+				key[i] = keys[2 * i + j];
+			beltBlockEncrCT(blocks + 4 * j, 1, key);
+		}
+		return;
+	}
+	E2K((blocks + 0), (blocks + 1), (blocks + 2), (blocks + 3), keys);
+}
+
+/*
+*******************************************************************************
+Учет обращений
+*******************************************************************************
+*/
+
+#ifdef STAT_ENABLED
+
+#undef beltBlockEncr
+#undef beltBlockEncr2
+#undef beltBlockEncr3
+#undef beltBlockDecr
+#undef beltBlockDecr2
+#undef beltBlockDecr3
+#undef beltBlockEncrN
+#undef beltBlockDecrN
+
+void beltBlockEncr(octet block[16], const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockEncrRaw(block, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockEncr2(u32 block[4], const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockEncr2Raw(block, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockEncr3(u32* a, u32* b, u32* c, u32* d, const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockEncr3Raw(a, b, c, d, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockDecr(octet block[16], const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockDecrRaw(block, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockDecr2(u32 block[4], const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockDecr2Raw(block, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockDecr3(u32* a, u32* b, u32* c, u32* d, const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockDecr3Raw(a, b, c, d, key);
+	STAT_END(STAT_BELT_BLOCK, 16);
+}
+
+void beltBlockEncrN(octet blocks[], size_t count, const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockEncrNRaw(blocks, count, key);
+	STAT_END(STAT_BELT_BLOCK, 16 * count);
+}
+
+void beltBlockDecrN(octet blocks[], size_t count, const u32 key[8])
+{
+	STAT_BEGIN;
+	beltBlockDecrNRaw(blocks, count, key);
+	STAT_END(STAT_BELT_BLOCK, 16 * count);
+}
+
+#endif
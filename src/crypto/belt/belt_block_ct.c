@@ -0,0 +1,411 @@
+/*
+*******************************************************************************
+\file belt_block_ct.c
+\brief STB 34.101.31 (belt): block encryption without table lookups
+\project bee2 [cryptographic library]
+\created 2026.10.14
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/u32.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/belt.h"
+#include "belt_lcl.h"
+
+/*
+*******************************************************************************
+Реализация без таблиц
+
+Табличная реализация belt-block (см. belt_block.c) обращается к таблицам
+H5, H13, H21, H29 по адресам, которые зависят от ключа и данных. Такие
+обращения оставляют следы в кэше и могут использоваться в атаках по
+времени исполнения. Реализация этого модуля не содержит обращений к памяти
+по секретным адресам.
+
+Подстановка H вычисляется с помощью инструкции PSHUFB (SSSE3). Строка
+H[16h..16h + 16) таблицы H загружается в регистр целиком, а инструкция
+PSHUFB выбирает из нее октеты по младшим тетрадам индексов. Перед выбором
+из индекса x вычитается 16h и к разности с насыщением прибавляется 0x70.
+Если старшая тетрада x равняется h, то разность лежит в диапазоне
+[0, 15] и сумма меньше 0x80. Иначе сумма не меньше 0x80, и инструкция PSHUFB
+возвращает нулевой октет. Объединение результатов по всем 16 строкам дает
+H[x]. Одновременно обрабатываются 16 октетов.
+
+Четыре блока обрабатываются одновременно: слова a, b, c, d блоков
+размещаются в регистрах SSE по одному слову каждого блока (транспонирование
+матрицы 4 x 4 слов). Тактовая подстановка повторяет макрос R из
+belt_block.c. Если блоков меньше четырех, то лишние дорожки заполняются
+нулями.
+
+Реализация включается функцией beltBlockCT(). После включения к ней
+переходят все функции belt-block, а вместе с ними все режимы belt, которые
+эти функции используют. Флаг belt_ct проверяется при каждом вызове, поэтому
+переключать реализацию следует до обращения к belt из нескольких потоков.
+
+Реализация без таблиц медленнее табличной и поэтому включается только
+по запросу. На инструкциях SSSE3 одиночный блок (режимы CBC, MAC, hash)
+обрабатывается в 4 раза дольше, чем в табличной реализации. Если
+поддерживаются инструкции AVX512VBMI, то подстановка H выполняется
+инструкциями VPERMI2B (см. ниже), а пакеты из 16 и более блоков
+(режимы ECB, CTR) обрабатываются модулем belt_block_wide.c со скоростью
+табличной реализации.
+
+Реализация поддерживается только компиляторами GCC и Clang на платформах
+x86 и x86-64. Наличие SSSE3 и AVX512VBMI проверяется однократно с помощью
+cpuid. На других платформах остается табличная реализация.
+*******************************************************************************
+*/
+
+bool_t belt_ct;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define BELT_SSSE3 __attribute__((target("ssse3")))
+
+/*
+*******************************************************************************
+G-блоки
+*******************************************************************************
+*/
+
+BELT_SSSE3 static inline __m128i beltHCT(__m128i x)
+{
+	const octet* H = beltH();
+	const __m128i c70 = _mm_set1_epi8(0x70);
+	const __m128i c10 = _mm_set1_epi8(0x10);
+	__m128i y = _mm_setzero_si128();
+	size_t h;
+	for (h = 0; h < 16; ++h)
+	{
+		y = _mm_or_si128(y, _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i*)(H + 16 * h)),
+			_mm_adds_epu8(x, c70)));
+		x = _mm_sub_epi8(x, c10);
+	}
+	return y;
+}
+
+#define GCT(x, r)\
+	(y = HCT(x), _mm_or_si128(_mm_slli_epi32(y, r),\
+		_mm_srli_epi32(y, 32 - r)))
+
+#define vadd(x, y) _mm_add_epi32(x, y)
+#define vsub(x, y) _mm_sub_epi32(x, y)
+#define vxor(x, y) _mm_xor_si128(x, y)
+
+/*
+*******************************************************************************
+Тактовая подстановка
+
+Макрос RCT повторяет макрос R из belt_block.c. Параметры a, b, c, d --
+регистры, K -- тактовые ключи (по одному слову на дорожку).
+*******************************************************************************
+*/
+
+#define RCT(a, b, c, d, K, i, subkey)\
+	b = vxor(b, GCT(vadd(a, subkey(K, i, 0)), 5));\
+	c = vxor(c, GCT(vadd(d, subkey(K, i, 1)), 21));\
+	a = vsub(a, GCT(vadd(b, subkey(K, i, 2)), 13));\
+	c = vadd(c, b);\
+	b = vadd(b, vxor(GCT(vadd(c, subkey(K, i, 3)), 21), _mm_set1_epi32(i)));\
+	c = vsub(c, b);\
+	d = vadd(d, GCT(vadd(c, subkey(K, i, 4)), 13));\
+	b = vxor(b, GCT(vadd(a, subkey(K, i, 5)), 21));\
+	c = vxor(c, GCT(vadd(d, subkey(K, i, 6)), 5));\
+
+#define subkey_e(K, i, j) K[(7 * i - 7 + j) % 8]
+#define subkey_d(K, i, j) K[(7 * i - 1 - j) % 8]
+
+#define ECT(a, b, c, d, K)\
+	RCT(a, b, c, d, K, 1, subkey_e);\
+	RCT(b, d, a, c, K, 2, subkey_e);\
+	RCT(d, c, b, a, K, 3, subkey_e);\
+	RCT(c, a, d, b, K, 4, subkey_e);\
+	RCT(a, b, c, d, K, 5, subkey_e);\
+	RCT(b, d, a, c, K, 6, subkey_e);\
+	RCT(d, c, b, a, K, 7, subkey_e);\
+	RCT(c, a, d, b, K, 8, subkey_e);\
+
+#define DCT(a, b, c, d, K)\
+	RCT(a, b, c, d, K, 8, subkey_d);\
+	RCT(c, a, d, b, K, 7, subkey_d);\
+	RCT(d, c, b, a, K, 6, subkey_d);\
+	RCT(b, d, a, c, K, 5, subkey_d);\
+	RCT(a, b, c, d, K, 4, subkey_d);\
+	RCT(c, a, d, b, K, 3, subkey_d);\
+	RCT(d, c, b, a, K, 2, subkey_d);\
+	RCT(b, d, a, c, K, 1, subkey_d);\
+
+/*
+*******************************************************************************
+Транспонирование
+
+Слова t[4j..4j + 4) j-го блока раскладываются по регистрам a, b, c, d
+(j-я дорожка) и собираются обратно. Загружаются и выгружаются только
+первые count блоков.
+*******************************************************************************
+*/
+
+BELT_SSSE3 static void beltCTLoad(__m128i r[4], const u32 t[16], size_t count)
+{
+	__m128i x[4], y[4];
+	size_t j;
+	for (j = 0; j < 4; ++j)
+		x[j] = j < count ? _mm_loadu_si128((const __m128i*)(t + 4 * j)) :
+			_mm_setzero_si128();
+	y[0] = _mm_unpacklo_epi32(x[0], x[1]);
+	y[1] = _mm_unpacklo_epi32(x[2], x[3]);
+	y[2] = _mm_unpackhi_epi32(x[0], x[1]);
+	y[3] = _mm_unpackhi_epi32(x[2], x[3]);
+	r[0] = _mm_unpacklo_epi64(y[0], y[1]);
+	r[1] = _mm_unpackhi_epi64(y[0], y[1]);
+	r[2] = _mm_unpacklo_epi64(y[2], y[3]);
+	r[3] = _mm_unpackhi_epi64(y[2], y[3]);
+}
+
+BELT_SSSE3 static void beltCTStore(u32 t[16], size_t count,
+	__m128i a, __m128i b, __m128i c, __m128i d)
+{
+	__m128i y[4], x[4];
+	size_t j;
+	y[0] = _mm_unpacklo_epi32(a, b);
+	y[1] = _mm_unpacklo_epi32(c, d);
+	y[2] = _mm_unpackhi_epi32(a, b);
+	y[3] = _mm_unpackhi_epi32(c, d);
+	x[0] = _mm_unpacklo_epi64(y[0], y[1]);
+	x[1] = _mm_unpackhi_epi64(y[0], y[1]);
+	x[2] = _mm_unpacklo_epi64(y[2], y[3]);
+	x[3] = _mm_unpackhi_epi64(y[2], y[3]);
+	for (j = 0; j < count; ++j)
+		_mm_storeu_si128((__m128i*)(t + 4 * j), x[j]);
+}
+
+/*
+*******************************************************************************
+Зашифрование и расшифрование
+
+Окончательные перестановки регистров (см. макросы E и D в belt_block.c)
+выполняются при выгрузке: после ECT результат -- (b, d, a, c),
+после DCT -- (c, a, d, b).
+*******************************************************************************
+*/
+
+#define HCT(x) beltHCT(x)
+
+BELT_SSSE3 static void beltEncrSSSE3(u32 t[16], size_t count,
+	const __m128i K[8])
+{
+	__m128i r[4], y;
+	beltCTLoad(r, t, count);
+	ECT(r[0], r[1], r[2], r[3], K);
+	beltCTStore(t, count, r[1], r[3], r[0], r[2]);
+}
+
+BELT_SSSE3 static void beltDecrSSSE3(u32 t[16], size_t count,
+	const __m128i K[8])
+{
+	__m128i r[4], y;
+	beltCTLoad(r, t, count);
+	DCT(r[0], r[1], r[2], r[3], K);
+	beltCTStore(t, count, r[2], r[0], r[3], r[1]);
+}
+
+#undef HCT
+
+/*
+*******************************************************************************
+Подстановка H на AVX512VBMI
+
+Если поддерживаются инструкции AVX512VBMI (см. beltBlockWideIsAvail()), то
+подстановка H вычисляется так же, как в belt_block_wide.c: таблица H
+размещается в 4 регистрах ZMM, октеты выбираются инструкциями VPERMI2B по
+младшим 7 битам индексов, а старший бит индекса выбирает половину таблицы.
+Тактовые вычисления при этом не меняются: обрабатываются те же 4 дорожки
+в регистрах SSE, а подстановка выполняется в младших 16 октетах регистров
+ZMM. Вместо 16 выборок PSHUFB выполняются 2 выборки VPERMI2B. В режимах
+со сцеплением блоков (CBC, MAC) это ускоряет реализацию без таблиц
+примерно втрое, хотя она по-прежнему медленнее табличной в 1.4--1.5 раза.
+*******************************************************************************
+*/
+
+#define BELT_AVX512 __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+#define HCT(x)\
+	_mm512_castsi512_si128(_mm512_mask_blend_epi8(\
+		_mm512_movepi8_mask(_mm512_castsi128_si512(x)),\
+		_mm512_permutex2var_epi8(H0, _mm512_castsi128_si512(x), H1),\
+		_mm512_permutex2var_epi8(H2, _mm512_castsi128_si512(x), H3)))
+
+#define beltHLoad()\
+	const octet* H = beltH();\
+	const __m512i H0 = _mm512_loadu_si512(H);\
+	const __m512i H1 = _mm512_loadu_si512(H + 64);\
+	const __m512i H2 = _mm512_loadu_si512(H + 128);\
+	const __m512i H3 = _mm512_loadu_si512(H + 192)
+
+BELT_AVX512 static void beltEncrAVX512(u32 t[16], size_t count,
+	const __m128i K[8])
+{
+	__m128i r[4], y;
+	beltHLoad();
+	beltCTLoad(r, t, count);
+	ECT(r[0], r[1], r[2], r[3], K);
+	beltCTStore(t, count, r[1], r[3], r[0], r[2]);
+}
+
+BELT_AVX512 static void beltDecrAVX512(u32 t[16], size_t count,
+	const __m128i K[8])
+{
+	__m128i r[4], y;
+	beltHLoad();
+	beltCTLoad(r, t, count);
+	DCT(r[0], r[1], r[2], r[3], K);
+	beltCTStore(t, count, r[2], r[0], r[3], r[1]);
+}
+
+#undef HCT
+
+/*
+*******************************************************************************
+Обработка пакетов
+
+Функции beltCTEncr и beltCTDecr указывают на реализации зашифрования
+и расшифрования четверки блоков. Указатели устанавливаются однократно
+при проверке платформы (см. beltCTDetect()).
+*******************************************************************************
+*/
+
+typedef void (*belt_ct_i)(u32 t[16], size_t count, const __m128i K[8]);
+
+static belt_ct_i beltCTEncr;
+static belt_ct_i beltCTDecr;
+
+BELT_SSSE3 static void beltBlockEncrSSSE3(u32 blocks[], size_t count,
+	const u32 key[8])
+{
+	__m128i K[8];
+	size_t i;
+	for (i = 0; i < 8; ++i)
+		K[i] = _mm_set1_epi32((int)key[i]);
+	for (; count >= 4; count -= 4, blocks += 16)
+		beltCTEncr(blocks, 4, K);
+	if (count)
+		beltCTEncr(blocks, count, K);
+}
+
+BELT_SSSE3 static void beltBlockDecrSSSE3(u32 blocks[], size_t count,
+	const u32 key[8])
+{
+	__m128i K[8];
+	size_t i;
+	for (i = 0; i < 8; ++i)
+		K[i] = _mm_set1_epi32((int)key[i]);
+	for (; count >= 4; count -= 4, blocks += 16)
+		beltCTDecr(blocks, 4, K);
+	if (count)
+		beltCTDecr(blocks, count, K);
+}
+
+BELT_SSSE3 static void beltBlockEncr4SSSE3(u32 blocks[16],
+	const u32 keys[32])
+{
+	__m128i K[8];
+	size_t i;
+	for (i = 0; i < 8; ++i)
+		K[i] = _mm_loadu_si128((const __m128i*)(keys + 4 * i));
+	beltCTEncr(blocks, 4, K);
+}
+
+/*
+*******************************************************************************
+Выбор реализации
+*******************************************************************************
+*/
+
+static size_t _once;
+static bool_t _ssse3;
+
+static void beltCTDetect()
+{
+	u32 info[4];
+	// SSSE3?
+	_ssse3 = __get_cpuid(1, info, info + 1, info + 2, info + 3) &&
+		(info[2] & 0x00000200);
+	// AVX512VBMI?
+	if (beltBlockWideIsAvail())
+		beltCTEncr = beltEncrAVX512, beltCTDecr = beltDecrAVX512;
+	else
+		beltCTEncr = beltEncrSSSE3, beltCTDecr = beltDecrSSSE3;
+}
+
+static bool_t beltCTSupported()
+{
+	mtCallOnce(&_once, beltCTDetect);
+	return _ssse3;
+}
+
+void beltBlockEncrCT(u32 blocks[], size_t count, const u32 key[8])
+{
+	beltBlockEncrSSSE3(blocks, count, key);
+}
+
+void beltBlockDecrCT(u32 blocks[], size_t count, const u32 key[8])
+{
+	beltBlockDecrSSSE3(blocks, count, key);
+}
+
+void beltBlockEncr4CT(u32 blocks[16], const u32 keys[32])
+{
+	beltBlockEncr4SSSE3(blocks, keys);
+}
+
+#else
+
+static bool_t beltCTSupported()
+{
+	return FALSE;
+}
+
+void beltBlockEncrCT(u32 blocks[], size_t count, const u32 key[8])
+{
+	ASSERT(0);
+}
+
+void beltBlockDecrCT(u32 blocks[], size_t count, const u32 key[8])
+{
+	ASSERT(0);
+}
+
+void beltBlockEncr4CT(u32 blocks[16], const u32 keys[32])
+{
+	ASSERT(0);
+}
+
+#endif
+
+/*
+*******************************************************************************
+Интерфейс
+*******************************************************************************
+*/
+
+bool_t beltBlockCT(bool_t ct)
+{
+	belt_ct = ct && beltCTSupported();
+	return belt_ct;
+}
+
+const char* beltPlatform()
+{
+	if (!belt_ct)
+		return "BELT_TABLE";
+	return beltBlockWideIsAvail() ? "BELT_AVX512" : "BELT_SSSE3";
+}
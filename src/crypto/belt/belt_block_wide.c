@@ -0,0 +1,234 @@
+/*
+*******************************************************************************
+\file belt_block_wide.c
+\brief STB 34.101.31 (belt): block encryption on 16 blocks
+\project bee2 [cryptographic library]
+\created 2026.10.14
+\version 2026.10.14
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/belt.h"
+#include "belt_lcl.h"
+
+/*
+*******************************************************************************
+Обработка пакетов из 16 блоков
+
+Шестнадцать независимых блоков обрабатываются одновременно: слова a, b,
+c, d блоков размещаются в регистрах AVX512 по одному слову каждого блока
+(j-я дорожка регистра -- j-й блок). Тактовая подстановка повторяет
+макрос R из belt_block.c, все операции выполняются над регистрами целиком.
+
+Подстановка H вычисляется без обращений к памяти. Таблица H загружается
+в четыре регистра по 64 октета: H[0..64), H[64..128), H[128..192),
+H[192..256). Инструкция VPERMI2B (AVX512VBMI) выбирает октеты из пары
+регистров по младшим 7 битам индексов. Выбор между результатами для
+первой и второй половин таблицы выполняется по старшему биту индекса.
+Подстановка 64 октетов требует 4 инструкций, циклический сдвиг слов --
+одной инструкции VPROLD.
+
+Слова блоков собираются в регистры инструкцией VPGATHERDD и разносятся
+обратно инструкцией VPSCATTERDD. Адреса этих инструкций от данных
+не зависят.
+
+Пакетная обработка поддерживается компиляторами GCC и Clang на платформе
+x86-64. Наличие инструкций AVX512F, AVX512BW, AVX512VBMI и поддержка
+регистров AVX512 операционной системой проверяются однократно (cpuid,
+xgetbv). Функции beltBlockEncrN() и beltBlockDecrN() обращаются
+к пакетной обработке, если число блоков не меньше BELT_WIDE_MIN.
+*******************************************************************************
+*/
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define BELT_AVX512 __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+/*
+*******************************************************************************
+G-блоки
+*******************************************************************************
+*/
+
+#define GW(x, r)\
+	(y = _mm512_mask_blend_epi8(_mm512_movepi8_mask(x),\
+		_mm512_permutex2var_epi8(H0, x, H1),\
+		_mm512_permutex2var_epi8(H2, x, H3)),\
+	_mm512_rol_epi32(y, r))
+
+#define vadd(x, y) _mm512_add_epi32(x, y)
+#define vsub(x, y) _mm512_sub_epi32(x, y)
+#define vxor(x, y) _mm512_xor_si512(x, y)
+
+/*
+*******************************************************************************
+Тактовая подстановка
+
+Макрос RW повторяет макрос R из belt_block.c. Параметры a, b, c, d --
+регистры, K -- тактовые ключи, размноженные по дорожкам.
+*******************************************************************************
+*/
+
+#define RW(a, b, c, d, K, i, subkey)\
+	b = vxor(b, GW(vadd(a, subkey(K, i, 0)), 5));\
+	c = vxor(c, GW(vadd(d, subkey(K, i, 1)), 21));\
+	a = vsub(a, GW(vadd(b, subkey(K, i, 2)), 13));\
+	c = vadd(c, b);\
+	b = vadd(b, vxor(GW(vadd(c, subkey(K, i, 3)), 21),\
+		_mm512_set1_epi32(i)));\
+	c = vsub(c, b);\
+	d = vadd(d, GW(vadd(c, subkey(K, i, 4)), 13));\
+	b = vxor(b, GW(vadd(a, subkey(K, i, 5)), 21));\
+	c = vxor(c, GW(vadd(d, subkey(K, i, 6)), 5));\
+
+#define subkey_e(K, i, j) K[(7 * i - 7 + j) % 8]
+#define subkey_d(K, i, j) K[(7 * i - 1 - j) % 8]
+
+#define EW(a, b, c, d, K)\
+	RW(a, b, c, d, K, 1, subkey_e);\
+	RW(b, d, a, c, K, 2, subkey_e);\
+	RW(d, c, b, a, K, 3, subkey_e);\
+	RW(c, a, d, b, K, 4, subkey_e);\
+	RW(a, b, c, d, K, 5, subkey_e);\
+	RW(b, d, a, c, K, 6, subkey_e);\
+	RW(d, c, b, a, K, 7, subkey_e);\
+	RW(c, a, d, b, K, 8, subkey_e);\
+
+#define DW(a, b, c, d, K)\
+	RW(a, b, c, d, K, 8, subkey_d);\
+	RW(c, a, d, b, K, 7, subkey_d);\
+	RW(d, c, b, a, K, 6, subkey_d);\
+	RW(b, d, a, c, K, 5, subkey_d);\
+	RW(a, b, c, d, K, 4, subkey_d);\
+	RW(c, a, d, b, K, 3, subkey_d);\
+	RW(d, c, b, a, K, 2, subkey_d);\
+	RW(b, d, a, c, K, 1, subkey_d);\
+
+/*
+*******************************************************************************
+Зашифрование и расшифрование
+
+Окончательные перестановки регистров (см. макросы E и D в belt_block.c)
+выполняются при выгрузке: после EW результат -- (b, d, a, c),
+после DW -- (c, a, d, b).
+
+На платформе x86-64 порядок октетов little-endian, поэтому слова блоков
+загружаются непосредственно из blocks.
+*******************************************************************************
+*/
+
+BELT_AVX512 static void beltBlockWide(octet blocks[], size_t count,
+	const u32 key[8], bool_t encr)
+{
+	const octet* H = beltH();
+	const __m512i idx = _mm512_set_epi32(60, 56, 52, 48, 44, 40, 36, 32,
+		28, 24, 20, 16, 12, 8, 4, 0);
+	__m512i H0, H1, H2, H3, K[8], a, b, c, d, y;
+	size_t i;
+	ASSERT(count % 16 == 0);
+	H0 = _mm512_loadu_si512(H);
+	H1 = _mm512_loadu_si512(H + 64);
+	H2 = _mm512_loadu_si512(H + 128);
+	H3 = _mm512_loadu_si512(H + 192);
+	for (i = 0; i < 8; ++i)
+		K[i] = _mm512_set1_epi32((int)key[i]);
+	for (; count; count -= 16, blocks += 256)
+	{
+		a = _mm512_i32gather_epi32(idx, blocks, 4);
+		b = _mm512_i32gather_epi32(idx, blocks + 4, 4);
+		c = _mm512_i32gather_epi32(idx, blocks + 8, 4);
+		d = _mm512_i32gather_epi32(idx, blocks + 12, 4);
+		if (encr)
+		{
+			EW(a, b, c, d, K);
+			_mm512_i32scatter_epi32(blocks, idx, b, 4);
+			_mm512_i32scatter_epi32(blocks + 4, idx, d, 4);
+			_mm512_i32scatter_epi32(blocks + 8, idx, a, 4);
+			_mm512_i32scatter_epi32(blocks + 12, idx, c, 4);
+		}
+		else
+		{
+			DW(a, b, c, d, K);
+			_mm512_i32scatter_epi32(blocks, idx, c, 4);
+			_mm512_i32scatter_epi32(blocks + 4, idx, a, 4);
+			_mm512_i32scatter_epi32(blocks + 8, idx, d, 4);
+			_mm512_i32scatter_epi32(blocks + 12, idx, b, 4);
+		}
+	}
+}
+
+/*
+*******************************************************************************
+Выбор реализации
+*******************************************************************************
+*/
+
+static size_t _once;
+static bool_t _avx512;
+
+static u64 beltXGetBV()
+{
+	u32 lo, hi;
+	__asm__ volatile("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+	return (u64)hi << 32 | lo;
+}
+
+static void beltWideDetect()
+{
+	u32 info[4];
+	_avx512 = FALSE;
+	// OSXSAVE?
+	if (!__get_cpuid(1, info, info + 1, info + 2, info + 3) ||
+		!(info[2] & 0x08000000) || __get_cpuid_max(0, 0) < 7)
+		return;
+	// состояния opmask/ZMM?
+	if ((beltXGetBV() & 0xE6) != 0xE6)
+		return;
+	// AVX512F, AVX512BW, AVX512VBMI?
+	__cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+	_avx512 = (info[1] & 0x40010000) == 0x40010000 &&
+		(info[2] & 0x00000002);
+}
+
+bool_t beltBlockWideIsAvail()
+{
+	mtCallOnce(&_once, beltWideDetect);
+	return _avx512;
+}
+
+void beltBlockEncrWide(octet blocks[], size_t count, const u32 key[8])
+{
+	beltBlockWide(blocks, count, key, TRUE);
+}
+
+void beltBlockDecrWide(octet blocks[], size_t count, const u32 key[8])
+{
+	beltBlockWide(blocks, count, key, FALSE);
+}
+
+#else
+
+bool_t beltBlockWideIsAvail()
+{
+	return FALSE;
+}
+
+void beltBlockEncrWide(octet blocks[], size_t count, const u32 key[8])
+{
+	ASSERT(0);
+}
+
+void beltBlockDecrWide(octet blocks[], size_t count, const u32 key[8])
+{
+	ASSERT(0);
+}
+
+#endif
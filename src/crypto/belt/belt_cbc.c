@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): CBC encryption
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -15,6 +15,7 @@
 #include "bee2/core/mem.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "bee2/crypto/eng.h"
 #include "belt_lcl.h"
 
 /*
@@ -27,6 +28,7 @@ typedef struct
 	u32 key[8];			/*< форматированный ключ */
 	octet block[16];	/*< вспомогательный блок */
 	octet block2[16];	/*< еще один вспомогательный блок */
+	const u32* ext;		/*< присоединенный ключ (или 0) */
 } belt_cbc_st;
 
 size_t beltCBC_keep()
@@ -40,6 +42,16 @@ void beltCBCStart(void* state, const octet key[], size_t len,
 	belt_cbc_st* st = (belt_cbc_st*)state;
 	ASSERT(memIsDisjoint2(iv, 16, state, beltCBC_keep()));
 	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
+	beltBlockCopy(st->block, iv);
+}
+
+void beltCBCStartK(void* state, const void* key, const octet iv[16])
+{
+	belt_cbc_st* st = (belt_cbc_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltCBC_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
 	beltBlockCopy(st->block, iv);
 }
 
@@ -48,21 +60,23 @@ void beltCBCStepE(void* buf, size_t count, void* state)
 	belt_cbc_st* st = (belt_cbc_st*)state;
 	ASSERT(count >= 16);
 	ASSERT(memIsDisjoint2(buf, count, state, beltCBC_keep()));
-	// цикл по полным блокам
-	while(count >= 16)
+	// цикл по полным блокам: зашифрование на месте, предыдущий блок
+	// шифртекста берется из buf
+	beltBlockXor2(buf, st->block);
+	beltBlockEncr(buf, beltStKey(st));
+	for (buf = (octet*)buf + 16, count -= 16; count >= 16; count -= 16)
 	{
-		beltBlockXor2(st->block, buf);
-		beltBlockEncr(st->block, st->key);
-		beltBlockCopy(buf, st->block);
+		beltBlockXor2(buf, (octet*)buf - 16);
+		beltBlockEncr(buf, beltStKey(st));
 		buf = (octet*)buf + 16;
-		count -= 16;
 	}
+	beltBlockCopy(st->block, (octet*)buf - 16);
 	// неполный блок? кража блока
 	if (count)
 	{
 		memSwap((octet*)buf - 16, buf, count);
 		memXor2((octet*)buf - 16, st->block, count);
-		beltBlockEncr((octet*)buf - 16, st->key);
+		beltBlockEncr((octet*)buf - 16, beltStKey(st));
 	}
 }
 
@@ -71,11 +85,23 @@ void beltCBCStepD(void* buf, size_t count, void* state)
 	belt_cbc_st* st = (belt_cbc_st*)state;
 	ASSERT(count >= 16);
 	ASSERT(memIsDisjoint2(buf, count, state, beltCBC_keep()));
-	// цикл по полным блокам
+	// цикл по четверкам полных блоков
+	while(count >= 80 || count == 64)
+	{
+		octet c[64];
+		memCopy(c, buf, 64);
+		beltBlockDecrN(buf, 4, beltStKey(st));
+		beltBlockXor2(buf, st->block);
+		memXor2((octet*)buf + 16, c, 48);
+		beltBlockCopy(st->block, c + 48);
+		buf = (octet*)buf + 64;
+		count -= 64;
+	}
+	// цикл по оставшимся полным блокам
 	while(count >= 32 || count == 16)
 	{
 		beltBlockCopy(st->block2, buf);
-		beltBlockDecr(buf, st->key);
+		beltBlockDecr(buf, beltStKey(st));
 		beltBlockXor2(buf, st->block);
 		beltBlockCopy(st->block, st->block2);
 		buf = (octet*)buf + 16;
@@ -85,15 +111,54 @@ void beltCBCStepD(void* buf, size_t count, void* state)
 	if (count)
 	{
 		ASSERT(16 < count && count < 32);
-		beltBlockDecr(buf, st->key);
+		beltBlockDecr(buf, beltStKey(st));
 		memSwap(buf, (octet*)buf + 16, count - 16);
 		memXor2((octet*)buf + 16, buf, count - 16);
-		beltBlockDecr(buf, st->key);
+		beltBlockDecr(buf, beltStKey(st));
 		beltBlockXor2(buf, st->block);
 	}
 }
 
-err_t beltCBCEncr(void* dest, const void* src, size_t count,
+void beltCBCStepDMulti(void* buf, size_t count, void* state)
+{
+	belt_cbc_st* st = (belt_cbc_st*)state;
+	belt_cbc_st part[BELT_PAR_THREADS];
+	void* bufs[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	size_t n, blocks, offset, i;
+	ASSERT(count >= 16);
+	ASSERT(memIsDisjoint2(buf, count, state, beltCBC_keep()));
+	// короткий буфер?
+	if ((n = beltParCount(count)) < 2)
+	{
+		beltCBCStepD(buf, count, state);
+		return;
+	}
+	// разбить полные блоки на участки: последний участок захватывает
+	// неполный блок, начальный блок участка -- предыдущий блок шифртекста
+	blocks = count / 16;
+	for (i = offset = 0; i < n; ++i)
+	{
+		size_t len = blocks / n + (i < blocks % n);
+		memCopy(part + i, st, sizeof(belt_cbc_st));
+		if (i)
+			beltBlockCopy(part[i].block, (octet*)buf + 16 * offset - 16);
+		bufs[i] = (octet*)buf + 16 * offset;
+		counts[i] = 16 * len;
+		states[i] = part + i;
+		offset += len;
+	}
+	ASSERT(offset == blocks);
+	counts[n - 1] += count % 16;
+	// обработать участки
+	beltParRun(beltCBCStepD, bufs, counts, states, n);
+	// завершить
+	memCopy(st, part + n - 1, sizeof(belt_cbc_st));
+	memWipe(part, sizeof(part));
+}
+
+err_t beltCBCEncrSoft(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
 	void* state;
@@ -118,7 +183,21 @@ err_t beltCBCEncr(void* dest, const void* src, size_t count,
 	return ERR_OK;
 }
 
-err_t beltCBCDecr(void* dest, const void* src, size_t count,
+err_t beltCBCEncr(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16])
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_cbc_encr)
+	{
+		code = eng->belt_cbc_encr(eng->state, dest, src, count, key, len, iv);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltCBCEncrSoft(dest, src, count, key, len, iv);
+}
+
+err_t beltCBCDecrSoft(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
 	void* state;
@@ -142,3 +221,17 @@ err_t beltCBCDecr(void* dest, const void* src, size_t count,
 	blobClose(state);
 	return ERR_OK;
 }
+
+err_t beltCBCDecr(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16])
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_cbc_decr)
+	{
+		code = eng->belt_cbc_decr(eng->state, dest, src, count, key, len, iv);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltCBCDecrSoft(dest, src, count, key, len, iv);
+}
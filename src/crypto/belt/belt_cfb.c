@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): CFB encryption
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -26,6 +26,7 @@ typedef struct
 {
 	u32 key[8];			/*< форматированный ключ */
 	octet block[16];	/*< блок гаммы */
+	const u32* ext;		/*< присоединенный ключ (или 0) */
 	size_t reserved;	/*< резерв октетов гаммы */
 } belt_cfb_st;
 
@@ -40,6 +41,17 @@ void beltCFBStart(void* state, const octet key[], size_t len,
 	belt_cfb_st* st = (belt_cfb_st*)state;
 	ASSERT(memIsDisjoint2(iv, 16, state, beltCFB_keep()));
 	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
+	beltBlockCopy(st->block, iv);
+	st->reserved = 0;
+}
+
+void beltCFBStartK(void* state, const void* key, const octet iv[16])
+{
+	belt_cfb_st* st = (belt_cfb_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltCFB_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
 	beltBlockCopy(st->block, iv);
 	st->reserved = 0;
 }
@@ -67,7 +79,7 @@ void beltCFBStepE(void* buf, size_t count, void* state)
 	// цикл по полным блокам
 	while (count >= 16)
 	{
-		beltBlockEncr(st->block, st->key);
+		beltBlockEncr(st->block, beltStKey(st));
 		beltBlockXor2(st->block, buf);
 		beltBlockCopy(buf, st->block);
 		buf = (octet*)buf + 16;
@@ -76,7 +88,7 @@ void beltCFBStepE(void* buf, size_t count, void* state)
 	// неполный блок?
 	if (count)
 	{
-		beltBlockEncr(st->block, st->key);
+		beltBlockEncr(st->block, beltStKey(st));
 		memXor2(st->block, buf, count);
 		memCopy(buf, st->block, count);
 		st->reserved = 16 - count;
@@ -103,10 +115,23 @@ void beltCFBStepD(void* buf, size_t count, void* state)
 		buf = (octet*)buf + st->reserved;
 		st->reserved = 0;
 	}
-	// цикл по полным блокам
+	// цикл по четверкам полных блоков: гамма -- зашифрованные блоки
+	// шифртекста, которые известны заранее
+	while (count >= 64)
+	{
+		octet gamma[64];
+		memCopy(gamma, st->block, 16);
+		memCopy(gamma + 16, buf, 48);
+		memCopy(st->block, (octet*)buf + 48, 16);
+		beltBlockEncrN(gamma, 4, beltStKey(st));
+		memXor2(buf, gamma, 64);
+		buf = (octet*)buf + 64;
+		count -= 64;
+	}
+	// цикл по оставшимся полным блокам
 	while (count >= 16)
 	{
-		beltBlockEncr(st->block, st->key);
+		beltBlockEncr(st->block, beltStKey(st));
 		beltBlockXor2(buf, st->block);
 		beltBlockXor2(st->block, buf);
 		buf = (octet*)buf + 16;
@@ -115,13 +140,58 @@ void beltCFBStepD(void* buf, size_t count, void* state)
 	// неполный блок?
 	if (count)
 	{
-		beltBlockEncr(st->block, st->key);
+		beltBlockEncr(st->block, beltStKey(st));
 		memXor2(buf, st->block, count);
 		memXor2(st->block, buf, count);
 		st->reserved = 16 - count;
 	}
 }
 
+void beltCFBStepDMulti(void* buf, size_t count, void* state)
+{
+	belt_cfb_st* st = (belt_cfb_st*)state;
+	belt_cfb_st part[BELT_PAR_THREADS];
+	void* bufs[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	size_t n, blocks, offset, i;
+	ASSERT(memIsDisjoint2(buf, count, state, beltCFB_keep()));
+	// использовать резерв гаммы
+	if (st->reserved)
+	{
+		n = MIN2(st->reserved, count);
+		beltCFBStepD(buf, n, state);
+		buf = (octet*)buf + n, count -= n;
+	}
+	// короткий буфер?
+	if ((n = beltParCount(count)) < 2)
+	{
+		beltCFBStepD(buf, count, state);
+		return;
+	}
+	// разбить полные блоки на участки: последний участок захватывает
+	// неполный блок, начальный блок участка -- предыдущий блок шифртекста
+	blocks = count / 16;
+	for (i = offset = 0; i < n; ++i)
+	{
+		size_t len = blocks / n + (i < blocks % n);
+		memCopy(part + i, st, sizeof(belt_cfb_st));
+		if (i)
+			beltBlockCopy(part[i].block, (octet*)buf + 16 * offset - 16);
+		bufs[i] = (octet*)buf + 16 * offset;
+		counts[i] = 16 * len;
+		states[i] = part + i;
+		offset += len;
+	}
+	ASSERT(offset == blocks);
+	counts[n - 1] += count % 16;
+	// обработать участки
+	beltParRun(beltCFBStepD, bufs, counts, states, n);
+	// завершить
+	memCopy(st, part + n - 1, sizeof(belt_cfb_st));
+	memWipe(part, sizeof(part));
+}
+
 err_t beltCFBEncr(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
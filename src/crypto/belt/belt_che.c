@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): CHE (Ctr-Hash-Encrypt) authenticated encryption
 \project bee2 [cryptographic library]
 \created 2020.03.20
-\version 2020.07.31
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -28,12 +28,13 @@ typedef struct
 {
 	u32 key[8];				/*< форматированный ключ */
 	u32 s[4];				/*< переменная s */
-	word r[W_OF_B(128)];	/*< переменная r */
+	word r[4 * W_OF_B(128)];	/*< r, r^2, r^3, r^4 */
 	word t[W_OF_B(128)];	/*< переменная t */
 	word t1[W_OF_B(128)];	/*< копия t/имитовставка */
 	word len[W_OF_B(128)];	/*< обработано открытых || критических данных */
 	octet block[16];		/*< блок аутентифицируемых данных */
 	octet block1[16];		/*< блок гаммы */
+	const u32* ext;			/*< присоединенный ключ (или 0) */
 	size_t filled;			/*< накоплено октетов в block */
 	size_t reserved;		/*< резерв октетов гаммы */
 	octet stack[];			/*< стек умножения */
@@ -44,19 +45,17 @@ size_t beltCHE_keep()
 	return sizeof(belt_che_st) + beltPolyMul_deep();
 }
 
-void beltCHEStart(void* state, const octet key[], size_t len, 
-	const octet iv[16])
+static void beltCHEStart_internal(void* state, const octet iv[16])
 {
 	belt_che_st* st = (belt_che_st*)state;
-	ASSERT(memIsDisjoint2(iv, 16, state, beltCHE_keep()));
-	// разобрать key и iv
-	beltKeyExpand2(st->key, key, len);
+	// разобрать iv
 	beltBlockCopy(st->r, iv);
-	beltBlockEncr((octet*)st->r, st->key);
+	beltBlockEncr((octet*)st->r, beltStKey(st));
 	u32From(st->s, st->r, 16);
 #if (OCTET_ORDER == BIG_ENDIAN)
 	beltBlockRevW(st->r);
 #endif
+	beltPolyPow4(st->r, st->stack);
 	// подготовить t
 	wwFrom(st->t, beltH(), 16);
 	// обнулить счетчики
@@ -65,6 +64,25 @@ void beltCHEStart(void* state, const octet key[], size_t len,
 	st->filled = 0;
 }
 
+void beltCHEStart(void* state, const octet key[], size_t len, 
+	const octet iv[16])
+{
+	belt_che_st* st = (belt_che_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltCHE_keep()));
+	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
+	beltCHEStart_internal(state, iv);
+}
+
+void beltCHEStartK(void* state, const void* key, const octet iv[16])
+{
+	belt_che_st* st = (belt_che_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltCHE_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
+	beltCHEStart_internal(state, iv);
+}
+
 void beltCHEStepE(void* buf, size_t count, void* state)
 {
 	belt_che_st* st = (belt_che_st*)state;
@@ -88,7 +106,7 @@ void beltCHEStepE(void* buf, size_t count, void* state)
 	{
 		beltBlockMulC(st->s), st->s[0] ^= 0x00000001;
 		beltBlockCopy(st->block1, st->s);
-		beltBlockEncr2((u32*)st->block1, st->key);
+		beltBlockEncr2((u32*)st->block1, beltStKey(st));
 #if (OCTET_ORDER == BIG_ENDIAN)
 		beltBlockRevU32(st->block1);
 #endif
@@ -101,7 +119,7 @@ void beltCHEStepE(void* buf, size_t count, void* state)
 	{
 		beltBlockMulC(st->s), st->s[0] ^= 0x00000001;
 		beltBlockCopy(st->block1, st->s);
-		beltBlockEncr2((u32*)st->block1, st->key);
+		beltBlockEncr2((u32*)st->block1, beltStKey(st));
 #if (OCTET_ORDER == BIG_ENDIAN)
 		beltBlockRevU32(st->block1);
 #endif
@@ -138,16 +156,11 @@ void beltCHEStepI(const void* buf, size_t count, void* state)
 		st->filled = 0;
 	}
 	// цикл по полным блокам
-	while (count >= 16)
+	if (count >= 16)
 	{
-		beltBlockCopy(st->block, buf);
-#if (OCTET_ORDER == BIG_ENDIAN)
-		beltBlockRevW(st->block);
-#endif
-		beltBlockXor2(st->t, st->block);
-		beltPolyMul(st->t, st->t, st->r, st->stack);
-		buf = (const octet*)buf + 16;
-		count -= 16;
+		beltPolyMulBlocks(st->t, buf, count - count % 16, st->r, st->stack);
+		buf = (const octet*)buf + count - count % 16;
+		count %= 16;
 	}
 	// неполный блок?
 	if (count)
@@ -192,22 +205,40 @@ void beltCHEStepA(const void* buf, size_t count, void* state)
 		st->filled = 0;
 	}
 	// цикл по полным блокам
-	while (count >= 16)
+	if (count >= 16)
 	{
-		beltBlockCopy(st->block, buf);
-#if (OCTET_ORDER == BIG_ENDIAN)
-		beltBlockRevW(st->block);
-#endif
-		beltBlockXor2(st->t, st->block);
-		beltPolyMul(st->t, st->t, st->r, st->stack);
-		buf = (const octet*)buf + 16;
-		count -= 16;
+		beltPolyMulBlocks(st->t, buf, count - count % 16, st->r, st->stack);
+		buf = (const octet*)buf + count - count % 16;
+		count %= 16;
 	}
 	// неполный блок?
 	if (count)
 		memCopy(st->block, buf, st->filled = count);
 }
 
+/*
+*******************************************************************************
+Совмещенные зашифрование и имитозащита
+
+Буфер обрабатывается частями по 256 октетов: часть зашифровывается
+и сразу же, пока она находится в кэше первого уровня, имитозащищается.
+Тем самым буфер просматривается один раз.
+*******************************************************************************
+*/
+
+void beltCHEStepEA(void* buf, size_t count, void* state)
+{
+	ASSERT(memIsDisjoint2(buf, count, state, beltCHE_keep()));
+	while (count)
+	{
+		size_t n = MIN2(count, 256);
+		beltCHEStepE(buf, n, state);
+		beltCHEStepA(buf, n, state);
+		buf = (octet*)buf + n;
+		count -= n;
+	}
+}
+
 void beltCHEStepD(void* buf, size_t count, void* state)
 {
 	beltCHEStepE(buf, count, state);
@@ -233,7 +264,7 @@ static void beltCHEStepG_internal(void* state)
 #if (OCTET_ORDER == BIG_ENDIAN)
 	beltBlockRevW(st->t1);
 #endif
-	beltBlockEncr((octet*)st->t1, st->key);
+	beltBlockEncr((octet*)st->t1, beltStKey(st));
 }
 
 void beltCHEStepG(octet mac[8], void* state)
@@ -274,8 +305,7 @@ err_t beltCHEWrap(void* dest, octet mac[8], const void* src1, size_t count1,
 	beltCHEStart(state, key, len, iv);
 	beltCHEStepI(src2, count2, state);
 	memMove(dest, src1, count1);
-	beltCHEStepE(dest, count1, state);
-	beltCHEStepA(dest, count1, state);
+	beltCHEStepEA(dest, count1, state);
 	beltCHEStepG(mac, state);
 	// завершить
 	blobClose(state);
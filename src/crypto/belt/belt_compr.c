@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): compression
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2019.06.26
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -22,68 +22,142 @@
 
 h и X разбиваются на половинки:
 	[8]h = [4]h0 || [4]h1, [8]X = [4]X0 || [4]X1.
+
+Первое зашифрование (buf0 <- beltBlock(h0 + h1, X) + h0 + h1) определяет
+ключи K1 = buf0 || h1 и K2 = ~buf0 || h0 двух следующих. Поэтому оно
+выполняется отдельно, а два следующих, независимых друг от друга,
+зашифрования выполняются одновременно с перемежением с помощью
+beltBlockEncr2K(). Ключи K1 и K2 сразу записываются в стек
+с перемежением, которого требует beltBlockEncr2K().
+
+Стек: [8]t || [16]k, где t -- два обрабатываемых блока, k -- ключи.
 *******************************************************************************
 */
 
+static void beltComprK(u32 k[16], const u32 buf0[4], const u32 h[8])
+{
+	size_t i;
+	for (i = 0; i < 4; ++i)
+	{
+		k[2 * i] = buf0[i];
+		k[2 * i + 1] = ~buf0[i];
+		k[2 * i + 8] = h[4 + i];
+		k[2 * i + 9] = h[i];
+	}
+}
+
 void beltCompr(u32 h[8], const u32 X[8], void* stack)
 {
-	// [12]buf = [4]buf0 || [4]buf1 || [4]buf2
-	u32* buf = (u32*)stack;
+	u32* t = (u32*)stack;
+	u32* k = t + 8;
 	// буферы не пересекаются?
-	ASSERT(memIsDisjoint3(h, 32, X, 32, buf, 48));
-	// buf0, buf1 <- h0 + h1
-	beltBlockXor(buf, h, h + 4);
-	beltBlockCopy(buf + 4, buf);
-	// buf0 <- beltBlock(buf0, X) + buf1
-	beltBlockEncr2(buf, X);
-	beltBlockXor2(buf, buf + 4);
-	// buf2 <- h0
-	beltBlockCopy(buf + 8, h);
-	// buf1 <- h1 [buf01 == K1]
-	beltBlockCopy(buf + 4, h + 4);
-	// h0 <- beltBlock(X0, buf01) + X0
-	beltBlockCopy(h, X);
-	beltBlockEncr2(h, buf);
-	beltBlockXor2(h, X);
-	// buf1 <- ~buf0 [buf12 == K2]
-	beltBlockNeg(buf + 4, buf);
-	// h1 <- beltBlock(X1, buf12) + X1
-	beltBlockCopy(h + 4, X + 4);
-	beltBlockEncr2(h + 4, buf + 4);
-	beltBlockXor2(h + 4, X + 4);
+	ASSERT(memIsDisjoint3(h, 32, X, 32, t, 96));
+	// t0, t1 <- h0 + h1
+	beltBlockXor(t, h, h + 4);
+	beltBlockCopy(t + 4, t);
+	// t0 <- beltBlock(t0, X) + t1 [t0 == buf0]
+	beltBlockEncr2(t, X);
+	beltBlockXor2(t, t + 4);
+	// k <- K1, K2
+	beltComprK(k, t, h);
+	// h0 <- beltBlock(X0, K1) + X0, h1 <- beltBlock(X1, K2) + X1
+	beltBlockCopy(t, X);
+	beltBlockCopy(t + 4, X + 4);
+	beltBlockEncr2K(t, k);
+	beltBlockXor(h, t, X);
+	beltBlockXor(h + 4, t + 4, X + 4);
 }
 
 void beltCompr2(u32 s[4], u32 h[8], const u32 X[8], void* stack)
 {
-	// [12]buf = [4]buf0 || [4]buf1 || [4]buf2
-	u32* buf = (u32*)stack;
+	u32* t = (u32*)stack;
+	u32* k = t + 8;
 	// буферы не пересекаются?
-	ASSERT(memIsDisjoint4(s, 16, h, 32, X, 32, buf, 48));
-	// buf0, buf1 <- h0 + h1
-	beltBlockXor(buf, h, h + 4);
-	beltBlockCopy(buf + 4, buf);
-	// buf0 <- beltBlock(buf0, X) + buf1
-	beltBlockEncr2(buf, X);
-	beltBlockXor2(buf, buf + 4);
+	ASSERT(memIsDisjoint4(s, 16, h, 32, X, 32, t, 96));
+	// t0, t1 <- h0 + h1
+	beltBlockXor(t, h, h + 4);
+	beltBlockCopy(t + 4, t);
+	// t0 <- beltBlock(t0, X) + t1 [t0 == buf0]
+	beltBlockEncr2(t, X);
+	beltBlockXor2(t, t + 4);
 	// s <- s ^ buf0
-	beltBlockXor2(s, buf);
-	// buf2 <- h0
-	beltBlockCopy(buf + 8, h);
-	// buf1 <- h1 [buf01 == K1]
-	beltBlockCopy(buf + 4, h + 4);
-	// h0 <- beltBlock(X0, buf01) + X0
-	beltBlockCopy(h, X);
-	beltBlockEncr2(h, buf);
-	beltBlockXor2(h, X);
-	// buf1 <- ~buf0 [buf12 == K2]
-	beltBlockNeg(buf + 4, buf);
-	// h1 <- beltBlock(X1, buf12) + X1
-	beltBlockCopy(h + 4, X + 4);
-	beltBlockEncr2(h + 4, buf + 4);
-	beltBlockXor2(h + 4, X + 4);
+	beltBlockXor2(s, t);
+	// k <- K1, K2
+	beltComprK(k, t, h);
+	// h0 <- beltBlock(X0, K1) + X0, h1 <- beltBlock(X1, K2) + X1
+	beltBlockCopy(t, X);
+	beltBlockCopy(t + 4, X + 4);
+	beltBlockEncr2K(t, k);
+	beltBlockXor(h, t, X);
+	beltBlockXor(h + 4, t + 4, X + 4);
 }
 
 size_t beltCompr_deep()
 {
-	return 12 * 4;
+	return 24 * 4;
+}
+
+/*
+*******************************************************************************
+Четыре сжатия
+
+Выполняются одновременно четыре независимых сжатия beltCompr2(s[j], h[j],
+X[j]), j = 0, 1, 2, 3. Зашифрования belt-block выполняются для всех
+сжатий одновременно с помощью beltBlockEncr4().
+
+Массивы s, h и X состоят из четырех строк. Число строк не указывается
+в прототипе: иначе gcc (-Wstringop-overflow) сверяет его с размерами
+аргументов, которые после встраивания определяет неточно.
+*******************************************************************************
+*/
+
+void beltCompr4(u32 s[][4], u32 h[][8], const u32 X[][8], void* stack)
+{
+	u32* t = (u32*)stack;
+	u32* u = t + 16;
+	u32* k = u + 16;
+	u32* k1 = k + 32;
+	size_t i, j;
+	// t_j <- h0_j + h1_j [u <- t], k_j <- X_j
+	for (j = 0; j < 4; ++j)
+	{
+		for (i = 0; i < 4; ++i)
+			u[4 * j + i] = t[4 * j + i] = h[j][i] ^ h[j][4 + i];
+		for (i = 0; i < 8; ++i)
+			k[4 * i + j] = X[j][i];
+	}
+	// t_j <- beltBlock(t_j, X_j) + u_j [t_j == buf0_j], s_j <- s_j + t_j
+	beltBlockEncr4(t, k);
+	for (j = 0; j < 4; ++j)
+		for (i = 0; i < 4; ++i)
+		{
+			t[4 * j + i] ^= u[4 * j + i];
+			s[j][i] ^= t[4 * j + i];
+		}
+	// k_j <- buf0_j || h1_j, k1_j <- ~buf0_j || h0_j
+	for (j = 0; j < 4; ++j)
+		for (i = 0; i < 4; ++i)
+		{
+			k[4 * i + j] = t[4 * j + i];
+			k[4 * (i + 4) + j] = h[j][4 + i];
+			k1[4 * i + j] = ~t[4 * j + i];
+			k1[4 * (i + 4) + j] = h[j][i];
+		}
+	// h0_j <- beltBlock(X0_j, k_j) + X0_j, h1_j <- beltBlock(X1_j, k1_j) + X1_j
+	for (j = 0; j < 4; ++j)
+		for (i = 0; i < 4; ++i)
+			t[4 * j + i] = X[j][i], u[4 * j + i] = X[j][4 + i];
+	beltBlockEncr4(t, k);
+	beltBlockEncr4(u, k1);
+	for (j = 0; j < 4; ++j)
+		for (i = 0; i < 4; ++i)
+		{
+			h[j][i] = t[4 * j + i] ^ X[j][i];
+			h[j][4 + i] = u[4 * j + i] ^ X[j][4 + i];
+		}
+}
+
+size_t beltCompr4_deep()
+{
+	return 96 * 4;
 }
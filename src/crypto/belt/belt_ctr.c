@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): CTR encryption
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "bee2/crypto/eng.h"
 #include "belt_lcl.h"
 
 /*
@@ -27,6 +28,17 @@
 не используется реверс октетов  даже на платформах BIG_ENDIAN.
 Реверс применяется только перед использованием зашифрованного счетчика
 в качестве гаммы.
+
+При формировании пакетов счетчиков для beltBlockEncrN() на платформах
+LITTLE_ENDIAN слова ctr записываются в пакет непосредственно, без вызова
+u32To(). Запись выполняется через u32, а не через word: тип слов должен
+совпадать с типом, через который ctr изменяется в beltBlockIncU32(),
+иначе компилятор вправе переставить обращения.
+
+Начальное значение счетчика сохраняется в ctr0. Блок гаммы с номером i
+(начиная с 0) -- это зашифрованный счетчик ctr0 + i + 1. Поэтому переход
+к произвольной позиции в beltCTRSeek() сводится к сложению ctr0 с номером
+блока.
 *******************************************************************************
 */
 
@@ -41,11 +53,46 @@ void beltCTRStart(void* state, const octet key[], size_t len,
 	belt_ctr_st* st = (belt_ctr_st*)state;
 	ASSERT(memIsDisjoint2(iv, 16, state, beltCTR_keep()));
 	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
 	u32From(st->ctr, iv, 16);
 	beltBlockEncr2(st->ctr, st->key);
+	beltBlockCopy(st->ctr0, st->ctr);
+	st->reserved = 0;
+}
+
+void beltCTRStartK(void* state, const void* key, const octet iv[16])
+{
+	belt_ctr_st* st = (belt_ctr_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltCTR_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
+	u32From(st->ctr, iv, 16);
+	beltBlockEncr2(st->ctr, st->ext);
+	beltBlockCopy(st->ctr0, st->ctr);
 	st->reserved = 0;
 }
 
+void beltCTRSeek(void* state, size_t offset)
+{
+	belt_ctr_st* st = (belt_ctr_st*)state;
+	ASSERT(memIsValid(state, beltCTR_keep()));
+	// перейти к блоку, содержащему октет с номером offset
+	beltBlockCopy(st->ctr, st->ctr0);
+	beltBlockAddU32(st->ctr, offset / 16);
+	st->reserved = 0;
+	// неполный блок?
+	if (offset %= 16)
+	{
+		beltBlockIncU32(st->ctr);
+		beltBlockCopy(st->block, st->ctr);
+		beltBlockEncr2((u32*)st->block, beltStKey(st));
+#if (OCTET_ORDER == BIG_ENDIAN)
+		beltBlockRevU32(st->block);
+#endif
+		st->reserved = 16 - offset;
+	}
+}
+
 void beltCTRStepE(void* buf, size_t count, void* state)
 {
 	belt_ctr_st* st = (belt_ctr_st*)state;
@@ -64,12 +111,32 @@ void beltCTRStepE(void* buf, size_t count, void* state)
 		buf = (octet*)buf + st->reserved;
 		st->reserved = 0;
 	}
-	// цикл по полным блокам
+	// цикл по пакетам из 4..16 полных блоков
+	while (count >= 64)
+	{
+		u32 gamma[64];
+		size_t n = MIN2(count / 16, 16), j;
+		for (j = 0; j < n; ++j)
+		{
+			beltBlockIncU32(st->ctr);
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+			gamma[4 * j] = st->ctr[0], gamma[4 * j + 1] = st->ctr[1];
+			gamma[4 * j + 2] = st->ctr[2], gamma[4 * j + 3] = st->ctr[3];
+#else
+			u32To((octet*)gamma + 16 * j, 16, st->ctr);
+#endif
+		}
+		beltBlockEncrN((octet*)gamma, n, beltStKey(st));
+		memXor2(buf, gamma, 16 * n);
+		buf = (octet*)buf + 16 * n;
+		count -= 16 * n;
+	}
+	// цикл по оставшимся полным блокам
 	while (count >= 16)
 	{
 		beltBlockIncU32(st->ctr);
 		beltBlockCopy(st->block, st->ctr);
-		beltBlockEncr2((u32*)st->block, st->key);
+		beltBlockEncr2((u32*)st->block, beltStKey(st));
 #if (OCTET_ORDER == BIG_ENDIAN)
 		beltBlockRevU32(st->block);
 #endif
@@ -82,7 +149,7 @@ void beltCTRStepE(void* buf, size_t count, void* state)
 	{
 		beltBlockIncU32(st->ctr);
 		beltBlockCopy(st->block, st->ctr);
-		beltBlockEncr2((u32*)st->block, st->key);
+		beltBlockEncr2((u32*)st->block, beltStKey(st));
 #if (OCTET_ORDER == BIG_ENDIAN)
 		beltBlockRevU32(st->block);
 #endif
@@ -91,7 +158,62 @@ void beltCTRStepE(void* buf, size_t count, void* state)
 	}
 }
 
-err_t beltCTR(void* dest, const void* src, size_t count,
+/*
+*******************************************************************************
+Параллельное шифрование в режиме CTR
+
+Полные блоки буфера разбиваются на непрерывные участки, которые
+обрабатываются параллельно (см. beltParRun()). Для каждого участка
+используется копия состояния, счетчик которой смещен на число блоков,
+предшествующих участку.
+*******************************************************************************
+*/
+
+void beltCTRStepEMulti(void* buf, size_t count, void* state)
+{
+	belt_ctr_st* st = (belt_ctr_st*)state;
+	belt_ctr_st part[BELT_PAR_THREADS];
+	void* bufs[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	size_t n, blocks, offset, i;
+	ASSERT(memIsDisjoint2(buf, count, state, beltCTR_keep()));
+	// использовать резерв гаммы
+	if (st->reserved)
+	{
+		n = MIN2(st->reserved, count);
+		beltCTRStepE(buf, n, state);
+		buf = (octet*)buf + n, count -= n;
+	}
+	// короткий буфер?
+	if ((n = beltParCount(count)) < 2)
+	{
+		beltCTRStepE(buf, count, state);
+		return;
+	}
+	// разбить полные блоки на участки
+	blocks = count / 16;
+	for (i = offset = 0; i < n; ++i)
+	{
+		size_t len = blocks / n + (i < blocks % n);
+		memCopy(part + i, st, sizeof(belt_ctr_st));
+		beltBlockAddU32(part[i].ctr, offset);
+		bufs[i] = (octet*)buf + 16 * offset;
+		counts[i] = 16 * len;
+		states[i] = part + i;
+		offset += len;
+	}
+	ASSERT(offset == blocks);
+	// обработать участки
+	beltParRun(beltCTRStepE, bufs, counts, states, n);
+	// продвинуть счетчик и обработать неполный блок
+	beltBlockAddU32(st->ctr, blocks);
+	beltCTRStepE((octet*)buf + 16 * blocks, count % 16, state);
+	// завершить
+	memWipe(part, sizeof(part));
+}
+
+err_t beltCTRSoft(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
 	void* state;
@@ -114,3 +236,17 @@ err_t beltCTR(void* dest, const void* src, size_t count,
 	blobClose(state);
 	return ERR_OK;
 }
+
+err_t beltCTR(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16])
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_ctr)
+	{
+		code = eng->belt_ctr(eng->state, dest, src, count, key, len, iv);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltCTRSoft(dest, src, count, key, len, iv);
+}
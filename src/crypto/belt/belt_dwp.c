@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): DWP (datawrap = data encryption + authentication)
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -27,7 +27,7 @@
 typedef struct
 {
 	belt_ctr_st ctr[1];		/*< состояние функций CTR */
-	word r[W_OF_B(128)];	/*< переменная r */
+	word r[4 * W_OF_B(128)];	/*< r, r^2, r^3, r^4 */
 	word t[W_OF_B(128)];	/*< переменная t */
 	word t1[W_OF_B(128)];	/*< копия t/имитовставка */
 	word len[W_OF_B(128)];	/*< обработано открытых || критических данных */
@@ -41,26 +41,40 @@ size_t beltDWP_keep()
 	return sizeof(belt_dwp_st) + beltPolyMul_deep();
 }
 
-void beltDWPStart(void* state, const octet key[], size_t len, 
-	const octet iv[16])
+static void beltDWPStart_internal(void* state)
 {
 	belt_dwp_st* st = (belt_dwp_st*)state;
-	ASSERT(memIsDisjoint2(iv, 16, state, beltDWP_keep()));
-	// настроить CTR
-	beltCTRStart(st->ctr, key, len, iv);
 	// установить r, s
 	beltBlockCopy(st->r, st->ctr->ctr);
-	beltBlockEncr2((u32*)st->r, st->ctr->key);
+	beltBlockEncr2((u32*)st->r, beltStKey(st->ctr));
 #if (OCTET_ORDER == BIG_ENDIAN && B_PER_W != 32)
 	beltBlockRevU32(st->r);
 	beltBlockRevW(st->r);
 #endif
+	beltPolyPow4(st->r, st->stack);
 	wwFrom(st->t, beltH(), 16);
 	// обнулить счетчики
 	memSetZero(st->len, sizeof(st->len));
 	st->filled = 0;
 }
 
+void beltDWPStart(void* state, const octet key[], size_t len, 
+	const octet iv[16])
+{
+	belt_dwp_st* st = (belt_dwp_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltDWP_keep()));
+	beltCTRStart(st->ctr, key, len, iv);
+	beltDWPStart_internal(state);
+}
+
+void beltDWPStartK(void* state, const void* key, const octet iv[16])
+{
+	belt_dwp_st* st = (belt_dwp_st*)state;
+	ASSERT(memIsDisjoint2(iv, 16, state, beltDWP_keep()));
+	beltCTRStartK(st->ctr, key, iv);
+	beltDWPStart_internal(state);
+}
+
 void beltDWPStepE(void* buf, size_t count, void* state)
 {
 	beltCTRStepE(buf, count, state);
@@ -94,22 +108,24 @@ void beltDWPStepI(const void* buf, size_t count, void* state)
 		st->filled = 0;
 	}
 	// цикл по полным блокам
-	while (count >= 16)
+	if (count >= 16)
 	{
-		beltBlockCopy(st->block, buf);
-#if (OCTET_ORDER == BIG_ENDIAN)
-		beltBlockRevW(st->block);
-#endif
-		beltBlockXor2(st->t, st->block);
-		beltPolyMul(st->t, st->t, st->r, st->stack);
-		buf = (const octet*)buf + 16;
-		count -= 16;
+		beltPolyMulBlocks(st->t, buf, count - count % 16, st->r, st->stack);
+		buf = (const octet*)buf + count - count % 16;
+		count %= 16;
 	}
 	// неполный блок?
 	if (count)
 		memCopy(st->block, buf, st->filled = count);
 }
 
+void beltDWPStepIv(const mem_vec_t vec[], size_t n, void* state)
+{
+	ASSERT(memIsValid(vec, n * sizeof(mem_vec_t)));
+	for (; n--; ++vec)
+		beltDWPStepI(vec->buf, vec->count, state);
+}
+
 void beltDWPStepA(const void* buf, size_t count, void* state)
 {
 	belt_dwp_st* st = (belt_dwp_st*)state;
@@ -148,22 +164,47 @@ void beltDWPStepA(const void* buf, size_t count, void* state)
 		st->filled = 0;
 	}
 	// цикл по полным блокам
-	while (count >= 16)
+	if (count >= 16)
 	{
-		beltBlockCopy(st->block, buf);
-#if (OCTET_ORDER == BIG_ENDIAN)
-		beltBlockRevW(st->block);
-#endif
-		beltBlockXor2(st->t, st->block);
-		beltPolyMul(st->t, st->t, st->r, st->stack);
-		buf = (const octet*)buf + 16;
-		count -= 16;
+		beltPolyMulBlocks(st->t, buf, count - count % 16, st->r, st->stack);
+		buf = (const octet*)buf + count - count % 16;
+		count %= 16;
 	}
 	// неполный блок?
 	if (count)
 		memCopy(st->block, buf, st->filled = count);
 }
 
+/*
+*******************************************************************************
+Совмещенные зашифрование и имитозащита
+
+Буфер обрабатывается частями по 256 октетов: часть зашифровывается
+и сразу же, пока она находится в кэше первого уровня, имитозащищается.
+Тем самым буфер просматривается один раз.
+*******************************************************************************
+*/
+
+void beltDWPStepEA(void* buf, size_t count, void* state)
+{
+	ASSERT(memIsDisjoint2(buf, count, state, beltDWP_keep()));
+	while (count)
+	{
+		size_t n = MIN2(count, 256);
+		beltDWPStepE(buf, n, state);
+		beltDWPStepA(buf, n, state);
+		buf = (octet*)buf + n;
+		count -= n;
+	}
+}
+
+void beltDWPStepAv(const mem_vec_t vec[], size_t n, void* state)
+{
+	ASSERT(memIsValid(vec, n * sizeof(mem_vec_t)));
+	for (; n--; ++vec)
+		beltDWPStepA(vec->buf, vec->count, state);
+}
+
 void beltDWPStepD(void* buf, size_t count, void* state)
 {
 	beltCTRStepD(buf, count, state);
@@ -189,7 +230,7 @@ static void beltDWPStepG_internal(void* state)
 #if (OCTET_ORDER == BIG_ENDIAN)
 	beltBlockRevW(st->t1);
 #endif
-	beltBlockEncr((octet*)st->t1, st->ctr->key);
+	beltBlockEncr((octet*)st->t1, beltStKey(st->ctr));
 }
 
 void beltDWPStepG(octet mac[8], void* state)
@@ -230,8 +271,7 @@ err_t beltDWPWrap(void* dest, octet mac[8], const void* src1, size_t count1,
 	beltDWPStart(state, key, len, iv);
 	beltDWPStepI(src2, count2, state);
 	memMove(dest, src1, count1);
-	beltDWPStepE(dest, count1, state);
-	beltDWPStepA(dest, count1, state);
+	beltDWPStepEA(dest, count1, state);
 	beltDWPStepG(mac, state);
 	// завершить
 	blobClose(state);
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): ECB encryption
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -15,6 +15,8 @@
 #include "bee2/core/mem.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "bee2/crypto/eng.h"
+#include "belt_lcl.h"
 
 /*
 *******************************************************************************
@@ -24,6 +26,7 @@
 typedef struct
 {
 	u32 key[8];		/*< форматированный ключ */
+	const u32* ext;	/*< присоединенный ключ (или 0) */
 } belt_ecb_st;
 
 size_t beltECB_keep()
@@ -36,6 +39,15 @@ void beltECBStart(void* state, const octet key[], size_t len)
 	belt_ecb_st* st = (belt_ecb_st*)state;
 	ASSERT(memIsValid(state, beltECB_keep()));
 	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
+}
+
+void beltECBStartK(void* state, const void* key)
+{
+	belt_ecb_st* st = (belt_ecb_st*)state;
+	ASSERT(memIsValid(state, beltECB_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
 }
 
 void beltECBStepE(void* buf, size_t count, void* state)
@@ -43,18 +55,15 @@ void beltECBStepE(void* buf, size_t count, void* state)
 	belt_ecb_st* st = (belt_ecb_st*)state;
 	ASSERT(count >= 16);
 	ASSERT(memIsDisjoint2(buf, count, state, beltECB_keep()));
-	// цикл по полным блокам
-	while(count >= 16)
-	{
-		beltBlockEncr(buf, st->key);
-		buf = (octet*)buf + 16;
-		count -= 16;
-	}
+	// полные блоки
+	beltBlockEncrN(buf, count / 16, beltStKey(st));
+	buf = (octet*)buf + count / 16 * 16;
+	count %= 16;
 	// неполный блок? кража блока
 	if (count)
 	{
 		memSwap((octet*)buf - 16, buf, count);
-		beltBlockEncr((octet*)buf - 16, st->key);
+		beltBlockEncr((octet*)buf - 16, beltStKey(st));
 	}
 }
 
@@ -63,22 +72,19 @@ void beltECBStepD(void* buf, size_t count, void* state)
 	belt_ecb_st* st = (belt_ecb_st*)state;
 	ASSERT(count >= 16);
 	ASSERT(memIsDisjoint2(buf, count, state, beltECB_keep()));
-	// цикл по полным блокам
-	while(count >= 16)
-	{
-		beltBlockDecr(buf, st->key);
-		buf = (octet*)buf + 16;
-		count -= 16;
-	}
+	// полные блоки
+	beltBlockDecrN(buf, count / 16, beltStKey(st));
+	buf = (octet*)buf + count / 16 * 16;
+	count %= 16;
 	// неполный блок? кража блока
 	if (count)
 	{
 		memSwap((octet*)buf - 16, buf, count);
-		beltBlockDecr((octet*)buf - 16, st->key);
+		beltBlockDecr((octet*)buf - 16, beltStKey(st));
 	}
 }
 
-err_t beltECBEncr(void* dest, const void* src, size_t count,
+err_t beltECBEncrSoft(void* dest, const void* src, size_t count,
 	const octet key[], size_t len)
 {
 	void* state;
@@ -102,7 +108,21 @@ err_t beltECBEncr(void* dest, const void* src, size_t count,
 	return ERR_OK;
 }
 
-err_t beltECBDecr(void* dest, const void* src, size_t count,
+err_t beltECBEncr(void* dest, const void* src, size_t count,
+	const octet key[], size_t len)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_ecb_encr)
+	{
+		code = eng->belt_ecb_encr(eng->state, dest, src, count, key, len);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltECBEncrSoft(dest, src, count, key, len);
+}
+
+err_t beltECBDecrSoft(void* dest, const void* src, size_t count,
 	const octet key[], size_t len)
 {
 	void* state;
@@ -126,3 +146,17 @@ err_t beltECBDecr(void* dest, const void* src, size_t count,
 	return ERR_OK;
 }
 
+err_t beltECBDecr(void* dest, const void* src, size_t count,
+	const octet key[], size_t len)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_ecb_decr)
+	{
+		code = eng->belt_ecb_decr(eng->state, dest, src, count, key, len);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltECBDecrSoft(dest, src, count, key, len);
+}
+
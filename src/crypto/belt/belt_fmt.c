@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): FMT (format preserving encryption)
 \project bee2 [cryptographic library]
 \created 2017.09.28
-\version 2021.01.21
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -174,14 +174,30 @@ static void belt32BlockEncr(octet block[24], const u32 key[8])
 /*
 *******************************************************************************
 Конвертации
+
+Строки в алфавите {0, 1,..., mod - 1} интерпретируются как записи чисел
+по основанию mod (первый символ -- младший). Символы обрабатываются
+группами по e штук, где e -- максимальное число, для которого
+pow = mod^e умещается в машинное слово. Группа преобразуется в число
+0 <= d < pow с помощью обычной арифметики машинных слов, и в длинной
+арифметике выполняется одно умножение или деление на pow вместо e
+умножений или делений на mod.
 *******************************************************************************
 */
 
-static void beltStr2Bin(octet bin[], size_t b, u32 mod, 
+static void beltFMTCalcPow(size_t* e, word* pow, u32 mod)
+{
+	ASSERT(2 <= mod && mod < 65536);
+	for (*e = 1, *pow = (word)mod; *pow <= WORD_MAX / mod; ++*e)
+		*pow *= (word)mod;
+}
+
+static void beltStr2Bin(octet bin[], size_t b, u32 mod, size_t e, word pow,
 	const u16 str[], size_t count)
 {
+	register word d;
 	word* a;
-	size_t m;
+	size_t m, k;
 	// подготовить память
 	memSetZero(bin, 8 * b);
 	// особый случай: mod может не уложиться в word
@@ -192,27 +208,41 @@ static void beltStr2Bin(octet bin[], size_t b, u32 mod,
 	}
 	// конвертировать
 	ASSERT(2 <= mod && mod < 65536);
-	ASSERT(count >= 1);
-	--count;
-	EXPECT(str[count] < mod);
+	ASSERT(count >= 1 && e >= 1);
 	a = (word*)bin;
 	m = W_OF_O(8 * b);
-	a[0] = (word)str[count];
-	while (count--)
+	// старшая (возможно, неполная) группа
+	k = count % e;
+	if (k == 0)
+		k = e;
+	for (d = 0; k--;)
 	{
-		zzMulW(a, a, m, mod);
-		EXPECT(str[count] < mod);
-		zzAddW2(a, m, (word)str[count]);
+		EXPECT(str[count - 1] < mod);
+		d = d * mod + str[--count];
+	}
+	a[0] = d;
+	// остальные группы
+	while (count)
+	{
+		for (d = 0, k = e; k--;)
+		{
+			EXPECT(str[count - 1] < mod);
+			d = d * mod + str[--count];
+		}
+		zzMulW(a, a, m, pow);
+		zzAddW2(a, m, d);
 	}
+	d = 0;
 	wwTo(bin, 8 * b, a);
 }
 
-static void beltBin2StrAdd(u32 mod, u16 str[], size_t count, 
-	octet bin[], size_t b)
+static void beltBin2StrAdd(u32 mod, size_t e, word pow, u16 str[],
+	size_t count, octet bin[], size_t b)
 {
+	register word d;
 	register u32 t;
 	word* a;
-	size_t m;
+	size_t m, k;
 	// особый случай: mod может не уложиться в word
 	if (mod == 65536)
 	{
@@ -228,22 +258,26 @@ static void beltBin2StrAdd(u32 mod, u16 str[], size_t count,
 	wwFrom(a, bin, 8 * b);
 	// конвертировать и сложить
 	ASSERT(2 <= mod && mod < 65536);
-	while (count--)
+	while (count)
 	{
-		t = (u32)zzModW(a, m, mod);
-		t += str[0], t %= mod;
-		str[0] = (u16)t, ++str;
-		zzDivW(a, a, m, mod);
+		d = zzDivW(a, a, m, pow);
+		for (k = MIN2(e, count), count -= k; k--; d /= mod)
+		{
+			t = (u32)(d % mod);
+			t += str[0], t %= mod;
+			str[0] = (u16)t, ++str;
+		}
 	}
-	t = 0;
+	t = 0, d = 0;
 }
 
-static void beltBin2StrSub(word mod, u16 str[], size_t count, 
-	octet bin[], size_t b)
+static void beltBin2StrSub(u32 mod, size_t e, word pow, u16 str[],
+	size_t count, octet bin[], size_t b)
 {
+	register word d;
 	register u32 t;
 	word* a;
-	size_t m;
+	size_t m, k;
 	// особый случай: mod может не уложиться в word
 	if (mod == 65536)
 	{
@@ -258,15 +292,18 @@ static void beltBin2StrSub(word mod, u16 str[], size_t count,
 	a = (word*)bin;
 	wwFrom(a, bin, 8 * b);
 	// конвертировать и вычесть
-	ASSERT(2 <= mod && mod <= 65536);
-	while (count--)
+	ASSERT(2 <= mod && mod < 65536);
+	while (count)
 	{
-		t = (u32)zzModW(a, m, mod);
-		t = str[0] + mod - t, t %= mod;
-		str[0] = (u16)t, ++str;
-		zzDivW(a, a, m, mod);
+		d = zzDivW(a, a, m, pow);
+		for (k = MIN2(e, count), count -= k; k--; d /= mod)
+		{
+			t = (u32)(d % mod);
+			t = str[0] + mod - t, t %= mod;
+			str[0] = (u16)t, ++str;
+		}
 	}
-	t = 0;
+	t = 0, d = 0;
 }
 
 /*
@@ -290,6 +327,8 @@ typedef struct
 	size_t n2;				/*< длина правой половинки */
 	size_t b1;				/*< число блоков для обработки левой половинки */
 	size_t b2;				/*< число блоков для обработки правой половинки */
+	size_t e;				/*< число символов в группе */
+	word pow;				/*< mod^e */
 	octet iv[4 + 16 + 4];	/*< формат || синхропосылка || формат */
 	octet buf[];			/*< вспомогательный буфер */
 } belt_fmt_st;
@@ -315,6 +354,10 @@ void beltFMTStart(void* state, u32 mod, size_t count, const octet key[],
 	st->n2 = count / 2;
 	st->b1 = beltFMTCalcB(mod, st->n1);
 	st->b2 = beltFMTCalcB(mod, st->n2);
+	if (mod < 65536)
+		beltFMTCalcPow(&st->e, &st->pow, mod);
+	else
+		st->e = 1, st->pow = 0;
 #if (OCTET_ORDER == LITTLE_ENDIAN)
 	((u16*)st->iv)[0] = (u16)mod;
 	((u16*)st->iv)[1] = (u16)count;
@@ -325,6 +368,38 @@ void beltFMTStart(void* state, u32 mod, size_t count, const octet key[],
 	memCopy(st->iv + 20, st->iv, 4);
 }
 
+/*
+*******************************************************************************
+Половина такта
+
+Половинка [src_count]src конвертируется в число из b 64-битовых блоков,
+к нему добавляется 64-битовый блок h || iv, результат зашифровывается
+и добавляется к половинке [dest_count]dest (add == TRUE) или вычитается
+из нее (add == FALSE).
+*******************************************************************************
+*/
+
+static void beltFMTHalf(u16 dest[], size_t dest_count, const u16 src[],
+	size_t src_count, size_t b, const octet h[4], const octet iv[4],
+	bool_t add, belt_fmt_st* st)
+{
+	beltStr2Bin(st->buf, b, st->mod, st->e, st->pow, src, src_count);
+	memCopy(st->buf + b * 8, h, 4);
+	memCopy(st->buf + b * 8 + 4, iv, 4);
+	if (b == 1)
+		beltBlockEncr(st->buf, st->wbl->key);
+	else if (b == 2)
+		belt32BlockEncr(st->buf, st->wbl->key);
+	else
+		beltWBLStepE(st->buf, 8 * b + 8, st->wbl);
+	if (add)
+		beltBin2StrAdd(st->mod, st->e, st->pow, dest, dest_count, st->buf,
+			b + 1);
+	else
+		beltBin2StrSub(st->mod, st->e, st->pow, dest, dest_count, st->buf,
+			b + 1);
+}
+
 void beltFMTStepE(u16 buf[], const octet iv[16], void* state)
 {
 	belt_fmt_st* st = (belt_fmt_st*)state;
@@ -342,27 +417,11 @@ void beltFMTStepE(u16 buf[], const octet iv[16], void* state)
 	for (i = 0; i < 3; ++i)
 	{
 		// первая половинка
-		beltStr2Bin(st->buf, st->b2, st->mod, buf + st->n1, st->n2);
-		memCopy(st->buf + st->b2 * 8, beltH() + 8 * i, 4);
-		memCopy(st->buf + st->b2 * 8 + 4, st->iv + 8 * i, 4);
-		if (st->b2 == 1)
-			beltBlockEncr(st->buf, st->wbl->key);
-		else if (st->b2 == 2)
-			belt32BlockEncr(st->buf, st->wbl->key);
-		else
-			beltWBLStepE(st->buf, 8 * st->b2 + 8, st->wbl);
-		beltBin2StrAdd(st->mod, buf, st->n1, st->buf, st->b2 + 1);
+		beltFMTHalf(buf, st->n1, buf + st->n1, st->n2, st->b2,
+			beltH() + 8 * i, st->iv + 8 * i, TRUE, st);
 		// вторая половинка
-		beltStr2Bin(st->buf, st->b1, st->mod, buf, st->n1);
-		memCopy(st->buf + st->b1 * 8, beltH() + 8 * i + 4, 4);
-		memCopy(st->buf + st->b1 * 8 + 4, st->iv + 8 * i + 4, 4);
-		if (st->b1 == 1)
-			beltBlockEncr(st->buf, st->wbl->key);
-		else if (st->b1 == 2)
-			belt32BlockEncr(st->buf, st->wbl->key);
-		else
-			beltWBLStepE(st->buf, 8 * st->b1 + 8, st->wbl);
-		beltBin2StrAdd(st->mod, buf + st->n1, st->n2, st->buf, st->b1 + 1);
+		beltFMTHalf(buf + st->n1, st->n2, buf, st->n1, st->b1,
+			beltH() + 8 * i + 4, st->iv + 8 * i + 4, TRUE, st);
 	}
 }
 
@@ -383,28 +442,114 @@ void beltFMTStepD(u16 buf[], const octet iv[16], void* state)
 	for (i = 3; i--;)
 	{
 		// вторая половинка
-		beltStr2Bin(st->buf, st->b1, st->mod, buf, st->n1);
-		memCopy(st->buf + st->b1 * 8, beltH() + 8 * i + 4, 4);
-		memCopy(st->buf + st->b1 * 8 + 4, st->iv + 8 * i + 4, 4);
-		if (st->b1 == 1)
-			beltBlockEncr(st->buf, st->wbl->key);
-		else if (st->b1 == 2)
-			belt32BlockEncr(st->buf, st->wbl->key);
-		else
-			beltWBLStepE(st->buf, 8 * st->b1 + 8, st->wbl);
-		beltBin2StrSub(st->mod, buf + st->n1, st->n2, st->buf, st->b1 + 1);
+		beltFMTHalf(buf + st->n1, st->n2, buf, st->n1, st->b1,
+			beltH() + 8 * i + 4, st->iv + 8 * i + 4, FALSE, st);
 		// первая половинка
-		beltStr2Bin(st->buf, st->b2, st->mod, buf + st->n1, st->n2);
-		memCopy(st->buf + st->b2 * 8, beltH() + 8 * i, 4);
-		memCopy(st->buf + st->b2 * 8 + 4, st->iv + 8 * i, 4);
-		if (st->b2 == 1)
-			beltBlockEncr(st->buf, st->wbl->key);
-		else if (st->b2 == 2)
-			belt32BlockEncr(st->buf, st->wbl->key);
+		beltFMTHalf(buf, st->n1, buf + st->n1, st->n2, st->b2,
+			beltH() + 8 * i, st->iv + 8 * i, FALSE, st);
+	}
+}
+
+/*
+*******************************************************************************
+Шифрование нескольких строк
+
+Если обе половинки строки конвертируются в один 64-битовый блок
+(b1 == b2 == 1, например, для номеров карт), то на каждой половине такта
+блоки группы из BELT_FMT_GROUP строк зашифровываются одновременно
+с помощью beltBlockEncrN(). В противном случае строки обрабатываются
+последовательно.
+*******************************************************************************
+*/
+
+#define BELT_FMT_GROUP 16
+
+static void beltFMTHalfN(u16 buf[], size_t g, const octet iv[], size_t r,
+	bool_t left, bool_t add, belt_fmt_st* st, octet blocks[])
+{
+	const size_t count = st->n1 + st->n2;
+	u16* dest;
+	const u16* src;
+	size_t dest_count, src_count, pos, j;
+	if (left)
+		dest_count = st->n1, src_count = st->n2, pos = 8 * r;
+	else
+		dest_count = st->n2, src_count = st->n1, pos = 8 * r + 4;
+	// конвертировать и дополнить
+	for (j = 0; j < g; ++j)
+	{
+		src = buf + count * j + (left ? st->n1 : 0);
+		beltStr2Bin(blocks + 16 * j, 1, st->mod, st->e, st->pow, src,
+			src_count);
+		memCopy(blocks + 16 * j + 8, beltH() + pos, 4);
+		if (pos == 0 || pos == 20)
+			memCopy(blocks + 16 * j + 12, st->iv, 4);
+		else if (iv)
+			memCopy(blocks + 16 * j + 12, iv + 16 * j + pos - 4, 4);
+		else
+			memSetZero(blocks + 16 * j + 12, 4);
+	}
+	// зашифровать
+	beltBlockEncrN(blocks, g, st->wbl->key);
+	// сложить / вычесть
+	for (j = 0; j < g; ++j)
+	{
+		dest = buf + count * j + (left ? 0 : st->n1);
+		if (add)
+			beltBin2StrAdd(st->mod, st->e, st->pow, dest, dest_count,
+				blocks + 16 * j, 2);
+		else
+			beltBin2StrSub(st->mod, st->e, st->pow, dest, dest_count,
+				blocks + 16 * j, 2);
+	}
+}
+
+static void beltFMTStepN(u16 buf[], size_t n, const octet iv[],
+	void* state, bool_t encr)
+{
+	belt_fmt_st* st = (belt_fmt_st*)state;
+	const size_t count = st->n1 + st->n2;
+	octet blocks[16 * BELT_FMT_GROUP];
+	size_t g, i;
+	ASSERT(memIsValid(state, sizeof(belt_fmt_st)));
+	ASSERT(memIsValid(buf, 2 * count * n));
+	ASSERT(memIsNullOrValid(iv, 16 * n));
+	// последовательная обработка
+	if (st->b1 != 1 || st->b2 != 1)
+	{
+		for (; n--; buf += count, iv = iv ? iv + 16 : 0)
+			encr ? beltFMTStepE(buf, iv, state) :
+				beltFMTStepD(buf, iv, state);
+		return;
+	}
+	// обработка групп
+	for (; n; n -= g, buf += count * g, iv = iv ? iv + 16 * g : 0)
+	{
+		g = MIN2(n, BELT_FMT_GROUP);
+		if (encr)
+			for (i = 0; i < 3; ++i)
+			{
+				beltFMTHalfN(buf, g, iv, i, TRUE, TRUE, st, blocks);
+				beltFMTHalfN(buf, g, iv, i, FALSE, TRUE, st, blocks);
+			}
 		else
-			beltWBLStepE(st->buf, 8 * st->b2 + 8, st->wbl);
-		beltBin2StrSub(st->mod, buf, st->n1, st->buf, st->b2 + 1);
-	}	
+			for (i = 3; i--;)
+			{
+				beltFMTHalfN(buf, g, iv, i, FALSE, FALSE, st, blocks);
+				beltFMTHalfN(buf, g, iv, i, TRUE, FALSE, st, blocks);
+			}
+	}
+	memWipe(blocks, sizeof(blocks));
+}
+
+void beltFMTStepEMulti(u16 buf[], size_t n, const octet iv[], void* state)
+{
+	beltFMTStepN(buf, n, iv, state, TRUE);
+}
+
+void beltFMTStepDMulti(u16 buf[], size_t n, const octet iv[], void* state)
+{
+	beltFMTStepN(buf, n, iv, state, FALSE);
 }
 
 err_t beltFMTEncr(u16 dest[], u32 mod, const u16 src[], size_t count,
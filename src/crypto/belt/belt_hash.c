@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): hashing
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2022.07.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "bee2/crypto/eng.h"
 #include "belt_lcl.h"
 
 /*
@@ -27,10 +28,10 @@
 */
 typedef struct {
 	u32 ls[8];				/*< блок [4]len || [4]s */
-	u32 s1[4];				/*< копия переменной s */
 	u32 h[8];				/*< переменная h */
 	u32 h1[8];				/*< копия переменной h */
 	octet block[32];		/*< блок данных */
+	u32 s1[4];				/*< копия переменной s */
 	size_t filled;			/*< накоплено октетов в блоке */
 	octet stack[];			/*< [beltCompr_deep()] стек beltCompr */
 } belt_hash_st;
@@ -96,6 +97,13 @@ void beltHashStepH(const void* buf, size_t count, void* state)
 		memCopy(st->block, buf, st->filled = count);
 }
 
+void beltHashStepHv(const mem_vec_t vec[], size_t n, void* state)
+{
+	ASSERT(memIsValid(vec, n * sizeof(mem_vec_t)));
+	for (; n--; ++vec)
+		beltHashStepH(vec->buf, vec->count, state);
+}
+
 static void beltHashStepG_internal(void* state)
 {
 	belt_hash_st* st = (belt_hash_st*)state;
@@ -167,7 +175,57 @@ bool_t beltHashStepV2(const octet hash[], size_t hash_len, void* state)
 	return memEq(hash, st->h1, hash_len);
 }
 
-err_t beltHash(octet hash[32], const void* src, size_t count)
+/*
+*******************************************************************************
+Сохранение и восстановление состояния
+
+Формат сохраненного состояния (99 октетов):
+-	[1] идентификатор BELT_HASH_SAVE_ID;
+-	[1] версия формата BELT_HASH_SAVE_VER;
+-	[32] ls -- длина обработанных данных и переменная s (слова в порядке
+	little-endian);
+-	[32] h -- переменная h (слова в порядке little-endian);
+-	[1] filled -- число накопленных в блоке октетов;
+-	[32] block -- блок данных.
+
+Копии s1, h1 и стек не сохраняются.
+*******************************************************************************
+*/
+
+#define BELT_HASH_SAVE_ID	0x48	/* 'H' */
+#define BELT_HASH_SAVE_VER	1
+
+void beltHashSave(octet buf[99], const void* state)
+{
+	const belt_hash_st* st = (const belt_hash_st*)state;
+	ASSERT(memIsValid(st, beltHash_keep()));
+	ASSERT(memIsDisjoint2(buf, 99, st, beltHash_keep()));
+	buf[0] = BELT_HASH_SAVE_ID;
+	buf[1] = BELT_HASH_SAVE_VER;
+	u32To(buf + 2, 32, st->ls);
+	u32To(buf + 34, 32, st->h);
+	buf[66] = (octet)st->filled;
+	memCopy(buf + 67, st->block, 32);
+}
+
+err_t beltHashLoad(void* state, const octet buf[99])
+{
+	belt_hash_st* st = (belt_hash_st*)state;
+	// проверить входные данные
+	if (!memIsValid(buf, 99) || !memIsValid(state, beltHash_keep()))
+		return ERR_BAD_INPUT;
+	if (buf[0] != BELT_HASH_SAVE_ID || buf[1] != BELT_HASH_SAVE_VER ||
+		buf[66] >= 32)
+		return ERR_BAD_FORMAT;
+	// восстановить состояние
+	u32From(st->ls, buf + 2, 32);
+	u32From(st->h, buf + 34, 32);
+	st->filled = buf[66];
+	memMove(st->block, buf + 67, 32);
+	return ERR_OK;
+}
+
+err_t beltHashSoft(octet hash[32], const void* src, size_t count)
 {
 	void* state;
 	// проверить входные данные
@@ -185,3 +243,98 @@ err_t beltHash(octet hash[32], const void* src, size_t count)
 	blobClose(state);
 	return ERR_OK;
 }
+
+err_t beltHash(octet hash[32], const void* src, size_t count)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_hash)
+	{
+		code = eng->belt_hash(eng->state, hash, src, count);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltHashSoft(hash, src, count);
+}
+
+/*
+*******************************************************************************
+Хэширование нескольких сообщений
+
+Сообщения обрабатываются четверками. Для каждой четверки одновременно
+выполняются четыре цепочки вычислений belt-compress: на k-м шаге j-я
+цепочка обрабатывает k-й блок j-го сообщения (дополненный нулями, если он
+неполный) или, если блоки сообщения закончились, заключительный блок
+len || s. Три зашифрования belt-block внутри каждого сжатия выполняются
+для всех цепочек одновременно с помощью beltBlockEncr4() (первое
+зашифрование -- на ключах X, два следующих -- на ключах, зависящих от
+результата первого), см. beltCompr4(). Цепочки, которые уже завершились, продолжают
+обрабатывать нулевые блоки, результаты при этом отбрасываются.
+*******************************************************************************
+*/
+
+err_t beltHashMulti(octet hash[], size_t n, const void* src[],
+	const size_t count[])
+{
+	u32* stack;
+	u32 (*s)[4];
+	u32 (*h)[8];
+	u32 (*X)[8];
+	size_t m[4];
+	size_t steps, g, j, k;
+	// проверить входные данные
+	if (!memIsValid(src, sizeof(const void*) * n) ||
+		!memIsValid(count, sizeof(size_t) * n) ||
+		!memIsValid(hash, 32 * n))
+		return ERR_BAD_INPUT;
+	for (j = 0; j < n; ++j)
+		if (!memIsValid(src[j], count[j]))
+			return ERR_BAD_INPUT;
+	// создать состояние
+	stack = (u32*)blobCreate(4 * (16 + 32 + 32 + 96));
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	s = (u32(*)[4])stack;
+	h = (u32(*)[8])(stack + 16);
+	X = (u32(*)[8])(stack + 48);
+	// цикл по четверкам
+	for (g = 0; g < n; g += 4)
+	{
+		// начать хэширование
+		for (j = steps = 0; j < 4; ++j)
+		{
+			beltBlockSetZero(s[j]);
+			u32From(h[j], beltH(), 32);
+			m[j] = g + j < n ? (count[g + j] + 31) / 32 : 0;
+			steps = MAX2(steps, m[j] + 1);
+		}
+		// шаги
+		for (k = 0; k < steps; ++k)
+		{
+			for (j = 0; j < 4; ++j)
+				if (g + j >= n || k > m[j])
+					memSetZero(X[j], 32);
+				else if (k < m[j])
+				{
+					size_t len = MIN2(32, count[g + j] - 32 * k);
+					memSetZero(X[j], 32);
+					u32From(X[j], (const octet*)src[g + j] + 32 * k, len);
+				}
+				else
+				{
+					// заключительный блок: len || s
+					beltBlockSetZero(X[j]);
+					beltBlockAddBitSizeU32(X[j], count[g + j]);
+					beltBlockCopy(X[j] + 4, s[j]);
+				}
+			beltCompr4(s, h, (const u32(*)[8])X, stack + 112);
+			// выгрузить хэш-значения завершенных цепочек
+			for (j = 0; j < 4; ++j)
+				if (g + j < n && k == m[j])
+					u32To(hash + 32 * (g + j), 32, h[j]);
+		}
+	}
+	// завершить
+	blobClose(stack);
+	return ERR_OK;
+}
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): HMAC message authentication
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2022.07.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -42,72 +42,150 @@ size_t beltHMAC_keep()
 	return sizeof(belt_hmac_st) + beltCompr_deep();
 }
 
-void beltHMACStart(void* state, const octet key[], size_t len)
+/*
+*******************************************************************************
+Подготовка ключа
+
+Функция beltHMACPads() обрабатывает ключ [len]key и определяет переменные
+s и h внутреннего (s_in, h_in) и внешнего (s_out, h_out) хэширования после
+сжатия блоков key ^ ipad и key ^ opad. Используются вспомогательные
+буферы ls и block. Функция вызывается также из brng.c.
+*******************************************************************************
+*/
+
+void beltHMACPads(u32 s_in[4], u32 h_in[8], u32 s_out[4],
+	u32 h_out[8], u32 ls[8], octet block[32], const octet key[], size_t len,
+	void* stack)
 {
-	belt_hmac_st* st = (belt_hmac_st*)state;
-	ASSERT(memIsDisjoint2(key, len, state, beltHMAC_keep()));
 	// key <- key || 0
 	if (len <= 32)
 	{
-		memCopy(st->block, key, len);
-		memSetZero(st->block + len, 32 - len);
+		memCopy(block, key, len);
+		memSetZero(block + len, 32 - len);
 #if (OCTET_ORDER == BIG_ENDIAN)
-		beltBlockRevU32(st->block);
-		beltBlockRevU32(st->block + 16);
+		beltBlockRevU32(block);
+		beltBlockRevU32(block + 16);
 #endif
 	}
 	// key <- beltHash(key)
 	else
 	{
-		beltBlockSetZero(st->ls_in);
-		beltBlockAddBitSizeU32(st->ls_in, len);
-		beltBlockSetZero(st->ls_in + 4);
-		u32From(st->h_in, beltH(), 32);
+		beltBlockSetZero(ls);
+		beltBlockAddBitSizeU32(ls, len);
+		beltBlockSetZero(ls + 4);
+		u32From(h_in, beltH(), 32);
 		while (len >= 32)
 		{
-			beltBlockCopy(st->block, key);
-			beltBlockCopy(st->block + 16, key + 16);
+			beltBlockCopy(block, key);
+			beltBlockCopy(block + 16, key + 16);
 #if (OCTET_ORDER == BIG_ENDIAN)
-			beltBlockRevU32(st->block);
-			beltBlockRevU32(st->block + 16);
+			beltBlockRevU32(block);
+			beltBlockRevU32(block + 16);
 #endif
-			beltCompr2(st->ls_in + 4, st->h_in, (u32*)st->block, st->stack);
+			beltCompr2(ls + 4, h_in, (u32*)block, stack);
 			key += 32;
 			len -= 32;
 		}
 		if (len)
 		{
-			memCopy(st->block, key, len);
-			memSetZero(st->block + len, 32 - len);
+			memCopy(block, key, len);
+			memSetZero(block + len, 32 - len);
 #if (OCTET_ORDER == BIG_ENDIAN)
-			beltBlockRevU32(st->block);
-			beltBlockRevU32(st->block + 16);
+			beltBlockRevU32(block);
+			beltBlockRevU32(block + 16);
 #endif
-			beltCompr2(st->ls_in + 4, st->h_in, (u32*)st->block, st->stack);
+			beltCompr2(ls + 4, h_in, (u32*)block, stack);
 		}
-		beltCompr(st->h_in, st->ls_in, st->stack);
-		beltBlockCopy(st->block, st->h_in);
-		beltBlockCopy(st->block + 16, st->h_in + 4);
+		beltCompr(h_in, ls, stack);
+		beltBlockCopy(block, h_in);
+		beltBlockCopy(block + 16, h_in + 4);
 	}
 	// сформировать key ^ ipad
 	for (len = 0; len < 32; ++len)
-		st->block[len] ^= 0x36;
+		block[len] ^= 0x36;
 	// начать внутреннее хэширование
+	beltBlockSetZero(s_in);
+	u32From(h_in, beltH(), 32);
+	beltCompr2(s_in, h_in, (u32*)block, stack);
+	// сформировать key ^ opad [0x36 ^ 0x5C == 0x6A]
+	for (; len--; )
+		block[len] ^= 0x6A;
+	// начать внешнее хэширование
+	beltBlockSetZero(s_out);
+	u32From(h_out, beltH(), 32);
+	beltCompr2(s_out, h_out, (u32*)block, stack);
+	memWipe(block, 32);
+}
+
+void beltHMACStart(void* state, const octet key[], size_t len)
+{
+	belt_hmac_st* st = (belt_hmac_st*)state;
+	ASSERT(memIsDisjoint2(key, len, state, beltHMAC_keep()));
+	beltHMACPads(st->ls_in + 4, st->h_in, st->ls_out + 4, st->h_out,
+		st->ls_in, st->block, key, len, st->stack);
+	// длина внутреннего хэширования [обработан один блок]
 	beltBlockSetZero(st->ls_in);
 	beltBlockAddBitSizeU32(st->ls_in, 32);
-	beltBlockSetZero(st->ls_in + 4);
-	u32From(st->h_in, beltH(), 32);
-	beltCompr2(st->ls_in + 4, st->h_in, (u32*)st->block, st->stack);
 	st->filled = 0;
-	// сформировать key ^ opad [0x36 ^ 0x5C == 0x6A]
-	for (; len--; )
-		st->block[len] ^= 0x6A;
-	// начать внешнее хэширование [будет хэшироваться ровно два блока]
+	// длина внешнего хэширования [будет хэшироваться ровно два блока]
+	beltBlockSetZero(st->ls_out);
+	beltBlockAddBitSizeU32(st->ls_out, 32 * 2);
+}
+
+/*
+*******************************************************************************
+Объект ключа HMAC
+
+Объект содержит переменные s и h внутреннего и внешнего хэширования после
+обработки ключа. Буферы ls, block и stack используются только при
+инициализации объекта.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	u32 s_in[4];		/*< переменная s внутреннего хэширования */
+	u32 h_in[8];		/*< переменная h внутреннего хэширования */
+	u32 s_out[4];		/*< переменная s внешнего хэширования */
+	u32 h_out[8];		/*< переменная h внешнего хэширования */
+	u32 ls[8];			/*< вспомогательный блок [4]len || [4]s */
+	octet block[32];	/*< вспомогательный блок данных */
+	octet stack[];		/*< [beltCompr_deep()] стек beltCompr */
+} belt_hmac_key_st;
+
+size_t beltHMACKey_keep()
+{
+	return sizeof(belt_hmac_key_st) + beltCompr_deep();
+}
+
+void beltHMACKeyStart(void* hkey, const octet key[], size_t len)
+{
+	belt_hmac_key_st* hk = (belt_hmac_key_st*)hkey;
+	ASSERT(memIsDisjoint2(key, len, hkey, beltHMACKey_keep()));
+	beltHMACPads(hk->s_in, hk->h_in, hk->s_out, hk->h_out, hk->ls,
+		hk->block, key, len, hk->stack);
+	memWipe(hk->ls, 32);
+}
+
+void beltHMACStartK(void* state, const void* hkey)
+{
+	belt_hmac_st* st = (belt_hmac_st*)state;
+	const belt_hmac_key_st* hk = (const belt_hmac_key_st*)hkey;
+	ASSERT(memIsDisjoint2(hkey, sizeof(belt_hmac_key_st), state,
+		beltHMAC_keep()));
+	// внутреннее хэширование
+	beltBlockSetZero(st->ls_in);
+	beltBlockAddBitSizeU32(st->ls_in, 32);
+	beltBlockCopy(st->ls_in + 4, hk->s_in);
+	beltBlockCopy(st->h_in, hk->h_in);
+	beltBlockCopy(st->h_in + 4, hk->h_in + 4);
+	st->filled = 0;
+	// внешнее хэширование
 	beltBlockSetZero(st->ls_out);
 	beltBlockAddBitSizeU32(st->ls_out, 32 * 2);
-	beltBlockSetZero(st->ls_out + 4);
-	u32From(st->h_out, beltH(), 32);
-	beltCompr2(st->ls_out + 4, st->h_out, (u32*)st->block, st->stack);
+	beltBlockCopy(st->ls_out + 4, hk->s_out);
+	beltBlockCopy(st->h_out, hk->h_out);
+	beltBlockCopy(st->h_out + 4, hk->h_out + 4);
 }
 
 void beltHMACStepA(const void* buf, size_t count, void* state)
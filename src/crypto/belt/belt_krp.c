@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): KRP (keyrep = key diversification + meshing)
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -69,6 +69,58 @@ void beltKRPStepG(octet key_[], size_t key_len, const octet header[16],
 	u32To(key_, key_len, st->key_new);
 }
 
+/*
+*******************************************************************************
+Преобразование ключа для нескольких заголовков
+
+Ключи строятся четверками: четыре сжатия belt-compr выполняются
+одновременно с помощью beltCompr4(). Первая половина блока r || level ||
+header у всех ключей общая и хранится в состоянии. Переменные четверки
+размещаются в локальной памяти, чтобы не увеличивать beltKRP_keep(),
+и очищаются перед возвратом.
+*******************************************************************************
+*/
+
+void beltKRPStepGMulti(octet key_[], size_t key_len, const octet header[],
+	size_t n, void* state)
+{
+	belt_krp_st* st = (belt_krp_st*)state;
+	u32 s[4][4];
+	u32 h[4][8];
+	u32 X[4][8];
+	u32 stack[96];
+	size_t g, m, j;
+	// pre
+	ASSERT(memIsValid(state, beltKRP_keep()));
+	ASSERT(key_len == 16 || key_len == 24 || key_len == 32);
+	ASSERT(key_len <= st->len);
+	ASSERT(memIsDisjoint2(key_, key_len * n, state, beltKRP_keep()));
+	ASSERT(memIsDisjoint2(header, 16 * n, state, beltKRP_keep()));
+	// r || level
+	u32From(st->block, beltH() + 4 * (st->len - 16) + 2 * (key_len - 16), 4);
+	// цикл по четверкам
+	for (g = 0; g < n; g += 4)
+	{
+		m = MIN2(4, n - g);
+		for (j = 0; j < 4; ++j)
+		{
+			beltBlockCopy(X[j], st->block);
+			if (j < m)
+				u32From(X[j] + 4, header + 16 * (g + j), 16);
+			else
+				beltBlockSetZero(X[j] + 4);
+			beltBlockCopy(h[j], st->key);
+			beltBlockCopy(h[j] + 4, st->key + 4);
+		}
+		beltCompr4(s, h, (const u32(*)[8])X, stack);
+		for (j = 0; j < m; ++j)
+			u32To(key_ + key_len * (g + j), key_len, h[j]);
+	}
+	memWipe(h, sizeof(h));
+	memWipe(X, sizeof(X));
+	memWipe(stack, sizeof(stack));
+}
+
 err_t beltKRP(octet dest[], size_t m, const octet src[], size_t n,
 	const octet level[12], const octet header[16])
 {
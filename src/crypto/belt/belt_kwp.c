@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): KWP (keywrap = key encryption + authentication)
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2019.06.26
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -87,3 +87,119 @@ err_t beltKWPUnwrap(octet dest[], const octet src[], size_t count,
 	blobClose(state);
 	return ERR_OK;
 }
+
+/*
+*******************************************************************************
+Перезащита нескольких ключей
+
+Ключи защиты расширяются однократно, состояния WBL используются в потоках
+только для чтения. Защищенные ключи обрабатываются группами
+по BELT_WBL_LANES: с группы снимается защита (beltWBLStepDMulti()),
+проверяются заголовки, затем устанавливается новая защита
+(beltWBLStepEMulti()). Расшифрованный ключ и его заголовок остаются
+на месте и сразу образуют входные данные зашифрования.
+
+Пакет разбивается на участки, кратные BELT_WBL_LANES, которые
+обрабатываются параллельно (см. beltParRun()). Трудоемкость перезащиты
+одного ключа оценивается как трудоемкость зашифрования 4 * count октетов
+(2 * 2n зашифрований belt-block, n = count / 16).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const octet* src;		/*< защищенные ключи участка */
+	const octet* header;	/*< заголовки ключей участка */
+	size_t count;			/*< длина защищенного ключа */
+	void* state_old;		/*< состояние WBL прежнего ключа */
+	void* state_new;		/*< состояние WBL нового ключа */
+	size_t bad;				/*< число ошибок */
+} belt_kwp_rewrap_st;
+
+static void beltKWPRewrapStep(void* buf, size_t n, void* state)
+{
+	belt_kwp_rewrap_st* job = (belt_kwp_rewrap_st*)state;
+	const size_t count = job->count;
+	octet* dest = (octet*)buf;
+	const octet* header = job->header;
+	bool_t bad[BELT_WBL_LANES];
+	size_t g, j;
+	// цикл по группам
+	memMove(dest, job->src, count * n);
+	for (; n; n -= g, dest += count * g, header = header ? header + 16 * g : 0)
+	{
+		g = MIN2(n, BELT_WBL_LANES);
+		// снять защиту и проверить заголовки
+		beltWBLStepDMulti(dest, count, g, job->state_old);
+		for (j = 0; j < g; ++j)
+		{
+			const octet* h = dest + count * j + count - 16;
+			bad[j] = header ? !memEq(h, header + 16 * j, 16) :
+				!memIsZero(h, 16);
+			if (bad[j])
+				job->bad++;
+		}
+		// установить защиту
+		beltWBLStepEMulti(dest, count, g, job->state_new);
+		for (j = 0; j < g; ++j)
+			if (bad[j])
+				memSetZero(dest + count * j, count);
+	}
+}
+
+err_t beltKWPRewrapMulti(octet dest[], const octet src[], size_t count,
+	size_t n, const octet header[], const octet key_old[], size_t len_old,
+	const octet key_new[], size_t len_new)
+{
+	belt_kwp_rewrap_st job[BELT_PAR_THREADS];
+	void* buf[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	void* state;
+	size_t work, part, threads, bad, i;
+	// проверить входные данные
+	if (count < 32 || n > SIZE_MAX / count ||
+		len_old != 16 && len_old != 24 && len_old != 32 ||
+		len_new != 16 && len_new != 24 && len_new != 32 ||
+		!memIsValid(src, count * n) ||
+		!memIsNullOrValid(header, 16 * n) ||
+		!memIsValid(key_old, len_old) ||
+		!memIsValid(key_new, len_new) ||
+		!memIsValid(dest, count * n) ||
+		!memIsSameOrDisjoint(src, dest, count * n))
+		return ERR_BAD_INPUT;
+	if (n == 0)
+		return ERR_OK;
+	// разбить пакет на участки
+	work = count * n < SIZE_MAX / 4 ? 4 * count * n : SIZE_MAX;
+	threads = MIN2(beltParCount(work),
+		(n + BELT_WBL_LANES - 1) / BELT_WBL_LANES);
+	part = (n + BELT_WBL_LANES * threads - 1) / (BELT_WBL_LANES * threads) *
+		BELT_WBL_LANES;
+	threads = (n + part - 1) / part;
+	// создать состояния
+	state = blobCreate(2 * beltWBL_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	beltWBLStart(state, key_old, len_old);
+	beltWBLStart((octet*)state + beltWBL_keep(), key_new, len_new);
+	// перезащитить ключи
+	for (i = 0; i < threads; ++i)
+	{
+		job[i].src = src + count * part * i;
+		job[i].header = header ? header + 16 * part * i : 0;
+		job[i].count = count;
+		job[i].state_old = state;
+		job[i].state_new = (octet*)state + beltWBL_keep();
+		job[i].bad = 0;
+		buf[i] = dest + count * part * i;
+		counts[i] = MIN2(part, n - part * i);
+		states[i] = job + i;
+	}
+	beltParRun(beltKWPRewrapStep, buf, counts, states, threads);
+	for (bad = i = 0; i < threads; ++i)
+		bad += job[i].bad;
+	// завершить
+	blobClose(state);
+	return bad ? ERR_BAD_KEYTOKEN : ERR_OK;
+}
@@ -4,13 +4,14 @@
 \brief STB 34.101.31 (belt): local functions
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.20
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
@@ -53,6 +54,30 @@ void beltBlockAddBitSizeU32(u32 block[4], size_t count)
 	carry = 0;
 }
 
+void beltBlockAddU32(u32 block[4], size_t count)
+{
+	// block <- block + count
+	register u32 carry = (u32)count;
+#if (B_PER_S < 32)
+	carry = (block[0] += carry) < carry;
+	carry = (block[1] += carry) < carry;
+	carry = (block[2] += carry) < carry;
+	block[3] += carry;
+#else
+	register size_t t = count >> 16;
+	t >>= 16;
+	carry = (block[0] += carry) < carry;
+	if ((block[1] += carry) < carry)
+		block[1] = (u32)t;
+	else
+		carry = (block[1] += (u32)t) < (u32)t;
+	carry = (block[2] += carry) < carry;
+	block[3] += carry;
+	t = 0;
+#endif
+	carry = 0;
+}
+
 void beltHalfBlockAddBitSizeW(word block[W_OF_B(64)], size_t count)
 {
 	// block <- block + 8 * count
@@ -90,10 +115,32 @@ void beltHalfBlockAddBitSizeW(word block[W_OF_B(64)], size_t count)
 /*
 *******************************************************************************
 Арифметика многочленов
+
+Многочлены степени < 128 над GF(2) представляются 128-битовыми числами:
+коэффициент при x^i -- это i-й бит числа. Умножение выполняется по модулю
+f(x) = x^128 + x^7 + x^2 + x + 1.
+
+Функция beltPolyMulBlocks() обрабатывает последовательность блоков
+X_1, X_2,..., X_n по правилу t <- (t + X_i) * r. Степени r, r^2, r^3, r^4
+рассчитываются заранее в beltPolyPow4().
+
+На платформе x86-64 при сборке компиляторами GCC и Clang дополнительно
+реализовано умножение с помощью инструкции PCLMULQDQ. Произведение
+256-битового числа на x^128 приводится по модулю f умножением старшей
+половины на x^7 + x^2 + x + 1 (тоже с помощью PCLMULQDQ). В
+beltPolyMulBlocks() четверки блоков обрабатываются с отложенным
+приведением:
+	t <- (t + X_1) * r^4 + X_2 * r^3 + X_3 * r^2 + X_4 * r.
+Сложение неприведенных произведений выполняется до приведения, которое
+выполняется один раз.
+
+Реализация PCLMULQDQ выбирается при первом обращении к beltPolyMul()
+или beltPolyMulBlocks() по результатам инструкции cpuid.
 *******************************************************************************
 */
 
-void beltPolyMul(word c[], const word a[], const word b[], void* stack)
+static void beltPolyMulPP(word c[], const word a[], const word b[],
+	void* stack)
 {
 	const size_t n = W_OF_B(128);
 	word* prod = (word*)stack;
@@ -105,12 +152,181 @@ void beltPolyMul(word c[], const word a[], const word b[], void* stack)
 	wwCopy(c, prod, n);
 }
 
+static void beltPolyMulBlocksPP(word t[], const void* buf, size_t count,
+	const word r[], void* stack)
+{
+	word block[W_OF_B(128)];
+	ASSERT(count % 16 == 0);
+	for (; count; count -= 16, buf = (const octet*)buf + 16)
+	{
+		beltBlockCopy(block, buf);
+#if (OCTET_ORDER == BIG_ENDIAN)
+		beltBlockRevW(block);
+#endif
+		beltBlockXor2(t, block);
+		beltPolyMulPP(t, t, r, stack);
+	}
+	memWipe(block, sizeof(block));
+}
+
+#if defined(__GNUC__) && defined(__x86_64__) && (B_PER_W == 64)
+
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#define BELT_CLMUL __attribute__((target("pclmul,sse2")))
+
+BELT_CLMUL static inline void beltClMul(__m128i* lo, __m128i* hi,
+	__m128i a, __m128i b)
+{
+	__m128i mid;
+	*lo = _mm_clmulepi64_si128(a, b, 0x00);
+	*hi = _mm_clmulepi64_si128(a, b, 0x11);
+	mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x01),
+		_mm_clmulepi64_si128(a, b, 0x10));
+	*lo = _mm_xor_si128(*lo, _mm_slli_si128(mid, 8));
+	*hi = _mm_xor_si128(*hi, _mm_srli_si128(mid, 8));
+}
+
+BELT_CLMUL static inline __m128i beltClRed(__m128i lo, __m128i hi)
+{
+	const __m128i p = _mm_set_epi64x(0, 0x87);
+	__m128i t;
+	// lo <- lo + hi_0 * (x^7 + x^2 + x + 1)
+	lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(hi, p, 0x00));
+	// lo <- lo + hi_1 * x^64 * (x^7 + x^2 + x + 1)
+	t = _mm_clmulepi64_si128(hi, p, 0x01);
+	lo = _mm_xor_si128(lo, _mm_slli_si128(t, 8));
+	// перенос за x^128
+	t = _mm_srli_si128(t, 8);
+	return _mm_xor_si128(lo, _mm_clmulepi64_si128(t, p, 0x00));
+}
+
+BELT_CLMUL static void beltPolyMulCL(word c[], const word a[],
+	const word b[], void* stack)
+{
+	__m128i lo, hi;
+	beltClMul(&lo, &hi, _mm_loadu_si128((const __m128i*)a),
+		_mm_loadu_si128((const __m128i*)b));
+	_mm_storeu_si128((__m128i*)c, beltClRed(lo, hi));
+}
+
+BELT_CLMUL static void beltPolyMulBlocksCL(word t[], const void* buf,
+	size_t count, const word r[], void* stack)
+{
+	const octet* x = (const octet*)buf;
+	__m128i h, lo, hi, lo1, hi1;
+	ASSERT(count % 16 == 0);
+	h = _mm_loadu_si128((const __m128i*)t);
+	// четверки блоков
+	for (; count >= 64; count -= 64, x += 64)
+	{
+		h = _mm_xor_si128(h, _mm_loadu_si128((const __m128i*)x));
+		beltClMul(&lo, &hi, h, _mm_loadu_si128((const __m128i*)(r + 6)));
+		beltClMul(&lo1, &hi1, _mm_loadu_si128((const __m128i*)(x + 16)),
+			_mm_loadu_si128((const __m128i*)(r + 4)));
+		lo = _mm_xor_si128(lo, lo1), hi = _mm_xor_si128(hi, hi1);
+		beltClMul(&lo1, &hi1, _mm_loadu_si128((const __m128i*)(x + 32)),
+			_mm_loadu_si128((const __m128i*)(r + 2)));
+		lo = _mm_xor_si128(lo, lo1), hi = _mm_xor_si128(hi, hi1);
+		beltClMul(&lo1, &hi1, _mm_loadu_si128((const __m128i*)(x + 48)),
+			_mm_loadu_si128((const __m128i*)r));
+		lo = _mm_xor_si128(lo, lo1), hi = _mm_xor_si128(hi, hi1);
+		h = beltClRed(lo, hi);
+	}
+	// оставшиеся блоки
+	for (; count; count -= 16, x += 16)
+	{
+		h = _mm_xor_si128(h, _mm_loadu_si128((const __m128i*)x));
+		beltClMul(&lo, &hi, h, _mm_loadu_si128((const __m128i*)r));
+		h = beltClRed(lo, hi);
+	}
+	_mm_storeu_si128((__m128i*)t, h);
+}
+
+static void beltPolyMulFirst(word c[], const word a[], const word b[],
+	void* stack);
+static void beltPolyMulBlocksFirst(word t[], const void* buf, size_t count,
+	const word r[], void* stack);
+
+static size_t _once;
+static void (*_belt_poly_mul)(word c[], const word a[], const word b[],
+	void* stack) = beltPolyMulFirst;
+static void (*_belt_poly_mul_blocks)(word t[], const void* buf,
+	size_t count, const word r[], void* stack) = beltPolyMulBlocksFirst;
+
+static void beltPolySelect()
+{
+	u32 info[4];
+	// PCLMULQDQ и SSE2?
+	if (__get_cpuid(1, info, info + 1, info + 2, info + 3) &&
+		(info[2] & 0x00000002) && (info[3] & 0x04000000))
+	{
+		_belt_poly_mul_blocks = beltPolyMulBlocksCL;
+		_belt_poly_mul = beltPolyMulCL;
+	}
+	else
+	{
+		_belt_poly_mul_blocks = beltPolyMulBlocksPP;
+		_belt_poly_mul = beltPolyMulPP;
+	}
+}
+
+static void beltPolyMulFirst(word c[], const word a[], const word b[],
+	void* stack)
+{
+	mtCallOnce(&_once, beltPolySelect);
+	_belt_poly_mul(c, a, b, stack);
+}
+
+static void beltPolyMulBlocksFirst(word t[], const void* buf, size_t count,
+	const word r[], void* stack)
+{
+	mtCallOnce(&_once, beltPolySelect);
+	_belt_poly_mul_blocks(t, buf, count, r, stack);
+}
+
+void beltPolyMul(word c[], const word a[], const word b[], void* stack)
+{
+	_belt_poly_mul(c, a, b, stack);
+}
+
+void beltPolyMulBlocks(word t[], const void* buf, size_t count,
+	const word r[], void* stack)
+{
+	_belt_poly_mul_blocks(t, buf, count, r, stack);
+}
+
+#else
+
+void beltPolyMul(word c[], const word a[], const word b[], void* stack)
+{
+	beltPolyMulPP(c, a, b, stack);
+}
+
+void beltPolyMulBlocks(word t[], const void* buf, size_t count,
+	const word r[], void* stack)
+{
+	beltPolyMulBlocksPP(t, buf, count, r, stack);
+}
+
+#endif
+
 size_t beltPolyMul_deep()
 {
 	const size_t n = W_OF_B(128);
 	return O_OF_W(2 * n) + ppMul_deep(n, n);
 }
 
+void beltPolyPow4(word r[], void* stack)
+{
+	const size_t n = W_OF_B(128);
+	beltPolyMul(r + n, r, r, stack);
+	beltPolyMul(r + 2 * n, r + n, r, stack);
+	beltPolyMul(r + 3 * n, r + 2 * n, r, stack);
+}
+
 /*
 *******************************************************************************
 Умножение на многочлен C(x) = x mod (x^128 + x^7 + x^2 + x + 1)
@@ -128,3 +344,50 @@ void beltBlockMulC(u32 block[4])
 	block[0] = (block[0] << 1) ^ t;
 	t = 0;
 }
+
+/*
+*******************************************************************************
+Параллельная обработка
+
+Буфер длины count разбивается на beltParCount(count) участков. Участки
+обрабатываются функцией step на собственных копиях состояния в потоках
+пула по умолчанию и в вызывающем потоке (см. mtPoolFor()).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	void (*step)(void* buf, size_t count, void* state);
+	void* buf;
+	size_t count;
+	void* state;
+} belt_par_st;
+
+static void beltParStep(size_t from, size_t to, void* arg)
+{
+	belt_par_st* par = (belt_par_st*)arg;
+	for (; from < to; ++from)
+		par[from].step(par[from].buf, par[from].count, par[from].state);
+}
+
+size_t beltParCount(size_t count)
+{
+	size_t n;
+	if (count < BELT_PAR_MIN)
+		return 1;
+	n = MIN3(mtProcCount(), (size_t)BELT_PAR_THREADS,
+		count / (BELT_PAR_MIN / 2));
+	return MAX2(n, 1);
+}
+
+void beltParRun(void (*step)(void* buf, size_t count, void* state),
+	void* buf[], const size_t count[], void* state[], size_t n)
+{
+	belt_par_st par[BELT_PAR_THREADS];
+	size_t i;
+	ASSERT(0 < n && n <= BELT_PAR_THREADS);
+	for (i = 0; i < n; ++i)
+		par[i].step = step, par[i].buf = buf[i], par[i].count = count[i],
+			par[i].state = state[i];
+	mtPoolFor(0, n, beltParStep, par);
+}
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): local definitions
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.20
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -201,14 +201,20 @@ extern "C" {
 /*
 *******************************************************************************
 Состояния CTR и WBL (используются в DWP, KWP и FMT)
+
+В этих и других состояниях belt блоки размещаются в начале по смещениям,
+кратным 16, а указатели и счетчики -- в конце. Поэтому в состоянии,
+выровненном на границу MEM_ALIGN, блоки выровнены на границу 16 байт.
 *******************************************************************************
 */
 
 typedef struct
 {
 	u32 key[8];			/*< форматированный ключ */
+	u32 ctr0[4];		/*< начальное значение счетчика */
 	u32 ctr[4];			/*< счетчик */
 	octet block[16];	/*< блок гаммы */
+	const u32* ext;		/*< присоединенный ключ (или 0) */
 	size_t reserved;	/*< резерв октетов гаммы */
 } belt_ctr_st;
 
@@ -220,19 +226,128 @@ typedef struct
 	word round;			/*< номер такта */
 } belt_wbl_st;
 
+/*
+*******************************************************************************
+Ключ
+
+Состояние belt_key_st содержит форматированный ключ. Состояния режимов,
+инициализированные функциями beltXXXStartK(), не копируют ключ, а ссылаются
+на него через поле ext. Если ext == 0, то используется собственный ключ
+состояния (поле key). Макрос beltStKey() возвращает действующий ключ.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	u32 key[8];			/*< форматированный ключ */
+} belt_key_st;
+
+#define beltStKey(st) ((st)->ext ? (st)->ext : (st)->key)
+
+/*
+*******************************************************************************
+Реализация belt-block
+
+Если флаг belt_ct установлен, то функции belt-block перенаправляют вызовы
+реализации без таблиц (см. belt_block_ct.c).
+*******************************************************************************
+*/
+
+extern bool_t belt_ct;
+
+/*
+*******************************************************************************
+Пакетная обработка
+
+Функции beltBlockEncrN() и beltBlockDecrN() обрабатывают пакеты из 16
+блоков одновременно (см. belt_block_wide.c), если платформа поддерживает
+пакетную обработку, а число блоков не меньше BELT_WIDE_MIN.
+*******************************************************************************
+*/
+
+#define BELT_WIDE_MIN 16
+
+/*
+*******************************************************************************
+Несколько широких блоков
+
+Функции beltWBLStepEMulti() и beltWBLStepDMulti() обрабатывают широкие
+блоки группами по BELT_WBL_LANES: на каждом такте блоки группы
+зашифровываются одним вызовом beltBlockEncrN().
+*******************************************************************************
+*/
+
+#define BELT_WBL_LANES 16
+
 /*
 *******************************************************************************
 Вспомогательные функции
 *******************************************************************************
 */
 
+void beltBlockEncr2K(u32 blocks[8], const u32 keys[16]);
+void beltBlockEncr4(u32 blocks[16], const u32 keys[32]);
+void beltBlockEncrCT(u32 blocks[], size_t count, const u32 key[8]);
+void beltBlockDecrCT(u32 blocks[], size_t count, const u32 key[8]);
+void beltBlockEncr4CT(u32 blocks[16], const u32 keys[32]);
+bool_t beltBlockWideIsAvail();
+void beltBlockEncrWide(octet blocks[], size_t count, const u32 key[8]);
+void beltBlockDecrWide(octet blocks[], size_t count, const u32 key[8]);
+void beltCompr4(u32 s[][4], u32 h[][8], const u32 X[][8], void* stack);
+size_t beltCompr4_deep();
 void beltBlockAddBitSizeU32(u32 block[4], size_t count);
+void beltBlockAddU32(u32 block[4], size_t count);
 void beltHalfBlockAddBitSizeW(word block[W_OF_B(64)], size_t count);
 void beltPolyMul(word c[], const word a[], const word b[], void* stack);
 size_t beltPolyMul_deep();
+void beltPolyPow4(word r[], void* stack);
+void beltPolyMulBlocks(word t[], const void* buf, size_t count,
+	const word r[], void* stack);
 void beltBlockMulC(u32 block[4]);
+void beltHMACPads(u32 s_in[4], u32 h_in[8], u32 s_out[4], u32 h_out[8],
+	u32 ls[8], octet block[32], const octet key[], size_t len, void* stack);
 
+/*
+*******************************************************************************
+Параллельная обработка
+
+Буфер обрабатывается параллельно, если его длина не меньше BELT_PAR_MIN.
+Длина участка не меньше BELT_PAR_MIN / 2, число участков не превосходит
+BELT_PAR_THREADS.
+*******************************************************************************
+*/
+
+#define BELT_PAR_MIN ((size_t)1 << 18)
+#define BELT_PAR_THREADS 16
+
+size_t beltParCount(size_t count);
+void beltParRun(void (*step)(void* buf, size_t count, void* state),
+	void* buf[], const size_t count[], void* state[], size_t n);
+
+/*
+*******************************************************************************
+Программные реализации
+
+Функции beltXXXSoft() -- это программные реализации высокоуровневых
+функций beltXXX(), которые перехватываются движками (см. eng.h).
+Функции используются как запасной путь, если перехватчик отсутствует
+или отказывается от обработки, и как перехватчики эталонного движка.
+*******************************************************************************
+*/
 
+err_t beltECBEncrSoft(void* dest, const void* src, size_t count,
+	const octet key[], size_t len);
+err_t beltECBDecrSoft(void* dest, const void* src, size_t count,
+	const octet key[], size_t len);
+err_t beltCBCEncrSoft(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16]);
+err_t beltCBCDecrSoft(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16]);
+err_t beltCTRSoft(void* dest, const void* src, size_t count,
+	const octet key[], size_t len, const octet iv[16]);
+err_t beltMACSoft(octet mac[8], const void* src, size_t count,
+	const octet key[], size_t len);
+err_t beltHashSoft(octet hash[32], const void* src, size_t count);
 
 #ifdef __cplusplus
 } /* extern "C" */
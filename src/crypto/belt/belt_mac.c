@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): MAC (message authentication)
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "bee2/crypto/eng.h"
 #include "belt_lcl.h"
 
 /*
@@ -27,6 +28,12 @@
 в которой не используется реверс октетов даже на платформах BIG_ENDIAN.
 Реверс применяется только перед сложением накопленного блока данных
 с текущей имитовставкой.
+
+На платформах LITTLE_ENDIAN реверс не нужен, и полные блоки данных,
+за исключением последнего, прибавляются к s непосредственно из буфера
+пользователя, без копирования в st->block. Последний блок
+(возможно, полный) по-прежнему накапливается в st->block: он
+обрабатывается особым образом в beltMACStepG().
 *******************************************************************************
 */
 typedef struct
@@ -36,6 +43,7 @@ typedef struct
 	u32 r[4];			/*< переменная r */
 	u32 mac[4];			/*< окончательная имитовставка */
 	octet block[16];	/*< блок данных */
+	const u32* ext;		/*< присоединенный ключ (или 0) */
 	size_t filled;		/*< накоплено октетов в блоке */
 } belt_mac_st;
 
@@ -49,12 +57,25 @@ void beltMACStart(void* state, const octet key[], size_t len)
 	belt_mac_st* st = (belt_mac_st*)state;
 	ASSERT(memIsValid(state, beltMAC_keep()));
 	beltKeyExpand2(st->key, key, len);
+	st->ext = 0;
 	beltBlockSetZero(st->s);
 	beltBlockSetZero(st->r);
 	beltBlockEncr2(st->r, st->key);
 	st->filled = 0;
 }
 
+void beltMACStartK(void* state, const void* key)
+{
+	belt_mac_st* st = (belt_mac_st*)state;
+	ASSERT(memIsValid(state, beltMAC_keep()));
+	ASSERT(memIsValid(key, beltKey_keep()));
+	st->ext = ((const belt_key_st*)key)->key;
+	beltBlockSetZero(st->s);
+	beltBlockSetZero(st->r);
+	beltBlockEncr2(st->r, st->ext);
+	st->filled = 0;
+}
+
 void beltMACStepA(const void* buf, size_t count, void* state)
 {
 	belt_mac_st* st = (belt_mac_st*)state;
@@ -73,6 +94,25 @@ void beltMACStepA(const void* buf, size_t count, void* state)
 		buf = (const octet*)buf + 16 - st->filled;
 		st->filled = 16;
 	}
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+	// прямая обработка блоков buf (без копирования в st->block)
+	if (count > 16)
+	{
+		beltBlockXor2(st->s, st->block);
+		beltBlockEncr2(st->s, beltStKey(st));
+		do
+		{
+			beltBlockXor2(st->s, buf);
+			beltBlockEncr2(st->s, beltStKey(st));
+			buf = (const octet*)buf + 16;
+			count -= 16;
+		}
+		while (count > 16);
+		memCopy(st->block, buf, count);
+		st->filled = count;
+		return;
+	}
+#endif
 	// цикл по полным блокам
 	while (count >= 16)
 	{
@@ -80,7 +120,7 @@ void beltMACStepA(const void* buf, size_t count, void* state)
 		beltBlockRevU32(st->block);
 #endif
 		beltBlockXor2(st->s, st->block);
-		beltBlockEncr2(st->s, st->key);
+		beltBlockEncr2(st->s, beltStKey(st));
 		beltBlockCopy(st->block, buf);
 		buf = (const octet*)buf + 16;
 		count -= 16;
@@ -92,12 +132,19 @@ void beltMACStepA(const void* buf, size_t count, void* state)
 		beltBlockRevU32(st->block);
 #endif
 		beltBlockXor2(st->s, st->block);
-		beltBlockEncr2(st->s, st->key);
+		beltBlockEncr2(st->s, beltStKey(st));
 		memCopy(st->block, buf, count);
 		st->filled = count;
 	}
 }
 
+void beltMACStepAv(const mem_vec_t vec[], size_t n, void* state)
+{
+	ASSERT(memIsValid(vec, n * sizeof(mem_vec_t)));
+	for (; n--; ++vec)
+		beltMACStepA(vec->buf, vec->count, state);
+}
+
 static void beltMACStepG_internal(void* state)
 {
 	belt_mac_st* st = (belt_mac_st*)state;
@@ -134,7 +181,7 @@ static void beltMACStepG_internal(void* state)
 		beltBlockRevU32(st->block);
 #endif
 	}
-	beltBlockEncr2(st->mac, st->key);
+	beltBlockEncr2(st->mac, beltStKey(st));
 }
 
 void beltMACStepG(octet mac[8], void* state)
@@ -179,7 +226,7 @@ bool_t beltMACStepV2(const octet mac[], size_t mac_len, void* state)
 	return memEq(mac, st->mac, mac_len);
 }
 
-err_t beltMAC(octet mac[8], const void* src, size_t count,
+err_t beltMACSoft(octet mac[8], const void* src, size_t count,
 	const octet key[], size_t len)
 {
 	void* state;
@@ -201,3 +248,133 @@ err_t beltMAC(octet mac[8], const void* src, size_t count,
 	blobClose(state);
 	return ERR_OK;
 }
+
+err_t beltMAC(octet mac[8], const void* src, size_t count,
+	const octet key[], size_t len)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->belt_mac)
+	{
+		code = eng->belt_mac(eng->state, mac, src, count, key, len);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return beltMACSoft(mac, src, count, key, len);
+}
+
+/*
+*******************************************************************************
+Имитозащита нескольких сообщений
+
+Сообщения обрабатываются четверками. Ключи четверки расширяются
+и размещаются в массиве keys[32] с перемежением (см. beltBlockEncr4()).
+Сообщение длины count разбивается на m = (count - 1) / 16 блоков цепочки
+(m = 0, если count == 0) и заключительный блок из count - 16m октетов.
+На k-м шаге j-я цепочка обрабатывает k-й блок j-го сообщения, и переменные
+s всех четырех цепочек зашифровываются одновременно одним вызовом
+beltBlockEncr4(). Если блоки цепочки j-го сообщения закончились,
+то j-я цепочка зашифровывает нулевой блок и результат отбрасывается.
+Переменные r и окончательные имитовставки четверки также вычисляются
+одним вызовом beltBlockEncr4().
+
+Стек: keys[32] || r[16] || s[16] || t[16] (слова u32). Массив t используется
+также для расширения ключей.
+*******************************************************************************
+*/
+
+err_t beltMACMulti(octet mac[], size_t n, const void* src[],
+	const size_t count[], const octet* key[], size_t len)
+{
+	u32* keys;
+	u32* r;
+	u32* s;
+	u32* t;
+	octet block[16];
+	size_t m[4];
+	size_t steps, g, i, j, k;
+	// проверить входные данные
+	if (len != 16 && len != 24 && len != 32 ||
+		!memIsValid(src, sizeof(const void*) * n) ||
+		!memIsValid(count, sizeof(size_t) * n) ||
+		!memIsValid(key, sizeof(const octet*) * n) ||
+		!memIsValid(mac, 8 * n))
+		return ERR_BAD_INPUT;
+	for (j = 0; j < n; ++j)
+		if (!memIsValid(src[j], count[j]) || !memIsValid(key[j], len))
+			return ERR_BAD_INPUT;
+	// создать состояние
+	keys = (u32*)blobCreate(4 * (32 + 16 + 16 + 16));
+	if (keys == 0)
+		return ERR_OUTOFMEMORY;
+	r = keys + 32, s = r + 16, t = s + 16;
+	// цикл по четверкам
+	for (g = 0; g < n; g += 4)
+	{
+		// расширить ключи, r_j <- beltBlock(0, key_j), s_j <- 0
+		for (j = steps = 0; j < 4; ++j)
+		{
+			beltKeyExpand2(t, key[g + j < n ? g + j : g], len);
+			for (i = 0; i < 8; ++i)
+				keys[4 * i + j] = t[i];
+			m[j] = g + j < n && count[g + j] ? (count[g + j] - 1) / 16 : 0;
+			steps = MAX2(steps, m[j]);
+		}
+		memSetZero(r, 64);
+		memSetZero(s, 64);
+		beltBlockEncr4(r, keys);
+		// шаги: s_j <- beltBlock(s_j + X_j, key_j)
+		for (k = 0; k < steps; ++k)
+		{
+			for (j = 0; j < 4; ++j)
+				if (k < m[j])
+				{
+					u32From(t + 4 * j, (const octet*)src[g + j] + 16 * k, 16);
+					beltBlockXor2(t + 4 * j, s + 4 * j);
+				}
+				else
+					beltBlockSetZero(t + 4 * j);
+			beltBlockEncr4(t, keys);
+			for (j = 0; j < 4; ++j)
+				if (k < m[j])
+					beltBlockCopy(s + 4 * j, t + 4 * j);
+		}
+		// заключительные блоки: t_j <- s_j + X_j + phi(r_j)
+		for (j = 0; j < 4; ++j)
+		{
+			u32* rj = r + 4 * j;
+			u32* tj = t + 4 * j;
+			size_t rest = g + j < n ? count[g + j] - 16 * m[j] : 0;
+			if (rest == 16)
+			{
+				u32From(tj, (const octet*)src[g + j] + 16 * m[j], 16);
+				beltBlockXor2(tj, s + 4 * j);
+				tj[0] ^= rj[1];
+				tj[1] ^= rj[2];
+				tj[2] ^= rj[3];
+				tj[3] ^= rj[0] ^ rj[1];
+			}
+			else
+			{
+				if (g + j < n)
+					memCopy(block, (const octet*)src[g + j] + 16 * m[j], rest);
+				block[rest] = 0x80;
+				memSetZero(block + rest + 1, 16 - rest - 1);
+				u32From(tj, block, 16);
+				beltBlockXor2(tj, s + 4 * j);
+				tj[0] ^= rj[0] ^ rj[3];
+				tj[1] ^= rj[0];
+				tj[2] ^= rj[1];
+				tj[3] ^= rj[2];
+			}
+		}
+		beltBlockEncr4(t, keys);
+		// выгрузить имитовставки
+		for (j = 0; j < 4 && g + j < n; ++j)
+			u32To(mac + 8 * (g + j), 8, t + 4 * j);
+	}
+	// завершить
+	memWipe(block, sizeof(block));
+	blobClose(keys);
+	return ERR_OK;
+}
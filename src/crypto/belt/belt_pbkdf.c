@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): PBKDF (password-based key derivation)
 \project bee2 [cryptographic library]
 \created 2012.12.18
-\version 2017.09.28
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,19 +13,221 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/u32.h"
+#include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
+#include "belt_lcl.h"
 
 /*
 *******************************************************************************
 Построение ключа по паролю
+
+Ключ HMAC (пароль) не меняется от итерации к итерации. Поэтому сжатия
+блоков key ^ ipad и key ^ opad выполняются однократно, а их результаты
+(переменные h и s внутреннего и внешнего хэширования) сохраняются
+в структуре belt_pads_st. После этого каждая итерация сводится к четырем
+сжатиям: блок t и блок len || s внутреннего хэширования, блок внутреннего
+хэш-значения и блок len || s внешнего хэширования. На всех итерациях,
+кроме первой, хэшируются сообщения длины 64 октета.
+
+При построении нескольких ключей итерации выполняются четверками:
+сжатия четырех цепочек выполняются одновременно с помощью beltCompr4().
+Большие пакеты дополнительно разбиваются на участки, которые
+обрабатываются в отдельных потоках (см. beltParRun()).
 *******************************************************************************
 */
 
+typedef struct
+{
+	u32 h_in[8];		/*< переменная h после сжатия key ^ ipad */
+	u32 s_in[4];		/*< переменная s после сжатия key ^ ipad */
+	u32 h_out[8];		/*< переменная h после сжатия key ^ opad */
+	u32 s_out[4];		/*< переменная s после сжатия key ^ opad */
+} belt_pads_st;
+
+typedef struct
+{
+	const octet** pwd;			/*< пароли */
+	const size_t* pwd_len;		/*< длины паролей */
+	const octet** salt;			/*< синхропосылки */
+	const size_t* salt_len;		/*< длины синхропосылок */
+	size_t iter;				/*< число итераций */
+	void* stack;				/*< [beltPBKDF2_deep()] стек */
+} belt_pbkdf_st;
+
+static size_t beltPBKDF2_deep()
+{
+	size_t deep = 4 * sizeof(belt_pads_st) + 2 * 4 * 32 +
+		utilMax(5,
+			beltHMAC_keep(),
+			32 + beltHash_keep(),
+			32 + beltCompr_deep(),
+			4 * (8 + 4 + 8) + beltCompr_deep(),
+			4 * (4 + 8 + 8) * 4 + beltCompr4_deep());
+	return (deep + 15) / 16 * 16;
+}
+
+static void beltPBKDF2Pads(belt_pads_st* pads, const octet pwd[],
+	size_t pwd_len, void* stack)
+{
+	u32* X = (u32*)stack;
+	size_t i;
+	stack = X + 8;
+	// X <- pwd || 0 или X <- beltHash(pwd)
+	if (pwd_len <= 32)
+	{
+		memSetZero(X, 32);
+		u32From(X, pwd, pwd_len);
+	}
+	else
+	{
+		beltHashStart(stack);
+		beltHashStepH(pwd, pwd_len, stack);
+		beltHashStepG((octet*)X, stack);
+		u32From(X, X, 32);
+	}
+	// сжать X ^ ipad
+	for (i = 0; i < 8; ++i)
+		X[i] ^= 0x36363636;
+	beltBlockSetZero(pads->s_in);
+	u32From(pads->h_in, beltH(), 32);
+	beltCompr2(pads->s_in, pads->h_in, X, stack);
+	// сжать X ^ opad [0x36 ^ 0x5C == 0x6A]
+	for (i = 0; i < 8; ++i)
+		X[i] ^= 0x6A6A6A6A;
+	beltBlockSetZero(pads->s_out);
+	u32From(pads->h_out, beltH(), 32);
+	beltCompr2(pads->s_out, pads->h_out, X, stack);
+	memWipe(X, 32);
+}
+
+static void beltPBKDF2Iter(u32 t[8], const belt_pads_st* pads, void* stack)
+{
+	u32* h = (u32*)stack;
+	u32* s = h + 8;
+	u32* X = s + 4;
+	stack = X + 8;
+	// h <- HMAC_in(t)
+	beltBlockCopy(h, pads->h_in);
+	beltBlockCopy(h + 4, pads->h_in + 4);
+	beltBlockCopy(s, pads->s_in);
+	beltCompr2(s, h, t, stack);
+	beltBlockSetZero(X);
+	beltBlockAddBitSizeU32(X, 64);
+	beltBlockCopy(X + 4, s);
+	beltCompr(h, X, stack);
+	// t <- HMAC_out(h)
+	beltBlockCopy(t, pads->h_out);
+	beltBlockCopy(t + 4, pads->h_out + 4);
+	beltBlockCopy(s, pads->s_out);
+	beltCompr2(s, t, h, stack);
+	beltBlockSetZero(X);
+	beltBlockAddBitSizeU32(X, 64);
+	beltBlockCopy(X + 4, s);
+	beltCompr(t, X, stack);
+}
+
+static void beltPBKDF2Iter4(u32 t[4][8], const belt_pads_st pads[4],
+	void* stack)
+{
+	u32 (*s)[4] = (u32(*)[4])stack;
+	u32 (*h)[8] = (u32(*)[8])(s + 4);
+	u32 (*X)[8] = h + 4;
+	size_t j;
+	stack = X + 4;
+	// h_j <- HMAC_in(t_j)
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockCopy(h[j], pads[j].h_in);
+		beltBlockCopy(h[j] + 4, pads[j].h_in + 4);
+		beltBlockCopy(s[j], pads[j].s_in);
+	}
+	beltCompr4(s, h, (const u32(*)[8])t, stack);
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockSetZero(X[j]);
+		beltBlockAddBitSizeU32(X[j], 64);
+		beltBlockCopy(X[j] + 4, s[j]);
+	}
+	beltCompr4(s, h, (const u32(*)[8])X, stack);
+	// t_j <- HMAC_out(h_j)
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockCopy(X[j], h[j]);
+		beltBlockCopy(X[j] + 4, h[j] + 4);
+		beltBlockCopy(h[j], pads[j].h_out);
+		beltBlockCopy(h[j] + 4, pads[j].h_out + 4);
+		beltBlockCopy(s[j], pads[j].s_out);
+	}
+	beltCompr4(s, h, (const u32(*)[8])X, stack);
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockSetZero(X[j]);
+		beltBlockAddBitSizeU32(X[j], 64);
+		beltBlockCopy(X[j] + 4, s[j]);
+	}
+	beltCompr4(s, h, (const u32(*)[8])X, stack);
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockCopy(t[j], h[j]);
+		beltBlockCopy(t[j] + 4, h[j] + 4);
+	}
+}
+
+static void beltPBKDF2Step(void* buf, size_t count, void* state)
+{
+	const belt_pbkdf_st* job = (const belt_pbkdf_st*)state;
+	octet* key = (octet*)buf;
+	belt_pads_st* pads = (belt_pads_st*)job->stack;
+	u32 (*t)[8] = (u32(*)[8])(pads + 4);
+	u32 (*k)[8] = t + 4;
+	void* stack = k + 4;
+	size_t g, m, i, j;
+	// цикл по четверкам
+	for (g = 0; g < count; g += 4)
+	{
+		m = MIN2(4, count - g);
+		// t_j <- HMAC(pwd_j, salt_j || 00000001), k_j <- t_j
+		for (j = 0; j < 4; ++j)
+		{
+			if (j < m)
+			{
+				beltHMACStart(stack, job->pwd[g + j], job->pwd_len[g + j]);
+				beltHMACStepA(job->salt[g + j], job->salt_len[g + j], stack);
+				memSetZero(t[j], 4), ((octet*)t[j])[3] = 1;
+				beltHMACStepA(t[j], 4, stack);
+				beltHMACStepG((octet*)t[j], stack);
+				u32From(t[j], t[j], 32);
+				beltPBKDF2Pads(pads + j, job->pwd[g + j],
+					job->pwd_len[g + j], stack);
+			}
+			else
+			{
+				memSetZero(pads + j, sizeof(belt_pads_st));
+				memSetZero(t[j], 32);
+			}
+			memCopy(k[j], t[j], 32);
+		}
+		// пересчитать k_j
+		for (i = 1; i < job->iter; ++i)
+		{
+			if (m == 1)
+				beltPBKDF2Iter(t[0], pads, stack);
+			else
+				beltPBKDF2Iter4(t, pads, stack);
+			for (j = 0; j < m; ++j)
+				memXor2(k[j], t[j], 32);
+		}
+		// выгрузить ключи
+		for (j = 0; j < m; ++j)
+			u32To(key + 32 * (g + j), 32, k[j]);
+	}
+}
+
 err_t beltPBKDF2(octet key[32], const octet pwd[], size_t pwd_len,
 	size_t iter, const octet salt[], size_t salt_len)
 {
-	void* state;
-	octet* t;
+	belt_pbkdf_st job[1];
 	// проверить входные данные
 	if (iter == 0 ||
 		!memIsValid(pwd, pwd_len) ||
@@ -33,26 +235,68 @@ err_t beltPBKDF2(octet key[32], const octet pwd[], size_t pwd_len,
 		!memIsValid(key, 32))
 		return ERR_BAD_INPUT;
 	// создать состояние
-	state = blobCreate(beltHMAC_keep() + 32);
-	if (state == 0)
+	job->stack = blobCreate(beltPBKDF2_deep());
+	if (job->stack == 0)
+		return ERR_OUTOFMEMORY;
+	// построить ключ
+	job->pwd = &pwd, job->pwd_len = &pwd_len;
+	job->salt = &salt, job->salt_len = &salt_len;
+	job->iter = iter;
+	beltPBKDF2Step(key, 1, job);
+	// завершить
+	blobClose(job->stack);
+	return ERR_OK;
+}
+
+err_t beltPBKDF2Multi(octet key[], size_t n, const octet* pwd[],
+	const size_t pwd_len[], size_t iter, const octet* salt[],
+	const size_t salt_len[])
+{
+	belt_pbkdf_st job[BELT_PAR_THREADS];
+	void* buf[BELT_PAR_THREADS];
+	size_t count[BELT_PAR_THREADS];
+	void* state[BELT_PAR_THREADS];
+	void* stack;
+	size_t deep, work, part, threads, i;
+	// проверить входные данные
+	if (iter == 0 ||
+		!memIsValid(pwd, sizeof(const octet*) * n) ||
+		!memIsValid(pwd_len, sizeof(size_t) * n) ||
+		!memIsValid(salt, sizeof(const octet*) * n) ||
+		!memIsValid(salt_len, sizeof(size_t) * n) ||
+		!memIsValid(key, 32 * n))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < n; ++i)
+		if (!memIsValid(pwd[i], pwd_len[i]) ||
+			!memIsValid(salt[i], salt_len[i]))
+			return ERR_BAD_INPUT;
+	if (n == 0)
+		return ERR_OK;
+	// разбить пакет на участки (по 4 * 32 октета сжимается на итерации)
+	work = iter < SIZE_MAX / 128 / n ? 128 * iter * n : SIZE_MAX;
+	threads = MIN2(beltParCount(work), (n + 3) / 4);
+	part = (n + 4 * threads - 1) / (4 * threads) * 4;
+	threads = (n + part - 1) / part;
+	// создать состояние
+	deep = beltPBKDF2_deep();
+	stack = blobCreate(deep * threads);
+	if (stack == 0)
 		return ERR_OUTOFMEMORY;
-	t = (octet*)state + beltHMAC_keep();
-	// key <- HMAC(pwd, salt || 00000001)
-	beltHMACStart(state, pwd, pwd_len);
-	beltHMACStepA(salt, salt_len, state);
-	*(u32*)key = 0, key[3] = 1;
-	beltHMACStepA(key, 4, state);
-	beltHMACStepG(key, state);
-	// пересчитать key
-	memCopy(t, key, 32);
-	while (--iter)
-	{
-		beltHMACStart(state, pwd, pwd_len);
-		beltHMACStepA(t, 32, state);
-		beltHMACStepG(t, state);
-		memXor2(key, t, 32);
+	// построить ключи
+	for (i = 0; i < threads; ++i)
+	{
+		job[i].pwd = pwd + part * i;
+		job[i].pwd_len = pwd_len + part * i;
+		job[i].salt = salt + part * i;
+		job[i].salt_len = salt_len + part * i;
+		job[i].iter = iter;
+		job[i].stack = (octet*)stack + deep * i;
+		buf[i] = key + 32 * part * i;
+		count[i] = MIN2(part, n - part * i);
+		state[i] = job + i;
 	}
+	beltParRun(beltPBKDF2Step, buf, count, state, threads);
 	// завершить
-	blobClose(state);
+	blobClose(stack);
 	return ERR_OK;
 }
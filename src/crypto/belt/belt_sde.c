@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): SDE (Sectorwise Disk Encryption)
 \project bee2 [cryptographic library]
 \created 2018.09.01
-\version 2020.03.24
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -71,6 +71,87 @@ void beltSDEStepD(void* buf, size_t count, const octet iv[16], void* state)
 	beltBlockXor2(buf, st->s);
 }
 
+/*
+*******************************************************************************
+Шифрование нескольких секторов в режиме SDE
+
+Синхропосылки секторов получаются увеличением синхропосылки первого
+сектора как 128-битового числа. Последовательность секторов разбивается
+на участки, которые обрабатываются в нескольких потоках
+(см. beltParRun()).
+*******************************************************************************
+*/
+typedef struct
+{
+	belt_sde_st sde[1];	/*< состояние SDE */
+	u32 iv[4];			/*< синхропосылка очередного сектора */
+	octet block[16];	/*< синхропосылка (октеты) */
+	size_t size;		/*< длина сектора */
+	bool_t encr;		/*< зашифрование? */
+} belt_sde_sec_st;
+
+static void beltSDESectors(void* buf, size_t count, void* state)
+{
+	belt_sde_sec_st* st = (belt_sde_sec_st*)state;
+	ASSERT(count % st->size == 0);
+	for (; count; count -= st->size)
+	{
+		u32To(st->block, 16, st->iv);
+		if (st->encr)
+			beltSDEStepE(buf, st->size, st->block, st->sde);
+		else
+			beltSDEStepD(buf, st->size, st->block, st->sde);
+		beltBlockIncU32(st->iv);
+		buf = (octet*)buf + st->size;
+	}
+}
+
+static void beltSDEStepMulti(void* buf, size_t size, size_t n,
+	const octet iv[16], const void* state, bool_t encr)
+{
+	belt_sde_sec_st part[BELT_PAR_THREADS];
+	void* bufs[BELT_PAR_THREADS];
+	size_t counts[BELT_PAR_THREADS];
+	void* states[BELT_PAR_THREADS];
+	size_t parts, offset, i;
+	ASSERT(size % 16 == 0 && size >= 32);
+	ASSERT(memIsDisjoint2(buf, size * n, state, beltSDE_keep()));
+	ASSERT(memIsValid(iv, 16));
+	if (n == 0)
+		return;
+	// разбить секторы на участки
+	parts = MIN2(beltParCount(size * n), n);
+	for (i = offset = 0; i < parts; ++i)
+	{
+		size_t len = n / parts + (i < n % parts);
+		memCopy(part[i].sde, state, sizeof(belt_sde_st));
+		u32From(part[i].iv, iv, 16);
+		beltBlockAddU32(part[i].iv, offset);
+		part[i].size = size, part[i].encr = encr;
+		bufs[i] = (octet*)buf + size * offset;
+		counts[i] = size * len;
+		states[i] = part + i;
+		offset += len;
+	}
+	ASSERT(offset == n);
+	// обработать участки
+	beltParRun(beltSDESectors, bufs, counts, states, parts);
+	// завершить
+	memWipe(part, sizeof(part));
+}
+
+void beltSDEStepEMulti(void* buf, size_t size, size_t n, const octet iv[16],
+	const void* state)
+{
+	beltSDEStepMulti(buf, size, n, iv, state, TRUE);
+}
+
+void beltSDEStepDMulti(void* buf, size_t size, size_t n, const octet iv[16],
+	const void* state)
+{
+	beltSDEStepMulti(buf, size, n, iv, state, FALSE);
+}
+
 err_t beltSDEEncr(void* dest, const void* src, size_t count,
 	const octet key[], size_t len, const octet iv[16])
 {
@@ -4,7 +4,7 @@
 \brief STB 34.101.31 (belt): wide block encryption
 \project bee2 [cryptographic library]
 \created 2017.11.03
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -30,12 +30,32 @@
 - в beltWBLStepEOpt() сумма sum = r1 + ... + r_{n-1} сохраняется и учитывается 
   при расчете такой же суммы на следующем такте (требуется 2 сложения 
   128-битовых блоков вместо n - 2);
-- в beltWBLStepD2() сумма sum = r2 + ... + r_{n-1} сохраняется и учитывается 
+- в beltWBLStepDOpt() сумма sum = r2 + ... + r_{n-1} сохраняется и учитывается 
   при расчете такой же суммы на следующем такте (требуется 2 сложения блоков 
-  вместо n - 3).
+  вместо n - 3);
+- буфер не сдвигается: блоки обрабатываются по кольцу, смещения блоков
+  пересчитываются без деления по модулю count;
+- номер такта добавляется к блоку одной операцией над словом.
 *******************************************************************************
 */
 
+/*
+*******************************************************************************
+Добавление номера такта
+
+Номер такта round добавляется к первому слову блока block. Блок block
+выровнен на границу слова (см. belt_wbl_st).
+*******************************************************************************
+*/
+
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+	#define beltBlockXorRound(block, round)\
+		((word*)(block))[0] ^= (round)
+#else // BIG_ENDIAN
+	#define beltBlockXorRound(block, round)\
+		((word*)(block))[0] ^= wordRev(round)
+#endif // OCTET_ORDER
+
 size_t beltWBL_keep()
 {
 	return sizeof(belt_wbl_st);
@@ -87,43 +107,40 @@ void beltWBLStepEOpt(void* buf, size_t count, void* state)
 {
 	belt_wbl_st* st = (belt_wbl_st*)state;
 	word n = ((word)count + 15) / 16;
-	size_t i;
+	octet* r = (octet*)buf;
+	size_t i, j;
 	ASSERT(count >= 32 && count % 16 == 0);
 	ASSERT(memIsDisjoint2(buf, count, state, beltWBL_keep()));
 	// sum <- r1 + ... + r_{n-1}
-	beltBlockCopy(st->sum, buf);
+	beltBlockCopy(st->sum, r);
 	for (i = 16; i + 16 < count; i += 16)
-		beltBlockXor2(st->sum, (octet*)buf + i);
+		beltBlockXor2(st->sum, r + i);
 	// 2 * n итераций 
 	ASSERT(st->round % (2 * n) == 0);
-	// sum будет записываться по смещению i: 
-	// это блок r1 в начале такта и блок r* в конце)
-	i = 0; 
+	// sum будет записываться по смещению i (это блок r1 в начале такта
+	// и блок r* в конце), блок r* начала такта находится по смещению j
+	i = 0, j = count - 16;
 	do
 	{
 		// block <- beltBlockEncr(sum) + <round>
 		beltBlockCopy(st->block, st->sum);
 		beltBlockEncr(st->block, st->key);
 		st->round++;
-#if (OCTET_ORDER == LITTLE_ENDIAN)
-		memXor2(st->block, &st->round, O_PER_W);
-#else // BIG_ENDIAN
-		st->round = wordRev(st->round);
-		memXor2(st->block, &st->round, O_PER_W);
-		st->round = wordRev(st->round);
-#endif // OCTET_ORDER
+		beltBlockXorRound(st->block, st->round);
 		// r* <- r* + block
-		beltBlockXor2((octet*)buf + (i + count - 16) % count, st->block);
+		beltBlockXor2(r + j, st->block);
 		// запомнить sum
 		beltBlockCopy(st->block, st->sum);
 		// пересчитать sum: добавить новое слагаемое
-		beltBlockXor2(st->sum, (octet*)buf + (i + count - 16) % count);
+		beltBlockXor2(st->sum, r + j);
 		// пересчитать sum: исключить старое слагаемое
-		beltBlockXor2(st->sum, (octet*)buf + i);
+		beltBlockXor2(st->sum, r + i);
 		// сохранить sum
-		beltBlockCopy((octet*)buf + i, st->block);
+		beltBlockCopy(r + i, st->block);
 		// вперед
-		i = (i + 16) % count;
+		j = i;
+		if ((i += 16) == count)
+			i = 0;
 	}
 	while (st->round % (2 * n));
 }
@@ -164,37 +181,35 @@ void beltWBLStepDOpt(void* buf, size_t count, void* state)
 {
 	belt_wbl_st* st = (belt_wbl_st*)state;
 	word n = ((word)count + 15) / 16;
-	size_t i;
+	octet* r = (octet*)buf;
+	size_t i, j, k;
 	ASSERT(count >= 32 && count % 16 == 0);
 	ASSERT(memIsDisjoint2(buf, count, state, beltWBL_keep()));
 	// sum <- r1 + ... + r_{n-2} (будущая сумма r2 + ... + r_{n-1})
-	beltBlockCopy(st->sum, (octet*)buf);
+	beltBlockCopy(st->sum, r);
 	for (i = 16; i + 32 < count; i += 16)
-		beltBlockXor2(st->sum, (octet*)buf + i);
-	// 2 * n итераций (sum будет записываться по смещению i: 
-	// это блок r* в начале такта и блок r1 в конце)
-	for (st->round = 2 * n, i = count - 16; st->round; --st->round)
+		beltBlockXor2(st->sum, r + i);
+	// 2 * n итераций (sum будет записываться по смещению i: это блок r*
+	// в начале такта и блок r1 в конце; j и k -- смещения двух
+	// предшествующих блоков)
+	i = count - 16, j = count - 32, k = count - 48;
+	for (st->round = 2 * n; st->round; --st->round)
 	{
 		// block <- beltBlockEncr(r*) + <round>
-		beltBlockCopy(st->block, (octet*)buf + i);
+		beltBlockCopy(st->block, r + i);
 		beltBlockEncr(st->block, st->key);
-#if (OCTET_ORDER == LITTLE_ENDIAN)
-		memXor2(st->block, &st->round, O_PER_W);
-#else // BIG_ENDIAN
-		st->round = wordRev(st->round);
-		memXor2(st->block, &st->round, O_PER_W);
-		st->round = wordRev(st->round);
-#endif // OCTET_ORDER
+		beltBlockXorRound(st->block, st->round);
 		// r* <- r* + block
-		beltBlockXor2((octet*)buf + (i + count - 16) % count, st->block);
+		beltBlockXor2(r + j, st->block);
 		// r1 <- pre r* + sum
-		beltBlockXor2((octet*)buf + i, st->sum);
+		beltBlockXor2(r + i, st->sum);
 		// пересчитать sum: исключить старое слагаемое
-		beltBlockXor2(st->sum, (octet*)buf + (i + count - 32) % count);
+		beltBlockXor2(st->sum, r + k);
 		// пересчитать sum: добавить новое слагаемое
-		beltBlockXor2(st->sum, (octet*)buf + i);
+		beltBlockXor2(st->sum, r + i);
 		// назад
-		i = (i + count - 16) % count;
+		i = j, j = k;
+		k = (k ? k : count) - 16;
 	}
 }
 
@@ -261,3 +276,99 @@ void beltWBLStepR(void* buf, size_t count, void* state)
 		beltWBLStepEBase(buf, count, state) :
 		beltWBLStepEOpt(buf, count, state);
 }
+
+/*
+*******************************************************************************
+Несколько широких блоков
+
+Широкие блоки одной длины обрабатываются группами по BELT_WBL_LANES.
+На каждом такте от каждого широкого блока группы отбирается по одному
+128-битовому блоку. Отобранные блоки размещаются подряд в массиве blocks
+и зашифровываются одним вызовом beltBlockEncrN(), который обрабатывает
+их четверками с перемежением или пакетом из 16 блоков (см. belt_block.c).
+Остальные шаги такта повторяют beltWBLStepEBase() и beltWBLStepDBase().
+
+В state используется только ключ, поэтому одно состояние можно
+одновременно использовать в нескольких потоках.
+*******************************************************************************
+*/
+
+void beltWBLStepEMulti(void* buf, size_t count, size_t n, void* state)
+{
+	const belt_wbl_st* st = (const belt_wbl_st*)state;
+	const word rounds = 2 * (((word)count + 15) / 16);
+	word blocks[BELT_WBL_LANES * 16 / O_PER_W];
+	octet* b = (octet*)blocks;
+	word round;
+	size_t g, i, j;
+	ASSERT(count >= 32);
+	ASSERT(memIsValid(state, beltWBL_keep()));
+	ASSERT(memIsDisjoint2(buf, count * n, state, beltWBL_keep()));
+	for (; n; n -= g, buf = (octet*)buf + count * g)
+	{
+		g = MIN2(n, BELT_WBL_LANES);
+		for (round = 1; round <= rounds; ++round)
+		{
+			for (j = 0; j < g; ++j)
+			{
+				octet* r = (octet*)buf + count * j;
+				// block_j <- r1 + ... + r_{n-1}
+				beltBlockCopy(b + 16 * j, r);
+				for (i = 16; i + 16 < count; i += 16)
+					beltBlockXor2(b + 16 * j, r + i);
+				// r <- ShLo^128(r), r* <- block_j
+				memMove(r, r + 16, count - 16);
+				beltBlockCopy(r + count - 16, b + 16 * j);
+			}
+			// block_j <- beltBlockEncr(block_j) + <round>
+			beltBlockEncrN(b, g, st->key);
+			for (j = 0; j < g; ++j)
+			{
+				octet* r = (octet*)buf + count * j;
+				beltBlockXorRound(b + 16 * j, round);
+				// r*_до_сдвига <- r*_до_сдвига + block_j
+				beltBlockXor2(r + count - 32, b + 16 * j);
+			}
+		}
+	}
+}
+
+void beltWBLStepDMulti(void* buf, size_t count, size_t n, void* state)
+{
+	const belt_wbl_st* st = (const belt_wbl_st*)state;
+	const word rounds = 2 * (((word)count + 15) / 16);
+	word blocks[BELT_WBL_LANES * 16 / O_PER_W];
+	octet* b = (octet*)blocks;
+	word round;
+	size_t g, i, j;
+	ASSERT(count >= 32);
+	ASSERT(memIsValid(state, beltWBL_keep()));
+	ASSERT(memIsDisjoint2(buf, count * n, state, beltWBL_keep()));
+	for (; n; n -= g, buf = (octet*)buf + count * g)
+	{
+		g = MIN2(n, BELT_WBL_LANES);
+		for (round = rounds; round; --round)
+		{
+			for (j = 0; j < g; ++j)
+			{
+				octet* r = (octet*)buf + count * j;
+				// block_j <- r*, r <- ShHi^128(r), r1 <- block_j
+				beltBlockCopy(b + 16 * j, r + count - 16);
+				memMove(r + 16, r, count - 16);
+				beltBlockCopy(r, b + 16 * j);
+			}
+			// block_j <- beltBlockEncr(block_j) + <round>
+			beltBlockEncrN(b, g, st->key);
+			for (j = 0; j < g; ++j)
+			{
+				octet* r = (octet*)buf + count * j;
+				beltBlockXorRound(b + 16 * j, round);
+				// r* <- r* + block_j
+				beltBlockXor2(r + count - 16, b + 16 * j);
+				// r1 <- r1 + r2 + ... + r_{n-1}
+				for (i = 16; i + 16 < count; i += 16)
+					beltBlockXor2(r, r + i);
+			}
+		}
+	}
+}
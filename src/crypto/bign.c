@@ -4,7 +4,7 @@
 \brief STB 34.101.45 (bign): digital signature and key transport algorithms
 \project bee2 [cryptographic library]
 \created 2012.04.27
-\version 2021.04.20
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -14,17 +14,23 @@
 #include "bee2/core/err.h"
 #include "bee2/core/der.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/obj.h"
 #include "bee2/core/oid.h"
 #include "bee2/core/str.h"
+#include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/belt.h"
 #include "bee2/crypto/bign.h"
+#include "bee2/crypto/eng.h"
 #include "crypto/bign_lcl.h"
 #include "bee2/math/gfp.h"
 #include "bee2/math/ecp.h"
 #include "bee2/math/pri.h"
 #include "bee2/math/ww.h"
+#include "bee2/math/zm.h"
 #include "bee2/math/zz.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -236,13 +242,60 @@ err_t bignStdParams(bign_params* params, const char* name)
 	return ERR_FILE_NOT_FOUND;
 }
 
+/*
+*******************************************************************************
+Распознавание стандартных параметров
+
+Функция bignIsStdParams() проверяет, что params совпадают с одним из 
+наборов bignStdParams() (без учета seed или с его учетом). Сравниваются 
+только значащие октеты (2l / 8 октетов p, a, b, q, yG). Сравнение 
+регулярное: все поля сравниваются полностью и результаты объединяются 
+без ветвлений.
+*******************************************************************************
+*/
+
+static const octet* const _curve128v1[] = {
+	_curve128v1_p, _curve128v1_a, _curve128v1_b, _curve128v1_q,
+	_curve128v1_yG, _curve128v1_seed,
+};
+
+static const octet* const _curve192v1[] = {
+	_curve192v1_p, _curve192v1_a, _curve192v1_b, _curve192v1_q,
+	_curve192v1_yG, _curve192v1_seed,
+};
+
+static const octet* const _curve256v1[] = {
+	_curve256v1_p, _curve256v1_a, _curve256v1_b, _curve256v1_q,
+	_curve256v1_yG, _curve256v1_seed,
+};
+
+static bool_t bignIsStdParams(const bign_params* params, bool_t seed)
+{
+	const size_t no = params->l / 4;
+	const octet* const* std;
+	if (params->l == 128)
+		std = _curve128v1;
+	else if (params->l == 192)
+		std = _curve192v1;
+	else if (params->l == 256)
+		std = _curve256v1;
+	else
+		return FALSE;
+	return memEq(params->p, std[0], no) &
+		memEq(params->a, std[1], no) &
+		memEq(params->b, std[2], no) &
+		memEq(params->q, std[3], no) &
+		memEq(params->yG, std[4], no) &
+		(!seed | memEq(params->seed, std[5], 8));
+}
+
 /*
 *******************************************************************************
 Создание / закрытие эллиптической кривой
 *******************************************************************************
 */
 
-err_t bignStart(void* state, const bign_params* params)
+static err_t bignStartRed(void* state, const bign_params* params, size_t red)
 {
 	// размерности
 	size_t no, n;
@@ -264,14 +317,15 @@ err_t bignStart(void* state, const bign_params* params)
 	// создать поле и выполнить минимальные проверки p
 	f = (qr_o*)((octet*)state + ec_keep);
 	stack = (octet*)f + f_keep;
-	if (!gfpCreate(f, params->p, no, stack) ||
+	if (params->p[0] % 2 == 0 ||
+		!zmCreateRed(f, params->p, no, red, stack) ||
 		wwBitSize(f->mod, n) != params->l * 2 ||
 		wwGetBits(f->mod, 0, 2) != 3)
 		return ERR_BAD_PARAMS;
 	// создать кривую и группу, выполнить минимальную проверку order
 	ec = (ec_o*)state;
 	if (!ecpCreateJ(ec, f, params->a, params->b, stack) ||
-		!ecCreateGroup(ec, 0, params->yG, params->q, no, 1, stack) ||
+		!ecCreateGroupBarr(ec, 0, params->yG, params->q, no, 1, stack) ||
 		wwBitSize(ec->order, n) != params->l * 2 ||
 		zzIsEven(ec->order, n))
 		return ERR_BAD_PARAMS;
@@ -281,6 +335,11 @@ err_t bignStart(void* state, const bign_params* params)
 	return ERR_OK;
 }
 
+err_t bignStart(void* state, const bign_params* params)
+{
+	return bignStartRed(state, params, ZM_RED_AUTO);
+}
+
 size_t bignStart_keep(size_t l, bign_deep_i deep)
 {
 	// размерности
@@ -295,7 +354,7 @@ size_t bignStart_keep(size_t l, bign_deep_i deep)
 	return f_keep + ec_keep +
 		utilMax(3,
 			ec_deep,
-			ecCreateGroup_deep(f_deep),
+			ecCreateGroupBarr_deep(n, f_deep),
 			deep ? deep(n, f_deep, ec_d, ec_deep) : 0);
 }
 
@@ -324,39 +383,195 @@ static size_t bignValParams_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return beltHash_keep() + O_OF_B(512) +
-		utilMax(6,
+		utilMax(7,
 			beltHash_keep(),
 			ecpIsValid_deep(n, f_deep),
 			ecpIsSafeGroup_deep(n),
 			ecpIsOnA_deep(n, f_deep),
-			qrPower_deep(n, n, f_deep),
+			zzJacobi_deep(n, n),
+			gfpSqrt_deep(n, f_deep),
 			ecHasOrderA_deep(n, ec_d, ec_deep, n));
 }
 
-err_t bignValParams(const bign_params* params)
+/*
+*******************************************************************************
+Кэш проверенных параметров
+
+Полная проверка параметров (bignValParamsFull()) включает проверку 
+простоты p и q, проверку условия MOV и проверку порядка G. Приложения, 
+которые извлекают параметры из сертификатов, проверяют одни и те же 
+параметры многократно. Поэтому bignValParams():
+-	признает корректными без вычислений параметры, которые совпадают 
+	(включая seed) с одним из наборов bignStdParams();
+-	сохраняет хэш-значения belt-hash(p || a || b || q || yG || seed) 
+	остальных успешно проверенных параметров в кэше _val_cache 
+	и не повторяет их проверку.
+.
+
+Кэш содержит BIGN_VAL_CACHE_SIZE хэш-значений, которые замещаются 
+по кругу. Отрицательные результаты не кэшируются. Кэш защищен 
+мьютексом _val_mtx.
+*******************************************************************************
+*/
+
+#define BIGN_VAL_CACHE_SIZE 8
+
+static size_t _val_once;				/*< триггер однократности */
+static mt_mtx_t _val_mtx[1];			/*< мьютекс */
+static bool_t _val_inited;				/*< мьютекс создан? */
+static octet _val_cache[BIGN_VAL_CACHE_SIZE][32];	/*< хэш-значения */
+static size_t _val_count;				/*< число хэш-значений */
+static size_t _val_next;				/*< следующая замещаемая ячейка */
+
+static void bignValCacheDestroy()
+{
+	mtMtxClose(_val_mtx);
+	_val_inited = FALSE;
+}
+
+static void bignValCacheInit()
+{
+	ASSERT(!_val_inited);
+	if (!mtMtxCreate(_val_mtx))
+		return;
+	if (!utilOnExit(bignValCacheDestroy))
+	{
+		mtMtxClose(_val_mtx);
+		return;
+	}
+	_val_inited = TRUE;
+}
+
+static void bignValDigest(octet digest[32], const bign_params* params)
+{
+	const size_t no = params->l / 4;
+	octet buf[5 * 64 + 8];
+	memCopy(buf, params->p, no);
+	memCopy(buf + no, params->a, no);
+	memCopy(buf + 2 * no, params->b, no);
+	memCopy(buf + 3 * no, params->q, no);
+	memCopy(buf + 4 * no, params->yG, no);
+	memCopy(buf + 5 * no, params->seed, 8);
+	beltHash(digest, buf, 5 * no + 8);
+}
+
+static bool_t bignValCacheFind(const octet digest[32])
+{
+	size_t i;
+	bool_t ret = FALSE;
+	if (!mtCallOnce(&_val_once, bignValCacheInit) || !_val_inited)
+		return FALSE;
+	mtMtxLock(_val_mtx);
+	for (i = 0; !ret && i < _val_count; ++i)
+		ret = memEq(_val_cache[i], digest, 32);
+	mtMtxUnlock(_val_mtx);
+	return ret;
+}
+
+static void bignValCacheAdd(const octet digest[32])
+{
+	if (!mtCallOnce(&_val_once, bignValCacheInit) || !_val_inited)
+		return;
+	mtMtxLock(_val_mtx);
+	memCopy(_val_cache[_val_next], digest, 32);
+	_val_next = (_val_next + 1) % BIGN_VAL_CACHE_SIZE;
+	if (_val_count < BIGN_VAL_CACHE_SIZE)
+		++_val_count;
+	mtMtxUnlock(_val_mtx);
+}
+
+/*
+*******************************************************************************
+Пошаговая проверка параметров
+
+Проверка разбита на шаги (номер следующего шага хранится в поле step
+состояния bign_val_st):
+1)	B (по seed), b \equiv B (mod p), b != 0, ecpIsValid (простота p);
+2)	ecpIsSafeGroup (простота q, условие MOV);
+3)	(b / p) = 1, G = (0, b^{(p + 1) /4});
+4)	qG = O.
+
+Описание кривой, построенное в bignValStart(), сохраняется в состоянии
+(сразу за структурой bign_val_st) между шагами.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t step;		/*< номер следующего шага */
+	size_t cache;		/*< сохранить digest в кэше при успехе? */
+	err_t code;			/*< итог проверки (ERR_NOT_READY -- не завершена) */
+	octet digest[32];	/*< хэш-значение параметров (для кэша) */
+	bign_params params[1];	/*< проверяемые параметры */
+} bign_val_st;
+
+#define bignValEc(st) ((ec_o*)((bign_val_st*)(st) + 1))
+
+size_t bignValParams_keep(size_t l)
+{
+	return sizeof(bign_val_st) + bignStart_keep(l, bignValParams_deep);
+}
+
+static err_t bignValStart(void* state, const bign_params* params,
+	bool_t cache)
 {
 	err_t code;
+	bign_val_st* st = (bign_val_st*)state;
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(state, bignValParams_keep(params->l)))
+		return ERR_BAD_INPUT;
+	// подготовить состояние
+	st->step = 1, st->cache = cache, st->code = ERR_NOT_READY;
+	memCopy(st->params, params, sizeof(bign_params));
+	// стандартные параметры или параметры уже проверялись?
+	if (cache)
+	{
+		if (bignIsStdParams(params, TRUE))
+			st->code = ERR_OK;
+		else
+		{
+			bignValDigest(st->digest, params);
+			if (bignValCacheFind(st->digest))
+				st->code = ERR_OK;
+		}
+		if (st->code == ERR_OK)
+			return ERR_OK;
+	}
+	// создать описание кривой
+	code = bignStart(bignValEc(st), params);
+	if (code != ERR_OK)
+		st->code = code;
+	return code;
+}
+
+err_t bignValParamsStart(void* state, const bign_params* params)
+{
+	return bignValStart(state, params, TRUE);
+}
+
+err_t bignValParamsStep(void* state)
+{
+	bign_val_st* st = (bign_val_st*)state;
+	const bign_params* params;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
 	ec_o* ec;				/* описание эллиптической кривой */
 	octet* hash_state;		/* [beltHash_keep] состояние хэширования */
 	octet* hash_data;		/* [8] данные хэширования */
 	word* B;				/* [W_OF_B(512)] переменная B */
 	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
+	// проверить состояние
+	if (!memIsValid(state, sizeof(bign_val_st)))
 		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignValParams_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
+	// проверка завершена?
+	if (st->code != ERR_NOT_READY)
+		return st->code;
+	params = st->params;
+	ec = bignValEc(st);
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
@@ -365,52 +580,95 @@ err_t bignValParams(const bign_params* params)
 	hash_data = hash_state + beltHash_keep();
 	B = (word*)hash_data;
 	stack = hash_data + O_OF_B(512);
-	// belt-hash(p..)
-	beltHashStart(hash_state);
-	beltHashStepH(params->p, no, hash_state);
-	// belt-hash(..a..)
-	beltHashStepH(params->a, no, hash_state);
-	memCopy(stack, hash_state, beltHash_keep());
-	// belt-hash(..seed)
-	memCopy(hash_data, params->seed, 8);
-	beltHashStepH(hash_data, 8, hash_state);
-	// belt-hash(..seed + 1)
-	wwFrom(B, hash_data, 8);
-	zzAddW2(B, W_OF_O(8), 1);
-	wwTo(hash_data, 8, B);
-	beltHashStepH(hash_data, 8, stack);
-	// B <- belt-hash(p || a || seed) || belt-hash(p || a || seed + 1)
-	beltHashStepG(hash_data, hash_state);
-	beltHashStepG(hash_data + 32, stack);
-	wwFrom(B, hash_data, 64);
-	// B <- B \mod p
-	zzMod(B, B, W_OF_O(64), ec->f->mod, n, stack);
-	wwTo(B, 64, B);
-	// проверить условия алгоритма 6.1.4
-	if (qrFrom(B, (octet*)B, ec->f, stack) &&
-		wwEq(B, ec->B, n) &&
-		!wwIsZero(ec->B, n) &&
-		ecpIsValid(ec, stack) &&
-		ecpIsSafeGroup(ec, 50, stack) &&
-		zzJacobi(ec->B, n, ec->f->mod, n, stack) == 1)
+	// шаги
+	switch (st->step++)
 	{
+	case 1:
+		// belt-hash(p..)
+		beltHashStart(hash_state);
+		beltHashStepH(params->p, no, hash_state);
+		// belt-hash(..a..)
+		beltHashStepH(params->a, no, hash_state);
+		memCopy(stack, hash_state, beltHash_keep());
+		// belt-hash(..seed)
+		memCopy(hash_data, params->seed, 8);
+		beltHashStepH(hash_data, 8, hash_state);
+		// belt-hash(..seed + 1)
+		wwFrom(B, hash_data, 8);
+		zzAddW2(B, W_OF_O(8), 1);
+		wwTo(hash_data, 8, B);
+		beltHashStepH(hash_data, 8, stack);
+		// B <- belt-hash(p || a || seed) || belt-hash(p || a || seed + 1)
+		beltHashStepG(hash_data, hash_state);
+		beltHashStepG(hash_data + 32, stack);
+		wwFrom(B, hash_data, 64);
+		// B <- B \mod p
+		zzMod(B, B, W_OF_O(64), ec->f->mod, n, stack);
+		wwTo(B, 64, B);
+		// проверить условия алгоритма 6.1.4
+		if (!qrFrom(B, (octet*)B, ec->f, stack) ||
+			!wwEq(B, ec->B, n) ||
+			wwIsZero(ec->B, n) ||
+			!ecpIsValid(ec, stack))
+			st->code = ERR_BAD_PARAMS;
+		break;
+	case 2:
+		if (!ecpIsSafeGroup(ec, 50, stack))
+			st->code = ERR_BAD_PARAMS;
+		break;
+	case 3:
 		// B <- b^{(p + 1) / 4} = \sqrt{b} mod p
-		wwCopy(B, ec->f->mod, n);
-		zzAddW2(B, n, 1);
-		wwShLo(B, n, 2);
-		qrPower(B, ec->B, B, n, ec->f, stack);
-		// оставшиеся условия
-		if (!wwEq(B, ecY(ec->base, n), n) ||
-			!ecHasOrderA(ec->base, ec, ec->order, n, stack))
-			code = ERR_BAD_PARAMS;
+		if (zzJacobi(ec->B, n, ec->f->mod, n, stack) != 1 ||
+			!gfpSqrt(B, ec->B, ec->f, stack) ||
+			!wwEq(B, ecY(ec->base, n), n))
+			st->code = ERR_BAD_PARAMS;
+		break;
+	default:
+		ASSERT(st->step == BIGN_VAL_STEPS + 1);
+		if (!ecHasOrderA(ec->base, ec, ec->order, n, stack))
+			st->code = ERR_BAD_PARAMS;
+		else
+		{
+			st->code = ERR_OK;
+			if (st->cache)
+				bignValCacheAdd(st->digest);
+		}
 	}
-	else
-		code = ERR_BAD_PARAMS;
+	return st->code;
+}
+
+static err_t bignValRun(const bign_params* params, bool_t cache)
+{
+	err_t code;
+	void* state;
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// создать состояние
+	state = blobCreate(bignValParams_keep(params->l));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// проверка
+	code = bignValStart(state, params, cache);
+	if (code == ERR_OK)
+		while ((code = bignValParamsStep(state)) == ERR_NOT_READY);
 	// завершение
 	blobClose(state);
 	return code;
 }
 
+err_t bignValParamsFull(const bign_params* params)
+{
+	return bignValRun(params, FALSE);
+}
+
+err_t bignValParams(const bign_params* params)
+{
+	return bignValRun(params, TRUE);
+}
+
 /*
 *******************************************************************************
 Идентификатор объекта
@@ -440,453 +698,2445 @@ err_t bignOidToDER(octet oid_der[], size_t* oid_len, const char* oid)
 
 /*
 *******************************************************************************
-Управление ключами
+Контекст
+
+Контекст -- это объект, который содержит описание эллиптической кривой, 
+построенное функцией bignStart(), и таблицу предвычислений гребенчатого 
+метода для базовой точки G. Функции bignCtxXXX() выделяют память только
+для стека, глубина которого рассчитывается по размерностям готового
+описания.
+
+Функции bignXXX() и bignCtxXXX() выполняются с помощью общих функций
+bignXXXEc(), которые работают с готовым описанием кривой и готовым стеком.
+Функции, которые определяют кратные G, дополнительно получают таблицу 
+предвычислений pre. Если таблица не задана (pre == 0, как в bignXXX()), 
+то кратные определяются с помощью ecMulA(). Для однократного расчета 
+кратной точки строить таблицу невыгодно.
+
+Ширина гребня BIGN_COMB_W выбрана так, чтобы таблица (2^{w-1} аффинных 
+точек) занимала не более 4 Кбайт на уровне стойкости 256. В профиле
+с низким потреблением памяти (директива LEAN_ENABLED) ширина гребня
+равняется 4, таблица занимает 1 Кбайт, готовые таблицы не используются.
+
+Для стандартных кривых таблица не строится: контекст ссылается на готовую 
+таблицу в памяти только для чтения (см. bignStdPre()), а кривая 
+описывается с редукцией ZM_RED_CRAND, в представлении которой записана 
+таблица. Готовая таблица -- внешняя ссылка объекта (см. obj.h), она 
+не входит в контекст и разделяется всеми процессами.
 *******************************************************************************
 */
 
-static size_t bignGenKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
+#ifdef LEAN_ENABLED
+	#define BIGN_COMB_W 4
+#else
+	#define BIGN_COMB_W 6
+#endif
+
+typedef struct
+{
+	obj_hdr_t hdr;			/*!< заголовок */
+// ptr_table {
+	ec_o* ec;				/*!< описание эллиптической кривой */
+	const word* pre;		/*!< таблица предвычислений для G */
+// }
+	octet descr[];			/*!< память для размещения данных */
+} bign_ctx;
+
+#define bignCtxEc(ctx) (((const bign_ctx*)(ctx))->ec)
+#define bignCtxPre(ctx) (((const bign_ctx*)(ctx))->pre)
+
+static bool_t bignMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], void* stack)
+{
+	if (pre)
+		return ecCombMulA(b, pre, ec, BIGN_COMB_W, d, ec->f->n, stack);
+	return ecMulA(b, ec->base, ec, d, ec->f->n, stack);
+}
+
+static size_t bignMulBase_deep(size_t n, size_t ec_d, size_t ec_deep)
+{
+	return utilMax(2,
+		ecMulA_deep(n, ec_d, ec_deep, n),
+		ecCombMulA_deep(n, ec_d, ec_deep, BIGN_COMB_W));
+}
+
+static bool_t bignAddMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], const word a[], const word e[], size_t m, void* stack)
+{
+	// без таблицы
+	if (!pre)
+		return ecAddMulA(b, ec, stack, 2, ec->base, d, ec->f->n, a, e, m);
+	// с таблицей (d и e не являются секретными)
+	return ecCombAddMulA(b, pre, ec, BIGN_COMB_W, d, ec->f->n, a, e, m,
+		stack);
+}
+
+static size_t bignAddMulBase_deep(size_t n, size_t ec_d, size_t ec_deep,
+	size_t m)
+{
+	return utilMax(2,
+		ecAddMulA_deep(n, ec_d, ec_deep, 2, n, m),
+		ecCombAddMulA_deep(n, ec_d, ec_deep, BIGN_COMB_W, m));
+}
+
+static size_t bignCtxStart_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return O_OF_W(n + 2 * n) +
-		ecMulA_deep(n, ec_d, ec_deep, n);
+	return ecCombPrecA_deep(n, ec_d, ec_deep);
 }
 
-err_t bignGenKeypair(octet privkey[], octet pubkey[],
-	const bign_params* params, gen_i rng, void* rng_state)
+size_t bignCtx_keep(size_t l)
+{
+	// размерности
+	size_t no = O_OF_B(2 * l);
+	size_t n = W_OF_B(2 * l);
+	// расчет
+	return sizeof(bign_ctx) + ecCombPrecA_keep(n, BIGN_COMB_W) +
+		gfpCreate_keep(no) + ecpCreateJ_keep(n);
+}
+
+err_t bignCtxStart(void* ctx, const bign_params* params)
 {
 	err_t code;
-	size_t no, n;
-	// состояние
+	const word* pre;
 	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
-	word* d;				/* [n] личный ключ */
-	word* Q;				/* [2n] открытый ключ */
-	void* stack;
+	bign_ctx* c = (bign_ctx*)ctx;
 	// проверить params
 	if (!memIsValid(params, sizeof(bign_params)))
 		return ERR_BAD_INPUT;
 	if (params->l != 128 && params->l != 192 && params->l != 256)
 		return ERR_BAD_PARAMS;
-	// проверить rng
-	if (rng == 0)
-		return ERR_BAD_RNG;
+	// проверить ctx
+	if (!memIsValid(ctx, bignCtx_keep(params->l)))
+		return ERR_BAD_INPUT;
 	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignGenKeypair_deep));
+	state = blobCreate(bignStart_keep(params->l, bignCtxStart_deep));
 	if (state == 0)
 		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
+	// стандартная кривая с готовой таблицей?
+	pre = bignIsStdParams(params, FALSE) ? bignStdPre(params->l) : 0;
+	// старт (готовая таблица рассчитана для редукции Крэндалла)
+	code = bignStartRed(state, params, pre ? ZM_RED_CRAND : ZM_RED_AUTO);
 	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
-	// размерности
-	no  = ec->f->no;
-	n = ec->f->n;
-	// проверить входные указатели
-	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
-	{
-		blobClose(state);
-		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
-	Q = d + n;
-	stack = Q + 2 * n;
-	// d <-R {1,2,..., q - 1}
-	if (!zzRandNZMod(d, ec->f->mod, n, rng, rng_state))
-	{
-		blobClose(state);
-		return ERR_BAD_RNG;
-	}
-	// Q <- d G
-	if (ecMulA(Q, ec->base, ec, d, n, stack))
-	{
-		// выгрузить ключи
-		wwTo(privkey, no, d);
-		qrTo(pubkey, ecX(Q), ec->f, stack);
-		qrTo(pubkey + no, ecY(Q, n), ec->f, stack);
-	}
-	else
+	// подготовить контекст
+	c->hdr.keep = sizeof(bign_ctx);
+	if (!pre)
+		c->hdr.keep += ecCombPrecA_keep(W_OF_B(2 * params->l), BIGN_COMB_W);
+	c->hdr.p_count = 2;
+	c->hdr.o_count = 1;
+	c->ec = (ec_o*)state;
+	c->pre = pre ? pre : (const word*)c->descr;
+	// перенести описание кривой в контекст
+	ASSERT(objKeep(c) + objKeep(state) <= bignCtx_keep(params->l));
+	objAppend(c, state, 0);
+	// построить таблицу предвычислений
+	if (!pre && !ecCombPrecA((word*)c->descr, c->ec->base, c->ec, BIGN_COMB_W,
+		objEnd(state, void)))
 		code = ERR_BAD_PARAMS;
 	// завершение
 	blobClose(state);
 	return code;
 }
 
-static size_t bignValKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
+static bool_t bignCtxIsOperable(const void* ctx)
+{
+	const bign_ctx* c = (const bign_ctx*)ctx;
+	return memIsValid(c, sizeof(bign_ctx)) &&
+		objPCount(c) == 2 && objOCount(c) == 1 &&
+		objIsOperable(c) &&
+		ecIsOperable(c->ec) &&
+		ecIsOperableGroup(c->ec) &&
+		wwIsValid(c->pre, c->ec->f->n << BIGN_COMB_W);
+}
+
+static void* bignCtxStackCreate(const void* ctx, bign_deep_i deep)
+{
+	const ec_o* ec = bignCtxEc(ctx);
+	return blobCreate(deep(ec->f->n, ec->f->deep, ec->d, ec->deep));
+}
+
+static bool_t bignCtxStackIsValid(const void* ctx, const void* stack,
+	bign_deep_i deep)
+{
+	const ec_o* ec = bignCtxEc(ctx);
+	return memIsValid(stack, deep(ec->f->n, ec->f->deep, ec->d, ec->deep));
+}
+
+/*
+*******************************************************************************
+Сохранение и загрузка контекста
+
+Образ контекста -- строка октетов следующего формата:
+-	[4] сигнатура "BCTX";
+-	[28] заголовок: 7 чисел u32 (little-endian) -- версия формата 
+	(BIGN_CTX_VERSION), уровень стойкости l, длина машинного слова B_PER_W, 
+	порядок октетов в слове (0 -- little-endian, 1 -- big-endian), 
+	редукция в базовом поле (см. zmRed()), ширина гребня BIGN_COMB_W, 
+	резерв (0);
+-	[32] хэш-значение belt-hash описания кривой: p, a, b, q, yG
+	(по 2l / 8 октетов, см. bignCtxDigest());
+-	[ecCombPrecA_keep(n, BIGN_COMB_W)] таблица предвычислений в машинном 
+	представлении (слова, элементы поля с редукцией из заголовка);
+-	[32] хэш-значение belt-hash всех предыдущих октетов.
+.
+
+Образ не содержит указателей и не зависит от адреса размещения. При 
+загрузке описание кривой строится заново (это быстро) с редукцией 
+из заголовка, а указатель на таблицу предвычислений направляется внутрь 
+образа (внешняя ссылка объекта, см. obj.h). Поэтому образ можно 
+отобразить в память только для чтения и использовать в нескольких 
+процессах без копирования.
+
+Хэш-значение защищает от случайных искажений образа, но не от 
+преднамеренных: злоумышленник может пересчитать его. При загрузке 
+дополнительно проверяется, что все точки таблицы лежат на кривой, 
+а первая точка и опорные точки G + 2^{js}G, j = 1,..., BIGN_COMB_W - 1 
+(s -- шаг гребня, см. ecCombPrecA()), совпадают с кратными G, которые 
+вычисляются заново. Остальные точки таблицы являются суммами опорных 
+и проверяются только на принадлежность кривой. Поэтому образ, который 
+искажен преднамеренно, может быть загружен и давать неверные подписи. 
+Образ следует получать из доверенного источника.
+*******************************************************************************
+*/
+
+#define BIGN_CTX_VERSION 1
+#define BIGN_CTX_HDR 64
+
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+	#define BIGN_CTX_ORDER 0
+#else
+	#define BIGN_CTX_ORDER 1
+#endif
+
+static size_t bignCtxImage_size(size_t n)
+{
+	return BIGN_CTX_HDR + ecCombPrecA_keep(n, BIGN_COMB_W) + 32;
+}
+
+static size_t bignCtxLoad_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return O_OF_W(n + 2 * n) +
-		ecMulA_deep(n, ec_d, ec_deep, n);
+	return utilMax(3,
+		O_OF_W(5 * n) + f_deep,
+		ecpIsOnA_deep(n, f_deep),
+		ecCombPrecA_deep(n, ec_d, ec_deep));
 }
 
-err_t bignValKeypair(const bign_params* params, const octet privkey[],
-	const octet pubkey[])
+static bool_t bignCtxPreIsValid(const word pre[], const ec_o* ec, 
+	void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t s = (wwBitSize(ec->order, n + 1) + BIGN_COMB_W - 1) / 
+		BIGN_COMB_W;
+	size_t i, j;
+	// переменные в stack
+	word* t;			/* t = 2^{js}G */
+	word* u;			/* u = G + 2^{js}G */
+	word* p;			/* p = G + 2^{js}G (аффинная) */
+	// раскладка stack
+	t = (word*)stack;
+	u = t + ec->d * n;
+	p = u + ec->d * n;
+	stack = p + 2 * n;
+	// pre[0] == G?
+	if (!wwEq(pre, ec->base, 2 * n))
+		return FALSE;
+	// pre[2^{j - 1}] == G + 2^{js}G?
+	ecFromA(t, ec->base, ec, stack);
+	for (j = 1; j < BIGN_COMB_W; ++j)
+	{
+		for (i = 0; i < s; ++i)
+			ecDbl(t, t, ec, stack);
+		ecAddA(u, t, ec->base, ec, stack);
+		if (!ecToA(p, u, ec, stack) ||
+			!wwEq(p, pre + 2 * n * (SIZE_1 << (j - 1)), 2 * n))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static void bignCtxDigest(octet digest[32], const ec_o* ec, void* stack)
+{
+	const size_t no = ec->f->no;
+	octet* buf = (octet*)stack;
+	stack = buf + 5 * no;
+	wwTo(buf, no, ec->f->mod);
+	qrTo(buf + no, ec->A, ec->f, stack);
+	qrTo(buf + 2 * no, ec->B, ec->f, stack);
+	wwTo(buf + 3 * no, no, ec->order);
+	qrTo(buf + 4 * no, ecY(ec->base, ec->f->n), ec->f, stack);
+	beltHash(digest, buf, 5 * no);
+	memWipe(buf, 5 * no);
+}
+
+err_t bignCtxSave(octet image[], size_t* count, const void* ctx)
+{
+	const bign_ctx* c = (const bign_ctx*)ctx;
+	size_t n;
+	u32 hdr[7];
+	void* stack;
+	// проверить входные данные
+	if (!bignCtxIsOperable(ctx) || !memIsValid(count, sizeof(size_t)))
+		return ERR_BAD_INPUT;
+	n = c->ec->f->n;
+	// только длина?
+	if (!image)
+	{
+		*count = bignCtxImage_size(n);
+		return ERR_OK;
+	}
+	if (!memIsValid(image, bignCtxImage_size(n)))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = blobCreate(bignCtxLoad_deep(n, c->ec->f->deep, 0, 0));
+	if (!stack)
+		return ERR_OUTOFMEMORY;
+	// заголовок
+	hdr[0] = BIGN_CTX_VERSION;
+	hdr[1] = (u32)(c->ec->f->no * 4);
+	hdr[2] = B_PER_W;
+	hdr[3] = BIGN_CTX_ORDER;
+	hdr[4] = (u32)zmRed(c->ec->f);
+	hdr[5] = BIGN_COMB_W;
+	hdr[6] = 0;
+	memCopy(image, "BCTX", 4);
+	u32To(image + 4, 28, hdr);
+	bignCtxDigest(image + 32, c->ec, stack);
+	// таблица
+	memCopy(image + BIGN_CTX_HDR, c->pre, ecCombPrecA_keep(n, BIGN_COMB_W));
+	// контрольное хэш-значение
+	*count = bignCtxImage_size(n);
+	beltHash(image + *count - 32, image, *count - 32);
+	// завершение
+	blobClose(stack);
+	return ERR_OK;
+}
+
+size_t bignCtxLoad_keep(size_t l)
+{
+	// размерности
+	size_t no = O_OF_B(2 * l);
+	size_t n = W_OF_B(2 * l);
+	// расчет
+	return sizeof(bign_ctx) + gfpCreate_keep(no) + ecpCreateJ_keep(n);
+}
+
+err_t bignCtxLoad(void* ctx, const bign_params* params, const octet image[],
+	size_t count)
 {
 	err_t code;
-	size_t no, n;
-	// состояние
+	size_t n, i;
+	u32 hdr[7];
+	octet digest[32];
 	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
-	word* d;				/* [n] личный ключ */
-	word* Q;				/* [2n] открытый ключ */
 	void* stack;
+	bign_ctx* c = (bign_ctx*)ctx;
 	// проверить params
 	if (!memIsValid(params, sizeof(bign_params)))
 		return ERR_BAD_INPUT;
 	if (params->l != 128 && params->l != 192 && params->l != 256)
 		return ERR_BAD_PARAMS;
+	// проверить ctx и image
+	n = W_OF_B(2 * params->l);
+	if (!memIsValid(ctx, bignCtxLoad_keep(params->l)) ||
+		!memIsValid(image, count))
+		return ERR_BAD_INPUT;
+	// проверить формат
+	if (count != bignCtxImage_size(n) || !memEq(image, "BCTX", 4))
+		return ERR_BAD_FORMAT;
+	u32From(hdr, image + 4, 28);
+	if (hdr[0] != BIGN_CTX_VERSION || hdr[1] != params->l ||
+		hdr[2] != B_PER_W || hdr[3] != BIGN_CTX_ORDER ||
+		hdr[4] == ZM_RED_AUTO || zmRedName(hdr[4]) == 0 ||
+		hdr[5] != BIGN_COMB_W || hdr[6] != 0)
+		return ERR_BAD_FORMAT;
+	// таблица выровнена?
+	if ((size_t)(image + BIGN_CTX_HDR) % O_PER_W)
+		return ERR_BAD_INPUT;
+	// проверить целостность
+	beltHash(digest, image, count - 32);
+	if (!memEq(digest, image + count - 32, 32))
+		return ERR_BAD_HASH;
 	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignValKeypair_deep));
+	state = blobCreate(bignStart_keep(params->l, bignCtxLoad_deep));
 	if (state == 0)
 		return ERR_OUTOFMEMORY;
 	// старт
-	code = bignStart(state, params);
+	code = bignStartRed(state, params, hdr[4]);
 	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
-	// размерности
-	no = ec->f->no;
-	n = ec->f->n;
-	// проверить входные указатели
-	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
+	// образ соответствует params?
+	stack = objEnd(state, void);
+	bignCtxDigest(digest, (const ec_o*)state, stack);
+	if (!memEq(digest, image + 32, 32))
+		code = ERR_BAD_PARAMS;
+	// подготовить контекст
+	if (code == ERR_OK)
 	{
-		blobClose(state);
-		return ERR_BAD_INPUT;
+		c->hdr.keep = sizeof(bign_ctx);
+		c->hdr.p_count = 2;
+		c->hdr.o_count = 1;
+		c->ec = (ec_o*)state;
+		c->pre = (const word*)(image + BIGN_CTX_HDR);
+		ASSERT(objKeep(c) + objKeep(state) <= bignCtxLoad_keep(params->l));
+		objAppend(c, state, 0);
+		// проверить таблицу
+		for (i = 0; code == ERR_OK && i < (SIZE_1 << (BIGN_COMB_W - 1)); ++i)
+			if (!ecpIsOnA(c->pre + 2 * n * i, c->ec, stack))
+				code = ERR_BAD_FORMAT;
+		if (code == ERR_OK && !bignCtxPreIsValid(c->pre, c->ec, stack))
+			code = ERR_BAD_FORMAT;
 	}
-	// раскладка состояния
-	d = objEnd(ec, word);
-	Q = d + n;
-	stack = Q + 2 * n;
-	// d <- privkey
-	wwFrom(d, privkey, no);
-	// 0 < d < q?
-	wwFrom(Q, params->q, no);
-	if (wwIsZero(d, n) || wwCmp(d, Q, n) >= 0)
-	{
-		blobClose(state);
-		return ERR_BAD_PRIVKEY;
-	}
-	// Q <- d G
-	if (ecMulA(Q, ec->base, ec, d, n, stack))
-	{
-		// Q == pubkey?
-		wwTo(Q, 2 * no, Q);
-		if (!memEq(Q, pubkey, 2 * no))
-			code = ERR_BAD_PUBKEY;
-	}
-	else
-		code = ERR_BAD_PARAMS;
 	// завершение
 	blobClose(state);
 	return code;
 }
 
-static size_t bignValPubkey_deep(size_t n, size_t f_deep, size_t ec_d,
-	size_t ec_deep)
+/*
+*******************************************************************************
+Реплики контекста
+
+Реплика строится по схеме bignCtxStart(): заголовок, таблица
+предвычислений, описание кривой. Таблица копируется в реплику, даже если
+контекст ссылается на встроенную таблицу или на образ.
+*******************************************************************************
+*/
+
+static void bignCtxClone(void* dest, const void* ctx)
 {
-	return O_OF_W(2 * n) +
-		ecpIsOnA_deep(n, f_deep);
+	const bign_ctx* c = (const bign_ctx*)ctx;
+	bign_ctx* d = (bign_ctx*)dest;
+	const size_t n = c->ec->f->n;
+	ASSERT(bignCtxIsOperable(ctx));
+	ASSERT(memIsValid(dest, bignCtx_keep(c->ec->f->no * 4)));
+	// заголовок и таблица
+	d->hdr.keep = sizeof(bign_ctx) + ecCombPrecA_keep(n, BIGN_COMB_W);
+	d->hdr.p_count = 2;
+	d->hdr.o_count = 1;
+	d->ec = c->ec;
+	d->pre = (const word*)d->descr;
+	wwCopy((word*)d->descr, c->pre, n << BIGN_COMB_W);
+	// описание кривой
+	objAppend(d, c->ec, 0);
 }
 
-err_t bignValPubkey(const bign_params* params, const octet pubkey[])
+err_t bignCtxRepsStart(void* reps, const void* ctx)
 {
-	err_t code;
-	size_t no, n;
-	// состояние
-	void* state;
-	ec_o* ec;			/* описание эллиптической кривой */
-	word* Q;			/* [2n] открытый ключ */
-	void* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignValPubkey_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
-	// размерности
-	no  = ec->f->no;
-	n = ec->f->n;
-	// проверить входные указатели
-	if (!memIsValid(pubkey, 2 * no))
-	{
-		blobClose(state);
+	const bign_ctx* c = (const bign_ctx*)ctx;
+	if (!bignCtxIsOperable(ctx) || !memIsValid(reps, objReps_keep()))
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	Q = objEnd(ec, word);
-	stack = Q + 2 * n;
-	// загрузить pt
-	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
-		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack))
+	objRepsStart(reps, ctx, bignCtx_keep(c->ec->f->no * 4), bignCtxClone);
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Пакетные вычисления
+
+На кривой bign-curve256v1 подписи вырабатываются и проверяются пакетами 
+по 4 с помощью 4-полосной арифметики (см. ecpAddMulAX4()). Без векторных 
+инструкций AVX2 полосы обрабатываются последовательно и проигрывают 
+ecMulA() / ecAddMulA(). Поэтому 4-полосная арифметика используется только 
+при наличии AVX2. При выработке подписей в контексте выигрывает 
+гребенчатый метод, при проверке -- 4-полосная арифметика.
+*******************************************************************************
+*/
+
+#if defined(__AVX2__) && defined(U64_SUPPORT)
+	#define BIGN_X4
+#endif
+
+static bool_t bignIsOperableX4(const ec_o* ec)
+{
+#ifdef BIGN_X4
+	return ecpIsOperableX4(ec);
+#else
+	return FALSE;
+#endif
+}
+
+/*
+*******************************************************************************
+Кэш контекстов
+
+Функции bignXXX() с параметрами bign_params работают с контекстами, 
+которые хранятся в кэше _ctx_cache. Контекст выбирается по ключу 
+belt-hash(p || a || b || q || yG || seed) (как в кэше проверенных 
+параметров). Описание кривой и таблица предвычислений контекста 
+передаются функции bignXXXEc() вместо описания, построенного функцией 
+bignStart(). Поэтому приложения, которые многократно используют одни 
+и те же параметры через bignXXX(), получают ускорение bignCtxXXX() без 
+изменений. Ключ вычисляется функциями beltHashStepX(), а не beltHash(), 
+чтобы не обращаться к движку (см. eng.h).
+
+Для стандартных параметров контекст строится при первом обращении: 
+таблица предвычислений готова (см. bignStdPre()). Для остальных 
+параметров при первом обращении в кэш записывается только ключ, 
+контекст строится при повторном обращении: параметры, которые 
+встречаются однократно, не замедляют вычислений.
+
+Кэш содержит не более _ctx_max записей. Если свободных записей нет, 
+то вытесняется запись, к которой дольше всего не обращались (LRU). 
+Контекст снабжен счетчиком ссылок: его владельцами являются кэш и 
+функции, которые его используют. Контекст освобождается последним 
+владельцем, поэтому вытеснение не мешает вычислениям в других потоках.
+Контекст строится без блокировки.
+
+Кэш, его размер и счетчики защищены мьютексом _ctx_mtx. Размер _ctx_max 
+дополнительно читается атомарно без блокировки, чтобы отключенный кэш 
+не замедлял вычислений. По умолчанию размер равняется 
+BIGN_CTX_CACHE_DEFAULT. Директива -DBIGN_CTX_CACHE_DEFAULT=0 отключает 
+кэш при сборке, функция bignCtxCacheSetMax(0) -- во время выполнения.
+*******************************************************************************
+*/
+
+#if (BIGN_CTX_CACHE_DEFAULT > BIGN_CTX_CACHE_MAX)
+	#error "BIGN_CTX_CACHE_DEFAULT > BIGN_CTX_CACHE_MAX"
+#endif
+
+typedef struct
+{
+	size_t refs;			/*< число владельцев */
+	octet ctx[];			/*< контекст */
+} bign_ctx_ref_st;
+
+typedef struct
+{
+	octet key[32];			/*< ключ записи */
+	size_t stamp;			/*< момент последнего обращения */
+	bign_ctx_ref_st* ref;	/*< контекст (0 -- еще не построен) */
+} bign_ctx_entry_st;
+
+static size_t _ctx_once;				/*< триггер однократности */
+static mt_mtx_t _ctx_mtx[1];			/*< мьютекс */
+static bool_t _ctx_inited;				/*< мьютекс создан? */
+static bign_ctx_entry_st _ctx_cache[BIGN_CTX_CACHE_MAX];	/*< записи */
+static size_t _ctx_max = BIGN_CTX_CACHE_DEFAULT;	/*< число записей */
+static size_t _ctx_count;				/*< число занятых записей */
+static size_t _ctx_stamp;				/*< счетчик обращений */
+
+static void bignCtxRefDrop(bign_ctx_ref_st* ref)
+{
+	ASSERT(ref->refs > 0);
+	if (--ref->refs == 0)
+		blobClose(ref);
+}
+
+static void bignCtxCacheClear()
+{
+	size_t pos;
+	for (pos = 0; pos < _ctx_count; ++pos)
+		if (_ctx_cache[pos].ref)
+			bignCtxRefDrop(_ctx_cache[pos].ref);
+	memSetZero(_ctx_cache, sizeof(_ctx_cache));
+	_ctx_count = 0;
+}
+
+static void bignCtxCacheDestroy()
+{
+	bignCtxCacheClear();
+	mtMtxClose(_ctx_mtx);
+	_ctx_inited = FALSE;
+}
+
+static void bignCtxCacheInit()
+{
+	ASSERT(!_ctx_inited);
+	if (!mtMtxCreate(_ctx_mtx))
+		return;
+	if (!utilOnExit(bignCtxCacheDestroy))
 	{
-		blobClose(state);
-		return ERR_BAD_PUBKEY;
+		mtMtxClose(_ctx_mtx);
+		return;
 	}
-	// Q \in ec?
-	code = ecpIsOnA(Q, ec, stack) ? ERR_OK : ERR_BAD_PUBKEY;
-	// завершение
-	blobClose(state);
-	return code;
+	_ctx_inited = TRUE;
 }
 
-static size_t bignCalcPubkey_deep(size_t n, size_t f_deep, size_t ec_d,
-	size_t ec_deep)
+bool_t bignCtxCacheSetMax(size_t max)
 {
-	return O_OF_W(n + 2 * n) +
-		ecMulA_deep(n, ec_d, ec_deep, n);
+	// входной контроль
+	if (max > BIGN_CTX_CACHE_MAX)
+		return FALSE;
+	// инициализировать однократно
+	if (!mtCallOnce(&_ctx_once, bignCtxCacheInit) || !_ctx_inited)
+		return FALSE;
+	// заменить кэш
+	mtMtxLock(_ctx_mtx);
+	bignCtxCacheClear();
+	mtAtomicStore(&_ctx_max, max);
+	mtMtxUnlock(_ctx_mtx);
+	return TRUE;
 }
 
-err_t bignCalcPubkey(octet pubkey[], const bign_params* params,
-	const octet privkey[])
+void bignCtxCacheFlush()
 {
-	err_t code;
-	size_t no, n;
-	// состояние
+	if (!mtCallOnce(&_ctx_once, bignCtxCacheInit) || !_ctx_inited)
+		return;
+	mtMtxLock(_ctx_mtx);
+	bignCtxCacheClear();
+	mtMtxUnlock(_ctx_mtx);
+}
+
+static bool_t bignCtxCacheKey(octet key[32], const bign_params* params)
+{
+	const size_t no = params->l / 4;
 	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
-	word* d;				/* [n] личный ключ */
-	word* Q;				/* [2n] открытый ключ */
-	void* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignCalcPubkey_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
-	// размерности
-	no  = ec->f->no;
-	n = ec->f->n;
-	// проверить входные указатели
-	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
+	// выделить память
+	state = blobCreate(beltHash_keep());
+	if (!state)
+		return FALSE;
+	// key <- beltHash(p || a || b || q || yG || seed)
+	beltHashStart(state);
+	beltHashStepH(params->p, no, state);
+	beltHashStepH(params->a, no, state);
+	beltHashStepH(params->b, no, state);
+	beltHashStepH(params->q, no, state);
+	beltHashStepH(params->yG, no, state);
+	beltHashStepH(params->seed, 8, state);
+	beltHashStepG(key, state);
+	// завершить
+	blobClose(state);
+	return TRUE;
+}
+
+static size_t bignCtxCacheFind(const octet key[32])
+{
+	size_t pos;
+	for (pos = 0; pos < _ctx_count; ++pos)
+		if (memEq(_ctx_cache[pos].key, key, 32))
+			break;
+	return pos;
+}
+
+static void bignCtxCachePut(const octet key[32], bign_ctx_ref_st* ref)
+{
+	size_t pos, i;
+	ASSERT(_ctx_max > 0);
+	// найти свободную или вытесняемую запись
+	if (_ctx_count < _ctx_max)
+		pos = _ctx_count++;
+	else
 	{
-		blobClose(state);
-		return ERR_BAD_INPUT;
+		for (pos = 0, i = 1; i < _ctx_count; ++i)
+			if (_ctx_cache[i].stamp < _ctx_cache[pos].stamp)
+				pos = i;
+		if (_ctx_cache[pos].ref)
+			bignCtxRefDrop(_ctx_cache[pos].ref);
 	}
-	// раскладка состояния
-	d = objEnd(ec, word);
-	Q = d + n;
-	stack = Q + 2 * n;
-	// загрузить d
-	wwFrom(d, privkey, no);
-	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
+	// заполнить запись
+	memCopy(_ctx_cache[pos].key, key, 32);
+	_ctx_cache[pos].stamp = ++_ctx_stamp;
+	_ctx_cache[pos].ref = ref;
+	if (ref)
+		++ref->refs;
+}
+
+static bign_ctx_ref_st* bignCtxCacheGet(const bign_params* params)
+{
+	octet key[32];
+	bign_ctx_ref_st* ref = 0;
+	bign_ctx_ref_st* ref1;
+	bool_t build;
+	size_t pos;
+	// кэш отключен?
+	if (!mtAtomicLoad(&_ctx_max))
+		return 0;
+	if (!mtCallOnce(&_ctx_once, bignCtxCacheInit) || !_ctx_inited)
+		return 0;
+	// найти запись
+	if (!bignCtxCacheKey(key, params))
+		return 0;
+	build = bignIsStdParams(params, FALSE);
+	mtMtxLock(_ctx_mtx);
+	if (!_ctx_max)
+		build = FALSE;
+	else if ((pos = bignCtxCacheFind(key)) < _ctx_count)
 	{
-		blobClose(state);
-		return ERR_BAD_PRIVKEY;
+		_ctx_cache[pos].stamp = ++_ctx_stamp;
+		if ((ref = _ctx_cache[pos].ref) != 0)
+			++ref->refs;
+		build = TRUE;
 	}
-	// Q <- d G
-	if (ecMulA(Q, ec->base, ec, d, n, stack))
+	else if (!build)
+		bignCtxCachePut(key, 0);
+	mtMtxUnlock(_ctx_mtx);
+	if (ref || !build)
+		return ref;
+	// построить контекст
+	ref = (bign_ctx_ref_st*)blobCreate(sizeof(bign_ctx_ref_st) +
+		bignCtx_keep(params->l));
+	if (ref == 0)
+		return 0;
+	if (bignCtxStart(ref->ctx, params) != ERR_OK)
 	{
-		// выгрузить открытый ключ
-		qrTo(pubkey, ecX(Q), ec->f, stack);
-		qrTo(pubkey + no, ecY(Q, n), ec->f, stack);
+		blobClose(ref);
+		return 0;
 	}
-	else
-		code = ERR_BAD_PARAMS;
-	// завершение
-	blobClose(state);
-	return code;
+	ref->refs = 1;
+	// сохранить контекст (если его не построили в другом потоке)
+	mtMtxLock(_ctx_mtx);
+	if (_ctx_max)
+	{
+		if ((pos = bignCtxCacheFind(key)) == _ctx_count)
+			bignCtxCachePut(key, ref);
+		else if ((ref1 = _ctx_cache[pos].ref) == 0)
+			_ctx_cache[pos].ref = ref, ++ref->refs;
+		else
+			bignCtxRefDrop(ref), ref = ref1, ++ref->refs;
+	}
+	mtMtxUnlock(_ctx_mtx);
+	return ref;
 }
 
-static size_t bignDH_deep(size_t n, size_t f_deep, size_t ec_d,
-	size_t ec_deep)
+static void bignCtxCacheRelease(bign_ctx_ref_st* ref)
 {
-	return O_OF_W(n + 2 * n) +
-		utilMax(2,
-			ecpIsOnA_deep(n, f_deep),
-			ecMulA_deep(n, ec_d, ec_deep, n));
+	ASSERT(_ctx_inited);
+	mtMtxLock(_ctx_mtx);
+	bignCtxRefDrop(ref);
+	mtMtxUnlock(_ctx_mtx);
 }
 
-err_t bignDH(octet key[], const bign_params* params, const octet privkey[],
-	const octet pubkey[], size_t key_len)
+/*
+*******************************************************************************
+Подготовка описания кривой
+
+Функция bignPrepStart() подготавливает для функций bignXXX() описание 
+кривой, таблицу предвычислений и стек глубины deep. Если контекст для 
+params найден в кэше, то описание и таблица берутся из него. Иначе 
+описание строится функцией bignStart(), а таблица не используется.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const ec_o* ec;			/*< описание кривой */
+	const word* pre;		/*< таблица предвычислений для G (или 0) */
+	void* stack;			/*< стек */
+	void* state;			/*< состояние bignStart() (или 0) */
+	bign_ctx_ref_st* ref;	/*< контекст из кэша (или 0) */
+} bign_prep_st;
+
+static err_t bignPrepStart(bign_prep_st* prep, const bign_params* params,
+	bign_deep_i deep)
 {
 	err_t code;
-	size_t no, n;
-	// состояние
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
-	word* d;				/* [n] личный ключ */
-	word* Q;				/* [2n] открытый ключ */
-	void* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
+	// контекст из кэша?
+	if ((prep->ref = bignCtxCacheGet(params)) != 0)
+	{
+		prep->stack = bignCtxStackCreate(prep->ref->ctx, deep);
+		if (prep->stack == 0)
+		{
+			bignCtxCacheRelease(prep->ref);
+			return ERR_OUTOFMEMORY;
+		}
+		prep->ec = bignCtxEc(prep->ref->ctx);
+		prep->pre = bignCtxPre(prep->ref->ctx);
+		prep->state = 0;
+		return ERR_OK;
+	}
 	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignDH_deep));
-	if (state == 0)
+	prep->state = blobCreate(bignStart_keep(params->l, deep));
+	if (prep->state == 0)
 		return ERR_OUTOFMEMORY;
 	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
-	// размерности
-	no  = ec->f->no;
-	n = ec->f->n;
-	// проверить длину key
-	if (key_len > 2 * no)
-	{
-		blobClose(state);
-		return ERR_BAD_SHAREDKEY;
-	}
-	// проверить входные указатели
-	if (!memIsValid(privkey, no) || 
-		!memIsValid(pubkey, 2 * no) ||
-		!memIsValid(key, key_len))
-	{
-		blobClose(state);
-		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
-	Q = d + n;
-	stack = Q + 2 * n;
-	// загрузить d
-	wwFrom(d, privkey, no);
-	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
-	{
-		blobClose(state);
-		return ERR_BAD_PRIVKEY;
-	}
-	// загрузить Q
-	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
-		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack) ||
-		!ecpIsOnA(Q, ec, stack))
-	{
-		blobClose(state);
-		return ERR_BAD_PUBKEY;
-	}
-	// Q <- d Q
-	if (ecMulA(Q, Q, ec, d, n, stack))
+	code = bignStart(prep->state, params);
+	ERR_CALL_HANDLE(code, blobClose(prep->state));
+	prep->ec = (const ec_o*)prep->state;
+	prep->pre = 0;
+	prep->stack = objEnd(prep->state, void);
+	return ERR_OK;
+}
+
+static void bignPrepStop(bign_prep_st* prep)
+{
+	if (prep->ref)
 	{
-		// выгрузить общий ключ
-		qrTo((octet*)Q, ecX(Q), ec->f, stack);
-		if (key_len > no)
-			qrTo((octet*)Q + no, ecY(Q, n), ec->f, stack);
-		memCopy(key, Q, key_len);
+		blobClose(prep->stack);
+		bignCtxCacheRelease(prep->ref);
 	}
 	else
-		code = ERR_BAD_PARAMS;
-	// завершение
-	blobClose(state);
-	return code;
+		blobClose(prep->state);
 }
 
 /*
 *******************************************************************************
-Выработка ЭЦП
+Управление ключами
 *******************************************************************************
 */
 
-static size_t bignSign_deep(size_t n, size_t f_deep, size_t ec_d,
+static size_t bignGenKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return O_OF_W(4 * n) +
-		utilMax(4,
-			beltHash_keep(),
-			ecMulA_deep(n, ec_d, ec_deep, n),
-			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n));
+	return O_OF_W(n + 2 * n) +
+		bignMulBase_deep(n, ec_d, ec_deep);
 }
 
-err_t bignSign(octet sig[], const bign_params* params, const octet oid_der[],
-	size_t oid_len, const octet hash[], const octet privkey[], gen_i rng, 
-	void* rng_state)
+static err_t bignGenKeypairEc(octet privkey[], octet pubkey[],
+	const ec_o* ec, const word pre[], gen_i rng, void* rng_state, void* stack)
 {
-	err_t code;
 	size_t no, n;
-	// состояние (буферы могут пересекаться)
-	void* state;			
-	ec_o* ec;				/* описание эллиптической кривой */
+	// состояние
 	word* d;				/* [n] личный ключ */
-	word* k;				/* [n] одноразовый личный ключ */
-	word* R;				/* [2n] точка R */
-	word* s0;				/* [n/2] первая часть подписи */
-	word* s1;				/* [n] вторая часть подписи */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
-	// проверить oid_der
-	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
-		return ERR_BAD_OID;
+	word* Q;				/* [2n] открытый ключ */
 	// проверить rng
 	if (rng == 0)
 		return ERR_BAD_RNG;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignSign_deep));
-	if (state == 0)
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + n;
+	stack = Q + 2 * n;
+	// d <-R {1,2,..., q - 1}
+	if (!zzRandNZMod(d, ec->order, n, rng, rng_state))
+		return ERR_BAD_RNG;
+	// Q <- d G
+	if (!bignMulBase(Q, ec, pre, d, stack))
+		return ERR_BAD_PARAMS;
+	// выгрузить ключи
+	wwTo(privkey, no, d);
+	qrTo(pubkey, ecX(Q), ec->f, stack);
+	qrTo(pubkey + no, ecY(Q, n), ec->f, stack);
+	return ERR_OK;
+}
+
+err_t bignGenKeypair(octet privkey[], octet pubkey[],
+	const bign_params* params, gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignGenKeypair_deep);
+	ERR_CALL_CHECK(code);
+	// сгенерировать ключи
+	code = bignGenKeypairEc(privkey, pubkey, prep->ec, prep->pre, rng,
+		rng_state, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxGenKeypair(octet privkey[], octet pubkey[], const void* ctx,
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignGenKeypair_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// сгенерировать ключи
+	code = bignGenKeypairEc(privkey, pubkey, bignCtxEc(ctx), bignCtxPre(ctx),
+		rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетная генерация ключей
+
+Пары ключей генерируются пакетами по BIGN_GEN_BATCH. В пакете личные
+ключи d_i генерируются в порядке следования пар, открытые ключи d_i G
+определяются функцией ecCombMulABatch() по таблице предвычислений
+контекста с одним обращением в базовом поле на пакет. Размер пакета
+ограничивает глубину стека, которая не зависит от числа пар.
+
+Функция bignGenKeypairBatch(), как и bignKeyWrapBatch(), всегда работает
+с контекстом: из кэша или созданным заново.
+*******************************************************************************
+*/
+
+#define BIGN_GEN_BATCH 16
+
+static size_t bignGenKeypairBatch_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	const size_t b = BIGN_GEN_BATCH;
+	return O_OF_W(b * n + b * 2 * n) +
+		utilMax(2,
+			ecCombMulABatch_deep(n, ec_d, ec_deep, BIGN_COMB_W, b),
+			f_deep);
+}
+
+static err_t bignGenKeypairBatchEc(octet privkeys[], octet pubkeys[],
+	const ec_o* ec, const word pre[], size_t count, gen_i rng,
+	void* rng_state, void* stack)
+{
+	const size_t b = BIGN_GEN_BATCH;
+	size_t no, n, i, j, cnt;
+	// состояние
+	word* d;				/* [b * n] личные ключи */
+	word* Q;				/* [b * 2n] открытые ключи */
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(privkeys, count * no) ||
+		!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsDisjoint2(privkeys, count * no, pubkeys, count * 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + b * n;
+	stack = Q + b * 2 * n;
+	// обработать пакеты
+	for (i = 0; i < count; i += cnt)
+	{
+		cnt = MIN2(b, count - i);
+		// d_i <-R {1,2,..., q - 1}
+		for (j = 0; j < cnt; ++j)
+			if (!zzRandNZMod(d + j * n, ec->order, n, rng, rng_state))
+				return ERR_BAD_RNG;
+		// Q_i <- d_i G
+		if (!ecCombMulABatch(Q, pre, ec, BIGN_COMB_W, d, n, cnt, stack))
+			return ERR_BAD_PARAMS;
+		// выгрузить ключи
+		for (j = 0; j < cnt; ++j)
+		{
+			octet* pubkey = pubkeys + (i + j) * 2 * no;
+			wwTo(privkeys + (i + j) * no, no, d + j * n);
+			qrTo(pubkey, ecX(Q + j * 2 * n), ec->f, stack);
+			qrTo(pubkey + no, ecY(Q + j * 2 * n, n), ec->f, stack);
+		}
+	}
+	// все нормально
+	return ERR_OK;
+}
+
+err_t bignGenKeypairBatch(octet privkeys[], octet pubkeys[],
+	const bign_params* params, size_t count, gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_ctx_ref_st* ref;
+	void* ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// контекст из кэша?
+	if ((ref = bignCtxCacheGet(params)) != 0)
+	{
+		code = bignCtxGenKeypairBatch(privkeys, pubkeys, ref->ctx, count,
+			rng, rng_state);
+		bignCtxCacheRelease(ref);
+		return code;
+	}
+	// создать контекст
+	ctx = blobCreate(bignCtx_keep(params->l));
+	if (ctx == 0)
+		return ERR_OUTOFMEMORY;
+	// старт
+	code = bignCtxStart(ctx, params);
+	ERR_CALL_HANDLE(code, blobClose(ctx));
+	// сгенерировать ключи
+	code = bignCtxGenKeypairBatch(privkeys, pubkeys, ctx, count, rng,
+		rng_state);
+	// завершение
+	blobClose(ctx);
+	return code;
+}
+
+err_t bignCtxGenKeypairBatch(octet privkeys[], octet pubkeys[],
+	const void* ctx, size_t count, gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignGenKeypairBatch_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// сгенерировать ключи
+	code = bignGenKeypairBatchEc(privkeys, pubkeys, bignCtxEc(ctx),
+		bignCtxPre(ctx), count, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+static size_t bignValKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(n + 2 * n) +
+		bignMulBase_deep(n, ec_d, ec_deep);
+}
+
+static err_t bignValKeypairEc(const ec_o* ec, const word pre[],
+	const octet privkey[], const octet pubkey[], void* stack)
+{
+	size_t no, n;
+	// состояние
+	word* d;				/* [n] личный ключ */
+	word* Q;				/* [2n] открытый ключ */
+	// размерности
+	no = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + n;
+	stack = Q + 2 * n;
+	// d <- privkey
+	wwFrom(d, privkey, no);
+	// 0 < d < q?
+	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
+		return ERR_BAD_PRIVKEY;
+	// Q <- d G
+	if (!bignMulBase(Q, ec, pre, d, stack))
+		return ERR_BAD_PARAMS;
+	// Q == pubkey?
+	wwTo(Q, 2 * no, Q);
+	return memEq(Q, pubkey, 2 * no) ? ERR_OK : ERR_BAD_PUBKEY;
+}
+
+err_t bignValKeypair(const bign_params* params, const octet privkey[],
+	const octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignValKeypair_deep);
+	ERR_CALL_CHECK(code);
+	// проверить ключи
+	code = bignValKeypairEc(prep->ec, prep->pre, privkey, pubkey,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxValKeypair(const void* ctx, const octet privkey[],
+	const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignValKeypair_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить ключи
+	code = bignValKeypairEc(bignCtxEc(ctx), bignCtxPre(ctx), privkey, pubkey,
+		stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+static size_t bignValPubkey_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(2 * n) +
+		ecpIsOnA_deep(n, f_deep);
+}
+
+static err_t bignValPubkeyEc(const ec_o* ec, const octet pubkey[],
+	void* stack)
+{
+	size_t no, n;
+	// состояние
+	word* Q;			/* [2n] открытый ключ */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(pubkey, 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	Q = (word*)stack;
+	stack = Q + 2 * n;
+	// загрузить pt
+	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
+		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack))
+		return ERR_BAD_PUBKEY;
+	// Q \in ec?
+	return ecpIsOnA(Q, ec, stack) ? ERR_OK : ERR_BAD_PUBKEY;
+}
+
+err_t bignValPubkey(const bign_params* params, const octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignValPubkey_deep);
+	ERR_CALL_CHECK(code);
+	// проверить ключ
+	code = bignValPubkeyEc(prep->ec, pubkey, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxValPubkey(const void* ctx, const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignValPubkey_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить ключ
+	code = bignValPubkeyEc(bignCtxEc(ctx), pubkey, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxValPubkeyW(const void* ctx, const octet pubkey[], void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignValPubkey_deep))
+		return ERR_BAD_INPUT;
+	// проверить ключ
+	return bignValPubkeyEc(bignCtxEc(ctx), pubkey, stack);
+}
+
+static err_t bignValPubkeyBatchEc(octet valid[], const ec_o* ec,
+	size_t count, const octet pubkeys[], void* stack)
+{
+	const size_t no = ec->f->no;
+	err_t code = ERR_OK;
+	size_t i;
+	// проверить входные указатели
+	if (!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsValid(valid, (count + 7) / 8))
+		return ERR_BAD_INPUT;
+	// цикл по ключам
+	memSetZero(valid, (count + 7) / 8);
+	for (i = 0; i < count; ++i)
+		if (bignValPubkeyEc(ec, pubkeys + i * 2 * no, stack) == ERR_OK)
+			valid[i / 8] |= (octet)(1 << i % 8);
+		else
+			code = ERR_BAD_PUBKEY;
+	return code;
+}
+
+err_t bignValPubkeyBatch(octet valid[], const bign_params* params,
+	size_t count, const octet pubkeys[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignValPubkey_deep);
+	ERR_CALL_CHECK(code);
+	// проверить ключи
+	code = bignValPubkeyBatchEc(valid, prep->ec, count, pubkeys,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxValPubkeyBatch(octet valid[], const void* ctx, size_t count,
+	const octet pubkeys[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignValPubkey_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить ключи
+	code = bignValPubkeyBatchEc(valid, bignCtxEc(ctx), count, pubkeys,
+		stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Проверенный открытый ключ
+
+Описатель открытого ключа содержит точку Q (аффинные координаты 
+в представлении поля контекста), признак корректности Q и ссылку на 
+контекст, в котором Q проверялась. Функции bignCtxXXXPk() не загружают 
+и не проверяют Q повторно, а используют координаты описателя. Поэтому 
+описатель допускается только с тем контекстом, в котором он создан.
+
+Описатель, созданный функцией bignCtxPubkeyPreStart(), дополнительно
+содержит таблицу гребня для Q (той же ширины BIGN_COMB_W, что и таблица
+для G). Таблица размещается сразу за координатами Q. С ней кратные Q
+в проверке подписи (s1 G + (s0 + 2^l) Q) и в проверке идентификационной
+подписи (s1 G + (s0 + 2^l) R + t Q) определяются по двум гребням 
+(см. ecComb2AddMulA()).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const void* ctx;		/*!< контекст */
+	size_t n;				/*!< число слов в координате */
+	bool_t valid;			/*!< Q корректна? */
+	bool_t pre;				/*!< есть таблица предвычислений для Q? */
+	word Q[];				/*!< [2n] открытый ключ и таблица для Q */
+} bign_pubkey_st;
+
+size_t bignPubkey_keep(size_t l)
+{
+	return sizeof(bign_pubkey_st) + O_OF_W(2 * W_OF_B(2 * l));
+}
+
+size_t bignPubkeyPre_keep(size_t l)
+{
+	return bignPubkey_keep(l) + 
+		ecCombPrecA_keep(W_OF_B(2 * l), BIGN_COMB_W);
+}
+
+static size_t bignPubkeyPre_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return utilMax(2,
+		bignValPubkey_deep(n, f_deep, ec_d, ec_deep),
+		ecCombPrecA_deep(n, ec_d, ec_deep));
+}
+
+static err_t bignCtxPubkeyStartInternal(void* pk, const void* ctx, 
+	const octet pubkey[], bool_t pre)
+{
+	const ec_o* ec;
+	bign_pubkey_st* s = (bign_pubkey_st*)pk;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить входные указатели
+	ec = bignCtxEc(ctx);
+	if (!memIsValid(pk, pre ? bignPubkeyPre_keep(ec->f->no * 4) : 
+			bignPubkey_keep(ec->f->no * 4)) ||
+		!memIsValid(pubkey, 2 * ec->f->no))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, 
+		pre ? bignPubkeyPre_deep : bignValPubkey_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// загрузить и проверить Q
+	s->ctx = ctx;
+	s->n = ec->f->n;
+	s->pre = FALSE;
+	s->valid = 
+		qrFrom(ecX(s->Q), pubkey, ec->f, stack) &&
+		qrFrom(ecY(s->Q, s->n), pubkey + ec->f->no, ec->f, stack) &&
+		ecpIsOnA(s->Q, ec, stack);
+	// построить таблицу предвычислений для Q
+	if (pre && s->valid)
+		s->valid = s->pre = 
+			ecCombPrecA(s->Q + 2 * s->n, s->Q, ec, BIGN_COMB_W, stack);
+	// завершение
+	blobClose(stack);
+	return s->valid ? ERR_OK : ERR_BAD_PUBKEY;
+}
+
+err_t bignCtxPubkeyStart(void* pk, const void* ctx, const octet pubkey[])
+{
+	return bignCtxPubkeyStartInternal(pk, ctx, pubkey, FALSE);
+}
+
+err_t bignCtxPubkeyPreStart(void* pk, const void* ctx, const octet pubkey[])
+{
+	return bignCtxPubkeyStartInternal(pk, ctx, pubkey, TRUE);
+}
+
+static err_t bignPubkeyCheck(const void* pk, const void* ctx)
+{
+	const bign_pubkey_st* s = (const bign_pubkey_st*)pk;
+	if (!memIsValid(s, sizeof(bign_pubkey_st)) || s->ctx != ctx ||
+		s->n != bignCtxEc(ctx)->f->n || 
+		!wwIsValid(s->Q, 2 * s->n + (s->pre ? s->n << BIGN_COMB_W : 0)))
+		return ERR_BAD_INPUT;
+	return s->valid ? ERR_OK : ERR_BAD_PUBKEY;
+}
+
+#define bignPubkeyQ(pk) (((const bign_pubkey_st*)(pk))->Q)
+#define bignPubkeyPre(pk)\
+	(((const bign_pubkey_st*)(pk))->pre ?\
+		bignPubkeyQ(pk) + 2 * ((const bign_pubkey_st*)(pk))->n : 0)
+
+/*
+*******************************************************************************
+Загруженный личный ключ
+
+Описатель личного ключа содержит d в машинном представлении (число
+из n слов), признак корректности d и ссылку на контекст, в котором d 
+проверялся. Функции bignCtxXXXSk() не загружают и не проверяют d 
+повторно, а копируют его из описателя в стек.
+
+В bignCtxSign2Sk() ключ theta алгоритма 6.3.3 вычисляется как 
+belt-hash(oid || d || t). Идентификатор oid предшествует d, поэтому 
+зависящую от d часть хэширования нельзя выполнить заранее, не зная oid. 
+Октеты d для хэширования получаются из описателя функцией wwTo().
+*******************************************************************************
+*/
+
+typedef struct
+{
+	const void* ctx;		/*!< контекст */
+	size_t n;				/*!< число слов в d */
+	bool_t valid;			/*!< d корректен? */
+	word d[];				/*!< [n] личный ключ */
+} bign_privkey_st;
+
+size_t bignPrivkey_keep(size_t l)
+{
+	return sizeof(bign_privkey_st) + O_OF_W(W_OF_B(2 * l));
+}
+
+err_t bignCtxPrivkeyStart(void* sk, const void* ctx, const octet privkey[])
+{
+	const ec_o* ec;
+	bign_privkey_st* s = (bign_privkey_st*)sk;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить входные указатели
+	ec = bignCtxEc(ctx);
+	if (!memIsValid(sk, bignPrivkey_keep(ec->f->no * 4)) ||
+		!memIsValid(privkey, ec->f->no))
+		return ERR_BAD_INPUT;
+	// загрузить и проверить d
+	s->ctx = ctx;
+	s->n = ec->f->n;
+	wwFrom(s->d, privkey, ec->f->no);
+	s->valid = !wwIsZero(s->d, s->n) && wwCmp(s->d, ec->order, s->n) < 0;
+	if (!s->valid)
+		wwSetZero(s->d, s->n);
+	return s->valid ? ERR_OK : ERR_BAD_PRIVKEY;
+}
+
+void bignPrivkeyStop(void* sk)
+{
+	bign_privkey_st* s = (bign_privkey_st*)sk;
+	ASSERT(memIsValid(s, sizeof(bign_privkey_st)));
+	ASSERT(memIsValid(s->d, O_OF_W(s->n)));
+	memWipe(s, sizeof(bign_privkey_st) + O_OF_W(s->n));
+}
+
+static err_t bignPrivkeyCheck(const void* sk, const void* ctx)
+{
+	const bign_privkey_st* s = (const bign_privkey_st*)sk;
+	if (!memIsValid(s, sizeof(bign_privkey_st)) || s->ctx != ctx ||
+		s->n != bignCtxEc(ctx)->f->n || !wwIsValid(s->d, s->n))
+		return ERR_BAD_INPUT;
+	return s->valid ? ERR_OK : ERR_BAD_PRIVKEY;
+}
+
+#define bignPrivkeyD(sk) (((const bign_privkey_st*)(sk))->d)
+
+static bool_t bignPrivkeyLoad(word d[], const ec_o* ec, const octet privkey[],
+	const word dv[])
+{
+	// проверенный ключ dv копируется
+	if (dv)
+	{
+		wwCopy(d, dv, ec->f->n);
+		return TRUE;
+	}
+	wwFrom(d, privkey, ec->f->no);
+	return !wwIsZero(d, ec->f->n) && wwCmp(d, ec->order, ec->f->n) < 0;
+}
+
+static size_t bignCalcPubkey_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(n + 2 * n) +
+		bignMulBase_deep(n, ec_d, ec_deep);
+}
+
+static err_t bignCalcPubkeyEc(octet pubkey[], const ec_o* ec, const word pre[],
+	const octet privkey[], void* stack)
+{
+	size_t no, n;
+	// состояние
+	word* d;				/* [n] личный ключ */
+	word* Q;				/* [2n] открытый ключ */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(privkey, no) || !memIsValid(pubkey, 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + n;
+	stack = Q + 2 * n;
+	// загрузить d
+	wwFrom(d, privkey, no);
+	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
+		return ERR_BAD_PRIVKEY;
+	// Q <- d G
+	if (!bignMulBase(Q, ec, pre, d, stack))
+		return ERR_BAD_PARAMS;
+	// выгрузить открытый ключ
+	qrTo(pubkey, ecX(Q), ec->f, stack);
+	qrTo(pubkey + no, ecY(Q, n), ec->f, stack);
+	return ERR_OK;
+}
+
+err_t bignCalcPubkey(octet pubkey[], const bign_params* params,
+	const octet privkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignCalcPubkey_deep);
+	ERR_CALL_CHECK(code);
+	// построить открытый ключ
+	code = bignCalcPubkeyEc(pubkey, prep->ec, prep->pre, privkey,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxCalcPubkey(octet pubkey[], const void* ctx,
+	const octet privkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignCalcPubkey_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// построить открытый ключ
+	code = bignCalcPubkeyEc(pubkey, bignCtxEc(ctx), bignCtxPre(ctx), privkey,
+		stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxCalcPubkeyW(octet pubkey[], const void* ctx,
+	const octet privkey[], void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignCalcPubkey_deep))
+		return ERR_BAD_INPUT;
+	// построить открытый ключ
+	return bignCalcPubkeyEc(pubkey, bignCtxEc(ctx), bignCtxPre(ctx), privkey,
+		stack);
+}
+
+/*
+*******************************************************************************
+Сжатие открытого ключа
+
+Сжатое представление открытого ключа Q = (x, y) -- это x-координата,
+дополненная октетом y mod 2. При восстановлении определяется 
+y^2 = x^3 + A x + B и корень y извлекается с помощью gfpSqrt(). Для 
+модулей стандартных кривых (p = 2^{2l} - c, p \equiv 3 \mod 4) в gfpSqrt() 
+используется аддитивная цепочка.
+
+Пакетное восстановление ускоряется за счет однократной подготовки 
+описания кривой и памяти. Обращения в поле, которые можно было бы 
+совместить по методу Монтгомери, при восстановлении не выполняются.
+*******************************************************************************
+*/
+
+static size_t bignPubkeyCompress_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(2 * n) +
+		ecpIsOnA_deep(n, f_deep);
+}
+
+static err_t bignPubkeyCompressEc(octet xpubkey[], const ec_o* ec,
+	const octet pubkey[], void* stack)
+{
+	size_t no, n;
+	octet y0;
+	// состояние
+	word* Q;			/* [2n] открытый ключ */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(pubkey, 2 * no) || !memIsValid(xpubkey, no + 1))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	Q = (word*)stack;
+	stack = Q + 2 * n;
+	// загрузить и проверить Q
+	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
+		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack) ||
+		!ecpIsOnA(Q, ec, stack))
+		return ERR_BAD_PUBKEY;
+	// xpubkey <- x || y mod 2
+	y0 = pubkey[no] & 1;
+	memMove(xpubkey, pubkey, no);
+	xpubkey[no] = y0;
+	return ERR_OK;
+}
+
+err_t bignPubkeyCompress(octet xpubkey[], const bign_params* params,
+	const octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignPubkeyCompress_deep);
+	ERR_CALL_CHECK(code);
+	// сжать ключ
+	code = bignPubkeyCompressEc(xpubkey, prep->ec, pubkey,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxPubkeyCompress(octet xpubkey[], const void* ctx,
+	const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignPubkeyCompress_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// сжать ключ
+	code = bignPubkeyCompressEc(xpubkey, bignCtxEc(ctx), pubkey, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+static size_t bignPubkeyDecompress_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			f_deep,
+			gfpSqrt_deep(n, f_deep));
+}
+
+static err_t bignPubkeyDecompressEc(octet pubkey[], const ec_o* ec,
+	const octet xpubkey[], void* stack)
+{
+	size_t no, n;
+	octet y0;
+	// состояние
+	word* x;			/* [n] x-координата */
+	word* y;			/* [n] y-координата */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(xpubkey, no + 1) || !memIsValid(pubkey, 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	x = (word*)stack;
+	y = x + n;
+	stack = y + n;
+	// загрузить x и y mod 2
+	y0 = xpubkey[no];
+	if (y0 > 1 || !qrFrom(x, xpubkey, ec->f, stack))
+		return ERR_BAD_PUBKEY;
+	// y <- x^3 + A x + B
+	qrSqr(y, x, ec->f, stack);
+	qrAdd(y, y, ec->A, ec->f);
+	qrMul(y, y, x, ec->f, stack);
+	qrAdd(y, y, ec->B, ec->f);
+	// y <- \sqrt(y)
+	if (!gfpSqrt(y, y, ec->f, stack))
+		return ERR_BAD_PUBKEY;
+	// выгрузить открытый ключ
+	qrTo(pubkey, x, ec->f, stack);
+	qrTo(pubkey + no, y, ec->f, stack);
+	if ((pubkey[no] & 1) != y0)
+	{
+		if (qrIsZero(y, ec->f))
+			return ERR_BAD_PUBKEY;
+		qrNeg(y, y, ec->f);
+		qrTo(pubkey + no, y, ec->f, stack);
+	}
+	return ERR_OK;
+}
+
+err_t bignPubkeyDecompress(octet pubkey[], const bign_params* params,
+	const octet xpubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignPubkeyDecompress_deep);
+	ERR_CALL_CHECK(code);
+	// восстановить ключ
+	code = bignPubkeyDecompressEc(pubkey, prep->ec, xpubkey,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxPubkeyDecompress(octet pubkey[], const void* ctx,
+	const octet xpubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignPubkeyDecompress_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// восстановить ключ
+	code = bignPubkeyDecompressEc(pubkey, bignCtxEc(ctx), xpubkey, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+static err_t bignPubkeyDecompressBatchEc(octet pubkeys[], const ec_o* ec,
+	size_t count, const octet xpubkeys[], err_t codes[], void* stack)
+{
+	const size_t no = ec->f->no;
+	err_t ret = ERR_OK;
+	err_t code;
+	size_t i;
+	// проверить входные указатели
+	if (!memIsValid(xpubkeys, count * (no + 1)) ||
+		!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsDisjoint2(xpubkeys, count * (no + 1), pubkeys, count * 2 * no) ||
+		!memIsNullOrValid(codes, count * sizeof(err_t)))
+		return ERR_BAD_INPUT;
+	// цикл по ключам
+	for (i = 0; i < count; ++i)
+	{
+		code = bignPubkeyDecompressEc(pubkeys + i * 2 * no, ec,
+			xpubkeys + i * (no + 1), stack);
+		if (codes)
+			codes[i] = code;
+		if (code != ERR_OK && ret == ERR_OK)
+		{
+			ret = code;
+			if (!codes)
+				break;
+		}
+	}
+	return ret;
+}
+
+err_t bignPubkeyDecompressBatch(octet pubkeys[], const bign_params* params,
+	size_t count, const octet xpubkeys[], err_t codes[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignPubkeyDecompress_deep);
+	ERR_CALL_CHECK(code);
+	// восстановить ключи
+	code = bignPubkeyDecompressBatchEc(pubkeys, prep->ec, count,
+		xpubkeys, codes, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxPubkeyDecompressBatch(octet pubkeys[], const void* ctx,
+	size_t count, const octet xpubkeys[], err_t codes[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignPubkeyDecompress_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// восстановить ключи
+	code = bignPubkeyDecompressBatchEc(pubkeys, bignCtxEc(ctx), count,
+		xpubkeys, codes, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+static size_t bignDH_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(n + 2 * n) +
+		utilMax(2,
+			ecpIsOnA_deep(n, f_deep),
+			ecMulA_deep(n, ec_d, ec_deep, n));
+}
+
+static err_t bignDHEc(octet key[], const ec_o* ec, const octet privkey[],
+	const word dv[], const octet pubkey[], const word Qv[], size_t key_len,
+	void* stack)
+{
+	size_t no, n;
+	// состояние
+	word* d;				/* [n] личный ключ */
+	word* Q;				/* [2n] открытый ключ */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить длину key
+	if (key_len > 2 * no)
+		return ERR_BAD_SHAREDKEY;
+	// проверить входные указатели
+	ASSERT((privkey == 0) != (dv == 0));
+	ASSERT((pubkey == 0) != (Qv == 0));
+	if (!memIsNullOrValid(privkey, no) ||
+		!memIsNullOrValid(pubkey, 2 * no) ||
+		!memIsValid(key, key_len))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + n;
+	stack = Q + 2 * n;
+	// загрузить d
+	if (!bignPrivkeyLoad(d, ec, privkey, dv))
+		return ERR_BAD_PRIVKEY;
+	// загрузить Q (проверенная точка Qv копируется)
+	if (Qv)
+		wwCopy(Q, Qv, 2 * n);
+	else if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
+		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack) ||
+		!ecpIsOnA(Q, ec, stack))
+		return ERR_BAD_PUBKEY;
+	// Q <- d Q
+	if (!ecMulA(Q, Q, ec, d, n, stack))
+		return ERR_BAD_PARAMS;
+	// выгрузить общий ключ
+	qrTo((octet*)Q, ecX(Q), ec->f, stack);
+	if (key_len > no)
+		qrTo((octet*)Q + no, ecY(Q, n), ec->f, stack);
+	memCopy(key, Q, key_len);
+	return ERR_OK;
+}
+
+err_t bignDHSoft(octet key[], const bign_params* params, const octet privkey[],
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignDH_deep);
+	ERR_CALL_CHECK(code);
+	// построить общий ключ
+	code = bignDHEc(key, prep->ec, privkey, 0, pubkey, 0, key_len,
+		prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+static err_t bignDHBody(octet key[], const bign_params* params,
+	const octet privkey[], const octet pubkey[], size_t key_len)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->bign_dh)
+	{
+		code = eng->bign_dh(eng->state, key, params, privkey, pubkey, key_len);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return bignDHSoft(key, params, privkey, pubkey, key_len);
+}
+
+err_t bignDH(octet key[], const bign_params* params, const octet privkey[],
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_DH);
+	code = bignDHBody(key, params, privkey, pubkey, key_len);
+	STAT_API_END(STAT_API_BIGN_DH, code);
+	return code;
+}
+
+static err_t bignCtxDHBody(octet key[], const void* ctx, const octet privkey[],
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignDH_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// построить общий ключ
+	code = bignDHEc(key, bignCtxEc(ctx), privkey, 0, pubkey, 0, key_len,
+		stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxDH(octet key[], const void* ctx, const octet privkey[],
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_DH);
+	code = bignCtxDHBody(key, ctx, privkey, pubkey, key_len);
+	STAT_API_END(STAT_API_BIGN_CTX_DH, code);
+	return code;
+}
+
+static err_t bignCtxDHWBody(octet key[], const void* ctx, const octet privkey[],
+	const octet pubkey[], size_t key_len, void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignDH_deep))
+		return ERR_BAD_INPUT;
+	// построить общий ключ
+	return bignDHEc(key, bignCtxEc(ctx), privkey, 0, pubkey, 0, key_len,
+		stack);
+}
+
+err_t bignCtxDHW(octet key[], const void* ctx, const octet privkey[],
+	const octet pubkey[], size_t key_len, void* stack)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_DH);
+	code = bignCtxDHWBody(key, ctx, privkey, pubkey, key_len, stack);
+	STAT_API_END(STAT_API_BIGN_CTX_DH, code);
+	return code;
+}
+
+static err_t bignCtxDHPkBody(octet key[], const void* ctx,
+	const octet privkey[], const void* pk, size_t key_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и pk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPubkeyCheck(pk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignDH_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// построить общий ключ
+	code = bignDHEc(key, bignCtxEc(ctx), privkey, 0, 0, bignPubkeyQ(pk),
+		key_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxDHPk(octet key[], const void* ctx, const octet privkey[],
+	const void* pk, size_t key_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_DH);
+	code = bignCtxDHPkBody(key, ctx, privkey, pk, key_len);
+	STAT_API_END(STAT_API_BIGN_CTX_DH, code);
+	return code;
+}
+
+static err_t bignCtxDHSkBody(octet key[], const void* ctx, const void* sk,
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и sk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPrivkeyCheck(sk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignDH_deep);
+	if (stack == 0)
 		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
+	// построить общий ключ
+	code = bignDHEc(key, bignCtxEc(ctx), 0, bignPrivkeyD(sk), pubkey, 0,
+		key_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxDHSk(octet key[], const void* ctx, const void* sk,
+	const octet pubkey[], size_t key_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_DH);
+	code = bignCtxDHSkBody(key, ctx, sk, pubkey, key_len);
+	STAT_API_END(STAT_API_BIGN_CTX_DH, code);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетное построение общих ключей
+
+Общие ключи одного личного ключа d с открытыми ключами нескольких сторон
+строятся пакетами по BIGN_DH_BATCH. Кратность d перекодируется один раз
+(ecRecode()), кратные точки d Q_i пакета определяются функцией
+ecMulARecBatch1() с общими переходами к аффинным координатам. Размер
+пакета ограничивает глубину стека, которая не зависит от числа сторон.
+
+Открытые ключи проверяются: точка вне кривой может дать бесконечно
+удаленную кратную точку и нарушить пакетный переход к аффинным
+координатам.
+*******************************************************************************
+*/
+
+#define BIGN_DH_BATCH 16
+
+static size_t bignDHBatch_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	const size_t b = BIGN_DH_BATCH;
+	return O_OF_W(n + b * 2 * n + b * 2 * n) +
+		O_OF_W(W_OF_O(ecRecode_keep(n))) +
+		utilMax(4,
+			ecpIsOnA_deep(n, f_deep),
+			ecRecode_deep(n),
+			ecMulARecBatch_deep(n, ec_d, ec_deep, n, b),
+			f_deep);
+}
+
+static err_t bignDHBatchEc(octet keys[], const ec_o* ec,
+	const octet privkey[], size_t count, const octet pubkeys[],
+	size_t key_len, void* stack)
+{
+	const size_t b = BIGN_DH_BATCH;
+	size_t no, n, i, j, cnt;
+	// состояние
+	word* d;				/* [n] личный ключ */
+	word* Q;				/* [b * 2n] открытые ключи */
+	word* R;				/* [b * 2n] точки d Q_i */
+	octet* rec;				/* [ecRecode_keep(n)] перекодированный d */
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить длину key
+	if (key_len > 2 * no)
+		return ERR_BAD_SHAREDKEY;
+	// проверить входные указатели
+	if (!memIsValid(privkey, no) ||
+		!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsValid(keys, count * key_len) ||
+		!memIsDisjoint2(keys, count * key_len, pubkeys, count * 2 * no))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = (word*)stack;
+	Q = d + n;
+	R = Q + b * 2 * n;
+	rec = (octet*)(R + b * 2 * n);
+	stack = rec + O_OF_W(W_OF_O(ecRecode_keep(n)));
+	// загрузить и перекодировать d
+	if (!bignPrivkeyLoad(d, ec, privkey, 0))
+		return ERR_BAD_PRIVKEY;
+	ecRecode(rec, d, n, stack);
+	// обработать пакеты
+	for (i = 0; i < count; i += cnt)
+	{
+		cnt = MIN2(b, count - i);
+		// загрузить и проверить Q_i
+		for (j = 0; j < cnt; ++j)
+		{
+			const octet* pubkey = pubkeys + (i + j) * 2 * no;
+			if (!qrFrom(ecX(Q + j * 2 * n), pubkey, ec->f, stack) ||
+				!qrFrom(ecY(Q + j * 2 * n, n), pubkey + no, ec->f, stack) ||
+				!ecpIsOnA(Q + j * 2 * n, ec, stack))
+				return ERR_BAD_PUBKEY;
+		}
+		// R_i <- d Q_i
+		if (!ecMulARecBatch1(R, Q, ec, rec, n, cnt, stack))
+			return ERR_BAD_PARAMS;
+		// выгрузить общие ключи
+		for (j = 0; j < cnt; ++j)
+		{
+			octet* key = (octet*)(Q + j * 2 * n);
+			qrTo(key, ecX(R + j * 2 * n), ec->f, stack);
+			if (key_len > no)
+				qrTo(key + no, ecY(R + j * 2 * n, n), ec->f, stack);
+			memCopy(keys + (i + j) * key_len, key, key_len);
+		}
+	}
+	// все нормально
+	return ERR_OK;
+}
+
+err_t bignDHBatch(octet keys[], const bign_params* params,
+	const octet privkey[], size_t count, const octet pubkeys[],
+	size_t key_len)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignDHBatch_deep);
+	ERR_CALL_CHECK(code);
+	// построить общие ключи
+	code = bignDHBatchEc(keys, prep->ec, privkey, count, pubkeys,
+		key_len, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxDHBatch(octet keys[], const void* ctx, const octet privkey[],
+	size_t count, const octet pubkeys[], size_t key_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignDHBatch_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// построить общие ключи
+	code = bignDHBatchEc(keys, bignCtxEc(ctx), privkey, count, pubkeys,
+		key_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Выработка ЭЦП
+
+Функция bignSignFinish() по одноразовому ключу k и точке R = k G 
+завершает выработку подписи. Буферы d, k и R портятся.
+*******************************************************************************
+*/
+
+static void bignSignFinish(octet sig[], const ec_o* ec, 
+	const octet oid_der[], size_t oid_len, const octet hash[], word d[], 
+	word k[], word R[], void* stack)
+{
+	const size_t no = ec->f->no;
+	const size_t n = ec->f->n;
+	// состояние (буферы могут пересекаться)
+	word* s0;				/* [n/2] первая часть подписи */
+	word* s1;				/* [n] вторая часть подписи */
+	// раскладка
+	s1 = d;
+	s0 = R + n + n / 2;
+	// s0 <- belt-hash(oid || R || H) mod 2^l
+	qrTo((octet*)R, ecX(R), ec->f, stack);
+	beltHashStart(stack);
+	beltHashStepH(oid_der, oid_len, stack);
+	beltHashStepH(R, no, stack);
+	beltHashStepH(hash, no, stack);
+	beltHashStepG2(sig, no / 2, stack);
+	wwFrom(s0, sig, no / 2);
+	// R <- (s0 + 2^l) d
+	zzMul(R, s0, n / 2, d, n, stack);
+	R[n + n / 2] = zzAdd(R + n / 2, R + n / 2, d, n);
+	// s1 <- R mod q
+	ecModOrder(s1, R, n + n / 2 + 1, ec, stack);
+	// s1 <- (k - s1 - H) mod q
+	zzSubMod(s1, k, s1, ec->order, n);
+	wwFrom(k, hash, no);
+	zzSubMod(s1, s1, k, ec->order, n);
+	// выгрузить s1
+	wwTo(sig + no / 2, no, s1);
+}
+
+static size_t bignSignFinish_deep(size_t n, size_t f_deep)
+{
+	return utilMax(4,
+		f_deep,
+		beltHash_keep(),
+		zzMul_deep(n / 2, n),
+		ecModOrder_deep(n));
+}
+
+static size_t bignSign_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(4 * n) +
+		utilMax(2,
+			bignMulBase_deep(n, ec_d, ec_deep),
+			bignSignFinish_deep(n, f_deep));
+}
+
+static err_t bignSignEc(octet sig[], const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], const word dv[], gen_i rng, void* rng_state,
+	void* stack)
+{
+	size_t no, n;
+	// состояние (буферы могут пересекаться)
+	word* d;				/* [n] личный ключ */
+	word* k;				/* [n] одноразовый личный ключ */
+	word* R;				/* [2n] точка R */
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	ASSERT(n % 2 == 0);
 	// проверить входные указатели
+	ASSERT((privkey == 0) != (dv == 0));
 	if (!memIsValid(hash, no) ||
-		!memIsValid(privkey, no) ||
+		!memIsNullOrValid(privkey, no) ||
 		!memIsValid(sig, no + no / 2) ||
 		!memIsDisjoint2(hash, no, sig, no + no / 2))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = s1 = objEnd(ec, word);
+	// раскладка стека
+	d = (word*)stack;
 	k = d + n;
 	R = k + n;
-	s0 = R + n + n / 2;
-	stack = (octet*)(R + 2 * n);
+	stack = R + 2 * n;
 	// загрузить d
-	wwFrom(d, privkey, no);
-	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
+	if (!bignPrivkeyLoad(d, ec, privkey, dv))
+		return ERR_BAD_PRIVKEY;
+	// сгенерировать k с помощью rng
+	if (!zzRandNZMod(k, ec->order, n, rng, rng_state))
+		return ERR_BAD_RNG;
+	// R <- k G
+	if (!bignMulBase(R, ec, pre, k, stack))
+		return ERR_BAD_PARAMS;
+	// завершить выработку подписи
+	bignSignFinish(sig, ec, oid_der, oid_len, hash, d, k, R, stack);
+	return ERR_OK;
+}
+
+err_t bignSignSoft(octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignSign_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = bignSignEc(sig, prep->ec, prep->pre, oid_der, oid_len, hash,
+		privkey, 0, rng, rng_state, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+static err_t bignSignBody(octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->bign_sign)
 	{
-		blobClose(state);
+		code = eng->bign_sign(eng->state, sig, params, oid_der, oid_len,
+			hash, privkey, rng, rng_state);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
+	}
+	return bignSignSoft(sig, params, oid_der, oid_len, hash, privkey, rng,
+		rng_state);
+}
+
+err_t bignSign(octet sig[], const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet privkey[], gen_i rng,
+	void* rng_state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_SIGN);
+	code = bignSignBody(sig, params, oid_der, oid_len, hash, privkey, rng,
+		rng_state);
+	STAT_API_END(STAT_API_BIGN_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSignBody(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignSignEc(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, privkey, 0, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxSign(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet privkey[], gen_i rng,
+	void* rng_state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSignBody(sig, ctx, oid_der, oid_len, hash, privkey, rng,
+		rng_state);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSignWBody(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state, void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignSign_deep))
+		return ERR_BAD_INPUT;
+	// выработать подпись
+	return bignSignEc(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, privkey, 0, rng, rng_state, stack);
+}
+
+err_t bignCtxSignW(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet privkey[], gen_i rng,
+	void* rng_state, void* stack)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSignWBody(sig, ctx, oid_der, oid_len, hash, privkey, rng,
+		rng_state, stack);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSignSkBody(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const void* sk, gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и sk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPrivkeyCheck(sk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignSignEc(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, 0, bignPrivkeyD(sk), rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxSignSk(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const void* sk, gen_i rng,
+	void* rng_state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSignSkBody(sig, ctx, oid_der, oid_len, hash, sk, rng,
+		rng_state);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+static size_t bignSign2_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(4 * n) + beltHash_keep() +
+		utilMax(6,
+			beltHash_keep(),
+			32,
+			beltWBL_keep(),
+			bignMulBase_deep(n, ec_d, ec_deep),
+			zzMul_deep(n / 2, n),
+			ecModOrder_deep(n));
+}
+
+static err_t bignSign2Ec(octet sig[], const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], const word dv[], const void* t, size_t t_len,
+	void* stack)
+{
+	size_t no, n;
+	// состояние (буферы могут пересекаться)
+	word* d;				/* [n] личный ключ */
+	word* k;				/* [n] одноразовый личный ключ */
+	word* R;				/* [2n] точка R */
+	word* s0;				/* [n/2] первая часть подписи */
+	word* s1;				/* [n] вторая часть подписи */
+	octet* hash_state;		/* [beltHash_keep] состояние хэширования */
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить t
+	if (!memIsNullOrValid(t, t_len))
+		return ERR_BAD_INPUT;
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	ASSERT(n % 2 == 0);
+	// проверить входные указатели
+	ASSERT((privkey == 0) != (dv == 0));
+	if (!memIsValid(hash, no) ||
+		!memIsNullOrValid(privkey, no) ||
+		!memIsValid(sig, no + no / 2) ||
+		!memIsDisjoint2(hash, no, sig, no + no / 2))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	d = s1 = (word*)stack;
+	k = d + n;
+	R = k + n;
+	s0 = R + n + n / 2;
+	hash_state = (octet*)(R + 2 * n);
+	stack = hash_state + beltHash_keep();
+	// загрузить d
+	if (!bignPrivkeyLoad(d, ec, privkey, dv))
 		return ERR_BAD_PRIVKEY;
-	}
-	// сгенерировать k с помощью rng
-	if (!zzRandNZMod(k, ec->order, n, rng, rng_state))
+	// хэшировать oid
+	beltHashStart(hash_state);
+	beltHashStepH(oid_der, oid_len, hash_state);
+	// сгенерировать k по алгоритму 6.3.3
 	{
-		blobClose(state);
-		return ERR_BAD_RNG;
+		// theta <- belt-hash(oid || d || t)
+		memCopy(stack, hash_state, beltHash_keep());
+		if (dv)
+		{
+			wwTo((octet*)k, no, d);
+			beltHashStepH(k, no, stack);
+		}
+		else
+			beltHashStepH(privkey, no, stack);
+		if (t != 0)
+			beltHashStepH(t, t_len, stack);
+		beltHashStepG(stack, stack);
+		// инициализировать beltWBL ключом theta
+		beltWBLStart(stack, stack, 32);
+		// k <- H
+		memCopy(k, hash, no);
+		// k <- beltWBL(k, theta) пока k \notin {1,..., q - 1}
+		while (1)
+		{
+			beltWBLStepE(k, no, stack);
+			wwFrom(k, k, no);
+			if (!wwIsZero(k, n) && wwCmp(k, ec->order, n) < 0)
+				break;
+			wwTo(k, no, k);
+		}
 	}
 	// R <- k G
-	if (!ecMulA(R, ec->base, ec, k, n, stack))
-	{
-		blobClose(state);
+	if (!bignMulBase(R, ec, pre, k, stack))
 		return ERR_BAD_PARAMS;
-	}
 	qrTo((octet*)R, ecX(R), ec->f, stack);
 	// s0 <- belt-hash(oid || R || H) mod 2^l
-	beltHashStart(stack);
-	beltHashStepH(oid_der, oid_len, stack);
-	beltHashStepH(R, no, stack);
-	beltHashStepH(hash, no, stack);
-	beltHashStepG2(sig, no / 2, stack);
+	beltHashStepH(R, no, hash_state);
+	beltHashStepH(hash, no, hash_state);
+	beltHashStepG2(sig, no / 2, hash_state);
 	wwFrom(s0, sig, no / 2);
 	// R <- (s0 + 2^l) d
 	zzMul(R, s0, n / 2, d, n, stack);
 	R[n + n / 2] = zzAdd(R + n / 2, R + n / 2, d, n);
 	// s1 <- R mod q
-	zzMod(s1, R, n + n / 2 + 1, ec->order, n, stack);
+	ecModOrder(s1, R, n + n / 2 + 1, ec, stack);
 	// s1 <- (k - s1 - H) mod q
 	zzSubMod(s1, k, s1, ec->order, n);
 	wwFrom(k, hash, no);
@@ -894,39 +3144,245 @@ err_t bignSign(octet sig[], const bign_params* params, const octet oid_der[],
 	// выгрузить s1
 	wwTo(sig + no / 2, no, s1);
 	// все нормально
-	blobClose(state);
 	return ERR_OK;
 }
 
-static size_t bignSign2_deep(size_t n, size_t f_deep, size_t ec_d,
-	size_t ec_deep)
+static err_t bignSign2Body(octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], const void* t, size_t t_len)
 {
-	return O_OF_W(4 * n) + beltHash_keep() +
-		utilMax(6,
-			beltHash_keep(),
-			32,
-			beltWBL_keep(),
-			ecMulA_deep(n, ec_d, ec_deep, n),
-			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n));
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить t
+	if (!memIsNullOrValid(t, t_len))
+		return ERR_BAD_INPUT;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignSign2_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = bignSign2Ec(sig, prep->ec, prep->pre, oid_der, oid_len, hash,
+		privkey, 0, t, t_len, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
 }
 
 err_t bignSign2(octet sig[], const bign_params* params, const octet oid_der[],
-	size_t oid_len, const octet hash[], const octet privkey[], const void* t, 
+	size_t oid_len, const octet hash[], const octet privkey[], const void* t,
 	size_t t_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_SIGN);
+	code = bignSign2Body(sig, params, oid_der, oid_len, hash, privkey, t,
+		t_len);
+	STAT_API_END(STAT_API_BIGN_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSign2Body(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], const void* t, size_t t_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSign2_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignSign2Ec(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, privkey, 0, t, t_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxSign2(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet privkey[], const void* t,
+	size_t t_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSign2Body(sig, ctx, oid_der, oid_len, hash, privkey, t,
+		t_len);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSign2WBody(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], const void* t, size_t t_len, void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignSign2_deep))
+		return ERR_BAD_INPUT;
+	// выработать подпись
+	return bignSign2Ec(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, privkey, 0, t, t_len, stack);
+}
+
+err_t bignCtxSign2W(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet privkey[], const void* t,
+	size_t t_len, void* stack)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSign2WBody(sig, ctx, oid_der, oid_len, hash, privkey, t,
+		t_len, stack);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+static err_t bignCtxSign2SkBody(octet sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const void* sk, const void* t, size_t t_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и sk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPrivkeyCheck(sk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSign2_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignSign2Ec(sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, 0, bignPrivkeyD(sk), t, t_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxSign2Sk(octet sig[], const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const void* sk, const void* t,
+	size_t t_len)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_SIGN);
+	code = bignCtxSign2SkBody(sig, ctx, oid_der, oid_len, hash, sk, t,
+		t_len);
+	STAT_API_END(STAT_API_BIGN_CTX_SIGN, code);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетная выработка ЭЦП
+*******************************************************************************
+*/
+
+static size_t bignSignBatch_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return utilMax(2,
+		bignSign_deep(n, f_deep, ec_d, ec_deep),
+		O_OF_W(2 * n + 4 * n + 8 * n + 8 * n + 4) +
+			utilMax(2,
+				ecpAddMulAX4_deep(n, f_deep, 1),
+				bignSignFinish_deep(n, f_deep)));
+}
+
+static err_t bignSignBatchEc(octet sigs[], const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, size_t count, const octet hashes[],
+	const octet privkey[], gen_i rng, void* rng_state, void* stack)
 {
 	err_t code;
 	size_t no, n;
-	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
+	size_t i, j;
+	// состояние
 	word* d;				/* [n] личный ключ */
-	word* k;				/* [n] одноразовый личный ключ */
-	word* R;				/* [2n] точка R */
-	word* s0;				/* [n/2] первая часть подписи */
-	word* s1;				/* [n] вторая часть подписи */
-	octet* hash_state;		/* [beltHash_keep] состояние хэширования */
-	octet* stack;
+	word* t;				/* [n] копия d */
+	word* k;				/* [4n] одноразовые личные ключи */
+	word* G;				/* [8n] 4 копии базовой точки */
+	word* R;				/* [8n] точки R */
+	word* e;				/* [4] нулевые кратности */
+	void* st;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(hashes, count * no) ||
+		!memIsValid(privkey, no) ||
+		!memIsValid(sigs, count * (no + no / 2)) ||
+		!memIsDisjoint2(hashes, count * no, sigs, count * (no + no / 2)))
+		return ERR_BAD_INPUT;
+	// пакетная обработка
+	i = 0;
+	if (!pre && bignIsOperableX4(ec))
+	{
+		// раскладка стека
+		d = (word*)stack;
+		t = d + n;
+		k = t + n;
+		G = k + 4 * n;
+		R = G + 8 * n;
+		e = R + 8 * n;
+		st = e + 4;
+		// загрузить d
+		wwFrom(d, privkey, no);
+		if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
+			return ERR_BAD_PRIVKEY;
+		// подготовить G и e
+		for (j = 0; j < 4; ++j)
+			wwCopy(G + 2 * n * j, ec->base, 2 * n);
+		wwSetZero(e, 4);
+		// обработать пакеты из 4 подписей
+		for (; i + 4 <= count; i += 4)
+		{
+			// сгенерировать k[j] с помощью rng
+			for (j = 0; j < 4; ++j)
+				if (!zzRandNZMod(k + n * j, ec->order, n, rng, rng_state))
+					return ERR_BAD_RNG;
+			// R[j] <- k[j] G
+			if (ecpAddMulAX4(R, ec, G, k, G, e, 1, st) != 15)
+				return ERR_BAD_PARAMS;
+			// завершить выработку подписей
+			for (j = 0; j < 4; ++j)
+			{
+				wwCopy(t, d, n);
+				bignSignFinish(sigs + (i + j) * (no + no / 2), ec, oid_der, 
+					oid_len, hashes + (i + j) * no, t, k + n * j, R + 2 * n * j,
+					st);
+			}
+		}
+	}
+	// обработать остаток
+	for (; i < count; ++i)
+	{
+		code = bignSignEc(sigs + i * (no + no / 2), ec, pre, oid_der, oid_len,
+			hashes + i * no, privkey, 0, rng, rng_state, stack);
+		ERR_CALL_CHECK(code);
+	}
+	return ERR_OK;
+}
+
+err_t bignSignBatch(octet sigs[], const bign_params* params, 
+	const octet oid_der[], size_t oid_len, size_t count, const octet hashes[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_prep_st prep[1];
 	// проверить params
 	if (!memIsValid(params, sizeof(bign_params)))
 		return ERR_BAD_INPUT;
@@ -935,200 +3391,802 @@ err_t bignSign2(octet sig[], const bign_params* params, const octet oid_der[],
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
-	// проверить t
-	if (!memIsNullOrValid(t, t_len))
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignSignBatch_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подписи
+	code = bignSignBatchEc(sigs, prep->ec, prep->pre, oid_der, oid_len,
+		count, hashes, privkey, rng, rng_state, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxSignBatch(octet sigs[], const void* ctx, const octet oid_der[],
+	size_t oid_len, size_t count, const octet hashes[], const octet privkey[],
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignSign2_deep));
-	if (state == 0)
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSignBatch_deep);
+	if (stack == 0)
 		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
+	// выработать подписи
+	code = bignSignBatchEc(sigs, bignCtxEc(ctx), bignCtxPre(ctx), oid_der,
+		oid_len, count, hashes, privkey, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пул одноразовых ключей
+
+Пул -- кольцевая очередь из size элементов (k, R), где k -- одноразовый
+личный ключ, R = k G (аффинная точка). Элементы вырабатываются функцией
+bignPoolFillOne(): ключ k генерируется под мьютексом пула (генератор пула
+не обязан быть потокобезопасным), точка R вычисляется вне мьютекса, после
+чего элемент ставится в очередь. Счетчик pending учитывает элементы, которые
+вырабатываются в данный момент, чтобы не переполнить очередь. Если места
+в очереди нет, то bignPoolFillOne() возвращает ERR_BUSY.
+
+Рабочие потоки (не более BIGN_POOL_THREADS) вызывают bignPoolFillOne()
+до остановки пула, а при заполненной очереди приостанавливаются на 1 мс.
+Поток, на генераторе которого произошла ошибка, записывает ее код в code
+и завершается.
+
+Элемент извлекается из очереди функцией bignPoolTake() и сразу
+обнуляется. При пустой очереди элемент вырабатывается в вызывающем потоке.
+Функция bignPoolTake() используется в bignCtxSignPool() и
+bignCtxPoolTake().
+
+Пул ссылается на контекст и содержит мьютекс и описатели потоков,
+поэтому не является объектом (см. obj.h) и не может перемещаться.
+*******************************************************************************
+*/
+
+#define BIGN_POOL_THREADS 16
+
+typedef struct
+{
+	const void* ctx;		/*!< контекст */
+	size_t n;				/*!< число слов в координате */
+	size_t size;			/*!< емкость очереди */
+	size_t head;			/*!< первый элемент очереди */
+	size_t count;			/*!< число элементов в очереди */
+	size_t pending;			/*!< число вырабатываемых элементов */
+	gen_i rng;				/*!< генератор */
+	void* rng_state;		/*!< состояние генератора */
+	err_t code;				/*!< ошибка рабочего потока */
+	size_t stop;			/*!< признак остановки */
+	size_t threads;			/*!< число рабочих потоков */
+	mt_thrd_t thrds[BIGN_POOL_THREADS];	/*!< рабочие потоки */
+	mt_mtx_t mtx[1];		/*!< мьютекс */
+	word entries[];			/*!< [size * 3n] элементы (k, R) */
+} bign_pool_st;
+
+size_t bignPool_keep(size_t l, size_t size)
+{
+	return sizeof(bign_pool_st) + O_OF_W(size * 3 * W_OF_B(2 * l));
+}
+
+static size_t bignPoolFillOne_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(3 * n) +
+		utilMax(2,
+			f_deep,
+			bignMulBase_deep(n, ec_d, ec_deep));
+}
+
+static err_t bignPoolFillOne(bign_pool_st* s, void* stack)
+{
+	const ec_o* ec = bignCtxEc(s->ctx);
+	const size_t n = s->n;
+	err_t code = ERR_OK;
+	word* entry;
+	// состояние
+	word* k;				/* [n] одноразовый личный ключ */
+	word* R;				/* [2n] точка R */
+	// раскладка стека
+	k = (word*)stack;
+	R = k + n;
+	stack = R + 2 * n;
+	// есть место?
+	mtMtxLock(s->mtx);
+	if (s->count + s->pending >= s->size)
+		code = ERR_BUSY;
+	else if (!zzRandNZMod(k, ec->order, n, s->rng, s->rng_state))
+		code = ERR_BAD_RNG;
+	else
+		++s->pending;
+	mtMtxUnlock(s->mtx);
+	ERR_CALL_CHECK(code);
+	// R <- k G
+	if (!bignMulBase(R, ec, bignCtxPre(s->ctx), k, stack))
+		code = ERR_BAD_PARAMS;
+	// поставить в очередь
+	mtMtxLock(s->mtx);
+	--s->pending;
+	if (code == ERR_OK)
+	{
+		entry = s->entries + (s->head + s->count) % s->size * 3 * n;
+		wwCopy(entry, k, n);
+		wwCopy(entry + n, R, 2 * n);
+		++s->count;
+	}
+	mtMtxUnlock(s->mtx);
+	// очистка
+	wwSetZero(k, n);
+	return code;
+}
+
+static void bignPoolThrd(void* arg)
+{
+	bign_pool_st* s = (bign_pool_st*)arg;
+	void* stack;
+	err_t code;
+	// создать стек
+	stack = bignCtxStackCreate(s->ctx, bignPoolFillOne_deep);
+	if (stack == 0)
+	{
+		mtMtxLock(s->mtx), s->code = ERR_OUTOFMEMORY, mtMtxUnlock(s->mtx);
+		return;
+	}
+	// вырабатывать элементы
+	while (!mtAtomicLoad(&s->stop))
+	{
+		code = bignPoolFillOne(s, stack);
+		if (code == ERR_BUSY)
+			mtSleep(1);
+		else if (code != ERR_OK)
+		{
+			mtMtxLock(s->mtx), s->code = code, mtMtxUnlock(s->mtx);
+			break;
+		}
+	}
+	// завершение
+	blobClose(stack);
+}
+
+static err_t bignPoolTake(word k[], word R[], bign_pool_st* s, void* stack)
+{
+	const ec_o* ec = bignCtxEc(s->ctx);
+	const size_t n = s->n;
+	word* entry;
+	bool_t found;
+	err_t code = ERR_OK;
+	// извлечь элемент
+	mtMtxLock(s->mtx);
+	if ((found = s->count > 0) != 0)
+	{
+		entry = s->entries + s->head * 3 * n;
+		wwCopy(k, entry, n);
+		wwCopy(R, entry + n, 2 * n);
+		wwSetZero(entry, 3 * n);
+		s->head = (s->head + 1) % s->size;
+		--s->count;
+	}
+	// очередь пуста: сгенерировать k
+	else if (!zzRandNZMod(k, ec->order, n, s->rng, s->rng_state))
+		code = ERR_BAD_RNG;
+	mtMtxUnlock(s->mtx);
+	ERR_CALL_CHECK(code);
+	// очередь пуста: R <- k G
+	if (!found && !bignMulBase(R, ec, bignCtxPre(s->ctx), k, stack))
+		code = ERR_BAD_PARAMS;
+	return code;
+}
+
+static bool_t bignPoolIsValid(const void* pool, const void* ctx)
+{
+	const bign_pool_st* s = (const bign_pool_st*)pool;
+	return memIsValid(s, sizeof(bign_pool_st)) && s->ctx == ctx &&
+		s->n == bignCtxEc(ctx)->f->n && s->size > 0 &&
+		wwIsValid(s->entries, s->size * 3 * s->n);
+}
+
+err_t bignCtxPoolStart(void* pool, const void* ctx, size_t size,
+	size_t threads, gen_i rng, void* rng_state)
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// проверить входные указатели
+	if (size == 0 || threads > BIGN_POOL_THREADS ||
+		!memIsValid(pool, bignPool_keep(bignCtxEc(ctx)->f->no * 4, size)))
+		return ERR_BAD_INPUT;
+	// подготовить пул
+	memSetZero(s, sizeof(bign_pool_st));
+	s->ctx = ctx;
+	s->n = bignCtxEc(ctx)->f->n;
+	s->size = size;
+	s->rng = rng;
+	s->rng_state = rng_state;
+	s->code = ERR_OK;
+	if (!mtMtxCreate(s->mtx))
+		return ERR_SYS;
+	// запустить рабочие потоки
+	for (; s->threads < threads; ++s->threads)
+		if (!mtThrdCreate(s->thrds + s->threads, bignPoolThrd, s))
+			break;
+	return ERR_OK;
+}
+
+err_t bignCtxPoolFill(void* pool, const void* ctx)
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	err_t code;
+	void* stack;
+	// проверить ctx и pool
+	if (!bignCtxIsOperable(ctx) || !bignPoolIsValid(pool, ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignPoolFillOne_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// заполнить очередь
+	while ((code = bignPoolFillOne(s, stack)) == ERR_OK);
+	if (code == ERR_BUSY)
+		code = ERR_OK;
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+size_t bignCtxPoolCount(void* pool)
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	size_t count;
+	ASSERT(memIsValid(s, sizeof(bign_pool_st)));
+	mtMtxLock(s->mtx);
+	count = s->count;
+	mtMtxUnlock(s->mtx);
+	return count;
+}
+
+err_t bignCtxSignPool(octet sig[], const void* ctx, void* pool,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[])
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	const ec_o* ec;
+	size_t no, n;
+	err_t code;
+	void* stack;
+	// состояние
+	word* d;				/* [n] личный ключ */
+	word* k;				/* [n] одноразовый личный ключ */
+	word* R;				/* [2n] точка R */
+	// проверить ctx и pool
+	if (!bignCtxIsOperable(ctx) || !bignPoolIsValid(pool, ctx))
+		return ERR_BAD_INPUT;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
 	// размерности
+	ec = bignCtxEc(ctx);
 	no  = ec->f->no;
 	n = ec->f->n;
-	ASSERT(n % 2 == 0);
 	// проверить входные указатели
 	if (!memIsValid(hash, no) ||
 		!memIsValid(privkey, no) ||
 		!memIsValid(sig, no + no / 2) ||
 		!memIsDisjoint2(hash, no, sig, no + no / 2))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = s1 = objEnd(ec, word);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка стека
+	d = (word*)stack;
 	k = d + n;
 	R = k + n;
-	s0 = R + n + n / 2;
-	hash_state = (octet*)(R + 2 * n);
-	stack = hash_state + beltHash_keep();
 	// загрузить d
 	wwFrom(d, privkey, no);
 	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
 	{
-		blobClose(state);
+		blobClose(stack);
 		return ERR_BAD_PRIVKEY;
 	}
-	// хэшировать oid
-	beltHashStart(hash_state);
-	beltHashStepH(oid_der, oid_len, hash_state);
-	// сгенерировать k по алгоритму 6.3.3
-	{
-		// theta <- belt-hash(oid || d || t)
-		memCopy(stack, hash_state, beltHash_keep());
-		beltHashStepH(privkey, no, stack);
-		if (t != 0)
-			beltHashStepH(t, t_len, stack);
-		beltHashStepG(stack, stack);
-		// инициализировать beltWBL ключом theta
-		beltWBLStart(stack, stack, 32);
-		// k <- H
-		memCopy(k, hash, no);
-		// k <- beltWBL(k, theta) пока k \notin {1,..., q - 1}
-		while (1)
-		{
-			beltWBLStepE(k, no, stack);
-			wwFrom(k, k, no);
-			if (!wwIsZero(k, n) && wwCmp(k, ec->order, n) < 0)
-				break;
-			wwTo(k, no, k);
-		}
-	}
-	// R <- k G
-	if (!ecMulA(R, ec->base, ec, k, n, stack))
+	// извлечь элемент
+	code = bignPoolTake(k, R, s, R + 2 * n);
+	ERR_CALL_HANDLE(code, blobClose(stack));
+	// завершить выработку подписи
+	bignSignFinish(sig, ec, oid_der, oid_len, hash, d, k, R, R + 2 * n);
+	// завершение
+	blobClose(stack);
+	return ERR_OK;
+}
+
+err_t bignCtxPoolTake(octet k[], octet R[], void* pool)
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	const ec_o* ec;
+	size_t no, n;
+	err_t code;
+	void* stack;
+	// состояние
+	word* kw;				/* [n] одноразовый личный ключ */
+	word* Rw;				/* [2n] точка R */
+	// проверить pool
+	if (!memIsValid(s, sizeof(bign_pool_st)) ||
+		!bignCtxIsOperable(s->ctx) || !bignPoolIsValid(pool, s->ctx))
+		return ERR_BAD_INPUT;
+	// размерности
+	ec = bignCtxEc(s->ctx);
+	no  = ec->f->no;
+	n = ec->f->n;
+	// проверить входные указатели
+	if (!memIsValid(k, no) || !memIsValid(R, 2 * no))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(s->ctx, bignPoolFillOne_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка стека
+	kw = (word*)stack;
+	Rw = kw + n;
+	// извлечь элемент
+	code = bignPoolTake(kw, Rw, s, Rw + 2 * n);
+	if (code == ERR_OK)
 	{
-		blobClose(state);
-		return ERR_BAD_PARAMS;
+		wwTo(k, no, kw);
+		qrTo(R, ecX(Rw), ec->f, Rw + 2 * n);
+		qrTo(R + no, ecY(Rw, n), ec->f, Rw + 2 * n);
 	}
-	qrTo((octet*)R, ecX(R), ec->f, stack);
-	// s0 <- belt-hash(oid || R || H) mod 2^l
-	beltHashStepH(R, no, hash_state);
-	beltHashStepH(hash, no, hash_state);
-	beltHashStepG2(sig, no / 2, hash_state);
-	wwFrom(s0, sig, no / 2);
-	// R <- (s0 + 2^l) d
-	zzMul(R, s0, n / 2, d, n, stack);
-	R[n + n / 2] = zzAdd(R + n / 2, R + n / 2, d, n);
-	// s1 <- R mod q
-	zzMod(s1, R, n + n / 2 + 1, ec->order, n, stack);
-	// s1 <- (k - s1 - H) mod q
-	zzSubMod(s1, k, s1, ec->order, n);
-	wwFrom(k, hash, no);
-	zzSubMod(s1, s1, k, ec->order, n);
-	// выгрузить s1
-	wwTo(sig + no / 2, no, s1);
-	// все нормально
-	blobClose(state);
-	return ERR_OK;
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxPoolStop(void* pool)
+{
+	bign_pool_st* s = (bign_pool_st*)pool;
+	err_t code;
+	ASSERT(memIsValid(s, sizeof(bign_pool_st)));
+	// остановить рабочие потоки
+	mtAtomicStore(&s->stop, 1);
+	while (s->threads)
+		mtThrdJoin(s->thrds + --s->threads);
+	// очистить очередь
+	code = s->code;
+	wwSetZero(s->entries, s->size * 3 * s->n);
+	mtMtxClose(s->mtx);
+	memSetZero(s, sizeof(bign_pool_st));
+	return code;
 }
 
 /*
 *******************************************************************************
 Проверка ЭЦП
+
+Функция bignVerifyLoad() загружает открытый ключ Q (если pubkey != 0) 
+и подпись (s0, s1), определяет кратности s1 + H и s0 + 2^l точек G и Q. Буфер H может совпадать 
+с s0. Функция bignVerifyFinish() по точке R = (s1 + H) G + (s0 + 2^l) Q
+завершает проверку. Буфер R портится.
 *******************************************************************************
 */
 
+static err_t bignVerifyLoad(word Q[], word s1[], word s0[], word H[],
+	const ec_o* ec, const octet hash[], const octet sig[],
+	const octet pubkey[], void* stack)
+{
+	const size_t no = ec->f->no;
+	const size_t n = ec->f->n;
+	// загрузить Q
+	if (pubkey && 
+		(!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
+		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack)))
+		return ERR_BAD_PUBKEY;
+	// загрузить и проверить s1
+	wwFrom(s1, sig + no / 2, no);
+	if (wwCmp(s1, ec->order, n) >= 0)
+		return ERR_BAD_SIG;
+	// s1 <- (s1 + H) mod q
+	wwFrom(H, hash, no);
+	if (wwCmp(H, ec->order, n) >= 0)
+	{
+		zzSub2(H, ec->order, n);
+		// 2^{l - 1} < q < 2^l, H < 2^l => H - q < q
+		ASSERT(wwCmp(H, ec->order, n) < 0);
+	}
+	zzAddMod(s1, s1, H, ec->order, n);
+	// загрузить s0
+	wwFrom(s0, sig, no / 2);
+	s0[n / 2] = 1;
+	return ERR_OK;
+}
+
+static err_t bignVerifyFinish(const ec_o* ec, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], word R[],
+	void* stack)
+{
+	const size_t no = ec->f->no;
+	qrTo((octet*)R, ecX(R), ec->f, stack);
+	// s0 == belt-hash(oid || R || H) mod 2^l?
+	beltHashStart(stack);
+	beltHashStepH(oid_der, oid_len, stack);
+	beltHashStepH(R, no, stack);
+	beltHashStepH(hash, no, stack);
+	return beltHashStepV2(sig, no / 2, stack) ? ERR_OK : ERR_BAD_SIG;
+}
+
+static size_t bignVerifyFinish_deep(size_t n, size_t f_deep)
+{
+	return utilMax(2,
+		f_deep,
+		beltHash_keep());
+}
+
 static size_t bignVerify_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(4 * n) +
-		utilMax(2,
-			beltHash_keep(),
-			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1));
+		utilMax(3,
+			bignVerifyFinish_deep(n, f_deep),
+			bignAddMulBase_deep(n, ec_d, ec_deep, n / 2 + 1),
+			ecComb2AddMulA_deep(n, ec_d, ec_deep, BIGN_COMB_W, 0));
 }
 
-err_t bignVerify(const bign_params* params, const octet oid_der[],
-	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+static err_t bignVerifyEc(const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet sig[], const octet pubkey[], const word Qv[], 
+	const word Qpre[], void* stack)
 {
 	err_t code;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;			/* описание эллиптической кривой */	
-	word* Q;			/* [2n] открытый ключ */
+	const word* Q;		/* [2n] открытый ключ */
 	word* R;			/* [2n] точка R */
 	word* H;			/* [n] хэш-значение */
 	word* s0;			/* [n / 2 + 1] первая часть подписи */
 	word* s1;			/* [n] вторая часть подписи */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignVerify_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	ASSERT(n % 2 == 0);
 	// проверить входные указатели
+	ASSERT((pubkey == 0) != (Qv == 0));
+	ASSERT(Qpre == 0 || Qv != 0 && pre != 0);
 	if (!memIsValid(hash, no) ||
 		!memIsValid(sig, no + no / 2) ||
-		!memIsValid(pubkey, 2 * no))
-	{
-		blobClose(state);
+		!memIsNullOrValid(pubkey, 2 * no))
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	Q = R = objEnd(ec, word);
-	H = s0 = Q + 2 * n;
+	// раскладка стека
+	R = (word*)stack;
+	H = s0 = R + 2 * n;
 	s1 = H + n;
-	stack = (octet*)(s1 + n);
-	// загрузить Q
-	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
-		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack))
+	stack = s1 + n;
+	// загрузить Q (проверенная точка Qv используется на месте), s0, s1
+	code = bignVerifyLoad(R, s1, s0, H, ec, hash, sig, pubkey, stack);
+	ERR_CALL_CHECK(code);
+	Q = Qv ? Qv : R;
+	// R <- s1 G + (s0 + 2^l) Q (по двум гребням, если есть таблица для Q)
+	if (Qpre)
 	{
-		blobClose(state);
-		return ERR_BAD_PUBKEY;
+		if (!ecComb2AddMulA(R, ec, BIGN_COMB_W, pre, s1, n, Qpre, s0, 
+			n / 2 + 1, 0, 0, 0, stack))
+			return ERR_BAD_SIG;
 	}
-	// загрузить и проверить s1
-	wwFrom(s1, sig + no / 2, no);
-	if (wwCmp(s1, ec->order, n) >= 0)
-	{
-		blobClose(state);
+	else if (!bignAddMulBase(R, ec, pre, s1, Q, s0, n / 2 + 1, stack))
 		return ERR_BAD_SIG;
-	}
-	// s1 <- (s1 + H) mod q
-	wwFrom(H, hash, no);
-	if (wwCmp(H, ec->order, n) >= 0)
+	// завершить проверку
+	return bignVerifyFinish(ec, oid_der, oid_len, hash, sig, R, stack);
+}
+
+err_t bignVerifySoft(const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignVerify_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подпись
+	code = bignVerifyEc(prep->ec, prep->pre, oid_der, oid_len, hash, sig,
+		pubkey, 0, 0, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+static err_t bignVerifyBody(const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+{
+	const eng_t* eng = engActive();
+	err_t code;
+	if (eng && eng->bign_verify)
 	{
-		zzSub2(H, ec->order, n);
-		// 2^{l - 1} < q < 2^l, H < 2^l => H - q < q
-		ASSERT(wwCmp(H, ec->order, n) < 0);
+		code = eng->bign_verify(eng->state, params, oid_der, oid_len, hash, sig,
+			pubkey);
+		if (code != ERR_NOT_IMPLEMENTED)
+			return code;
 	}
-	zzAddMod(s1, s1, H, ec->order, n);
-	// загрузить s0
-	wwFrom(s0, sig, no / 2);
-	s0[n / 2] = 1;
-	// R <- s1 G + (s0 + 2^l) Q
-	if (!ecAddMulA(R, ec, stack, 2, ec->base, s1, n, Q, s0, n / 2 + 1))
+	return bignVerifySoft(params, oid_der, oid_len, hash, sig,
+		pubkey);
+}
+
+err_t bignVerify(const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_VERIFY);
+	code = bignVerifyBody(params, oid_der, oid_len, hash, sig, pubkey);
+	STAT_API_END(STAT_API_BIGN_VERIFY, code);
+	return code;
+}
+
+static err_t bignCtxVerifyBody(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = bignVerifyEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, sig, pubkey, 0, 0, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxVerify(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_VERIFY);
+	code = bignCtxVerifyBody(ctx, oid_der, oid_len, hash, sig, pubkey);
+	STAT_API_END(STAT_API_BIGN_CTX_VERIFY, code);
+	return code;
+}
+
+static err_t bignCtxVerifyWBody(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[],
+	void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignVerify_deep))
+		return ERR_BAD_INPUT;
+	// проверить подпись
+	return bignVerifyEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, sig, pubkey, 0, 0, stack);
+}
+
+err_t bignCtxVerifyW(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const octet pubkey[],
+	void* stack)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_VERIFY);
+	code = bignCtxVerifyWBody(ctx, oid_der, oid_len, hash, sig, pubkey, stack);
+	STAT_API_END(STAT_API_BIGN_CTX_VERIFY, code);
+	return code;
+}
+
+static err_t bignCtxVerifyPkBody(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const void* pk)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и pk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPubkeyCheck(pk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = bignVerifyEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		hash, sig, 0, bignPubkeyQ(pk), bignPubkeyPre(pk), stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxVerifyPk(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[], const void* pk)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BIGN_CTX_VERIFY);
+	code = bignCtxVerifyPkBody(ctx, oid_der, oid_len, hash, sig, pk);
+	STAT_API_END(STAT_API_BIGN_CTX_VERIFY, code);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетная проверка подписи
+*******************************************************************************
+*/
+
+static size_t bignVerifyBatch_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	const size_t m = n / 2 + 1;
+	return utilMax(2,
+		bignVerify_deep(n, f_deep, ec_d, ec_deep),
+		O_OF_W(n + 8 * n + 8 * n + 4 * n + 4 * m + 8 * n) +
+			utilMax(2,
+				ecpAddMulAX4_deep(n, f_deep, m),
+				bignVerifyFinish_deep(n, f_deep)));
+}
+
+static err_t bignVerifyBatchEc(const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, size_t count, const octet hashes[],
+	const octet sigs[], const octet pubkeys[], err_t codes[], void* stack)
+{
+	err_t code, ret = ERR_OK;
+	size_t no = ec->f->no;
+	size_t n = ec->f->n;
+	size_t m = n / 2 + 1;
+	size_t i, j;
+	err_t c4[4];
+	size_t mask;
+	// состояние
+	word* H;			/* [n] хэш-значение */
+	word* G;			/* [8n] 4 копии базовой точки */
+	word* Q;			/* [8n] открытые ключи */
+	word* s1;			/* [4n] вторые части подписей */
+	word* s0;			/* [4m] первые части подписей */
+	word* R;			/* [8n] точки R */
+	void* st;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить входные указатели
+	if (!memIsValid(hashes, count * no) ||
+		!memIsValid(sigs, count * (no + no / 2)) ||
+		!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsNullOrValid(codes, count * sizeof(err_t)))
+		return ERR_BAD_INPUT;
+	// пакетная обработка
+	i = 0;
+	if (bignIsOperableX4(ec))
 	{
-		blobClose(state);
-		return ERR_BAD_SIG;
+		// раскладка стека
+		H = (word*)stack;
+		G = H + n;
+		Q = G + 8 * n;
+		s1 = Q + 8 * n;
+		s0 = s1 + 4 * n;
+		R = s0 + 4 * m;
+		st = R + 8 * n;
+		// подготовить G
+		for (j = 0; j < 4; ++j)
+			wwCopy(G + 2 * n * j, ec->base, 2 * n);
+		// обработать пакеты из 4 подписей
+		for (; i + 4 <= count; i += 4)
+		{
+			// загрузить Q[j], s0[j], s1[j] (некорректные -> фиктивные)
+			for (j = 0; j < 4; ++j)
+			{
+				c4[j] = bignVerifyLoad(Q + 2 * n * j, s1 + n * j, s0 + m * j,
+					H, ec, hashes + (i + j) * no, 
+					sigs + (i + j) * (no + no / 2),
+					pubkeys + (i + j) * 2 * no, st);
+				if (c4[j] != ERR_OK)
+				{
+					wwCopy(Q + 2 * n * j, ec->base, 2 * n);
+					wwSetW(s1 + n * j, n, 1);
+					wwSetZero(s0 + m * j, m);
+				}
+			}
+			// R[j] <- s1[j] G + (s0[j] + 2^l) Q[j]
+			mask = ecpAddMulAX4(R, ec, G, s1, Q, s0, m, st);
+			// завершить проверки
+			for (j = 0; j < 4; ++j)
+			{
+				if (c4[j] == ERR_OK)
+					c4[j] = (mask >> j) & 1 ?
+						bignVerifyFinish(ec, oid_der, oid_len,
+							hashes + (i + j) * no, 
+							sigs + (i + j) * (no + no / 2),
+							R + 2 * n * j, st) :
+						ERR_BAD_SIG;
+				if (codes)
+					codes[i + j] = c4[j];
+				if (c4[j] != ERR_OK && ret == ERR_OK)
+				{
+					ret = c4[j];
+					if (!codes)
+						return ret;
+				}
+			}
+		}
 	}
-	qrTo((octet*)R, ecX(R), ec->f, stack);
-	// s0 == belt-hash(oid || R || H) mod 2^l?
-	beltHashStart(stack);
-	beltHashStepH(oid_der, oid_len, stack);
-	beltHashStepH(R, no, stack);
-	beltHashStepH(hash, no, stack);
-	code = beltHashStepV2(sig, no / 2, stack) ? ERR_OK : ERR_BAD_SIG;
+	// обработать остаток
+	for (; i < count; ++i)
+	{
+		code = bignVerifyEc(ec, pre, oid_der, oid_len, hashes + i * no,
+			sigs + i * (no + no / 2), pubkeys + i * 2 * no, 0, 0, stack);
+		if (codes)
+			codes[i] = code;
+		if (code != ERR_OK && ret == ERR_OK)
+		{
+			ret = code;
+			if (!codes)
+				break;
+		}
+	}
+	return ret;
+}
+
+err_t bignVerifyBatch(const bign_params* params, const octet oid_der[],
+	size_t oid_len, size_t count, const octet hashes[], const octet sigs[],
+	const octet pubkeys[], err_t codes[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignVerifyBatch_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подписи
+	code = bignVerifyBatchEc(prep->ec, prep->pre, oid_der, oid_len, count,
+		hashes, sigs, pubkeys, codes, prep->stack);
 	// завершение
-	blobClose(state);
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxVerifyBatch(const void* ctx, const octet oid_der[],
+	size_t oid_len, size_t count, const octet hashes[], const octet sigs[],
+	const octet pubkeys[], err_t codes[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignVerifyBatch_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подписи
+	code = bignVerifyBatchEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der,
+		oid_len, count, hashes, sigs, pubkeys, codes, stack);
+	// завершение
+	blobClose(stack);
 	return code;
 }
 
@@ -1142,29 +4200,22 @@ static size_t bignKeyWrap_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(3 * n) + 32 +
-		utilMax(2,
+		utilMax(3,
 			ecMulA_deep(n, ec_d, ec_deep, n),
+			bignMulBase_deep(n, ec_d, ec_deep),
 			beltKWP_keep());
 }
 
-err_t bignKeyWrap(octet token[], const bign_params* params, const octet key[],
-	size_t len, const octet header[16], const octet pubkey[],
-	gen_i rng, void* rng_state)
+static err_t bignKeyWrapEc(octet token[], const ec_o* ec, const word pre[],
+	const octet key[], size_t len, const octet header[16],
+	const octet pubkey[], const word Qv[], gen_i rng, void* rng_state,
+	void* stack)
 {
-	err_t code;
 	size_t no, n;
 	// состояние
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
 	word* k;				/* [n] одноразовый личный ключ */
 	word* R;				/* [2n] точка R */
 	octet* theta;			/* [32] ключ защиты */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить rng
 	if (rng == 0)
 		return ERR_BAD_RNG;
@@ -1173,55 +4224,35 @@ err_t bignKeyWrap(octet token[], const bign_params* params, const octet key[],
 		!memIsValid(key, len) ||
 		!memIsNullOrValid(header, 16))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignKeyWrap_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	// проверить входные указатели
-	if (!memIsValid(pubkey, 2 * no) ||
+	ASSERT((pubkey == 0) != (Qv == 0));
+	if (!memIsNullOrValid(pubkey, 2 * no) ||
 		!memIsValid(token, 16 + no + len))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	k = objEnd(ec, word);
+	// раскладка стека
+	k = (word*)stack;
 	R = k + n;
 	theta = (octet*)(R + 2 * n);
 	stack = theta + 32;
 	// сгенерировать k
 	if (!zzRandNZMod(k, ec->order, n, rng, rng_state))
-	{
-		blobClose(state);
 		return ERR_BAD_RNG;
-	}
 	// R <- k Q
-	if (!qrFrom(ecX(R), pubkey, ec->f, stack) ||
+	if (Qv)
+		wwCopy(R, Qv, 2 * n);
+	else if (!qrFrom(ecX(R), pubkey, ec->f, stack) ||
 		!qrFrom(ecY(R, n), pubkey + no, ec->f, stack))
-	{
-		blobClose(state);
 		return ERR_BAD_PUBKEY;
-	}
 	if (!ecMulA(R, R, ec, k, n, stack))
-	{
-		blobClose(state);
 		return ERR_BAD_PARAMS;
-	}
 	// theta <- <R>_{256}
 	qrTo(theta, ecX(R), ec->f, stack);
 	// R <- k G
-	if (!ecMulA(R, ec->base, ec, k, n, stack))
-	{
-		blobClose(state);
+	if (!bignMulBase(R, ec, pre, k, stack))
 		return ERR_BAD_PARAMS;
-	}
 	qrTo((octet*)R, ecX(R), ec->f, stack);
 	// сформировать блок для шифрования
 	// (буферы key, header и token могут пересекаться)
@@ -1237,10 +4268,283 @@ err_t bignKeyWrap(octet token[], const bign_params* params, const octet key[],
 	// доопределить токен
 	memCopy(token, R, no);
 	// все нормально
-	blobClose(state);
 	return ERR_OK;
 }
 
+err_t bignKeyWrap(octet token[], const bign_params* params, const octet key[],
+	size_t len, const octet header[16], const octet pubkey[],
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// проверить header и key
+	if (len < 16 ||
+		!memIsValid(key, len) ||
+		!memIsNullOrValid(header, 16))
+		return ERR_BAD_INPUT;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignKeyWrap_deep);
+	ERR_CALL_CHECK(code);
+	// создать токен
+	code = bignKeyWrapEc(token, prep->ec, prep->pre, key, len, header,
+		pubkey, 0, rng, rng_state, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxKeyWrap(octet token[], const void* ctx, const octet key[],
+	size_t len, const octet header[16], const octet pubkey[],
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignKeyWrap_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// создать токен
+	code = bignKeyWrapEc(token, bignCtxEc(ctx), bignCtxPre(ctx), key, len,
+		header, pubkey, 0, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxKeyWrapW(octet token[], const void* ctx, const octet key[],
+	size_t len, const octet header[16], const octet pubkey[],
+	gen_i rng, void* rng_state, void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignKeyWrap_deep))
+		return ERR_BAD_INPUT;
+	// создать токен
+	return bignKeyWrapEc(token, bignCtxEc(ctx), bignCtxPre(ctx), key, len,
+		header, pubkey, 0, rng, rng_state, stack);
+}
+
+err_t bignCtxKeyWrapPk(octet token[], const void* ctx, const octet key[],
+	size_t len, const octet header[16], const void* pk, gen_i rng,
+	void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и pk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPubkeyCheck(pk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignKeyWrap_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// создать токен
+	code = bignKeyWrapEc(token, bignCtxEc(ctx), bignCtxPre(ctx), key, len,
+		header, 0, bignPubkeyQ(pk), rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетное создание токенов
+
+Токены одного ключа для нескольких получателей создаются пакетами
+по BIGN_WRAP_BATCH. В пакете одноразовые личные ключи k_i генерируются
+в порядке следования токенов, кратные точки k_i Q_i определяются
+совместно функцией ecMulARecBatch() (с общим переходом к аффинным
+координатам), а кратные k_i G -- с помощью bignMulBase() (по таблице
+предвычислений контекста). Размер пакета ограничивает глубину стека,
+которая не зависит от числа получателей.
+
+Функция bignKeyWrapBatch() всегда работает с контекстом (из кэша или
+созданным заново): для стандартных параметров таблица предвычислений
+готова, для остальных ее построение сопоставимо по трудоемкости с одной
+кратной точкой и окупается уже на нескольких получателях.
+
+Открытые ключи получателей проверяются: точка вне кривой может дать
+бесконечно удаленную кратную точку и нарушить пакетный переход
+к аффинным координатам.
+*******************************************************************************
+*/
+
+#define BIGN_WRAP_BATCH 8
+
+static size_t bignKeyWrapBatch_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	const size_t b = BIGN_WRAP_BATCH;
+	return O_OF_W(b * n + b * 2 * n + b * 2 * n) +
+		O_OF_W(W_OF_O(b * ecRecode_keep(n))) + 32 +
+		utilMax(6,
+			ecpIsOnA_deep(n, f_deep),
+			ecRecode_deep(n),
+			ecMulARecBatch_deep(n, ec_d, ec_deep, n, b),
+			bignMulBase_deep(n, ec_d, ec_deep),
+			f_deep,
+			beltKWP_keep());
+}
+
+static err_t bignKeyWrapBatchEc(octet tokens[], const ec_o* ec,
+	const word pre[], const octet key[], size_t len, const octet header[16],
+	size_t count, const octet pubkeys[], gen_i rng, void* rng_state,
+	void* stack)
+{
+	const size_t b = BIGN_WRAP_BATCH;
+	size_t no, n, keep, tlen;
+	size_t i, j, cnt;
+	// состояние
+	word* k;				/* [b * n] одноразовые личные ключи */
+	word* Q;				/* [b * 2n] открытые ключи */
+	word* R;				/* [b * 2n] точки k_i Q_i */
+	octet* rec;				/* [b * keep] перекодированные k_i */
+	octet* theta;			/* [32] ключ защиты */
+	octet* token;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// проверить header и key
+	if (len < 16 ||
+		!memIsValid(key, len) ||
+		!memIsNullOrValid(header, 16))
+		return ERR_BAD_INPUT;
+	// размерности
+	no  = ec->f->no;
+	n = ec->f->n;
+	keep = ecRecode_keep(n);
+	tlen = no + len + 16;
+	// проверить входные указатели
+	if (!memIsValid(pubkeys, count * 2 * no) ||
+		!memIsValid(tokens, count * tlen) ||
+		!memIsDisjoint2(tokens, count * tlen, key, len) ||
+		header && !memIsDisjoint2(tokens, count * tlen, header, 16))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	k = (word*)stack;
+	Q = k + b * n;
+	R = Q + b * 2 * n;
+	rec = (octet*)(R + b * 2 * n);
+	theta = rec + O_OF_W(W_OF_O(b * keep));
+	stack = theta + 32;
+	// обработать пакеты
+	for (i = 0; i < count; i += cnt)
+	{
+		cnt = MIN2(b, count - i);
+		// загрузить и проверить Q_i
+		for (j = 0; j < cnt; ++j)
+		{
+			const octet* pubkey = pubkeys + (i + j) * 2 * no;
+			if (!qrFrom(ecX(Q + j * 2 * n), pubkey, ec->f, stack) ||
+				!qrFrom(ecY(Q + j * 2 * n, n), pubkey + no, ec->f, stack) ||
+				!ecpIsOnA(Q + j * 2 * n, ec, stack))
+				return ERR_BAD_PUBKEY;
+		}
+		// сгенерировать и перекодировать k_i
+		for (j = 0; j < cnt; ++j)
+		{
+			if (!zzRandNZMod(k + j * n, ec->order, n, rng, rng_state))
+				return ERR_BAD_RNG;
+			ecRecode(rec + j * keep, k + j * n, n, stack);
+		}
+		// R_i <- k_i Q_i
+		if (!ecMulARecBatch(R, Q, ec, rec, n, cnt, stack))
+			return ERR_BAD_PARAMS;
+		// создать токены
+		for (j = 0; j < cnt; ++j)
+		{
+			token = tokens + (i + j) * tlen;
+			// theta <- <R_i>_{256}
+			qrTo(theta, ecX(R + j * 2 * n), ec->f, stack);
+			// Q_i <- k_i G
+			if (!bignMulBase(Q + j * 2 * n, ec, pre, k + j * n, stack))
+				return ERR_BAD_PARAMS;
+			qrTo(token, ecX(Q + j * 2 * n), ec->f, stack);
+			// зашифровать key || header
+			memCopy(token + no, key, len);
+			if (header)
+				memCopy(token + no + len, header, 16);
+			else
+				memSetZero(token + no + len, 16);
+			beltKWPStart(stack, theta, 32);
+			beltKWPStepE(token + no, len + 16, stack);
+		}
+	}
+	// все нормально
+	return ERR_OK;
+}
+
+err_t bignKeyWrapBatch(octet tokens[], const bign_params* params,
+	const octet key[], size_t len, const octet header[16], size_t count,
+	const octet pubkeys[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_ctx_ref_st* ref;
+	void* ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// контекст из кэша?
+	if ((ref = bignCtxCacheGet(params)) != 0)
+	{
+		code = bignCtxKeyWrapBatch(tokens, ref->ctx, key, len, header,
+			count, pubkeys, rng, rng_state);
+		bignCtxCacheRelease(ref);
+		return code;
+	}
+	// создать контекст
+	ctx = blobCreate(bignCtx_keep(params->l));
+	if (ctx == 0)
+		return ERR_OUTOFMEMORY;
+	// старт
+	code = bignCtxStart(ctx, params);
+	ERR_CALL_HANDLE(code, blobClose(ctx));
+	// создать токены
+	code = bignCtxKeyWrapBatch(tokens, ctx, key, len, header, count, pubkeys,
+		rng, rng_state);
+	// завершение
+	blobClose(ctx);
+	return code;
+}
+
+err_t bignCtxKeyWrapBatch(octet tokens[], const void* ctx, const octet key[],
+	size_t len, const octet header[16], size_t count, const octet pubkeys[],
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignKeyWrapBatch_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// создать токены
+	code = bignKeyWrapBatchEc(tokens, bignCtxEc(ctx), bignCtxPre(ctx), key,
+		len, header, count, pubkeys, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Разбор токена
@@ -1250,109 +4554,67 @@ err_t bignKeyWrap(octet token[], const bign_params* params, const octet key[],
 static size_t bignKeyUnwrap_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
-	return MAX2(O_OF_W(5 * n), 32 + 16) +
+	return MAX2(O_OF_W(4 * n), 32 + 16) +
 		utilMax(3,
 			beltKWP_keep(),
-			qrPower_deep(n, n, f_deep),
+			gfpSqrt_deep(n, f_deep),
 			ecMulA_deep(n, ec_d, ec_deep, n));
 }
 
-err_t bignKeyUnwrap(octet key[], const bign_params* params, const octet token[], 
-	size_t len, const octet header[16], const octet privkey[])
+static err_t bignKeyUnwrapEc(octet key[], const ec_o* ec, const octet token[],
+	size_t len, const octet header[16], const octet privkey[], const word dv[],
+	void* stack)
 {
-	err_t code;
+	err_t code = ERR_OK;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
 	word* d;				/* [n] личный ключ */
 	word* R;				/* [2n] точка R */
 	word* t1;				/* [n] вспомогательное число */
-	word* t2;				/* [n] вспомогательное число */
 	octet* theta;			/* [32] ключ защиты */
 	octet* header2;			/* [16] заголовок2 */
-	void* stack;			/* граница стека */
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить token и header
 	if (!memIsValid(token, len) ||
 		!memIsNullOrValid(header, 16))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignKeyUnwrap_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	// проверить длину токена
 	if (len < 32 + no)
-	{
-		blobClose(state);
 		return ERR_BAD_KEYTOKEN;
-	}
 	// проверить входные указатели
-	if (!memIsValid(privkey, no) ||
+	ASSERT((privkey == 0) != (dv == 0));
+	if (!memIsNullOrValid(privkey, no) ||
 		!memIsValid(key, len - 16 - no))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
+	// раскладка стека
+	d = (word*)stack;
 	R = d + n;
 	t1 = R + 2 * n;
-	t2 = t1 + n;
 	theta = (octet*)d;
 	header2 = theta + 32;
-	if (5 * no >= 48)
-		stack = t2 + n;
+	if (4 * no >= 48)
+		stack = t1 + n;
 	else
 		stack = header2 + 16;
 	// загрузить d
-	wwFrom(d, privkey, no);
-	if (wwIsZero(d, n) || wwCmp(d, ec->order, n) >= 0)
-	{
-		blobClose(state);
+	if (!bignPrivkeyLoad(d, ec, privkey, dv))
 		return ERR_BAD_PRIVKEY;
-	}
 	// xR <- x
 	if (!qrFrom(R, token, ec->f, stack))
-	{
-		blobClose(state);
 		return ERR_BAD_KEYTOKEN;
-	}
 	// t1 <- x^3 + a x + b
 	qrSqr(t1, R, ec->f, stack);
 	zmAdd(t1, t1, ec->A, ec->f);
 	qrMul(t1, t1, R, ec->f, stack);
 	zmAdd(t1, t1, ec->B, ec->f);
-	// yR <- t1^{(p + 1) / 4}
-	wwCopy(R + n, ec->f->mod, n);
-	zzAddW2(R + n, n, 1);
-	wwShLo(R + n, n, 2);
-	qrPower(R + n, t1, R + n, n, ec->f, stack);
-	// t2 <- yR^2
-	qrSqr(t2, R + n, ec->f, stack);
-	// (xR, yR) на кривой? t1 == t2?
-	if (!wwEq(t1, t2, n))
-	{
-		blobClose(state);
+	// yR <- t1^{(p + 1) / 4}, (xR, yR) на кривой?
+	if (!gfpSqrt(R + n, t1, ec->f, stack))
 		return ERR_BAD_KEYTOKEN;
-	}
 	// R <- d R
 	if (!ecMulA(R, R, ec, d, n, stack))
-	{
-		blobClose(state);
 		return ERR_BAD_PARAMS;
-	}
 	// theta <- <R>_{256}
 	qrTo(theta, ecX(R), ec->f, stack);
 	// сформировать данные для расшифрования
@@ -1369,13 +4631,97 @@ err_t bignKeyUnwrap(octet key[], const bign_params* params, const octet token[],
 		code = ERR_BAD_KEYTOKEN;
 	}
 	// завершение
-	blobClose(state);
+	return code;
+}
+
+err_t bignKeyUnwrap(octet key[], const bign_params* params, const octet token[],
+	size_t len, const octet header[16], const octet privkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить token и header
+	if (!memIsValid(token, len) ||
+		!memIsNullOrValid(header, 16))
+		return ERR_BAD_INPUT;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignKeyUnwrap_deep);
+	ERR_CALL_CHECK(code);
+	// разобрать токен
+	code = bignKeyUnwrapEc(key, prep->ec, token, len, header,
+		privkey, 0, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxKeyUnwrap(octet key[], const void* ctx, const octet token[],
+	size_t len, const octet header[16], const octet privkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignKeyUnwrap_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// разобрать токен
+	code = bignKeyUnwrapEc(key, bignCtxEc(ctx), token, len, header,
+		privkey, 0, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxKeyUnwrapW(octet key[], const void* ctx, const octet token[],
+	size_t len, const octet header[16], const octet privkey[], void* stack)
+{
+	// проверить ctx и стек
+	if (!bignCtxIsOperable(ctx) || 
+		!bignCtxStackIsValid(ctx, stack, bignKeyUnwrap_deep))
+		return ERR_BAD_INPUT;
+	// разобрать токен
+	return bignKeyUnwrapEc(key, bignCtxEc(ctx), token, len, header,
+		privkey, 0, stack);
+}
+
+err_t bignCtxKeyUnwrapSk(octet key[], const void* ctx, const octet token[],
+	size_t len, const octet header[16], const void* sk)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и sk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPrivkeyCheck(sk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignKeyUnwrap_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// разобрать токен
+	code = bignKeyUnwrapEc(key, bignCtxEc(ctx), token, len, header, 0,
+		bignPrivkeyD(sk), stack);
+	// завершение
+	blobClose(stack);
 	return code;
 }
 
 /*
 *******************************************************************************
 Извлечение ключей идентификационной ЭЦП
+
+Функции bignIdExtractEc() и bignIdVerifyEc() принимают открытый ключ 
+доверенной стороны либо в виде строки октетов pubkey, либо в виде 
+проверенной точки Qv (см. bignCtxPubkeyStart()). Если дополнительно
+задана таблица Qpre (см. bignCtxPubkeyPreStart()), то кратные G и Q 
+определяются по двум гребням.
 *******************************************************************************
 */
 
@@ -1383,75 +4729,56 @@ static size_t bignIdExtract_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(4 * n) +
-		utilMax(2,
+		utilMax(4,
 			beltHash_keep(),
-			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1));
+			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1),
+			bignAddMulBase_deep(n, ec_d, ec_deep, n / 2 + 1),
+			ecComb2AddMulA_deep(n, ec_d, ec_deep, BIGN_COMB_W, 0));
 }
 
-err_t bignIdExtract(octet id_privkey[], octet id_pubkey[], 
-	const bign_params* params, const octet oid_der[], size_t oid_len,
-	const octet id_hash[], const octet sig[], octet pubkey[])
+static err_t bignIdExtractEc(octet id_privkey[], octet id_pubkey[],
+	const ec_o* ec, const word pre[], const octet oid_der[], size_t oid_len,
+	const octet id_hash[], const octet sig[], const octet pubkey[],
+	const word Qv[], const word Qpre[], void* stack)
 {
-	err_t code;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;			/* описание эллиптической кривой */
-	word* Q;			/* [2n] открытый ключ */
+	const word* Q;		/* [2n] открытый ключ */
 	word* R;			/* [2n] точка R */
 	word* H;			/* [n] хэш-значение */
 	word* s0;			/* [n / 2 + 1] первая часть подписи */
 	word* s1;			/* [n] вторая часть подписи */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignIdExtract_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	ASSERT(n % 2 == 0);
 	// проверить входные указатели
+	ASSERT((pubkey == 0) != (Qv == 0));
+	ASSERT(Qpre == 0 || Qv != 0 && pre != 0);
 	if (!memIsValid(id_hash, no) ||
 		!memIsValid(sig, no + no / 2) ||
-		!memIsValid(pubkey, 2 * no) ||
+		!memIsNullOrValid(pubkey, 2 * no) ||
 		!memIsValid(id_privkey, no) ||
 		!memIsValid(id_pubkey, 2 * no))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	Q = R = objEnd(ec, word);
-	H = s0 = Q + 2 * n;
+	// раскладка стека
+	R = (word*)stack;
+	H = s0 = R + 2 * n;
 	s1 = H + n;
-	stack = (octet*)(s1 + n);
-	// загрузить Q
-	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
-		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack))
-	{
-		blobClose(state);
+	stack = s1 + n;
+	// загрузить Q (проверенная точка Qv используется на месте)
+	if (pubkey && 
+		(!qrFrom(ecX(R), pubkey, ec->f, stack) ||
+		!qrFrom(ecY(R, n), pubkey + no, ec->f, stack)))
 		return ERR_BAD_PUBKEY;
-	}
+	Q = Qv ? Qv : R;
 	// загрузить и проверить s1
 	wwFrom(s1, sig + no / 2, no);
 	if (wwCmp(s1, ec->order, n) >= 0)
-	{
-		blobClose(state);
 		return ERR_BAD_SIG;
-	}
 	// s1 <- (s1 + H) mod q
 	wwFrom(H, id_hash, no);
 	if (wwCmp(H, ec->order, n) >= 0)
@@ -1465,27 +4792,101 @@ err_t bignIdExtract(octet id_privkey[], octet id_pubkey[],
 	wwFrom(s0, sig, no);
 	s0[n / 2] = 1;
 	// R <- s1 G + (s0 + 2^l) Q
-	if (!ecAddMulA(R, ec, stack, 2, ec->base, s1, n, Q, s0, n / 2 + 1))
+	if (Qpre)
 	{
-		blobClose(state);
-		return ERR_BAD_SIG;
+		if (!ecComb2AddMulA(R, ec, BIGN_COMB_W, pre, s1, n, Qpre, s0, 
+			n / 2 + 1, 0, 0, 0, stack))
+			return ERR_BAD_SIG;
+	}
+	else if (pre)
+	{
+		if (!bignAddMulBase(R, ec, pre, s1, Q, s0, n / 2 + 1, stack))
+			return ERR_BAD_SIG;
 	}
+	else if (!ecAddMulA(R, ec, stack, 2, ec->base, s1, n, Q, s0, n / 2 + 1))
+		return ERR_BAD_SIG;
 	qrTo((octet*)R, ecX(R), ec->f, stack);
 	// s0 == belt-hash(oid || R || H) mod 2^l?
 	beltHashStart(stack);
 	beltHashStepH(oid_der, oid_len, stack);
 	beltHashStepH(R, no, stack);
 	beltHashStepH(id_hash, no, stack);
-	if (beltHashStepV2(sig, no / 2, stack))
-	{
-		wwTo(id_privkey, no, s1);
-		memCopy(id_pubkey, R, no);
-		qrTo(id_pubkey + no, ecY(R, n), ec->f, stack);
-	}
-	else
-		code = ERR_BAD_SIG;
+	if (!beltHashStepV2(sig, no / 2, stack))
+		return ERR_BAD_SIG;
+	// выгрузить ключи
+	wwTo(id_privkey, no, s1);
+	memCopy(id_pubkey, R, no);
+	qrTo(id_pubkey + no, ecY(R, n), ec->f, stack);
+	return ERR_OK;
+}
+
+err_t bignIdExtract(octet id_privkey[], octet id_pubkey[],
+	const bign_params* params, const octet oid_der[], size_t oid_len,
+	const octet id_hash[], const octet sig[], octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignIdExtract_deep);
+	ERR_CALL_CHECK(code);
+	// извлечь ключи
+	code = bignIdExtractEc(id_privkey, id_pubkey, prep->ec, prep->pre,
+		oid_der, oid_len, id_hash, sig, pubkey, 0, 0, prep->stack);
 	// завершение
-	blobClose(state);
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxIdExtract(octet id_privkey[], octet id_pubkey[],
+	const void* ctx, const octet oid_der[], size_t oid_len,
+	const octet id_hash[], const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdExtract_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// извлечь ключи
+	code = bignIdExtractEc(id_privkey, id_pubkey, bignCtxEc(ctx),
+		bignCtxPre(ctx), oid_der, oid_len, id_hash, sig, pubkey, 0, 0, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxIdExtractPk(octet id_privkey[], octet id_pubkey[],
+	const void* ctx, const octet oid_der[], size_t oid_len,
+	const octet id_hash[], const octet sig[], const void* pk)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и pk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPubkeyCheck(pk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdExtract_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// извлечь ключи
+	code = bignIdExtractEc(id_privkey, id_pubkey, bignCtxEc(ctx),
+		bignCtxPre(ctx), oid_der, oid_len, id_hash, sig, 0, bignPubkeyQ(pk),
+		bignPubkeyPre(pk), stack);
+	// завершение
+	blobClose(stack);
 	return code;
 }
 
@@ -1501,45 +4902,29 @@ static size_t bignIdSign_deep(size_t n, size_t f_deep, size_t ec_d,
 	return O_OF_W(4 * n) +
 		utilMax(4,
 			beltHash_keep(),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			bignMulBase_deep(n, ec_d, ec_deep),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n));
+			ecModOrder_deep(n));
 }
 
-err_t bignIdSign(octet id_sig[], const bign_params* params, 
-	const octet oid_der[], size_t oid_len, const octet id_hash[], 
-	const octet hash[], const octet id_privkey[], gen_i rng, void* rng_state)
+static err_t bignIdSignEc(octet id_sig[], const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], gen_i rng, void* rng_state,
+	void* stack)
 {
-	err_t code;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
 	word* e;				/* [n] личный ключ */
 	word* k;				/* [n] одноразовый личный ключ */
 	word* V;				/* [2n] точка V */
 	word* s0;				/* [n/2] первая часть подписи */
 	word* s1;				/* [n] вторая часть подписи */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
 	// проверить rng
 	if (rng == 0)
 		return ERR_BAD_RNG;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignIdSign_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
@@ -1549,35 +4934,23 @@ err_t bignIdSign(octet id_sig[], const bign_params* params,
 		!memIsValid(hash, no) ||
 		!memIsValid(id_privkey, no) ||
 		!memIsValid(id_sig, no + no / 2))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	e = s1 = objEnd(ec, word);
+	// раскладка стека
+	e = s1 = (word*)stack;
 	k = e + n;
 	V = k + n;
 	s0 = V + n + n / 2;
-	stack = (octet*)(V + 2 * n);
+	stack = V + 2 * n;
 	// загрузить e
 	wwFrom(e, id_privkey, no);
 	if (wwCmp(e, ec->order, n) >= 0)
-	{
-		blobClose(state);
 		return ERR_BAD_PRIVKEY;
-	}
 	// сгенерировать k с помощью rng
 	if (!zzRandNZMod(k, ec->order, n, rng, rng_state))
-	{
-		blobClose(state);
 		return ERR_BAD_RNG;
-	}
 	// V <- k G
-	if (!ecMulA(V, ec->base, ec, k, n, stack))
-	{
-		blobClose(state);
+	if (!bignMulBase(V, ec, pre, k, stack))
 		return ERR_BAD_PARAMS;
-	}
 	qrTo((octet*)V, ecX(V), ec->f, stack);
 	// s0 <- belt-hash(oid || V || H0 || H) mod 2^l
 	beltHashStart(stack);
@@ -1591,7 +4964,7 @@ err_t bignIdSign(octet id_sig[], const bign_params* params,
 	zzMul(V, s0, n / 2, e, n, stack);
 	V[n + n / 2] = zzAdd(V + n / 2, V + n / 2, e, n);
 	// s1 <- V mod q
-	zzMod(s1, V, n + n / 2 + 1, ec->order, n, stack);
+	ecModOrder(s1, V, n + n / 2 + 1, ec, stack);
 	// s1 <- (k - s1 - H) mod q
 	zzSubMod(s1, k, s1, ec->order, n);
 	wwFrom(k, hash, no);
@@ -1599,10 +4972,58 @@ err_t bignIdSign(octet id_sig[], const bign_params* params,
 	// выгрузить s1
 	wwTo(id_sig + no / 2, no, s1);
 	// все нормально
-	blobClose(state);
 	return ERR_OK;
 }
 
+err_t bignIdSign(octet id_sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignIdSign_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = bignIdSignEc(id_sig, prep->ec, prep->pre, oid_der, oid_len,
+		id_hash, hash, id_privkey, rng, rng_state, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxIdSign(octet id_sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignIdSignEc(id_sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der,
+		oid_len, id_hash, hash, id_privkey, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 static size_t bignIdSign2_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -1611,46 +5032,30 @@ static size_t bignIdSign2_deep(size_t n, size_t f_deep, size_t ec_d,
 			beltHash_keep(),
 			32,
 			beltWBL_keep(),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			bignMulBase_deep(n, ec_d, ec_deep),
 			zzMul_deep(n / 2, n),
-			zzMod_deep(n + n / 2 + 1, n));
+			ecModOrder_deep(n));
 }
 
-err_t bignIdSign2(octet id_sig[], const bign_params* params, 
-	const octet oid_der[], size_t oid_len, const octet id_hash[], 
-	const octet hash[], const octet id_privkey[], const void* t, size_t t_len)
+static err_t bignIdSign2Ec(octet id_sig[], const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], const void* t, size_t t_len,
+	void* stack)
 {
-	err_t code;
 	size_t no, n;
 	// состояние (буферы могут пересекаться)
-	void* state;
-	ec_o* ec;				/* описание эллиптической кривой */
 	word* e;				/* [n] личный ключ */
 	word* k;				/* [n] одноразовый личный ключ */
 	word* V;				/* [2n] точка V */
 	word* s0;				/* [n/2] первая часть подписи */
 	word* s1;				/* [n] вторая часть подписи */
 	octet* hash_state;		/* [beltHash_keep] состояние хэширования */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
 	// проверить t
 	if (!memIsNullOrValid(t, t_len))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignIdSign2_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
@@ -1660,12 +5065,9 @@ err_t bignIdSign2(octet id_sig[], const bign_params* params,
 		!memIsValid(hash, no) ||
 		!memIsValid(id_privkey, no) ||
 		!memIsValid(id_sig, no + no / 2))
-	{
-		blobClose(state);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	e = s1 = objEnd(ec, word);
+	// раскладка стека
+	e = s1 = (word*)stack;
 	k = e + n;
 	V = k + n;
 	s0 = V + n + n / 2;
@@ -1674,10 +5076,7 @@ err_t bignIdSign2(octet id_sig[], const bign_params* params,
 	// загрузить e
 	wwFrom(e, id_privkey, no);
 	if (wwCmp(e, ec->order, n) >= 0)
-	{
-		blobClose(state);
 		return ERR_BAD_PRIVKEY;
-	}
 	// хэшировать oid
 	beltHashStart(hash_state);
 	beltHashStepH(oid_der, oid_len, hash_state);
@@ -1704,11 +5103,8 @@ err_t bignIdSign2(octet id_sig[], const bign_params* params,
 		}
 	}
 	// V <- k G
-	if (!ecMulA(V, ec->base, ec, k, n, stack))
-	{
-		blobClose(state);
+	if (!bignMulBase(V, ec, pre, k, stack))
 		return ERR_BAD_PARAMS;
-	}
 	qrTo((octet*)V, ecX(V), ec->f, stack);
 	// s0 <- belt-hash(oid || V || H0 || H) mod 2^l
 	beltHashStepH(V, no, hash_state);
@@ -1720,7 +5116,7 @@ err_t bignIdSign2(octet id_sig[], const bign_params* params,
 	zzMul(V, s0, n / 2, e, n, stack);
 	V[n + n / 2] = zzAdd(V + n / 2, V + n / 2, e, n);
 	// s1 <- V mod q
-	zzMod(s1, V, n + n / 2 + 1, ec->order, n, stack);
+	ecModOrder(s1, V, n + n / 2 + 1, ec, stack);
 	// s1 <- (k - s1 - H) mod q
 	zzSubMod(s1, k, s1, ec->order, n);
 	wwFrom(k, hash, no);
@@ -1728,10 +5124,58 @@ err_t bignIdSign2(octet id_sig[], const bign_params* params,
 	// выгрузить s1
 	wwTo(id_sig + no / 2, no, s1);
 	// все нормально
-	blobClose(state);
 	return ERR_OK;
 }
 
+err_t bignIdSign2(octet id_sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], const void* t, size_t t_len)
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// проверить t
+	if (!memIsNullOrValid(t, t_len))
+		return ERR_BAD_INPUT;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignIdSign2_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = bignIdSign2Ec(id_sig, prep->ec, prep->pre, oid_der, oid_len,
+		id_hash, hash, id_privkey, t, t_len, prep->stack);
+	// завершение
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxIdSign2(octet id_sig[], const void* ctx,
+	const octet oid_der[], size_t oid_len, const octet id_hash[],
+	const octet hash[], const octet id_privkey[], const void* t, size_t t_len)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdSign2_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = bignIdSign2Ec(id_sig, bignCtxEc(ctx), bignCtxPre(ctx), oid_der,
+		oid_len, id_hash, hash, id_privkey, t, t_len, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Проверка идентификационной ЭЦП
@@ -1742,66 +5186,49 @@ static size_t bignIdVerify_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(7 * n + 2) + beltHash_keep() +
-		utilMax(5,
+		utilMax(6,
 			beltHash_keep(),
 			ecpIsOnA_deep(n, f_deep),
 			zzMul_deep(n / 2, n / 2),
-			zzMod_deep(n + 1, n),
-			ecAddMulA_deep(n, ec_d, ec_deep, 3, n, n / 2 + 1, n));
+			ecModOrder_deep(n),
+			ecAddMulA_deep(n, ec_d, ec_deep, 3, n, n / 2 + 1, n),
+			ecComb2AddMulA_deep(n, ec_d, ec_deep, BIGN_COMB_W, n / 2 + 1));
 }
 
-err_t bignIdVerify(const bign_params* params, const octet oid_der[], 
-	size_t oid_len, const octet id_hash[], const octet hash[], 
-	const octet id_sig[], const octet id_pubkey[], const octet pubkey[])
+static err_t bignIdVerifyEc(const ec_o* ec, const word pre[],
+	const octet oid_der[], size_t oid_len, const octet id_hash[], 
+	const octet hash[], const octet id_sig[], const octet id_pubkey[], 
+	const octet pubkey[], const word Qv[], const word Qpre[], void* stack)
 {
-	err_t code;
 	size_t no, n;
 	// состояние (буферы R и V совпадают)
-	void* state;
-	ec_o* ec;			/* описание эллиптической кривой */	
 	word* R;			/* [2n] открытый ключ R */
-	word* Q;			/* [2n] открытый ключ Q */
+	const word* Q;		/* [2n] открытый ключ Q */
 	word* V;			/* [2n] точка V (V == R) */
 	word* s0;			/* [n / 2 + 1] первая часть подписи */
 	word* s1;			/* [n] вторая часть подписи */
 	word* t;			/* [n / 2] переменная t */
 	word* t1;			/* [n + 1] произведение (s0 + 2^l)(t + 2^l) */
 	octet* hash_state;	/* [beltHash_keep] состояние хэширования */
-	octet* stack;
-	// проверить params
-	if (!memIsValid(params, sizeof(bign_params)))
-		return ERR_BAD_INPUT;
-	if (params->l != 128 && params->l != 192 && params->l != 256)
-		return ERR_BAD_PARAMS;
 	// проверить oid_der
 	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
 		return ERR_BAD_OID;
-	// создать состояние
-	state = blobCreate(bignStart_keep(params->l, bignIdVerify_deep));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// старт
-	code = bignStart(state, params);
-	ERR_CALL_HANDLE(code, blobClose(state));
-	ec = (ec_o*)state;
 	// размерности
 	no  = ec->f->no;
 	n = ec->f->n;
 	ASSERT(n % 2 == 0);
 	// проверить входные указатели
+	ASSERT((pubkey == 0) != (Qv == 0));
+	ASSERT(Qpre == 0 || Qv != 0 && pre != 0);
 	if (!memIsValid(id_hash, no) ||
 		!memIsValid(hash, no) ||
 		!memIsValid(id_sig, no + no / 2) ||
 		!memIsValid(id_pubkey, 2 * no) ||
-		!memIsValid(pubkey, 2 * no))
-	{
-		blobClose(state);
+		!memIsNullOrValid(pubkey, 2 * no))
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	R = V = objEnd(ec, word);
-	Q = R + 2 * n;
-	s0 = Q + 2 * n;
+	// раскладка стека
+	R = V = (word*)stack;
+	s0 = R + 4 * n;
 	s1 = s0 + n / 2 + 1;
 	t = s1 + n;
 	t1 = t + n / 2;
@@ -1811,24 +5238,22 @@ err_t bignIdVerify(const bign_params* params, const octet oid_der[],
 	if (!qrFrom(ecX(R), id_pubkey, ec->f, stack) ||
 		!qrFrom(ecY(R, n), id_pubkey + no, ec->f, stack) ||
 		!ecpIsOnA(R, ec, stack))
-	{
-		blobClose(state);
 		return ERR_BAD_PUBKEY;
-	}
-	// загрузить Q
-	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
-		!qrFrom(ecY(Q, n), pubkey + no, ec->f, stack))
+	// загрузить Q (проверенная точка Qv используется на месте)
+	if (pubkey)
 	{
-		blobClose(state);
-		return ERR_BAD_PUBKEY;
+		word* Ql = R + 2 * n;
+		if (!qrFrom(ecX(Ql), pubkey, ec->f, stack) ||
+			!qrFrom(ecY(Ql, n), pubkey + no, ec->f, stack))
+			return ERR_BAD_PUBKEY;
+		Q = Ql;
 	}
+	else
+		Q = Qv;
 	// загрузить и проверить s1
 	wwFrom(s1, id_sig + no / 2, no);
 	if (wwCmp(s1, ec->order, n) >= 0)
-	{
-		blobClose(state);
 		return ERR_BAD_SIG;
-	}
 	// s1 <- (s1 + H) mod q
 	wwFrom(t, hash, no);
 	if (wwCmp(t, ec->order, n) >= 0)
@@ -1855,22 +5280,122 @@ err_t bignIdVerify(const bign_params* params, const octet oid_der[],
 	t1[n] = zzAdd2(t1 + n / 2, t, n / 2);
 	t1[n] += zzAdd2(t1 + n / 2, s0, n / 2);
 	++t1[n];
-	zzMod(t1, t1, n + 1, ec->order, n, stack);
+	ecModOrder(t1, t1, n + 1, ec, stack);
 	zzNegMod(t1, t1, ec->order, n);
-	// V <- s1 G + (s0 + 2^l) R + t Q
-	if (!ecAddMulA(V, ec, stack,
-		3, ec->base, s1, n, R, s0, n / 2 + 1, Q, t1, n))
+	// V <- s1 G + (s0 + 2^l) R + t Q (G и Q -- по гребням, если есть таблицы)
+	if (Qpre)
 	{
-		blobClose(state);
-		return ERR_BAD_SIG;
+		if (!ecComb2AddMulA(V, ec, BIGN_COMB_W, pre, s1, n, Qpre, t1, n,
+			R, s0, n / 2 + 1, stack))
+			return ERR_BAD_SIG;
 	}
+	else if (!ecAddMulA(V, ec, stack,
+		3, ec->base, s1, n, R, s0, n / 2 + 1, Q, t1, n))
+		return ERR_BAD_SIG;
 	qrTo((octet*)V, ecX(V), ec->f, stack);
 	// s0 == belt-hash(oid || V || H0 || H) mod 2^l?
 	beltHashStepH(V, no, hash_state);
 	beltHashStepH(id_hash, no, hash_state);
 	beltHashStepH(hash, no, hash_state);
-	code = beltHashStepV2(id_sig, no / 2, hash_state) ? ERR_OK : ERR_BAD_SIG;
+	return beltHashStepV2(id_sig, no / 2, hash_state) ? ERR_OK : ERR_BAD_SIG;
+}
+
+err_t bignIdVerify(const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet id_hash[], const octet hash[],
+	const octet id_sig[], const octet id_pubkey[], const octet pubkey[])
+{
+	err_t code;
+	bign_prep_st prep[1];
+	// проверить params
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	// проверить oid_der
+	if (oid_len == SIZE_MAX || oidFromDER(0, oid_der, oid_len)  == SIZE_MAX)
+		return ERR_BAD_OID;
+	// подготовить описание кривой
+	code = bignPrepStart(prep, params, bignIdVerify_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подпись
+	code = bignIdVerifyEc(prep->ec, prep->pre, oid_der, oid_len, id_hash,
+		hash, id_sig, id_pubkey, pubkey, 0, 0, prep->stack);
 	// завершение
-	blobClose(state);
+	bignPrepStop(prep);
+	return code;
+}
+
+err_t bignCtxIdVerify(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet id_hash[], const octet hash[],
+	const octet id_sig[], const octet id_pubkey[], const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = bignIdVerifyEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		id_hash, hash, id_sig, id_pubkey, pubkey, 0, 0, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+err_t bignCtxIdVerifyPk(const void* ctx, const octet oid_der[],
+	size_t oid_len, const octet id_hash[], const octet hash[],
+	const octet id_sig[], const octet id_pubkey[], const void* pk)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx и pk
+	if (!bignCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	code = bignPubkeyCheck(pk, ctx);
+	ERR_CALL_CHECK(code);
+	// создать стек
+	stack = bignCtxStackCreate(ctx, bignIdVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = bignIdVerifyEc(bignCtxEc(ctx), bignCtxPre(ctx), oid_der, oid_len,
+		id_hash, hash, id_sig, id_pubkey, 0, bignPubkeyQ(pk),
+		bignPubkeyPre(pk), stack);
+	// завершение
+	blobClose(stack);
 	return code;
 }
+
+/*
+*******************************************************************************
+Рабочая память
+
+Функции bignCtxXXXW() используют стек, предоставленный вызывающей 
+программой. Его длина bignCtxStack_keep() -- максимум из потребностей 
+функций.
+*******************************************************************************
+*/
+
+size_t bignCtxStack_keep(size_t l)
+{
+	// размерности
+	size_t no = O_OF_B(2 * l);
+	size_t n = W_OF_B(2 * l);
+	size_t f_deep = gfpCreate_deep(no);
+	size_t ec_d = 3;
+	size_t ec_deep = ecpCreateJ_deep(n, f_deep);
+	// расчет
+	return utilMax(8,
+		bignValPubkey_deep(n, f_deep, ec_d, ec_deep),
+		bignCalcPubkey_deep(n, f_deep, ec_d, ec_deep),
+		bignDH_deep(n, f_deep, ec_d, ec_deep),
+		bignSign_deep(n, f_deep, ec_d, ec_deep),
+		bignSign2_deep(n, f_deep, ec_d, ec_deep),
+		bignVerify_deep(n, f_deep, ec_d, ec_deep),
+		bignKeyWrap_deep(n, f_deep, ec_d, ec_deep),
+		bignKeyUnwrap_deep(n, f_deep, ec_d, ec_deep));
+}
@@ -0,0 +1,222 @@
+/*
+*******************************************************************************
+\file bign_env.c
+\brief STB 34.101.45 (bign): envelopes
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/blob.h"
+#include "bee2/core/err.h"
+#include "bee2/core/mem.h"
+#include "bee2/core/u32.h"
+#include "bee2/core/u64.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/belt.h"
+#include "bee2/crypto/bign.h"
+
+/*
+*******************************************************************************
+Состояние
+
+Ключ key, транспортируемый в заголовке конверта, сразу расширяется
+функцией beltKeyStart(). Объект ключа размещается в конце состояния
+и используется функциями beltCHEStartK() только для чтения.
+*******************************************************************************
+*/
+
+#define BIGN_ENV_CHUNK_MAX ((size_t)1 << 30)
+
+typedef struct
+{
+	octet hdr[16];			/*< описание конверта */
+	size_t chunk;			/*< длина фрагмента */
+	octet key[];			/*< объект ключа */
+} bign_env_st;
+
+size_t bignEnv_keep()
+{
+	return sizeof(bign_env_st) + beltKey_keep();
+}
+
+size_t bignEnvChunk(const void* state)
+{
+	const bign_env_st* s = (const bign_env_st*)state;
+	ASSERT(memIsValid(s, bignEnv_keep()));
+	return s->chunk;
+}
+
+/*
+*******************************************************************************
+Заголовок
+*******************************************************************************
+*/
+
+static void bignEnvHdrSet(octet hdr[16], size_t chunk)
+{
+	u32 t = (u32)chunk;
+	ASSERT(0 < chunk && chunk <= BIGN_ENV_CHUNK_MAX);
+	memCopy(hdr, "benv", 4);
+	u32To(hdr + 4, 4, &t);
+	memSetZero(hdr + 8, 8);
+}
+
+static bool_t bignEnvHdrGet(size_t* chunk, const octet hdr[16])
+{
+	u32 t;
+	if (!memEq(hdr, "benv", 4) || !memIsZero(hdr + 8, 8))
+		return FALSE;
+	u32From(&t, hdr + 4, 4);
+	if (t == 0 || t > BIGN_ENV_CHUNK_MAX)
+		return FALSE;
+	*chunk = (size_t)t;
+	return TRUE;
+}
+
+err_t bignEnvWrapStart(octet head[], void* state, const bign_params* params,
+	size_t chunk, const octet pubkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	bign_env_st* s = (bign_env_st*)state;
+	octet key[32];
+	// проверить входные данные
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	if (chunk == 0 || chunk > BIGN_ENV_CHUNK_MAX ||
+		!memIsValid(head, params->l / 4 + 64) ||
+		!memIsValid(s, bignEnv_keep()) ||
+		!memIsDisjoint2(head, params->l / 4 + 64, s, bignEnv_keep()))
+		return ERR_BAD_INPUT;
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// сгенерировать ключ и упаковать его в токен
+	bignEnvHdrSet(head, chunk);
+	rng(key, 32, rng_state);
+	code = bignKeyWrap(head + 16, params, key, 32, head, pubkey, rng,
+		rng_state);
+	if (code == ERR_OK)
+	{
+		// подготовить состояние
+		memCopy(s->hdr, head, 16);
+		s->chunk = chunk;
+		beltKeyStart(s->key, key, 32);
+	}
+	memWipe(key, sizeof(key));
+	return code;
+}
+
+err_t bignEnvUnwrapStart(void* state, const bign_params* params,
+	const octet head[], const octet privkey[])
+{
+	err_t code;
+	bign_env_st* s = (bign_env_st*)state;
+	size_t chunk;
+	octet key[32];
+	// проверить входные данные
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(head, params->l / 4 + 64) ||
+		!memIsValid(s, bignEnv_keep()))
+		return ERR_BAD_INPUT;
+	// разобрать описание
+	if (!bignEnvHdrGet(&chunk, head))
+		return ERR_BAD_FORMAT;
+	// разобрать токен
+	code = bignKeyUnwrap(key, params, head + 16, params->l / 4 + 48, head,
+		privkey);
+	if (code == ERR_OK)
+	{
+		// подготовить состояние
+		memCopy(s->hdr, head, 16);
+		s->chunk = chunk;
+		beltKeyStart(s->key, key, 32);
+	}
+	memWipe(key, sizeof(key));
+	return code;
+}
+
+/*
+*******************************************************************************
+Фрагменты
+*******************************************************************************
+*/
+
+static void bignEnvIV(octet iv[16], size_t index, bool_t last)
+{
+	u64 t = (u64)index;
+	u64To(iv, 8, &t);
+	iv[8] = last ? 1 : 0;
+	memSetZero(iv + 9, 7);
+}
+
+err_t bignEnvChunkWrap(octet dest[], const void* src, size_t count,
+	size_t index, bool_t last, const void* state)
+{
+	const bign_env_st* s = (const bign_env_st*)state;
+	octet iv[16];
+	void* che;
+	// проверить входные данные
+	if (!memIsValid(s, bignEnv_keep()) ||
+		(last ? count >= s->chunk : count != s->chunk) ||
+		!memIsValid(src, count) ||
+		!memIsValid(dest, count + 8) ||
+		!memIsSameOrDisjoint(src, dest, count))
+		return ERR_BAD_INPUT;
+	// создать состояние CHE
+	che = blobCreate(beltCHE_keep());
+	if (che == 0)
+		return ERR_OUTOFMEMORY;
+	// защитить фрагмент
+	bignEnvIV(iv, index, last);
+	beltCHEStartK(che, s->key, iv);
+	beltCHEStepI(s->hdr, 16, che);
+	memMove(dest, src, count);
+	beltCHEStepEA(dest, count, che);
+	beltCHEStepG(dest + count, che);
+	// завершить
+	blobClose(che);
+	return ERR_OK;
+}
+
+err_t bignEnvChunkUnwrap(void* dest, const octet src[], size_t count,
+	size_t index, bool_t last, const void* state)
+{
+	const bign_env_st* s = (const bign_env_st*)state;
+	octet iv[16];
+	void* che;
+	// проверить входные данные
+	if (!memIsValid(s, bignEnv_keep()) ||
+		(last ? count >= s->chunk : count != s->chunk) ||
+		!memIsValid(src, count + 8) ||
+		!memIsValid(dest, count) ||
+		!memIsSameOrDisjoint(src, dest, count))
+		return ERR_BAD_INPUT;
+	// создать состояние CHE
+	che = blobCreate(beltCHE_keep());
+	if (che == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить имитовставку
+	bignEnvIV(iv, index, last);
+	beltCHEStartK(che, s->key, iv);
+	beltCHEStepI(s->hdr, 16, che);
+	beltCHEStepA(src, count, che);
+	if (!beltCHEStepV(src + count, che))
+	{
+		blobClose(che);
+		return ERR_BAD_MAC;
+	}
+	// расшифровать фрагмент
+	memMove(dest, src, count);
+	beltCHEStepD(dest, count, che);
+	// завершить
+	blobClose(che);
+	return ERR_OK;
+}
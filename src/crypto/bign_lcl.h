@@ -4,7 +4,7 @@
 \brief STB 34.101.45 (bign): local definitions
 \project bee2 [cryptographic library]
 \created 2014.04.03
-\version 2016.07.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -77,6 +77,48 @@ err_t bignStart(
 	const bign_params* params	/*!< [in] долговременные параметры */
 );
 
+/*!	\brief Полная проверка долговременных параметров
+
+	Проверяется корректность долговременных параметров params по алгоритму 
+	6.1.4 без распознавания стандартных параметров и без обращения к кэшу 
+	проверенных параметров (см. bignValParams()).
+	\return ERR_OK, если параметры корректны, и код ошибки
+	в противном случае.
+*/
+err_t bignValParamsFull(
+	const bign_params* params	/*!< [in] долговременные параметры */
+);
+
+/*!	\brief Готовая таблица предвычислений
+
+	Возвращается таблица гребенчатого метода (ширина 6) для базовой точки
+	стандартной кривой уровня стойкости l. Координаты точек таблицы
+	представлены так, как это делает редукция ZM_RED_CRAND.
+	\return Указатель на таблицу или 0, если таблицы нет (нестандартный
+	уровень или порядок октетов big-endian).
+	\remark Таблица размещается в памяти только для чтения и может
+	использоваться в контекстах без копирования.
+*/
+const word* bignStdPre(
+	size_t l				/*!< [in] уровень стойкости */
+);
+
+/*!	\brief Программные реализации
+
+	Функции bignXXXSoft() -- это программные реализации высокоуровневых
+	функций bignXXX(), которые перехватываются движками (см. eng.h).
+	Функции используются как запасной путь, если перехватчик отсутствует
+	или отказывается от обработки, и как перехватчики эталонного движка.
+*/
+err_t bignSignSoft(octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state);
+err_t bignVerifySoft(const bign_params* params, const octet oid_der[],
+	size_t oid_len, const octet hash[], const octet sig[],
+	const octet pubkey[]);
+err_t bignDHSoft(octet key[], const bign_params* params,
+	const octet privkey[], const octet pubkey[], size_t key_len);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -0,0 +1,1242 @@
+/*
+*******************************************************************************
+\file bign_pre.c
+\brief STB 34.101.45 (bign): precomputed tables for standard curves
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/util.h"
+#include "crypto/bign_lcl.h"
+
+/*
+*******************************************************************************
+Таблицы предвычислений
+
+Таблицы гребенчатого метода (ширина 6, 32 аффинные точки) для базовых 
+точек стандартных кривых bign-curve256v1, bign-curve384v1, 
+bign-curve512v1. Координаты точек -- элементы поля в представлении 
+редукции Крэндалла, т.е. обычные числа (little-endian). Поэтому таблицы 
+не зависят от длины машинного слова, но могут использоваться только при 
+OCTET_ORDER == LITTLE_ENDIAN.
+
+Таблицы построены функцией ecCombPrecA() над полем с редукцией 
+ZM_RED_CRAND и кривой в якобиановых координатах (ecpCreateJ()). Тест 
+bignTest() (функция bignTestStdPreTable() в test/crypto/bign_test.c) 
+строит таблицы заново тем же способом и побайтово сравнивает их 
+с готовыми. При изменении формата таблиц ecCombPrecA() готовые таблицы 
+следует пересобрать по этой функции. Выравнивание по границе слова 
+обеспечивается объединением с массивом слов.
+
+В профиле с низким потреблением памяти (директива LEAN_ENABLED) таблицы
+не компилируются: в этом профиле используется другая ширина гребня.
+*******************************************************************************
+*/
+
+#if (OCTET_ORDER == LITTLE_ENDIAN) && !defined(LEAN_ENABLED)
+
+// bign-curve256v1
+static const union
+{
+	octet o[2048];
+	word w[1];
+} _curve128v1_pre =
+{{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x93, 0x6A, 0x51, 0x04, 0x18, 0xCF, 0x29, 0x1E,
+	0x52, 0xF6, 0x08, 0xC4, 0x66, 0x39, 0x91, 0x78,
+	0x5D, 0x83, 0xD6, 0x51, 0xA3, 0xC9, 0xE4, 0x5C,
+	0x9F, 0xD6, 0x16, 0xFB, 0x3C, 0xFC, 0xF7, 0x6B,
+	0x83, 0x13, 0x74, 0x3E, 0x37, 0x3D, 0x93, 0xEE,
+	0x49, 0x4C, 0xCA, 0xD2, 0x04, 0xDD, 0x8A, 0x92,
+	0xEC, 0x26, 0x10, 0x1C, 0x77, 0x03, 0x23, 0x92,
+	0x14, 0xD8, 0x10, 0x91, 0xAB, 0x17, 0x9D, 0xF2,
+	0x5C, 0xCB, 0xAE, 0x50, 0x1D, 0xD5, 0xD3, 0x65,
+	0xF9, 0x7E, 0x6B, 0x06, 0x5B, 0x93, 0x4B, 0xF9,
+	0xB3, 0xED, 0xAD, 0x0B, 0x2F, 0x17, 0xF3, 0xDB,
+	0x4F, 0xA8, 0x01, 0x8A, 0x2B, 0xD9, 0xA9, 0xEA,
+	0xCB, 0x9A, 0xDF, 0x65, 0x4B, 0xAB, 0xC9, 0x18,
+	0xFF, 0x8F, 0x28, 0x52, 0xD9, 0x30, 0x61, 0x68,
+	0x4F, 0xAF, 0xD6, 0x2C, 0x33, 0x30, 0x05, 0xC5,
+	0x66, 0x03, 0xFD, 0x09, 0x1F, 0xC8, 0x01, 0x3C,
+	0x27, 0xB0, 0xC7, 0x60, 0x5C, 0x23, 0x40, 0xA3,
+	0x73, 0xC8, 0x57, 0xF4, 0x00, 0x56, 0x56, 0xD8,
+	0xD6, 0x52, 0xF9, 0x2B, 0xC0, 0xF9, 0x78, 0x72,
+	0x53, 0x4D, 0xA5, 0x7F, 0x22, 0x17, 0xE0, 0x00,
+	0x12, 0x25, 0xB4, 0x6D, 0xE4, 0xD6, 0x45, 0x99,
+	0x7C, 0xC1, 0x5A, 0xC0, 0xCB, 0xB9, 0x57, 0x0F,
+	0x5A, 0x9E, 0x4F, 0xE8, 0xFB, 0xCD, 0x45, 0x49,
+	0xC8, 0xF9, 0x85, 0x1C, 0xB1, 0xDB, 0x2E, 0xB3,
+	0xFC, 0xBF, 0xA3, 0xD3, 0x24, 0x31, 0xC6, 0x05,
+	0xFD, 0xD8, 0x3F, 0x1D, 0xCC, 0x8D, 0x66, 0x17,
+	0xE6, 0xC5, 0xFB, 0xFC, 0xB5, 0x9A, 0xBA, 0xCA,
+	0x80, 0x24, 0xE0, 0x55, 0x4E, 0x99, 0x78, 0x93,
+	0x74, 0x3D, 0x71, 0x4F, 0x20, 0x6E, 0x3A, 0x78,
+	0x8A, 0x7E, 0xFF, 0x9A, 0x74, 0xF5, 0x40, 0xCB,
+	0x78, 0x3E, 0x5E, 0xD2, 0xA7, 0xAB, 0x40, 0xB7,
+	0x4F, 0xC9, 0x5E, 0xF0, 0xDC, 0x40, 0x5E, 0x8A,
+	0x42, 0x97, 0x17, 0x6B, 0xF5, 0xBF, 0xBA, 0x60,
+	0x3F, 0xAD, 0x4E, 0x1B, 0xC4, 0xE7, 0xE0, 0xF0,
+	0xFC, 0xCA, 0x3C, 0x60, 0x90, 0x38, 0xD3, 0x65,
+	0x44, 0x28, 0xD0, 0xCA, 0xB1, 0xDA, 0x9A, 0xED,
+	0x9C, 0x19, 0x2B, 0x04, 0xF2, 0xF1, 0xB0, 0x13,
+	0x16, 0x7A, 0x83, 0x48, 0x21, 0xF9, 0xA6, 0x82,
+	0x41, 0x91, 0x5E, 0x76, 0x00, 0xA4, 0xD6, 0xEC,
+	0x59, 0xD0, 0xD2, 0xD2, 0xA4, 0xF3, 0x10, 0xBB,
+	0xB8, 0x66, 0x56, 0xE8, 0xB1, 0x02, 0xF3, 0xF8,
+	0xB8, 0x02, 0xA1, 0xFD, 0x30, 0x6D, 0x78, 0xB4,
+	0xFD, 0x8F, 0x51, 0xBA, 0x7E, 0x00, 0x0D, 0xB3,
+	0x19, 0x27, 0xF3, 0x6F, 0x9F, 0xD8, 0x73, 0x69,
+	0x64, 0x1C, 0xD4, 0x8C, 0xB5, 0xC5, 0xA8, 0x9D,
+	0x67, 0xC8, 0x38, 0x8D, 0xFD, 0xD2, 0x29, 0xDE,
+	0x04, 0x82, 0xB9, 0x79, 0xE8, 0x16, 0x6B, 0x02,
+	0x7A, 0xFE, 0x44, 0x7B, 0xE6, 0x2B, 0x18, 0x25,
+	0x68, 0x4C, 0x0C, 0x98, 0x7A, 0xAE, 0x77, 0x94,
+	0x34, 0x91, 0xB1, 0xB7, 0x58, 0x44, 0x02, 0xE4,
+	0xF2, 0xDC, 0xCE, 0xF1, 0xB1, 0x80, 0xBC, 0xBC,
+	0x05, 0x60, 0x6A, 0xFB, 0x0D, 0x61, 0xD7, 0x4D,
+	0x6D, 0xEF, 0x36, 0x3F, 0xE4, 0xCD, 0x30, 0xC9,
+	0x67, 0xF2, 0x03, 0x82, 0x4A, 0xBD, 0xEF, 0x49,
+	0x01, 0x70, 0x9E, 0x67, 0x3A, 0x07, 0x6E, 0x60,
+	0x3D, 0xFF, 0x4B, 0xCB, 0xD5, 0xAB, 0xAA, 0x8E,
+	0x7F, 0x56, 0xA9, 0x35, 0xD9, 0x2E, 0x1D, 0x5E,
+	0x52, 0xB4, 0x4C, 0xBE, 0x8D, 0x27, 0xAC, 0x3A,
+	0x49, 0xDC, 0x35, 0xF9, 0x1B, 0x93, 0x25, 0x1F,
+	0x95, 0x01, 0x3B, 0xE5, 0xAE, 0x9A, 0x4D, 0x89,
+	0x29, 0x5D, 0x17, 0xC8, 0x6D, 0xF8, 0xA2, 0x24,
+	0x5C, 0x81, 0xB9, 0x76, 0x84, 0xA0, 0x4E, 0x8D,
+	0xCF, 0x4B, 0xED, 0xBB, 0x04, 0x84, 0xB2, 0xD2,
+	0x1E, 0x3E, 0x4C, 0xA5, 0x2E, 0x3B, 0xA1, 0x7B,
+	0x71, 0x0B, 0xA3, 0x88, 0x59, 0xBA, 0xB2, 0xDA,
+	0xED, 0x65, 0xCB, 0x3B, 0x3D, 0x3E, 0x72, 0xE5,
+	0x7E, 0x6A, 0xFF, 0xFB, 0x1D, 0x7C, 0xEB, 0xB5,
+	0x4A, 0xDC, 0x49, 0xCE, 0x18, 0x8A, 0xFB, 0xFB,
+	0x1F, 0xDE, 0xA2, 0x91, 0x6F, 0x62, 0xE5, 0x9A,
+	0x61, 0x86, 0xD0, 0xDE, 0xA3, 0x92, 0x8B, 0xFE,
+	0xD9, 0xAD, 0x00, 0xF1, 0xA7, 0xEE, 0xF7, 0x61,
+	0x5B, 0x7F, 0x3D, 0x61, 0xA2, 0x28, 0x64, 0x97,
+	0x92, 0x84, 0x9E, 0x0A, 0xDE, 0x78, 0xC4, 0x33,
+	0x8B, 0x05, 0x46, 0xA9, 0x80, 0x94, 0xB9, 0xF4,
+	0x44, 0xFC, 0x47, 0x20, 0x36, 0xB3, 0xDF, 0x86,
+	0x60, 0x14, 0x65, 0x8A, 0xBD, 0x3F, 0x9A, 0x8B,
+	0xCB, 0x48, 0x2C, 0xE8, 0x96, 0x21, 0x5E, 0xC4,
+	0xAF, 0xAB, 0x91, 0x5E, 0xEC, 0x28, 0xE7, 0x97,
+	0x2D, 0x3A, 0xCB, 0x40, 0xED, 0x45, 0x5E, 0x3D,
+	0x0C, 0xD9, 0xD9, 0x66, 0x7C, 0x56, 0x24, 0xAD,
+	0xB0, 0x66, 0x83, 0x9C, 0xDC, 0xBE, 0x51, 0x85,
+	0xE3, 0xC6, 0xDE, 0xE9, 0xA8, 0xE4, 0xF3, 0x7F,
+	0x75, 0x3D, 0xE9, 0xE2, 0x79, 0xD5, 0x68, 0xBF,
+	0xF4, 0xCA, 0xE4, 0x49, 0x8F, 0x10, 0x12, 0xDE,
+	0x87, 0x43, 0x96, 0xEA, 0x22, 0x74, 0x30, 0xFB,
+	0xAF, 0xF0, 0xBA, 0x0C, 0xF7, 0x7A, 0xC1, 0xBC,
+	0xA3, 0xD4, 0x9F, 0xA6, 0xFA, 0x25, 0xDC, 0x5F,
+	0xFA, 0xD5, 0xC5, 0x79, 0xD6, 0x0A, 0x87, 0x0C,
+	0x3F, 0x2F, 0x63, 0x75, 0x2E, 0x86, 0xEC, 0x7B,
+	0xA7, 0xF8, 0xDF, 0x62, 0xA5, 0x58, 0x36, 0xD4,
+	0xBF, 0x5E, 0xA6, 0x36, 0x5C, 0xEF, 0x6D, 0x5E,
+	0x43, 0x6D, 0x26, 0x50, 0xB6, 0xB2, 0xE2, 0xAC,
+	0x8B, 0x53, 0x21, 0x85, 0x8C, 0x81, 0xC5, 0xDA,
+	0x42, 0xE9, 0x28, 0x64, 0x02, 0x3D, 0x9A, 0x29,
+	0x71, 0x09, 0x73, 0x08, 0xF1, 0x40, 0xA5, 0x34,
+	0x2B, 0x85, 0xAB, 0x62, 0x42, 0x74, 0x7D, 0x53,
+	0xA5, 0x61, 0x3D, 0xA8, 0xF0, 0xF4, 0x01, 0x83,
+	0xD2, 0x5F, 0xDC, 0x4D, 0x07, 0x83, 0x3B, 0xE7,
+	0xBA, 0xA0, 0x7B, 0x04, 0x6D, 0x16, 0x5B, 0xD3,
+	0x3B, 0xCA, 0xB1, 0xC4, 0x38, 0xE8, 0x6A, 0xE6,
+	0x9C, 0x78, 0xB9, 0x2B, 0x6B, 0xE6, 0x2D, 0x53,
+	0x27, 0x5D, 0xD0, 0xEC, 0xB9, 0x21, 0xB1, 0x7F,
+	0x81, 0xF2, 0x28, 0xBB, 0xDF, 0x1C, 0xE8, 0x0F,
+	0x8F, 0xDB, 0xDA, 0x29, 0x33, 0x6E, 0x78, 0xC8,
+	0xCD, 0x87, 0x02, 0xEB, 0xCE, 0xF0, 0xBF, 0xC4,
+	0x64, 0x09, 0xC1, 0xA4, 0x95, 0x8F, 0xD5, 0xB2,
+	0x42, 0x3E, 0x12, 0x07, 0xFD, 0x4C, 0xD4, 0x60,
+	0xEF, 0xCD, 0xB4, 0x5C, 0x79, 0x1B, 0x2B, 0x6A,
+	0x3E, 0x41, 0x7E, 0x30, 0xEF, 0x0A, 0xEB, 0x72,
+	0xA1, 0x74, 0x36, 0x5F, 0x2A, 0xC7, 0xE7, 0x29,
+	0xC5, 0x21, 0x36, 0x58, 0xA6, 0x2D, 0x74, 0x22,
+	0xE3, 0x4E, 0x5A, 0x01, 0x1B, 0xD2, 0xE4, 0x19,
+	0x68, 0x1A, 0xF6, 0x1B, 0x4F, 0xD9, 0xDD, 0xB5,
+	0x1F, 0x97, 0x89, 0x3F, 0xC3, 0xDE, 0x84, 0xB4,
+	0x52, 0x37, 0xA8, 0x5E, 0xCD, 0xA9, 0x4D, 0x38,
+	0x24, 0x3C, 0x74, 0xFA, 0x98, 0xAF, 0xDB, 0x4A,
+	0x75, 0xEC, 0xF0, 0xC2, 0x62, 0x37, 0x83, 0x1B,
+	0x13, 0xC9, 0x7B, 0x11, 0x08, 0xDA, 0x80, 0x9F,
+	0xE9, 0x5A, 0x9B, 0x66, 0x54, 0xE6, 0x2D, 0x91,
+	0x5E, 0x22, 0xC8, 0x05, 0x1A, 0x8A, 0x56, 0xB7,
+	0x20, 0x83, 0x47, 0x6C, 0x0A, 0x46, 0x11, 0x71,
+	0x9D, 0xFB, 0x92, 0x12, 0x8E, 0xF3, 0xE2, 0xE3,
+	0xE6, 0x11, 0xB3, 0xCA, 0x09, 0xDA, 0x7A, 0xF2,
+	0xC7, 0x36, 0x43, 0x8C, 0x84, 0xE1, 0x01, 0xD4,
+	0x14, 0x5C, 0xAE, 0xAF, 0x54, 0x2A, 0x09, 0x80,
+	0x65, 0x3F, 0x04, 0x0B, 0x7A, 0xEE, 0x4B, 0xF0,
+	0x5C, 0x54, 0xFD, 0xE6, 0xCE, 0xE8, 0x92, 0xF8,
+	0xE3, 0x97, 0x04, 0x30, 0x43, 0x7C, 0xDE, 0xE7,
+	0x63, 0x66, 0x96, 0x10, 0xE7, 0x02, 0x7F, 0xE7,
+	0xAC, 0xC8, 0xAB, 0xBE, 0x85, 0xBE, 0xE8, 0x8D,
+	0xF2, 0x8B, 0xE8, 0x6F, 0x97, 0x06, 0xB7, 0x02,
+	0x78, 0xD3, 0x2A, 0x28, 0x41, 0xC7, 0xFE, 0xCC,
+	0xED, 0x6B, 0x4C, 0x1F, 0x76, 0x2E, 0x9C, 0xE5,
+	0x09, 0x85, 0x32, 0x70, 0x47, 0xD3, 0x23, 0x20,
+	0xBE, 0x87, 0x77, 0x3B, 0x3F, 0xD9, 0x7C, 0xDD,
+	0xC2, 0x2C, 0xD5, 0x09, 0x71, 0x81, 0x37, 0x62,
+	0x46, 0x28, 0xBD, 0x33, 0xC1, 0xFC, 0x05, 0x32,
+	0x3D, 0xF2, 0xD0, 0x9F, 0x67, 0x9C, 0x4F, 0x26,
+	0xB1, 0x81, 0xDC, 0x21, 0x74, 0xA3, 0x61, 0x6A,
+	0xE3, 0x05, 0x7C, 0xD6, 0x2B, 0x2A, 0xC0, 0x57,
+	0x91, 0x18, 0x2C, 0x7F, 0x88, 0xA0, 0xC3, 0x3C,
+	0x0B, 0x22, 0x2E, 0x0B, 0xF0, 0x11, 0xEE, 0x18,
+	0x9C, 0x56, 0x88, 0x56, 0x0C, 0x44, 0x23, 0x67,
+	0xE1, 0x54, 0x1C, 0x96, 0x23, 0x09, 0x48, 0xD7,
+	0xB8, 0x8A, 0x99, 0x77, 0xC3, 0x11, 0xE9, 0x6C,
+	0xDE, 0x35, 0x7A, 0xA2, 0x70, 0x17, 0x3E, 0x22,
+	0x02, 0x51, 0xC5, 0x99, 0x62, 0x23, 0x02, 0x8B,
+	0x35, 0x7C, 0x23, 0x19, 0xA9, 0x16, 0xB7, 0x81,
+	0x7A, 0x35, 0x06, 0xA4, 0x13, 0x76, 0x79, 0x42,
+	0xC9, 0x49, 0x18, 0x1E, 0xD7, 0x13, 0x4C, 0xE5,
+	0xF1, 0x8E, 0x4A, 0x35, 0x46, 0xCF, 0x31, 0xBB,
+	0x75, 0xDF, 0x1C, 0xBF, 0x6A, 0x55, 0x53, 0x17,
+	0xE2, 0x6D, 0xC5, 0x4E, 0x69, 0x8F, 0x07, 0x0B,
+	0x9F, 0xDA, 0x56, 0x1D, 0x1F, 0xB7, 0x1D, 0xDE,
+	0x9C, 0x95, 0x13, 0x1B, 0xA4, 0x0D, 0xF8, 0x18,
+	0x95, 0x8F, 0xE1, 0x5F, 0x64, 0x0A, 0x80, 0xDF,
+	0xC7, 0xA5, 0xE6, 0x09, 0x42, 0xEF, 0xD3, 0xBE,
+	0x1C, 0x49, 0xC6, 0x37, 0xFF, 0x5C, 0xF5, 0xA8,
+	0xE7, 0x2F, 0xE7, 0x50, 0x53, 0x3F, 0x23, 0x3B,
+	0xCF, 0xAC, 0x45, 0x60, 0xFA, 0x4E, 0x72, 0x4E,
+	0xBF, 0xCA, 0xC1, 0xD9, 0xB8, 0x18, 0x85, 0x3F,
+	0x68, 0xD1, 0x9D, 0xD9, 0x97, 0x91, 0x4F, 0x01,
+	0x28, 0x4E, 0x20, 0xB6, 0x26, 0xBC, 0xA8, 0x44,
+	0xC2, 0x84, 0xB3, 0x6E, 0xFE, 0x2B, 0xD1, 0xDE,
+	0x89, 0xB8, 0x58, 0xEE, 0x9D, 0x1A, 0x68, 0x05,
+	0x7F, 0xAB, 0xA7, 0x94, 0x08, 0x32, 0xAC, 0xEE,
+	0xE3, 0x9D, 0xA4, 0x08, 0x9B, 0x03, 0x20, 0x5A,
+	0x58, 0xE9, 0x6A, 0x25, 0x07, 0x82, 0x26, 0x53,
+	0x31, 0x72, 0x88, 0x24, 0xDD, 0x53, 0x7D, 0xCD,
+	0x4E, 0x93, 0x51, 0xA5, 0xE4, 0x7B, 0xFB, 0x86,
+	0xFE, 0x03, 0x6A, 0xEE, 0xED, 0xC2, 0x67, 0xCF,
+	0x88, 0x39, 0xE6, 0xD0, 0xF3, 0x4D, 0x89, 0x52,
+	0x92, 0xEE, 0x80, 0x3E, 0xF4, 0xB5, 0xE4, 0xB8,
+	0xCC, 0xDA, 0x75, 0x41, 0x08, 0xE5, 0x90, 0xFE,
+	0xC5, 0xC0, 0x50, 0xB0, 0x54, 0xB6, 0x16, 0x7A,
+	0xDC, 0x36, 0xEF, 0x4A, 0xDF, 0x1B, 0x8E, 0xDA,
+	0xE4, 0xB0, 0x73, 0xFD, 0x1E, 0x19, 0xB1, 0x69,
+	0xAC, 0xE0, 0x8B, 0x0F, 0x05, 0x79, 0x13, 0x4D,
+	0xAD, 0x1D, 0x9E, 0xC0, 0x73, 0xC8, 0x69, 0x62,
+	0x29, 0x40, 0xBB, 0xD5, 0x7D, 0xB3, 0x1E, 0x4E,
+	0x4F, 0x83, 0x84, 0x94, 0x95, 0x69, 0x59, 0x36,
+	0x33, 0x19, 0x0A, 0x1E, 0x11, 0xC4, 0x1B, 0xF8,
+	0xCA, 0x4C, 0x82, 0x78, 0xCE, 0x7E, 0xD0, 0xA8,
+	0x8A, 0xC1, 0xEC, 0xF9, 0x0C, 0x6E, 0x7D, 0x56,
+	0x7E, 0x1E, 0xB8, 0x49, 0x21, 0xCC, 0xFB, 0x23,
+	0xCA, 0x5B, 0x7B, 0x2A, 0xB4, 0x71, 0xEC, 0x5D,
+	0x7F, 0x82, 0x29, 0x09, 0x56, 0xD7, 0xBC, 0x02,
+	0x63, 0xE0, 0xAC, 0x2E, 0x88, 0x6A, 0x51, 0x77,
+	0xA0, 0x48, 0x3B, 0x95, 0xB2, 0xC5, 0x89, 0xC8,
+	0x50, 0xC5, 0x1D, 0x3C, 0x18, 0x50, 0xFC, 0xAA,
+	0x45, 0x97, 0x7D, 0x5F, 0xBD, 0xC6, 0x0E, 0x63,
+	0xA6, 0x7F, 0x36, 0x2F, 0x44, 0x9B, 0x25, 0x08,
+	0x63, 0x75, 0x6E, 0x0A, 0x93, 0x65, 0xE5, 0x61,
+	0xEA, 0x02, 0x81, 0xC9, 0x5F, 0x83, 0x04, 0x80,
+	0xAB, 0xAC, 0xD6, 0x75, 0x62, 0x84, 0x98, 0xDC,
+	0x0A, 0x5C, 0x5A, 0x7A, 0x40, 0x76, 0xF9, 0x7B,
+	0x45, 0xBE, 0xDF, 0x2D, 0x6E, 0x36, 0x74, 0x36,
+	0x5B, 0xAE, 0x90, 0x1E, 0xE3, 0xFB, 0x15, 0x20,
+	0xE9, 0x60, 0x53, 0x4D, 0x34, 0x63, 0x61, 0x14,
+	0x77, 0xEB, 0x2E, 0x36, 0xEA, 0xDD, 0x6C, 0x9F,
+	0xBC, 0xA1, 0xB2, 0x8A, 0x8D, 0x0A, 0x9A, 0x53,
+	0xEC, 0xD1, 0x1A, 0x40, 0x79, 0x80, 0x9D, 0x22,
+	0xF6, 0xE1, 0x31, 0xED, 0xD4, 0xD3, 0xAB, 0xDB,
+	0x92, 0x53, 0xC9, 0x35, 0x73, 0x72, 0xF9, 0xB0,
+	0xBD, 0x7D, 0x89, 0x35, 0x86, 0xAD, 0xC9, 0xC4,
+	0x29, 0x35, 0xC6, 0x5C, 0xED, 0xEB, 0x7C, 0x58,
+	0xDC, 0xC2, 0x09, 0xD5, 0xF3, 0x6B, 0xC3, 0xD0,
+	0x41, 0x8D, 0x7F, 0x49, 0x0A, 0x48, 0x4D, 0x6A,
+	0x19, 0xB2, 0xC3, 0xBA, 0xB6, 0x14, 0x6E, 0x97,
+	0xFE, 0xAC, 0x36, 0x51, 0xF4, 0xF1, 0xB5, 0xCE,
+	0x40, 0x67, 0x9D, 0xBA, 0x73, 0x67, 0x8B, 0xF2,
+	0xF2, 0x0D, 0x2A, 0x7D, 0x58, 0x99, 0xD4, 0xBB,
+	0xC7, 0xB2, 0x2C, 0xAB, 0xC5, 0xD6, 0xCE, 0xDF,
+	0xA2, 0x38, 0x60, 0x46, 0x73, 0x56, 0xA1, 0xA9,
+	0x7E, 0x4E, 0x8C, 0x86, 0x68, 0x8B, 0x1C, 0x2F,
+	0xF8, 0x1F, 0xD0, 0x4B, 0xBD, 0xC3, 0x89, 0x24,
+	0x6A, 0x5B, 0x08, 0x60, 0xB2, 0xA8, 0xB9, 0xBA,
+	0x8E, 0x57, 0x75, 0x09, 0x61, 0x84, 0x3D, 0x28,
+	0x18, 0xE0, 0x1F, 0x46, 0x14, 0x47, 0x3F, 0xC1,
+	0xF4, 0x8F, 0x66, 0x2F, 0x42, 0xFA, 0xE0, 0xF5,
+	0xBD, 0xC8, 0xDA, 0x2D, 0xB9, 0xDA, 0xFA, 0x6A,
+	0xCE, 0x01, 0xFF, 0xBA, 0xF4, 0xE0, 0x3C, 0x34,
+	0xE7, 0xD0, 0xE0, 0x7D, 0xC7, 0xC2, 0x24, 0xED,
+	0xBF, 0x39, 0xE4, 0x19, 0x84, 0x51, 0xF1, 0xDB,
+	0x07, 0x11, 0xA3, 0x1F, 0x08, 0xF7, 0xB6, 0x93,
+	0x36, 0x24, 0x4A, 0x26, 0xBE, 0x8A, 0xE4, 0xB7,
+	0xF7, 0xBA, 0xAA, 0xF0, 0xA4, 0x88, 0xE3, 0x96,
+	0x30, 0x0A, 0xEB, 0xC3, 0x32, 0xEC, 0xF8, 0x49,
+	0x7C, 0xF7, 0xEB, 0x82, 0xD9, 0x18, 0x21, 0x66,
+	0x9C, 0x72, 0x65, 0x01, 0x5B, 0xBD, 0xC4, 0xDD,
+	0x91, 0xD0, 0x0D, 0xC4, 0x46, 0x36, 0xA6, 0x0F,
+	0x5B, 0xD1, 0x99, 0xB5, 0x85, 0x2E, 0x73, 0x16,
+	0xC1, 0x68, 0xC6, 0xD1, 0x2B, 0xB5, 0xD0, 0x9E,
+	0x2C, 0xCF, 0x2D, 0xF6, 0xF2, 0x1C, 0x72, 0xBA,
+	0x9B, 0xFD, 0x8B, 0x6C, 0x2F, 0xFB, 0xB5, 0x4B,
+	0x0C, 0xF8, 0x74, 0x81, 0x73, 0x67, 0xA4, 0x59,
+	0xE7, 0x1B, 0xAC, 0x18, 0xAD, 0x87, 0x3E, 0x40,
+	0xBF, 0xE0, 0x43, 0x7E, 0xD2, 0xE5, 0xAA, 0xAF,
+	0x84, 0xD3, 0xBF, 0x34, 0xCF, 0x4B, 0xFE, 0x33,
+	0x3A, 0xC7, 0x5F, 0x54, 0x22, 0xDF, 0xB0, 0xF5,
+	0xDF, 0x7D, 0x5E, 0x53, 0xC6, 0x91, 0xFF, 0x1B,
+	0x44, 0x1E, 0x12, 0x9E, 0xD4, 0xBD, 0xE4, 0x1F,
+	0x71, 0xC7, 0x6A, 0x0F, 0x0E, 0x87, 0xFD, 0xD1,
+	0xDD, 0x46, 0xCD, 0xD9, 0xC1, 0x48, 0x59, 0x39,
+	0xA4, 0xB1, 0x91, 0x49, 0xB6, 0xB0, 0xA9, 0x42,
+	0x1B, 0x3D, 0x61, 0xB6, 0xCE, 0x54, 0xAC, 0x6F,
+	0x89, 0x96, 0x83, 0x47, 0xB0, 0x0F, 0xE4, 0xF9,
+	0x03, 0xE0, 0x44, 0x3D, 0x12, 0xB4, 0x99, 0x58,
+	0xEF, 0x63, 0x53, 0xFB, 0x57, 0x59, 0x4D, 0x1A,
+	0x64, 0x7A, 0x2B, 0x77, 0x3F, 0x1B, 0x8D, 0xEE,
+	0x8B, 0xEE, 0x11, 0xF1, 0x1D, 0x4A, 0xFD, 0x65,
+	0xE8, 0x53, 0x9A, 0xF3, 0x69, 0x6F, 0xBB, 0xDB,
+}};
+
+// bign-curve384v1
+static const union
+{
+	octet o[3072];
+	word w[1];
+} _curve192v1_pre =
+{{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0xC4, 0x33, 0xF7, 0x31, 0xCB, 0x5E, 0xEA,
+	0xF9, 0x42, 0x2A, 0x6B, 0x27, 0x3E, 0x40, 0x84,
+	0x55, 0xD3, 0xB1, 0x66, 0x9E, 0xE7, 0x49, 0x05,
+	0xA0, 0xFF, 0x86, 0xDC, 0x11, 0x9A, 0x72, 0x3A,
+	0x89, 0xBF, 0x2D, 0x43, 0x7E, 0x11, 0x30, 0x63,
+	0x9E, 0x9E, 0x2E, 0xA8, 0x24, 0x82, 0x43, 0x5D,
+	0xCF, 0x7E, 0x9C, 0xB5, 0xDB, 0xD0, 0xAD, 0xB9,
+	0xF6, 0x3B, 0x60, 0x19, 0x4B, 0xE4, 0xD1, 0xA9,
+	0x08, 0xB0, 0x96, 0x49, 0xFA, 0x7C, 0x63, 0xA8,
+	0x74, 0xB8, 0xE9, 0xCE, 0xD3, 0x0C, 0x80, 0x49,
+	0xA4, 0xFD, 0x1E, 0xEF, 0xDF, 0x63, 0x5B, 0x7C,
+	0xAB, 0x74, 0xFB, 0x1F, 0xB9, 0xB4, 0x53, 0xA8,
+	0x48, 0xDC, 0xF9, 0x28, 0x8D, 0xB3, 0x66, 0x30,
+	0xEE, 0xE7, 0x3E, 0x56, 0xA6, 0x2C, 0xF3, 0x7D,
+	0x0C, 0x0B, 0x30, 0x58, 0x8C, 0x61, 0xF0, 0x45,
+	0xE6, 0xA3, 0x8F, 0xC6, 0x26, 0x87, 0xC7, 0xE1,
+	0x6D, 0x12, 0xD0, 0x0B, 0xA5, 0x8A, 0x8E, 0x73,
+	0x49, 0x24, 0xB5, 0x9C, 0xC1, 0xC9, 0xC1, 0x40,
+	0x99, 0x00, 0xC7, 0x00, 0xBC, 0x48, 0xA8, 0x41,
+	0x1E, 0x2E, 0xED, 0x6D, 0x3E, 0x56, 0x71, 0x66,
+	0xD0, 0x5D, 0xFE, 0xB5, 0x8C, 0xA8, 0x4B, 0xFB,
+	0x90, 0xA2, 0x81, 0x27, 0xB0, 0x35, 0x23, 0x45,
+	0xAE, 0xDB, 0x3C, 0x51, 0xE2, 0xA0, 0xE6, 0x86,
+	0xA0, 0x74, 0xC8, 0x84, 0xDC, 0x52, 0xA1, 0xB2,
+	0x30, 0x47, 0xE4, 0x5F, 0xF5, 0x34, 0xDF, 0x8D,
+	0x2D, 0x9F, 0xAF, 0x87, 0xA4, 0x51, 0x7C, 0x36,
+	0xB5, 0xC1, 0xD2, 0x7E, 0xDB, 0xE5, 0xEA, 0xF9,
+	0x4B, 0xCC, 0x4A, 0xC6, 0x42, 0xE2, 0x1E, 0x6A,
+	0xEA, 0x0A, 0x5F, 0x87, 0x5E, 0x48, 0x9F, 0x00,
+	0x73, 0x1F, 0xF5, 0x3E, 0x8F, 0x84, 0x41, 0x10,
+	0xCF, 0xA9, 0x09, 0x49, 0xBE, 0xBC, 0xA7, 0xAB,
+	0x63, 0x70, 0x37, 0xDF, 0x98, 0xAD, 0x66, 0x8A,
+	0x34, 0x39, 0xCD, 0xEF, 0x4B, 0xA7, 0x40, 0x3A,
+	0x25, 0xA2, 0x48, 0xCC, 0x62, 0xAB, 0xEF, 0x1E,
+	0x0F, 0x85, 0xE2, 0xE1, 0x7E, 0x39, 0x98, 0x66,
+	0xB2, 0x94, 0x7E, 0x6D, 0x93, 0xFF, 0x64, 0x22,
+	0xA9, 0xF2, 0x46, 0xF6, 0xE8, 0x3C, 0x9B, 0x23,
+	0x53, 0x80, 0xA1, 0x14, 0x28, 0xB9, 0x93, 0x15,
+	0x28, 0x64, 0xFD, 0x98, 0x6A, 0x36, 0x63, 0x86,
+	0x65, 0xC5, 0x1F, 0x51, 0x74, 0xB2, 0xCD, 0x7E,
+	0x57, 0x77, 0x80, 0x79, 0x2E, 0x9C, 0x81, 0x15,
+	0xF6, 0x75, 0xDD, 0xFA, 0xDF, 0x2E, 0x41, 0x92,
+	0x56, 0x24, 0x2B, 0xFA, 0x16, 0xB5, 0x24, 0x1A,
+	0xDD, 0x5F, 0xE8, 0x88, 0xF2, 0x6B, 0xBF, 0x33,
+	0x3F, 0x1B, 0x82, 0xB1, 0x44, 0x8D, 0x39, 0x2F,
+	0x38, 0x9C, 0xC1, 0x24, 0xCE, 0x1F, 0xCF, 0xF2,
+	0x9F, 0x98, 0x29, 0x1C, 0x48, 0x55, 0x3D, 0x3D,
+	0x73, 0x97, 0xC1, 0xC7, 0x83, 0x38, 0x7C, 0x68,
+	0xA0, 0x0B, 0x2B, 0xA2, 0x15, 0xF4, 0x34, 0x89,
+	0xB6, 0x12, 0x13, 0xB9, 0x4D, 0x05, 0x48, 0x2D,
+	0x5F, 0xAE, 0x74, 0xB4, 0x52, 0x22, 0x54, 0x7B,
+	0x95, 0xCF, 0xB3, 0x3B, 0x1D, 0x8E, 0x79, 0x4A,
+	0x19, 0xFE, 0xD6, 0x33, 0x0D, 0x56, 0xC1, 0x58,
+	0xB9, 0x48, 0x14, 0x5C, 0xEA, 0x27, 0x8D, 0x61,
+	0x71, 0x4F, 0x79, 0x34, 0x57, 0xF2, 0xDF, 0x2B,
+	0xF5, 0xA6, 0x5F, 0x6F, 0x7A, 0x2E, 0x6C, 0xE6,
+	0x7E, 0xF4, 0x6D, 0xDB, 0xBC, 0x61, 0x53, 0xDB,
+	0xE7, 0x36, 0x29, 0x74, 0xD7, 0x1A, 0x75, 0x86,
+	0xEA, 0x54, 0xDF, 0x59, 0x86, 0x49, 0x89, 0xFF,
+	0xE0, 0x69, 0xAC, 0x60, 0x0F, 0x5C, 0x82, 0xD9,
+	0xF3, 0xB7, 0x22, 0xBA, 0xA4, 0xCB, 0xF4, 0x8E,
+	0x75, 0x55, 0x90, 0x0F, 0x58, 0x3A, 0xE8, 0xCC,
+	0xD3, 0x50, 0x57, 0x2C, 0x97, 0x67, 0xB7, 0x91,
+	0x02, 0x77, 0x0C, 0x25, 0x00, 0xE0, 0xE9, 0x94,
+	0x09, 0x24, 0x17, 0x01, 0x57, 0x2B, 0x53, 0xA6,
+	0xB6, 0x1C, 0xA3, 0xD7, 0x18, 0x81, 0x52, 0x0C,
+	0x0A, 0x49, 0xD4, 0xD1, 0xAF, 0x37, 0xB8, 0x3F,
+	0x5C, 0xBE, 0x5E, 0x03, 0x9E, 0x21, 0x28, 0x9F,
+	0xFA, 0x10, 0x9A, 0x74, 0x40, 0x13, 0x1B, 0x98,
+	0x0B, 0x62, 0x9E, 0x70, 0xCE, 0x72, 0x0C, 0x95,
+	0x51, 0x17, 0xA1, 0x54, 0xFC, 0x59, 0x9E, 0xDF,
+	0x9B, 0x08, 0xB4, 0x27, 0x82, 0x9A, 0x1A, 0x18,
+	0xE2, 0x3E, 0xDD, 0xBA, 0x85, 0x0F, 0xA5, 0x63,
+	0xF9, 0x78, 0x7C, 0x21, 0xEA, 0x8A, 0x65, 0x01,
+	0xE5, 0x4A, 0x2D, 0x14, 0x01, 0xA6, 0x84, 0x7D,
+	0xC0, 0xD9, 0xC6, 0x91, 0x06, 0x02, 0x9A, 0xE9,
+	0xBF, 0x35, 0xF4, 0x2A, 0x6C, 0x53, 0x73, 0x42,
+	0x6B, 0x6D, 0x2B, 0x0D, 0x62, 0xCC, 0xD3, 0x32,
+	0xFB, 0x60, 0x75, 0xC5, 0xA2, 0x4F, 0xB0, 0x85,
+	0x5E, 0x0F, 0x5C, 0xE2, 0xD4, 0x72, 0x51, 0xAA,
+	0x3C, 0xFB, 0xDB, 0x8F, 0x35, 0xE7, 0x19, 0xA8,
+	0xFE, 0x07, 0x87, 0xBA, 0x20, 0x39, 0xA0, 0xDB,
+	0x9B, 0x9D, 0xA2, 0xD9, 0x75, 0xA1, 0x2D, 0x42,
+	0xA9, 0x83, 0xFE, 0xDF, 0x90, 0x5C, 0xA9, 0xEB,
+	0x13, 0x25, 0xAB, 0xAE, 0x3C, 0x7E, 0x2D, 0xFC,
+	0x42, 0xD9, 0x6E, 0x86, 0x03, 0xDE, 0xAE, 0x74,
+	0x44, 0x8C, 0x84, 0x8C, 0x6D, 0xA7, 0xE7, 0x50,
+	0xD2, 0x2A, 0xCA, 0xD4, 0xA9, 0x20, 0xF5, 0x37,
+	0x91, 0xF2, 0xEE, 0xC2, 0xE9, 0xCB, 0xE5, 0xAF,
+	0x5F, 0x78, 0x86, 0xB6, 0x79, 0xC7, 0xE3, 0xF1,
+	0x07, 0xB5, 0x9B, 0xCD, 0x2A, 0x75, 0x95, 0x71,
+	0x4C, 0x0E, 0xA9, 0xA2, 0x53, 0x3C, 0x79, 0x07,
+	0xBD, 0xEB, 0xE8, 0xBF, 0x7A, 0xCD, 0x7D, 0xCB,
+	0xAC, 0x24, 0x1A, 0x99, 0xB8, 0x43, 0x36, 0xC9,
+	0x10, 0x07, 0x36, 0xE7, 0x80, 0x1E, 0x5F, 0x6D,
+	0x81, 0x15, 0xA4, 0xF8, 0xF8, 0xE9, 0x1B, 0x96,
+	0x52, 0xCA, 0x91, 0xE1, 0x39, 0x6D, 0x6A, 0xBC,
+	0x68, 0x63, 0x08, 0x98, 0xC8, 0x20, 0x3F, 0xB5,
+	0x52, 0x3F, 0x1C, 0xF0, 0x44, 0x84, 0xEC, 0x08,
+	0xBE, 0x05, 0x2C, 0x20, 0x3D, 0x98, 0x6A, 0x14,
+	0xCD, 0x24, 0x36, 0x0B, 0xE3, 0x7B, 0xCE, 0x37,
+	0xCD, 0x56, 0x31, 0x7A, 0x3E, 0x93, 0x40, 0xA3,
+	0xD3, 0xBD, 0x4C, 0xCC, 0xEF, 0x1A, 0x13, 0x25,
+	0xE3, 0x2C, 0x8F, 0x12, 0xD3, 0x10, 0x4F, 0x9A,
+	0x45, 0x8D, 0x70, 0xC5, 0xBE, 0x65, 0x14, 0xFD,
+	0x3E, 0x69, 0x30, 0xFA, 0x30, 0xBC, 0xB0, 0x96,
+	0xA4, 0x33, 0x6A, 0xEA, 0x8F, 0xB8, 0xFB, 0x16,
+	0x76, 0x63, 0xBE, 0xD7, 0x30, 0x4F, 0xCC, 0x23,
+	0xD9, 0x67, 0x20, 0x38, 0xE7, 0x1D, 0xCF, 0xC0,
+	0xDA, 0x81, 0xFF, 0xE9, 0x81, 0x1F, 0x2B, 0xCE,
+	0xCE, 0xCC, 0x8D, 0xC1, 0x61, 0x4E, 0xF3, 0xE3,
+	0xE1, 0x51, 0x95, 0x26, 0x86, 0x2E, 0xD1, 0x53,
+	0x94, 0x74, 0x06, 0x50, 0xCC, 0xF9, 0xCF, 0x64,
+	0xA6, 0xE2, 0xEC, 0x7A, 0xB4, 0xFC, 0xD0, 0x61,
+	0x27, 0x01, 0x62, 0x28, 0x4D, 0xE7, 0x60, 0x0C,
+	0x72, 0x0B, 0x94, 0x19, 0xF2, 0x7E, 0x6E, 0xEC,
+	0x34, 0x11, 0xB9, 0x60, 0x4C, 0xF0, 0x98, 0x93,
+	0x4D, 0x85, 0xDF, 0x50, 0x7D, 0xCD, 0xF7, 0x47,
+	0xFC, 0xC0, 0x83, 0x4C, 0x81, 0x38, 0xD1, 0x08,
+	0xCB, 0xF6, 0x90, 0xB3, 0x3F, 0x0F, 0xAD, 0xF1,
+	0x92, 0x3E, 0x4F, 0x6C, 0x02, 0x3D, 0x44, 0x3A,
+	0x57, 0xC8, 0x45, 0x0E, 0x2C, 0x48, 0xD9, 0xF3,
+	0x59, 0x9C, 0xD6, 0x09, 0xA5, 0xDB, 0x55, 0xC2,
+	0x2F, 0xFF, 0x38, 0x21, 0xE6, 0xC4, 0xCE, 0xB7,
+	0x48, 0x1E, 0xB6, 0xE2, 0xE8, 0xB5, 0x40, 0x7B,
+	0x0F, 0xAD, 0x18, 0x71, 0x64, 0x94, 0xC8, 0xF8,
+	0xF5, 0x9C, 0x8A, 0xF8, 0x9B, 0xA7, 0xDD, 0x8A,
+	0x5F, 0x1F, 0x69, 0xD4, 0x52, 0xA9, 0x77, 0xC0,
+	0xE4, 0x46, 0x96, 0x40, 0x15, 0x0A, 0x6F, 0x36,
+	0x24, 0x10, 0xD1, 0x41, 0xAF, 0x01, 0x00, 0x82,
+	0x1E, 0xCB, 0xBB, 0x45, 0x54, 0x4B, 0x63, 0x57,
+	0xF7, 0x29, 0xDB, 0x99, 0x45, 0xA9, 0x8D, 0x51,
+	0xF0, 0xE5, 0x29, 0x5B, 0xA3, 0x1A, 0x74, 0xB2,
+	0xD8, 0x41, 0x9A, 0x3E, 0xFD, 0x0F, 0x9E, 0xB4,
+	0x06, 0x63, 0x39, 0xCE, 0x90, 0xDE, 0x77, 0x1E,
+	0x48, 0xF5, 0xD8, 0x74, 0x3B, 0x03, 0x3C, 0xB7,
+	0xD1, 0xF4, 0xE5, 0x33, 0xE1, 0x29, 0xF8, 0x31,
+	0x9B, 0x96, 0x37, 0xF1, 0xDA, 0x5E, 0xE6, 0x44,
+	0xC0, 0x12, 0xC1, 0x7D, 0xDA, 0x7B, 0xFB, 0x9F,
+	0x04, 0x8E, 0x58, 0x0B, 0x04, 0x0E, 0x5B, 0x89,
+	0x8D, 0x36, 0x85, 0xCB, 0xDE, 0x4D, 0xAE, 0x83,
+	0x54, 0x5A, 0x8D, 0x5E, 0x7E, 0x34, 0xE2, 0xB8,
+	0x1C, 0x06, 0x77, 0xF9, 0x58, 0xDA, 0x53, 0x6A,
+	0x37, 0x5B, 0x23, 0xA6, 0xD3, 0x27, 0xA4, 0x3E,
+	0x17, 0xCC, 0xF6, 0x52, 0x6E, 0x00, 0x6B, 0x7E,
+	0x56, 0x3D, 0xBE, 0x1E, 0xC8, 0x86, 0xA4, 0x53,
+	0x01, 0x88, 0x82, 0x60, 0x6F, 0xF8, 0x20, 0xDE,
+	0xEF, 0x7E, 0x11, 0x57, 0xF1, 0x75, 0xE7, 0xEE,
+	0x25, 0x0E, 0xED, 0x54, 0xA6, 0x0C, 0xFE, 0xAF,
+	0xF7, 0x36, 0xE9, 0x08, 0x92, 0x89, 0xF8, 0x64,
+	0xF5, 0xBA, 0xC6, 0xA4, 0x45, 0xBB, 0x35, 0xD5,
+	0x06, 0xBA, 0x6B, 0x08, 0x37, 0xAA, 0xDF, 0x69,
+	0xAE, 0xE0, 0x86, 0xEA, 0x7D, 0x1E, 0x9D, 0xD0,
+	0xAD, 0x7A, 0x88, 0x91, 0x4F, 0x32, 0x79, 0x4F,
+	0x93, 0x33, 0xDC, 0x34, 0x7C, 0xD2, 0xAE, 0x3F,
+	0xBF, 0x37, 0x8C, 0x5F, 0x48, 0xE0, 0xD8, 0x8C,
+	0xE2, 0x37, 0x29, 0x8F, 0x1B, 0x1C, 0x08, 0x4D,
+	0xCA, 0x2C, 0x09, 0x89, 0x4C, 0x30, 0xD2, 0x36,
+	0x65, 0x73, 0xD4, 0xAC, 0xBA, 0x52, 0x13, 0x00,
+	0xE2, 0x17, 0x79, 0xD6, 0x62, 0xC1, 0x16, 0x12,
+	0x80, 0x84, 0xAB, 0xB1, 0x80, 0x83, 0xED, 0xC6,
+	0x3A, 0xFA, 0x02, 0x05, 0x18, 0x45, 0x92, 0x00,
+	0x10, 0x0D, 0x1F, 0x15, 0xDD, 0xDD, 0x0E, 0x55,
+	0x10, 0xF8, 0x07, 0x83, 0x30, 0xBD, 0xFD, 0xE5,
+	0xFF, 0x8A, 0x1E, 0x29, 0x93, 0xD0, 0x57, 0x9F,
+	0xF3, 0xE3, 0xB0, 0xD1, 0x04, 0x8B, 0x47, 0xE3,
+	0x14, 0x11, 0x4A, 0x0E, 0x53, 0x58, 0x96, 0x29,
+	0xB5, 0xB7, 0x6C, 0x72, 0x84, 0x41, 0xF2, 0xF5,
+	0x58, 0x72, 0x85, 0x72, 0xCA, 0xCE, 0x7E, 0x2D,
+	0x94, 0xF1, 0x10, 0x14, 0x06, 0x5A, 0x7D, 0xC4,
+	0x06, 0x5A, 0xBD, 0x49, 0x27, 0x58, 0x7D, 0xF8,
+	0xCB, 0xA4, 0xA4, 0x2F, 0x10, 0x3F, 0x04, 0x90,
+	0xAA, 0x80, 0x84, 0x04, 0x44, 0xD8, 0x1A, 0x8C,
+	0x77, 0x8B, 0xC7, 0x25, 0xB8, 0x92, 0x72, 0x8C,
+	0x70, 0x8C, 0x78, 0x4A, 0xA6, 0x8F, 0x2D, 0x15,
+	0x39, 0x69, 0x7C, 0x2D, 0x5B, 0x0D, 0xB0, 0x89,
+	0x06, 0x73, 0x5B, 0x8E, 0x45, 0x9E, 0xC5, 0x73,
+	0x2D, 0x6B, 0x2D, 0xC6, 0xA0, 0x82, 0xBC, 0xBF,
+	0x13, 0xE4, 0x1E, 0x27, 0x8D, 0x68, 0x08, 0xA0,
+	0x7C, 0x05, 0x31, 0xA5, 0x1C, 0x5A, 0x88, 0xD3,
+	0x4E, 0x13, 0x79, 0x76, 0x0B, 0x98, 0x6C, 0xD2,
+	0x5E, 0x37, 0x81, 0x5C, 0x99, 0xEB, 0xC1, 0xBC,
+	0x98, 0xA2, 0xAD, 0x0B, 0x5C, 0xA6, 0x9E, 0xA1,
+	0x36, 0x52, 0x0C, 0xE3, 0x99, 0x5A, 0x1B, 0x62,
+	0x97, 0x09, 0xC2, 0xA1, 0xC7, 0xD2, 0xA3, 0x32,
+	0x26, 0xCE, 0xBE, 0x2E, 0xED, 0xD4, 0xDC, 0xFF,
+	0x4C, 0xCF, 0x74, 0x6A, 0xD7, 0xDF, 0x30, 0x7D,
+	0xC8, 0x42, 0xCF, 0xA8, 0xE2, 0x6F, 0x10, 0xE4,
+	0x7B, 0x3B, 0x57, 0x3F, 0x5C, 0xC0, 0x7A, 0xBD,
+	0x71, 0x82, 0x20, 0x87, 0x8C, 0xF5, 0x4E, 0xFF,
+	0xA7, 0xD5, 0xFB, 0x84, 0xEB, 0x85, 0xFC, 0x52,
+	0x91, 0x6C, 0x86, 0x32, 0x79, 0x33, 0x75, 0xD1,
+	0x03, 0xA7, 0x4E, 0x9F, 0x76, 0x32, 0xE2, 0x02,
+	0xA3, 0x14, 0x81, 0x4F, 0xE9, 0x33, 0x60, 0x1B,
+	0x85, 0x8A, 0xD6, 0x07, 0x7E, 0x68, 0xAD, 0x37,
+	0x95, 0x0C, 0x7E, 0xAD, 0x88, 0xE5, 0x37, 0x48,
+	0xE8, 0x90, 0x3D, 0xC4, 0x1A, 0xF3, 0xAF, 0x81,
+	0x5E, 0xA6, 0x93, 0x94, 0xA8, 0xAF, 0x5D, 0xF5,
+	0x03, 0x0C, 0x76, 0x3F, 0x77, 0x49, 0x40, 0xCA,
+	0x63, 0x74, 0x04, 0x3A, 0xBF, 0x7F, 0x7B, 0x5F,
+	0x10, 0x05, 0xB6, 0x90, 0xFC, 0xBB, 0x60, 0x34,
+	0x72, 0x7F, 0x64, 0xCA, 0x12, 0xFA, 0xBB, 0x3B,
+	0x9A, 0x0A, 0xDA, 0x0A, 0x54, 0x54, 0x79, 0x8E,
+	0x7F, 0x3C, 0x57, 0x3A, 0xCF, 0xE9, 0xF1, 0x0F,
+	0x8D, 0x7D, 0xE8, 0xD1, 0x6D, 0xD6, 0x69, 0x4A,
+	0xAC, 0xCB, 0x9B, 0xE4, 0xA5, 0x6A, 0x49, 0x96,
+	0x76, 0x3F, 0x55, 0xF5, 0x02, 0x8B, 0x37, 0xAF,
+	0x23, 0xAB, 0x60, 0x7D, 0xF6, 0x9B, 0xAB, 0xF8,
+	0x3D, 0xD1, 0x36, 0xD9, 0xB1, 0x79, 0xCE, 0xB5,
+	0xE9, 0xE4, 0x09, 0x78, 0xB7, 0x05, 0x9C, 0x1A,
+	0xD5, 0x3B, 0x91, 0xAE, 0xDF, 0xCC, 0xB8, 0x74,
+	0x37, 0x76, 0x44, 0x9B, 0x0C, 0x82, 0x21, 0x63,
+	0x3B, 0x1C, 0xE2, 0x0D, 0xE9, 0xB5, 0x09, 0x91,
+	0x8D, 0x9C, 0x72, 0x48, 0x2F, 0xD4, 0x2A, 0x4D,
+	0x31, 0x2B, 0xF5, 0x7C, 0x62, 0x46, 0x83, 0x59,
+	0x66, 0x0F, 0xE0, 0x6B, 0xE4, 0x8C, 0x6A, 0x7D,
+	0x18, 0x23, 0x36, 0xB9, 0xC9, 0xCF, 0xA9, 0x00,
+	0xDF, 0xFE, 0x0D, 0xC1, 0x16, 0x2F, 0xC0, 0x3B,
+	0x39, 0x06, 0x9E, 0x23, 0x88, 0x37, 0xD5, 0x0C,
+	0x84, 0xF3, 0xA8, 0x08, 0xA9, 0x59, 0x2E, 0xB8,
+	0x63, 0x46, 0xDF, 0x1B, 0x12, 0x83, 0x66, 0x25,
+	0x22, 0x94, 0x56, 0xCE, 0xD9, 0x88, 0x94, 0x5A,
+	0x86, 0x6B, 0xB3, 0xCA, 0x45, 0xFE, 0x02, 0x2E,
+	0xC9, 0xE4, 0x44, 0xE1, 0x7A, 0x25, 0x70, 0x79,
+	0x07, 0x9D, 0x12, 0xDC, 0xC6, 0xAF, 0xA3, 0x72,
+	0x0B, 0xB2, 0xA3, 0xEB, 0x03, 0xDA, 0x1D, 0x13,
+	0x42, 0xC8, 0xFB, 0xFD, 0xD1, 0x02, 0x67, 0xC8,
+	0x4F, 0xFB, 0xF1, 0x53, 0x09, 0x0E, 0xB8, 0x0C,
+	0x39, 0xFE, 0x53, 0x83, 0xD0, 0x94, 0x9B, 0xE9,
+	0x36, 0x75, 0x96, 0xE3, 0x27, 0xDF, 0xDC, 0xE3,
+	0x87, 0x9A, 0x44, 0xCD, 0xC7, 0xA0, 0x6A, 0xEB,
+	0x74, 0xEF, 0x47, 0xA3, 0x93, 0x4B, 0xEA, 0x83,
+	0x2B, 0x8E, 0xBA, 0xE4, 0xD6, 0x3E, 0xF6, 0xF1,
+	0x3A, 0xFA, 0xED, 0x5A, 0x88, 0x86, 0x95, 0xA0,
+	0x95, 0x02, 0x30, 0x72, 0xCC, 0xA6, 0xB9, 0x56,
+	0x39, 0xEE, 0xD4, 0xA6, 0xBB, 0x3E, 0x4D, 0x08,
+	0xE8, 0x45, 0xC3, 0x90, 0x53, 0xC7, 0x55, 0xBF,
+	0xC8, 0x3A, 0x00, 0xB6, 0x91, 0x67, 0xB1, 0x64,
+	0x45, 0xD6, 0x01, 0xBB, 0xA6, 0x40, 0xCF, 0xDB,
+	0xFB, 0xEF, 0x05, 0x13, 0x06, 0xAC, 0x2A, 0x2D,
+	0x3A, 0x0F, 0x45, 0x89, 0x06, 0x20, 0xBB, 0xDA,
+	0x89, 0x4C, 0x0A, 0x18, 0xA9, 0xE5, 0xB5, 0x48,
+	0xBC, 0xF7, 0xCB, 0xD3, 0x00, 0x9F, 0x8C, 0xB1,
+	0x39, 0x2E, 0xC8, 0xE7, 0x9B, 0x65, 0x6B, 0xF2,
+	0x75, 0x2C, 0x29, 0x75, 0xF1, 0x7C, 0xE5, 0xA0,
+	0xFD, 0xF3, 0xA9, 0x35, 0x9A, 0x49, 0x4D, 0x88,
+	0x74, 0xFE, 0x22, 0x9D, 0x97, 0xAC, 0x7D, 0x17,
+	0x85, 0xC1, 0x20, 0x69, 0x52, 0x99, 0xCB, 0x32,
+	0xF1, 0x39, 0xED, 0x77, 0x66, 0x8D, 0x98, 0xC9,
+	0xAA, 0x9C, 0xD1, 0xC3, 0x36, 0x84, 0x3A, 0x2A,
+	0x6A, 0x81, 0x24, 0x34, 0xC4, 0x8B, 0xDD, 0x55,
+	0x74, 0x21, 0x06, 0x57, 0x23, 0x06, 0x02, 0x6B,
+	0x6E, 0x6C, 0x5A, 0x31, 0x27, 0x9F, 0xBF, 0xE5,
+	0x7D, 0x09, 0xD7, 0x23, 0xFF, 0x99, 0xB6, 0xBD,
+	0x53, 0x98, 0xBF, 0xD7, 0xEA, 0x8E, 0x18, 0x0E,
+	0x41, 0x23, 0x55, 0x76, 0x70, 0x68, 0x1B, 0x1D,
+	0xE9, 0x4B, 0x18, 0x74, 0x63, 0xD0, 0xA3, 0x8D,
+	0xCA, 0x1A, 0x30, 0xB5, 0x90, 0xDF, 0x33, 0xF2,
+	0xCA, 0x79, 0xE9, 0x9D, 0xC4, 0x06, 0x0C, 0x65,
+	0x5C, 0x6B, 0x12, 0x7E, 0x61, 0x7D, 0x53, 0x4D,
+	0x22, 0x6E, 0xC8, 0x7F, 0xEA, 0x65, 0x9A, 0x52,
+	0xA5, 0xE5, 0x02, 0xE5, 0x34, 0x0D, 0x46, 0x4C,
+	0xE8, 0x9E, 0x08, 0xEC, 0x60, 0x7E, 0xEA, 0x17,
+	0x21, 0xD8, 0x06, 0x83, 0xAB, 0x48, 0x3C, 0x85,
+	0xD1, 0x74, 0x6A, 0x54, 0x07, 0xED, 0xA2, 0xC4,
+	0x9D, 0x9E, 0x8A, 0x19, 0xB3, 0x10, 0x80, 0xD1,
+	0x61, 0xD9, 0x40, 0x45, 0x54, 0x68, 0x78, 0x32,
+	0x62, 0xC5, 0x5C, 0xC6, 0xE4, 0xBF, 0x34, 0x41,
+	0x07, 0x20, 0xF9, 0x14, 0x11, 0x2C, 0x02, 0x0B,
+	0x07, 0xC9, 0x94, 0xBB, 0x49, 0xB1, 0xBD, 0x71,
+	0xBD, 0x65, 0x1D, 0xFB, 0x1D, 0xCE, 0x75, 0x8E,
+	0x80, 0xCE, 0x1B, 0x9C, 0x79, 0x73, 0x44, 0xA8,
+	0xEC, 0x99, 0x61, 0xCE, 0xD5, 0x0D, 0x3C, 0x5A,
+	0x39, 0xC2, 0xB3, 0xAF, 0xED, 0x20, 0x54, 0xE5,
+	0xFE, 0x1D, 0xA3, 0xAC, 0x97, 0x53, 0x48, 0x51,
+	0xC4, 0x8A, 0xFA, 0x45, 0xCC, 0x79, 0x09, 0x17,
+	0x27, 0xE1, 0xF5, 0x9C, 0x85, 0xF9, 0xDB, 0xEC,
+	0xAC, 0xA5, 0x32, 0x5A, 0x2D, 0x2D, 0xD3, 0x6B,
+	0xF7, 0x57, 0x5B, 0x70, 0x85, 0x96, 0x28, 0x69,
+	0x93, 0xDE, 0x88, 0x33, 0x8B, 0xFD, 0xBB, 0xDD,
+	0x69, 0x59, 0x53, 0xE9, 0x50, 0x49, 0x05, 0xA1,
+	0xED, 0x0D, 0xFE, 0x84, 0x89, 0x6A, 0xC8, 0x7C,
+	0x11, 0x63, 0x52, 0xCF, 0x48, 0x05, 0x0A, 0xC2,
+	0x57, 0x59, 0xF5, 0x80, 0x1A, 0xE3, 0xC0, 0x3D,
+	0xC0, 0xCF, 0x03, 0x11, 0xDE, 0xAE, 0xD5, 0xCE,
+	0xE1, 0x85, 0x10, 0x2C, 0x70, 0x5F, 0x39, 0x4A,
+	0x34, 0x00, 0x0A, 0x57, 0x9E, 0x30, 0x30, 0xD2,
+	0x4F, 0x7B, 0x89, 0xB5, 0x40, 0xC9, 0x7D, 0x8E,
+	0x6C, 0x15, 0x6B, 0xA2, 0x57, 0xD7, 0x48, 0x11,
+	0x11, 0x85, 0x8E, 0x58, 0x71, 0xF8, 0x3C, 0x5E,
+	0xA1, 0x6D, 0x77, 0x22, 0x09, 0xC5, 0x31, 0xEA,
+	0xA9, 0xA2, 0xB9, 0x65, 0x50, 0x94, 0x56, 0xFD,
+	0x1F, 0x8E, 0x6F, 0xCD, 0x01, 0x83, 0xF8, 0x69,
+	0x2F, 0x0F, 0x2A, 0xBA, 0x40, 0x27, 0xE6, 0x97,
+	0xA4, 0xB1, 0x39, 0x40, 0x49, 0x7C, 0x1D, 0xEC,
+	0xF3, 0x87, 0x9D, 0x85, 0xBB, 0x80, 0x0C, 0xE9,
+	0x6F, 0xFA, 0x44, 0xA2, 0x80, 0xED, 0x01, 0x4D,
+	0x36, 0xA4, 0x0F, 0x6C, 0xAE, 0xB1, 0xB5, 0x31,
+	0x9B, 0x1A, 0x24, 0xBC, 0x4E, 0x7B, 0x4D, 0x7E,
+	0x4E, 0x49, 0x19, 0xEC, 0xB1, 0xAD, 0xD9, 0xE2,
+	0x11, 0xC3, 0xCC, 0x07, 0x6E, 0x33, 0x1B, 0x69,
+	0x9E, 0x73, 0xE8, 0x5E, 0x9B, 0x1F, 0x5A, 0x82,
+	0x77, 0x0F, 0x9A, 0x77, 0xA3, 0xE2, 0xAA, 0x6F,
+	0x53, 0x8F, 0x31, 0xE1, 0xBD, 0x92, 0x17, 0x88,
+	0x1D, 0x44, 0x22, 0x33, 0x0F, 0xCE, 0x2A, 0x17,
+	0xC7, 0xE5, 0xD0, 0x35, 0x9C, 0x68, 0xBD, 0xD6,
+	0x7D, 0xFE, 0x9A, 0xFD, 0x70, 0x18, 0xC9, 0xD0,
+	0x9F, 0xCB, 0x83, 0xB7, 0x04, 0x42, 0xF4, 0x53,
+	0x74, 0x6E, 0x5D, 0xE7, 0x83, 0x67, 0x0F, 0xCD,
+	0xC3, 0x9E, 0x9B, 0x01, 0x83, 0xCD, 0x33, 0xCB,
+	0x8E, 0x0A, 0x27, 0x04, 0x2B, 0x4B, 0xA5, 0xFC,
+	0x64, 0xF2, 0x18, 0xDA, 0x52, 0x0E, 0xF8, 0xED,
+	0xC7, 0xB4, 0xAA, 0xD3, 0x3A, 0xFB, 0x03, 0x2C,
+	0x36, 0xFE, 0x6A, 0x5B, 0x5D, 0x49, 0xD4, 0x05,
+	0x33, 0x33, 0x63, 0xA2, 0x2C, 0x8A, 0xAB, 0x0F,
+	0xCB, 0xF7, 0x57, 0x98, 0xE0, 0xFF, 0x47, 0x2C,
+	0x0E, 0x4D, 0xE0, 0x4F, 0x97, 0x46, 0xEB, 0x70,
+	0x24, 0x80, 0x22, 0x09, 0x73, 0xFC, 0xE9, 0x91,
+	0x95, 0xBA, 0x3A, 0xBA, 0x29, 0xFA, 0xBC, 0x6A,
+	0xFF, 0xB3, 0xA3, 0xD4, 0x07, 0x5D, 0xE0, 0xEE,
+	0x99, 0x27, 0xE8, 0xB9, 0xD7, 0x39, 0xB7, 0xDD,
+	0x30, 0x90, 0xD4, 0x49, 0xCD, 0xB5, 0x92, 0xFD,
+	0xE3, 0x09, 0x7B, 0x6D, 0x95, 0xED, 0xA5, 0xF0,
+	0x51, 0x96, 0xAA, 0x45, 0xE8, 0xF0, 0x66, 0x36,
+	0x42, 0xBB, 0x26, 0x5F, 0x7D, 0x83, 0xCE, 0xDD,
+	0x45, 0xD7, 0x91, 0xF6, 0xF8, 0xD0, 0x2E, 0x86,
+	0xA3, 0xAB, 0xC7, 0x32, 0x56, 0x22, 0xEF, 0xAD,
+	0x7A, 0xB2, 0x79, 0x73, 0x40, 0xDD, 0x68, 0xE8,
+	0x75, 0xB2, 0x42, 0x4E, 0x4A, 0xCC, 0x4E, 0x21,
+	0xE2, 0x9B, 0x25, 0x83, 0xAD, 0x90, 0x51, 0xEF,
+	0x92, 0x2B, 0x9C, 0xED, 0x6E, 0x73, 0x9F, 0xD1,
+	0x1D, 0xC3, 0xED, 0xD6, 0xCD, 0xFA, 0x24, 0xB6,
+	0x1D, 0x7D, 0x06, 0x39, 0xFB, 0xB4, 0x64, 0xF4,
+	0x3E, 0x67, 0xDE, 0x48, 0x16, 0xAF, 0x91, 0xFC,
+	0x22, 0x05, 0x8E, 0x92, 0xDE, 0x39, 0x92, 0x62,
+	0xFC, 0xFA, 0x67, 0x99, 0x94, 0xF5, 0x26, 0x10,
+	0xB0, 0xF0, 0x2B, 0x93, 0xCD, 0xAD, 0x05, 0x90,
+	0x77, 0xC3, 0xA6, 0x91, 0xC5, 0x93, 0x6E, 0x9B,
+	0x2A, 0x70, 0xB9, 0x7F, 0xBE, 0xE1, 0xDF, 0x6C,
+	0xC6, 0x8A, 0x79, 0xE2, 0x5C, 0xB1, 0x3B, 0xE3,
+	0x14, 0xB0, 0x35, 0x55, 0xAD, 0xB2, 0xE0, 0x5B,
+	0x87, 0xFC, 0x6D, 0xC2, 0x3A, 0x6A, 0x3C, 0xE2,
+	0x04, 0xAF, 0x0C, 0x1E, 0x7C, 0x62, 0xEC, 0x03,
+	0x91, 0xCA, 0x46, 0xF0, 0xC8, 0x9D, 0x80, 0x65,
+	0xD6, 0xDF, 0x8A, 0x53, 0x1D, 0x8B, 0xA6, 0x33,
+	0x7C, 0xA1, 0x41, 0xE1, 0x8E, 0xC4, 0x45, 0x07,
+	0x72, 0x84, 0x2A, 0x17, 0x71, 0xF2, 0x34, 0x7B,
+	0x11, 0x39, 0xCA, 0x41, 0x6E, 0x93, 0x73, 0x33,
+	0xE8, 0x4E, 0x83, 0xF4, 0x28, 0x58, 0x55, 0xA2,
+	0xF5, 0xF1, 0xE1, 0x83, 0x9C, 0x41, 0x03, 0x33,
+	0x8B, 0xCB, 0x95, 0x4C, 0xBC, 0x23, 0x01, 0x37,
+	0xBF, 0x24, 0x9E, 0xE4, 0x97, 0x52, 0xB0, 0x8C,
+	0x98, 0x87, 0xA0, 0x00, 0xE7, 0x76, 0x6C, 0x76,
+	0xBB, 0x94, 0x76, 0x4F, 0xB3, 0xA8, 0xBB, 0x91,
+	0x66, 0x9D, 0x71, 0xE3, 0x4F, 0x4A, 0x32, 0x32,
+	0xAF, 0x07, 0xCC, 0x3F, 0xE5, 0x7E, 0x85, 0xD2,
+	0x1A, 0x5F, 0x00, 0x4D, 0x36, 0x9F, 0xAE, 0x86,
+	0x81, 0xB0, 0xAD, 0xC6, 0xD7, 0x02, 0xDB, 0x8E,
+	0x6C, 0xE4, 0x77, 0x87, 0xCF, 0x16, 0x65, 0xF2,
+	0x66, 0xF7, 0x58, 0xBA, 0xD5, 0xEC, 0xD6, 0x40,
+	0x24, 0xE0, 0xF3, 0xE6, 0xD5, 0x2F, 0x73, 0xA5,
+	0x90, 0x41, 0xDD, 0xDB, 0x82, 0x40, 0x7A, 0xA8,
+	0x27, 0x65, 0x2F, 0x98, 0x2A, 0xAD, 0x93, 0x0B,
+	0xD0, 0xE8, 0x2B, 0xC5, 0xFC, 0x58, 0x97, 0x24,
+	0x26, 0xB4, 0xAD, 0xE7, 0x4C, 0xBE, 0x0E, 0x1E,
+	0xD1, 0x5E, 0x8B, 0x52, 0x28, 0xE4, 0x40, 0x94,
+	0x7C, 0x9E, 0x64, 0x4C, 0x0C, 0x13, 0x38, 0x4F,
+	0x0D, 0x7E, 0x87, 0xCB, 0x9C, 0xA5, 0xD8, 0xC7,
+	0x89, 0x0B, 0x30, 0xEB, 0x58, 0x1F, 0x9D, 0xF3,
+	0x73, 0x87, 0x26, 0x8E, 0xAB, 0x33, 0xE1, 0x40,
+	0xF8, 0xD1, 0x3A, 0x47, 0xDB, 0x53, 0x25, 0x42,
+	0x7F, 0x95, 0x6E, 0x3C, 0x93, 0xAA, 0x38, 0x57,
+	0x60, 0x75, 0x05, 0x4C, 0x6C, 0xF0, 0x3C, 0xAE,
+	0x25, 0x43, 0x9F, 0x14, 0x8B, 0x99, 0x5A, 0x93,
+	0xEF, 0x5C, 0x54, 0x51, 0xB1, 0xAA, 0xE6, 0x96,
+	0xE0, 0x59, 0x47, 0xE2, 0xC4, 0xDE, 0x61, 0x44,
+	0x99, 0xB3, 0x1F, 0xE8, 0xE5, 0x3C, 0xE8, 0x9C,
+	0xB3, 0x58, 0x5F, 0xC5, 0x10, 0x85, 0xC4, 0xAE,
+}};
+
+// bign-curve512v1
+static const union
+{
+	octet o[4096];
+	word w[1];
+} _curve256v1_pre =
+{{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xBD, 0xED, 0xEF, 0xCE, 0x6F, 0xAE, 0x92, 0xB7,
+	0x04, 0x0D, 0x4C, 0xC9, 0xB9, 0x83, 0xAA, 0x67,
+	0x61, 0x22, 0xE8, 0xEE, 0x95, 0x73, 0x77, 0xFF,
+	0xD2, 0x6F, 0xFA, 0x0E, 0xE2, 0xDD, 0x73, 0x69,
+	0xDA, 0xCA, 0xCC, 0x00, 0x1B, 0xF8, 0xED, 0xD2,
+	0xE2, 0xBC, 0x61, 0xB3, 0xB3, 0x41, 0xAB, 0xB0,
+	0xAB, 0x8F, 0xD1, 0xA0, 0xF7, 0xE6, 0x82, 0xB1,
+	0x81, 0x76, 0x03, 0xE4, 0x7A, 0xFF, 0x26, 0xA8,
+	0xEE, 0x6D, 0xC0, 0xEB, 0x04, 0x0E, 0x7E, 0x07,
+	0xAD, 0xBF, 0x24, 0x80, 0xE9, 0x9E, 0xD4, 0x9E,
+	0xF2, 0x23, 0xF6, 0x13, 0x73, 0xB2, 0xB8, 0x0B,
+	0x34, 0x55, 0x90, 0xCC, 0x52, 0x3B, 0x4F, 0xCB,
+	0xC2, 0x10, 0x3E, 0xA6, 0x1C, 0x75, 0x0B, 0x2D,
+	0x09, 0xC7, 0x31, 0x49, 0x67, 0xFB, 0xDB, 0xA5,
+	0xEB, 0x75, 0xB8, 0x88, 0x3E, 0x2A, 0xDA, 0x95,
+	0x6F, 0x0E, 0x32, 0x9C, 0xDE, 0xD6, 0xA8, 0x05,
+	0xC3, 0x44, 0xCB, 0x46, 0xC9, 0xA4, 0x54, 0xB3,
+	0xAA, 0xBE, 0x63, 0x33, 0x74, 0xDF, 0x71, 0x3A,
+	0x05, 0x35, 0x3B, 0x34, 0x77, 0x77, 0x91, 0x89,
+	0x17, 0xFC, 0x35, 0xA2, 0xAE, 0xBB, 0x5F, 0x13,
+	0xC2, 0x4D, 0x87, 0xD0, 0xF9, 0xDA, 0x35, 0xFC,
+	0x82, 0xD9, 0x85, 0x5D, 0x1B, 0x43, 0xBE, 0x1B,
+	0x79, 0xD0, 0xFB, 0xE5, 0x8F, 0x4D, 0x3A, 0x6E,
+	0xED, 0xE8, 0x29, 0xB5, 0x96, 0x43, 0x6C, 0xC8,
+	0x99, 0xC8, 0xA8, 0x1C, 0xAD, 0x85, 0xB0, 0xF8,
+	0x97, 0x2B, 0x8B, 0x23, 0x6C, 0xC7, 0x07, 0xCA,
+	0x99, 0xFF, 0xFC, 0x43, 0x1F, 0x24, 0x95, 0x4A,
+	0xAB, 0x81, 0x1E, 0xE8, 0x55, 0xCA, 0x9B, 0x63,
+	0x40, 0xB0, 0x47, 0xAA, 0x55, 0x1C, 0xA9, 0x4C,
+	0x0B, 0x9A, 0x1F, 0x15, 0xF9, 0xB5, 0xC6, 0xAF,
+	0x7E, 0xC5, 0x00, 0xBE, 0x60, 0xB5, 0xBF, 0xCF,
+	0xEC, 0x12, 0x9F, 0xA2, 0xB9, 0xCD, 0x9E, 0xD8,
+	0x80, 0x49, 0x94, 0xCC, 0x44, 0x9F, 0x38, 0xE1,
+	0x21, 0x57, 0x3F, 0xE1, 0x80, 0x83, 0x5B, 0xC9,
+	0xFA, 0x62, 0x0D, 0x58, 0x77, 0x42, 0xAB, 0xD9,
+	0x7B, 0x4F, 0xAD, 0x96, 0x13, 0xBE, 0x37, 0x76,
+	0xDB, 0xD3, 0xD5, 0x82, 0x07, 0xE6, 0x8C, 0xD2,
+	0x4B, 0x67, 0x60, 0x03, 0x49, 0x3C, 0x61, 0x03,
+	0x1E, 0x05, 0x65, 0x18, 0xE2, 0xB7, 0x5B, 0x9A,
+	0xD0, 0xFC, 0x5F, 0x4D, 0x25, 0xBA, 0xC9, 0xE8,
+	0xCD, 0x9C, 0x4B, 0x39, 0x1F, 0x4B, 0xCC, 0x1B,
+	0x1C, 0x7D, 0xCA, 0x18, 0xD6, 0xFF, 0xC2, 0x5C,
+	0xE0, 0x00, 0xB3, 0x66, 0x01, 0x25, 0x1B, 0x04,
+	0x69, 0x93, 0x04, 0x6C, 0x94, 0x95, 0x34, 0xD9,
+	0x36, 0x07, 0x17, 0x79, 0x63, 0x2C, 0x40, 0x68,
+	0x44, 0x48, 0x5B, 0xC1, 0xD9, 0x7D, 0x06, 0xEF,
+	0x3A, 0x95, 0x15, 0xE0, 0x97, 0x11, 0x4D, 0x3B,
+	0x31, 0xF1, 0x79, 0xA0, 0x68, 0x9F, 0xED, 0x26,
+	0xD9, 0x73, 0x28, 0x98, 0xBC, 0x75, 0xC2, 0xAE,
+	0x7E, 0xA8, 0xDB, 0xB5, 0x18, 0xB7, 0x66, 0x43,
+	0x9A, 0x4D, 0xE2, 0x43, 0x28, 0x02, 0x1C, 0x7D,
+	0xCE, 0x07, 0xEC, 0xA7, 0xEE, 0x6A, 0xC4, 0x40,
+	0x77, 0xFB, 0xD4, 0x84, 0x91, 0x24, 0xEC, 0xB0,
+	0x6F, 0xA1, 0x3C, 0x8A, 0xDC, 0xB0, 0xE7, 0xC7,
+	0x6A, 0xFA, 0x8E, 0xF2, 0x27, 0xC7, 0x3B, 0x28,
+	0x8F, 0x3A, 0x29, 0x1C, 0x47, 0x53, 0xD1, 0x4B,
+	0x30, 0xFE, 0x8D, 0xF2, 0x33, 0x99, 0x3A, 0x58,
+	0x92, 0x36, 0xBB, 0x0C, 0x4F, 0xDB, 0x23, 0x63,
+	0x9E, 0xA5, 0x07, 0x94, 0xD2, 0x6C, 0x22, 0xE9,
+	0xB5, 0x98, 0x3F, 0x5F, 0xD1, 0xD7, 0x0A, 0x08,
+	0xE6, 0xAB, 0xA1, 0x9C, 0xF6, 0x6A, 0x96, 0xA7,
+	0x1B, 0xF9, 0xC5, 0xD6, 0x09, 0x21, 0xAE, 0xF9,
+	0x62, 0x7E, 0xA7, 0x72, 0x57, 0x09, 0xD1, 0xBC,
+	0xE8, 0xCA, 0xA6, 0x9E, 0x67, 0x9F, 0xAE, 0xD9,
+	0x76, 0xD9, 0x0F, 0x02, 0xB3, 0x70, 0xB9, 0xC5,
+	0x50, 0xDE, 0x36, 0x5E, 0x50, 0x14, 0x65, 0x45,
+	0x97, 0x11, 0x74, 0xD0, 0xFA, 0x06, 0xF6, 0xAD,
+	0x50, 0xE2, 0xFE, 0x13, 0x75, 0x19, 0xEA, 0x11,
+	0x55, 0x5A, 0x27, 0x97, 0x74, 0x42, 0x71, 0x7A,
+	0x21, 0x1D, 0xEA, 0x98, 0x0B, 0xD4, 0xBD, 0x35,
+	0x84, 0x72, 0x57, 0x01, 0x9A, 0xB0, 0x48, 0x42,
+	0x9D, 0xF1, 0x16, 0x29, 0x2B, 0x93, 0x7F, 0x33,
+	0x2A, 0xFA, 0xE5, 0x0D, 0x9A, 0xCF, 0x6C, 0xBF,
+	0xFF, 0x6A, 0xAF, 0x9E, 0x6B, 0x20, 0x15, 0x36,
+	0xE1, 0xE5, 0xF1, 0x14, 0x9A, 0xBC, 0xD4, 0xEC,
+	0xEE, 0x76, 0x86, 0xCB, 0xF3, 0xFF, 0xD2, 0xDE,
+	0x37, 0x1C, 0x0E, 0x88, 0xAF, 0x28, 0x4B, 0x07,
+	0x26, 0xAF, 0xCC, 0x16, 0x46, 0x97, 0xDD, 0x5D,
+	0x14, 0xFC, 0x34, 0xB7, 0xD2, 0x5B, 0x02, 0xD1,
+	0xB9, 0x1C, 0xDB, 0xB7, 0xD8, 0xFB, 0xC4, 0x5F,
+	0xA4, 0x13, 0x54, 0xF6, 0xA0, 0x99, 0x74, 0x12,
+	0x0A, 0x17, 0xF6, 0x4D, 0x93, 0x3C, 0x97, 0x9A,
+	0xAE, 0x83, 0x63, 0x2D, 0x60, 0x9C, 0xE9, 0xBC,
+	0xF4, 0x87, 0x12, 0x4C, 0xB7, 0x20, 0x1B, 0xD3,
+	0xF4, 0x09, 0x15, 0x42, 0x58, 0x2D, 0x07, 0x69,
+	0x2A, 0x4B, 0x53, 0x63, 0xDE, 0xD5, 0x2E, 0x27,
+	0x45, 0xCD, 0x76, 0xC2, 0x84, 0xBA, 0xB1, 0x9A,
+	0x02, 0x29, 0x6B, 0x7C, 0x31, 0xBD, 0xD7, 0xD4,
+	0xE8, 0x68, 0x58, 0xBF, 0x28, 0x53, 0x1C, 0xEB,
+	0xC9, 0x2C, 0xF3, 0x24, 0x2E, 0xB7, 0x57, 0x26,
+	0xE0, 0xE5, 0xC5, 0xF4, 0x3E, 0x19, 0x2A, 0x9D,
+	0xFD, 0xC0, 0xEE, 0xE5, 0x85, 0x4A, 0x1F, 0xA9,
+	0xA1, 0x21, 0xFB, 0x8C, 0xB8, 0xA4, 0x8B, 0x79,
+	0xFD, 0x95, 0x3A, 0xF7, 0xD7, 0x6F, 0x21, 0x42,
+	0x48, 0xDD, 0x2D, 0xE6, 0x41, 0xA1, 0xA2, 0x42,
+	0x04, 0x6A, 0x9B, 0x7F, 0xCE, 0xD7, 0xC8, 0x2F,
+	0x16, 0xAB, 0xD9, 0xB2, 0x30, 0x29, 0x6F, 0x54,
+	0x1B, 0x74, 0x92, 0xF8, 0x7C, 0xFD, 0xA0, 0xB0,
+	0x02, 0xD9, 0x41, 0x79, 0x63, 0x76, 0xCE, 0x3E,
+	0x60, 0x11, 0xC8, 0x9B, 0xE7, 0x36, 0xCA, 0x51,
+	0x50, 0x5F, 0x51, 0xDA, 0x28, 0x03, 0xE9, 0x3B,
+	0xBE, 0x5A, 0x26, 0xE8, 0xB4, 0x75, 0xF1, 0x1A,
+	0x01, 0xE6, 0x23, 0x78, 0xFF, 0x11, 0x02, 0x6E,
+	0x82, 0x77, 0x17, 0x66, 0xC9, 0x86, 0x91, 0xED,
+	0x0E, 0x07, 0xF8, 0x02, 0x62, 0xD8, 0xB6, 0xA5,
+	0x5A, 0x2B, 0x8C, 0x23, 0xE2, 0x7A, 0x7B, 0x53,
+	0x20, 0x81, 0x05, 0x5D, 0xE2, 0x52, 0xF2, 0xB0,
+	0x95, 0x2B, 0x12, 0x2D, 0xEC, 0xE9, 0xBA, 0x96,
+	0xF0, 0xC9, 0xC7, 0xB2, 0xDD, 0x35, 0x3B, 0xB4,
+	0x62, 0x5C, 0xEC, 0xDF, 0x05, 0xA0, 0xA0, 0x9C,
+	0xE3, 0x07, 0xD6, 0x21, 0xC5, 0x34, 0xFE, 0xB2,
+	0x7C, 0x1E, 0xB0, 0x8C, 0x4E, 0x22, 0x7B, 0xC6,
+	0x97, 0x34, 0x96, 0x22, 0x73, 0x77, 0x0D, 0x6E,
+	0x95, 0x5F, 0xE7, 0xDF, 0x27, 0x72, 0x14, 0x74,
+	0x18, 0xD8, 0xDD, 0x53, 0xC2, 0x02, 0x8D, 0x0B,
+	0x6B, 0x51, 0x08, 0xB2, 0xC8, 0xDD, 0xBC, 0x5D,
+	0xCF, 0x2E, 0x7E, 0xC0, 0xF7, 0x77, 0xB7, 0xED,
+	0x09, 0xCB, 0x80, 0x9F, 0xF2, 0x39, 0xF5, 0x09,
+	0x2D, 0x5D, 0x96, 0xD8, 0xF5, 0x9F, 0xAA, 0xBC,
+	0x96, 0x37, 0x32, 0xF7, 0xE0, 0xBB, 0x5F, 0x73,
+	0x38, 0x77, 0x63, 0x04, 0x6C, 0x27, 0x4A, 0xE0,
+	0x07, 0xC2, 0x47, 0xAB, 0x3A, 0x6C, 0xAF, 0x1D,
+	0x32, 0x7B, 0x59, 0x0C, 0xF0, 0x4D, 0xB9, 0x1D,
+	0x25, 0xAE, 0x32, 0x97, 0xF1, 0x3D, 0x4D, 0x0F,
+	0x1C, 0xF5, 0x96, 0x37, 0x92, 0xF0, 0x24, 0xBE,
+	0xF6, 0x0E, 0xC2, 0x4A, 0x38, 0x43, 0xCF, 0x17,
+	0x67, 0x95, 0x58, 0x15, 0x49, 0xF1, 0x21, 0x8E,
+	0x6E, 0x37, 0x24, 0x30, 0xBF, 0x15, 0xE7, 0x0F,
+	0x5D, 0x07, 0x3F, 0xDC, 0x66, 0x70, 0x10, 0x00,
+	0xB5, 0x97, 0x06, 0x88, 0xD2, 0x58, 0xBF, 0x05,
+	0x05, 0x05, 0x88, 0x81, 0x79, 0x5D, 0xC1, 0xDD,
+	0x2A, 0x34, 0x5A, 0x31, 0x76, 0x91, 0x58, 0xEA,
+	0xF8, 0x0A, 0x29, 0xFB, 0x9F, 0x45, 0x55, 0xC3,
+	0xD2, 0x38, 0x92, 0xF2, 0xA1, 0xB6, 0x2B, 0x12,
+	0x17, 0x9E, 0x4A, 0xF9, 0x11, 0x18, 0xA6, 0xA1,
+	0x5A, 0xBB, 0xF5, 0xD1, 0xC8, 0x60, 0x27, 0x70,
+	0x8A, 0x5C, 0x45, 0x4E, 0xFA, 0xD8, 0x03, 0x95,
+	0xC0, 0x86, 0xF3, 0x9F, 0x8C, 0xDD, 0xD3, 0x97,
+	0xEB, 0xAF, 0xB6, 0x95, 0x6A, 0xBD, 0xAD, 0xE1,
+	0xF3, 0x89, 0x3F, 0x5B, 0x35, 0xB0, 0x7C, 0x07,
+	0x6A, 0xD0, 0x0D, 0x95, 0x15, 0x93, 0x94, 0x18,
+	0x9E, 0xB8, 0xD8, 0xB0, 0x12, 0x27, 0xC1, 0x4E,
+	0x6F, 0xAD, 0x2C, 0xAF, 0x62, 0xEC, 0xAF, 0x85,
+	0x61, 0x52, 0x4B, 0x66, 0xA2, 0x5E, 0x5E, 0xB2,
+	0xB8, 0x98, 0x0B, 0x6F, 0x02, 0xA4, 0x83, 0xF1,
+	0x29, 0x0D, 0x72, 0xA4, 0x9C, 0x7E, 0xE8, 0x14,
+	0xB4, 0xA9, 0x61, 0xBB, 0x57, 0x43, 0x3D, 0x16,
+	0xEE, 0xCC, 0x7D, 0xA1, 0xA4, 0xBA, 0x20, 0xDB,
+	0x3B, 0xDA, 0x65, 0xC7, 0x94, 0x1E, 0x2E, 0xE3,
+	0xB1, 0xBC, 0x96, 0x05, 0x35, 0x23, 0x41, 0xDD,
+	0xE1, 0x1D, 0xE9, 0x90, 0xD7, 0x3D, 0x96, 0xEE,
+	0x5F, 0x36, 0x31, 0xAA, 0x67, 0x81, 0x5A, 0x2A,
+	0xCF, 0xD0, 0xC3, 0x30, 0x89, 0x53, 0x9A, 0x80,
+	0xA6, 0xA8, 0xB4, 0x3B, 0xB8, 0x03, 0x88, 0x7B,
+	0x59, 0xEA, 0xAD, 0x29, 0xCF, 0xD9, 0xC7, 0x22,
+	0x3D, 0x59, 0xDB, 0xE6, 0xD9, 0x6F, 0xB1, 0x32,
+	0xC0, 0xD8, 0x35, 0x7C, 0xEF, 0x83, 0x92, 0xF6,
+	0x3D, 0xE0, 0x7A, 0xB7, 0x7C, 0x51, 0x73, 0x12,
+	0xDB, 0x83, 0x8D, 0x1F, 0xD5, 0x22, 0xAD, 0xE7,
+	0x92, 0x5F, 0xD3, 0xB9, 0x6C, 0x7E, 0xC3, 0x8A,
+	0xF4, 0x71, 0x00, 0x93, 0x65, 0x55, 0x5B, 0xAB,
+	0x05, 0xCF, 0x3F, 0xE5, 0x49, 0x3A, 0x7E, 0x19,
+	0x6E, 0xBC, 0xBD, 0x7E, 0xCB, 0x0D, 0xCC, 0x72,
+	0x67, 0xE2, 0x2B, 0x0E, 0x45, 0x34, 0xD5, 0x1D,
+	0x87, 0xEA, 0x36, 0x6D, 0x82, 0xEB, 0x0F, 0xA8,
+	0x41, 0xAF, 0xC1, 0x40, 0x59, 0xFA, 0x7C, 0x0F,
+	0xD1, 0xE4, 0xA6, 0x15, 0x62, 0x61, 0xFC, 0x44,
+	0x35, 0x73, 0x0D, 0xE7, 0x09, 0xC1, 0x2A, 0x34,
+	0x9D, 0x71, 0x27, 0x58, 0x46, 0x28, 0xE9, 0xE5,
+	0x8E, 0xDE, 0x7F, 0x86, 0xD2, 0xFF, 0x71, 0xA1,
+	0xE2, 0x79, 0x72, 0x52, 0xF7, 0x3C, 0x4A, 0xB0,
+	0xE8, 0xF1, 0xC8, 0x3B, 0x5A, 0x50, 0xD9, 0x22,
+	0xA0, 0xAC, 0x9D, 0x1D, 0xB0, 0x83, 0xC8, 0xCD,
+	0x65, 0x6F, 0xBC, 0xE7, 0x88, 0x5F, 0x2B, 0xC1,
+	0x7F, 0x8D, 0x00, 0x62, 0x1D, 0xB6, 0xAB, 0x58,
+	0x62, 0xAA, 0x02, 0xBD, 0x66, 0xF6, 0x81, 0x72,
+	0x64, 0xCE, 0xDE, 0xF9, 0x63, 0x17, 0x29, 0x75,
+	0x9F, 0xCE, 0xD1, 0xCD, 0xD2, 0xBA, 0x91, 0x4B,
+	0x19, 0xBF, 0x20, 0xE4, 0x31, 0x56, 0xFA, 0x43,
+	0xB3, 0x22, 0x02, 0x99, 0x29, 0x9D, 0x78, 0x79,
+	0x83, 0x24, 0x85, 0x61, 0x12, 0x77, 0x73, 0xBD,
+	0x4C, 0x86, 0x8C, 0x38, 0x24, 0xF4, 0x73, 0xFA,
+	0x78, 0x2A, 0x06, 0xC9, 0x6A, 0x74, 0xDB, 0x3D,
+	0xB1, 0xB7, 0xC6, 0xCE, 0xE5, 0xCB, 0xB1, 0x88,
+	0xBB, 0xF5, 0x88, 0xCB, 0x40, 0x60, 0x16, 0x76,
+	0x62, 0xB2, 0xD0, 0x27, 0x0B, 0x6F, 0x2D, 0x28,
+	0x73, 0x0F, 0x83, 0xD4, 0xDB, 0x2F, 0xEC, 0xF5,
+	0x14, 0xFF, 0x2B, 0xB6, 0xEC, 0x91, 0xD2, 0x00,
+	0x4C, 0x10, 0xFD, 0xB2, 0x39, 0x39, 0x59, 0x0F,
+	0xB8, 0x97, 0x30, 0xD3, 0xAC, 0x38, 0xBF, 0x75,
+	0xEB, 0xD9, 0x04, 0x28, 0xC5, 0x16, 0x4D, 0x56,
+	0x1F, 0xE9, 0x62, 0xC4, 0xC8, 0x0D, 0x91, 0x03,
+	0xF4, 0x19, 0x30, 0x0F, 0xFA, 0xBC, 0x8C, 0xAB,
+	0xE0, 0xD8, 0xA7, 0x2D, 0xB7, 0xE3, 0xAB, 0x28,
+	0x9C, 0xBC, 0x87, 0x22, 0xFD, 0x47, 0x25, 0xE6,
+	0xD1, 0x03, 0x33, 0x52, 0x92, 0x7C, 0xE6, 0x9A,
+	0xBE, 0x80, 0xAC, 0x26, 0x3F, 0xAE, 0x64, 0xA4,
+	0x78, 0x67, 0xF2, 0xDC, 0xEA, 0x3F, 0x47, 0xE7,
+	0x24, 0x4C, 0xE4, 0x8D, 0xB3, 0x29, 0xF6, 0xB7,
+	0x40, 0x4F, 0xFD, 0xAE, 0x1E, 0xE9, 0xED, 0x63,
+	0x9F, 0xD3, 0x72, 0x92, 0xCF, 0xE2, 0xE4, 0x1E,
+	0x1F, 0xB6, 0x86, 0x1A, 0x93, 0x64, 0xF3, 0xC0,
+	0x7A, 0xA9, 0x5D, 0xDB, 0x26, 0x79, 0xDC, 0x0A,
+	0x12, 0xA5, 0x72, 0xDB, 0xE6, 0x3A, 0xAB, 0xEA,
+	0x29, 0x81, 0xF4, 0x1B, 0xC3, 0x1F, 0x95, 0xA6,
+	0xBC, 0x69, 0xBF, 0x52, 0x84, 0x8C, 0x84, 0xEE,
+	0xD6, 0xA6, 0xB2, 0xF2, 0xA1, 0x59, 0xF4, 0x79,
+	0x21, 0xB5, 0x16, 0x90, 0xFB, 0xE4, 0x5B, 0x2F,
+	0x7E, 0xF2, 0xEC, 0x31, 0xE7, 0xE3, 0x9F, 0xAC,
+	0x0E, 0x36, 0xEB, 0xEB, 0x62, 0x6E, 0x74, 0x07,
+	0xD7, 0xF4, 0xB8, 0x19, 0xE7, 0x8F, 0x5A, 0xE5,
+	0x9F, 0x5D, 0x92, 0x8A, 0xE6, 0xD5, 0xD6, 0x66,
+	0x81, 0xC9, 0x9B, 0x3C, 0x00, 0xD5, 0x99, 0xCA,
+	0x7D, 0x56, 0x44, 0x9B, 0xA7, 0x52, 0x46, 0x86,
+	0x5E, 0x8A, 0x72, 0x9F, 0xF7, 0x6B, 0x5C, 0x3C,
+	0x26, 0x7A, 0x42, 0x20, 0x9C, 0x97, 0x68, 0x50,
+	0xD2, 0x4D, 0xDA, 0x02, 0x42, 0x1A, 0x84, 0x35,
+	0xED, 0x0F, 0x00, 0x34, 0x4B, 0xF4, 0x17, 0x0F,
+	0x04, 0xF4, 0xC2, 0xF3, 0xD9, 0xE5, 0x14, 0x2A,
+	0x96, 0xAC, 0xCE, 0x71, 0x5A, 0xAE, 0x8C, 0xC9,
+	0x07, 0xA2, 0x80, 0xDA, 0xFD, 0xB6, 0x64, 0xAD,
+	0x7C, 0x88, 0x4E, 0x91, 0x7B, 0x97, 0xCF, 0x34,
+	0x73, 0xC8, 0x34, 0x4C, 0xF4, 0xFD, 0xBF, 0xBB,
+	0xE5, 0x01, 0xBC, 0x16, 0xEA, 0xBC, 0x08, 0xEC,
+	0x07, 0x4D, 0x36, 0x74, 0x12, 0x0E, 0xC7, 0xBE,
+	0xF6, 0xC2, 0x87, 0x21, 0xA8, 0xF2, 0x4A, 0xC4,
+	0xA5, 0xF8, 0x98, 0x42, 0x84, 0x70, 0x7D, 0xBE,
+	0x68, 0x09, 0x6A, 0x72, 0x7E, 0xD2, 0x38, 0xEE,
+	0x1B, 0xC7, 0x13, 0x5F, 0x02, 0x6D, 0x5A, 0x3C,
+	0xBB, 0xD6, 0xD5, 0x4C, 0xDF, 0x92, 0x05, 0x9F,
+	0xA9, 0x7F, 0xF1, 0xD9, 0xEC, 0xF2, 0x40, 0xE9,
+	0xB9, 0xD3, 0xE6, 0xBD, 0x3C, 0xE0, 0xF6, 0xBA,
+	0x06, 0x10, 0xDE, 0x28, 0xB2, 0x1F, 0x6A, 0xFB,
+	0xAB, 0x82, 0xB2, 0x1C, 0x7F, 0x38, 0x67, 0xA1,
+	0xC7, 0x75, 0xEC, 0x5A, 0x92, 0xDA, 0xA5, 0x87,
+	0x95, 0x3A, 0xE2, 0xF9, 0xD9, 0xBC, 0x4D, 0x83,
+	0x0F, 0x81, 0x49, 0x80, 0x8F, 0x6D, 0x4A, 0xD7,
+	0xBC, 0x57, 0x2F, 0xA3, 0xCE, 0xE9, 0x7D, 0x41,
+	0xD3, 0xBD, 0x62, 0x48, 0xCA, 0x7F, 0xD7, 0x63,
+	0x43, 0x33, 0x8E, 0xA9, 0x4D, 0x43, 0x3E, 0xC6,
+	0x49, 0xDA, 0x24, 0xA2, 0xFC, 0xEE, 0x8C, 0x4A,
+	0xA8, 0x14, 0xAF, 0x6D, 0xA8, 0xAD, 0x75, 0x05,
+	0x97, 0x3B, 0x37, 0xB0, 0x83, 0x7C, 0x0E, 0x73,
+	0x7D, 0x29, 0x52, 0x35, 0xD0, 0x4C, 0xD2, 0x63,
+	0x06, 0x31, 0xDC, 0xB5, 0x22, 0x9E, 0x03, 0x10,
+	0xED, 0xBA, 0x45, 0x5E, 0x91, 0xE8, 0x72, 0xD7,
+	0x71, 0xF3, 0xCD, 0xBE, 0x44, 0x35, 0xB8, 0x12,
+	0xAC, 0x84, 0x7F, 0x94, 0xE2, 0x25, 0x8C, 0xE9,
+	0x96, 0xFF, 0x42, 0x98, 0xBB, 0x36, 0x84, 0xD1,
+	0x1C, 0xFE, 0x96, 0xAA, 0x69, 0x4F, 0x19, 0xCD,
+	0xD1, 0x01, 0xAB, 0xA3, 0x2D, 0x4A, 0xA4, 0xC4,
+	0xB2, 0x4B, 0x16, 0xF5, 0x1C, 0x99, 0xCE, 0x42,
+	0x3C, 0x98, 0x1D, 0x91, 0xD2, 0x94, 0xB6, 0xD1,
+	0xD4, 0xFA, 0x2D, 0x30, 0x7B, 0xAC, 0x32, 0x81,
+	0x3A, 0x3D, 0x6E, 0x02, 0xE6, 0x41, 0x6C, 0x81,
+	0xC8, 0xDC, 0xC5, 0x01, 0xAB, 0xBB, 0xBE, 0x92,
+	0xF1, 0x16, 0x9D, 0x8F, 0xC1, 0x62, 0x1F, 0x27,
+	0xEB, 0x25, 0xF1, 0x76, 0x4D, 0x65, 0x14, 0x9C,
+	0x41, 0xAB, 0x6B, 0x51, 0x9D, 0xFA, 0x20, 0x5B,
+	0xE7, 0x87, 0xDE, 0x93, 0x97, 0x51, 0xF6, 0x16,
+	0xF7, 0xC4, 0xA0, 0xB9, 0xA8, 0x58, 0x51, 0x4F,
+	0x61, 0x51, 0x02, 0x8C, 0x19, 0xAA, 0xA6, 0xB1,
+	0x4D, 0x2A, 0x07, 0x7C, 0xC0, 0xDA, 0x67, 0x8C,
+	0x7D, 0xFD, 0x28, 0xC2, 0x18, 0x00, 0xF0, 0x97,
+	0x3C, 0xAE, 0xB4, 0x1A, 0xFC, 0x38, 0x4D, 0x51,
+	0x6F, 0x0F, 0x72, 0x88, 0x3F, 0xDC, 0x86, 0xF5,
+	0xFA, 0x13, 0xCD, 0x98, 0x8B, 0x51, 0xF2, 0xBD,
+	0xA9, 0x4F, 0x04, 0x24, 0xBD, 0x84, 0x46, 0x24,
+	0xFB, 0x7A, 0x30, 0x8A, 0x8A, 0x52, 0xE8, 0xCC,
+	0x88, 0x75, 0xD4, 0xC0, 0x8C, 0xA5, 0x31, 0x96,
+	0xAD, 0xBF, 0x49, 0x9C, 0x0F, 0x94, 0x5B, 0x3B,
+	0x09, 0x41, 0xED, 0x28, 0x13, 0x3E, 0x69, 0x2D,
+	0xE8, 0xEE, 0x49, 0x5D, 0x73, 0x77, 0xAC, 0xB8,
+	0xD2, 0x76, 0xD1, 0xA1, 0x72, 0x84, 0x57, 0x80,
+	0x06, 0x0E, 0x1E, 0x1F, 0xEB, 0x5A, 0x9D, 0xB7,
+	0x06, 0xF8, 0x67, 0x7E, 0xE2, 0xF5, 0x4D, 0x68,
+	0x66, 0x05, 0xE9, 0x53, 0xDA, 0xF6, 0xAC, 0xE9,
+	0x2B, 0xF0, 0xF1, 0x3B, 0x80, 0x30, 0x1B, 0x4D,
+	0xF6, 0xD2, 0xCA, 0xCE, 0x90, 0x92, 0xBF, 0x7D,
+	0x13, 0x5A, 0x9A, 0x17, 0x49, 0x3A, 0x4C, 0x3F,
+	0xB0, 0x20, 0x35, 0x90, 0x49, 0x35, 0x7D, 0xDE,
+	0x68, 0x43, 0x2B, 0x29, 0xE9, 0x39, 0xA4, 0x6F,
+	0x2F, 0x9A, 0xA2, 0x08, 0x5C, 0x5C, 0x42, 0xFE,
+	0x9D, 0xE3, 0xC8, 0xE5, 0x71, 0xCC, 0x1E, 0x71,
+	0x1E, 0xE2, 0xEA, 0x90, 0x37, 0x6C, 0x80, 0x0E,
+	0xF8, 0xB1, 0x90, 0xEC, 0x94, 0xA9, 0xC7, 0xD7,
+	0x0E, 0xBD, 0x23, 0x6D, 0x2A, 0x9B, 0xC8, 0xD3,
+	0x3C, 0xF1, 0xB3, 0x9D, 0x8F, 0x60, 0xEE, 0xE1,
+	0x7E, 0xA0, 0xB5, 0x67, 0x8B, 0x90, 0x48, 0x9C,
+	0x50, 0x69, 0xFC, 0xC5, 0xD3, 0x41, 0x7A, 0x39,
+	0x7E, 0x2D, 0x73, 0x4E, 0xED, 0x8F, 0x51, 0x45,
+	0xD0, 0xC0, 0xC5, 0xC5, 0x46, 0x10, 0x4C, 0xF6,
+	0x06, 0xCA, 0xB7, 0x75, 0x81, 0x58, 0xEE, 0xBA,
+	0xBF, 0xB2, 0xAA, 0xAA, 0xE4, 0x27, 0xF7, 0x8B,
+	0xCC, 0xD5, 0x07, 0xBB, 0xD5, 0x26, 0x1F, 0xCA,
+	0x93, 0xF6, 0x7F, 0x19, 0xAB, 0x6F, 0x60, 0x77,
+	0x5B, 0x25, 0x10, 0xAF, 0x97, 0xC1, 0x21, 0x11,
+	0x19, 0xFC, 0x5D, 0x53, 0x18, 0x6C, 0x00, 0x24,
+	0xD2, 0x55, 0xE4, 0x40, 0x09, 0xB5, 0x0C, 0x64,
+	0xC6, 0x19, 0x2C, 0xF6, 0x92, 0x69, 0x19, 0xF9,
+	0x79, 0x12, 0x26, 0x7A, 0x38, 0xFF, 0x3E, 0x2D,
+	0xB9, 0xE8, 0x73, 0xE9, 0xF3, 0x7E, 0x60, 0x08,
+	0xA5, 0xE4, 0x5E, 0xD1, 0x09, 0x07, 0x41, 0x00,
+	0x01, 0xF0, 0xED, 0xF6, 0x56, 0x89, 0x2E, 0xAE,
+	0xCC, 0xE5, 0xDC, 0x9E, 0x1A, 0x39, 0xF4, 0x49,
+	0xE2, 0x7D, 0xEB, 0x62, 0xE6, 0xAD, 0x0B, 0x31,
+	0x4F, 0x25, 0x1A, 0x89, 0x10, 0xD0, 0x44, 0x61,
+	0x2F, 0x40, 0x84, 0xE5, 0xC7, 0xD9, 0x3F, 0x98,
+	0x27, 0xCD, 0x89, 0x1E, 0xCA, 0xF7, 0x2A, 0x0E,
+	0x5F, 0xCC, 0x0D, 0x23, 0x48, 0xF5, 0xEE, 0x65,
+	0xDF, 0x7B, 0x07, 0xB3, 0xBA, 0xF7, 0xCD, 0x46,
+	0xBA, 0xB1, 0x29, 0x06, 0x57, 0x8A, 0x29, 0x6F,
+	0x47, 0xCF, 0x79, 0x6C, 0x0B, 0xD6, 0x21, 0x1A,
+	0x59, 0x25, 0x05, 0x71, 0x3F, 0xDD, 0x2B, 0x30,
+	0x5B, 0x10, 0xB9, 0x23, 0x42, 0xDF, 0xE9, 0xA4,
+	0x9D, 0x47, 0x7D, 0x7E, 0xCE, 0x01, 0x58, 0x64,
+	0x9E, 0xC5, 0x33, 0xC1, 0x75, 0x9F, 0x4E, 0x20,
+	0xA0, 0x72, 0x64, 0x52, 0xD2, 0x41, 0x80, 0x23,
+	0x06, 0xB5, 0xCB, 0xCE, 0xB9, 0x71, 0x03, 0xAF,
+	0xA3, 0x15, 0x2B, 0x07, 0xD3, 0xB7, 0xC0, 0xFE,
+	0x45, 0x98, 0x2C, 0x22, 0x7C, 0xF8, 0x8F, 0x49,
+	0x85, 0x2D, 0xBD, 0xF3, 0x15, 0x9F, 0x39, 0x3A,
+	0x5C, 0x4E, 0x0A, 0xE0, 0x38, 0x16, 0x61, 0x56,
+	0x88, 0xD7, 0x33, 0x00, 0x61, 0xA0, 0x57, 0x8C,
+	0x1A, 0x77, 0xCF, 0x94, 0x06, 0x60, 0xB2, 0x1F,
+	0xD5, 0xFB, 0xF1, 0x6C, 0xE3, 0x7C, 0x9C, 0xEC,
+	0xA1, 0x6E, 0x40, 0x8F, 0x16, 0x39, 0x6F, 0x03,
+	0xCB, 0xC2, 0x1D, 0x86, 0xB3, 0x97, 0xEF, 0xF6,
+	0x4D, 0xD9, 0xB9, 0x92, 0x08, 0xB5, 0xF3, 0x23,
+	0x1B, 0x69, 0x8C, 0xD4, 0x99, 0x05, 0xA5, 0xF0,
+	0xE9, 0xBB, 0xED, 0xAD, 0x8E, 0xD4, 0x26, 0xCB,
+	0x57, 0xF0, 0x9F, 0x7E, 0xA8, 0x8A, 0x32, 0x0E,
+	0x3A, 0x82, 0x90, 0x7C, 0x9F, 0x59, 0xC1, 0x17,
+	0x6F, 0x9A, 0xAE, 0xB3, 0x87, 0x37, 0xA8, 0xAC,
+	0x4A, 0x2B, 0xC6, 0x07, 0xDD, 0x87, 0xBA, 0x43,
+	0x4D, 0xEA, 0x0B, 0xCD, 0xB5, 0xE1, 0x5C, 0x4B,
+	0xFA, 0x1E, 0xAD, 0x31, 0xBA, 0x61, 0xA8, 0xC5,
+	0x11, 0x38, 0x92, 0xC2, 0x35, 0x5F, 0x63, 0x65,
+	0x58, 0xBE, 0x9D, 0xAC, 0x4D, 0xBC, 0xAB, 0x2A,
+	0xCF, 0xC8, 0x76, 0x53, 0x5C, 0xFB, 0xB8, 0xB4,
+	0xB2, 0x80, 0x07, 0x76, 0x09, 0x14, 0xBC, 0x2F,
+	0x9A, 0x2F, 0x6F, 0xB3, 0x46, 0x75, 0x7B, 0xD9,
+	0x51, 0x83, 0x0B, 0xFD, 0x6E, 0xF6, 0xEA, 0x47,
+	0xF5, 0x73, 0x00, 0x41, 0x5C, 0x5D, 0xF8, 0x2D,
+	0x2B, 0x71, 0x7E, 0x49, 0xEE, 0x2F, 0x86, 0xFA,
+	0x7C, 0xD9, 0x68, 0xA0, 0x95, 0x1D, 0x49, 0x0F,
+	0x0F, 0x55, 0x1B, 0x8E, 0x78, 0xC0, 0x0F, 0x0C,
+	0x47, 0x1D, 0x23, 0x31, 0x4B, 0xF3, 0x61, 0x5C,
+	0x66, 0x24, 0x36, 0xD9, 0xF1, 0x1B, 0x55, 0x7C,
+	0x52, 0x9E, 0xE5, 0x32, 0x19, 0x0F, 0x0A, 0x85,
+	0xBC, 0x4B, 0xC0, 0xDB, 0xC0, 0x9F, 0x04, 0x1F,
+	0xE7, 0xEA, 0xFC, 0x37, 0x5B, 0xB4, 0x85, 0x93,
+	0x14, 0xBD, 0x9A, 0xAF, 0x2F, 0x6A, 0xD7, 0xA2,
+	0x59, 0xF6, 0xF7, 0x5C, 0x1A, 0xFD, 0xAE, 0x91,
+	0xC8, 0x34, 0xD2, 0x70, 0xE4, 0x7C, 0xCE, 0xA9,
+	0x1F, 0x3D, 0x84, 0xE0, 0xCE, 0xF8, 0x21, 0x55,
+	0x3C, 0x67, 0x2D, 0x81, 0x31, 0x4B, 0x01, 0xA5,
+	0xBF, 0xBC, 0x32, 0x53, 0xE3, 0xB2, 0xAA, 0x87,
+	0x41, 0x7F, 0xF5, 0x77, 0x07, 0x49, 0xAC, 0x65,
+	0xCD, 0x42, 0xFD, 0xCF, 0x93, 0xE9, 0x37, 0x93,
+	0x7C, 0xB3, 0x31, 0xC7, 0x86, 0x75, 0x7B, 0x22,
+	0xCB, 0xD6, 0x28, 0x0B, 0x57, 0x92, 0x74, 0x29,
+	0xF0, 0x32, 0x7F, 0xED, 0x57, 0x2B, 0x6B, 0xA2,
+	0x3F, 0xFD, 0xED, 0x4D, 0x89, 0xDE, 0xA4, 0xBD,
+	0xD0, 0x2D, 0x83, 0x37, 0x98, 0x79, 0x5F, 0x22,
+	0x5B, 0xAA, 0x78, 0x25, 0x61, 0xF2, 0xF7, 0x55,
+	0x3E, 0xCE, 0xCD, 0xD7, 0xBD, 0x8D, 0x16, 0x19,
+	0xD9, 0x48, 0xEB, 0xDC, 0xDB, 0xD7, 0x84, 0xA2,
+	0xAC, 0xE8, 0x9D, 0x24, 0xEA, 0xEA, 0xC3, 0xC2,
+	0x79, 0x28, 0xDB, 0x23, 0xFF, 0xD6, 0x16, 0xF7,
+	0xF8, 0xC9, 0x97, 0xAD, 0x1E, 0x48, 0x23, 0x9C,
+	0xC2, 0xDC, 0xF1, 0x76, 0xD2, 0x06, 0xC1, 0x2B,
+	0xFF, 0xC1, 0x9E, 0x97, 0x91, 0xB0, 0x54, 0xCC,
+	0xA4, 0xC3, 0x68, 0xAC, 0x52, 0x1B, 0xFC, 0x77,
+	0x78, 0xF1, 0xEF, 0x52, 0x11, 0x14, 0x12, 0x7D,
+	0x93, 0xC6, 0xE9, 0x3A, 0xF1, 0x2A, 0x41, 0xCA,
+	0x70, 0x96, 0x88, 0xEE, 0xB4, 0x4B, 0x63, 0x0F,
+	0x8B, 0xA7, 0x14, 0x27, 0x42, 0xA0, 0x00, 0x50,
+	0xF0, 0x95, 0xB2, 0xE5, 0x9F, 0xBE, 0x9E, 0x0E,
+	0xE5, 0x94, 0xF9, 0xAA, 0x3E, 0x49, 0x2F, 0x55,
+	0xCE, 0xB6, 0xA8, 0xA4, 0x1B, 0x7B, 0xEC, 0x33,
+	0xBB, 0x7B, 0x6D, 0xB4, 0x20, 0x14, 0x14, 0xAB,
+	0x69, 0x4D, 0x14, 0x92, 0x17, 0x34, 0x22, 0xAB,
+	0x04, 0xC4, 0x05, 0x47, 0x0B, 0x8B, 0xB7, 0x17,
+	0x40, 0x89, 0xB4, 0x74, 0x99, 0x33, 0xF4, 0x0C,
+	0x85, 0xFB, 0x04, 0xF3, 0xF6, 0xE0, 0x33, 0x58,
+	0x21, 0xBA, 0xA7, 0xB7, 0xF0, 0x30, 0x50, 0x21,
+	0xD1, 0x65, 0x80, 0xCA, 0xA4, 0x4F, 0x93, 0x21,
+	0x18, 0xBE, 0xD6, 0xFE, 0x01, 0x36, 0x75, 0xE6,
+	0xE1, 0x43, 0xCD, 0xAA, 0x10, 0xA7, 0x97, 0xA6,
+	0x7D, 0xFC, 0x99, 0x8B, 0x91, 0x37, 0x31, 0xC4,
+	0xA3, 0x07, 0x62, 0xD2, 0x52, 0xB9, 0xFA, 0xD8,
+	0x29, 0x87, 0x3A, 0x24, 0x54, 0xAB, 0xE4, 0x71,
+	0xF1, 0x64, 0xF1, 0x69, 0x77, 0x51, 0x7D, 0x22,
+	0x99, 0xBF, 0xCE, 0x91, 0xA4, 0x0B, 0x65, 0x69,
+	0x49, 0x48, 0xAA, 0x53, 0x31, 0x38, 0x72, 0x6E,
+	0x9A, 0x66, 0xE6, 0x98, 0x73, 0x49, 0x0C, 0xC7,
+	0xF9, 0x07, 0xB0, 0xAD, 0x18, 0xCF, 0x6F, 0x41,
+	0x4F, 0xD5, 0x54, 0xFD, 0x6D, 0x87, 0x7F, 0x2E,
+	0x3E, 0xB6, 0x69, 0xB9, 0x33, 0x55, 0x4C, 0x14,
+	0x94, 0x35, 0x18, 0x9D, 0x24, 0xA4, 0x55, 0xC1,
+	0x5B, 0x8E, 0xDD, 0x50, 0x35, 0x6E, 0xEF, 0xDA,
+	0xBB, 0x33, 0x77, 0x13, 0x7E, 0x77, 0x37, 0x59,
+	0x8E, 0xAF, 0xDA, 0x8D, 0x78, 0x18, 0x3A, 0x01,
+	0x5A, 0x7D, 0xE1, 0xA5, 0xC9, 0x13, 0xB0, 0xF5,
+	0xF1, 0x2F, 0x17, 0x1E, 0xDB, 0x86, 0x0D, 0xF6,
+	0x73, 0x18, 0xA2, 0xF5, 0x5A, 0xDB, 0x15, 0x1D,
+	0xF3, 0x73, 0xF1, 0xFD, 0x9A, 0xD0, 0x96, 0xEA,
+	0xAC, 0x98, 0x66, 0xAD, 0x1E, 0x31, 0x55, 0x37,
+	0xB2, 0xAB, 0x3A, 0x06, 0x18, 0xB6, 0xDF, 0xC7,
+	0x2B, 0x79, 0x1E, 0x55, 0x04, 0xB8, 0x53, 0x5B,
+	0x69, 0xCC, 0x9E, 0xE0, 0x41, 0xBD, 0xB2, 0x58,
+	0x28, 0x44, 0xA6, 0xE0, 0x18, 0xD5, 0x06, 0x66,
+	0x27, 0x67, 0x72, 0xDF, 0x67, 0x09, 0x45, 0x7A,
+	0xE8, 0xD4, 0x07, 0x4B, 0x0A, 0x82, 0x08, 0x3F,
+	0xEF, 0xDD, 0xE7, 0x05, 0x9F, 0x5D, 0x1B, 0x21,
+	0x97, 0x50, 0xA9, 0x4C, 0x45, 0xF3, 0x3C, 0x2B,
+	0x56, 0x6D, 0xD1, 0x88, 0x27, 0x57, 0x5F, 0x57,
+	0xEC, 0xBD, 0x63, 0xE9, 0xE5, 0x65, 0x32, 0xD1,
+	0xB4, 0x1F, 0x38, 0xA6, 0x70, 0xA6, 0xB1, 0x43,
+	0x06, 0x95, 0x41, 0x07, 0x64, 0x50, 0x0B, 0xF7,
+	0x63, 0x5F, 0xBC, 0x3E, 0x38, 0xCD, 0x58, 0xCB,
+	0x5E, 0xCF, 0x94, 0x38, 0xD3, 0x21, 0x1A, 0x83,
+	0xFD, 0x16, 0xC1, 0xEB, 0xF2, 0x40, 0x20, 0xB3,
+	0xEF, 0x96, 0x5B, 0x1D, 0xFC, 0xBA, 0xF3, 0x47,
+	0x64, 0x0E, 0x82, 0xD2, 0x2B, 0x56, 0xD8, 0xBB,
+	0x83, 0x8B, 0x39, 0x1B, 0xB7, 0x2C, 0xCE, 0x9D,
+	0xDA, 0xEE, 0xF2, 0xEA, 0xA3, 0xE3, 0x8E, 0x78,
+	0x3A, 0x78, 0xD0, 0x40, 0xBA, 0xA9, 0x67, 0x45,
+	0x18, 0xD6, 0x40, 0xB7, 0x33, 0x81, 0x11, 0x0C,
+	0x40, 0xF0, 0xD4, 0xAC, 0xD6, 0x2D, 0x22, 0x32,
+	0xF8, 0x85, 0x3D, 0x59, 0xAC, 0xB2, 0xD2, 0x31,
+	0x20, 0xCF, 0x7D, 0x0F, 0x75, 0x32, 0x72, 0xE6,
+	0x5F, 0x1C, 0xE8, 0x51, 0x3E, 0x16, 0x35, 0x57,
+	0xFB, 0xEB, 0xF2, 0x76, 0x40, 0x67, 0xC9, 0x1A,
+	0x74, 0x27, 0xE7, 0x80, 0xD0, 0x87, 0x54, 0x4F,
+	0x94, 0x4D, 0xE0, 0x07, 0x1C, 0xEE, 0x5C, 0xB0,
+	0x3E, 0x5B, 0x29, 0xEE, 0x0A, 0xE1, 0x91, 0xF4,
+	0x27, 0xCC, 0x8B, 0xD2, 0x16, 0xC7, 0x2D, 0x67,
+	0x8A, 0xE6, 0x87, 0xCE, 0x8C, 0x07, 0x93, 0xD8,
+	0xCA, 0x6F, 0xFD, 0xAE, 0x86, 0x45, 0x8A, 0x99,
+	0x52, 0x4D, 0x47, 0xB6, 0x27, 0xC5, 0x3D, 0x00,
+	0xA5, 0x93, 0xDB, 0x32, 0xBA, 0x77, 0xE7, 0xBA,
+	0x26, 0xF0, 0x23, 0x40, 0xF8, 0x22, 0x62, 0x36,
+	0x31, 0x2B, 0xFC, 0x54, 0xEE, 0x3A, 0xA5, 0x9F,
+	0x1C, 0xE5, 0x0F, 0xE7, 0x9E, 0xE2, 0xCE, 0x16,
+	0xC7, 0x09, 0xD1, 0xFC, 0x84, 0x34, 0x58, 0xA2,
+	0x2B, 0xD6, 0x24, 0xD0, 0x05, 0x5C, 0x91, 0x9D,
+	0xA0, 0xE3, 0xB8, 0xA9, 0x19, 0x9A, 0x33, 0x6D,
+	0x27, 0xA0, 0xF9, 0xCC, 0x34, 0x49, 0x62, 0x63,
+	0x81, 0xE1, 0xDE, 0xDF, 0xF5, 0xE5, 0x99, 0x7C,
+	0x56, 0x10, 0xC2, 0x60, 0x86, 0xE5, 0x04, 0xBE,
+	0x0C, 0xB9, 0x49, 0x70, 0xF8, 0x99, 0xF3, 0x65,
+	0xE1, 0xF0, 0xE7, 0x05, 0x1E, 0x8F, 0x67, 0x0D,
+	0x0C, 0x56, 0x96, 0x20, 0xA5, 0x4B, 0xD2, 0x9A,
+	0x5E, 0x27, 0xE9, 0xC1, 0x4D, 0x53, 0x88, 0xB5,
+	0x11, 0x08, 0x61, 0x4A, 0x12, 0xD8, 0xE3, 0xA4,
+	0x57, 0x6E, 0xAA, 0x9C, 0x70, 0x74, 0xCC, 0x6D,
+	0x58, 0x81, 0x0E, 0xEE, 0xC4, 0xC6, 0x6F, 0xE5,
+	0x5E, 0xEC, 0x41, 0x45, 0x90, 0x56, 0x22, 0xD0,
+	0x61, 0x49, 0x70, 0x13, 0x9D, 0x5A, 0x15, 0x9D,
+	0xC9, 0x1D, 0x27, 0x91, 0xD2, 0xC4, 0xA7, 0x76,
+	0xF9, 0x53, 0x70, 0xB2, 0x07, 0xAB, 0x3C, 0xF0,
+	0x23, 0x9D, 0x29, 0x9B, 0xFD, 0xA3, 0xAC, 0x0D,
+	0x61, 0x02, 0xC8, 0x12, 0xA7, 0x4F, 0xC5, 0xA6,
+	0x7E, 0xF9, 0x6E, 0xE3, 0xB9, 0x22, 0x0F, 0x54,
+	0xC6, 0x4D, 0x37, 0xFC, 0x8F, 0x23, 0x1F, 0x9B,
+	0x7C, 0xD9, 0x66, 0x09, 0xC4, 0x80, 0x48, 0x3B,
+	0x7F, 0x7B, 0xF2, 0xED, 0xF2, 0xE7, 0xB7, 0x24,
+	0x6F, 0x30, 0x8D, 0xF6, 0x23, 0x55, 0x03, 0x30,
+	0x5F, 0xEE, 0xFA, 0x73, 0x0C, 0xA6, 0xD6, 0x95,
+	0x59, 0x50, 0x45, 0x33, 0x69, 0xF9, 0xC9, 0x5E,
+	0x7E, 0xBE, 0x9D, 0x49, 0x5C, 0x54, 0xB1, 0x4C,
+	0x3D, 0xF8, 0x1A, 0x98, 0x7B, 0x1C, 0xEA, 0xE6,
+	0xB0, 0x56, 0x67, 0x96, 0x90, 0xE8, 0x23, 0x53,
+	0xC3, 0x03, 0x47, 0x6C, 0xA4, 0x4B, 0x21, 0x61,
+	0x1A, 0x00, 0xAC, 0xA8, 0xD5, 0x56, 0xD6, 0x6C,
+	0x2C, 0x67, 0x20, 0x9A, 0x53, 0xF0, 0xEC, 0xD5,
+	0xED, 0x0C, 0x73, 0x82, 0x06, 0x26, 0x01, 0x4A,
+	0x4C, 0x78, 0x25, 0x00, 0x46, 0x16, 0x2E, 0x06,
+	0xAA, 0x5F, 0x28, 0x74, 0xA5, 0xB2, 0x90, 0x37,
+	0x09, 0xE3, 0x63, 0xDD, 0x28, 0xAA, 0x3E, 0xCA,
+	0x96, 0x03, 0xD7, 0x31, 0xE8, 0xB5, 0xBC, 0xD9,
+	0x94, 0x6A, 0x6B, 0xFA, 0x47, 0x8F, 0x39, 0x58,
+	0x4B, 0x0B, 0x27, 0xA6, 0x81, 0xE3, 0x98, 0x43,
+	0x3C, 0x3D, 0xA2, 0x66, 0xE4, 0xAC, 0x0E, 0x3E,
+	0x93, 0x93, 0x39, 0xA4, 0xFA, 0xBE, 0xEF, 0x46,
+	0x6F, 0xA3, 0x3D, 0x43, 0xE1, 0x9C, 0xC8, 0x58,
+	0xA8, 0x24, 0x6F, 0x3C, 0xDD, 0x9D, 0x00, 0x70,
+	0x41, 0x6C, 0xFC, 0x5A, 0x93, 0xAD, 0xFB, 0xE7,
+	0x6E, 0xF2, 0xBE, 0x2F, 0x0F, 0xB5, 0x86, 0xEA,
+	0xF5, 0x74, 0xAC, 0x89, 0x7A, 0xE7, 0xDB, 0x78,
+	0x49, 0x3C, 0x58, 0x5A, 0xB4, 0x5D, 0x35, 0x87,
+	0x1E, 0x3F, 0x67, 0x7D, 0x2F, 0xC9, 0x85, 0x66,
+	0xB4, 0x68, 0x1E, 0x9C, 0x5E, 0x17, 0xA2, 0xCA,
+	0x3F, 0xC2, 0x7B, 0x80, 0x95, 0xB5, 0x9C, 0x25,
+	0x92, 0x07, 0x27, 0xE8, 0x7B, 0x8B, 0x1B, 0xB5,
+	0xF2, 0xDC, 0x5F, 0x47, 0x9C, 0x25, 0x52, 0x5B,
+	0xED, 0x54, 0x19, 0x66, 0x2F, 0x00, 0x34, 0x0F,
+	0x73, 0x86, 0x2C, 0xF2, 0x0B, 0x70, 0xED, 0xF1,
+	0x8D, 0x8F, 0x71, 0x05, 0x79, 0x18, 0xFD, 0xE9,
+	0x62, 0x02, 0xE7, 0x1C, 0xED, 0xA0, 0xE2, 0xB4,
+	0x0B, 0x74, 0xBA, 0xCA, 0xE5, 0x65, 0x24, 0x10,
+	0xD6, 0xBA, 0x15, 0x6F, 0xC4, 0x1A, 0x3C, 0x2B,
+}};
+
+const word* bignStdPre(size_t l)
+{
+	switch (l)
+	{
+	case 128:
+		return _curve128v1_pre.w;
+	case 192:
+		return _curve192v1_pre.w;
+	case 256:
+		return _curve256v1_pre.w;
+	}
+	return 0;
+}
+
+#else
+
+const word* bignStdPre(size_t l)
+{
+	return 0;
+}
+
+#endif
@@ -4,7 +4,7 @@
 \brief STB 34.101.47/botp: OTP algorithms
 \project bee2 [cryptographic library]
 \created 2015.11.02
-\version 2020.03.24
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -23,6 +23,7 @@
 #include "bee2/math/zz.h"
 #include "bee2/crypto/belt.h"
 #include "bee2/crypto/botp.h"
+#include "crypto/belt/belt_lcl.h"
 
 /*
 *******************************************************************************
@@ -116,12 +117,12 @@ typedef struct
 	octet ctr1[8];		/*< копия счетчика */
 	octet mac[32];		/*< имитовставка */
 	char otp[10];		/*< текущий пароль */
-	octet stack[];		/*< [2 * beltHMAC_deep()] */
+	octet stack[];		/*< [beltHMAC_keep() + beltHMACKey_keep()] */
 } botp_hotp_st;
 
 size_t botpHOTP_keep()
 {
-	return sizeof(botp_hotp_st) + 2 * beltHMAC_keep();
+	return sizeof(botp_hotp_st) + beltHMAC_keep() + beltHMACKey_keep();
 }
 
 void botpHOTPStart(void* state, size_t digit, const octet key[], 
@@ -131,7 +132,7 @@ void botpHOTPStart(void* state, size_t digit, const octet key[],
 	ASSERT(6 <= digit && digit <= 8);
 	ASSERT(memIsDisjoint2(key, key_len, state, botpHOTP_keep()));
 	st->digit = digit;
-	beltHMACStart(st->stack + beltHMAC_keep(), key, key_len);
+	beltHMACKeyStart(st->stack + beltHMAC_keep(), key, key_len);
 }
 
 void botpHOTPStepS(void* state, const octet ctr[8])
@@ -148,7 +149,7 @@ void botpHOTPStepR(char* otp, void* state)
 	ASSERT(memIsDisjoint2(otp, st->digit + 1, state, botpHOTP_keep()) || 
 		otp == st->otp);
 	// вычислить имитовставку
-	memCopy(st->stack, st->stack + beltHMAC_keep(), beltHMAC_keep());
+	beltHMACStartK(st->stack, st->stack + beltHMAC_keep());
 	beltHMACStepA(st->ctr, 8, st->stack);
 	beltHMACStepG(st->mac, st->stack);
 	// построить пароль
@@ -174,6 +175,34 @@ bool_t botpHOTPStepV(const char* otp, void* state)
 	return FALSE;
 }
 
+bool_t botpHOTPStepW(size_t* offset, const char* otp, size_t window,
+	void* state)
+{
+	botp_hotp_st* st = (botp_hotp_st*)state;
+	size_t i;
+	// pre
+	ASSERT(strIsValid(otp));
+	ASSERT(memIsDisjoint2(otp, strLen(otp) + 1, state, botpHOTP_keep()));
+	ASSERT(offset == 0 || memIsDisjoint2(offset, sizeof(size_t), state,
+		botpHOTP_keep()));
+	// сохранить счетчик
+	memCopy(st->ctr1, st->ctr, 8);
+	// проверить пароли окна
+	for (i = 0; i <= window; ++i)
+	{
+		botpHOTPStepR(st->otp, state);
+		if (strEq(st->otp, otp))
+		{
+			if (offset)
+				*offset = i;
+			return TRUE;
+		}
+	}
+	// вернуться к первоначальному счетчику
+	memCopy(st->ctr, st->ctr1, 8);
+	return FALSE;
+}
+
 void botpHOTPStepG(octet ctr[8], const void* state)
 {
 	const botp_hotp_st* st = (const botp_hotp_st*)state;
@@ -228,6 +257,30 @@ err_t botpHOTPVerify(const char* otp, const octet key[], size_t key_len,
 	return success ? ERR_OK : ERR_BAD_PWD;
 }
 
+err_t botpHOTPVerifyW(size_t* offset, const char* otp, const octet key[],
+	size_t key_len, const octet ctr[8], size_t window)
+{
+	void* state;
+	bool_t success;
+	// проверить входные данные
+	if (!strIsValid(otp) || strLen(otp) < 6 || strLen(otp) > 8)
+		return ERR_BAD_PWD;
+	if (!memIsValid(key, key_len) || !memIsValid(ctr, 8) ||
+		!memIsNullOrValid(offset, sizeof(size_t)))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(botpHOTP_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить пароль
+	botpHOTPStart(state, strLen(otp), key, key_len);
+	botpHOTPStepS(state, ctr);
+	success = botpHOTPStepW(offset, otp, window, state);
+	// завершить
+	blobClose(state);
+	return success ? ERR_OK : ERR_BAD_PWD;
+}
+
 /*
 *******************************************************************************
 Режим TOTP
@@ -240,12 +293,12 @@ typedef struct
 	octet t[8];			/*< округленная отметка времени */
 	octet mac[32];		/*< имитовставка */
 	char otp[10];		/*< текущий пароль */
-	octet stack[];		/*< [2 * beltHMAC_deep()] */
+	octet stack[];		/*< [beltHMAC_keep() + beltHMACKey_keep()] */
 } botp_totp_st;
 
 size_t botpTOTP_keep()
 {
-	return sizeof(botp_totp_st) + 2 * beltHMAC_keep();
+	return sizeof(botp_totp_st) + beltHMAC_keep() + beltHMACKey_keep();
 }
 
 void botpTOTPStart(void* state, size_t digit, const octet key[], 
@@ -255,7 +308,7 @@ void botpTOTPStart(void* state, size_t digit, const octet key[],
 	ASSERT(6 <= digit && digit <= 8);
 	ASSERT(memIsDisjoint2(key, key_len, state, botpTOTP_keep()));
 	st->digit = digit;
-	beltHMACStart(st->stack + beltHMAC_keep(), key, key_len);
+	beltHMACKeyStart(st->stack + beltHMAC_keep(), key, key_len);
 }
 
 void botpTOTPStepR(char* otp, tm_time_t t, void* state)
@@ -266,7 +319,7 @@ void botpTOTPStepR(char* otp, tm_time_t t, void* state)
 	ASSERT(memIsDisjoint2(otp, st->digit + 1, state, botpHOTP_keep()) || 
 		otp == st->otp);
 	// вычислить имитовставку
-	memCopy(st->stack, st->stack + beltHMAC_keep(), beltHMAC_keep());
+	beltHMACStartK(st->stack, st->stack + beltHMAC_keep());
 	botpTimeToCtr(st->t, t);
 	beltHMACStepA(st->t, 8, st->stack);
 	beltHMACStepG(st->mac, st->stack);
@@ -286,6 +339,45 @@ bool_t botpTOTPStepV(const char* otp, tm_time_t t, void* state)
 	return strEq(st->otp, otp);
 }
 
+bool_t botpTOTPStepW(tm_time_t* t1, const char* otp, tm_time_t t,
+	size_t back, size_t ahead, void* state)
+{
+	botp_totp_st* st = (botp_totp_st*)state;
+	size_t i;
+	// pre
+	ASSERT(strIsValid(otp));
+	ASSERT(t != TIME_ERR);
+	ASSERT(memIsDisjoint2(otp, strLen(otp) + 1, state, botpTOTP_keep()));
+	ASSERT(t1 == 0 || memIsDisjoint2(t1, sizeof(tm_time_t), state,
+		botpTOTP_keep()));
+	// t, t - 1, t + 1, t - 2, t + 2,...
+	for (i = 0; i <= back || i <= ahead; ++i)
+	{
+		if (i <= back && (tm_time_t)i <= t)
+		{
+			botpTOTPStepR(st->otp, t - (tm_time_t)i, state);
+			if (strEq(st->otp, otp))
+			{
+				if (t1)
+					*t1 = t - (tm_time_t)i;
+				return TRUE;
+			}
+		}
+		if (i && i <= ahead)
+		{
+			ASSERT(t + (tm_time_t)i != TIME_ERR);
+			botpTOTPStepR(st->otp, t + (tm_time_t)i, state);
+			if (strEq(st->otp, otp))
+			{
+				if (t1)
+					*t1 = t + (tm_time_t)i;
+				return TRUE;
+			}
+		}
+	}
+	return FALSE;
+}
+
 err_t botpTOTPRand(char* otp, size_t digit, const octet key[], size_t key_len, 
 	tm_time_t t)
 {
@@ -334,6 +426,204 @@ err_t botpTOTPVerify(const char* otp, const octet key[], size_t key_len,
 	return success ? ERR_OK : ERR_BAD_PWD;
 }
 
+err_t botpTOTPVerifyW(tm_time_t* t1, const char* otp, const octet key[],
+	size_t key_len, tm_time_t t, size_t back, size_t ahead)
+{
+	void* state;
+	bool_t success;
+	// проверить входные данные
+	if (!strIsValid(otp) || strLen(otp) < 6 || strLen(otp) > 8)
+		return ERR_BAD_PWD;
+	if (t == TIME_ERR)
+		return ERR_BAD_TIME;
+	if (!memIsValid(key, key_len) ||
+		!memIsNullOrValid(t1, sizeof(tm_time_t)))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(botpTOTP_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить пароль
+	botpTOTPStart(state, strLen(otp), key, key_len);
+	success = botpTOTPStepW(t1, otp, t, back, ahead, state);
+	// завершить
+	blobClose(state);
+	return success ? ERR_OK : ERR_BAD_PWD;
+}
+
+/*
+*******************************************************************************
+Пакетная проверка паролей TOTP
+
+Пароли проверяются четверками. Для каждой четверки ключи приводятся
+к 32 октетам (длинные ключи хэшируются), после чего beltHMAC всех
+четырех паролей вычисляется на дорожках (s[j], h[j]) одновременно
+с помощью beltCompr4(): сжимаются блоки key ^ ipad, счетчик и len || s
+внутреннего хэширования, затем блоки key ^ opad, результат внутреннего
+хэширования и len || s внешнего хэширования. Дорожки, для которых
+нет паролей (или пароли заведомо неверны), обрабатывают нулевые данные,
+результаты при этом отбрасываются.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	u32 s[4][4];		/*< переменные s дорожек */
+	u32 h[4][8];		/*< переменные h дорожек */
+	u32 X[4][8];		/*< сжимаемые блоки дорожек */
+	u32 h1[4][8];		/*< результаты внутреннего хэширования */
+	octet key[4][32];	/*< ключи дорожек */
+	octet t[8];			/*< округленная отметка времени */
+	octet mac[32];		/*< имитовставка */
+	char otp[10];		/*< текущий пароль */
+	octet stack[];		/*< [max(beltCompr4_deep(), beltHash_keep())] */
+} botp_totp_multi_st;
+
+size_t botpTOTPMulti_keep()
+{
+	return sizeof(botp_totp_multi_st) +
+		utilMax(2,
+			beltCompr4_deep(),
+			beltHash_keep());
+}
+
+static bool_t botpTOTPMultiIsValid(const char* otp, tm_time_t t)
+{
+	return strIsValid(otp) && strLen(otp) >= 6 && strLen(otp) <= 8 &&
+		t != TIME_ERR;
+}
+
+static void botpTOTPMultiPads(botp_totp_multi_st* st, octet pad)
+{
+	size_t i, j;
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockSetZero(st->s[j]);
+		u32From(st->h[j], beltH(), 32);
+		for (i = 0; i < 32; ++i)
+			((octet*)st->X[j])[i] = st->key[j][i] ^ pad;
+#if (OCTET_ORDER == BIG_ENDIAN)
+		beltBlockRevU32(st->X[j]);
+		beltBlockRevU32(st->X[j] + 4);
+#endif
+	}
+	beltCompr4(st->s, st->h, (const u32(*)[8])st->X, st->stack);
+}
+
+static void botpTOTPMultiFinal(botp_totp_multi_st* st, size_t count)
+{
+	size_t j;
+	for (j = 0; j < 4; ++j)
+	{
+		beltBlockSetZero(st->X[j]);
+		beltBlockAddBitSizeU32(st->X[j], count);
+		beltBlockCopy(st->X[j] + 4, st->s[j]);
+	}
+	beltCompr4(st->s, st->h, (const u32(*)[8])st->X, st->stack);
+}
+
+void botpTOTPStepVMulti(bool_t rets[], size_t n, const octet* keys[],
+	const size_t key_lens[], const char* otps[], const tm_time_t ts[],
+	void* state)
+{
+	botp_totp_multi_st* st = (botp_totp_multi_st*)state;
+	size_t g, j;
+	// pre
+	ASSERT(memIsValid(rets, sizeof(bool_t) * n));
+	ASSERT(memIsValid(keys, sizeof(const octet*) * n));
+	ASSERT(memIsValid(key_lens, sizeof(size_t) * n));
+	ASSERT(memIsValid(otps, sizeof(const char*) * n));
+	ASSERT(memIsValid(ts, sizeof(tm_time_t) * n));
+	// цикл по четверкам
+	for (g = 0; g < n; g += 4)
+	{
+		// подготовить ключи и счетчики
+		for (j = 0; j < 4; ++j)
+		{
+			memSetZero(st->key[j], 32);
+			memSetZero(st->h1[j], 32);
+			if (g + j >= n || !botpTOTPMultiIsValid(otps[g + j], ts[g + j]))
+				continue;
+			ASSERT(memIsValid(keys[g + j], key_lens[g + j]));
+			if (key_lens[g + j] <= 32)
+				memCopy(st->key[j], keys[g + j], key_lens[g + j]);
+			else
+			{
+				beltHashStart(st->stack);
+				beltHashStepH(keys[g + j], key_lens[g + j], st->stack);
+				beltHashStepG(st->key[j], st->stack);
+			}
+			botpTimeToCtr(st->t, ts[g + j]);
+			u32From(st->h1[j], st->t, 8);
+		}
+		// внутреннее хэширование
+		botpTOTPMultiPads(st, 0x36);
+		for (j = 0; j < 4; ++j)
+		{
+			beltBlockCopy(st->X[j], st->h1[j]);
+			beltBlockCopy(st->X[j] + 4, st->h1[j] + 4);
+		}
+		beltCompr4(st->s, st->h, (const u32(*)[8])st->X, st->stack);
+		botpTOTPMultiFinal(st, 32 + 8);
+		for (j = 0; j < 4; ++j)
+		{
+			beltBlockCopy(st->h1[j], st->h[j]);
+			beltBlockCopy(st->h1[j] + 4, st->h[j] + 4);
+		}
+		// внешнее хэширование
+		botpTOTPMultiPads(st, 0x5C);
+		for (j = 0; j < 4; ++j)
+		{
+			beltBlockCopy(st->X[j], st->h1[j]);
+			beltBlockCopy(st->X[j] + 4, st->h1[j] + 4);
+		}
+		beltCompr4(st->s, st->h, (const u32(*)[8])st->X, st->stack);
+		botpTOTPMultiFinal(st, 32 * 2);
+		// построить и проверить пароли
+		for (j = 0; j < 4 && g + j < n; ++j)
+		{
+			rets[g + j] = FALSE;
+			if (!botpTOTPMultiIsValid(otps[g + j], ts[g + j]))
+				continue;
+			u32To(st->mac, 32, st->h[j]);
+			botpDT(st->otp, strLen(otps[g + j]), st->mac, 32);
+			rets[g + j] = strEq(st->otp, otps[g + j]);
+		}
+	}
+	// очистка
+	memWipe(st->key, sizeof(st->key));
+	memWipe(st->s, sizeof(st->s));
+	memWipe(st->h, sizeof(st->h));
+	memWipe(st->X, sizeof(st->X));
+	memWipe(st->h1, sizeof(st->h1));
+}
+
+err_t botpTOTPVerifyMulti(bool_t rets[], size_t n, const octet* keys[],
+	const size_t key_lens[], const char* otps[], const tm_time_t ts[])
+{
+	void* state;
+	size_t j;
+	// проверить входные данные
+	if (!memIsValid(rets, sizeof(bool_t) * n) ||
+		!memIsValid(keys, sizeof(const octet*) * n) ||
+		!memIsValid(key_lens, sizeof(size_t) * n) ||
+		!memIsValid(otps, sizeof(const char*) * n) ||
+		!memIsValid(ts, sizeof(tm_time_t) * n))
+		return ERR_BAD_INPUT;
+	for (j = 0; j < n; ++j)
+		if (!memIsValid(keys[j], key_lens[j]) || !strIsValid(otps[j]))
+			return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(botpTOTPMulti_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить пароли
+	botpTOTPStepVMulti(rets, n, keys, key_lens, otps, ts, state);
+	// завершить
+	blobClose(state);
+	return ERR_OK;
+}
+
 /*
 *******************************************************************************
 Режим OCRA
@@ -371,17 +661,37 @@ static const char ocra_sha1[] = "SHA1";
 static const char ocra_sha256[] = "SHA256";
 static const char ocra_sha512[] = "SHA512";
 
-bool_t botpOCRAStart(void* state, const char* suite, const octet key[], 
-	size_t key_len)
+/*
+*******************************************************************************
+Разбор описателя
+
+Функция botpOCRAParse() разбирает описатель suite и размещает его
+параметры в su. Описатель копируется в su->suite: он обрабатывается
+первым при вычислении имитовставки. Длина корректного описателя
+не превосходит 44 символов.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t digit;		/*< число цифр в пароле */
+	size_t ctr_len;		/*< длина счетчика */
+	char q_type;		/*< тип запроса (A, N, H) */
+	size_t q_max;		/*< максимальная длина одиночного запроса */
+	size_t p_len;		/*< длина p */
+	size_t s_len;		/*< длина идентификатора */
+	tm_time_t ts;		/*< шаг времени */
+	size_t suite_len;	/*< длина описателя (с завершающим нулем) */
+	char suite[64];		/*< описатель */
+} botp_ocra_suite_st;
+
+static bool_t botpOCRAParse(botp_ocra_suite_st* su, const char* suite)
 {
-	botp_ocra_st* st = (botp_ocra_st*)state;
 	const char* suite_save = suite;
-	// pre
 	ASSERT(strIsValid(suite));
-	ASSERT(memIsDisjoint2(suite, strLen(suite) + 1, state, botpOCRA_keep()));
-	ASSERT(memIsDisjoint2(key, key_len, state, botpOCRA_keep()));
-	// подготовить state
-	memSetZero(st, botpOCRA_keep());
+	ASSERT(memIsDisjoint2(suite, strLen(suite) + 1, su,
+		sizeof(botp_ocra_suite_st)));
+	memSetZero(su, sizeof(botp_ocra_suite_st));
 	// разбор suite: префикс
 	if (!strStartsWith(suite, ocra_prefix))
 		return FALSE;
@@ -394,7 +704,7 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 	// разбор suite: digit
 	if (*suite < '4' || *suite > '9')
 		return FALSE;
-	st->digit = (size_t)(*suite++ - '0');
+	su->digit = (size_t)(*suite++ - '0');
 	// разбор suite: DataInput
 	if (*suite++ != ':')
 		return FALSE;
@@ -404,7 +714,7 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 		if (*++suite != '-')
 			return FALSE;
 		++suite;
-		st->ctr_len = 8;
+		su->ctr_len = 8;
 	}
 	// разбор suite: q
 	if (*suite++ != 'Q')
@@ -414,16 +724,16 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 	case 'A':
 	case 'N':
 	case 'H':
-		st->q_type = *suite++;
+		su->q_type = *suite++;
 		break;
 	default:
 		return FALSE;
 	}
 	if (suite[0] < '0' || suite[0] > '9' || suite[1] < '0' || suite[1] > '9')
 		return FALSE;
-	st->q_max = (size_t)(suite[0] - '0');
-	st->q_max *= 10, st->q_max += (size_t)(suite[1] - '0');
-	if (st->q_max < 4 || st->q_max > 64)
+	su->q_max = (size_t)(suite[0] - '0');
+	su->q_max *= 10, su->q_max += (size_t)(suite[1] - '0');
+	if (su->q_max < 4 || su->q_max > 64)
 		return FALSE;
 	suite += 2;
 	// разбор suite: p
@@ -433,22 +743,22 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 		if (strStartsWith(suite, ocra_hbelt))
 		{
 			suite += strLen(ocra_hbelt);
-			st->p_len = 32;
+			su->p_len = 32;
 		}
 		else if (strStartsWith(suite, ocra_sha1))
 		{
 			suite += strLen(ocra_sha1);
-			st->p_len = 20;
+			su->p_len = 20;
 		}
 		else if (strStartsWith(suite, ocra_sha256))
 		{
 			suite += strLen(ocra_sha256);
-			st->p_len = 32;
+			su->p_len = 32;
 		}
 		else if (strStartsWith(suite, ocra_sha512))
 		{
 			suite += strLen(ocra_sha512);
-			st->p_len = 64;
+			su->p_len = 64;
 		}
 		else
 			return FALSE;
@@ -461,10 +771,10 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 			suite[1] < '0' || suite[1] > '9' ||
 			suite[2] < '0' || suite[2] > '9')
 			return FALSE;
-		st->s_len = (size_t)(suite[0] - '0');
-		st->s_len *= 10, st->s_len += (size_t)(suite[1] - '0');
-		st->s_len *= 10, st->s_len += (size_t)(suite[2] - '0');
-		if (st->s_len > 512)
+		su->s_len = (size_t)(suite[0] - '0');
+		su->s_len *= 10, su->s_len += (size_t)(suite[1] - '0');
+		su->s_len *= 10, su->s_len += (size_t)(suite[2] - '0');
+		if (su->s_len > 512)
 			return FALSE;
 		suite += 3;
 	}
@@ -474,24 +784,24 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 		suite += 2;
 		if (*suite < '1' || *suite > '9')
 			return FALSE;
-		st->ts = (size_t)(*suite++ - '0');
+		su->ts = (size_t)(*suite++ - '0');
 		if (*suite >= '0' && *suite <= '9')
-			st->ts *= 10, st->ts += (size_t)(*suite++ - '0');
+			su->ts *= 10, su->ts += (size_t)(*suite++ - '0');
 		switch (*suite++)
 		{
 		case 'S':
-			if (st->ts > 59)
+			if (su->ts > 59)
 				return FALSE;
 			break;
 		case 'M':
-			if (st->ts > 59)
+			if (su->ts > 59)
 				return FALSE;
-			st->ts *= 60;
+			su->ts *= 60;
 			break;
 		case 'H':
-			if (st->ts > 48)
+			if (su->ts > 48)
 				return FALSE;
-			st->ts *= 3600;
+			su->ts *= 3600;
 			break;
 		default:
 			return FALSE;
@@ -500,10 +810,73 @@ bool_t botpOCRAStart(void* state, const char* suite, const octet key[],
 	// разбор suite: окончание
 	if (*suite)
 		return FALSE;
-	// запуск HMAC 
+	// сохранить описатель
+	su->suite_len = strLen(suite_save) + 1;
+	ASSERT(su->suite_len <= sizeof(su->suite));
+	memCopy(su->suite, suite_save, su->suite_len);
+	return TRUE;
+}
+
+size_t botpOCRASuite_keep()
+{
+	return sizeof(botp_ocra_suite_st);
+}
+
+bool_t botpOCRASuiteStart(void* hsuite, const char* suite)
+{
+	ASSERT(memIsValid(hsuite, botpOCRASuite_keep()));
+	return botpOCRAParse((botp_ocra_suite_st*)hsuite, suite);
+}
+
+/*
+*******************************************************************************
+Инициализация
+
+Ключезависимая часть инициализации -- запуск beltHMAC на ключе и обработка
+описателя. Ее результат сохраняется во втором beltHMAC-состоянии
+и копируется в первое при вычислении каждой имитовставки.
+*******************************************************************************
+*/
+
+void botpOCRAStartS(void* state, const void* hsuite, const octet key[],
+	size_t key_len)
+{
+	botp_ocra_st* st = (botp_ocra_st*)state;
+	const botp_ocra_suite_st* su = (const botp_ocra_suite_st*)hsuite;
+	// pre
+	ASSERT(memIsDisjoint2(hsuite, botpOCRASuite_keep(), state,
+		botpOCRA_keep()));
+	ASSERT(memIsDisjoint2(key, key_len, state, botpOCRA_keep()));
+	ASSERT(su->digit);
+	// перенести параметры
+	memSetZero(st, sizeof(botp_ocra_st));
+	st->digit = su->digit;
+	st->ctr_len = su->ctr_len;
+	st->q_type = su->q_type;
+	st->q_max = su->q_max;
+	st->p_len = su->p_len;
+	st->s_len = su->s_len;
+	st->ts = su->ts;
+	// запуск HMAC
 	beltHMACStart(st->stack + beltHMAC_keep(), key, key_len);
-	beltHMACStepA(suite_save, strLen(suite_save) + 1,
-		st->stack + beltHMAC_keep());
+	beltHMACStepA(su->suite, su->suite_len, st->stack + beltHMAC_keep());
+}
+
+bool_t botpOCRAStart(void* state, const char* suite, const octet key[], 
+	size_t key_len)
+{
+	botp_ocra_suite_st su[1];
+	// pre
+	ASSERT(strIsValid(suite));
+	ASSERT(memIsDisjoint2(suite, strLen(suite) + 1, state, botpOCRA_keep()));
+	ASSERT(memIsDisjoint2(key, key_len, state, botpOCRA_keep()));
+	// подготовить state
+	memSetZero(state, botpOCRA_keep());
+	// разобрать suite
+	if (!botpOCRAParse(su, suite))
+		return FALSE;
+	// инициализировать state
+	botpOCRAStartS(state, su, key, key_len);
 	return TRUE;
 }
 
@@ -586,46 +959,34 @@ void botpOCRAStepG(octet ctr[8], const void* state)
 	memMove(ctr, st->ctr, 8);
 }
 
-err_t botpOCRARand(char* otp, const char* suite, const octet key[],	
-	size_t key_len, const octet q[], size_t q_len, const octet ctr[8], 
+err_t botpOCRARandS(char* otp, const void* hsuite, const octet key[],
+	size_t key_len, const octet q[], size_t q_len, const octet ctr[8],
 	const octet p[], const octet s[], tm_time_t t)
 {
+	const botp_ocra_suite_st* su = (const botp_ocra_suite_st*)hsuite;
 	botp_ocra_st* state;
-	// предварительно проверить входные данные
-	if (!strIsValid(suite) || !memIsValid(key, key_len))
+	// проверить входные данные
+	if (!memIsValid(hsuite, botpOCRASuite_keep()) ||
+		!memIsValid(key, key_len))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = (botp_ocra_st*)blobCreate(botpOCRA_keep());
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
-	// разобрать suite
-	if (!botpOCRAStart(state, suite, key, key_len))
-	{
-		blobClose(state);
+	if (!su->digit)
 		return ERR_BAD_FORMAT;
-	}
-	// проверить q_len
-	if (q_len < 4 || q_len > 2 * state->q_max)
-	{
-		blobClose(state);
+	if (q_len < 4 || q_len > 2 * su->q_max)
 		return ERR_BAD_PARAMS;
-	}
-	// полностью проверить входные данные
-	if (!memIsValid(otp, state->digit + 1) ||
-		state->ctr_len && !memIsValid(ctr, state->ctr_len) ||
+	if (!memIsValid(otp, su->digit + 1) ||
+		su->ctr_len && !memIsValid(ctr, su->ctr_len) ||
 		!memIsValid(q, q_len) ||
-		state->p_len && !memIsValid(p, state->p_len) ||
-		state->s_len && !memIsValid(s, state->s_len))
-	{
-		blobClose(state);
+		su->p_len && !memIsValid(p, su->p_len) ||
+		su->s_len && !memIsValid(s, su->s_len))
 		return ERR_BAD_INPUT;
-	}
-	if (state->ts && t == TIME_ERR)
-	{
-		blobClose(state);
+	if (su->ts && t == TIME_ERR)
 		return ERR_BAD_TIME;
-	}
+	// создать состояние
+	state = (botp_ocra_st*)blobCreate(botpOCRA_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
 	// сгенерировать пароль
+	botpOCRAStartS(state, su, key, key_len);
 	botpOCRAStepS(state, ctr, p, s);
 	botpOCRAStepR(otp, q, q_len, t, state);
 	// завершить
@@ -633,55 +994,69 @@ err_t botpOCRARand(char* otp, const char* suite, const octet key[],
 	return ERR_OK;
 }
 
-err_t botpOCRAVerify(const char* otp, const char* suite, const octet key[], 
+err_t botpOCRARand(char* otp, const char* suite, const octet key[],	
 	size_t key_len, const octet q[], size_t q_len, const octet ctr[8], 
 	const octet p[], const octet s[], tm_time_t t)
 {
-	botp_ocra_st* state;
-	bool_t success;
+	botp_ocra_suite_st su[1];
 	// предварительно проверить входные данные
 	if (!strIsValid(suite) || !memIsValid(key, key_len))
 		return ERR_BAD_INPUT;
-	// создать состояние
-	state = (botp_ocra_st*)blobCreate(botpOCRA_keep());
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
 	// разобрать suite
-	if (!botpOCRAStart(state, suite, key, key_len))
-	{
-		blobClose(state);
+	if (!botpOCRAParse(su, suite))
 		return ERR_BAD_FORMAT;
-	}
-	// проверить q_len
-	if (q_len < 4 || q_len > 2 * state->q_max)
-	{
-		blobClose(state);
+	// сгенерировать пароль
+	return botpOCRARandS(otp, su, key, key_len, q, q_len, ctr, p, s, t);
+}
+
+err_t botpOCRAVerifyS(const char* otp, const void* hsuite, const octet key[],
+	size_t key_len, const octet q[], size_t q_len, const octet ctr[8],
+	const octet p[], const octet s[], tm_time_t t)
+{
+	const botp_ocra_suite_st* su = (const botp_ocra_suite_st*)hsuite;
+	botp_ocra_st* state;
+	bool_t success;
+	// проверить входные данные
+	if (!strIsValid(otp) || !memIsValid(hsuite, botpOCRASuite_keep()) ||
+		!memIsValid(key, key_len))
+		return ERR_BAD_INPUT;
+	if (!su->digit)
+		return ERR_BAD_FORMAT;
+	if (q_len < 4 || q_len > 2 * su->q_max)
 		return ERR_BAD_PARAMS;
-	}
-	// полностью проверить входные данные
-	if (state->digit != strLen(otp))
-	{
-		blobClose(state);
+	if (su->digit != strLen(otp))
 		return ERR_BAD_PWD;
-	}
-	if (!memIsValid(otp, state->digit + 1) ||
-		state->ctr_len && !memIsValid(ctr, state->ctr_len) ||
+	if (su->ctr_len && !memIsValid(ctr, su->ctr_len) ||
 		!memIsValid(q, q_len) ||
-		state->p_len && !memIsValid(p, state->p_len) ||
-		state->s_len && !memIsValid(s, state->s_len))
-	{
-		blobClose(state);
+		su->p_len && !memIsValid(p, su->p_len) ||
+		su->s_len && !memIsValid(s, su->s_len))
 		return ERR_BAD_INPUT;
-	}
-	if (state->ts && t == TIME_ERR)
-	{
-		blobClose(state);
+	if (su->ts && t == TIME_ERR)
 		return ERR_BAD_TIME;
-	}
+	// создать состояние
+	state = (botp_ocra_st*)blobCreate(botpOCRA_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
 	// проверить пароль
+	botpOCRAStartS(state, su, key, key_len);
 	botpOCRAStepS(state, ctr, p, s);
 	success = botpOCRAStepV(otp, q, q_len, t, state);
 	// завершить
 	blobClose(state);
 	return success ? ERR_OK : ERR_BAD_PWD;
 }
+
+err_t botpOCRAVerify(const char* otp, const char* suite, const octet key[], 
+	size_t key_len, const octet q[], size_t q_len, const octet ctr[8], 
+	const octet p[], const octet s[], tm_time_t t)
+{
+	botp_ocra_suite_st su[1];
+	// предварительно проверить входные данные
+	if (!strIsValid(suite) || !memIsValid(key, key_len))
+		return ERR_BAD_INPUT;
+	// разобрать suite
+	if (!botpOCRAParse(su, suite))
+		return ERR_BAD_FORMAT;
+	// проверить пароль
+	return botpOCRAVerifyS(otp, su, key, key_len, q, q_len, ctr, p, s, t);
+}
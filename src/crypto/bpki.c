@@ -4,7 +4,7 @@
 \brief STB 34.101.78 (bpki): PKI helpers
 \project bee2 [cryptographic library]
 \created 2021.04.03
-\version 2022.07.07
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -14,6 +14,8 @@
 #include "bee2/core/err.h"
 #include "bee2/core/der.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/tm.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/bels.h"
 #include "bee2/crypto/belt.h"
@@ -298,6 +300,184 @@ static size_t bpkiEdataDec(octet edata[], size_t* edata_len, octet salt[8],
 	return ptr - epki;
 }
 
+/*
+*******************************************************************************
+Кэш ключей защиты
+
+В кэше сохраняются ключи защиты key = PBKDF2(pwd, salt, iter), построенные
+при успешном разборе контейнеров. Вместе с ключом сохраняются salt, iter и
+метка пароля tag = belt-hmac(hkey, pwd). Ключ hkey вырабатывается при
+создании кэша. Сам пароль в кэше не сохраняется.
+
+Ключ извлекается из кэша, только если совпадают salt, iter и tag. Поэтому
+обращение к кэшу с неверным паролем приводит к обычному вычислению PBKDF2 и
+к ошибке снятия защиты.
+
+Запись действительна в течение ttl секунд после создания. Просроченные
+записи стираются при обращении к кэшу. При переполнении заменяется запись,
+которая истекает раньше других. Кэш размещается в блобе, защищен мьютексом
+_mtx и стирается при завершении программы.
+
+PBKDF2 вычисляется вне блокировки: параллельные обращения к кэшу
+с одинаковыми параметрами могут привести к дублированию вычислений.
+*******************************************************************************
+*/
+
+#define BPKI_CACHE_SIZE 8
+
+typedef struct
+{
+	octet salt[8];			/*< синхропосылка PBKDF2 */
+	size_t iter;			/*< число итераций PBKDF2 */
+	octet tag[32];			/*< метка пароля */
+	octet key[32];			/*< ключ защиты */
+	tm_time_t until;		/*< окончание действия (TIME_0 -- пустая) */
+} bpki_cache_entry;
+
+typedef struct
+{
+	octet hkey[32];			/*< ключ меток паролей */
+	size_t ttl;				/*< время жизни записей (в секундах) */
+	bpki_cache_entry entries[BPKI_CACHE_SIZE];	/*< записи */
+	octet stack[];			/*< [beltHMAC_keep()] состояние belt-hmac */
+} bpki_cache_st;
+
+static size_t _once;			/*< триггер однократности */
+static mt_mtx_t _mtx[1];		/*< мьютекс */
+static bool_t _inited;			/*< мьютекс создан? */
+static bpki_cache_st* _cache;	/*< кэш */
+
+static void bpkiCacheDestroy()
+{
+	mtMtxLock(_mtx);
+	blobClose(_cache), _cache = 0;
+	mtMtxUnlock(_mtx);
+	mtMtxClose(_mtx);
+	_inited = FALSE;
+}
+
+static void bpkiCacheInit()
+{
+	ASSERT(!_inited);
+	if (!mtMtxCreate(_mtx))
+		return;
+	if (!utilOnExit(bpkiCacheDestroy))
+	{
+		mtMtxClose(_mtx);
+		return;
+	}
+	_inited = TRUE;
+}
+
+err_t bpkiCacheStart(size_t ttl, gen_i rng, void* rng_state)
+{
+	// проверить генератор
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// проверить входные данные
+	if (ttl == 0)
+		return ERR_BAD_INPUT;
+	// инициализировать однократно
+	if (!mtCallOnce(&_once, bpkiCacheInit) || !_inited)
+		return ERR_FILE_CREATE;
+	// создать кэш
+	mtMtxLock(_mtx);
+	if (!_cache)
+	{
+		_cache = (bpki_cache_st*)blobCreate(sizeof(bpki_cache_st) +
+			beltHMAC_keep());
+		if (!_cache)
+		{
+			mtMtxUnlock(_mtx);
+			return ERR_OUTOFMEMORY;
+		}
+		rng(_cache->hkey, 32, rng_state);
+	}
+	_cache->ttl = ttl;
+	mtMtxUnlock(_mtx);
+	return ERR_OK;
+}
+
+void bpkiCacheStop()
+{
+	if (!_inited)
+		return;
+	mtMtxLock(_mtx);
+	blobClose(_cache), _cache = 0;
+	mtMtxUnlock(_mtx);
+}
+
+/*
+	Функция bpkiCacheGet() ищет в кэше ключ защиты. Если кэш включен,
+	то в tag возвращается метка пароля, которую следует передать
+	в bpkiCachePut() после успешного снятия защиты.
+*/
+
+static bool_t bpkiCacheGet(octet key[32], bool_t* use, octet tag[32],
+	const octet salt[8], size_t iter, const octet pwd[], size_t pwd_len)
+{
+	tm_time_t now;
+	size_t i;
+	bool_t found = FALSE;
+	*use = FALSE;
+	if (!_inited)
+		return FALSE;
+	mtMtxLock(_mtx);
+	if (!_cache || (now = tmTime()) == TIME_ERR)
+	{
+		mtMtxUnlock(_mtx);
+		return FALSE;
+	}
+	// tag <- belt-hmac(hkey, pwd)
+	beltHMACStart(_cache->stack, _cache->hkey, 32);
+	beltHMACStepA(pwd, pwd_len, _cache->stack);
+	beltHMACStepG(tag, _cache->stack);
+	*use = TRUE;
+	// просмотреть записи
+	for (i = 0; i < BPKI_CACHE_SIZE; ++i)
+	{
+		bpki_cache_entry* e = _cache->entries + i;
+		if (e->until == TIME_0)
+			continue;
+		if (e->until <= now)
+			memWipe(e, sizeof(bpki_cache_entry)), e->until = TIME_0;
+		else if (!found && e->iter == iter && memEq(e->salt, salt, 8) &&
+			memEq(e->tag, tag, 32))
+		{
+			memCopy(key, e->key, 32);
+			found = TRUE;
+		}
+	}
+	mtMtxUnlock(_mtx);
+	return found;
+}
+
+static void bpkiCachePut(const octet key[32], const octet tag[32],
+	const octet salt[8], size_t iter)
+{
+	tm_time_t now;
+	size_t i, pos;
+	ASSERT(_inited);
+	mtMtxLock(_mtx);
+	if (!_cache || (now = tmTime()) == TIME_ERR)
+	{
+		mtMtxUnlock(_mtx);
+		return;
+	}
+	// выбрать запись: пустую или истекающую раньше других
+	for (pos = 0, i = 1; i < BPKI_CACHE_SIZE &&
+		_cache->entries[pos].until != TIME_0; ++i)
+		if (_cache->entries[i].until < _cache->entries[pos].until)
+			pos = i;
+	// заполнить запись
+	memCopy(_cache->entries[pos].salt, salt, 8);
+	_cache->entries[pos].iter = iter;
+	memCopy(_cache->entries[pos].tag, tag, 32);
+	memCopy(_cache->entries[pos].key, key, 32);
+	_cache->entries[pos].until = now + (tm_time_t)_cache->ttl;
+	mtMtxUnlock(_mtx);
+}
+
 /*
 *******************************************************************************
 Контейнер с личным ключом
@@ -369,7 +549,9 @@ err_t bpkiPrivkeyUnwrap(octet privkey[], size_t* privkey_len,
 	void* state;
 	octet* salt;
 	octet* key;
+	octet* tag;
 	octet* edata;
+	bool_t use, hit;
 	err_t code;
 	// проверить входные данные
 	if (epki_len == SIZE_MAX || !memIsValid(epki, epki_len) ||
@@ -381,21 +563,29 @@ err_t bpkiPrivkeyUnwrap(octet privkey[], size_t* privkey_len,
 	if (count != epki_len)
 		return ERR_BAD_FORMAT;
 	// подготовить буферы для параметров PBKDF2
-	state = blobCreate(8 + 32 + edata_len);
+	state = blobCreate(8 + 32 + 32 + edata_len);
 	if (!state)
 		return ERR_OUTOFMEMORY;
 	salt = (octet*)state;
 	key = salt + 8;
-	edata = key + 32;
+	tag = key + 32;
+	edata = tag + 32;
 	// выделить edata
 	count = bpkiEdataDec(edata, 0, salt, &iter, epki, epki_len);
 	ASSERT(count == epki_len);
-	// построить ключ защиты 
-	code = beltPBKDF2(key, pwd, pwd_len, iter, salt, 8);
-	ERR_CALL_HANDLE(code, blobClose(state));
+	// построить ключ защиты (или найти его в кэше)
+	hit = bpkiCacheGet(key, &use, tag, salt, iter, pwd, pwd_len);
+	if (!hit)
+	{
+		code = beltPBKDF2(key, pwd, pwd_len, iter, salt, 8);
+		ERR_CALL_HANDLE(code, blobClose(state));
+	}
 	// снять защиту
 	code = beltKWPUnwrap(edata, edata, edata_len, 0, key, 32);
 	ERR_CALL_HANDLE(code, blobClose(state));
+	// сохранить ключ защиты в кэше
+	if (use && !hit)
+		bpkiCachePut(key, tag, salt, iter);
 	pki_len = edata_len - 16;
 	// определить длину privkey
 	count = bpkiPrivkeyDec(privkey, &edata_len, edata, pki_len);
@@ -484,7 +674,9 @@ err_t bpkiShareUnwrap(octet share[], size_t* share_len,
 	void* state;
 	octet* salt;
 	octet* key;
+	octet* tag;
 	octet* edata;
+	bool_t use, hit;
 	err_t code;
 	// проверить входные данные
 	if (epki_len == SIZE_MAX || !memIsValid(epki, epki_len) ||
@@ -496,21 +688,29 @@ err_t bpkiShareUnwrap(octet share[], size_t* share_len,
 	if (count != epki_len)
 		return ERR_BAD_FORMAT;
 	// подготовить буферы для параметров PBKDF2
-	state = blobCreate(8 + 32 + edata_len);
+	state = blobCreate(8 + 32 + 32 + edata_len);
 	if (!state)
 		return ERR_OUTOFMEMORY;
 	salt = (octet*)state;
 	key = salt + 8;
-	edata = key + 32;
+	tag = key + 32;
+	edata = tag + 32;
 	// выделить edata
 	count = bpkiEdataDec(edata, 0, salt, &iter, epki, epki_len);
 	ASSERT(count == epki_len);
-	// построить ключ защиты 
-	code = beltPBKDF2(key, pwd, pwd_len, iter, salt, 8);
-	ERR_CALL_HANDLE(code, blobClose(state));
+	// построить ключ защиты (или найти его в кэше)
+	hit = bpkiCacheGet(key, &use, tag, salt, iter, pwd, pwd_len);
+	if (!hit)
+	{
+		code = beltPBKDF2(key, pwd, pwd_len, iter, salt, 8);
+		ERR_CALL_HANDLE(code, blobClose(state));
+	}
 	// снять защиту
 	code = beltKWPUnwrap(edata, edata, edata_len, 0, key, 32);
 	ERR_CALL_HANDLE(code, blobClose(state));
+	// сохранить ключ защиты в кэше
+	if (use && !hit)
+		bpkiCachePut(key, tag, salt, iter);
 	pki_len = edata_len - 16;
 	// определить длину share
 	count = bpkiShareDec(share, &edata_len, edata, pki_len);
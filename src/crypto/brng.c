@@ -4,7 +4,7 @@
 \brief STB 34.101.47 (brng): algorithms of pseudorandom number generation
 \project bee2 [cryptographic library]
 \created 2013.01.31
-\version 2018.07.09
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,10 +13,12 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/u32.h"
 #include "bee2/core/util.h"
 #include "bee2/core/word.h"
 #include "bee2/crypto/belt.h"
 #include "bee2/crypto/brng.h"
+#include "crypto/belt/belt_lcl.h"
 
 /*
 *******************************************************************************
@@ -60,9 +62,16 @@ static void brngBlockInc(octet block[32])
 *******************************************************************************
 Генерация в режиме CTR
 
-В brng_ctr_st::state_ex размещаются два beltHash-состояния:
--	вспомогательное состояние;
--	состояние beltHash(key ||....).
+Выходной блок Y_t = belt-hash(key || s || X_t || r) определяется по
+хэшируемым данным фиксированной длины 128 октетов. Поэтому вместо
+beltHash-состояния используются непосредственно функции сжатия:
+-	в brngCTRStart() обрабатывается первый блок key, получаются
+	переменные h0 и s0 belt-hash;
+-	в brngCTRStepR() для каждого выходного блока h и сумма s
+	инициализируются значениями h0, s0, обрабатываются блоки s, X_t, r
+	(beltCompr2()) и затем блок длины <1024>_128 || s (beltCompr()).
+
+Неполный последний блок X_t дополняется нулями до 32 октетов.
 *******************************************************************************
 */
 typedef struct
@@ -71,12 +80,17 @@ typedef struct
 	octet r[32];		/*< переменная r */
 	octet block[32];	/*< блок выходных данных */
 	size_t reserved;	/*< резерв выходных октетов */
-	octet state_ex[];	/*< [2 beltHash_keep()] хэш-состояния */
+	u32 h0[8];			/*< переменная h belt-hash после обработки key */
+	u32 s0[4];			/*< сумма s belt-hash после обработки key */
+	u32 h[8];			/*< переменная h belt-hash */
+	u32 ls[8];			/*< блок длины || сумма s belt-hash */
+	u32 X[8];			/*< блок хэшируемых данных */
+	octet stack[];		/*< [beltCompr_deep()] стек beltCompr */
 } brng_ctr_st;
 
 size_t brngCTR_keep()
 {
-	return sizeof(brng_ctr_st) + 2 * beltHash_keep();
+	return sizeof(brng_ctr_st) + beltCompr_deep();
 }
 
 void brngCTRStart(void* state, const octet key[32], const octet iv[32])
@@ -85,8 +99,14 @@ void brngCTRStart(void* state, const octet key[32], const octet iv[32])
 	ASSERT(memIsDisjoint2(s, brngCTR_keep(), key, 32));
 	ASSERT(iv == 0 || memIsDisjoint2(s, brngCTR_keep(), iv, 32));
 	// обработать key
-	beltHashStart(s->state_ex + beltHash_keep());
-	beltHashStepH(key, 32, s->state_ex + beltHash_keep());
+	u32From(s->h0, beltH(), 32);
+	memSetZero(s->s0, sizeof(s->s0));
+	u32From(s->X, key, 32);
+	beltCompr2(s->s0, s->h0, s->X, s->stack);
+	memWipe(s->X, sizeof(s->X));
+	// длина хэшируемых данных: 128 октетов
+	memSetZero(s->ls, sizeof(s->ls));
+	s->ls[0] = 128 * 8;
 	//	сохранить iv
 	if (iv)
 		memCopy(s->s, iv, 32);
@@ -98,6 +118,23 @@ void brngCTRStart(void* state, const octet key[32], const octet iv[32])
 	s->reserved = 0;
 }
 
+static void brngCTRBlock(octet y[32], const octet X[32], brng_ctr_st* s)
+{
+	// h, s <- h0, s0
+	memCopy(s->h, s->h0, sizeof(s->h));
+	memCopy(s->ls + 4, s->s0, sizeof(s->s0));
+	// обработать s, X, r
+	u32From(s->X, s->s, 32);
+	beltCompr2(s->ls + 4, s->h, s->X, s->stack);
+	u32From(s->X, X, 32);
+	beltCompr2(s->ls + 4, s->h, s->X, s->stack);
+	u32From(s->X, s->r, 32);
+	beltCompr2(s->ls + 4, s->h, s->X, s->stack);
+	// обработать блок длины
+	beltCompr(s->h, s->ls, s->stack);
+	u32To(y, 32, s->h);
+}
+
 void brngCTRStepR(void* buf, size_t count, void* state)
 {
 	brng_ctr_st* s = (brng_ctr_st*)state;
@@ -120,11 +157,7 @@ void brngCTRStepR(void* buf, size_t count, void* state)
 	while (count >= 32)
 	{
 		// Y_t <- belt-hash(key || s || X_t || r)
-		memCopy(s->state_ex, s->state_ex + beltHash_keep(), beltHash_keep());
-		beltHashStepH(s->s, 32, s->state_ex);
-		beltHashStepH(buf, 32, s->state_ex);
-		beltHashStepH(s->r, 32, s->state_ex);
-		beltHashStepG(buf, s->state_ex);
+		brngCTRBlock(buf, buf, s);
 		// next
 		brngBlockInc(s->s);
 		brngBlockXor2(s->r, buf);
@@ -135,13 +168,9 @@ void brngCTRStepR(void* buf, size_t count, void* state)
 	if (count)
 	{
 		// block <- beltHash(key || s || zero_pad(X_t) || r)
+		memCopy(s->block, buf, count);
 		memSetZero(s->block + count, 32 - count);
-		memCopy(s->state_ex, s->state_ex + beltHash_keep(), beltHash_keep());
-		beltHashStepH(s->s, 32, s->state_ex);
-		beltHashStepH(buf, count, s->state_ex);
-		beltHashStepH(s->block + count, 32 - count, s->state_ex);
-		beltHashStepH(s->r, 32, s->state_ex);
-		beltHashStepG(s->block, s->state_ex);
+		brngCTRBlock(s->block, s->block, s);
 		// Y_t <- left(block)
 		memCopy(buf, s->block, count);
 		// next
@@ -183,11 +212,17 @@ err_t brngCTRRand(void* buf, size_t count, const octet key[32], octet iv[32])
 *******************************************************************************
 Генерация в режиме HMAC
 
-В brng_hmac_st::state_ex размещаются два beltHMAC-состояния:
--	вспомогательное состояние;
--	состояние beltHMAC(key, ...).
+Ключ обрабатывается однократно: в состоянии сохраняются переменные s и h
+внутреннего (s_in, h_in) и внешнего (s_out, h_out) хэширования после
+сжатия блоков key ^ ipad и key ^ opad (см. beltHMACPads()). Далее
+beltHMAC вычисляется прямыми обращениями к beltCompr2() и beltCompr().
 
-\remark Учитывается инкрементальность beltHMAC
+Выходные блоки Y_t = beltHMAC(key, r_t || iv) и следующие значения
+r_{t+1} = beltHMAC(key, r_t) начинаются с одного и того же сжатия блока r_t.
+Это сжатие выполняется однократно, после чего переменные r вычисляются
+последовательно, а до четырех блоков Y_t -- одновременно на дорожках
+(s[j], h[j]) с помощью beltCompr4(). Если за одно обращение вырабатывается
+один блок, то используются обычные сжатия.
 *******************************************************************************
 */
 typedef struct
@@ -195,21 +230,132 @@ typedef struct
 	const octet* iv;			/*< указатель на синхропосылку */
 	octet iv_buf[64];			/*< синхропосылка (если укладывается) */
 	size_t iv_len;				/*< длина синхропосылки в октетах */
-	octet r[32];				/*< переменная r */
+	u32 r[8];					/*< переменная r */
 	octet block[32];			/*< блок выходных данных */
 	size_t reserved;			/*< резерв выходных октетов */
-	octet state_ex[];			/*< [2 * beltHMAC_keep()] hmac-состояния */
+	u32 s_in[4];				/*< переменная s внутреннего хэширования */
+	u32 h_in[8];				/*< переменная h внутреннего хэширования */
+	u32 s_out[4];				/*< переменная s внешнего хэширования */
+	u32 h_out[8];				/*< переменная h внешнего хэширования */
+	u32 s[4][4];				/*< переменные s дорожек */
+	u32 h[4][8];				/*< переменные h дорожек */
+	u32 X[4][8];				/*< сжимаемые блоки дорожек */
+	u32 ls[8];					/*< блок [4]len || [4]s */
+	u32 t[8];					/*< вспомогательная переменная */
+	octet stack[];				/*< стек beltCompr4 (beltCompr) */
 } brng_hmac_st;
 
 size_t brngHMAC_keep()
 {
-	return sizeof(brng_hmac_st) + 2 * beltHMAC_keep();
+	return sizeof(brng_hmac_st) +
+		utilMax(2,
+			beltCompr_deep(),
+			beltCompr4_deep());
+}
+
+/*
+*******************************************************************************
+Сжатия на дорожках
+
+Функция brngHMACCompr() выполняет сжатия beltCompr2(s[j], h[j], X[j])
+для j < n. Если n > 1, то сжатия выполняются на всех четырех дорожках
+одновременно, а результаты на дорожках j >= n не используются.
+*******************************************************************************
+*/
+
+static void brngHMACCompr(brng_hmac_st* s, size_t n)
+{
+	ASSERT(1 <= n && n <= 4);
+	if (n == 1)
+		beltCompr2(s->s[0], s->h[0], s->X[0], s->stack);
+	else
+		beltCompr4(s->s, s->h, (const u32(*)[8])s->X, s->stack);
+}
+
+/*
+*******************************************************************************
+Выработка блоков
+
+Функция brngHMACBlocks() вырабатывает n <= 4 очередных блоков Y_t
+и размещает их в h[0],..., h[n - 1].
+*******************************************************************************
+*/
+
+static void brngHMACBlocks(brng_hmac_st* s, size_t n)
+{
+	size_t offset, j;
+	ASSERT(1 <= n && n <= 4);
+	// цикл по блокам
+	for (j = 0; j < n; ++j)
+	{
+		// (s_j, h_j) <- сжатие r после key ^ ipad
+		beltBlockCopy(s->s[j], s->s_in);
+		beltBlockCopy(s->h[j], s->h_in);
+		beltBlockCopy(s->h[j] + 4, s->h_in + 4);
+		beltCompr2(s->s[j], s->h[j], s->r, s->stack);
+		// t <- внутреннее хэширование (key ^ ipad) || r
+		beltBlockCopy(s->t, s->h[j]);
+		beltBlockCopy(s->t + 4, s->h[j] + 4);
+		beltBlockSetZero(s->ls);
+		beltBlockAddBitSizeU32(s->ls, 32 * 2);
+		beltBlockCopy(s->ls + 4, s->s[j]);
+		beltCompr(s->t, s->ls, s->stack);
+		// r <- внешнее хэширование (key ^ opad) || t
+		beltBlockCopy(s->ls + 4, s->s_out);
+		beltBlockCopy(s->r, s->h_out);
+		beltBlockCopy(s->r + 4, s->h_out + 4);
+		beltCompr2(s->ls + 4, s->r, s->t, s->stack);
+		beltCompr(s->r, s->ls, s->stack);
+	}
+	// продолжить внутреннее хэширование: iv
+	for (offset = 0; offset < s->iv_len; offset += 32)
+	{
+		if (s->iv_len - offset >= 32)
+			u32From(s->X[0], s->iv + offset, 32);
+		else
+		{
+			memSetZero(s->X[0], 32);
+			u32From(s->X[0], s->iv + offset, s->iv_len - offset);
+		}
+		for (j = 1; j < n; ++j)
+		{
+			beltBlockCopy(s->X[j], s->X[0]);
+			beltBlockCopy(s->X[j] + 4, s->X[0] + 4);
+		}
+		brngHMACCompr(s, n);
+	}
+	// завершить внутреннее хэширование
+	for (j = 0; j < n; ++j)
+	{
+		beltBlockSetZero(s->X[j]);
+		beltBlockAddBitSizeU32(s->X[j], 32 * 2 + s->iv_len);
+		beltBlockCopy(s->X[j] + 4, s->s[j]);
+	}
+	brngHMACCompr(s, n);
+	// внешнее хэширование
+	for (j = 0; j < n; ++j)
+	{
+		beltBlockCopy(s->X[j], s->h[j]);
+		beltBlockCopy(s->X[j] + 4, s->h[j] + 4);
+		beltBlockCopy(s->s[j], s->s_out);
+		beltBlockCopy(s->h[j], s->h_out);
+		beltBlockCopy(s->h[j] + 4, s->h_out + 4);
+	}
+	brngHMACCompr(s, n);
+	for (j = 0; j < n; ++j)
+	{
+		beltBlockSetZero(s->X[j]);
+		beltBlockAddBitSizeU32(s->X[j], 32 * 2);
+		beltBlockCopy(s->X[j] + 4, s->s[j]);
+	}
+	brngHMACCompr(s, n);
 }
 
 void brngHMACStart(void* state, const octet key[], size_t key_len, 
 	const octet iv[], size_t iv_len)
 {
 	brng_hmac_st* s = (brng_hmac_st*)state;
+	size_t len;
 	ASSERT(memIsDisjoint2(s, brngHMAC_keep(), key, key_len));
 	ASSERT(memIsDisjoint2(s, brngHMAC_keep(), iv, iv_len));
 	// запомнить iv
@@ -221,11 +367,39 @@ void brngHMACStart(void* state, const octet key[], size_t key_len,
 	else
 		s->iv = iv;
 	// обработать key
-	beltHMACStart(s->state_ex + beltHMAC_keep(), key, key_len);
-	// r <- beltHMAC(key, iv)
-	memCopy(s->state_ex, s->state_ex + beltHMAC_keep(), beltHMAC_keep());
-	beltHMACStepA(iv, iv_len, s->state_ex);
-	beltHMACStepG(s->r, s->state_ex);
+	beltHMACPads(s->s_in, s->h_in, s->s_out, s->h_out, s->ls, s->block,
+		key, key_len, s->stack);
+	// дорожки
+	memSetZero(s->s, sizeof(s->s));
+	memSetZero(s->h, sizeof(s->h));
+	memSetZero(s->X, sizeof(s->X));
+	// h_0 <- внутреннее хэширование (key ^ ipad) || iv
+	beltBlockCopy(s->s[0], s->s_in);
+	beltBlockCopy(s->h[0], s->h_in);
+	beltBlockCopy(s->h[0] + 4, s->h_in + 4);
+	for (len = iv_len; len >= 32; len -= 32, iv += 32)
+	{
+		u32From(s->X[0], iv, 32);
+		beltCompr2(s->s[0], s->h[0], s->X[0], s->stack);
+	}
+	if (len)
+	{
+		memSetZero(s->X[0], 32);
+		u32From(s->X[0], iv, len);
+		beltCompr2(s->s[0], s->h[0], s->X[0], s->stack);
+	}
+	beltBlockSetZero(s->ls);
+	beltBlockAddBitSizeU32(s->ls, 32 + iv_len);
+	beltBlockCopy(s->ls + 4, s->s[0]);
+	beltCompr(s->h[0], s->ls, s->stack);
+	// r <- внешнее хэширование (key ^ opad) || h_0
+	beltBlockCopy(s->ls + 4, s->s_out);
+	beltBlockCopy(s->r, s->h_out);
+	beltBlockCopy(s->r + 4, s->h_out + 4);
+	beltCompr2(s->ls + 4, s->r, s->h[0], s->stack);
+	beltBlockSetZero(s->ls);
+	beltBlockAddBitSizeU32(s->ls, 32 * 2);
+	beltCompr(s->r, s->ls, s->stack);
 	// нет выходных данных
 	s->reserved = 0;
 }
@@ -233,6 +407,7 @@ void brngHMACStart(void* state, const octet key[], size_t key_len,
 void brngHMACStepR(void* buf, size_t count, void* state)
 {
 	brng_hmac_st* s = (brng_hmac_st*)state;
+	size_t n, j;
 	ASSERT(memIsDisjoint2(buf, count, s, brngHMAC_keep()));
 	// есть резерв данных?
 	if (s->reserved)
@@ -248,33 +423,29 @@ void brngHMACStepR(void* buf, size_t count, void* state)
 		buf = (octet*)buf + s->reserved;
 		s->reserved = 0;
 	}
-	// цикл по полным блокам
-	while (count >= 32)
+	// цикл по группам блоков
+	while (count)
 	{
-		// r <- beltHMAC(key, r) 
-		memCopy(s->state_ex, s->state_ex + beltHMAC_keep(), beltHMAC_keep());
-		beltHMACStepA(s->r, 32, s->state_ex);
-		beltHMACStepG(s->r, s->state_ex);
-		// Y_t <- beltHMAC(key, r || iv)
-		beltHMACStepA(s->iv, s->iv_len, s->state_ex);
-		beltHMACStepG(buf, s->state_ex);
-		// next
-		buf = (octet*)buf + 32;
-		count -= 32;
-	}
-	// неполный блок?
-	if (count)
-	{
-		// r <- beltHMAC(key, r) 
-		memCopy(s->state_ex, s->state_ex + beltHMAC_keep(), beltHMAC_keep());
-		beltHMACStepA(s->r, 32, s->state_ex);
-		beltHMACStepG(s->r, s->state_ex);
-		// Y_t <- left(beltHMAC(key, r || iv))
-		beltHMACStepA(s->iv, s->iv_len, s->state_ex);
-		beltHMACStepG(s->block, s->state_ex);
-		memCopy(buf, s->block, count);
-		// next
-		s->reserved = 32 - count;
+		n = MIN2(4, (count + 31) / 32);
+		brngHMACBlocks(s, n);
+		for (j = 0; j < n; ++j)
+		{
+			// полный блок?
+			if (count >= 32)
+			{
+				u32To(buf, 32, s->h[j]);
+				buf = (octet*)buf + 32;
+				count -= 32;
+			}
+			// неполный блок
+			else
+			{
+				u32To(s->block, 32, s->h[j]);
+				memCopy(buf, s->block, count);
+				s->reserved = 32 - count;
+				count = 0;
+			}
+		}
 	}
 }
 
@@ -4,7 +4,7 @@
 \brief STB 34.101.79 (btok): BAUTH protocol
 \project bee2 [cryptographic library]
 \created 2022.02.22
-\version 2022.11.10
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -23,6 +23,7 @@
 #include "bee2/math/ecp.h"
 #include "bee2/math/ww.h"
 #include "bee2/math/zz.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -77,6 +78,8 @@ typedef struct
 	bign_params params[1];		/*< параметры */
 	bake_settings settings[1];	/*< настройки */
 	bake_cert cert[1];			/*< сертификат */
+	const word* pre;			/*< таблица предвычислений для G (или 0) */
+	const octet* rec;			/*< перекодированный личный ключ (или 0) */
 	octet K0[32];				/*< ключ K0 */
 	octet K1[32];				/*< ключ K1 */
 	octet K2[32];				/*< ключ K2 */
@@ -176,6 +179,7 @@ err_t btokBAuthTStart(void* state, const bign_params* params,
 	s->hdr.o_count = 1;
 	// загрузить личный ключ
 	wwFrom(s->d, privkey, no);
+	s->pre = 0, s->rec = 0;
 	// раскладка стека
 	Q = objEnd(s, word);
 	stack = Q + 2 * n;
@@ -273,13 +277,193 @@ static size_t btokBAuthCTStart_deep(size_t n, size_t f_deep, size_t ec_d,
 			ecpIsOnA_deep(n, f_deep));
 }
 
+/*
+*******************************************************************************
+Контекст терминала
+
+Контекст содержит описание эллиптической кривой, личный ключ терминала dt,
+его перекодированное представление (см. ecRecode()) и таблицу
+предвычислений гребенчатого метода для базовой точки G. Сертификат
+терминала проверяется один раз, при построении контекста.
+
+Сеанс, запущенный функцией btokBAuthTCtxSession(), ссылается на описание
+кривой, личный ключ и таблицы контекста, не копируя их. На шаге 3 сеанс
+определяет dt Vct с помощью ecMulARec(), на шаге 5 -- сумму кратных
+sct G + (2^l + t)Qct с помощью ecCombAddMulA(): кратности sct и t
+не являются секретными.
+*******************************************************************************
+*/
+
+#ifdef LEAN_ENABLED
+	#define BTOK_BAUTH_COMB_W 4
+#else
+	#define BTOK_BAUTH_COMB_W 6
+#endif
+
+typedef struct
+{
+	obj_hdr_t hdr;				/*< заголовок */
+// ptr_table {
+	ec_o* ec;					/*< описание эллиптической кривой */
+	word* d;					/*< [ec->f->n] личный ключ терминала */
+	word* pre;					/*< таблица предвычислений для G */
+	octet* rec;					/*< перекодированный личный ключ */
+// }
+	bign_params params[1];		/*< параметры */
+	bake_cert cert[1];			/*< сертификат терминала */
+	octet descr[];				/*< память для размещения данных */
+} btok_bauth_ctx;
+
+static size_t btokBAuthTCtxDescr_keep(size_t n)
+{
+	return O_OF_W(n) + ecCombPrecA_keep(n, BTOK_BAUTH_COMB_W) +
+		ecRecode_keep(n);
+}
+
+static size_t btokBAuthTCtxStart_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return O_OF_W(2 * n) +
+		utilMax(4,
+			f_deep,
+			ecpIsOnA_deep(n, f_deep),
+			ecRecode_deep(n),
+			ecCombPrecA_deep(n, ec_d, ec_deep));
+}
+
+size_t btokBAuthTCtx_keep(size_t l)
+{
+	// размерности
+	const size_t no = O_OF_B(2 * l);
+	const size_t n = W_OF_B(2 * l);
+	// расчет
+	return sizeof(btok_bauth_ctx) + btokBAuthTCtxDescr_keep(n) +
+		gfpCreate_keep(no) + ecpCreateJ_keep(n);
+}
+
+err_t btokBAuthTCtxStart(void* ctx, const bign_params* params,
+	const octet privkey[], const bake_cert* cert)
+{
+	err_t code;
+	btok_bauth_ctx* c = (btok_bauth_ctx*)ctx;
+	void* state;
+	ec_o* ec;
+	size_t n, no;
+	// стек
+	word* Q;
+	void* stack;
+	// проверить входные данные
+	if (!memIsValid(params, sizeof(bign_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 128 && params->l != 192 && params->l != 256)
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(ctx, btokBAuthTCtx_keep(params->l)) ||
+		!memIsValid(privkey, params->l / 4) ||
+		!memIsValid(cert, sizeof(bake_cert)) ||
+		!memIsValid(cert->data, cert->len) ||
+		cert->val == 0)
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(bignStart_keep(params->l, btokBAuthTCtxStart_deep));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// старт
+	code = bignStart(state, params);
+	ERR_CALL_HANDLE(code, blobClose(state));
+	ec = (ec_o*)state;
+	n = ec->f->n, no = ec->f->no;
+	// раскладка стека
+	Q = objEnd(state, word);
+	stack = Q + 2 * n;
+	// проверить сертификат и его открытый ключ
+	code = cert->val((octet*)Q, params, cert->data, cert->len);
+	ERR_CALL_HANDLE(code, blobClose(state));
+	if (!qrFrom(ecX(Q), (octet*)Q, ec->f, stack) ||
+		!qrFrom(ecY(Q, n), (octet*)Q + no, ec->f, stack) ||
+		!ecpIsOnA(Q, ec, stack))
+	{
+		blobClose(state);
+		return ERR_BAD_CERT;
+	}
+	// подготовить контекст
+	c->hdr.keep = sizeof(btok_bauth_ctx) + btokBAuthTCtxDescr_keep(n);
+	c->hdr.p_count = 4;
+	c->hdr.o_count = 1;
+	c->ec = ec;
+	c->d = (word*)c->descr;
+	c->pre = c->d + n;
+	c->rec = (octet*)(c->pre + (n << BTOK_BAUTH_COMB_W));
+	memCopy(c->params, params, sizeof(bign_params));
+	memCopy(c->cert, cert, sizeof(bake_cert));
+	// загрузить и перекодировать личный ключ
+	wwFrom(c->d, privkey, no);
+	ecRecode(c->rec, c->d, n, stack);
+	// построить таблицу предвычислений
+	if (!ecCombPrecA(c->pre, ec->base, ec, BTOK_BAUTH_COMB_W, stack))
+		code = ERR_BAD_PARAMS;
+	// перенести описание кривой в контекст
+	ASSERT(objKeep(c) + objKeep(state) <= btokBAuthTCtx_keep(params->l));
+	objAppend(c, state, 0);
+	// завершение
+	blobClose(state);
+	return code;
+}
+
+static bool_t btokBAuthTCtxIsOperable(const void* ctx)
+{
+	const btok_bauth_ctx* c = (const btok_bauth_ctx*)ctx;
+	return memIsValid(c, sizeof(btok_bauth_ctx)) &&
+		objPCount(c) == 4 && objOCount(c) == 1 &&
+		objIsOperable(c) &&
+		ecIsOperable(c->ec) &&
+		ecIsOperableGroup(c->ec);
+}
+
+err_t btokBAuthTCtxSession(void* state, const void* ctx,
+	const bake_settings* settings)
+{
+	bake_bauth_t_o* s = (bake_bauth_t_o*)state;
+	const btok_bauth_ctx* c = (const btok_bauth_ctx*)ctx;
+	size_t n, no;
+	// проверить входные данные
+	if (!btokBAuthTCtxIsOperable(c) ||
+		!memIsValid(settings, sizeof(bake_settings)) ||
+		settings->kca != TRUE ||
+		!memIsNullOrValid(settings->helloa, settings->helloa_len) ||
+		!memIsNullOrValid(settings->hellob, settings->hellob_len))
+		return ERR_BAD_INPUT;
+	if (settings->rng == 0)
+		return ERR_BAD_RNG;
+	if (!memIsValid(s, btokBAuthT_keep(c->params->l)))
+		return ERR_BAD_INPUT;
+	n = c->ec->f->n, no = c->ec->f->no;
+	// сохранить параметры, настройки и сертификат
+	memCopy(s->params, c->params, sizeof(bign_params));
+	memCopy(s->settings, settings, sizeof(bake_settings));
+	memCopy(s->cert, c->cert, sizeof(bake_cert));
+	// настроить указатели (ec и d -- внешние ссылки на контекст)
+	s->ec = c->ec;
+	s->d = c->d;
+	s->Vct = (word*)s->data;
+	s->R = (octet*)(s->Vct + 2 * n);
+	s->pre = c->pre;
+	s->rec = c->rec;
+	// настроить заголовок
+	s->hdr.keep = sizeof(bake_bauth_t_o) + O_OF_W(2 * n) + no / 2;
+	s->hdr.p_count = 3;
+	s->hdr.o_count = 0;
+	// все нормально
+	return ERR_OK;
+}
+
 /*
 *******************************************************************************
 Шаги
 *******************************************************************************
 */
 
-err_t btokBAuthCTStep2(octet out[], const bake_cert* certt, void* state)
+static err_t btokBAuthCTStep2Body(octet out[], const bake_cert* certt,
+	void* state)
 {
   err_t code;
 	bake_bauth_ct_o* s = (bake_bauth_ct_o*)state;
@@ -334,6 +518,15 @@ err_t btokBAuthCTStep2(octet out[], const bake_cert* certt, void* state)
 	return ERR_OK;
 }
 
+err_t btokBAuthCTStep2(octet out[], const bake_cert* certt, void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BTOK_BAUTH2);
+	code = btokBAuthCTStep2Body(out, certt, state);
+	STAT_API_END(STAT_API_BTOK_BAUTH2, code);
+	return code;
+}
+
 static size_t btokBAuthCTStep2_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
@@ -343,7 +536,7 @@ static size_t btokBAuthCTStep2_deep(size_t n, size_t f_deep, size_t ec_d,
 			ecMulA_deep(n, ec_d, ec_deep, n));
 }
 
-err_t btokBAuthTStep3(octet out[], const octet in[], void* state)
+static err_t btokBAuthTStep3Body(octet out[], const octet in[], void* state)
 {
 	bake_bauth_t_o* s = (bake_bauth_t_o*)state;
 	size_t n, no;
@@ -378,7 +571,8 @@ err_t btokBAuthTStep3(octet out[], const octet in[], void* state)
 		!ecpIsOnA(s->Vct, s->ec, stack))
 		return ERR_BAD_POINT;
 	// K <- dt Vct
-	if (!ecMulA(K, s->Vct, s->ec, s->d, n, stack))
+	if (s->rec ? !ecMulARec(K, s->Vct, s->ec, s->rec, n, stack) :
+		!ecMulA(K, s->Vct, s->ec, s->d, n, stack))
 		return ERR_BAD_PARAMS;
 	memSetZero(hdr, 16);
 	qrTo((octet*)K, ecX(K), s->ec->f, stack);
@@ -430,19 +624,29 @@ err_t btokBAuthTStep3(octet out[], const octet in[], void* state)
 	return ERR_OK;
 }
 
+err_t btokBAuthTStep3(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BTOK_BAUTH3);
+	code = btokBAuthTStep3Body(out, in, state);
+	STAT_API_END(STAT_API_BTOK_BAUTH3, code);
+	return code;
+}
+
 static size_t btokBAuthTStep3_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return MAX2(O_OF_W(2 * n), 32 + 16 + 16) +
-		utilMax(5,
+		utilMax(6,
 			f_deep,
 			ecMulA_deep(n, ec_d, ec_deep, n),
+			ecMulARec_deep(n, ec_d, ec_deep, n),
 			beltHash_keep(),
 			beltKRP_keep(),
 			beltMAC_keep());
 }
 
-err_t btokBAuthCTStep4(octet out[], const octet in[], void* state)
+static err_t btokBAuthCTStep4Body(octet out[], const octet in[], void* state)
 {
 	bake_bauth_ct_o* s = (bake_bauth_ct_o*)state;
 	size_t n, no;
@@ -514,7 +718,7 @@ err_t btokBAuthCTStep4(octet out[], const octet in[], void* state)
 		// sct <- (uct - (2^l + t)dct) \mod q
 		zzMul(sct, t, n / 2, s->d, n, stack);
 		sct[n + n / 2] = zzAdd2(sct + n / 2, s->d, n);
-		zzMod(sct, sct, n + n / 2 + 1, s->ec->order, n, stack);
+		ecModOrder(sct, sct, n + n / 2 + 1, s->ec, stack);
 		zzSubMod(sct, s->u, sct, s->ec->order, n);
   		// out ||.. <- sct || cert_ct
 		wwTo(out, no, sct);
@@ -532,20 +736,30 @@ err_t btokBAuthCTStep4(octet out[], const octet in[], void* state)
 	return ERR_OK;
 }
 
+err_t btokBAuthCTStep4(octet out[], const octet in[], void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BTOK_BAUTH4);
+	code = btokBAuthCTStep4Body(out, in, state);
+	STAT_API_END(STAT_API_BTOK_BAUTH4, code);
+	return code;
+}
+
 static size_t btokBAuthCTStep4_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return 16 + 32 + 32 + O_OF_W(2 * n + 1) +
-		utilMax(5,
+		utilMax(6,
 			f_deep,
+			ecModOrder_deep(n),
 			ecMulA_deep(n, ec_d, ec_deep, n),
 			beltHash_keep(),
 			beltKRP_keep(),
 			beltMAC_keep());
 }
 
-err_t btokBAuthTStep5(const octet in[], size_t in_len, bake_certval_i val_ct,
-	void* state)
+static err_t btokBAuthTStep5Body(const octet in[], size_t in_len,
+	bake_certval_i val_ct, void* state)
 {
 	err_t code;
 	bake_bauth_t_o* s = (bake_bauth_t_o*)state;
@@ -616,8 +830,10 @@ err_t btokBAuthTStep5(const octet in[], size_t in_len, bake_certval_i val_ct,
 	wwFrom(t, t, no / 2);
 	// sct G + (2^l + t)Qct == Vct?
 	t[n / 2] = 1;
-	if (!ecAddMulA(Qct, s->ec, stack, 2, s->ec->base, sct, n, Qct, t,
-		n / 2 + 1))
+	if (s->pre ? !ecCombAddMulA(Qct, s->pre, s->ec, BTOK_BAUTH_COMB_W, sct, n,
+			Qct, t, n / 2 + 1, stack) :
+		!ecAddMulA(Qct, s->ec, stack, 2, s->ec->base, sct, n, Qct, t,
+			n / 2 + 1))
 		return ERR_BAD_PARAMS;
 	if (!wwEq(Qct, s->Vct, 2 * n))
 		return ERR_AUTH;
@@ -625,17 +841,29 @@ err_t btokBAuthTStep5(const octet in[], size_t in_len, bake_certval_i val_ct,
 	return ERR_OK;
 }
 
+err_t btokBAuthTStep5(const octet in[], size_t in_len, bake_certval_i val_ct,
+	void* state)
+{
+	err_t code;
+	STAT_API_BEGIN(STAT_API_BTOK_BAUTH5);
+	code = btokBAuthTStep5Body(in, in_len, val_ct, state);
+	STAT_API_END(STAT_API_BTOK_BAUTH5, code);
+	return code;
+}
+
 static size_t btokBAuthTStep5_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(3 * n + n / 2 + 1) +
-		utilMax(6,
+		utilMax(7,
 			beltHash_keep(),
 			beltMAC_keep(),
 			beltCFB_keep(),
 			f_deep,
 			ecpIsOnA_deep(n, f_deep),
-			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1));
+			ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n / 2 + 1),
+			ecCombAddMulA_deep(n, ec_d, ec_deep, BTOK_BAUTH_COMB_W,
+				n / 2 + 1));
 }
 
 static size_t btokBAuthCT_deep(size_t n, size_t f_deep, size_t ec_d,
@@ -4,7 +4,7 @@
 \brief STB 34.101.79 (btok): CV certificates
 \project bee2 [cryptographic library]
 \created 2022.07.04
-\version 2022.10.31
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -14,6 +14,7 @@
 #include "bee2/core/err.h"
 #include "bee2/core/der.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/hex.h"
 #include "bee2/core/rng.h"
 #include "bee2/core/str.h"
@@ -88,7 +89,7 @@ static err_t btokKeypairVal(const octet privkey[], size_t privkey_len,
 }
 
 static err_t btokSign(octet sig[], const void* buf, size_t count,
-	const octet privkey[], size_t privkey_len)
+	const octet privkey[], size_t privkey_len, const void* ctx)
 {
 	err_t code;
 	void* stack;
@@ -144,8 +145,13 @@ static err_t btokSign(octet sig[], const void* buf, size_t count,
 		rngStepR(t, t_len = privkey_len, 0);
 	else
 		t_len = 0;
-	// подписать
-	code = bignSign2(sig, params, oid_der, oid_len, hash, privkey, t, t_len);
+	// подписать (в контексте, если он задан)
+	if (ctx)
+		code = bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, t,
+			t_len);
+	else
+		code = bignSign2(sig, params, oid_der, oid_len, hash, privkey, t,
+			t_len);
 	blobClose(stack);
 	return code;
 }
@@ -208,6 +214,31 @@ static err_t btokVerify(const void* buf, size_t count, const octet sig[],
 	return code;
 }
 
+static err_t btokParamsStd(bign_params* params, octet oid_der[],
+	size_t* oid_len, size_t pubkey_len)
+{
+	err_t code;
+	ASSERT(pubkey_len == 64 || pubkey_len == 96 || pubkey_len == 128);
+	code = bignStdParams(params,
+		pubkey_len == 64 ? "1.2.112.0.2.0.34.101.45.3.1" :
+		pubkey_len == 96 ? "1.2.112.0.2.0.34.101.45.3.2" :
+		"1.2.112.0.2.0.34.101.45.3.3");
+	ERR_CALL_CHECK(code);
+	return bignOidToDER(oid_der, oid_len,
+		pubkey_len == 64 ? "1.2.112.0.2.0.34.101.31.81" :
+		pubkey_len == 96 ? "1.2.112.0.2.0.34.101.77.12" :
+		"1.2.112.0.2.0.34.101.77.13");
+}
+
+static err_t btokHash(octet hash[], const void* buf, size_t count,
+	size_t pubkey_len)
+{
+	ASSERT(pubkey_len == 64 || pubkey_len == 96 || pubkey_len == 128);
+	if (pubkey_len == 64)
+		return beltHash(hash, buf, count);
+	return bashHash(hash, pubkey_len * 2, buf, count);
+}
+
 /*
 *******************************************************************************
 Содержание CV-сертификата
@@ -253,10 +284,8 @@ err_t btokCVCCheck(const btok_cvc_t* cvc)
 	return btokPubkeyVal(cvc->pubkey, cvc->pubkey_len);
 }
 
-err_t btokCVCCheck2(const btok_cvc_t* cvc, const btok_cvc_t* cvca)
+static err_t btokCVCCheckIss(const btok_cvc_t* cvc, const btok_cvc_t* cvca)
 {
-	err_t code = btokCVCCheck(cvc);
-	ERR_CALL_CHECK(code);
 	if (!memIsValid(cvca, sizeof(btok_cvc_t)))
 		return ERR_BAD_INPUT;
 	if (!strEq(cvc->authority, cvca->holder))
@@ -269,6 +298,13 @@ err_t btokCVCCheck2(const btok_cvc_t* cvc, const btok_cvc_t* cvca)
 	return ERR_OK;
 }
 
+err_t btokCVCCheck2(const btok_cvc_t* cvc, const btok_cvc_t* cvca)
+{
+	err_t code = btokCVCCheck(cvc);
+	ERR_CALL_CHECK(code);
+	return btokCVCCheckIss(cvc, cvca);
+}
+
 /*
 *******************************************************************************
 Основная часть (тело) CV-сертификата
@@ -427,6 +463,171 @@ static size_t btokCVCBodyDec(btok_cvc_t* cvc, const octet body[], size_t count)
 	return ptr - body;
 }
 
+/*
+*******************************************************************************
+Кэш проверенных CV-сертификатов
+
+Кэш хранит содержание CV-сертификатов, которые были успешно разобраны
+функцией btokCVCUnwrap(). Ключом записи кэша служит хэш-значение
+beltHash(<pubkey_len>_8 || pubkey || cert), где pubkey -- открытый ключ,
+на котором проверялась подпись cert (возможно, пустой). Повторный разбор
+сертификата с тем же ключом проверки сводится к поиску записи и
+копированию содержания: ни декодирование, ни проверка подписи не
+выполняются.
+
+Записи размещаются в блобе _cache. Поиск линейный: кэш рассчитан на
+десятки-сотни записей. При переполнении вытесняется запись, к которой
+дольше всего не обращались (LRU): каждое обращение к записи присваивает ей
+очередное значение счетчика _cache_stamp, вытесняется запись с наименьшим
+значением.
+
+Самоподписанные сертификаты, подпись которых проверяется на собственном
+открытом ключе (pubkey == cvc->pubkey, pubkey_len == 0), не кэшируются:
+ключ проверки становится известен только после декодирования.
+
+Кэш, его размер и счетчики защищены мьютексом _cache_mtx. Размер
+_cache_max дополнительно читается атомарно без блокировки, чтобы
+отключенный кэш не замедлял разбор.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet key[32];			/*< ключ записи */
+	btok_cvc_t cvc[1];		/*< содержание сертификата */
+	size_t stamp;			/*< момент последнего обращения */
+} btok_cvc_entry_st;
+
+static size_t _cache_once;				/*< триггер однократности */
+static mt_mtx_t _cache_mtx[1];			/*< мьютекс */
+static bool_t _cache_inited;			/*< мьютекс создан? */
+static btok_cvc_entry_st* _cache;		/*< записи */
+static size_t _cache_max;				/*< максимальное число записей */
+static size_t _cache_count;				/*< число записей */
+static size_t _cache_stamp;				/*< счетчик обращений */
+
+static void btokCVCCacheDestroy()
+{
+	blobClose(_cache), _cache = 0;
+	_cache_max = _cache_count = 0;
+	mtMtxClose(_cache_mtx);
+	_cache_inited = FALSE;
+}
+
+static void btokCVCCacheInit()
+{
+	ASSERT(!_cache_inited);
+	if (!mtMtxCreate(_cache_mtx))
+		return;
+	if (!utilOnExit(btokCVCCacheDestroy))
+	{
+		mtMtxClose(_cache_mtx);
+		return;
+	}
+	_cache_inited = TRUE;
+}
+
+bool_t btokCVCCacheSetMax(size_t max)
+{
+	btok_cvc_entry_st* cache = 0;
+	// входной контроль
+	if (max > BTOK_CVC_CACHE_MAX)
+		return FALSE;
+	// инициализировать однократно
+	if (!mtCallOnce(&_cache_once, btokCVCCacheInit) || !_cache_inited)
+		return FALSE;
+	// выделить память
+	if (max)
+	{
+		cache = (btok_cvc_entry_st*)blobCreate(
+			max * sizeof(btok_cvc_entry_st));
+		if (!cache)
+			return FALSE;
+	}
+	// заменить кэш
+	mtMtxLock(_cache_mtx);
+	blobClose(_cache);
+	_cache = cache, _cache_count = 0;
+	mtAtomicStore(&_cache_max, max);
+	mtMtxUnlock(_cache_mtx);
+	return TRUE;
+}
+
+void btokCVCCacheFlush()
+{
+	if (!mtAtomicLoad(&_cache_max))
+		return;
+	mtMtxLock(_cache_mtx);
+	memWipe(_cache, _cache_count * sizeof(btok_cvc_entry_st));
+	_cache_count = 0;
+	mtMtxUnlock(_cache_mtx);
+}
+
+static bool_t btokCVCCacheKey(octet key[32], const octet cert[],
+	size_t cert_len, const octet pubkey[], size_t pubkey_len)
+{
+	void* state;
+	octet len;
+	// кэш отключен?
+	if (!mtAtomicLoad(&_cache_max))
+		return FALSE;
+	// выделить память
+	state = blobCreate(beltHash_keep());
+	if (!state)
+		return FALSE;
+	// key <- beltHash(<pubkey_len>_8 || pubkey || cert)
+	ASSERT(pubkey_len < 256);
+	len = (octet)pubkey_len;
+	beltHashStart(state);
+	beltHashStepH(&len, 1, state);
+	beltHashStepH(pubkey, pubkey_len, state);
+	beltHashStepH(cert, cert_len, state);
+	beltHashStepG(key, state);
+	// завершить
+	blobClose(state);
+	return TRUE;
+}
+
+static bool_t btokCVCCacheGet(btok_cvc_t* cvc, const octet key[32])
+{
+	size_t pos;
+	bool_t found = FALSE;
+	mtMtxLock(_cache_mtx);
+	for (pos = 0; pos < _cache_count; ++pos)
+		if (memEq(_cache[pos].key, key, 32))
+		{
+			memCopy(cvc, _cache[pos].cvc, sizeof(btok_cvc_t));
+			_cache[pos].stamp = ++_cache_stamp;
+			found = TRUE;
+			break;
+		}
+	mtMtxUnlock(_cache_mtx);
+	return found;
+}
+
+static void btokCVCCachePut(const btok_cvc_t* cvc, const octet key[32])
+{
+	size_t pos, i;
+	mtMtxLock(_cache_mtx);
+	// кэш отключили?
+	if (!_cache_max)
+	{
+		mtMtxUnlock(_cache_mtx);
+		return;
+	}
+	// найти свободную или вытесняемую запись
+	if (_cache_count < _cache_max)
+		pos = _cache_count++;
+	else for (pos = 0, i = 1; i < _cache_count; ++i)
+		if (_cache[i].stamp < _cache[pos].stamp)
+			pos = i;
+	// записать
+	memCopy(_cache[pos].key, key, 32);
+	memCopy(_cache[pos].cvc, cvc, sizeof(btok_cvc_t));
+	_cache[pos].stamp = ++_cache_stamp;
+	mtMtxUnlock(_cache_mtx);
+}
+
 /*
 *******************************************************************************
 Создание / разбор CV-сертификата
@@ -437,19 +638,19 @@ SEQ[APPLICATION 33] CVCertificate
 *******************************************************************************
 */
 
-err_t btokCVCWrap(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
-	const octet privkey[], size_t privkey_len)
+static err_t btokCVCWrapInternal(octet cert[], size_t* cert_len, 
+	btok_cvc_t* cvc, const octet privkey[], size_t privkey_len, 
+	const void* ctx)
 {
 	err_t code;
 	der_anchor_t CVCert[1];
 	size_t count = 0;
 	size_t t;
-	// проверить входные данные
-	if (!memIsValid(cvc, sizeof(btok_cvc_t)) ||
-		privkey_len != 32 && privkey_len != 48 && privkey_len != 64 ||
-		!memIsValid(privkey, privkey_len) ||
-		!memIsNullOrValid(cert_len, O_PER_S))
-		return ERR_BAD_INPUT;
+	// pre
+	ASSERT(memIsValid(cvc, sizeof(btok_cvc_t)));
+	ASSERT(privkey_len == 32 || privkey_len == 48 || privkey_len == 64);
+	ASSERT(memIsValid(privkey, privkey_len));
+	ASSERT(memIsNullOrValid(cert_len, O_PER_S));
 	// построить открытый ключ
 	if (cvc->pubkey_len == 0)
 	{
@@ -471,7 +672,7 @@ err_t btokCVCWrap(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
 	ASSERT(t != SIZE_MAX);
 	if (cert)
 	{
-		code = btokSign(cvc->sig, cert, t, privkey, privkey_len);
+		code = btokSign(cvc->sig, cert, t, privkey, privkey_len, ctx);
 		ERR_CALL_CHECK(code);
 	}
 	cert = cert ? cert + t : 0, count += t;
@@ -490,24 +691,28 @@ err_t btokCVCWrap(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
 	return ERR_OK;
 }
 
-err_t btokCVCUnwrap(btok_cvc_t* cvc, const octet cert[], size_t cert_len,
-	const octet pubkey[], size_t pubkey_len)
+err_t btokCVCWrap(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
+	const octet privkey[], size_t privkey_len)
 {
-	err_t code;
-	der_anchor_t CVCert[1];
-	size_t t;
-	const octet* body;
-	size_t body_len;
 	// проверить входные данные
 	if (!memIsValid(cvc, sizeof(btok_cvc_t)) ||
-		pubkey_len != 0 &&
-			pubkey_len != 64 && pubkey_len != 96 &&	pubkey_len != 128 ||
-		pubkey_len == 0 && pubkey != 0 && pubkey != cvc->pubkey ||
-		!memIsValid(cert, cert_len) ||
-		!memIsValid(pubkey, pubkey_len) ||
-		!memIsDisjoint2(cvc, sizeof(btok_cvc_t), cert, cert_len) ||
-		!memIsDisjoint2(cvc, sizeof(btok_cvc_t), pubkey, pubkey_len))
+		privkey_len != 32 && privkey_len != 48 && privkey_len != 64 ||
+		!memIsValid(privkey, privkey_len) ||
+		!memIsNullOrValid(cert_len, O_PER_S))
 		return ERR_BAD_INPUT;
+	return btokCVCWrapInternal(cert, cert_len, cvc, privkey, privkey_len, 0);
+}
+
+static err_t btokCVCDec(btok_cvc_t* cvc, const octet** body,
+	size_t* body_len, const octet cert[], size_t cert_len, size_t sig_len)
+{
+	der_anchor_t CVCert[1];
+	size_t t;
+	// pre
+	ASSERT(memIsValid(cvc, sizeof(btok_cvc_t)));
+	ASSERT(memIsValid(cert, cert_len));
+	ASSERT(sig_len == 0 || sig_len == 48 || sig_len == 72 || sig_len == 96 ||
+		sig_len == SIZE_MAX);
 	// подготовить cvc
 	memSetZero(cvc, sizeof(btok_cvc_t));
 	// начать декодирование...
@@ -519,33 +724,24 @@ err_t btokCVCUnwrap(btok_cvc_t* cvc, const octet cert[], size_t cert_len,
 	t = btokCVCBodyDec(cvc, cert, cert_len);
 	if (t == SIZE_MAX)
 		return ERR_BAD_FORMAT;
-	body = cert, body_len = t;
+	*body = cert, *body_len = t;
 	cert = cert ? cert + t : 0, cert_len -= t;
 	// ...определить длину подписи...
-	if (pubkey_len == 0 && pubkey == cvc->pubkey)
-		pubkey_len = cvc->pubkey_len;
-	if (pubkey_len == 0)
+	if (sig_len == SIZE_MAX)
+		sig_len = cvc->pubkey_len - cvc->pubkey_len / 4;
+	if (sig_len == 0)
 	{
-		size_t sig_len;
 		if (derDec3(0, cert, cert_len, 0x5F37, sig_len = 48) == SIZE_MAX &&
 			derDec3(0, cert, cert_len, 0x5F37, sig_len = 72) == SIZE_MAX &&
 			derDec3(0, cert, cert_len, 0x5F37, sig_len = 96) == SIZE_MAX)
 			return ERR_BAD_FORMAT;
-		cvc->sig_len = sig_len;
 	}
-	else 
-		cvc->sig_len = pubkey_len - pubkey_len / 4;
+	cvc->sig_len = sig_len;
 	// ...декодировать подпись...
 	t = derTOCTDec2(cvc->sig, cert, cert_len, 0x5F37, cvc->sig_len);
 	if (t == SIZE_MAX)
 		return ERR_BAD_FORMAT;
 	cert = cert ? cert + t : 0, cert_len -= t;
-	// ...проверить подпись...
-	if (pubkey_len)
-	{
-		code = btokVerify(body, body_len, cvc->sig, pubkey, pubkey_len);
-		ERR_CALL_CHECK(code);
-	}
 	// ...завершить декодирование
 	t = derTSEQDecStop(cert, CVCert);
 	if (t == SIZE_MAX)
@@ -557,6 +753,54 @@ err_t btokCVCUnwrap(btok_cvc_t* cvc, const octet cert[], size_t cert_len,
 	return btokCVCCheck(cvc);
 }
 
+err_t btokCVCUnwrap(btok_cvc_t* cvc, const octet cert[], size_t cert_len,
+	const octet pubkey[], size_t pubkey_len)
+{
+	err_t code;
+	const octet* body;
+	size_t body_len;
+	octet key[32];
+	bool_t cached;
+	// проверить входные данные
+	if (!memIsValid(cvc, sizeof(btok_cvc_t)) ||
+		pubkey_len != 0 &&
+			pubkey_len != 64 && pubkey_len != 96 &&	pubkey_len != 128 ||
+		pubkey_len == 0 && pubkey != 0 && pubkey != cvc->pubkey ||
+		!memIsValid(cert, cert_len) ||
+		!memIsValid(pubkey, pubkey_len) ||
+		!memIsDisjoint2(cvc, sizeof(btok_cvc_t), cert, cert_len) ||
+		!memIsDisjoint2(cvc, sizeof(btok_cvc_t), pubkey, pubkey_len))
+		return ERR_BAD_INPUT;
+	// найти в кэше
+	cached = (pubkey_len != 0 || pubkey == 0) &&
+		btokCVCCacheKey(key, cert, cert_len, pubkey, pubkey_len);
+	if (cached && btokCVCCacheGet(cvc, key))
+		return ERR_OK;
+	// декодировать
+	if (pubkey_len == 0 && pubkey == cvc->pubkey)
+	{
+		code = btokCVCDec(cvc, &body, &body_len, cert, cert_len, SIZE_MAX);
+		ERR_CALL_CHECK(code);
+		pubkey_len = cvc->pubkey_len;
+	}
+	else
+	{
+		code = btokCVCDec(cvc, &body, &body_len, cert, cert_len,
+			pubkey_len - pubkey_len / 4);
+		ERR_CALL_CHECK(code);
+	}
+	// проверить подпись
+	if (pubkey_len)
+	{
+		code = btokVerify(body, body_len, cvc->sig, pubkey, pubkey_len);
+		ERR_CALL_CHECK(code);
+	}
+	// сохранить в кэше
+	if (cached)
+		btokCVCCachePut(cvc, key);
+	return ERR_OK;
+}
+
 /*
 *******************************************************************************
 Выпуск CV-сертификата
@@ -589,6 +833,84 @@ err_t btokCVCIss(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
 	return code;
 }
 
+/*
+*******************************************************************************
+Пакетный выпуск CV-сертификатов
+
+Состояние содержит разобранный сертификат издателя, личный ключ издателя
+и контекст bign, построенный на стандартных параметрах уровня стойкости 
+ключа. Соответствие личного ключа сертификату проверяется однократно 
+в btokCVCIssStart().
+*******************************************************************************
+*/
+
+typedef struct
+{
+	btok_cvc_t cvca[1];		/*< содержание сертификата издателя */
+	size_t privkeya_len;	/*< длина личного ключа */
+	octet privkeya[64];		/*< личный ключ */
+	octet ctx[];			/*< [bignCtx_keep(l)] контекст bign */
+} btok_cvc_iss_st;
+
+size_t btokCVCIss_keep(size_t privkeya_len)
+{
+	ASSERT(privkeya_len == 32 || privkeya_len == 48 || privkeya_len == 64);
+	return sizeof(btok_cvc_iss_st) + bignCtx_keep(privkeya_len * 4);
+}
+
+err_t btokCVCIssStart(void* state, const octet certa[], size_t certa_len,
+	const octet privkeya[], size_t privkeya_len)
+{
+	err_t code;
+	btok_cvc_iss_st* st = (btok_cvc_iss_st*)state;
+	bign_params params[1];
+	// проверить входные данные
+	if (privkeya_len != 32 && privkeya_len != 48 && privkeya_len != 64 ||
+		!memIsValid(privkeya, privkeya_len) ||
+		!memIsValid(state, btokCVCIss_keep(privkeya_len)))
+		return ERR_BAD_INPUT;
+	// разобрать сертификат издателя
+	code = btokCVCUnwrap(st->cvca, certa, certa_len, 0, 0);
+	ERR_CALL_CHECK(code);
+	if (st->cvca->pubkey_len != 2 * privkeya_len)
+		return ERR_BAD_KEYPAIR;
+	// построить контекст
+	code = bignStdParams(params,
+		privkeya_len == 32 ? "1.2.112.0.2.0.34.101.45.3.1" :
+		privkeya_len == 48 ? "1.2.112.0.2.0.34.101.45.3.2" :
+		"1.2.112.0.2.0.34.101.45.3.3");
+	ERR_CALL_CHECK(code);
+	code = bignCtxStart(st->ctx, params);
+	ERR_CALL_CHECK(code);
+	// проверить ключи издателя
+	code = bignCtxValKeypair(st->ctx, privkeya, st->cvca->pubkey);
+	ERR_CALL_CHECK(code);
+	// сохранить личный ключ
+	memCopy(st->privkeya, privkeya, privkeya_len);
+	st->privkeya_len = privkeya_len;
+	return ERR_OK;
+}
+
+err_t btokCVCIssStep(octet cert[], size_t* cert_len, btok_cvc_t* cvc,
+	const void* state)
+{
+	err_t code;
+	const btok_cvc_iss_st* st = (const btok_cvc_iss_st*)state;
+	// проверить входные данные
+	if (!memIsValid(st, sizeof(btok_cvc_iss_st)) ||
+		st->privkeya_len != 32 && st->privkeya_len != 48 && 
+			st->privkeya_len != 64 ||
+		!memIsValid(cvc, sizeof(btok_cvc_t)) ||
+		!memIsNullOrValid(cert_len, O_PER_S))
+		return ERR_BAD_INPUT;
+	// проверить содержимое выпускаемого сертификата
+	code = btokCVCCheck2(cvc, st->cvca);
+	ERR_CALL_CHECK(code);
+	// создать сертификат
+	return btokCVCWrapInternal(cert, cert_len, cvc, st->privkeya,
+		st->privkeya_len, st->ctx);
+}
+
 /*
 *******************************************************************************
 Точная длина CV-сертификата
@@ -626,9 +948,9 @@ err_t btokCVCVal(const octet cert[], size_t cert_len,
 	cvca = cvc + 1;
 	// разобрать сертификаты
 	code = btokCVCUnwrap(cvca, certa, certa_len, 0, 0);
-	ERR_CALL_HANDLE(code, blobClose(cvca));
+	ERR_CALL_HANDLE(code, blobClose(state));
 	code = btokCVCUnwrap(cvc, cert, cert_len, cvca->pubkey, cvca->pubkey_len);
-	ERR_CALL_HANDLE(code, blobClose(cvc));
+	ERR_CALL_HANDLE(code, blobClose(state));
 	// проверить соответствие
 	code = btokCVCCheck2(cvc, cvca);
 	ERR_CALL_HANDLE(code, blobClose(cvc));
@@ -685,6 +1007,172 @@ err_t btokCVCVal2(btok_cvc_t* cvc, const octet cert[], size_t cert_len,
 	return code;
 }
 
+/*
+*******************************************************************************
+Проверка цепочки CV-сертификатов
+
+Проверка выполняется в два этапа. Сначала все сертификаты цепочки
+разбираются без проверки подписей, проверяется их соответствие издателям
+и вычисляются хэш-значения основных частей. Затем подписи проверяются
+пакетами: в один пакет bignVerifyBatch() попадают подписи, выработанные
+на ключах одного уровня стойкости. Описание кривой и память готовятся
+однократно для всего пакета.
+
+Если сертификат i не разобран, то сертификаты после него не
+обрабатываются, но подписи сертификатов 0,..., i - 1 все равно
+проверяются: ошибочной признается первая из проблемных позиций.
+*******************************************************************************
+*/
+
+err_t btokCVCValChain(size_t* bad, btok_cvc_t* cvc, const octet certs[],
+	size_t certs_len, const btok_cvc_t* cvca, const octet* date)
+{
+	err_t code;
+	size_t count, decoded, fail, pos, t, i, j, n, l;
+	void* state;
+	bign_params* params;
+	btok_cvc_t* cvcs;
+	size_t* idx;
+	err_t* codes;
+	octet* hashes;
+	octet* batch_hashes;
+	octet* batch_sigs;
+	octet* batch_pubkeys;
+	octet oid_der[16];
+	size_t oid_len;
+	const btok_cvc_t* issuer;
+	const octet* body;
+	size_t body_len;
+	// входной контроль
+	if (!memIsNullOrValid(bad, sizeof(size_t)) ||
+		!memIsNullOrValid(cvc, sizeof(btok_cvc_t)) ||
+		!memIsValid(certs, certs_len) ||
+		!memIsNullOrValid(cvca, sizeof(btok_cvc_t)) ||
+		!memIsNullOrValid(date, 6))
+		return ERR_BAD_INPUT;
+	if (bad)
+		*bad = SIZE_MAX;
+	// определить число сертификатов
+	for (count = pos = 0; pos < certs_len; ++count, pos += t)
+	{
+		t = btokCVCLen(certs + pos, certs_len - pos);
+		if (t == SIZE_MAX)
+		{
+			if (bad)
+				*bad = count;
+			return ERR_BAD_FORMAT;
+		}
+	}
+	if (count == 0)
+		return ERR_BAD_INPUT;
+	// проверить ключ доверенного издателя
+	if (cvca)
+	{
+		code = btokPubkeyVal(cvca->pubkey, cvca->pubkey_len);
+		ERR_CALL_CHECK(code);
+	}
+	// выделить и разметить память
+	state = blobCreate(sizeof(bign_params) + count * (sizeof(btok_cvc_t) +
+		sizeof(size_t) + sizeof(err_t) + 64 + 64 + 96 + 128));
+	if (!state)
+		return ERR_OUTOFMEMORY;
+	params = (bign_params*)state;
+	cvcs = (btok_cvc_t*)(params + 1);
+	idx = (size_t*)(cvcs + count);
+	codes = (err_t*)(idx + count);
+	hashes = (octet*)(codes + count);
+	batch_hashes = hashes + 64 * count;
+	batch_sigs = batch_hashes + 64 * count;
+	batch_pubkeys = batch_sigs + 96 * count;
+	// разобрать сертификаты и хэшировать основные части
+	code = ERR_OK;
+	for (decoded = pos = 0; decoded < count; ++decoded, pos += t)
+	{
+		t = btokCVCLen(certs + pos, certs_len - pos);
+		ASSERT(t != SIZE_MAX);
+		issuer = decoded ? cvcs + decoded - 1 : cvca;
+		if (issuer)
+		{
+			code = btokCVCDec(cvcs + decoded, &body, &body_len, certs + pos,
+				t, issuer->pubkey_len - issuer->pubkey_len / 4);
+			if (code == ERR_OK)
+				code = btokCVCCheck2(cvcs + decoded, issuer);
+		}
+		else
+		{
+			code = btokCVCDec(cvcs, &body, &body_len, certs + pos, t,
+				SIZE_MAX);
+			issuer = cvcs;
+		}
+		if (code == ERR_OK)
+			code = btokHash(hashes + 64 * decoded, body, body_len,
+				issuer->pubkey_len);
+		if (code != ERR_OK)
+			break;
+	}
+	// проверить подписи пакетами по уровням стойкости
+	fail = decoded;
+	for (l = 64; l <= 128; l += 32)
+	{
+		err_t batch_code;
+		// собрать пакет
+		for (n = i = 0; i < decoded; ++i)
+		{
+			issuer = i ? cvcs + i - 1 : cvca ? cvca : cvcs;
+			if (issuer->pubkey_len != l)
+				continue;
+			idx[n] = i;
+			memCopy(batch_hashes + n * l / 2, hashes + 64 * i, l / 2);
+			memCopy(batch_sigs + n * (l - l / 4), cvcs[i].sig, l - l / 4);
+			memCopy(batch_pubkeys + n * l, issuer->pubkey, l);
+			++n;
+		}
+		if (n == 0)
+			continue;
+		// проверить пакет
+		oid_len = sizeof(oid_der);
+		batch_code = btokParamsStd(params, oid_der, &oid_len, l);
+		ERR_CALL_HANDLE(batch_code, blobClose(state));
+		memSetZero(codes, n * sizeof(err_t));
+		batch_code = bignVerifyBatch(params, oid_der, oid_len, n,
+			batch_hashes, batch_sigs, batch_pubkeys, codes);
+		if (batch_code == ERR_OK)
+			continue;
+		// найти первую ошибку
+		for (j = 0; j < n && codes[j] == ERR_OK; ++j);
+		if (j == n)
+		{
+			blobClose(state);
+			return batch_code;
+		}
+		for (; j < n; ++j)
+			if (codes[j] != ERR_OK && idx[j] < fail)
+				fail = idx[j], code = codes[j];
+	}
+	// проверить дату
+	if (fail == count && date)
+	{
+		fail = count - 1;
+		if (!tmDateIsValid2(date))
+			code = ERR_BAD_DATE;
+		else if (!tmDateLeq2(cvcs[fail].from, date) ||
+			!tmDateLeq2(date, cvcs[fail].until))
+			code = ERR_OUTOFRANGE;
+		else
+			fail = count;
+	}
+	// завершить
+	if (code == ERR_OK)
+	{
+		if (cvc)
+			memCopy(cvc, cvcs + count - 1, sizeof(btok_cvc_t));
+	}
+	else if (bad)
+		*bad = fail;
+	blobClose(state);
+	return code;
+}
+
 /*
 *******************************************************************************
 Проверка соответствия CV-сертификата
@@ -709,3 +1197,348 @@ err_t btokCVCMatch(const octet cert[], size_t cert_len, const octet privkey[],
 	blobClose(cvc);
 	return code;
 }
+
+/*
+*******************************************************************************
+Дескриптор CV-сертификата
+
+Дескриптор хранит содержание сертификата, DER-код его основной части
+и результаты уже выполненных проверок:
+- открытый ключ сертификата проверяется при разборе (btokCVCCheck());
+- ключ издателя, на котором успешно проверена подпись, сохраняется
+  в поле val_key. Повторная проверка на том же ключе сводится
+  к сравнению ключей;
+- хэш-значение beltHash(privkey) личного ключа, соответствие которому
+  установлено, сохраняется в поле match. Повторная проверка соответствия
+  тому же ключу сводится к хэшированию и сравнению.
+
+Длина основной части сертификата ограничена: самый длинный сертификат,
+допустимый профилем, имеет длину 365 октетов, из них на основную часть
+приходится 261 октет.
+*******************************************************************************
+*/
+
+#define BTOK_CVCH_BODY_MAX 272
+
+typedef struct
+{
+	btok_cvc_t cvc[1];					/*< содержание */
+	octet body[BTOK_CVCH_BODY_MAX];		/*< основная часть */
+	size_t body_len;					/*< длина основной части */
+	octet val_key[128];					/*< ключ проверки подписи */
+	size_t val_key_len;					/*< длина val_key (0 -- нет) */
+	octet match[32];					/*< хэш личного ключа */
+	bool_t matched;						/*< match определен? */
+} btok_cvch_st;
+
+size_t btokCVCH_keep()
+{
+	return sizeof(btok_cvch_st);
+}
+
+err_t btokCVCHStart(void* h, const octet cert[], size_t cert_len)
+{
+	err_t code;
+	btok_cvch_st* st = (btok_cvch_st*)h;
+	const octet* body;
+	size_t body_len;
+	// проверить входные данные
+	if (!memIsValid(h, sizeof(btok_cvch_st)) ||
+		!memIsValid(cert, cert_len) ||
+		!memIsDisjoint2(h, sizeof(btok_cvch_st), cert, cert_len))
+		return ERR_BAD_INPUT;
+	// декодировать (с проверкой открытого ключа)
+	memSetZero(st, sizeof(btok_cvch_st));
+	code = btokCVCDec(st->cvc, &body, &body_len, cert, cert_len, 0);
+	ERR_CALL_CHECK(code);
+	if (body_len > sizeof(st->body))
+		return ERR_BAD_FORMAT;
+	// сохранить основную часть
+	memCopy(st->body, body, body_len);
+	st->body_len = body_len;
+	return ERR_OK;
+}
+
+const btok_cvc_t* btokCVCHCvc(const void* h)
+{
+	const btok_cvch_st* st = (const btok_cvch_st*)h;
+	if (!memIsValid(h, sizeof(btok_cvch_st)))
+		return 0;
+	return st->cvc;
+}
+
+err_t btokCVCHVal(void* h, const void* ha, const octet* date)
+{
+	err_t code;
+	btok_cvch_st* st = (btok_cvch_st*)h;
+	const btok_cvc_t* cvca;
+	// проверить входные данные
+	if (!memIsValid(h, sizeof(btok_cvch_st)) ||
+		!memIsNullOrValid(ha, sizeof(btok_cvch_st)) ||
+		!memIsNullOrValid(date, 6))
+		return ERR_BAD_INPUT;
+	// проверить соответствие издателю
+	if (ha == 0 || ha == h)
+		cvca = st->cvc;
+	else
+	{
+		cvca = ((const btok_cvch_st*)ha)->cvc;
+		code = btokCVCCheckIss(st->cvc, cvca);
+		ERR_CALL_CHECK(code);
+	}
+	// проверить подпись (если она еще не проверялась на ключе cvca)
+	if (st->val_key_len != cvca->pubkey_len ||
+		!memEq(st->val_key, cvca->pubkey, cvca->pubkey_len))
+	{
+		if (st->cvc->sig_len != cvca->pubkey_len - cvca->pubkey_len / 4)
+			return ERR_BAD_FORMAT;
+		code = btokVerify(st->body, st->body_len, st->cvc->sig,
+			cvca->pubkey, cvca->pubkey_len);
+		ERR_CALL_CHECK(code);
+		memCopy(st->val_key, cvca->pubkey, cvca->pubkey_len);
+		st->val_key_len = cvca->pubkey_len;
+	}
+	// проверить дату
+	if (date)
+	{
+		if (!tmDateIsValid2(date))
+			return ERR_BAD_DATE;
+		if (!tmDateLeq2(st->cvc->from, date) ||
+			!tmDateLeq2(date, st->cvc->until))
+			return ERR_OUTOFRANGE;
+	}
+	return ERR_OK;
+}
+
+err_t btokCVCHMatch(void* h, const octet privkey[], size_t privkey_len)
+{
+	err_t code;
+	btok_cvch_st* st = (btok_cvch_st*)h;
+	octet hash[32];
+	// проверить входные данные
+	if (!memIsValid(h, sizeof(btok_cvch_st)) ||
+		!memIsValid(privkey, privkey_len))
+		return ERR_BAD_INPUT;
+	// соответствие уже установлено?
+	code = beltHash(hash, privkey, privkey_len);
+	ERR_CALL_CHECK(code);
+	if (st->matched && memEq(st->match, hash, 32))
+	{
+		memWipe(hash, 32);
+		return ERR_OK;
+	}
+	// проверить соответствие
+	code = btokKeypairVal(privkey, privkey_len, st->cvc->pubkey,
+		st->cvc->pubkey_len);
+	if (code == ERR_OK)
+	{
+		memCopy(st->match, hash, 32);
+		st->matched = TRUE;
+	}
+	memWipe(hash, 32);
+	return code;
+}
+
+/*
+*******************************************************************************
+Хранилище CV-сертификатов
+
+Хранилище содержит копию набора сертификатов, дескрипторы сертификатов
+и три хэш-таблицы: по владельцу, по издателю и по DER-коду сертификата.
+Хэш-таблицы организованы по методу цепочек: в корзине хранится номер
+первой записи, в записи -- номер следующей записи той же корзины
+(SIZE_MAX -- конец цепочки). Число корзин -- наименьшая степень 2,
+не меньшая числа сертификатов. Хэширование выполняется по алгоритму
+FNV-1a (см. utilFNV32()).
+
+Хранилище размечается так:
+	btok_cvc_store_st || entries[count] || heads[3 * buckets] || certs.
+Указатели внутри хранилища не используются, поэтому хранилище можно
+перемещать в памяти. Дескриптор является первым полем записи, поэтому
+указатель на дескриптор совпадает с указателем на запись.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	btok_cvch_st h[1];			/*< дескриптор */
+	size_t next[3];				/*< следующие записи цепочек */
+	size_t offset;				/*< смещение сертификата в наборе */
+	size_t len;					/*< длина сертификата */
+} btok_cvc_store_entry_st;
+
+typedef struct
+{
+	size_t count;				/*< число сертификатов */
+	size_t buckets;				/*< число корзин */
+	size_t certs_len;			/*< длина набора */
+} btok_cvc_store_st;
+
+static size_t btokCVCStoreBuckets(size_t count)
+{
+	size_t buckets = 1;
+	while (buckets < count)
+		buckets <<= 1;
+	return buckets;
+}
+
+static btok_cvc_store_entry_st* btokCVCStoreEntries(btok_cvc_store_st* st)
+{
+	return (btok_cvc_store_entry_st*)(st + 1);
+}
+
+static size_t* btokCVCStoreHeads(btok_cvc_store_st* st)
+{
+	return (size_t*)(btokCVCStoreEntries(st) + st->count);
+}
+
+static octet* btokCVCStoreCerts(btok_cvc_store_st* st)
+{
+	return (octet*)(btokCVCStoreHeads(st) + 3 * st->buckets);
+}
+
+static size_t btokCVCStoreHash(const btok_cvc_store_st* st, const void* key,
+	size_t key_len)
+{
+	return (size_t)utilFNV32(key, key_len, 0x811C9DC5) & (st->buckets - 1);
+}
+
+size_t btokCVCStoreCount(const octet certs[], size_t certs_len)
+{
+	size_t count;
+	size_t cert_len;
+	if (!memIsValid(certs, certs_len))
+		return SIZE_MAX;
+	for (count = 0; certs_len; ++count)
+	{
+		cert_len = btokCVCLen(certs, certs_len);
+		if (cert_len == SIZE_MAX)
+			return SIZE_MAX;
+		certs += cert_len, certs_len -= cert_len;
+	}
+	return count;
+}
+
+size_t btokCVCStore_keep(size_t count, size_t certs_len)
+{
+	return sizeof(btok_cvc_store_st) +
+		count * sizeof(btok_cvc_store_entry_st) +
+		3 * btokCVCStoreBuckets(count) * sizeof(size_t) + certs_len;
+}
+
+err_t btokCVCStoreStart(void* store, const octet certs[], size_t certs_len)
+{
+	err_t code;
+	btok_cvc_store_st* st = (btok_cvc_store_st*)store;
+	btok_cvc_store_entry_st* entries;
+	size_t* heads;
+	octet* copy;
+	size_t count;
+	size_t offset;
+	size_t pos;
+	size_t i;
+	// проверить входные данные
+	count = btokCVCStoreCount(certs, certs_len);
+	if (count == SIZE_MAX)
+		return ERR_BAD_CERT;
+	if (!memIsValid(store, btokCVCStore_keep(count, certs_len)) ||
+		!memIsDisjoint2(store, btokCVCStore_keep(count, certs_len),
+			certs, certs_len))
+		return ERR_BAD_INPUT;
+	// разметить хранилище
+	st->count = count;
+	st->buckets = btokCVCStoreBuckets(count);
+	st->certs_len = certs_len;
+	entries = btokCVCStoreEntries(st);
+	heads = btokCVCStoreHeads(st);
+	copy = btokCVCStoreCerts(st);
+	memCopy(copy, certs, certs_len);
+	memSet(heads, 0xFF, 3 * st->buckets * sizeof(size_t));
+	// разобрать сертификаты
+	for (pos = offset = 0; pos < count; ++pos)
+	{
+		entries[pos].offset = offset;
+		entries[pos].len = btokCVCLen(copy + offset, certs_len - offset);
+		ASSERT(entries[pos].len != SIZE_MAX);
+		code = btokCVCHStart(entries[pos].h, copy + offset,
+			entries[pos].len);
+		ERR_CALL_CHECK(code);
+		offset += entries[pos].len;
+	}
+	// построить индексы (в обратном порядке, чтобы цепочки корзин
+	// перечисляли сертификаты в порядке следования в наборе)
+	for (pos = count; pos--; )
+	{
+		const btok_cvc_t* cvc = entries[pos].h->cvc;
+		i = btokCVCStoreHash(st, cvc->holder, strLen(cvc->holder));
+		entries[pos].next[0] = heads[i], heads[i] = pos;
+		i = btokCVCStoreHash(st, cvc->authority, strLen(cvc->authority));
+		entries[pos].next[1] = heads[st->buckets + i];
+		heads[st->buckets + i] = pos;
+		i = btokCVCStoreHash(st, copy + entries[pos].offset,
+			entries[pos].len);
+		entries[pos].next[2] = heads[2 * st->buckets + i];
+		heads[2 * st->buckets + i] = pos;
+	}
+	return ERR_OK;
+}
+
+static void* btokCVCStoreNext(void* store, size_t index, const void* key,
+	size_t key_len, const void* prev)
+{
+	btok_cvc_store_st* st = (btok_cvc_store_st*)store;
+	btok_cvc_store_entry_st* entries;
+	size_t pos;
+	// проверить хранилище
+	if (!memIsValid(store, sizeof(btok_cvc_store_st)) ||
+		!memIsValid(store, btokCVCStore_keep(st->count, st->certs_len)))
+		return 0;
+	entries = btokCVCStoreEntries(st);
+	// определить начало поиска
+	if (prev)
+	{
+		pos = (size_t)((const octet*)prev - (const octet*)entries);
+		if ((const octet*)prev < (const octet*)entries ||
+			pos % sizeof(btok_cvc_store_entry_st) != 0 ||
+			(pos /= sizeof(btok_cvc_store_entry_st)) >= st->count)
+			return 0;
+		pos = entries[pos].next[index];
+	}
+	else
+		pos = btokCVCStoreHeads(st)[index * st->buckets +
+			btokCVCStoreHash(st, key, key_len)];
+	// просмотреть цепочку корзины
+	for (; pos != SIZE_MAX; pos = entries[pos].next[index])
+	{
+		const btok_cvc_t* cvc = entries[pos].h->cvc;
+		if (index == 0 && strEq(cvc->holder, key) ||
+			index == 1 && strEq(cvc->authority, key) ||
+			index == 2 && entries[pos].len == key_len &&
+				memEq(btokCVCStoreCerts(st) + entries[pos].offset, key,
+					key_len))
+			return entries[pos].h;
+	}
+	return 0;
+}
+
+void* btokCVCStoreFind(void* store, const octet cert[], size_t cert_len)
+{
+	if (!memIsValid(cert, cert_len))
+		return 0;
+	return btokCVCStoreNext(store, 2, cert, cert_len, 0);
+}
+
+void* btokCVCStoreByHolder(void* store, const char* holder, const void* prev)
+{
+	if (!strIsValid(holder))
+		return 0;
+	return btokCVCStoreNext(store, 0, holder, strLen(holder), prev);
+}
+
+void* btokCVCStoreByAuthority(void* store, const char* authority,
+	const void* prev)
+{
+	if (!strIsValid(authority))
+		return 0;
+	return btokCVCStoreNext(store, 1, authority, strLen(authority), prev);
+}
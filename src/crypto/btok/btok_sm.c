@@ -4,7 +4,7 @@
 \brief STB 34.101.79 (btok): Secure Messaging
 \project bee2 [cryptographic library]
 \created 2022.10.31
-\version 2022.11.04
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -27,34 +27,66 @@
   key1 <- belt-keyrep(key, 0, <1>, 256)
   key2 <- belt-keyrep(key, 0, <2>, 256)
   ctr <- 0
+
+Ключи key1 и key2 сохраняются в состоянии в виде объектов ключей
+(см. beltKeyStart()). Состояния belt-mac и belt-cfb, которые создаются при
+обработке каждой команды/ответа, ссылаются на эти объекты (beltXXXStartK()),
+ключи повторно не расширяются.
+
+Кроме того, в состоянии сохраняется начальное состояние belt-mac на ключе
+key1 (в нем уже определен блок r = belt-block(0, key1)). При обработке
+каждой команды/ответа это состояние копируется в стек, и зашифрование
+нулевого блока не повторяется. Состояние belt-cfb зависит от счетчика
+и строится заново.
+
+Состояния belt-mac и belt-cfb размещаются в стеке одновременно. Это
+позволяет зашифровывать (расшифровывать) и имитозащищать тело команды
+за один проход: тело обрабатывается фрагментами по BTOK_SM_CHUNK октетов,
+каждый фрагмент сразу после зашифрования (перед расшифрованием)
+обрабатывается belt-mac, пока находится в кэше.
 *******************************************************************************
 */
 
+#define BTOK_SM_CHUNK 1024
+
 typedef struct {
-	octet key1[32];		/*!< ключ belt-mac */
-	octet key2[32];		/*!< ключ belt-cfb */
 	octet ctr[16];		/*!< счетчик */
-	octet stack[];		/*!< стек */
+	octet stack[];		/*!< объекты key1, key2, начальный belt-mac и стек */
 } btok_sm_st;
 
+#define btokSMKey1(st) ((st)->stack)
+#define btokSMKey2(st) ((st)->stack + beltKey_keep())
+#define btokSMMAC0(st) ((st)->stack + 2 * beltKey_keep())
+#define btokSMMAC(st) (btokSMMAC0(st) + beltMAC_keep())
+#define btokSMCFB(st) (btokSMMAC(st) + beltMAC_keep())
+
+#define btokSMMACStart(st)\
+	memCopy(btokSMMAC(st), btokSMMAC0(st), beltMAC_keep())
+
 size_t btokSM_keep()
 {
-	return sizeof(btok_sm_st) + utilMax(3,
-		beltKRP_keep(), beltMAC_keep(), beltCFB_keep());
+	return sizeof(btok_sm_st) + 2 * beltKey_keep() + beltMAC_keep() +
+		utilMax(2, beltKRP_keep() + 32, beltMAC_keep() + beltCFB_keep());
 }
 
 void btokSMStart(void* state, const octet key[32])
 {
 	btok_sm_st* st = (btok_sm_st*)state;
+	octet* key_i = btokSMMAC(st) + beltKRP_keep();
 	// pre
 	ASSERT(memIsDisjoint2(key, 32, state, btokSM_keep()));
 	// key_i <- belt-keyrep(key, 0, <i>, 32);
 	memSetZero(st->ctr, 16);
-	beltKRPStart(st->stack, key, 32, st->ctr);
+	beltKRPStart(btokSMMAC(st), key, 32, st->ctr);
 	st->ctr[0] = 1;
-	beltKRPStepG(st->key1, 32, st->ctr, st->stack);
+	beltKRPStepG(key_i, 32, st->ctr, btokSMMAC(st));
+	beltKeyStart(btokSMKey1(st), key_i, 32);
 	st->ctr[0] = 2;
-	beltKRPStepG(st->key2, 32, st->ctr, st->stack);
+	beltKRPStepG(key_i, 32, st->ctr, btokSMMAC(st));
+	beltKeyStart(btokSMKey2(st), key_i, 32);
+	memWipe(key_i, 32);
+	// начальное состояние belt-mac
+	beltMACStartK(btokSMMAC0(st), btokSMKey1(st));
 	// ctr <- 0
 	st->ctr[0] = 0;
 }
@@ -66,7 +98,13 @@ void btokSMCtrInc(void* state)
 	size_t pos;
 	// pre
 	ASSERT(memIsValid(state, btokSM_keep()));
-	// инкремент
+	// инкремент без переноса (счетчик не является секретным)
+	if (st->ctr[0] != 0xFF)
+	{
+		++st->ctr[0];
+		return;
+	}
+	// инкремент с переносом
 	for (pos = 0; pos < 16; ++pos)
 		carry += st->ctr[pos], st->ctr[pos] = (octet)carry, carry >>= 8;
 	carry = 0;
@@ -78,16 +116,6 @@ APDU
 *******************************************************************************
 */
 
-static size_t apduCmdCDFLenLen(const apdu_cmd_t* cmd)
-{
-	ASSERT(apduCmdIsValid(cmd));
-	if (cmd->cdf_len == 0)
-		return 0;
-	if (cmd->cdf_len < 256 && cmd->rdf_len <= 256)
-		return 1;
-	return 3;
-}
-
 static size_t apduCmdRDFLenLen(const apdu_cmd_t* cmd)
 {
 	ASSERT(apduCmdIsValid(cmd));
@@ -147,8 +175,8 @@ err_t btokSMCmdWrap(octet apdu[], size_t* count, const apdu_cmd_t* cmd,
 	// некорректная команда? команду нужно защитить, а она уже защищена?
 	if (!apduCmdIsValid(cmd) || state && (cmd->cla & 0x04))
 		return ERR_BAD_APDU;
-	// кодировать без защиты
-	offset = apduCmdEnc(apdu, cmd);
+	// кодировать без защиты (с защитой -- только проверить кодируемость)
+	offset = apduCmdEnc(state ? 0 : apdu, cmd);
 	if (offset == SIZE_MAX)
 		return ERR_BAD_APDU;
 	// состояние не задано, т.е. защита не нужна?
@@ -205,28 +233,34 @@ err_t btokSMCmdWrap(octet apdu[], size_t* count, const apdu_cmd_t* cmd,
 	st = (btok_sm_st*)state;
 	if (st->ctr[0] % 2 != 1)
 		return ERR_BAD_LOGIC;
-	// уточнить заголовок
-	offset = 0;
-	apdu[0] |= 0x04;
-	offset += 4;
+	// кодировать заголовок
+	apdu[0] = cmd->cla | 0x04, apdu[1] = cmd->ins;
+	apdu[2] = cmd->p1, apdu[3] = cmd->p2;
+	offset = 4;
+	// начать вычисление имитовставки
+	btokSMMACStart(st);
+	beltMACStepA(apdu, 4, btokSMMAC(st));
 	// перейти к cdf
 	offset += cdf_len_len;
 	// обработать cdf
 	if (cmd->cdf_len)
 	{
-		c = derTLEnc(0, 0x87, cmd->cdf_len + 1);
-		ASSERT(c != SIZE_MAX);
-		// подготовить значение
-		memMove(apdu + offset + c + 1,
-			apdu + 4 + apduCmdCDFLenLen(cmd), cmd->cdf_len);
-		apdu[offset + c] = 0x02;
-		// кодировать TL
+		size_t pos;
+		// кодировать TL и индикатор заполнения
 		c = derTLEnc(apdu + offset, 0x87, cmd->cdf_len + 1);
 		ASSERT(c != SIZE_MAX);
+		apdu[offset + c] = 0x02;
+		beltMACStepA(apdu + offset, c + 1, btokSMMAC(st));
 		offset += c + 1;
-		// зашифровать
-		beltCFBStart(st->stack, st->key2, 32, st->ctr);
-		beltCFBStepE(apdu + offset, cmd->cdf_len, st->stack);
+		// зашифровать и имитозащитить за один проход
+		beltCFBStartK(btokSMCFB(st), btokSMKey2(st), st->ctr);
+		for (pos = 0; pos < cmd->cdf_len; pos += c)
+		{
+			c = MIN2(BTOK_SM_CHUNK, cmd->cdf_len - pos);
+			memCopy(apdu + offset + pos, cmd->cdf + pos, c);
+			beltCFBStepE(apdu + offset + pos, c, btokSMCFB(st));
+			beltMACStepA(apdu + offset + pos, c, btokSMMAC(st));
+		}
 		// дальше
 		offset += cmd->cdf_len;
 	}
@@ -264,17 +298,14 @@ err_t btokSMCmdWrap(octet apdu[], size_t* count, const apdu_cmd_t* cmd,
 			apdu[offset + 2] = (octet)cmd->rdf_len;
 		}
 		// дальше
+		beltMACStepA(apdu + offset - c, c + l, btokSMMAC(st));
 		offset += l;
 	}
-	// вычислить имитовставку
-	beltMACStart(st->stack, st->key1, 32);
-	beltMACStepA(apdu, 4, st->stack);
-	ASSERT(offset >= 4 + cdf_len_len);
-	beltMACStepA(apdu + 4 + cdf_len_len, offset - 4 - cdf_len_len, st->stack);
+	// завершить вычисление имитовставки
 	c = derTLEnc(apdu + offset, 0x8E, 8);
 	ASSERT(c != SIZE_MAX);
 	offset += c;
-	beltMACStepG(apdu + offset, st->stack);
+	beltMACStepG(apdu + offset, btokSMMAC(st));
 	offset += 8;
 	// кодировать новую длину rdf
 	memSetZero(apdu + offset, rdf_len_len);
@@ -291,45 +322,33 @@ err_t btokSMCmdWrap(octet apdu[], size_t* count, const apdu_cmd_t* cmd,
 	return ERR_OK;
 }
 
-err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
-	size_t count, void* state)
+/*
+*******************************************************************************
+Снятие защиты с команды
+
+Функция btokSMCmdParse() разбирает защищенную команду без снятия защиты.
+В представлении view поле cdf указывает на шифртекст внутри кода. Кроме
+того, возвращаются смещение offset защищенного поля CDF*, длины c1, c2
+его компонентов der(0x87, 0x02 Y) и der(0x97, Le), а также указатель на
+имитовставку.
+
+Функция btokSMCmdMACD() за один проход имитозащищает шифртекст и
+расшифровывает его в буфер cdf. Буфер cdf может совпадать с шифртекстом
+(расшифрование на месте) или не пересекаться с ним.
+*******************************************************************************
+*/
+
+static err_t btokSMCmdParse(apdu_cmd_view_t* view, size_t* offset,
+	size_t* c1, size_t* c2, const octet** mac, const octet apdu[],
+	size_t count)
 {
 	size_t len;
-	size_t offset;
-	size_t c1, c2, c3;
+	size_t c3;
 	size_t cdf_len;
 	size_t cdf_len_len;
 	const octet* cdf;
 	size_t rdf_len;
-	const octet* mac;
-	btok_sm_st* st;
-	// pre
-	ASSERT(memIsValid(apdu, count));
-	ASSERT(memIsNullOrValid(state, btokSM_keep()));
-	ASSERT(memIsNullOrValid(cmd, sizeof(apdu_cmd_t)));
-	// слишком короткая командв?
-	// нужно снять защиту с незащищенной команды?
-	// невозможно снять защиту?
-	if (count < 4 || state && count < 15 ||
-		state && (apdu[0] & 0x04) == 0 ||
-		!state && (apdu[0] & 0x04) != 0)
-		return ERR_BAD_APDU;
-	// декодировать без снятия защиты?
-	if (!state)
-	{
-		offset = apduCmdDec(cmd, apdu, count);
-		if (offset == SIZE_MAX)
-			return ERR_BAD_APDU;
-		if (size)
-		{
-			ASSERT(memIsDisjoint2(size, O_PER_S, apdu, count));
-			ASSERT(cmd == 0 ||
-				memIsDisjoint2(size, O_PER_S, cmd, apduCmdSizeof(cmd)));
-			*size = offset;
-		}
-		return ERR_OK;
-	}
-	ASSERT(memIsDisjoint2(state, btokSM_keep(), apdu, count));
+	ASSERT(memIsValid(apdu, count) && count >= 15);
 	// разобрать длину защищенного поля cdf
 	if (apdu[4] != 0)
 	{
@@ -345,26 +364,27 @@ err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
 		if (apdu[4] != 0)
 			return ERR_BAD_APDU;
 	}
-	offset = 4 + cdf_len_len;
+	*offset = 4 + cdf_len_len;
 	// проверить длину кода
 	if (4 + cdf_len_len + len > count || 4 + cdf_len_len + len + 2 < count)
 		return ERR_BAD_APDU;
 	// разобрать защищенное поле cdf: шифртекст
-	c1 = derDec2(&cdf, &cdf_len, apdu + offset, len, 0x87);
-	if (c1 != SIZE_MAX)
+	*c1 = derDec2(&cdf, &cdf_len, apdu + *offset, len, 0x87);
+	if (*c1 != SIZE_MAX)
 	{
 		if (cdf_len < 2 || cdf[0] != 0x02)
 			return ERR_BAD_APDU;
 		++cdf, --cdf_len;
 	}
 	else
-		c1 = cdf_len = 0;
+		*c1 = cdf_len = 0, cdf = apdu + *offset;
 	// разобрать защищенное поле cdf: rdf_len
 	{
 		const octet* val;
 		size_t rdf_len_len;
-		c2 = derDec2(&val, &rdf_len_len, apdu + offset + c1, len - c1, 0x97);
-		if (c2 != SIZE_MAX)
+		*c2 = derDec2(&val, &rdf_len_len, apdu + *offset + *c1, len - *c1,
+			0x97);
+		if (*c2 != SIZE_MAX)
 		{
 			if (rdf_len_len == 0 || rdf_len_len > 3)
 				return ERR_BAD_APDU;
@@ -394,7 +414,7 @@ err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
 			}
 		}
 		else
-			c2 = rdf_len = 0;
+			*c2 = rdf_len = 0;
 		// еще раз проверить длину кода, а также его завершение 
 		// (мы только сейчас узнали rdf_len)
 		if (rdf_len == 0)
@@ -408,46 +428,115 @@ err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
 			return ERR_BAD_APDU;
 	}
 	// разобрать защищенное поле cdf: имитовставка
-	c3 = derDec3(&mac, apdu + offset + c1 + c2, len - c1 - c2, 0x8E, 8);
-	if (c3 == SIZE_MAX || c1 + c2 + c3 != len)
+	c3 = derDec3(mac, apdu + *offset + *c1 + *c2, len - *c1 - *c2, 0x8E, 8);
+	if (c3 == SIZE_MAX || *c1 + *c2 + c3 != len)
 		return ERR_BAD_APDU;
+	// заполнить представление
+	view->cla = apdu[0] & 0xFB;
+	view->ins = apdu[1], view->p1 = apdu[2], view->p2 = apdu[3];
+	view->rdf_len = rdf_len;
+	view->cdf_len = cdf_len;
+	view->cdf = cdf;
+	return ERR_OK;
+}
+
+static bool_t btokSMCmdMACD(octet cdf[], const apdu_cmd_view_t* view,
+	const octet apdu[], size_t offset, size_t c1, size_t c2,
+	const octet mac[8], btok_sm_st* st)
+{
+	ASSERT(cdf == view->cdf ||
+		memIsDisjoint2(cdf, view->cdf_len, view->cdf, view->cdf_len));
+	// обработать заголовок и префикс cdf
+	btokSMMACStart(st);
+	beltMACStepA(apdu, 4, btokSMMAC(st));
+	if (view->cdf_len)
+	{
+		size_t pos;
+		size_t c;
+		beltMACStepA(apdu + offset, view->cdf - apdu - offset,
+			btokSMMAC(st));
+		// имитозащитить и расшифровать cdf за один проход
+		beltCFBStartK(btokSMCFB(st), btokSMKey2(st), st->ctr);
+		for (pos = 0; pos < view->cdf_len; pos += c)
+		{
+			c = MIN2(BTOK_SM_CHUNK, view->cdf_len - pos);
+			beltMACStepA(view->cdf + pos, c, btokSMMAC(st));
+			if (cdf != view->cdf)
+				memCopy(cdf + pos, view->cdf + pos, c);
+			beltCFBStepD(cdf + pos, c, btokSMCFB(st));
+		}
+	}
+	// проверить имитовставку
+	beltMACStepA(apdu + offset + c1, c2, btokSMMAC(st));
+	return beltMACStepV(mac, btokSMMAC(st));
+}
+
+err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
+	size_t count, void* state)
+{
+	err_t code;
+	apdu_cmd_view_t view[1];
+	size_t offset;
+	size_t c1, c2;
+	const octet* mac;
+	btok_sm_st* st;
+	// pre
+	ASSERT(memIsValid(apdu, count));
+	ASSERT(memIsNullOrValid(state, btokSM_keep()));
+	ASSERT(memIsNullOrValid(cmd, sizeof(apdu_cmd_t)));
+	// слишком короткая командв?
+	// нужно снять защиту с незащищенной команды?
+	// невозможно снять защиту?
+	if (count < 4 || state && count < 15 ||
+		state && (apdu[0] & 0x04) == 0 ||
+		!state && (apdu[0] & 0x04) != 0)
+		return ERR_BAD_APDU;
+	// декодировать без снятия защиты?
+	if (!state)
+	{
+		offset = apduCmdDec(cmd, apdu, count);
+		if (offset == SIZE_MAX)
+			return ERR_BAD_APDU;
+		if (size)
+		{
+			ASSERT(memIsDisjoint2(size, O_PER_S, apdu, count));
+			ASSERT(cmd == 0 ||
+				memIsDisjoint2(size, O_PER_S, cmd, apduCmdSizeof(cmd)));
+			*size = offset;
+		}
+		return ERR_OK;
+	}
+	ASSERT(memIsDisjoint2(state, btokSM_keep(), apdu, count));
+	// разобрать защищенную команду
+	code = btokSMCmdParse(view, &offset, &c1, &c2, &mac, apdu, count);
+	ERR_CALL_CHECK(code);
 	// ограничиться проверкой формата?
 	if (!cmd)
 	{
 		if (size)
 		{
 			ASSERT(memIsDisjoint2(size, O_PER_S, apdu, count));
-			*size = sizeof(apdu_cmd_t) + cdf_len;
+			*size = sizeof(apdu_cmd_t) + view->cdf_len;
 		}
 		return ERR_OK;
 	}
-	// нужно снять защиту, а состояние SM не передано?
-	if (!state)
-		return ERR_BAD_LOGIC;
-	// инкрементировать счетчик
+	// проверить счетчик
 	st = (btok_sm_st*)state;
 	if (st->ctr[0] % 2 != 1)
 		return ERR_BAD_LOGIC;
-	// проверить имитовставку
-	beltMACStart(st->stack, st->key1, 32);
-	beltMACStepA(apdu, 4, st->stack);
-	beltMACStepA(apdu + offset, c1 + c2, st->stack);
-	if (!beltMACStepV(mac, st->stack))
-		return ERR_BAD_MAC;
 	// заполнить поля команды
 	memSetZero(cmd, sizeof(apdu_cmd_t));
-	cmd->cla = apdu[0] & 0xFB;
-	cmd->ins = apdu[1], cmd->p1 = apdu[2], cmd->p2 = apdu[3];
-	cmd->rdf_len = rdf_len;
-	cmd->cdf_len = cdf_len;
-	memCopy(cmd->cdf, cdf, cdf_len);
+	cmd->cla = view->cla;
+	cmd->ins = view->ins, cmd->p1 = view->p1, cmd->p2 = view->p2;
+	cmd->rdf_len = view->rdf_len;
+	cmd->cdf_len = view->cdf_len;
 	ASSERT(memIsDisjoint2(cmd, apduCmdSizeof(cmd), state, btokSM_keep()));
 	ASSERT(memIsDisjoint2(cmd, apduCmdSizeof(cmd), apdu, count));
-	// расшифровать cdf
-	if (cdf_len)
+	// снять защиту
+	if (!btokSMCmdMACD(cmd->cdf, view, apdu, offset, c1, c2, mac, st))
 	{
-		beltCFBStart(st->stack, st->key2, 32, st->ctr);
-		beltCFBStepD(cmd->cdf, cdf_len, st->stack);
+		memWipe(cmd, apduCmdSizeof(cmd));
+		return ERR_BAD_MAC;
 	}
 	// возвратить размер
 	if (size)
@@ -461,6 +550,131 @@ err_t btokSMCmdUnwrap(apdu_cmd_t* cmd, size_t* size, const octet apdu[],
 	return ERR_OK;
 }
 
+err_t btokSMCmdUnwrapView(apdu_cmd_view_t* cmd, octet apdu[], size_t count,
+	void* state)
+{
+	err_t code;
+	apdu_cmd_view_t view[1];
+	size_t offset;
+	size_t c1, c2;
+	const octet* mac;
+	octet* cdf;
+	btok_sm_st* st;
+	// pre
+	ASSERT(memIsValid(apdu, count));
+	ASSERT(memIsNullOrValid(state, btokSM_keep()));
+	ASSERT(memIsNullOrValid(cmd, sizeof(apdu_cmd_view_t)));
+	// слишком короткая команда?
+	// нужно снять защиту с незащищенной команды?
+	// невозможно снять защиту?
+	if (count < 4 || state && count < 15 ||
+		state && (apdu[0] & 0x04) == 0 ||
+		!state && (apdu[0] & 0x04) != 0)
+		return ERR_BAD_APDU;
+	// декодировать без снятия защиты?
+	if (!state)
+		return apduCmdView(cmd, apdu, count) ? ERR_OK : ERR_BAD_APDU;
+	ASSERT(memIsDisjoint2(state, btokSM_keep(), apdu, count));
+	// разобрать защищенную команду
+	code = btokSMCmdParse(view, &offset, &c1, &c2, &mac, apdu, count);
+	ERR_CALL_CHECK(code);
+	// ограничиться проверкой формата?
+	if (!cmd)
+		return ERR_OK;
+	ASSERT(memIsDisjoint2(cmd, sizeof(apdu_cmd_view_t), state,
+		btokSM_keep()));
+	ASSERT(memIsDisjoint2(cmd, sizeof(apdu_cmd_view_t), apdu, count));
+	// проверить счетчик
+	st = (btok_sm_st*)state;
+	if (st->ctr[0] % 2 != 1)
+		return ERR_BAD_LOGIC;
+	// снять защиту на месте
+	cdf = apdu + (view->cdf - apdu);
+	if (!btokSMCmdMACD(cdf, view, apdu, offset, c1, c2, mac, st))
+	{
+		memWipe(cdf, view->cdf_len);
+		return ERR_BAD_MAC;
+	}
+	// возвратить представление
+	memCopy(cmd, view, sizeof(apdu_cmd_view_t));
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Цепочки команд
+
+Команды цепочки обрабатываются функциями btokSMCmdWrap(), btokSMCmdUnwrap()
+с промежуточными инкрементами счетчика. Объекты ключей из состояния SM
+используются всеми командами цепочки.
+*******************************************************************************
+*/
+
+err_t btokSMCmdWrapChain(octet apdu[], size_t counts[],
+	const apdu_cmd_t* const cmds[], size_t n, void* state)
+{
+	err_t code;
+	size_t i;
+	// pre
+	ASSERT(memIsValid(counts, n * O_PER_S));
+	ASSERT(memIsValid(cmds, n * sizeof(const apdu_cmd_t*)));
+	ASSERT(memIsNullOrValid(state, btokSM_keep()));
+	// определить длины кодов или кодировать без защиты?
+	if (!apdu || !state)
+	{
+		for (i = 0; i < n; ++i)
+		{
+			code = btokSMCmdWrap(apdu, counts + i, cmds[i], state);
+			ERR_CALL_CHECK(code);
+			if (apdu)
+				apdu += counts[i];
+		}
+		return ERR_OK;
+	}
+	// проверить счетчик
+	if (((btok_sm_st*)state)->ctr[0] % 2 != 0)
+		return ERR_BAD_LOGIC;
+	// защитить команды
+	for (i = 0; i < n; ++i)
+	{
+		if (i > 0)
+			btokSMCtrInc(state);
+		btokSMCtrInc(state);
+		code = btokSMCmdWrap(apdu, counts + i, cmds[i], state);
+		ERR_CALL_CHECK(code);
+		apdu += counts[i];
+	}
+	return ERR_OK;
+}
+
+err_t btokSMCmdUnwrapChain(apdu_cmd_t* const cmds[], const octet apdu[],
+	const size_t counts[], size_t n, void* state)
+{
+	err_t code;
+	size_t i;
+	// pre
+	ASSERT(memIsValid(counts, n * O_PER_S));
+	ASSERT(memIsValid(cmds, n * sizeof(apdu_cmd_t*)));
+	ASSERT(memIsNullOrValid(state, btokSM_keep()));
+	// проверить счетчик
+	if (state && ((btok_sm_st*)state)->ctr[0] % 2 != 0)
+		return ERR_BAD_LOGIC;
+	// снять защиту с команд
+	for (i = 0; i < n; ++i)
+	{
+		if (state)
+		{
+			if (i > 0)
+				btokSMCtrInc(state);
+			btokSMCtrInc(state);
+		}
+		code = btokSMCmdUnwrap(cmds[i], 0, apdu, counts[i], state);
+		ERR_CALL_CHECK(code);
+		apdu += counts[i];
+	}
+	return ERR_OK;
+}
+
 /*
 *******************************************************************************
 Кодирование и защита ответов
@@ -550,20 +764,20 @@ err_t btokSMRespWrap(octet apdu[], size_t* count, const apdu_resp_t* resp,
 		ASSERT(c != SIZE_MAX);
 		offset += c + 1;
 		// зашифровать
-		beltCFBStart(st->stack, st->key2, 32, st->ctr);
-		beltCFBStepE(apdu + offset, resp->rdf_len, st->stack);
+		beltCFBStartK(btokSMCFB(st), btokSMKey2(st), st->ctr);
+		beltCFBStepE(apdu + offset, resp->rdf_len, btokSMCFB(st));
 		// дальше
 		offset += resp->rdf_len;
 	}
 	// вычислить имитовставку
-	beltMACStart(st->stack, st->key1, 32);
-	beltMACStepA(apdu, offset, st->stack);
-	beltMACStepA(&resp->sw1, 1, st->stack);
-	beltMACStepA(&resp->sw2, 1, st->stack);
+	btokSMMACStart(st);
+	beltMACStepA(apdu, offset, btokSMMAC(st));
+	beltMACStepA(&resp->sw1, 1, btokSMMAC(st));
+	beltMACStepA(&resp->sw2, 1, btokSMMAC(st));
 	c = derTLEnc(apdu + offset, 0x8E, 8);
 	ASSERT(c != SIZE_MAX);
 	offset += c;
-	beltMACStepG(apdu + offset, st->stack);
+	beltMACStepG(apdu + offset, btokSMMAC(st));
 	offset += 8;
 	// кодировать статусы
 	apdu[offset++] = resp->sw1, apdu[offset++] = resp->sw2;
@@ -579,12 +793,45 @@ err_t btokSMRespWrap(octet apdu[], size_t* count, const apdu_resp_t* resp,
 	return ERR_OK;
 }
 
+static err_t btokSMRespParse(apdu_resp_view_t* view, size_t* c1,
+	const octet** mac, const octet apdu[], size_t count)
+{
+	size_t c2;
+	ASSERT(memIsValid(apdu, count) && count >= 12);
+	// разобрать защищенное поле rdf: шифртекст
+	*c1 = derDec2(&view->rdf, &view->rdf_len, apdu, count - 2, 0x87);
+	if (*c1 != SIZE_MAX)
+	{
+		if (view->rdf_len < 2 || view->rdf[0] != 0x02)
+			return ERR_BAD_APDU;
+		++view->rdf, --view->rdf_len;
+	}
+	else
+		*c1 = view->rdf_len = 0, view->rdf = apdu;
+	// разобрать защищенное поле rdf: имитовставка
+	c2 = derDec3(mac, apdu + *c1, count - 2 - *c1, 0x8E, 8);
+	if (c2 == SIZE_MAX || *c1 + c2 + 2 != count)
+		return ERR_BAD_APDU;
+	// статусы
+	view->sw1 = apdu[count - 2], view->sw2 = apdu[count - 1];
+	return ERR_OK;
+}
+
+static bool_t btokSMRespMACV(const octet apdu[], size_t count, size_t c1,
+	const octet mac[8], btok_sm_st* st)
+{
+	btokSMMACStart(st);
+	beltMACStepA(apdu, c1, btokSMMAC(st));
+	beltMACStepA(apdu + count - 2, 2, btokSMMAC(st));
+	return beltMACStepV(mac, btokSMMAC(st));
+}
+
 err_t btokSMRespUnwrap(apdu_resp_t* resp, size_t* size, const octet apdu[],
 	size_t count, void* state)
 {
-	size_t c1, c2;
-	size_t rdf_len;
-	const octet* rdf;
+	err_t code;
+	apdu_resp_view_t view[1];
+	size_t c1;
 	const octet* mac;
 	btok_sm_st* st;
 	// pre
@@ -610,55 +857,38 @@ err_t btokSMRespUnwrap(apdu_resp_t* resp, size_t* size, const octet apdu[],
 		return ERR_OK;
 	}
 	ASSERT(memIsDisjoint2(state, btokSM_keep(), apdu, count));
-	// разобрать защищенное поле rdf: шифртекст
-	c1 = derDec2(&rdf, &rdf_len, apdu, count - 2, 0x87);
-	if (c1 != SIZE_MAX)
-	{
-		if (rdf_len < 2 || rdf[0] != 0x02)
-			return ERR_BAD_APDU;
-		++rdf, --rdf_len;
-	}
-	else
-		c1 = rdf_len = 0;
-	// разобрать защищенное поле rdf: имитовставка
-	c2 = derDec3(&mac, apdu + c1, count - 2 - c1, 0x8E, 8);
-	if (c2 == SIZE_MAX || c1 + c2 + 2 != count)
-		return ERR_BAD_APDU;
+	// разобрать защищенный ответ
+	code = btokSMRespParse(view, &c1, &mac, apdu, count);
+	ERR_CALL_CHECK(code);
 	// ограничиться проверкой формата?
 	if (!resp)
 	{
 		if (size)
 		{
 			ASSERT(memIsDisjoint2(size, O_PER_S, apdu, count));
-			*size = sizeof(apdu_resp_t) + rdf_len;
+			*size = sizeof(apdu_resp_t) + view->rdf_len;
 		}
 		return ERR_OK;
 	}
-	// нужно снять защиту, а состояние SM не передано?
-	if (!state)
-		return ERR_BAD_LOGIC;
-	// инкрементировать счетчик
+	// проверить счетчик
 	st = (btok_sm_st*)state;
 	if (st->ctr[0] % 2 != 0)
 		return ERR_BAD_LOGIC;
 	// проверить имитовставку
-	beltMACStart(st->stack, st->key1, 32);
-	beltMACStepA(apdu, c1, st->stack);
-	beltMACStepA(apdu + count - 2, 2, st->stack);
-	if (!beltMACStepV(mac, st->stack))
+	if (!btokSMRespMACV(apdu, count, c1, mac, st))
 		return ERR_BAD_MAC;
 	// заполнить поля ответа
 	memSetZero(resp, sizeof(apdu_resp_t));
-	resp->sw1 = apdu[count - 2], resp->sw2 = apdu[count - 1];
-	resp->rdf_len = rdf_len;
-	memCopy(resp->rdf, rdf, rdf_len);
+	resp->sw1 = view->sw1, resp->sw2 = view->sw2;
+	resp->rdf_len = view->rdf_len;
+	memCopy(resp->rdf, view->rdf, view->rdf_len);
 	ASSERT(memIsDisjoint2(resp, apduRespSizeof(resp), state, btokSM_keep()));
 	ASSERT(memIsDisjoint2(resp, apduRespSizeof(resp), apdu, count));
 	// расшифровать rdf
-	if (rdf_len)
+	if (resp->rdf_len)
 	{
-		beltCFBStart(st->stack, st->key2, 32, st->ctr);
-		beltCFBStepD(resp->rdf, rdf_len, st->stack);
+		beltCFBStartK(btokSMCFB(st), btokSMKey2(st), st->ctr);
+		beltCFBStepD(resp->rdf, resp->rdf_len, btokSMCFB(st));
 	}
 	// возвратить размер
 	if (size)
@@ -671,3 +901,50 @@ err_t btokSMRespUnwrap(apdu_resp_t* resp, size_t* size, const octet apdu[],
 	// завершить
 	return ERR_OK;
 }
+
+err_t btokSMRespUnwrapView(apdu_resp_view_t* resp, octet apdu[],
+	size_t count, void* state)
+{
+	err_t code;
+	apdu_resp_view_t view[1];
+	size_t c1;
+	const octet* mac;
+	btok_sm_st* st;
+	// pre
+	ASSERT(memIsValid(apdu, count));
+	ASSERT(memIsNullOrValid(state, btokSM_keep()));
+	ASSERT(memIsNullOrValid(resp, sizeof(apdu_resp_view_t)));
+	// слишком короткий ответ?
+	if (count < 2 || state && count < 12)
+		return ERR_BAD_APDU;
+	// декодировать без снятия защиты?
+	if (!state)
+		return apduRespView(resp, apdu, count) ? ERR_OK : ERR_BAD_APDU;
+	ASSERT(memIsDisjoint2(state, btokSM_keep(), apdu, count));
+	// разобрать защищенный ответ
+	code = btokSMRespParse(view, &c1, &mac, apdu, count);
+	ERR_CALL_CHECK(code);
+	// ограничиться проверкой формата?
+	if (!resp)
+		return ERR_OK;
+	ASSERT(memIsDisjoint2(resp, sizeof(apdu_resp_view_t), state,
+		btokSM_keep()));
+	ASSERT(memIsDisjoint2(resp, sizeof(apdu_resp_view_t), apdu, count));
+	// проверить счетчик
+	st = (btok_sm_st*)state;
+	if (st->ctr[0] % 2 != 0)
+		return ERR_BAD_LOGIC;
+	// проверить имитовставку
+	if (!btokSMRespMACV(apdu, count, c1, mac, st))
+		return ERR_BAD_MAC;
+	// расшифровать rdf на месте
+	if (view->rdf_len)
+	{
+		beltCFBStartK(btokSMCFB(st), btokSMKey2(st), st->ctr);
+		beltCFBStepD(apdu + (view->rdf - apdu), view->rdf_len,
+			btokSMCFB(st));
+	}
+	// возвратить представление
+	memCopy(resp, view, sizeof(apdu_resp_view_t));
+	return ERR_OK;
+}
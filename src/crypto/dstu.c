@@ -4,7 +4,7 @@
 \brief DSTU 4145-2002 (Ukraine): digital signature algorithms
 \project bee2 [cryptographic library]
 \created 2012.04.27
-\version 2016.04.22
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,6 +13,7 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/obj.h"
 #include "bee2/core/str.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/dstu.h"
@@ -681,6 +682,45 @@ err_t dstuValPoint(const dstu_params* params, const octet point[])
 	return code;
 }
 
+err_t dstuValPointBatch(octet valid[], const dstu_params* params,
+	size_t count, const octet points[])
+{
+	err_t code;
+	size_t i;
+	// состояние
+	ec_o* ec;
+	word* x;
+	word* y;
+	void* stack;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuValPoint_deep);
+	ERR_CALL_CHECK(code);
+	// проверить входные указатели
+	if (!memIsValid(points, count * 2 * ec->f->no) ||
+		!memIsValid(valid, (count + 7) / 8))
+	{
+		_dstuCloseEc(ec);
+		return ERR_BAD_INPUT;
+	}
+	// раскладка состояния
+	x = objEnd(ec, word);
+	y = x + ec->f->n;
+	stack = y + ec->f->n;
+	// цикл по точкам
+	memSetZero(valid, (count + 7) / 8);
+	for (i = 0; i < count; ++i, points += 2 * ec->f->no)
+		if (qrFrom(x, points, ec->f, stack) &&
+			qrFrom(y, points + ec->f->no, ec->f, stack) &&
+			ec2IsOnA(x, ec, stack) &&
+			ecHasOrderA(x, ec, ec->order, ec->f->n, stack))
+			valid[i / 8] |= (octet)(1 << i % 8);
+		else
+			code = ERR_BAD_POINT;
+	// завершение
+	_dstuCloseEc(ec);
+	return code;
+}
+
 static size_t _dstuCompressPoint_deep(size_t n, size_t f_deep, size_t ec_d, 
 	size_t ec_deep)
 {
@@ -821,6 +861,139 @@ err_t dstuRecoverPoint(octet point[], const dstu_params* params,
 	return code;
 }
 
+/*
+*******************************************************************************
+Контекст
+
+Контекст -- это объект, который содержит описание эллиптической кривой, 
+построенное функцией _dstuCreateEc(), и таблицу предвычислений гребенчатого 
+метода для базовой точки P. Функции dstuCtxXXX() выделяют память только
+для стека, глубина которого рассчитывается по размерностям готового
+описания.
+
+Функции dstuXXX() и dstuCtxXXX() выполняются с помощью общих функций
+_dstuXXXEc(), которые работают с готовым описанием кривой и готовым стеком.
+Если таблица предвычислений не задана (pre == 0, как в dstuXXX()), 
+то кратные P с секретной кратностью (dstuGenKeypair(), dstuSign()) 
+определяются с помощью регулярной функции ec2MulAX() (лестница 
+Монтгомери), а суммы кратных при проверке подписи -- с помощью 
+ecAddMulA().
+*******************************************************************************
+*/
+
+#define DSTU_COMB_W 6
+
+typedef struct
+{
+	obj_hdr_t hdr;			/*!< заголовок */
+// ptr_table {
+	ec_o* ec;				/*!< описание эллиптической кривой */
+	word* pre;				/*!< таблица предвычислений для P */
+// }
+	octet descr[];			/*!< память для размещения данных */
+} dstu_ctx;
+
+#define _dstuCtxEc(ctx) (((const dstu_ctx*)(ctx))->ec)
+#define _dstuCtxPre(ctx) ((const word*)((const dstu_ctx*)(ctx))->pre)
+
+static bool_t _dstuMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], size_t m, void* stack)
+{
+	if (pre)
+		return ecCombMulA(b, pre, ec, DSTU_COMB_W, d, m, stack);
+	return ec2MulAX(b, ec->base, ec, d, m, stack);
+}
+
+static size_t _dstuMulBase_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return utilMax(2,
+		ec2MulAX_deep(n, f_deep, ec_deep, n),
+		ecCombMulA_deep(n, ec_d, ec_deep, DSTU_COMB_W));
+}
+
+static bool_t _dstuAddMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], const word a[], const word e[], size_t m, void* stack)
+{
+	// без таблицы
+	if (!pre)
+		return ecAddMulA(b, ec, stack, 2, ec->base, d, m, a, e, m);
+	// с таблицей (d и e не являются секретными)
+	return ecCombAddMulA(b, pre, ec, DSTU_COMB_W, d, m, a, e, m, stack);
+}
+
+static size_t _dstuAddMulBase_deep(size_t n, size_t ec_d, size_t ec_deep)
+{
+	return utilMax(2,
+		ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n),
+		ecCombAddMulA_deep(n, ec_d, ec_deep, DSTU_COMB_W, n));
+}
+
+static size_t _dstuCtxStart_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return ecCombPrecA_deep(n, ec_d, ec_deep);
+}
+
+size_t dstuCtx_keep(size_t m)
+{
+	const size_t n = W_OF_B(m);
+	return sizeof(dstu_ctx) + ecCombPrecA_keep(n, DSTU_COMB_W) +
+		gf2Create_keep(m) + ec2CreateLD_keep(n);
+}
+
+err_t dstuCtxStart(void* ctx, const dstu_params* params)
+{
+	err_t code;
+	ec_o* ec;
+	dstu_ctx* c = (dstu_ctx*)ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(dstu_params)))
+		return ERR_BAD_INPUT;
+	if (params->p[0] < 160 || params->p[0] > 509)
+		return ERR_BAD_PARAMS;
+	// проверить ctx
+	if (!memIsValid(ctx, dstuCtx_keep(params->p[0])))
+		return ERR_BAD_INPUT;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuCtxStart_deep);
+	ERR_CALL_CHECK(code);
+	// подготовить контекст
+	c->hdr.keep = sizeof(dstu_ctx) + 
+		ecCombPrecA_keep(ec->f->n, DSTU_COMB_W);
+	c->hdr.p_count = 2;
+	c->hdr.o_count = 1;
+	c->ec = ec;
+	c->pre = (word*)c->descr;
+	// перенести описание кривой в контекст
+	ASSERT(objKeep(c) + objKeep(ec) <= dstuCtx_keep(params->p[0]));
+	objAppend(c, ec, 0);
+	// построить таблицу предвычислений
+	if (!ecCombPrecA(c->pre, c->ec->base, c->ec, DSTU_COMB_W,
+		objEnd(ec, void)))
+		code = ERR_BAD_PARAMS;
+	// завершение
+	_dstuCloseEc(ec);
+	return code;
+}
+
+static bool_t _dstuCtxIsOperable(const void* ctx)
+{
+	const dstu_ctx* c = (const dstu_ctx*)ctx;
+	return memIsValid(c, sizeof(dstu_ctx)) &&
+		objPCount(c) == 2 && objOCount(c) == 1 &&
+		objIsOperable(c) &&
+		ecIsOperable(c->ec) &&
+		ecIsOperableGroup(c->ec) &&
+		wwIsValid(c->pre, c->ec->f->n << DSTU_COMB_W);
+}
+
+static void* _dstuCtxStackCreate(const void* ctx, _dstu_deep_i deep)
+{
+	const ec_o* ec = _dstuCtxEc(ctx);
+	return blobCreate(deep(ec->f->n, ec->f->deep, ec->d, ec->deep));
+}
+
 /*
 *******************************************************************************
 Управление ключами
@@ -831,26 +1004,18 @@ static size_t _dstuGenKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
 	size_t ec_deep)
 {
 	return O_OF_W(3 * n) + 
-		ecMulA_deep(n, ec_d, ec_deep, n);
+		_dstuMulBase_deep(n, f_deep, ec_d, ec_deep);
 }
 
-err_t dstuGenKeypair(octet privkey[], octet pubkey[], 
-	const dstu_params* params, gen_i rng, void* rng_state)
+static err_t _dstuGenKeypairEc(octet privkey[], octet pubkey[],
+	const ec_o* ec, const word pre[], gen_i rng, void* rng_state,
+	void* stack)
 {
-	err_t code;
 	size_t order_n, order_no, order_nb;
 	// состояние
-	ec_o* ec;
 	word* d;
 	word* x;
 	word* y;
-	void* stack;
-	// проверить rng
-	if (rng == 0)
-		return ERR_BAD_RNG;
-	// старт
-	code = _dstuCreateEc(&ec, params, _dstuGenKeypair_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
 	order_nb = wwBitSize(ec->order, ec->f->n);
 	order_no = O_OF_B(order_nb);
@@ -858,12 +1023,9 @@ err_t dstuGenKeypair(octet privkey[], octet pubkey[],
 	// проверить входные указатели
 	if (!memIsValid(privkey, order_no) || 
 		!memIsValid(pubkey, 2 * ec->f->no))
-	{
-		_dstuCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
+	// раскладка стека
+	d = (word*)stack;
 	x = d + ec->f->n;
 	y = x + ec->f->n;
 	stack = y + ec->f->n;
@@ -881,23 +1043,60 @@ err_t dstuGenKeypair(octet privkey[], octet pubkey[],
 			break;
 	}
 	// Q <- d G
-	if (!ecMulA(x, ec->base, ec, d, order_n, stack))
-	{
+	if (!_dstuMulBase(x, ec, pre, d, order_n, stack))
 		// если params корректны, то этого быть не должно
-		_dstuCloseEc(ec);
 		return ERR_BAD_PARAMS;
-	}
 	// Q <- -Q
 	ec2NegA(x, x, ec);
 	// выгрузить ключи
 	wwTo(privkey, order_no, d);
 	qrTo(pubkey, x, ec->f, stack);
 	qrTo(pubkey + ec->f->no, y, ec->f, stack);
-	// все нормально
+	return ERR_OK;
+}
+
+err_t dstuGenKeypair(octet privkey[], octet pubkey[], 
+	const dstu_params* params, gen_i rng, void* rng_state)
+{
+	err_t code;
+	ec_o* ec;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuGenKeypair_deep);
+	ERR_CALL_CHECK(code);
+	// сгенерировать ключи
+	code = _dstuGenKeypairEc(privkey, pubkey, ec, 0, rng, rng_state,
+		objEnd(ec, void));
+	// завершение
 	_dstuCloseEc(ec);
 	return code;
 }
 
+err_t dstuCtxGenKeypair(octet privkey[], octet pubkey[], const void* ctx,
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!_dstuCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// создать стек
+	stack = _dstuCtxStackCreate(ctx, _dstuGenKeypair_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// сгенерировать ключи
+	code = _dstuGenKeypairEc(privkey, pubkey, _dstuCtxEc(ctx), 
+		_dstuCtxPre(ctx), rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 ЭЦП
@@ -909,31 +1108,22 @@ static size_t _dstuSign_deep(size_t n, size_t f_deep, size_t ec_d,
 {
 	return O_OF_W(6 * n) + 
 		utilMax(2,
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			_dstuMulBase_deep(n, f_deep, ec_d, ec_deep),
 			zzMulMod_deep(n));
 }
 
-err_t dstuSign(octet sig[], const dstu_params* params, size_t ld, 
-	const octet hash[], size_t hash_len, const octet privkey[], 
-	gen_i rng, void* rng_state)
+static err_t _dstuSignEc(octet sig[], const ec_o* ec, const word pre[],
+	size_t ld, const octet hash[], size_t hash_len, const octet privkey[], 
+	gen_i rng, void* rng_state, void* stack)
 {
-	err_t code;
 	size_t order_n, order_no, order_nb;
 	// состояние
-	ec_o* ec;
 	word* e;		/* эфемерный лк */
 	word* h;		/* хэш-значение как элемент поля */
 	word* x;		/* х-координата эфемерного ок */
 	word* y;		/* y-координата эфемерного ок */
 	word* r;		/* первая часть ЭЦП */
 	word* s;		/* вторая часть ЭЦП */
-	void* stack;
-	// проверить rng
-	if (rng == 0)
-		return ERR_BAD_RNG;
-	// старт
-	code = _dstuCreateEc(&ec, params, _dstuSign_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
 	order_nb = wwBitSize(ec->order, ec->f->n);
 	order_no = O_OF_B(order_nb);
@@ -945,12 +1135,9 @@ err_t dstuSign(octet sig[], const dstu_params* params, size_t ld,
 		ld % 16 != 0 || ld < 16 * order_no ||
 		!memIsValid(hash, hash_len) ||
 		!memIsValid(sig, O_OF_B(ld)))
-	{
-		_dstuCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	e = objEnd(ec, word);
+	// раскладка стека
+	e = (word*)stack;
 	h = e + ec->f->n;
 	x = h + ec->f->n;
 	y = x + ec->f->n;
@@ -988,12 +1175,9 @@ step8:
 			break;
 	}
 	// шаг 8: (x, y) <- e G
-	if (!ecMulA(x, ec->base, ec, e, order_n, stack))
-	{
+	if (!_dstuMulBase(x, ec, pre, e, order_n, stack))
 		// если params корректны, то этого быть не должно
-		_dstuCloseEc(ec);
 		return ERR_BAD_PARAMS;
-	}
 	// шаг 8: если x == 0, то повторить генерацию
 	if (qrIsZero(x, ec->f))
 		goto step8;
@@ -1019,34 +1203,71 @@ step8:
 	memSetZero(sig, O_OF_B(ld));
 	wwTo(sig, order_no, r);
 	wwTo(sig + ld / 16, order_no, s);
-	// все нормально
+	return ERR_OK;
+}
+
+err_t dstuSign(octet sig[], const dstu_params* params, size_t ld, 
+	const octet hash[], size_t hash_len, const octet privkey[], 
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	ec_o* ec;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuSign_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = _dstuSignEc(sig, ec, 0, ld, hash, hash_len, privkey, rng,
+		rng_state, objEnd(ec, void));
+	// завершение
 	_dstuCloseEc(ec);
 	return code;
 }
 
+err_t dstuCtxSign(octet sig[], const void* ctx, size_t ld, 
+	const octet hash[], size_t hash_len, const octet privkey[], 
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!_dstuCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// создать стек
+	stack = _dstuCtxStackCreate(ctx, _dstuSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = _dstuSignEc(sig, _dstuCtxEc(ctx), _dstuCtxPre(ctx), ld, hash,
+		hash_len, privkey, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 static size_t _dstuVerify_deep(size_t n, size_t f_deep, size_t ec_d, 
 	size_t ec_deep)
 {
 	return O_OF_W(5 * n) + 
-		ecAddMulA_deep(n, ec_d, ec_deep, 2, n, n);
+		_dstuAddMulBase_deep(n, ec_d, ec_deep);
 }
 
-err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[], 
-	size_t hash_len, const octet sig[], const octet pubkey[])
+static err_t _dstuVerifyEc(const ec_o* ec, const word pre[], size_t ld,
+	const octet hash[], size_t hash_len, const octet sig[],
+	const octet pubkey[], void* stack)
 {
-	err_t code;
 	size_t order_n, order_no, order_nb, i;
 	// состояние
-	ec_o* ec;
 	word* h;		/* хэш-значение как элемент поля */
 	word* x;		/* х-координата эфемерного ок */
 	word* y;		/* y-координата эфемерного ок */
 	word* r;		/* первая часть ЭЦП */
 	word* s;		/* вторая часть ЭЦП */
-	void* stack;
-	// старт
-	code = _dstuCreateEc(&ec, params, _dstuVerify_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
 	order_nb = wwBitSize(ec->order, ec->f->n);
 	order_no = O_OF_B(order_nb);
@@ -1057,12 +1278,9 @@ err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[],
 	if (!memIsValid(pubkey, 2 * ec->f->no) || 
 		ld % 16 != 0 || ld < 16 * order_no ||
 		!memIsValid(hash, hash_len))
-	{
-		_dstuCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	h = objEnd(ec, word);
+	// раскладка стека
+	h = (word*)stack;
 	x = h + ec->f->n;
 	y = x + ec->f->n;
 	r = y + ec->f->n;
@@ -1073,10 +1291,7 @@ err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[],
 	// [минимальная проверка принадлежности координат базовому полю]
 	if (!qrFrom(x, pubkey, ec->f, stack) || 
 		!qrFrom(y, pubkey + ec->f->no, ec->f, stack))
-	{
-		_dstuCloseEc(ec);
 		return ERR_BAD_PUBKEY;
-	}
 	// шаги 6, 7: хэширование
 	// шаг 8: перевести hash в элемент основного поля h
 	// [алгоритм из раздела 5.9 ДСТУ]
@@ -1100,25 +1315,16 @@ err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[],
 	wwFrom(s, sig + ld / 16, order_no);
 	for (i = order_no; i < ld / 16; ++i)
 		if (sig[i] || sig[i + ld / 16])
-		{
-			_dstuCloseEc(ec);
 			return ERR_BAD_SIG;
-		}
 	// шаги 10, 11: проверить r и s
 	if (wwIsZero(r, order_n) ||
 		wwIsZero(s, order_n) ||
 		wwCmp(r, ec->order, order_n) >= 0 ||
 		wwCmp(s, ec->order, order_n) >= 0)
-	{
-		_dstuCloseEc(ec);
 		return ERR_BAD_SIG;
-	}
 	// шаг 12: R <- sP + rQ
-	if (!ecAddMulA(x, ec, stack, 2, ec->base, s, order_n, x, r, order_n))
-	{
-		_dstuCloseEc(ec);
+	if (!_dstuAddMulBase(x, ec, pre, s, x, r, order_n, stack))
 		return ERR_BAD_SIG;
-	}
 	// шаг 13: y <- h * x
 	qrMul(y, x, h, ec->f, stack);
 	// шаг 14: r' <- \bar{y}
@@ -1127,9 +1333,260 @@ err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[],
 	wwFrom(s, s, order_no);
 	wwTrimHi(s, order_n, order_nb - 1);
 	// шаг 15:
-	if (!wwEq(r, s, order_n))
-		code = ERR_BAD_SIG;
-	// все нормально
+	return wwEq(r, s, order_n) ? ERR_OK : ERR_BAD_SIG;
+}
+
+err_t dstuVerify(const dstu_params* params, size_t ld, const octet hash[], 
+	size_t hash_len, const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	ec_o* ec;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuVerify_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подпись
+	code = _dstuVerifyEc(ec, 0, ld, hash, hash_len, sig, pubkey,
+		objEnd(ec, void));
+	// завершение
+	_dstuCloseEc(ec);
+	return code;
+}
+
+err_t dstuCtxVerify(const void* ctx, size_t ld, const octet hash[], 
+	size_t hash_len, const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!_dstuCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = _dstuCtxStackCreate(ctx, _dstuVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = _dstuVerifyEc(_dstuCtxEc(ctx), _dstuCtxPre(ctx), ld, hash,
+		hash_len, sig, pubkey, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
+/*
+*******************************************************************************
+Пакетная проверка подписи
+
+Открытые ключи передаются в сжатом виде и восстанавливаются порциями
+по DSTU_BATCH_SIZE ключей. При восстановлении ключа (x, y) по x 
+(см. dstuRecoverPoint()) требуется решить уравнение z^2 + z = x + a + b / x^2.
+Обратные к x^2 определяются для всей порции одновременно
+(см. qrInvBatch()). Уравнение решается с помощью полуследа: z = htr(t),
+где t = x + a + b / x^2. В отличие от gf2QSolve(), не выполняется 
+деление t на квадрат единичного коэффициента при z.
+
+Подписи проверяются по восстановленным ключам функцией _dstuVerifyEc().
+В контексте кратная базовой точки определяется по таблице предвычислений.
+Кроме того, описание кривой строится один раз для всего пакета.
+*******************************************************************************
+*/
+
+#define DSTU_BATCH_SIZE 16
+
+static size_t _dstuRecoverBatch_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(DSTU_BATCH_SIZE * n) +
+		utilMax(4,
+			f_deep,
+			gf2Tr_deep(n, f_deep),
+			gf2QSolve_deep(n, f_deep),
+			qrInvBatch_deep(n, DSTU_BATCH_SIZE, f_deep));
+}
+
+static void _dstuRecoverBatch(word Q[], err_t codes[], const ec_o* ec,
+	const octet xpoints[], size_t count, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t m = gf2Deg(ec->f);
+	const bool_t a = !qrIsZero(ec->A, ec->f);
+	size_t i, j;
+	bool_t traces[DSTU_BATCH_SIZE];
+	// состояние
+	word* t;			/* [DSTU_BATCH_SIZE * n] x^2 и обратные к ним */
+	// pre
+	ASSERT(count <= DSTU_BATCH_SIZE);
+	// раскладка стека
+	t = (word*)stack;
+	stack = t + DSTU_BATCH_SIZE * n;
+	// загрузить x-координаты, t[i] <- x^2
+	for (i = 0; i < count; ++i)
+	{
+		word* x = ecX(Q + 2 * n * i);
+		codes[i] = ERR_OK;
+		if (!qrFrom(x, xpoints + i * ec->f->no, ec->f, stack))
+		{
+			codes[i] = ERR_BAD_PUBKEY;
+			qrSetZero(x, ec->f);
+		}
+		if (qrIsZero(x, ec->f))
+		{
+			qrSetUnity(t + n * i, ec->f);
+			continue;
+		}
+		// восстановить первый разряд x
+		traces[i] = wwTestBit(x, 0);
+		wwSetBit(x, 0, 0);
+		if (gf2Tr(x, ec->f, stack) != a)
+			wwSetBit(x, 0, 1);
+		qrSqr(t + n * i, x, ec->f, stack);
+	}
+	// t[i] <- t[i]^{-1}
+	qrInvBatch(t, t, count, ec->f, stack);
+	// восстановить y-координаты
+	for (i = 0; i < count; ++i)
+	{
+		word* x = ecX(Q + 2 * n * i);
+		word* y = ecY(Q + 2 * n * i, n);
+		if (codes[i] != ERR_OK)
+			continue;
+		// x == 0 => y <- b^{2^{m - 1}}
+		if (qrIsZero(x, ec->f))
+		{
+			qrCopy(y, ec->B, ec->f);
+			for (j = m; --j;)
+				qrSqr(y, y, ec->f, stack);
+			continue;
+		}
+		// t <- x + a + b / x^2
+		qrMul(t + n * i, ec->B, t + n * i, ec->f, stack);
+		gf2Add2(t + n * i, x, ec->f);
+		if (a)
+			wwFlipBit(t + n * i, 0);
+		// Solve[z^2 + z == t]: z <- htr(t) при нечетном m
+		if (m % 2)
+		{
+			if (gf2Tr(t + n * i, ec->f, stack))
+			{
+				codes[i] = ERR_BAD_PUBKEY;
+				continue;
+			}
+			qrCopy(y, t + n * i, ec->f);
+			for (j = (m - 1) / 2; j--;)
+			{
+				qrSqr(y, y, ec->f, stack);
+				qrSqr(y, y, ec->f, stack);
+				gf2Add2(y, t + n * i, ec->f);
+			}
+		}
+		else if (!gf2QSolve(y, ec->f->unity, t + n * i, ec->f, stack))
+		{
+			codes[i] = ERR_BAD_PUBKEY;
+			continue;
+		}
+		// y <- z * x или (z + 1) * x
+		if (gf2Tr(y, ec->f, stack) != traces[i])
+			wwFlipBit(y, 0);
+		qrMul(y, x, y, ec->f, stack);
+	}
+}
+
+static size_t _dstuVerifyBatch_deep(size_t n, size_t f_deep, size_t ec_d, 
+	size_t ec_deep)
+{
+	return O_OF_W(DSTU_BATCH_SIZE * 2 * n + 2 * n) +
+		DSTU_BATCH_SIZE * sizeof(err_t) +
+		utilMax(2,
+			_dstuRecoverBatch_deep(n, f_deep),
+			_dstuVerify_deep(n, f_deep, ec_d, ec_deep));
+}
+
+static err_t _dstuVerifyBatchEc(const ec_o* ec, const word pre[], size_t ld,
+	size_t count, const octet hashes[], size_t hash_len, const octet sigs[],
+	const octet xpubkeys[], err_t codes[], void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t no = ec->f->no;
+	err_t ret = ERR_OK;
+	size_t i, j, c;
+	// состояние
+	word* Q;			/* [DSTU_BATCH_SIZE * 2n] открытые ключи */
+	octet* pubkey;		/* [2no] открытый ключ */
+	err_t* cs;			/* [DSTU_BATCH_SIZE] коды восстановления */
+	// проверить входные указатели
+	if (ld % 16 != 0 ||
+		!memIsValid(hashes, count * hash_len) ||
+		!memIsValid(sigs, count * O_OF_B(ld)) ||
+		!memIsValid(xpubkeys, count * no) ||
+		!memIsNullOrValid(codes, count * sizeof(err_t)))
+		return ERR_BAD_INPUT;
+	// раскладка стека
+	Q = (word*)stack;
+	pubkey = (octet*)(Q + DSTU_BATCH_SIZE * 2 * n);
+	cs = (err_t*)(pubkey + O_OF_W(2 * n));
+	stack = cs + DSTU_BATCH_SIZE;
+	// цикл по порциям
+	for (i = 0; i < count; i += c)
+	{
+		c = MIN2(count - i, DSTU_BATCH_SIZE);
+		// восстановить открытые ключи
+		_dstuRecoverBatch(Q, cs, ec, xpubkeys + i * no, c, stack);
+		// проверить подписи
+		for (j = 0; j < c; ++j)
+		{
+			if (cs[j] == ERR_OK)
+			{
+				qrTo(pubkey, ecX(Q + 2 * n * j), ec->f, stack);
+				qrTo(pubkey + no, ecY(Q + 2 * n * j, n), ec->f, stack);
+				cs[j] = _dstuVerifyEc(ec, pre, ld, 
+					hashes + (i + j) * hash_len, hash_len,
+					sigs + (i + j) * O_OF_B(ld), pubkey, stack);
+			}
+			if (codes)
+				codes[i + j] = cs[j];
+			if (cs[j] != ERR_OK && ret == ERR_OK)
+			{
+				ret = cs[j];
+				if (!codes)
+					return ret;
+			}
+		}
+	}
+	return ret;
+}
+
+err_t dstuVerifyBatch(const dstu_params* params, size_t ld, size_t count,
+	const octet hashes[], size_t hash_len, const octet sigs[],
+	const octet xpubkeys[], err_t codes[])
+{
+	err_t code;
+	ec_o* ec;
+	// старт
+	code = _dstuCreateEc(&ec, params, _dstuVerifyBatch_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подписи
+	code = _dstuVerifyBatchEc(ec, 0, ld, count, hashes, hash_len, sigs,
+		xpubkeys, codes, objEnd(ec, void));
+	// завершение
 	_dstuCloseEc(ec);
 	return code;
 }
+
+err_t dstuCtxVerifyBatch(const void* ctx, size_t ld, size_t count,
+	const octet hashes[], size_t hash_len, const octet sigs[],
+	const octet xpubkeys[], err_t codes[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!_dstuCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = _dstuCtxStackCreate(ctx, _dstuVerifyBatch_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подписи
+	code = _dstuVerifyBatchEc(_dstuCtxEc(ctx), _dstuCtxPre(ctx), ld, count,
+		hashes, hash_len, sigs, xpubkeys, codes, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
@@ -0,0 +1,173 @@
+/*
+*******************************************************************************
+\file eng.c
+\brief Engines: offloading belt and bign to external implementations
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/err.h"
+#include "bee2/core/mem.h"
+#include "bee2/core/rng.h"
+#include "bee2/core/str.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/eng.h"
+#include "crypto/belt/belt_lcl.h"
+#include "crypto/bign_lcl.h"
+
+/*
+*******************************************************************************
+Эталонный движок
+
+Перехватчики эталонного движка обращаются к программным реализациям
+beltXXXSoft(), bignXXXSoft() и игнорируют состояние движка.
+*******************************************************************************
+*/
+
+static err_t engSoftECBEncr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len)
+{
+	return beltECBEncrSoft(dest, src, count, key, len);
+}
+
+static err_t engSoftECBDecr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len)
+{
+	return beltECBDecrSoft(dest, src, count, key, len);
+}
+
+static err_t engSoftCBCEncr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len, const octet iv[16])
+{
+	return beltCBCEncrSoft(dest, src, count, key, len, iv);
+}
+
+static err_t engSoftCBCDecr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len, const octet iv[16])
+{
+	return beltCBCDecrSoft(dest, src, count, key, len, iv);
+}
+
+static err_t engSoftCTR(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len, const octet iv[16])
+{
+	return beltCTRSoft(dest, src, count, key, len, iv);
+}
+
+static err_t engSoftMAC(void* state, octet mac[8], const void* src,
+	size_t count, const octet key[], size_t len)
+{
+	return beltMACSoft(mac, src, count, key, len);
+}
+
+static err_t engSoftHash(void* state, octet hash[32], const void* src,
+	size_t count)
+{
+	return beltHashSoft(hash, src, count);
+}
+
+static err_t engSoftSign(void* state, octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	return bignSignSoft(sig, params, oid_der, oid_len, hash, privkey, rng,
+		rng_state);
+}
+
+static err_t engSoftVerify(void* state, const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet sig[], const octet pubkey[])
+{
+	return bignVerifySoft(params, oid_der, oid_len, hash, sig, pubkey);
+}
+
+static err_t engSoftDH(void* state, octet key[], const bign_params* params,
+	const octet privkey[], const octet pubkey[], size_t key_len)
+{
+	return bignDHSoft(key, params, privkey, pubkey, key_len);
+}
+
+static const eng_t _soft =
+{
+	"soft", 0,
+	engSoftECBEncr, engSoftECBDecr, engSoftCBCEncr, engSoftCBCDecr,
+	engSoftCTR, engSoftMAC, engSoftHash,
+	engSoftSign, engSoftVerify, engSoftDH,
+	0,
+};
+
+const eng_t* engSoft()
+{
+	return &_soft;
+}
+
+/*
+*******************************************************************************
+Регистрация и назначение
+*******************************************************************************
+*/
+
+static size_t _count;					/*< число движков */
+static const eng_t* _engs[8];			/*< зарегистрированные движки */
+static const eng_t* volatile _active;	/*< действующий движок */
+
+static const eng_t* engFind(const char* name)
+{
+	size_t pos;
+	if (strEq(name, _soft.name))
+		return &_soft;
+	for (pos = 0; pos < _count; ++pos)
+		if (strEq(name, _engs[pos]->name))
+			return _engs[pos];
+	return 0;
+}
+
+err_t engReg(const eng_t* eng)
+{
+	// проверить входные данные
+	if (!memIsValid(eng, sizeof(eng_t)) || !strIsValid(eng->name) ||
+		strLen(eng->name) == 0 || strLen(eng->name) > 16)
+		return ERR_BAD_INPUT;
+	// движок уже зарегистрирован?
+	if (engFind(eng->name))
+		return ERR_BAD_INPUT;
+	// нет места?
+	if (_count == COUNT_OF(_engs))
+		return ERR_OUTOFMEMORY;
+	// зарегистрировать
+	_engs[_count++] = eng;
+	return ERR_OK;
+}
+
+err_t engSelect(const char* name)
+{
+	err_t code;
+	const eng_t* eng = 0;
+	// найти движок
+	if (name)
+	{
+		if (!strIsValid(name) || !(eng = engFind(name)))
+			return ERR_BAD_INPUT;
+	}
+	// подключить источник случайности нового движка
+	if (eng && eng->rng_read)
+	{
+		code = rngCreate(eng->rng_read, eng->state);
+		ERR_CALL_CHECK(code);
+	}
+	// отключить источник прежнего движка
+	if (_active && _active->rng_read)
+		rngClose();
+	// назначить
+	_active = eng;
+	return ERR_OK;
+}
+
+const eng_t* engActive()
+{
+	return _active;
+}
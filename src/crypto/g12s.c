@@ -4,7 +4,7 @@
 \brief GOST R 34.10-94 (Russia): digital signature algorithms
 \project bee2 [cryptographic library]
 \created 2012.07.09
-\version 2016.04.22
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,12 +13,16 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/obj.h"
 #include "bee2/core/str.h"
+#include "bee2/core/u32.h"
 #include "bee2/core/util.h"
+#include "bee2/crypto/belt.h"
 #include "bee2/crypto/g12s.h"
 #include "bee2/math/ecp.h"
 #include "bee2/math/gfp.h"
 #include "bee2/math/ww.h"
+#include "bee2/math/zm.h"
 #include "bee2/math/zz.h"
 
 /*
@@ -591,9 +595,10 @@ err_t g12sStdParams(g12s_params* params, const char* name)
 *******************************************************************************
 */
 
-static err_t g12sCreateEc(
+static err_t g12sCreateEcRed(
 	ec_o** pec,						/* [out] описание эллиптической кривой */
 	const g12s_params* params,		/* [in] долговременные параметры */
+	size_t red,						/* [in] редукция в базовом поле */
 	g12s_deep_i deep				/* [in] потребности в стековой памяти */
 )
 {
@@ -628,14 +633,15 @@ static err_t g12sCreateEc(
 		f_keep + ec_keep +
 		utilMax(3,
 			ec_deep,
-			ecCreateGroup_deep(f_deep),
+			ecCreateGroupBarr_deep(n, f_deep),
 			deep(n, f_deep, ec_d, ec_deep)));
 	if (state == 0)
 		return ERR_OUTOFMEMORY;
 	// создать поле
 	f = (qr_o*)((octet*)state + ec_keep);
 	stack = (octet*)f + f_keep;
-	if (!gfpCreate(f, params->p, no, stack))
+	if (no == 0 || params->p[0] % 2 == 0 ||
+		!zmCreateRed(f, params->p, no, red, stack))
 	{
 		blobClose(state);
 		return ERR_BAD_PARAMS;
@@ -651,7 +657,7 @@ static err_t g12sCreateEc(
 	// создать кривую и группу
 	ec = (ec_o*)state;
 	if (!ecpCreateJ(ec, f, params->a, params->b, stack) ||
-		!ecCreateGroup(ec, params->xP, params->yP, params->q, 
+		!ecCreateGroupBarr(ec, params->xP, params->yP, params->q, 
 			params->l / 8, params->n, stack))
 	{
 		blobClose(state);
@@ -674,6 +680,15 @@ static err_t g12sCreateEc(
 	return ERR_OK;
 }
 
+static err_t g12sCreateEc(
+	ec_o** pec,						/* [out] описание эллиптической кривой */
+	const g12s_params* params,		/* [in] долговременные параметры */
+	g12s_deep_i deep				/* [in] потребности в стековой памяти */
+)
+{
+	return g12sCreateEcRed(pec, params, ZM_RED_AUTO, deep);
+}
+
 /*
 *******************************************************************************
 Закрытие описания эллиптической кривой
@@ -738,6 +753,327 @@ err_t g12sValParams(const g12s_params* params)
 	return code;
 }
 
+/*
+*******************************************************************************
+Контекст
+
+Контекст -- это объект, который содержит описание эллиптической кривой, 
+построенное функцией g12sCreateEc(), и таблицу предвычислений гребенчатого 
+метода для базовой точки P. Функции g12sCtxXXX() выделяют память только
+для стека, глубина которого рассчитывается по размерностям готового
+описания.
+
+Функции g12sXXX() и g12sCtxXXX() выполняются с помощью общих функций
+g12sXXXEc(), которые работают с готовым описанием кривой и готовым стеком.
+Если таблица предвычислений не задана (pre == 0, как в g12sXXX()), 
+то кратные P определяются с помощью ecMulA() и ecAddMulA().
+
+Ширина гребня G12S_COMB_W выбрана так же, как в bign: при l == 512
+таблица (2^{w-1} аффинных точек) занимает около 8 Кбайт.
+*******************************************************************************
+*/
+
+#define G12S_COMB_W 6
+
+typedef struct
+{
+	obj_hdr_t hdr;			/*!< заголовок */
+// ptr_table {
+	ec_o* ec;				/*!< описание эллиптической кривой */
+	const word* pre;		/*!< таблица предвычислений для P */
+// }
+	size_t l;				/*!< уровень стойкости */
+	octet descr[];			/*!< память для размещения данных */
+} g12s_ctx;
+
+#define g12sCtxEc(ctx) (((const g12s_ctx*)(ctx))->ec)
+#define g12sCtxPre(ctx) (((const g12s_ctx*)(ctx))->pre)
+#define g12sCtxL(ctx) (((const g12s_ctx*)(ctx))->l)
+
+static bool_t g12sMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], size_t m, void* stack)
+{
+	if (pre)
+		return ecCombMulA(b, pre, ec, G12S_COMB_W, d, m, stack);
+	return ecMulA(b, ec->base, ec, d, m, stack);
+}
+
+static size_t g12sMulBase_deep(size_t n, size_t ec_d, size_t ec_deep)
+{
+	return utilMax(2,
+		ecMulA_deep(n, ec_d, ec_deep, n),
+		ecCombMulA_deep(n, ec_d, ec_deep, G12S_COMB_W));
+}
+
+static bool_t g12sAddMulBase(word b[], const ec_o* ec, const word pre[],
+	const word d[], const word a[], const word e[], size_t m, void* stack)
+{
+	// без таблицы
+	if (!pre)
+		return ecAddMulA(b, ec, stack, 2, ec->base, d, m, a, e, m);
+	// с таблицей (d и e не являются секретными)
+	return ecCombAddMulA(b, pre, ec, G12S_COMB_W, d, m, a, e, m, stack);
+}
+
+static size_t g12sAddMulBase_deep(size_t n, size_t ec_d, size_t ec_deep,
+	size_t m)
+{
+	return utilMax(2,
+		ecAddMulA_deep(n, ec_d, ec_deep, 2, m, m),
+		ecCombAddMulA_deep(n, ec_d, ec_deep, G12S_COMB_W, m));
+}
+
+static size_t g12sCtxStart_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return ecCombPrecA_deep(n, ec_d, ec_deep);
+}
+
+size_t g12sCtx_keep(size_t l)
+{
+	// размерности (см. g12sCreateEc())
+	size_t no = G12S_FIELD_SIZE * l / 512;
+	size_t n = W_OF_O(no);
+	// расчет
+	return sizeof(g12s_ctx) + ecCombPrecA_keep(n, G12S_COMB_W) +
+		gfpCreate_keep(no) + ecpCreateJ_keep(no);
+}
+
+err_t g12sCtxStart(void* ctx, const g12s_params* params)
+{
+	err_t code;
+	ec_o* ec;
+	g12s_ctx* c = (g12s_ctx*)ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(g12s_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 256 && params->l != 512)
+		return ERR_BAD_PARAMS;
+	// проверить ctx
+	if (!memIsValid(ctx, g12sCtx_keep(params->l)))
+		return ERR_BAD_INPUT;
+	// старт
+	code = g12sCreateEc(&ec, params, g12sCtxStart_deep);
+	ERR_CALL_CHECK(code);
+	// подготовить контекст
+	c->hdr.keep = sizeof(g12s_ctx) + 
+		ecCombPrecA_keep(ec->f->n, G12S_COMB_W);
+	c->hdr.p_count = 2;
+	c->hdr.o_count = 1;
+	c->ec = ec;
+	c->pre = (const word*)c->descr;
+	c->l = params->l;
+	// перенести описание кривой в контекст
+	ASSERT(objKeep(c) + objKeep(ec) <= g12sCtx_keep(params->l));
+	objAppend(c, ec, 0);
+	// построить таблицу предвычислений
+	if (!ecCombPrecA((word*)c->descr, c->ec->base, c->ec, G12S_COMB_W,
+		objEnd(ec, void)))
+		code = ERR_BAD_PARAMS;
+	// завершение
+	g12sCloseEc(ec);
+	return code;
+}
+
+static bool_t g12sCtxIsOperable(const void* ctx)
+{
+	const g12s_ctx* c = (const g12s_ctx*)ctx;
+	return memIsValid(c, sizeof(g12s_ctx)) &&
+		objPCount(c) == 2 && objOCount(c) == 1 &&
+		objIsOperable(c) &&
+		(c->l == 256 || c->l == 512) &&
+		ecIsOperable(c->ec) &&
+		ecIsOperableGroup(c->ec) &&
+		wwIsValid(c->pre, c->ec->f->n << G12S_COMB_W);
+}
+
+static void* g12sCtxStackCreate(const void* ctx, g12s_deep_i deep)
+{
+	const ec_o* ec = g12sCtxEc(ctx);
+	return blobCreate(deep(ec->f->n, ec->f->deep, ec->d, ec->deep));
+}
+
+/*
+*******************************************************************************
+Сохранение и загрузка контекста
+
+Образ контекста устроен так же, как в bign (см. bignCtxSave()):
+-	[4] сигнатура "GCTX";
+-	[28] заголовок: 7 чисел u32 (little-endian) -- версия формата 
+	(G12S_CTX_VERSION), уровень стойкости l, длина машинного слова B_PER_W, 
+	порядок октетов в слове, редукция в базовом поле, ширина гребня 
+	G12S_COMB_W, резерв (0);
+-	[32] хэш-значение belt-hash описания кривой: p, a, b, q, xP, yP
+	(см. g12sCtxDigest());
+-	[ecCombPrecA_keep(n, G12S_COMB_W)] таблица предвычислений в машинном 
+	представлении;
+-	[32] хэш-значение belt-hash всех предыдущих октетов.
+.
+Здесь n -- длина p в машинных словах. Длина p определяется по параметрам,
+поэтому длина образа проверяется после построения описания кривой.
+*******************************************************************************
+*/
+
+#define G12S_CTX_VERSION 1
+#define G12S_CTX_HDR 64
+
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+	#define G12S_CTX_ORDER 0
+#else
+	#define G12S_CTX_ORDER 1
+#endif
+
+static size_t g12sCtxImage_size(size_t n)
+{
+	return G12S_CTX_HDR + ecCombPrecA_keep(n, G12S_COMB_W) + 32;
+}
+
+static size_t g12sCtxLoad_deep(size_t n, size_t f_deep, size_t ec_d,
+	size_t ec_deep)
+{
+	return utilMax(2,
+		O_OF_W(6 * n) + f_deep,
+		ecpIsOnA_deep(n, f_deep));
+}
+
+static void g12sCtxDigest(octet digest[32], const ec_o* ec, size_t l,
+	void* stack)
+{
+	const size_t no = ec->f->no;
+	octet* buf = (octet*)stack;
+	stack = buf + 5 * no + l / 8;
+	wwTo(buf, no, ec->f->mod);
+	qrTo(buf + no, ec->A, ec->f, stack);
+	qrTo(buf + 2 * no, ec->B, ec->f, stack);
+	wwTo(buf + 3 * no, l / 8, ec->order);
+	qrTo(buf + 3 * no + l / 8, ecX(ec->base), ec->f, stack);
+	qrTo(buf + 4 * no + l / 8, ecY(ec->base, ec->f->n), ec->f, stack);
+	beltHash(digest, buf, 5 * no + l / 8);
+	memWipe(buf, 5 * no + l / 8);
+}
+
+err_t g12sCtxSave(octet image[], size_t* count, const void* ctx)
+{
+	const g12s_ctx* c = (const g12s_ctx*)ctx;
+	size_t n;
+	u32 hdr[7];
+	void* stack;
+	// проверить входные данные
+	if (!g12sCtxIsOperable(ctx) || !memIsValid(count, sizeof(size_t)))
+		return ERR_BAD_INPUT;
+	n = c->ec->f->n;
+	// только длина?
+	if (!image)
+	{
+		*count = g12sCtxImage_size(n);
+		return ERR_OK;
+	}
+	if (!memIsValid(image, g12sCtxImage_size(n)))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = blobCreate(g12sCtxLoad_deep(n, c->ec->f->deep, 0, 0));
+	if (!stack)
+		return ERR_OUTOFMEMORY;
+	// заголовок
+	hdr[0] = G12S_CTX_VERSION;
+	hdr[1] = (u32)c->l;
+	hdr[2] = B_PER_W;
+	hdr[3] = G12S_CTX_ORDER;
+	hdr[4] = (u32)zmRed(c->ec->f);
+	hdr[5] = G12S_COMB_W;
+	hdr[6] = 0;
+	memCopy(image, "GCTX", 4);
+	u32To(image + 4, 28, hdr);
+	g12sCtxDigest(image + 32, c->ec, c->l, stack);
+	// таблица
+	memCopy(image + G12S_CTX_HDR, c->pre, ecCombPrecA_keep(n, G12S_COMB_W));
+	// контрольное хэш-значение
+	*count = g12sCtxImage_size(n);
+	beltHash(image + *count - 32, image, *count - 32);
+	// завершение
+	blobClose(stack);
+	return ERR_OK;
+}
+
+size_t g12sCtxLoad_keep(size_t l)
+{
+	// размерности (см. g12sCreateEc())
+	size_t no = G12S_FIELD_SIZE * l / 512;
+	size_t n = W_OF_O(no);
+	// расчет
+	return sizeof(g12s_ctx) + gfpCreate_keep(no) + ecpCreateJ_keep(n);
+}
+
+err_t g12sCtxLoad(void* ctx, const g12s_params* params, const octet image[],
+	size_t count)
+{
+	err_t code;
+	size_t n, i;
+	u32 hdr[7];
+	octet digest[32];
+	ec_o* ec;
+	g12s_ctx* c = (g12s_ctx*)ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(g12s_params)))
+		return ERR_BAD_INPUT;
+	if (params->l != 256 && params->l != 512)
+		return ERR_BAD_PARAMS;
+	// проверить ctx и image
+	if (!memIsValid(ctx, g12sCtxLoad_keep(params->l)) ||
+		!memIsValid(image, count))
+		return ERR_BAD_INPUT;
+	// проверить формат
+	if (count <= G12S_CTX_HDR + 32 || !memEq(image, "GCTX", 4))
+		return ERR_BAD_FORMAT;
+	u32From(hdr, image + 4, 28);
+	if (hdr[0] != G12S_CTX_VERSION || hdr[1] != params->l ||
+		hdr[2] != B_PER_W || hdr[3] != G12S_CTX_ORDER ||
+		hdr[4] == ZM_RED_AUTO || zmRedName(hdr[4]) == 0 ||
+		hdr[5] != G12S_COMB_W || hdr[6] != 0)
+		return ERR_BAD_FORMAT;
+	// таблица выровнена?
+	if ((size_t)(image + G12S_CTX_HDR) % O_PER_W)
+		return ERR_BAD_INPUT;
+	// проверить целостность
+	beltHash(digest, image, count - 32);
+	if (!memEq(digest, image + count - 32, 32))
+		return ERR_BAD_HASH;
+	// старт
+	code = g12sCreateEcRed(&ec, params, hdr[4], g12sCtxLoad_deep);
+	ERR_CALL_CHECK(code);
+	n = ec->f->n;
+	// образ соответствует params?
+	if (count != g12sCtxImage_size(n))
+		code = ERR_BAD_FORMAT;
+	else
+	{
+		g12sCtxDigest(digest, ec, params->l, objEnd(ec, void));
+		if (!memEq(digest, image + 32, 32))
+			code = ERR_BAD_PARAMS;
+	}
+	// подготовить контекст
+	if (code == ERR_OK)
+	{
+		c->hdr.keep = sizeof(g12s_ctx);
+		c->hdr.p_count = 2;
+		c->hdr.o_count = 1;
+		c->ec = ec;
+		c->pre = (const word*)(image + G12S_CTX_HDR);
+		c->l = params->l;
+		ASSERT(objKeep(c) + objKeep(ec) <= g12sCtxLoad_keep(params->l));
+		objAppend(c, ec, 0);
+		// проверить таблицу
+		if (!wwEq(c->pre, c->ec->base, 2 * n))
+			code = ERR_BAD_FORMAT;
+		for (i = 0; code == ERR_OK && i < (SIZE_1 << (G12S_COMB_W - 1)); ++i)
+			if (!ecpIsOnA(c->pre + 2 * n * i, c->ec, objEnd(ec, void)))
+				code = ERR_BAD_FORMAT;
+	}
+	// завершение
+	g12sCloseEc(ec);
+	return code;
+}
+
 /*
 *******************************************************************************
 Управление ключами
@@ -749,60 +1085,83 @@ static size_t g12sGenKeypair_deep(size_t n, size_t f_deep, size_t ec_d,
 {
 	const size_t m = n;
 	return O_OF_W(m + 2 * n) + 
-		ecMulA_deep(n, ec_d, ec_deep, n);
+		g12sMulBase_deep(n, ec_d, ec_deep);
 }
 
-err_t g12sGenKeypair(octet privkey[], octet pubkey[],
-	const g12s_params* params, gen_i rng, void* rng_stack)
+static err_t g12sGenKeypairEc(octet privkey[], octet pubkey[],
+	const ec_o* ec, const word pre[], size_t l, gen_i rng, void* rng_state,
+	void* stack)
 {
-	err_t code;
 	size_t m, mo;
 	// состояние
-	ec_o* ec;
 	word* d;				/* [m] личный ключ */
 	word* Q;				/* [2n] открытый ключ */	
-	void* stack;
-	// проверить rng
-	if (rng == 0)
-		return ERR_BAD_RNG;
-	// старт
-	code = g12sCreateEc(&ec, params, g12sGenKeypair_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
-	m = W_OF_B(params->l);
-	mo = O_OF_B(params->l);
+	m = W_OF_B(l);
+	mo = O_OF_B(l);
 	// проверить входные указатели
 	if (!memIsValid(privkey, mo) || 
 		!memIsValid(pubkey, 2 * ec->f->no))
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
+	// раскладка стека
+	d = (word*)stack;
 	Q = d + m;
 	stack = Q + 2 * ec->f->n;
 	// d <-R {1,2,..., q - 1}
-	if (!zzRandNZMod(d, ec->order, m, rng, rng_stack))
-	{
-		g12sCloseEc(ec);
+	if (!zzRandNZMod(d, ec->order, m, rng, rng_state))
 		return ERR_BAD_RNG;
-	}
 	// Q <- d P
-	if (!ecMulA(Q, ec->base, ec, d, m, stack))
-	{
-		g12sCloseEc(ec);
+	if (!g12sMulBase(Q, ec, pre, d, m, stack))
 		return ERR_BAD_PARAMS;
-	}
 	// выгрузить ключи
 	wwTo(privkey, mo, d);
 	qrTo(pubkey, ecX(Q), ec->f, stack);
 	qrTo(pubkey + ec->f->no, ecY(Q, ec->f->n), ec->f, stack);
-	// все нормально
-	g12sCloseEc(ec);
 	return ERR_OK;
 }
 
+err_t g12sGenKeypair(octet privkey[], octet pubkey[],
+	const g12s_params* params, gen_i rng, void* rng_state)
+{
+	err_t code;
+	ec_o* ec;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// старт
+	code = g12sCreateEc(&ec, params, g12sGenKeypair_deep);
+	ERR_CALL_CHECK(code);
+	// сгенерировать ключи
+	code = g12sGenKeypairEc(privkey, pubkey, ec, 0, params->l, rng,
+		rng_state, objEnd(ec, void));
+	// завершение
+	g12sCloseEc(ec);
+	return code;
+}
+
+err_t g12sCtxGenKeypair(octet privkey[], octet pubkey[], const void* ctx,
+	gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!g12sCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// создать стек
+	stack = g12sCtxStackCreate(ctx, g12sGenKeypair_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// сгенерировать ключи
+	code = g12sGenKeypairEc(privkey, pubkey, g12sCtxEc(ctx), g12sCtxPre(ctx),
+		g12sCtxL(ctx), rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Выработка ЭЦП
@@ -815,44 +1174,33 @@ static size_t g12sSign_deep(size_t n, size_t f_deep, size_t ec_d,
 	const size_t m = n;
 	return 	O_OF_W(3 * m + 2 * n) +
 		utilMax(3,
-			zzMod_deep(m, m),
-			ecMulA_deep(n, ec_d, ec_deep, n),
+			ecModOrder_deep(n),
+			g12sMulBase_deep(n, ec_d, ec_deep),
 			zzMulMod_deep(m));
 }
 
-err_t g12sSign(octet sig[], const g12s_params* params, const octet hash[],
-	const octet privkey[], gen_i rng, void* rng_stack)
+static err_t g12sSignEc(octet sig[], const ec_o* ec, const word pre[],
+	size_t l, const octet hash[], const octet privkey[], gen_i rng,
+	void* rng_state, void* stack)
 {
-	err_t code;
 	size_t m, mo;
 	// состояние
-	ec_o* ec;
 	word* d;		/* [m] личный ключ */
 	word* e;		/* [m] обработанное хэш-значение */
 	word* k;		/* [m] одноразовый ключ */
 	word* C;		/* [2n] вспомогательная точка */
 	word* r;		/* [m] первая (старшая) часть подписи */
 	word* s;		/* [m] вторая часть подписи */
-	void* stack;
-	// проверить rng
-	if (rng == 0)
-		return ERR_BAD_RNG;
-	// старт
-	code = g12sCreateEc(&ec, params, g12sSign_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
-	m = W_OF_B(params->l);
-	mo = O_OF_B(params->l);
+	m = W_OF_B(l);
+	mo = O_OF_B(l);
 	// проверить входные указатели
 	if (!memIsValid(hash, mo) ||
 		!memIsValid(privkey, mo) ||
 		!memIsValid(sig, 2 * mo))
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	d = objEnd(ec, word);
+	// раскладка стека
+	d = (word*)stack;
 	e = d + m;
 	k = e + m;
 	C = k + m;
@@ -863,36 +1211,27 @@ err_t g12sSign(octet sig[], const g12s_params* params, const octet hash[],
 	wwFrom(d, privkey, mo);
 	if (wwIsZero(d, m) || 
 		wwCmp(d, ec->order, m) >= 0)
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_PRIVKEY;
-	}
 	// e <- hash \mod q
 	memCopy(e, hash, mo);
 	memRev(e, mo);
 	wwFrom(e, e, mo);
-	zzMod(e, e, m, ec->order, m, stack);
+	ecModOrder(e, e, m, ec, stack);
 	// e == 0 => e <- 1
 	if (wwIsZero(e, m))
 		e[0] = 1;
 	// k <-R {1,2,..., q - 1}
 gen_k:
-	if (!zzRandNZMod(k, ec->order, m, rng, rng_stack))
-	{
-		g12sCloseEc(ec);
+	if (!zzRandNZMod(k, ec->order, m, rng, rng_state))
 		return ERR_BAD_RNG;
-	}
 	// C <- k P
-	if (!ecMulA(C, ec->base, ec, k, m, stack))
-	{
+	if (!g12sMulBase(C, ec, pre, k, m, stack))
 		// если params корректны, то этого быть не должно
-		g12sCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
 	// r <- x_C \mod q
 	qrTo((octet*)C, ecX(C), ec->f, stack);
 	wwFrom(r, C, ec->f->no);
-	zzMod(r, r, ec->f->n, ec->order, m, stack);
+	ecModOrder(r, r, ec->f->n, ec, stack);
 	// r == 0 => повторить генерацию k
 	if (wwIsZero(r, m))
 		goto gen_k;
@@ -904,14 +1243,57 @@ gen_k:
 	wwTo(sig, mo, s);
 	wwTo(sig + mo, mo, r);
 	memRev(sig, 2 * mo);
-	// все нормально
-	g12sCloseEc(ec);
 	return ERR_OK;
 }
 
+err_t g12sSign(octet sig[], const g12s_params* params, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	ec_o* ec;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// старт
+	code = g12sCreateEc(&ec, params, g12sSign_deep);
+	ERR_CALL_CHECK(code);
+	// выработать подпись
+	code = g12sSignEc(sig, ec, 0, params->l, hash, privkey, rng, rng_state,
+		objEnd(ec, void));
+	// завершение
+	g12sCloseEc(ec);
+	return code;
+}
+
+err_t g12sCtxSign(octet sig[], const void* ctx, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!g12sCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// проверить rng
+	if (rng == 0)
+		return ERR_BAD_RNG;
+	// создать стек
+	stack = g12sCtxStackCreate(ctx, g12sSign_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// выработать подпись
+	code = g12sSignEc(sig, g12sCtxEc(ctx), g12sCtxPre(ctx), g12sCtxL(ctx),
+		hash, privkey, rng, rng_state, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
+
 /*
 *******************************************************************************
 Проверка ЭЦП
+
+Сумма z1 P + z2 Q определяется в одном цикле удвоений. В контексте
+кратная P определяется по таблице предвычислений (см. ecCombAddMulA()).
 *******************************************************************************
 */
 
@@ -921,40 +1303,31 @@ static size_t g12sVerify_deep(size_t n, size_t f_deep, size_t ec_d,
 	const size_t m = n;
 	return O_OF_W(5 * m + 2 * n) +
 		utilMax(4,
-			zzMod_deep(m, m),
+			ecModOrder_deep(n),
 			zzMulMod_deep(m),
 			zzInvMod_deep(m),
-			ecAddMulA_deep(n, ec_d, ec_deep, 2, m, m));
+			g12sAddMulBase_deep(n, ec_d, ec_deep, m));
 }
 
-err_t g12sVerify(const g12s_params* params, const octet hash[], 
-	const octet sig[], const octet pubkey[])
+static err_t g12sVerifyEc(const ec_o* ec, const word pre[], size_t l,
+	const octet hash[], const octet sig[], const octet pubkey[], void* stack)
 {
-	err_t code;
 	size_t m, mo;
 	// состояние
-	ec_o* ec;
 	word* Q;		/* [2n] открытый ключ / точка R */
 	word* r;		/* [m] первая (старшая) часть подписи */
 	word* s;		/* [m] вторая часть подписи */
 	word* e;		/* [m] обработанное хэш-значение, v */
-	void* stack;
-	// старт
-	code = g12sCreateEc(&ec, params, g12sVerify_deep);
-	ERR_CALL_CHECK(code);
 	// размерности order
-	m = W_OF_B(params->l);
-	mo = O_OF_B(params->l);
+	m = W_OF_B(l);
+	mo = O_OF_B(l);
 	// проверить входные указатели
 	if (!memIsValid(hash, mo) ||
 		!memIsValid(sig, 2 * mo) ||
 		!memIsValid(pubkey, 2 * ec->f->no))
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_INPUT;
-	}
-	// раскладка состояния
-	Q = objEnd(ec, word);
+	// раскладка стека
+	Q = (word*)stack;
 	r = Q + 2 * ec->f->n;
 	s = r + m;
 	e = s + m;
@@ -962,10 +1335,7 @@ err_t g12sVerify(const g12s_params* params, const octet hash[],
 	// загрузить Q
 	if (!qrFrom(ecX(Q), pubkey, ec->f, stack) ||
 		!qrFrom(ecY(Q, ec->f->n), pubkey + ec->f->no, ec->f, stack))
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_PUBKEY;
-	}
 	// загрузить r и s
 	memCopy(s, sig + mo, mo);
 	memRev(s, mo);
@@ -977,15 +1347,12 @@ err_t g12sVerify(const g12s_params* params, const octet hash[],
 		wwIsZero(r, m) || 
 		wwCmp(s, ec->order, m) >= 0 ||
 		wwCmp(r, ec->order, m) >= 0)
-	{
-		g12sCloseEc(ec);
 		return ERR_BAD_SIG;
-	}
 	// e <- hash \mod q
 	memCopy(e, hash, mo);
 	memRev(e, mo);
 	wwFrom(e, e, mo);
-	zzMod(e, e, m, ec->order, m, stack);
+	ecModOrder(e, e, m, ec, stack);
 	// e == 0 => e <- 1
 	if (wwIsZero(e, m))
 		e[0] = 1;
@@ -997,18 +1364,48 @@ err_t g12sVerify(const g12s_params* params, const octet hash[],
 	zzMulMod(e, e, r, ec->order, m, stack);
 	zzNegMod(e, e, ec->order, m);
 	// Q <- s P + e Q [z1 P + z2 Q = R]
-	if (!ecAddMulA(Q, ec, stack, 2, ec->base, s, m, Q, e, m))
-	{
-		g12sCloseEc(ec);
+	if (!g12sAddMulBase(Q, ec, pre, s, Q, e, m, stack))
 		return ERR_BAD_PARAMS;
-	}
 	// s <- x_Q \mod q [x_R \mod q]
 	qrTo((octet*)Q, ecX(Q), ec->f, stack);
 	wwFrom(Q, Q, ec->f->no);
-	zzMod(s, Q, ec->f->n, ec->order, m, stack);
+	ecModOrder(s, Q, ec->f->n, ec, stack);
 	// s == r?
-	code = wwEq(r, s, m) ? ERR_OK : ERR_BAD_SIG;
+	return wwEq(r, s, m) ? ERR_OK : ERR_BAD_SIG;
+}
+
+err_t g12sVerify(const g12s_params* params, const octet hash[], 
+	const octet sig[], const octet pubkey[])
+{
+	err_t code;
+	ec_o* ec;
+	// старт
+	code = g12sCreateEc(&ec, params, g12sVerify_deep);
+	ERR_CALL_CHECK(code);
+	// проверить подпись
+	code = g12sVerifyEc(ec, 0, params->l, hash, sig, pubkey,
+		objEnd(ec, void));
 	// завершение
 	g12sCloseEc(ec);
 	return code;
 }
+
+err_t g12sCtxVerify(const void* ctx, const octet hash[], const octet sig[],
+	const octet pubkey[])
+{
+	err_t code;
+	void* stack;
+	// проверить ctx
+	if (!g12sCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// создать стек
+	stack = g12sCtxStackCreate(ctx, g12sVerify_deep);
+	if (stack == 0)
+		return ERR_OUTOFMEMORY;
+	// проверить подпись
+	code = g12sVerifyEc(g12sCtxEc(ctx), g12sCtxPre(ctx), g12sCtxL(ctx),
+		hash, sig, pubkey, stack);
+	// завершение
+	blobClose(stack);
+	return code;
+}
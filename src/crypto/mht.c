@@ -0,0 +1,672 @@
+/*
+*******************************************************************************
+\file mht.c
+\brief Merkle hash trees over belt-hash and bash
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/blob.h"
+#include "bee2/core/err.h"
+#include "bee2/core/mem.h"
+#include "bee2/core/util.h"
+#include "bee2/crypto/bash.h"
+#include "bee2/crypto/belt.h"
+#include "bee2/crypto/mht.h"
+
+/*
+*******************************************************************************
+Хэширование
+
+Внутренние узлы хэшируются пакетами по MHT_BATCH узлов. Для каждого узла
+пакета во вспомогательном буфере формируется сообщение 01 || L || R, после
+чего сообщения пакета обрабатываются одним вызовом beltHashMulti() или
+bashHashMulti(). Пакет кратен числу сообщений, которые обрабатываются
+одновременно (4 для belt-hash, 8 для bash).
+*******************************************************************************
+*/
+
+#define MHT_BATCH 64
+
+static bool_t mhtAlgIsValid(size_t alg)
+{
+	return alg == MHT_BELT || (alg % 16 == 0 && alg <= 256);
+}
+
+size_t mhtHashLen(size_t alg)
+{
+	if (!mhtAlgIsValid(alg))
+		return SIZE_MAX;
+	return alg == MHT_BELT ? 32 : alg / 4;
+}
+
+static err_t mhtHash(octet hash[], size_t alg, const void* src, size_t count)
+{
+	return alg == MHT_BELT ? beltHash(hash, src, count) :
+		bashHash(hash, alg, src, count);
+}
+
+static size_t mhtLeaf_keep()
+{
+	return MAX2(beltHash_keep(), bashHash_keep());
+}
+
+static void mhtLeafInternal(octet hash[], size_t alg, const void* src,
+	size_t count, void* state)
+{
+	const octet prefix = 0x00;
+	if (alg == MHT_BELT)
+	{
+		beltHashStart(state);
+		beltHashStepH(&prefix, 1, state);
+		beltHashStepH(src, count, state);
+		beltHashStepG(hash, state);
+	}
+	else
+	{
+		bashHashStart(state, alg);
+		bashHashStepH(&prefix, 1, state);
+		bashHashStepH(src, count, state);
+		bashHashStepG(hash, alg / 4, state);
+	}
+}
+
+err_t mhtLeaf(octet hash[], size_t alg, const void* src, size_t count)
+{
+	void* state;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(src, count) || !memIsValid(hash, mhtHashLen(alg)))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(mhtLeaf_keep());
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// вычислить хэш-значение
+	mhtLeafInternal(hash, alg, src, count, state);
+	// завершить
+	blobClose(state);
+	return ERR_OK;
+}
+
+static err_t mhtNode(octet hash[], size_t alg, const octet left[],
+	const octet right[])
+{
+	const size_t hlen = mhtHashLen(alg);
+	octet msg[1 + 2 * MHT_HASH_MAX];
+	err_t code;
+	msg[0] = 0x01;
+	memCopy(msg + 1, left, hlen);
+	memCopy(msg + 1 + hlen, right, hlen);
+	code = mhtHash(hash, alg, msg, 1 + 2 * hlen);
+	memWipe(msg, sizeof(msg));
+	return code;
+}
+
+/*
+	Определяются n родителей [n]parents пар узлов [2n]children. Буферы
+	parents и children могут совпадать: родители пакета записываются
+	после того, как прочитаны все потомки пакета, а потомки следующих
+	пакетов расположены правее.
+*/
+static err_t mhtNodes(octet parents[], size_t alg, const octet children[],
+	size_t n)
+{
+	const size_t hlen = mhtHashLen(alg);
+	const size_t mlen = 1 + 2 * hlen;
+	const void* src[MHT_BATCH];
+	size_t count[MHT_BATCH];
+	octet* msg;
+	size_t i, k;
+	err_t code = ERR_OK;
+	// нет узлов?
+	if (n == 0)
+		return ERR_OK;
+	// создать буфер сообщений
+	msg = (octet*)blobCreate(MHT_BATCH * mlen);
+	if (msg == 0)
+		return ERR_OUTOFMEMORY;
+	for (i = 0; i < MHT_BATCH; ++i)
+		src[i] = msg + i * mlen, count[i] = mlen;
+	// цикл по пакетам
+	for (; n && code == ERR_OK; n -= k)
+	{
+		k = MIN2(n, MHT_BATCH);
+		for (i = 0; i < k; ++i)
+		{
+			msg[i * mlen] = 0x01;
+			memCopy(msg + i * mlen + 1, children + 2 * i * hlen, 2 * hlen);
+		}
+		code = alg == MHT_BELT ? beltHashMulti(parents, k, src, count) :
+			bashHashMulti(parents, alg, k, src, count);
+		children += 2 * k * hlen, parents += k * hlen;
+	}
+	// завершить
+	blobClose(msg);
+	return code;
+}
+
+/*
+*******************************************************************************
+Корень по листьям
+
+Корень определяется по уровням: узлы уровня объединяются в пары, которые
+хэшируются пакетами, последний непарный узел переносится на следующий
+уровень без изменений. Такой обход строит то же дерево, что и рекурсивное
+определение MTH.
+*******************************************************************************
+*/
+
+static err_t mhtMTH(octet root[], size_t alg, const octet leaves[], size_t n)
+{
+	const size_t hlen = mhtHashLen(alg);
+	octet* level;
+	size_t m;
+	err_t code;
+	// пустое дерево? один лист?
+	if (n == 0)
+		return mhtHash(root, alg, root, 0);
+	if (n == 1)
+	{
+		memMove(root, leaves, hlen);
+		return ERR_OK;
+	}
+	// создать уровень
+	level = (octet*)blobCreate((n + 1) / 2 * hlen);
+	if (level == 0)
+		return ERR_OUTOFMEMORY;
+	// первый уровень
+	m = n / 2;
+	code = mhtNodes(level, alg, leaves, m);
+	if (n & 1)
+		memCopy(level + m * hlen, leaves + (n - 1) * hlen, hlen);
+	n = m + (n & 1);
+	// следующие уровни
+	while (code == ERR_OK && n > 1)
+	{
+		m = n / 2;
+		code = mhtNodes(level, alg, level, m);
+		if (n & 1)
+			memMove(level + m * hlen, level + (n - 1) * hlen, hlen);
+		n = m + (n & 1);
+	}
+	// завершить
+	if (code == ERR_OK)
+		memCopy(root, level, hlen);
+	blobClose(level);
+	return code;
+}
+
+err_t mhtRootOf(octet root[], size_t alg, const octet leaves[], size_t n)
+{
+	size_t hlen;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	hlen = mhtHashLen(alg);
+	if (n > SIZE_MAX / hlen ||
+		!memIsValid(leaves, n * hlen) ||
+		!memIsValid(root, hlen))
+		return ERR_BAD_INPUT;
+	// вычислить
+	return mhtMTH(root, alg, leaves, n);
+}
+
+/*
+*******************************************************************************
+Растущее дерево
+
+Фронт: f[i] -- корень полного поддерева из 2^i листьев, если i-й бит
+числа листьев size установлен.
+
+Пакет листьев добавляется по уровням. На уровне i новые узлы, к которым
+слева приписывается f[i], если i-й бит size установлен, объединяются в
+пары. Последний непарный узел становится новым f[i]. Родители пар
+образуют новые узлы уровня i + 1. Новый фронт формируется в копии и
+переносится в состояние только после успешного завершения. Одиночный
+лист добавляется без копирования фронта: он последовательно объединяется
+с f[0], f[1],... по младшим установленным битам size.
+
+Формат сохраненного фронта (11 + w * hlen октетов):
+-	[1] идентификатор MHT_SAVE_ID;
+-	[1] версия формата MHT_SAVE_VER;
+-	[1] alg / 16;
+-	[8] size (little-endian);
+-	[w * hlen] f[i] для установленных битов size в порядке возрастания i.
+*******************************************************************************
+*/
+
+#define MHT_SAVE_ID		0x4D	/* 'M' */
+#define MHT_SAVE_VER	1
+
+typedef struct
+{
+	size_t alg;							/*< алгоритм хэширования */
+	size_t hlen;						/*< длина хэш-значения */
+	size_t size;						/*< число листьев */
+	octet f[B_PER_S][MHT_HASH_MAX];		/*< фронт */
+} mht_st;
+
+size_t mht_keep()
+{
+	return sizeof(mht_st);
+}
+
+err_t mhtStart(void* state, size_t alg)
+{
+	mht_st* st = (mht_st*)state;
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	if (!memIsValid(state, mht_keep()))
+		return ERR_BAD_INPUT;
+	memSetZero(st, sizeof(mht_st));
+	st->alg = alg, st->hlen = mhtHashLen(alg);
+	return ERR_OK;
+}
+
+err_t mhtAppendH(void* state, const octet leaves[], size_t n)
+{
+	mht_st* st = (mht_st*)state;
+	octet* f;
+	octet* level;
+	size_t i, m, p;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!memIsValid(state, mht_keep()) || !mhtAlgIsValid(st->alg) ||
+		n > SIZE_MAX - st->size || n > SIZE_MAX / st->hlen - 2 ||
+		!memIsValid(leaves, n * st->hlen))
+		return ERR_BAD_INPUT;
+	if (n == 0)
+		return ERR_OK;
+	// один лист: перенос по установленным битам size
+	if (n == 1)
+	{
+		octet carry[MHT_HASH_MAX];
+		memCopy(carry, leaves, st->hlen);
+		for (i = 0; (st->size >> i) & 1 && code == ERR_OK; ++i)
+			code = mhtNode(carry, st->alg, st->f[i], carry);
+		if (code == ERR_OK)
+			memCopy(st->f[i], carry, st->hlen), ++st->size;
+		memWipe(carry, sizeof(carry));
+		return code;
+	}
+	// создать копию фронта и уровень
+	f = (octet*)blobCreate(sizeof(st->f) + (n + 1) * st->hlen);
+	if (f == 0)
+		return ERR_OUTOFMEMORY;
+	level = f + sizeof(st->f);
+	memCopy(f, st->f, sizeof(st->f));
+	memCopy(level, leaves, n * st->hlen);
+	// цикл по уровням
+	for (i = 0, m = n; m && code == ERR_OK; ++i)
+	{
+		ASSERT(i < B_PER_S);
+		p = st->size >> i;
+		// приписать f[i]
+		if (p & 1)
+		{
+			memMove(level + st->hlen, level, m * st->hlen);
+			memCopy(level, f + i * MHT_HASH_MAX, st->hlen);
+			++m;
+		}
+		// новый f[i]
+		if (m & 1)
+			memCopy(f + i * MHT_HASH_MAX, level + (m - 1) * st->hlen,
+				st->hlen);
+		// родители
+		m /= 2;
+		code = mhtNodes(level, st->alg, level, m);
+	}
+	// обновить состояние
+	if (code == ERR_OK)
+	{
+		memCopy(st->f, f, sizeof(st->f));
+		st->size += n;
+	}
+	blobClose(f);
+	return code;
+}
+
+err_t mhtAppend(void* state, const void* src[], const size_t count[],
+	size_t n)
+{
+	mht_st* st = (mht_st*)state;
+	octet* leaves;
+	void* stack;
+	size_t i;
+	err_t code;
+	// проверить входные данные
+	if (!memIsValid(state, mht_keep()) || !mhtAlgIsValid(st->alg) ||
+		n > SIZE_MAX / st->hlen ||
+		!memIsValid(src, n * sizeof(const void*)) ||
+		!memIsValid(count, n * sizeof(size_t)))
+		return ERR_BAD_INPUT;
+	for (i = 0; i < n; ++i)
+		if (!memIsValid(src[i], count[i]))
+			return ERR_BAD_INPUT;
+	// создать хэш-значения листьев и состояние хэширования
+	leaves = (octet*)blobCreate(n * st->hlen + mhtLeaf_keep());
+	if (leaves == 0)
+		return ERR_OUTOFMEMORY;
+	stack = leaves + n * st->hlen;
+	// хэшировать и добавить листья
+	for (i = 0; i < n; ++i)
+		mhtLeafInternal(leaves + i * st->hlen, st->alg, src[i], count[i],
+			stack);
+	code = mhtAppendH(state, leaves, n);
+	// завершить
+	blobClose(leaves);
+	return code;
+}
+
+size_t mhtSize(const void* state)
+{
+	const mht_st* st = (const mht_st*)state;
+	ASSERT(memIsValid(state, mht_keep()));
+	return st->size;
+}
+
+err_t mhtRoot(octet root[], const void* state)
+{
+	const mht_st* st = (const mht_st*)state;
+	octet r[MHT_HASH_MAX];
+	size_t i;
+	bool_t first = TRUE;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!memIsValid(state, mht_keep()) || !mhtAlgIsValid(st->alg) ||
+		!memIsValid(root, st->hlen))
+		return ERR_BAD_INPUT;
+	// пустое дерево?
+	if (st->size == 0)
+		return mhtHash(root, st->alg, root, 0);
+	// свернуть фронт от младших битов к старшим
+	for (i = 0; i < B_PER_S && code == ERR_OK; ++i)
+		if ((st->size >> i) & 1)
+		{
+			if (first)
+				memCopy(r, st->f[i], st->hlen), first = FALSE;
+			else
+				code = mhtNode(r, st->alg, st->f[i], r);
+		}
+	if (code == ERR_OK)
+		memCopy(root, r, st->hlen);
+	memWipe(r, sizeof(r));
+	return code;
+}
+
+size_t mhtSave(octet buf[], const void* state)
+{
+	const mht_st* st = (const mht_st*)state;
+	size_t count = 11;
+	size_t i;
+	ASSERT(memIsValid(state, mht_keep()));
+	// фронт
+	for (i = 0; i < B_PER_S; ++i)
+		if ((st->size >> i) & 1)
+		{
+			if (buf)
+			{
+				ASSERT(memIsValid(buf + count, st->hlen));
+				memCopy(buf + count, st->f[i], st->hlen);
+			}
+			count += st->hlen;
+		}
+	// заголовок
+	if (buf)
+	{
+		ASSERT(memIsValid(buf, 11));
+		buf[0] = MHT_SAVE_ID, buf[1] = MHT_SAVE_VER;
+		buf[2] = (octet)(st->alg / 16);
+		memSetZero(buf + 3, 8);
+		for (i = 0; i < O_PER_S; ++i)
+			buf[3 + i] = (octet)(st->size >> 8 * i);
+	}
+	return count;
+}
+
+err_t mhtLoad(void* state, const octet buf[], size_t count)
+{
+	mht_st* st = (mht_st*)state;
+	size_t alg, size, pos, i;
+	// проверить входные данные
+	if (!memIsValid(state, mht_keep()) || !memIsValid(buf, count))
+		return ERR_BAD_INPUT;
+	// разобрать заголовок
+	if (count < 11 || buf[0] != MHT_SAVE_ID || buf[1] != MHT_SAVE_VER ||
+		buf[2] > 16)
+		return ERR_BAD_FORMAT;
+	alg = (size_t)buf[2] * 16;
+	for (size = 0, i = 8; i--;)
+	{
+		if (i >= O_PER_S && buf[3 + i])
+			return ERR_BAD_FORMAT;
+		if (i < O_PER_S)
+			size = size << 4 << 4 | buf[3 + i];
+	}
+	// проверить длину
+	for (pos = 11, i = 0; i < B_PER_S; ++i)
+		if ((size >> i) & 1)
+			pos += mhtHashLen(alg);
+	if (pos != count)
+		return ERR_BAD_FORMAT;
+	// восстановить
+	memSetZero(st, sizeof(mht_st));
+	st->alg = alg, st->hlen = mhtHashLen(alg), st->size = size;
+	for (pos = 11, i = 0; i < B_PER_S; ++i)
+		if ((size >> i) & 1)
+		{
+			memCopy(st->f[i], buf + pos, st->hlen);
+			pos += st->hlen;
+		}
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Доказательства
+
+Правила PATH и PROOF (RFC 9162) раскрываются сверху вниз: на каждом шаге
+дерево из n листьев делится на левое поддерево из k листьев, где k --
+наибольшая степень двойки, меньшая n, и правое поддерево. Одно из
+поддеревьев содержит искомый лист (границу префикса), корень другого
+становится элементом доказательства. Элементы доказательства следуют
+снизу вверх, поэтому найденные сверху вниз поддеревья записываются в
+обратном порядке.
+
+Проверка доказательств выполняется по алгоритмам RFC 9162, 2.1.3.2,
+2.1.4.2.
+*******************************************************************************
+*/
+
+static size_t mhtSplit(size_t n)
+{
+	size_t k = 1;
+	ASSERT(n > 1);
+	while (k < n - k)
+		k <<= 1;
+	return k;
+}
+
+err_t mhtProve(octet proof[], size_t* len, size_t alg, const octet leaves[],
+	size_t n, size_t index)
+{
+	size_t off[B_PER_S];
+	size_t cnt[B_PER_S];
+	size_t hlen, d, j, k;
+	size_t pos = 0;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	hlen = mhtHashLen(alg);
+	if (index >= n || n > SIZE_MAX / hlen ||
+		!memIsValid(leaves, n * hlen) || !memIsValid(len, O_PER_S))
+		return ERR_BAD_INPUT;
+	// найти поддеревья
+	for (d = 0; n > 1; ++d)
+	{
+		ASSERT(d < B_PER_S);
+		k = mhtSplit(n);
+		if (index < k)
+			off[d] = pos + k, cnt[d] = n - k, n = k;
+		else
+			off[d] = pos, cnt[d] = k, pos += k, index -= k, n -= k;
+	}
+	*len = d;
+	if (proof == 0)
+		return ERR_OK;
+	if (!memIsValid(proof, d * hlen))
+		return ERR_BAD_INPUT;
+	// вычислить корни поддеревьев
+	for (j = 0; j < d && code == ERR_OK; ++j)
+		code = mhtMTH(proof + (d - 1 - j) * hlen, alg, leaves + off[j] * hlen,
+			cnt[j]);
+	return code;
+}
+
+err_t mhtVerify(size_t alg, const octet root[], size_t n, size_t index,
+	const octet leaf[], const octet proof[], size_t len)
+{
+	octet r[MHT_HASH_MAX];
+	size_t hlen, fn, sn;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	hlen = mhtHashLen(alg);
+	if (index >= n || len > B_PER_S + 1 ||
+		!memIsValid(root, hlen) || !memIsValid(leaf, hlen) ||
+		!memIsValid(proof, len * hlen))
+		return ERR_BAD_INPUT;
+	// подняться к корню
+	memCopy(r, leaf, hlen);
+	for (fn = index, sn = n - 1; len-- && code == ERR_OK; proof += hlen)
+	{
+		if (sn == 0)
+		{
+			code = ERR_BAD_HASH;
+			break;
+		}
+		if ((fn & 1) || fn == sn)
+		{
+			code = mhtNode(r, alg, proof, r);
+			while (!(fn & 1) && fn)
+				fn >>= 1, sn >>= 1;
+		}
+		else
+			code = mhtNode(r, alg, r, proof);
+		fn >>= 1, sn >>= 1;
+	}
+	// сравнить
+	if (code == ERR_OK && (sn != 0 || !memEq(r, root, hlen)))
+		code = ERR_BAD_HASH;
+	memWipe(r, sizeof(r));
+	return code;
+}
+
+err_t mhtProveC(octet proof[], size_t* len, size_t alg,
+	const octet leaves[], size_t n, size_t m)
+{
+	size_t off[B_PER_S + 1];
+	size_t cnt[B_PER_S + 1];
+	size_t hlen, d, j, k;
+	size_t pos = 0;
+	bool_t whole = TRUE;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	hlen = mhtHashLen(alg);
+	if (m == 0 || m > n || n > SIZE_MAX / hlen ||
+		!memIsValid(leaves, n * hlen) || !memIsValid(len, O_PER_S))
+		return ERR_BAD_INPUT;
+	// найти поддеревья
+	for (d = 0; m != n; ++d)
+	{
+		ASSERT(d < B_PER_S);
+		k = mhtSplit(n);
+		if (m <= k)
+			off[d] = pos + k, cnt[d] = n - k, n = k;
+		else
+			off[d] = pos, cnt[d] = k, pos += k, m -= k, n -= k,
+				whole = FALSE;
+	}
+	// префикс не является левым поддеревом: добавить его корень
+	if (d && !whole)
+		off[d] = pos, cnt[d] = n, ++d;
+	*len = d;
+	if (proof == 0)
+		return ERR_OK;
+	if (!memIsValid(proof, d * hlen))
+		return ERR_BAD_INPUT;
+	// вычислить корни поддеревьев
+	for (j = 0; j < d && code == ERR_OK; ++j)
+		code = mhtMTH(proof + (d - 1 - j) * hlen, alg, leaves + off[j] * hlen,
+			cnt[j]);
+	return code;
+}
+
+err_t mhtVerifyC(size_t alg, const octet root_m[], size_t m,
+	const octet root_n[], size_t n, const octet proof[], size_t len)
+{
+	octet fr[MHT_HASH_MAX];
+	octet sr[MHT_HASH_MAX];
+	size_t hlen, fn, sn;
+	err_t code = ERR_OK;
+	// проверить входные данные
+	if (!mhtAlgIsValid(alg))
+		return ERR_BAD_PARAMS;
+	hlen = mhtHashLen(alg);
+	if (m == 0 || m > n || len > B_PER_S + 1 ||
+		!memIsValid(root_m, hlen) || !memIsValid(root_n, hlen) ||
+		!memIsValid(proof, len * hlen))
+		return ERR_BAD_INPUT;
+	// одинаковые деревья?
+	if (m == n)
+		return len == 0 && memEq(root_m, root_n, hlen) ? ERR_OK :
+			ERR_BAD_HASH;
+	if (len == 0)
+		return ERR_BAD_HASH;
+	// m -- степень двойки: первым элементом считается root_m
+	if ((m & (m - 1)) == 0)
+		memCopy(fr, root_m, hlen);
+	else
+		memCopy(fr, proof, hlen), proof += hlen, --len;
+	memCopy(sr, fr, hlen);
+	// пропустить общие правые ветви
+	for (fn = m - 1, sn = n - 1; fn & 1;)
+		fn >>= 1, sn >>= 1;
+	// подняться к корням
+	for (; len-- && code == ERR_OK; proof += hlen)
+	{
+		if (sn == 0)
+		{
+			code = ERR_BAD_HASH;
+			break;
+		}
+		if ((fn & 1) || fn == sn)
+		{
+			code = mhtNode(fr, alg, proof, fr);
+			if (code == ERR_OK)
+				code = mhtNode(sr, alg, proof, sr);
+			while (!(fn & 1) && fn)
+				fn >>= 1, sn >>= 1;
+		}
+		else
+			code = mhtNode(sr, alg, sr, proof);
+		fn >>= 1, sn >>= 1;
+	}
+	// сравнить
+	if (code == ERR_OK && (sn != 0 || !memEq(fr, root_m, hlen) ||
+		!memEq(sr, root_n, hlen)))
+		code = ERR_BAD_HASH;
+	memWipe(fr, sizeof(fr));
+	memWipe(sr, sizeof(sr));
+	return code;
+}
@@ -4,7 +4,7 @@
 \brief Draft of RD_RB: key establishment protocols in finite fields
 \project bee2 [cryptographic library]
 \created 2014.07.01
-\version 2020.11.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,10 +13,13 @@
 #include "bee2/core/blob.h"
 #include "bee2/core/err.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/obj.h"
 #include "bee2/core/prng.h"
 #include "bee2/core/str.h"
 #include "bee2/core/util.h"
 #include "bee2/crypto/pfok.h"
+#include "crypto/pfok_lcl.h"
 #include "bee2/math/pri.h"
 #include "bee2/math/zm.h"
 #include "bee2/math/ww.h"
@@ -403,6 +406,19 @@ err_t pfokStdParams(pfok_params* params, pfok_seed* seed, const char* name)
 	return ERR_FILE_NOT_FOUND;
 }
 
+static bool_t pfokIsStdParams(const pfok_params* params)
+{
+	if (params->l == _bdh_params3_l)
+		return params->r == _bdh_params3_r &&
+			memEq(params->p, _bdh_params3_p, sizeof(_bdh_params3_p)) &&
+			memEq(params->g, _bdh_params3_g, sizeof(_bdh_params3_g));
+	if (params->l == _bdh_params6_l)
+		return params->r == _bdh_params6_r &&
+			memEq(params->p, _bdh_params6_p, sizeof(_bdh_params6_p)) &&
+			memEq(params->g, _bdh_params6_g, sizeof(_bdh_params6_g));
+	return FALSE;
+}
+
 /*
 *******************************************************************************
 Работоспособные параметры?
@@ -461,144 +477,260 @@ static bool_t pfokIsOperableParams(const pfok_params* params)
 Проверка примитивности g:
 g^(q) \neq e => g^(q) == - e
 g^(2) \neq e => g == e или g == -e
+
+Генерация выполняется пошагово (функции pfokGenParamsStart(),
+pfokGenParamsStep()). Переменные основного цикла (номер i строящегося
+простого цепочки, смещение offset этого простого в массиве qi, число
+кандидатов num) хранятся в состоянии pfok_gen_st. Шаг выполняет одну
+итерацию основного цикла: строит одно простое цепочки (одним вызовом
+priNextPrimeW() или priExtendPrimeMT()), а если построено q = q_0,
+то дополнительно проверяет простоту p = 2q + 1. После построения p
+каждый шаг проверяет одного кандидата g. Результат пошаговой генерации
+совпадает с результатом pfokGenParams().
 *******************************************************************************
 */
 
-err_t pfokGenParams(pfok_params* params, const pfok_seed* seed, 
-	pfok_on_q_i on_q)
+typedef struct
+{
+	pfok_params params[1];	/*< строящиеся параметры */
+	u32 lt[20];				/*< цепочка lt[i] */
+	pfok_on_q_i on_q;		/*< обработчик */
+	size_t threads;			/*< число потоков */
+	size_t top;				/*< номер последнего (минимального) простого */
+	size_t chain;			/*< длина цепочки qi в машинных словах */
+	size_t i;				/*< номер строящегося простого */
+	size_t offset;			/*< смещение qi[i] в машинных словах */
+	size_t num;				/*< число построенных кандидатов q */
+	size_t stage;			/*< этап: 0 -- p, 1 -- g, 2 -- завершено */
+	octet stack[];			/*< [] состояние prngSTB, qi, p, qr, стек */
+} pfok_gen_st;
+
+static bool_t pfokGenChain(size_t* pos, size_t* top, size_t* chain,
+	const u32 lt[20])
 {
-	size_t num = 0;
 	size_t i;
-	size_t no, n;
-	size_t offset;
+	// найти l = lt[0] + 1
+	for (i = 0; i < COUNT_OF(_ls); ++i)
+		if (lt[0] == _ls[i] - 1)
+			break;
+	if (i == COUNT_OF(_ls))
+		return FALSE;
+	*pos = i;
+	// проверить цепочку
+	for (i = 1, *chain = W_OF_B(lt[0]); i < 20 && lt[i] > 32; ++i)
+	{
+		if (lt[i - 1] > 2 * lt[i] || 5 * lt[i] + 16 >= 4 * lt[i - 1])
+			return FALSE;
+		*chain += W_OF_B(lt[i]);
+	}
+	if (i == 20 || lt[i] <= 16)
+		return FALSE;
+	*top = i, *chain += W_OF_B(lt[i]);
+	return TRUE;
+}
+
+static size_t pfokGenParams_deep(size_t l, size_t lt0, size_t threads)
+{
+	const size_t no = O_OF_B(l);
+	const size_t n = W_OF_B(l);
+	return utilMax(6,
+		priNextPrimeW_deep(),
+		priExtendPrimeMT_deep(l, n, (lt0 + 3) / 4, threads),
+		priIsSieved_deep((lt0 + 3) / 4),
+		priIsSGPrime_deep(n),
+		zmMontCreate_deep(no),
+		qrPower_deep(n, n, zmMontCreate_deep(no)));
+}
+
+size_t pfokGenParams_keep(const pfok_seed* seed, size_t threads)
+{
+	size_t pos, top, chain;
+	size_t l;
+	ASSERT(memIsValid(seed, sizeof(pfok_seed)));
+	if (!pfokGenChain(&pos, &top, &chain, seed->lt))
+		return sizeof(pfok_gen_st);
+	l = _ls[pos];
+	return sizeof(pfok_gen_st) + prngSTB_keep() + O_OF_W(chain) +
+		O_OF_W(W_OF_B(l)) + zmMontCreate_keep(O_OF_B(l)) +
+		pfokGenParams_deep(l, seed->lt[0], threads);
+}
+
+err_t pfokGenParamsStart(void* state, const pfok_seed* seed,
+	pfok_on_q_i on_q, size_t threads)
+{
+	pfok_gen_st* st = (pfok_gen_st*)state;
+	size_t pos;
+	size_t i;
+	// проверить входные данные
+	if (!memIsValid(seed, sizeof(pfok_seed)) ||
+		!memIsValid(state, pfokGenParams_keep(seed, threads)))
+		return ERR_BAD_INPUT;
+	// проверить числа z[i]
+	for (i = 0; i < 31; ++i)
+		if (seed->z[i] == 0 || seed->z[i] >= 65257)
+			return ERR_BAD_PARAMS;
+	// проверить цепочку lt[i] и зафиксировать размерности
+	memSetZero(st, sizeof(pfok_gen_st));
+	if (!pfokGenChain(&pos, &st->top, &st->chain, seed->lt))
+		return ERR_BAD_PARAMS;
+	st->params->l = _ls[pos], st->params->r = _rs[pos], st->params->n = 256;
+	memCopy(st->lt, seed->lt, sizeof(st->lt));
+	st->on_q = on_q;
+	st->threads = threads;
+	// начать с последнего простого
+	st->i = st->top;
+	st->offset = st->chain - W_OF_B(st->lt[st->top]);
+	// запустить генератор
+	prngSTBStart(st->stack, seed->z);
+	return ERR_OK;
+}
+
+err_t pfokGenParamsStep(pfok_params* params, void* state)
+{
+	pfok_gen_st* st = (pfok_gen_st*)state;
 	const u32* lt;
-	// состояние 
-	void* state;
+	size_t no, n;
+	size_t i;
+	// состояние
 	octet* stb_state;
 	word* qi;
 	word* p;
 	word* g;
 	qr_o* qr;
 	void* stack;
-	// проверить указатели
+	// проверить входные данные
 	if (!memIsValid(params, sizeof(pfok_params)) ||
-		!memIsValid(seed, sizeof(pfok_seed)))
+		!memIsValid(state, sizeof(pfok_gen_st)) ||
+		st->stage > 2)
 		return ERR_BAD_INPUT;
-	// подготовить params
-	memSetZero(params, sizeof(pfok_params));
-	// проверить числа z[i]
-	for (i = 0; i < 31; ++i)
-		if (seed->z[i] == 0 || seed->z[i] >= 65257)
-			return ERR_BAD_PARAMS;
-	// проверить цепочку lt[i] и одновременно зафиксировать размерности
-	for (i = 0, lt = seed->lt; i < COUNT_OF(_ls); ++i)
-		if (lt[0] == _ls[i] - 1)
-			break;
-	if (i == COUNT_OF(_ls))
-		return ERR_BAD_PARAMS;
-	params->l = _ls[i], params->r = _rs[i], params->n = 256;
-	for (i = 1, offset = W_OF_B(lt[0]); lt[i] > 32; ++i)
+	// генерация завершена?
+	if (st->stage == 2)
 	{
-		if (lt[i - 1] > 2 * lt[i] || 5 * lt[i] + 16 >= 4 * lt[i - 1])
-			return ERR_BAD_PARAMS;
-		offset += W_OF_B(lt[i]);
+		memCopy(params, st->params, sizeof(pfok_params));
+		return ERR_OK;
 	}
-	ASSERT(lt[i] > 16);
 	// размерности
-	no = O_OF_B(params->l), n = W_OF_B(params->l);
-	// создать состояние
-	state = blobCreate(
-		prngSTB_keep() + O_OF_W(offset) + O_OF_B(lt[i]) + 
-		O_OF_W(n) +	zmMontCreate_keep(no) +
-		utilMax(6,
-			priNextPrimeW_deep(),
-			priExtendPrime_deep(params->l, n, (lt[0] + 3) / 4),
-			priIsSieved_deep((lt[0] + 3) / 4),
-			priIsSGPrime_deep(n),
-			zmMontCreate_deep(no), 
-			qrPower_deep(n, n, zmMontCreate_deep(no))));
-	if (state == 0)
-		return ERR_OUTOFMEMORY;
+	lt = st->lt, i = st->i;
+	no = O_OF_B(st->params->l), n = W_OF_B(st->params->l);
 	// раскладка состояния
-	stb_state = (octet*)state;
+	stb_state = st->stack;
 	qi = (word*)(stb_state + prngSTB_keep());
-	p = qi + offset + W_OF_B(lt[i]);
+	p = qi + st->chain;
 	qr = (qr_o*)(p + n);
 	stack = (octet*)qr + zmMontCreate_keep(no);
-	// запустить генератор
-	prngSTBStart(stb_state, seed->z);
-	// основной цикл
-	while (1)
+	// построение g: проверить очередного кандидата
+	if (st->stage == 1)
 	{
-		// первое (минимальное) простое?
-		if (lt[i] <= 32)
+		g = qi + W_OF_B(lt[0]);
+		// g <- g + 1
+		for (i = 0; i < no && ++st->params->g[i] == 0;);
+		// p <- g^(q) [p == e или p == -e]
+		qrFrom(g, st->params->g, qr, stack);
+		FAST(qrPower)(p, g, qi, W_OF_B(lt[0]), qr, stack);
+		if (qrIsUnity(p, qr) || qrIsUnity(g, qr) || qrCmp(p, g, qr) == 0)
+			return ERR_NOT_READY;
+		st->stage = 2;
+		memCopy(params, st->params, sizeof(pfok_params));
+		return ERR_OK;
+	}
+	// первое (минимальное) простое?
+	if (lt[i] <= 32)
+	{
+		do
+		{
+			prngSTBStepR(qi + st->offset, O_OF_B(lt[i]), stb_state);
+			wwFrom(qi + st->offset, qi + st->offset, O_OF_B(lt[i]));
+			wwTrimHi(qi + st->offset, W_OF_B(lt[i]), lt[i] - 1);
+			wwSetBit(qi + st->offset, lt[i] - 1, 1);
+		}
+		while (!priNextPrimeW(qi + st->offset, qi[st->offset], stack));
+		// к следующему простому
+		st->offset -= W_OF_B(lt[--st->i]);
+	}
+	// обычное простое
+	else
+	{
+		size_t trials = (i == 0) ? 4 * lt[i] * lt[i] : 4 * lt[i];
+		size_t base_count = (lt[i] + 3) / 4;
+		// потенциальное отступление от Проекта, не влияющее на результат
+		if (base_count > priBaseSize())
+			base_count = priBaseSize();
+		// не удается построить новое простое?
+		if (!priExtendPrimeMT(qi + st->offset, lt[i],
+				qi + st->offset + W_OF_B(lt[i]), W_OF_B(lt[i + 1]),
+				trials, base_count, st->threads, prngSTBStepR, stb_state,
+				stack))
+		{
+			// к предыдущему простому
+			st->offset += W_OF_B(lt[st->i++]);
+			return ERR_NOT_READY;
+		}
+		// не последнее простое?
+		if (i > 0)
 		{
-			do
-			{
-				prngSTBStepR(qi + offset, O_OF_B(lt[i]), stb_state);
-				wwFrom(qi + offset, qi + offset, O_OF_B(lt[i]));
-				wwTrimHi(qi + offset, W_OF_B(lt[i]), lt[i] - 1);
-				wwSetBit(qi + offset, lt[i] - 1, 1);
-			}
-			while (!priNextPrimeW(qi + offset, qi[offset], stack));
 			// к следующему простому
-			offset -= W_OF_B(lt[--i]);
+			st->offset -= W_OF_B(lt[--st->i]);
+			return ERR_NOT_READY;
 		}
-		// обычное простое
-		else
+		// обработать нового кандидата
+		++st->num;
+		if (st->on_q)
+			st->on_q(qi, W_OF_B(lt[0]), st->num);
+		// p <- 2q_0 + 1
+		ASSERT(W_OF_B(lt[0]) == n);
+		wwCopy(p, qi, n);
+		wwShHi(p, n, 1);
+		p[0] |= 1;
+		// p -- простое?
+		if (priIsSieved(p, n, base_count, stack) &&
+			priIsSGPrime(qi, n, stack))
 		{
-			size_t trials = (i == 0) ? 4 * lt[i] * lt[i] : 4 * lt[i];
-			size_t base_count = (lt[i] + 3) / 4;
-			// потенциальное отступление от Проекта, не влияющее на результат
-			if (base_count > priBaseSize())
-				base_count = priBaseSize();
-			// не удается построить новое простое?
-			if (!priExtendPrime(qi + offset, lt[i], 
-					qi + offset + W_OF_B(lt[i]), W_OF_B(lt[i + 1]), 
-					trials, base_count, prngSTBStepR, stb_state, stack))
-			{
-				// к предыдущему простому
-				offset += W_OF_B(lt[i++]);
-				continue;
-			}
-			// не последнее простое?
-			if (i > 0)
-			{
-				// к следующему простому
-				offset -= W_OF_B(lt[--i]);
-				continue;
-			}
-			// обработать нового кандидата
-			on_q ? on_q(qi, W_OF_B(lt[0]), ++num) : 0;
-			// p <- 2q_0 + 1
-			ASSERT(W_OF_B(lt[0]) == n);
-			wwCopy(p, qi, n);
-			wwShHi(p, n, 1);
-			p[0] |= 1;
-			// p -- простое?
-			if (priIsSieved(p, n, base_count, stack) && 
-				priIsSGPrime(qi, n, stack))
-				break;
+			// сохранить p
+			wwTo(st->params->p, no, p);
+			// построить кольцо Монтгомери
+			zmMontCreate(qr, st->params->p, no, st->params->l + 2, stack);
+			// к построению g
+			st->stage = 1;
 		}
 	}
-	// сохранить p
-	wwTo(params->p, no, p);
-	// построить кольцо Монтгомери
-	zmMontCreate(qr, params->p, no, params->l + 2, stack);
-	// сгенерировать g
-	g = qi + W_OF_B(lt[0]);
-	do
-	{
-		// g <- g + 1
-		for (i = 0; i < no && ++params->g[i] == 0;);
-		// p <- g^(q) [p == e или p == -e]
-		qrFrom(g, params->g, qr, stack);
-		qrPower(p, g, qi, W_OF_B(lt[0]), qr, stack);
-	}
-	while (qrIsUnity(p, qr) || qrIsUnity(g, qr) || qrCmp(p, g, qr) == 0);
-	// все нормально
+	return ERR_NOT_READY;
+}
+
+size_t pfokGenParamsNum(const void* state)
+{
+	const pfok_gen_st* st = (const pfok_gen_st*)state;
+	ASSERT(memIsValid(st, sizeof(pfok_gen_st)));
+	return st->num;
+}
+
+err_t pfokGenParamsMT(pfok_params* params, const pfok_seed* seed, 
+	pfok_on_q_i on_q, size_t threads)
+{
+	err_t code;
+	void* state;
+	// проверить указатели
+	if (!memIsValid(params, sizeof(pfok_params)) ||
+		!memIsValid(seed, sizeof(pfok_seed)))
+		return ERR_BAD_INPUT;
+	// подготовить params
+	memSetZero(params, sizeof(pfok_params));
+	// создать состояние
+	state = blobCreate(pfokGenParams_keep(seed, threads));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// генерация
+	code = pfokGenParamsStart(state, seed, on_q, threads);
+	if (code == ERR_OK)
+		while ((code = pfokGenParamsStep(params, state)) == ERR_NOT_READY);
+	// завершение
 	blobClose(state);
-	return ERR_OK;
+	return code;
+}
+
+err_t pfokGenParams(pfok_params* params, const pfok_seed* seed, 
+	pfok_on_q_i on_q)
+{
+	return pfokGenParamsMT(params, seed, on_q, 1);
 }
 
 err_t pfokValParams(const pfok_params* params)
@@ -650,7 +782,7 @@ err_t pfokValParams(const pfok_params* params)
 	zmMontCreate(qr, params->p, no, params->l + 2, stack);
 	// проверить g
 	qrFrom(g, params->g, qr, stack);
-	qrPower(p, g, p, W_OF_B(params->l - 1), qr, stack);
+	FAST(qrPower)(p, g, p, W_OF_B(params->l - 1), qr, stack);
 	if (qrIsUnity(p, qr) || qrIsUnity(g, qr) || qrCmp(p, g, qr) == 0)
 	{
 		blobClose(state);
@@ -664,9 +796,14 @@ err_t pfokValParams(const pfok_params* params)
 /*
 *******************************************************************************
 Управление ключами
+
+Если для params удается найти (построить) контекст в кэше (см. далее),
+то степени g определяются по таблице предвычислений контекста.
 *******************************************************************************
 */
 
+static const void* pfokCacheGet(const pfok_params* params);
+
 err_t pfokGenKeypair(octet privkey[], octet pubkey[], 
 	const pfok_params* params, gen_i rng, void* rng_state)
 {
@@ -678,6 +815,7 @@ err_t pfokGenKeypair(octet privkey[], octet pubkey[],
 	word* y;				/* [n] открытый ключ */
 	qr_o* qr;				/* описание кольца Монтгомери */
 	void* stack;
+	const void* ctx;
 	// проверить params
 	if (!memIsValid(params, sizeof(pfok_params)))
 		return ERR_BAD_INPUT;
@@ -690,6 +828,9 @@ err_t pfokGenKeypair(octet privkey[], octet pubkey[],
 	// проверить остальные входные данные
 	if (!memIsValid(privkey, mo) || !memIsValid(pubkey, no) || rng == 0)
 		return ERR_BAD_INPUT;
+	// есть контекст?
+	if ((ctx = pfokCacheGet(params)) != 0)
+		return pfokCtxGenKeypair(privkey, pubkey, ctx, rng, rng_state);
 	// создать состояние
 	state = blobCreate(
 		O_OF_W(n) + O_OF_W(m) + zmMontCreate_keep(no) +  
@@ -752,6 +893,7 @@ err_t pfokCalcPubkey(octet pubkey[], const pfok_params* params,
 	word* y;				/* [n] открытый ключ */
 	qr_o* qr;				/* описание кольца Монтгомери */
 	void* stack;
+	const void* ctx;
 	// проверить params
 	if (!memIsValid(params, sizeof(pfok_params)))
 		return ERR_BAD_INPUT;
@@ -764,6 +906,9 @@ err_t pfokCalcPubkey(octet pubkey[], const pfok_params* params,
 	// проверить остальные входные данные
 	if (!memIsValid(privkey, mo) || !memIsValid(pubkey, no))
 		return ERR_BAD_INPUT;
+	// есть контекст?
+	if ((ctx = pfokCacheGet(params)) != 0)
+		return pfokCtxCalcPubkey(pubkey, ctx, privkey);
 	// создать состояние
 	state = blobCreate(
 		O_OF_W(n) + O_OF_W(m) + zmMontCreate_keep(no) +  
@@ -796,6 +941,352 @@ err_t pfokCalcPubkey(octet pubkey[], const pfok_params* params,
 	return ERR_OK;
 }
 
+/*
+*******************************************************************************
+Контекст
+
+Таблица предвычислений для g строится с шириной гребня PFOK_COMB_W = 6
+и содержит 64 элемента B_p. При l = 2942 таблица занимает около 23 Кбайт.
+При r = 240 для возведения в степень требуется 39 возведений в квадрат 
+и 39 умножений против 252 возведений в квадрат и 77 умножений
+в SAFE(qrPower).
+
+Для стандартных параметров bdh-params3 и bdh-params6 таблица 
+не строится: контекст ссылается на готовую таблицу в памяти только для 
+чтения (см. pfokStdPre()). Готовая таблица -- внешняя ссылка объекта 
+(см. obj.h), она не входит в контекст и разделяется всеми процессами.
+*******************************************************************************
+*/
+
+#define PFOK_COMB_W 6
+
+typedef struct
+{
+	obj_hdr_t hdr;			/*!< заголовок */
+// ptr_table {
+	qr_o* qr;				/*!< описание кольца Монтгомери */
+	const word* pre;		/*!< таблица предвычислений для g */
+// }
+	size_t l;				/*!< битовая длина p */
+	size_t r;				/*!< битовая длина личного ключа */
+	octet descr[];			/*!< память для размещения данных */
+} pfok_ctx;
+
+size_t pfokCtx_keep(size_t l)
+{
+	return sizeof(pfok_ctx) + qrCombPrec_keep(W_OF_B(l), PFOK_COMB_W) +
+		zmMontCreate_keep(O_OF_B(l));
+}
+
+err_t pfokCtxStart(void* ctx, const pfok_params* params)
+{
+	size_t no, n;
+	const word* pre;
+	// состояние
+	void* state;
+	qr_o* qr;				/* описание кольца Монтгомери */
+	word* g;				/* [n] образующий */
+	void* stack;
+	pfok_ctx* c = (pfok_ctx*)ctx;
+	// проверить params
+	if (!memIsValid(params, sizeof(pfok_params)))
+		return ERR_BAD_INPUT;
+	// работоспособные параметры?
+	if (!pfokIsOperableParams(params))
+		return ERR_BAD_PARAMS;
+	// проверить ctx
+	if (!memIsValid(ctx, pfokCtx_keep(params->l)))
+		return ERR_BAD_INPUT;
+	// размерности
+	no = O_OF_B(params->l), n = W_OF_B(params->l);
+	// создать состояние
+	state = blobCreate(
+		zmMontCreate_keep(no) + O_OF_W(n) +
+		utilMax(2,
+			zmMontCreate_deep(no),
+			qrCombPrec_deep(n, zmMontCreate_deep(no))));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка состояния
+	qr = (qr_o*)state;
+	g = (word*)((octet*)qr + zmMontCreate_keep(no));
+	stack = g + n;
+	// построить кольцо Монтгомери
+	zmMontCreate(qr, params->p, no, params->l + 2, stack);
+	// стандартные параметры с готовой таблицей?
+	pre = pfokIsStdParams(params) ? pfokStdPre(params->l) : 0;
+	// подготовить контекст
+	c->hdr.keep = sizeof(pfok_ctx);
+	if (!pre)
+		c->hdr.keep += qrCombPrec_keep(n, PFOK_COMB_W);
+	c->hdr.p_count = 2;
+	c->hdr.o_count = 1;
+	c->qr = qr;
+	c->pre = pre ? pre : (const word*)c->descr;
+	c->l = params->l;
+	c->r = params->r;
+	// перенести описание кольца в контекст
+	ASSERT(objKeep(c) + objKeep(qr) <= pfokCtx_keep(params->l));
+	objAppend(c, qr, 0);
+	// построить таблицу предвычислений
+	if (!pre)
+	{
+		wwFrom(g, params->g, no);
+		qrCombPrec((word*)c->descr, g, c->r, PFOK_COMB_W, c->qr, stack);
+	}
+	// завершение
+	blobClose(state);
+	return ERR_OK;
+}
+
+static bool_t pfokCtxIsOperable(const void* ctx)
+{
+	const pfok_ctx* c = (const pfok_ctx*)ctx;
+	return memIsValid(c, sizeof(pfok_ctx)) &&
+		objPCount(c) == 2 && objOCount(c) == 1 &&
+		objIsOperable(c) &&
+		qrIsOperable(c->qr) &&
+		c->qr->n == W_OF_B(c->l) &&
+		wwIsValid(c->pre, c->qr->n << PFOK_COMB_W);
+}
+
+static void pfokCtxClone(void* dest, const void* ctx)
+{
+	const pfok_ctx* c = (const pfok_ctx*)ctx;
+	pfok_ctx* d = (pfok_ctx*)dest;
+	const size_t n = c->qr->n;
+	ASSERT(pfokCtxIsOperable(ctx));
+	ASSERT(memIsValid(dest, pfokCtx_keep(c->l)));
+	// заголовок и таблица
+	d->hdr.keep = sizeof(pfok_ctx) + qrCombPrec_keep(n, PFOK_COMB_W);
+	d->hdr.p_count = 2;
+	d->hdr.o_count = 1;
+	d->qr = c->qr;
+	d->pre = (const word*)d->descr;
+	d->l = c->l;
+	d->r = c->r;
+	wwCopy((word*)d->descr, c->pre, n << PFOK_COMB_W);
+	// описание кольца
+	objAppend(d, c->qr, 0);
+}
+
+err_t pfokCtxRepsStart(void* reps, const void* ctx)
+{
+	if (!pfokCtxIsOperable(ctx) || !memIsValid(reps, objReps_keep()))
+		return ERR_BAD_INPUT;
+	objRepsStart(reps, ctx, pfokCtx_keep(((const pfok_ctx*)ctx)->l),
+		pfokCtxClone);
+	return ERR_OK;
+}
+
+err_t pfokCtxGenKeypair(octet privkey[], octet pubkey[], const void* ctx,
+	gen_i rng, void* rng_state)
+{
+	const pfok_ctx* c = (const pfok_ctx*)ctx;
+	size_t no, n;
+	size_t mo, m;
+	// состояние
+	void* state;
+	word* x;				/* [m] личный ключ */
+	word* y;				/* [n] открытый ключ */
+	void* stack;
+	// проверить ctx
+	if (!pfokCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// размерности
+	no = O_OF_B(c->l), n = W_OF_B(c->l);
+	mo = O_OF_B(c->r), m = W_OF_B(c->r);
+	// проверить остальные входные данные
+	if (!memIsValid(privkey, mo) || !memIsValid(pubkey, no) || rng == 0)
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(O_OF_W(n) + O_OF_W(m) +
+		qrCombPower_deep(n, c->qr->deep));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка состояния
+	x = (word*)state;
+	y = x + m;
+	stack = y + n;
+	// x <-R {0, 1,..., 2^r - 1}
+	rng(x, mo, rng_state);
+	wwFrom(x, x, mo);
+	wwTrimHi(x, m, c->r);
+	// y <- g^(x)
+	qrCombPower(y, c->pre, c->r, PFOK_COMB_W, x, m, c->qr, stack);
+	// выгрузить ключи
+	wwTo(privkey, mo, x);
+	qrTo(pubkey, y, c->qr, stack);
+	// все нормально
+	blobClose(state);
+	return ERR_OK;
+}
+
+err_t pfokCtxCalcPubkey(octet pubkey[], const void* ctx, 
+	const octet privkey[])
+{
+	const pfok_ctx* c = (const pfok_ctx*)ctx;
+	size_t no, n;
+	size_t mo, m;
+	// состояние
+	void* state;
+	word* x;				/* [m] личный ключ */
+	word* y;				/* [n] открытый ключ */
+	void* stack;
+	// проверить ctx
+	if (!pfokCtxIsOperable(ctx))
+		return ERR_BAD_INPUT;
+	// размерности
+	no = O_OF_B(c->l), n = W_OF_B(c->l);
+	mo = O_OF_B(c->r), m = W_OF_B(c->r);
+	// проверить остальные входные данные
+	if (!memIsValid(privkey, mo) || !memIsValid(pubkey, no))
+		return ERR_BAD_INPUT;
+	// создать состояние
+	state = blobCreate(O_OF_W(n) + O_OF_W(m) +
+		qrCombPower_deep(n, c->qr->deep));
+	if (state == 0)
+		return ERR_OUTOFMEMORY;
+	// раскладка состояния
+	x = (word*)state;
+	y = x + m;
+	stack = y + n;
+	// x <- privkey
+	wwFrom(x, privkey, mo);
+	if (wwGetBits(x, c->r, B_OF_W(m) - c->r) != 0)
+	{
+		blobClose(state);
+		return ERR_BAD_PRIVKEY;
+	}
+	// y <- g^(x)
+	qrCombPower(y, c->pre, c->r, PFOK_COMB_W, x, m, c->qr, stack);
+	// выгрузить открытый ключ
+	qrTo(pubkey, y, c->qr, stack);
+	// все нормально
+	blobClose(state);
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Кэш контекстов
+
+Функции pfokGenKeypair() и pfokCalcPubkey() при первом обращении с новыми
+параметрами строят для них контекст и сохраняют его в кэше _cache.
+Построение контекста занимает примерно столько же времени, сколько одно
+возведение g в степень в SAFE(qrPower), так что строить контекст выгодно
+уже со второго обращения. Параметры сравниваются по значению (l, r, p, g),
+поэтому кэш работает и для копий params.
+
+Кэш рассчитан на небольшое число наборов параметров (как правило,
+стандартных). Записи не вытесняются: когда кэш заполнен, функции
+возвращаются к вычислениям без контекста. Поэтому найденный контекст
+остается действительным до завершения программы и им можно пользоваться
+вне мьютекса (функции pfokCtxXXX() не изменяют контекст).
+
+Контексты содержат только открытые данные (описание кольца и степени g)
+и размещаются в памяти memAlloc(), а не в блобах. Память освобождается
+при завершении программы (см. utilOnExit()).
+
+Для каждого контекста ведется набор реплик (см. pfokCtxRepsStart()).
+Функции получают реплику узла NUMA вызывающего потока. На системах
+без NUMA реплика одна (для узла 0).
+*******************************************************************************
+*/
+
+#define PFOK_CACHE_SIZE 4
+
+typedef struct
+{
+	u32 l;					/*< битовая длина p */
+	u32 r;					/*< битовая длина личного ключа */
+	octet p[368];			/*< модуль p */
+	octet g[368];			/*< образующий g */
+	void* ctx;				/*< контекст */
+	void* reps;				/*< реплики контекста */
+} pfok_cache_entry;
+
+static size_t _once;		/*< триггер однократности */
+static mt_mtx_t _mtx[1];	/*< мьютекс */
+static bool_t _inited;		/*< мьютекс создан? */
+static pfok_cache_entry _cache[PFOK_CACHE_SIZE];	/*< кэш */
+
+static void pfokCacheDestroy()
+{
+	size_t i;
+	mtMtxLock(_mtx);
+	for (i = 0; i < PFOK_CACHE_SIZE; ++i)
+		if (_cache[i].ctx)
+		{
+			objRepsClose(_cache[i].reps);
+			memFree(_cache[i].reps), _cache[i].reps = 0;
+			memFree(_cache[i].ctx), _cache[i].ctx = 0;
+		}
+	mtMtxUnlock(_mtx);
+	mtMtxClose(_mtx);
+	_inited = FALSE;
+}
+
+static void pfokCacheInit()
+{
+	ASSERT(!_inited);
+	if (!mtMtxCreate(_mtx))
+		return;
+	if (!utilOnExit(pfokCacheDestroy))
+	{
+		mtMtxClose(_mtx);
+		return;
+	}
+	_inited = TRUE;
+}
+
+static const void* pfokCacheGet(const pfok_params* params)
+{
+	const size_t no = O_OF_B(params->l);
+	pfok_cache_entry* e;
+	size_t i;
+	ASSERT(pfokIsOperableParams(params));
+	// инициализировать однократно
+	if (!mtCallOnce(&_once, pfokCacheInit) || !_inited)
+		return 0;
+	mtMtxLock(_mtx);
+	// найти запись
+	for (i = 0; i < PFOK_CACHE_SIZE && _cache[i].ctx; ++i)
+	{
+		e = _cache + i;
+		if (e->l == params->l && e->r == params->r &&
+			memEq(e->p, params->p, no) && memEq(e->g, params->g, no))
+		{
+			mtMtxUnlock(_mtx);
+			return objRepsGet(e->reps);
+		}
+	}
+	// кэш заполнен?
+	if (i == PFOK_CACHE_SIZE)
+	{
+		mtMtxUnlock(_mtx);
+		return 0;
+	}
+	// построить контекст
+	e = _cache + i;
+	e->ctx = memAlloc(pfokCtx_keep(params->l));
+	e->reps = memAlloc(objReps_keep());
+	if (!e->ctx || !e->reps ||
+		pfokCtxStart(e->ctx, params) != ERR_OK ||
+		pfokCtxRepsStart(e->reps, e->ctx) != ERR_OK)
+	{
+		memFree(e->reps), e->reps = 0;
+		memFree(e->ctx), e->ctx = 0;
+		mtMtxUnlock(_mtx);
+		return 0;
+	}
+	e->l = params->l, e->r = params->r;
+	memCopy(e->p, params->p, no);
+	memCopy(e->g, params->g, no);
+	mtMtxUnlock(_mtx);
+	return objRepsGet(e->reps);
+}
+
 /*
 *******************************************************************************
 Протоколы
@@ -0,0 +1,40 @@
+/*
+*******************************************************************************
+\file pfok_lcl.h
+\brief Draft of RD_RB: local definitions
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifndef __BEE2_PFOK_LCL_H
+#define __BEE2_PFOK_LCL_H
+
+#include "bee2/crypto/pfok.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!	\brief Готовая таблица предвычислений
+
+	Возвращается таблица гребенчатого метода (ширина 6) для образующей
+	стандартных параметров с битовой длиной модуля l. Элементы таблицы
+	представлены в форме Монтгомери с R = 2^{l + 2}.
+	\return Указатель на таблицу или 0, если таблицы нет (другие 
+	параметры или порядок октетов big-endian).
+	\remark Таблица размещается в памяти только для чтения и может
+	использоваться в контекстах без копирования.
+*/
+const word* pfokStdPre(
+	size_t l				/*!< [in] битовая длина модуля */
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_PFOK_LCL_H */
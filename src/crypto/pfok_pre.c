@@ -0,0 +1,2634 @@
+/*
+*******************************************************************************
+\file pfok_pre.c
+\brief Draft of RD_RB: precomputed tables for standard parameters
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/util.h"
+#include "crypto/pfok_lcl.h"
+
+/*
+*******************************************************************************
+Таблицы предвычислений
+
+Таблицы гребенчатого метода (ширина 6, 64 элемента) для образующих 
+стандартных параметров bdh-params3 и bdh-params6. Элементы -- вычеты 
+в форме Монтгомери с R = 2^{l + 2} (little-endian). Поскольку l + 2 
+кратно 64, таблицы не зависят от длины машинного слова, но могут 
+использоваться только при OCTET_ORDER == LITTLE_ENDIAN. Для bdh-params10 
+таблица не приводится: она велика (около 20 Кбайт), а ее элементы 
+не укладываются в целое число 64-битовых слов без дополнения.
+
+Таблицы построены функцией qrCombPrec() и проверяются тестом pfokTest() 
+путем сравнения с заново рассчитанными таблицами (см. pfokTestStdPreTable() 
+в test/crypto/pfok_test.c). Выравнивание по границе слова обеспечивается 
+объединением с массивом слов.
+*******************************************************************************
+*/
+
+#if (OCTET_ORDER == LITTLE_ENDIAN)
+
+// bdh-params3
+static const union
+{
+	octet o[8192];
+	word w[1];
+} _bdh_params3_pre =
+{{
+	0x44, 0x86, 0x06, 0x39, 0xA3, 0xA8, 0x26, 0xA2,
+	0xEF, 0x01, 0xEB, 0x50, 0xC5, 0xE2, 0x60, 0x7E,
+	0x44, 0xF6, 0x86, 0x54, 0x4C, 0xF7, 0x05, 0x11,
+	0x02, 0x57, 0xD0, 0x4C, 0xEC, 0xA0, 0xE3, 0x6B,
+	0x62, 0x27, 0xED, 0x03, 0x65, 0x61, 0x6A, 0x4C,
+	0xDF, 0xB6, 0x98, 0x4F, 0x50, 0xF1, 0xA5, 0x37,
+	0xC2, 0xD2, 0x53, 0xFD, 0x9D, 0xBC, 0x63, 0x27,
+	0x8D, 0xFD, 0x21, 0x5D, 0x74, 0xAD, 0x53, 0xAD,
+	0xC5, 0x6F, 0xCF, 0xEB, 0x9F, 0x91, 0xF9, 0xD0,
+	0x46, 0xBC, 0xEB, 0x53, 0x63, 0xF4, 0x5C, 0x1E,
+	0x52, 0x59, 0x50, 0xB8, 0x62, 0xD3, 0x88, 0x65,
+	0xDD, 0x56, 0x06, 0x86, 0x8A, 0x86, 0x07, 0x20,
+	0x66, 0x6A, 0xE0, 0x45, 0x2E, 0x9F, 0x65, 0x2E,
+	0x6E, 0x06, 0x1F, 0xF5, 0xB2, 0x65, 0x70, 0xC4,
+	0x1E, 0x86, 0xBD, 0xD2, 0xCD, 0xCD, 0x41, 0xFD,
+	0x6D, 0x65, 0x26, 0x1C, 0xEB, 0xA0, 0xA7, 0x31,
+	0x69, 0x4D, 0x08, 0xFB, 0x1D, 0x37, 0x1A, 0x1B,
+	0x5C, 0xFB, 0x53, 0x95, 0xCD, 0x61, 0xCB, 0xE4,
+	0x2E, 0x88, 0xFB, 0xA5, 0xEE, 0x3C, 0xC6, 0x03,
+	0xFA, 0x45, 0x14, 0x99, 0x16, 0xB6, 0xCA, 0xD7,
+	0xA6, 0xEC, 0x80, 0x2F, 0x64, 0x0A, 0x7D, 0x7A,
+	0xEA, 0x41, 0x81, 0x6A, 0x02, 0x0C, 0x60, 0x9A,
+	0xE7, 0x2B, 0xF0, 0xC3, 0xC3, 0xE1, 0x7D, 0xD4,
+	0x13, 0x78, 0xEB, 0x85, 0xC2, 0xFF, 0xE6, 0xC7,
+	0x39, 0x5F, 0x46, 0x80, 0xB5, 0x56, 0x98, 0xAC,
+	0x25, 0xE7, 0xCE, 0x34, 0xA4, 0x49, 0x83, 0x54,
+	0xF3, 0xE6, 0x72, 0xC2, 0x8B, 0xE4, 0x8C, 0xCD,
+	0xD8, 0x4C, 0x82, 0x58, 0x1F, 0x54, 0x17, 0xFF,
+	0x6C, 0x5E, 0x06, 0x18, 0xC4, 0x80, 0x58, 0x67,
+	0x3B, 0xB5, 0x10, 0x0F, 0xA3, 0x11, 0x87, 0x69,
+	0xD8, 0xD3, 0xEE, 0xA2, 0xA0, 0xBC, 0x0D, 0x69,
+	0xC8, 0xFE, 0xDC, 0x50, 0xD3, 0x3A, 0x2A, 0x32,
+	0x15, 0x31, 0xEE, 0x4C, 0xA5, 0x05, 0xFF, 0xA9,
+	0x02, 0x14, 0xC5, 0x9C, 0x82, 0xA5, 0x1C, 0xA5,
+	0xEB, 0xC5, 0x9A, 0x91, 0xBF, 0xFF, 0x50, 0x58,
+	0x51, 0x4F, 0x72, 0xCA, 0xE5, 0x53, 0xE7, 0x6C,
+	0x5E, 0xDD, 0xEC, 0x42, 0x1D, 0xBE, 0xEB, 0x00,
+	0xC0, 0x30, 0x6D, 0x42, 0xF6, 0x2D, 0x61, 0x44,
+	0x1D, 0x5A, 0x8D, 0xE1, 0xDC, 0x5B, 0xB3, 0xC1,
+	0x0C, 0x4B, 0x4F, 0xCD, 0x62, 0x89, 0x59, 0xEC,
+	0x59, 0x89, 0x22, 0x97, 0xC2, 0x2A, 0x1A, 0x24,
+	0x64, 0x98, 0x32, 0x2B, 0x8B, 0x74, 0xC0, 0x90,
+	0x89, 0x7F, 0x26, 0x5E, 0x25, 0xAC, 0x5E, 0xA8,
+	0x7B, 0x43, 0xC2, 0x78, 0x68, 0x0F, 0x7A, 0x3E,
+	0xF6, 0x9B, 0xC1, 0x91, 0xAA, 0xF1, 0x8C, 0xED,
+	0xEE, 0xDF, 0xA1, 0x11, 0xDB, 0x7D, 0x5D, 0x58,
+	0x43, 0x93, 0x74, 0x57, 0xC7, 0xEC, 0xE1, 0xF7,
+	0x6A, 0x74, 0x6C, 0xE5, 0xBF, 0xCF, 0x8E, 0x30,
+	0x71, 0x05, 0x0D, 0x34, 0x5F, 0xBE, 0x36, 0xD8,
+	0x90, 0x5A, 0x24, 0x10, 0x03, 0xA2, 0x8C, 0xDA,
+	0x64, 0x7C, 0x40, 0x9E, 0xFB, 0xB0, 0x59, 0xF0,
+	0xCE, 0x17, 0x27, 0x9D, 0x68, 0xD8, 0x63, 0x7A,
+	0x51, 0x07, 0x9B, 0x7E, 0x74, 0xD2, 0x80, 0x4D,
+	0x8D, 0x61, 0x71, 0x29, 0x11, 0x26, 0x30, 0x22,
+	0x87, 0xD8, 0x32, 0x8A, 0x0A, 0xAC, 0xCC, 0x16,
+	0x09, 0x0D, 0x9F, 0x63, 0x1F, 0xBA, 0x6A, 0xC4,
+	0x80, 0x51, 0x5A, 0xF8, 0xB9, 0x48, 0xA5, 0x7A,
+	0xBF, 0x3D, 0xC5, 0x18, 0x31, 0x77, 0xFC, 0x57,
+	0x61, 0xE1, 0x56, 0xE3, 0xC6, 0xE0, 0x1B, 0xF7,
+	0x8B, 0xCE, 0x00, 0xCB, 0x25, 0x7C, 0x60, 0xB1,
+	0xEC, 0xB6, 0x35, 0x34, 0xBC, 0x83, 0x96, 0xDE,
+	0x9D, 0xA5, 0x85, 0x03, 0xFA, 0xB3, 0xCA, 0x1D,
+	0x7D, 0x55, 0x61, 0xDC, 0xD2, 0xBC, 0x1F, 0x1A,
+	0x5C, 0x08, 0xE9, 0x03, 0x34, 0x28, 0x59, 0x2C,
+	0x5D, 0xC9, 0x22, 0x2D, 0x0C, 0x5E, 0xA7, 0x34,
+	0x6C, 0x1F, 0xF8, 0x73, 0x00, 0x7E, 0xE2, 0x24,
+	0xBC, 0x69, 0xBE, 0xF6, 0x52, 0x5B, 0x41, 0x3B,
+	0xAE, 0x0B, 0xE4, 0xCA, 0x8A, 0xED, 0xB6, 0x6A,
+	0x0F, 0x54, 0x71, 0xB2, 0x90, 0xC5, 0xCE, 0xEC,
+	0x30, 0xE9, 0xDE, 0x3C, 0x05, 0x16, 0xF8, 0x08,
+	0x25, 0xF3, 0x1B, 0x84, 0xC9, 0xB4, 0x2A, 0x1E,
+	0x64, 0x4C, 0x11, 0x3F, 0xA4, 0xCF, 0x9D, 0x9D,
+	0x67, 0x0B, 0x63, 0x43, 0x31, 0xA4, 0x27, 0xEB,
+	0xD6, 0x20, 0x2F, 0x16, 0x93, 0xA6, 0x47, 0x1B,
+	0x20, 0x4E, 0xB8, 0x4B, 0x15, 0x8F, 0xDF, 0xE6,
+	0xA8, 0x69, 0x66, 0xF0, 0x17, 0x5F, 0x83, 0x05,
+	0xEF, 0x18, 0x9C, 0x93, 0xA7, 0xB0, 0xE4, 0xD3,
+	0x0A, 0xB8, 0x9C, 0x92, 0xA2, 0xA3, 0x0A, 0x2E,
+	0x48, 0x81, 0xF6, 0xFB, 0x82, 0x2C, 0xD5, 0x9A,
+	0x5A, 0x94, 0xA1, 0x5A, 0x45, 0x12, 0x3A, 0x2F,
+	0x95, 0xBB, 0x55, 0x6F, 0x1E, 0xEB, 0x7D, 0x52,
+	0x43, 0x79, 0x78, 0xB5, 0x15, 0xB8, 0x46, 0x69,
+	0x04, 0x20, 0xE2, 0x05, 0x76, 0x03, 0xAB, 0x7E,
+	0x3D, 0x31, 0x6A, 0xC8, 0xDF, 0x3B, 0xD8, 0x19,
+	0xEB, 0x0E, 0x90, 0xD8, 0x67, 0xF5, 0x1F, 0xDA,
+	0xA6, 0xCB, 0x2C, 0xF4, 0xF7, 0x4F, 0xE8, 0x53,
+	0x6B, 0x7E, 0x35, 0xE7, 0x6B, 0x73, 0x24, 0x84,
+	0xAD, 0xFF, 0x3D, 0x5C, 0x4C, 0xF4, 0x81, 0x44,
+	0xAD, 0x14, 0x52, 0xA8, 0xC8, 0xD1, 0xC4, 0x52,
+	0x18, 0x4F, 0xDD, 0xAA, 0x63, 0x74, 0x52, 0xB5,
+	0x13, 0x41, 0x26, 0xCF, 0x6F, 0x96, 0x90, 0x49,
+	0x51, 0x4F, 0xD1, 0xFB, 0xAA, 0x40, 0x50, 0x3E,
+	0xF2, 0x38, 0x6D, 0x54, 0x73, 0xC9, 0xB4, 0xC9,
+	0x67, 0xEF, 0x91, 0x23, 0xE1, 0x27, 0xC2, 0xF1,
+	0xDD, 0x7B, 0x3C, 0xB1, 0x45, 0x17, 0xD3, 0x7D,
+	0xFE, 0xFD, 0x56, 0x82, 0xD0, 0x56, 0xCB, 0x0F,
+	0x60, 0xD0, 0x8D, 0x4D, 0x99, 0x97, 0x23, 0x8C,
+	0xD8, 0x74, 0x56, 0x73, 0x04, 0x7A, 0xBE, 0xA7,
+	0x12, 0x10, 0x3A, 0xFC, 0x46, 0x20, 0xD8, 0x5B,
+	0x4C, 0x69, 0x2D, 0x03, 0xA8, 0xD9, 0x87, 0xBC,
+	0x78, 0xA9, 0xC3, 0x6D, 0x7C, 0x64, 0x88, 0xE8,
+	0x2B, 0xF9, 0x66, 0x7B, 0x32, 0x4D, 0x11, 0xAD,
+	0x5A, 0x1A, 0x01, 0xC2, 0xD2, 0x6C, 0x02, 0xAF,
+	0x37, 0x5F, 0x75, 0xDB, 0x3E, 0x1D, 0xD7, 0x75,
+	0xD5, 0x66, 0x27, 0x27, 0xC3, 0x9E, 0xC9, 0x17,
+	0x9E, 0x0E, 0x7B, 0x84, 0x1C, 0xF3, 0xA5, 0x92,
+	0x79, 0xC7, 0x9C, 0x28, 0x31, 0xBE, 0xCC, 0x00,
+	0xC8, 0x0C, 0xC8, 0xF2, 0xE4, 0x66, 0x4E, 0xAB,
+	0x56, 0x63, 0x30, 0xCD, 0xE4, 0xCD, 0xD1, 0x03,
+	0xE3, 0x74, 0xB5, 0x71, 0x4C, 0x72, 0x79, 0xEA,
+	0xEB, 0xDF, 0x5A, 0xA3, 0xA1, 0x45, 0xF9, 0x0C,
+	0x7D, 0x2F, 0x4A, 0x77, 0xA4, 0x65, 0xC1, 0x0A,
+	0xB8, 0x92, 0x34, 0x9C, 0x6B, 0x33, 0x89, 0x7E,
+	0x71, 0x8F, 0x41, 0x89, 0x82, 0x65, 0x11, 0x15,
+	0xBA, 0xF5, 0x8E, 0x52, 0x88, 0xB7, 0xAB, 0x14,
+	0x0D, 0x09, 0x7A, 0x2B, 0xE3, 0x9E, 0x81, 0xEA,
+	0x5F, 0xD5, 0x47, 0x6A, 0x3C, 0xDC, 0xAD, 0x64,
+	0xBF, 0x17, 0x90, 0xCD, 0xC3, 0xE3, 0x31, 0x27,
+	0x35, 0x5C, 0xCC, 0x59, 0x8A, 0xFF, 0x41, 0x95,
+	0xA5, 0x05, 0x3A, 0x1F, 0x15, 0xB0, 0x64, 0x03,
+	0x09, 0xDF, 0xE8, 0x9B, 0xAD, 0x88, 0xAE, 0xA7,
+	0x41, 0x30, 0x43, 0x3D, 0x67, 0x06, 0x44, 0x0C,
+	0xD8, 0x7B, 0x58, 0x4D, 0xDD, 0x21, 0x2C, 0x43,
+	0x38, 0x33, 0x49, 0x3F, 0x2A, 0x71, 0x50, 0xEC,
+	0xE8, 0x0D, 0x5F, 0xCD, 0xA8, 0x9D, 0x44, 0xCF,
+	0x8C, 0x63, 0x3B, 0xF7, 0x24, 0x06, 0xA9, 0xF5,
+	0x5A, 0x32, 0xA3, 0xAD, 0xB3, 0x8C, 0x79, 0xEE,
+	0x99, 0xEE, 0x60, 0x2C, 0x7E, 0x2F, 0x26, 0x21,
+	0x6F, 0x68, 0x9E, 0x94, 0xD4, 0x2A, 0xB3, 0x50,
+	0xE8, 0x15, 0x24, 0x37, 0xDB, 0x17, 0xDD, 0xCB,
+	0x63, 0xB9, 0x83, 0xDC, 0xD2, 0x3F, 0x42, 0x12,
+	0xAA, 0xD1, 0xF3, 0x11, 0xA3, 0x13, 0x97, 0x0C,
+	0xB4, 0x35, 0x99, 0xBA, 0x71, 0x41, 0xF8, 0x35,
+	0xD0, 0x7F, 0xA7, 0x56, 0xE3, 0xF0, 0x25, 0x11,
+	0xC9, 0xE5, 0x4E, 0x69, 0x22, 0x4F, 0xB8, 0xBA,
+	0x26, 0x56, 0x21, 0x11, 0x26, 0x29, 0xC1, 0x70,
+	0x33, 0xF1, 0x52, 0x8D, 0x3F, 0x5D, 0x24, 0x59,
+	0x1F, 0x37, 0xCD, 0x66, 0xDB, 0x9A, 0xB7, 0xD4,
+	0x74, 0x2D, 0xB8, 0x46, 0x48, 0x8F, 0x23, 0x8F,
+	0xDA, 0x89, 0x50, 0x93, 0x49, 0x71, 0x96, 0xA3,
+	0xA5, 0x69, 0xE8, 0x6D, 0xFA, 0x5F, 0x55, 0x04,
+	0x47, 0xF2, 0x6A, 0x52, 0xA7, 0x99, 0x39, 0x6B,
+	0xBA, 0x06, 0x09, 0x29, 0x77, 0x6E, 0x7B, 0x43,
+	0x3A, 0xA1, 0x5A, 0x7C, 0x7B, 0x15, 0x58, 0x13,
+	0x40, 0xC0, 0x34, 0x96, 0x31, 0xB1, 0xFD, 0x34,
+	0xEC, 0x79, 0x86, 0x8A, 0x64, 0xFF, 0x69, 0x66,
+	0xBA, 0x6C, 0xF8, 0xB0, 0x23, 0x2F, 0x72, 0xAC,
+	0xF3, 0x58, 0xF5, 0x06, 0xB4, 0xCD, 0xDA, 0xB6,
+	0x2C, 0xD0, 0x9D, 0xCE, 0x4C, 0xC7, 0x91, 0x4E,
+	0x4B, 0x8B, 0xE7, 0x47, 0x72, 0xBD, 0x50, 0x96,
+	0x18, 0x6D, 0xFD, 0xC5, 0x62, 0x75, 0x3B, 0x93,
+	0xBD, 0x46, 0x36, 0xCE, 0x55, 0x81, 0xEC, 0xCD,
+	0x4A, 0x70, 0xE8, 0x69, 0x91, 0x43, 0x2C, 0x7D,
+	0xA8, 0x4A, 0x3E, 0xEC, 0x45, 0xC5, 0xB4, 0x94,
+	0xBB, 0x3D, 0xEA, 0x00, 0xB0, 0x33, 0xE3, 0xE6,
+	0x98, 0xEB, 0x10, 0x39, 0x80, 0x44, 0x43, 0x9D,
+	0xF1, 0x7A, 0x3F, 0x97, 0xC9, 0x16, 0x2E, 0xE1,
+	0xD0, 0xEC, 0x06, 0x82, 0xD0, 0xDC, 0xCA, 0x7F,
+	0x1D, 0x5F, 0xF6, 0x38, 0xC5, 0xCB, 0x36, 0x92,
+	0x39, 0x80, 0x67, 0xA2, 0xF3, 0x91, 0xA5, 0x2A,
+	0x9A, 0xF2, 0x9B, 0x73, 0xAB, 0x32, 0xBE, 0x6A,
+	0xF9, 0xCB, 0x9D, 0x29, 0x6C, 0x50, 0x6E, 0xD5,
+	0x16, 0xED, 0xA7, 0xE2, 0x94, 0x66, 0x61, 0x53,
+	0x2A, 0x38, 0xC1, 0xB9, 0x24, 0xE0, 0xCF, 0x0D,
+	0x81, 0xB1, 0xED, 0xF0, 0xCE, 0xA8, 0xB4, 0x11,
+	0x7A, 0xE9, 0x7D, 0x24, 0x03, 0xDE, 0x8F, 0x94,
+	0x33, 0xA1, 0x0D, 0x71, 0x7F, 0x05, 0xF9, 0xFC,
+	0xDE, 0x08, 0x07, 0x17, 0x45, 0xE7, 0xBC, 0xC7,
+	0x9E, 0x0B, 0x64, 0xE7, 0xFA, 0x7F, 0x58, 0x0B,
+	0xFD, 0x79, 0x9E, 0x39, 0xD9, 0x66, 0xA7, 0x15,
+	0xB1, 0x6C, 0x5A, 0xA0, 0x36, 0x90, 0x7F, 0xB3,
+	0x92, 0x0B, 0x3B, 0x38, 0x6F, 0x35, 0xC8, 0x00,
+	0xC6, 0xA4, 0x70, 0xC2, 0x62, 0x07, 0x77, 0x00,
+	0x20, 0x72, 0x59, 0x7D, 0x90, 0xF3, 0xF3, 0x53,
+	0xBD, 0xB7, 0x37, 0xE0, 0xA4, 0xDE, 0x2A, 0xD7,
+	0xDE, 0xF6, 0x34, 0xEF, 0x9D, 0x10, 0xBD, 0x00,
+	0xD8, 0xA9, 0x5B, 0x06, 0x52, 0x7A, 0x30, 0xFB,
+	0x4A, 0x0F, 0xB5, 0x41, 0x14, 0x01, 0xA7, 0xA1,
+	0xCA, 0xE2, 0x42, 0xFD, 0xC9, 0x23, 0x3C, 0xDE,
+	0x1D, 0x76, 0xD0, 0x43, 0xFC, 0x00, 0xA9, 0x72,
+	0x4A, 0x92, 0x08, 0xF8, 0xC0, 0x3E, 0xED, 0xE9,
+	0xAA, 0x68, 0x00, 0xB1, 0xF0, 0x9F, 0xD6, 0xBD,
+	0xBD, 0x01, 0x9F, 0xC4, 0xB2, 0x89, 0x3C, 0x14,
+	0x97, 0xCB, 0x87, 0x1A, 0xA2, 0x69, 0xAF, 0x15,
+	0xEE, 0xD4, 0xD2, 0x98, 0x2B, 0xC9, 0x6E, 0xFC,
+	0xA6, 0x25, 0x8A, 0x29, 0x76, 0x9A, 0x7C, 0x2C,
+	0xAE, 0xF7, 0xC4, 0xF0, 0x7A, 0x20, 0xCD, 0x91,
+	0xD6, 0x5C, 0x3B, 0x8A, 0x1E, 0x1F, 0x8C, 0xA6,
+	0x20, 0x70, 0xD1, 0xFE, 0xCE, 0x0A, 0xAB, 0x9C,
+	0xC1, 0x51, 0xEA, 0x67, 0xF4, 0x4D, 0xDF, 0xA2,
+	0xB5, 0x1E, 0xDE, 0xB4, 0x32, 0xF8, 0x51, 0x4D,
+	0x63, 0x63, 0x39, 0x5B, 0x11, 0xB7, 0x42, 0x28,
+	0x5D, 0xEB, 0x30, 0xEF, 0xC6, 0xB4, 0xDA, 0x21,
+	0xA6, 0x95, 0x80, 0x66, 0x7A, 0x25, 0x7E, 0x03,
+	0xA7, 0xC3, 0xF1, 0x22, 0x5D, 0xCE, 0x76, 0x02,
+	0x9C, 0x99, 0x97, 0xB9, 0x36, 0xD9, 0x92, 0x3B,
+	0xDF, 0x24, 0x11, 0xA4, 0x4E, 0x32, 0xB4, 0x97,
+	0xE5, 0xAB, 0x94, 0x69, 0xBE, 0x34, 0xFE, 0x4B,
+	0x6C, 0xA8, 0x1D, 0xBC, 0xB3, 0x32, 0x8C, 0x58,
+	0x3E, 0xF1, 0x5D, 0x12, 0x82, 0xEB, 0xDB, 0x89,
+	0xC6, 0xA6, 0xD2, 0xC1, 0x4B, 0x4F, 0x74, 0xA8,
+	0x10, 0xB0, 0x44, 0x6A, 0xAA, 0xF1, 0x3F, 0xF8,
+	0x44, 0xFA, 0x43, 0x49, 0xD7, 0x28, 0x3D, 0x8B,
+	0xF2, 0x27, 0x16, 0xDE, 0x0B, 0x12, 0x7B, 0xC1,
+	0xEB, 0xD8, 0xE8, 0x90, 0xAD, 0xA1, 0x60, 0xC8,
+	0xD3, 0xC9, 0xB3, 0xDA, 0xC4, 0x92, 0x64, 0x11,
+	0xED, 0xF6, 0x35, 0xD2, 0x31, 0x38, 0x2A, 0xD6,
+	0xDA, 0x4B, 0x17, 0x6B, 0xE2, 0x04, 0x6A, 0x0F,
+	0xD4, 0xED, 0x78, 0x2F, 0xD1, 0xAC, 0xA4, 0x92,
+	0x4A, 0xB3, 0x8D, 0xBD, 0x88, 0x72, 0xF5, 0xBF,
+	0x1F, 0x7F, 0x08, 0x9E, 0x96, 0xCC, 0xEC, 0xA5,
+	0xB1, 0x51, 0xB0, 0x3F, 0xA2, 0xEA, 0x97, 0xCE,
+	0xDB, 0x66, 0xD7, 0x69, 0xE3, 0xF1, 0xB6, 0x7D,
+	0x70, 0x97, 0x29, 0xAB, 0xF3, 0x94, 0xB5, 0x36,
+	0x35, 0x1A, 0x98, 0x3A, 0xA4, 0x13, 0xF9, 0x17,
+	0xEA, 0x2D, 0x89, 0x0B, 0xC8, 0x78, 0x94, 0x4D,
+	0x31, 0xD5, 0x65, 0xE1, 0x0C, 0xD2, 0x80, 0x87,
+	0xF7, 0x07, 0x29, 0x4C, 0x5E, 0x77, 0x48, 0x0C,
+	0x4E, 0x4B, 0xBC, 0x7A, 0x93, 0xC7, 0xC7, 0x0D,
+	0x38, 0x32, 0x59, 0xB9, 0xAA, 0x64, 0x09, 0x5E,
+	0x4E, 0xC6, 0x8A, 0x59, 0xE7, 0xCA, 0x1F, 0x4C,
+	0xED, 0x94, 0x32, 0xFF, 0x51, 0x04, 0x2C, 0xF9,
+	0xF5, 0xFE, 0xBB, 0xD6, 0x56, 0x5A, 0x9F, 0x11,
+	0xD4, 0x03, 0xE3, 0x41, 0xE0, 0x32, 0xF8, 0x01,
+	0x78, 0x60, 0x20, 0x9D, 0x45, 0xE6, 0x4A, 0xF6,
+	0x20, 0x1D, 0x13, 0xD8, 0xAF, 0x9E, 0x1A, 0xDC,
+	0x4E, 0x04, 0x05, 0xE8, 0x43, 0x61, 0x80, 0x67,
+	0x30, 0x3F, 0x49, 0x57, 0x73, 0x87, 0x79, 0xCF,
+	0xF9, 0x3D, 0x68, 0x22, 0x6F, 0x4A, 0xFF, 0xD8,
+	0xDB, 0x7C, 0x98, 0x4C, 0xD4, 0xAA, 0xCE, 0xC1,
+	0x06, 0xC0, 0x39, 0x7F, 0x88, 0x84, 0x3C, 0xA5,
+	0xA6, 0xD2, 0xF4, 0xE2, 0x72, 0x4E, 0x6B, 0xFA,
+	0xCA, 0xA5, 0x05, 0x26, 0xE2, 0x3E, 0xD8, 0xAF,
+	0x97, 0x18, 0xC9, 0xC3, 0x4C, 0x76, 0x1F, 0x18,
+	0x5B, 0x5C, 0xD0, 0x55, 0xC7, 0xE0, 0x91, 0xFE,
+	0x85, 0x13, 0x66, 0x44, 0x99, 0xE5, 0xE6, 0x98,
+	0x09, 0xAD, 0x9E, 0x08, 0x56, 0xB3, 0x37, 0xB0,
+	0x04, 0xEE, 0x34, 0x01, 0x49, 0xA4, 0x28, 0x58,
+	0x92, 0x83, 0x8B, 0x4B, 0x14, 0xA5, 0xF5, 0x2A,
+	0x9E, 0xCA, 0xA0, 0xD3, 0xE1, 0xD7, 0x1E, 0x32,
+	0xF8, 0xC0, 0xAD, 0x0B, 0xA9, 0xC2, 0x49, 0xD2,
+	0xAA, 0x69, 0x9B, 0xCB, 0x57, 0x80, 0xC7, 0x0C,
+	0x77, 0x88, 0x33, 0xE1, 0xFA, 0x50, 0x60, 0xF3,
+	0x77, 0x08, 0xE6, 0xBE, 0x1E, 0xF4, 0x0B, 0x7B,
+	0x35, 0xA9, 0x61, 0x60, 0x1D, 0xD4, 0xA8, 0xA3,
+	0xB1, 0xF0, 0xB5, 0x8C, 0x0C, 0x20, 0x37, 0x4F,
+	0x0D, 0x8B, 0x02, 0xA2, 0x52, 0x82, 0xC0, 0xFF,
+	0xD5, 0x04, 0xBD, 0xBD, 0xEE, 0x53, 0xAC, 0x94,
+	0x44, 0x5E, 0x6A, 0xC7, 0xD5, 0xF5, 0x07, 0x9D,
+	0x29, 0xBE, 0x9C, 0x95, 0xB4, 0x43, 0x30, 0x56,
+	0x5A, 0x2D, 0x9A, 0xE1, 0x4C, 0x06, 0x2E, 0x2D,
+	0xEE, 0xBE, 0x15, 0x93, 0xC4, 0xF0, 0x90, 0xB3,
+	0x7F, 0x93, 0xFE, 0x25, 0x30, 0x92, 0x8C, 0x0A,
+	0xDE, 0x33, 0x66, 0x94, 0x88, 0x48, 0xBC, 0x7B,
+	0xD9, 0x7B, 0x77, 0xE8, 0xF5, 0x09, 0xDC, 0xFD,
+	0x80, 0x58, 0xF3, 0xE1, 0xCC, 0xC6, 0x1E, 0x25,
+	0x74, 0x55, 0x74, 0x85, 0xFF, 0x99, 0xE5, 0xAA,
+	0x02, 0xA9, 0x4A, 0xA3, 0x72, 0x01, 0x3C, 0xD9,
+	0x56, 0xB2, 0x62, 0xEE, 0x42, 0xA6, 0x7F, 0x4A,
+	0xB6, 0x5F, 0xD3, 0xDC, 0x59, 0x33, 0x23, 0x42,
+	0x95, 0x48, 0x31, 0x48, 0xBA, 0x4D, 0xA2, 0x01,
+	0xFB, 0xC2, 0xE0, 0x73, 0x74, 0x7D, 0x9F, 0xE8,
+	0x56, 0xBC, 0x7B, 0x26, 0x3D, 0xBA, 0x12, 0xCA,
+	0x9B, 0x64, 0x37, 0x9C, 0xE2, 0x3A, 0xE3, 0xF2,
+	0x5D, 0xDF, 0x74, 0xA1, 0x83, 0xAF, 0x99, 0x51,
+	0x7F, 0xFF, 0xB1, 0x28, 0x1C, 0x2A, 0x6A, 0x5E,
+	0x65, 0x8B, 0x43, 0xC2, 0x74, 0xC0, 0xE9, 0x0B,
+	0xF8, 0xA6, 0x08, 0xB2, 0xB8, 0xB0, 0xF6, 0x92,
+	0x0A, 0x0A, 0x9F, 0x1B, 0xC4, 0x3A, 0xC9, 0xF3,
+	0x87, 0xF5, 0xEA, 0x5B, 0xC9, 0xA7, 0x1F, 0xF8,
+	0x18, 0x37, 0x22, 0x47, 0x47, 0xCC, 0x0F, 0xE1,
+	0x7C, 0x79, 0x44, 0x1D, 0xB2, 0x86, 0x6E, 0x29,
+	0x89, 0x6D, 0xF3, 0x36, 0xA9, 0x51, 0x85, 0xE5,
+	0xC7, 0x52, 0x6F, 0x63, 0x6A, 0xA0, 0xA4, 0xA2,
+	0x04, 0xB3, 0x9B, 0x39, 0xE7, 0xA9, 0x04, 0xF8,
+	0xA9, 0xF9, 0x5E, 0xC4, 0x14, 0x43, 0x43, 0xB2,
+	0x27, 0x8B, 0x71, 0x23, 0x11, 0xDC, 0x51, 0xED,
+	0x28, 0xB7, 0x23, 0xC5, 0xF6, 0x9A, 0x83, 0xB5,
+	0xBF, 0x2F, 0x49, 0xCC, 0x7C, 0xB6, 0x59, 0xD9,
+	0x02, 0x0F, 0x58, 0xB6, 0x85, 0x6C, 0xDD, 0x55,
+	0x1D, 0x48, 0x1D, 0x82, 0x25, 0x1E, 0xEF, 0xAB,
+	0x71, 0x5E, 0x43, 0xB6, 0xE6, 0x16, 0x98, 0x27,
+	0x72, 0x47, 0xD1, 0xD9, 0xDC, 0xB9, 0x85, 0x73,
+	0x8A, 0xBF, 0xD7, 0x60, 0xE9, 0x6B, 0xF1, 0xCE,
+	0x47, 0xE1, 0xAA, 0x70, 0x90, 0x59, 0x3A, 0xB6,
+	0x21, 0x66, 0xBB, 0xBE, 0x87, 0x11, 0x93, 0xAF,
+	0xD0, 0x0A, 0x5C, 0xE3, 0xF4, 0x5A, 0xC9, 0xEF,
+	0xB9, 0x35, 0x6E, 0x87, 0x6F, 0x44, 0x0C, 0x19,
+	0x9E, 0xA2, 0x2A, 0x49, 0xDC, 0xD6, 0x42, 0x95,
+	0x27, 0xA0, 0x96, 0x7E, 0x35, 0x8F, 0x26, 0x81,
+	0x89, 0x6B, 0x1B, 0x1B, 0x78, 0x81, 0x2A, 0xE2,
+	0xB6, 0x9A, 0xE7, 0x77, 0xD3, 0x47, 0xA8, 0x52,
+	0x67, 0x4A, 0xA8, 0x57, 0xDE, 0x20, 0x9D, 0xC6,
+	0x29, 0xBA, 0xF8, 0xA9, 0x9F, 0x7B, 0xF4, 0x6C,
+	0xA1, 0xA4, 0xC7, 0x90, 0x88, 0xDA, 0x51, 0x7D,
+	0xB2, 0x58, 0xF8, 0xC0, 0xC4, 0xF1, 0x68, 0xC4,
+	0xB8, 0x46, 0x83, 0x6C, 0xCE, 0x7E, 0x55, 0x09,
+	0x52, 0x15, 0x62, 0x5E, 0xC5, 0xBF, 0xBD, 0x51,
+	0x2C, 0x53, 0x0C, 0xA9, 0xED, 0x64, 0xD7, 0x2E,
+	0x70, 0xB4, 0x41, 0x50, 0x29, 0xCB, 0xBF, 0x90,
+	0xED, 0x79, 0x73, 0x2A, 0x7C, 0x41, 0x62, 0x7D,
+	0x2D, 0x0F, 0x1C, 0x08, 0xA1, 0x14, 0x48, 0x02,
+	0x23, 0x32, 0x43, 0xD2, 0x85, 0x67, 0x20, 0xBC,
+	0x93, 0x11, 0xE8, 0x9F, 0x0A, 0x85, 0x94, 0x2C,
+	0x76, 0x60, 0xD5, 0xA2, 0x62, 0x50, 0x5A, 0x7A,
+	0xFB, 0xF3, 0x0F, 0x9C, 0x39, 0xB8, 0xFF, 0x8F,
+	0xC9, 0xA3, 0x95, 0x19, 0xD1, 0xDC, 0x1E, 0xFF,
+	0x09, 0xDF, 0x49, 0x94, 0x1C, 0xAD, 0xD1, 0x79,
+	0xFF, 0x53, 0x8D, 0xAD, 0xD6, 0x35, 0x40, 0xDB,
+	0x0B, 0xC7, 0xA8, 0x1E, 0xE8, 0xA7, 0x10, 0x20,
+	0x7A, 0x13, 0x41, 0x51, 0xFE, 0x2A, 0x43, 0xD0,
+	0x50, 0x84, 0x6A, 0xF8, 0xC2, 0xCC, 0x67, 0xAD,
+	0x2A, 0x2F, 0x78, 0xD9, 0x2D, 0x18, 0x9E, 0x67,
+	0x03, 0x20, 0x4E, 0xF3, 0xB6, 0x53, 0x21, 0xD5,
+	0x26, 0xFE, 0xF1, 0x2F, 0x51, 0x3E, 0xD9, 0x1C,
+	0xB6, 0x15, 0x9B, 0x64, 0x3E, 0x6E, 0x3D, 0xFB,
+	0x3C, 0x58, 0x3E, 0x7D, 0xBE, 0x5B, 0xF7, 0x35,
+	0x72, 0x57, 0x6F, 0x08, 0x70, 0x6B, 0xB5, 0x52,
+	0x75, 0x22, 0x87, 0x8C, 0x48, 0x70, 0xD9, 0xB7,
+	0x0D, 0x4F, 0x4B, 0x86, 0xE8, 0x0D, 0x6E, 0x0D,
+	0x28, 0x06, 0xE2, 0xCE, 0x7F, 0xAE, 0xE5, 0xCC,
+	0xA7, 0x3B, 0x2E, 0x93, 0xD7, 0x25, 0xFC, 0x5B,
+	0xE7, 0xA6, 0xFB, 0xB9, 0x8C, 0xC5, 0x6C, 0x7D,
+	0x52, 0xB4, 0x86, 0x88, 0x22, 0x0B, 0xE0, 0x12,
+	0x51, 0x8E, 0xB7, 0xE0, 0xD9, 0xFB, 0xC1, 0xDE,
+	0x4A, 0x04, 0x35, 0xF7, 0x2C, 0xBF, 0x99, 0xC3,
+	0x38, 0xB5, 0x03, 0xF1, 0xC6, 0x48, 0xAF, 0x8B,
+	0xE4, 0xCC, 0x30, 0x97, 0xFE, 0x5B, 0xD6, 0xF6,
+	0xD9, 0xED, 0xFD, 0x61, 0xE9, 0x1C, 0xB7, 0x7E,
+	0x6D, 0x89, 0x0A, 0x38, 0x6C, 0xA0, 0x68, 0x71,
+	0x3D, 0x9A, 0xC5, 0x74, 0x82, 0xE8, 0x2D, 0x81,
+	0x8C, 0x59, 0xD7, 0x89, 0xDF, 0x02, 0x2B, 0x4E,
+	0x65, 0xF6, 0x75, 0x39, 0x21, 0x66, 0xBD, 0x80,
+	0xD9, 0x47, 0xAA, 0x23, 0x0D, 0x4F, 0x9E, 0xB9,
+	0x67, 0x97, 0x90, 0x6F, 0xFD, 0x80, 0x0B, 0xF2,
+	0x68, 0x81, 0x1F, 0x4F, 0x11, 0xFF, 0x76, 0x16,
+	0x8B, 0x26, 0xB3, 0x57, 0xB0, 0x64, 0x07, 0xE3,
+	0x2A, 0x23, 0xC8, 0x64, 0x72, 0xB8, 0x3E, 0xDE,
+	0x5B, 0x40, 0x8A, 0x1E, 0x53, 0x19, 0xE7, 0x13,
+	0xF1, 0x70, 0x70, 0x17, 0x38, 0xE5, 0xEB, 0x02,
+	0x30, 0x49, 0xBB, 0x0D, 0x2D, 0xD4, 0xDC, 0xBB,
+	0x10, 0x27, 0x6F, 0xFC, 0xE7, 0xB8, 0xA1, 0x51,
+	0x2B, 0x88, 0xEE, 0x5D, 0x65, 0x96, 0xB9, 0x8B,
+	0x4D, 0xB5, 0x1F, 0xA0, 0x42, 0xE5, 0x3E, 0xB8,
+	0x09, 0x68, 0xC9, 0x6D, 0xAC, 0x0D, 0x63, 0xD5,
+	0x61, 0xBE, 0x9A, 0xEF, 0x21, 0x29, 0x0D, 0x7C,
+	0xA1, 0x6A, 0xC1, 0x77, 0xF4, 0xAB, 0xFF, 0x2C,
+	0x1F, 0x74, 0xB2, 0x2C, 0x10, 0x36, 0x12, 0x7B,
+	0xA2, 0x19, 0x95, 0xD5, 0x40, 0x59, 0x39, 0x42,
+	0xDF, 0x05, 0xA0, 0x4F, 0x1C, 0xF1, 0x14, 0x5D,
+	0xDD, 0x19, 0xB3, 0x39, 0x9E, 0x18, 0x1E, 0xFE,
+	0xEB, 0xE4, 0xA1, 0x12, 0x1F, 0x59, 0x92, 0x14,
+	0xA6, 0xC3, 0x49, 0x48, 0x25, 0xB3, 0xEA, 0x31,
+	0x31, 0x08, 0x40, 0x9B, 0xEB, 0xA5, 0x91, 0x7E,
+	0x2C, 0x32, 0xA5, 0xD7, 0xB8, 0xB7, 0x78, 0x34,
+	0x63, 0x6C, 0x02, 0xA0, 0xEE, 0xC0, 0x7F, 0xF8,
+	0xB9, 0x0E, 0xEF, 0xA0, 0xA4, 0xC1, 0x31, 0x0B,
+	0xEF, 0x00, 0x44, 0xD4, 0xDC, 0x9B, 0xB9, 0x23,
+	0x31, 0xC6, 0x16, 0x2C, 0x79, 0x89, 0x9F, 0x95,
+	0x3C, 0xFF, 0x64, 0xC6, 0xA4, 0x76, 0x96, 0x7F,
+	0x75, 0x9A, 0xAE, 0x43, 0x3B, 0xF7, 0x5A, 0x5C,
+	0xF3, 0x24, 0xA4, 0x27, 0xF4, 0x46, 0x81, 0xCB,
+	0x51, 0xBE, 0xDC, 0x45, 0x2F, 0x3F, 0xA1, 0x9B,
+	0xCE, 0x6F, 0xD9, 0x8D, 0x15, 0xE2, 0x3B, 0x3A,
+	0x97, 0x1E, 0xAC, 0xD1, 0x40, 0x43, 0x06, 0x94,
+	0xC5, 0x68, 0x55, 0x30, 0x8B, 0x30, 0x96, 0x82,
+	0xDB, 0xA1, 0x8F, 0x9A, 0x91, 0x3B, 0x3F, 0xA1,
+	0xD9, 0x6E, 0xC6, 0x17, 0x13, 0x4C, 0x75, 0x0F,
+	0x8B, 0x4D, 0x00, 0x64, 0x4D, 0x36, 0xB2, 0x51,
+	0x1F, 0xA4, 0xDD, 0x47, 0xBD, 0x4E, 0x79, 0x6C,
+	0x31, 0x37, 0x5B, 0x14, 0x0F, 0x63, 0xB7, 0x85,
+	0x69, 0x1A, 0x56, 0xAC, 0xCF, 0xBD, 0x26, 0x30,
+	0x75, 0x00, 0x83, 0xB1, 0x85, 0xCF, 0x1B, 0xAB,
+	0x43, 0x30, 0x0F, 0x99, 0x87, 0xF0, 0x6B, 0x04,
+	0x47, 0xDC, 0xE7, 0xAA, 0x2F, 0x07, 0xD6, 0x88,
+	0x1A, 0x15, 0x2D, 0x20, 0x80, 0x98, 0x39, 0x54,
+	0xC1, 0x04, 0x92, 0xD6, 0x09, 0x23, 0xFE, 0x47,
+	0x1D, 0xA8, 0xA3, 0xAA, 0x01, 0x7D, 0x01, 0x61,
+	0x70, 0xC0, 0x97, 0xCD, 0xB5, 0x4C, 0x4B, 0xAC,
+	0x46, 0x7B, 0xA3, 0xE0, 0x97, 0x29, 0xCB, 0xF4,
+	0xF7, 0xE7, 0xB5, 0xA5, 0xDB, 0xA8, 0x13, 0xAC,
+	0x23, 0x22, 0xF8, 0x03, 0xEC, 0xF1, 0x10, 0x9C,
+	0xF8, 0xE4, 0xEC, 0x11, 0xC0, 0xF9, 0xAB, 0xFD,
+	0x83, 0x69, 0x07, 0xB5, 0x26, 0x89, 0x80, 0x1A,
+	0x96, 0x91, 0x29, 0x98, 0x39, 0x19, 0x1B, 0x12,
+	0x4F, 0x48, 0xF2, 0xF0, 0xA1, 0xF9, 0x8D, 0x73,
+	0x16, 0x1F, 0x03, 0x96, 0x18, 0xF0, 0x96, 0xD8,
+	0xD0, 0xEC, 0x44, 0xCA, 0xFA, 0x41, 0x48, 0xAA,
+	0x4A, 0x28, 0x83, 0x68, 0x7C, 0x0E, 0x70, 0x51,
+	0xFF, 0x5E, 0x9E, 0xB5, 0x87, 0x46, 0x95, 0xE5,
+	0x2F, 0xEF, 0x29, 0xC8, 0x85, 0x3B, 0x70, 0x57,
+	0xA6, 0x15, 0xEA, 0xCF, 0xBA, 0x7A, 0xA1, 0x28,
+	0x94, 0x4C, 0x16, 0xCB, 0x66, 0x03, 0xE4, 0x96,
+	0xE6, 0x4D, 0x2F, 0xF7, 0xF1, 0xE0, 0x79, 0x6B,
+	0xDA, 0xC8, 0x3D, 0x7D, 0xF7, 0x91, 0x8A, 0x62,
+	0x26, 0x8C, 0xB2, 0x26, 0x37, 0x0C, 0xEA, 0x9B,
+	0x18, 0x63, 0xF9, 0x4A, 0xE0, 0x4A, 0xE0, 0x47,
+	0x0C, 0x56, 0x0E, 0x86, 0xFF, 0x82, 0xB5, 0x47,
+	0xC1, 0x73, 0x39, 0xDF, 0x00, 0x7B, 0x5B, 0x56,
+	0x19, 0x32, 0xDD, 0x5C, 0x75, 0xF1, 0xDC, 0x2C,
+	0x05, 0xC0, 0xA5, 0x21, 0x2B, 0x3A, 0x0B, 0xB1,
+	0xE1, 0xF3, 0x4A, 0x75, 0x63, 0xDD, 0x01, 0xE3,
+	0xB1, 0x2D, 0x4C, 0x60, 0xDB, 0xF5, 0x95, 0xCC,
+	0x0B, 0x18, 0x75, 0xB4, 0xE4, 0x92, 0x84, 0x2F,
+	0x14, 0xEF, 0x12, 0xE1, 0xA6, 0xF9, 0x4F, 0x02,
+	0x19, 0x22, 0x57, 0x4C, 0xB1, 0x0C, 0xDB, 0x89,
+	0x91, 0x80, 0x45, 0x92, 0x6F, 0xDB, 0x66, 0x96,
+	0x65, 0xBD, 0xD4, 0xE8, 0xE5, 0xC2, 0x50, 0xC1,
+	0xA3, 0x55, 0xAF, 0x45, 0x3F, 0xDA, 0x71, 0x11,
+	0x0C, 0x17, 0x47, 0xC3, 0x83, 0xAC, 0xDD, 0x8C,
+	0x5D, 0xF0, 0x13, 0x68, 0x93, 0xB6, 0x52, 0xC0,
+	0x64, 0x2C, 0x58, 0xCC, 0xCD, 0xE5, 0x62, 0xF3,
+	0x2F, 0x93, 0x2B, 0xF4, 0xAC, 0xB9, 0x34, 0x51,
+	0x3E, 0x4F, 0xE2, 0x3D, 0x52, 0xD2, 0xF0, 0xFE,
+	0x8A, 0xD9, 0x81, 0x8D, 0xF1, 0xA2, 0x24, 0x8B,
+	0xE0, 0x4C, 0x19, 0x6C, 0x18, 0xFE, 0x39, 0x29,
+	0x1D, 0xA6, 0x6D, 0xE0, 0x1F, 0x9D, 0x7B, 0xD7,
+	0xC3, 0x43, 0x01, 0x5B, 0x70, 0xFD, 0x4B, 0x8B,
+	0x1C, 0xBA, 0x0E, 0x20, 0x59, 0x58, 0x2F, 0xBD,
+	0xD8, 0x4F, 0x31, 0xD4, 0xA4, 0x09, 0xBF, 0x11,
+	0x33, 0x4C, 0x56, 0xB9, 0x8D, 0x1A, 0x1E, 0x43,
+	0x4E, 0x63, 0x78, 0x9C, 0x63, 0x72, 0x10, 0xBE,
+	0x0B, 0x2D, 0xAE, 0x20, 0x5C, 0x55, 0xA0, 0x9B,
+	0xDC, 0x2C, 0x39, 0x29, 0x92, 0xF2, 0xA4, 0xFB,
+	0xB9, 0x5A, 0xCE, 0x1F, 0xCE, 0x39, 0x42, 0xB7,
+	0x3F, 0x8A, 0x3B, 0x50, 0xEE, 0x62, 0x42, 0xCA,
+	0x92, 0xB3, 0xBF, 0xE4, 0xB6, 0xE3, 0x2A, 0x0D,
+	0xCA, 0x60, 0xA7, 0x0F, 0x8E, 0xBB, 0x4D, 0xE1,
+	0x11, 0xE1, 0xF7, 0x16, 0xFC, 0xD8, 0xC2, 0x7C,
+	0x15, 0x21, 0xF6, 0xF7, 0xC4, 0xF4, 0x5A, 0x6D,
+	0xA5, 0x16, 0x5E, 0x00, 0x71, 0x3B, 0x97, 0x38,
+	0xD1, 0x97, 0x76, 0x35, 0x18, 0xD2, 0x5F, 0x11,
+	0xE4, 0xF0, 0x42, 0xD8, 0x56, 0x29, 0xCA, 0xBC,
+	0xDF, 0x96, 0xFB, 0xE0, 0xB3, 0x15, 0xA9, 0x44,
+	0x4F, 0x49, 0x14, 0x85, 0x0B, 0xFE, 0x92, 0x73,
+	0xE9, 0x20, 0x7C, 0xB2, 0x84, 0x78, 0x26, 0x3E,
+	0x6F, 0xD5, 0x0F, 0xF7, 0x8C, 0xC4, 0x8F, 0xB0,
+	0x7F, 0x43, 0x4B, 0xE9, 0xE1, 0x3A, 0x53, 0x61,
+	0xCF, 0xDD, 0x52, 0x60, 0x4E, 0x65, 0x4C, 0x9A,
+	0x37, 0xC7, 0xAA, 0x1D, 0x4A, 0x39, 0x46, 0x03,
+	0x51, 0x23, 0xC2, 0x91, 0x6D, 0xCD, 0x62, 0x7B,
+	0x1C, 0x70, 0xC5, 0xBC, 0x4E, 0x9B, 0x25, 0x41,
+	0xC0, 0x4A, 0x17, 0x79, 0xFA, 0x22, 0x33, 0xCF,
+	0x74, 0xBB, 0x8B, 0x68, 0x33, 0x84, 0xB3, 0xCA,
+	0xDE, 0xD4, 0x26, 0xA4, 0xEC, 0x65, 0x2B, 0x4F,
+	0x20, 0x7A, 0x1F, 0x84, 0x48, 0xEA, 0x51, 0x1F,
+	0x94, 0xEB, 0xE5, 0xF1, 0xEA, 0xCD, 0x5A, 0xD2,
+	0x4F, 0xE9, 0xD1, 0xD4, 0x1C, 0xC1, 0x89, 0x1A,
+	0x63, 0x37, 0xD8, 0x9E, 0xEA, 0x88, 0x6A, 0x36,
+	0x8E, 0x7F, 0xE3, 0x08, 0x19, 0x32, 0x00, 0xF2,
+	0x4B, 0x8E, 0xC8, 0x82, 0x85, 0xA2, 0xFB, 0x53,
+	0x51, 0x3B, 0x96, 0x79, 0xF5, 0x8E, 0x86, 0xFF,
+	0x83, 0x98, 0xBF, 0xD3, 0xA2, 0xF8, 0xFF, 0xE7,
+	0xDE, 0x67, 0x0F, 0x9B, 0xCB, 0x94, 0xFF, 0x6C,
+	0xB9, 0x83, 0x8C, 0x38, 0x07, 0x35, 0xFF, 0xDA,
+	0xD0, 0x9F, 0xA8, 0xF2, 0x4B, 0xB0, 0xAE, 0x81,
+	0x34, 0x61, 0x6F, 0x35, 0x6C, 0x49, 0xDD, 0x62,
+	0xD5, 0x87, 0xC1, 0x5C, 0xB4, 0x8B, 0x46, 0xAF,
+	0xF4, 0x14, 0x35, 0xD7, 0xFB, 0xAC, 0xEE, 0xE0,
+	0x5B, 0x17, 0xCC, 0x10, 0x00, 0xA7, 0x03, 0xEB,
+	0x87, 0x90, 0xAD, 0x45, 0xD5, 0xF2, 0x22, 0xAD,
+	0xF8, 0x45, 0xE3, 0x4F, 0x2F, 0x08, 0x5A, 0xE3,
+	0x18, 0xEA, 0x96, 0xFB, 0x08, 0x37, 0xA9, 0x7D,
+	0xAE, 0x9E, 0x90, 0xA3, 0x9F, 0xD2, 0x3B, 0x29,
+	0x86, 0x5B, 0x23, 0x60, 0xE9, 0x98, 0x73, 0x79,
+	0x88, 0xE5, 0x26, 0x4A, 0xB0, 0xF6, 0xC5, 0x03,
+	0x4B, 0xB1, 0x49, 0x33, 0x88, 0xF7, 0x7A, 0xDC,
+	0x6A, 0x40, 0xB0, 0xDA, 0x68, 0xAE, 0x15, 0x1A,
+	0xE5, 0x2D, 0xFA, 0xBF, 0x04, 0xB7, 0x39, 0xA0,
+	0xE7, 0x63, 0x2A, 0xCF, 0xDC, 0xE1, 0xD9, 0xF2,
+	0x25, 0xB7, 0x9D, 0xB9, 0x3E, 0x1A, 0x7B, 0x03,
+	0x46, 0xA6, 0x32, 0x0C, 0x2E, 0x22, 0xD2, 0xAD,
+	0x29, 0x69, 0xF7, 0x87, 0x70, 0x96, 0x80, 0x9F,
+	0x06, 0x27, 0x10, 0x68, 0x62, 0x25, 0x9F, 0xD8,
+	0x23, 0x61, 0x0A, 0x79, 0x31, 0x0C, 0x4D, 0x1A,
+	0x44, 0x79, 0x18, 0x36, 0xE4, 0xBF, 0xF8, 0x36,
+	0x62, 0xB1, 0x1A, 0xC3, 0xE8, 0x92, 0x7E, 0xA7,
+	0xBD, 0x4F, 0x5F, 0xA1, 0xA1, 0xEE, 0x45, 0x34,
+	0xA2, 0x79, 0x64, 0xD6, 0x0D, 0x1F, 0x2E, 0x91,
+	0x2E, 0x36, 0xA1, 0xCF, 0x36, 0x1A, 0xE0, 0x29,
+	0x73, 0xBF, 0x3A, 0xA2, 0x7C, 0xF0, 0xFA, 0x02,
+	0xFA, 0x49, 0xFE, 0x01, 0x0F, 0xA5, 0x9B, 0x20,
+	0xAC, 0x38, 0x07, 0x72, 0xA1, 0x45, 0x07, 0xE4,
+	0xE2, 0xD0, 0x9F, 0x52, 0xA4, 0x1C, 0x56, 0xBB,
+	0xC4, 0x6C, 0x98, 0x3A, 0x9E, 0x87, 0x82, 0x1B,
+	0xF1, 0x55, 0x34, 0xD4, 0x7E, 0xDF, 0x1B, 0x6E,
+	0x73, 0x2F, 0x85, 0xCD, 0x2C, 0x7E, 0x9F, 0x8E,
+	0x39, 0x0A, 0xBC, 0x8A, 0x32, 0xC7, 0xCC, 0xBF,
+	0xA0, 0x94, 0x60, 0x83, 0x69, 0x23, 0x1F, 0x9E,
+	0x38, 0x04, 0x8C, 0xF9, 0x61, 0x2F, 0xA0, 0x56,
+	0xB6, 0xEC, 0xA9, 0xA3, 0xCA, 0x57, 0xDF, 0x90,
+	0x49, 0xCB, 0xF2, 0xD5, 0x29, 0xC6, 0x13, 0x03,
+	0xF3, 0x11, 0x99, 0x6E, 0x30, 0x37, 0x68, 0xA0,
+	0x64, 0x22, 0xB9, 0x74, 0x05, 0xC0, 0xC9, 0x33,
+	0xD0, 0xA2, 0x8E, 0x7B, 0x8C, 0x28, 0xA9, 0x01,
+	0xF3, 0x9D, 0xAE, 0x04, 0xD6, 0x6F, 0x5F, 0x1C,
+	0x86, 0xA9, 0x3A, 0x68, 0xBC, 0xA1, 0x64, 0xF3,
+	0xB7, 0x28, 0xD9, 0x99, 0xE2, 0x22, 0x83, 0xD4,
+	0x62, 0xA6, 0xBF, 0x76, 0x16, 0x5B, 0xC2, 0x53,
+	0xD2, 0xEE, 0xDB, 0x19, 0xAD, 0x9E, 0x2D, 0xE3,
+	0x95, 0x77, 0xB6, 0x16, 0x05, 0x97, 0x68, 0x2F,
+	0x9B, 0xB9, 0xA4, 0x85, 0xAF, 0x1B, 0x58, 0x86,
+	0x14, 0xAC, 0x52, 0x4E, 0xE4, 0x32, 0x8E, 0xCF,
+	0x5C, 0xC8, 0xE6, 0x19, 0xAA, 0xBC, 0x2D, 0x76,
+	0x87, 0x3F, 0xBE, 0x20, 0x94, 0xCF, 0x24, 0xEE,
+	0x20, 0x7B, 0xB9, 0x2D, 0xF8, 0x05, 0x10, 0x8C,
+	0x11, 0x29, 0x4E, 0xBA, 0x30, 0x0A, 0xAB, 0xE2,
+	0xC2, 0x02, 0x1F, 0x5A, 0x41, 0x2A, 0xA7, 0x3F,
+	0x7D, 0x10, 0x17, 0x0D, 0x2A, 0x52, 0x3C, 0x4B,
+	0x10, 0x9F, 0x18, 0x48, 0x40, 0xD9, 0x22, 0x04,
+	0xE3, 0x26, 0x71, 0x72, 0x13, 0x42, 0xF0, 0xB3,
+	0xE7, 0x55, 0xAA, 0x45, 0x2F, 0xF3, 0x38, 0x20,
+	0xDB, 0xA9, 0x88, 0x25, 0xA1, 0x40, 0x37, 0x76,
+	0xC9, 0x4F, 0x56, 0x73, 0x46, 0xF9, 0x29, 0x55,
+	0xC6, 0x43, 0x16, 0xD7, 0x86, 0xD0, 0x5C, 0xA5,
+	0x18, 0xCA, 0x3F, 0xDD, 0xF6, 0xDF, 0x65, 0xEC,
+	0xDD, 0x85, 0x57, 0x6E, 0x9B, 0xEA, 0xC1, 0x4E,
+	0xAB, 0x7E, 0x4A, 0xDE, 0x87, 0xB2, 0x77, 0xE1,
+	0x93, 0x99, 0x7C, 0xE9, 0x51, 0xD9, 0x95, 0xA3,
+	0x9E, 0x7D, 0xF4, 0xEB, 0x02, 0x0D, 0xE4, 0xE5,
+	0x49, 0x2A, 0x1D, 0xBF, 0xA2, 0xE8, 0xB1, 0xD8,
+	0xB4, 0x38, 0xB9, 0xBB, 0x64, 0x18, 0x17, 0x74,
+	0x13, 0xD1, 0x83, 0x91, 0x7B, 0x69, 0x23, 0x98,
+	0x9F, 0x4A, 0xAF, 0x5B, 0xC3, 0x08, 0x48, 0xA6,
+	0xB3, 0xA0, 0xE0, 0x0A, 0x25, 0xDA, 0x25, 0xD4,
+	0xD1, 0x63, 0x26, 0xC9, 0x58, 0x5B, 0xF4, 0x0F,
+	0xC7, 0x1F, 0x85, 0x03, 0xF3, 0x07, 0x9F, 0x8E,
+	0xD1, 0x86, 0x11, 0xE2, 0x2E, 0xD7, 0x8C, 0x22,
+	0x8C, 0x95, 0xDD, 0x35, 0x02, 0x08, 0xE0, 0xCE,
+	0x24, 0xB0, 0x25, 0xE3, 0x72, 0xE4, 0x01, 0xAE,
+	0xA1, 0x2A, 0x82, 0xCD, 0xDD, 0x36, 0x6E, 0x5D,
+	0x02, 0xED, 0x42, 0xC2, 0x27, 0xE0, 0x19, 0x74,
+	0xF1, 0x6A, 0x9D, 0xFB, 0xAF, 0x57, 0x3C, 0x5A,
+	0x40, 0x56, 0x19, 0xB7, 0xD7, 0x7E, 0x91, 0xA6,
+	0x3E, 0xCE, 0x79, 0xB5, 0xDE, 0xD5, 0xAA, 0x13,
+	0xD1, 0x1B, 0x51, 0x63, 0x50, 0xD7, 0x69, 0xF4,
+	0x2E, 0xD5, 0x03, 0x87, 0xCD, 0xEE, 0x2D, 0x74,
+	0x8A, 0x49, 0x70, 0xD4, 0xBB, 0x0A, 0xF7, 0xC1,
+	0xF7, 0x43, 0xFC, 0xD2, 0xF9, 0x7E, 0xEE, 0x77,
+	0xB5, 0x8C, 0x99, 0x05, 0x7A, 0x9E, 0xC3, 0xB6,
+	0x4A, 0xF4, 0xAE, 0x99, 0x4A, 0x21, 0x7E, 0xB3,
+	0xB5, 0x4D, 0x66, 0x37, 0x4A, 0x5E, 0x33, 0xE2,
+	0x3B, 0x68, 0x95, 0x9C, 0x96, 0xB4, 0x30, 0xB1,
+	0xE5, 0x76, 0x4B, 0x1B, 0x62, 0x89, 0xFA, 0x0B,
+	0xAC, 0x45, 0xE6, 0xEA, 0xAA, 0x39, 0x0F, 0xE5,
+	0x0B, 0x43, 0xFF, 0x88, 0x12, 0xBA, 0xE6, 0xD7,
+	0xFD, 0x63, 0xA0, 0xF0, 0x66, 0xA7, 0x70, 0x20,
+	0xC9, 0x3B, 0xA7, 0xAE, 0xF9, 0x52, 0x15, 0x16,
+	0xBB, 0x19, 0x9D, 0x86, 0xC6, 0xE7, 0x5B, 0x3E,
+	0xF3, 0x4B, 0xCE, 0xC9, 0x19, 0xFE, 0x07, 0xAB,
+	0x98, 0x4F, 0x81, 0x4D, 0x85, 0x74, 0x18, 0xC8,
+	0x1E, 0x60, 0x9B, 0x76, 0x14, 0xDA, 0x0F, 0x2E,
+	0x48, 0x41, 0xAD, 0x20, 0x47, 0x66, 0x3F, 0x2F,
+	0x8E, 0x37, 0xFC, 0xA2, 0xAC, 0xAE, 0x42, 0x57,
+	0xC5, 0xB7, 0x08, 0x6F, 0x10, 0x17, 0x0C, 0x29,
+	0xA5, 0xA7, 0xE2, 0x6C, 0x29, 0x83, 0xD7, 0xB1,
+	0x89, 0x54, 0xC6, 0x3A, 0xE5, 0x66, 0xFE, 0xE8,
+	0xAD, 0x85, 0xA7, 0xEA, 0xCE, 0x5E, 0x4A, 0xC3,
+	0x05, 0x2D, 0x59, 0x74, 0x25, 0x49, 0x49, 0xDF,
+	0xAF, 0xE0, 0xF7, 0x82, 0xE9, 0xF1, 0xC9, 0x04,
+	0xB7, 0x45, 0x8C, 0x08, 0x72, 0xF3, 0x66, 0xB2,
+	0xFA, 0xCE, 0x13, 0xB2, 0xA3, 0x13, 0x10, 0x8F,
+	0xBC, 0x04, 0xAB, 0x8B, 0xC7, 0xCB, 0x52, 0xB3,
+	0x16, 0x86, 0xF6, 0x12, 0xA3, 0x22, 0x05, 0x2B,
+	0x6E, 0xFD, 0xF9, 0x5F, 0xBA, 0x1B, 0xFF, 0x20,
+	0x9D, 0x09, 0xAF, 0x04, 0x0A, 0xBD, 0x4F, 0xD9,
+	0x0D, 0x86, 0x82, 0xF6, 0x20, 0x35, 0x45, 0xB8,
+	0x94, 0x4F, 0xBC, 0xBB, 0xD8, 0xDC, 0x9E, 0x1A,
+	0x88, 0xA0, 0xF1, 0x1B, 0x03, 0x9C, 0x3C, 0x06,
+	0x30, 0x6C, 0xE3, 0xB8, 0x72, 0xA0, 0xBA, 0x51,
+	0xD7, 0x90, 0x34, 0x0D, 0xC1, 0xC6, 0x66, 0x7E,
+	0x0C, 0x98, 0x89, 0xAD, 0x5A, 0x41, 0x31, 0xD2,
+	0xCA, 0xCA, 0x44, 0x0F, 0xAF, 0x69, 0x14, 0x80,
+	0x7A, 0x03, 0x0D, 0xC7, 0xC5, 0x00, 0xBF, 0x2F,
+	0x9C, 0x2C, 0x88, 0x54, 0xC6, 0xCD, 0xFF, 0x30,
+	0x1D, 0x05, 0x82, 0x57, 0x70, 0x5D, 0x80, 0x06,
+	0xA8, 0x3A, 0xE8, 0x6E, 0xA2, 0x6E, 0x83, 0x74,
+	0xCC, 0x27, 0x61, 0x9A, 0x3B, 0xD7, 0x33, 0x48,
+	0x46, 0x5A, 0x5C, 0x92, 0xFE, 0x44, 0x5B, 0x09,
+	0xC3, 0x3C, 0x74, 0x24, 0x23, 0xCF, 0x7A, 0x29,
+	0xB4, 0xEF, 0x48, 0x5D, 0x4D, 0x7A, 0x5A, 0x85,
+	0x34, 0xBF, 0x55, 0xA2, 0xA8, 0xCF, 0xB8, 0x4D,
+	0x8F, 0xEB, 0x08, 0x94, 0x97, 0xF7, 0x95, 0x56,
+	0x50, 0x70, 0xB9, 0xB0, 0x8B, 0xCD, 0xAD, 0xA5,
+	0x81, 0x00, 0x60, 0x50, 0xF3, 0xF6, 0x6F, 0xDF,
+	0x57, 0x1C, 0xB7, 0xA1, 0x01, 0xF1, 0xA1, 0x59,
+	0xE1, 0x67, 0xAB, 0xF6, 0xD1, 0x7B, 0xCE, 0x42,
+	0xF6, 0xCA, 0x7F, 0x3D, 0xA5, 0xFF, 0x27, 0x6F,
+	0x3A, 0xDB, 0x9B, 0x88, 0xAC, 0x37, 0x3D, 0x75,
+	0x3B, 0x41, 0x76, 0x49, 0x70, 0xA5, 0x71, 0x67,
+	0x20, 0xB6, 0x20, 0xCE, 0xD2, 0x8F, 0x3E, 0xBA,
+	0x3C, 0x6C, 0x3E, 0xF2, 0xAA, 0xA9, 0x26, 0x09,
+	0x31, 0x1A, 0x4A, 0xDB, 0xB7, 0x30, 0x79, 0xBA,
+	0xF9, 0x33, 0xB9, 0xF2, 0xDC, 0xA7, 0xA8, 0x9A,
+	0x97, 0x0B, 0xAD, 0x4F, 0x85, 0xCF, 0x0D, 0x00,
+	0x97, 0xD1, 0x69, 0x87, 0x07, 0x11, 0x1C, 0x67,
+	0x12, 0x0A, 0x06, 0x5D, 0x70, 0x8E, 0x1B, 0x19,
+	0x6C, 0x00, 0x14, 0x18, 0xBE, 0x4A, 0x64, 0x17,
+	0x50, 0xE3, 0x5A, 0x0E, 0xE6, 0x44, 0x60, 0xAE,
+	0x18, 0x7C, 0x1D, 0x73, 0xB0, 0x79, 0xC7, 0x31,
+	0x1C, 0xC3, 0x7B, 0x38, 0xEF, 0xA9, 0xA4, 0x05,
+	0x86, 0xC4, 0xA4, 0x73, 0xAE, 0x1F, 0x9B, 0x15,
+	0x2D, 0xA5, 0xBD, 0x4B, 0x53, 0x6D, 0x61, 0x26,
+	0x4B, 0xE9, 0x94, 0x84, 0xE3, 0x4B, 0xDF, 0xE7,
+	0x57, 0x24, 0x3B, 0x7F, 0x56, 0x54, 0xA8, 0xEC,
+	0x96, 0x1F, 0x1A, 0x98, 0x9B, 0x32, 0xBE, 0xDE,
+	0x4F, 0x5A, 0x9F, 0x71, 0x39, 0xE9, 0x92, 0x9B,
+	0xF9, 0x79, 0x58, 0x80, 0x2B, 0xBE, 0x0D, 0x30,
+	0xB7, 0xA7, 0xCA, 0xC3, 0x7D, 0x12, 0xF1, 0xD6,
+	0xF1, 0xFC, 0xC3, 0x7E, 0x85, 0xFA, 0xC2, 0x02,
+	0x82, 0xA9, 0x1A, 0xB7, 0x6E, 0x81, 0xE1, 0xC8,
+	0x79, 0x92, 0x84, 0x9B, 0xAF, 0x1B, 0x98, 0x2C,
+	0x31, 0x39, 0x0A, 0xAD, 0x8E, 0x1F, 0x2E, 0xD9,
+	0x2D, 0x78, 0xE8, 0xF8, 0xE3, 0xDA, 0xF6, 0x6A,
+	0x1B, 0x00, 0xF8, 0xB0, 0xCA, 0x86, 0xCA, 0x63,
+	0xAF, 0xEC, 0x6C, 0x87, 0x01, 0x31, 0x4F, 0xF1,
+	0xE9, 0x9D, 0xEE, 0x6F, 0x56, 0xB5, 0xB4, 0xFE,
+	0x09, 0x14, 0x94, 0x2C, 0x42, 0x36, 0x20, 0xF4,
+	0xDC, 0xBD, 0x63, 0x90, 0xB1, 0x34, 0xFE, 0x95,
+	0x8F, 0x80, 0xC8, 0xD9, 0x99, 0xF1, 0x98, 0x88,
+	0xC2, 0x5F, 0x02, 0xE6, 0xCE, 0xD5, 0x1D, 0x6C,
+	0xCA, 0x2D, 0x0E, 0xFC, 0xEF, 0xB8, 0x7C, 0xE5,
+	0x14, 0xD4, 0x95, 0x6A, 0x05, 0x76, 0xB1, 0x45,
+	0x40, 0x41, 0x95, 0x41, 0xFD, 0x1F, 0x65, 0x10,
+	0x29, 0xEB, 0xB5, 0xEE, 0x18, 0xF7, 0x14, 0x84,
+	0x87, 0x88, 0xE4, 0xCF, 0x53, 0x1A, 0xED, 0x5F,
+	0xC2, 0x53, 0xBA, 0xEF, 0x88, 0x95, 0x7F, 0x39,
+	0x7C, 0x54, 0x7C, 0x9E, 0x1D, 0x39, 0x67, 0x48,
+	0x6D, 0x95, 0x93, 0x8E, 0x89, 0x35, 0xE3, 0xC0,
+	0xC6, 0x76, 0xB3, 0x90, 0x58, 0x63, 0x9E, 0x1F,
+	0xB3, 0x73, 0xD4, 0x93, 0x91, 0x60, 0x8C, 0x06,
+	0xC6, 0xD6, 0x23, 0x5E, 0x1E, 0x4F, 0x5E, 0xF0,
+	0x80, 0xF7, 0x0A, 0x79, 0xB4, 0x4F, 0xF7, 0xA0,
+	0xE5, 0x80, 0x9E, 0x0B, 0x18, 0xF0, 0x38, 0x73,
+	0x90, 0x71, 0xAE, 0xF6, 0xAC, 0x92, 0x38, 0x55,
+	0x1C, 0xCB, 0x10, 0xF2, 0xE8, 0xE3, 0x51, 0x0D,
+	0xB9, 0x63, 0x38, 0xD7, 0x5C, 0xDF, 0xBC, 0x21,
+	0x25, 0xC9, 0x61, 0xF4, 0x9F, 0xB6, 0xC0, 0xB3,
+	0x9C, 0xBA, 0xA4, 0x0F, 0x66, 0x32, 0x18, 0xEF,
+	0xCB, 0xB2, 0x15, 0x38, 0xEF, 0x09, 0x0B, 0x19,
+	0x6B, 0xD8, 0xFE, 0x34, 0x83, 0x5B, 0xB3, 0x15,
+	0xD1, 0xB7, 0x0B, 0x71, 0xCC, 0x9D, 0x18, 0xE3,
+	0x4A, 0xAD, 0x11, 0xFB, 0x34, 0xD2, 0x92, 0x4B,
+	0xA8, 0x71, 0x23, 0xB8, 0xE4, 0x3E, 0x04, 0xFF,
+	0xE2, 0xF8, 0xAE, 0x93, 0x9C, 0x11, 0xBF, 0x99,
+	0xA6, 0xD9, 0xB4, 0x28, 0x2D, 0x15, 0xDA, 0xD0,
+	0x91, 0x0B, 0x09, 0x19, 0x80, 0x98, 0x25, 0x9A,
+	0x5E, 0x9D, 0x07, 0xC3, 0x04, 0x7F, 0x0C, 0x37,
+	0x12, 0x05, 0x50, 0xDF, 0xC4, 0xA2, 0xCD, 0x71,
+	0x0A, 0x5E, 0x36, 0x60, 0x14, 0x7F, 0xDA, 0xA7,
+	0xEF, 0x20, 0x30, 0x05, 0x6B, 0xAF, 0x3B, 0x32,
+	0xEE, 0x56, 0x32, 0xC1, 0x4E, 0x02, 0xC6, 0xCA,
+	0x61, 0xE6, 0x3E, 0x20, 0x62, 0x7C, 0x09, 0xE9,
+	0x8D, 0xE4, 0x83, 0xB3, 0x64, 0xBF, 0xB9, 0x80,
+	0xB3, 0xEA, 0x87, 0xA5, 0x6B, 0x12, 0xBC, 0x20,
+	0xAA, 0xE7, 0xC2, 0x23, 0x55, 0x72, 0x70, 0x01,
+	0xA7, 0x27, 0x64, 0x48, 0x09, 0x34, 0x12, 0x79,
+	0xC3, 0xE7, 0xA3, 0x19, 0x54, 0x3E, 0xF8, 0xFB,
+	0xA4, 0x13, 0xE0, 0x7F, 0x15, 0xAB, 0x27, 0x21,
+	0x4F, 0x53, 0x80, 0xDE, 0xF6, 0x95, 0x32, 0x03,
+	0x05, 0x60, 0x3A, 0xAA, 0xE3, 0xC2, 0xD7, 0x5D,
+	0x74, 0xB3, 0xB3, 0x42, 0x67, 0x03, 0x44, 0xD3,
+	0x51, 0x2B, 0x35, 0x71, 0x9E, 0x66, 0xD1, 0x8A,
+	0x48, 0x3E, 0xA9, 0xF0, 0xFB, 0x5F, 0x59, 0x7C,
+	0x7D, 0x08, 0xA8, 0x02, 0xA5, 0xC3, 0x5D, 0x0B,
+	0x2E, 0xEF, 0x8C, 0x4D, 0x2B, 0xD3, 0x31, 0xD3,
+	0x36, 0x7E, 0xFD, 0x70, 0xD8, 0x12, 0x53, 0xBC,
+	0xC9, 0xEA, 0xFE, 0x35, 0xF7, 0x67, 0x5D, 0x76,
+	0x85, 0x69, 0x2E, 0xD7, 0x4C, 0xDA, 0x5B, 0x9D,
+	0x72, 0x79, 0x79, 0x7D, 0xEE, 0xE2, 0xA4, 0x18,
+	0x2F, 0xD9, 0xD7, 0x38, 0xDB, 0x85, 0xFD, 0x9B,
+	0xCD, 0x40, 0x41, 0x1A, 0xAB, 0x93, 0x7F, 0x30,
+	0xCF, 0x79, 0x7F, 0x4B, 0xDC, 0xA6, 0x27, 0xB2,
+	0x18, 0xDB, 0x73, 0x54, 0x69, 0xB0, 0x6E, 0x2E,
+	0x6A, 0xB8, 0x1E, 0x96, 0xFC, 0xBA, 0xFD, 0xDD,
+	0x05, 0x40, 0xEE, 0xB8, 0x67, 0x4F, 0x90, 0x83,
+	0xFB, 0xF5, 0x2F, 0xB3, 0x51, 0x7D, 0x20, 0x8D,
+	0x93, 0x15, 0x62, 0x48, 0x41, 0x09, 0x11, 0xFF,
+	0x68, 0x02, 0xE0, 0x03, 0xA2, 0x62, 0x7B, 0x55,
+	0x7A, 0xC1, 0x95, 0xC3, 0xD7, 0x57, 0x1D, 0x15,
+	0xDD, 0x6B, 0x8C, 0xB6, 0xF9, 0x08, 0x2B, 0x34,
+	0x54, 0x8A, 0xA6, 0xB8, 0x3F, 0x25, 0x3A, 0x90,
+	0x1D, 0xAD, 0xD7, 0x31, 0x87, 0x05, 0xDC, 0x46,
+	0x69, 0x2A, 0x7F, 0xD3, 0x16, 0x37, 0x1A, 0xD4,
+	0x38, 0xDD, 0x95, 0x7C, 0x3C, 0xAD, 0x7C, 0xFC,
+	0x7E, 0xA9, 0x44, 0xED, 0x16, 0x08, 0xD4, 0x9E,
+	0xCC, 0x50, 0xFD, 0x5D, 0xDA, 0x8D, 0xAF, 0x3A,
+	0x45, 0x1B, 0x7F, 0xB8, 0x9B, 0x5D, 0x5B, 0x05,
+	0xAE, 0xC9, 0x3F, 0xED, 0x17, 0xF9, 0x33, 0x65,
+	0x7A, 0x11, 0x33, 0xE2, 0x0A, 0x64, 0x4A, 0xE0,
+	0xC3, 0x95, 0xB7, 0x77, 0x00, 0xF7, 0x87, 0x96,
+	0x1A, 0x93, 0xEE, 0x27, 0x20, 0x09, 0xC4, 0x70,
+	0xBF, 0x03, 0x31, 0x53, 0x67, 0x93, 0xAA, 0x22,
+	0x56, 0xD5, 0x91, 0x26, 0xEA, 0x1F, 0xD3, 0x5E,
+	0x47, 0xF8, 0x6D, 0x61, 0x24, 0x6F, 0xDF, 0x57,
+	0xCE, 0xF8, 0x0A, 0x2D, 0x56, 0x6B, 0x62, 0xAE,
+	0xC4, 0xE6, 0x2E, 0xB5, 0x8D, 0x12, 0xEC, 0x87,
+	0x58, 0xCA, 0x9F, 0x2B, 0x38, 0xE8, 0xF3, 0x38,
+	0x7B, 0xC2, 0x44, 0x8F, 0xBE, 0x36, 0x5F, 0xF0,
+	0x59, 0xA4, 0x58, 0x94, 0x87, 0x85, 0xC0, 0x19,
+	0x3F, 0xF7, 0x21, 0xEC, 0xB8, 0x81, 0x25, 0x20,
+	0x50, 0xED, 0x57, 0xD0, 0x65, 0xED, 0x82, 0x6B,
+	0x13, 0x23, 0x8C, 0x44, 0x18, 0x00, 0x7D, 0x11,
+	0xB3, 0x63, 0xB6, 0x07, 0xD2, 0x8D, 0xD8, 0x21,
+	0xCE, 0x1E, 0xBD, 0x9C, 0x2B, 0x9B, 0xE5, 0x5F,
+	0x7F, 0x8C, 0x88, 0x2E, 0x9F, 0x2D, 0x16, 0xA3,
+	0x18, 0xFE, 0xD9, 0x2F, 0x9D, 0x6B, 0x0F, 0xA5,
+	0xB0, 0x20, 0x6C, 0x60, 0xBB, 0x8E, 0x28, 0x0E,
+	0xF8, 0x01, 0x1C, 0xE1, 0xF1, 0xF7, 0x0F, 0xAB,
+	0xF3, 0xED, 0x17, 0xAE, 0xA5, 0xF6, 0xFE, 0x5E,
+	0x64, 0x0D, 0xBD, 0x8E, 0x4C, 0xC6, 0xC0, 0x59,
+	0x41, 0x4E, 0x8B, 0xC6, 0x1D, 0x86, 0x40, 0x3C,
+	0x2A, 0xCD, 0x36, 0xC1, 0xA9, 0xA9, 0x10, 0x41,
+	0xC9, 0x9C, 0x60, 0x49, 0xC9, 0x7E, 0x72, 0xA4,
+	0x95, 0xCB, 0x71, 0x70, 0x7B, 0x8B, 0x3F, 0x34,
+	0xD2, 0x0F, 0xCC, 0x37, 0xD3, 0x20, 0x9B, 0xD3,
+	0xB9, 0x4A, 0x63, 0xB0, 0x02, 0xC2, 0xBD, 0x8B,
+	0x82, 0x48, 0x73, 0xE4, 0xE2, 0x66, 0xD2, 0x9D,
+	0x48, 0xF2, 0x0B, 0x5E, 0x1F, 0x63, 0xB0, 0x4D,
+	0x0A, 0x45, 0x71, 0xEA, 0xC3, 0xFA, 0xD1, 0x2B,
+	0xF0, 0x74, 0x45, 0xDF, 0xCA, 0x7B, 0x7C, 0x22,
+	0x3C, 0xB0, 0x9A, 0x05, 0x14, 0x71, 0x6F, 0x83,
+	0x62, 0x53, 0x31, 0x69, 0x39, 0x49, 0xCC, 0x40,
+	0x6F, 0x94, 0xCE, 0x71, 0x29, 0xD1, 0x9A, 0x57,
+	0x0D, 0x6B, 0x72, 0x4C, 0x11, 0x97, 0x85, 0x7C,
+	0x0E, 0x66, 0xFD, 0xC1, 0x71, 0x5C, 0xA0, 0x21,
+	0xA5, 0xC1, 0x1F, 0x5F, 0x2E, 0xF5, 0xA1, 0x61,
+	0xE6, 0xD4, 0x68, 0x13, 0x94, 0xBE, 0x64, 0xFB,
+	0xE3, 0x09, 0x85, 0xF0, 0x42, 0xA6, 0x43, 0xFD,
+	0x3C, 0x08, 0x5A, 0xEF, 0x5F, 0x3F, 0xD2, 0x9A,
+	0x2A, 0xC5, 0x24, 0xEC, 0x5E, 0xFF, 0xBF, 0xD9,
+	0x4D, 0x1A, 0x98, 0x3F, 0xFA, 0xFD, 0x9C, 0xD9,
+	0x50, 0xCE, 0xD6, 0xF4, 0x7B, 0x52, 0xD0, 0x41,
+	0x7B, 0x74, 0x7D, 0xFE, 0xFC, 0x83, 0x24, 0x1D,
+	0x3F, 0xA0, 0x6E, 0xC5, 0xBA, 0xD7, 0xD4, 0x06,
+	0x45, 0x28, 0x15, 0x18, 0x4C, 0xF7, 0x43, 0x19,
+	0x09, 0xDE, 0xCF, 0x79, 0xBA, 0xBC, 0xC0, 0x03,
+	0x0E, 0xCB, 0x7D, 0xC7, 0x39, 0x9E, 0x4E, 0x53,
+	0x6D, 0xCA, 0x10, 0x44, 0x04, 0xED, 0x67, 0xD0,
+	0x0C, 0x9F, 0xBA, 0x87, 0x14, 0xB8, 0x08, 0x73,
+	0x9D, 0x00, 0x18, 0xDE, 0x19, 0xDF, 0x5F, 0xEC,
+	0xB0, 0x54, 0x7A, 0x3B, 0x76, 0xBA, 0x0D, 0xD0,
+	0x65, 0x43, 0x65, 0x19, 0xF9, 0x45, 0x71, 0xA2,
+	0x49, 0x87, 0xC6, 0xE0, 0x32, 0x46, 0x8F, 0x82,
+	0xE8, 0x69, 0x2B, 0x35, 0x10, 0x29, 0x03, 0x63,
+	0xEF, 0xBB, 0x2D, 0xE1, 0x41, 0x77, 0xA4, 0xA6,
+	0xA8, 0xE1, 0xA5, 0xBD, 0x65, 0xD9, 0x0D, 0xE8,
+	0x6E, 0xB6, 0x2A, 0xDF, 0x22, 0xB8, 0x3C, 0x85,
+	0x65, 0x65, 0x80, 0xED, 0xC5, 0xE7, 0x32, 0x54,
+	0xA4, 0x45, 0x20, 0x97, 0x2F, 0xEE, 0x7D, 0x6F,
+	0x71, 0x18, 0xF1, 0x34, 0xA3, 0x03, 0x6E, 0x48,
+	0xE5, 0x79, 0xA1, 0xCA, 0xAF, 0xBB, 0x73, 0x1A,
+	0x36, 0x63, 0x53, 0xC2, 0xFC, 0x8F, 0x10, 0xE4,
+	0x8D, 0x2E, 0x41, 0xF9, 0xFB, 0x7E, 0x05, 0xB8,
+	0x71, 0x8B, 0xB8, 0x91, 0xB7, 0x7F, 0x30, 0xDD,
+	0x19, 0xAE, 0x3D, 0xC0, 0x7F, 0xB6, 0xFC, 0x97,
+	0xD7, 0x7B, 0xD3, 0x9D, 0x96, 0x6C, 0xC6, 0x0A,
+	0x3A, 0x25, 0x46, 0x16, 0x91, 0xAF, 0xC5, 0xC9,
+	0x45, 0x9C, 0x52, 0xD6, 0x14, 0x7C, 0x3F, 0x16,
+	0x16, 0xFD, 0x7F, 0xF9, 0x9D, 0x47, 0x78, 0x84,
+	0xA2, 0x4B, 0xE3, 0x2B, 0xDD, 0xDB, 0x6D, 0x73,
+	0x74, 0xB0, 0x6B, 0xA6, 0x91, 0x3C, 0xD0, 0x07,
+	0x80, 0xDA, 0x81, 0x2C, 0x45, 0xB0, 0x40, 0x56,
+	0x3A, 0x14, 0xD6, 0x70, 0x6D, 0x72, 0x73, 0xD5,
+	0x5F, 0xB7, 0x1B, 0xD5, 0xD8, 0x57, 0x50, 0xFF,
+	0x37, 0xA1, 0xF1, 0xD7, 0x6C, 0xF0, 0x11, 0x05,
+	0xA5, 0xD5, 0x62, 0x2B, 0x96, 0x3A, 0xE1, 0xDA,
+	0x2D, 0x81, 0x57, 0xA6, 0x4C, 0xDA, 0xB5, 0x00,
+	0xFD, 0x61, 0x89, 0xED, 0x1A, 0x38, 0xFA, 0xB3,
+	0xB4, 0x04, 0x26, 0xD9, 0x30, 0xF0, 0xA9, 0x5A,
+	0xCF, 0xF4, 0x3C, 0xFF, 0x3B, 0x2F, 0x16, 0x23,
+	0x25, 0xC4, 0x2E, 0xCD, 0x09, 0xCA, 0x92, 0x57,
+	0xF1, 0x7A, 0x39, 0x7E, 0x49, 0xD5, 0x6B, 0xF8,
+	0xAC, 0xEC, 0x00, 0xF1, 0xC7, 0xE7, 0xAC, 0x8E,
+	0xA1, 0xE1, 0x67, 0x57, 0x6A, 0x23, 0x26, 0xE9,
+	0x02, 0xF0, 0x42, 0x04, 0x21, 0xAC, 0xB4, 0x1A,
+	0x55, 0xD8, 0x05, 0xDC, 0x3B, 0x09, 0x20, 0xD6,
+	0x24, 0xD8, 0xED, 0x8F, 0x8F, 0x60, 0xAB, 0xFB,
+	0x39, 0xEC, 0x85, 0x89, 0x6D, 0x76, 0x8A, 0xD7,
+	0xC3, 0x80, 0x47, 0x70, 0x9F, 0x2A, 0x03, 0xE3,
+	0x7D, 0x41, 0xF2, 0x1E, 0x6F, 0x2A, 0x5B, 0x88,
+	0x59, 0xDF, 0x23, 0x82, 0x2B, 0x4F, 0x11, 0x21,
+	0xA9, 0x86, 0xF3, 0x01, 0x44, 0x71, 0xA5, 0x96,
+	0x94, 0x52, 0x95, 0xBA, 0xD1, 0x27, 0xFE, 0x24,
+	0x94, 0xB7, 0xCA, 0x99, 0x4A, 0x40, 0xB3, 0x93,
+	0x34, 0xD8, 0xB8, 0x66, 0xE3, 0xA3, 0x5C, 0x4F,
+	0x42, 0x6B, 0x33, 0xD5, 0x62, 0x0F, 0x14, 0x12,
+	0x04, 0x6D, 0x21, 0x7A, 0xFA, 0x93, 0xD7, 0xDC,
+	0xDF, 0x6C, 0x48, 0x39, 0xC8, 0x1E, 0x2E, 0x2D,
+	0x57, 0x16, 0xC8, 0x49, 0xC2, 0x33, 0xCD, 0xDD,
+	0xD0, 0xA9, 0x34, 0xFC, 0x25, 0x31, 0x8B, 0x59,
+	0x28, 0x85, 0xE0, 0x15, 0x2B, 0x7B, 0xE9, 0xC2,
+	0xD7, 0x28, 0x11, 0xBE, 0xF9, 0xA6, 0x6A, 0xDC,
+	0xE7, 0x4A, 0x39, 0x45, 0x01, 0x8D, 0x33, 0x1E,
+	0x78, 0x2C, 0x5A, 0xBD, 0x99, 0x80, 0xD9, 0x1E,
+	0x47, 0xCC, 0x7D, 0x2A, 0xF8, 0xD6, 0x00, 0x4C,
+	0x3E, 0xDD, 0x2D, 0xF9, 0x6A, 0x97, 0xD6, 0xB0,
+	0x09, 0x0B, 0x74, 0x5A, 0xB4, 0x29, 0xC7, 0xD8,
+	0x69, 0x2C, 0x3E, 0x12, 0x72, 0x37, 0x03, 0x7E,
+	0xB0, 0x28, 0x09, 0x55, 0x41, 0xA3, 0x55, 0x02,
+	0xF1, 0x7E, 0x3F, 0xEA, 0x6B, 0x95, 0x98, 0x36,
+	0x47, 0x58, 0xB2, 0xF3, 0xA5, 0xC1, 0xF2, 0x24,
+	0xD3, 0xC9, 0x8B, 0x6A, 0x85, 0x25, 0x46, 0x46,
+	0xFA, 0x84, 0xC2, 0x8E, 0x10, 0x50, 0xAD, 0x32,
+	0x52, 0xB6, 0x2B, 0x44, 0x9E, 0xD5, 0x32, 0x18,
+	0x20, 0x1D, 0xE1, 0x69, 0xC6, 0x5A, 0x1D, 0x2B,
+	0x5A, 0x3B, 0xA8, 0xF9, 0xE8, 0xC6, 0x76, 0xDF,
+	0x31, 0xF9, 0xF5, 0x21, 0xF8, 0x84, 0xD5, 0x37,
+	0x35, 0xCA, 0xCA, 0x05, 0x3E, 0x56, 0xC6, 0x28,
+	0x6E, 0x08, 0x91, 0x16, 0xE0, 0x13, 0x4C, 0x9F,
+	0xD7, 0x26, 0x2A, 0x0A, 0x7F, 0xAE, 0x85, 0x4C,
+	0x7D, 0x83, 0x18, 0xDF, 0x43, 0xBF, 0x3D, 0x91,
+	0x26, 0x68, 0x2B, 0x77, 0x4B, 0xBB, 0xF5, 0x7A,
+	0xFE, 0xA3, 0x17, 0x3B, 0x92, 0x27, 0x86, 0xDC,
+	0xB5, 0xC3, 0x3C, 0xD0, 0xC5, 0x71, 0xAC, 0xB8,
+	0x12, 0xB4, 0x6A, 0xE6, 0x4E, 0xCF, 0xAC, 0x14,
+	0x3C, 0xA3, 0x01, 0x08, 0xF8, 0x48, 0x62, 0x62,
+	0x30, 0x6C, 0xB5, 0xC1, 0x6F, 0x53, 0x8B, 0xA8,
+	0xC7, 0xA7, 0x59, 0x50, 0x45, 0x48, 0x8E, 0x3C,
+	0x69, 0x58, 0x7B, 0x5A, 0x15, 0x97, 0xC1, 0xD5,
+	0x38, 0xEA, 0x37, 0xE0, 0x9B, 0xA6, 0xD7, 0x61,
+	0xA6, 0x8C, 0xAF, 0x01, 0x83, 0xB7, 0xCE, 0x45,
+	0xE2, 0x69, 0xAE, 0x35, 0xF8, 0xDA, 0x6A, 0x58,
+	0x77, 0x1B, 0x1B, 0x95, 0xBB, 0xF7, 0x8C, 0x1D,
+	0x22, 0x4C, 0x98, 0xC5, 0x6C, 0x04, 0x4F, 0x18,
+	0x51, 0x67, 0x31, 0xD0, 0x01, 0xCD, 0x80, 0x59,
+	0x07, 0x81, 0xB0, 0x0C, 0x70, 0x44, 0xB5, 0x75,
+	0xF8, 0xAB, 0x00, 0x51, 0x01, 0x6C, 0x71, 0x9E,
+	0x54, 0x48, 0x4B, 0x54, 0x18, 0x60, 0x95, 0x87,
+	0xB8, 0x19, 0x9B, 0xD9, 0xED, 0x44, 0xE7, 0x61,
+	0x52, 0xF0, 0x4F, 0xA0, 0x76, 0xEA, 0x6F, 0x54,
+	0x15, 0xDD, 0xD3, 0x07, 0xC2, 0x3A, 0x91, 0x27,
+	0xAD, 0x11, 0x54, 0x32, 0x9D, 0x89, 0x5F, 0x7B,
+	0x81, 0x67, 0x5B, 0x0E, 0x6B, 0x59, 0xD9, 0x5E,
+	0x08, 0x9B, 0x80, 0xAE, 0xB2, 0x78, 0x74, 0xDB,
+	0x38, 0x84, 0xD3, 0xD7, 0xD5, 0xFA, 0x3E, 0xF5,
+	0xAC, 0xDC, 0x5C, 0x93, 0xD1, 0x00, 0xFA, 0x27,
+	0x9F, 0x5F, 0xE4, 0x58, 0x2A, 0x40, 0x98, 0x32,
+	0x13, 0x92, 0x03, 0x5E, 0x77, 0x38, 0x99, 0x8A,
+	0x63, 0x6E, 0x13, 0x63, 0x43, 0xA3, 0xE3, 0x76,
+	0x1C, 0xD6, 0x1A, 0xBB, 0xB5, 0xDA, 0x6C, 0xA9,
+	0x23, 0xCE, 0xA1, 0xE2, 0xD8, 0x99, 0x5F, 0x4B,
+	0x5A, 0xE7, 0xA9, 0x8C, 0x08, 0x6F, 0x5A, 0xE5,
+	0x9A, 0x81, 0xE3, 0xC6, 0x8F, 0x9C, 0xB0, 0x8A,
+	0x98, 0x9A, 0x33, 0xC5, 0xC5, 0x92, 0x54, 0x66,
+	0xB5, 0xEC, 0x33, 0xE2, 0xA4, 0x33, 0x05, 0x27,
+	0x2D, 0x98, 0x22, 0x16, 0x02, 0xD3, 0xCF, 0xEB,
+	0x43, 0x83, 0x6E, 0x9F, 0xF3, 0x1B, 0x29, 0x0A,
+	0x87, 0x8C, 0xF7, 0x78, 0x36, 0x3C, 0xD8, 0x12,
+	0xE8, 0xB3, 0x3C, 0x6B, 0xD3, 0x99, 0xA9, 0x4A,
+	0xDB, 0x3E, 0xAA, 0x03, 0x82, 0xF5, 0x3F, 0xC0,
+	0xD3, 0xCA, 0xA6, 0xA5, 0x9F, 0xEE, 0x92, 0xB1,
+	0x23, 0x2E, 0xAE, 0xDD, 0xB0, 0x5D, 0xD2, 0xFE,
+	0x33, 0xAC, 0x01, 0x18, 0xC5, 0xEB, 0x4C, 0x8E,
+	0xEB, 0xF7, 0xEF, 0x84, 0x34, 0x6A, 0x34, 0x73,
+	0xF8, 0xC0, 0xC1, 0x9F, 0x12, 0xE3, 0x4E, 0x9F,
+	0x80, 0x77, 0x74, 0x78, 0xC0, 0xE6, 0x50, 0x26,
+	0x62, 0x56, 0xA8, 0xDE, 0x07, 0x62, 0x2C, 0xA5,
+	0xEF, 0xA8, 0x8B, 0x81, 0x34, 0xE3, 0xAD, 0x45,
+	0xDE, 0xD5, 0x8C, 0x54, 0xD8, 0xDA, 0x7B, 0xE7,
+	0xB4, 0xD5, 0x33, 0xE4, 0x9A, 0xD4, 0x01, 0xA2,
+	0xC9, 0x91, 0x6C, 0xBA, 0xE5, 0x7D, 0x5F, 0x48,
+	0x60, 0xE5, 0x43, 0x2B, 0xE5, 0x38, 0xC4, 0x87,
+	0xDE, 0x06, 0xDA, 0x17, 0x24, 0x70, 0x59, 0x11,
+	0x64, 0x5E, 0xC7, 0x10, 0x9C, 0x87, 0x81, 0x00,
+	0x8C, 0x48, 0x77, 0xAE, 0x59, 0xB2, 0xD2, 0x37,
+	0xD2, 0xA2, 0x50, 0x0D, 0x74, 0x8D, 0xC7, 0xC6,
+	0x84, 0xAD, 0xD6, 0x0F, 0xB1, 0x8A, 0x8D, 0x54,
+	0x44, 0x73, 0xEA, 0xA9, 0x40, 0x64, 0xFD, 0x25,
+	0xE2, 0x07, 0x1E, 0xB1, 0x36, 0x79, 0xA4, 0xF7,
+	0x61, 0x9C, 0x25, 0xB3, 0x64, 0xF4, 0x71, 0xBE,
+	0x7D, 0x74, 0x41, 0x4E, 0x39, 0x72, 0x9B, 0x59,
+	0x2F, 0x06, 0x39, 0xEC, 0xD6, 0x69, 0x15, 0x57,
+	0x3B, 0x7E, 0x39, 0x8E, 0x9B, 0x96, 0xE4, 0x67,
+	0xED, 0x37, 0x4C, 0x36, 0x3A, 0x5A, 0xA6, 0x4D,
+	0x2A, 0x9A, 0xFD, 0xCD, 0x49, 0x18, 0x48, 0x3F,
+	0x57, 0x1A, 0x5B, 0xBF, 0xFD, 0x88, 0xBE, 0xC7,
+	0x62, 0xDF, 0xB1, 0x9C, 0xB7, 0x61, 0x78, 0xED,
+	0xA6, 0x8D, 0x34, 0x74, 0x34, 0xE6, 0xE7, 0x66,
+	0xD0, 0xC2, 0x62, 0x04, 0xB8, 0x9B, 0xD3, 0x11,
+	0xF9, 0x73, 0x2A, 0x98, 0x0F, 0x03, 0xDF, 0xB3,
+	0x22, 0x6A, 0x14, 0xCE, 0xA3, 0x20, 0xF2, 0x59,
+	0xAC, 0x51, 0x23, 0x0A, 0x55, 0x7E, 0x66, 0x6C,
+	0xF4, 0x17, 0x52, 0x8F, 0xC8, 0xB9, 0x1F, 0x91,
+	0xC6, 0x11, 0x1C, 0x99, 0x43, 0x55, 0x88, 0x0C,
+	0x5D, 0x03, 0x0D, 0xCD, 0x8C, 0x96, 0xD0, 0xA3,
+	0x05, 0xE4, 0x3B, 0xD1, 0x91, 0x05, 0xE8, 0x6D,
+	0x4E, 0x00, 0xBC, 0x98, 0xE1, 0xF5, 0x82, 0x4E,
+	0xA1, 0x9F, 0xD8, 0xDA, 0xA4, 0x00, 0x41, 0x90,
+	0x3B, 0x61, 0x8D, 0xFD, 0x8E, 0xC2, 0xCA, 0x99,
+	0xED, 0xF3, 0x2E, 0x1F, 0x39, 0x7E, 0x4A, 0x56,
+	0x6A, 0x47, 0x71, 0xB9, 0xC4, 0xB8, 0x60, 0x04,
+	0x3A, 0x8B, 0x2A, 0x17, 0x40, 0x64, 0xBE, 0x86,
+	0x78, 0x7D, 0xAA, 0x9B, 0x85, 0x92, 0x0F, 0x1B,
+	0x70, 0x18, 0x31, 0x87, 0x68, 0x2A, 0xA2, 0x7A,
+	0x3E, 0x0C, 0xD8, 0x13, 0x1A, 0xE0, 0xBB, 0x06,
+	0x5B, 0xCC, 0x08, 0x7D, 0xEA, 0x0A, 0x87, 0x4F,
+	0x8B, 0xFA, 0xA9, 0x99, 0xA3, 0xC5, 0x23, 0xD6,
+	0x08, 0x4B, 0xD9, 0x12, 0x7C, 0x8C, 0xEB, 0x97,
+	0xCD, 0xD7, 0x5E, 0x49, 0x28, 0x33, 0x10, 0x78,
+	0x8E, 0x2C, 0xB3, 0xDB, 0xB5, 0x00, 0x4C, 0x41,
+	0x8A, 0x2F, 0x59, 0x2E, 0xD8, 0x85, 0x6A, 0x92,
+	0xF7, 0xA2, 0x37, 0x69, 0x12, 0xC3, 0x6C, 0x43,
+	0x73, 0xF4, 0x52, 0x96, 0xC3, 0x77, 0x19, 0x2A,
+	0x6A, 0xEC, 0x1F, 0xEE, 0x17, 0xFA, 0x00, 0xEB,
+	0xBC, 0x1E, 0x45, 0x7C, 0x5F, 0xFD, 0xFD, 0x7B,
+	0x41, 0x31, 0x5D, 0x84, 0xB0, 0x6E, 0x37, 0x61,
+	0xB8, 0x0B, 0xD0, 0x72, 0x60, 0x5B, 0x7C, 0xD7,
+	0x77, 0x7E, 0x9D, 0x40, 0xD9, 0x61, 0x69, 0xED,
+	0xF6, 0x0D, 0x8A, 0x09, 0xB0, 0x6B, 0xED, 0xCD,
+	0xB5, 0x31, 0x9F, 0x76, 0xA6, 0xE8, 0xF3, 0xFC,
+	0xDD, 0x6B, 0xA2, 0x61, 0xC4, 0x8A, 0xD0, 0x14,
+	0x53, 0xE4, 0x74, 0xA1, 0x40, 0x57, 0x1A, 0xAC,
+	0x8B, 0x2E, 0x91, 0xC0, 0x0F, 0x27, 0xFF, 0x04,
+	0x64, 0x50, 0x2F, 0xC5, 0x91, 0x48, 0x3C, 0xFF,
+	0x59, 0xE0, 0xCD, 0xAE, 0x3C, 0x7F, 0x79, 0x52,
+	0x6D, 0xCE, 0x5F, 0x6D, 0x77, 0x66, 0xF6, 0xA5,
+	0xCA, 0x7F, 0x01, 0x8F, 0x50, 0xF4, 0x5A, 0x15,
+	0x49, 0xEB, 0x01, 0x7D, 0xEE, 0xDC, 0xDB, 0x8D,
+	0x83, 0x85, 0x8F, 0xC6, 0x45, 0xB0, 0xEC, 0x89,
+	0xE2, 0x69, 0x33, 0x6D, 0xE1, 0xC1, 0x68, 0xF2,
+	0x0A, 0x51, 0x4E, 0xDD, 0x5A, 0x77, 0xF6, 0xE3,
+	0xFA, 0x46, 0x93, 0x98, 0x7D, 0xB0, 0x1E, 0x2E,
+	0x6C, 0x4B, 0x87, 0x6E, 0x0C, 0x89, 0x1C, 0xDF,
+	0xA5, 0x66, 0xEF, 0xB6, 0x62, 0x82, 0x48, 0x90,
+	0xD3, 0x00, 0xC0, 0xF0, 0x7A, 0x53, 0xBF, 0x76,
+	0x6D, 0x84, 0xF3, 0x99, 0xBD, 0x7F, 0xE5, 0x21,
+	0x1F, 0x11, 0xE3, 0x16, 0x59, 0x5E, 0x23, 0x0E,
+	0xDB, 0xD3, 0xEE, 0x0E, 0xC2, 0x10, 0x53, 0x87,
+	0x0A, 0xC6, 0x43, 0xFB, 0xB7, 0xE5, 0x0E, 0x1E,
+	0xF6, 0x46, 0xD3, 0xCD, 0x5A, 0x8D, 0x70, 0x09,
+	0xAB, 0xE7, 0x74, 0x60, 0x04, 0x11, 0x37, 0x43,
+	0x32, 0xBC, 0x31, 0x43, 0xA4, 0x23, 0xAB, 0x2C,
+	0x46, 0x37, 0xB7, 0xB5, 0x41, 0xBF, 0x04, 0x3D,
+	0xE3, 0x20, 0x94, 0x1A, 0xDA, 0x78, 0xEA, 0x4C,
+	0xFA, 0x30, 0x15, 0x5E, 0x06, 0x22, 0x2E, 0xAA,
+	0x9B, 0x72, 0x22, 0xB8, 0x26, 0x6A, 0xD2, 0xBA,
+	0x5F, 0x75, 0x14, 0x4D, 0xB2, 0xE6, 0xCC, 0xE1,
+	0xFF, 0x29, 0x9B, 0x74, 0x73, 0xED, 0xE0, 0xA0,
+	0x1D, 0x60, 0x9D, 0x3B, 0xB5, 0xEB, 0x76, 0x25,
+	0xD5, 0xFC, 0xDF, 0xB4, 0x3B, 0x0E, 0xEE, 0xD6,
+	0x93, 0x16, 0x64, 0x83, 0x9C, 0x46, 0xA6, 0xBF,
+	0xCF, 0x9C, 0x56, 0xD6, 0x31, 0xB4, 0x5B, 0xC1,
+	0x54, 0x68, 0x1A, 0x81, 0xBA, 0x0A, 0x16, 0x00,
+	0x8A, 0x81, 0xFD, 0x64, 0xC0, 0xB3, 0xB7, 0x46,
+	0x78, 0xB4, 0xDE, 0x16, 0xB3, 0xB1, 0x1F, 0xED,
+	0x60, 0x21, 0x33, 0x0A, 0xFC, 0xDA, 0x03, 0x0D,
+	0x76, 0x50, 0x53, 0x9E, 0xC4, 0xE8, 0xA1, 0xE0,
+	0x0C, 0xA2, 0x30, 0x56, 0xB9, 0xEF, 0xC2, 0xB0,
+	0x5C, 0x61, 0x14, 0x02, 0x75, 0xE0, 0x27, 0x37,
+	0x88, 0x66, 0x12, 0x93, 0x4F, 0xFA, 0xE2, 0xA0,
+	0xF4, 0x86, 0x13, 0xB3, 0x14, 0xF4, 0x5A, 0x26,
+	0xAA, 0xC5, 0x26, 0x63, 0x55, 0xBB, 0xD7, 0xBF,
+	0xB6, 0x26, 0x77, 0x41, 0x20, 0x18, 0x92, 0x73,
+	0x56, 0x91, 0x05, 0x55, 0x6D, 0xBE, 0x17, 0xBD,
+	0xCA, 0x60, 0xF0, 0xD2, 0xB5, 0x05, 0xA8, 0x30,
+	0x82, 0xFB, 0x54, 0x00, 0x80, 0x16, 0x9B, 0x9F,
+	0x45, 0x8D, 0x8A, 0x2B, 0x07, 0x1A, 0xF4, 0x1C,
+	0xF3, 0x5C, 0xEF, 0x20, 0x85, 0x21, 0xC2, 0x8F,
+	0x99, 0xE1, 0x53, 0x6C, 0x19, 0x2C, 0x58, 0x33,
+	0xFA, 0xAB, 0xAD, 0x9F, 0x80, 0x2A, 0xA0, 0xE5,
+	0xF9, 0x99, 0x27, 0x52, 0x72, 0xFD, 0x83, 0x6F,
+	0x93, 0x71, 0x60, 0x42, 0x9B, 0xF7, 0x28, 0x30,
+	0x16, 0xA2, 0x71, 0x2E, 0x6D, 0x33, 0x60, 0x79,
+	0xD4, 0xD4, 0x9F, 0x0F, 0xF4, 0x91, 0xCC, 0xED,
+	0x8A, 0xB2, 0x74, 0xB0, 0x88, 0x67, 0x1C, 0xD7,
+	0x80, 0x6E, 0xA7, 0x20, 0x7F, 0x5B, 0x11, 0x54,
+	0xA3, 0xBC, 0xE6, 0x0D, 0x23, 0x61, 0x7A, 0x73,
+	0x57, 0x17, 0xB5, 0xF4, 0x7C, 0x60, 0xC4, 0x41,
+	0x93, 0xAE, 0x5C, 0x87, 0x28, 0xCC, 0x18, 0x07,
+	0x77, 0x99, 0x7E, 0xB7, 0x24, 0xF4, 0x7B, 0x28,
+	0xCE, 0xA6, 0x34, 0x4D, 0x4B, 0xE7, 0x4B, 0xC1,
+	0xE0, 0xEE, 0xCF, 0x39, 0xE9, 0x47, 0x8C, 0x76,
+	0xF1, 0x59, 0x7C, 0x97, 0x59, 0x55, 0xE8, 0xA9,
+	0xB1, 0x4A, 0x2A, 0x86, 0xE6, 0x39, 0xC3, 0x22,
+	0x83, 0x51, 0x1F, 0xE8, 0x4E, 0x3D, 0xF1, 0x30,
+	0xB1, 0x3A, 0x69, 0x37, 0xF1, 0x73, 0xD2, 0x5C,
+	0x4D, 0x13, 0x55, 0xA4, 0x6F, 0x6C, 0x55, 0x1D,
+	0x36, 0x7B, 0x70, 0x7B, 0x21, 0x33, 0xBA, 0xB0,
+	0xC4, 0xA9, 0xF6, 0x18, 0xE6, 0x30, 0x04, 0xE7,
+	0xAA, 0x77, 0x93, 0x3A, 0xA9, 0x7A, 0x2E, 0xAE,
+	0xD8, 0x13, 0xFA, 0xB3, 0x8A, 0x24, 0xA3, 0x31,
+	0xCF, 0xAC, 0x2D, 0x51, 0x5D, 0xF5, 0x3D, 0xF0,
+	0xEC, 0x6E, 0x95, 0x17, 0xF8, 0xC7, 0xC5, 0x7F,
+	0x9C, 0x57, 0x7E, 0xC1, 0x7D, 0xFB, 0x44, 0x7A,
+	0x9C, 0x2D, 0x1F, 0x38, 0x40, 0x2E, 0xE7, 0xD2,
+	0x6A, 0x5C, 0xC4, 0x17, 0xE2, 0xE9, 0xB9, 0x39,
+	0x6E, 0xCC, 0x50, 0x4D, 0xE7, 0xF6, 0xFE, 0x7E,
+	0x5B, 0x0E, 0x5B, 0xA7, 0x92, 0x38, 0xCB, 0x21,
+	0x92, 0x3C, 0xFE, 0x2B, 0x17, 0x63, 0x64, 0xEE,
+	0xA7, 0x19, 0xE4, 0x02, 0x87, 0x8F, 0xED, 0xF7,
+	0x62, 0x8A, 0xA1, 0xC5, 0xB3, 0xE3, 0xAE, 0x01,
+	0x73, 0x92, 0x4E, 0x76, 0x14, 0xD9, 0x8C, 0x36,
+	0x85, 0x69, 0x41, 0xF6, 0xCC, 0x1D, 0x95, 0x1D,
+	0xE8, 0x97, 0x3C, 0xF8, 0xE3, 0xD9, 0x19, 0x29,
+	0xE0, 0x70, 0x94, 0x0B, 0x87, 0x70, 0x60, 0x64,
+	0x56, 0x40, 0xFF, 0x6B, 0xDB, 0xDF, 0x70, 0x6C,
+	0xE9, 0x4F, 0x35, 0x20, 0xD1, 0x82, 0xB4, 0xF8,
+	0x02, 0x12, 0xE6, 0xBD, 0x02, 0x08, 0xA9, 0x0A,
+	0x8C, 0xE4, 0x9A, 0xB6, 0x84, 0xAD, 0xFB, 0x1D,
+	0xE5, 0xE6, 0x67, 0x9B, 0x2B, 0x9D, 0xA5, 0xF4,
+	0xD2, 0x2E, 0x53, 0x7E, 0xE8, 0x5D, 0x10, 0x3F,
+	0xB6, 0x1A, 0x32, 0x06, 0x7F, 0xA6, 0x48, 0xD0,
+	0xE8, 0xA9, 0xB2, 0xAB, 0x1F, 0xCF, 0x84, 0x16,
+	0xBF, 0x9F, 0x27, 0x57, 0x42, 0x61, 0xEE, 0x72,
+	0x86, 0xEC, 0xE3, 0xB9, 0x7F, 0x90, 0xB1, 0xE1,
+	0x1E, 0xC6, 0x38, 0xCB, 0x6C, 0x41, 0x8C, 0x4A,
+	0x0F, 0x89, 0xBF, 0x72, 0x64, 0x97, 0x38, 0x07,
+	0xF6, 0x05, 0x27, 0x6C, 0xE4, 0xA1, 0x83, 0xC2,
+	0xC8, 0x6A, 0xC4, 0xF7, 0xCF, 0xCC, 0x6A, 0x97,
+	0xA8, 0x70, 0x79, 0x3B, 0x18, 0x8F, 0xBB, 0x0E,
+	0xC1, 0xD9, 0xBE, 0xC0, 0xA1, 0x05, 0x9A, 0x57,
+	0xA4, 0xC8, 0x5B, 0xBA, 0x9B, 0x48, 0x33, 0xD1,
+	0x27, 0x5E, 0x21, 0x22, 0xEC, 0xCB, 0x2C, 0x16,
+	0xE5, 0x9F, 0x3F, 0x9B, 0x1F, 0xF6, 0xE9, 0xBA,
+	0x0D, 0xFA, 0x9A, 0xD8, 0xB6, 0xD4, 0x35, 0x3E,
+	0xAB, 0x19, 0x74, 0xEC, 0x0C, 0x21, 0xB2, 0x61,
+	0x68, 0x88, 0x73, 0xAD, 0xBB, 0x79, 0x46, 0x3C,
+	0xF6, 0xD4, 0xA5, 0xA6, 0x02, 0x20, 0x00, 0xE3,
+	0xF1, 0xFD, 0x56, 0xDE, 0xF8, 0xF0, 0xE0, 0xAF,
+	0x01, 0x8A, 0x08, 0x30, 0xDD, 0xE1, 0xFC, 0xB7,
+	0xD1, 0xE2, 0x6F, 0x61, 0x5D, 0x45, 0x5D, 0xA0,
+	0x8B, 0xA3, 0xB3, 0x80, 0x14, 0xEB, 0x82, 0x0F,
+	0x43, 0x68, 0x0E, 0xD5, 0x32, 0x98, 0x0F, 0x30,
+}};
+
+// bdh-params6
+static const union
+{
+	octet o[12288];
+	word w[1];
+} _bdh_params6_pre =
+{{
+	0xE4, 0xB8, 0xAE, 0x13, 0x4A, 0x58, 0x2E, 0x48,
+	0x37, 0x83, 0x3A, 0xE9, 0xD6, 0x67, 0x42, 0x69,
+	0x2D, 0x7B, 0x00, 0x29, 0xF7, 0xD2, 0x00, 0x25,
+	0x2B, 0xAD, 0x47, 0x27, 0x6C, 0xA2, 0x2B, 0x48,
+	0xF7, 0x46, 0x03, 0x17, 0x2A, 0x07, 0x36, 0x4C,
+	0x91, 0x03, 0x1D, 0x55, 0x61, 0x59, 0x3A, 0x3D,
+	0xD8, 0x92, 0xE7, 0x7A, 0x16, 0xC0, 0x7D, 0xE0,
+	0xC0, 0xFF, 0xAE, 0x1D, 0x5C, 0x33, 0x9A, 0x17,
+	0x44, 0xAB, 0xFD, 0xEA, 0x77, 0xDF, 0xE8, 0x99,
+	0x10, 0x3F, 0xC2, 0x9F, 0x92, 0x07, 0xF9, 0x8C,
+	0xCC, 0xE2, 0x4C, 0xC0, 0x2C, 0x0D, 0xEF, 0x1B,
+	0x16, 0x6B, 0x97, 0x45, 0x43, 0x16, 0x04, 0xCF,
+	0x95, 0xE7, 0x5F, 0x81, 0xA5, 0xDD, 0x1D, 0x13,
+	0x2D, 0x6A, 0x21, 0xF2, 0xC8, 0xDB, 0xA3, 0xEA,
+	0x2E, 0xDE, 0xA3, 0xED, 0x7A, 0x2D, 0x0C, 0x7E,
+	0x9C, 0xE9, 0xB5, 0xE4, 0x6E, 0xF7, 0x89, 0x7F,
+	0x49, 0x19, 0x67, 0x20, 0x2E, 0x8C, 0xFE, 0x7F,
+	0x84, 0xB5, 0xE5, 0x53, 0x52, 0x4B, 0x7D, 0xD0,
+	0x64, 0xB6, 0xF4, 0xCF, 0x48, 0xB9, 0x52, 0x78,
+	0x80, 0x5B, 0xC8, 0x3A, 0x3D, 0x6B, 0x02, 0x11,
+	0xAD, 0xA9, 0x62, 0x9C, 0x7A, 0x56, 0x1D, 0x1E,
+	0x8E, 0x87, 0x4E, 0x2A, 0xDD, 0xD5, 0xC4, 0xAA,
+	0xBC, 0x16, 0x83, 0xCC, 0xAD, 0xD0, 0xEA, 0x4B,
+	0x6B, 0x29, 0x58, 0x51, 0xBE, 0x82, 0x0F, 0x1A,
+	0xB2, 0x85, 0x48, 0xF3, 0x48, 0xEB, 0xE7, 0x5A,
+	0xBD, 0x23, 0xCE, 0x48, 0xB7, 0x2E, 0x92, 0xC5,
+	0x78, 0x0F, 0x74, 0xC2, 0xD7, 0xDF, 0x35, 0x1D,
+	0x76, 0x31, 0x54, 0x3F, 0xEE, 0x2C, 0x40, 0xB4,
+	0xE2, 0x9B, 0x5E, 0x7B, 0x94, 0xF9, 0x34, 0xD8,
+	0xA1, 0xD8, 0x71, 0x5E, 0x25, 0xC5, 0x21, 0xE4,
+	0xCE, 0xFC, 0xA4, 0x13, 0x22, 0xDF, 0x78, 0x8C,
+	0x6A, 0x71, 0xFD, 0x64, 0x4E, 0xE5, 0x74, 0x60,
+	0x1B, 0xCC, 0x01, 0xEC, 0x99, 0xF6, 0xCE, 0x18,
+	0xE2, 0x53, 0x4D, 0xA0, 0xA6, 0x85, 0x4B, 0xF6,
+	0xC8, 0xC6, 0xF9, 0xB0, 0x59, 0x3E, 0x31, 0x3A,
+	0x1A, 0x20, 0x6D, 0xB7, 0xB7, 0xC6, 0x54, 0x45,
+	0xA3, 0x00, 0xB1, 0x33, 0x06, 0x09, 0x2B, 0x97,
+	0x0D, 0xD7, 0x98, 0xC7, 0x32, 0x15, 0xC5, 0x3A,
+	0x97, 0xD3, 0xB4, 0xAF, 0xE1, 0xF9, 0x25, 0x08,
+	0xD1, 0xE5, 0x22, 0x13, 0x56, 0xAD, 0x88, 0xD2,
+	0xCD, 0xA0, 0xD7, 0x73, 0xD9, 0x62, 0x76, 0xC1,
+	0x47, 0x50, 0xBF, 0x1E, 0xD8, 0x7D, 0x58, 0x8B,
+	0xC7, 0xC5, 0x47, 0xEE, 0xB7, 0x57, 0xA9, 0xC3,
+	0xAF, 0x25, 0xC8, 0x7B, 0x8F, 0x13, 0x3A, 0x3C,
+	0xFD, 0x6F, 0x7D, 0xEE, 0x66, 0xF7, 0xD0, 0x9A,
+	0xCC, 0xA7, 0xCB, 0xB3, 0x0B, 0x4D, 0xDA, 0x41,
+	0xB4, 0x21, 0x84, 0xF9, 0xBD, 0xF4, 0xE3, 0x6B,
+	0xEF, 0x90, 0x3E, 0x5E, 0xB6, 0xA8, 0xE7, 0x24,
+	0x68, 0x70, 0x90, 0xA9, 0x0F, 0xD1, 0xBB, 0x87,
+	0x03, 0x83, 0xEC, 0xB6, 0x2B, 0x1D, 0xEF, 0xAA,
+	0x15, 0xE4, 0x04, 0x24, 0x3F, 0x8A, 0x2C, 0xDB,
+	0x65, 0x0A, 0x5F, 0x53, 0x16, 0xD5, 0x1A, 0x4E,
+	0x63, 0xEE, 0xB7, 0xD0, 0x59, 0x7D, 0xEA, 0x58,
+	0xE7, 0x06, 0x84, 0x25, 0xFD, 0x2E, 0x0B, 0x50,
+	0x16, 0x74, 0xE9, 0xD3, 0x7D, 0xAC, 0x3A, 0x55,
+	0x1C, 0x73, 0x78, 0x3F, 0x97, 0x55, 0x2A, 0x29,
+	0xA7, 0x5C, 0x69, 0x5D, 0x3D, 0x4E, 0x3A, 0xC6,
+	0x47, 0x63, 0xD4, 0x4D, 0x86, 0x96, 0x83, 0xE7,
+	0x40, 0x1C, 0x49, 0xF5, 0xAA, 0x10, 0x46, 0x2B,
+	0xAB, 0xCC, 0xFE, 0xF6, 0x8D, 0xC8, 0xFE, 0xA3,
+	0x5F, 0x5B, 0x95, 0x11, 0xBB, 0x51, 0x37, 0xF4,
+	0x7D, 0xE4, 0x78, 0xCA, 0x16, 0x83, 0xEF, 0x53,
+	0x15, 0x74, 0x23, 0xC8, 0x94, 0x11, 0xDE, 0x66,
+	0x27, 0xAD, 0xE9, 0xAF, 0xB5, 0xA7, 0x02, 0x1E,
+	0x7B, 0x15, 0x39, 0xB2, 0x9F, 0x80, 0x02, 0x0C,
+	0x3E, 0xAB, 0x14, 0x97, 0xD3, 0x31, 0x3E, 0x15,
+	0x13, 0x0C, 0x52, 0x6A, 0xF6, 0xFB, 0x47, 0x94,
+	0x20, 0x88, 0x8F, 0x93, 0xC7, 0xD6, 0x97, 0xF5,
+	0x72, 0x70, 0x45, 0xF4, 0xD9, 0x7A, 0x1F, 0x69,
+	0xB1, 0xFD, 0xDB, 0x37, 0x29, 0x9E, 0xBA, 0x00,
+	0x31, 0x0A, 0x0E, 0x7B, 0xFA, 0x74, 0xBC, 0xF1,
+	0x78, 0x11, 0x67, 0x6A, 0xC4, 0xF1, 0x9D, 0x28,
+	0xB4, 0xBC, 0xBE, 0x12, 0x1C, 0x39, 0x6F, 0xBC,
+	0x08, 0x4B, 0xE3, 0xC0, 0x61, 0xFB, 0xED, 0x36,
+	0x06, 0x18, 0x0D, 0x71, 0x73, 0x92, 0x87, 0x82,
+	0x48, 0xF5, 0x47, 0x89, 0xA4, 0x4C, 0xA7, 0xEF,
+	0xE0, 0xBD, 0x5D, 0x12, 0x9A, 0x12, 0xC4, 0x14,
+	0xC6, 0xDB, 0xC6, 0x8B, 0xA4, 0x5C, 0xF8, 0x19,
+	0x84, 0x78, 0x1B, 0x5F, 0x78, 0xAB, 0x04, 0x1B,
+	0x25, 0x42, 0xE0, 0x68, 0x7F, 0x32, 0x09, 0xA7,
+	0x5D, 0xDC, 0x39, 0x8E, 0x3D, 0xB1, 0xF5, 0xA3,
+	0x4A, 0x3A, 0x04, 0x95, 0x3B, 0x22, 0x83, 0x3E,
+	0x98, 0xB5, 0x13, 0x99, 0xFF, 0x93, 0x7E, 0x26,
+	0x83, 0x64, 0x70, 0x1F, 0x82, 0xB5, 0x12, 0x7F,
+	0xC8, 0x22, 0x9A, 0x88, 0x55, 0x30, 0xFB, 0xB0,
+	0x6A, 0xB5, 0xEE, 0x31, 0x60, 0x75, 0x7E, 0x72,
+	0x18, 0x5A, 0xFD, 0xA7, 0x88, 0xD6, 0xF5, 0x8B,
+	0xC1, 0x48, 0xEB, 0x35, 0x4D, 0xE8, 0xF2, 0xE0,
+	0xF0, 0xF8, 0x93, 0x83, 0x82, 0x91, 0x49, 0xBA,
+	0x8A, 0x3A, 0xF5, 0x81, 0x3F, 0x40, 0x8D, 0x8C,
+	0x16, 0xAA, 0x20, 0x68, 0x7A, 0x74, 0xAD, 0xE1,
+	0xBD, 0xF4, 0xBB, 0x84, 0xCD, 0x7C, 0xCE, 0xC2,
+	0x2C, 0x19, 0xB8, 0xDA, 0x18, 0x61, 0xFC, 0xAB,
+	0x3E, 0x6B, 0x2B, 0xE1, 0x61, 0x06, 0xC2, 0x18,
+	0x6D, 0x5C, 0xA1, 0xBE, 0x37, 0x2C, 0xFD, 0xB3,
+	0xD0, 0x32, 0x15, 0xB8, 0xAE, 0xE5, 0x72, 0x1C,
+	0x42, 0xE5, 0x2C, 0x68, 0xC8, 0xCC, 0x3C, 0x1A,
+	0xF6, 0xEF, 0x6C, 0xEB, 0x5D, 0x96, 0x6F, 0xCD,
+	0x9C, 0xC7, 0xE3, 0x09, 0x04, 0x5F, 0xCF, 0x1E,
+	0x4F, 0x0B, 0xD3, 0xCA, 0x63, 0x5B, 0xC7, 0xBA,
+	0x84, 0xE2, 0x31, 0x1C, 0x0C, 0xE7, 0xDA, 0x93,
+	0x77, 0x3A, 0x6C, 0x28, 0xFF, 0xE4, 0x7F, 0xAA,
+	0x48, 0x30, 0x36, 0x97, 0x8D, 0x68, 0xA9, 0x23,
+	0x80, 0xB5, 0x58, 0x0C, 0x64, 0x31, 0x95, 0xBF,
+	0xCC, 0x7B, 0x73, 0x3C, 0x2E, 0x86, 0xCB, 0xE5,
+	0x5F, 0x23, 0x59, 0x9F, 0xA4, 0x5A, 0x85, 0xAC,
+	0x6F, 0xBD, 0xA1, 0x47, 0x7F, 0x6B, 0xBB, 0xBC,
+	0x75, 0x2F, 0xB4, 0x6C, 0x8E, 0x78, 0x70, 0xE2,
+	0xA8, 0xB5, 0xF7, 0xB9, 0x09, 0x8C, 0x8B, 0x17,
+	0x4D, 0xD6, 0x04, 0xAE, 0x0D, 0x5B, 0x7D, 0xC0,
+	0x91, 0x04, 0x7D, 0xF8, 0xB9, 0x58, 0xE4, 0x07,
+	0x58, 0xAD, 0x00, 0x4B, 0x8C, 0xEB, 0x51, 0xFC,
+	0x1D, 0x1D, 0x62, 0x83, 0x70, 0xD5, 0xFA, 0x4A,
+	0x89, 0x19, 0xD6, 0x9A, 0x58, 0x6D, 0x72, 0x50,
+	0x14, 0xE8, 0xDE, 0x61, 0x57, 0x6F, 0xE1, 0x19,
+	0x6F, 0x5B, 0x24, 0x0B, 0x6E, 0xAC, 0x19, 0x65,
+	0x52, 0x44, 0x60, 0x87, 0xD8, 0x71, 0x23, 0x17,
+	0xF7, 0x79, 0x00, 0x6B, 0xF0, 0x37, 0xE3, 0x33,
+	0x99, 0x36, 0xAA, 0xDA, 0x3C, 0xD3, 0x1E, 0x60,
+	0xC0, 0xAC, 0xA3, 0xB9, 0xE8, 0xBC, 0x19, 0x05,
+	0x87, 0x64, 0xDD, 0x60, 0x8A, 0x80, 0x69, 0x76,
+	0xFF, 0xDD, 0xFE, 0x0D, 0x8E, 0xC9, 0xDA, 0x6E,
+	0xBA, 0x27, 0x00, 0x28, 0xA3, 0x3B, 0x90, 0x46,
+	0xC6, 0x66, 0xA1, 0x56, 0x62, 0xDB, 0xA0, 0xE6,
+	0x66, 0x5C, 0x2F, 0xBC, 0x03, 0x9D, 0xCC, 0x5D,
+	0xE7, 0xA6, 0xA4, 0xEF, 0x46, 0xD9, 0x8F, 0xB8,
+	0x90, 0xF6, 0x60, 0x49, 0x13, 0x8D, 0x67, 0xA6,
+	0x32, 0xED, 0x46, 0x29, 0x14, 0x0B, 0x94, 0x34,
+	0xC7, 0x60, 0x54, 0x25, 0x3B, 0x80, 0xFD, 0x46,
+	0xAE, 0xAA, 0x55, 0x09, 0x24, 0x0E, 0x39, 0x53,
+	0x5A, 0xFD, 0x0F, 0x18, 0xA2, 0x60, 0x6E, 0x37,
+	0xD9, 0xB5, 0xD9, 0xEF, 0x56, 0x59, 0x68, 0x65,
+	0xCA, 0x68, 0xDF, 0x1B, 0xA4, 0x4E, 0xB8, 0x9D,
+	0xEF, 0x14, 0x53, 0x6E, 0xD8, 0xB5, 0xB5, 0xD7,
+	0x8B, 0xAE, 0x8D, 0x7C, 0xAB, 0xD0, 0x62, 0xF0,
+	0x61, 0xC4, 0x32, 0x62, 0xE0, 0xE2, 0xC8, 0x9C,
+	0x40, 0x9E, 0x6A, 0xD8, 0x7C, 0x95, 0x84, 0xA1,
+	0x3F, 0xC4, 0x2F, 0x61, 0x19, 0x6F, 0xF2, 0xB7,
+	0x69, 0xFA, 0xBC, 0x1A, 0x4D, 0x33, 0xC2, 0xDA,
+	0x0E, 0xC2, 0x03, 0x65, 0x3D, 0xE0, 0xE5, 0x98,
+	0xB4, 0x4C, 0x9B, 0x01, 0xAE, 0x27, 0x85, 0xF8,
+	0x73, 0xDB, 0xEE, 0x19, 0x7D, 0xF4, 0x2B, 0x01,
+	0x1F, 0x13, 0xD7, 0x5F, 0x81, 0x31, 0xA4, 0x66,
+	0x00, 0xBC, 0x3C, 0x09, 0xF3, 0x39, 0xD6, 0x09,
+	0xFE, 0x53, 0xC3, 0x5E, 0xB1, 0x84, 0x3F, 0x87,
+	0xFB, 0x06, 0x18, 0x54, 0xB1, 0x8A, 0xFA, 0x6D,
+	0x11, 0x3C, 0x5F, 0x12, 0x5E, 0x96, 0xCC, 0xAE,
+	0x6D, 0xFF, 0xFC, 0x58, 0x3D, 0x96, 0xDC, 0xF3,
+	0x83, 0x44, 0xB9, 0xDC, 0xBE, 0x6C, 0xDD, 0x7F,
+	0x41, 0x32, 0xBF, 0x22, 0x6C, 0xB1, 0xAF, 0xD6,
+	0xE4, 0x52, 0xBA, 0x4C, 0xAC, 0x01, 0x9E, 0x94,
+	0x2E, 0xC5, 0xE9, 0x55, 0x14, 0x14, 0x04, 0x10,
+	0xCC, 0xC6, 0x89, 0x3D, 0xA4, 0xF1, 0xAD, 0x74,
+	0xCB, 0x2F, 0x1A, 0x64, 0x67, 0x9F, 0x93, 0x5C,
+	0xF8, 0x74, 0x73, 0x8A, 0x52, 0x7D, 0x64, 0x4E,
+	0x06, 0xD1, 0xE8, 0xBE, 0x06, 0x97, 0xA7, 0x38,
+	0x2D, 0x1A, 0x1E, 0x01, 0xC1, 0x98, 0x7B, 0xE3,
+	0xC3, 0x3A, 0x4B, 0xC3, 0xBE, 0xC9, 0x46, 0x62,
+	0xC6, 0x41, 0x4D, 0x4A, 0x45, 0xA3, 0xB7, 0x2C,
+	0xB7, 0x0E, 0x32, 0xA1, 0x25, 0x1A, 0x86, 0xD3,
+	0x53, 0x91, 0xAC, 0xAD, 0xC3, 0x33, 0x4B, 0x10,
+	0xC1, 0x12, 0x43, 0x53, 0xD0, 0x21, 0xEB, 0xDB,
+	0x23, 0x89, 0xF3, 0x0D, 0xF3, 0xCF, 0x4B, 0x6A,
+	0x20, 0x02, 0xE8, 0xFB, 0x69, 0xC9, 0x88, 0xC0,
+	0x4B, 0xA9, 0x40, 0x15, 0x55, 0xB5, 0xCE, 0x65,
+	0xB5, 0x6D, 0x96, 0xF3, 0xAD, 0x3D, 0xEF, 0xF7,
+	0x26, 0xF1, 0xD2, 0xCA, 0x53, 0x47, 0xD7, 0x31,
+	0x2E, 0x2B, 0xF3, 0xA7, 0x8E, 0x4D, 0xA8, 0x32,
+	0xC8, 0x4A, 0x1D, 0x1F, 0xE9, 0xC5, 0x2A, 0xDE,
+	0x81, 0x94, 0xA4, 0xE3, 0x51, 0x35, 0x6C, 0x05,
+	0x0B, 0x01, 0xB7, 0xC0, 0x2A, 0xA4, 0x03, 0xB7,
+	0xCD, 0xFE, 0xBE, 0x6D, 0x17, 0xCB, 0x01, 0xC3,
+	0x56, 0xFC, 0x6A, 0xCA, 0xB3, 0x66, 0xEB, 0xC1,
+	0x5F, 0x57, 0x8A, 0xAA, 0x6D, 0x01, 0x5D, 0x67,
+	0x08, 0x18, 0x41, 0xA2, 0xBA, 0x88, 0x4F, 0x4F,
+	0x89, 0xF0, 0x3C, 0xD9, 0xD1, 0xB1, 0x92, 0x8F,
+	0x47, 0x6B, 0xF4, 0xDB, 0x36, 0x4F, 0x0E, 0x08,
+	0x9D, 0x94, 0xDF, 0x94, 0xBA, 0x60, 0x85, 0xC8,
+	0x39, 0x5B, 0x8D, 0x6C, 0x4B, 0xBD, 0x2B, 0x11,
+	0x22, 0x5E, 0x74, 0x60, 0xE1, 0x24, 0x9E, 0xD5,
+	0x1A, 0x2C, 0x33, 0x40, 0x89, 0x0D, 0x67, 0x7E,
+	0xD5, 0x55, 0x7B, 0xD1, 0xB0, 0xB6, 0x8F, 0x20,
+	0x0D, 0x1A, 0xBD, 0x5B, 0x0A, 0x2E, 0x63, 0x3A,
+	0x6B, 0x32, 0xEE, 0x03, 0x5F, 0x32, 0x2F, 0x24,
+	0xEA, 0xA9, 0x9B, 0xFD, 0x6F, 0xC8, 0x68, 0xDA,
+	0x14, 0xB8, 0x04, 0x1C, 0xD1, 0x9C, 0x00, 0x58,
+	0xE4, 0x5D, 0x16, 0x64, 0x8E, 0x97, 0x65, 0x89,
+	0xEA, 0xB8, 0xDC, 0xB6, 0x04, 0xE4, 0xBE, 0xD5,
+	0xE2, 0xE0, 0x58, 0x00, 0xDC, 0x42, 0x8E, 0x97,
+	0x32, 0x3E, 0x88, 0xC0, 0x23, 0x93, 0xA8, 0x9A,
+	0x5D, 0x98, 0x49, 0xF5, 0xCE, 0x7D, 0x0F, 0xCE,
+	0x5D, 0xB2, 0x39, 0x57, 0xBB, 0xD3, 0x23, 0x32,
+	0x18, 0x46, 0x28, 0xE0, 0x92, 0x22, 0x70, 0xC4,
+	0xA5, 0x21, 0xCA, 0x88, 0x40, 0x88, 0x2F, 0x9A,
+	0xBE, 0x92, 0x7F, 0x1D, 0x14, 0x9B, 0xAA, 0xE0,
+	0xC9, 0x8B, 0xE5, 0xA0, 0xA1, 0x1B, 0x7B, 0xE2,
+	0xD9, 0xD4, 0x98, 0xAB, 0x9A, 0xDB, 0x46, 0x2A,
+	0xF0, 0x16, 0xA3, 0x8A, 0xCE, 0xEB, 0xA8, 0xDF,
+	0x20, 0xC5, 0x5A, 0x5E, 0x8D, 0xCD, 0x99, 0xA5,
+	0x77, 0x31, 0xB4, 0x16, 0x12, 0x8B, 0x2C, 0x52,
+	0xF0, 0x69, 0x06, 0x19, 0x20, 0xEF, 0x48, 0xCE,
+	0x12, 0x1D, 0x59, 0x54, 0x84, 0xFC, 0xA2, 0x78,
+	0xE7, 0xCE, 0x8A, 0x20, 0x60, 0xAC, 0xB8, 0x43,
+	0x50, 0xBF, 0x45, 0xD0, 0x51, 0xF0, 0x80, 0x36,
+	0x0F, 0x09, 0xF3, 0x26, 0x6C, 0xC9, 0x6C, 0x94,
+	0x39, 0xC4, 0xA1, 0x95, 0xCB, 0xF8, 0x23, 0x32,
+	0xD7, 0x57, 0x9E, 0x5F, 0x04, 0xBB, 0xD1, 0xEC,
+	0x77, 0xA3, 0xDF, 0x8C, 0x0A, 0xED, 0x3A, 0x92,
+	0x53, 0x97, 0xB3, 0x97, 0x79, 0xD1, 0x8D, 0xCC,
+	0x85, 0x5C, 0x4D, 0x3A, 0xEB, 0x84, 0x76, 0x32,
+	0x0D, 0xD0, 0xF4, 0x3B, 0xBD, 0x38, 0x1D, 0xA8,
+	0x3A, 0xCB, 0x8F, 0x37, 0xE6, 0x49, 0xB0, 0x7E,
+	0xB5, 0x7A, 0x35, 0x08, 0x56, 0xF8, 0xD1, 0x15,
+	0xE9, 0xDD, 0x2E, 0x4A, 0x3D, 0x67, 0x48, 0x32,
+	0x6D, 0xCA, 0xD0, 0x6A, 0xD2, 0x8D, 0xB2, 0x1C,
+	0x0E, 0xAE, 0x2A, 0x25, 0x3A, 0xF0, 0x7E, 0x04,
+	0x47, 0x3B, 0xB6, 0xAF, 0x07, 0x00, 0x33, 0x58,
+	0x3B, 0x0F, 0xCE, 0x9E, 0xC8, 0x0F, 0x21, 0x7E,
+	0x6E, 0xC8, 0xC9, 0xB5, 0xE3, 0x84, 0x0E, 0x48,
+	0x2F, 0xF0, 0xDD, 0x62, 0xD8, 0x91, 0xA4, 0x67,
+	0x49, 0xEF, 0xF3, 0x35, 0x28, 0x9F, 0x01, 0x5E,
+	0x2F, 0x41, 0xAA, 0x09, 0x5D, 0x60, 0x19, 0x34,
+	0x21, 0x0D, 0xB0, 0xF3, 0x60, 0x6B, 0xEA, 0x54,
+	0xBD, 0xD4, 0x1E, 0xB4, 0x8B, 0x91, 0x0F, 0x11,
+	0x44, 0xFF, 0xB1, 0x69, 0x6E, 0x9F, 0x1E, 0x19,
+	0x5C, 0x79, 0xAF, 0xA6, 0xC3, 0x01, 0xF4, 0x4A,
+	0x41, 0xBF, 0x8F, 0x72, 0x0C, 0x5E, 0x1A, 0x10,
+	0xE2, 0x89, 0xEA, 0xF5, 0x44, 0xED, 0x0F, 0x8C,
+	0x44, 0xBD, 0x10, 0x9C, 0xDB, 0x40, 0x21, 0x0F,
+	0x64, 0x19, 0x11, 0x72, 0x44, 0xA4, 0xCA, 0x49,
+	0x1C, 0xC2, 0x3C, 0x6D, 0xE0, 0x1A, 0x75, 0x20,
+	0x8B, 0xF8, 0xC4, 0x74, 0x81, 0xAF, 0xDE, 0x0A,
+	0xD2, 0x53, 0xDE, 0x0C, 0x68, 0xC8, 0xA0, 0x81,
+	0xE5, 0x8E, 0x30, 0xD9, 0xB3, 0xEB, 0x2A, 0x28,
+	0x09, 0x9E, 0x6B, 0x75, 0x66, 0x86, 0xE8, 0x92,
+	0x79, 0x2B, 0xC2, 0x49, 0xF8, 0x7C, 0x61, 0xD3,
+	0xDF, 0x98, 0xB2, 0x0D, 0xC8, 0xCE, 0xAD, 0xDC,
+	0x7F, 0x8F, 0x19, 0x54, 0xE7, 0x1D, 0xC1, 0x97,
+	0x25, 0x7A, 0xAE, 0x36, 0x92, 0xF3, 0xE5, 0xA9,
+	0x97, 0x3C, 0x89, 0x86, 0x0F, 0x67, 0x0B, 0x04,
+	0xE6, 0xEF, 0x1B, 0x66, 0xE2, 0x5A, 0xC2, 0x26,
+	0x0F, 0xB4, 0xD5, 0x49, 0xA4, 0x11, 0xB8, 0x29,
+	0x33, 0xD6, 0x6B, 0xE1, 0x19, 0x48, 0xE3, 0x64,
+	0xC7, 0x9E, 0xAD, 0x82, 0x9E, 0x69, 0x76, 0xB8,
+	0xDB, 0xDE, 0x57, 0x39, 0xDC, 0xA9, 0xF8, 0x1E,
+	0x87, 0x46, 0xB3, 0x27, 0x0D, 0x5F, 0x29, 0xC4,
+	0x61, 0xC2, 0xC3, 0x72, 0xAC, 0x32, 0x36, 0x5B,
+	0x33, 0xA5, 0xF4, 0x39, 0x5B, 0x68, 0xC4, 0x11,
+	0x5F, 0xEA, 0xC5, 0x0E, 0xA2, 0xD2, 0x97, 0xBE,
+	0x7D, 0x6C, 0x23, 0x66, 0x55, 0xE0, 0x4C, 0x33,
+	0x8D, 0x6D, 0x4C, 0x0F, 0x8A, 0x40, 0xDF, 0xD1,
+	0xFE, 0xCA, 0x60, 0x82, 0x39, 0x5A, 0x62, 0x53,
+	0x9C, 0x75, 0x21, 0xF1, 0xCD, 0x43, 0x9C, 0x4F,
+	0x2A, 0x8D, 0xB5, 0x52, 0x97, 0x51, 0x64, 0x29,
+	0x08, 0xF2, 0x76, 0x8B, 0xE3, 0x9A, 0xAB, 0x26,
+	0xEE, 0x8B, 0x0C, 0xE8, 0xB7, 0xE8, 0x84, 0xE9,
+	0xC5, 0x35, 0xCF, 0x0E, 0xA6, 0x08, 0x20, 0xBF,
+	0xD4, 0xEC, 0xFA, 0x33, 0x3C, 0x62, 0x70, 0xAB,
+	0xCB, 0xD2, 0x5E, 0x01, 0xB5, 0xF2, 0xAC, 0xF4,
+	0xE3, 0x68, 0x8A, 0xD4, 0x21, 0x32, 0x22, 0xC1,
+	0x7B, 0xB9, 0x78, 0x17, 0x56, 0x85, 0xA2, 0x9A,
+	0xA7, 0xFC, 0x8D, 0x98, 0x60, 0xDD, 0x0D, 0xE0,
+	0xD8, 0x8C, 0xC9, 0x26, 0x4D, 0x5A, 0x34, 0x4E,
+	0x3B, 0x4D, 0xEB, 0x7B, 0xF1, 0xDF, 0xC4, 0x31,
+	0xB0, 0x45, 0xDA, 0x0C, 0xED, 0xE3, 0x5E, 0xD1,
+	0x12, 0x81, 0x3C, 0xB8, 0x36, 0x91, 0xFC, 0xD9,
+	0x79, 0x46, 0xDA, 0x41, 0x30, 0x7A, 0xB0, 0x25,
+	0x76, 0x73, 0x54, 0x2C, 0x74, 0xBE, 0xB3, 0xBB,
+	0x43, 0x36, 0xDA, 0xC1, 0xFB, 0x4E, 0xD7, 0x18,
+	0x6F, 0xDE, 0x12, 0x89, 0xD6, 0x62, 0xFD, 0xF4,
+	0x98, 0x60, 0x3B, 0x93, 0x1B, 0x62, 0xB6, 0x63,
+	0xEB, 0x8B, 0x0A, 0x02, 0xF3, 0xC5, 0xEE, 0x00,
+	0x7D, 0xB0, 0xDC, 0x56, 0xA3, 0x39, 0x4F, 0xF3,
+	0x5A, 0xAE, 0x7F, 0x62, 0xAA, 0xAB, 0x48, 0x4E,
+	0x51, 0x0E, 0xAF, 0x95, 0x0B, 0x46, 0x68, 0xA9,
+	0xDF, 0x9F, 0x3E, 0x67, 0xA1, 0x92, 0xF8, 0xA0,
+	0xF9, 0x60, 0xB5, 0x3E, 0x16, 0x59, 0x41, 0x59,
+	0x8F, 0x01, 0x4E, 0xAF, 0x55, 0x3B, 0x1F, 0x81,
+	0x3F, 0x7F, 0x40, 0x21, 0xD9, 0x5A, 0x60, 0xFA,
+	0xE6, 0xE5, 0xAC, 0xB8, 0x0D, 0x62, 0x8C, 0x6B,
+	0x99, 0x39, 0xC4, 0xCC, 0xC1, 0xD2, 0x42, 0x62,
+	0x28, 0x1C, 0xDF, 0x15, 0xC3, 0x78, 0x5F, 0xDE,
+	0x95, 0x7E, 0x26, 0x78, 0xE0, 0xBC, 0x2B, 0xB2,
+	0x39, 0x20, 0xB0, 0x69, 0xCE, 0xE4, 0x3E, 0xA3,
+	0x42, 0x5B, 0x2A, 0xE7, 0xD1, 0x96, 0x37, 0x15,
+	0xDE, 0x29, 0x93, 0xCA, 0x3D, 0x8E, 0xB9, 0x0E,
+	0xD2, 0x5E, 0x53, 0xC9, 0x19, 0x9A, 0x80, 0x6B,
+	0xEB, 0x7A, 0xA7, 0xDD, 0x17, 0xED, 0x7C, 0x08,
+	0x95, 0x45, 0x3C, 0xAA, 0xF3, 0xC0, 0xA2, 0x40,
+	0x52, 0x6D, 0xE5, 0xAB, 0x95, 0x17, 0x1E, 0x05,
+	0xBA, 0xC0, 0x23, 0x98, 0x3A, 0xDB, 0x59, 0x3A,
+	0xB3, 0x4C, 0xE6, 0x32, 0x7D, 0x71, 0x93, 0x5E,
+	0x75, 0xC2, 0x43, 0x88, 0x29, 0xB9, 0xA0, 0x9B,
+	0x37, 0x76, 0x9E, 0x40, 0x76, 0x7E, 0x0E, 0x11,
+	0xD9, 0x8B, 0x07, 0x9B, 0xC9, 0x9C, 0xC7, 0x0A,
+	0x49, 0x78, 0x30, 0x7A, 0x5A, 0x12, 0xD6, 0xCD,
+	0x13, 0x6B, 0xF4, 0xC3, 0x47, 0x01, 0x6A, 0x92,
+	0xCC, 0x64, 0x4D, 0x60, 0x42, 0x1A, 0xBB, 0x49,
+	0xBF, 0xCF, 0x8F, 0x49, 0x96, 0x26, 0xF0, 0x34,
+	0xE7, 0x65, 0x07, 0x38, 0xB2, 0x50, 0x2A, 0xA1,
+	0x42, 0x8D, 0xE4, 0x0B, 0x47, 0x93, 0xBE, 0x29,
+	0xEB, 0x6A, 0x31, 0xF7, 0x65, 0xA0, 0x10, 0xA6,
+	0x6E, 0x68, 0x8D, 0xA2, 0xA9, 0x38, 0x4D, 0x08,
+	0xE8, 0x4C, 0x46, 0xFD, 0x1C, 0xC1, 0x50, 0x45,
+	0xC1, 0xAF, 0x23, 0x42, 0xA1, 0x52, 0x93, 0x94,
+	0x66, 0xE1, 0xA8, 0x07, 0xF0, 0xDF, 0x59, 0x92,
+	0x0E, 0x15, 0x7A, 0x16, 0xB4, 0xA6, 0x3C, 0x26,
+	0xA3, 0x85, 0x8B, 0x78, 0x92, 0x6B, 0x92, 0xFB,
+	0x34, 0xCB, 0x5C, 0x35, 0x7F, 0xA8, 0xCD, 0x2D,
+	0x72, 0xD0, 0xCE, 0x8E, 0xA2, 0x6E, 0xA9, 0x5E,
+	0x16, 0x8F, 0x0E, 0xF9, 0xBE, 0xD1, 0x1B, 0x67,
+	0x8F, 0xA1, 0x9C, 0xFF, 0x07, 0x6F, 0x08, 0x38,
+	0xB4, 0x00, 0x09, 0x94, 0xED, 0xA1, 0x3E, 0x41,
+	0x4D, 0x29, 0x37, 0xC5, 0xFE, 0x78, 0x0F, 0x40,
+	0x87, 0x92, 0x7B, 0x0E, 0x33, 0x31, 0xA5, 0x66,
+	0x19, 0xAB, 0xD2, 0xE8, 0xEF, 0x18, 0x7C, 0x1F,
+	0x74, 0x81, 0x24, 0x39, 0x43, 0xB5, 0xE2, 0x61,
+	0x7A, 0xBE, 0xB5, 0xD6, 0x2D, 0x08, 0x8B, 0xEA,
+	0x22, 0x87, 0xD1, 0xB9, 0x3A, 0xBB, 0x44, 0x2A,
+	0xCA, 0xF5, 0x23, 0xE7, 0x06, 0xDA, 0xDB, 0x11,
+	0xC9, 0x62, 0x31, 0x38, 0x8C, 0x48, 0xAC, 0x3E,
+	0x89, 0x09, 0x10, 0x76, 0x9E, 0xEE, 0xA2, 0x03,
+	0xD5, 0x31, 0x56, 0x5D, 0x26, 0xA6, 0xDC, 0x25,
+	0xD0, 0xD5, 0x30, 0xA5, 0x06, 0x2C, 0x99, 0xBE,
+	0x15, 0x2C, 0x92, 0x5F, 0x35, 0x80, 0xA7, 0x5E,
+	0x31, 0x74, 0xB8, 0x1B, 0xC4, 0x18, 0x60, 0x63,
+	0x6D, 0x4C, 0x3B, 0xDD, 0x5C, 0x18, 0x8D, 0x74,
+	0xC3, 0x11, 0xAA, 0xD2, 0x6C, 0x58, 0x77, 0x53,
+	0x8D, 0xFB, 0x88, 0x31, 0x27, 0x76, 0x33, 0x95,
+	0x7B, 0x68, 0xF3, 0x95, 0x6C, 0xAD, 0x12, 0x4E,
+	0xD4, 0x46, 0x46, 0x90, 0x53, 0x92, 0xE9, 0x53,
+	0x61, 0x80, 0x07, 0xCC, 0x1A, 0x28, 0x20, 0x9E,
+	0x56, 0x45, 0x4B, 0x63, 0x83, 0x38, 0x4C, 0x98,
+	0xF4, 0x28, 0x0B, 0x0D, 0x22, 0x7B, 0xD0, 0x47,
+	0x6B, 0xE3, 0x72, 0x67, 0x06, 0xF1, 0x64, 0x50,
+	0x96, 0x9B, 0x00, 0x20, 0xE4, 0xF6, 0x2D, 0x26,
+	0xAF, 0xD4, 0x9A, 0x99, 0xB2, 0xF7, 0xBF, 0xA1,
+	0xF4, 0x59, 0x61, 0x52, 0x74, 0x34, 0x91, 0x15,
+	0x45, 0xFA, 0x27, 0xAE, 0xF8, 0x63, 0x43, 0x01,
+	0xE4, 0x6C, 0x47, 0xEF, 0xE0, 0x90, 0xDA, 0x01,
+	0xAF, 0xEA, 0xB8, 0xB7, 0xB9, 0xED, 0x08, 0xF3,
+	0x4C, 0xCA, 0x91, 0x32, 0x3F, 0x36, 0xD5, 0xD0,
+	0x97, 0x7D, 0xF0, 0xE0, 0x11, 0x3C, 0xA7, 0x3E,
+	0xCA, 0x01, 0xB1, 0x97, 0xDF, 0x8D, 0x10, 0x08,
+	0xF5, 0x83, 0xC4, 0x87, 0xFA, 0xCB, 0xB4, 0xE9,
+	0x03, 0x78, 0x7F, 0x28, 0x14, 0x22, 0xF4, 0x05,
+	0x8B, 0x05, 0x69, 0xEB, 0x75, 0xCF, 0x7A, 0x5B,
+	0xD1, 0x7E, 0xBE, 0xA1, 0xA5, 0xAF, 0xDA, 0x59,
+	0x56, 0x87, 0x9F, 0x07, 0x84, 0x52, 0x8F, 0x5E,
+	0x25, 0x26, 0x9A, 0x3B, 0x21, 0xFC, 0x32, 0xF7,
+	0x47, 0x2E, 0x23, 0x5D, 0x19, 0xA1, 0x6D, 0xAC,
+	0x48, 0x09, 0xA6, 0xD6, 0x14, 0x5C, 0xDF, 0x0B,
+	0xCE, 0x6B, 0xBF, 0x82, 0x29, 0xAD, 0xC8, 0x73,
+	0x62, 0x66, 0x5E, 0xD7, 0x6C, 0x5B, 0x27, 0x00,
+	0x33, 0xA1, 0xDE, 0x8F, 0x61, 0xA1, 0x58, 0xC3,
+	0x57, 0xA2, 0x94, 0x11, 0x6B, 0x3D, 0xB1, 0xF7,
+	0x40, 0x58, 0x2D, 0x5E, 0x54, 0x75, 0xA0, 0x05,
+	0x7F, 0xC6, 0xCA, 0x77, 0xAF, 0x54, 0x28, 0x3B,
+	0x69, 0x4D, 0xEC, 0xE0, 0xEF, 0xAB, 0x26, 0xA0,
+	0x14, 0x3B, 0xDB, 0xE7, 0xD0, 0x84, 0x20, 0x19,
+	0xD4, 0x05, 0x03, 0x43, 0xCE, 0xC1, 0x95, 0xD6,
+	0xA7, 0x8A, 0xE8, 0x3E, 0xB8, 0x0A, 0xFE, 0x26,
+	0x52, 0x00, 0x37, 0x2E, 0x06, 0x7B, 0x97, 0x9A,
+	0x44, 0xF5, 0xEE, 0x50, 0x54, 0xC0, 0x58, 0xA5,
+	0xC0, 0x62, 0x2D, 0x4B, 0xD3, 0xF6, 0xB3, 0xA4,
+	0x74, 0x9A, 0xAD, 0xFB, 0x7E, 0x12, 0xB0, 0xCE,
+	0x22, 0x2A, 0x3F, 0xE8, 0x4B, 0xB8, 0x24, 0x82,
+	0x81, 0x94, 0x09, 0xBF, 0x80, 0x09, 0xF2, 0x57,
+	0xC9, 0xBC, 0x87, 0x77, 0xD6, 0x96, 0x5C, 0x77,
+	0x8D, 0x86, 0x07, 0x45, 0x6D, 0xEC, 0xCD, 0x72,
+	0x34, 0x5D, 0x32, 0x5C, 0x04, 0xEA, 0x17, 0x92,
+	0xC4, 0x8C, 0x0D, 0xA8, 0x47, 0x88, 0x99, 0x3C,
+	0xBA, 0xB8, 0xFE, 0x08, 0x61, 0xE8, 0x4D, 0xF5,
+	0x96, 0xF3, 0x3E, 0x42, 0xF6, 0xDE, 0xB6, 0xD4,
+	0x3B, 0x26, 0x13, 0x75, 0x2B, 0x7E, 0x71, 0xA8,
+	0xF7, 0xD6, 0xF1, 0x66, 0x02, 0xC8, 0xE9, 0x94,
+	0x85, 0x9A, 0x8E, 0x59, 0xC0, 0xD6, 0xC4, 0xBA,
+	0xC9, 0xB9, 0xF8, 0xE2, 0x80, 0x52, 0xCA, 0xB7,
+	0x25, 0x4D, 0x47, 0x5A, 0x2D, 0x22, 0x50, 0x56,
+	0x0E, 0xF2, 0x62, 0x15, 0xC6, 0xDE, 0xE2, 0x75,
+	0xC3, 0x7D, 0xC2, 0x42, 0xAC, 0xBB, 0x88, 0xB9,
+	0x20, 0xD0, 0xF2, 0x6F, 0xF5, 0x2C, 0xF6, 0x8B,
+	0x2F, 0x6A, 0x48, 0x51, 0x47, 0x15, 0xC0, 0x03,
+	0xC7, 0x86, 0xA9, 0x02, 0x18, 0xB6, 0x12, 0x03,
+	0x50, 0x25, 0x39, 0x3E, 0x85, 0x61, 0xD4, 0xF9,
+	0xFE, 0xA2, 0xBF, 0x32, 0x5B, 0x84, 0x78, 0x57,
+	0x68, 0x71, 0x01, 0xC2, 0xC7, 0xD5, 0x53, 0xD5,
+	0x0B, 0x88, 0xD4, 0xF1, 0xD3, 0xC5, 0xEF, 0x65,
+	0xA2, 0xB4, 0xA1, 0x61, 0x2D, 0x28, 0x08, 0x65,
+	0xA7, 0x30, 0xCC, 0xB5, 0xEF, 0x36, 0x83, 0xAE,
+	0xEA, 0x40, 0x8B, 0xCC, 0xCE, 0x14, 0x7B, 0x0A,
+	0xC6, 0x50, 0xBC, 0xAF, 0x8C, 0x7F, 0x56, 0xD8,
+	0x50, 0x17, 0x4E, 0xBB, 0xB4, 0xA8, 0xD8, 0x31,
+	0x76, 0x4E, 0x0F, 0x76, 0x2E, 0x44, 0x65, 0x21,
+	0x31, 0x47, 0x6B, 0x0D, 0x06, 0xF5, 0x1B, 0x59,
+	0xF3, 0x2A, 0x26, 0x3A, 0x78, 0x33, 0x20, 0x00,
+	0xDF, 0xD8, 0xAC, 0xC8, 0xE8, 0x7A, 0xC1, 0x38,
+	0x77, 0x38, 0xC0, 0x76, 0xFD, 0x4F, 0xAF, 0x1B,
+	0xD6, 0x07, 0x71, 0xF4, 0x6D, 0x9C, 0xA2, 0x44,
+	0x93, 0x36, 0xCD, 0xE1, 0xD3, 0x85, 0xD0, 0x92,
+	0xF9, 0x75, 0xF0, 0x66, 0x76, 0x26, 0xCF, 0xA6,
+	0x0E, 0x5E, 0x3A, 0x72, 0x97, 0x34, 0x57, 0x2E,
+	0x9C, 0x51, 0xFC, 0x5C, 0xC3, 0xEA, 0xC7, 0x32,
+	0x52, 0x47, 0xD1, 0x15, 0x3E, 0xFD, 0x33, 0x8D,
+	0xAC, 0x3E, 0x7B, 0x00, 0xBD, 0xD2, 0xE5, 0xF1,
+	0x26, 0x63, 0x83, 0xB8, 0x3A, 0xAB, 0x39, 0xFB,
+	0x40, 0x95, 0xAF, 0xE9, 0xBC, 0x7E, 0x38, 0x92,
+	0x77, 0x06, 0xBB, 0x78, 0x27, 0x82, 0x2B, 0x06,
+	0x12, 0xED, 0x9D, 0xCC, 0xC9, 0x42, 0xC6, 0x6B,
+	0xCF, 0x93, 0xEF, 0x91, 0x45, 0x7F, 0x5F, 0xB2,
+	0x3B, 0xF3, 0x39, 0x9D, 0x0D, 0x75, 0x72, 0x34,
+	0x3A, 0x7C, 0xAB, 0x7C, 0xEF, 0xAE, 0xF9, 0x37,
+	0x89, 0xA2, 0x81, 0xB4, 0xAC, 0xB1, 0x19, 0x35,
+	0x59, 0x40, 0x9C, 0x86, 0x3F, 0x73, 0x36, 0x9D,
+	0x15, 0x6F, 0xDA, 0xD4, 0xCA, 0x3F, 0x95, 0xE4,
+	0x9C, 0x77, 0x73, 0x15, 0x01, 0xD0, 0x7F, 0x2D,
+	0xC8, 0x91, 0xD2, 0xA0, 0x9B, 0xE5, 0xB7, 0x62,
+	0xF4, 0xFC, 0xDE, 0x5E, 0x97, 0x84, 0xC6, 0x00,
+	0x7E, 0xDC, 0x2D, 0x6D, 0x49, 0xAF, 0xAC, 0xFF,
+	0xFA, 0x53, 0xDA, 0x3A, 0x6B, 0x23, 0x47, 0x20,
+	0xB4, 0x46, 0x6A, 0xC7, 0xD7, 0x7D, 0x3F, 0x3A,
+	0xF7, 0x93, 0x86, 0x6F, 0x10, 0xA5, 0x7B, 0xC3,
+	0xAB, 0x3B, 0xE3, 0x58, 0x65, 0x87, 0x6D, 0xE8,
+	0xB7, 0x17, 0x92, 0x09, 0x34, 0x53, 0xBA, 0x35,
+	0x86, 0x31, 0xC8, 0x58, 0x69, 0x7B, 0x75, 0xAC,
+	0x17, 0x01, 0x80, 0xE7, 0x90, 0x88, 0xA5, 0x4C,
+	0xFB, 0x64, 0xB8, 0xF0, 0x97, 0xFA, 0x70, 0x36,
+	0xA1, 0x25, 0x67, 0xF3, 0xBA, 0x3C, 0x69, 0xD2,
+	0x1A, 0x8C, 0x02, 0x30, 0xFB, 0xFE, 0xB9, 0xA9,
+	0xC3, 0x24, 0xE1, 0x98, 0x9D, 0x61, 0x21, 0x2B,
+	0x51, 0x1A, 0x08, 0x75, 0x15, 0x91, 0x36, 0x9A,
+	0xE5, 0x6A, 0xA1, 0x8F, 0xB4, 0x65, 0xB3, 0x28,
+	0x3F, 0x53, 0x90, 0x7F, 0x0B, 0xB8, 0x3A, 0x60,
+	0x62, 0x19, 0xB2, 0x7E, 0xC9, 0x47, 0x7B, 0x44,
+	0x81, 0x57, 0x5A, 0x93, 0xD8, 0xF6, 0x3F, 0x51,
+	0xA8, 0x8D, 0x00, 0x24, 0xF3, 0x62, 0xD9, 0xA9,
+	0xF3, 0x7F, 0x5B, 0xE1, 0x92, 0x09, 0x2E, 0xFB,
+	0x46, 0x58, 0xE8, 0x67, 0xC8, 0x02, 0x4D, 0x89,
+	0x51, 0x46, 0x2F, 0x2D, 0x55, 0x0B, 0x9A, 0x02,
+	0x16, 0x28, 0x6B, 0xED, 0x7E, 0xCE, 0x33, 0x01,
+	0x0A, 0xCE, 0x83, 0x07, 0xAB, 0xB5, 0xBD, 0x5E,
+	0x1B, 0xEB, 0x6D, 0xAB, 0x3D, 0x0C, 0x9D, 0xD1,
+	0xAC, 0xB6, 0x64, 0x3D, 0xC3, 0xA0, 0xFC, 0x06,
+	0x16, 0x1E, 0x47, 0x9E, 0xA3, 0x12, 0xAA, 0x26,
+	0xDD, 0x36, 0xB7, 0xD1, 0xF1, 0x67, 0x73, 0xA6,
+	0xD9, 0x0D, 0x9C, 0xC8, 0x5C, 0x50, 0x7B, 0x2D,
+	0x3B, 0x55, 0x5A, 0x9F, 0x70, 0xBB, 0x68, 0x54,
+	0x55, 0x6B, 0xA3, 0xB0, 0xBC, 0xA3, 0xAF, 0x62,
+	0x52, 0x48, 0x42, 0xD7, 0x74, 0xEA, 0x01, 0x11,
+	0x2B, 0xB1, 0x29, 0x03, 0x83, 0xB0, 0x11, 0x1B,
+	0xA6, 0x96, 0x16, 0x4B, 0x3B, 0x6E, 0x61, 0x86,
+	0x44, 0xC7, 0x27, 0x6F, 0x65, 0xC1, 0xA6, 0x92,
+	0xE3, 0x4D, 0x2A, 0x41, 0x06, 0x82, 0x0E, 0x99,
+	0x8A, 0x1D, 0x8B, 0x59, 0x78, 0xA1, 0x34, 0x24,
+	0xFD, 0xBC, 0x97, 0xE5, 0x82, 0x84, 0x1B, 0xD7,
+	0xA8, 0x9F, 0xA7, 0x1A, 0xD1, 0xBA, 0x3B, 0x35,
+	0x32, 0x0D, 0x28, 0xF5, 0xE6, 0x47, 0xE4, 0x68,
+	0xD8, 0x68, 0x75, 0xB4, 0x4C, 0x4E, 0x32, 0xC4,
+	0x8F, 0xCE, 0x56, 0xA5, 0x79, 0xCA, 0x22, 0x18,
+	0x88, 0x0E, 0x27, 0x41, 0x0F, 0x4D, 0x93, 0x21,
+	0xD2, 0xD6, 0x8B, 0xAF, 0x5D, 0x9B, 0x4F, 0xB5,
+	0x0D, 0x28, 0x19, 0x3F, 0x1A, 0xFB, 0x70, 0x03,
+	0xF8, 0xCF, 0x0E, 0x2A, 0x25, 0x17, 0xAB, 0x74,
+	0xB3, 0x25, 0x10, 0x76, 0xE9, 0x74, 0x45, 0xF1,
+	0xAB, 0x7C, 0xA7, 0xD3, 0xB5, 0xDD, 0x49, 0x97,
+	0xC7, 0xA8, 0x34, 0xEB, 0xFB, 0x6D, 0xDC, 0x6E,
+	0x94, 0x9C, 0xBE, 0x50, 0x77, 0x50, 0xD2, 0x44,
+	0xAF, 0x9C, 0x4A, 0xC9, 0x2A, 0x1D, 0x5B, 0xEA,
+	0xAE, 0x1C, 0xDC, 0x33, 0x07, 0x2D, 0xB7, 0x12,
+	0xFD, 0x82, 0xCB, 0x26, 0x80, 0x25, 0x79, 0xE8,
+	0x11, 0x62, 0x63, 0x63, 0x88, 0xF7, 0xEA, 0xE6,
+	0x7E, 0x17, 0x18, 0xB3, 0x99, 0xD2, 0x19, 0x6E,
+	0xCB, 0x41, 0x73, 0x42, 0x74, 0xB1, 0x52, 0x79,
+	0x38, 0xB3, 0x77, 0x58, 0x58, 0xE8, 0x3B, 0x9C,
+	0xF1, 0x50, 0xF5, 0x5B, 0x9F, 0x81, 0xA5, 0xCC,
+	0xCC, 0xE7, 0x3A, 0x51, 0x2A, 0x47, 0x17, 0x22,
+	0xC5, 0x02, 0x51, 0xBF, 0xDF, 0x81, 0x9D, 0x90,
+	0x2F, 0x61, 0x12, 0xD2, 0x62, 0xBD, 0x39, 0xF7,
+	0x55, 0x64, 0x37, 0xD9, 0xF0, 0x84, 0x00, 0xA7,
+	0x4F, 0xEF, 0x22, 0xC9, 0xFA, 0x93, 0x0B, 0x24,
+	0x36, 0x12, 0x12, 0x88, 0xCB, 0x5E, 0x79, 0xF0,
+	0x02, 0x95, 0xC0, 0x8F, 0x5E, 0x29, 0xED, 0x61,
+	0x6B, 0xAA, 0xB3, 0x9A, 0xED, 0xCC, 0xD3, 0x42,
+	0x72, 0x5C, 0x16, 0xB8, 0x9B, 0xCD, 0x1B, 0x26,
+	0xBC, 0x08, 0x07, 0xC8, 0xE8, 0xB9, 0x9A, 0x34,
+	0x8D, 0xA9, 0x81, 0x8E, 0x26, 0x11, 0x5F, 0x75,
+	0xAD, 0x8E, 0x5C, 0xA6, 0xB0, 0xDD, 0x44, 0xEB,
+	0x06, 0xAE, 0x2F, 0xDA, 0x26, 0x07, 0xFB, 0xF0,
+	0x5B, 0x31, 0x7B, 0xA3, 0x33, 0xAB, 0xE2, 0x8F,
+	0xD1, 0x74, 0x2E, 0x51, 0x6B, 0x4A, 0x41, 0x47,
+	0x75, 0xF0, 0x12, 0x67, 0x8E, 0x29, 0x91, 0xD2,
+	0x73, 0x67, 0x50, 0x09, 0xD4, 0x7E, 0xCE, 0x10,
+	0xD3, 0x1B, 0x17, 0x01, 0xAA, 0x72, 0xD9, 0xAA,
+	0xA8, 0x3F, 0xE2, 0xAB, 0xDF, 0x7D, 0xEC, 0x63,
+	0x8E, 0xA0, 0x59, 0xF1, 0x26, 0xEB, 0x9F, 0x72,
+	0xC5, 0x0B, 0xB5, 0x0A, 0xF4, 0xE1, 0x35, 0xA1,
+	0x55, 0x62, 0x96, 0x98, 0xA7, 0x49, 0xFD, 0x76,
+	0x63, 0xCC, 0xAE, 0x46, 0x6A, 0x15, 0x1A, 0x50,
+	0x34, 0xA6, 0xC2, 0xDB, 0x4F, 0x64, 0x06, 0x76,
+	0x98, 0x37, 0xF8, 0x3E, 0x91, 0xAC, 0xD2, 0xD1,
+	0x13, 0xFD, 0xCC, 0xD1, 0x0C, 0x00, 0xF0, 0xD8,
+	0xAD, 0xFF, 0xE8, 0x63, 0x1C, 0xB8, 0xE6, 0x71,
+	0x37, 0xF9, 0xFA, 0xB2, 0xA2, 0xBA, 0x5B, 0x65,
+	0x3C, 0x48, 0xC5, 0x3B, 0xA9, 0x03, 0x59, 0x0B,
+	0x77, 0xD2, 0xFD, 0x8E, 0x80, 0x77, 0x2D, 0x82,
+	0x10, 0x6F, 0x73, 0x56, 0x5A, 0xFE, 0xB0, 0xA7,
+	0xE8, 0xE8, 0x40, 0xBF, 0x40, 0x81, 0x34, 0xAF,
+	0x66, 0x54, 0xE8, 0x90, 0x53, 0x09, 0xF2, 0xC3,
+	0xBE, 0xA6, 0xE4, 0xF8, 0x9A, 0x95, 0xBD, 0x4C,
+	0x1C, 0x46, 0xD9, 0x5B, 0xBB, 0xE8, 0x6B, 0xB5,
+	0x41, 0x79, 0x41, 0xA5, 0x44, 0xD9, 0xFF, 0x35,
+	0xD5, 0x90, 0xDF, 0xF7, 0x16, 0x34, 0xCA, 0xE6,
+	0xD7, 0x2A, 0x13, 0x2B, 0xCB, 0x76, 0x59, 0x57,
+	0x09, 0x1A, 0xBC, 0xF6, 0xB1, 0x88, 0xD4, 0x75,
+	0x32, 0xCD, 0x7F, 0x8B, 0x00, 0x9E, 0x85, 0xC0,
+	0x3B, 0x82, 0x6C, 0xD4, 0x91, 0xCB, 0x4F, 0x9F,
+	0x1D, 0xA6, 0xD4, 0x6B, 0x40, 0x34, 0x15, 0x96,
+	0xBC, 0x9C, 0x29, 0xC0, 0x34, 0x22, 0x87, 0x9C,
+	0xDD, 0x52, 0xC6, 0xA0, 0x24, 0xCD, 0x34, 0x18,
+	0x59, 0xBC, 0x37, 0x93, 0xB2, 0x77, 0xCB, 0x85,
+	0x53, 0x63, 0x56, 0xAD, 0xEF, 0xE3, 0xD2, 0x23,
+	0x04, 0x8F, 0xDF, 0xFB, 0x0D, 0x4E, 0x17, 0x5A,
+	0x25, 0x7A, 0xE7, 0x33, 0x7B, 0x12, 0xD3, 0x0D,
+	0x9C, 0xAF, 0x7A, 0x44, 0xEF, 0xC8, 0x89, 0xDB,
+	0x3B, 0x1A, 0xD4, 0x4A, 0x45, 0x2C, 0x42, 0xD3,
+	0xBF, 0x63, 0x3B, 0xE9, 0xC8, 0xA0, 0x3E, 0x59,
+	0x49, 0x82, 0x21, 0x19, 0x5C, 0x01, 0x7B, 0x21,
+	0x8D, 0xE3, 0x2F, 0xB4, 0x6A, 0xF0, 0x64, 0x16,
+	0x70, 0xA9, 0x75, 0x8B, 0x2D, 0x0E, 0xA0, 0x20,
+	0xED, 0x19, 0xFA, 0xC8, 0x85, 0x3F, 0x6D, 0x24,
+	0xF6, 0x21, 0x61, 0x35, 0x0D, 0x3D, 0xE2, 0x5D,
+	0xF2, 0x3A, 0xD0, 0xD6, 0xC1, 0x67, 0xFC, 0x02,
+	0x59, 0xC6, 0x09, 0x0F, 0x08, 0x6D, 0x84, 0x76,
+	0xBE, 0x91, 0xD8, 0xEA, 0x67, 0x4A, 0x3C, 0x7A,
+	0x52, 0x87, 0xC2, 0x29, 0x80, 0x78, 0xE5, 0xA0,
+	0x23, 0xC4, 0xEE, 0xF1, 0xD7, 0xF9, 0xF5, 0x10,
+	0x02, 0x91, 0x36, 0x9F, 0xC2, 0xDD, 0x91, 0xB2,
+	0x3B, 0x48, 0xD1, 0xC9, 0x97, 0x58, 0xEF, 0x83,
+	0x66, 0x21, 0x94, 0xF7, 0xFB, 0x5A, 0x4D, 0x42,
+	0x13, 0x7C, 0x7C, 0x38, 0xD2, 0x82, 0x7F, 0x02,
+	0x7D, 0xD8, 0xD3, 0x05, 0x5D, 0xFC, 0x50, 0x3B,
+	0x68, 0xBD, 0xC5, 0xF3, 0xD9, 0x76, 0x5B, 0xF3,
+	0x4A, 0x45, 0xCC, 0xBB, 0x75, 0xA5, 0x08, 0xD4,
+	0xC5, 0x77, 0x6C, 0xC6, 0x78, 0x7E, 0x72, 0x1D,
+	0x39, 0xC0, 0x95, 0xA1, 0xF3, 0xE2, 0x8D, 0x48,
+	0xDA, 0x68, 0xC6, 0xF2, 0x7B, 0x03, 0xEC, 0x0A,
+	0x72, 0x60, 0x40, 0xD0, 0x88, 0x81, 0xDD, 0x0D,
+	0xCC, 0x1A, 0xFC, 0x41, 0x46, 0x71, 0xBB, 0x11,
+	0xA5, 0xD0, 0x67, 0xD2, 0xBF, 0x59, 0x23, 0x5B,
+	0x2D, 0xC1, 0x09, 0x45, 0x62, 0x85, 0x7A, 0x3E,
+	0xD9, 0xCE, 0xA3, 0xEB, 0x63, 0xC8, 0x74, 0x8B,
+	0x26, 0x36, 0xA2, 0x94, 0x98, 0xD5, 0xA7, 0x11,
+	0xEB, 0xA8, 0x9E, 0xE4, 0x7B, 0x33, 0xFC, 0x4F,
+	0x4C, 0x03, 0x1D, 0xCE, 0x8E, 0x07, 0xE4, 0xFA,
+	0x79, 0xF1, 0x34, 0x7C, 0x56, 0x91, 0x3C, 0x4C,
+	0x7F, 0x3B, 0xBF, 0x5E, 0xCA, 0x25, 0xC9, 0x62,
+	0x3E, 0x96, 0xD9, 0x13, 0x42, 0xF1, 0x24, 0x83,
+	0xE3, 0x49, 0xAA, 0xB3, 0xBB, 0xA5, 0xDE, 0x36,
+	0xE3, 0x59, 0xDF, 0xA3, 0xA6, 0xB7, 0xA1, 0x22,
+	0xFE, 0xCD, 0x66, 0x35, 0xB8, 0x46, 0x74, 0xA9,
+	0xD9, 0xB8, 0xD8, 0x2B, 0xCC, 0xA0, 0x9F, 0x1D,
+	0xAC, 0x29, 0x8D, 0x76, 0xF0, 0x14, 0xDE, 0x62,
+	0x62, 0x57, 0x0D, 0x44, 0xC0, 0x96, 0x0D, 0xD0,
+	0x04, 0x45, 0xD7, 0x10, 0xC7, 0xF0, 0x4E, 0xBF,
+	0x42, 0xF7, 0xF0, 0xD7, 0xE1, 0x5D, 0xA0, 0x22,
+	0xC0, 0x04, 0xEA, 0x67, 0x41, 0xCC, 0x12, 0x17,
+	0x33, 0x7F, 0xA6, 0x6E, 0xBE, 0xB4, 0x1F, 0x73,
+	0xA2, 0xFA, 0xDA, 0xF8, 0x69, 0xED, 0xA4, 0x07,
+	0xB3, 0x3B, 0x47, 0x89, 0x91, 0x51, 0x10, 0xC6,
+	0xC8, 0xE0, 0x09, 0x2E, 0x7F, 0xCE, 0x5B, 0xE4,
+	0x6E, 0x2C, 0x28, 0x94, 0xD9, 0x70, 0x9E, 0xBD,
+	0x51, 0x5E, 0xE4, 0xA2, 0x27, 0x47, 0xD6, 0x7A,
+	0x0D, 0x39, 0xDB, 0x1C, 0x11, 0x90, 0x18, 0x48,
+	0x1C, 0xFF, 0xEB, 0x0C, 0x6D, 0xDE, 0x2C, 0x4F,
+	0x7A, 0xB7, 0x5A, 0x99, 0x2C, 0xAF, 0xFE, 0xBA,
+	0xD6, 0xA2, 0x05, 0x69, 0x54, 0xF1, 0xD4, 0x28,
+	0xCD, 0xD4, 0x7B, 0xD0, 0x71, 0xCA, 0x7D, 0x2F,
+	0xF4, 0xF4, 0x64, 0x0E, 0x45, 0x5D, 0x21, 0xC1,
+	0xC4, 0xB6, 0x62, 0x22, 0xDC, 0x6E, 0xAF, 0xE9,
+	0x60, 0x33, 0xBC, 0x50, 0xC9, 0x0B, 0x71, 0x79,
+	0x49, 0xF4, 0x0C, 0x2C, 0x3D, 0x47, 0x53, 0x17,
+	0xD8, 0xA6, 0xFF, 0x55, 0xAF, 0xB0, 0x6D, 0xCD,
+	0x4A, 0x12, 0x85, 0xF9, 0xBE, 0x12, 0x4A, 0x90,
+	0xD3, 0x77, 0x14, 0x8D, 0x2F, 0xA7, 0x4B, 0x93,
+	0xF6, 0x3F, 0x90, 0xEA, 0x85, 0x3C, 0xA4, 0xCC,
+	0x77, 0x89, 0x96, 0x3C, 0xFD, 0x8A, 0x04, 0x1C,
+	0xF2, 0xEF, 0x6D, 0xEE, 0x97, 0x2B, 0xDF, 0x2B,
+	0x7B, 0x74, 0xD4, 0xE3, 0xEF, 0xEA, 0x24, 0xED,
+	0x31, 0x50, 0x4A, 0x48, 0xD2, 0xD2, 0xBF, 0xCB,
+	0x6C, 0x3F, 0xA4, 0x61, 0xE3, 0x05, 0xB4, 0xF0,
+	0x06, 0x29, 0x1C, 0x72, 0xDA, 0x0E, 0xC2, 0x48,
+	0x12, 0x50, 0xE1, 0xFC, 0x1A, 0xB7, 0xC7, 0x9C,
+	0x3A, 0xF5, 0xBC, 0xF3, 0xF0, 0x51, 0x10, 0x90,
+	0x3E, 0xCC, 0x7A, 0xAE, 0x16, 0xC5, 0x30, 0x58,
+	0xE6, 0x91, 0x82, 0x55, 0x40, 0x95, 0x88, 0xF9,
+	0xAF, 0x5F, 0x88, 0x92, 0x41, 0xC1, 0x3A, 0x55,
+	0xB9, 0xB0, 0x13, 0x75, 0xB4, 0xAE, 0xA7, 0xA5,
+	0xB3, 0x85, 0xBA, 0x09, 0xEA, 0x3B, 0xBC, 0x25,
+	0xBD, 0xEA, 0xB2, 0xA1, 0xF7, 0x9B, 0x96, 0x45,
+	0x38, 0xEC, 0x26, 0x75, 0x35, 0x37, 0x2F, 0x18,
+	0xD1, 0x45, 0xA9, 0x64, 0x67, 0xF9, 0x75, 0x16,
+	0x1B, 0x1A, 0x6C, 0xC5, 0xBD, 0xEA, 0x51, 0x34,
+	0x21, 0x0B, 0x18, 0xC6, 0x58, 0x77, 0xD7, 0xF2,
+	0x27, 0x86, 0x52, 0xC2, 0x17, 0x70, 0xA8, 0x89,
+	0x7E, 0xCC, 0x21, 0x02, 0xEF, 0xC3, 0xA3, 0xCE,
+	0xC7, 0x33, 0x2B, 0xB3, 0x64, 0xA4, 0x2A, 0x6D,
+	0x52, 0x64, 0xD0, 0xDD, 0xBF, 0x2C, 0x01, 0xC1,
+	0xC3, 0x34, 0xF8, 0x9A, 0x03, 0x1B, 0xAD, 0xA3,
+	0x81, 0xAA, 0x2A, 0xE5, 0x29, 0xB2, 0x9F, 0xD2,
+	0x50, 0x18, 0x19, 0x44, 0x0E, 0x6F, 0x30, 0x3A,
+	0x20, 0x56, 0x76, 0xA2, 0x76, 0xF3, 0x38, 0xA2,
+	0x41, 0xB7, 0x83, 0x8A, 0xAD, 0x0E, 0x0C, 0x51,
+	0x3D, 0x2A, 0x5F, 0xC9, 0x3F, 0x93, 0x2C, 0x3D,
+	0x5B, 0xFE, 0xDE, 0xBB, 0xCF, 0x58, 0x7E, 0x27,
+	0xFD, 0xDE, 0x67, 0x03, 0xE4, 0x34, 0x20, 0x91,
+	0x5A, 0xA5, 0xFD, 0xC1, 0xAE, 0x88, 0x9F, 0xB6,
+	0x47, 0xBF, 0x54, 0x8E, 0xBA, 0x56, 0xD8, 0x85,
+	0xF1, 0x08, 0x89, 0x40, 0xB8, 0x5A, 0x59, 0x31,
+	0x26, 0x4D, 0x0C, 0x5A, 0xC8, 0xBA, 0x83, 0xDF,
+	0x42, 0x4F, 0xD8, 0x37, 0xBC, 0x83, 0xA9, 0x24,
+	0x4C, 0x62, 0xA5, 0x7B, 0x59, 0x2B, 0x1A, 0x58,
+	0x2D, 0xBB, 0xCB, 0x61, 0x6C, 0x2A, 0x10, 0x71,
+	0x21, 0xDD, 0x87, 0x9F, 0xA0, 0x42, 0xE8, 0xFE,
+	0xF2, 0x71, 0x7D, 0x2D, 0x59, 0xFA, 0x89, 0x2C,
+	0x93, 0x2F, 0x70, 0x78, 0x4C, 0x57, 0x9D, 0x9F,
+	0xC0, 0xFA, 0x38, 0x05, 0x9A, 0x44, 0x26, 0x15,
+	0xB2, 0xCD, 0x3A, 0x2C, 0xDF, 0x29, 0x54, 0xEB,
+	0x2F, 0xE5, 0x77, 0x51, 0xFD, 0xC6, 0x10, 0xAE,
+	0x1C, 0x95, 0x86, 0x39, 0xFA, 0x42, 0x37, 0x1E,
+	0x40, 0x42, 0x59, 0xCA, 0xF5, 0x10, 0xE1, 0x36,
+	0x19, 0x85, 0xAB, 0x8E, 0x59, 0x3C, 0x26, 0x46,
+	0x0E, 0xF9, 0x5C, 0xBF, 0xB6, 0xDB, 0x70, 0x43,
+	0x54, 0x92, 0x24, 0x81, 0xC5, 0x02, 0x8C, 0xE8,
+	0xCB, 0x17, 0x51, 0xA3, 0x81, 0x45, 0xDD, 0xA7,
+	0x2C, 0x64, 0xA3, 0xEF, 0x0D, 0xFA, 0xFB, 0x68,
+	0xD4, 0x8F, 0xD0, 0x91, 0xC4, 0x35, 0xFC, 0xFD,
+	0xA0, 0x47, 0x07, 0xE7, 0x81, 0xA5, 0x6D, 0x2F,
+	0x4D, 0xFA, 0xEB, 0xD6, 0x88, 0x16, 0xF6, 0x86,
+	0xD7, 0xD5, 0x3C, 0x42, 0x1D, 0x43, 0xEA, 0x12,
+	0x2F, 0xCC, 0x2F, 0x02, 0x71, 0x2A, 0x9E, 0x3B,
+	0xBF, 0x3F, 0xBC, 0x58, 0xCF, 0x94, 0xEF, 0x13,
+	0x4B, 0x1F, 0x29, 0x14, 0x77, 0x8E, 0x9A, 0x5A,
+	0x24, 0x65, 0x0B, 0xE5, 0x1C, 0x5D, 0xA8, 0x8F,
+	0xA0, 0x48, 0x13, 0x9B, 0xAE, 0xD0, 0x18, 0xB5,
+	0x56, 0xB5, 0x8C, 0xF3, 0xC0, 0x69, 0x7B, 0xDB,
+	0xCA, 0x86, 0x74, 0x76, 0xC0, 0x94, 0x32, 0x7A,
+	0x3E, 0xFE, 0xD2, 0xBB, 0xB9, 0x99, 0xFE, 0xC1,
+	0x93, 0x67, 0xA7, 0xFF, 0xFE, 0x3C, 0x15, 0x2B,
+	0x5B, 0x13, 0x32, 0x52, 0x64, 0x4E, 0xDF, 0x99,
+	0x3B, 0xEC, 0x27, 0xC9, 0x83, 0xFF, 0xAE, 0xF8,
+	0xD0, 0x1A, 0xA7, 0x72, 0x10, 0xDD, 0x72, 0xDD,
+	0x29, 0x10, 0x52, 0x83, 0xBD, 0xC2, 0xE2, 0x01,
+	0xC6, 0x10, 0x27, 0x7E, 0xF7, 0x4C, 0x2C, 0xA0,
+	0xDA, 0x12, 0x93, 0x6E, 0x3E, 0x56, 0x6C, 0x04,
+	0x38, 0xCA, 0xE9, 0x24, 0x17, 0x01, 0x07, 0x5F,
+	0x22, 0x4C, 0x7A, 0x7A, 0xE3, 0x7A, 0xDE, 0x74,
+	0x84, 0x20, 0xC1, 0x4C, 0xB3, 0xB9, 0x16, 0xEC,
+	0xCA, 0xC9, 0x0B, 0x4C, 0x62, 0x9C, 0xA5, 0xBD,
+	0xAD, 0x66, 0x62, 0x63, 0xCB, 0x4B, 0xCB, 0x47,
+	0x79, 0xA9, 0x52, 0x78, 0x14, 0xD4, 0x15, 0xC4,
+	0x9F, 0xD5, 0x96, 0x7C, 0x2C, 0x63, 0xE6, 0x54,
+	0x26, 0xB9, 0xF7, 0x32, 0x20, 0x1E, 0x2F, 0xE5,
+	0x26, 0xC2, 0xD1, 0x4D, 0x73, 0x0F, 0x24, 0x8F,
+	0x9E, 0x7B, 0x15, 0x3D, 0xD0, 0xD6, 0xA5, 0xF2,
+	0xBF, 0x25, 0x93, 0x7D, 0xB6, 0x3F, 0xF1, 0xEE,
+	0xDB, 0x30, 0xC7, 0x01, 0x75, 0xAC, 0x9B, 0x7F,
+	0xC7, 0xCF, 0x7B, 0xC0, 0x63, 0x2B, 0x94, 0xC9,
+	0xDD, 0x1F, 0xD4, 0xD3, 0xF3, 0x98, 0x6D, 0xD6,
+	0xD1, 0x8E, 0x75, 0x7E, 0x66, 0xEC, 0x28, 0xDE,
+	0x1F, 0xE6, 0x84, 0x47, 0x9B, 0xD3, 0x65, 0x5B,
+	0x27, 0xCC, 0x73, 0x45, 0x21, 0xED, 0xC2, 0x84,
+	0x27, 0x19, 0x90, 0x93, 0xFD, 0x10, 0x45, 0x09,
+	0xD3, 0x35, 0x63, 0x5B, 0x94, 0x5E, 0x8A, 0x3B,
+	0x47, 0x86, 0xC1, 0x25, 0xA7, 0x43, 0x64, 0xF0,
+	0x5A, 0xC0, 0xE9, 0x11, 0x8A, 0xC2, 0xC2, 0x7B,
+	0x12, 0xB7, 0x38, 0x57, 0x37, 0xD7, 0xD6, 0x8D,
+	0x07, 0x8E, 0x32, 0x88, 0xEB, 0x73, 0xEE, 0x74,
+	0xB2, 0x4D, 0x6B, 0xB0, 0x49, 0x01, 0xEF, 0x6B,
+	0xE4, 0xBD, 0xD3, 0x17, 0xE3, 0x96, 0x99, 0x53,
+	0x75, 0x24, 0x9E, 0xE7, 0x70, 0xD9, 0x12, 0xA2,
+	0x55, 0xA5, 0x83, 0xCB, 0x74, 0x03, 0x78, 0x55,
+	0x64, 0xEA, 0x92, 0x1F, 0xBA, 0xA7, 0x1F, 0x90,
+	0xF5, 0x29, 0xC9, 0x4E, 0xDD, 0x5D, 0xD3, 0x9C,
+	0xDD, 0x28, 0xA3, 0x1C, 0xD0, 0x40, 0xD6, 0x44,
+	0x87, 0xF0, 0x2F, 0x6E, 0x30, 0xA9, 0x68, 0x14,
+	0x74, 0x9C, 0x57, 0x7B, 0x07, 0xD2, 0x0C, 0x6F,
+	0x2A, 0x6D, 0x05, 0x9C, 0x9A, 0xA0, 0x30, 0xA7,
+	0xAE, 0x51, 0xD8, 0xD1, 0xDD, 0xF8, 0x7B, 0x6C,
+	0xC5, 0x05, 0x8E, 0xB8, 0xB8, 0xFC, 0x7B, 0x5B,
+	0xEB, 0x6D, 0x40, 0x41, 0xA5, 0x32, 0x71, 0x54,
+	0x93, 0x26, 0xA9, 0x19, 0x60, 0x25, 0xF6, 0x76,
+	0x85, 0xA5, 0x3B, 0x85, 0x90, 0xD2, 0x36, 0xEF,
+	0x30, 0xA6, 0xFA, 0x24, 0xB0, 0x8C, 0xF8, 0x83,
+	0x63, 0x99, 0x68, 0x79, 0x16, 0xC2, 0x05, 0x5A,
+	0x3A, 0x41, 0xE6, 0xE6, 0x61, 0xD2, 0x45, 0x69,
+	0xA9, 0x38, 0x31, 0x00, 0xE4, 0xAA, 0x54, 0x0D,
+	0xE8, 0x99, 0xC1, 0xCB, 0xB6, 0xAC, 0x79, 0xCD,
+	0x84, 0x68, 0x4B, 0x17, 0x5E, 0xCE, 0xD0, 0x66,
+	0xCA, 0xFB, 0xB8, 0xE4, 0x3C, 0x33, 0x8C, 0x0F,
+	0x31, 0x0E, 0x14, 0x6F, 0x88, 0xDE, 0x22, 0xD8,
+	0x9E, 0x42, 0x58, 0x1E, 0x15, 0xBB, 0x07, 0xAD,
+	0xE3, 0x49, 0xF7, 0xF6, 0x98, 0xE2, 0x5C, 0xC7,
+	0xCE, 0xB1, 0xF1, 0xFA, 0xE7, 0x52, 0x3E, 0xDD,
+	0xDA, 0x7D, 0x97, 0x72, 0xFB, 0xB2, 0x0A, 0x3B,
+	0x4A, 0xD7, 0xB3, 0xD7, 0xF3, 0x2F, 0xF7, 0x4F,
+	0xEC, 0x26, 0x95, 0xE7, 0x61, 0x7B, 0x25, 0x41,
+	0x33, 0xA2, 0xB4, 0x70, 0x10, 0xD3, 0x60, 0x97,
+	0x3B, 0xFA, 0x3E, 0xE1, 0x44, 0x6C, 0xE8, 0x6F,
+	0x70, 0xC1, 0x4C, 0x91, 0xF4, 0x49, 0x5E, 0x2A,
+	0x14, 0x73, 0xDB, 0x98, 0xD7, 0xBE, 0x4B, 0xDC,
+	0x05, 0x79, 0x4E, 0x4C, 0xA6, 0x78, 0x09, 0xDE,
+	0x9D, 0xCC, 0xFB, 0xA6, 0x2A, 0xAF, 0x41, 0x95,
+	0xFA, 0x73, 0xFA, 0x89, 0x02, 0x26, 0x14, 0x7D,
+	0x43, 0xE2, 0xF8, 0x11, 0x1E, 0x58, 0xCC, 0xF9,
+	0x92, 0xCB, 0x28, 0x90, 0xB9, 0x59, 0x7F, 0xB2,
+	0xD3, 0x6C, 0x90, 0xCE, 0x65, 0x9E, 0xFB, 0x54,
+	0x84, 0x51, 0xAD, 0xC8, 0xCC, 0x32, 0xB9, 0x2C,
+	0xC1, 0x04, 0x7F, 0x88, 0x6C, 0x6D, 0x56, 0x87,
+	0xE6, 0x1A, 0xBA, 0xEB, 0x09, 0xF4, 0x07, 0xE9,
+	0x3A, 0x3A, 0xAE, 0xAC, 0xA1, 0x6B, 0x6F, 0x25,
+	0xAE, 0x53, 0xB9, 0x34, 0xD3, 0x00, 0x4F, 0x9E,
+	0xFE, 0x55, 0x1F, 0xAB, 0xB6, 0x9D, 0x44, 0x8E,
+	0x59, 0x50, 0x5B, 0x4F, 0xEF, 0x37, 0x6A, 0x58,
+	0x98, 0xB2, 0xD8, 0xE1, 0xB4, 0xFC, 0x66, 0xFB,
+	0x8B, 0x80, 0xE2, 0xBF, 0xDC, 0x97, 0xD3, 0x8B,
+	0x14, 0x5F, 0x76, 0x2E, 0x76, 0x47, 0x97, 0xFB,
+	0x76, 0x48, 0xB1, 0x09, 0xAA, 0x1B, 0xD9, 0xBD,
+	0x50, 0xBB, 0x37, 0x84, 0x5E, 0xDE, 0x13, 0xA0,
+	0x4B, 0x4E, 0x93, 0x8D, 0xCB, 0x13, 0xD3, 0x7E,
+	0xF4, 0x2B, 0xA1, 0x75, 0xBE, 0x7C, 0x90, 0xF4,
+	0xF8, 0xD7, 0xD3, 0xA9, 0xEB, 0x06, 0x69, 0x1E,
+	0x32, 0xA6, 0xD5, 0x7A, 0x2D, 0x48, 0xF5, 0xED,
+	0x39, 0xC5, 0x06, 0x47, 0xB1, 0xCD, 0x5F, 0x2F,
+	0xD3, 0x7C, 0xD6, 0x8C, 0x02, 0x57, 0x85, 0x93,
+	0x67, 0x22, 0xC8, 0x89, 0xBA, 0x2B, 0x9C, 0x35,
+	0x8B, 0xFB, 0x26, 0x91, 0x37, 0xAC, 0x20, 0x90,
+	0x71, 0xF0, 0x15, 0xDF, 0xBD, 0xE5, 0xEA, 0x35,
+	0x6B, 0x71, 0xDD, 0x00, 0x55, 0x9C, 0x0C, 0xCD,
+	0x9F, 0x8D, 0x1D, 0x7E, 0xF8, 0xD8, 0x58, 0x08,
+	0x06, 0x26, 0x1B, 0xB3, 0x35, 0xCA, 0x9D, 0x0A,
+	0x10, 0x79, 0xE7, 0x52, 0xB4, 0x1F, 0x22, 0x72,
+	0xFE, 0x70, 0x41, 0xE8, 0x33, 0x78, 0xD5, 0x99,
+	0xDB, 0x02, 0x28, 0xC4, 0xD6, 0xEE, 0x56, 0x1B,
+	0x20, 0x52, 0x58, 0x78, 0x8C, 0xE9, 0xE9, 0x18,
+	0x00, 0xCC, 0x7D, 0x40, 0xB1, 0x50, 0xD9, 0x86,
+	0x67, 0xBA, 0xE7, 0xEF, 0x81, 0x12, 0xB6, 0xED,
+	0x32, 0xCC, 0x23, 0x3F, 0x88, 0x26, 0x11, 0xB7,
+	0x32, 0xF3, 0xE7, 0xA9, 0x7E, 0x97, 0x19, 0x95,
+	0x2D, 0x34, 0xAE, 0x03, 0x21, 0x20, 0x36, 0xED,
+	0x50, 0xEA, 0x6D, 0x16, 0x99, 0xD8, 0x54, 0x64,
+	0x92, 0xF3, 0xC2, 0x8F, 0xE3, 0x0A, 0x23, 0x05,
+	0x40, 0xEE, 0x82, 0x07, 0x9F, 0x80, 0xB3, 0x5B,
+	0x33, 0xB8, 0x68, 0x9F, 0xB3, 0x15, 0xE3, 0x6A,
+	0x84, 0x15, 0x42, 0x49, 0x45, 0x13, 0x73, 0x5E,
+	0x70, 0x6D, 0xE0, 0xDA, 0x05, 0x79, 0x72, 0x37,
+	0x4C, 0x68, 0x95, 0xF1, 0x3D, 0x94, 0x25, 0xEB,
+	0xBD, 0x00, 0x9E, 0x5C, 0x26, 0xCB, 0xE3, 0xFC,
+	0xD5, 0xF9, 0xDA, 0x34, 0xD7, 0x2C, 0x75, 0x9F,
+	0xE0, 0x80, 0xF6, 0x18, 0xC7, 0x16, 0xAF, 0x0B,
+	0x6E, 0x47, 0x63, 0x03, 0x0A, 0x5F, 0xAF, 0x61,
+	0x68, 0xB7, 0x36, 0xD4, 0x03, 0x97, 0x4F, 0xD8,
+	0x62, 0xF4, 0x97, 0x82, 0x4E, 0x56, 0x17, 0xCA,
+	0xAF, 0x67, 0x8F, 0x07, 0x89, 0xD8, 0x8A, 0xA3,
+	0xDE, 0x26, 0x08, 0xF9, 0x18, 0x95, 0xDC, 0x91,
+	0x26, 0x92, 0x7C, 0x83, 0x2F, 0x8F, 0xEB, 0xB7,
+	0x41, 0x12, 0x6B, 0x05, 0xD8, 0xE3, 0xA4, 0x15,
+	0xBA, 0xF2, 0x23, 0x0F, 0x67, 0x2D, 0xD4, 0xD6,
+	0x12, 0x03, 0x86, 0x5E, 0x49, 0x75, 0xB6, 0x32,
+	0x33, 0x70, 0x2C, 0x00, 0x62, 0xC6, 0x1A, 0x40,
+	0xCC, 0xBA, 0xFE, 0xBA, 0x8D, 0x31, 0x49, 0xE6,
+	0x25, 0x09, 0x0E, 0x15, 0xFE, 0xA9, 0x2C, 0x4C,
+	0xCA, 0x9C, 0x71, 0x1B, 0xC6, 0x3C, 0xB2, 0x8E,
+	0x2D, 0xC5, 0x44, 0xB7, 0xE3, 0xD8, 0xD3, 0xED,
+	0xCE, 0x33, 0xF6, 0xFF, 0xCF, 0x49, 0x3B, 0x21,
+	0x6E, 0x80, 0xCA, 0x65, 0x20, 0x4B, 0xF2, 0x6D,
+	0xF3, 0x6A, 0x6A, 0x5C, 0x94, 0x92, 0x84, 0x94,
+	0xBC, 0x5D, 0xDD, 0x78, 0x7D, 0x19, 0xA2, 0x0C,
+	0xC3, 0xD9, 0x34, 0xCA, 0x41, 0xAE, 0xB7, 0xAF,
+	0x6F, 0x27, 0xF8, 0xCC, 0x57, 0xAE, 0x9B, 0x33,
+	0x90, 0xE7, 0x96, 0x9D, 0xEB, 0x9C, 0x40, 0x51,
+	0xED, 0x32, 0x79, 0x13, 0x2D, 0x91, 0xED, 0x8C,
+	0xF2, 0xAE, 0x61, 0x5D, 0xF6, 0x9A, 0x5C, 0x28,
+	0x42, 0xF0, 0xB0, 0xE4, 0xB0, 0x86, 0x27, 0xE1,
+	0xC6, 0x11, 0xCE, 0x7A, 0x11, 0x33, 0x13, 0x0C,
+	0xE0, 0x42, 0x8B, 0xB5, 0x9C, 0xCA, 0x89, 0x22,
+	0xF5, 0xE9, 0x8D, 0xE7, 0x54, 0x85, 0x8E, 0x51,
+	0xF1, 0x17, 0x20, 0xAF, 0x56, 0xC2, 0x32, 0x2F,
+	0x39, 0x7F, 0x73, 0xB4, 0x59, 0x64, 0x06, 0x63,
+	0xE8, 0x29, 0x91, 0x21, 0x69, 0x66, 0x6B, 0x1B,
+	0xA1, 0x31, 0x80, 0xC7, 0xA5, 0xB9, 0x63, 0x92,
+	0x74, 0xAC, 0x2C, 0x93, 0xA9, 0xC0, 0xE5, 0x39,
+	0xC5, 0xC5, 0x40, 0x0E, 0x74, 0xD2, 0xCC, 0x10,
+	0x85, 0x42, 0x0A, 0x17, 0x5B, 0x92, 0x11, 0xC8,
+	0x8C, 0xE1, 0x64, 0xEE, 0xC9, 0x25, 0x91, 0xA8,
+	0x46, 0xC5, 0xF0, 0xC4, 0x5B, 0xA4, 0x3D, 0xBC,
+	0x1E, 0x60, 0x8E, 0x41, 0x20, 0xF5, 0x5C, 0x29,
+	0xB9, 0x84, 0x75, 0x90, 0xCE, 0xF7, 0x56, 0x52,
+	0x26, 0x14, 0x2B, 0xDC, 0x78, 0xBA, 0x72, 0x11,
+	0x18, 0xFA, 0x4C, 0x1F, 0x84, 0xF6, 0x8F, 0x0A,
+	0x88, 0xBA, 0xAD, 0x92, 0xF1, 0xEA, 0xB2, 0x4E,
+	0x2D, 0x0C, 0xE7, 0xB0, 0x78, 0xBE, 0x1B, 0x3B,
+	0x31, 0x97, 0xC6, 0x76, 0x82, 0x1F, 0x72, 0xEA,
+	0x37, 0x4F, 0x5E, 0xC6, 0xD3, 0xEE, 0xCA, 0x77,
+	0xDF, 0xEF, 0x6C, 0x2B, 0xD1, 0x19, 0xD8, 0x58,
+	0xD7, 0xD4, 0x13, 0xE4, 0x7D, 0xBC, 0xD6, 0x9A,
+	0x80, 0x80, 0x4F, 0x30, 0x8A, 0xE6, 0x75, 0x9A,
+	0x7A, 0x0A, 0xA2, 0x2F, 0xD9, 0x2F, 0x5F, 0x99,
+	0x5A, 0x86, 0x3C, 0xAB, 0x80, 0xF3, 0x4D, 0x11,
+	0x6B, 0x45, 0x43, 0xDD, 0x23, 0xA0, 0x6E, 0xC9,
+	0x03, 0x99, 0x54, 0xA2, 0xE2, 0x1E, 0x03, 0x0D,
+	0x50, 0x16, 0xA6, 0x14, 0xFC, 0x83, 0x9C, 0x19,
+	0x09, 0xD9, 0x04, 0xA8, 0xF4, 0x2F, 0xB2, 0xB7,
+	0xBB, 0x5A, 0x0A, 0xB1, 0x9C, 0xDB, 0x62, 0x30,
+	0xD3, 0x7C, 0x46, 0x2C, 0x5B, 0x36, 0x60, 0x9F,
+	0xA8, 0xD2, 0xB2, 0xAC, 0x19, 0x30, 0x3D, 0xAA,
+	0x3F, 0x52, 0x1B, 0x8E, 0x2B, 0x51, 0xF9, 0x38,
+	0xBE, 0x87, 0x48, 0xCB, 0xEB, 0xAF, 0xEC, 0x6D,
+	0xF0, 0xB2, 0x07, 0xDD, 0x6B, 0xE6, 0x1B, 0x34,
+	0x52, 0xC6, 0xEA, 0xAB, 0x21, 0x6E, 0x6B, 0x13,
+	0x9F, 0x96, 0x75, 0x44, 0x78, 0x60, 0x17, 0xBD,
+	0x20, 0x18, 0x60, 0x1B, 0x32, 0x8D, 0xCD, 0x1C,
+	0xAC, 0x71, 0x18, 0x51, 0xB3, 0xE9, 0x0D, 0xDA,
+	0xB1, 0x8D, 0xA0, 0x08, 0x1D, 0x65, 0x1B, 0xD0,
+	0x2A, 0x1E, 0x65, 0x14, 0xEB, 0xA8, 0x8A, 0x06,
+	0x8F, 0xE3, 0x4F, 0x8A, 0xC5, 0x7C, 0x22, 0x5F,
+	0xED, 0xED, 0xF8, 0xA8, 0x73, 0x61, 0x94, 0x3E,
+	0x4D, 0x28, 0xBE, 0xCF, 0x00, 0x69, 0xE5, 0x0C,
+	0x6F, 0x62, 0xD4, 0xC0, 0x05, 0xC9, 0x19, 0x41,
+	0xF4, 0xED, 0x30, 0x3B, 0x77, 0xCA, 0xAC, 0xBC,
+	0xC5, 0xE1, 0xB9, 0xFF, 0xE6, 0xB1, 0xBF, 0x92,
+	0xDE, 0x03, 0x1B, 0xB8, 0xE2, 0xB3, 0x1E, 0xEC,
+	0x8B, 0x64, 0x69, 0xF9, 0x42, 0xFA, 0x48, 0x7E,
+	0x0E, 0xDB, 0x1A, 0xA9, 0xE9, 0x63, 0x51, 0x34,
+	0xE9, 0x45, 0xE7, 0xF4, 0x29, 0x64, 0x07, 0xEC,
+	0x58, 0xD0, 0xFD, 0x57, 0xBB, 0x1C, 0x8A, 0xB4,
+	0x31, 0xD9, 0x71, 0x9C, 0xC6, 0xEE, 0x2A, 0x44,
+	0xE3, 0x98, 0x58, 0x54, 0xF8, 0x47, 0x93, 0x9D,
+	0x89, 0x3F, 0xDA, 0x50, 0x65, 0xCF, 0x68, 0xD7,
+	0x68, 0xC1, 0x27, 0x8C, 0xC8, 0xC7, 0x98, 0xB2,
+	0x58, 0xB8, 0xFD, 0x55, 0x08, 0xAA, 0xB9, 0x12,
+	0x20, 0xF9, 0x57, 0xCD, 0xCF, 0xED, 0xF3, 0xC5,
+	0x80, 0x0E, 0x4B, 0xEB, 0x19, 0x05, 0xE1, 0x71,
+	0x01, 0x76, 0xEE, 0xDD, 0xBC, 0xDC, 0x66, 0x78,
+	0x9E, 0x0F, 0x1A, 0xCA, 0x1B, 0xAE, 0x3A, 0x79,
+	0x47, 0x1A, 0x54, 0x13, 0x91, 0xD6, 0x1C, 0x6A,
+	0xF9, 0x03, 0x6C, 0x91, 0xF9, 0xB9, 0x5F, 0xA0,
+	0x04, 0x33, 0xDA, 0xBB, 0xD0, 0xC3, 0x5F, 0x69,
+	0xC4, 0x22, 0xBB, 0xBB, 0x79, 0xD0, 0xD8, 0xAB,
+	0x01, 0x53, 0x65, 0xE3, 0x21, 0x22, 0x48, 0xD9,
+	0x34, 0xF5, 0xE1, 0x62, 0x0A, 0x66, 0xD6, 0x3B,
+	0x08, 0x0C, 0x40, 0xD1, 0x28, 0xE0, 0x0B, 0x5F,
+	0x87, 0xE2, 0x2A, 0x2E, 0xD7, 0xD8, 0xD4, 0x48,
+	0x8E, 0x25, 0x64, 0x67, 0x52, 0xD6, 0xC1, 0x73,
+	0x73, 0x4D, 0x28, 0x27, 0x58, 0xDA, 0x23, 0xB5,
+	0x4E, 0xE3, 0xBB, 0xDC, 0x00, 0xF0, 0x57, 0x03,
+	0xD7, 0xD8, 0x11, 0x2B, 0x7B, 0xF2, 0xB0, 0x9A,
+	0x0F, 0xC4, 0xC1, 0x85, 0xAD, 0x09, 0x41, 0x8A,
+	0x36, 0xD7, 0x88, 0x65, 0x84, 0x24, 0xCA, 0x13,
+	0x1A, 0xF8, 0xEC, 0xDD, 0x5F, 0xF9, 0xAE, 0x60,
+	0x59, 0x7D, 0xFA, 0x00, 0x8E, 0x29, 0xBB, 0xA5,
+	0xC2, 0xC6, 0x14, 0x63, 0x88, 0xFC, 0xA8, 0x31,
+	0xD1, 0x83, 0xEB, 0x9C, 0xB8, 0x8F, 0x07, 0xA9,
+	0xBC, 0x82, 0xE8, 0xA3, 0xCE, 0xDE, 0x1A, 0xC7,
+	0x2A, 0x3B, 0x03, 0x0D, 0x94, 0x1D, 0xD5, 0x02,
+	0x09, 0x88, 0xFC, 0x26, 0x21, 0x4A, 0x27, 0x7A,
+	0x29, 0xAC, 0xA0, 0xDF, 0xF1, 0x86, 0x3C, 0xCC,
+	0x04, 0xE8, 0xF4, 0x9E, 0x4E, 0xFA, 0xCD, 0x18,
+	0xCF, 0xBB, 0xCB, 0x30, 0x6A, 0xFD, 0x5A, 0x01,
+	0xBB, 0xE7, 0xF8, 0xA3, 0x6E, 0x1B, 0x74, 0xAC,
+	0x74, 0x88, 0x35, 0x7D, 0xBB, 0x23, 0x64, 0x8F,
+	0xEF, 0xDB, 0xF0, 0x0B, 0x3C, 0x23, 0x74, 0x53,
+	0x0B, 0x9D, 0x08, 0x1F, 0x72, 0x8A, 0xF0, 0x4C,
+	0xA6, 0x63, 0x6B, 0x73, 0x5E, 0xDC, 0xCC, 0xC2,
+	0x00, 0x58, 0xF7, 0x4C, 0xC8, 0xF3, 0x2B, 0xD8,
+	0x5D, 0x2F, 0xFA, 0x93, 0xBE, 0x88, 0x66, 0x2C,
+	0x96, 0xBD, 0xD9, 0x08, 0xC3, 0x01, 0x1F, 0xB1,
+	0x69, 0x1C, 0x1D, 0x92, 0xDC, 0xA5, 0xAD, 0xB6,
+	0xAE, 0xB7, 0xE3, 0x1A, 0x07, 0xBA, 0xB5, 0x19,
+	0xA1, 0x79, 0x48, 0x5D, 0x34, 0x03, 0x48, 0x85,
+	0xB6, 0x9B, 0xAF, 0x71, 0x9C, 0xC5, 0x3E, 0x47,
+	0xE4, 0x97, 0x93, 0xFC, 0x77, 0xC4, 0x6F, 0xB0,
+	0x3A, 0x83, 0x86, 0xC7, 0x54, 0x9E, 0xFF, 0x51,
+	0x4B, 0x6C, 0xDC, 0xC3, 0x05, 0xFF, 0xB2, 0x48,
+	0x26, 0xB3, 0x8D, 0xE6, 0x3B, 0x57, 0xFA, 0x69,
+	0x04, 0x90, 0x78, 0x3F, 0xE9, 0x92, 0x37, 0x63,
+	0x47, 0xE8, 0x7A, 0x1B, 0x3F, 0x37, 0x41, 0x05,
+	0x46, 0x7F, 0xAF, 0xF7, 0x65, 0xE0, 0x6C, 0xC9,
+	0x9B, 0xCF, 0x4E, 0x84, 0x62, 0xB1, 0xF7, 0x10,
+	0x22, 0x95, 0xE6, 0x63, 0xA4, 0xEE, 0xD2, 0xFB,
+	0x0F, 0x2C, 0x70, 0xB8, 0xDC, 0x27, 0x41, 0x2C,
+	0x09, 0x61, 0xF8, 0xC5, 0x89, 0xE6, 0x06, 0x01,
+	0x79, 0xDC, 0x78, 0x59, 0xD9, 0x63, 0xF8, 0x0F,
+	0x2D, 0xA9, 0xEE, 0x13, 0x21, 0x4B, 0xD6, 0x50,
+	0x92, 0x6C, 0x93, 0x14, 0xEB, 0x0C, 0x72, 0x58,
+	0xD9, 0x49, 0xD5, 0x15, 0x2E, 0xC1, 0xF1, 0x71,
+	0x5D, 0x67, 0xE4, 0x8D, 0x5E, 0xD2, 0xE2, 0x01,
+	0xCD, 0xF3, 0x4C, 0x81, 0xF4, 0x17, 0x7F, 0xEB,
+	0x86, 0x0B, 0x03, 0xA3, 0xCF, 0x2A, 0xAC, 0x10,
+	0xF4, 0x87, 0x18, 0x32, 0xFA, 0x0A, 0xB4, 0x76,
+	0x19, 0x26, 0x98, 0xF7, 0xF9, 0xAC, 0x0E, 0xBD,
+	0x07, 0xC3, 0x19, 0xCC, 0x3F, 0x15, 0xAC, 0x70,
+	0x8E, 0xE4, 0x94, 0x9C, 0xE4, 0x02, 0xB6, 0xB3,
+	0xCA, 0xF8, 0x0C, 0xEF, 0x1C, 0x17, 0x20, 0x9F,
+	0xC3, 0x7C, 0xD5, 0x59, 0x1E, 0xEF, 0x0C, 0xD3,
+	0x14, 0x4D, 0xBD, 0xF2, 0x05, 0x2D, 0xC2, 0xBD,
+	0xF5, 0x22, 0x5E, 0x19, 0xC2, 0x51, 0x86, 0x63,
+	0x67, 0x4E, 0x05, 0x8F, 0x56, 0x84, 0x65, 0xBA,
+	0x9F, 0xDF, 0xC5, 0x8E, 0xA0, 0x46, 0xD0, 0x9A,
+	0x91, 0x31, 0x62, 0x44, 0x8A, 0xBD, 0xF2, 0x5C,
+	0x6F, 0x5F, 0x98, 0xD0, 0x04, 0x76, 0x9B, 0xB1,
+	0xF1, 0xDF, 0x7F, 0x62, 0xAD, 0x16, 0x72, 0xAA,
+	0x99, 0xBD, 0xBE, 0x83, 0x6C, 0x9D, 0x60, 0x16,
+	0x6F, 0x92, 0x13, 0xEF, 0x89, 0xEB, 0xB3, 0xBE,
+	0xB1, 0x37, 0x73, 0x38, 0x41, 0x91, 0xB1, 0x93,
+	0xCA, 0x1E, 0x1D, 0x19, 0xA4, 0x94, 0x0C, 0x49,
+	0xC6, 0x1B, 0x93, 0x45, 0x14, 0xE6, 0x23, 0x16,
+	0x6D, 0xC3, 0x35, 0x08, 0x4C, 0x52, 0x45, 0x05,
+	0x4F, 0xCD, 0x5C, 0xA4, 0x45, 0x2A, 0xAB, 0x8A,
+	0xF4, 0xB0, 0xC3, 0x3C, 0xF7, 0xD2, 0xC7, 0x56,
+	0x5F, 0x7C, 0x36, 0xB6, 0x90, 0x07, 0x83, 0x91,
+	0x9C, 0xC1, 0xD7, 0x54, 0x11, 0xF4, 0x27, 0x89,
+	0xBE, 0x59, 0xCF, 0xF1, 0xBC, 0x66, 0x50, 0xCE,
+	0x2D, 0x34, 0xF3, 0x35, 0x0E, 0xFE, 0xFD, 0xC9,
+	0xDE, 0x93, 0xDF, 0xD5, 0x3A, 0x53, 0xFD, 0xF0,
+	0x8B, 0x7D, 0x8C, 0x50, 0xD4, 0x2C, 0x4F, 0x63,
+	0x5B, 0xB9, 0xC5, 0x2E, 0xED, 0x04, 0xA4, 0x43,
+	0xE7, 0xB2, 0x03, 0x1C, 0xBC, 0x81, 0xB3, 0xE1,
+	0x33, 0x71, 0xD2, 0x76, 0x04, 0x2C, 0x16, 0xB7,
+	0xDC, 0xDF, 0x76, 0xD1, 0xE0, 0x7D, 0x14, 0x1D,
+	0xAF, 0x8C, 0x8E, 0x99, 0xE8, 0xD4, 0x36, 0x55,
+	0x5A, 0xBF, 0x3A, 0xC0, 0x7F, 0x96, 0xB4, 0xFF,
+	0xB7, 0x45, 0xBE, 0x6D, 0x25, 0xC5, 0xD3, 0xC2,
+	0xB1, 0x39, 0x63, 0x1C, 0xD9, 0x30, 0xC9, 0xF3,
+	0x03, 0x2A, 0xF7, 0xDF, 0x4C, 0x03, 0x71, 0x72,
+	0xDC, 0x1B, 0xFD, 0xB2, 0xB2, 0x95, 0xE1, 0x61,
+	0x8C, 0x61, 0xD2, 0xC4, 0x3C, 0x32, 0x74, 0x26,
+	0xF4, 0x49, 0x1F, 0x0C, 0x34, 0x92, 0x4F, 0xC2,
+	0x79, 0x6E, 0x00, 0xA5, 0x04, 0x1C, 0xFB, 0xEE,
+	0x26, 0x0D, 0x1F, 0xF9, 0x46, 0x10, 0xD9, 0x60,
+	0xC0, 0x75, 0xAC, 0xA3, 0x41, 0x38, 0xA6, 0x3E,
+	0x16, 0x8B, 0xAB, 0xB6, 0x2D, 0x67, 0x7C, 0x17,
+	0x27, 0x53, 0x70, 0xDC, 0x8B, 0x74, 0x96, 0xC0,
+	0x79, 0xD4, 0x77, 0x4A, 0x0B, 0xA0, 0x6B, 0x2E,
+	0x65, 0x8D, 0x2E, 0x26, 0xA1, 0x24, 0xF2, 0xA2,
+	0x0F, 0xE5, 0xE3, 0x50, 0x41, 0x93, 0x19, 0x82,
+	0x3F, 0xE4, 0x48, 0x99, 0x85, 0xE9, 0x28, 0x0B,
+	0xB5, 0xBB, 0x4A, 0x4D, 0x48, 0xB6, 0xB1, 0x33,
+	0xC6, 0xD4, 0xD1, 0xB9, 0x87, 0x5D, 0x10, 0x9E,
+	0xE7, 0xD0, 0x50, 0x74, 0x65, 0xE4, 0x97, 0x00,
+	0xF0, 0xB6, 0xB1, 0x5F, 0xAD, 0x42, 0x6E, 0x93,
+	0x94, 0xB9, 0xDB, 0xCE, 0x82, 0xC3, 0xC9, 0x87,
+	0x24, 0xB8, 0x71, 0x11, 0x15, 0xEC, 0x0A, 0x90,
+	0x4F, 0x0F, 0xA7, 0x90, 0x6B, 0x61, 0x03, 0x14,
+	0xCD, 0x86, 0xFA, 0xC4, 0xD0, 0xFF, 0xC5, 0x98,
+	0x52, 0x6C, 0x39, 0x25, 0x5F, 0x0F, 0xA2, 0x12,
+	0x48, 0xDD, 0xDB, 0xDB, 0x82, 0x0B, 0x1D, 0x38,
+	0x71, 0x40, 0xBF, 0x68, 0xDC, 0x58, 0x68, 0x81,
+	0xEA, 0x0D, 0x7B, 0x74, 0x02, 0x30, 0x2D, 0xAE,
+	0x7C, 0xCB, 0x2C, 0x63, 0x41, 0xD2, 0x2E, 0xD7,
+	0x32, 0x2B, 0x30, 0x4B, 0x60, 0xFE, 0xA1, 0x08,
+	0x38, 0xF6, 0x30, 0x82, 0x1F, 0x23, 0x76, 0xDE,
+	0xE8, 0xDD, 0xDD, 0x76, 0x5A, 0xEB, 0xD9, 0xBC,
+	0x33, 0xDD, 0xB9, 0xCC, 0x09, 0x3A, 0x33, 0x21,
+	0x93, 0x73, 0xCD, 0xD5, 0x2C, 0x92, 0x5E, 0x2D,
+	0x94, 0x19, 0x15, 0xCF, 0xDD, 0x06, 0xCA, 0xF0,
+	0x50, 0x1D, 0x45, 0x9C, 0x8A, 0x52, 0x7E, 0xEF,
+	0xE9, 0x01, 0x6A, 0x2C, 0xD9, 0xB6, 0x22, 0xB3,
+	0x47, 0x32, 0x41, 0xDF, 0xA2, 0x48, 0x19, 0xFB,
+	0x19, 0x63, 0x05, 0xF3, 0x71, 0x77, 0x13, 0x9A,
+	0xD6, 0xEA, 0xB4, 0xDC, 0xCF, 0xA8, 0x70, 0x4F,
+	0x21, 0xA7, 0x02, 0x9B, 0x5C, 0xFC, 0x2F, 0x4D,
+	0x97, 0xD3, 0x85, 0xE5, 0xB2, 0xA1, 0xEA, 0xF5,
+	0x7B, 0x75, 0x3B, 0x91, 0xE7, 0x70, 0xF7, 0x6F,
+	0x7E, 0xBA, 0x63, 0xFC, 0x16, 0xF6, 0x8D, 0xBE,
+	0xD1, 0x1E, 0x8B, 0xF0, 0xD7, 0xAB, 0x2D, 0x66,
+	0x1C, 0x82, 0xBF, 0xE1, 0xB7, 0x5A, 0x4F, 0x94,
+	0x8E, 0x28, 0xEB, 0x43, 0x84, 0x16, 0x7E, 0xD8,
+	0x49, 0xF1, 0x58, 0xB7, 0x1A, 0xF6, 0x48, 0x02,
+	0x3D, 0x67, 0x60, 0x03, 0xF9, 0xD8, 0xEC, 0x60,
+	0xBD, 0xD6, 0x72, 0xD2, 0x77, 0xBD, 0xEC, 0x46,
+	0x78, 0x50, 0x7C, 0x0C, 0xDD, 0x17, 0x4C, 0x31,
+	0x78, 0x40, 0xE3, 0x0A, 0x9A, 0x18, 0x43, 0xBF,
+	0xF3, 0xA8, 0xB5, 0xE8, 0xF2, 0x25, 0x12, 0x98,
+	0x91, 0xD2, 0x2C, 0xBF, 0x04, 0x5B, 0xFC, 0x1F,
+	0x87, 0xF0, 0xC2, 0x5F, 0x81, 0xFC, 0xF8, 0x29,
+	0x88, 0x1F, 0xB1, 0x72, 0x86, 0x90, 0xC0, 0x7D,
+	0x8A, 0xA5, 0x39, 0xFE, 0x6D, 0xBC, 0xAA, 0x51,
+	0x5D, 0x2E, 0x23, 0xCF, 0xB6, 0x2E, 0x49, 0xC2,
+	0xC1, 0xD3, 0xDC, 0x16, 0x61, 0xF9, 0x0B, 0x74,
+	0xE8, 0xD9, 0x47, 0xF0, 0xE4, 0x06, 0x0A, 0xC0,
+	0x80, 0x82, 0x7C, 0xE9, 0xFF, 0x2E, 0xE9, 0x2E,
+	0xC8, 0x20, 0x56, 0x21, 0xC6, 0xC5, 0xFC, 0x70,
+	0xC9, 0xE2, 0x5C, 0xA7, 0x29, 0x81, 0x7B, 0x03,
+	0xB3, 0x6A, 0xFB, 0x49, 0x43, 0x4F, 0x12, 0xEA,
+	0x7E, 0x1D, 0xCC, 0x2E, 0xB9, 0x6C, 0xB9, 0x71,
+	0x0A, 0x0C, 0x82, 0x4D, 0x67, 0xCA, 0xC5, 0x0F,
+	0x2E, 0x40, 0xB0, 0x25, 0x7E, 0xAF, 0x07, 0xB3,
+	0x10, 0xF3, 0xA6, 0xED, 0xB0, 0x5E, 0x56, 0x27,
+	0x2A, 0xB2, 0x7E, 0xFB, 0x6D, 0x56, 0xC1, 0xCF,
+	0x28, 0x2A, 0xEE, 0x08, 0x74, 0xC1, 0x87, 0xB9,
+	0x49, 0xEF, 0x67, 0x3D, 0xCD, 0x5D, 0x56, 0x99,
+	0xFC, 0x64, 0xC9, 0xA0, 0xDE, 0x15, 0x11, 0xD4,
+	0x03, 0x52, 0x8E, 0x00, 0x58, 0xA3, 0x8E, 0x36,
+	0xFC, 0xED, 0xC6, 0x4C, 0x34, 0x9B, 0x53, 0x1D,
+	0x12, 0xE4, 0xB9, 0xFC, 0xF5, 0xE6, 0x63, 0xD8,
+	0x0A, 0x0B, 0x94, 0x42, 0x72, 0x9F, 0x02, 0x6C,
+	0xB8, 0x2D, 0xDC, 0x05, 0xC2, 0xDD, 0xD2, 0x2E,
+	0x4C, 0xC5, 0x91, 0x00, 0x50, 0x72, 0x07, 0x1B,
+	0x46, 0x54, 0x42, 0x62, 0x2E, 0xC9, 0xAE, 0xC1,
+	0x4A, 0x59, 0x5D, 0x3F, 0x0C, 0x73, 0x26, 0xCE,
+	0x01, 0x35, 0x6B, 0x2F, 0x00, 0x85, 0x26, 0x75,
+	0x4B, 0x58, 0xEB, 0xC3, 0x29, 0x22, 0x90, 0x68,
+	0x99, 0x53, 0x18, 0xB7, 0x96, 0xAF, 0x5F, 0xA3,
+	0xC4, 0xE8, 0x56, 0x21, 0x8D, 0x90, 0x40, 0x14,
+	0x5D, 0xE5, 0xB1, 0x5C, 0x5C, 0xDF, 0x90, 0x5F,
+	0x26, 0xF1, 0x9F, 0x34, 0xA5, 0xEC, 0x70, 0xA5,
+	0xEC, 0xBA, 0x85, 0xE8, 0x0C, 0xC1, 0xEE, 0x82,
+	0x16, 0xD1, 0xC9, 0x81, 0xC4, 0xF9, 0x72, 0xAB,
+	0x37, 0x06, 0x9C, 0x1D, 0x38, 0x91, 0xD9, 0x20,
+	0x26, 0xD1, 0x15, 0xC9, 0x3D, 0x68, 0x15, 0xF9,
+	0x2B, 0xAF, 0xC8, 0x4A, 0xF4, 0xFE, 0xCB, 0x23,
+	0x1E, 0x38, 0x4B, 0x83, 0xF2, 0x3B, 0x94, 0xC9,
+	0xC9, 0x9B, 0x34, 0x74, 0xC6, 0x73, 0x46, 0x13,
+	0xEC, 0xB1, 0xB2, 0x24, 0x55, 0xD7, 0xF0, 0x1D,
+	0x24, 0x31, 0x36, 0x48, 0x38, 0x54, 0x3B, 0x38,
+	0x5A, 0x56, 0x98, 0x62, 0x84, 0xAF, 0x22, 0x85,
+	0xE4, 0xCE, 0x06, 0x52, 0x67, 0x9F, 0xA1, 0x5B,
+	0x54, 0x57, 0x06, 0xE9, 0x03, 0xE1, 0x9F, 0xEB,
+	0x67, 0x74, 0x3E, 0x35, 0xD5, 0xF5, 0xB0, 0xF5,
+	0x56, 0xBE, 0xEA, 0x74, 0x8B, 0xB4, 0xAB, 0x3A,
+	0x3C, 0x5B, 0xD0, 0x9A, 0xFF, 0x7F, 0x0D, 0xB5,
+	0x62, 0xF8, 0xA4, 0xDA, 0x21, 0x4D, 0xCF, 0x0F,
+	0x71, 0xE0, 0x41, 0xFF, 0x88, 0x35, 0x4E, 0x94,
+	0x24, 0x23, 0xF6, 0x1B, 0xD7, 0x2A, 0x49, 0x2D,
+	0x06, 0xC2, 0xFF, 0x74, 0xA9, 0x4C, 0xDC, 0x27,
+	0xF3, 0x76, 0x63, 0x22, 0x79, 0x71, 0xA5, 0xD7,
+	0xF7, 0x84, 0x7F, 0x3B, 0xF7, 0xD3, 0x29, 0x88,
+	0x99, 0x85, 0x29, 0xB1, 0x0E, 0x50, 0x98, 0x03,
+	0xD2, 0xCD, 0xF6, 0x94, 0xD7, 0x3C, 0x84, 0xAD,
+	0x0E, 0x5A, 0x85, 0xFF, 0xBD, 0xFD, 0x4B, 0x14,
+	0xBB, 0x2D, 0xAA, 0x7E, 0x2C, 0x90, 0x50, 0x99,
+	0x5E, 0x9A, 0x4A, 0x2E, 0xE1, 0x22, 0x85, 0x1D,
+	0xD5, 0x91, 0x05, 0x41, 0x2B, 0xAB, 0x3A, 0xAD,
+	0xB8, 0x4D, 0x93, 0x70, 0x48, 0x10, 0x6A, 0xF9,
+	0x9C, 0x9C, 0x70, 0x42, 0xDC, 0x86, 0xDE, 0x9F,
+	0x6E, 0x6F, 0xD9, 0x72, 0x31, 0xF1, 0x97, 0x38,
+	0x50, 0x4C, 0x66, 0x47, 0xAF, 0xC7, 0x93, 0xFF,
+	0xB3, 0x89, 0x00, 0xE0, 0xD8, 0xE6, 0x0A, 0xD9,
+	0xC5, 0x48, 0xFD, 0x63, 0xCE, 0x88, 0x3B, 0x23,
+	0x3D, 0x80, 0xB5, 0x35, 0xF5, 0x35, 0x46, 0xB0,
+	0x99, 0xF9, 0xAC, 0x10, 0x0C, 0x69, 0x2F, 0x70,
+	0xA0, 0x28, 0x38, 0x77, 0x36, 0x3B, 0xAC, 0xAA,
+	0x46, 0x40, 0xFA, 0x77, 0x64, 0xDE, 0x12, 0x0B,
+	0xE5, 0x52, 0x98, 0x70, 0x1E, 0xA1, 0x73, 0x88,
+	0x34, 0xC2, 0x67, 0xDE, 0x91, 0xA4, 0x39, 0x8C,
+	0x0B, 0xC0, 0x9F, 0x24, 0x49, 0x21, 0xBD, 0x20,
+	0x33, 0x1A, 0x00, 0x6E, 0xC7, 0xFD, 0x15, 0x34,
+	0x3E, 0x22, 0xFB, 0xEA, 0x8B, 0xD3, 0x21, 0xD2,
+	0xDF, 0xE3, 0x61, 0x55, 0x08, 0xF6, 0x03, 0x93,
+	0xD3, 0xFF, 0x36, 0x0E, 0x14, 0x87, 0x5C, 0x7F,
+	0x10, 0x10, 0x3F, 0x28, 0x2A, 0x22, 0xBB, 0xB7,
+	0x91, 0xAD, 0xAB, 0xD6, 0x7A, 0x15, 0xE3, 0xB1,
+	0xC4, 0x28, 0x58, 0x61, 0x2E, 0x10, 0x55, 0xAB,
+	0x8A, 0xAC, 0xC4, 0xE0, 0x35, 0x1A, 0x8C, 0xC9,
+	0xAD, 0xA7, 0x25, 0xD4, 0x9C, 0x58, 0x3F, 0xAA,
+	0x83, 0xCA, 0x27, 0x84, 0xC3, 0xDB, 0xFB, 0x3E,
+	0x7F, 0x71, 0x36, 0xA6, 0x7C, 0x8A, 0x88, 0x54,
+	0x77, 0x17, 0xDF, 0x87, 0xB6, 0x4A, 0xFA, 0x77,
+	0x01, 0x98, 0xD6, 0x28, 0xF6, 0x0E, 0x4B, 0x53,
+	0xA7, 0xF5, 0xB6, 0x3E, 0x0C, 0x7B, 0x74, 0x58,
+	0x57, 0x11, 0x6A, 0xAB, 0x1E, 0xC4, 0x8E, 0xA8,
+	0x79, 0xE7, 0xDD, 0x86, 0xB7, 0x0C, 0x54, 0xD9,
+	0x13, 0xB6, 0x18, 0x26, 0x89, 0x24, 0x3C, 0xE9,
+	0x06, 0x68, 0x95, 0x00, 0xF8, 0x6D, 0xAB, 0xA3,
+	0xE7, 0xB2, 0x58, 0xB8, 0xD6, 0x95, 0x95, 0xDE,
+	0xBA, 0x3F, 0x7C, 0xBE, 0x46, 0x0F, 0x64, 0x45,
+	0x41, 0xA1, 0x8B, 0xD4, 0x74, 0xD3, 0x58, 0x5D,
+	0xB8, 0x2F, 0x51, 0x3A, 0xA1, 0x40, 0xEE, 0x0A,
+	0xBA, 0x4C, 0xD7, 0xC7, 0x2D, 0x36, 0xC3, 0x32,
+	0x64, 0x46, 0x22, 0x27, 0x9B, 0x2F, 0x02, 0x2E,
+	0x4C, 0xDA, 0x0B, 0x67, 0x5E, 0xC0, 0x3B, 0xB0,
+	0x5D, 0x54, 0x46, 0xD4, 0x76, 0x2C, 0xE6, 0xB0,
+	0xF9, 0x18, 0x17, 0xFE, 0x6D, 0x86, 0xE4, 0xAB,
+	0xD6, 0xBD, 0x89, 0x90, 0x78, 0xF8, 0xFB, 0x0A,
+	0x71, 0xBF, 0xFC, 0x3B, 0xB2, 0x69, 0x3F, 0x32,
+	0x7D, 0x40, 0x8A, 0x5A, 0x7E, 0x13, 0xCA, 0x68,
+	0xA4, 0x76, 0xE4, 0x24, 0x6C, 0x1E, 0xEB, 0xA5,
+	0x48, 0x59, 0xDC, 0xEA, 0xA1, 0x15, 0x3F, 0xCA,
+	0x24, 0xA6, 0xE6, 0x96, 0x63, 0xF5, 0x83, 0x8F,
+	0xA9, 0x3C, 0xEA, 0x60, 0x62, 0xC4, 0x0A, 0x86,
+	0xBA, 0x30, 0x77, 0xCE, 0xDC, 0x74, 0x7F, 0x6F,
+	0x06, 0x86, 0x99, 0xA2, 0x8D, 0xDB, 0xAC, 0xC1,
+	0xC9, 0xBB, 0x52, 0xF1, 0xB9, 0x88, 0xA4, 0x4A,
+	0x79, 0xD1, 0x17, 0xAC, 0xE3, 0xE4, 0x87, 0x90,
+	0x2D, 0x23, 0x3E, 0xB6, 0x7B, 0xF3, 0xE7, 0xEE,
+	0xC0, 0x26, 0x57, 0xD2, 0xAE, 0xB2, 0x0A, 0x2E,
+	0xBE, 0x63, 0x02, 0x7E, 0x8E, 0xAE, 0x52, 0x2E,
+	0x72, 0x18, 0xFE, 0x42, 0x79, 0x36, 0x07, 0x8A,
+	0x78, 0x7F, 0xF0, 0x78, 0x23, 0x92, 0x7E, 0x9D,
+	0x2C, 0x2A, 0x6E, 0xD3, 0xFD, 0xE3, 0x3F, 0xD6,
+	0xF7, 0x0B, 0x96, 0x0C, 0x37, 0x4D, 0x51, 0xFB,
+	0x33, 0xA4, 0xB5, 0x73, 0x83, 0x98, 0xDC, 0x3B,
+	0x96, 0xB5, 0x10, 0xF5, 0x18, 0xB2, 0x46, 0x8C,
+	0x5B, 0x5F, 0x01, 0x90, 0x09, 0xC8, 0x0E, 0x05,
+	0x32, 0x53, 0x15, 0x1E, 0xD9, 0xCE, 0x71, 0x45,
+	0xBC, 0xDA, 0xF9, 0x12, 0x4F, 0x87, 0xD0, 0x4F,
+	0x68, 0xD2, 0x91, 0x62, 0x50, 0x84, 0x57, 0x2C,
+	0x55, 0x41, 0xF8, 0xCC, 0xAE, 0x59, 0xAD, 0xF5,
+	0x96, 0x49, 0x3C, 0x21, 0x1F, 0x0B, 0xA6, 0x23,
+	0xF8, 0x47, 0x20, 0x6A, 0x43, 0x7C, 0xA7, 0xA9,
+	0xD8, 0xD9, 0xEE, 0xFF, 0xF0, 0x48, 0x36, 0x4B,
+	0x9A, 0xE0, 0x51, 0x3A, 0xEE, 0x61, 0x22, 0xC9,
+	0xE8, 0x77, 0x21, 0xEC, 0x30, 0x48, 0xFD, 0x42,
+	0xE1, 0x36, 0xA6, 0x16, 0x5D, 0xEA, 0x43, 0xAD,
+	0x46, 0xB0, 0x03, 0xBA, 0x99, 0x12, 0xD8, 0x46,
+	0x1E, 0x37, 0xE8, 0xDE, 0x74, 0x28, 0x51, 0xBB,
+	0x85, 0x6F, 0xCE, 0x6A, 0x9B, 0x38, 0x4F, 0x05,
+	0x77, 0x37, 0x1E, 0x7C, 0x48, 0xDA, 0x2C, 0x14,
+	0x16, 0xB2, 0x77, 0xC7, 0xD7, 0x5A, 0xEC, 0x24,
+	0x29, 0x30, 0x04, 0x63, 0x5F, 0x49, 0xA3, 0x97,
+	0x3D, 0xC9, 0xC8, 0xFC, 0x54, 0x37, 0x60, 0xFE,
+	0xD5, 0x1A, 0xAF, 0xB8, 0x07, 0xA9, 0x27, 0x62,
+	0xDB, 0x2D, 0x99, 0x78, 0xEB, 0x1E, 0x7A, 0x6C,
+	0xCB, 0x7D, 0x26, 0x8F, 0x16, 0xCC, 0xAC, 0x5B,
+	0x6F, 0xAD, 0xBE, 0x22, 0x4C, 0xDD, 0x70, 0x19,
+	0x61, 0xA7, 0x0C, 0x8C, 0x66, 0xE1, 0x1A, 0x74,
+	0x16, 0x65, 0xB3, 0xA6, 0xF2, 0x44, 0x9A, 0x07,
+	0x4C, 0x27, 0x06, 0x57, 0x5F, 0xC0, 0x56, 0x02,
+	0x08, 0x75, 0xE8, 0xEC, 0x8F, 0x75, 0x6D, 0x5D,
+	0xF6, 0x21, 0x03, 0xFF, 0x8B, 0x40, 0x3C, 0x87,
+	0xED, 0x1E, 0x1C, 0x7E, 0xFF, 0xB2, 0x32, 0xAF,
+	0x28, 0xEC, 0x0D, 0x47, 0xD7, 0x95, 0x38, 0x23,
+	0x9A, 0xA5, 0x26, 0x86, 0x1F, 0x3E, 0xE7, 0x21,
+	0x52, 0x2C, 0x3F, 0xD2, 0xD8, 0xD7, 0xB6, 0x55,
+	0x08, 0x87, 0x30, 0x26, 0xED, 0xF6, 0x0A, 0xEF,
+	0x6A, 0xA7, 0x67, 0x38, 0xAA, 0xBC, 0x17, 0x9C,
+	0xEE, 0xC8, 0x68, 0x61, 0x23, 0xC2, 0xF8, 0x49,
+	0x17, 0x27, 0xFE, 0x70, 0xE8, 0xDE, 0x2A, 0xC4,
+	0xC0, 0x9F, 0x6B, 0xD1, 0xBF, 0x91, 0xFF, 0xED,
+	0xB5, 0x5C, 0x5C, 0xFC, 0xC6, 0xAB, 0xA5, 0xD1,
+	0x3C, 0xD1, 0x48, 0x34, 0x37, 0x86, 0x46, 0x52,
+	0xC2, 0x49, 0x73, 0x50, 0xA4, 0xDB, 0x26, 0xCF,
+	0x61, 0x72, 0xE0, 0x33, 0xEB, 0x5A, 0xCC, 0xF6,
+	0x7D, 0x17, 0x38, 0xD3, 0x57, 0xD0, 0x11, 0x8C,
+	0x19, 0x94, 0xBB, 0xE6, 0x14, 0xF4, 0x38, 0xC9,
+	0x33, 0xC9, 0x29, 0x83, 0x76, 0x99, 0x0B, 0x90,
+	0xD5, 0xEB, 0x67, 0xB7, 0x30, 0x12, 0x6C, 0x61,
+	0xD2, 0xDA, 0x71, 0xE6, 0xC1, 0x84, 0x05, 0x2C,
+	0xFC, 0x01, 0x2C, 0x74, 0x1E, 0xCF, 0xBD, 0xB1,
+	0x98, 0xC6, 0x58, 0x2D, 0xEA, 0x00, 0x41, 0x25,
+	0x0F, 0xDB, 0x79, 0xF0, 0xA0, 0xB5, 0x81, 0xD4,
+	0x88, 0x72, 0x0A, 0x4C, 0xB8, 0xA2, 0x99, 0x36,
+	0x87, 0xAA, 0x40, 0x22, 0xF0, 0x8D, 0xC1, 0x7E,
+	0xED, 0xFF, 0x44, 0x85, 0x00, 0x97, 0xC7, 0x22,
+	0x40, 0xBE, 0xFF, 0x9F, 0x63, 0x81, 0x8C, 0x78,
+	0x41, 0x1B, 0x85, 0x8B, 0x03, 0x55, 0x2E, 0x84,
+	0x0E, 0xEA, 0xE7, 0xE5, 0x87, 0x30, 0xB8, 0x02,
+	0xC8, 0x07, 0x31, 0xC9, 0x4F, 0xD4, 0xA8, 0xC8,
+	0xAB, 0x04, 0x9F, 0x4C, 0x54, 0x6A, 0x96, 0x46,
+	0xA1, 0x50, 0xD9, 0x1A, 0xAD, 0xA0, 0x18, 0xC3,
+	0x03, 0xAA, 0x72, 0xB1, 0x99, 0x86, 0xE5, 0x91,
+	0xC0, 0xA4, 0xE4, 0x12, 0xE0, 0xEB, 0x01, 0xF9,
+	0xFD, 0x48, 0xBA, 0x81, 0x11, 0xF8, 0xFF, 0x92,
+	0xC9, 0xB6, 0xD3, 0xE5, 0x5A, 0x60, 0xFD, 0xC6,
+	0x59, 0xFA, 0x17, 0x81, 0x60, 0x5E, 0x4C, 0x4B,
+	0x8A, 0x54, 0xD0, 0xA8, 0xE9, 0x84, 0x10, 0x52,
+	0xF7, 0x85, 0x5D, 0xE1, 0xB1, 0x90, 0xA8, 0xC4,
+	0x22, 0x5C, 0x9D, 0xE5, 0x97, 0x77, 0xE2, 0x2B,
+	0xF6, 0x2F, 0x4B, 0xD4, 0xB1, 0x46, 0xF0, 0x4C,
+	0x26, 0xB1, 0xCF, 0x51, 0x49, 0x71, 0xEB, 0xB7,
+	0xCE, 0x6B, 0x49, 0xAA, 0x1F, 0x02, 0xC7, 0x6E,
+	0x5F, 0x63, 0x28, 0x22, 0xD9, 0xC0, 0xF5, 0x3E,
+	0xA6, 0x02, 0x08, 0x13, 0x9D, 0x86, 0x6C, 0x78,
+	0x79, 0x0C, 0xA7, 0xCB, 0xED, 0xEA, 0xCC, 0x98,
+	0x0B, 0xCA, 0xD3, 0x24, 0xE2, 0x34, 0xCC, 0xD7,
+	0x40, 0x09, 0x61, 0x9D, 0x3A, 0x94, 0xF0, 0x2E,
+	0xEB, 0x04, 0xE0, 0xDF, 0x68, 0xCF, 0xF1, 0xC1,
+	0x24, 0x55, 0xCE, 0xE9, 0xF6, 0xE0, 0x75, 0x63,
+	0x6E, 0x5A, 0x91, 0x66, 0xF4, 0xEE, 0x5B, 0x49,
+	0xB7, 0x6E, 0x40, 0x24, 0x58, 0x3F, 0x44, 0x2D,
+	0xF8, 0xD6, 0xEB, 0x0A, 0x20, 0xF7, 0x97, 0xCB,
+	0xCC, 0x36, 0xDB, 0x4B, 0x2E, 0x6D, 0xDF, 0x61,
+	0x2B, 0x2D, 0x43, 0x63, 0x18, 0xD8, 0xCF, 0x22,
+	0x9A, 0xB9, 0x52, 0x20, 0x7B, 0x96, 0xDB, 0xD9,
+	0x3E, 0xD5, 0xE8, 0xEC, 0x42, 0xD7, 0xF3, 0x98,
+	0xB9, 0x37, 0xD6, 0xE5, 0x04, 0xCE, 0xF2, 0x41,
+	0xF7, 0x2C, 0x9C, 0x12, 0x2C, 0x65, 0x1A, 0x62,
+	0xEC, 0x0B, 0xBD, 0x4B, 0x49, 0xCB, 0xFC, 0x64,
+	0x93, 0xC4, 0xAA, 0x18, 0xED, 0x24, 0x6A, 0x4D,
+	0x43, 0xBD, 0x24, 0x69, 0x2A, 0x98, 0x56, 0xC5,
+	0xE2, 0xAF, 0x14, 0x40, 0x6F, 0xB8, 0x35, 0x6C,
+	0x55, 0xB9, 0x0F, 0xC8, 0x92, 0x00, 0x60, 0xB9,
+	0x92, 0x3A, 0xD8, 0xBC, 0x4F, 0xBC, 0x9B, 0xF1,
+	0x16, 0x6F, 0xDE, 0xF6, 0x33, 0xB1, 0xD3, 0xD3,
+	0x02, 0xAC, 0xA5, 0xEA, 0xB0, 0xCC, 0xFA, 0xF2,
+	0xE3, 0x70, 0x2E, 0x47, 0xA0, 0x45, 0xF4, 0x85,
+	0x2D, 0x26, 0xCD, 0x89, 0x63, 0xB8, 0x13, 0x0E,
+	0xC1, 0x66, 0x5B, 0xD8, 0xB7, 0x1E, 0x99, 0x33,
+	0x87, 0x67, 0x38, 0xA0, 0x69, 0x05, 0x95, 0xEA,
+	0xFD, 0xB5, 0x3C, 0x1D, 0x4B, 0x9C, 0xCD, 0x02,
+	0x6F, 0x42, 0x2D, 0xF0, 0xF0, 0xB7, 0xA4, 0x1D,
+	0x8D, 0x54, 0xEC, 0x61, 0x3F, 0x29, 0xE4, 0x5A,
+	0xA7, 0x37, 0x09, 0x28, 0x97, 0x04, 0x33, 0x77,
+	0xD3, 0xBF, 0xB2, 0x18, 0xAC, 0xDC, 0x34, 0xB8,
+	0xE5, 0x54, 0xA9, 0x54, 0x22, 0x88, 0x2F, 0xF6,
+	0xA0, 0xDD, 0xA9, 0x36, 0xE3, 0xB4, 0xDE, 0x68,
+	0x1E, 0xB5, 0x15, 0x23, 0xC7, 0xF0, 0x9D, 0x31,
+	0x7B, 0x2B, 0x3C, 0xBB, 0x39, 0xF2, 0xC6, 0xBE,
+	0x60, 0x38, 0xA8, 0x5E, 0xEA, 0x81, 0xA9, 0x46,
+	0xCB, 0xDB, 0x35, 0x2C, 0xC7, 0xEA, 0xFE, 0xDA,
+	0x1E, 0xAA, 0x89, 0x33, 0x2C, 0xEF, 0x01, 0xB3,
+	0xF9, 0x32, 0x16, 0x05, 0x11, 0x47, 0x9C, 0x1F,
+	0x85, 0x2D, 0xE1, 0x67, 0x40, 0xD9, 0xC1, 0xC5,
+	0xBE, 0xA4, 0xBE, 0xAA, 0x2B, 0x0F, 0xF5, 0x45,
+	0x66, 0x15, 0xBD, 0x58, 0x7B, 0xBF, 0x3C, 0x7F,
+	0x24, 0xE5, 0x74, 0x17, 0xD7, 0x97, 0x02, 0xCB,
+	0x09, 0x94, 0x46, 0x31, 0xC5, 0x65, 0xF2, 0x70,
+	0x46, 0x6C, 0xB3, 0xB0, 0xFE, 0xD4, 0x38, 0xAB,
+	0x82, 0x9B, 0x00, 0x6D, 0x6A, 0xD3, 0x70, 0x1A,
+	0x22, 0xF9, 0x82, 0x51, 0x33, 0x29, 0xD8, 0x08,
+	0x88, 0xB3, 0xAF, 0xB5, 0xD8, 0x65, 0xC2, 0xAD,
+	0x3B, 0x37, 0xA2, 0x92, 0xB5, 0xAF, 0x6F, 0xD9,
+	0x2F, 0xAB, 0xCF, 0xAA, 0xA5, 0x43, 0xDD, 0xE7,
+	0x4D, 0x15, 0xF5, 0x8B, 0xD2, 0x8B, 0x16, 0x1A,
+	0x40, 0xE0, 0x51, 0x53, 0x5E, 0xA7, 0xE8, 0x9C,
+	0x6C, 0x10, 0x98, 0x7E, 0x3E, 0x6C, 0x9B, 0x02,
+	0xA5, 0x19, 0x75, 0x7C, 0x05, 0xCF, 0x74, 0x22,
+	0x9B, 0xD3, 0x4D, 0xE6, 0x49, 0x39, 0xAA, 0x75,
+	0x75, 0x4E, 0x59, 0xD4, 0x5E, 0x44, 0x05, 0x30,
+	0x04, 0x53, 0x95, 0xBB, 0x85, 0xE7, 0xF4, 0xF4,
+	0x82, 0x84, 0x73, 0x0B, 0x47, 0x34, 0x6A, 0xC6,
+	0x68, 0x1C, 0xBA, 0xE1, 0x4C, 0x85, 0xDD, 0x0D,
+	0xF2, 0xD5, 0x27, 0x28, 0xAF, 0xDB, 0xD2, 0x98,
+	0x44, 0x13, 0x6B, 0xF6, 0x8D, 0xBD, 0xE5, 0xF6,
+	0x9B, 0xC1, 0x39, 0x35, 0x44, 0x65, 0xBB, 0x47,
+	0x8B, 0xAE, 0xF5, 0x02, 0x3D, 0xA2, 0xE4, 0x1B,
+	0x69, 0x62, 0xFE, 0xB7, 0xDE, 0xEC, 0x20, 0x41,
+	0x99, 0xEC, 0xC2, 0xCE, 0x76, 0x91, 0xA1, 0x91,
+	0xD1, 0x90, 0x9C, 0xD1, 0x20, 0xCE, 0x5A, 0x6D,
+	0xB5, 0x9F, 0x6C, 0xA3, 0x9D, 0x13, 0x66, 0xE1,
+	0x43, 0xB3, 0xC7, 0xFD, 0xBA, 0xCA, 0x2D, 0x3D,
+	0x92, 0x3A, 0x1A, 0x67, 0xDF, 0x0F, 0xC6, 0x08,
+	0xEF, 0xE7, 0x25, 0x99, 0x0B, 0xC4, 0xF5, 0x93,
+	0xCA, 0x8B, 0x87, 0x80, 0x29, 0x01, 0xDE, 0x1E,
+	0x78, 0x7E, 0x86, 0x2D, 0x01, 0xD6, 0x04, 0x07,
+	0x6E, 0xEE, 0xDC, 0xB6, 0x70, 0xF6, 0xF9, 0x5A,
+	0x7F, 0xF2, 0xC1, 0xAE, 0x57, 0x68, 0x29, 0xD7,
+	0xD7, 0xD6, 0x5A, 0xAC, 0x4D, 0x58, 0xA8, 0x0F,
+	0x1B, 0x71, 0x36, 0x71, 0x4B, 0x89, 0x29, 0xBA,
+	0xC9, 0xEC, 0xBD, 0xBE, 0x14, 0x94, 0x92, 0xEC,
+	0xF5, 0xD9, 0x8B, 0x7C, 0xB0, 0x0D, 0x62, 0x46,
+	0xED, 0xF4, 0x43, 0x36, 0x9C, 0xA0, 0x71, 0xA7,
+	0x20, 0x79, 0xDF, 0x2A, 0x8C, 0x70, 0xEC, 0x06,
+	0x36, 0x9B, 0xC2, 0x00, 0x50, 0xB2, 0xB6, 0x6C,
+	0x78, 0x28, 0x39, 0x5F, 0xAA, 0xBF, 0xD3, 0x82,
+	0x48, 0x25, 0xCE, 0xF7, 0x12, 0x0C, 0x46, 0xF7,
+	0x31, 0x17, 0x21, 0x10, 0x99, 0x0C, 0x55, 0xDF,
+	0xC6, 0xF0, 0xC2, 0xF4, 0x6D, 0x79, 0x25, 0x68,
+	0x73, 0xA7, 0x98, 0x6A, 0x4B, 0xCA, 0x7F, 0x51,
+	0xB7, 0xAE, 0xBC, 0xB9, 0x97, 0x56, 0x6A, 0x61,
+	0x92, 0x7E, 0x1E, 0xE2, 0xF9, 0x1E, 0xA6, 0x8E,
+	0x4A, 0xAB, 0x6F, 0xE7, 0x27, 0x13, 0x8F, 0x49,
+	0xA7, 0xDB, 0x0C, 0x47, 0xBA, 0x90, 0x64, 0xF3,
+	0x93, 0x9C, 0xD7, 0xE9, 0xA9, 0xA7, 0x3D, 0xDB,
+	0x3B, 0x5D, 0x00, 0xCF, 0xE8, 0x03, 0xB5, 0xD9,
+	0xAD, 0x14, 0xCB, 0xD4, 0x9B, 0x38, 0x0A, 0xC8,
+	0x09, 0xF0, 0x40, 0x09, 0xA9, 0x77, 0x9E, 0xFE,
+	0x66, 0x74, 0x08, 0xA4, 0xB2, 0x02, 0x09, 0xBD,
+	0x5C, 0x55, 0x5A, 0x31, 0xAF, 0x32, 0x69, 0xF9,
+	0xCB, 0x97, 0xED, 0xFC, 0x8C, 0x24, 0x10, 0x89,
+	0x5F, 0x3D, 0x22, 0x47, 0xAF, 0xF9, 0x52, 0xF5,
+	0x40, 0xEF, 0x65, 0x53, 0x7F, 0x00, 0x9B, 0x2D,
+	0xD5, 0x2E, 0xA1, 0x9A, 0x98, 0x5F, 0x17, 0xD6,
+	0x78, 0x46, 0xA3, 0xCA, 0x8F, 0xB2, 0x05, 0x3E,
+	0x90, 0xFB, 0xB7, 0x00, 0xFB, 0xCB, 0xF3, 0x47,
+	0x8D, 0xE6, 0x3E, 0x88, 0xB0, 0xCE, 0xB2, 0xBB,
+	0xB9, 0xB5, 0x05, 0x63, 0x30, 0x14, 0x1C, 0x02,
+	0x2C, 0x54, 0x55, 0x74, 0x1A, 0x3B, 0x24, 0xC8,
+	0xB6, 0x41, 0xFF, 0xFD, 0x74, 0x63, 0x29, 0x05,
+	0x3E, 0x5C, 0x1B, 0xEA, 0xDF, 0x4A, 0xB5, 0xB1,
+	0xB6, 0x8C, 0xED, 0x57, 0xD5, 0x7F, 0xE0, 0xEC,
+	0x50, 0xE4, 0xC8, 0x46, 0x8F, 0x60, 0x16, 0x6C,
+	0x18, 0xFD, 0xF1, 0x71, 0x93, 0x6B, 0xB3, 0x01,
+	0xD5, 0x7A, 0x0F, 0x9E, 0x2A, 0xE6, 0x14, 0x01,
+	0xBF, 0x46, 0x5E, 0x32, 0xF4, 0x4E, 0x00, 0x50,
+	0x8B, 0x7C, 0x24, 0x38, 0xC7, 0xF6, 0x32, 0x33,
+	0x61, 0xE9, 0x42, 0x95, 0x82, 0xF9, 0xD4, 0x6D,
+	0x1A, 0x3F, 0x94, 0x27, 0xF9, 0x0F, 0x8E, 0x44,
+	0x2A, 0x2A, 0xDE, 0x4D, 0x7B, 0x19, 0x12, 0x56,
+	0x2E, 0x4A, 0xC6, 0x96, 0x0C, 0x2A, 0x52, 0x48,
+	0x1F, 0xC7, 0xD1, 0x55, 0x6B, 0x12, 0xF4, 0x0C,
+	0x5E, 0xBC, 0xD0, 0xF7, 0xEE, 0x52, 0xDF, 0x0D,
+	0xC1, 0x01, 0x13, 0x90, 0x6F, 0xEC, 0x15, 0x14,
+	0x79, 0x33, 0x58, 0xE3, 0xA1, 0x7E, 0x15, 0x5A,
+	0x95, 0x32, 0x29, 0xF2, 0x96, 0x3A, 0x85, 0xC2,
+	0x41, 0x7B, 0xD3, 0x7C, 0x06, 0xFE, 0xB2, 0x1C,
+	0xD5, 0x9D, 0xC8, 0xEE, 0x10, 0x08, 0x2E, 0x55,
+	0xB5, 0xF7, 0xE8, 0xD7, 0x6B, 0x9B, 0x83, 0x13,
+	0x83, 0x9A, 0xD4, 0x5B, 0x7D, 0xD1, 0xBC, 0xBC,
+	0x39, 0xF5, 0x60, 0x8C, 0xD0, 0xD0, 0x51, 0xDC,
+	0xED, 0xBC, 0xDF, 0x3D, 0x00, 0x75, 0x3F, 0xCB,
+	0xCD, 0x65, 0xF2, 0x22, 0xDA, 0xD0, 0xC8, 0x61,
+	0xEC, 0x40, 0x35, 0x1F, 0x8D, 0x1A, 0xBC, 0x07,
+	0x3B, 0x4A, 0x52, 0x5D, 0xB0, 0xA6, 0x51, 0x74,
+	0x04, 0x73, 0x3F, 0xE5, 0xEA, 0xBB, 0x89, 0x6A,
+	0xC6, 0xBF, 0x16, 0x0D, 0x2C, 0xFF, 0x47, 0x5E,
+	0x4E, 0xFE, 0x35, 0xE8, 0x08, 0xEF, 0xE2, 0x92,
+	0xDA, 0xA6, 0x6C, 0xF5, 0x03, 0x4A, 0x27, 0x88,
+	0xAA, 0x83, 0x70, 0x41, 0x15, 0x7B, 0x07, 0x6E,
+	0x37, 0x2C, 0xEB, 0xA7, 0x3E, 0xB6, 0x24, 0x86,
+	0x77, 0x61, 0x58, 0x36, 0x72, 0x7E, 0xAD, 0xC1,
+	0xFC, 0xB0, 0x28, 0x86, 0x5D, 0xC0, 0xA3, 0x41,
+	0xEE, 0x13, 0x06, 0x43, 0x82, 0x64, 0x02, 0x1B,
+	0x31, 0x0C, 0xDB, 0x89, 0xE5, 0x1D, 0x02, 0x18,
+	0xE0, 0x0E, 0x37, 0x28, 0x3D, 0xBF, 0x0B, 0xC8,
+	0x09, 0x45, 0xD2, 0x04, 0xFF, 0x36, 0x46, 0xBD,
+	0xA2, 0xD1, 0x25, 0x8D, 0x1F, 0x40, 0x04, 0xE6,
+	0x5A, 0xBB, 0xFC, 0x41, 0x45, 0x9F, 0xF9, 0x62,
+	0x3B, 0xEA, 0x6E, 0x84, 0x50, 0x33, 0xBB, 0x43,
+	0x94, 0xC7, 0x58, 0x9E, 0xE7, 0x81, 0x47, 0x14,
+	0xB3, 0x53, 0xCF, 0x60, 0x3F, 0x98, 0x7D, 0xF9,
+	0xC9, 0x81, 0x00, 0xFB, 0x6A, 0xAD, 0x43, 0x0E,
+	0xCA, 0x9F, 0x7B, 0x1C, 0xD9, 0x04, 0xF6, 0x59,
+	0x58, 0xC2, 0xB8, 0xB5, 0xC3, 0x61, 0x39, 0x82,
+	0xD0, 0xCD, 0x9F, 0xF4, 0x06, 0xC4, 0xE4, 0x13,
+	0xD0, 0xC7, 0x4C, 0x50, 0x74, 0xB4, 0xA3, 0x3C,
+	0x12, 0x1E, 0xBD, 0x43, 0xAD, 0xAE, 0xB5, 0xA0,
+	0xA8, 0x8C, 0x81, 0xBA, 0x93, 0x02, 0x38, 0x38,
+	0xA2, 0x6E, 0x62, 0x21, 0xEB, 0x7E, 0xB7, 0xB2,
+	0xF2, 0x35, 0x15, 0xC4, 0x90, 0x9F, 0x46, 0x02,
+	0x91, 0xD2, 0x2D, 0xFE, 0x91, 0xEB, 0xF7, 0xA1,
+	0xFE, 0x09, 0xF4, 0xBC, 0x83, 0x7A, 0x74, 0xA4,
+	0xB8, 0x99, 0x4E, 0x31, 0xA7, 0x18, 0xBB, 0x43,
+	0xD3, 0x02, 0x0F, 0xEA, 0x71, 0x3E, 0xD6, 0x2A,
+	0x44, 0xD0, 0x23, 0xF7, 0x5C, 0x15, 0xE2, 0xD6,
+	0x95, 0x1B, 0x81, 0x38, 0x03, 0xB5, 0x45, 0x9A,
+	0xA2, 0x23, 0x78, 0x3E, 0x52, 0xE4, 0x0D, 0x33,
+	0xEF, 0x7F, 0x42, 0xB8, 0x5F, 0xF7, 0xE7, 0x95,
+	0x48, 0x3D, 0xAB, 0x06, 0x8D, 0xC6, 0x7B, 0x6C,
+	0x71, 0x6C, 0x68, 0xF2, 0xCC, 0xA6, 0x63, 0x12,
+	0x6C, 0x29, 0xA4, 0x4C, 0x99, 0x68, 0xBE, 0xF7,
+	0xED, 0xAC, 0xA4, 0x88, 0xF8, 0xB8, 0xB8, 0x2C,
+	0xE4, 0x8F, 0x50, 0x02, 0x5C, 0x22, 0x73, 0xA8,
+	0x89, 0xEF, 0x78, 0x1F, 0x09, 0xA0, 0x67, 0x17,
+	0x96, 0x36, 0x58, 0x22, 0x6E, 0x34, 0x0C, 0x08,
+	0xA6, 0xB1, 0x34, 0x67, 0x8E, 0x34, 0xD6, 0x2F,
+	0xA5, 0x25, 0x96, 0x68, 0x49, 0x96, 0x62, 0x29,
+	0xA1, 0x35, 0xC1, 0xFD, 0x00, 0x50, 0x8C, 0xF2,
+	0xC3, 0x56, 0x73, 0x56, 0x6E, 0x40, 0x42, 0xCB,
+	0x46, 0x4D, 0xC2, 0x4C, 0xC9, 0xD7, 0xD7, 0x4C,
+	0x9A, 0x34, 0xF4, 0xD6, 0x94, 0xF2, 0x7D, 0xBF,
+	0x54, 0xF5, 0xEE, 0x33, 0x06, 0xDC, 0x13, 0xBB,
+	0xAB, 0x38, 0x59, 0xA9, 0x8C, 0x6A, 0x71, 0x2B,
+	0x75, 0x7A, 0x2A, 0xD5, 0xC8, 0x4D, 0x62, 0x8C,
+	0x7B, 0x69, 0xE2, 0xAB, 0x8E, 0xE5, 0xB2, 0x4C,
+	0x75, 0xE4, 0x46, 0xE8, 0xE4, 0x66, 0xF8, 0x1F,
+	0x29, 0xB4, 0x19, 0x1A, 0x22, 0x3E, 0x15, 0x6E,
+	0xF4, 0x1C, 0x90, 0xA7, 0x8C, 0x3B, 0xD6, 0xF0,
+	0xB5, 0xB7, 0x7D, 0xD4, 0xC2, 0x05, 0x3C, 0xA0,
+	0xFD, 0x30, 0x55, 0x57, 0x1D, 0xB2, 0x8D, 0x90,
+	0x65, 0xFC, 0x72, 0xD8, 0x5F, 0xEC, 0x62, 0xA0,
+	0xB1, 0xC0, 0x9B, 0x72, 0x6A, 0x02, 0x91, 0x60,
+	0xFD, 0x71, 0xA6, 0xCF, 0x05, 0x43, 0x13, 0x80,
+	0x29, 0x90, 0x90, 0xA2, 0xF8, 0xE6, 0x8B, 0xA0,
+	0xDE, 0xF3, 0x3C, 0x38, 0xF2, 0x69, 0xB6, 0x31,
+	0x31, 0x67, 0x54, 0x7E, 0xF7, 0x86, 0x29, 0xB9,
+	0xD1, 0xB9, 0xB9, 0x95, 0x0E, 0x82, 0xF1, 0x89,
+	0x9F, 0xE0, 0x34, 0x53, 0x18, 0xB6, 0xC8, 0x2A,
+	0x3A, 0xDD, 0x74, 0xBD, 0x35, 0x55, 0x76, 0x86,
+	0x3C, 0x62, 0x64, 0xD4, 0xF3, 0x16, 0x1B, 0xFD,
+	0x96, 0x4C, 0xC4, 0x0C, 0x8D, 0xC3, 0x11, 0xE5,
+	0x54, 0xCB, 0xF2, 0x25, 0x06, 0x14, 0x91, 0xCE,
+	0xDB, 0x20, 0xF5, 0x43, 0xD4, 0x7C, 0xB3, 0x6F,
+	0x69, 0xCD, 0x22, 0x76, 0x3A, 0x21, 0x07, 0x35,
+	0x77, 0xD8, 0x5D, 0x3B, 0xEF, 0x44, 0x3C, 0xB9,
+	0xEE, 0xA1, 0x19, 0x42, 0xA5, 0x23, 0xE7, 0xB9,
+	0x97, 0x17, 0x66, 0x0A, 0x0C, 0x20, 0x17, 0xAE,
+	0xA2, 0x1E, 0x86, 0xD7, 0x05, 0xF5, 0xEA, 0x2A,
+	0x82, 0x5E, 0xA8, 0x76, 0x53, 0x9B, 0x43, 0x65,
+	0xC6, 0x29, 0xD1, 0x02, 0xA1, 0x84, 0x46, 0x6D,
+	0xD9, 0x5F, 0x26, 0x5C, 0x95, 0x4E, 0xFA, 0xB0,
+	0xCE, 0x5A, 0x71, 0x5E, 0x60, 0x53, 0x43, 0x26,
+	0xF5, 0x76, 0x7A, 0x0A, 0x86, 0xA6, 0x9D, 0xF3,
+	0x65, 0xAB, 0x9F, 0xF3, 0xDE, 0xB5, 0x61, 0x7D,
+	0xDE, 0xFA, 0xD1, 0xF4, 0x11, 0x95, 0xF2, 0x33,
+	0x0F, 0x2F, 0xB6, 0x44, 0x0A, 0xE6, 0xF3, 0x14,
+	0x8B, 0x8B, 0x4E, 0xB4, 0xAD, 0xC6, 0xEE, 0xE3,
+	0xC3, 0x5D, 0xB0, 0xA9, 0x46, 0x16, 0x31, 0x5D,
+	0xF7, 0xFB, 0x74, 0x2F, 0x18, 0xF2, 0xAB, 0x11,
+	0x5C, 0xD9, 0x3D, 0x3C, 0xB2, 0xEB, 0x35, 0xE9,
+	0x85, 0x61, 0x4D, 0x20, 0x43, 0xFE, 0x9A, 0xCB,
+	0x21, 0xE4, 0x38, 0xDF, 0x4D, 0xD9, 0x44, 0x06,
+	0xC5, 0x6F, 0x6C, 0x27, 0xBE, 0x8E, 0xB8, 0x9B,
+	0x29, 0xA4, 0x46, 0xC7, 0x78, 0xCD, 0xD7, 0x40,
+	0x5A, 0x07, 0xA7, 0xE8, 0xF1, 0xA3, 0xE9, 0x06,
+	0xC4, 0x17, 0x5B, 0xB7, 0xA6, 0x2F, 0xE9, 0x03,
+	0xD4, 0x3E, 0x13, 0x01, 0xE7, 0x51, 0x09, 0x91,
+	0x4D, 0x23, 0x8D, 0x56, 0x04, 0x96, 0x39, 0xD2,
+	0x72, 0x74, 0xA2, 0x77, 0x9D, 0x25, 0xE0, 0x21,
+	0x47, 0x2A, 0x3A, 0x43, 0xF8, 0xFC, 0x24, 0xDB,
+	0x9F, 0x06, 0xAA, 0xE4, 0xFC, 0x8F, 0xB7, 0xA5,
+	0x61, 0xBD, 0xC2, 0x27, 0xC3, 0x54, 0x76, 0x52,
+	0x08, 0x9A, 0xBA, 0x59, 0xCC, 0x39, 0xAA, 0x0C,
+	0x24, 0xF3, 0xAE, 0x9D, 0xC0, 0x28, 0xFD, 0x05,
+	0x43, 0x31, 0xB9, 0x4B, 0x91, 0xE7, 0x93, 0x77,
+	0x81, 0x72, 0xE6, 0xA8, 0x2A, 0x55, 0xB2, 0x58,
+	0xDF, 0x49, 0x4C, 0x07, 0x3E, 0x4D, 0xDA, 0x64,
+	0x83, 0x20, 0xD2, 0xE1, 0x59, 0x1D, 0x23, 0x4A,
+	0xEC, 0xCB, 0x34, 0x7D, 0x2B, 0xAF, 0x54, 0xEC,
+	0xC6, 0x20, 0x27, 0x92, 0x5D, 0x67, 0xF6, 0x18,
+	0x59, 0xA0, 0x0A, 0x31, 0x0A, 0x30, 0x94, 0x99,
+	0x4F, 0xBF, 0xB7, 0xE3, 0xC1, 0x6B, 0x36, 0x23,
+	0xCD, 0x92, 0x3E, 0x74, 0x13, 0xBB, 0x6D, 0x5A,
+	0xBE, 0x34, 0xB4, 0x31, 0xD6, 0xFC, 0x8C, 0x6E,
+	0xF9, 0x8C, 0xE3, 0x95, 0xDD, 0xD6, 0xA4, 0xD0,
+	0x9B, 0xA0, 0xC1, 0xD8, 0xEF, 0x89, 0xF8, 0x17,
+	0x69, 0xF7, 0x98, 0x41, 0x75, 0x28, 0x17, 0x98,
+	0xF9, 0x3E, 0x74, 0x2F, 0x51, 0x51, 0x6B, 0x0B,
+	0x3B, 0x18, 0x26, 0xB7, 0xB8, 0x4C, 0x0D, 0xD4,
+	0x0E, 0x3B, 0xC3, 0x32, 0xD9, 0x07, 0x4C, 0xEE,
+	0x1D, 0xF6, 0x34, 0x9D, 0xCA, 0x18, 0x6E, 0xA6,
+	0xC8, 0x82, 0xE8, 0xA9, 0x2A, 0x87, 0xF8, 0x67,
+	0xCF, 0x57, 0xB4, 0xDA, 0x25, 0xC8, 0xE7, 0xB4,
+	0x38, 0x68, 0x32, 0x67, 0x5C, 0xFD, 0x49, 0x24,
+	0xB6, 0xFB, 0x66, 0x60, 0x33, 0xE6, 0xD3, 0xAB,
+	0xD5, 0x30, 0xFB, 0xD3, 0xB9, 0x61, 0x00, 0xEC,
+	0x95, 0x5A, 0xBF, 0x04, 0x50, 0x89, 0x57, 0x3C,
+	0x20, 0xDB, 0xA6, 0xC2, 0x09, 0xD3, 0x51, 0xBF,
+	0x44, 0xD5, 0x21, 0x47, 0xFB, 0xB1, 0x84, 0x9C,
+	0x58, 0xBE, 0x35, 0xDD, 0xCE, 0x80, 0x1E, 0x7A,
+	0x9D, 0x37, 0x4B, 0xBA, 0x08, 0x29, 0x26, 0x67,
+	0x8B, 0xB1, 0x96, 0x63, 0x21, 0xBE, 0x33, 0x8D,
+	0x60, 0x40, 0xED, 0xB5, 0x96, 0xD0, 0x5E, 0xAB,
+	0xA5, 0xB7, 0xF3, 0xBB, 0x3B, 0xB9, 0xEB, 0x00,
+	0x57, 0xAB, 0x62, 0x08, 0x2E, 0xE6, 0x2C, 0x95,
+	0xC0, 0x82, 0x15, 0x80, 0x34, 0x6C, 0x1C, 0xDF,
+	0xF2, 0x87, 0x24, 0x01, 0xA1, 0x5F, 0x55, 0x44,
+	0x4A, 0x27, 0x25, 0x1A, 0xD3, 0x70, 0xB8, 0xC6,
+	0xF9, 0x79, 0x9C, 0xF0, 0xC0, 0xAD, 0x30, 0x9F,
+	0x9E, 0x7D, 0x8A, 0xFB, 0x64, 0x7D, 0x5B, 0x17,
+	0xF9, 0x65, 0x82, 0xC1, 0x95, 0x21, 0x0A, 0x65,
+	0x8D, 0xF7, 0xE1, 0x73, 0x28, 0x09, 0xF3, 0x87,
+	0xB2, 0xC9, 0xB0, 0xB2, 0xFC, 0xB3, 0x82, 0x59,
+	0x98, 0xFE, 0x31, 0xD3, 0x4E, 0x2B, 0x85, 0x01,
+	0x82, 0x5F, 0xE2, 0xCE, 0x46, 0xF0, 0x74, 0x40,
+	0x1C, 0x58, 0x92, 0x01, 0x75, 0x8A, 0x58, 0x5F,
+	0xA0, 0x0C, 0x94, 0x2A, 0x3D, 0xAD, 0xD0, 0xF1,
+	0x84, 0x34, 0x84, 0xEB, 0xF0, 0x6D, 0x33, 0x1E,
+	0xD1, 0x4A, 0xA8, 0x9D, 0x70, 0x03, 0x47, 0x3E,
+	0xCB, 0x28, 0xA1, 0xA4, 0x96, 0xC6, 0x6A, 0x7B,
+	0xED, 0x50, 0x9C, 0x69, 0x27, 0x66, 0x8F, 0xD6,
+	0xDA, 0xE3, 0xC0, 0x6D, 0x93, 0x27, 0x4D, 0x2E,
+	0x3E, 0x2D, 0xC7, 0x9B, 0x82, 0x23, 0xDB, 0xC1,
+	0xD6, 0xAB, 0x1E, 0x96, 0x27, 0x9B, 0x43, 0x39,
+	0x17, 0xC8, 0x9D, 0x46, 0xF5, 0x2E, 0x9C, 0x9E,
+	0xFA, 0xAA, 0x62, 0x1E, 0x5F, 0x91, 0x7B, 0x0D,
+	0x49, 0x6E, 0xE5, 0xF3, 0x1E, 0x46, 0x11, 0x97,
+	0x52, 0xB1, 0xC0, 0x4B, 0x1B, 0x2A, 0x88, 0xFA,
+	0x3C, 0x9C, 0x10, 0x20, 0xCB, 0xA8, 0x5A, 0x9D,
+	0xA1, 0x3C, 0x08, 0x6C, 0x3C, 0x3E, 0xC9, 0xD7,
+	0xE8, 0x5D, 0x56, 0x87, 0x3A, 0x0E, 0x24, 0xA5,
+	0x04, 0x02, 0x4A, 0xBD, 0x14, 0x3B, 0xC2, 0xF8,
+	0x73, 0x2D, 0x69, 0xD8, 0xD2, 0x6F, 0x4A, 0x26,
+	0x7D, 0x50, 0x63, 0xD2, 0xCD, 0x64, 0x58, 0x1B,
+	0xB8, 0xD2, 0x25, 0x81, 0xC5, 0x2C, 0x83, 0x4A,
+	0x61, 0x83, 0xB2, 0x65, 0x31, 0x6A, 0x78, 0x01,
+	0x05, 0x5A, 0x9E, 0xD6, 0x81, 0x3D, 0xA0, 0x1E,
+	0x8C, 0xCE, 0x7A, 0x96, 0x85, 0x5C, 0xDF, 0x06,
+	0x1F, 0xC5, 0x56, 0xA7, 0x80, 0xB6, 0x9C, 0xA5,
+	0x6A, 0xDC, 0x00, 0x3F, 0xE8, 0x60, 0x1B, 0xD6,
+	0x7B, 0x98, 0x38, 0x15, 0x39, 0xAD, 0xF1, 0x9F,
+	0x4C, 0xD2, 0xB9, 0xF4, 0xFF, 0x8F, 0x19, 0x80,
+	0x28, 0xFE, 0x6F, 0x79, 0x09, 0xEA, 0x65, 0xFA,
+	0x2F, 0x1E, 0x4D, 0xEE, 0x02, 0x96, 0xE3, 0x22,
+	0x7B, 0xDE, 0x25, 0x20, 0x80, 0x8F, 0x5C, 0xC4,
+	0xC8, 0x52, 0xE1, 0x04, 0x27, 0xDC, 0x83, 0xFB,
+	0x36, 0x8F, 0x9B, 0xD2, 0x67, 0x9F, 0xDE, 0xAD,
+	0x86, 0xD8, 0x48, 0x1A, 0x2E, 0x84, 0x69, 0xFF,
+	0x56, 0xAE, 0x8C, 0xAF, 0xB9, 0xA7, 0x9B, 0x0A,
+	0x87, 0xB1, 0x4D, 0x1F, 0xB1, 0xD7, 0xA4, 0xD3,
+	0xA1, 0x07, 0xC5, 0x2D, 0xD5, 0xE2, 0xD0, 0x0D,
+	0x1E, 0xDC, 0x18, 0xC6, 0xA5, 0x04, 0x39, 0xC2,
+	0xB6, 0xC7, 0xE3, 0x7C, 0xA5, 0xE0, 0xD4, 0x95,
+	0xE4, 0x84, 0x5E, 0xB1, 0xFD, 0xA0, 0xB8, 0x1A,
+	0x4B, 0xE6, 0x42, 0xE0, 0xE0, 0x3A, 0xE9, 0x82,
+	0x9F, 0xE3, 0x39, 0xF8, 0x73, 0x31, 0xE8, 0x8A,
+	0x19, 0xF6, 0x56, 0x2E, 0xDC, 0x82, 0x4C, 0x65,
+	0x7E, 0x7A, 0xE8, 0xBE, 0x5B, 0x82, 0x78, 0x36,
+	0xC8, 0xDC, 0x41, 0x21, 0x07, 0xE7, 0xAE, 0x51,
+	0x71, 0x27, 0xB4, 0x6E, 0xE4, 0x3C, 0xE4, 0x14,
+	0x04, 0xFB, 0xCD, 0x12, 0xFD, 0x0B, 0x09, 0x6B,
+	0x53, 0x78, 0x10, 0x32, 0x24, 0xA6, 0x57, 0x00,
+	0x3D, 0xEF, 0xEE, 0xF7, 0xF0, 0x95, 0xE1, 0x37,
+	0x60, 0xA7, 0xFF, 0x4D, 0x91, 0x05, 0x7F, 0xA4,
+	0x20, 0x7F, 0xAA, 0xB5, 0xCF, 0xA3, 0xD9, 0x9D,
+	0x9B, 0x75, 0x2A, 0xA5, 0xCF, 0x8E, 0x50, 0xCE,
+	0x38, 0xAB, 0xAE, 0x1B, 0xC7, 0x05, 0x57, 0x47,
+	0x97, 0x39, 0x9E, 0x80, 0x50, 0x4D, 0x5B, 0x43,
+	0x44, 0x4B, 0xE4, 0xBF, 0xC1, 0x70, 0x0E, 0xB8,
+	0x61, 0xEC, 0xAE, 0xAD, 0x49, 0xB8, 0x35, 0xB1,
+	0xB2, 0x77, 0x0B, 0xEB, 0x5A, 0x18, 0x82, 0x20,
+	0x9E, 0x48, 0x36, 0x72, 0x8B, 0xBB, 0xA6, 0x04,
+	0x94, 0x31, 0x81, 0x62, 0x27, 0x50, 0xE7, 0xA9,
+	0xAB, 0x88, 0x29, 0x9A, 0x74, 0x7B, 0xAE, 0xDB,
+	0x83, 0x45, 0xDA, 0xB3, 0xFE, 0x9C, 0xD4, 0x11,
+	0x87, 0x8A, 0x94, 0xAF, 0xD5, 0xA5, 0x10, 0x0E,
+	0x72, 0xC6, 0xF3, 0xB0, 0xA1, 0x25, 0xF6, 0xCE,
+	0x82, 0x96, 0x4B, 0x8A, 0x6B, 0x3E, 0x07, 0xEA,
+	0x46, 0x31, 0x94, 0xEC, 0xC9, 0x09, 0xB4, 0xB2,
+	0x03, 0xCC, 0xAB, 0x6E, 0xC4, 0x7C, 0xEB, 0xE7,
+	0x89, 0x79, 0x25, 0x89, 0x54, 0x54, 0x69, 0x12,
+	0x88, 0x58, 0x3D, 0xA0, 0x47, 0x64, 0x58, 0x2A,
+	0xF7, 0xC9, 0x2E, 0x9C, 0xAE, 0x25, 0xE5, 0xE5,
+	0x7C, 0x0C, 0x37, 0xC7, 0x55, 0xE0, 0x4A, 0xCF,
+	0x1B, 0x3F, 0x6C, 0xB0, 0xBE, 0xED, 0x50, 0xE0,
+	0x58, 0x3B, 0x32, 0x59, 0xCE, 0xF8, 0x67, 0x4E,
+	0xBC, 0x08, 0x4C, 0xD2, 0x2B, 0xF2, 0xFD, 0x30,
+	0x8D, 0x9F, 0x27, 0xEE, 0x18, 0xF2, 0x60, 0x9A,
+	0x2E, 0x8B, 0x47, 0x43, 0x39, 0x79, 0xCA, 0xE8,
+	0x87, 0xF8, 0xD3, 0xC8, 0x86, 0x8B, 0xED, 0xA2,
+	0x26, 0xCE, 0x26, 0xEB, 0x74, 0xAD, 0x3D, 0x6D,
+	0x12, 0xC0, 0x22, 0x51, 0x72, 0xA8, 0x9B, 0xD0,
+	0xBF, 0xD7, 0x9F, 0xBF, 0xB7, 0x0B, 0x7F, 0xBD,
+	0x92, 0x0A, 0x80, 0xE8, 0x48, 0x17, 0x06, 0xCF,
+	0x7B, 0xA6, 0x8E, 0x8F, 0xF9, 0xAA, 0xE5, 0xFB,
+	0x7D, 0xEB, 0x73, 0x36, 0xB9, 0x6C, 0x41, 0x6E,
+	0xD2, 0xA2, 0xFD, 0x11, 0xB3, 0xF5, 0x23, 0x0E,
+	0x25, 0xB8, 0xB3, 0x4E, 0x3F, 0xF7, 0x99, 0xBA,
+	0x4B, 0xE6, 0x1C, 0x25, 0x2B, 0x54, 0x01, 0x1A,
+	0x54, 0x32, 0x36, 0xFD, 0x34, 0xD5, 0x48, 0xE4,
+	0x7E, 0x51, 0x86, 0x81, 0x9B, 0x8D, 0xEB, 0x8C,
+	0x83, 0xEF, 0x3A, 0xAC, 0xB9, 0xDF, 0x9C, 0x3E,
+	0x82, 0x9F, 0x66, 0x65, 0xC7, 0xC1, 0xC8, 0x15,
+	0xB3, 0xE5, 0x23, 0x41, 0x63, 0x42, 0x77, 0x0C,
+	0x6E, 0xF5, 0xC3, 0x33, 0x19, 0x10, 0xED, 0xA6,
+	0x6A, 0x5F, 0x70, 0xE0, 0x34, 0x04, 0x07, 0x02,
+}};
+
+const word* pfokStdPre(size_t l)
+{
+	switch (l)
+	{
+	case 1022:
+		return _bdh_params3_pre.w;
+	case 1534:
+		return _bdh_params6_pre.w;
+	}
+	return 0;
+}
+
+#else
+
+const word* pfokStdPre(size_t l)
+{
+	return 0;
+}
+
+#endif
@@ -4,7 +4,7 @@
 \brief Elliptic curves
 \project bee2 [cryptographic library]
 \created 2014.03.04
-\version 2015.11.09
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -18,6 +18,7 @@
 #include "bee2/math/ec.h"
 #include "bee2/math/ww.h"
 #include "bee2/math/zz.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -89,6 +90,29 @@ size_t ecCreateGroup_deep(size_t f_deep)
 	return f_deep;
 }
 
+bool_t ecCreateGroupBarr(ec_o* ec, const octet xbase[], const octet ybase[], 
+	const octet order[], size_t order_len, u32 cofactor, void* stack)
+{
+	size_t m;
+	// создать группу
+	if (!ecCreateGroup(ec, xbase, ybase, order, order_len, cofactor, stack))
+		return FALSE;
+	// рассчитать параметр Барретта
+	m = wwWordSize(ec->order, ec->f->n + 1);
+	ec->params = ec->order + ec->f->n + 1;
+	ASSERT(wwIsValid((word*)ec->params, ec->f->n + 3));
+	zzRedBarrStart((word*)ec->params, ec->order, m, stack);
+	wwSetZero((word*)ec->params + m + 2, ec->f->n + 1 - m);
+	return TRUE;
+}
+
+size_t ecCreateGroupBarr_deep(size_t n, size_t f_deep)
+{
+	return utilMax(2,
+		ecCreateGroup_deep(f_deep),
+		zzRedBarrStart_deep(n + 1));
+}
+
 bool_t ecIsOperableGroup(const ec_o* ec)
 {
 	ASSERT(ecIsOperable(ec));
@@ -98,6 +122,105 @@ bool_t ecIsOperableGroup(const ec_o* ec)
 		ec->cofactor != 0;
 }
 
+/*
+*******************************************************************************
+Приведение по модулю порядка
+
+Число a обрабатывается по схеме Горнера блоками по m слов, начиная со
+старших: t <- (t * B^k + [k]a_i) \mod order, k <= m. В каждом блоке
+приводится число t < order * B^m <= B^{2m}, поэтому достаточно одной
+редукции Барретта. Для na <= 2m блок единственный.
+*******************************************************************************
+*/
+
+void ecModOrder(word b[], const word a[], size_t na, const ec_o* ec,
+	void* stack)
+{
+	const size_t m = wwWordSize(ec->order, ec->f->n + 1);
+	size_t k;
+	// переменные в stack
+	word* t = (word*)stack;
+	word* r = t + 2 * m;
+	stack = r + m;
+	// pre
+	ASSERT(ecIsOperableGroup(ec));
+	ASSERT(ec->params == ec->order + ec->f->n + 1);
+	ASSERT(wwIsValid(a, na));
+	ASSERT(wwIsSameOrDisjoint(b, a, m));
+	// t <- старшие слова a
+	k = MIN2(na, 2 * m);
+	na -= k;
+	wwCopy(t, a + na, k);
+	wwSetZero(t + k, 2 * m - k);
+	zzRedBarr(t, ec->order, m, (const word*)ec->params, stack);
+	// обработать остальные блоки
+	while (na)
+	{
+		k = MIN2(na, m);
+		na -= k;
+		wwCopy(r, t, m);
+		wwCopy(t, a + na, k);
+		wwCopy(t + k, r, m);
+		wwSetZero(t + k + m, m - k);
+		zzRedBarr(t, ec->order, m, (const word*)ec->params, stack);
+	}
+	// b <- t
+	wwCopy(b, t, m);
+}
+
+size_t ecModOrder_deep(size_t n)
+{
+	return O_OF_W(3 * (n + 1)) + zzRedBarr_deep(n + 1);
+}
+
+/*
+*******************************************************************************
+Регулярный выбор
+
+Элементы таблиц предвычислений выбираются с помощью wwSelect(): 
+просматриваются все элементы таблицы, неподходящие маскируются. Функция
+ecMaskMove() переписывает [size]b в [size]a, если mask == WORD_MAX, и
+оставляет a без изменений, если mask == 0.
+*******************************************************************************
+*/
+
+static void ecMaskMove(word a[], const word b[], register word mask, 
+	size_t size)
+{
+	while (size--)
+		a[size] ^= (a[size] ^ b[size]) & mask;
+}
+
+/*
+*******************************************************************************
+Пакетный переход к аффинным координатам
+*******************************************************************************
+*/
+
+bool_t ecToABatch(word b[], const word a[], size_t count, const ec_o* ec,
+	void* stack)
+{
+	const size_t n = ec->f->n;
+	bool_t ret = TRUE;
+	size_t i;
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(wwIsDisjoint2(a, count * ec->d * n, b, count * 2 * n));
+	// пакетная функция?
+	if (ec->toab)
+		return ec->toab(b, a, count, ec, stack);
+	// по отдельности
+	for (i = 0; i < count; ++i)
+		if (!ecToA(b + 2 * n * i, a + ec->d * n * i, ec, stack))
+			ret = FALSE;
+	return ret;
+}
+
+size_t ecToABatch_deep(size_t n, size_t ec_deep, size_t count)
+{
+	return O_OF_W((2 * count + 1) * n) + ec_deep;
+}
+
 /*
 *******************************************************************************
 Кратная точка
@@ -141,32 +264,35 @@ Springer, 2004].
 задачи:
 	(2^{w - 2} - 2) + l / (w + 1) -> min.
 
-\todo Усилить вторую стратегию. Рассчитать малые кратные в проективных 
-координатах, а затем быстро перейти к аффинным координатам с помощью 
-трюка Монтгомери [Algorithm 11.15 Simultaneous inversion, CohenFrey, p. 209]:
-	U_1 <- Z_1
-	for t = 2,..., T: U_t <- U_{t-1} Z_t
-	V <- U_T^{-1}
-	for t = T,..., 2: 
-		Z_t^{-1} <- V U_{t-1}
-		V <- V Z_t
-	Z_1^{-1} <- V
+Малые кратные, рассчитанные в проективных координатах, переводятся в
+аффинные одним пакетом (см. ecToABatch()): выполняется одно обращение
+в базовом поле вместо 2^{w-2}. После этого в основном цикле используются
+сложения (P <- P + A) вместо (P <- P + P). Если среди малых кратных 
+встречается O (порядок a мал), то остаются проективные кратные.
+
+В профиле с низким потреблением памяти (директива LEAN_ENABLED) длина
+окна не превосходит 4. Таблицы малых кратных (в том числе в регулярной
+редакции ecMulA(), где они содержат 2^{w-1} точек) сокращаются в 4 раза
+для l >= 336 и в 2 раза для 120 <= l < 336. Число сложений возрастает
+примерно на l / 30.
 *******************************************************************************
 */
 
 static size_t ecNAFWidth(size_t l)
 {
+#ifndef LEAN_ENABLED
 	if (l >= 336)
 		return 6;
 	else if (l >= 120)
 		return 5;
-	else if (l >= 40)
+#endif
+	if (l >= 40)
 		return 4;
 	return 3;
 }
 
-bool_t ecMulA(word b[], const word a[], const ec_o* ec, const word d[],
-	size_t m, void* stack)
+bool_t FAST(ecMulA)(word b[], const word a[], const ec_o* ec, 
+	const word d[], size_t m, void* stack)
 {
 	const size_t n = ec->f->n;
 	const size_t naf_width = ecNAFWidth(B_OF_W(m));
@@ -175,23 +301,30 @@ bool_t ecMulA(word b[], const word a[], const ec_o* ec, const word d[],
 	register size_t naf_size;
 	register size_t i;
 	register word w;
+	bool_t aff;
 	// переменные в stack
-	word* naf;			/* NAF */
+	octet* naf;			/* символы NAF */
 	word* t;			/* вспомогательная точка */
 	word* pre;			/* pre[i] = (2i + 1)a (naf_count элементов) */
+	word* preA;			/* pre[i] в аффинных координатах */
+	STAT_BEGIN;
 	// pre
 	ASSERT(ecIsOperable(ec));
 	// раскладка stack
-	naf = (word*)stack;
-	t = naf + 2 * m + 1;
+	naf = (octet*)stack;
+	t = (word*)(naf + O_OF_W(W_OF_O(B_OF_W(m) + 1)));
 	pre = t + ec->d * n;
-	stack = pre + naf_count * ec->d * n;
+	preA = pre + naf_count * ec->d * n;
+	stack = preA + naf_count * 2 * n;
 	// расчет NAF
 	ASSERT(naf_width >= 3);
-	naf_size = wwNAF(naf, d, m, naf_width);
+	naf_size = wwNAFDigits(naf, d, m, naf_width);
 	// d == O => b <- O
 	if (naf_size == 0)
+	{
+		STAT_END(STAT_EC_MULA, 0);
 		return FALSE;
+	}
 	// pre[0] <- a
 	ecFromA(pre, a, ec, stack);
 	// расчет pre[i]: t <- 2a, pre[i] <- t + pre[i - 1]
@@ -200,21 +333,28 @@ bool_t ecMulA(word b[], const word a[], const ec_o* ec, const word d[],
 	ecAddA(pre + ec->d * n, t, pre, ec, stack);
 	for (i = 2; i < naf_count; ++i)
 		ecAdd(pre + i * ec->d * n, t, pre + (i - 1) * ec->d * n, ec, stack);
+	// preA[i] <- pre[i] (preA[0] = a)
+	wwCopy(preA, a, 2 * n);
+	aff = ecToABatch(preA + 2 * n, pre + ec->d * n, naf_count - 1, ec, 
+		stack);
 	// t <- a[naf[l - 1]]
-	w = wwGetBits(naf, 0, naf_width);
+	w = naf[--naf_size];
 	ASSERT((w & 1) == 1 && (w & naf_hi) == 0);
 	wwCopy(t, pre + (w >> 1) * ec->d * n, ec->d * n);
 	// цикл по символам NAF
-	i = naf_width;
-	while (--naf_size)
+	while (naf_size--)
 	{
-		w = wwGetBits(naf, i, naf_width);
+		w = naf[naf_size];
 		if (w & 1)
 		{
 			// t <- 2 t
 			ecDbl(t, t, ec, stack);
 			// t <- t \pm pre[naf[w]]
-			if (w == 1)
+			if (aff && (w & naf_hi))
+				ecSubA(t, t, preA + ((w ^ naf_hi) >> 1) * 2 * n, ec, stack);
+			else if (aff)
+				ecAddA(t, t, preA + (w >> 1) * 2 * n, ec, stack);
+			else if (w == 1)
 				ecAddA(t, t, pre, ec, stack);
 			else if (w == (naf_hi ^ 1))
 				ecSubA(t, t, pre, ec, stack);
@@ -222,27 +362,339 @@ bool_t ecMulA(word b[], const word a[], const ec_o* ec, const word d[],
 				ecSub(t, t, pre + ((w ^ naf_hi) >> 1) * ec->d * n, ec, stack);
 			else
 				ecAdd(t, t, pre + (w >> 1) * ec->d * n, ec, stack);
-			// к следующему разряду naf
-			i += naf_width;
 		}
 		else
-			ecDbl(t, t, ec, stack), ++i;
+			ecDbl(t, t, ec, stack);
 	}
 	// очистка
 	w = 0;
-	i = 0;
 	// к аффинным координатам
-	return ecToA(b, t, ec, stack);
+	aff = ecToA(b, t, ec, stack);
+	STAT_END(STAT_EC_MULA, 0);
+	return aff;
 }
 
-size_t ecMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m)
+static size_t ecMulAFast_deep(size_t n, size_t ec_d, size_t ec_deep, 
+	size_t m)
 {
 	const size_t naf_width = ecNAFWidth(B_OF_W(m));
 	const size_t naf_count = SIZE_1 << (naf_width - 2);
-	return O_OF_W(2 * m + 1) + 
+	return O_OF_W(W_OF_O(B_OF_W(m) + 1)) + 
 		O_OF_W(ec_d * n) + 
-		O_OF_W(ec_d * n * naf_count) + 
-		ec_deep;
+		O_OF_W((ec_d + 2) * n * naf_count) + 
+		utilMax(2,
+			ec_deep,
+			ecToABatch_deep(n, ec_deep, naf_count - 1));
+}
+
+/*
+*******************************************************************************
+Кратная точка: регулярная редакция
+
+Используется регулярная перекодировка [Joye M., Tunstall M. Exponent 
+Recoding and Regular Exponentiation Algorithms, 2009]. Нечетное число 
+e длины l = B_OF_W(m) битов представляется цифрами
+	e = k_0 + k_1 2^w + ... + k_{s-1} 2^{(s-1)w},  s = \lceil l / w \rceil,
+	k_i \in {\pm 1, \pm 3,..., \pm (2^w - 1)}, k_{s - 1} > 0.
+Перекодировка:
+	for i = 0,..., s - 2:
+		k_i <- (e mod 2^{w+1}) - 2^w
+		e <- (e >> w) | 1
+	k_{s - 1} <- e.
+
+Кратность d заменяется на нечетное e = d | 1. Если d четно, то от 
+результата вычитается a (с выбором по маске).
+
+Предварительно рассчитываются точки pre[i] = (2i + 1)a, i < 2^{w-1}. 
+Затем
+	t <- pre[k_{s - 1}]
+	for i = s - 2,..., 0:
+		t <- 2^w t
+		t <- t \pm pre[|k_i|].
+Число удвоений и сложений, а также порядок обращения к памяти зависят 
+только от m. Точки pre[|k_i|] выбираются просмотром всей таблицы, знаки 
+учитываются с помощью масок. Регулярность нарушается только в 
+исключительных ситуациях сложения равных или противоположных точек, 
+а также при d = 0.
+
+Таблица pre переводится в аффинные координаты одним пакетом 
+(см. ecToABatch()), и в цикле по цифрам используются сложения 
+с аффинными точками. Выбор между аффинной и проективной таблицами 
+зависит только от a.
+
+По сравнению с FAST(ecMulA) выполняется примерно на l / (w(w + 1)) 
+сложений больше, плюс 2^{w-2} сложений при построении таблицы.
+
+Перекодировка (цифры k_i и признак четности d) выполняется функцией
+ecRecode() и может быть сохранена, если одна и та же кратность 
+используется для нескольких точек. Умножение на перекодированную кратность 
+выполняет функция ecMulARec(). Функция SAFE(ecMulA) последовательно 
+вызывает ecRecode() и ecMulARec().
+*******************************************************************************
+*/
+
+size_t ecRecode_keep(size_t m)
+{
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	return (B_OF_W(m) + w - 1) / w + 1;
+}
+
+void ecRecode(octet rec[], const word d[], size_t m, void* stack)
+{
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t s = (B_OF_W(m) + w - 1) / w;
+	register word r, mask;
+	size_t i;
+	// переменные в stack
+	word* e = (word*)stack;
+	// pre
+	ASSERT(wwIsValid(d, m));
+	ASSERT(B_OF_W(m) > w);
+	ASSERT(memIsValid(rec, s + 1));
+	// e <- d | 1
+	wwCopy(e, d, m);
+	rec[s] = (octet)(e[0] & WORD_1);
+	e[0] |= WORD_1;
+	// перекодировка
+	for (i = 0; i + 1 < s; ++i)
+	{
+		r = wwGetBits(e, 0, w + 1);
+		mask = WORD_0 - ((r >> w) ^ WORD_1);
+		r = ((r - (WORD_1 << w)) ^ mask) - mask;
+		rec[i] = (octet)((r >> 1) | (mask & 0x80));
+		wwShLo(e, m, w);
+		e[0] |= WORD_1;
+	}
+	ASSERT(wwCmpW(e, m, WORD_1 << w) < 0);
+	rec[s - 1] = (octet)(e[0] >> 1);
+	// очистка
+	r = mask = 0;
+	wwSetZero(e, m);
+}
+
+size_t ecRecode_deep(size_t m)
+{
+	return O_OF_W(m);
+}
+
+static void ecMulARecPre(word pre[], const word a[], const ec_o* ec, 
+	size_t count, void* stack)
+{
+	const size_t n = ec->f->n;
+	size_t i;
+	// переменные в stack
+	word* t = (word*)stack;
+	stack = t + ec->d * n;
+	// pre[0] <- a, pre[i] <- pre[i - 1] + 2a
+	ecFromA(pre, a, ec, stack);
+	ecDblA(t, pre, ec, stack);
+	ecAddA(pre + ec->d * n, t, pre, ec, stack);
+	for (i = 2; i < count; ++i)
+		ecAdd(pre + i * ec->d * n, t, pre + (i - 1) * ec->d * n, ec, stack);
+}
+
+static void ecMulARecMain(word t[], const word a[], const word pre[],
+	const word preA[], bool_t aff, const ec_o* ec, const octet rec[],
+	size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t count = SIZE_1 << (w - 1);
+	const size_t s = (B_OF_W(m) + w - 1) / w;
+	register word odd;
+	size_t i, j;
+	// переменные в stack
+	word* u;			/* [ec->d * n] выбранная точка */
+	word* v;			/* [ec->d * n] -u */
+	// раскладка stack
+	u = (word*)stack;
+	v = u + ec->d * n;
+	stack = v + ec->d * n;
+	// t <- pre[k_{s - 1}]
+	wwSelect(t, pre, count, rec[s - 1], ec->d * n);
+	// цикл по цифрам
+	for (i = s - 1; i--;)
+	{
+		// t <- 2^w t
+		for (j = 0; j < w; ++j)
+			ecDbl(t, t, ec, stack);
+		// u <- \pm pre[|k_i|], t <- t + u
+		if (aff)
+		{
+			wwSelect(u, preA, count, rec[i] & 0x7F, 2 * n);
+			ecFromA(u, u, ec, stack);
+			ecNeg(v, u, ec, stack);
+			ecMaskMove(u, v, WORD_0 - (word)(rec[i] >> 7), ec->d * n);
+			ecAddA(t, t, u, ec, stack);
+		}
+		else
+		{
+			wwSelect(u, pre, count, rec[i] & 0x7F, ec->d * n);
+			ecNeg(v, u, ec, stack);
+			ecMaskMove(u, v, WORD_0 - (word)(rec[i] >> 7), ec->d * n);
+			ecAdd(t, t, u, ec, stack);
+		}
+	}
+	// t <- t - a, если d четно
+	odd = WORD_0 - (word)(rec[s] & 1);
+	ecSubA(v, t, a, ec, stack);
+	ecMaskMove(t, v, ~odd, ec->d * n);
+	odd = 0;
+}
+
+bool_t ecMulARec(word b[], const word a[], const ec_o* ec, 
+	const octet rec[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t count = SIZE_1 << (w - 1);
+	bool_t aff;
+	// переменные в stack
+	word* t;			/* [ec->d * n] результат */
+	word* pre;			/* [count * ec->d * n] pre[i] = (2i + 1)a */
+	word* preA;			/* [count * 2 * n] pre[i] в аффинных координатах */
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(memIsValid(rec, (B_OF_W(m) + w - 1) / w + 1));
+	ASSERT(B_OF_W(m) > w);
+	// раскладка stack
+	t = (word*)stack;
+	pre = t + ec->d * n;
+	preA = pre + count * ec->d * n;
+	stack = preA + count * 2 * n;
+	// pre[i] <- (2i + 1)a
+	ecMulARecPre(pre, a, ec, count, stack);
+	// preA[i] <- pre[i] (preA[0] = a)
+	wwCopy(preA, a, 2 * n);
+	aff = ecToABatch(preA + 2 * n, pre + ec->d * n, count - 1, ec, stack);
+	// t <- d a
+	ecMulARecMain(t, a, pre, preA, aff, ec, rec, m, stack);
+	// к аффинным координатам
+	return ecToA(b, t, ec, stack);
+}
+
+size_t ecMulARec_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m)
+{
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t count = SIZE_1 << (w - 1);
+	return O_OF_W(3 * ec_d * n) + 
+		O_OF_W(count * (ec_d + 2) * n) + 
+		utilMax(2,
+			ec_deep,
+			ecToABatch_deep(n, ec_deep, count - 1));
+}
+
+/*
+*******************************************************************************
+Пакет кратных точек
+
+Функция ecMulARecBatch() выполняет count независимых вызовов ecMulARec()
+с общими переходами к аффинным координатам: таблицы малых кратных всех
+точек переводятся в аффинные координаты одним пакетом, результаты --
+вторым пакетом (см. ecToABatch()). Тем самым выполняется 2 обращения
+в базовом поле вместо 2 count. Основные циклы выполняются так же, как
+в ecMulARec(), и сохраняют регулярность.
+
+Функция ecMulARecBatch1() отличается тем, что все точки умножаются на одну
+кратность: перекодированная кратность используется во всех основных
+циклах (шаг step по rec равен 0).
+*******************************************************************************
+*/
+
+static bool_t ecMulARecBatchStep(word b[], const word a[], const ec_o* ec,
+	const octet rec[], size_t step, size_t m, size_t count, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t cnt = SIZE_1 << (w - 1);
+	bool_t aff;
+	size_t i;
+	// переменные в stack
+	word* t;			/* [count * ec->d * n] результаты */
+	word* pre;			/* [count * cnt * ec->d * n] таблицы */
+	word* preA;			/* [count * cnt * 2 * n] таблицы (аффинные) */
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(memIsValid(rec, step ? count * step : ecRecode_keep(m)));
+	ASSERT(wwIsDisjoint2(a, count * 2 * n, b, count * 2 * n));
+	ASSERT(B_OF_W(m) > w);
+	// раскладка stack
+	t = (word*)stack;
+	pre = t + count * ec->d * n;
+	preA = pre + count * cnt * ec->d * n;
+	stack = preA + count * cnt * 2 * n;
+	// таблицы
+	for (i = 0; i < count; ++i)
+		ecMulARecPre(pre + i * cnt * ec->d * n, a + i * 2 * n, ec, cnt,
+			stack);
+	aff = ecToABatch(preA, pre, count * cnt, ec, stack);
+	// основные циклы
+	for (i = 0; i < count; ++i)
+		ecMulARecMain(t + i * ec->d * n, a + i * 2 * n,
+			pre + i * cnt * ec->d * n, preA + i * cnt * 2 * n, aff, ec,
+			rec + i * step, m, stack);
+	// к аффинным координатам
+	return ecToABatch(b, t, count, ec, stack);
+}
+
+bool_t ecMulARecBatch(word b[], const word a[], const ec_o* ec,
+	const octet rec[], size_t m, size_t count, void* stack)
+{
+	return ecMulARecBatchStep(b, a, ec, rec, ecRecode_keep(m), m, count,
+		stack);
+}
+
+bool_t ecMulARecBatch1(word b[], const word a[], const ec_o* ec,
+	const octet rec[], size_t m, size_t count, void* stack)
+{
+	return ecMulARecBatchStep(b, a, ec, rec, 0, m, count, stack);
+}
+
+size_t ecMulARecBatch_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m,
+	size_t count)
+{
+	const size_t w = ecNAFWidth(B_OF_W(m));
+	const size_t cnt = SIZE_1 << (w - 1);
+	return O_OF_W(count * ec_d * n) +
+		O_OF_W(count * cnt * (ec_d + 2) * n) +
+		utilMax(3,
+			O_OF_W(ec_d * n) + ec_deep,
+			O_OF_W(2 * ec_d * n) + ec_deep,
+			ecToABatch_deep(n, ec_deep, count * cnt));
+}
+
+bool_t SAFE(ecMulA)(word b[], const word a[], const ec_o* ec, 
+	const word d[], size_t m, void* stack)
+{
+	const size_t keep = ecRecode_keep(m);
+	bool_t ret;
+	// переменные в stack
+	octet* rec = (octet*)stack;
+	STAT_BEGIN;
+	stack = rec + O_OF_W(W_OF_O(keep));
+	// перекодировать и умножить
+	ecRecode(rec, d, m, stack);
+	ret = ecMulARec(b, a, ec, rec, m, stack);
+	// очистка
+	memSetZero(rec, keep);
+	STAT_END(STAT_EC_MULA, 0);
+	return ret;
+}
+
+static size_t ecMulASafe_deep(size_t n, size_t ec_d, size_t ec_deep, 
+	size_t m)
+{
+	return O_OF_W(W_OF_O(ecRecode_keep(m))) +
+		utilMax(2,
+			ecRecode_deep(m),
+			ecMulARec_deep(n, ec_d, ec_deep, m));
+}
+
+size_t ecMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m)
+{
+	return utilMax(2,
+		ecMulAFast_deep(n, ec_d, ec_deep, m),
+		ecMulASafe_deep(n, ec_d, ec_deep, m));
 }
 
 /*
@@ -258,13 +710,13 @@ bool_t ecHasOrderA(const word a[], const ec_o* ec, const word q[], size_t m,
 	// переменные в stack
 	word* b = (word*)stack;
 	stack = b + ec->d * n;
-	// q a == O?
-	return !ecMulA(b, a, ec, q, m, stack);
+	// q a == O? (q не является секретным)
+	return !FAST(ecMulA)(b, a, ec, q, m, stack);
 }
 
 size_t ecHasOrderA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t m)
 {
-	return O_OF_W(ec_d * n) + ecMulA_deep(n, ec_d, ec_deep, m);
+	return O_OF_W(ec_d * n) + ecMulAFast_deep(n, ec_d, ec_deep, m);
 }
 
 /*
@@ -282,61 +734,47 @@ Elliptic Curve Cryptography, Springer, 2004] (interleaving with NAF).
 *******************************************************************************
 */
 
-bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
+static bool_t ecAddMulStraus(word b[], const ec_o* ec, size_t k, 
+	const word* a[], const word* d[], size_t m[], void* stack)
 {
 	const size_t n = ec->f->n;
 	register word w;
 	size_t i, naf_max_size = 0;
-	va_list marker;
 	// переменные в stack
 	word* t;			/* проективная точка */
-	size_t* m;			/* длины d[i] */
 	size_t* naf_width;	/* размеры NAF-окон */
 	size_t* naf_size;	/* длины NAF */
-	size_t* naf_pos;	/* позиция в NAF-представлении */
-	word** naf;			/* NAF */
+	octet** naf;		/* символы NAF */
 	word** pre;			/* предвычисленные точки */
 	// pre
 	ASSERT(ecIsOperable(ec));
 	ASSERT(k > 0);
 	// раскладка stack
 	t = (word*)stack;
-	m = (size_t*)(t + ec->d * n);
-	naf_width = m + k;
+	naf_width = (size_t*)(t + ec->d * n);
 	naf_size = naf_width + k;
-	naf_pos = naf_size + k;
-	naf = (word**)(naf_pos + k);
-	pre = naf + k;
+	naf = (octet**)(naf_size + k);
+	pre = (word**)(naf + k);
 	stack = pre + k;
-	// обработать параметры (a[i], d[i], m[i])
-	va_start(marker, k);
+	// обработать тройки (a[i], d[i], m[i])
 	for (i = 0; i < k; ++i)
 	{
-		const word* a;
-		const word* d;
 		size_t naf_count, j;
-		// a <- a[i]
-		a = va_arg(marker, const word*);
-		// d <- d[i]
-		d = va_arg(marker, const word*);
-		// прочитать m[i]
-		m[i] = va_arg(marker, size_t);
 		// подправить m[i]
-		m[i] = wwWordSize(d, m[i]);
+		m[i] = wwWordSize(d[i], m[i]);
 		// расчет naf[i]
 		naf_width[i] = ecNAFWidth(B_OF_W(m[i]));
 		naf_count = SIZE_1 << (naf_width[i] - 2);
-		naf[i] = (word*)stack;
-		stack = naf[i] + 2 * m[i] + 1;
-		naf_size[i] = wwNAF(naf[i], d, m[i], naf_width[i]);
+		naf[i] = (octet*)stack;
+		stack = naf[i] + O_OF_W(W_OF_O(B_OF_W(m[i]) + 1));
+		naf_size[i] = wwNAFDigits(naf[i], d[i], m[i], naf_width[i]);
 		if (naf_size[i] > naf_max_size)
 			naf_max_size = naf_size[i];
-		naf_pos[i] = 0;
 		// резервируем память для pre[i]
 		pre[i] = (word*)stack;
 		stack = pre[i] + ec->d * n * naf_count;
 		// pre[i][0] <- a[i]
-		ecFromA(pre[i], a, ec, stack);
+		ecFromA(pre[i], a[i], ec, stack);
 		// расчет pre[i][j]: t <- 2a[i], pre[i][j] <- t + pre[i][j - 1]
 		ASSERT(naf_count > 1);
 		ecDblA(t, pre[i], ec, stack);
@@ -345,7 +783,6 @@ bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
 			ecAdd(pre[i] + j * ec->d * n, t, pre[i] + (j - 1) * ec->d * n, ec,
 				stack);
 	}
-	va_end(marker);
 	// t <- O
 	ecSetO(t, ec);
 	// основной цикл
@@ -361,7 +798,7 @@ bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
 			if (naf_size[i] < naf_max_size)
 				continue;
 			// прочитать очередной символ naf[i]
-			w = wwGetBits(naf[i], naf_pos[i], naf_width[i]);
+			w = naf[i][naf_max_size - 1];
 			// обработать символ
 			naf_hi = WORD_1 << (naf_width[i] - 1);
 			if (w & 1)
@@ -376,11 +813,7 @@ bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
 					ecSub(t, t, pre[i] + (w >> 1) * ec->d * n, ec, stack);
 				else
 					ecAdd(t, t, pre[i] + (w >> 1) * ec->d * n, ec, stack);
-				// к следующему символу naf[i]
-				naf_pos[i] += naf_width[i];
 			}
-			else
-				++naf_pos[i];
 		}
 	}
 	// очистка
@@ -389,23 +822,693 @@ bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
 	return ecToA(b, t, ec, stack);
 }
 
+static size_t ecAddMulStraus_deep(size_t n, size_t ec_d, size_t ec_deep, 
+	size_t k)
+{
+	return O_OF_W(ec_d * n) +
+		2 * sizeof(size_t) * k +
+		2 * sizeof(word**) * k +
+		ec_deep;
+}
+
+static size_t ecAddMulStrausItem_deep(size_t n, size_t ec_d, size_t m)
+{
+	const size_t naf_width = ecNAFWidth(B_OF_W(m));
+	const size_t naf_count = SIZE_1 << (naf_width - 2);
+	return O_OF_W(W_OF_O(B_OF_W(m) + 1)) + O_OF_W(ec_d * n * naf_count);
+}
+
+bool_t ecAddMulA(word b[], const ec_o* ec, void* stack, size_t k, ...)
+{
+	size_t i;
+	va_list marker;
+	bool_t ret;
+	// переменные в stack
+	const word** a;		/* точки */
+	const word** d;		/* кратности */
+	size_t* m;			/* длины d[i] */
+	STAT_BEGIN;
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(k > 0);
+	// раскладка stack
+	a = (const word**)stack;
+	d = a + k;
+	m = (size_t*)(d + k);
+	stack = m + k;
+	// прочитать тройки (a[i], d[i], m[i])
+	va_start(marker, k);
+	for (i = 0; i < k; ++i)
+	{
+		a[i] = va_arg(marker, const word*);
+		d[i] = va_arg(marker, const word*);
+		m[i] = va_arg(marker, size_t);
+	}
+	va_end(marker);
+	// расчет
+	ret = ecAddMulStraus(b, ec, k, a, d, m, stack);
+	STAT_END(STAT_EC_ADDMULA, 0);
+	return ret;
+}
+
 size_t ecAddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t k, ...)
 {
 	size_t i, ret;
 	va_list marker;
-	ret = O_OF_W(ec_d * n);
-	ret += 4 * sizeof(size_t) * k;
-	ret += 2 * sizeof(word**) * k;
+	ret = 2 * sizeof(word*) * k + sizeof(size_t) * k;
+	ret += ecAddMulStraus_deep(n, ec_d, ec_deep, k);
 	va_start(marker, k);
 	for (i = 0; i < k; ++i)
+		ret += ecAddMulStrausItem_deep(n, ec_d, va_arg(marker, size_t));
+	va_end(marker);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Сумма кратных точек: массивы
+
+При большом числе слагаемых k используется метод Пиппенджера 
+[Bernstein D. J. et al. Faster batch forgery identification, 2012]
+(bucket method). Кратности разбиваются на окна из c битов. Для каждого 
+окна слагаемые a[i] с одинаковой цифрой v распределяются по корзинам B[v], 
+после чего сумма \sum v B[v] рассчитывается накоплением:
+	s <- O, u <- O
+	for v = 2^c - 1,..., 1:
+		s <- s + B[v]
+		u <- u + s.
+
+Сложность (l = B_OF_W(m)): 
+	l(P <- 2P) + \lceil l / c \rceil [k (P <- P + A) + 2^{c+1} (P <- P + P)].
+
+Между алгоритмом 3.51 (см. ecAddMulStraus()) и методом Пиппенджера 
+выбирается тот, у которого меньше оценка числа сложений. Выбор, как и длина 
+окна c, зависит только от k и m, что позволяет рассчитать глубину стека. 
+Порог перехода к методу Пиппенджера составляет несколько сотен слагаемых.
+
+Корзины занимают 2^c - 1 проективных точек. Длина окна ограничена
+сверху значением EC_PIPPENGER_MAX: 12 в обычном профиле и 6 в профиле
+с низким потреблением памяти (директива LEAN_ENABLED).
+*******************************************************************************
+*/
+
+#ifdef LEAN_ENABLED
+	#define EC_PIPPENGER_MAX 6
+#else
+	#define EC_PIPPENGER_MAX 12
+#endif
+
+static size_t ecPippengerWidth(size_t k, size_t m)
+{
+	const size_t l = B_OF_W(m);
+	const size_t naf_width = ecNAFWidth(l);
+	size_t best, c, c_best = 0;
+	// оценка алгоритма 3.51
+	best = k * ((SIZE_1 << (naf_width - 2)) + l / (naf_width + 1));
+	// оценки метода Пиппенджера
+	for (c = 2; c <= EC_PIPPENGER_MAX; ++c)
 	{
-		size_t m = va_arg(marker, size_t);
-		size_t naf_width = ecNAFWidth(B_OF_W(m));
-		size_t naf_count = SIZE_1 << (naf_width - 2);
-		ret += O_OF_W(2 * m + 1);
-		ret += O_OF_W(ec_d * n * naf_count);
+		size_t cost = (l + c - 1) / c * (k + (SIZE_1 << (c + 1)));
+		if (cost < best)
+			best = cost, c_best = c;
 	}
-	va_end(marker);
-	ret += ec_deep;
+	return c_best;
+}
+
+static bool_t ecAddMulPippenger(word b[], const ec_o* ec, size_t k,
+	const word a[], const word d[], size_t m, size_t c, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t l = B_OF_W(m);
+	const size_t count = (SIZE_1 << c) - 1;
+	size_t i, j, v, pos;
+	// переменные в stack
+	word* t;			/* результат */
+	word* s;			/* накопленная сумма корзин */
+	word* u;			/* сумма кратных корзин */
+	word* bucket;		/* корзины B[1], B[2],..., B[count] */
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(2 <= c && c < B_PER_W);
+	// раскладка stack
+	t = (word*)stack;
+	s = t + ec->d * n;
+	u = s + ec->d * n;
+	bucket = u + ec->d * n;
+	stack = bucket + count * ec->d * n;
+	// t <- O
+	ecSetO(t, ec);
+	// цикл по окнам, начиная со старшего
+	for (j = (l + c - 1) / c; j--;)
+	{
+		const size_t width = MIN2(c, l - j * c);
+		// t <- 2^c t
+		for (i = 0; i < c; ++i)
+			ecDbl(t, t, ec, stack);
+		// распределить слагаемые по корзинам
+		for (v = 0; v < count; ++v)
+			ecSetO(bucket + v * ec->d * n, ec);
+		for (i = 0, pos = j * c; i < k; ++i)
+		{
+			v = (size_t)wwGetBits(d + i * m, pos, width);
+			if (v)
+				--v, ecAddA(bucket + v * ec->d * n, bucket + v * ec->d * n,
+					a + 2 * n * i, ec, stack);
+		}
+		// u <- \sum v B[v]
+		ecSetO(s, ec);
+		ecSetO(u, ec);
+		for (v = count; v--;)
+		{
+			ecAdd(s, s, bucket + v * ec->d * n, ec, stack);
+			ecAdd(u, u, s, ec, stack);
+		}
+		// t <- t + u
+		ecAdd(t, t, u, ec, stack);
+	}
+	// к аффинным координатам
+	return ecToA(b, t, ec, stack);
+}
+
+static size_t ecAddMulPippenger_deep(size_t n, size_t ec_d, size_t ec_deep,
+	size_t c)
+{
+	return O_OF_W(3 * ec_d * n) +
+		O_OF_W(((SIZE_1 << c) - 1) * ec_d * n) +
+		ec_deep;
+}
+
+bool_t ecAddMulAV(word b[], const ec_o* ec, size_t k, const word a[],
+	const word d[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t c = ecPippengerWidth(k, m);
+	size_t i;
+	bool_t ret;
+	// переменные в stack
+	const word** pa;	/* указатели на точки */
+	const word** pd;	/* указатели на кратности */
+	size_t* pm;			/* длины кратностей */
+	STAT_BEGIN;
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(k > 0 && m > 0);
+	ASSERT(wwIsValid(a, 2 * n * k) && wwIsValid(d, m * k));
+	// метод Пиппенджера?
+	if (c)
+		ret = ecAddMulPippenger(b, ec, k, a, d, m, c, stack);
+	else
+	{
+		// раскладка stack
+		pa = (const word**)stack;
+		pd = pa + k;
+		pm = (size_t*)(pd + k);
+		stack = pm + k;
+		// алгоритм 3.51
+		for (i = 0; i < k; ++i)
+			pa[i] = a + 2 * n * i, pd[i] = d + m * i, pm[i] = m;
+		ret = ecAddMulStraus(b, ec, k, pa, pd, pm, stack);
+	}
+	STAT_END(STAT_EC_ADDMULA, 0);
 	return ret;
 }
+
+size_t ecAddMulAV_deep(size_t n, size_t ec_d, size_t ec_deep, size_t k,
+	size_t m)
+{
+	const size_t c = ecPippengerWidth(k, m);
+	if (c)
+		return ecAddMulPippenger_deep(n, ec_d, ec_deep, c);
+	return 2 * sizeof(word*) * k + sizeof(size_t) * k +
+		ecAddMulStraus_deep(n, ec_d, ec_deep, k) +
+		k * ecAddMulStrausItem_deep(n, ec_d, m);
+}
+
+/*
+*******************************************************************************
+Кратная точка: гребенчатый метод
+
+Точка a фиксирована, кратные b = da определяются для многих d.
+Реализован гребенчатый метод со знаковыми ненулевыми цифрами
+[Hedabou M., Pinel P., Beneteau L. Countermeasures for Preventing 
+Comb Method Against SCA Attacks, 2005].
+
+Пусть l = wwBitSize(ec->order), s = \lceil l / w \rceil. Предварительно 
+рассчитываются аффинные точки
+	pre[i] = a + i_0 2^s a + i_1 2^{2s} a + ... + i_{w-2} 2^{(w-1)s} a,
+где (i_{w-2}...i_1 i_0)_2 -- двоичное представление i, 0 <= i < 2^{w-1}.
+
+Кратность d < ec->order заменяется на нечетное число e: e = d, если d 
+нечетно, и e = ec->order - d в противном случае (во втором случае 
+результат дополнительно обращается). Столбцы двоичной записи e
+	x_i = (e_{i + (w-1)s}...e_{i + s} e_i)_2,  i = 0, 1,..., s - 1,
+перекодируются в нечетные цифры x_0, x_1,..., x_s со знаками. Перекодировка
+повторяет функцию ecp_comb_recode_core() библиотеки mbedTLS.
+
+Затем
+	b <- \pm pre[x_s]
+	for i = s - 1,..., 0:
+		b <- 2b
+		b <- b \pm pre[x_i]
+
+Сложность: s удвоений и s сложений с аффинными точками. Для l = 256, w = 6:
+43 удвоения и 43 сложения против (примерно) 256 удвоений и 43 сложений
+в ecMulA().
+
+Точки pre[x_i] выбираются просмотром всей таблицы с маскированием,
+знаки учитываются также с помощью масок. Поэтому последовательность
+операций не зависит от d, за исключением редких исключительных ситуаций
+в ecAddA() (сложение равных или противоположных точек). 
+*******************************************************************************
+*/
+
+static size_t ecCombStride(const ec_o* ec, size_t w)
+{
+	ASSERT(2 <= w && w <= 8);
+	return (wwBitSize(ec->order, ec->f->n + 1) + w - 1) / w;
+}
+
+static void ecCombDigits(octet x[], const word e[], size_t n, size_t s,
+	size_t w)
+{
+	register octet c, cc, adj;
+	size_t i, j;
+	ASSERT(e[0] & WORD_1);
+	// столбцы
+	memSetZero(x, s + 1);
+	for (i = 0; i < s; ++i)
+		for (j = 0; j < w; ++j)
+			if (i + s * j < B_OF_W(n + 1))
+				x[i] |= (octet)(wwTestBit(e, i + s * j) << j);
+	// перекодировка столбцов
+	for (c = 0, i = 1; i <= s; ++i)
+	{
+		cc = x[i] & c;
+		x[i] ^= c;
+		c = cc;
+		adj = 1 - (x[i] & 1);
+		c |= x[i] & (x[i - 1] * adj);
+		x[i] ^= x[i - 1] * adj;
+		x[i - 1] |= adj << 7;
+	}
+	ASSERT(c == 0);
+	c = cc = adj = 0;
+}
+
+bool_t ecCombPrecA(word pre[], const word a[], const ec_o* ec, size_t w,
+	void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t s = ecCombStride(ec, w);
+	size_t i, j, k;
+	// переменные в stack
+	word* t;			/* t = 2^{js}a */
+	word* u;			/* вспомогательная точка */
+	word* p;			/* p = 2^{js}a (аффинная) */
+	// pre
+	ASSERT(ecIsOperable(ec) && ecIsOperableGroup(ec));
+	ASSERT(wwIsDisjoint2(pre, n << w, a, 2 * n));
+	// раскладка stack
+	t = (word*)stack;
+	u = t + ec->d * n;
+	p = u + ec->d * n;
+	stack = p + 2 * n;
+	// pre[0] <- a
+	wwCopy(pre, a, 2 * n);
+	// t <- a
+	ecFromA(t, a, ec, stack);
+	for (j = 1; j < w; ++j)
+	{
+		// p <- 2^{js}a
+		for (i = 0; i < s; ++i)
+			ecDbl(t, t, ec, stack);
+		if (!ecToA(p, t, ec, stack))
+			return FALSE;
+		// pre[2^{j - 1} + k] <- pre[k] + 2^{js}a
+		for (k = 0; k < (SIZE_1 << (j - 1)); ++k)
+		{
+			ecFromA(u, pre + 2 * n * k, ec, stack);
+			ecAddA(u, u, p, ec, stack);
+			if (!ecToA(pre + 2 * n * ((SIZE_1 << (j - 1)) + k), u, ec, stack))
+				return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+size_t ecCombPrecA_keep(size_t n, size_t w)
+{
+	ASSERT(2 <= w && w <= 8);
+	return O_OF_W(n << w);
+}
+
+size_t ecCombPrecA_deep(size_t n, size_t ec_d, size_t ec_deep)
+{
+	return O_OF_W(2 * ec_d * n + 2 * n) + ec_deep;
+}
+
+static bool_t ecCombMulMain(word t[], const word pre[], const ec_o* ec,
+	size_t w, const word d[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t s = ecCombStride(ec, w);
+	const size_t count = SIZE_1 << (w - 1);
+	size_t i;
+	register word neg;
+	// переменные в stack
+	word* e;			/* [n + 1] нечетная кратность */
+	word* u;			/* [ec->d * n] выбранная точка */
+	word* v;			/* [ec->d * n] -u или -t */
+	octet* x;			/* [s + 1] цифры */
+	// pre
+	ASSERT(ecIsOperable(ec) && ecIsOperableGroup(ec));
+	ASSERT(wwIsValid(pre, n << w));
+	ASSERT(wwIsValid(d, m));
+	ASSERT(wwCmp2(d, m, ec->order, n + 1) < 0);
+	// раскладка stack
+	e = (word*)stack;
+	u = e + n + 1;
+	v = u + ec->d * n;
+	x = (octet*)(v + ec->d * n);
+	stack = x + O_OF_W(W_OF_O(s + 1));
+	// e <- d
+	m = MIN2(m, n + 1);
+	wwCopy(e, d, m);
+	wwSetZero(e + m, n + 1 - m);
+	// d == 0 => b <- O
+	if (wwIsZero(e, n + 1))
+		return FALSE;
+	// e <- d или ec->order - d (нечетное)
+	zzSub(v, ec->order, e, n + 1);
+	neg = WORD_0 - (~e[0] & WORD_1);
+	ecMaskMove(e, v, neg, n + 1);
+	ASSERT(e[0] & WORD_1);
+	// цифры
+	ecCombDigits(x, e, n, s, w);
+	// t <- \pm pre[x_s]
+	wwSelect(u, pre, count, (x[s] & 0x7F) >> 1, 2 * n);
+	ecFromA(t, u, ec, stack);
+	ecNeg(v, t, ec, stack);
+	ecMaskMove(t, v, WORD_0 - (word)(x[s] >> 7), ec->d * n);
+	// цикл по цифрам
+	for (i = s; i--;)
+	{
+		// t <- 2t
+		ecDbl(t, t, ec, stack);
+		// u <- \pm pre[x_i]
+		wwSelect(u, pre, count, (x[i] & 0x7F) >> 1, 2 * n);
+		ecFromA(u, u, ec, stack);
+		ecNeg(v, u, ec, stack);
+		ecMaskMove(u, v, WORD_0 - (word)(x[i] >> 7), 2 * n);
+		// t <- t + u
+		ecAddA(t, t, u, ec, stack);
+	}
+	// t <- -t, если e = ec->order - d
+	ecNeg(v, t, ec, stack);
+	ecMaskMove(t, v, neg, ec->d * n);
+	// очистка
+	neg = 0;
+	wwSetZero(e, n + 1);
+	memSetZero(x, s + 1);
+	return TRUE;
+}
+
+static size_t ecCombMulMain_deep(size_t n, size_t ec_d, size_t ec_deep,
+	size_t w)
+{
+	return O_OF_W(n + 1) + 
+		O_OF_W(2 * ec_d * n) + 
+		O_OF_W(W_OF_O(B_OF_W(n + 1) / w + 2)) + 
+		ec_deep;
+}
+
+bool_t ecCombMulA(word b[], const word pre[], const ec_o* ec, size_t w, 
+	const word d[], size_t m, void* stack)
+{
+	// переменные в stack
+	word* t = (word*)stack;	/* [ec->d * n] результат */
+	stack = t + ec->d * ec->f->n;
+	// t <- d a
+	if (!ecCombMulMain(t, pre, ec, w, d, m, stack))
+		return FALSE;
+	// к аффинным координатам
+	return ecToA(b, t, ec, stack);
+}
+
+size_t ecCombMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w)
+{
+	ASSERT(2 <= w && w <= 8);
+	return O_OF_W(ec_d * n) + 
+		ecCombMulMain_deep(n, ec_d, ec_deep, w);
+}
+
+bool_t ecCombMulABatch(word b[], const word pre[], const ec_o* ec,
+	size_t w, const word d[], size_t m, size_t count, void* stack)
+{
+	const size_t n = ec->f->n;
+	size_t i;
+	// переменные в stack
+	word* t = (word*)stack;	/* [count * ec->d * n] результаты */
+	stack = t + count * ec->d * n;
+	// pre
+	ASSERT(wwIsDisjoint2(b, count * 2 * n, d, count * m));
+	// t_i <- d_i a
+	for (i = 0; i < count; ++i)
+		if (!ecCombMulMain(t + i * ec->d * n, pre, ec, w, d + i * m, m,
+			stack))
+			return FALSE;
+	// к аффинным координатам
+	return ecToABatch(b, t, count, ec, stack);
+}
+
+size_t ecCombMulABatch_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w,
+	size_t count)
+{
+	ASSERT(2 <= w && w <= 8);
+	return O_OF_W(count * ec_d * n) + 
+		utilMax(2,
+			ecCombMulMain_deep(n, ec_d, ec_deep, w),
+			ecToABatch_deep(n, ec_deep, count));
+}
+
+/*
+*******************************************************************************
+Сумма кратных точек с таблицей предвычислений
+
+Рассчитывается d G + e a, где G -- точка, для которой построена таблица 
+гребня pre. Цифры x_0, x_1,..., x_s кратности d определяются так же, 
+как в ecCombMulA(), кратность e представляется символами NAF ширины w',
+выбранной функцией ecNAFWidth(). Для a рассчитываются малые нечетные 
+кратные, которые переводятся в аффинные координаты одним пакетом.
+
+Затем обе последовательности обрабатываются в одном цикле:
+	t <- O
+	for i = max(s, l - 1),..., 0:
+		t <- 2t
+		if i <= s:
+			t <- t \pm pre[x_i]
+		if e_i != 0:
+			t <- t \pm e_i a
+
+Для l = 256, w = 6 удвоений примерно 256 (как в ecMulA()), сложений 
+43 + 256 / (w' + 1). Раздельный расчет d G с помощью ecCombMulA() и e a 
+с помощью ecMulA() требует дополнительно 43 удвоений, а расчет 
+с помощью ecAddMulA() -- дополнительно примерно 256 / (w' + 1) сложений 
+(NAF для G вместо гребня).
+
+Функция нерегулярна и предназначена для обработки открытых кратностей
+(например, при проверке подписи).
+
+Функция ecComb2AddMulA() дополнительно обрабатывает в том же цикле
+гребень второй фиксированной точки: d G + d2 Q + e a. Для l = 256, w = 6 
+и e длины 128 (проверка идентификационной подписи) удвоений примерно 128 
+вместо 256 в ecAddMulA() с тремя слагаемыми. Слагаемое e a может 
+отсутствовать (k == 0), и тогда удвоений всего 43.
+*******************************************************************************
+*/
+
+static bool_t ecCombAddMulA_internal(word b[], const ec_o* ec, size_t w,
+	const word pre[], const word d[], size_t m, 
+	const word pre2[], const word d2[], size_t m2, 
+	const word a[], const word e[], size_t k, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t s = ecCombStride(ec, w);
+	const size_t naf_width = ecNAFWidth(B_OF_W(k));
+	const size_t naf_count = SIZE_1 << (naf_width - 2);
+	const word naf_hi = WORD_1 << (naf_width - 1);
+	size_t comb_size;
+	size_t comb2_size;
+	size_t naf_size;
+	size_t i;
+	bool_t neg;
+	bool_t neg2;
+	bool_t aff;
+	word c;
+	// переменные в stack
+	word* f;			/* [n + 1] нечетная кратность */
+	word* t;			/* [ec->d * n] результат */
+	octet* x;			/* [s + 1] цифры гребня */
+	octet* naf;			/* символы NAF */
+	word* pa;			/* pa[i] = (2i + 1)a (naf_count элементов) */
+	word* paA;			/* pa[i] в аффинных координатах */
+	octet* x2;			/* [s + 1] цифры второго гребня */
+	// pre
+	ASSERT(ecIsOperable(ec) && ecIsOperableGroup(ec));
+	ASSERT(wwIsValid(pre, n << w));
+	ASSERT(wwIsValid(d, m) && wwIsValid(e, k));
+	ASSERT(wwCmp2(d, m, ec->order, n + 1) < 0);
+	ASSERT(pre2 == 0 || wwIsValid(pre2, n << w) && wwIsValid(d2, m2));
+	ASSERT(pre2 == 0 || wwCmp2(d2, m2, ec->order, n + 1) < 0);
+	ASSERT(k == 0 || a != 0);
+	// раскладка stack
+	f = (word*)stack;
+	t = f + n + 1;
+	x = (octet*)(t + ec->d * n);
+	naf = x + O_OF_W(W_OF_O(s + 1));
+	pa = (word*)(naf + O_OF_W(W_OF_O(B_OF_W(k) + 1)));
+	paA = pa + naf_count * ec->d * n;
+	stack = x2 = (octet*)(paA + naf_count * 2 * n);
+	if (pre2)
+		stack = x2 + O_OF_W(W_OF_O(s + 1));
+	// f <- d или ec->order - d (нечетное), цифры гребня
+	neg = FALSE, comb_size = 0;
+	m = MIN2(m, n + 1);
+	wwCopy(f, d, m);
+	wwSetZero(f + m, n + 1 - m);
+	if (!wwIsZero(f, n + 1))
+	{
+		if ((f[0] & WORD_1) == 0)
+		{
+			zzSub(f, ec->order, f, n + 1);
+			neg = TRUE;
+		}
+		ecCombDigits(x, f, n, s, w);
+		comb_size = s + 1;
+	}
+	// то же для d2
+	neg2 = FALSE, comb2_size = 0;
+	if (pre2)
+	{
+		m2 = MIN2(m2, n + 1);
+		wwCopy(f, d2, m2);
+		wwSetZero(f + m2, n + 1 - m2);
+		if (!wwIsZero(f, n + 1))
+		{
+			if ((f[0] & WORD_1) == 0)
+			{
+				zzSub(f, ec->order, f, n + 1);
+				neg2 = TRUE;
+			}
+			ecCombDigits(x2, f, n, s, w);
+			comb2_size = s + 1;
+		}
+	}
+	// символы NAF
+	ASSERT(naf_width >= 3);
+	naf_size = k ? wwNAFDigits(naf, e, k, naf_width) : 0;
+	// малые кратные a
+	aff = FALSE;
+	if (naf_size)
+	{
+		// pa[0] <- a
+		ecFromA(pa, a, ec, stack);
+		// pa[i] <- 2a + pa[i - 1]
+		ASSERT(naf_count > 1);
+		ecDblA(t, pa, ec, stack);
+		ecAddA(pa + ec->d * n, t, pa, ec, stack);
+		for (i = 2; i < naf_count; ++i)
+			ecAdd(pa + i * ec->d * n, t, pa + (i - 1) * ec->d * n, ec, 
+				stack);
+		// paA[i] <- pa[i] (paA[0] = a)
+		wwCopy(paA, a, 2 * n);
+		aff = ecToABatch(paA + 2 * n, pa + ec->d * n, naf_count - 1, ec, 
+			stack);
+	}
+	// t <- O
+	ecSetO(t, ec);
+	// цикл по разрядам
+	for (i = MAX2(MAX2(comb_size, comb2_size), naf_size); i--;)
+	{
+		// t <- 2t
+		ecDbl(t, t, ec, stack);
+		// t <- t \pm pre[x_i]
+		if (i < comb_size)
+		{
+			c = x[i];
+			if ((c >> 7) ^ neg)
+				ecSubA(t, t, pre + ((c & 0x7F) >> 1) * 2 * n, ec, stack);
+			else
+				ecAddA(t, t, pre + ((c & 0x7F) >> 1) * 2 * n, ec, stack);
+		}
+		// t <- t \pm pre2[x2_i]
+		if (i < comb2_size)
+		{
+			c = x2[i];
+			if ((c >> 7) ^ neg2)
+				ecSubA(t, t, pre2 + ((c & 0x7F) >> 1) * 2 * n, ec, stack);
+			else
+				ecAddA(t, t, pre2 + ((c & 0x7F) >> 1) * 2 * n, ec, stack);
+		}
+		// t <- t \pm pa[naf_i]
+		if (i < naf_size && ((c = naf[i]) & 1))
+		{
+			if (aff && (c & naf_hi))
+				ecSubA(t, t, paA + ((c ^ naf_hi) >> 1) * 2 * n, ec, stack);
+			else if (aff)
+				ecAddA(t, t, paA + (c >> 1) * 2 * n, ec, stack);
+			else if (c == 1)
+				ecAddA(t, t, a, ec, stack);
+			else if (c == (naf_hi ^ 1))
+				ecSubA(t, t, a, ec, stack);
+			else if (c & naf_hi)
+				ecSub(t, t, pa + ((c ^ naf_hi) >> 1) * ec->d * n, ec, stack);
+			else
+				ecAdd(t, t, pa + (c >> 1) * ec->d * n, ec, stack);
+		}
+	}
+	// к аффинным координатам
+	return ecToA(b, t, ec, stack);
+}
+
+bool_t ecCombAddMulA(word b[], const word pre[], const ec_o* ec, size_t w,
+	const word d[], size_t m, const word a[], const word e[], size_t k, 
+	void* stack)
+{
+	ASSERT(k > 0);
+	return ecCombAddMulA_internal(b, ec, w, pre, d, m, 0, 0, 0, a, e, k,
+		stack);
+}
+
+size_t ecCombAddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w, 
+	size_t k)
+{
+	const size_t naf_width = ecNAFWidth(B_OF_W(k));
+	const size_t naf_count = SIZE_1 << (naf_width - 2);
+	ASSERT(2 <= w && w <= 8);
+	return O_OF_W(n + 1) + 
+		O_OF_W(ec_d * n) + 
+		O_OF_W(W_OF_O(B_OF_W(n + 1) / w + 2)) + 
+		O_OF_W(W_OF_O(B_OF_W(k) + 1)) + 
+		O_OF_W((ec_d + 2) * n * naf_count) + 
+		utilMax(2,
+			ec_deep,
+			ecToABatch_deep(n, ec_deep, naf_count - 1));
+}
+
+bool_t ecComb2AddMulA(word b[], const ec_o* ec, size_t w, const word pre[],
+	const word d[], size_t m, const word pre2[], const word d2[], size_t m2,
+	const word a[], const word e[], size_t k, void* stack)
+{
+	ASSERT(pre2 != 0);
+	return ecCombAddMulA_internal(b, ec, w, pre, d, m, pre2, d2, m2, a, e, k,
+		stack);
+}
+
+size_t ecComb2AddMulA_deep(size_t n, size_t ec_d, size_t ec_deep, size_t w,
+	size_t k)
+{
+	ASSERT(2 <= w && w <= 8);
+	return ecCombAddMulA_deep(n, ec_d, ec_deep, w, k) +
+		O_OF_W(W_OF_O(B_OF_W(n + 1) / w + 2));
+}
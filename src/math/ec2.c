@@ -4,7 +4,7 @@
 \brief Elliptic curves over binary fields
 \project bee2 [cryptographic library]
 \created 2012.06.26
-\version 2014.07.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,6 +13,7 @@
 #include "bee2/core/mem.h"
 #include "bee2/core/stack.h"
 #include "bee2/core/util.h"
+#include "bee2/core/word.h"
 #include "bee2/math/ec2.h"
 #include "bee2/math/gf2.h"
 #include "bee2/math/pri.h"
@@ -167,6 +168,44 @@ static size_t ec2ToALD_deep(size_t n, size_t f_deep)
 	return O_OF_W(n) + f_deep;
 }
 
+// [count * 3n]a -> [count * 2n]b
+static bool_t ec2ToALDBatch(word b[], const word a[], size_t count, 
+	const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	bool_t ret = TRUE;
+	size_t i;
+	// переменные в stack
+	word* z = (word*)stack;
+	stack = z + count * n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(wwIsDisjoint2(a, count * 3 * n, b, count * 2 * n));
+	// z[i] <- za[i] (или 1, если a[i] == O)
+	for (i = 0; i < count; ++i)
+	{
+		ASSERT(ec2SeemsOn3(a + 3 * n * i, ec));
+		if (qrIsZero(ecZ(a + 3 * n * i, n), ec->f))
+			qrCopy(z + n * i, ec->f->unity, ec->f), ret = FALSE;
+		else
+			qrCopy(z + n * i, ecZ(a + 3 * n * i, n), ec->f);
+	}
+	// z[i] <- z[i]^{-1}
+	qrInvBatch(z, z, count, ec->f, stack);
+	for (i = 0; i < count; ++i)
+	{
+		// xb <- xa z[i]
+		qrMul(ecX(b + 2 * n * i), ecX(a + 3 * n * i), z + n * i, ec->f, 
+			stack);
+		// z[i] <- z[i]^2
+		qrSqr(z + n * i, z + n * i, ec->f, stack);
+		// yb <- ya z[i]
+		qrMul(ecY(b + 2 * n * i, n), ecY(a + 3 * n * i, n), z + n * i, 
+			ec->f, stack);
+	}
+	return ret;
+}
+
 // [3n]b <- -[3n]a (P <- -P)
 static void ec2NegLD(word b[], const word a[], const ec_o* ec, void* stack)
 {
@@ -552,6 +591,8 @@ bool_t ec2CreateLD(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 	// подготовить буферы для описания группы точек
 	ec->base = ec->B + f->n;
 	ec->order = ec->base + 2 * f->n;
+	// за order: [f->n + 3] параметр Барретта (см. ecCreateGroupBarr())
+	ec->params = 0;
 	// настроить интерфейсы
 	ec->froma = ec2FromALD;
 	ec->toa = ec2ToALD;
@@ -562,6 +603,7 @@ bool_t ec2CreateLD(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 	ec->suba = ec2SubALD;
 	ec->dbl = ec2DblLD;
 	ec->dbla = ec2DblALD;
+	ec->toab = ec2ToALDBatch;
 	ec->deep = utilMax(8,
 		ec2ToALD_deep(f->n, f->deep),
 		ec2NegLD_deep(f->n, f->deep),
@@ -572,7 +614,7 @@ bool_t ec2CreateLD(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 		ec2DblLD_deep(f->n, f->deep),
 		ec2DblALD_deep(f->n, f->deep));
 	// настроить заголовок
-	ec->hdr.keep = sizeof(ec_o) + O_OF_W(5 * f->n + 1);
+	ec->hdr.keep = sizeof(ec_o) + O_OF_W(6 * f->n + 4);
 	ec->hdr.p_count = 6;
 	ec->hdr.o_count = 1;
 	// все нормально
@@ -581,7 +623,7 @@ bool_t ec2CreateLD(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 
 size_t ec2CreateLD_keep(size_t n)
 {
-	return sizeof(ec_o) + O_OF_W(5 * n + 1);
+	return sizeof(ec_o) + O_OF_W(6 * n + 4);
 }
 
 size_t ec2CreateLD_deep(size_t n, size_t f_deep)
@@ -858,3 +900,633 @@ size_t ec2SubAA_deep(size_t n, size_t f_deep)
 {
 	return O_OF_W(2 * n) + ec2AddAA_deep(n, f_deep);
 }
+
+/*
+*******************************************************************************
+Кратная точка: лестница Монтгомери в x-координатах
+
+Реализован алгоритм из работы [Lopez J., Dahab R. Fast multiplication on 
+elliptic curves over GF(2^m) without precomputation. CHES 1999]. 
+Поддерживаются x-координаты точек R0 = ka, R1 = (k + 1)a в проективной 
+форме (X, Z), x = X / Z, где k -- старшие биты кратности. Разность 
+R1 - R0 = a известна, поэтому сумма R0 + R1 определяется по x-координатам:
+	Z3 <- (X0 Z1 + X1 Z0)^2, X3 <- xa Z3 + (X0 Z1)(X1 Z0).
+Удвоение:
+	X3 <- X^4 + B Z^4, Z3 <- X^2 Z^2.
+Сложность шага: 5M + 5S + 1*B \approx 6M (ср. с одним удвоением (5M) и 
+1/(w + 1) сложениями (по 9M) на бит в ecMulA()). Таблица предвычислений 
+не нужна, шаги выполняются без ветвлений.
+
+После выполнения шагов по x-координатам R0 и R1 восстанавливается 
+y-координата R0 = (x0, y0) [Lopez, Dahab, 1999]:
+	x0 = X0 / Z0, 
+	y0 = (xa + x0)[(X0 + xa Z0)(X1 + xa Z1) + (xa^2 + ya) Z0 Z1] / 
+		(xa Z0 Z1) + ya.
+Здесь требуется одно обращение.
+
+Регуляризация кратности и условные перестановки R0 и R1 выполняются 
+по маскам: кратность d < q заменяется на k = d + q или k = d + 2q, 
+где q = ec->order, так, чтобы длина k в битах равнялась l + 1, 
+l = wwBitSize(q). Формулы сложения и удвоения корректно обрабатывают 
+точку O (Z = 0), поэтому исключительные ситуации возникают только в 
+конце: при R0 = O (d a = O) и R1 = O (d a = -a). При d >= q, а также
+при xa = 0 (порядок a равен 2) вызывается SAFE(ecMulA).
+*******************************************************************************
+*/
+
+static void ec2MaskSwap(word a[], word b[], register word mask, size_t size)
+{
+	register word t;
+	while (size--)
+		t = (a[size] ^ b[size]) & mask, a[size] ^= t, b[size] ^= t;
+	t = 0;
+}
+
+bool_t ec2MulAX(word b[], const word a[], const ec_o* ec, const word d[],
+	size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t l = wwBitSize(ec->order, n + 1);
+	register word mask, bit, swap;
+	size_t i;
+	// переменные в stack
+	word* k;			/* [n + 2] регуляризованная кратность */
+	word* k2;			/* [n + 2] k + q */
+	word* r0;			/* [2n] (X0, Z0) */
+	word* r1;			/* [2n] (X1, Z1) */
+	word* t1;			/* [n] вспомогательное число */
+	word* t2;			/* [n] вспомогательное число */
+	// pre
+	ASSERT(ecIsOperableGroup(ec) && ec->d == 3);
+	ASSERT(ec2SeemsOnA(a, ec));
+	ASSERT(wwIsValid(d, m));
+	// d >= q или xa == 0 => нерегулярный случай
+	if (wwCmp2(d, m, ec->order, n + 1) >= 0 || qrIsZero(ecX(a), ec->f))
+		return SAFE(ecMulA)(b, a, ec, d, m, stack);
+	// раскладка stack
+	k = (word*)stack;
+	k2 = k + n + 2;
+	r0 = k2 + n + 2;
+	r1 = r0 + 2 * n;
+	t1 = r1 + 2 * n;
+	t2 = t1 + n;
+	stack = t2 + n;
+	// k <- d + q, k2 <- k + q
+	wwCopy(k, d, MIN2(m, n + 2));
+	wwSetZero(k + MIN2(m, n + 2), n + 2 - MIN2(m, n + 2));
+	k[n + 1] = zzAdd2(k, ec->order, n + 1);
+	k2[n + 1] = k[n + 1] + zzAdd(k2, k, ec->order, n + 1);
+	// k <- k2, если бит l числа k нулевой
+	mask = (word)wwTestBit(k, l) - WORD_1;
+	ec2MaskSwap(k, k2, mask, n + 2);
+	ASSERT(wwTestBit(k, l) && wwBitSize(k, n + 2) == l + 1);
+	// R0 <- (xa, 1), R1 <- (xa^4 + B, xa^2)
+	qrCopy(r0, ecX(a), ec->f);
+	qrSetUnity(r0 + n, ec->f);
+	qrSqr(r1 + n, ecX(a), ec->f, stack);
+	qrSqr(r1, r1 + n, ec->f, stack);
+	gf2Add2(r1, ec->B, ec->f);
+	// цикл по битам k
+	for (i = l, swap = 0; i--;)
+	{
+		bit = (word)wwTestBit(k, i);
+		ec2MaskSwap(r0, r1, WORD_0 - (bit ^ swap), 2 * n);
+		swap = bit;
+		// R1 <- R0 + R1: t1 <- X0 Z1, t2 <- X1 Z0
+		qrMul(t1, r0, r1 + n, ec->f, stack);
+		qrMul(t2, r1, r0 + n, ec->f, stack);
+		// Z1 <- (t1 + t2)^2, X1 <- xa Z1 + t1 t2
+		gf2Add(r1 + n, t1, t2, ec->f);
+		qrSqr(r1 + n, r1 + n, ec->f, stack);
+		qrMul(t1, t1, t2, ec->f, stack);
+		qrMul(r1, ecX(a), r1 + n, ec->f, stack);
+		gf2Add2(r1, t1, ec->f);
+		// R0 <- 2 R0: t1 <- X0^2, t2 <- Z0^2
+		qrSqr(t1, r0, ec->f, stack);
+		qrSqr(t2, r0 + n, ec->f, stack);
+		// Z0 <- t1 t2, X0 <- t1^2 + B t2^2
+		qrMul(r0 + n, t1, t2, ec->f, stack);
+		qrSqr(t2, t2, ec->f, stack);
+		qrMul(t2, t2, ec->B, ec->f, stack);
+		qrSqr(r0, t1, ec->f, stack);
+		gf2Add2(r0, t2, ec->f);
+	}
+	ec2MaskSwap(r0, r1, WORD_0 - swap, 2 * n);
+	// очистка
+	mask = bit = swap = 0;
+	wwSetZero(k, 2 * n + 4);
+	// R0 == O => b <- O
+	if (qrIsZero(r0 + n, ec->f))
+		return FALSE;
+	// R1 == O => b <- -a
+	if (qrIsZero(r1 + n, ec->f))
+	{
+		ec2NegA(b, a, ec);
+		return TRUE;
+	}
+	// t1 <- Z0 Z1, t2 <- X0 Z1
+	qrMul(t1, r0 + n, r1 + n, ec->f, stack);
+	qrMul(t2, r0, r1 + n, ec->f, stack);
+	// X1 <- X1 + xa Z1
+	qrMul(r1 + n, ecX(a), r1 + n, ec->f, stack);
+	gf2Add2(r1, r1 + n, ec->f);
+	// Z1 <- X0 + xa Z0
+	qrMul(r1 + n, ecX(a), r0 + n, ec->f, stack);
+	gf2Add2(r1 + n, r0, ec->f);
+	// X1 <- X1 Z1 + (xa^2 + ya) t1
+	qrMul(r1, r1, r1 + n, ec->f, stack);
+	qrSqr(r1 + n, ecX(a), ec->f, stack);
+	gf2Add2(r1 + n, ecY(a, n), ec->f);
+	qrMul(r1 + n, r1 + n, t1, ec->f, stack);
+	gf2Add2(r1, r1 + n, ec->f);
+	// t1 <- (xa t1)^{-1}
+	qrMul(r0 + n, ecX(a), t1, ec->f, stack);
+	qrInv(t1, r0 + n, ec->f, stack);
+	// t2 <- xa t2 t1 = X0 / Z0 = x0
+	qrMul(t2, t2, ecX(a), ec->f, stack);
+	qrMul(t2, t2, t1, ec->f, stack);
+	// X1 <- X1 (xa + x0) t1 + ya = y0
+	gf2Add(r1 + n, ecX(a), t2, ec->f);
+	qrMul(r1, r1, r1 + n, ec->f, stack);
+	qrMul(r1, r1, t1, ec->f, stack);
+	gf2Add2(r1, ecY(a, n), ec->f);
+	// b <- (x0, y0)
+	qrCopy(ecX(b), t2, ec->f);
+	qrCopy(ecY(b, n), r1, ec->f);
+	return TRUE;
+}
+
+size_t ec2MulAX_deep(size_t n, size_t f_deep, size_t ec_deep, size_t m)
+{
+	return utilMax(2,
+		O_OF_W(2 * (n + 2) + 6 * n) + f_deep,
+		ecMulA_deep(n, 3, ec_deep, m));
+}
+
+/*
+*******************************************************************************
+Кривые Коблица
+
+Кривая E: y^2 + xy = x^3 + A x^2 + 1, A \in {0, 1}, называется кривой 
+Коблица. На E действует эндоморфизм Фробениуса \tau: (x, y) -> (x^2, y^2),
+который удовлетворяет уравнению \tau^2 - \mu\tau + 2 = 0, \mu = (-1)^{1 - A}.
+Поэтому кратность d можно заменить элементом \rho кольца Z[\tau] и
+разложить \rho по степеням \tau (\tau-адический NAF). Удвоения при
+вычислении кратной точки заменяются применениями \tau, т.е. тремя
+возведениями в квадрат в LD-координатах: (X : Y : Z) -> (X^2 : Y^2 : Z^2).
+
+Реализованы алгоритмы 3.65 (редукция) и 3.69 (оконный \tau-NAF) из
+[Hankerson D., Menezes A., Vanstone S. Guide to Elliptic Curve Cryptography,
+Springer, 2004] со следующими упрощениями:
+1)	d редуцируется по модулю \tau^m - 1, а не (\tau^m - 1) / (\tau - 1).
+	Поскольку \tau^m действует на E(GF(2^m)) тождественно, редукция 
+	корректна для любой точки, а не только для точек простого порядка.
+	Коэффициенты \tau^m - 1 = a0 + a1 \tau рассчитываются с помощью 
+	последовательности Люка: 
+		U_0 = 0, U_1 = 1, U_{k + 1} = \mu U_k - 2 U_{k - 1},
+		\tau^k = U_k \tau - 2 U_{k - 1};
+2)	при делении на \tau^m - 1 частное округляется покомпонентно. 
+	Норма остатка \rho не превосходит N(\tau^m - 1) = #E(GF(2^m)), и длина 
+	\tau-NAF для \rho превышает m не более чем на несколько символов.
+
+Числа, которые возникают при редукции и перекодировке, могут быть 
+отрицательными. Они представляются в дополнительном коде в буферах
+фиксированной длины (функции ec2ZXXX()).
+
+Символы u оконного \tau-NAF нечетны, |u| < 2^{w - 1}. Символу u > 0
+соответствует представитель \alpha_u = \beta_u + \gamma_u \tau класса
+вычетов u \bmod \tau^w с минимальной нормой (таблица 3.9 из [Hankerson D., 
+Menezes A., Vanstone S., 2004]). Малые кратные \alpha_u a рассчитываются 
+по \tau-NAF (w = 2) для \alpha_u и переводятся в аффинные координаты одним 
+пакетом.
+
+Средняя сложность (l = m):
+	l(3S) + c_w(P <- P + A) + l/(w + 1)(P <- P + A),
+где c_w -- число сложений при расчете малых кратных (c_5 = 10). 
+Сложность FAST(ecMulA) включает вместо l(3S) слагаемое l(P <- 2P).
+
+\todo Лямбда-координаты [Oliveira, Lopez, Aranha, Rodriguez-Henriquez, 
+2013] для дальнейшего ускорения сложений.
+*******************************************************************************
+*/
+
+static const struct
+{
+	word tw;			/*< t_w = 2 U_{w - 1} U_w^{-1} \bmod 2^w */
+	int alpha[16][2];	/*< (\beta_u, \gamma_u), u = 1, 3,..., 2^{w - 1} - 1 */
+} _ec2_tnaf[2][3] =
+{
+	// A = 0
+	{
+		{10, {{1, 0}, {-3, -1}, {-1, -1}, {1, -1}}},
+		{26, {{1, 0}, {-3, -1}, {-1, -1}, {1, -1}, {-3, -2}, {-1, -2}, 
+			{1, -2}, {1, 3}}},
+		{26, {{1, 0}, {3, 0}, {5, 0}, {-5, -2}, {-3, -2}, {-1, -2}, {1, -2}, 
+			{1, 3}, {3, 3}, {5, 3}, {-3, -4}, {-3, 1}, {-1, 1}, {1, 1}, 
+			{3, 1}, {5, 1}}},
+	},
+	// A = 1
+	{
+		{6, {{1, 0}, {-3, 1}, {-1, 1}, {1, 1}}},
+		{6, {{1, 0}, {-3, 1}, {-1, 1}, {1, 1}, {-3, 2}, {-1, 2}, {1, 2}, 
+			{1, -3}}},
+		{38, {{1, 0}, {3, 0}, {5, 0}, {-5, 2}, {-3, 2}, {-1, 2}, {1, 2}, 
+			{1, -3}, {3, -3}, {5, -3}, {-3, 4}, {-3, -1}, {-1, -1}, {1, -1}, 
+			{3, -1}, {5, -1}}},
+	},
+};
+
+static size_t ec2TNAFWidth(size_t l)
+{
+	if (l >= 336)
+		return 6;
+	else if (l >= 120)
+		return 5;
+	return 4;
+}
+
+bool_t ec2IsKoblitz(const ec_o* ec)
+{
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	return (qrIsZero(ec->A, ec->f) || qrIsUnity(ec->A, ec->f)) &&
+		qrIsUnity(ec->B, ec->f);
+}
+
+// [3n]b <- \tau([3n]a)
+static void ec2FrobLD(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	qrSqr(ecX(b), ecX(a), ec->f, stack);
+	qrSqr(ecY(b, n), ecY(a, n), ec->f, stack);
+	qrSqr(ecZ(b, n), ecZ(a, n), ec->f, stack);
+}
+
+#define ec2ZIsNeg(a, L)\
+	(((a)[(L) - 1] & WORD_BIT_HI) != 0)
+
+// [L]a <- [L]a + v
+static void ec2ZAddI(word a[], size_t L, int v)
+{
+	if (v >= 0)
+		zzAddW2(a, L, (word)v);
+	else
+		zzSubW2(a, L, (word)-v);
+}
+
+// [L]a <- [L]a / 2 (a -- четное)
+static void ec2ZHalve(word a[], size_t L)
+{
+	const word hi = a[L - 1] & WORD_BIT_HI;
+	ASSERT((a[0] & 1) == 0);
+	wwShLo(a, L, 1);
+	a[L - 1] |= hi;
+}
+
+// [L]c <- [L]a * [L]b
+static void ec2ZMul(word c[], const word a[], const word b[], size_t L,
+	void* stack)
+{
+	// переменные в stack
+	word* ua = (word*)stack;
+	word* ub = ua + L;
+	word* prod = ub + L;
+	stack = prod + 2 * L;
+	// ua <- |a|, ub <- |b|
+	if (ec2ZIsNeg(a, L))
+		zzNeg(ua, a, L);
+	else
+		wwCopy(ua, a, L);
+	if (ec2ZIsNeg(b, L))
+		zzNeg(ub, b, L);
+	else
+		wwCopy(ub, b, L);
+	// c <- \pm ua ub
+	zzMul(prod, ua, L, ub, L, stack);
+	ASSERT(!ec2ZIsNeg(prod, L) && wwIsZero(prod + L, L));
+	if (ec2ZIsNeg(a, L) != ec2ZIsNeg(b, L))
+		zzNeg(c, prod, L);
+	else
+		wwCopy(c, prod, L);
+}
+
+static size_t ec2ZMul_deep(size_t L)
+{
+	return O_OF_W(4 * L) + zzMul_deep(L, L);
+}
+
+// [L]q <- round([L]a / [L]N) (N > 0)
+static void ec2ZRound(word q[], const word a[], const word N[], size_t L,
+	void* stack)
+{
+	size_t nN2;
+	// переменные в stack
+	word* t = (word*)stack;
+	word* N2 = t + L;
+	word* r = N2 + L;
+	stack = r + L;
+	// pre
+	ASSERT(!ec2ZIsNeg(N, L) && !wwIsZero(N, L));
+	// t <- 2|a| + N
+	if (ec2ZIsNeg(a, L))
+		zzNeg(t, a, L);
+	else
+		wwCopy(t, a, L);
+	wwShHi(t, L, 1);
+	zzAdd2(t, N, L);
+	ASSERT(!ec2ZIsNeg(t, L));
+	// N2 <- 2N
+	wwCopy(N2, N, L);
+	wwShHi(N2, L, 1);
+	nN2 = wwWordSize(N2, L);
+	// q <- \pm t \div N2
+	wwSetZero(q, L);
+	zzDiv(q, r, t, L, N2, nN2, stack);
+	if (ec2ZIsNeg(a, L))
+		zzNeg(q, q, L);
+}
+
+static size_t ec2ZRound_deep(size_t L)
+{
+	return O_OF_W(3 * L) + zzDiv_deep(L, L);
+}
+
+// [L]a <- [l]a (расширение знака)
+static void ec2ZExtend(word a[], size_t l, size_t L)
+{
+	ASSERT(0 < l && l < L);
+	wwRepW(a + l, L - l, ec2ZIsNeg(a, l) ? WORD_MAX : 0);
+}
+
+/*
+	[l]r0 + [l]r1 \tau <- [m]d \bmod (\tau^deg - 1)
+
+	Промежуточные вычисления ведутся над числами длины L. Коэффициенты 
+	\tau^deg - 1 и результат по модулю не превосходят 2^{deg / 2 + 2} 
+	и умещаются в l слов.
+*/
+static void ec2TauReduce(word r0[], word r1[], const word d[], size_t m,
+	const ec_o* ec, size_t L, size_t l, void* stack)
+{
+	const size_t deg = gf2Deg(ec->f);
+	const bool_t mu = qrIsUnity(ec->A, ec->f);
+	size_t i;
+	// переменные в stack
+	word* a0 = (word*)stack;
+	word* a1 = a0 + L;
+	word* c0 = a1 + L;
+	word* N = c0 + L;
+	word* q0 = N + L;
+	word* q1 = q0 + L;
+	word* t = q1 + L;
+	word* s = t + L;
+	stack = s + L;
+	// pre
+	ASSERT(L > m + 1 && L > l);
+	// (a0, a1) <- (U_{deg - 1}, U_deg)
+	wwSetZero(a0, l);
+	wwSetW(a1, l, 1);
+	for (i = 1; i < deg; ++i)
+	{
+		word* tmp;
+		// a0 <- \mu a1 - 2 a0
+		zzNeg(a0, a0, l);
+		wwShHi(a0, l, 1);
+		if (mu)
+			zzAdd2(a0, a1, l);
+		else
+			zzSub2(a0, a1, l);
+		// a0 <-> a1
+		tmp = a0, a0 = a1, a1 = tmp;
+	}
+	ec2ZExtend(a0, l, L);
+	ec2ZExtend(a1, l, L);
+	// a0 <- -2 a0 - 1 (\tau^deg - 1 = a0 + a1 \tau)
+	wwShHi(a0, L, 1);
+	zzAddW2(a0, L, 1);
+	zzNeg(a0, a0, L);
+	// c0 <- a0 + \mu a1 (сопряженный элемент: c0 - a1 \tau)
+	wwCopy(c0, a0, L);
+	if (mu)
+		zzAdd2(c0, a1, L);
+	else
+		zzSub2(c0, a1, L);
+	// N <- a0 c0 + 2 a1^2
+	ec2ZMul(N, a0, c0, L, stack);
+	ec2ZMul(t, a1, a1, L, stack);
+	wwShHi(t, L, 1);
+	zzAdd2(N, t, L);
+	// s <- d
+	wwCopy(s, d, m);
+	wwSetZero(s + m, L - m);
+	// q0 <- round(d c0 / N), q1 <- round(-d a1 / N)
+	ec2ZMul(t, s, c0, L, stack);
+	ec2ZRound(q0, t, N, L, stack);
+	ec2ZMul(t, s, a1, L, stack);
+	zzNeg(t, t, L);
+	ec2ZRound(q1, t, N, L, stack);
+	// s <- d - (q0 a0 - 2 q1 a1)
+	ec2ZMul(t, q0, a0, L, stack);
+	zzSub2(s, t, L);
+	ec2ZMul(t, q1, a1, L, stack);
+	wwShHi(t, L, 1);
+	zzAdd2(s, t, L);
+	wwCopy(r0, s, l);
+	// s <- -(q0 a1 + q1 c0)
+	ec2ZMul(t, q0, a1, L, stack);
+	ec2ZMul(s, q1, c0, L, stack);
+	zzAdd2(s, t, L);
+	zzNeg(s, s, L);
+	wwCopy(r1, s, l);
+}
+
+static size_t ec2TauReduce_deep(size_t L)
+{
+	return O_OF_W(8 * L) + 
+		utilMax(2,
+			ec2ZMul_deep(L),
+			ec2ZRound_deep(L));
+}
+
+/*
+	\tau-NAF (w = 2) малого элемента r0 + r1 \tau: символы dg[i] \in {0, \pm 1}
+*/
+static size_t ec2TNAFSmall(int dg[16], int r0, int r1, bool_t mu)
+{
+	size_t i;
+	int t;
+	for (i = 0; r0 || r1; ++i)
+	{
+		ASSERT(i < 16);
+		if (r0 % 2)
+		{
+			dg[i] = 2 - (int)((unsigned)(r0 - 2 * r1) & 3);
+			r0 -= dg[i];
+		}
+		else
+			dg[i] = 0;
+		// r0 + r1 \tau <- (r0 + r1 \tau) / \tau
+		t = r0 / 2;
+		r0 = mu ? r1 + t : r1 - t;
+		r1 = -t;
+	}
+	return i;
+}
+
+/*
+	Оконный \tau-NAF элемента [l]r0 + [l]r1 \tau. Символы записываются 
+	в naf так же, как в wwNAF(): отрицательный символ -u представляется 
+	числом u | 2^{w - 1}. Возвращается число символов. Буферы r0 и r1 
+	портятся.
+*/
+static size_t ec2TNAF(word naf[], word r0[], word r1[], size_t l, 
+	bool_t mu, size_t w, size_t naf_max)
+{
+	const word tw = _ec2_tnaf[mu][w - 4].tw;
+	const word naf_hi = WORD_1 << (w - 1);
+	const word mask = (WORD_1 << w) - 1;
+	register word u;
+	size_t i;
+	// цикл
+	wwSetZero(naf, W_OF_B(w * naf_max));
+	for (i = 0; !wwIsZero(r0, l) || !wwIsZero(r1, l); ++i)
+	{
+		word* t;
+		ASSERT(i < naf_max);
+		if (r0[0] & 1)
+		{
+			// u <- (r0 + r1 t_w) mods 2^w
+			u = (r0[0] + r1[0] * tw) & mask;
+			// r <- r + \alpha_{-u}
+			if (u & naf_hi)
+			{
+				u = (WORD_0 - u) & mask;
+				ec2ZAddI(r0, l, _ec2_tnaf[mu][w - 4].alpha[u >> 1][0]);
+				ec2ZAddI(r1, l, _ec2_tnaf[mu][w - 4].alpha[u >> 1][1]);
+				wwSetBits(naf, i * w, w, u | naf_hi);
+			}
+			// r <- r - \alpha_u
+			else
+			{
+				ec2ZAddI(r0, l, -_ec2_tnaf[mu][w - 4].alpha[u >> 1][0]);
+				ec2ZAddI(r1, l, -_ec2_tnaf[mu][w - 4].alpha[u >> 1][1]);
+				wwSetBits(naf, i * w, w, u);
+			}
+		}
+		// (r0, r1) <- (r1 + \mu r0 / 2, -r0 / 2)
+		ec2ZHalve(r0, l);
+		if (mu)
+			zzAdd2(r1, r0, l);
+		else
+			zzSub2(r1, r0, l);
+		zzNeg(r0, r0, l);
+		t = r0, r0 = r1, r1 = t;
+	}
+	u = 0;
+	return i;
+}
+
+bool_t ec2MulAKoblitz(word b[], const word a[], const ec_o* ec, 
+	const word d[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t L = m + n + 2;
+	const size_t l = n / 2 + 2;
+	const size_t naf_width = ec2TNAFWidth(gf2Deg(ec->f));
+	const size_t naf_count = SIZE_1 << (naf_width - 2);
+	const size_t naf_max = B_OF_W(n) + 16;
+	const word naf_hi = WORD_1 << (naf_width - 1);
+	const bool_t mu = qrIsUnity(ec->A, ec->f);
+	int dg[16];
+	size_t naf_size;
+	size_t i, j;
+	register word w;
+	// переменные в stack
+	word* r0;			/* \rho = r0 + r1 \tau */
+	word* r1;
+	word* naf;			/* \tau-NAF */
+	word* t;			/* вспомогательная точка */
+	word* pre;			/* pre[i] = \alpha_{2i + 3} a (naf_count - 1 элементов) */
+	word* preA;			/* preA[i] = \alpha_{2i + 1} a */
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ec2IsKoblitz(ec));
+	ASSERT(ec2SeemsOnA(a, ec));
+	// раскладка stack
+	r0 = (word*)stack;
+	r1 = r0 + l;
+	naf = r1 + l;
+	t = naf + W_OF_B(naf_width * naf_max);
+	pre = t + 3 * n;
+	preA = pre + (naf_count - 1) * 3 * n;
+	stack = preA + naf_count * 2 * n;
+	// \rho <- d \bmod (\tau^m - 1)
+	ec2TauReduce(r0, r1, d, m, ec, L, l, stack);
+	// расчет \tau-NAF
+	naf_size = ec2TNAF(naf, r0, r1, l, mu, naf_width, naf_max);
+	// \rho == 0 => b <- O
+	if (naf_size == 0)
+		return FALSE;
+	// pre[i - 1] <- \alpha_{2i + 1} a: схема Горнера по \tau-NAF(\alpha)
+	for (i = 1; i < naf_count; ++i)
+	{
+		word* p = pre + (i - 1) * 3 * n;
+		j = ec2TNAFSmall(dg, _ec2_tnaf[mu][naf_width - 4].alpha[i][0],
+			_ec2_tnaf[mu][naf_width - 4].alpha[i][1], mu);
+		wwSetZero(p, 3 * n);
+		while (j--)
+		{
+			ec2FrobLD(p, p, ec, stack);
+			if (dg[j] > 0)
+				ecAddA(p, p, a, ec, stack);
+			else if (dg[j] < 0)
+				ecSubA(p, p, a, ec, stack);
+		}
+	}
+	// preA[i] <- pre[i - 1] (preA[0] = a)
+	wwCopy(preA, a, 2 * n);
+	if (!ecToABatch(preA + 2 * n, pre, naf_count - 1, ec, stack))
+		// малый порядок a
+		return FAST(ecMulA)(b, a, ec, d, m, stack);
+	// t <- \pm preA[naf[naf_size - 1]]
+	i = naf_size - 1;
+	w = wwGetBits(naf, i * naf_width, naf_width);
+	ASSERT(w & 1);
+	ecFromA(t, preA + ((w & ~naf_hi) >> 1) * 2 * n, ec, stack);
+	if (w & naf_hi)
+		ecNeg(t, t, ec, stack);
+	// цикл по символам \tau-NAF
+	while (i--)
+	{
+		// t <- \tau(t)
+		ec2FrobLD(t, t, ec, stack);
+		// t <- t \pm preA[naf[i]]
+		w = wwGetBits(naf, i * naf_width, naf_width);
+		if (w & naf_hi)
+			ecSubA(t, t, preA + ((w ^ naf_hi) >> 1) * 2 * n, ec, stack);
+		else if (w)
+			ecAddA(t, t, preA + (w >> 1) * 2 * n, ec, stack);
+	}
+	// очистка
+	w = 0;
+	// к аффинным координатам
+	return ecToA(b, t, ec, stack);
+}
+
+size_t ec2MulAKoblitz_deep(size_t n, size_t f_deep, size_t ec_deep,
+	size_t m)
+{
+	const size_t L = m + n + 2;
+	const size_t naf_width = ec2TNAFWidth(B_OF_W(n));
+	const size_t naf_count = SIZE_1 << (naf_width - 2);
+	const size_t naf_max = B_OF_W(n) + 16;
+	const size_t l = n / 2 + 2;
+	return O_OF_W(2 * l) + 
+		O_OF_W(W_OF_B(6 * naf_max)) + 
+		O_OF_W(3 * n) + 
+		O_OF_W(5 * n * naf_count) + 
+		utilMax(4,
+			ec2TauReduce_deep(L),
+			ec_deep,
+			ecToABatch_deep(n, ec_deep, naf_count - 1),
+			ecMulA_deep(n, 3, ec_deep, m));
+}
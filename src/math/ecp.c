@@ -4,7 +4,7 @@
 \brief Elliptic curves over prime fields
 \project bee2 [cryptographic library]
 \created 2012.06.26
-\version 2021.06.30
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,11 +13,15 @@
 #include "bee2/core/mem.h"
 #include "bee2/core/stack.h"
 #include "bee2/core/util.h"
+#include "bee2/core/word.h"
 #include "bee2/math/ecp.h"
 #include "bee2/math/gfp.h"
 #include "bee2/math/pri.h"
 #include "bee2/math/ww.h"
 #include "bee2/math/zz.h"
+#include "math/ww_lcl.h"
+#include "math/zm_lcl.h"
+#include "math/zz/zz_lcl.h"
 
 /*
 *******************************************************************************
@@ -180,6 +184,45 @@ static size_t ecpToAJ_deep(size_t n, size_t f_deep)
 	return O_OF_W(2 * n) + f_deep;
 }
 
+// [count * 3n]a -> [count * 2n]b
+static bool_t ecpToAJBatch(word b[], const word a[], size_t count, 
+	const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	bool_t ret = TRUE;
+	size_t i;
+	// переменные в stack
+	word* z = (word*)stack;
+	word* t = z + count * n;
+	stack = t + n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(wwIsDisjoint2(a, count * 3 * n, b, count * 2 * n));
+	// z[i] <- za[i] (или 1, если a[i] == O)
+	for (i = 0; i < count; ++i)
+	{
+		ASSERT(ecpSeemsOn3(a + 3 * n * i, ec));
+		if (qrIsZero(ecZ(a + 3 * n * i, n), ec->f))
+			qrCopy(z + n * i, ec->f->unity, ec->f), ret = FALSE;
+		else
+			qrCopy(z + n * i, ecZ(a + 3 * n * i, n), ec->f);
+	}
+	// z[i] <- z[i]^{-1}
+	qrInvBatch(z, z, count, ec->f, t);
+	for (i = 0; i < count; ++i)
+	{
+		// t <- z[i]^2
+		qrSqr(t, z + n * i, ec->f, stack);
+		// xb <- xa t
+		qrMul(ecX(b + 2 * n * i), ecX(a + 3 * n * i), t, ec->f, stack);
+		// t <- z[i] t
+		qrMul(t, z + n * i, t, ec->f, stack);
+		// yb <- ya t
+		qrMul(ecY(b + 2 * n * i, n), ecY(a + 3 * n * i, n), t, ec->f, stack);
+	}
+	return ret;
+}
+
 // [3n]b <- -[3n]a (P <- -P)
 static void ecpNegJ(word b[], const word a[], const ec_o* ec, void* stack)
 {
@@ -602,7 +645,7 @@ void ecpSubJ(word c[], const word a[], const word b[], const ec_o* ec,
 	zmNeg(ecY(t, n), ecY(b, n), ec->f);
 	qrCopy(ecZ(t, n), ecZ(b, n), ec->f);
 	// c <- a + t
-	ecpAddJ(c, a, t, ec, stack);
+	ec->add(c, a, t, ec, stack);
 }
 
 size_t ecpSubJ_deep(size_t n, size_t f_deep)
@@ -628,7 +671,7 @@ static void ecpSubAJ(word c[], const word a[], const word b[], const ec_o* ec,
 	qrCopy(ecX(t), ecX(b), ec->f);
 	zmNeg(ecY(t, n), ecY(b, n), ec->f);
 	// c <- a + t
-	ecpAddAJ(c, a, t, ec, stack);
+	ec->adda(c, a, t, ec, stack);
 }
 
 static size_t ecpSubAJ_deep(size_t n, size_t f_deep)
@@ -801,6 +844,307 @@ size_t ecpTplJA3_deep(size_t n, size_t f_deep)
 	return O_OF_W(7 * n) + f_deep;
 }
 
+/*
+*******************************************************************************
+Якобиановы координаты: ядра фиксированной длины
+
+Если умножение в базовом поле построено на ядре фиксированной длины
+(см. zmFixKind()), то функции ecpDblJ(), ecpDblJA3(), ecpAddJ(), ecpAddAJ()
+заменяются специализированными редакциями. В редакциях умножение
+и возведение в квадрат выполняются прямыми обращениями к ядрам zzMulN(),
+zzSqrN() и к функциям редукции, а не через указатели f->mul и f->sqr,
+длина элементов поля является константой. Это снимает косвенные вызовы
+и позволяет компилятору встраивать умножения и распределять регистры
+в пределах всей операции над точками. Копирование и проверки элементов
+поля выполняются встраиваемыми примитивами фиксированной длины
+(см. ww_lcl.h).
+
+Редакции генерируются макросом ecpFixJ() и повторяют общие функции
+(комментарии к шагам см. в общих функциях). Потребности в стеке не
+превосходят потребностей общих функций. Для других полей (в том числе
+нестандартных кривых) сохраняются общие функции.
+
+Для модулей bign (см. ZM_FIX_BIGN) сложение и вычитание в поле также
+выполняются ядрами фиксированной длины zzAddModBignL(), zzSubModBignL()
+со встроенными модулями (L = 128, 192, 256).
+
+Функции ecpSubJ() и ecpSubAJ() вызывают сложение через указатели ec->add
+и ec->adda и поэтому также используют специализированные редакции.
+*******************************************************************************
+*/
+
+#define ecpFixJ(tag, len, red, ops)\
+static void ecpMul##tag(word c[], const word a[], const word b[],\
+	const qr_o* f, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	zzMul##len(prod, a, b);\
+	red;\
+	wwCopyFix(c, prod, len);\
+}\
+\
+static void ecpSqr##tag(word b[], const word a[], const qr_o* f,\
+	void* stack)\
+{\
+	word* prod = (word*)stack;\
+	zzSqr##len(prod, a);\
+	red;\
+	wwCopyFix(b, prod, len);\
+}\
+\
+static void ecpDblJ##tag(word b[], const word a[], const ec_o* ec,\
+	void* stack)\
+{\
+	const size_t n = len;\
+	word* t1 = (word*)stack;\
+	word* t2 = t1 + n;\
+	stack = t2 + n;\
+	ASSERT(ecIsOperable(ec) && ec->d == 3 && ec->f->n == len);\
+	ASSERT(ecpSeemsOn3(a, ec));\
+	ASSERT(wwIsSameOrDisjoint(a, b, 3 * n));\
+	if (wwIsZeroFix(ecZ(a, n), n) || wwIsZeroFix(ecY(a, n), n))\
+	{\
+		qrSetZero(ecZ(b, n), ec->f);\
+		return;\
+	}\
+	ecpSqr##tag(t1, ecZ(a, n), ec->f, stack);\
+	ecpMul##tag(ecZ(b, n), ecY(a, n), ecZ(a, n), ec->f, stack);\
+	ecpDouble##ops(ecZ(b, n), ecZ(b, n), ec->f);\
+	ecpSqr##tag(t1, t1, ec->f, stack);\
+	ecpMul##tag(t1, ec->A, t1, ec->f, stack);\
+	ecpSqr##tag(t2, ecX(a), ec->f, stack);\
+	ecpAdd##ops(t1, t1, t2, ec->f);\
+	ecpDouble##ops(t2, t2, ec->f);\
+	ecpAdd##ops(t1, t1, t2, ec->f);\
+	ecpDouble##ops(ecY(b, n), ecY(a, n), ec->f);\
+	ecpSqr##tag(ecY(b, n), ecY(b, n), ec->f, stack);\
+	ecpSqr##tag(t2, ecY(b, n), ec->f, stack);\
+	gfpHalf(t2, t2, ec->f);\
+	ecpMul##tag(ecY(b, n), ecY(b, n), ecX(a), ec->f, stack);\
+	ecpSqr##tag(ecX(b), t1, ec->f, stack);\
+	ecpSub##ops(ecX(b), ecX(b), ecY(b, n), ec->f);\
+	ecpSub##ops(ecX(b), ecX(b), ecY(b, n), ec->f);\
+	ecpSub##ops(ecY(b, n), ecY(b, n), ecX(b), ec->f);\
+	ecpMul##tag(ecY(b, n), ecY(b, n), t1, ec->f, stack);\
+	ecpSub##ops(ecY(b, n), ecY(b, n), t2, ec->f);\
+}\
+\
+static void ecpDblJA3##tag(word b[], const word a[], const ec_o* ec,\
+	void* stack)\
+{\
+	const size_t n = len;\
+	word* t1 = (word*)stack;\
+	word* t2 = t1 + n;\
+	stack = t2 + n;\
+	ASSERT(ecIsOperable(ec) && ec->d == 3 && ec->f->n == len);\
+	ASSERT(ecpSeemsOn3(a, ec));\
+	ASSERT(wwIsSameOrDisjoint(a, b, 3 * n));\
+	if (wwIsZeroFix(ecZ(a, n), n) || wwIsZeroFix(ecY(a, n), n))\
+	{\
+		qrSetZero(ecZ(b, n), ec->f);\
+		return;\
+	}\
+	ecpSqr##tag(t1, ecZ(a, n), ec->f, stack);\
+	ecpMul##tag(ecZ(b, n), ecY(a, n), ecZ(a, n), ec->f, stack);\
+	ecpDouble##ops(ecZ(b, n), ecZ(b, n), ec->f);\
+	ecpSub##ops(t2, ecX(a), t1, ec->f);\
+	ecpAdd##ops(t1, ecX(a), t1, ec->f);\
+	ecpMul##tag(t2, t1, t2, ec->f, stack);\
+	ecpDouble##ops(t1, t2, ec->f);\
+	ecpAdd##ops(t1, t1, t2, ec->f);\
+	ecpDouble##ops(ecY(b, n), ecY(a, n), ec->f);\
+	ecpSqr##tag(ecY(b, n), ecY(b, n), ec->f, stack);\
+	ecpSqr##tag(t2, ecY(b, n), ec->f, stack);\
+	gfpHalf(t2, t2, ec->f);\
+	ecpMul##tag(ecY(b, n), ecY(b, n), ecX(a), ec->f, stack);\
+	ecpSqr##tag(ecX(b), t1, ec->f, stack);\
+	ecpSub##ops(ecX(b), ecX(b), ecY(b, n), ec->f);\
+	ecpSub##ops(ecX(b), ecX(b), ecY(b, n), ec->f);\
+	ecpSub##ops(ecY(b, n), ecY(b, n), ecX(b), ec->f);\
+	ecpMul##tag(ecY(b, n), ecY(b, n), t1, ec->f, stack);\
+	ecpSub##ops(ecY(b, n), ecY(b, n), t2, ec->f);\
+}\
+\
+static void ecpAddJ##tag(word c[], const word a[], const word b[],\
+	const ec_o* ec, void* stack)\
+{\
+	const size_t n = len;\
+	word* t1 = (word*)stack;\
+	word* t2 = t1 + n;\
+	word* t3 = t2 + n;\
+	word* t4 = t3 + n;\
+	stack = t4 + n;\
+	ASSERT(ecIsOperable(ec) && ec->d == 3 && ec->f->n == len);\
+	ASSERT(ecpSeemsOn3(a, ec));\
+	ASSERT(ecpSeemsOn3(b, ec));\
+	ASSERT(wwIsSameOrDisjoint(a, c, 3 * n));\
+	ASSERT(wwIsSameOrDisjoint(b, c, 3 * n));\
+	if (wwIsZeroFix(ecZ(a, n), n))\
+	{\
+		wwCopyFix(c, b, 3 * n);\
+		return;\
+	}\
+	if (wwIsZeroFix(ecZ(b, n), n))\
+	{\
+		wwCopyFix(c, a, 3 * n);\
+		return;\
+	}\
+	ecpSqr##tag(t1, ecZ(a, n), ec->f, stack);\
+	ecpSqr##tag(t2, ecZ(b, n), ec->f, stack);\
+	ecpMul##tag(t3, ecZ(b, n), t2, ec->f, stack);\
+	ecpMul##tag(t3, ecY(a, n), t3, ec->f, stack);\
+	ecpMul##tag(t4, ecZ(a, n), t1, ec->f, stack);\
+	ecpMul##tag(t4, ecY(b, n), t4, ec->f, stack);\
+	ecpAdd##ops(ecZ(c, n), ecZ(a, n), ecZ(b, n), ec->f);\
+	ecpSqr##tag(ecZ(c, n), ecZ(c, n), ec->f, stack);\
+	ecpSub##ops(ecZ(c, n), ecZ(c, n), t1, ec->f);\
+	ecpSub##ops(ecZ(c, n), ecZ(c, n), t2, ec->f);\
+	ecpMul##tag(t1, ecX(b), t1, ec->f, stack);\
+	ecpMul##tag(t2, ecX(a), t2, ec->f, stack);\
+	ecpSub##ops(t1, t1, t2, ec->f);\
+	if (wwIsZeroFix(t1, n))\
+	{\
+		if (wwEqFix(t3, t4, n))\
+			ecpDblJ(c, c == a ? b : a, ec, stack);\
+		else\
+			qrSetZero(ecZ(c, n), ec->f);\
+		return;\
+	}\
+	ecpMul##tag(ecZ(c, n), ecZ(c, n), t1, ec->f, stack);\
+	ecpSub##ops(t4, t4, t3, ec->f);\
+	ecpDouble##ops(t4, t4, ec->f);\
+	ecpDouble##ops(ecY(c, n), t1, ec->f);\
+	ecpSqr##tag(ecY(c, n), ecY(c, n), ec->f, stack);\
+	ecpMul##tag(t1, t1, ecY(c, n), ec->f, stack);\
+	ecpMul##tag(ecY(c, n), t2, ecY(c, n), ec->f, stack);\
+	ecpDouble##ops(t2, ecY(c, n), ec->f);\
+	ecpSqr##tag(ecX(c), t4, ec->f, stack);\
+	ecpSub##ops(ecX(c), ecX(c), t1, ec->f);\
+	ecpSub##ops(ecX(c), ecX(c), t2, ec->f);\
+	ecpSub##ops(ecY(c, n), ecY(c, n), ecX(c), ec->f);\
+	ecpMul##tag(ecY(c, n), t4, ecY(c, n), ec->f, stack);\
+	ecpDouble##ops(t3, t3, ec->f);\
+	ecpMul##tag(t3, t3, t1, ec->f, stack);\
+	ecpSub##ops(ecY(c, n), ecY(c, n), t3, ec->f);\
+}\
+\
+static void ecpAddAJ##tag(word c[], const word a[], const word b[],\
+	const ec_o* ec, void* stack)\
+{\
+	const size_t n = len;\
+	word* t1 = (word*)stack;\
+	word* t2 = t1 + n;\
+	word* t3 = t2 + n;\
+	word* t4 = t3 + n;\
+	stack = t4 + n;\
+	ASSERT(ecIsOperable(ec) && ec->d == 3 && ec->f->n == len);\
+	ASSERT(ecpSeemsOn3(a, ec));\
+	ASSERT(ecpSeemsOnA(b, ec));\
+	ASSERT(wwIsSameOrDisjoint(a,  c, 3 * n));\
+	ASSERT(b == c || wwIsDisjoint2(b, 2 * n, c, 3 * n));\
+	if (wwIsZeroFix(ecZ(a, n), n))\
+	{\
+		wwCopyFix(ecX(c), ecX(b), n);\
+		wwCopyFix(ecY(c, n), ecY(b, n), n);\
+		qrSetUnity(ecZ(c, n), ec->f);\
+		return;\
+	}\
+	ecpSqr##tag(t1, ecZ(a, n), ec->f, stack);\
+	ecpMul##tag(t2, t1, ecZ(a, n), ec->f, stack);\
+	ecpMul##tag(t1, t1, ecX(b), ec->f, stack);\
+	ecpMul##tag(t2, t2, ecY(b, n), ec->f, stack);\
+	ecpSub##ops(t1, t1, ecX(a), ec->f);\
+	ecpSub##ops(t2, t2, ecY(a, n), ec->f);\
+	if (wwIsZeroFix(t1, n))\
+	{\
+		if (wwIsZeroFix(t2, n))\
+			ecpDblAJ(c, b, ec, stack);\
+		else\
+			qrSetZero(ecZ(c, n), ec->f);\
+		return;\
+	}\
+	ecpMul##tag(ecZ(c, n), t1, ecZ(a, n), ec->f, stack);\
+	ecpSqr##tag(t3, t1, ec->f, stack);\
+	ecpMul##tag(t4, t1, t3, ec->f, stack);\
+	ecpMul##tag(t3, t3, ecX(a), ec->f, stack);\
+	ecpDouble##ops(t1, t3, ec->f);\
+	ecpSqr##tag(ecX(c), t2, ec->f, stack);\
+	ecpSub##ops(ecX(c), ecX(c), t1, ec->f);\
+	ecpSub##ops(ecX(c), ecX(c), t4, ec->f);\
+	ecpSub##ops(t3, t3, ecX(c), ec->f);\
+	ecpMul##tag(t3, t3, t2, ec->f, stack);\
+	ecpMul##tag(t4, t4, ecY(a, n), ec->f, stack);\
+	ecpSub##ops(ecY(c, n), t3, t4, ec->f);\
+}
+
+#define ecpAddZm(c, a, b, f) zmAdd(c, a, b, f)
+#define ecpSubZm(c, a, b, f) zmSub(c, a, b, f)
+#define ecpDoubleZm(b, a, f) gfpDouble(b, a, f)
+
+ecpFixJ(Crand4, 4, zzRedCrand4(prod, f->mod), Zm)
+ecpFixJ(Crand6, 6, zzRedCrand6(prod, f->mod), Zm)
+ecpFixJ(Crand8, 8, zzRedCrand8(prod, f->mod), Zm)
+ecpFixJ(Mont4, 4, zzRedMont4(prod, f->mod, *(word*)f->params), Zm)
+ecpFixJ(Mont6, 6, zzRedMont6(prod, f->mod, *(word*)f->params), Zm)
+ecpFixJ(Mont8, 8, zzRedMont8(prod, f->mod, *(word*)f->params), Zm)
+
+#if (B_PER_W == 64)
+
+#define ecpAddBign128(c, a, b, f) zzAddModBign128(c, a, b)
+#define ecpSubBign128(c, a, b, f) zzSubModBign128(c, a, b)
+#define ecpDoubleBign128(b, a, f) zzAddModBign128(b, a, a)
+#define ecpAddBign192(c, a, b, f) zzAddModBign192(c, a, b)
+#define ecpSubBign192(c, a, b, f) zzSubModBign192(c, a, b)
+#define ecpDoubleBign192(b, a, f) zzAddModBign192(b, a, a)
+#define ecpAddBign256(c, a, b, f) zzAddModBign256(c, a, b)
+#define ecpSubBign256(c, a, b, f) zzSubModBign256(c, a, b)
+#define ecpDoubleBign256(b, a, f) zzAddModBign256(b, a, a)
+
+ecpFixJ(Bign128, 4, zzRedBign128(prod), Bign128)
+ecpFixJ(Bign192, 6, zzRedBign192(prod), Bign192)
+ecpFixJ(Bign256, 8, zzRedBign256(prod), Bign256)
+
+#endif
+
+#define ecpSetFixJ(ec, bA3, tag)\
+	(ec)->add = ecpAddJ##tag,\
+	(ec)->adda = ecpAddAJ##tag,\
+	(ec)->dbl = (bA3) ? ecpDblJA3##tag : ecpDblJ##tag
+
+static void ecpCreateJFix(ec_o* ec, bool_t bA3)
+{
+	const size_t n = ec->f->n;
+	switch (zmFixKind(ec->f))
+	{
+	case ZM_FIX_CRAND:
+		if (n == 4)
+			ecpSetFixJ(ec, bA3, Crand4);
+		else if (n == 6)
+			ecpSetFixJ(ec, bA3, Crand6);
+		else if (n == 8)
+			ecpSetFixJ(ec, bA3, Crand8);
+		break;
+	case ZM_FIX_MONT:
+		if (n == 4)
+			ecpSetFixJ(ec, bA3, Mont4);
+		else if (n == 6)
+			ecpSetFixJ(ec, bA3, Mont6);
+		else if (n == 8)
+			ecpSetFixJ(ec, bA3, Mont8);
+		break;
+#if (B_PER_W == 64)
+	case ZM_FIX_BIGN:
+		if (n == 4)
+			ecpSetFixJ(ec, bA3, Bign128);
+		else if (n == 6)
+			ecpSetFixJ(ec, bA3, Bign192);
+		else if (n == 8)
+			ecpSetFixJ(ec, bA3, Bign256);
+		break;
+#endif
+	}
+}
+
 bool_t ecpCreateJ(ec_o* ec, const qr_o* f, const octet A[], const octet B[], 
 	void* stack)
 {
@@ -835,6 +1179,8 @@ bool_t ecpCreateJ(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 	// подготовить буферы для описания группы точек
 	ec->base = ec->B + f->n;
 	ec->order = ec->base + 2 * f->n;
+	// за order: [f->n + 3] параметр Барретта (см. ecCreateGroupBarr())
+	ec->params = 0;
 	// настроить интерфейсы
 	ec->froma = ecpFromAJ;
 	ec->toa = ecpToAJ;
@@ -846,6 +1192,8 @@ bool_t ecpCreateJ(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 	ec->dbl = bA3 ? ecpDblJA3 : ecpDblJ;
 	ec->dbla = ecpDblAJ;
 	ec->tpl = bA3 ? ecpTplJA3 : ecpTplJ;
+	ec->toab = ecpToAJBatch;
+	ecpCreateJFix(ec, bA3);
 	ec->deep = utilMax(8,
 		ecpToAJ_deep(f->n, f->deep),
 		ecpAddJ_deep(f->n, f->deep),
@@ -856,7 +1204,7 @@ bool_t ecpCreateJ(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 		ecpDblAJ_deep(f->n, f->deep),
 		bA3 ? ecpTplJA3_deep(f->n, f->deep) : ecpTplJ_deep(f->n, f->deep));
 	// настроить
-	ec->hdr.keep = sizeof(ec_o) + O_OF_W(5 * f->n + 1);
+	ec->hdr.keep = sizeof(ec_o) + O_OF_W(6 * f->n + 4);
 	ec->hdr.p_count = 6;
 	ec->hdr.o_count = 1;
 	// все нормально
@@ -866,7 +1214,7 @@ bool_t ecpCreateJ(ec_o* ec, const qr_o* f, const octet A[], const octet B[],
 
 size_t ecpCreateJ_keep(size_t n)
 {
-	return sizeof(ec_o) + O_OF_W(5 * n + 1);
+	return sizeof(ec_o) + O_OF_W(6 * n + 4);
 }
 
 size_t ecpCreateJ_deep(size_t n, size_t f_deep)
@@ -885,6 +1233,519 @@ size_t ecpCreateJ_deep(size_t n, size_t f_deep)
 		ecpTplJA3_deep(n, f_deep));
 }
 
+/*
+*******************************************************************************
+Однородные проективные координаты:
+	x = X / Z, y = Y / Z,
+	-(X : Y : Z) = (X : -Y : Z),
+	O = (0 : 1 : 0).
+
+Реализованы полные (исключение-свободные) формулы для случая A = -3
+[Renes J., Costello C., Batina L. Complete addition formulas for prime 
+order elliptic curves. EUROCRYPT 2016]. Формулы корректны для любых 
+входных точек, включая O, равные и противоположные точки. Поэтому в
+функциях нет ветвлений, зависящих от точек.
+
+В функции ecpAddP() выполняется сложение P <- P + P (алгоритм 4).
+Сложность:
+	12M + 2*B + 29add \approx 14M.
+
+В функции ecpAddAP() выполняется сложение P <- P + A (алгоритм 5).
+Сложность:
+	11M + 2*B + 23add \approx 13M.
+
+В функции ecpDblP() выполняется удвоение P <- 2P (алгоритм 6).
+Сложность:
+	8M + 3S + 2*B + 21add \approx 13M.
+
+Полные формулы дороже, чем формулы в якобиановых координатах 
+(ср. 16M, 11M и 8M для ecpAddJ(), ecpAddAJ(), ecpDblJA3()), но их 
+вычисление не зависит от входных точек. Это упрощает регулярные 
+и пакетные (в том числе векторные) вычисления.
+
+Умножение на B выполняется как обычное умножение \mod p.
+*******************************************************************************
+*/
+
+// [3n]b <- [2n]a (P <- A)
+static bool_t ecpFromAP(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOnA(a, ec));
+	ASSERT(a == b || wwIsDisjoint2(a, 2 * n, b, 3 * n));
+	// xb <- xa, yb <- ya, zb <- unity
+	qrCopy(ecX(b), ecX(a), ec->f);
+	qrCopy(ecY(b, n), ecY(a, n), ec->f);
+	qrSetUnity(ecZ(b, n), ec->f);
+	return TRUE;
+}
+
+// [2n]b <- [3n]a (A <- P)
+static bool_t ecpToAP(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t = (word*)stack;
+	stack = t + n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(a == b || wwIsDisjoint2(a, 3 * n, b, 2 * n));
+	// a == O => b <- O
+	if (qrIsZero(ecZ(a, n), ec->f))
+		return FALSE;
+	// t <- za^{-1}
+	qrInv(t, ecZ(a, n), ec->f, stack);
+	// xb <- xa t
+	qrMul(ecX(b), ecX(a), t, ec->f, stack);
+	// yb <- ya t
+	qrMul(ecY(b, n), ecY(a, n), t, ec->f, stack);
+	// b != O
+	return TRUE;
+}
+
+static size_t ecpToAP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(n) + f_deep;
+}
+
+// [count * 3n]a -> [count * 2n]b
+static bool_t ecpToAPBatch(word b[], const word a[], size_t count, 
+	const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	bool_t ret = TRUE;
+	size_t i;
+	// переменные в stack
+	word* z = (word*)stack;
+	stack = z + count * n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(wwIsDisjoint2(a, count * 3 * n, b, count * 2 * n));
+	// z[i] <- za[i] (или 1, если a[i] == O)
+	for (i = 0; i < count; ++i)
+	{
+		ASSERT(ecpSeemsOn3(a + 3 * n * i, ec));
+		if (qrIsZero(ecZ(a + 3 * n * i, n), ec->f))
+			qrCopy(z + n * i, ec->f->unity, ec->f), ret = FALSE;
+		else
+			qrCopy(z + n * i, ecZ(a + 3 * n * i, n), ec->f);
+	}
+	// z[i] <- z[i]^{-1}
+	qrInvBatch(z, z, count, ec->f, stack);
+	// xb <- xa z[i], yb <- ya z[i]
+	for (i = 0; i < count; ++i)
+	{
+		qrMul(ecX(b + 2 * n * i), ecX(a + 3 * n * i), z + n * i, ec->f, 
+			stack);
+		qrMul(ecY(b + 2 * n * i, n), ecY(a + 3 * n * i, n), z + n * i, 
+			ec->f, stack);
+	}
+	return ret;
+}
+
+// [3n]b <- -[3n]a (P <- -P)
+static void ecpNegP(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(wwIsSameOrDisjoint(a, b, 3 * n));
+	// xb <- xa, yb <- -ya, zb <- za
+	qrCopy(ecX(b), ecX(a), ec->f);
+	zmNeg(ecY(b, n), ecY(a, n), ec->f);
+	qrCopy(ecZ(b, n), ecZ(a, n), ec->f);
+}
+
+// [3n]c <- [3n]a + [3n]b (P <- P + P)
+static void ecpAddP(word c[], const word a[], const word b[], const ec_o* ec,
+	void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t0 = (word*)stack;
+	word* t1 = t0 + n;
+	word* t2 = t1 + n;
+	word* t3 = t2 + n;
+	word* t4 = t3 + n;
+	word* x3 = t4 + n;
+	word* y3 = x3 + n;
+	word* z3 = y3 + n;
+	stack = z3 + n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(ecpSeemsOn3(b, ec));
+	ASSERT(wwIsSameOrDisjoint(a, c, 3 * n));
+	ASSERT(wwIsSameOrDisjoint(b, c, 3 * n));
+	// t0 <- xa xb, t1 <- ya yb, t2 <- za zb
+	qrMul(t0, ecX(a), ecX(b), ec->f, stack);
+	qrMul(t1, ecY(a, n), ecY(b, n), ec->f, stack);
+	qrMul(t2, ecZ(a, n), ecZ(b, n), ec->f, stack);
+	// t3 <- (xa + ya)(xb + yb) - t0 - t1
+	zmAdd(t3, ecX(a), ecY(a, n), ec->f);
+	zmAdd(t4, ecX(b), ecY(b, n), ec->f);
+	qrMul(t3, t3, t4, ec->f, stack);
+	zmAdd(t4, t0, t1, ec->f);
+	zmSub(t3, t3, t4, ec->f);
+	// t4 <- (ya + za)(yb + zb) - t1 - t2
+	zmAdd(t4, ecY(a, n), ecZ(a, n), ec->f);
+	zmAdd(x3, ecY(b, n), ecZ(b, n), ec->f);
+	qrMul(t4, t4, x3, ec->f, stack);
+	zmAdd(x3, t1, t2, ec->f);
+	zmSub(t4, t4, x3, ec->f);
+	// y3 <- (xa + za)(xb + zb) - t0 - t2
+	zmAdd(x3, ecX(a), ecZ(a, n), ec->f);
+	zmAdd(y3, ecX(b), ecZ(b, n), ec->f);
+	qrMul(x3, x3, y3, ec->f, stack);
+	zmAdd(y3, t0, t2, ec->f);
+	zmSub(y3, x3, y3, ec->f);
+	// x3 <- 3(y3 - B t2)
+	qrMul(z3, ec->B, t2, ec->f, stack);
+	zmSub(x3, y3, z3, ec->f);
+	gfpDouble(z3, x3, ec->f);
+	zmAdd(x3, x3, z3, ec->f);
+	// z3 <- t1 - x3, x3 <- t1 + x3
+	zmSub(z3, t1, x3, ec->f);
+	zmAdd(x3, t1, x3, ec->f);
+	// y3 <- 3(B y3 - 3 t2 - t0)
+	qrMul(y3, ec->B, y3, ec->f, stack);
+	gfpDouble(t1, t2, ec->f);
+	zmAdd(t2, t1, t2, ec->f);
+	zmSub(y3, y3, t2, ec->f);
+	zmSub(y3, y3, t0, ec->f);
+	gfpDouble(t1, y3, ec->f);
+	zmAdd(y3, t1, y3, ec->f);
+	// t0 <- 3 t0 - t2
+	gfpDouble(t1, t0, ec->f);
+	zmAdd(t0, t1, t0, ec->f);
+	zmSub(t0, t0, t2, ec->f);
+	// t1 <- t4 y3, t2 <- t0 y3
+	qrMul(t1, t4, y3, ec->f, stack);
+	qrMul(t2, t0, y3, ec->f, stack);
+	// yc <- x3 z3 + t2
+	qrMul(y3, x3, z3, ec->f, stack);
+	zmAdd(ecY(c, n), y3, t2, ec->f);
+	// xc <- t3 x3 - t1
+	qrMul(x3, t3, x3, ec->f, stack);
+	zmSub(ecX(c), x3, t1, ec->f);
+	// zc <- t4 z3 + t3 t0
+	qrMul(z3, t4, z3, ec->f, stack);
+	qrMul(t1, t3, t0, ec->f, stack);
+	zmAdd(ecZ(c, n), z3, t1, ec->f);
+}
+
+static size_t ecpAddP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(8 * n) + f_deep;
+}
+
+// [3n]c <- [3n]a + [2n]b (P <- P + A)
+static void ecpAddAP(word c[], const word a[], const word b[], 
+	const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t0 = (word*)stack;
+	word* t1 = t0 + n;
+	word* t2 = t1 + n;
+	word* t3 = t2 + n;
+	word* t4 = t3 + n;
+	word* x3 = t4 + n;
+	word* y3 = x3 + n;
+	word* z3 = y3 + n;
+	stack = z3 + n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(ecpSeemsOnA(b, ec));
+	ASSERT(wwIsSameOrDisjoint(a, c, 3 * n));
+	ASSERT(b == c || wwIsDisjoint2(b, 2 * n, c, 3 * n));
+	// t0 <- xa xb, t1 <- ya yb
+	qrMul(t0, ecX(a), ecX(b), ec->f, stack);
+	qrMul(t1, ecY(a, n), ecY(b, n), ec->f, stack);
+	// t3 <- (xb + yb)(xa + ya) - t0 - t1
+	zmAdd(t3, ecX(b), ecY(b, n), ec->f);
+	zmAdd(t4, ecX(a), ecY(a, n), ec->f);
+	qrMul(t3, t3, t4, ec->f, stack);
+	zmAdd(t4, t0, t1, ec->f);
+	zmSub(t3, t3, t4, ec->f);
+	// t4 <- yb za + ya
+	qrMul(t4, ecY(b, n), ecZ(a, n), ec->f, stack);
+	zmAdd(t4, t4, ecY(a, n), ec->f);
+	// y3 <- xb za + xa
+	qrMul(y3, ecX(b), ecZ(a, n), ec->f, stack);
+	zmAdd(y3, y3, ecX(a), ec->f);
+	// x3 <- 3(y3 - B za)
+	qrMul(z3, ec->B, ecZ(a, n), ec->f, stack);
+	zmSub(x3, y3, z3, ec->f);
+	gfpDouble(z3, x3, ec->f);
+	zmAdd(x3, x3, z3, ec->f);
+	// z3 <- t1 - x3, x3 <- t1 + x3
+	zmSub(z3, t1, x3, ec->f);
+	zmAdd(x3, t1, x3, ec->f);
+	// y3 <- 3(B y3 - 3 za - t0)
+	qrMul(y3, ec->B, y3, ec->f, stack);
+	gfpDouble(t1, ecZ(a, n), ec->f);
+	zmAdd(t2, t1, ecZ(a, n), ec->f);
+	zmSub(y3, y3, t2, ec->f);
+	zmSub(y3, y3, t0, ec->f);
+	gfpDouble(t1, y3, ec->f);
+	zmAdd(y3, t1, y3, ec->f);
+	// t0 <- 3 t0 - t2
+	gfpDouble(t1, t0, ec->f);
+	zmAdd(t0, t1, t0, ec->f);
+	zmSub(t0, t0, t2, ec->f);
+	// t1 <- t4 y3, t2 <- t0 y3
+	qrMul(t1, t4, y3, ec->f, stack);
+	qrMul(t2, t0, y3, ec->f, stack);
+	// yc <- x3 z3 + t2
+	qrMul(y3, x3, z3, ec->f, stack);
+	zmAdd(ecY(c, n), y3, t2, ec->f);
+	// xc <- t3 x3 - t1
+	qrMul(x3, t3, x3, ec->f, stack);
+	zmSub(ecX(c), x3, t1, ec->f);
+	// zc <- t4 z3 + t3 t0
+	qrMul(z3, t4, z3, ec->f, stack);
+	qrMul(t1, t3, t0, ec->f, stack);
+	zmAdd(ecZ(c, n), z3, t1, ec->f);
+}
+
+static size_t ecpAddAP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(8 * n) + f_deep;
+}
+
+// [3n]c <- [3n]a - [3n]b (P <- P - P)
+static void ecpSubP(word c[], const word a[], const word b[], const ec_o* ec,
+	void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t = (word*)stack;
+	stack = t + 3 * n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(ecpSeemsOn3(b, ec));
+	ASSERT(wwIsSameOrDisjoint(a, c, 3 * n));
+	ASSERT(wwIsSameOrDisjoint(b, c, 3 * n));
+	// t <- -b
+	ecpNegP(t, b, ec, stack);
+	// c <- a + t
+	ecpAddP(c, a, t, ec, stack);
+}
+
+static size_t ecpSubP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(3 * n) + ecpAddP_deep(n, f_deep);
+}
+
+// [3n]c <- [3n]a - [2n]b (P <- P - A)
+static void ecpSubAP(word c[], const word a[], const word b[], 
+	const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t = (word*)stack;
+	stack = t + 2 * n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(ecpSeemsOnA(b, ec));
+	ASSERT(wwIsSameOrDisjoint(a, c, 3 * n));
+	ASSERT(b == c || wwIsDisjoint2(b, 2 * n, c, 3 * n));
+	// t <- -b
+	qrCopy(ecX(t), ecX(b), ec->f);
+	zmNeg(ecY(t, n), ecY(b, n), ec->f);
+	// c <- a + t
+	ecpAddAP(c, a, t, ec, stack);
+}
+
+static size_t ecpSubAP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(2 * n) + ecpAddAP_deep(n, f_deep);
+}
+
+// [3n]b <- 2[3n]a (P <- 2P)
+static void ecpDblP(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t0 = (word*)stack;
+	word* t1 = t0 + n;
+	word* t2 = t1 + n;
+	word* t3 = t2 + n;
+	word* x3 = t3 + n;
+	word* y3 = x3 + n;
+	word* z3 = y3 + n;
+	stack = z3 + n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOn3(a, ec));
+	ASSERT(wwIsSameOrDisjoint(a, b, 3 * n));
+	// t0 <- xa^2, t1 <- ya^2, t2 <- za^2
+	qrSqr(t0, ecX(a), ec->f, stack);
+	qrSqr(t1, ecY(a, n), ec->f, stack);
+	qrSqr(t2, ecZ(a, n), ec->f, stack);
+	// t3 <- 2 xa ya
+	qrMul(t3, ecX(a), ecY(a, n), ec->f, stack);
+	gfpDouble(t3, t3, ec->f);
+	// z3 <- 2 xa za
+	qrMul(z3, ecX(a), ecZ(a, n), ec->f, stack);
+	gfpDouble(z3, z3, ec->f);
+	// y3 <- 3(B t2 - z3)
+	qrMul(y3, ec->B, t2, ec->f, stack);
+	zmSub(y3, y3, z3, ec->f);
+	gfpDouble(x3, y3, ec->f);
+	zmAdd(y3, x3, y3, ec->f);
+	// x3 <- t1 - y3, y3 <- (t1 + y3) x3
+	zmSub(x3, t1, y3, ec->f);
+	zmAdd(y3, t1, y3, ec->f);
+	qrMul(y3, x3, y3, ec->f, stack);
+	// x3 <- x3 t3
+	qrMul(x3, x3, t3, ec->f, stack);
+	// t2 <- 3 t2
+	gfpDouble(t3, t2, ec->f);
+	zmAdd(t2, t2, t3, ec->f);
+	// z3 <- 3(B z3 - t2 - t0)
+	qrMul(z3, ec->B, z3, ec->f, stack);
+	zmSub(z3, z3, t2, ec->f);
+	zmSub(z3, z3, t0, ec->f);
+	gfpDouble(t3, z3, ec->f);
+	zmAdd(z3, z3, t3, ec->f);
+	// t0 <- 3 t0 - t2
+	gfpDouble(t3, t0, ec->f);
+	zmAdd(t0, t3, t0, ec->f);
+	zmSub(t0, t0, t2, ec->f);
+	// y3 <- y3 + t0 z3
+	qrMul(t0, t0, z3, ec->f, stack);
+	zmAdd(y3, y3, t0, ec->f);
+	// t0 <- 2 ya za
+	qrMul(t0, ecY(a, n), ecZ(a, n), ec->f, stack);
+	gfpDouble(t0, t0, ec->f);
+	// xb <- x3 - t0 z3
+	qrMul(z3, t0, z3, ec->f, stack);
+	zmSub(ecX(b), x3, z3, ec->f);
+	// yb <- y3
+	qrCopy(ecY(b, n), y3, ec->f);
+	// zb <- 4 t0 t1
+	qrMul(z3, t0, t1, ec->f, stack);
+	gfpDouble(z3, z3, ec->f);
+	gfpDouble(ecZ(b, n), z3, ec->f);
+}
+
+static size_t ecpDblP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(7 * n) + f_deep;
+}
+
+// [3n]b <- 2[2n]a (P <- 2A)
+static void ecpDblAP(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	// переменные в stack
+	word* t = (word*)stack;
+	stack = t + 3 * n;
+	// pre
+	ASSERT(ecIsOperable(ec) && ec->d == 3);
+	ASSERT(ecpSeemsOnA(a, ec));
+	ASSERT(a == b || wwIsDisjoint2(a, 2 * n, b, 3 * n));
+	// b <- 2(xa : ya : 1)
+	ecpFromAP(t, a, ec, stack);
+	ecpDblP(b, t, ec, stack);
+}
+
+static size_t ecpDblAP_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(3 * n) + ecpDblP_deep(n, f_deep);
+}
+
+bool_t ecpCreateP(ec_o* ec, const qr_o* f, const octet A[], const octet B[], 
+	void* stack)
+{
+	word* t;
+	// pre
+	ASSERT(memIsValid(ec, sizeof(ec_o)));
+	ASSERT(gfpIsOperable(f));
+	ASSERT(memIsValid(A, f->no)); 
+	ASSERT(memIsValid(B, f->no));
+	// f->mod > 3?
+	if (wwCmpW(f->mod, f->n, 3) <= 0)
+		return FALSE;
+	// обнулить
+	memSetZero(ec, sizeof(ec_o));
+	// зафикисровать размерности
+	ec->d = 3;
+	// запомнить базовое поле
+	ec->f = f;
+	// сохранить коэффициенты
+	ec->A = (word*)ec->descr;
+	ec->B = ec->A + f->n;
+	if (!qrFrom(ec->A, A, ec->f, stack) || !qrFrom(ec->B, B, ec->f, stack))
+		return FALSE;
+	// t <- -3
+	t = (word*)stack;
+	gfpDouble(t, f->unity, f);
+	zmAdd(t, t, f->unity, f);
+	zmNeg(t, t, f);
+	// A != -3?
+	if (qrCmp(t, ec->A, f) != 0)
+		return FALSE;
+	// подготовить буферы для описания группы точек
+	ec->base = ec->B + f->n;
+	ec->order = ec->base + 2 * f->n;
+	// за order: [f->n + 3] параметр Барретта (см. ecCreateGroupBarr())
+	ec->params = 0;
+	// настроить интерфейсы
+	ec->froma = ecpFromAP;
+	ec->toa = ecpToAP;
+	ec->neg = ecpNegP;
+	ec->add = ecpAddP;
+	ec->adda = ecpAddAP;
+	ec->sub = ecpSubP;
+	ec->suba = ecpSubAP;
+	ec->dbl = ecpDblP;
+	ec->dbla = ecpDblAP;
+	ec->tpl = 0;
+	ec->toab = ecpToAPBatch;
+	ec->deep = utilMax(7,
+		ecpToAP_deep(f->n, f->deep),
+		ecpAddP_deep(f->n, f->deep),
+		ecpAddAP_deep(f->n, f->deep),
+		ecpSubP_deep(f->n, f->deep),
+		ecpSubAP_deep(f->n, f->deep),
+		ecpDblP_deep(f->n, f->deep),
+		ecpDblAP_deep(f->n, f->deep));
+	// настроить
+	ec->hdr.keep = sizeof(ec_o) + O_OF_W(6 * f->n + 4);
+	ec->hdr.p_count = 6;
+	ec->hdr.o_count = 1;
+	// все нормально
+	return TRUE;
+}
+
+size_t ecpCreateP_keep(size_t n)
+{
+	return sizeof(ec_o) + O_OF_W(6 * n + 4);
+}
+
+size_t ecpCreateP_deep(size_t n, size_t f_deep)
+{
+	return utilMax(8,
+		O_OF_W(n),
+		ecpToAP_deep(n, f_deep),
+		ecpAddP_deep(n, f_deep),
+		ecpAddAP_deep(n, f_deep),
+		ecpSubP_deep(n, f_deep),
+		ecpSubAP_deep(n, f_deep),
+		ecpDblP_deep(n, f_deep),
+		ecpDblAP_deep(n, f_deep));
+}
+
 /*
 *******************************************************************************
 Свойства кривой 
@@ -1202,11 +2063,88 @@ size_t ecpSubAA_deep(size_t n, size_t f_deep)
 *******************************************************************************
 Алгоритм SWU
 
+Функция ecpSWU2() реализует алгоритм SWU непосредственно: x1 находится
+с помощью обращения (возведение в степень p - 2), квадратный корень
+из y = x1^3 + A x1 + B -- с помощью второго возведения в степень.
+
+Функция ecpSWU() использует одно возведение в степень. Пусть
+x1 = num / den, где num = -B(1 + t + t^2), den = A(t + t^2).
+Тогда y = U / V, где U = num^3 + A num den^2 + B den^3, V = den^3.
+Для w = U V^3 вычисляется e = w^{(p - 3) / 4}. При этом:
+--	e^2 w = w^{(p - 1) / 2} -- символ Лежандра y;
+--	U V e = y^{(p + 1) / 4} -- квадратный корень из y, если y -- вычет;
+--	e^2 U den^8 = \pm 1 / den, где знак совпадает с символом Лежандра.
+Результат совпадает с результатом ecpSWU2(). Исключительные ситуации
+den = 0 (a \in {0, 1, p - 1}) и U = 0 (точка порядка 2) обрабатываются
+в ecpSWU2().
+
+Показатели (p - 3) / 4 и p - 2 для стандартных простых bign имеют вид
+(2^m - 1) 2^8 + e0. Для таких показателей функция ecpSWUPower()
+использует фиксированную аддитивную цепочку: x^{2^m - 1} вычисляется
+за m возведений в квадрат и около 2 log m умножений (ср. с (m + 8) / 5
+умножениями и таблицей в qrPower()).
+
 \todo Регуляризировать (qrIsUnitySafe).
 *******************************************************************************
 */
 
-void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
+static void ecpSWUPower(word b[], const word a[], const word e[],
+	const qr_o* f, void* stack)
+{
+	const size_t n = f->n;
+	size_t k, m, i, j, l;
+	// переменные в stack
+	word* r = (word*)stack;
+	word* s = r + n;
+	stack = s + n;
+	// e = (2^m - 1) 2^8 + e0?
+	k = wwBitSize(e, n);
+	for (i = 8; i < k && wwTestBit(e, i); ++i);
+	if (k < 16 || i < k)
+	{
+		FAST(qrPower)(b, a, e, n, f, stack);
+		return;
+	}
+	m = k - 8;
+	// r <- a^{2^m - 1}
+	for (l = 0; (m >> l) > 1; ++l);
+	qrCopy(r, a, f);
+	for (j = 1; l--;)
+	{
+		// r <- r^{2^j} r
+		qrCopy(s, r, f);
+		for (i = 0; i < j; ++i)
+			qrSqr(s, s, f, stack);
+		qrMul(r, s, r, f, stack);
+		j *= 2;
+		// r <- r^2 a
+		if ((m >> l) & 1)
+		{
+			qrSqr(r, r, f, stack);
+			qrMul(r, r, a, f, stack);
+			++j;
+		}
+	}
+	ASSERT(j == m);
+	// b <- r^{2^8} a^{e0}
+	for (i = 8; i--;)
+	{
+		qrSqr(r, r, f, stack);
+		if (wwTestBit(e, i))
+			qrMul(r, r, a, f, stack);
+	}
+	qrCopy(b, r, f);
+}
+
+static size_t ecpSWUPower_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			f_deep,
+			qrPower_deep(n, n, f_deep));
+}
+
+static void ecpSWU2(word b[], const word a[], const ec_o* ec, void* stack)
 {
 	const size_t n = ec->f->n;
 	register size_t mask;
@@ -1217,11 +2155,6 @@ void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
 	word* y = x2 + n;
 	word* s = y + n; 
 	stack = s + n;
-	// pre
-	ASSERT(ecIsOperable(ec));
-	ASSERT(zmIsIn(a, ec->f));
-	ASSERT(wwGetBits(ec->f->mod, 0, 2) == 3);
-	ASSERT(!qrIsZero(ec->A, ec->f) && !qrIsZero(ec->B, ec->f));
 	// t <- -a^2
 	qrSqr(t, a, ec->f, stack);
 	zmNeg(t, t, ec->f);
@@ -1232,7 +2165,7 @@ void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
 	qrSqr(x2, t, ec->f, stack);
 	qrAdd(x2, x2, t, ec->f);
 	qrMul(x1, x2, ec->A, ec->f, stack);
-	qrPower(x1, x1, s, n, ec->f, stack);
+	ecpSWUPower(x1, x1, s, ec->f, stack);
 	qrAddUnity(x2, x2, ec->f);
 	qrMul(x1, x1, x2, ec->f, stack);
 	qrMul(x1, x1, ec->B, ec->f, stack);
@@ -1249,7 +2182,7 @@ void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
 	wwCopy(t, ec->f->mod, n);
 	wwShLo(t, n, 2);
 	zzSub(s, s, t, n);
-	qrPower(t, y, s, n, ec->f, stack);
+	FAST(qrPower)(t, y, s, n, ec->f, stack);
 	// s <- a^3 y
 	qrSqr(s, a, ec->f, stack);
 	qrMul(s, s, a, ec->f, stack);
@@ -1265,10 +2198,104 @@ void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
 	mask = 0;
 }
 
-size_t ecpSWU_deep(size_t n, size_t f_deep)
+static size_t ecpSWU2_deep(size_t n, size_t f_deep)
 {
 	return O_OF_W(5 * n) + 
-		utilMax(2,
+		utilMax(3,
 			f_deep,
-			qrPower_deep(n, n, f_deep));
+			qrPower_deep(n, n, f_deep),
+			ecpSWUPower_deep(n, f_deep));
+}
+
+void ecpSWU(word b[], const word a[], const ec_o* ec, void* stack)
+{
+	const size_t n = ec->f->n;
+	register size_t mask;
+	// переменные в stack [x2 после x1, s после r, ninv после inv!]
+	word* t = (word*)stack;
+	word* num = t + n;
+	word* den = num + n;
+	word* U = den + n;
+	word* V = U + n;
+	word* w = V + n;
+	word* e = w + n;
+	word* x1 = e + n;
+	word* x2 = x1 + n;
+	word* r = x2 + n;
+	word* s = r + n;
+	word* inv = s + n;
+	word* ninv = inv + n;
+	stack = ninv + n;
+	// pre
+	ASSERT(ecIsOperable(ec));
+	ASSERT(zmIsIn(a, ec->f));
+	ASSERT(wwGetBits(ec->f->mod, 0, 2) == 3);
+	ASSERT(!qrIsZero(ec->A, ec->f) && !qrIsZero(ec->B, ec->f));
+	// t <- -a^2
+	qrSqr(t, a, ec->f, stack);
+	zmNeg(t, t, ec->f);
+	// den <- A(t + t^2), num <- -B(1 + t + t^2)
+	qrSqr(den, t, ec->f, stack);
+	qrAdd(den, den, t, ec->f);
+	qrAddUnity(num, den, ec->f);
+	qrMul(den, den, ec->A, ec->f, stack);
+	qrMul(num, num, ec->B, ec->f, stack);
+	zmNeg(num, num, ec->f);
+	// U <- num^3 + A num den^2 + B den^3, V <- den^3
+	qrSqr(V, den, ec->f, stack);
+	qrMul(s, V, ec->A, ec->f, stack);
+	qrSqr(U, num, ec->f, stack);
+	qrAdd(U, U, s, ec->f);
+	qrMul(U, U, num, ec->f, stack);
+	qrMul(V, V, den, ec->f, stack);
+	qrMul(s, V, ec->B, ec->f, stack);
+	qrAdd(U, U, s, ec->f);
+	// исключительная ситуация?
+	if (qrIsZero(den, ec->f) || qrIsZero(U, ec->f))
+	{
+		ecpSWU2(b, a, ec, stack);
+		return;
+	}
+	// e <- (U V^3)^{(p - 3) / 4}
+	qrSqr(w, V, ec->f, stack);
+	qrMul(w, w, V, ec->f, stack);
+	qrMul(w, w, U, ec->f, stack);
+	wwCopy(s, ec->f->mod, n);
+	wwShLo(s, n, 2);
+	ecpSWUPower(e, w, s, ec->f, stack);
+	// mask <- e^2 w == 1 ? 0 : -1
+	qrSqr(inv, e, ec->f, stack);
+	qrMul(s, inv, w, ec->f, stack);
+	mask = qrIsUnity(s, ec->f) - SIZE_1;
+	// inv <- e^2 U den^8 = \pm 1 / den, ninv <- -inv
+	qrMul(inv, inv, U, ec->f, stack);
+	qrSqr(s, den, ec->f, stack);
+	qrSqr(s, s, ec->f, stack);
+	qrSqr(s, s, ec->f, stack);
+	qrMul(inv, inv, s, ec->f, stack);
+	zmNeg(ninv, inv, ec->f);
+	// x1 <- num / den, x2 <- x1 t
+	qrMul(x1, num, inv + (mask & n), ec->f, stack);
+	qrMul(x2, x1, t, ec->f, stack);
+	// r <- U V e, s <- -a^3 r
+	qrMul(r, U, V, ec->f, stack);
+	qrMul(r, r, e, ec->f, stack);
+	qrSqr(s, a, ec->f, stack);
+	qrMul(s, s, a, ec->f, stack);
+	qrMul(s, s, r, ec->f, stack);
+	zmNeg(s, s, ec->f);
+	// b <- mask == 0 ? (x1, r) : (x2, s)
+	qrCopy(ecX(b), x1 + (mask & n), ec->f);
+	qrCopy(ecY(b, n), r + (mask & n), ec->f);
+	// очистка
+	mask = 0;
+}
+
+size_t ecpSWU_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(13 * n) + 
+		utilMax(3,
+			f_deep,
+			ecpSWUPower_deep(n, f_deep),
+			ecpSWU2_deep(n, f_deep));
 }
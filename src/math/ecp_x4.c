@@ -0,0 +1,553 @@
+/*
+*******************************************************************************
+\file ecp_x4.c
+\brief Elliptic curves over prime fields: 4-way batch arithmetic
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/util.h"
+#include "bee2/core/word.h"
+#include "bee2/math/ecp.h"
+#include "bee2/math/gfp.h"
+#include "bee2/math/ww.h"
+#include "bee2/math/zz.h"
+
+#if defined(__AVX2__) && defined(U64_SUPPORT)
+	#include <immintrin.h>
+#endif
+
+/*
+*******************************************************************************
+4-полосная арифметика
+
+Поддерживаются поля GF(p), p = 2^256 - c, 0 < c < 2^16, в частности,
+базовое поле кривой bign-curve256v1. В одном вызове обрабатываются
+4 независимых элемента поля (полосы, lanes).
+
+Элемент поля a представляется 10 limbs a_i по 26 битов:
+	a = a_0 + a_1 2^26 + ... + a_9 2^234,
+при этом 2^260 \equiv 16c \mod p. Limbs хранятся в 64-битовых словах.
+Элемент, обрабатываемый в 4 полосах, задается массивом [40]u64:
+слово 4i + j содержит i-й limb элемента j-й полосы. Такая раскладка
+позволяет обрабатывать полосы одной векторной инструкцией.
+
+Limbs элементов, которые поступают на вход и возвращаются на выходе
+функций gfpx4Add(), gfpx4Sub(), gfpx4Mul(), не превосходят 2^27.
+Элементы не обязательно приведены по модулю p. Полное приведение
+выполняется только при выгрузке (gfpx4To()).
+
+При умножении вычисляются 19 сумм произведений limbs (каждая < 2^58),
+выполняется распространение переносов, старшие limbs сворачиваются
+умножением на 16c, переносы распространяются повторно. При вычитании
+к уменьшаемому добавляется 64p в представлении, все limbs которого
+не меньше 2^27 (чтобы избежать отрицательных limbs).
+
+Если компилятор поддерживает AVX2 (макрос __AVX2__, например, при сборке
+с BASH_PLATFORM=BASH_AVX2), то умножение реализуется с помощью
+инструкции vpmuludq, которая выполняет 4 умножения 32 x 32 -> 64
+одновременно. В противном случае используется переносимая реализация
+с циклами по полосам.
+
+\remark В 4-полосной арифметике используется стандартное (не
+монтгомеровское) представление элементов поля. Перевод из представления
+ec->f выполняется с помощью qrTo() / qrFrom().
+*******************************************************************************
+*/
+
+#ifdef U64_SUPPORT
+
+#define GFPX4_M ((u64)0x3FFFFFF)
+
+typedef struct
+{
+	u64 c16;			/*!< 16c */
+	u64 p64[10];		/*!< 64p (limbs >= 2^27) */
+	u64 b[40];			/*!< коэффициент B во всех полосах */
+} gfpx4_ctx;
+
+// загрузить [32]x в полосу j элемента a
+static void gfpx4From(u64 a[40], size_t j, const octet x[32])
+{
+	u64 acc = 0;
+	size_t bits = 0, pos = 0, i;
+	for (i = 0; i < 10; ++i)
+	{
+		while (bits < 26 && pos < 32)
+			acc |= (u64)x[pos++] << bits, bits += 8;
+		a[4 * i + j] = acc & GFPX4_M;
+		acc >>= 26, bits -= MIN2(bits, 26);
+	}
+}
+
+// выгрузить полосу j элемента a в [32]x (с полным приведением)
+static void gfpx4To(octet x[32], const u64 a[40], size_t j, u64 c)
+{
+	u64 v[10];
+	u64 w[10];
+	u64 acc, mask;
+	size_t i, k, bits, pos;
+	for (i = 0; i < 10; ++i)
+		v[i] = a[4 * i + j];
+	// v <- v mod 2^260 + 16c (v >> 260) (дважды)
+	for (k = 0; k < 2; ++k)
+	{
+		for (i = 0; i < 9; ++i)
+			v[i + 1] += v[i] >> 26, v[i] &= GFPX4_M;
+		v[0] += (v[9] >> 26) * 16 * c, v[9] &= GFPX4_M;
+	}
+	// v <- v mod 2^256 + c (v >> 256) (дважды)
+	for (k = 0; k < 2; ++k)
+	{
+		for (i = 0; i < 9; ++i)
+			v[i + 1] += v[i] >> 26, v[i] &= GFPX4_M;
+		v[0] += (v[9] >> 22) * c, v[9] &= 0x3FFFFF;
+	}
+	for (i = 0; i < 9; ++i)
+		v[i + 1] += v[i] >> 26, v[i] &= GFPX4_M;
+	// v < 2^256: w <- v + c, v >= p <=> w >= 2^256
+	w[0] = v[0] + c;
+	for (i = 0; i < 9; ++i)
+		w[i + 1] = v[i + 1] + (w[i] >> 26), w[i] &= GFPX4_M;
+	mask = (u64)0 - (w[9] >> 22);
+	w[9] &= 0x3FFFFF;
+	for (i = 0; i < 10; ++i)
+		v[i] ^= (v[i] ^ w[i]) & mask;
+	// упаковать
+	for (i = pos = 0, acc = 0, bits = 0; pos < 32; )
+	{
+		if (bits < 8 && i < 10)
+			acc |= v[i++] << bits, bits += 26;
+		x[pos++] = (octet)acc;
+		acc >>= 8, bits -= MIN2(bits, 8);
+	}
+	acc = mask = 0;
+	memWipe(v, sizeof(v));
+	memWipe(w, sizeof(w));
+}
+
+// a <- a (распространение переносов, свертка limb с номером 10)
+static void gfpx4Carry(u64 a[40], const gfpx4_ctx* ctx)
+{
+	size_t i, j;
+	for (i = 0; i < 9; ++i)
+		for (j = 0; j < 4; ++j)
+			a[4 * i + 4 + j] += a[4 * i + j] >> 26,
+				a[4 * i + j] &= GFPX4_M;
+	for (j = 0; j < 4; ++j)
+		a[j] += (a[36 + j] >> 26) * ctx->c16, a[36 + j] &= GFPX4_M;
+	for (j = 0; j < 4; ++j)
+		a[4 + j] += a[j] >> 26, a[j] &= GFPX4_M;
+}
+
+// c <- a + b
+static void gfpx4Add(u64 c[40], const u64 a[40], const u64 b[40],
+	const gfpx4_ctx* ctx)
+{
+	size_t i;
+	for (i = 0; i < 40; ++i)
+		c[i] = a[i] + b[i];
+	gfpx4Carry(c, ctx);
+}
+
+// c <- a - b
+static void gfpx4Sub(u64 c[40], const u64 a[40], const u64 b[40],
+	const gfpx4_ctx* ctx)
+{
+	size_t i;
+	for (i = 0; i < 40; ++i)
+		c[i] = a[i] + ctx->p64[i / 4] - b[i];
+	gfpx4Carry(c, ctx);
+}
+
+// c <- a b
+#if defined(__AVX2__)
+
+static void gfpx4Mul(u64 c[40], const u64 a[40], const u64 b[40],
+	const gfpx4_ctx* ctx)
+{
+	const __m256i m = _mm256_set1_epi64x((long long)GFPX4_M);
+	const __m256i c16 = _mm256_set1_epi64x((long long)ctx->c16);
+	__m256i A[10], t[20], top;
+	size_t i, j;
+	for (i = 0; i < 10; ++i)
+		A[i] = _mm256_loadu_si256((const __m256i*)(a + 4 * i));
+	for (i = 0; i < 20; ++i)
+		t[i] = _mm256_setzero_si256();
+	// t <- a b
+	for (j = 0; j < 10; ++j)
+	{
+		__m256i B = _mm256_loadu_si256((const __m256i*)(b + 4 * j));
+		for (i = 0; i < 10; ++i)
+			t[i + j] = _mm256_add_epi64(t[i + j], _mm256_mul_epu32(A[i], B));
+	}
+	// переносы
+	for (i = 0; i < 19; ++i)
+		t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(t[i], 26)),
+			t[i] = _mm256_and_si256(t[i], m);
+	// свертка
+	for (i = 0; i < 10; ++i)
+		t[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(t[i + 10], c16));
+	for (i = 0; i < 9; ++i)
+		t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(t[i], 26)),
+			t[i] = _mm256_and_si256(t[i], m);
+	top = _mm256_srli_epi64(t[9], 26);
+	t[9] = _mm256_and_si256(t[9], m);
+	t[0] = _mm256_add_epi64(t[0], _mm256_mul_epu32(top, c16));
+	t[1] = _mm256_add_epi64(t[1], _mm256_srli_epi64(t[0], 26));
+	t[0] = _mm256_and_si256(t[0], m);
+	for (i = 0; i < 10; ++i)
+		_mm256_storeu_si256((__m256i*)(c + 4 * i), t[i]);
+}
+
+#else
+
+static void gfpx4Mul(u64 c[40], const u64 a[40], const u64 b[40],
+	const gfpx4_ctx* ctx)
+{
+	u64 t[80];
+	size_t i, k, j;
+	for (i = 0; i < 80; ++i)
+		t[i] = 0;
+	// t <- a b
+	for (i = 0; i < 10; ++i)
+		for (k = 0; k < 10; ++k)
+			for (j = 0; j < 4; ++j)
+				t[4 * (i + k) + j] += a[4 * i + j] * b[4 * k + j];
+	// переносы
+	for (i = 0; i < 19; ++i)
+		for (j = 0; j < 4; ++j)
+			t[4 * i + 4 + j] += t[4 * i + j] >> 26, t[4 * i + j] &= GFPX4_M;
+	// свертка
+	for (i = 0; i < 40; ++i)
+		c[i] = t[i] + t[i + 40] * ctx->c16;
+	gfpx4Carry(c, ctx);
+}
+
+#endif
+
+// b <- a^2
+#define gfpx4Sqr(b, a, ctx) gfpx4Mul(b, a, a, ctx)
+
+/*
+*******************************************************************************
+4-полосные точки
+
+Точки задаются однородными проективными координатами (X : Y : Z) и
+обрабатываются по полным формулам для случая A = -3 (см. ecp.c):
+ecpx4Add() (алгоритм 4 [Renes, Costello, Batina]), ecpx4Dbl()
+(алгоритм 6). Точка в 4 полосах занимает [120]u64: X -- первые 40 слов,
+Y -- следующие 40, Z -- последние 40.
+*******************************************************************************
+*/
+
+#define x4X(pt) (pt)
+#define x4Y(pt) ((pt) + 40)
+#define x4Z(pt) ((pt) + 80)
+
+// [120]c <- [120]a + [120]b, t -- [8 * 40] вспомогательная память
+static void ecpx4Add(u64 c[120], const u64 a[120], const u64 b[120],
+	const gfpx4_ctx* ctx, u64 t[])
+{
+	u64* t0 = t;
+	u64* t1 = t0 + 40;
+	u64* t2 = t1 + 40;
+	u64* t3 = t2 + 40;
+	u64* t4 = t3 + 40;
+	u64* x3 = t4 + 40;
+	u64* y3 = x3 + 40;
+	u64* z3 = y3 + 40;
+	gfpx4Mul(t0, x4X(a), x4X(b), ctx);
+	gfpx4Mul(t1, x4Y(a), x4Y(b), ctx);
+	gfpx4Mul(t2, x4Z(a), x4Z(b), ctx);
+	gfpx4Add(t3, x4X(a), x4Y(a), ctx);
+	gfpx4Add(t4, x4X(b), x4Y(b), ctx);
+	gfpx4Mul(t3, t3, t4, ctx);
+	gfpx4Add(t4, t0, t1, ctx);
+	gfpx4Sub(t3, t3, t4, ctx);
+	gfpx4Add(t4, x4Y(a), x4Z(a), ctx);
+	gfpx4Add(x3, x4Y(b), x4Z(b), ctx);
+	gfpx4Mul(t4, t4, x3, ctx);
+	gfpx4Add(x3, t1, t2, ctx);
+	gfpx4Sub(t4, t4, x3, ctx);
+	gfpx4Add(x3, x4X(a), x4Z(a), ctx);
+	gfpx4Add(y3, x4X(b), x4Z(b), ctx);
+	gfpx4Mul(x3, x3, y3, ctx);
+	gfpx4Add(y3, t0, t2, ctx);
+	gfpx4Sub(y3, x3, y3, ctx);
+	gfpx4Mul(z3, ctx->b, t2, ctx);
+	gfpx4Sub(x3, y3, z3, ctx);
+	gfpx4Add(z3, x3, x3, ctx);
+	gfpx4Add(x3, x3, z3, ctx);
+	gfpx4Sub(z3, t1, x3, ctx);
+	gfpx4Add(x3, t1, x3, ctx);
+	gfpx4Mul(y3, ctx->b, y3, ctx);
+	gfpx4Add(t1, t2, t2, ctx);
+	gfpx4Add(t2, t1, t2, ctx);
+	gfpx4Sub(y3, y3, t2, ctx);
+	gfpx4Sub(y3, y3, t0, ctx);
+	gfpx4Add(t1, y3, y3, ctx);
+	gfpx4Add(y3, t1, y3, ctx);
+	gfpx4Add(t1, t0, t0, ctx);
+	gfpx4Add(t0, t1, t0, ctx);
+	gfpx4Sub(t0, t0, t2, ctx);
+	gfpx4Mul(t1, t4, y3, ctx);
+	gfpx4Mul(t2, t0, y3, ctx);
+	gfpx4Mul(y3, x3, z3, ctx);
+	gfpx4Add(x4Y(c), y3, t2, ctx);
+	gfpx4Mul(x3, t3, x3, ctx);
+	gfpx4Sub(x4X(c), x3, t1, ctx);
+	gfpx4Mul(z3, t4, z3, ctx);
+	gfpx4Mul(t1, t3, t0, ctx);
+	gfpx4Add(x4Z(c), z3, t1, ctx);
+}
+
+// [120]b <- 2[120]a, t -- [7 * 40] вспомогательная память
+static void ecpx4Dbl(u64 b[120], const u64 a[120], const gfpx4_ctx* ctx,
+	u64 t[])
+{
+	u64* t0 = t;
+	u64* t1 = t0 + 40;
+	u64* t2 = t1 + 40;
+	u64* t3 = t2 + 40;
+	u64* x3 = t3 + 40;
+	u64* y3 = x3 + 40;
+	u64* z3 = y3 + 40;
+	gfpx4Sqr(t0, x4X(a), ctx);
+	gfpx4Sqr(t1, x4Y(a), ctx);
+	gfpx4Sqr(t2, x4Z(a), ctx);
+	gfpx4Mul(t3, x4X(a), x4Y(a), ctx);
+	gfpx4Add(t3, t3, t3, ctx);
+	gfpx4Mul(z3, x4X(a), x4Z(a), ctx);
+	gfpx4Add(z3, z3, z3, ctx);
+	gfpx4Mul(y3, ctx->b, t2, ctx);
+	gfpx4Sub(y3, y3, z3, ctx);
+	gfpx4Add(x3, y3, y3, ctx);
+	gfpx4Add(y3, x3, y3, ctx);
+	gfpx4Sub(x3, t1, y3, ctx);
+	gfpx4Add(y3, t1, y3, ctx);
+	gfpx4Mul(y3, x3, y3, ctx);
+	gfpx4Mul(x3, x3, t3, ctx);
+	gfpx4Add(t3, t2, t2, ctx);
+	gfpx4Add(t2, t2, t3, ctx);
+	gfpx4Mul(z3, ctx->b, z3, ctx);
+	gfpx4Sub(z3, z3, t2, ctx);
+	gfpx4Sub(z3, z3, t0, ctx);
+	gfpx4Add(t3, z3, z3, ctx);
+	gfpx4Add(z3, z3, t3, ctx);
+	gfpx4Add(t3, t0, t0, ctx);
+	gfpx4Add(t0, t3, t0, ctx);
+	gfpx4Sub(t0, t0, t2, ctx);
+	gfpx4Mul(t0, t0, z3, ctx);
+	gfpx4Add(y3, y3, t0, ctx);
+	gfpx4Mul(t0, x4Y(a), x4Z(a), ctx);
+	gfpx4Add(t0, t0, t0, ctx);
+	gfpx4Mul(z3, t0, z3, ctx);
+	gfpx4Sub(x4X(b), x3, z3, ctx);
+	memCopy(x4Y(b), y3, 40 * sizeof(u64));
+	gfpx4Mul(z3, t0, t1, ctx);
+	gfpx4Add(z3, z3, z3, ctx);
+	gfpx4Add(x4Z(b), z3, z3, ctx);
+}
+
+// [120]s <- в полосе j точка pre[idx[j]], pre -- [4 * 120] таблица
+static void ecpx4Select(u64 s[120], const u64 pre[480], const size_t idx[4])
+{
+	size_t i, j, k;
+	u64 mask;
+	for (i = 0; i < 120; ++i)
+		s[i] = 0;
+	for (k = 0; k < 4; ++k)
+		for (j = 0; j < 4; ++j)
+		{
+			mask = (u64)0 - ((((u64)(idx[j] ^ k)) - 1) >> 63);
+			for (i = j; i < 120; i += 4)
+				s[i] |= pre[120 * k + i] & mask;
+		}
+	mask = 0;
+}
+
+#endif /* U64_SUPPORT */
+
+/*
+*******************************************************************************
+Пакетная сумма кратных точек
+
+В каждой из 4 полос вычисляется b_j = d_j a_j + e_j c_j. Используется
+регулярный совместный метод "удвоение и сложение" (трюк Шамира):
+	pre <- (O, a, c, a + c)
+	t <- O
+	for i = l - 1,..., 0:
+		t <- 2t
+		t <- t + pre[bit_i(d) + 2 bit_i(e)].
+Благодаря полным формулам сложение с O и сложение равных точек
+не требуют ветвлений. Точки из pre выбираются просмотром всей таблицы
+с маскированием. Последовательность операций и обращений к памяти
+зависит только от n и m.
+*******************************************************************************
+*/
+
+bool_t ecpIsOperableX4(const ec_o* ec)
+{
+#ifdef U64_SUPPORT
+	word t[W_OF_O(32)];
+	size_t i;
+	if (!ecIsOperable(ec) || ec->d != 3 || ec->f->no != 32 ||
+		!gfpIsOperable(ec->f))
+		return FALSE;
+	// p = 2^256 - c, 0 < c < 2^16?
+	for (i = 1; i < ec->f->n; ++i)
+		if (ec->f->mod[i] != WORD_MAX)
+			return FALSE;
+	if (ec->f->mod[0] <= WORD_MAX - 0xFFFF)
+		return FALSE;
+	// A == -3?
+	gfpDouble(t, ec->f->unity, ec->f);
+	zmAdd(t, t, ec->f->unity, ec->f);
+	zmNeg(t, t, ec->f);
+	return qrCmp(t, ec->A, ec->f) == 0;
+#else
+	return FALSE;
+#endif
+}
+
+#ifdef U64_SUPPORT
+
+size_t ecpAddMulAX4(word b[], const ec_o* ec, const word a[], const word d[],
+	const word c[], const word e[], size_t m, void* stack)
+{
+	const size_t n = ec->f->n;
+	const size_t l = B_OF_W(MAX2(n, m));
+	size_t ret = 0;
+	size_t idx[4];
+	size_t i, j;
+	u64 cc;
+	// переменные в stack
+	gfpx4_ctx* ctx;		/* 4-полосная арифметика */
+	u64* pre;			/* [4 * 120] O, a, c, a + c */
+	u64* t;				/* [120] результат */
+	u64* s;				/* [120] выбранная точка */
+	u64* tmp;			/* [8 * 40] вспомогательная память */
+	octet* x;			/* [32] элемент поля */
+	word* w;			/* [4 * 3 * n] результаты в представлении ec->f */
+	word* z;			/* [4 * n] обратные Z-координаты */
+	// pre
+	ASSERT(ecpIsOperableX4(ec));
+	ASSERT(wwIsValid(a, 4 * 2 * n) && wwIsValid(c, 4 * 2 * n));
+	ASSERT(wwIsValid(d, 4 * n) && wwIsValid(e, 4 * m));
+	ASSERT(wwIsValid(b, 4 * 2 * n));
+	// раскладка stack
+	ctx = (gfpx4_ctx*)stack;
+	pre = (u64*)(ctx + 1);
+	t = pre + 4 * 120;
+	s = t + 120;
+	tmp = s + 120;
+	x = (octet*)(tmp + 8 * 40);
+	w = (word*)(x + 32);
+	z = w + 4 * 3 * n;
+	stack = z + 4 * n;
+	// подготовить ctx: p = 2^256 - cc
+	cc = (u64)(WORD_MAX - ec->f->mod[0]) + 1;
+	ctx->c16 = 16 * cc;
+	ctx->p64[0] = 64 * ((u64)GFPX4_M + 1 - cc);
+	for (i = 1; i < 9; ++i)
+		ctx->p64[i] = 64 * GFPX4_M;
+	ctx->p64[9] = 64 * (u64)0x3FFFFF;
+	qrTo(x, ec->B, ec->f, stack);
+	for (j = 0; j < 4; ++j)
+		gfpx4From(ctx->b, j, x);
+	// pre[0] <- O
+	for (i = 0; i < 120; ++i)
+		pre[i] = 0;
+	for (j = 0; j < 4; ++j)
+		x4Y(pre)[j] = 1;
+	// pre[1] <- a, pre[2] <- c
+	for (j = 0; j < 4; ++j)
+	{
+		qrTo(x, ecX(a + 2 * n * j), ec->f, stack);
+		gfpx4From(x4X(pre + 120), j, x);
+		qrTo(x, ecY(a + 2 * n * j, n), ec->f, stack);
+		gfpx4From(x4Y(pre + 120), j, x);
+		qrTo(x, ecX(c + 2 * n * j), ec->f, stack);
+		gfpx4From(x4X(pre + 240), j, x);
+		qrTo(x, ecY(c + 2 * n * j, n), ec->f, stack);
+		gfpx4From(x4Y(pre + 240), j, x);
+	}
+	for (i = 0; i < 40; ++i)
+		x4Z(pre + 120)[i] = x4Z(pre + 240)[i] = (i < 4);
+	// pre[3] <- a + c
+	ecpx4Add(pre + 360, pre + 120, pre + 240, ctx, tmp);
+	// t <- O
+	memCopy(t, pre, 120 * sizeof(u64));
+	// цикл по битам
+	for (i = l; i--;)
+	{
+		ecpx4Dbl(t, t, ctx, tmp);
+		for (j = 0; j < 4; ++j)
+		{
+			idx[j] = 0;
+			if (i < B_OF_W(n))
+				idx[j] |= (size_t)wwTestBit(d + n * j, i);
+			if (i < B_OF_W(m))
+				idx[j] |= (size_t)wwTestBit(e + m * j, i) << 1;
+		}
+		ecpx4Select(s, pre, idx);
+		ecpx4Add(t, t, s, ctx, tmp);
+	}
+	// к представлению ec->f
+	for (j = 0; j < 4; ++j)
+	{
+		gfpx4To(x, x4X(t), j, cc);
+		qrFrom(w + 3 * n * j, x, ec->f, stack);
+		gfpx4To(x, x4Y(t), j, cc);
+		qrFrom(w + 3 * n * j + n, x, ec->f, stack);
+		gfpx4To(x, x4Z(t), j, cc);
+		qrFrom(z + n * j, x, ec->f, stack);
+		if (qrIsZero(z + n * j, ec->f))
+			qrSetUnity(z + n * j, ec->f);
+		else
+			ret |= SIZE_1 << j;
+	}
+	// к аффинным координатам
+	qrInvBatch(z, z, 4, ec->f, stack);
+	for (j = 0; j < 4; ++j)
+	{
+		qrMul(ecX(b + 2 * n * j), w + 3 * n * j, z + n * j, ec->f, stack);
+		qrMul(ecY(b + 2 * n * j, n), w + 3 * n * j + n, z + n * j, ec->f, 
+			stack);
+	}
+	// очистка
+	memWipe(pre, (4 * 120 + 2 * 120 + 8 * 40) * sizeof(u64));
+	memWipe(idx, sizeof(idx));
+	return ret;
+}
+
+#else
+
+size_t ecpAddMulAX4(word b[], const ec_o* ec, const word a[], const word d[],
+	const word c[], const word e[], size_t m, void* stack)
+{
+	ASSERT(ecpIsOperableX4(ec));
+	return 0;
+}
+
+#endif /* U64_SUPPORT */
+
+size_t ecpAddMulAX4_deep(size_t n, size_t f_deep, size_t m)
+{
+#ifdef U64_SUPPORT
+	return sizeof(gfpx4_ctx) + 
+		sizeof(u64) * (4 * 120 + 2 * 120 + 8 * 40) + 32 +
+		O_OF_W(4 * 3 * n + 4 * n) +
+		utilMax(2,
+			f_deep,
+			qrInvBatch_deep(n, 4, f_deep));
+#else
+	return 0;
+#endif
+}
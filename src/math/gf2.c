@@ -4,7 +4,7 @@
 \brief Binary fields
 \project bee2 [cryptographic library]
 \created 2012.04.17
-\version 2015.11.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -378,6 +378,250 @@ static size_t gf2Div_deep(size_t n)
 	return O_OF_W(n + 1) + ppDivMod_deep(n + 1);
 }
 
+/*
+*******************************************************************************
+Стандартные многочлены ДСТУ 4145
+
+Для многочленов, которые задают базовые поля стандартных кривых 
+ДСТУ 4145-2002 (приложение Г), реализованы специализированные функции
+приведения gf2RedXXX(), где XXX -- степень многочлена. Функции 
+получаются из gf2RedTrinomialX() и gf2RedPentanomial() подстановкой 
+констант вместо полей gf2_trinom_st / gf2_pentanom_st. Это позволяет 
+компилятору вычислить сдвиги и индексы заранее и развернуть циклы.
+
+Макрос _GF2_RED(a, i, hi, d) прибавляет к a моном hi x^{B_PER_W i - d}.
+Если d кратно B_PER_W, то слово a[i - d / B_PER_W - 1] не меняется 
+(сдвиг выполняется в два этапа, чтобы избежать сдвига на B_PER_W).
+
+Функции gf2MulXXX() и gf2SqrXXX() выбираются в gf2Create() при совпадении 
+описания многочлена со стандартным.
+
+Для стандартных полей обращение выполняется по алгоритму Ито -- Цудзии:
+a^{-1} = (a^{2^{m - 1} - 1})^2, причем a^{2^{m - 1} - 1} вычисляется по
+аддитивной цепочке для m - 1 с помощью соотношений
+	a^{2^{2k} - 1} = (a^{2^k - 1})^{2^k} a^{2^k - 1},
+	a^{2^{k + 1} - 1} = (a^{2^k - 1})^2 a.
+Требуется m - 1 возведений в квадрат и не более 2 log_2(m) умножений.
+Последовательность операций зависит только от m, т.е. обращение выполняется
+за постоянное время (в отличие от ppInvMod()). Деление сводится к
+обращению и умножению.
+
+Для стандартных полей след tr(a) является суммой нескольких разрядов a
+(tr(x^i) = 1 только для i из короткого списка, который рассчитан заранее 
+по тождествам Ньютона). Поэтому gf2Tr() для таких полей выполняется 
+без возведений в квадрат. Для ускорения gf2QSolve() этого достаточно:
+проверка следа становится бесплатной, а полуслед по-прежнему вычисляется
+последовательными возведениями в квадрат. Таблицы полуследов не 
+используются: описание поля создается при каждом вызове функций dstu, 
+и расчет таблиц обошелся бы дороже, чем дает выигрыш.
+*******************************************************************************
+*/
+
+#define _GF2_RED_LO(a, i, hi, d)\
+	(a)[(i) - (d) / B_PER_W - 1] ^=\
+		(hi) << (B_PER_W - 1 - (d) % B_PER_W) << 1
+
+#define _GF2_RED_HI(a, i, hi, d)\
+	(a)[(i) - (d) / B_PER_W] ^= (hi) >> (d) % B_PER_W
+
+#define _GF2_RED(a, i, hi, d)\
+	_GF2_RED_LO(a, i, hi, d), _GF2_RED_HI(a, i, hi, d)
+
+#define _GF2_RED_TOP(a, i, hi, m, d)\
+	if ((d) / B_PER_W < (m) / B_PER_W)\
+		_GF2_RED_LO(a, i, hi, d);\
+	_GF2_RED_HI(a, i, hi, d)
+
+#define _GF2_STD_MUL(m)\
+static void gf2Mul##m(word c[], const word a[], const word b[],\
+	const qr_o* f, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	stack = prod + 2 * W_OF_B(m);\
+	ASSERT(gf2IsOperable(f) && gf2Deg(f) == (m));\
+	ASSERT(gf2IsIn(a, f));\
+	ASSERT(gf2IsIn(b, f));\
+	ppMul(prod, a, W_OF_B(m), b, W_OF_B(m), stack);\
+	gf2Red##m(prod);\
+	wwCopy(c, prod, W_OF_B(m));\
+}\
+\
+static void gf2Sqr##m(word b[], const word a[], const qr_o* f, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	stack = prod + 2 * W_OF_B(m);\
+	ASSERT(gf2IsOperable(f) && gf2Deg(f) == (m));\
+	ASSERT(gf2IsIn(a, f));\
+	ppSqr(prod, a, W_OF_B(m), stack);\
+	gf2Red##m(prod);\
+	wwCopy(b, prod, W_OF_B(m));\
+}\
+
+#define _GF2_STD_TRINOM(m, k)\
+static void gf2Red##m(word a[])\
+{\
+	register word hi;\
+	size_t i;\
+	for (i = 2 * W_OF_B(m) - 1; i > (m) / B_PER_W; --i)\
+	{\
+		hi = a[i];\
+		_GF2_RED(a, i, hi, (m));\
+		_GF2_RED(a, i, hi, (m) - (k));\
+	}\
+	hi = a[i] >> (m) % B_PER_W;\
+	a[0] ^= hi;\
+	hi <<= (m) % B_PER_W;\
+	_GF2_RED_TOP(a, i, hi, (m), (m) - (k));\
+	a[i] ^= hi;\
+	hi = 0;\
+}\
+\
+_GF2_STD_MUL(m)\
+
+#define _GF2_STD_PENTANOM(m, k, l, l1)\
+static void gf2Red##m(word a[])\
+{\
+	register word hi;\
+	size_t i;\
+	for (i = 2 * W_OF_B(m) - 1; i > (m) / B_PER_W; --i)\
+	{\
+		hi = a[i];\
+		_GF2_RED(a, i, hi, (m));\
+		_GF2_RED(a, i, hi, (m) - (l1));\
+		_GF2_RED(a, i, hi, (m) - (l));\
+		_GF2_RED(a, i, hi, (m) - (k));\
+	}\
+	hi = a[i] >> (m) % B_PER_W;\
+	a[0] ^= hi;\
+	hi <<= (m) % B_PER_W;\
+	_GF2_RED_TOP(a, i, hi, (m), (m) - (l1));\
+	_GF2_RED_TOP(a, i, hi, (m), (m) - (l));\
+	_GF2_RED_TOP(a, i, hi, (m), (m) - (k));\
+	a[i] ^= hi;\
+	hi = 0;\
+}\
+\
+_GF2_STD_MUL(m)\
+
+_GF2_STD_PENTANOM(163, 7, 6, 3)
+_GF2_STD_TRINOM(167, 6)
+_GF2_STD_PENTANOM(173, 10, 2, 1)
+_GF2_STD_PENTANOM(179, 4, 2, 1)
+_GF2_STD_TRINOM(191, 9)
+_GF2_STD_PENTANOM(233, 9, 4, 1)
+_GF2_STD_TRINOM(257, 12)
+_GF2_STD_PENTANOM(307, 8, 4, 2)
+_GF2_STD_TRINOM(367, 21)
+_GF2_STD_PENTANOM(431, 5, 3, 1)
+
+static void gf2InvStd(word b[], const word a[], const qr_o* f, void* stack)
+{
+	const size_t e = gf2Deg(f) - 1;
+	size_t k, i, pos;
+	word* u = (word*)stack;
+	word* t = u + f->n;
+	stack = t + f->n;
+	// pre
+	ASSERT(gf2IsOperable(f));
+	ASSERT(gf2IsIn(a, f));
+	ASSERT(e > 1);
+	// pos <- номер старшего разряда e
+	for (pos = 0; (e >> pos) > 1; ++pos);
+	// u <- a, b <- a = a^{2^1 - 1}
+	qrCopy(u, a, f);
+	qrCopy(b, u, f), k = 1;
+	// цепочка
+	while (pos--)
+	{
+		// b <- b^{2^k} b = a^{2^{2k} - 1}
+		qrCopy(t, b, f);
+		for (i = 0; i < k; ++i)
+			qrSqr(t, t, f, stack);
+		qrMul(b, b, t, f, stack), k *= 2;
+		// b <- b^2 u = a^{2^{k + 1} - 1}?
+		if ((e >> pos) & 1)
+		{
+			qrSqr(b, b, f, stack);
+			qrMul(b, b, u, f, stack), ++k;
+		}
+	}
+	ASSERT(k == e);
+	// b <- b^2 = a^{2^m - 2}
+	qrSqr(b, b, f, stack);
+	// очистка
+	qrSetZero(u, f);
+}
+
+static size_t gf2InvStd_deep(size_t n)
+{
+	return O_OF_W(4 * n) + 
+		utilMax(2,
+			ppMul_deep(n, n),
+			ppSqr_deep(n));
+}
+
+static void gf2DivStd(word b[], const word divident[], const word a[], 
+	const qr_o* f, void* stack)
+{
+	word* t = (word*)stack;
+	stack = t + f->n;
+	// pre
+	ASSERT(gf2IsOperable(f));
+	ASSERT(gf2IsIn(divident, f));
+	// b <- divident * a^{-1}
+	gf2InvStd(t, a, f, stack);
+	qrMul(b, divident, t, f, stack);
+}
+
+static size_t gf2DivStd_deep(size_t n)
+{
+	return O_OF_W(n) + gf2InvStd_deep(n);
+}
+
+static const struct
+{
+	size_t p[4];		/*< описание многочлена */
+	size_t tr[4];		/*< разряды следа (кроме 0, 0 -- конец) */
+	qr_mul_i mul;		/*< умножение */
+	qr_sqr_i sqr;		/*< возведение в квадрат */
+} _gf2_std[] =
+{
+	{{163, 7, 6, 3}, {157}, gf2Mul163, gf2Sqr163},
+	{{167, 6, 0, 0}, {161}, gf2Mul167, gf2Sqr167},
+	{{173, 10, 2, 1}, {163, 171}, gf2Mul173, gf2Sqr173},
+	{{179, 4, 2, 1}, {175, 177}, gf2Mul179, gf2Sqr179},
+	{{191, 9, 0, 0}, {0}, gf2Mul191, gf2Sqr191},
+	{{233, 9, 4, 1}, {229}, gf2Mul233, gf2Sqr233},
+	{{257, 12, 0, 0}, {245}, gf2Mul257, gf2Sqr257},
+	{{307, 8, 4, 2}, {299, 303, 305}, gf2Mul307, gf2Sqr307},
+	{{367, 21, 0, 0}, {0}, gf2Mul367, gf2Sqr367},
+	{{431, 5, 3, 1}, {0}, gf2Mul431, gf2Sqr431},
+};
+
+static void gf2SetStd(qr_o* f, const size_t p[4])
+{
+	size_t i;
+	for (i = 0; i < COUNT_OF(_gf2_std); ++i)
+		if (memEq(_gf2_std[i].p, p, sizeof(_gf2_std[i].p)))
+		{
+			f->mul = _gf2_std[i].mul;
+			f->sqr = _gf2_std[i].sqr;
+			f->inv = gf2InvStd;
+			f->div = gf2DivStd;
+			f->deep = utilMax(2, f->deep, gf2DivStd_deep(f->n));
+			break;
+		}
+}
+
+static size_t gf2FindStd(const qr_o* f)
+{
+	size_t i;
+	for (i = 0; i < COUNT_OF(_gf2_std); ++i)
+		if (f->mul == _gf2_std[i].mul)
+			break;
+	return i;
+}
+
 /*
 *******************************************************************************
 Управление описанием поля
@@ -520,6 +764,8 @@ bool_t gf2Create(qr_o* f, const size_t p[4], void* stack)
 			gf2Inv_deep(f->n),
 			gf2Div_deep(f->n));
 	}
+	// стандартный многочлен?
+	gf2SetStd(f, p);
 	return TRUE;
 }
 
@@ -536,7 +782,7 @@ size_t gf2Create_keep(size_t m)
 size_t gf2Create_deep(size_t m)
 {
 	const size_t n = W_OF_B(m);
-	return utilMax(8, 
+	return utilMax(9, 
 		gf2MulTrinomial0_deep(n),
 		gf2SqrTrinomial0_deep(n),
 		gf2MulTrinomial1_deep(n),
@@ -544,7 +790,8 @@ size_t gf2Create_deep(size_t m)
 		gf2MulPentanomial_deep(n),
 		gf2SqrPentanomial_deep(n),
 		gf2Inv_deep(n),
-		gf2Div_deep(n));
+		gf2Div_deep(n),
+		gf2DivStd_deep(n));
 }
 
 bool_t gf2IsOperable(const qr_o* f)
@@ -615,11 +862,20 @@ size_t gf2Deg(const qr_o* f)
 bool_t gf2Tr(const word a[], const qr_o* f, void* stack)
 {
 	size_t m = gf2Deg(f);
+	size_t i;
 	word* t = (word*)stack;
 	stack = t + f->n;
 	// pre
 	ASSERT(gf2IsOperable(f));
 	ASSERT(gf2IsIn(a, f));
+	// стандартное поле?
+	if ((i = gf2FindStd(f)) < COUNT_OF(_gf2_std))
+	{
+		word w = a[0];
+		for (m = 0; m < COUNT_OF(_gf2_std[i].tr) && _gf2_std[i].tr[m]; ++m)
+			w ^= wwGetBits(a, _gf2_std[i].tr[m], 1);
+		return (bool_t)(w & 1);
+	}
 	// t <- sum_{i = 0}^{m - 1} a^{2^i}
 	qrCopy(t, a, f);
 	while (--m)
@@ -4,7 +4,7 @@
 \brief Prime fields
 \project bee2 [cryptographic library]
 \created 2012.07.11
-\version 2014.04.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,9 +12,11 @@
 
 #include "bee2/core/mem.h"
 #include "bee2/core/util.h"
+#include "bee2/core/word.h"
 #include "bee2/math/gfp.h"
 #include "bee2/math/pri.h"
 #include "bee2/math/ww.h"
+#include "bee2/math/zz.h"
 
 /*
 *******************************************************************************
@@ -77,3 +79,217 @@ size_t gfpIsValid_deep(size_t n)
 {
 	return priIsPrime_deep(n);
 }
+
+/*
+*******************************************************************************
+Квадратный корень
+
+При p \equiv 3 \mod 4 корень из квадратичного вычета a равен 
+a^{(p + 1) / 4} mod p. Если p = 2^k - c, где c < 2^B_PER_W (таковы, 
+например, модули стандартных кривых bign), то показатель имеет вид
+	e = (p + 1) / 4 = 2^{k - 2} - c',  c' = (c - 1) / 4,
+и раскладывается как
+	e = (2^q - 1) 2^r + h,  r = bitlen(c'), q = k - 2 - r, h = 2^r - c'.
+Степень a^{2^q - 1} определяется с помощью аддитивной цепочки
+	a^{2^{2j} - 1} = (a^{2^j - 1})^{2^j} a^{2^j - 1},
+	a^{2^{j + 1} - 1} = (a^{2^j - 1})^2 a,
+которая строится по двоичной записи q. После этого выполняется r 
+возведений в квадрат, которые совмещаются с умножениями на a по схеме
+Горнера для h. Всего требуется k - 2 возведений в квадрат и 
+(примерно) 2 log_2(q) + wt(h) умножений, тогда как в qrPower() --
+k - 2 возведений в квадрат и (примерно) k / 5 умножений. 
+
+Для модулей другого вида используется qrPower().
+
+При p \equiv 1 \mod 4 используется алгоритм Тонелли -- Шенкса 
+[Cohen, A course in Computational Algebraic Number Theory, алгоритм 1.5.1]:
+	p - 1 = 2^s q, q -- нечетное, z -- квадратичный невычет
+	c <- z^q, x <- a^{(q + 1) / 2}, t <- a^q, m <- s
+	while t != 1
+	  i <- min{i: t^{2^i} = 1} // если i == m, то a -- невычет
+	  c <- c^{2^{m - i - 1}}
+	  x <- x c, c <- c^2, t <- t c, m <- i
+	return x
+Невычет z ищется перебором z = 2, 3,... с помощью zzJacobi(). Степени
+x и t определяются по одному возведению в степень (q - 1) / 2.
+*******************************************************************************
+*/
+
+static bool_t gfpSqrtTS(word b[], const word a[], const qr_o* f, 
+	void* stack)
+{
+	const size_t n = f->n;
+	size_t s, m, i;
+	word z;
+	int j;
+	// переменные в stack
+	word* x = (word*)stack;
+	word* t = x + n;
+	word* c = t + n;
+	word* e = c + n;
+	stack = e + n;
+	// pre
+	ASSERT(f->mod[0] % 4 == 1);
+	// a == 0?
+	if (qrIsZero(a, f))
+	{
+		qrSetZero(b, f);
+		return TRUE;
+	}
+	// e <- q: p - 1 = 2^s q
+	wwCopy(e, f->mod, n);
+	e[0] ^= 1;
+	s = wwLoZeroBits(e, n);
+	wwShLo(e, n, s);
+	// z <- квадратичный невычет
+	for (z = 2; (j = zzJacobi(&z, 1, f->mod, n, stack)) != -1; ++z)
+		if (j == 0)
+			return FALSE;
+	// c <- z^q
+	wwSetW(c, n, z);
+	wwTo((octet*)c, f->no, c);
+	if (!qrFrom(c, (octet*)c, f, stack))
+		return FALSE;
+	qrPower(c, c, e, n, f, stack);
+	// x <- a^{(q - 1) / 2}, t <- x^2 a = a^q, x <- x a = a^{(q + 1) / 2}
+	wwShLo(e, n, 1);
+	qrPower(x, a, e, n, f, stack);
+	qrSqr(t, x, f, stack);
+	qrMul(t, t, a, f, stack);
+	qrMul(x, x, a, f, stack);
+	// основной цикл
+	for (m = s; !qrIsUnity(t, f); m = i)
+	{
+		// i <- min{i: t^{2^i} = 1}
+		qrCopy(e, t, f);
+		i = 0;
+		do
+		{
+			qrSqr(e, e, f, stack);
+			++i;
+		}
+		while (i < m && !qrIsUnity(e, f));
+		if (i == m)
+			return FALSE;
+		// c <- c^{2^{m - i - 1}}
+		while (--m > i)
+			qrSqr(c, c, f, stack);
+		// x <- x c, c <- c^2, t <- t c
+		qrMul(x, x, c, f, stack);
+		qrSqr(c, c, f, stack);
+		qrMul(t, t, c, f, stack);
+	}
+	qrCopy(b, x, f);
+	return TRUE;
+}
+
+static size_t gfpSqrtTS_deep(size_t n, size_t f_deep)
+{
+	return O_OF_W(4 * n) +
+		utilMax(3,
+			f_deep,
+			zzJacobi_deep(1, n),
+			qrPower_deep(n, n, f_deep));
+}
+
+bool_t gfpSqrt(word b[], const word a[], const qr_o* f, void* stack)
+{
+	const size_t n = f->n;
+	size_t k, q, r, j, i;
+	word c, h;
+	bool_t spec;
+	// переменные в stack
+	word* t;
+	word* u;
+	// pre
+	ASSERT(gfpIsOperable(f));
+	ASSERT(zmIsIn(a, f));
+	// p \equiv 1 \mod 4?
+	if (f->mod[0] % 4 == 1)
+		return gfpSqrtTS(b, a, f, stack);
+	// раскладка stack
+	t = (word*)stack;
+	u = t + n;
+	stack = u + n;
+	// p = 2^k - c?
+	k = wwBitSize(f->mod, n);
+	c = WORD_0 - f->mod[0];
+	wwCopy(t, f->mod, n);
+	if (zzAddW2(t, n, c))
+		c = wwIsZero(t, n) && k == B_PER_W * n ? c : 0;
+	else if (k < B_PER_W * n && wwTestBit(t, k))
+	{
+		wwSetBit(t, k, 0);
+		c = wwIsZero(t, n) ? c : 0;
+	}
+	else
+		c = 0;
+	// q, r, h
+	spec = FALSE;
+	if (c)
+	{
+		c >>= 2;
+		r = wwBitSize(&c, 1);
+		h = (WORD_1 << r) - c;
+		spec = k > r + 2;
+		q = k - 2 - r;
+	}
+	// общий модуль
+	if (!spec)
+	{
+		// u <- (p + 1) / 4
+		wwCopy(u, f->mod, n);
+		wwShLo(u, n, 2);
+		zzAddW2(u, n, 1);
+		// t <- a^u
+		qrPower(t, a, u, n, f, stack);
+	}
+	// специальный модуль
+	else
+	{
+		// t <- a^{2^q - 1}
+		qrCopy(t, a, f);
+		for (i = 0; (q >> i) > 1; ++i);
+		for (j = 1; i--;)
+		{
+			size_t s;
+			qrCopy(u, t, f);
+			for (s = 0; s < j; ++s)
+				qrSqr(t, t, f, stack);
+			qrMul(t, t, u, f, stack);
+			j *= 2;
+			if ((q >> i) & 1)
+			{
+				qrSqr(t, t, f, stack);
+				qrMul(t, t, a, f, stack);
+				++j;
+			}
+		}
+		ASSERT(j == q);
+		// t <- t^{2^r} a^h
+		if (h >> r)
+			qrMul(t, t, a, f, stack);
+		for (i = r; i--;)
+		{
+			qrSqr(t, t, f, stack);
+			if ((h >> i) & 1)
+				qrMul(t, t, a, f, stack);
+		}
+	}
+	// t^2 == a?
+	qrSqr(u, t, f, stack);
+	if (qrCmp(u, a, f) != 0)
+		return FALSE;
+	qrCopy(b, t, f);
+	return TRUE;
+}
+
+size_t gfpSqrt_deep(size_t n, size_t f_deep)
+{
+	return utilMax(2,
+		O_OF_W(2 * n) + 
+			utilMax(2,
+				f_deep,
+				qrPower_deep(n, n, f_deep)),
+		gfpSqrtTS_deep(n, f_deep));
+}
@@ -4,13 +4,14 @@
 \brief Binary polynomials
 \project bee2 [cryptographic library]
 \created 2012.03.01
-\version 2021.04.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/util.h"
 #include "bee2/math/pp.h"
 #include "bee2/math/ww.h"
@@ -845,9 +846,10 @@ size_t ppAddMulW_deep(size_t n)
 В массиве _mul_funcs задаются базовые функции умножения многочленов малой
 одинаковой длины.
 
-Функция _ppMulEq() реализует умножение многочленов одинаковой длины.
-Используются функции из таблицы _mul_funcs либо алгоритм Карацубы
-(возможно усеченный).
+Функция ppMulEq() реализует умножение многочленов одинаковой длины.
+Используются функции из таблицы procs либо алгоритм Карацубы
+(возможно усеченный). Функция ppMulEqPP() использует таблицу _mul_procs,
+функция ppMulEqCL() (см. далее) -- таблицу _mul_procs_cl.
 
 deep1(_ppMulEq, n) =
 	max(deep1(_ppMulEq, m), deep1(_ppMulEq, n - m))	+ 4 * m,
@@ -865,29 +867,29 @@ static const _pp_mul_proc _mul_procs[] =
 };
 
 static void ppMulEq(word c[], const word a[], const word b[], size_t n,
-	void* stack)
+	const _pp_mul_proc procs[], size_t count, void* stack)
 {
 	ASSERT(wwIsDisjoint2(a, n, c, 2 * n));
 	ASSERT(wwIsDisjoint2(b, n, c, 2 * n));
 	// умножение многочленов малой длины
-	if (n < COUNT_OF(_mul_procs))
-		_mul_procs[n](c, a, b, stack);
+	if (n < count)
+		procs[n](c, a, b, stack);
 	// усеченный алгоритм Карацубы, n --- четное
 	else if ((n & 1) == 0)
 	{
 		word* t = (word*)stack;
 		size_t m = n / 2, i;
 		// c1 || c0 <- a0 b0
-		ppMulEq(c, a, b, m, t);
+		ppMulEq(c, a, b, m, procs, count, t);
 		// c3 || c2 <- a1 b1
-		ppMulEq(c + 2 * m, a + m, b + m, m, t);
+		ppMulEq(c + 2 * m, a + m, b + m, m, procs, count, t);
 		// t0 <- a0 + a1, t1 <- b0 + b1, t2 <- c1 + c2
 		for (i = 0; i < m; ++i)
 			t[i] = a[i] ^ a[m + i],
 			t[m + i] = b[i] ^ b[m + i],
 			t[2 * m + i] = c[m + i] ^ c[2 * m + i];
 		// c2 || c1 <- t0 t1
-		ppMulEq(c + m, t, t + m, m, t + 3 * m);
+		ppMulEq(c + m, t, t + m, m, procs, count, t + 3 * m);
 		// c1 <- c1 + c0 + t2, c2 <- c2 + c3 + t2
 		for (i = 0; i < m; ++i)
 			c[m + i] ^= c[i] ^ t[2 * m + i],
@@ -899,9 +901,9 @@ static void ppMulEq(word c[], const word a[], const word b[], size_t n,
 		word* t = (word*)stack;
 		size_t m = (n + 1) / 2, i;
 		// c1 || c0 <- a0 b0
-		ppMulEq(c, a, b, m, t);
+		ppMulEq(c, a, b, m, procs, count, t);
 		// c3 || c2 <- a1 b1
-		ppMulEq(c + 2 * m, a + m, b + m, n - m, t);
+		ppMulEq(c + 2 * m, a + m, b + m, n - m, procs, count, t);
 		// t0 <- a0 + a1, t1 <- b0 + b1, t2 <- c1 + c2
 		for (i = 0; i + 1 < m; ++i)
 			t[i] = a[i] ^ a[m + i],
@@ -911,7 +913,7 @@ static void ppMulEq(word c[], const word a[], const word b[], size_t n,
 		t[m + i] = b[i];
 		t[2 * m + i] = c[m + i] ^ c[2 * m + i];
 		// c2 || c1 <- t0 t1
-		ppMulEq(c + m, t, t + m, m, t + 3 * m);
+		ppMulEq(c + m, t, t + m, m, procs, count, t + 3 * m);
 		// c1 <- c1 + c0 + t2, c2 <- c2 + c3 + t2
 		for (i = 0; i + 2 < m; ++i)
 			c[m + i] ^= c[i] ^ t[2 * m + i],
@@ -924,6 +926,17 @@ static void ppMulEq(word c[], const word a[], const word b[], size_t n,
 	}
 }
 
+static void ppMulEqPP(word c[], const word a[], const word b[], size_t n,
+	void* stack)
+{
+	ppMulEq(c, a, b, n, _mul_procs, COUNT_OF(_mul_procs), stack);
+}
+
+static void ppMulEqFirst(word c[], const word a[], const word b[], size_t n,
+	void* stack);
+static void (*_pp_mul_eq)(word c[], const word a[], const word b[], size_t n,
+	void* stack) = ppMulEqFirst;
+
 void ppMul(word c[], const word a[], size_t n, const word b[], size_t m,
 	void* stack)
 {
@@ -937,7 +950,7 @@ void ppMul(word c[], const word a[], size_t n, const word b[], size_t m,
 	}
 	// умножение многочленов одинаковой длины
 	if (n == m)
-		ppMulEq(c, a, b, n, stack);
+		_pp_mul_eq(c, a, b, n, stack);
 	// длина a меньше длины b?
 	else if (n < m)
 		ppMul(c, b, m, a, n, stack);
@@ -946,7 +959,7 @@ void ppMul(word c[], const word a[], size_t n, const word b[], size_t m,
 	{
 		size_t i;
 		// умножаем части одинаковой длины
-		ppMulEq(c, a, b, m, stack);
+		_pp_mul_eq(c, a, b, m, stack);
 		// готовим старшую часть произведения
 		wwSetZero(c + 2 * m, n - m);
 		// умножаем старшие слова a на b
@@ -1099,7 +1112,7 @@ static const word _squares[256] =
 	#error "Unsupported word size"
 #endif
 
-void ppSqr(word b[], const word a[], size_t n, void* stack)
+static void ppSqrPP(word b[], const word a[], size_t n, void* stack)
 {
 	size_t i;
 	ASSERT(wwIsDisjoint2(a, n, b, 2 * n));
@@ -1108,6 +1121,179 @@ void ppSqr(word b[], const word a[], size_t n, void* stack)
 		b[i + i + 1] = _SQR_HI(a[i]);
 }
 
+/*
+*******************************************************************************
+Умножение и возведение в квадрат: PCLMULQDQ
+
+На платформе x86-64 при сборке компиляторами GCC и Clang дополнительно 
+реализовано умножение слов-многочленов с помощью инструкции PCLMULQDQ 
+(carry-less multiplication). Многочлены длины 2 и 4 перемножаются 
+по алгоритму Карацубы (3 и 9 инструкций), многочлены длины 3 -- по 
+схеме Карацубы для трех слагаемых (6 инструкций). Многочлены большей 
+длины обрабатываются в ppMulEq() с таблицей _mul_procs_cl. Глубина стека 
+при этом не превосходит глубины для переносимой реализации. Квадрат слова 
+также определяется с помощью PCLMULQDQ.
+
+Реализация PCLMULQDQ выбирается при первом обращении к ppMul() или ppSqr() 
+по результатам инструкции cpuid.
+*******************************************************************************
+*/
+
+#if defined(__GNUC__) && defined(__x86_64__) && (B_PER_W == 64)
+
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#define PP_CLMUL __attribute__((target("pclmul,sse2")))
+
+PP_CLMUL static inline __m128i ppClMulW(word a, word b)
+{
+	return _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a),
+		_mm_cvtsi64_si128((long long)b), 0x00);
+}
+
+PP_CLMUL static inline void ppClStore(word c[2], __m128i t)
+{
+	_mm_storeu_si128((__m128i*)c, t);
+}
+
+PP_CLMUL static inline void ppClXor(word c[2], __m128i t)
+{
+	_mm_storeu_si128((__m128i*)c, 
+		_mm_xor_si128(_mm_loadu_si128((const __m128i*)c), t));
+}
+
+PP_CLMUL static void ppMul1CL(word c[2], const word a[1], const word b[1],
+	void* stack)
+{
+	ppClStore(c, ppClMulW(a[0], b[0]));
+}
+
+PP_CLMUL static void ppMul2CL(word c[4], const word a[2], const word b[2],
+	void* stack)
+{
+	__m128i lo, hi, mid;
+	lo = ppClMulW(a[0], b[0]);
+	hi = ppClMulW(a[1], b[1]);
+	mid = ppClMulW(a[0] ^ a[1], b[0] ^ b[1]);
+	mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+	ppClStore(c, lo);
+	ppClStore(c + 2, hi);
+	ppClXor(c + 1, mid);
+}
+
+PP_CLMUL static void ppMul3CL(word c[6], const word a[3], const word b[3],
+	void* stack)
+{
+	__m128i d0, d1, d2, t;
+	d0 = ppClMulW(a[0], b[0]);
+	d1 = ppClMulW(a[1], b[1]);
+	d2 = ppClMulW(a[2], b[2]);
+	// c <- d0 + d2 x^4
+	ppClStore(c, d0);
+	ppClStore(c + 2, _mm_setzero_si128());
+	ppClStore(c + 4, d2);
+	// c <- c + ((a0 + a1)(b0 + b1) + d0 + d1) x
+	t = ppClMulW(a[0] ^ a[1], b[0] ^ b[1]);
+	ppClXor(c + 1, _mm_xor_si128(t, _mm_xor_si128(d0, d1)));
+	// c <- c + ((a0 + a2)(b0 + b2) + d0 + d1 + d2) x^2
+	t = ppClMulW(a[0] ^ a[2], b[0] ^ b[2]);
+	t = _mm_xor_si128(t, _mm_xor_si128(d0, d1));
+	ppClXor(c + 2, _mm_xor_si128(t, d2));
+	// c <- c + ((a1 + a2)(b1 + b2) + d1 + d2) x^3
+	t = ppClMulW(a[1] ^ a[2], b[1] ^ b[2]);
+	ppClXor(c + 3, _mm_xor_si128(t, _mm_xor_si128(d1, d2)));
+}
+
+PP_CLMUL static void ppMul4CL(word c[8], const word a[4], const word b[4],
+	void* stack)
+{
+	word* t = (word*)stack;
+	// c1 || c0 <- a0 b0, c3 || c2 <- a1 b1
+	ppMul2CL(c, a, b, 0);
+	ppMul2CL(c + 4, a + 2, b + 2, 0);
+	// t1 || t0 <- (a0 + a1)(b0 + b1) + a0 b0 + a1 b1
+	t[4] = a[0] ^ a[2], t[5] = a[1] ^ a[3];
+	t[6] = b[0] ^ b[2], t[7] = b[1] ^ b[3];
+	ppMul2CL(t, t + 4, t + 6, 0);
+	t[0] ^= c[0] ^ c[4], t[1] ^= c[1] ^ c[5];
+	t[2] ^= c[2] ^ c[6], t[3] ^= c[3] ^ c[7];
+	// c <- c + t x^2
+	c[2] ^= t[0], c[3] ^= t[1], c[4] ^= t[2], c[5] ^= t[3];
+}
+
+static const _pp_mul_proc _mul_procs_cl[] =
+{
+	0,
+	ppMul1CL, ppMul2CL, ppMul3CL, ppMul4CL,
+};
+
+static void ppMulEqCL(word c[], const word a[], const word b[], size_t n,
+	void* stack)
+{
+	ppMulEq(c, a, b, n, _mul_procs_cl, COUNT_OF(_mul_procs_cl), stack);
+}
+
+PP_CLMUL static void ppSqrCL(word b[], const word a[], size_t n, 
+	void* stack)
+{
+	size_t i;
+	ASSERT(wwIsDisjoint2(a, n, b, 2 * n));
+	for (i = 0; i < n; ++i)
+		ppClStore(b + i + i, ppClMulW(a[i], a[i]));
+}
+
+#endif
+
+/*
+*******************************************************************************
+Выбор реализации
+*******************************************************************************
+*/
+
+static void ppSqrFirst(word b[], const word a[], size_t n, void* stack);
+
+static size_t _once;
+static void (*_pp_sqr)(word b[], const word a[], size_t n, void* stack) = 
+	ppSqrFirst;
+
+static void ppSelect()
+{
+#ifdef PP_CLMUL
+	u32 info[4];
+	// PCLMULQDQ и SSE2?
+	if (__get_cpuid(1, info, info + 1, info + 2, info + 3) &&
+		(info[2] & 0x00000002) && (info[3] & 0x04000000))
+	{
+		_pp_mul_eq = ppMulEqCL;
+		_pp_sqr = ppSqrCL;
+		return;
+	}
+#endif
+	_pp_mul_eq = ppMulEqPP;
+	_pp_sqr = ppSqrPP;
+}
+
+static void ppMulEqFirst(word c[], const word a[], const word b[], size_t n,
+	void* stack)
+{
+	mtCallOnce(&_once, ppSelect);
+	_pp_mul_eq(c, a, b, n, stack);
+}
+
+static void ppSqrFirst(word b[], const word a[], size_t n, void* stack)
+{
+	mtCallOnce(&_once, ppSelect);
+	_pp_sqr(b, a, n, stack);
+}
+
+void ppSqr(word b[], const word a[], size_t n, void* stack)
+{
+	ASSERT(wwIsDisjoint2(a, n, b, 2 * n));
+	_pp_sqr(b, a, n, stack);
+}
+
 size_t ppSqr_deep(size_t n)
 {
 	return 0;
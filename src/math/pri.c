@@ -4,13 +4,14 @@
 \brief Prime numbers
 \project bee2 [cryptographic library]
 \created 2012.08.13
-\version 2016.07.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
 #include "bee2/core/prng.h"
 #include "bee2/core/util.h"
 #include "bee2/core/word.h"
@@ -736,6 +737,155 @@ size_t priIsSGPrime_deep(size_t n)
 			qrPower_deep(n + 1, n, qr_deep));
 }
 
+/*
+*******************************************************************************
+Решето
+
+Кандидаты в простые образуют арифметическую прогрессию p + j * s.
+Вместо пересчета вычетов каждого кандидата по модулям _base[i]
+поддерживаются смещения offs[i] -- номера ближайших кандидатов, которые
+делятся на _base[i]. Окно из PRI_SIEVE_SIZE последовательных кандидатов
+просеивается целиком: в битовой карте sieve отмечаются кандидаты с
+номерами offs[i], offs[i] + _base[i],... Затраты на окно составляют
+около PRI_SIEVE_SIZE * \sum_i 1 / _base[i] + base_count операций
+вместо PRI_SIEVE_SIZE * base_count при поэлементном пересчете.
+
+Если s \equiv 0 \mod _base[i], то кандидаты не делятся на _base[i] (в
+вызывающих функциях это гарантируется) и offs[i] = WORD_MAX.
+После просеивания offs[i] указывают на кандидатов следующего окна.
+*******************************************************************************
+*/
+
+#define PRI_SIEVE_SIZE 1024
+
+static word priInvModW(register word a, register word mod)
+{
+	register word b = mod;
+	register word u = 1;
+	register word v = 0;
+	register word q;
+	ASSERT(0 < a && a < mod);
+	// инвариант: a \equiv u a_0, b \equiv -v a_0 \mod mod
+	while (1)
+	{
+		if (a == 1)
+			break;
+		q = b / a, b -= q * a, v += q * u;
+		if (b == 1)
+		{
+			u = mod - v;
+			break;
+		}
+		q = a / b, a -= q * b, u += q * v;
+	}
+	a = b = v = q = 0;
+	return u;
+}
+
+static void priSieve(word sieve[], word offs[], size_t base_count)
+{
+	size_t i;
+	register word j;
+	wwSetZero(sieve, W_OF_B(PRI_SIEVE_SIZE));
+	for (i = 0; i < base_count; ++i)
+	{
+		if (offs[i] == WORD_MAX)
+			continue;
+		for (j = offs[i]; j < PRI_SIEVE_SIZE; j += _base[i])
+			sieve[j / B_PER_W] |= WORD_1 << j % B_PER_W;
+		offs[i] = j - PRI_SIEVE_SIZE;
+	}
+}
+
+/*
+*******************************************************************************
+Параллельная проверка
+
+Кандидаты окна с номерами 0, 1,..., count - 1 проверяются функцией test
+в threads потоках. Потоки атомарно выбирают очередной номер j из счетчика
+next, пропускают отсеянных кандидатов и сохраняют в found минимальный номер
+кандидата, прошедшего проверку. Поток прекращает работу, если выбранный
+номер превосходит found. Номера выбираются по возрастанию, поэтому к
+моменту завершения проверены все кандидаты с номерами меньше found и
+результат совпадает с результатом последовательной проверки.
+
+Потоки -- это участки mtPoolFor() в пуле по умолчанию. Каждому потоку
+выделяется собственный участок стека. Если потоков в пуле меньше, чем
+threads, то оставшиеся участки выполняются позже и застают перебор
+завершенным.
+*******************************************************************************
+*/
+
+#define PRI_MT_THREADS 16
+
+typedef struct
+{
+	bool_t (*test)(const void* ctx, size_t j, void* stack);
+	const void* ctx;		/*!< контекст проверки */
+	const word* sieve;		/*!< решето */
+	size_t count;			/*!< число кандидатов */
+	size_t next;			/*!< следующий номер */
+	size_t found;			/*!< минимальный номер простого */
+} pri_par_st;
+
+typedef struct
+{
+	pri_par_st* par;		/*!< общее состояние */
+	void* stack;			/*!< участок стека */
+} pri_worker_st;
+
+static size_t priParThreads(size_t threads)
+{
+	return MAX2(MIN2(threads, PRI_MT_THREADS), 1);
+}
+
+static void priParStep(void* arg)
+{
+	pri_worker_st* worker = (pri_worker_st*)arg;
+	pri_par_st* par = worker->par;
+	size_t j;
+	size_t found;
+	while (1)
+	{
+		j = mtAtomicIncr(&par->next) - 1;
+		if (j >= par->count || j > mtAtomicLoad(&par->found))
+			break;
+		if (wwTestBit(par->sieve, j) || !par->test(par->ctx, j, worker->stack))
+			continue;
+		// found <- min(found, j)
+		do
+			found = mtAtomicLoad(&par->found);
+		while (j < found && mtAtomicCmpSwap(&par->found, found, j) != found);
+		break;
+	}
+}
+
+static void priParRange(size_t from, size_t to, void* arg)
+{
+	pri_worker_st* worker = (pri_worker_st*)arg;
+	for (; from < to; ++from)
+		priParStep(worker + from);
+}
+
+static size_t priParRun(bool_t (*test)(const void*, size_t, void*),
+	const void* ctx, const word sieve[], size_t count, size_t threads,
+	void* stack, size_t block)
+{
+	pri_par_st par[1];
+	pri_worker_st worker[PRI_MT_THREADS];
+	size_t i;
+	ASSERT(0 < threads && threads <= PRI_MT_THREADS);
+	par->test = test, par->ctx = ctx, par->sieve = sieve;
+	par->count = count, par->next = 0, par->found = SIZE_MAX;
+	for (i = 0; i < threads; ++i)
+		worker[i].par = par, worker[i].stack = (octet*)stack + i * block;
+	// малое окно: без дополнительных потоков
+	if (count < 2 * threads)
+		threads = 1;
+	mtPoolFor(0, threads, priParRange, worker);
+	return par->found;
+}
+
 /*
 *******************************************************************************
 Следующее простое
@@ -771,20 +921,51 @@ size_t priNextPrimeW_deep()
 	return priIsPrimeW_deep();
 }
 
-bool_t priNextPrime(word p[], const word a[], size_t n, size_t trials,
-	size_t base_count, size_t iter, void* stack)
+typedef struct
+{
+	const word* p;		/*!< первый кандидат окна */
+	size_t n;			/*!< длина кандидатов */
+	size_t iter;		/*!< число итераций теста Рабина -- Миллера */
+} pri_next_st;
+
+static bool_t priNextPrimeTest(const void* ctx, size_t j, void* stack)
+{
+	const pri_next_st* next = (const pri_next_st*)ctx;
+	// переменные в stack
+	word* p = (word*)stack;
+	stack = p + next->n;
+	// p <- p + 2j
+	wwCopy(p, next->p, next->n);
+	VERIFY(zzAddW2(p, next->n, 2 * j) == 0);
+	// проверка
+	return priRMTest(p, next->n, next->iter, stack);
+}
+
+static size_t priNextPrimeTest_deep(size_t n)
+{
+	return O_OF_W(W_OF_O(O_OF_W(n) + priRMTest_deep(n)));
+}
+
+bool_t priNextPrimeMT(word p[], const word a[], size_t n, size_t trials,
+	size_t base_count, size_t iter, size_t threads, void* stack)
 {
 	size_t l;
 	size_t i;
-	bool_t base_success;
+	size_t count;
+	bool_t stop;
+	pri_next_st next[1];
 	// переменные в stack
-	word* mods;
+	word* offs;
+	word* sieve;
+	word* pw;
 	// pre
 	ASSERT(wwIsSameOrDisjoint(a, p, n));
 	ASSERT(base_count <= priBaseSize());
 	// раскладка stack
-	mods = (word*)stack;
-	stack = mods + base_count;
+	offs = (word*)stack;
+	sieve = offs + base_count;
+	pw = sieve + W_OF_B(PRI_SIEVE_SIZE);
+	stack = pw + n;
 	// l <- битовая длина a
 	l = wwBitSize(a, n);
 	// 0-битовых и 1-битовых простых не существует
@@ -798,39 +979,63 @@ bool_t priNextPrime(word p[], const word a[], size_t n, size_t trials,
 		// при необходимости скоррректировать факторную базу
 		while (base_count > 0 && priBasePrime(base_count - 1) >= p[0])
 			--base_count;
-	// рассчитать остатки от деления на малые простые
-	priBaseMod(mods, p, n, base_count);
-	for (i = 0, base_success = TRUE; i < base_count; ++i)
-		if (mods[i] == 0)
+	// offs[i] <- min j: p + 2j \equiv 0 \mod _base[i]
+	priBaseMod(offs, p, n, base_count);
+	for (i = 0; i < base_count; ++i)
+		if (offs[i])
+			offs[i] = (_base[i] - offs[i]) * ((_base[i] + 1) / 2) % _base[i];
+	// подготовить контекст проверки
+	next->p = pw, next->n = n, next->iter = iter;
+	threads = priParThreads(threads);
+	// цикл по окнам
+	for (stop = FALSE; !stop;)
+	{
+		// просеять окно
+		priSieve(sieve, offs, base_count);
+		wwCopy(pw, p, n);
+		// count <- число кандидатов окна с учетом trials и длины
+		for (count = 0; count < PRI_SIEVE_SIZE;)
 		{
-			base_success = FALSE;
-			break;
+			if (trials != SIZE_MAX && trials-- == 0)
+			{
+				stop = TRUE;
+				break;
+			}
+			++count;
+			if (zzAddW2(p, n, 2) || wwBitSize(p, n) > l)
+			{
+				stop = TRUE;
+				break;
+			}
 		}
-	// попытки
-	while (trials == SIZE_MAX || trials--)
-	{
 		// проверка простоты
-		if (base_success && priRMTest(p, n, iter, stack))
-			return TRUE;
-		// к следующему кандидату
-		if (zzAddW2(p, n, 2) || wwBitSize(p, n) > l)
-			return FALSE;
-		for (i = 0, base_success = TRUE; i < base_count; ++i)
+		i = priParRun(priNextPrimeTest, next, sieve, count, threads,
+			stack, priNextPrimeTest_deep(n));
+		if (i < count)
 		{
-			if (mods[i] < _base[i] - 2)
-				mods[i] += 2;
-			else if (mods[i] == _base[i] - 1)
-				mods[i] = 1;
-			else
-				mods[i] = 0, base_success = FALSE;
+			wwCopy(p, pw, n);
+			VERIFY(zzAddW2(p, n, 2 * i) == 0);
+			return TRUE;
 		}
 	}
 	return FALSE;
 }
 
+size_t priNextPrimeMT_deep(size_t n, size_t base_count, size_t threads)
+{
+	return O_OF_W(base_count + W_OF_B(PRI_SIEVE_SIZE) + n) +
+		priParThreads(threads) * priNextPrimeTest_deep(n);
+}
+
+bool_t priNextPrime(word p[], const word a[], size_t n, size_t trials,
+	size_t base_count, size_t iter, void* stack)
+{
+	return priNextPrimeMT(p, a, n, trials, base_count, iter, 1, stack);
+}
+
 size_t priNextPrime_deep(size_t n, size_t base_count)
 {
-	return base_count * O_PER_W + priRMTest_deep(n);
+	return priNextPrimeMT_deep(n, base_count, 1);
 }
 
 /*
@@ -860,19 +1065,99 @@ size_t priNextPrime_deep(size_t n, size_t base_count)
 *******************************************************************************
 */
 
-bool_t priExtendPrime(word p[], size_t l, const word q[], size_t n,
-	size_t trials, size_t base_count, gen_i rng, void* rng_state, void* stack)
+typedef struct
+{
+	const word* p;		/*!< первый кандидат окна */
+	const word* r;		/*!< множитель r первого кандидата */
+	const word* q;		/*!< базовое простое */
+	size_t m;			/*!< длина p */
+	size_t n;			/*!< длина q */
+	size_t mo;			/*!< длина p в октетах */
+} pri_ext_st;
+
+static void priExtendPrimeStep(word p[], const word pw[], const word q[],
+	size_t m, size_t n, size_t j)
+{
+	register word carry;
+	ASSERT(wwIsDisjoint2(p, m, pw, m) && wwIsDisjoint2(p, m, q, n));
+	// p <- pw + 2qj
+	wwSetZero(p + n, m - n);
+	carry = zzMulW(p, q, n, 2 * j);
+	if (m > n)
+		p[n] = carry;
+	else
+		ASSERT(carry == 0);
+	VERIFY(zzAdd2(p, pw, m) == 0);
+	carry = 0;
+}
+
+static bool_t priExtendPrimeTest(const void* ctx, size_t j, void* stack)
+{
+	const pri_ext_st* ext = (const pri_ext_st*)ctx;
+	const size_t m = ext->m;
+	const size_t n = ext->n;
+	// переменные в stack
+	word* p;
+	word* r;
+	word* t;
+	word* four;
+	qr_o* qr;
+	// раскладка stack
+	p = (word*)stack;
+	r = p + m;
+	t = r + m - n + 1;
+	four = t + m;
+	qr = (qr_o*)(four + m);
+	stack = (octet*)qr + zmCreate_keep(ext->mo);
+	// p <- p + 2qj, r <- r + j
+	priExtendPrimeStep(p, ext->p, ext->q, m, n, j);
+	wwCopy(r, ext->r, m - n + 1);
+	VERIFY(zzAddW2(r, m - n + 1, j) == 0);
+	// создать кольцо вычетов \mod p
+	wwTo(t, ext->mo, p);
+	zmCreate(qr, (octet*)t, ext->mo, stack);
+	// four <- 4 [в кольце qr]
+	qrAdd(four, qr->unity, qr->unity, qr);
+	qrAdd(four, four, four, qr);
+	// 4^r \mod p != 1?
+	qrPower(t, four, r, m - n + 1, qr, stack);
+	if (qrCmp(t, qr->unity, qr) == 0)
+		return FALSE;
+	// (4^r)^q \mod p == 1?
+	qrPower(t, t, ext->q, n, qr, stack);
+	return qrCmp(t, qr->unity, qr) == 0;
+}
+
+static size_t priExtendPrimeTest_deep(size_t l, size_t n)
+{
+	const size_t m = W_OF_B(l);
+	const size_t mo = O_OF_B(l);
+	const size_t qr_deep = zmCreate_deep(mo);
+	return O_OF_W(W_OF_O(O_OF_W(m + m - n + 1 + m + m) +
+		zmCreate_keep(mo) +
+		utilMax(2,
+			qr_deep,
+			qrPower_deep(m, m, qr_deep))));
+}
+
+bool_t priExtendPrimeMT(word p[], size_t l, const word q[], size_t n,
+	size_t trials, size_t base_count, size_t threads, gen_i rng,
+	void* rng_state, void* stack)
 {
 	const size_t m = W_OF_B(l);
 	const size_t mo = O_OF_B(l);
 	size_t i;
+	size_t count;
+	int stop;
+	pri_ext_st ext[1];
 	// переменные в stack
 	word* r;
 	word* t;
-	word* four;
-	word* mods;
-	word* mods1;
-	qr_o* qr;
+	word* offs;
+	word* invs;
+	word* sieve;
+	word* pw;
+	word* rw;
 	// pre
 	ASSERT(wwIsDisjoint2(q, n, p, m));
 	ASSERT(zzIsOdd(q, n) && wwCmpW(q, n, 3) >= 0);
@@ -884,17 +1169,31 @@ bool_t priExtendPrime(word p[], size_t l, const word q[], size_t n,
 	// раскладка stack
 	r = (word*)stack;
 	t = r + m - n + 1;
-	four = t + m + 1;
-	mods = four + m;
-	mods1 = mods + base_count;
-	qr = (qr_o*)(mods1 + base_count);
-	stack = (octet*)qr + zmCreate_keep(mo);
+	offs = t + m + 1;
+	invs = offs + base_count;
+	sieve = invs + base_count;
+	pw = sieve + W_OF_B(PRI_SIEVE_SIZE);
+	rw = pw + m;
+	stack = rw + m - n + 1;
 	// малое p?
 	if (l < B_PER_W)
 		// при необходимости уменьшить факторную базу
 		while (base_count > 0 && 
 			priBasePrime(base_count - 1) > WORD_BIT_POS(l - 1))
 			--base_count;
+	// invs[i] <- (2q)^{-1} \mod _base[i] (0, если обратного нет)
+	priBaseMod(invs, q, n, base_count);
+	for (i = 0; i < base_count; ++i)
+		if (invs[i])
+		{
+			if ((invs[i] += invs[i]) >= _base[i])
+				invs[i] -= _base[i];
+			invs[i] = priInvModW(invs[i], _base[i]);
+		}
+	// подготовить контекст проверки
+	ext->p = pw, ext->r = rw, ext->q = q, ext->m = m, ext->n = n;
+	ext->mo = mo;
+	threads = priParThreads(threads);
 	// попытки
 	while (trials == SIZE_MAX || trials--)
 	{
@@ -916,67 +1215,79 @@ bool_t priExtendPrime(word p[], size_t l, const word q[], size_t n,
 		wwShHi(p, m, 1);
 		++p[0];
 		ASSERT(wwBitSize(p, m) == l);
-		// рассчитать вычеты p, 2q по малым модулям
-		priBaseMod(mods, p, m, base_count);
-		priBaseMod(mods1, q, n, base_count);
+		// offs[i] <- min j: p + 2qj \equiv 0 \mod _base[i]
+		priBaseMod(offs, p, m, base_count);
 		for (i = 0; i < base_count; ++i)
-			if ((mods1[i] += mods1[i]) >= _base[i])
-				mods1[i] -= _base[i];
-		// проверка простоты
-		while (1)
+			if (invs[i] == 0)
+				offs[i] = WORD_MAX;
+			else if (offs[i])
+				offs[i] = (_base[i] - offs[i]) * invs[i] % _base[i];
+		// цикл по окнам: stop == 1 -- кандидаты r исчерпаны,
+		// stop == 2 -- исчерпаны попытки
+		for (stop = 0; !stop;)
 		{
-			// p делится на малые простые?
-			for (i = 0; i < base_count; ++i)
-				if (mods[i] == 0)
-					break;
-			// не делится: тест Демитко
-			if (i == base_count)
+			// просеять окно
+			priSieve(sieve, offs, base_count);
+			wwCopy(pw, p, m);
+			wwCopy(rw, r, m - n + 1);
+			// count <- число кандидатов окна с учетом trials и длины
+			for (count = 1; ; ++count)
 			{
-				// создать кольцо вычетов \mod p
-				wwTo(t, mo, p);
-				zmCreate(qr, (octet*)t, mo, stack);
-				// four <- 4 [в кольце qr]
-				qrAdd(four, qr->unity, qr->unity, qr);
-				qrAdd(four, four, four, qr);
-				// 4^r \mod p != 1?
-				qrPower(t, four, r, m - n + 1, qr, stack);
-				if (qrCmp(t, qr->unity, qr) != 0)
+				// p <- p + 2q, переполнение?
+				if (zzAddW2(p + n, m - n, zzAdd2(p, q, n)) ||
+					zzAddW2(p + n, m - n, zzAdd2(p, q, n)) ||
+					wwBitSize(p, m) > l)
 				{
-					// (4^r)^q \mod p == 1?
-					qrPower(t, t, q, n, qr, stack);
-					if (qrCmp(t, qr->unity, qr) == 0)
-						return TRUE;
+					stop = 1;
+					break;
 				}
+				// к следующей попытке
+				if (trials != SIZE_MAX && trials-- == 0)
+				{
+					stop = 2;
+					break;
+				}
+				if (count == PRI_SIEVE_SIZE)
+					break;
 			}
-			// p <- p + 2q, переполнение?
-			if (zzAddW2(p + n, m - n, zzAdd2(p, q, n)) ||
-				zzAddW2(p + n, m - n, zzAdd2(p, q, n)) ||
-				wwBitSize(p, m) > l)
-				break;
-			// r <- r + 1, t <- t + q, пересчитать mods
-			zzAddW2(r, m - n + 1, 1);
-			zzAddW2(t + n, m - n, zzAdd2(t, q, n));
-			for (i = 0; i < base_count; ++i)
-				if ((mods[i] += mods1[i]) >= _base[i])
-					mods[i] -= _base[i];
-			// к следующей попытке
-			if (trials != SIZE_MAX && trials-- == 0)
+			// проверка простоты: тест Демитко
+			i = priParRun(priExtendPrimeTest, ext, sieve, count, threads,
+				stack, priExtendPrimeTest_deep(l, n));
+			if (i < count)
+			{
+				priExtendPrimeStep(p, pw, q, m, n, i);
+				return TRUE;
+			}
+			if (stop == 2)
 				return FALSE;
+			// r <- r + count
+			zzAddW2(r, m - n + 1, count);
 		}
 	}
 	return FALSE;
 }
 
-size_t priExtendPrime_deep(size_t l, size_t n, size_t base_count)
+size_t priExtendPrimeMT_deep(size_t l, size_t n, size_t base_count,
+	size_t threads)
 {
 	const size_t m = W_OF_B(l);
-	const size_t mo = O_OF_B(l);
-	const size_t qr_deep = zmCreate_deep(mo);
 	ASSERT(m >= n);
-	return O_OF_W(m - n + 1 + m + 1 + m + 2 * base_count) + zmCreate_keep(mo) +
-		utilMax(4,
+	return O_OF_W(m - n + 1 + m + 1 + 2 * base_count +
+			W_OF_B(PRI_SIEVE_SIZE) + m + m - n + 1) +
+		utilMax(3,
 			zzDiv_deep(m, n),
 			zzMul_deep(n, m - n + 1),
-			qr_deep,
-			qrPower_deep(m, m, qr_deep));
+			priParThreads(threads) * priExtendPrimeTest_deep(l, n));
+}
+
+bool_t priExtendPrime(word p[], size_t l, const word q[], size_t n,
+	size_t trials, size_t base_count, gen_i rng, void* rng_state, void* stack)
+{
+	return priExtendPrimeMT(p, l, q, n, trials, base_count, 1, rng,
+		rng_state, stack);
+}
+
+size_t priExtendPrime_deep(size_t l, size_t n, size_t base_count)
+{
+	return priExtendPrimeMT_deep(l, n, base_count, 1);
 }
@@ -4,7 +4,7 @@
 \brief Quotient rings
 \project bee2 [cryptographic library]
 \created 2013.09.14
-\version 2014.04.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,6 +12,7 @@
 
 #include "bee2/core/mem.h"
 #include "bee2/core/util.h"
+#include "bee2/core/word.h"
 #include "bee2/math/qr.h"
 #include "bee2/math/ww.h"
 
@@ -50,9 +51,9 @@ bool_t qrIsOperable(const qr_o* r)
 
 /*
 *******************************************************************************
-Возведение в степень
+Возведение в степень: скользящее окно
 
-В функции qrPower() реализован скользящий оконный метод возведения 
+В функции FAST(qrPower) реализован скользящий оконный метод возведения 
 в степень (c = a^b). Предварительно рассчитываются малые степени
 	a^1, a^3,..., a^{2^w} - 1,
 где w --- величина окна. Затем в b выделяются серии из нулей и слайды.
@@ -95,7 +96,7 @@ static size_t qrCalcSlideWidth(size_t m)
 	return 7;
 }
 
-void qrPower(word c[], const word a[], const word b[], size_t m, 
+void FAST(qrPower)(word c[], const word a[], const word b[], size_t m, 
 	const qr_o* r, void* stack)
 {
 	const size_t w = qrCalcSlideWidth(m);
@@ -177,8 +178,300 @@ void qrPower(word c[], const word a[], const word b[], size_t m,
 	wwCopy(c, power, r->n);
 }
 
-size_t qrPower_deep(size_t n, size_t m, size_t r_deep)
+static size_t qrPowerFast_deep(size_t n, size_t m, size_t r_deep)
 {
 	const size_t powers_count = SIZE_1 << (qrCalcSlideWidth(m) - 1);
 	return O_OF_W(n + n * powers_count) + r_deep;
 }
+
+/*
+*******************************************************************************
+Возведение в степень: фиксированное окно
+
+В функции SAFE(qrPower) реализован оконный метод с фиксированной длиной
+окна w. Показатель b разбивается на s = \lceil B_OF_W(m) / w \rceil цифр
+	b = \sum {i=0}^{s - 1} x_i 2^{wi},	x_i \in {0, 1,..., 2^w - 1}.
+Предварительно рассчитываются степени a^0, a^1,..., a^{2^w - 1}. Затем
+	c <- a^{x_{s - 1}}
+	for i = s - 2,..., 0:
+		c <- c^{2^w}
+		c <- c * a^{x_i}.
+Нулевые цифры не пропускаются: умножение на a^0 = r->unity выполняется
+так же, как и на другие степени. Степени a^{x_i} выбираются просмотром
+всей таблицы с маскированием (см. wwSelect()). Поэтому
+последовательность операций и обращений к памяти зависит только от m.
+
+Для расчета малых степеней требуется 2^w - 2 умножений, для расчета c --
+еще s - 1 умножений. В функции qrCalcFixedWidth() определяется w, которое
+доставляет минимум целевой функции 2^w + B_OF_W(m) / w. По сравнению
+с FAST(qrPower) выполняется примерно B_OF_W(m) / (w(w + 1)) умножений
+больше, плюс 2^{w - 1} умножений при построении таблицы.
+*******************************************************************************
+*/
+
+static size_t qrCalcFixedWidth(size_t m)
+{
+	m = B_OF_W(m);
+	if (m <= 24)
+		return 2;
+	if (m <= 96)
+		return 3;
+	if (m <= 320)
+		return 4;
+	if (m <= 960)
+		return 5;
+	if (m <= 2688)
+		return 6;
+	return 7;
+}
+
+void SAFE(qrPower)(word c[], const word a[], const word b[], size_t m, 
+	const qr_o* r, void* stack)
+{
+	const size_t w = qrCalcFixedWidth(m);
+	const size_t powers_count = SIZE_1 << w;
+	const size_t s = (B_OF_W(m) + w - 1) / w;
+	register word digit;
+	size_t i, j;
+	// переменные в stack
+	word* power;		/* [r->n] степень */
+	word* t;			/* [r->n] выбранная малая степень */
+	word* powers;		/* [r->n << w] малые степени */
+	// pre
+	ASSERT(qrIsOperable(r));
+	ASSERT(wwIsValid(a, r->n));
+	ASSERT(wwIsValid(b, m));
+	ASSERT(wwIsValid(c, r->n));
+	ASSERT(m > 0);
+	// раскладка stack
+	power = (word*)stack;
+	t = power + r->n;
+	powers = t + r->n;
+	stack = powers + r->n * powers_count;
+	// powers[i] <- a^i
+	wwCopy(powers, r->unity, r->n);
+	wwCopy(powers + r->n, a, r->n);
+	for (i = 2; i < powers_count; ++i)
+		if (i % 2 == 0)
+			qrSqr(powers + r->n * i, powers + r->n * (i / 2), r, stack);
+		else
+			qrMul(powers + r->n * i, powers + r->n * (i - 1), a, r, stack);
+	// power <- a^{x_{s - 1}}
+	digit = wwGetBits(b, w * (s - 1), B_OF_W(m) - w * (s - 1));
+	wwSelect(power, powers, powers_count, digit, r->n);
+	// цикл по цифрам
+	for (i = s - 1; i--;)
+	{
+		// power <- power^{2^w}
+		for (j = 0; j < w; ++j)
+			qrSqr(power, power, r, stack);
+		// power <- power * a^{x_i}
+		digit = wwGetBits(b, w * i, w);
+		wwSelect(t, powers, powers_count, digit, r->n);
+		qrMul(power, power, t, r, stack);
+	}
+	// очистка и возврат
+	digit = 0;
+	wwCopy(c, power, r->n);
+	wwSetZero(t, r->n);
+}
+
+static size_t qrPowerSafe_deep(size_t n, size_t m, size_t r_deep)
+{
+	const size_t powers_count = SIZE_1 << qrCalcFixedWidth(m);
+	return O_OF_W(2 * n + n * powers_count) + r_deep;
+}
+
+size_t qrPower_deep(size_t n, size_t m, size_t r_deep)
+{
+	return utilMax(2,
+		qrPowerFast_deep(n, m, r_deep),
+		qrPowerSafe_deep(n, m, r_deep));
+}
+
+/*
+*******************************************************************************
+Возведение в степень: гребенчатый метод
+
+Основание a фиксировано, степени c = a^b определяются для многих b
+битовой длины не более l. Пусть s = \lceil l / w \rceil. Предварительно
+рассчитываются элементы
+	pre[i] = a^{i_0 + i_1 2^s + ... + i_{w-1} 2^{(w-1)s}},
+где (i_{w-1}...i_1 i_0)_2 -- двоичное представление i, 0 <= i < 2^w.
+В частности, pre[0] = r->unity, pre[1] = a.
+
+Столбцы двоичной записи b
+	x_i = (b_{i + (w-1)s}...b_{i + s} b_i)_2,  i = 0, 1,..., s - 1,
+определяют степень:
+	c <- pre[x_{s - 1}]
+	for i = s - 2,..., 0:
+		c <- c^2
+		c <- c * pre[x_i].
+
+Сложность: s - 1 возведений в квадрат и s - 1 умножений против
+(примерно) l возведений в квадрат и l / (w + 1) умножений в qrPower().
+Элементы pre[x_i] выбираются просмотром всей таблицы с маскированием,
+умножение на pre[0] не пропускается. Поэтому последовательность операций
+и обращений к памяти зависит только от l и w.
+
+Построение таблицы требует (w - 1)s возведений в квадрат и 2^w - w
+умножений и окупается уже при нескольких возведениях в степень.
+*******************************************************************************
+*/
+
+void qrCombPrec(word pre[], const word a[], size_t l, size_t w, 
+	const qr_o* r, void* stack)
+{
+	const size_t s = (l + w - 1) / w;
+	size_t i, j, k;
+	// переменные в stack
+	word* t;			/* [r->n] t = a^{2^{js}} */
+	// pre
+	ASSERT(qrIsOperable(r));
+	ASSERT(wwIsValid(a, r->n));
+	ASSERT(l > 0 && 2 <= w && w <= 8);
+	ASSERT(wwIsDisjoint2(pre, r->n << w, a, r->n));
+	// раскладка stack
+	t = (word*)stack;
+	stack = t + r->n;
+	// pre[0] <- 1, pre[1] <- a
+	wwCopy(pre, r->unity, r->n);
+	wwCopy(pre + r->n, a, r->n);
+	wwCopy(t, a, r->n);
+	for (j = 1; j < w; ++j)
+	{
+		// t <- a^{2^{js}}
+		for (i = 0; i < s; ++i)
+			qrSqr(t, t, r, stack);
+		// pre[2^j] <- t, pre[2^j + k] <- pre[k] * t
+		wwCopy(pre + r->n * (SIZE_1 << j), t, r->n);
+		for (k = 1; k < (SIZE_1 << j); ++k)
+			qrMul(pre + r->n * ((SIZE_1 << j) + k), pre + r->n * k, t, r, 
+				stack);
+	}
+}
+
+size_t qrCombPrec_keep(size_t n, size_t w)
+{
+	ASSERT(2 <= w && w <= 8);
+	return O_OF_W(n << w);
+}
+
+size_t qrCombPrec_deep(size_t n, size_t r_deep)
+{
+	return O_OF_W(n) + r_deep;
+}
+
+void qrCombPower(word c[], const word pre[], size_t l, size_t w, 
+	const word b[], size_t m, const qr_o* r, void* stack)
+{
+	const size_t s = (l + w - 1) / w;
+	const size_t count = SIZE_1 << w;
+	register word x;
+	size_t i, j;
+	// переменные в stack
+	word* power;		/* [r->n] степень */
+	word* t;			/* [r->n] выбранный элемент таблицы */
+	// pre
+	ASSERT(qrIsOperable(r));
+	ASSERT(l > 0 && 2 <= w && w <= 8);
+	ASSERT(wwIsValid(pre, r->n << w));
+	ASSERT(wwIsValid(b, m));
+	ASSERT(wwIsValid(c, r->n));
+	ASSERT(wwBitSize(b, m) <= l);
+	// раскладка stack
+	power = (word*)stack;
+	t = power + r->n;
+	stack = t + r->n;
+	// цикл по столбцам
+	for (i = s; i--;)
+	{
+		// x <- (b_{i + (w-1)s}...b_{i + s} b_i)_2
+		for (x = 0, j = 0; j < w; ++j)
+			if (i + s * j < B_OF_W(m))
+				x |= (word)wwTestBit(b, i + s * j) << j;
+		if (i + 1 == s)
+		{
+			// power <- pre[x_{s - 1}]
+			wwSelect(power, pre, count, x, r->n);
+			continue;
+		}
+		// power <- power^2 * pre[x_i]
+		qrSqr(power, power, r, stack);
+		wwSelect(t, pre, count, x, r->n);
+		qrMul(power, power, t, r, stack);
+	}
+	// очистка и возврат
+	x = 0;
+	wwCopy(c, power, r->n);
+	wwSetZero(t, r->n);
+}
+
+size_t qrCombPower_deep(size_t n, size_t r_deep)
+{
+	return O_OF_W(2 * n) + r_deep;
+}
+
+/*
+*******************************************************************************
+Одновременное обращение
+
+Реализован трюк Монтгомери [Algorithm 11.15 Simultaneous inversion, 
+CohenFrey, p. 209]:
+	u_0 <- a_0
+	for t = 1,..., T - 1: u_t <- u_{t-1} a_t
+	v <- u_{T-1}^{-1}
+	for t = T - 1,..., 1: 
+		a_t^{-1} <- v u_{t-1}
+		v <- v a_t
+	a_0^{-1} <- v
+Сложность: одно обращение и 3(T - 1) умножений.
+
+Элемент a_t используется при обновлении v, поэтому новое значение v 
+рассчитывается до записи a_t^{-1}. Это позволяет обращать элементы
+на месте (b == a).
+*******************************************************************************
+*/
+
+void qrInvBatch(word b[], const word a[], size_t count, const qr_o* r,
+	void* stack)
+{
+	size_t i;
+	// переменные в stack
+	word* u;			/* [count * r->n] произведения u_t */
+	word* v;			/* [r->n] новое значение v */
+	// pre
+	ASSERT(qrIsOperable(r));
+	ASSERT(wwIsValid(a, count * r->n));
+	ASSERT(wwIsSameOrDisjoint(a, b, count * r->n));
+	// count == 0?
+	if (count == 0)
+		return;
+	// раскладка stack
+	u = (word*)stack;
+	v = u + count * r->n;
+	stack = v + r->n;
+	// u_t <- a_0 a_1 ... a_t
+	wwCopy(u, a, r->n);
+	for (i = 1; i < count; ++i)
+		qrMul(u + i * r->n, u + (i - 1) * r->n, a + i * r->n, r, stack);
+	// u_{T-1} <- u_{T-1}^{-1}
+	i = count - 1;
+	qrInv(u + i * r->n, u + i * r->n, r, stack);
+	// цикл
+	for (; i; --i)
+	{
+		// v <- v a_t
+		qrMul(v, u + i * r->n, a + i * r->n, r, stack);
+		// b_t <- v u_{t-1}
+		qrMul(b + i * r->n, u + i * r->n, u + (i - 1) * r->n, r, stack);
+		wwCopy(u + (i - 1) * r->n, v, r->n);
+	}
+	// b_0 <- v
+	wwCopy(b, u, r->n);
+}
+
+size_t qrInvBatch_deep(size_t n, size_t count, size_t r_deep)
+{
+	return O_OF_W((count + 1) * n) + r_deep;
+}
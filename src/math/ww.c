@@ -4,7 +4,7 @@
 \brief Arbitrary length words
 \project bee2 [cryptographic library]
 \created 2012.04.18
-\version 2016.05.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -15,6 +15,18 @@
 #include "bee2/core/word.h"
 #include "bee2/math/ww.h"
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define WW_SELECT_AVX2
+	#define WW_SELECT_SSE2
+#elif defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define WW_SELECT_SSE2
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+	#define WW_SELECT_NEON
+#endif
+
 /*
 *******************************************************************************
 Копирование, логические операции
@@ -296,6 +308,120 @@ size_t wwOctetSize(const word a[], size_t n)
 	}
 }
 
+/*
+*******************************************************************************
+Регулярный выбор
+
+Функция wwSelect() просматривает все элементы таблицы и накладывает их 
+на аккумулятор по маскам, которые строятся без ветвлений. Внешний цикл 
+выполняется по блокам слов (векторам), внутренний -- по элементам 
+таблицы, так что аккумулятор блока остается в регистре и записывается 
+в c один раз.
+
+В векторных реализациях маска строится сравнением вектора-счетчика 
+(номер текущего элемента во всех 32-битовых полосах) с вектором, 
+составленным из index. Так как все полосы счетчика одинаковы, маска 
+покрывает вектор целиком при любой длине машинного слова. Чтобы номер 
+уместился в 32 бита, index >= count предварительно (регулярно) 
+заменяется на count.
+
+Реализация выбирается на этапе компиляции: AVX2 (__AVX2__, блоки по 
+32 октета), SSE2 (__SSE2__, _M_X64, блоки по 16 октетов), NEON 
+(__ARM_NEON, блоки по 16 октетов). Слова, которые не вошли в блоки, 
+обрабатываются по одному с масками wordEq0M(). Используются только 
+загрузки, сравнения, and, or и записи, время выполнения которых не 
+зависит от данных. По сравнению с пословным выбором, который компилятор 
+векторизует самостоятельно, исключаются пересчет и размножение скалярной 
+маски и запись аккумулятора после каждого элемента.
+*******************************************************************************
+*/
+
+void wwSelect(word c[], const word table[], size_t count, size_t index, 
+	size_t n)
+{
+	register word mask;
+	register word w;
+	size_t i, k = 0;
+#if defined(WW_SELECT_SSE2) || defined(WW_SELECT_NEON)
+	register size_t lt;
+	u32 idx;
+#endif
+	ASSERT((u32)count == count);
+	ASSERT(wwIsDisjoint2(c, n, table, count * n));
+#if defined(WW_SELECT_SSE2) || defined(WW_SELECT_NEON)
+	// idx <- min(index, count)
+	lt = (size_t)(index >= count) - SIZE_1;
+	idx = (u32)((index & lt) | (count & ~lt));
+	lt = 0;
+#endif
+#ifdef WW_SELECT_AVX2
+	for (; k + W_OF_O(32) <= n; k += W_OF_O(32))
+	{
+		const __m256i vidx = _mm256_set1_epi32((int)idx);
+		const __m256i one = _mm256_set1_epi32(1);
+		__m256i ctr = _mm256_setzero_si256();
+		__m256i acc = _mm256_setzero_si256();
+		const word* t = table + k;
+		for (i = 0; i < count; ++i, t += n)
+		{
+			acc = _mm256_or_si256(acc, _mm256_and_si256(
+				_mm256_cmpeq_epi32(ctr, vidx),
+				_mm256_loadu_si256((const __m256i*)t)));
+			ctr = _mm256_add_epi32(ctr, one);
+		}
+		_mm256_storeu_si256((__m256i*)(c + k), acc);
+	}
+#endif
+#ifdef WW_SELECT_SSE2
+	for (; k + W_OF_O(16) <= n; k += W_OF_O(16))
+	{
+		const __m128i vidx = _mm_set1_epi32((int)idx);
+		const __m128i one = _mm_set1_epi32(1);
+		__m128i ctr = _mm_setzero_si128();
+		__m128i acc = _mm_setzero_si128();
+		const word* t = table + k;
+		for (i = 0; i < count; ++i, t += n)
+		{
+			acc = _mm_or_si128(acc, _mm_and_si128(
+				_mm_cmpeq_epi32(ctr, vidx),
+				_mm_loadu_si128((const __m128i*)t)));
+			ctr = _mm_add_epi32(ctr, one);
+		}
+		_mm_storeu_si128((__m128i*)(c + k), acc);
+	}
+#endif
+#ifdef WW_SELECT_NEON
+	for (; k + W_OF_O(16) <= n; k += W_OF_O(16))
+	{
+		const uint32x4_t vidx = vdupq_n_u32(idx);
+		const uint32x4_t one = vdupq_n_u32(1);
+		uint32x4_t ctr = vdupq_n_u32(0);
+		uint32x4_t acc = vdupq_n_u32(0);
+		const word* t = table + k;
+		for (i = 0; i < count; ++i, t += n)
+		{
+			acc = vorrq_u32(acc, vandq_u32(vceqq_u32(ctr, vidx),
+				vld1q_u32((const uint32_t*)t)));
+			ctr = vaddq_u32(ctr, one);
+		}
+		vst1q_u32((uint32_t*)(c + k), acc);
+	}
+#endif
+	for (; k < n; ++k)
+	{
+		for (w = 0, i = 0; i < count; ++i)
+		{
+			mask = wordEq0M((word)i, (word)index);
+			w |= table[i * n + k] & mask;
+		}
+		c[k] = w;
+	}
+	mask = w = 0;
+#if defined(WW_SELECT_SSE2) || defined(WW_SELECT_NEON)
+	idx = 0;
+#endif
+}
+
 /*
 *******************************************************************************
 Операции с отдельными битами, кодирование
@@ -360,7 +486,7 @@ void wwSetBits(word a[], size_t pos, size_t width, register word val)
 	// биты a[n + 1]
 	if (pos + width > B_PER_W)
 	{
-		a[n + 1] &= mask << pos;
+		a[n + 1] &= ~(mask >> (B_PER_W - pos));
 		a[n + 1] ^= (val & mask) >> (B_PER_W - pos);
 	}
 }
@@ -403,25 +529,38 @@ size_t wwBitSize(const word a[], size_t n)
 	return n * B_PER_W - wwHiZeroBits(a, n);
 }
 
-size_t wwNAF(word naf[], const word a[], size_t n, size_t w)
+/*
+*******************************************************************************
+NAF
+
+Символы NAF вычисляются функцией wwNAFCore() от младших к старшим. Если
+dig != 0, то символы записываются в dig (по одному октету). Если naf != 0,
+то символы записываются в упакованном виде: код очередного символа
+размещается в naf непосредственно перед кодами уже обработанных символов
+(младшие символы -- в конце кодового представления). Для этого требуется
+заранее знать длину naf_len кодового представления (в битах). Длина
+возвращается через указатель len при первом (пробном) вызове.
+*******************************************************************************
+*/
+
+static size_t wwNAFCore(octet dig[], word naf[], size_t naf_len,
+	const word a[], size_t n, size_t w, size_t* len)
 {
 	const word next_bit = WORD_BIT_POS(w);
 	const word hi_bit = next_bit >> 1;
 	const word mask = hi_bit - 1;
 	register word window;
 	register word digit;
-	register size_t naf_len = 0;
+	register size_t pos = 0;
 	register size_t naf_size = 0;
 	register size_t a_len = wwBitSize(a, n);
 	size_t i;
-	// pre
-	ASSERT(wwIsDisjoint2(a, n, naf, 2 * n + 1));
-	ASSERT(2 <= w && w < B_PER_W);
-	// naf <- 0
-	wwSetZero(naf, 2 * n + 1);
 	// a == 0?
-	if (wwIsZero(a, n))
+	if (a_len == 0)
+	{
+		*len = 0;
 		return 0;
+	}
 	// window <- a mod 2^w
 	window = wwGetBits(a, 0, w);
 	// расчет NAF
@@ -453,25 +592,53 @@ size_t wwNAF(word naf[], const word a[], size_t n, size_t w)
 				// window <- window - digit
 				window = 0;
 			// запись ненулевого символа
-			wwShHi(naf, W_OF_B(naf_len + w), w);
-			wwSetBits(naf, 0, w, digit);
-			naf_len += w;
+			pos += w;
+			if (naf)
+				wwSetBits(naf, naf_len - pos, w, digit);
 		}
 		else
 			// кодирование нулевого символа
-			wwShHi(naf, W_OF_B(++naf_len), 1);
+			digit = 0, ++pos;
+		if (dig)
+			dig[naf_size] = (octet)digit;
 		// увеличить размер naf
 		++naf_size;
 		// сдвиг окна
 		window >>= 1;
 		if (i < a_len)
-			window += hi_bit * wwTestBit(a, i);
+			window += hi_bit * (a[i / B_PER_W] >> i % B_PER_W & 1);
 	}
+	*len = pos;
 	digit = window = 0;
-	naf_len = a_len = 0;
+	pos = a_len = 0;
 	return naf_size;
 }
 
+size_t wwNAF(word naf[], const word a[], size_t n, size_t w)
+{
+	size_t naf_len;
+	// pre
+	ASSERT(wwIsDisjoint2(a, n, naf, 2 * n + 1));
+	ASSERT(2 <= w && w < B_PER_W);
+	// naf <- 0
+	wwSetZero(naf, 2 * n + 1);
+	// naf_len <- длина кодового представления
+	wwNAFCore(0, 0, 0, a, n, w, &naf_len);
+	ASSERT(naf_len <= B_OF_W(2 * n + 1));
+	// расчет NAF
+	return wwNAFCore(0, naf, naf_len, a, n, w, &naf_len);
+}
+
+size_t wwNAFDigits(octet naf[], const word a[], size_t n, size_t w)
+{
+	size_t naf_len;
+	// pre
+	ASSERT(memIsDisjoint2(a, O_OF_W(n), naf, B_OF_W(n) + 1));
+	ASSERT(2 <= w && w <= 8);
+	// расчет NAF
+	return wwNAFCore(naf, 0, 0, a, n, w, &naf_len);
+}
+
 /*
 *******************************************************************************
 Сдвиги и очистка
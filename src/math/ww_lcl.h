@@ -0,0 +1,193 @@
+/*
+*******************************************************************************
+\file ww_lcl.h
+\brief Arbitrary length words: local definitions
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifndef __WW_LCL_H
+#define __WW_LCL_H
+
+#include "bee2/core/word.h"
+#include "bee2/math/ww.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define WW_FIX_SSE2
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+	#define WW_FIX_NEON
+#endif
+
+#if defined(_MSC_VER)
+	#define WW_FIX_INLINE static __forceinline
+#else
+	#define WW_FIX_INLINE static inline
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*******************************************************************************
+Примитивы фиксированной длины
+
+Встраиваемые редакции функций wwCopy(), wwXor(), wwXor2(), wwEq(),
+wwIsZero(), wwCmp(), wwShLo() и wwShHi(). Редакции предназначены для
+вызова с длиной n, известной при компиляции (например, в ядрах
+фиксированной длины zz_fix.c, zm.c, ecp.c). После встраивания циклы
+по n полностью разворачиваются, а блоки по 128 битов обрабатываются
+командами SSE2 (на NEON -- только в wwCopyFix(), wwXorFix(), wwXor2Fix()).
+
+В отличие от FAST-редакций wwEq(), wwIsZero() и wwCmp(), редакции
+фиксированной длины регулярны: при небольших n отказ от досрочного выхода
+не замедляет сравнение, но позволяет обходиться без ветвлений.
+
+Сдвиги wwShLoFix() и wwShHiFix() выполняются на число битов
+0 < shift < B_PER_W. Сдвиги на целое число слов при фиксированной длине
+сводятся к копированию.
+*******************************************************************************
+*/
+
+WW_FIX_INLINE void wwCopyFix(word b[], const word a[], size_t n)
+{
+	size_t i = 0;
+	ASSERT(wwIsSameOrDisjoint(a, b, n));
+#if defined(WW_FIX_SSE2)
+	for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+		_mm_storeu_si128((__m128i*)(b + i),
+			_mm_loadu_si128((const __m128i*)(a + i)));
+#elif defined(WW_FIX_NEON)
+	for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+		vst1q_u8((octet*)(b + i), vld1q_u8((const octet*)(a + i)));
+#endif
+	for (; i < n; ++i)
+		b[i] = a[i];
+}
+
+WW_FIX_INLINE void wwXorFix(word c[], const word a[], const word b[],
+	size_t n)
+{
+	size_t i = 0;
+	ASSERT(wwIsSameOrDisjoint(a, c, n));
+	ASSERT(wwIsSameOrDisjoint(b, c, n));
+#if defined(WW_FIX_SSE2)
+	for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+		_mm_storeu_si128((__m128i*)(c + i), _mm_xor_si128(
+			_mm_loadu_si128((const __m128i*)(a + i)),
+			_mm_loadu_si128((const __m128i*)(b + i))));
+#elif defined(WW_FIX_NEON)
+	for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+		vst1q_u8((octet*)(c + i), veorq_u8(vld1q_u8((const octet*)(a + i)),
+			vld1q_u8((const octet*)(b + i))));
+#endif
+	for (; i < n; ++i)
+		c[i] = a[i] ^ b[i];
+}
+
+WW_FIX_INLINE void wwXor2Fix(word b[], const word a[], size_t n)
+{
+	wwXorFix(b, b, a, n);
+}
+
+WW_FIX_INLINE bool_t wwIsZeroFix(const word a[], size_t n)
+{
+	register word acc = 0;
+	size_t i = 0;
+	bool_t ret;
+	ASSERT(wwIsValid(a, n));
+#if defined(WW_FIX_SSE2)
+	{
+		__m128i v = _mm_setzero_si128();
+		for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+			v = _mm_or_si128(v, _mm_loadu_si128((const __m128i*)(a + i)));
+		acc = (word)(_mm_movemask_epi8(
+			_mm_cmpeq_epi8(v, _mm_setzero_si128())) ^ 0xFFFF);
+	}
+#endif
+	for (; i < n; ++i)
+		acc |= a[i];
+	ret = wordEq(acc, 0);
+	acc = 0;
+	return ret;
+}
+
+WW_FIX_INLINE bool_t wwEqFix(const word a[], const word b[], size_t n)
+{
+	register word acc = 0;
+	size_t i = 0;
+	bool_t ret;
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n));
+#if defined(WW_FIX_SSE2)
+	{
+		__m128i v = _mm_setzero_si128();
+		for (; i + W_OF_O(16) <= n; i += W_OF_O(16))
+			v = _mm_or_si128(v, _mm_xor_si128(
+				_mm_loadu_si128((const __m128i*)(a + i)),
+				_mm_loadu_si128((const __m128i*)(b + i))));
+		acc = (word)(_mm_movemask_epi8(
+			_mm_cmpeq_epi8(v, _mm_setzero_si128())) ^ 0xFFFF);
+	}
+#endif
+	for (; i < n; ++i)
+		acc |= a[i] ^ b[i];
+	ret = wordEq(acc, 0);
+	acc = 0;
+	return ret;
+}
+
+/*
+	Сравнение выполняется вычитанием a - b: заем из старшего слова
+	указывает на a < b, ненулевая разность -- на a != b.
+*/
+
+WW_FIX_INLINE int wwCmpFix(const word a[], const word b[], size_t n)
+{
+	register word borrow = 0;
+	register word diff = 0;
+	register word w;
+	size_t i;
+	int ret;
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n));
+	for (i = 0; i < n; ++i)
+	{
+		w = a[i] - b[i];
+		borrow = wordLess01(a[i], b[i]) | wordLess01(w, borrow);
+		diff |= w;
+	}
+	ret = (int)wordNeq(diff, 0) - 2 * (int)borrow;
+	borrow = diff = w = 0;
+	return ret;
+}
+
+WW_FIX_INLINE void wwShLoFix(word a[], size_t n, size_t shift)
+{
+	size_t i;
+	ASSERT(wwIsValid(a, n) && n > 0);
+	ASSERT(0 < shift && shift < B_PER_W);
+	for (i = 0; i + 1 < n; ++i)
+		a[i] = a[i] >> shift | a[i + 1] << (B_PER_W - shift);
+	a[i] >>= shift;
+}
+
+WW_FIX_INLINE void wwShHiFix(word a[], size_t n, size_t shift)
+{
+	size_t i;
+	ASSERT(wwIsValid(a, n) && n > 0);
+	ASSERT(0 < shift && shift < B_PER_W);
+	for (i = n - 1; i > 0; --i)
+		a[i] = a[i] << shift | a[i - 1] >> (B_PER_W - shift);
+	a[0] <<= shift;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __WW_LCL_H */
@@ -4,18 +4,24 @@
 \brief Quotient rings of integers modulo m
 \project bee2 [cryptographic library]
 \created 2013.09.14
-\version 2016.07.04
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include "bee2/core/blob.h"
 #include "bee2/core/mem.h"
+#include "bee2/core/mt.h"
+#include "bee2/core/tm.h"
 #include "bee2/core/util.h"
 #include "bee2/core/word.h"
 #include "bee2/math/ww.h"
 #include "bee2/math/zm.h"
 #include "bee2/math/zz.h"
+#include "math/ww_lcl.h"
+#include "math/zm_lcl.h"
+#include "math/zz/zz_lcl.h"
 
 /*
 *******************************************************************************
@@ -75,9 +81,10 @@ static void zmMul(word c[], const word a[], const word b[],
 
 static size_t zmMul_deep(size_t n)
 {
-	return utilMax(2,
-		zzMul_deep(n, n),
-		zzRed_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzMul_deep(n, n),
+			zzRed_deep(n));
 }
 
 static void zmSqr(word b[], const word a[], const qr_o* r, void* stack)
@@ -93,9 +100,10 @@ static void zmSqr(word b[], const word a[], const qr_o* r, void* stack)
 
 static size_t zmSqr_deep(size_t n)
 {
-	return utilMax(2,
-		zzSqr_deep(n),
-		zzRed_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzSqr_deep(n),
+			zzRed_deep(n));
 }
 
 static void zmInv(word b[], const word a[], const qr_o* r, void* stack)
@@ -199,9 +207,10 @@ static void zmMulCrand(word c[], const word a[], const word b[],
 
 static size_t zmMulCrand_deep(size_t n)
 {
-	return utilMax(2,
-		zzMul_deep(n, n),
-		zzRedCrand_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzMul_deep(n, n),
+			zzRedCrand_deep(n));
 }
 
 static void zmSqrCrand(word b[], const word a[], const qr_o* r, void* stack)
@@ -217,9 +226,104 @@ static void zmSqrCrand(word b[], const word a[], const qr_o* r, void* stack)
 
 static size_t zmSqrCrand_deep(size_t n)
 {
-	return utilMax(2,
-		zzSqr_deep(n),
-		zzRedCrand_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzSqr_deep(n),
+			zzRedCrand_deep(n));
+}
+
+/*
+*******************************************************************************
+Ядра фиксированной длины
+
+При n = 4, 6, 8 функции умножения и возведения в квадрат колец с редукциями
+Крэндалла и Монтгомери заменяются функциями, которые построены на ядрах
+фиксированной длины (см. zz_lcl.h). Замена выполняется при создании
+кольца, общие функции остаются для других n.
+
+Для модулей кривых bign (на платформах с 64-разрядным словом) используются
+редукции zzRedBign128(), zzRedBign192(), zzRedBign256() со встроенными
+модулями.
+*******************************************************************************
+*/
+
+#define zmMulCrandFix(len)\
+static void zmMulCrand##len(word c[], const word a[], const word b[],\
+	const qr_o* r, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	ASSERT(zmIsIn(b, r));\
+	zzMul##len(prod, a, b);\
+	zzRedCrand##len(prod, r->mod);\
+	wwCopyFix(c, prod, len);\
+}\
+\
+static void zmSqrCrand##len(word b[], const word a[], const qr_o* r,\
+	void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	zzSqr##len(prod, a);\
+	zzRedCrand##len(prod, r->mod);\
+	wwCopyFix(b, prod, len);\
+}
+
+zmMulCrandFix(4)
+zmMulCrandFix(6)
+zmMulCrandFix(8)
+
+#if (B_PER_W == 64)
+
+#define zmMulBignFix(level, len)\
+static void zmMulBign##level(word c[], const word a[], const word b[],\
+	const qr_o* r, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	ASSERT(zmIsIn(b, r));\
+	zzMul##len(prod, a, b);\
+	zzRedBign##level(prod);\
+	wwCopyFix(c, prod, len);\
+}\
+\
+static void zmSqrBign##level(word b[], const word a[], const qr_o* r,\
+	void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	zzSqr##len(prod, a);\
+	zzRedBign##level(prod);\
+	wwCopyFix(b, prod, len);\
+}
+
+zmMulBignFix(128, 4)
+zmMulBignFix(192, 6)
+zmMulBignFix(256, 8)
+
+#endif
+
+static void zmCreateCrandFix(qr_o* r)
+{
+#if (B_PER_W == 64)
+	if (r->n == 4 && r->mod[0] == WORD_0 - 189)
+		r->mul = zmMulBign128, r->sqr = zmSqrBign128;
+	else if (r->n == 6 && r->mod[0] == WORD_0 - 317)
+		r->mul = zmMulBign192, r->sqr = zmSqrBign192;
+	else if (r->n == 8 && r->mod[0] == WORD_0 - 569)
+		r->mul = zmMulBign256, r->sqr = zmSqrBign256;
+	else
+#endif
+	if (r->n == 4)
+		r->mul = zmMulCrand4, r->sqr = zmSqrCrand4;
+	else if (r->n == 6)
+		r->mul = zmMulCrand6, r->sqr = zmSqrCrand6;
+	else if (r->n == 8)
+		r->mul = zmMulCrand8, r->sqr = zmSqrCrand8;
 }
 
 void zmCreateCrand(qr_o* r, const octet mod[], size_t no, void* stack)
@@ -252,6 +356,7 @@ void zmCreateCrand(qr_o* r, const octet mod[], size_t no, void* stack)
 	r->sqr = zmSqrCrand;
 	r->inv = zmInv;
 	r->div = zmDiv;
+	zmCreateCrandFix(r);
 	r->deep = utilMax(4,
 		zmMulCrand_deep(r->n),
 		zmSqrCrand_deep(r->n),
@@ -300,9 +405,10 @@ static void zmMulBarr(word c[], const word a[], const word b[],
 
 static size_t zmMulBarr_deep(size_t n)
 {
-	return utilMax(2,
-		zzMul_deep(n, n),
-		zzRedBarr_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzMul_deep(n, n),
+			zzRedBarr_deep(n));
 }
 
 static void zmSqrBarr(word b[], const word a[], const qr_o* r, void* stack)
@@ -318,9 +424,10 @@ static void zmSqrBarr(word b[], const word a[], const qr_o* r, void* stack)
 
 static size_t zmSqrBarr_deep(size_t n)
 {
-	return utilMax(2,
-		zzSqr_deep(n),
-		zzRedBarr_deep(n));
+	return O_OF_W(2 * n) +
+		utilMax(2,
+			zzSqr_deep(n),
+			zzRedBarr_deep(n));
 }
 
 void zmCreateBarr(qr_o* r, const octet mod[], size_t no, void* stack)
@@ -386,11 +493,16 @@ size_t zmCreateBarr_deep(size_t no)
 Функция zmFromMont() задает переход a -> a R (\mod mod), R = B^n.
 Функция zmToMont() задает обратный переход a -> a R^{-1} (\mod mod).
 
-\todo В функции zmInvMont() переход от a^{-1} 2^k \mod mod к
-a^{-1} R^2 \mod mod реализуется последовательными удвоениями по модулю mod.
-Можно ускорить расчеты, если предварительно вычислить R^2 \mod mod.
-Подробнее см. [E. Savas, K. Koc. The Montgomery Modular Inverse --
-Revisited. IEEE Transactions on Computers, 49(7):763–766, 2000].
+Умножение и возведение в квадрат выполняются функциями zzMulMont()
+и zzSqrMont(), в которых умножение чередуется с редукцией (алгоритм CIOS).
+Полное 2n-словное произведение не строится.
+
+Обратный элемент в кольце Монтгомери определяется в функции zmInvMont()
+как частное R^2 / a \mod mod. Число R^2 \mod mod вычисляется по единице
+кольца (R \mod mod) редукцией открытых данных, деление выполняется
+регулярной функцией zzDivMod() (см. zz_gcd.c). Ранее использовалось
+почти-обращение zzAlmostInvMod() с последующими удвоениями, число которых
+зависело от обращаемого элемента.
 *******************************************************************************
 */
 
@@ -437,58 +549,62 @@ static size_t zmToMont_deep(size_t n)
 static void zmMulMont(word c[], const word a[], const word b[],
 	const qr_o* r, void* stack)
 {
-	word* prod = (word*)stack;
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
 	ASSERT(zmIsIn(b, r));
-	stack = prod + 2 * r->n;
-	zzMul(prod, a, r->n, b, r->n, stack);
-	zzRedMont(prod, r->mod, r->n, *(word*)r->params, stack);
-	wwCopy(c, prod, r->n);
+	zzMulMont(c, a, b, r->mod, r->n, *(word*)r->params, stack);
 }
 
 static size_t zmMulMont_deep(size_t n)
 {
-	return utilMax(2,
-		zzMul_deep(n, n),
-		zzRedMont_deep(n));
+	return zzMulMont_deep(n);
 }
 
 static void zmSqrMont(word b[], const word a[], const qr_o* r, void* stack)
 {
-	word* prod = (word*)stack;
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
-	stack = prod + 2 * r->n;
-	zzSqr(prod, a, r->n, stack);
-	zzRedMont(prod, r->mod, r->n, *(word*)r->params, stack);
-	wwCopy(b, prod, r->n);
+	zzSqrMont(b, a, r->mod, r->n, *(word*)r->params, stack);
 }
 
 static size_t zmSqrMont_deep(size_t n)
 {
-	return utilMax(2,
-		zzSqr_deep(n),
-		zzRedMont_deep(n));
+	return zzSqrMont_deep(n);
+}
+
+static void zmInvMontL(word b[], const word a[], const qr_o* r, size_t l,
+	void* stack)
+{
+	word* c = (word*)stack;
+	word* t = c + r->n;
+	stack = t + 2 * r->n;
+	// c <- R^2 \mod mod, R = 2^l
+	wwCopy(t, r->unity, r->n);
+	wwSetZero(t + r->n, r->n);
+	wwShHi(t, 2 * r->n, l);
+	zzMod(c, t, 2 * r->n, r->mod, r->n, stack);
+	// b <- c / a = a^{-1} R^2 \mod mod
+	zzDivMod(b, c, a, r->mod, r->n, stack);
+}
+
+static size_t zmInvMontL_deep(size_t n)
+{
+	return O_OF_W(3 * n) +
+		utilMax(2,
+			zzMod_deep(2 * n, n),
+			zzDivMod_deep(n));
 }
 
 static void zmInvMont(word b[], const word a[], const qr_o* r, void* stack)
 {
-	register size_t k;
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
-	// b <- a^{-1} 2^k \mod mod
-	k = zzAlmostInvMod(b, a, r->mod, r->n, stack);
-	ASSERT(wwBitSize(r->mod, r->n) <= k);
-	ASSERT(k <= 2 * wwBitSize(r->mod, r->n));
-	// b <- a^{-1} R^2 \mod mod
-	for (; k < 2 * r->n * B_PER_W; ++k)
-		zzDoubleMod(b, b, r->mod, r->n);
+	zmInvMontL(b, a, r, B_OF_W(r->n), stack);
 }
 
 static size_t zmInvMont_deep(size_t n)
 {
-	return zzAlmostInvMod_deep(n);
+	return zmInvMontL_deep(n);
 }
 
 static void zmDivMont(word b[], const word divident[], const word a[],
@@ -512,6 +628,44 @@ static size_t zmDivMont_deep(size_t n)
 		zmMulMont_deep(n));
 }
 
+#define zmMulMontFix(len)\
+static void zmMulMont##len(word c[], const word a[], const word b[],\
+	const qr_o* r, void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	ASSERT(zmIsIn(b, r));\
+	zzMul##len(prod, a, b);\
+	zzRedMont##len(prod, r->mod, *(word*)r->params);\
+	wwCopyFix(c, prod, len);\
+}\
+\
+static void zmSqrMont##len(word b[], const word a[], const qr_o* r,\
+	void* stack)\
+{\
+	word* prod = (word*)stack;\
+	ASSERT(zmIsOperable(r) && r->n == len);\
+	ASSERT(zmIsIn(a, r));\
+	zzSqr##len(prod, a);\
+	zzRedMont##len(prod, r->mod, *(word*)r->params);\
+	wwCopyFix(b, prod, len);\
+}
+
+zmMulMontFix(4)
+zmMulMontFix(6)
+zmMulMontFix(8)
+
+static void zmCreateMontFix(qr_o* r)
+{
+	if (r->n == 4)
+		r->mul = zmMulMont4, r->sqr = zmSqrMont4;
+	else if (r->n == 6)
+		r->mul = zmMulMont6, r->sqr = zmSqrMont6;
+	else if (r->n == 8)
+		r->mul = zmMulMont8, r->sqr = zmSqrMont8;
+}
+
 void zmCreateMont(qr_o* r, const octet mod[], size_t no, void* stack)
 {
 	ASSERT(memIsValid(r, sizeof(qr_o)));
@@ -542,6 +696,7 @@ void zmCreateMont(qr_o* r, const octet mod[], size_t no, void* stack)
 	r->sqr = zmSqrMont;
 	r->inv = zmInvMont;
 	r->div = zmDivMont;
+	zmCreateMontFix(r);
 	r->deep = utilMax(6,
 		zmFromMont_deep(r->n),
 		zmToMont_deep(r->n),
@@ -577,33 +732,173 @@ size_t zmCreateMont_deep(size_t no)
 /*
 *******************************************************************************
 Создание оптимального кольца
+
+Редукция выбирается функцией zmCreateBy() по коду red. Структурное правило 
+выбора реализовано в zmCreateStatic(), результаты настройки хранятся 
+в таблице _tuned: _tuned[crand][n] -- код редукции для нечетных модулей
+длины n слов вида B^n - c (crand == 1) или другого вида (crand == 0). 
+Нулевое значение означает, что замеры не выполнялись. Параллельные замеры 
+для одинаковых характеристик допустимы: они дают близкие результаты, 
+запись в таблицу атомарна.
+
+Замеры выполняются над модулями B^n - c, где c = 189, 317, 569 при n = 4, 
+6, 8 (модули bign, для них используются специальные ядра) и c = 189 при 
+остальных n, а также над модулем B^n - B - 1. Время умножения в кольце 
+определяется как минимум по ZM_TUNE_ROUNDS сериям из ZM_TUNE_REPS 
+умножений. При равенстве времен сохраняется структурный выбор.
 *******************************************************************************
 */
 
-void zmCreate(qr_o* r, const octet mod[], size_t no, void* stack)
+#define ZM_TUNE_REPS	32
+#define ZM_TUNE_ROUNDS	5
+
+static bool_t _tune;
+static size_t _tuned[2][ZM_TUNE_MAX_N + 1];
+
+static bool_t zmIsCrandMod(const octet mod[], size_t no)
+{
+	return no % O_PER_W == 0 && no >= 2 * O_PER_W &&
+		!memIsZero(mod, O_PER_W) &&
+		memIsRep(mod + O_PER_W, no - O_PER_W, 0xFF);
+}
+
+static size_t zmCreateStatic(const octet mod[], size_t no)
 {
-	ASSERT(memIsValid(r, sizeof(qr_o)));
-	ASSERT(memIsValid(mod, no));
-	ASSERT(no > 0 && mod[no - 1] > 0);
 	// короткий модуль?
 	if (no <= 2 * O_PER_W)
-		zmCreatePlain(r, mod, no, stack);
+		return ZM_RED_PLAIN;
 	// подходит редукция Крэндалла?
-	else if (no % O_PER_W == 0 && no >= 2 * O_PER_W &&
-		!memIsZero(mod, O_PER_W) &&
-		memIsRep(mod + O_PER_W, no - O_PER_W, 0xFF))
-		zmCreateCrand(r, mod, no, stack);
+	if (zmIsCrandMod(mod, no))
+		return ZM_RED_CRAND;
 	// подходит редукция Монтгомери?
-	else if (mod[0] % 2)
-		zmCreateMont(r, mod, no, stack);
+	if (mod[0] % 2)
+		return ZM_RED_MONT;
 	// длинный модуль?
-	else if (no >= 4 * O_PER_W)
-		zmCreateBarr(r, mod, no, stack);
+	if (no >= 4 * O_PER_W)
+		return ZM_RED_BARR;
 	// средний четный модуль
+	return ZM_RED_PLAIN;
+}
+
+static void zmCreateBy(qr_o* r, const octet mod[], size_t no, size_t red,
+	void* stack)
+{
+	if (red == ZM_RED_CRAND)
+		zmCreateCrand(r, mod, no, stack);
+	else if (red == ZM_RED_MONT)
+		zmCreateMont(r, mod, no, stack);
+	else if (red == ZM_RED_BARR)
+		zmCreateBarr(r, mod, no, stack);
 	else
 		zmCreatePlain(r, mod, no, stack);
 }
 
+static size_t zmTuneMeasure(size_t n, bool_t crand)
+{
+	const size_t no = O_OF_W(n);
+	size_t reds[3];
+	size_t count = 0;
+	size_t best;
+	tm_ticks_t best_ticks = 0;
+	size_t i, round, k;
+	void* state;
+	octet* mod;
+	word* a;
+	word* b;
+	word* c;
+	qr_o* r;
+	void* stack;
+	ASSERT(2 < n && n <= ZM_TUNE_MAX_N);
+	// кандидаты (первый -- структурный выбор)
+	if (crand)
+		reds[count++] = ZM_RED_CRAND;
+	reds[count++] = ZM_RED_MONT;
+	if (n >= 4)
+		reds[count++] = ZM_RED_BARR;
+	best = reds[0];
+	// подготовить память
+	state = blobCreate(no + O_OF_W(3 * n) + zmCreate_keep(no) +
+		zmCreate_deep(no));
+	if (!state)
+		return best;
+	a = (word*)state;
+	b = a + n;
+	c = b + n;
+	mod = (octet*)(c + n);
+	r = (qr_o*)(mod + no);
+	stack = (octet*)r + zmCreate_keep(no);
+	// построить модуль
+	wwRepW(a, n, WORD_MAX);
+	if (crand)
+		a[0] = WORD_0 - (n == 6 ? 317 : n == 8 ? 569 : 189);
+	else
+		a[1] = WORD_MAX - 1;
+	wwTo(mod, no, a);
+	// замеры
+	for (i = 0; i < count; ++i)
+	{
+		tm_ticks_t ticks = 0;
+		zmCreateBy(r, mod, no, reds[i], stack);
+		for (round = 0; round < ZM_TUNE_ROUNDS; ++round)
+		{
+			tm_ticks_t start;
+			wwCopy(a, r->mod, n), wwShLo(a, n, 1);
+			wwCopy(b, r->mod, n), wwShLo(b, n, 3);
+			start = tmTicks();
+			for (k = 0; k < ZM_TUNE_REPS; ++k)
+			{
+				qrMul(c, a, b, r, stack);
+				qrMul(a, c, b, r, stack);
+			}
+			start = tmTicks() - start;
+			if (round == 0 || start < ticks)
+				ticks = start;
+		}
+		if (i == 0 || ticks < best_ticks)
+			best = reds[i], best_ticks = ticks;
+	}
+	blobClose(state);
+	return best;
+}
+
+size_t zmTuned(size_t n, bool_t crand)
+{
+	size_t red;
+	ASSERT(n > 0);
+	crand = crand ? 1 : 0;
+	// структурный выбор?
+	if (n <= 2)
+		return ZM_RED_PLAIN;
+	if (!_tune || n > ZM_TUNE_MAX_N)
+		return crand ? ZM_RED_CRAND : ZM_RED_MONT;
+	// замеры
+	if (!(red = mtAtomicLoad(&_tuned[crand][n])))
+	{
+		red = zmTuneMeasure(n, crand);
+		mtAtomicStore(&_tuned[crand][n], red);
+	}
+	return red;
+}
+
+bool_t zmTune(bool_t tune)
+{
+	_tune = tune;
+	return _tune;
+}
+
+void zmCreate(qr_o* r, const octet mod[], size_t no, void* stack)
+{
+	size_t red;
+	ASSERT(memIsValid(r, sizeof(qr_o)));
+	ASSERT(memIsValid(mod, no));
+	ASSERT(no > 0 && mod[no - 1] > 0);
+	red = zmCreateStatic(mod, no);
+	// настроить выбор?
+	if (_tune && (red == ZM_RED_CRAND || red == ZM_RED_MONT))
+		red = zmTuned(W_OF_O(no), red == ZM_RED_CRAND);
+	zmCreateBy(r, mod, no, red, stack);
+}
+
 size_t zmCreate_keep(size_t no)
 {
 	return utilMax(4,
@@ -622,6 +917,46 @@ size_t zmCreate_deep(size_t no)
 		zmCreateMont_deep(no));
 }
 
+bool_t zmCreateRed(qr_o* r, const octet mod[], size_t no, size_t red,
+	void* stack)
+{
+	ASSERT(memIsValid(r, sizeof(qr_o)));
+	ASSERT(memIsValid(mod, no));
+	ASSERT(no > 0 && mod[no - 1] > 0);
+	if (red == ZM_RED_AUTO)
+		zmCreate(r, mod, no, stack);
+	else if (red == ZM_RED_CRAND && !zmIsCrandMod(mod, no) ||
+		red == ZM_RED_MONT && mod[0] % 2 == 0 ||
+		red > ZM_RED_MONT)
+		return FALSE;
+	else
+		zmCreateBy(r, mod, no, red, stack);
+	return TRUE;
+}
+
+/*
+*******************************************************************************
+Ядро кольца
+*******************************************************************************
+*/
+
+size_t zmFixKind(const qr_o* r)
+{
+	ASSERT(zmIsOperable(r));
+#if (B_PER_W == 64)
+	if (r->mul == zmMulBign128 || r->mul == zmMulBign192 ||
+		r->mul == zmMulBign256)
+		return ZM_FIX_BIGN;
+#endif
+	if (r->mul == zmMulCrand4 || r->mul == zmMulCrand6 ||
+		r->mul == zmMulCrand8)
+		return ZM_FIX_CRAND;
+	if (r->mul == zmMulMont4 || r->mul == zmMulMont6 ||
+		r->mul == zmMulMont8)
+		return ZM_FIX_MONT;
+	return ZM_FIX_NONE;
+}
+
 /*
 *******************************************************************************
 Проверка описания кольца
@@ -652,18 +987,14 @@ static void zmMulMont2(word c[], const word a[], const word b[],
 {
 	register size_t k;
 	const zm_mont_params_st* params;
-	word* prod = (word*)stack;
 	// pre
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
 	ASSERT(zmIsIn(b, r));
 	// настроить указатели
 	params = (const zm_mont_params_st*)r->params;
-	stack = prod + 2 * r->n;
 	// c <- a b B^{-n} \mod mod
-	zzMul(prod, a, r->n, b, r->n, stack);
-	zzRedMont(prod, r->mod, r->n, *(word*)r->params, stack);
-	wwCopy(c, prod, r->n);
+	zzMulMont(c, a, b, r->mod, r->n, params->m0, stack);
 	// c <- c * B^n / 2^l \mod mod
 	for (k = params->l; k < B_PER_W * r->n; ++k)
 		zzDoubleMod(c, c, r->mod, r->n);
@@ -671,26 +1002,20 @@ static void zmMulMont2(word c[], const word a[], const word b[],
 
 static size_t zmMulMont2_deep(size_t n)
 {
-	return utilMax(2,
-		zzMul_deep(n, n),
-		zzRedMont_deep(n));
+	return zzMulMont_deep(n);
 }
 
 static void zmSqrMont2(word b[], const word a[], const qr_o* r, void* stack)
 {
 	register size_t k;
 	const zm_mont_params_st* params;
-	word* prod = (word*)stack;
 	// pre
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
 	// настроить указатели
 	params = (const zm_mont_params_st*)r->params;
-	stack = prod + 2 * r->n;
 	// b <- a^2 B^{-n} \mod mod
-	zzSqr(prod, a, r->n, stack);
-	zzRedMont(prod, r->mod, r->n, *(word*)r->params, stack);
-	wwCopy(b, prod, r->n);
+	zzSqrMont(b, a, r->mod, r->n, params->m0, stack);
 	// b <- b * B^n / 2^l \mod mod
 	for (k = params->l; k < B_PER_W * r->n; ++k)
 		zzDoubleMod(b, b, r->mod, r->n);
@@ -698,30 +1023,21 @@ static void zmSqrMont2(word b[], const word a[], const qr_o* r, void* stack)
 
 static size_t zmSqrMont2_deep(size_t n)
 {
-	return utilMax(2,
-		zzSqr_deep(n),
-		zzRedMont_deep(n));
+	return zzSqrMont_deep(n);
 }
 
 static void zmInvMont2(word b[], const word a[], const qr_o* r, void* stack)
 {
-	register size_t k;
 	const zm_mont_params_st* params;
 	ASSERT(zmIsOperable(r));
 	ASSERT(zmIsIn(a, r));
 	params = (const zm_mont_params_st*)r->params;
-	// b <- a^{-1} 2^k \mod mod
-	k = zzAlmostInvMod(b, a, r->mod, r->n, stack);
-	ASSERT(wwBitSize(r->mod, r->n) <= k);
-	ASSERT(k <= 2 * wwBitSize(r->mod, r->n));
-	// b <- a^{-1} R^2 \mod mod
-	for (; k < 2 * params->l; ++k)
-		zzDoubleMod(b, b, r->mod, r->n);
+	zmInvMontL(b, a, r, params->l, stack);
 }
 
 static size_t zmInvMont2_deep(size_t n)
 {
-	return zzAlmostInvMod_deep(n);
+	return zmInvMontL_deep(n);
 }
 
 static void zmDivMont2(word b[], const word divident[], const word a[],
@@ -807,3 +1123,33 @@ size_t zmMontCreate_deep(size_t no)
 		zmInvMont_deep(n),
 		zmDivMont_deep(n));
 }
+
+/*
+*******************************************************************************
+Редукция кольца
+*******************************************************************************
+*/
+
+size_t zmRed(const qr_o* r)
+{
+	ASSERT(zmIsOperable(r));
+	if (r->mul == zmMul)
+		return ZM_RED_PLAIN;
+	if (r->mul == zmMulBarr)
+		return ZM_RED_BARR;
+	if (r->mul == zmMulMont || r->mul == zmMulMont2 ||
+		zmFixKind(r) == ZM_FIX_MONT)
+		return ZM_RED_MONT;
+	ASSERT(r->mul == zmMulCrand || zmFixKind(r) == ZM_FIX_CRAND ||
+		zmFixKind(r) == ZM_FIX_BIGN);
+	return ZM_RED_CRAND;
+}
+
+const char* zmRedName(size_t red)
+{
+	static const char* const names[] =
+	{
+		"AUTO", "PLAIN", "CRAND", "BARR", "MONT",
+	};
+	return red < COUNT_OF(names) ? names[red] : 0;
+}
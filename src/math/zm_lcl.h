@@ -0,0 +1,52 @@
+/*
+*******************************************************************************
+\file zm_lcl.h
+\brief Quotient rings of integers modulo m: local definitions
+\project bee2 [cryptographic library]
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifndef __ZM_LCL_H
+#define __ZM_LCL_H
+
+#include "bee2/math/qr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*******************************************************************************
+Ядра фиксированной длины
+
+Функция zmFixKind() определяет, на каком ядре фиксированной длины
+(см. zz_lcl.h) построены умножение и возведение в квадрат в кольце r:
+-	ZM_FIX_CRAND: zzMulN(), zzSqrN() и редукция zzRedCrandN();
+-	ZM_FIX_MONT: zzMulN(), zzSqrN() и редукция zzRedMontN();
+-	ZM_FIX_BIGN: zzMulN(), zzSqrN() и редукция zzRedBign128(), 
+	zzRedBign192() или zzRedBign256();
+-	ZM_FIX_NONE: ядро не используется.
+.
+Здесь N = r->n. Знание ядра позволяет модулям верхнего уровня (ecp.c)
+обращаться к нему напрямую, минуя указатели r->mul и r->sqr.
+
+\remark Реализована в zm.c.
+*******************************************************************************
+*/
+
+#define ZM_FIX_NONE		0
+#define ZM_FIX_CRAND	1
+#define ZM_FIX_MONT		2
+#define ZM_FIX_BIGN		3
+
+size_t zmFixKind(const qr_o* r);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __ZM_LCL_H */
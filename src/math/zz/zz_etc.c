@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers: other functions
 \project bee2 [cryptographic library]
 \created 2012.04.22
-\version 2021.06.30
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -88,8 +88,28 @@ word zzSubAndW(word b[], const word a[], size_t n, register word w)
 *******************************************************************************
 Квадратичные вычеты
 
-Реализован алгоритм 2.148 из [Menezes A., van Oorschot P., Vanstone S.
-Handbook of Applied Cryptography] в редакции CТБ 34.101.45 (приложение Ж).
+Реализован бинарный алгоритм (без делений), в котором поддерживаются
+нечетное v и произвольное u. На каждом шаге:
+-#	если u нечетное и u < v, то u и v меняются местами, при этом
+	t <- -t, если u, v \equiv 3 \mod 4 (закон взаимности);
+-#	если u нечетное, то u <- u - v;
+-#	u <- u / 2, при этом t <- -t, если v \equiv 3, 5 \mod 8.
+.
+На каждом шаге, пока u != 0, суммарная битовая длина u и v уменьшается
+хотя бы на 1. Поэтому B_OF_W(n + m) шагов достаточно, чтобы обнулить u.
+При u == 0 символ (u / v) равняется 0, если v != 1, и 1, если v == 1.
+Лишние шаги с u == 0 не изменяют t, если v == 1.
+
+Шаги выполняются без ветвлений, с помощью масок. Число шагов и
+последовательность обращений к памяти зависят только от n и m. Таким
+образом, функция регулярна. Сравнение u < v определяется по заему
+при вычитании u - v, обмен и вычитание совмещаются: при обмене
+u <- v - u = -(u - v), v <- u.
+
+Ранее использовался алгоритм 2.148 из [Menezes A., van Oorschot P.,
+Vanstone S. Handbook of Applied Cryptography] в редакции
+CТБ 34.101.45 (приложение Ж), в котором на каждом шаге выполняется
+деление с остатком (zzMod()).
 
 В некоторых приложениях область определения символа Якоби расширяется
 до любых b по следующим правилам:
@@ -106,61 +126,65 @@ Handbook of Applied Cryptography] в редакции CТБ 34.101.45 (прил
 
 int zzJacobi(const word a[], size_t n, const word b[], size_t m, void* stack)
 {
-	register int t = 1;
-	register size_t s;
+	const size_t k = MAX2(n, m);
+	register word t = 0;
+	register word odd;
+	register word swap;
+	register word borrow;
+	register word w;
+	size_t steps, i;
 	// переменные в stack
 	word* u = (word*)stack;
-	word* v = u + n;
-	stack = v + m;
+	word* v = u + k;
+	word* d = v + k;
+	stack = d + k;
 	// pre
 	ASSERT(wwIsValid(a, n));
 	ASSERT(zzIsOdd(b, m));
-	// v <- b
+	// u <- a, v <- b
+	wwCopy(u, a, n);
+	wwSetZero(u + n, k - n);
 	wwCopy(v, b, m);
-	m = wwWordSize(v, m);
-	// u <- a \mod b
-	zzMod(u, a, n, v, m, stack);
-	n = wwWordSize(u, m);
+	wwSetZero(v + m, k - m);
 	// основной цикл
-	while (wwCmpW(v, m, 1) > 0)
+	for (steps = B_OF_W(n + m); steps--;)
 	{
-		// u == 0 => (u / v) <- 0
-		if (wwIsZero(u, n))
+		// d <- u - v, borrow <- u < v
+		for (borrow = 0, i = 0; i < k; ++i)
 		{
-			t = 0;
-			break;
+			w = u[i] - borrow;
+			borrow = wordLess01(u[i], borrow);
+			borrow |= wordLess01(w, v[i]);
+			d[i] = w - v[i];
 		}
-		// u == 1 => (u / v) <- s
-		if (wwIsW(u, n, 1))
-			break;
-		// s <- max_{2^i | u}i
-		s = wwLoZeroBits(u, n);
-		// s -- нечетное, v \equiv 3, 5 \mod 8 => t <- -t
-		if (s % 2 && ((v[0] & 7) == 3 || (v[0] & 7) == 5))
-			t = -t;
-		// u <- u / 2^s
-		wwShLo(u, n, s);
-		n = wwWordSize(u, n);
+		// odd <- u -- нечетное ? -1 : 0, swap <- odd && u < v ? -1 : 0
+		odd = WORD_0 - (u[0] & 1);
+		swap = odd & (WORD_0 - borrow);
 		// u, v \equiv 3 \mod 4 => t <- -t
-		if ((u[0] & 3) == 3 && (v[0] & 3) == 3)
-			t = -t;
-		// v <- v \mod u
-		zzMod(v, v, m, u, n, stack);
-		m = wwWordSize(v, n);
-		// v <-> u
-		wwSwap(u, v, n);
-		s = m, m = n, n = s;
+		t ^= swap & u[0] & v[0] & 2;
+		// v <- swap ? u : v, u <- odd ? (swap ? -d : d) : u
+		for (borrow = swap & 1, i = 0; i < k; ++i)
+		{
+			v[i] ^= (u[i] ^ v[i]) & swap;
+			w = (d[i] ^ swap) + borrow;
+			borrow = wordLess01(w, borrow);
+			u[i] ^= (u[i] ^ w) & odd;
+		}
+		// u <- u / 2
+		wwShLo(u, k, 1);
+		// v \equiv 3, 5 \mod 8 => t <- -t
+		t ^= (v[0] ^ v[0] >> 1) & 2;
 	}
 	// символ Якоби
-	return t;
+	w = wwIsW(v, k, 1);
+	t = ((t >> 1) & 1);
+	odd = swap = borrow = 0;
+	return w ? 1 - 2 * (int)t : 0;
 }
 
 size_t zzJacobi_deep(size_t n, size_t m)
 {
-	return O_OF_W(n + m) + 
-		utilMax(2, 
-			zzMod_deep(n, m), 
-			zzMod_deep(m, n));
+	return O_OF_W(3 * MAX2(n, m));
 }
 
 /*
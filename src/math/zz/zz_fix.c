@@ -0,0 +1,818 @@
+/*
+*******************************************************************************
+\file zz_fix.c
+\brief Multiple-precision unsigned integers: fixed-size kernels
+\project bee2 [cryptographic library]
+\created 2026.10.14
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include "bee2/core/mem.h"
+#include "bee2/core/util.h"
+#include "bee2/core/word.h"
+#include "bee2/math/ww.h"
+#include "bee2/math/zz.h"
+#include "zz_lcl.h"
+
+/*
+*******************************************************************************
+Умножение и возведение в квадрат фиксированной длины
+
+Реализован метод Комбы (product scanning): слова произведения вычисляются
+последовательно, от младших к старшим, и k-е слово накапливается суммой
+произведений a[i] b[j], i + j = k. Сумма хранится в трех словах (r2 r1 r0),
+после обработки k-го столбца слово r0 выгружается в c[k], а сумма
+сдвигается на слово вправо. Циклы полностью развернуты, промежуточные
+данные размещаются в регистрах.
+
+Макрос _MAC добавляет к сумме произведение a b, макрос _MAC2 --
+произведение 2 a b (при возведении в квадрат). Старший бит 2 a b сразу
+добавляется к r2.
+*******************************************************************************
+*/
+
+#define _MAC(a, b)\
+	_MUL(prod, a, b);\
+	prod += r0, r0 = (word)prod, prod >>= B_PER_W;\
+	prod += r1, r1 = (word)prod, r2 += (word)(prod >> B_PER_W)
+
+#define _MAC2(a, b)\
+	_MUL(prod, a, b);\
+	r2 += (word)(prod >> (2 * B_PER_W - 1)), prod <<= 1;\
+	prod += r0, r0 = (word)prod, prod >>= B_PER_W;\
+	prod += r1, r1 = (word)prod, r2 += (word)(prod >> B_PER_W)
+
+#define _COL(c)\
+	(c) = r0, r0 = r1, r1 = r2, r2 = 0
+
+void zzMul4(word c[8], const word a[4], const word b[4])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 4, c, 8));
+	ASSERT(wwIsDisjoint2(b, 4, c, 8));
+	_MAC(a[0], b[0]);
+	_COL(c[0]);
+	_MAC(a[0], b[1]);
+	_MAC(a[1], b[0]);
+	_COL(c[1]);
+	_MAC(a[0], b[2]);
+	_MAC(a[1], b[1]);
+	_MAC(a[2], b[0]);
+	_COL(c[2]);
+	_MAC(a[0], b[3]);
+	_MAC(a[1], b[2]);
+	_MAC(a[2], b[1]);
+	_MAC(a[3], b[0]);
+	_COL(c[3]);
+	_MAC(a[1], b[3]);
+	_MAC(a[2], b[2]);
+	_MAC(a[3], b[1]);
+	_COL(c[4]);
+	_MAC(a[2], b[3]);
+	_MAC(a[3], b[2]);
+	_COL(c[5]);
+	_MAC(a[3], b[3]);
+	_COL(c[6]);
+	c[7] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+void zzMul6(word c[12], const word a[6], const word b[6])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 6, c, 12));
+	ASSERT(wwIsDisjoint2(b, 6, c, 12));
+	_MAC(a[0], b[0]);
+	_COL(c[0]);
+	_MAC(a[0], b[1]);
+	_MAC(a[1], b[0]);
+	_COL(c[1]);
+	_MAC(a[0], b[2]);
+	_MAC(a[1], b[1]);
+	_MAC(a[2], b[0]);
+	_COL(c[2]);
+	_MAC(a[0], b[3]);
+	_MAC(a[1], b[2]);
+	_MAC(a[2], b[1]);
+	_MAC(a[3], b[0]);
+	_COL(c[3]);
+	_MAC(a[0], b[4]);
+	_MAC(a[1], b[3]);
+	_MAC(a[2], b[2]);
+	_MAC(a[3], b[1]);
+	_MAC(a[4], b[0]);
+	_COL(c[4]);
+	_MAC(a[0], b[5]);
+	_MAC(a[1], b[4]);
+	_MAC(a[2], b[3]);
+	_MAC(a[3], b[2]);
+	_MAC(a[4], b[1]);
+	_MAC(a[5], b[0]);
+	_COL(c[5]);
+	_MAC(a[1], b[5]);
+	_MAC(a[2], b[4]);
+	_MAC(a[3], b[3]);
+	_MAC(a[4], b[2]);
+	_MAC(a[5], b[1]);
+	_COL(c[6]);
+	_MAC(a[2], b[5]);
+	_MAC(a[3], b[4]);
+	_MAC(a[4], b[3]);
+	_MAC(a[5], b[2]);
+	_COL(c[7]);
+	_MAC(a[3], b[5]);
+	_MAC(a[4], b[4]);
+	_MAC(a[5], b[3]);
+	_COL(c[8]);
+	_MAC(a[4], b[5]);
+	_MAC(a[5], b[4]);
+	_COL(c[9]);
+	_MAC(a[5], b[5]);
+	_COL(c[10]);
+	c[11] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+void zzMul8(word c[16], const word a[8], const word b[8])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 8, c, 16));
+	ASSERT(wwIsDisjoint2(b, 8, c, 16));
+	_MAC(a[0], b[0]);
+	_COL(c[0]);
+	_MAC(a[0], b[1]);
+	_MAC(a[1], b[0]);
+	_COL(c[1]);
+	_MAC(a[0], b[2]);
+	_MAC(a[1], b[1]);
+	_MAC(a[2], b[0]);
+	_COL(c[2]);
+	_MAC(a[0], b[3]);
+	_MAC(a[1], b[2]);
+	_MAC(a[2], b[1]);
+	_MAC(a[3], b[0]);
+	_COL(c[3]);
+	_MAC(a[0], b[4]);
+	_MAC(a[1], b[3]);
+	_MAC(a[2], b[2]);
+	_MAC(a[3], b[1]);
+	_MAC(a[4], b[0]);
+	_COL(c[4]);
+	_MAC(a[0], b[5]);
+	_MAC(a[1], b[4]);
+	_MAC(a[2], b[3]);
+	_MAC(a[3], b[2]);
+	_MAC(a[4], b[1]);
+	_MAC(a[5], b[0]);
+	_COL(c[5]);
+	_MAC(a[0], b[6]);
+	_MAC(a[1], b[5]);
+	_MAC(a[2], b[4]);
+	_MAC(a[3], b[3]);
+	_MAC(a[4], b[2]);
+	_MAC(a[5], b[1]);
+	_MAC(a[6], b[0]);
+	_COL(c[6]);
+	_MAC(a[0], b[7]);
+	_MAC(a[1], b[6]);
+	_MAC(a[2], b[5]);
+	_MAC(a[3], b[4]);
+	_MAC(a[4], b[3]);
+	_MAC(a[5], b[2]);
+	_MAC(a[6], b[1]);
+	_MAC(a[7], b[0]);
+	_COL(c[7]);
+	_MAC(a[1], b[7]);
+	_MAC(a[2], b[6]);
+	_MAC(a[3], b[5]);
+	_MAC(a[4], b[4]);
+	_MAC(a[5], b[3]);
+	_MAC(a[6], b[2]);
+	_MAC(a[7], b[1]);
+	_COL(c[8]);
+	_MAC(a[2], b[7]);
+	_MAC(a[3], b[6]);
+	_MAC(a[4], b[5]);
+	_MAC(a[5], b[4]);
+	_MAC(a[6], b[3]);
+	_MAC(a[7], b[2]);
+	_COL(c[9]);
+	_MAC(a[3], b[7]);
+	_MAC(a[4], b[6]);
+	_MAC(a[5], b[5]);
+	_MAC(a[6], b[4]);
+	_MAC(a[7], b[3]);
+	_COL(c[10]);
+	_MAC(a[4], b[7]);
+	_MAC(a[5], b[6]);
+	_MAC(a[6], b[5]);
+	_MAC(a[7], b[4]);
+	_COL(c[11]);
+	_MAC(a[5], b[7]);
+	_MAC(a[6], b[6]);
+	_MAC(a[7], b[5]);
+	_COL(c[12]);
+	_MAC(a[6], b[7]);
+	_MAC(a[7], b[6]);
+	_COL(c[13]);
+	_MAC(a[7], b[7]);
+	_COL(c[14]);
+	c[15] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+void zzSqr4(word b[8], const word a[4])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 4, b, 8));
+	_MAC(a[0], a[0]);
+	_COL(b[0]);
+	_MAC2(a[0], a[1]);
+	_COL(b[1]);
+	_MAC2(a[0], a[2]);
+	_MAC(a[1], a[1]);
+	_COL(b[2]);
+	_MAC2(a[0], a[3]);
+	_MAC2(a[1], a[2]);
+	_COL(b[3]);
+	_MAC2(a[1], a[3]);
+	_MAC(a[2], a[2]);
+	_COL(b[4]);
+	_MAC2(a[2], a[3]);
+	_COL(b[5]);
+	_MAC(a[3], a[3]);
+	_COL(b[6]);
+	b[7] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+void zzSqr6(word b[12], const word a[6])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 6, b, 12));
+	_MAC(a[0], a[0]);
+	_COL(b[0]);
+	_MAC2(a[0], a[1]);
+	_COL(b[1]);
+	_MAC2(a[0], a[2]);
+	_MAC(a[1], a[1]);
+	_COL(b[2]);
+	_MAC2(a[0], a[3]);
+	_MAC2(a[1], a[2]);
+	_COL(b[3]);
+	_MAC2(a[0], a[4]);
+	_MAC2(a[1], a[3]);
+	_MAC(a[2], a[2]);
+	_COL(b[4]);
+	_MAC2(a[0], a[5]);
+	_MAC2(a[1], a[4]);
+	_MAC2(a[2], a[3]);
+	_COL(b[5]);
+	_MAC2(a[1], a[5]);
+	_MAC2(a[2], a[4]);
+	_MAC(a[3], a[3]);
+	_COL(b[6]);
+	_MAC2(a[2], a[5]);
+	_MAC2(a[3], a[4]);
+	_COL(b[7]);
+	_MAC2(a[3], a[5]);
+	_MAC(a[4], a[4]);
+	_COL(b[8]);
+	_MAC2(a[4], a[5]);
+	_COL(b[9]);
+	_MAC(a[5], a[5]);
+	_COL(b[10]);
+	b[11] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+void zzSqr8(word b[16], const word a[8])
+{
+	register word r0 = 0, r1 = 0, r2 = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 8, b, 16));
+	_MAC(a[0], a[0]);
+	_COL(b[0]);
+	_MAC2(a[0], a[1]);
+	_COL(b[1]);
+	_MAC2(a[0], a[2]);
+	_MAC(a[1], a[1]);
+	_COL(b[2]);
+	_MAC2(a[0], a[3]);
+	_MAC2(a[1], a[2]);
+	_COL(b[3]);
+	_MAC2(a[0], a[4]);
+	_MAC2(a[1], a[3]);
+	_MAC(a[2], a[2]);
+	_COL(b[4]);
+	_MAC2(a[0], a[5]);
+	_MAC2(a[1], a[4]);
+	_MAC2(a[2], a[3]);
+	_COL(b[5]);
+	_MAC2(a[0], a[6]);
+	_MAC2(a[1], a[5]);
+	_MAC2(a[2], a[4]);
+	_MAC(a[3], a[3]);
+	_COL(b[6]);
+	_MAC2(a[0], a[7]);
+	_MAC2(a[1], a[6]);
+	_MAC2(a[2], a[5]);
+	_MAC2(a[3], a[4]);
+	_COL(b[7]);
+	_MAC2(a[1], a[7]);
+	_MAC2(a[2], a[6]);
+	_MAC2(a[3], a[5]);
+	_MAC(a[4], a[4]);
+	_COL(b[8]);
+	_MAC2(a[2], a[7]);
+	_MAC2(a[3], a[6]);
+	_MAC2(a[4], a[5]);
+	_COL(b[9]);
+	_MAC2(a[3], a[7]);
+	_MAC2(a[4], a[6]);
+	_MAC(a[5], a[5]);
+	_COL(b[10]);
+	_MAC2(a[4], a[7]);
+	_MAC2(a[5], a[6]);
+	_COL(b[11]);
+	_MAC2(a[5], a[7]);
+	_MAC(a[6], a[6]);
+	_COL(b[12]);
+	_MAC2(a[6], a[7]);
+	_COL(b[13]);
+	_MAC(a[7], a[7]);
+	_COL(b[14]);
+	b[15] = r0;
+	prod = 0, r0 = r1 = 0;
+}
+
+/*
+*******************************************************************************
+Редукция Крэндалла фиксированной длины
+
+Модуль mod = B^n - c, 0 < c < B. Повторяется алгоритм zzRedCrand():
+1) a <- a[0..n) + c a[n..2n) (переносом является слово carry);
+2) a <- a + c carry;
+3) если a >= mod или возник перенос, то a <- a - mod = a + c - B^n.
+Первый шаг развернут полностью. Коррекция на шаге 3 выполняется без
+ветвлений, как в SAFE(zzRedCrand).
+*******************************************************************************
+*/
+
+#define _CRAND(i, n)\
+	_MUL(prod, w, a[(n) + (i)]);\
+	prod += carry, prod += a[i];\
+	a[i] = (word)prod, carry = (word)(prod >> B_PER_W)
+
+static void zzRedCrandCorr(word a[], const word mod[], size_t n,
+	register word w, register word carry)
+{
+	register dword prod;
+	register word mask;
+	size_t i;
+	// a <- a + c carry
+	_MUL(prod, carry, w);
+	prod += a[0];
+	a[0] = (word)prod;
+	carry = (word)(prod >> B_PER_W);
+	// a >= mod?
+	mask = wordLeq01(mod[0], a[0]);
+	for (i = 1; i < n; ++i)
+	{
+		a[i] += carry;
+		carry = wordLess01(a[i], carry);
+		mask &= wordEq01(mod[i], a[i]);
+		mask |= wordLess01(mod[i], a[i]);
+	}
+	// a <- a - mod
+	mask |= carry;
+	mask = WORD_0 - mask;
+	zzAddW2(a, n, mask & w);
+	prod = 0, mask = 0;
+}
+
+void zzRedCrand4(word a[8], const word mod[4])
+{
+	register word w = WORD_0 - mod[0];
+	register word carry = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 8, mod, 4));
+	ASSERT(mod[0] && wwIsRepW(mod + 1, 3, WORD_MAX));
+	_CRAND(0, 4);
+	_CRAND(1, 4);
+	_CRAND(2, 4);
+	_CRAND(3, 4);
+	zzRedCrandCorr(a, mod, 4, w, carry);
+	prod = 0, w = carry = 0;
+}
+
+void zzRedCrand6(word a[12], const word mod[6])
+{
+	register word w = WORD_0 - mod[0];
+	register word carry = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 12, mod, 6));
+	ASSERT(mod[0] && wwIsRepW(mod + 1, 5, WORD_MAX));
+	_CRAND(0, 6);
+	_CRAND(1, 6);
+	_CRAND(2, 6);
+	_CRAND(3, 6);
+	_CRAND(4, 6);
+	_CRAND(5, 6);
+	zzRedCrandCorr(a, mod, 6, w, carry);
+	prod = 0, w = carry = 0;
+}
+
+void zzRedCrand8(word a[16], const word mod[8])
+{
+	register word w = WORD_0 - mod[0];
+	register word carry = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 16, mod, 8));
+	ASSERT(mod[0] && wwIsRepW(mod + 1, 7, WORD_MAX));
+	_CRAND(0, 8);
+	_CRAND(1, 8);
+	_CRAND(2, 8);
+	_CRAND(3, 8);
+	_CRAND(4, 8);
+	_CRAND(5, 8);
+	_CRAND(6, 8);
+	_CRAND(7, 8);
+	zzRedCrandCorr(a, mod, 8, w, carry);
+	prod = 0, w = carry = 0;
+}
+
+/*
+*******************************************************************************
+Редукция Монтгомери фиксированной длины
+
+Повторяется алгоритм zzRedMont() в редакции Дуссе -- Калиски. На i-м шаге
+к a добавляется произведение w * mod * B^i, где w = a[i] mont_param \bmod B.
+Перенос из слова a[i + n] не распространяется по старшим словам,
+а сохраняется в переменной top и учитывается на следующем шаге. Шаги
+развернуты полностью. Заключительное вычитание mod выполняется без
+ветвлений.
+*******************************************************************************
+*/
+
+#define _MONT(i, j)\
+	_MUL(prod, w, mod[j]);\
+	prod += carry, prod += a[(i) + (j)];\
+	a[(i) + (j)] = (word)prod, carry = (word)(prod >> B_PER_W)
+
+#define _MONT_TOP(k)\
+	prod = top, prod += carry, prod += a[k];\
+	a[k] = (word)prod, top = (word)(prod >> B_PER_W)
+
+static void zzRedMontCorr(word a[], const word mod[], size_t n,
+	register word top)
+{
+	register word mask = 1;
+	size_t i;
+	// a <- a / B^n, a >= mod?
+	for (i = 0; i < n; ++i)
+	{
+		a[i] = a[n + i];
+		mask &= wordEq01(mod[i], a[i]);
+		mask |= wordLess01(mod[i], a[i]);
+	}
+	// a <- a - mod
+	mask |= top, mask = WORD_0 - mask;
+	zzSubAndW(a, mod, n, mask);
+	mask = 0;
+}
+
+void zzRedMont4(word a[8], const word mod[4], register word mont_param)
+{
+	register word w, carry, top = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 8, mod, 4));
+	ASSERT(mod[3] != 0 && mod[0] % 2);
+	ASSERT((word)(mod[0] * mont_param + 1) == 0);
+	_MUL_LO(w, a[0], mont_param);
+	carry = 0;
+	_MONT(0, 0);
+	_MONT(0, 1);
+	_MONT(0, 2);
+	_MONT(0, 3);
+	_MONT_TOP(4);
+	_MUL_LO(w, a[1], mont_param);
+	carry = 0;
+	_MONT(1, 0);
+	_MONT(1, 1);
+	_MONT(1, 2);
+	_MONT(1, 3);
+	_MONT_TOP(5);
+	_MUL_LO(w, a[2], mont_param);
+	carry = 0;
+	_MONT(2, 0);
+	_MONT(2, 1);
+	_MONT(2, 2);
+	_MONT(2, 3);
+	_MONT_TOP(6);
+	_MUL_LO(w, a[3], mont_param);
+	carry = 0;
+	_MONT(3, 0);
+	_MONT(3, 1);
+	_MONT(3, 2);
+	_MONT(3, 3);
+	_MONT_TOP(7);
+	zzRedMontCorr(a, mod, 4, top);
+	prod = 0, w = carry = top = 0;
+}
+
+void zzRedMont6(word a[12], const word mod[6], register word mont_param)
+{
+	register word w, carry, top = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 12, mod, 6));
+	ASSERT(mod[5] != 0 && mod[0] % 2);
+	ASSERT((word)(mod[0] * mont_param + 1) == 0);
+	_MUL_LO(w, a[0], mont_param);
+	carry = 0;
+	_MONT(0, 0);
+	_MONT(0, 1);
+	_MONT(0, 2);
+	_MONT(0, 3);
+	_MONT(0, 4);
+	_MONT(0, 5);
+	_MONT_TOP(6);
+	_MUL_LO(w, a[1], mont_param);
+	carry = 0;
+	_MONT(1, 0);
+	_MONT(1, 1);
+	_MONT(1, 2);
+	_MONT(1, 3);
+	_MONT(1, 4);
+	_MONT(1, 5);
+	_MONT_TOP(7);
+	_MUL_LO(w, a[2], mont_param);
+	carry = 0;
+	_MONT(2, 0);
+	_MONT(2, 1);
+	_MONT(2, 2);
+	_MONT(2, 3);
+	_MONT(2, 4);
+	_MONT(2, 5);
+	_MONT_TOP(8);
+	_MUL_LO(w, a[3], mont_param);
+	carry = 0;
+	_MONT(3, 0);
+	_MONT(3, 1);
+	_MONT(3, 2);
+	_MONT(3, 3);
+	_MONT(3, 4);
+	_MONT(3, 5);
+	_MONT_TOP(9);
+	_MUL_LO(w, a[4], mont_param);
+	carry = 0;
+	_MONT(4, 0);
+	_MONT(4, 1);
+	_MONT(4, 2);
+	_MONT(4, 3);
+	_MONT(4, 4);
+	_MONT(4, 5);
+	_MONT_TOP(10);
+	_MUL_LO(w, a[5], mont_param);
+	carry = 0;
+	_MONT(5, 0);
+	_MONT(5, 1);
+	_MONT(5, 2);
+	_MONT(5, 3);
+	_MONT(5, 4);
+	_MONT(5, 5);
+	_MONT_TOP(11);
+	zzRedMontCorr(a, mod, 6, top);
+	prod = 0, w = carry = top = 0;
+}
+
+void zzRedMont8(word a[16], const word mod[8], register word mont_param)
+{
+	register word w, carry, top = 0;
+	register dword prod;
+	ASSERT(wwIsDisjoint2(a, 16, mod, 8));
+	ASSERT(mod[7] != 0 && mod[0] % 2);
+	ASSERT((word)(mod[0] * mont_param + 1) == 0);
+	_MUL_LO(w, a[0], mont_param);
+	carry = 0;
+	_MONT(0, 0);
+	_MONT(0, 1);
+	_MONT(0, 2);
+	_MONT(0, 3);
+	_MONT(0, 4);
+	_MONT(0, 5);
+	_MONT(0, 6);
+	_MONT(0, 7);
+	_MONT_TOP(8);
+	_MUL_LO(w, a[1], mont_param);
+	carry = 0;
+	_MONT(1, 0);
+	_MONT(1, 1);
+	_MONT(1, 2);
+	_MONT(1, 3);
+	_MONT(1, 4);
+	_MONT(1, 5);
+	_MONT(1, 6);
+	_MONT(1, 7);
+	_MONT_TOP(9);
+	_MUL_LO(w, a[2], mont_param);
+	carry = 0;
+	_MONT(2, 0);
+	_MONT(2, 1);
+	_MONT(2, 2);
+	_MONT(2, 3);
+	_MONT(2, 4);
+	_MONT(2, 5);
+	_MONT(2, 6);
+	_MONT(2, 7);
+	_MONT_TOP(10);
+	_MUL_LO(w, a[3], mont_param);
+	carry = 0;
+	_MONT(3, 0);
+	_MONT(3, 1);
+	_MONT(3, 2);
+	_MONT(3, 3);
+	_MONT(3, 4);
+	_MONT(3, 5);
+	_MONT(3, 6);
+	_MONT(3, 7);
+	_MONT_TOP(11);
+	_MUL_LO(w, a[4], mont_param);
+	carry = 0;
+	_MONT(4, 0);
+	_MONT(4, 1);
+	_MONT(4, 2);
+	_MONT(4, 3);
+	_MONT(4, 4);
+	_MONT(4, 5);
+	_MONT(4, 6);
+	_MONT(4, 7);
+	_MONT_TOP(12);
+	_MUL_LO(w, a[5], mont_param);
+	carry = 0;
+	_MONT(5, 0);
+	_MONT(5, 1);
+	_MONT(5, 2);
+	_MONT(5, 3);
+	_MONT(5, 4);
+	_MONT(5, 5);
+	_MONT(5, 6);
+	_MONT(5, 7);
+	_MONT_TOP(13);
+	_MUL_LO(w, a[6], mont_param);
+	carry = 0;
+	_MONT(6, 0);
+	_MONT(6, 1);
+	_MONT(6, 2);
+	_MONT(6, 3);
+	_MONT(6, 4);
+	_MONT(6, 5);
+	_MONT(6, 6);
+	_MONT(6, 7);
+	_MONT_TOP(14);
+	_MUL_LO(w, a[7], mont_param);
+	carry = 0;
+	_MONT(7, 0);
+	_MONT(7, 1);
+	_MONT(7, 2);
+	_MONT(7, 3);
+	_MONT(7, 4);
+	_MONT(7, 5);
+	_MONT(7, 6);
+	_MONT(7, 7);
+	_MONT_TOP(15);
+	zzRedMontCorr(a, mod, 8, top);
+	prod = 0, w = carry = top = 0;
+}
+
+/*
+*******************************************************************************
+Арифметика по модулям bign
+
+Модули кривых bign-curve128v1, bign-curve192v1, bign-curve256v1 имеют вид
+p = 2^l - c, где (l, c) = (256, 189), (384, 317), (512, 569). На платформах
+с 64-разрядным словом это модули Крэндалла из n = 4, 6, 8 слов, константа c
+встраивается в код.
+
+Поскольку c < 2^10, после первого шага редукции Крэндалла
+	v <- a[0..n) + c a[n..2n) = a' + carry B^n
+перенос carry не превосходит c, а произведение carry c умещается в слово.
+Второй шаг и приведение к каноническому виду объединяются (без сравнения
+с модулем):
+1) a' <- a' + (carry + 1) c, o -- перенос за пределы B^n;
+2) если o == 0, то a' <- a' - c.
+Действительно, пусть u = a' + carry c. Если u < p, то a' + (carry + 1) c < B^n
+и результатом является a' - c = u. Иначе p <= u < 2p, o == 1 и результатом
+является u - p = a' + (carry + 1) c - B^n. Шаг 2 выполняется без ветвлений.
+
+Сложение и вычитание по модулю p также выполняются без сравнения с модулем.
+При сложении s = a + b < 2p условие s >= p равносильно тому, что перенос
+возникает либо при вычислении a + b, либо при добавлении c к младшим n
+словам суммы; в обоих случаях результатом является s + c mod B^n. При
+вычитании заем означает, что к разности нужно добавить p, то есть
+вычесть c по модулю B^n.
+
+Длина n и константа c встраиваются в код, циклы по словам имеют
+постоянные границы и развертываются компилятором.
+*******************************************************************************
+*/
+
+#if (B_PER_W == 64)
+
+#define _RED_BIGN(name, n, c)\
+void name(word a[2 * n])\
+{\
+	register word carry = 0;\
+	register word w;\
+	register dword prod;\
+	size_t i;\
+	ASSERT(wwIsValid(a, 2 * n));\
+	/* a <- a[0..n) + c a[n..2n) */\
+	for (i = 0; i < n; ++i)\
+	{\
+		_MUL(prod, (word)(c), a[n + i]);\
+		prod += carry, prod += a[i];\
+		a[i] = (word)prod, carry = (word)(prod >> B_PER_W);\
+	}\
+	/* a <- a + (carry + 1) c */\
+	w = (carry + 1) * (word)(c);\
+	for (i = 0; i < n; ++i)\
+		a[i] += w, w = wordLess01(a[i], w);\
+	/* o == 0 => a <- a - c */\
+	w = (WORD_0 - (w ^ 1)) & (word)(c);\
+	for (i = 0; i < n; ++i)\
+		a[i] -= w, w = wordLess01(~w, a[i]);\
+	prod = 0, carry = w = 0;\
+}
+
+#define _ADD_BIGN(name, n, c)\
+void name(word d[n], const word a[n], const word b[n])\
+{\
+	register word carry = 0;\
+	register word w;\
+	size_t i;\
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n));\
+	ASSERT(wwIsSameOrDisjoint(a, d, n) && wwIsSameOrDisjoint(b, d, n));\
+	/* d <- a + b */\
+	for (i = 0; i < n; ++i)\
+	{\
+		w = a[i] + carry;\
+		carry = wordLess01(w, carry);\
+		d[i] = w + b[i];\
+		carry |= wordLess01(d[i], w);\
+	}\
+	/* перенос при вычислении d + c */\
+	w = (word)(c);\
+	for (i = 0; i < n; ++i)\
+		w = wordLess01(d[i] + w, w);\
+	/* a + b >= p => d <- d + c */\
+	w = (WORD_0 - (carry | w)) & (word)(c);\
+	for (i = 0; i < n; ++i)\
+		d[i] += w, w = wordLess01(d[i], w);\
+	carry = w = 0;\
+}
+
+#define _SUB_BIGN(name, n, c)\
+void name(word d[n], const word a[n], const word b[n])\
+{\
+	register word borrow = 0;\
+	register word w;\
+	size_t i;\
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n));\
+	ASSERT(wwIsSameOrDisjoint(a, d, n) && wwIsSameOrDisjoint(b, d, n));\
+	/* d <- a - b */\
+	for (i = 0; i < n; ++i)\
+	{\
+		w = a[i] - borrow;\
+		borrow = wordLess01(a[i], borrow);\
+		borrow |= wordLess01(w, b[i]);\
+		d[i] = w - b[i];\
+	}\
+	/* a < b => d <- d - c */\
+	w = (WORD_0 - borrow) & (word)(c);\
+	for (i = 0; i < n; ++i)\
+		borrow = wordLess01(d[i], w), d[i] -= w, w = borrow;\
+	borrow = w = 0;\
+}
+
+_RED_BIGN(zzRedBign128, 4, 189)
+_RED_BIGN(zzRedBign192, 6, 317)
+_RED_BIGN(zzRedBign256, 8, 569)
+
+_ADD_BIGN(zzAddModBign128, 4, 189)
+_ADD_BIGN(zzAddModBign192, 6, 317)
+_ADD_BIGN(zzAddModBign256, 8, 569)
+
+_SUB_BIGN(zzSubModBign128, 4, 189)
+_SUB_BIGN(zzSubModBign192, 6, 317)
+_SUB_BIGN(zzSubModBign256, 8, 569)
+
+#endif
@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers: local definitions
 \project bee2 [cryptographic library]
 \created 2016.07.01
-\version 2019.06.27
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -93,6 +93,113 @@ _MUL_LO:
 #define _MUL_LO(c, a, b)\
 	(c) = (word)(a) * (word)(b);
 
+/*
+*******************************************************************************
+Умножение Карацубы
+
+Функция zzMul() обращается к алгоритму Карацубы, если длины n и m
+сомножителей не меньше ZZ_KARA_THRESHOLD и max(n, m) < 2 min(n, m).
+Функция zzSqr() обращается к алгоритму Карацубы, если длина n
+не меньше ZZ_KARA_SQR_THRESHOLD. Иначе используются школьные алгоритмы.
+Пороги подобраны по результатам zzBench() на платформе x86-64: школьный
+алгоритм с 128-битовыми произведениями слов проигрывает алгоритму
+Карацубы только на длинных числах. При возведении в квадрат школьный
+алгоритм вдвое сокращает число умножений слов, поэтому порог выше.
+
+Функции zzMulSchool(), zzSqrSchool(), zzMulKara(), zzSqrKara()
+вызываются из zzMul(), zzSqr() и zzBench(). Функции zzMulKara()
+и zzSqrKara() требуют min(n, m) >= 4 и используют стек глубины
+zzMulKara_deep(n, m) и zzSqrKara_deep(n).
+
+\remark Реализованы в zz_mul.c.
+*******************************************************************************
+*/
+
+#ifndef ZZ_KARA_THRESHOLD
+	#define ZZ_KARA_THRESHOLD 48
+#endif
+
+#ifndef ZZ_KARA_SQR_THRESHOLD
+	#define ZZ_KARA_SQR_THRESHOLD 64
+#endif
+
+#define zzMulIsKara(n, m)\
+	(MIN2(n, m) >= ZZ_KARA_THRESHOLD && MAX2(n, m) < 2 * MIN2(n, m))
+
+void zzMulSchool(word c[], const word a[], size_t n, const word b[],
+	size_t m);
+void zzMulKara(word c[], const word a[], size_t n, const word b[], size_t m,
+	void* stack);
+size_t zzMulKara_deep(size_t n, size_t m);
+
+void zzSqrSchool(word b[], const word a[], size_t n);
+void zzSqrKara(word b[], const word a[], size_t n, void* stack);
+size_t zzSqrKara_deep(size_t n);
+
+/*
+*******************************************************************************
+Ядра фиксированной длины
+
+Умножение, возведение в квадрат, редукции Крэндалла и Монтгомери для
+n = 4, 6, 8 слов с полностью развернутыми циклами. Функции повторяют
+zzMul(), zzSqr(), SAFE(zzRedCrand)() и SAFE(zzRedMont)() с n == m и
+не используют стек. Выходы функций умножения не должны пересекаться
+со входами. Функции редукции выполняются без ветвлений.
+
+Ядра выбираются при создании колец вычетов (см. zm.c) и используются
+в кривых bign (n = 4, 6, 8 на 64-разрядных платформах).
+
+
+\remark Реализованы в zz_fix.c.
+*******************************************************************************
+*/
+
+void zzMul4(word c[8], const word a[4], const word b[4]);
+void zzMul6(word c[12], const word a[6], const word b[6]);
+void zzMul8(word c[16], const word a[8], const word b[8]);
+
+void zzSqr4(word b[8], const word a[4]);
+void zzSqr6(word b[12], const word a[6]);
+void zzSqr8(word b[16], const word a[8]);
+
+void zzRedCrand4(word a[8], const word mod[4]);
+void zzRedCrand6(word a[12], const word mod[6]);
+void zzRedCrand8(word a[16], const word mod[8]);
+
+void zzRedMont4(word a[8], const word mod[4], register word mont_param);
+void zzRedMont6(word a[12], const word mod[6], register word mont_param);
+void zzRedMont8(word a[16], const word mod[8], register word mont_param);
+
+/*
+*******************************************************************************
+Арифметика по модулям bign
+
+Функции zzRedBign128(), zzRedBign192(), zzRedBign256() повторяют
+zzRedCrand4(), zzRedCrand6(), zzRedCrand8() для модулей
+p = 2^256 - 189, 2^384 - 317, 2^512 - 569 кривых bign-curve128v1,
+bign-curve192v1, bign-curve256v1. Функции zzAddModBignL(), zzSubModBignL()
+повторяют zzAddMod(), zzSubMod() для тех же модулей (L = 128, 192, 256).
+Модули встроены в код. Функции выполняются без ветвлений и определены
+только при B_PER_W == 64.
+
+\remark Реализованы в zz_fix.c.
+*******************************************************************************
+*/
+
+#if (B_PER_W == 64)
+void zzRedBign128(word a[8]);
+void zzRedBign192(word a[12]);
+void zzRedBign256(word a[16]);
+
+void zzAddModBign128(word d[4], const word a[4], const word b[4]);
+void zzAddModBign192(word d[6], const word a[6], const word b[6]);
+void zzAddModBign256(word d[8], const word a[8], const word b[8]);
+
+void zzSubModBign128(word d[4], const word a[4], const word b[4]);
+void zzSubModBign192(word d[6], const word a[6], const word b[6]);
+void zzSubModBign256(word d[8], const word a[8], const word b[8]);
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers: multiplicative operations
 \project bee2 [cryptographic library]
 \created 2012.04.22
-\version 2019.06.26
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -21,8 +21,15 @@
 *******************************************************************************
 Умножение / возведение в квадрат
 
+Функции zzMulSchool() и zzSqrSchool() реализуют школьные алгоритмы.
+Функции zzMulKara() и zzSqrKara() реализуют алгоритм Карацубы: при
+a = a0 + a1 B^h, b = b0 + b1 B^h
+	a b = a0 b0 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B^h + a1 b1 B^{2h}.
+Сомножители a0 + a1 и b0 + b1 занимают на одно слово больше, чем a1 и b1.
+Три произведения меньшей длины вычисляются рекурсивно через zzMul()
+(zzSqr()). Пороги перехода к алгоритму Карацубы описаны в zz_lcl.h.
+
 \todo Возведение в квадрат за один проход (?), сначала с квадратов (?).
-\todo Умножение Карацубы.
 *******************************************************************************
 */
 
@@ -80,8 +87,8 @@ word zzSubMulW(word b[], const word a[], size_t n, register word w)
 	return borrow;
 }
 
-void zzMul(word c[], const word a[], size_t n, const word b[], size_t m, 
-	void* stack)
+void zzMulSchool(word c[], const word a[], size_t n, const word b[],
+	size_t m)
 {
 	register word carry = 0;
 	register dword prod;
@@ -105,12 +112,67 @@ void zzMul(word c[], const word a[], size_t n, const word b[], size_t m,
 	prod = 0;
 }
 
+void zzMulKara(word c[], const word a[], size_t n, const word b[], size_t m,
+	void* stack)
+{
+	const size_t h = MIN2(n, m) / 2;
+	const size_t n1 = n - h, m1 = m - h;
+	word* sa = (word*)stack;
+	word* sb = sa + n1 + 1;
+	word* mid = sb + m1 + 1;
+	word carry;
+	// pre
+	ASSERT(h >= 2);
+	ASSERT(wwIsDisjoint2(a, n, c, n + m));
+	ASSERT(wwIsDisjoint2(b, m, c, n + m));
+	stack = mid + n1 + m1 + 2;
+	// c <- a0 b0 + a1 b1 B^{2h}
+	zzMul(c, a, h, b, h, stack);
+	zzMul(c + 2 * h, a + h, n1, b + h, m1, stack);
+	// sa <- a0 + a1, sb <- b0 + b1
+	wwCopy(sa, a + h, n1);
+	sa[n1] = zzAddW2(sa + h, n1 - h, zzAdd2(sa, a, h));
+	wwCopy(sb, b + h, m1);
+	sb[m1] = zzAddW2(sb + h, m1 - h, zzAdd2(sb, b, h));
+	// mid <- sa sb - a0 b0 - a1 b1
+	zzMul(mid, sa, n1 + 1, sb, m1 + 1, stack);
+	carry = zzSub2(mid, c, 2 * h);
+	zzSubW2(mid + 2 * h, n1 + m1 + 2 - 2 * h, carry);
+	carry = zzSub2(mid, c + 2 * h, n1 + m1);
+	zzSubW2(mid + n1 + m1, 2, carry);
+	// c <- c + mid B^h
+	carry = zzAdd2(c + h, mid, n1 + m1 + 2);
+	zzAddW2(c + h + n1 + m1 + 2, h - 2, carry);
+	// очистка
+	carry = 0;
+}
+
+size_t zzMulKara_deep(size_t n, size_t m)
+{
+	const size_t h = MIN2(n, m) / 2;
+	const size_t n1 = n - h, m1 = m - h;
+	return O_OF_W(2 * (n1 + m1 + 2)) +
+		utilMax(3,
+			zzMul_deep(h, h),
+			zzMul_deep(n1, m1),
+			zzMul_deep(n1 + 1, m1 + 1));
+}
+
+void zzMul(word c[], const word a[], size_t n, const word b[], size_t m,
+	void* stack)
+{
+	if (zzMulIsKara(n, m))
+		zzMulKara(c, a, n, b, m, stack);
+	else
+		zzMulSchool(c, a, n, b, m);
+}
+
 size_t zzMul_deep(size_t n, size_t m)
 {
-	return 0;
+	return zzMulIsKara(n, m) ? zzMulKara_deep(n, m) : 0;
 }
 
-void zzSqr(word b[], const word a[], size_t n, void* stack)
+void zzSqrSchool(word b[], const word a[], size_t n)
 {
 	register word carry = 0;
 	register word carry1;
@@ -155,9 +217,58 @@ void zzSqr(word b[], const word a[], size_t n, void* stack)
 	carry = carry1 = 0;
 }
 
+void zzSqrKara(word b[], const word a[], size_t n, void* stack)
+{
+	const size_t h = n / 2;
+	const size_t n1 = n - h;
+	word* sa = (word*)stack;
+	word* mid = sa + n1 + 1;
+	word carry;
+	// pre
+	ASSERT(h >= 2);
+	ASSERT(wwIsDisjoint2(a, n, b, n + n));
+	stack = mid + 2 * n1 + 2;
+	// b <- a0^2 + a1^2 B^{2h}
+	zzSqr(b, a, h, stack);
+	zzSqr(b + 2 * h, a + h, n1, stack);
+	// sa <- a0 + a1
+	wwCopy(sa, a + h, n1);
+	sa[n1] = zzAddW2(sa + h, n1 - h, zzAdd2(sa, a, h));
+	// mid <- sa^2 - a0^2 - a1^2
+	zzSqr(mid, sa, n1 + 1, stack);
+	carry = zzSub2(mid, b, 2 * h);
+	zzSubW2(mid + 2 * h, 2 * n1 + 2 - 2 * h, carry);
+	carry = zzSub2(mid, b + 2 * h, 2 * n1);
+	zzSubW2(mid + 2 * n1, 2, carry);
+	// b <- b + mid B^h
+	carry = zzAdd2(b + h, mid, 2 * n1 + 2);
+	zzAddW2(b + h + 2 * n1 + 2, h - 2, carry);
+	// очистка
+	carry = 0;
+}
+
+size_t zzSqrKara_deep(size_t n)
+{
+	const size_t h = n / 2;
+	const size_t n1 = n - h;
+	return O_OF_W(3 * n1 + 3) +
+		utilMax(3,
+			zzSqr_deep(h),
+			zzSqr_deep(n1),
+			zzSqr_deep(n1 + 1));
+}
+
+void zzSqr(word b[], const word a[], size_t n, void* stack)
+{
+	if (n >= ZZ_KARA_SQR_THRESHOLD)
+		zzSqrKara(b, a, n, stack);
+	else
+		zzSqrSchool(b, a, n);
+}
+
 size_t zzSqr_deep(size_t n)
 {
-	return 0;
+	return n >= ZZ_KARA_SQR_THRESHOLD ? zzSqrKara_deep(n) : 0;
 }
 
 /*
@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers: modular exponentiation
 \project bee2 [cryptographic library]
 \created 2012.04.22
-\version 2016.07.01
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,7 @@
 #include "bee2/math/ww.h"
 #include "bee2/math/zm.h"
 #include "bee2/math/zz.h"
+#include "core/stat_lcl.h"
 
 /*
 *******************************************************************************
@@ -30,6 +31,7 @@ void zzPowerMod(word c[], const word a[], size_t n, const word b[], size_t m,
 	// переменные в stack
 	word* t;
 	qr_o* r;
+	STAT_BEGIN;
 	// pre
 	ASSERT(n > 0 && mod[n - 1] != 0);
 	ASSERT(wwCmp(a, mod, n) < 0);
@@ -50,6 +52,7 @@ void zzPowerMod(word c[], const word a[], size_t n, const word b[], size_t m,
 	// c <- t
 	qrTo((octet*)t, t, r, stack);
 	wwFrom(c, t, no);
+	STAT_END(STAT_ZZ_POWERMOD, 0);
 }
 
 size_t zzPowerMod_deep(size_t n, size_t m)
@@ -4,7 +4,7 @@
 \brief Multiple-precision unsigned integers: modular reductions
 \project bee2 [cryptographic library]
 \created 2012.04.22
-\version 2019.06.26
+\version 2026.10.14
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -295,6 +295,141 @@ size_t zzRedMont_deep(size_t n)
 	return 0;
 }
 
+/*
+*******************************************************************************
+Умножение Монтгомери
+
+В функции zzMulMont() реализован алгоритм CIOS (Coarsely Integrated Operand
+Scanning) из работы [Koc C. K., Acar T., Kaliski B. S. Analyzing and
+comparing Montgomery multiplication algorithms. IEEE Micro, 16(3):26–33,
+1996]. Умножение и редукция чередуются, промежуточное значение занимает
+n + 2 слова стека (вместо 2n слов произведения):
+[pretime]    m* <- -mod[0]^{-1} \bmod B
+[realtime]   t <- 0
+             for (i = 0; i < n; ++i)
+               t <- t + a * b[i]
+               w <- t[0] * m* \mod B
+               t <- (t + w * mod) / B
+             if (t >= mod)
+               t <- t - mod
+После каждой итерации t < 2 mod, поэтому t умещается в n + 1 слово.
+Слово t[n + 1] принимает значения 0 или 1 и используется только
+внутри итерации.
+
+Функция zzSqrMont() вызывает zzMulMont() с одинаковыми множителями.
+Возведение в квадрат с последующей отдельной редукцией требует меньше
+умножений слов, но обращается к 2n-словному буферу.
+*******************************************************************************
+*/
+
+#define _CIOS(t, a, b, mod, n, mont_param)\
+	wwSetZero(t, n + 2);\
+	for (i = 0; i < n; ++i)\
+	{\
+		/* t <- t + a * b[i] */\
+		carry = 0;\
+		for (j = 0; j < n; ++j)\
+		{\
+			_MUL(prod, a[j], b[i]);\
+			prod += carry;\
+			prod += t[j];\
+			t[j] = (word)prod;\
+			carry = (word)(prod >> B_PER_W);\
+		}\
+		t[n] += carry;\
+		t[n + 1] = wordLess01(t[n], carry);\
+		/* t <- (t + w * mod) / B */\
+		_MUL_LO(w, t[0], mont_param);\
+		_MUL(prod, w, mod[0]);\
+		prod += t[0];\
+		carry = (word)(prod >> B_PER_W);\
+		for (j = 1; j < n; ++j)\
+		{\
+			_MUL(prod, w, mod[j]);\
+			prod += carry;\
+			prod += t[j];\
+			t[j - 1] = (word)prod;\
+			carry = (word)(prod >> B_PER_W);\
+		}\
+		t[n - 1] = t[n] + carry;\
+		t[n] = t[n + 1] + wordLess01(t[n - 1], carry);\
+	}
+
+void FAST(zzMulMont)(word c[], const word a[], const word b[],
+	const word mod[], size_t n, register word mont_param, void* stack)
+{
+	word* t = (word*)stack;
+	register word carry;
+	register word w;
+	register dword prod;
+	size_t i, j;
+	// pre
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n) && wwIsValid(c, n));
+	ASSERT(n > 0 && mod[n - 1] != 0 && mod[0] % 2);
+	ASSERT((word)(mod[0] * mont_param + 1) == 0);
+	// t <- a * b * B^{-n}
+	_CIOS(t, a, b, mod, n, mont_param);
+	// t >= mod?
+	if (wwCmp2(t, n + 1, mod, n) >= 0)
+		// t <- t - mod
+		zzSub2(t, mod, n);
+	wwCopy(c, t, n);
+	// очистка
+	prod = 0;
+	carry = w = 0;
+}
+
+void SAFE(zzMulMont)(word c[], const word a[], const word b[],
+	const word mod[], size_t n, register word mont_param, void* stack)
+{
+	word* t = (word*)stack;
+	register word carry;
+	register word w;
+	register dword prod;
+	size_t i, j;
+	// pre
+	ASSERT(wwIsValid(a, n) && wwIsValid(b, n) && wwIsValid(c, n));
+	ASSERT(n > 0 && mod[n - 1] != 0 && mod[0] % 2);
+	ASSERT((word)(mod[0] * mont_param + 1) == 0);
+	// t <- a * b * B^{-n}
+	_CIOS(t, a, b, mod, n, mont_param);
+	// t >= mod?
+	for (w = 1, i = 0; i < n; ++i)
+	{
+		w &= wordEq01(mod[i], t[i]);
+		w |= wordLess01(mod[i], t[i]);
+	}
+	w |= t[n], w = WORD_0 - w;
+	// t <- t - mod
+	zzSubAndW(t, mod, n, w);
+	wwCopy(c, t, n);
+	// очистка
+	prod = 0;
+	carry = w = 0;
+}
+
+size_t zzMulMont_deep(size_t n)
+{
+	return O_OF_W(n + 2);
+}
+
+void FAST(zzSqrMont)(word b[], const word a[], const word mod[], size_t n,
+	register word mont_param, void* stack)
+{
+	FAST(zzMulMont)(b, a, a, mod, n, mont_param, stack);
+}
+
+void SAFE(zzSqrMont)(word b[], const word a[], const word mod[], size_t n,
+	register word mont_param, void* stack)
+{
+	SAFE(zzMulMont)(b, a, a, mod, n, mont_param, stack);
+}
+
+size_t zzSqrMont_deep(size_t n)
+{
+	return zzMulMont_deep(n);
+}
+
 /*
 *******************************************************************************
 Редукция Крэндалла-Монтгомери
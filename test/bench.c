@@ -0,0 +1,496 @@
+/*
+*******************************************************************************
+\file bench.c
+\brief Benchmark harness
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <bee2/core/str.h>
+#include <bee2/core/tm.h>
+#include <bee2/core/util.h>
+#include "bench.h"
+
+#if defined(OS_WIN)
+	#include <windows.h>
+#elif defined(OS_LINUX)
+	#include <sched.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#include <intrin.h>
+	#define BENCH_TSC_MSC
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#include <cpuid.h>
+	#define BENCH_TSC_GCC
+#endif
+
+/*
+*******************************************************************************
+Таймер
+
+Поддержка rdtscp определяется по биту 27 регистра edx, который возвращает
+cpuid(0x80000001).
+*******************************************************************************
+*/
+
+#if defined(BENCH_TSC_GCC)
+
+static int _rdtscp = -1;
+
+static bool_t benchHasRdtscp()
+{
+	if (_rdtscp < 0)
+	{
+		unsigned a, b, c, d;
+		_rdtscp = __get_cpuid(0x80000001, &a, &b, &c, &d) &&
+			(d >> 27 & 1);
+	}
+	return _rdtscp;
+}
+
+tm_ticks_t benchTicksStart()
+{
+	register u32 hi;
+	register u32 lo;
+	__asm__ __volatile__("lfence\n\trdtsc" : "=a"(lo), "=d"(hi) :: "memory");
+	return (tm_ticks_t)lo | (tm_ticks_t)hi << 32;
+}
+
+tm_ticks_t benchTicksStop()
+{
+	register u32 hi;
+	register u32 lo;
+	if (benchHasRdtscp())
+		__asm__ __volatile__("rdtscp\n\tlfence"
+			: "=a"(lo), "=d"(hi) :: "ecx", "memory");
+	else
+		__asm__ __volatile__("lfence\n\trdtsc\n\tlfence"
+			: "=a"(lo), "=d"(hi) :: "memory");
+	return (tm_ticks_t)lo | (tm_ticks_t)hi << 32;
+}
+
+static const char* benchCounter()
+{
+	return benchHasRdtscp() ? "rdtscp" : "rdtsc";
+}
+
+#elif defined(BENCH_TSC_MSC)
+
+static int _rdtscp = -1;
+
+static bool_t benchHasRdtscp()
+{
+	if (_rdtscp < 0)
+	{
+		int regs[4];
+		__cpuid(regs, 0x80000000);
+		if ((unsigned)regs[0] >= 0x80000001)
+		{
+			__cpuid(regs, 0x80000001);
+			_rdtscp = regs[3] >> 27 & 1;
+		}
+		else
+			_rdtscp = 0;
+	}
+	return _rdtscp;
+}
+
+tm_ticks_t benchTicksStart()
+{
+	_mm_lfence();
+	return (tm_ticks_t)__rdtsc();
+}
+
+tm_ticks_t benchTicksStop()
+{
+	tm_ticks_t ticks;
+	unsigned aux;
+	if (benchHasRdtscp())
+		ticks = (tm_ticks_t)__rdtscp(&aux);
+	else
+		_mm_lfence(), ticks = (tm_ticks_t)__rdtsc();
+	_mm_lfence();
+	return ticks;
+}
+
+static const char* benchCounter()
+{
+	return benchHasRdtscp() ? "rdtscp" : "rdtsc";
+}
+
+#else
+
+tm_ticks_t benchTicksStart()
+{
+	return tmTicks();
+}
+
+tm_ticks_t benchTicksStop()
+{
+	return tmTicks();
+}
+
+static const char* benchCounter()
+{
+	return "tm";
+}
+
+#endif
+
+/*
+*******************************************************************************
+Настройки
+
+Настройки читаются из переменных окружения при первом обращении
+к benchRun() или benchPrint(). Тогда же загружаются базовые значения.
+*******************************************************************************
+*/
+
+#define BENCH_MAX_SAMPLES 1001
+
+enum { BENCH_TEXT, BENCH_CSV, BENCH_JSON, BENCH_BASELINE };
+
+typedef struct
+{
+	char name[128];			/*!< имя эксперимента */
+	size_t samples;			/*!< число замеров */
+	double median;			/*!< медиана */
+	double var;				/*!< выборочная дисперсия */
+} bench_base_t;
+
+static struct
+{
+	bool_t ready;			/*!< настройки прочитаны? */
+	int format;				/*!< формат печати */
+	FILE* out;				/*!< поток печати */
+	size_t samples;			/*!< число замеров */
+	tm_ticks_t target;		/*!< пороговое время замера (в тактах) */
+	tm_ticks_t freq;		/*!< частота таймера */
+	bool_t compare;			/*!< режим сравнения? */
+	double threshold;		/*!< порог регрессии (доля) */
+	bench_base_t* base;		/*!< базовые значения */
+	size_t base_count;		/*!< число базовых значений */
+} _cfg;
+
+static void benchPin(const char* cpu)
+{
+#if defined(OS_WIN)
+	SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << atoi(cpu));
+#elif defined(OS_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(atoi(cpu), &set);
+	if (sched_setaffinity(0, sizeof(set), &set) != 0)
+		fprintf(stderr, "bench: unable to pin to cpu %s\n", cpu);
+#else
+	fprintf(stderr, "bench: pinning is not supported\n");
+#endif
+}
+
+static void benchHeader(char* line)
+{
+	char counter[16];
+	double freq;
+	size_t len = strlen(line);
+	while (len && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+		line[--len] = 0;
+	if (strStartsWith(line, "# platform "))
+	{
+		if (!strEq(line + 11, utilPlatform()))
+			fprintf(stderr, "bench: baseline platform differs\n"
+				"  baseline: %s\n  current: %s\n", line + 11, utilPlatform());
+	}
+	else if (sscanf(line, "# counter %15s %lf", counter, &freq) == 2)
+	{
+		if (!strEq(counter, benchCounter()) ||
+			freq > 1.01 * _cfg.freq || freq < 0.99 * _cfg.freq)
+			fprintf(stderr, "bench: baseline counter differs "
+				"(%s %.0f vs %s %.0f)\n", counter, freq, benchCounter(),
+				(double)_cfg.freq);
+	}
+}
+
+static void benchLoad(const char* path)
+{
+	FILE* fp;
+	char line[1024];
+	bench_base_t b;
+	char unit[16];
+	unsigned samples;
+	size_t cap = 0;
+	if ((fp = fopen(path, "r")) == 0)
+	{
+		fprintf(stderr, "bench: unable to open %s\n", path);
+		return;
+	}
+	while (fgets(line, sizeof(line), fp))
+	{
+		if (line[0] == '#')
+		{
+			benchHeader(line);
+			continue;
+		}
+		if (sscanf(line, "%127s %15s %u %lf %lf", b.name, unit, &samples,
+				&b.median, &b.var) != 5 || samples == 0)
+			continue;
+		b.samples = samples;
+		if (_cfg.base_count == cap)
+		{
+			bench_base_t* base;
+			cap = cap ? 2 * cap : 64;
+			base = (bench_base_t*)realloc(_cfg.base, cap * sizeof(b));
+			if (!base)
+				break;
+			_cfg.base = base;
+		}
+		_cfg.base[_cfg.base_count++] = b;
+	}
+	fclose(fp);
+}
+
+static void benchSetup()
+{
+	const char* env;
+	if (_cfg.ready)
+		return;
+	_cfg.ready = TRUE;
+	// формат
+	_cfg.format = BENCH_TEXT;
+	if ((env = getenv("BEE2_BENCH_FORMAT")) != 0)
+	{
+		if (strEq(env, "csv"))
+			_cfg.format = BENCH_CSV;
+		else if (strEq(env, "json"))
+			_cfg.format = BENCH_JSON;
+		else if (strEq(env, "baseline"))
+			_cfg.format = BENCH_BASELINE;
+	}
+	// поток печати
+	_cfg.out = stdout;
+	if ((env = getenv("BEE2_BENCH_OUT")) != 0 &&
+		(_cfg.out = fopen(env, "a")) == 0)
+	{
+		fprintf(stderr, "bench: unable to open %s\n", env);
+		_cfg.out = stdout;
+	}
+	// число замеров
+	_cfg.samples = 15;
+	if ((env = getenv("BEE2_BENCH_SAMPLES")) != 0 && atoi(env) > 0)
+		_cfg.samples = MIN2((size_t)atoi(env), BENCH_MAX_SAMPLES);
+	// пороговое время
+	_cfg.freq = tmFreq();
+	_cfg.target = _cfg.freq / 1000;
+	if ((env = getenv("BEE2_BENCH_TIME")) != 0 && atoi(env) > 0)
+		_cfg.target *= (tm_ticks_t)atoi(env);
+	if (_cfg.target == 0)
+		_cfg.target = 1;
+	// привязка к ядру
+	if ((env = getenv("BEE2_BENCH_CPU")) != 0)
+		benchPin(env);
+	// порог регрессии
+	_cfg.threshold = 0.05;
+	if ((env = getenv("BEE2_BENCH_THRESHOLD")) != 0 && atof(env) >= 0)
+		_cfg.threshold = atof(env) / 100;
+	// базовые значения
+	if ((env = getenv("BEE2_BENCH_BASELINE")) != 0)
+		_cfg.compare = TRUE, benchLoad(env);
+	// заголовки
+	if (_cfg.format == BENCH_CSV)
+		fprintf(_cfg.out, "name,unit,units,reps,samples,"
+			"min,p10,median,p90,max,var,counter,freq\n");
+	else if (_cfg.format == BENCH_BASELINE)
+		fprintf(_cfg.out, "# bee2 benchmark baseline\n"
+			"# platform %s\n# counter %s %.0f\n",
+			utilPlatform(), benchCounter(), (double)_cfg.freq);
+}
+
+/*
+*******************************************************************************
+Эксперимент
+*******************************************************************************
+*/
+
+static int benchCmp(const void* a, const void* b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static tm_ticks_t benchSample(void (*fn)(void*, size_t), void* arg,
+	size_t reps)
+{
+	tm_ticks_t ticks = benchTicksStart();
+	fn(arg, reps);
+	return benchTicksStop() - ticks;
+}
+
+bool_t benchRun(bench_res_t* res, const char* name, const char* unit,
+	size_t units, void (*fn)(void* arg, size_t reps), void* arg)
+{
+	double t[BENCH_MAX_SAMPLES];
+	double mean, var;
+	size_t reps, i, s;
+	// pre
+	ASSERT(units > 0);
+	ASSERT(strIsValid(name) && !strchr(name, ' '));
+	benchSetup();
+	// калибровка
+	for (reps = 1; reps < SIZE_MAX / 2; reps *= 2)
+		if (benchSample(fn, arg, reps) >= _cfg.target)
+			break;
+	// разогрев
+	benchSample(fn, arg, reps);
+	// замеры
+	s = _cfg.samples;
+	for (i = 0; i < s; ++i)
+		t[i] = (double)benchSample(fn, arg, reps) / reps / units;
+	qsort(t, s, sizeof(double), benchCmp);
+	// результаты
+	res->name = name, res->unit = unit, res->units = units;
+	res->reps = reps, res->samples = s;
+	res->min = t[0], res->max = t[s - 1];
+	res->p10 = t[(s - 1) / 10], res->p90 = t[(s - 1) * 9 / 10];
+	res->median = s % 2 ? t[s / 2] : (t[s / 2 - 1] + t[s / 2]) / 2;
+	for (mean = 0, i = 0; i < s; ++i)
+		mean += t[i];
+	mean /= s;
+	for (var = 0, i = 0; i < s; ++i)
+		var += (t[i] - mean) * (t[i] - mean);
+	res->var = s > 1 ? var / (s - 1) : 0;
+	return TRUE;
+}
+
+void benchPrint(const bench_res_t* res)
+{
+	benchSetup();
+	if (_cfg.format == BENCH_CSV)
+		fprintf(_cfg.out, "%s,%s,%u,%u,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,"
+			"%s,%.0f\n",
+			res->name, res->unit, (unsigned)res->units,
+			(unsigned)res->reps, (unsigned)res->samples,
+			res->min, res->p10, res->median, res->p90, res->max, res->var,
+			benchCounter(), (double)_cfg.freq);
+	else if (_cfg.format == BENCH_JSON)
+		fprintf(_cfg.out, "{\"name\": \"%s\", \"unit\": \"%s\", "
+			"\"units\": %u, \"reps\": %u, \"samples\": %u, "
+			"\"min\": %.3f, \"p10\": %.3f, \"median\": %.3f, "
+			"\"p90\": %.3f, \"max\": %.3f, \"var\": %.3f, "
+			"\"counter\": \"%s\", \"freq\": %.0f}\n",
+			res->name, res->unit, (unsigned)res->units,
+			(unsigned)res->reps, (unsigned)res->samples,
+			res->min, res->p10, res->median, res->p90, res->max, res->var,
+			benchCounter(), (double)_cfg.freq);
+	else if (_cfg.format == BENCH_BASELINE)
+		fprintf(_cfg.out, "%s %s %u %.3f %.3f\n", res->name, res->unit,
+			(unsigned)res->samples, res->median, res->var);
+	else
+	{
+		double speed = res->median > 0 ? _cfg.freq / res->median : 0;
+		if (strEq(res->unit, "B"))
+			fprintf(_cfg.out, "%s: %.2f cpb (p10 %.2f, p90 %.2f) "
+				"[%.0f kBytes/sec]\n", res->name,
+				res->median, res->p10, res->p90, speed / 1024);
+		else
+			fprintf(_cfg.out, "%s: %.0f cycles/%s (p10 %.0f, p90 %.0f) "
+				"[%.0f %ss/sec]\n", res->name, res->median, res->unit,
+				res->p10, res->p90, speed, res->unit);
+	}
+	fflush(_cfg.out);
+}
+
+/*
+*******************************************************************************
+Сравнение с базовыми значениями
+
+Стандартные ошибки сравниваются в квадрате, чтобы не извлекать корни.
+*******************************************************************************
+*/
+
+static const bench_base_t* benchFind(const char* name)
+{
+	size_t i;
+	for (i = 0; i < _cfg.base_count; ++i)
+		if (strEq(_cfg.base[i].name, name))
+			return _cfg.base + i;
+	return 0;
+}
+
+static bool_t benchCompare(const bench_res_t* res)
+{
+	const bench_base_t* base;
+	const char* status = "ok";
+	double delta, noise;
+	if (!(base = benchFind(res->name)))
+	{
+		fprintf(stderr, "bench: %s: new\n", res->name);
+		return TRUE;
+	}
+	delta = res->median - base->median;
+	noise = 4 * (base->var / base->samples + res->var / res->samples);
+	if (delta > base->median * _cfg.threshold && delta * delta > noise)
+		status = "REGRESSION";
+	else if (-delta > base->median * _cfg.threshold && delta * delta > noise)
+		status = "improved";
+	fprintf(stderr, "bench: %s: %.3f -> %.3f (%+.1f%%) %s\n", res->name,
+		base->median, res->median,
+		base->median > 0 ? 100 * delta / base->median : 0.0, status);
+	return status[0] != 'R';
+}
+
+/*
+*******************************************************************************
+Фильтры
+*******************************************************************************
+*/
+
+static size_t _filter_count;
+static const char* const* _filters;
+static bool_t _list;
+
+void benchFilter(size_t count, const char* const filters[], bool_t list)
+{
+	_filter_count = count, _filters = filters, _list = list;
+}
+
+bool_t benchIsSelected(const char* name)
+{
+	size_t i;
+	if (_filter_count == 0)
+		return TRUE;
+	for (i = 0; i < _filter_count; ++i)
+		if (strstr(name, _filters[i]))
+			return TRUE;
+	return FALSE;
+}
+
+bool_t benchDo(const char* name, const char* unit, size_t units,
+	void (*fn)(void* arg, size_t reps), void* arg)
+{
+	bench_res_t res[1];
+	if (!benchIsSelected(name))
+		return TRUE;
+	if (_list)
+	{
+		printf("%s\n", name);
+		return TRUE;
+	}
+	if (!benchRun(res, name, unit, units, fn, arg))
+		return FALSE;
+	benchPrint(res);
+	if (_cfg.compare)
+		return benchCompare(res);
+	return TRUE;
+}
@@ -0,0 +1,212 @@
+/*
+*******************************************************************************
+\file bench.h
+\brief Benchmark harness
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#ifndef __BEE2_TEST_BENCH_H
+#define __BEE2_TEST_BENCH_H
+
+#include <bee2/defs.h>
+#include <bee2/core/tm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*******************************************************************************
+Замер производительности
+
+Эксперимент -- это функция fn(arg, reps), которая reps раз выполняет
+измеряемую операцию над объектами, размещенными по адресу arg. Каждое
+выполнение операции обрабатывает units единиц данных (октетов, строк,
+ключей, кратных точек и т.д.).
+
+Функция benchRun() проводит эксперимент по следующей схеме:
+1.	Калибровка: число повторов reps удваивается (начиная с 1), пока время
+	выполнения fn(arg, reps) не достигнет порогового значения. Калибровка
+	одновременно служит разогревом (кэши, предсказатель переходов,
+	частота процессора).
+2.	Разогрев: выполняется еще один вызов fn(arg, reps).
+3.	Замеры: выполняется samples вызовов fn(arg, reps). По результатам
+	определяется время обработки одной единицы данных: минимум, 10-й
+	процентиль, медиана, 90-й процентиль, максимум.
+
+Время измеряется в тактах таймера benchTicks(). На платформе x86
+используется счетчик тактов (TSC), чтение которого сериализуется:
+перед замером выполняются команды lfence и rdtsc, после замера --
+команды rdtscp и lfence (или lfence, rdtsc, lfence, если rdtscp
+не поддерживается). На других платформах используется tmTicks().
+Частота таймера определяется с помощью tmFreq().
+
+Функция benchPrint() печатает результаты. Формат печати и другие
+параметры задаются переменными окружения:
+-	BEE2_BENCH_FORMAT: text (по умолчанию), csv, json или baseline.
+	В формате csv сначала печатается строка заголовков. В формате json
+	каждый результат печатается отдельным объектом в отдельной строке
+	(JSON Lines). В формате baseline печатается файл базовых значений
+	(см. ниже);
+-	BEE2_BENCH_OUT: имя файла, в конец которого дописываются результаты
+	(по умолчанию результаты печатаются в stdout);
+-	BEE2_BENCH_SAMPLES: число замеров (по умолчанию 15);
+-	BEE2_BENCH_TIME: пороговое время одного замера в мс (по умолчанию 1);
+-	BEE2_BENCH_CPU: номер ядра, к которому привязывается поток,
+	выполняющий эксперименты (по умолчанию привязка не выполняется);
+-	BEE2_BENCH_BASELINE: имя файла базовых значений, с которыми
+	сравниваются результаты (по умолчанию сравнение не выполняется);
+-	BEE2_BENCH_THRESHOLD: порог регрессии в процентах (по умолчанию 5).
+
+Файл базовых значений -- текстовый файл, строки которого имеют вид
+\code
+	name unit samples median var
+\endcode
+Здесь median -- медиана, а var -- выборочная дисперсия числа тактов на
+единицу данных, samples -- число замеров. Строки, которые начинаются
+с символа '#', являются комментариями. Строка
+\code
+	# platform <описание>
+\endcode
+содержит описание платформы utilPlatform(), на которой получены базовые
+значения (в частности, возможности процессора), строка
+\code
+	# counter <счетчик> <частота>
+\endcode
+-- таймер и его частоту. Базовые значения получаются запуском
+экспериментов с BEE2_BENCH_FORMAT=baseline.
+
+В режиме сравнения (задана переменная BEE2_BENCH_BASELINE) результат
+каждого эксперимента сравнивается с базовым значением эксперимента
+с тем же именем. Регрессией считается рост медианы на величину, которая
+одновременно превышает порог BEE2_BENCH_THRESHOLD и две стандартные
+ошибки разности:
+\code
+	median - median0 > median0 * threshold / 100,
+	median - median0 > 2 sqrt(var0 / samples0 + var / samples).
+\endcode
+Аналогично (с обратным знаком) определяется ускорение. Результаты
+сравнения печатаются в stderr, чтобы не смешиваться с результатами
+в форматах csv и json. Если платформа или таймер базовых значений
+отличаются от текущих, то печатается предупреждение. Функция benchDo()
+возвращает FALSE при регрессии.
+
+Имена экспериментов имеют вид module::experiment[params] и служат
+ключами базовых значений. Поэтому имена уникальны, не содержат пробелов
+и не зависят от платформы: например, длины чисел указываются в битах,
+а не в машинных словах.
+
+Эксперименты можно отбирать с помощью фильтров benchFilter(): проводятся
+только те эксперименты, имена которых содержат хотя бы один из фильтров
+в качестве подстроки. В режиме перечисления (см. benchFilter())
+эксперименты не проводятся, печатаются только их имена.
+
+\remark Потоки, созданные после привязки, наследуют ее (Linux). Поэтому
+при привязке многопоточные реализации (например, пул mtPoolFor()) будут
+работать на одном ядре.
+*******************************************************************************
+*/
+
+/*!	\brief Результаты эксперимента */
+typedef struct
+{
+	const char* name;	/*!< имя эксперимента */
+	const char* unit;	/*!< единица данных */
+	size_t units;		/*!< число единиц данных в одной операции */
+	size_t reps;		/*!< число операций в одном замере */
+	size_t samples;		/*!< число замеров */
+	double min;			/*!< минимум тактов на единицу данных */
+	double p10;			/*!< 10-й процентиль */
+	double median;		/*!< медиана */
+	double p90;			/*!< 90-й процентиль */
+	double max;			/*!< максимум */
+	double var;			/*!< выборочная дисперсия */
+} bench_res_t;
+
+/*!	\brief Сериализованное чтение таймера: начало замера
+
+	Возвращаются показания таймера в начале замера.
+	\return Показания таймера.
+*/
+tm_ticks_t benchTicksStart();
+
+/*!	\brief Сериализованное чтение таймера: окончание замера
+
+	Возвращаются показания таймера в конце замера.
+	\return Показания таймера.
+*/
+tm_ticks_t benchTicksStop();
+
+/*!	\brief Проведение эксперимента
+
+	Проводится эксперимент с функцией fn и объектами arg. Результаты
+	эксперимента возвращаются в res.
+	\pre units > 0.
+	\return Признак успеха.
+*/
+bool_t benchRun(
+	bench_res_t* res,					/*!< [out] результаты */
+	const char* name,					/*!< [in] имя эксперимента */
+	const char* unit,					/*!< [in] единица данных */
+	size_t units,						/*!< [in] число единиц в операции */
+	void (*fn)(void* arg, size_t reps),	/*!< [in] эксперимент */
+	void* arg							/*!< [in,out] объекты эксперимента */
+);
+
+/*!	\brief Печать результатов эксперимента
+
+	Печатаются результаты res.
+*/
+void benchPrint(
+	const bench_res_t* res		/*!< [in] результаты */
+);
+
+/*!	\brief Фильтры экспериментов
+
+	Устанавливаются фильтры [count]filters. Если count == 0, то проводятся
+	все эксперименты. Если list == TRUE, то устанавливается режим
+	перечисления.
+	\remark Строки filters не копируются и должны оставаться доступными
+	до окончания экспериментов.
+*/
+void benchFilter(
+	size_t count,					/*!< [in] число фильтров */
+	const char* const filters[],	/*!< [in] фильтры */
+	bool_t list						/*!< [in] режим перечисления */
+);
+
+/*!	\brief Эксперимент отобран?
+
+	Проверяется, что эксперимент с именем name удовлетворяет фильтрам.
+	\return Признак успеха.
+*/
+bool_t benchIsSelected(
+	const char* name				/*!< [in] имя эксперимента */
+);
+
+/*!	\brief Проведение эксперимента с печатью результатов
+
+	Проводится эксперимент benchRun(). Результаты печатаются с помощью
+	benchPrint() и в режиме сравнения сравниваются с базовыми значениями.
+	Эксперимент, не удовлетворяющий фильтрам, пропускается. В режиме
+	перечисления печатается только имя эксперимента.
+	\return Признак успеха (FALSE при регрессии).
+*/
+bool_t benchDo(
+	const char* name,					/*!< [in] имя эксперимента */
+	const char* unit,					/*!< [in] единица данных */
+	size_t units,						/*!< [in] число единиц в операции */
+	void (*fn)(void* arg, size_t reps),	/*!< [in] эксперимент */
+	void* arg							/*!< [in,out] объекты эксперимента */
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __BEE2_TEST_BENCH_H */
@@ -0,0 +1,122 @@
+/*
+*******************************************************************************
+\file bench_main.c
+\brief Bee2 benchmarks
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <bee2/defs.h>
+#include "bench.h"
+
+/*
+*******************************************************************************
+Замеры модулей math
+*******************************************************************************
+*/
+
+extern bool_t wwBench();
+extern bool_t zzBench();
+extern bool_t ecpBench();
+extern bool_t ec2Bench();
+
+int benchMath()
+{
+	bool_t code;
+	int ret = 0;
+	code = wwBench(), ret |= !code;
+	code = zzBench(), ret |= !code;
+	code = ecpBench(), ret |= !code;
+	code = ec2Bench(), ret |= !code;
+	return ret;
+}
+
+/*
+*******************************************************************************
+Замеры модулей crypto
+*******************************************************************************
+*/
+
+extern bool_t beltBench();
+extern bool_t bashBench();
+extern bool_t bignBench();
+extern bool_t bakeBench();
+extern bool_t belsBench();
+extern bool_t botpBench();
+extern bool_t bpkiBench();
+extern bool_t brngBench();
+extern bool_t btokBench();
+extern bool_t dstuBench();
+extern bool_t engBench();
+extern bool_t g12sBench();
+extern bool_t mhtBench();
+extern bool_t pfokBench();
+
+int benchCrypto()
+{
+	bool_t code;
+	int ret = 0;
+	code = beltBench(), ret |= !code;
+	code = bashBench(), ret |= !code;
+	code = bignBench(), ret |= !code;
+	code = bakeBench(), ret |= !code;
+	code = belsBench(), ret |= !code;
+	code = botpBench(), ret |= !code;
+	code = bpkiBench(), ret |= !code;
+	code = brngBench(), ret |= !code;
+	code = btokBench(), ret |= !code;
+	code = dstuBench(), ret |= !code;
+	code = engBench(), ret |= !code;
+	code = g12sBench(), ret |= !code;
+	code = mhtBench(), ret |= !code;
+	code = pfokBench(), ret |= !code;
+	return ret;
+}
+
+/*
+*******************************************************************************
+main
+
+Использование: benchbee2 [-l] [filter ...]
+
+Проводятся эксперименты, имена которых содержат хотя бы один из фильтров
+filter (например, beltBench, belt-ctr, [256]). Если фильтры не заданы,
+то проводятся все эксперименты. При указании -l печатаются имена
+экспериментов без их проведения.
+
+Отслеживание регрессий (см. bench.h):
+\code
+	BEE2_BENCH_FORMAT=baseline BEE2_BENCH_OUT=base.txt benchbee2
+	BEE2_BENCH_BASELINE=base.txt [BEE2_BENCH_THRESHOLD=5] benchbee2
+\endcode
+Во втором запуске программа возвращает ненулевой код, если обнаружена
+регрессия хотя бы в одном эксперименте.
+*******************************************************************************
+*/
+
+int main(int argc, char* argv[])
+{
+	bool_t list = FALSE;
+	int ret = 0;
+	// разобрать параметры
+	if (argc > 1 && (strcmp(argv[1], "-h") == 0 ||
+		strcmp(argv[1], "--help") == 0))
+	{
+		printf("Usage: benchbee2 [-l] [filter ...]\n");
+		return 0;
+	}
+	if (argc > 1 && (strcmp(argv[1], "-l") == 0 ||
+		strcmp(argv[1], "--list") == 0))
+		list = TRUE, --argc, ++argv;
+	benchFilter((size_t)(argc - 1), (const char* const*)argv + 1, list);
+	// замеры
+	ret |= benchMath();
+	ret |= benchCrypto();
+	return ret;
+}
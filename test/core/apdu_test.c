@@ -4,7 +4,7 @@
 \brief Tests for APDU formats
 \project bee2/test
 \created 2022.10.31
-\version 2022.11.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -31,6 +31,8 @@ bool_t apduTest()
 	apdu_cmd_t* cmd1 = (apdu_cmd_t*)(stack + 1024);
 	apdu_resp_t* resp = (apdu_resp_t*)stack;
 	apdu_resp_t* resp1 = (apdu_resp_t*)(stack + 1024);
+	apdu_cmd_view_t cmd_view[1];
+	apdu_resp_view_t resp_view[1];
 	octet apdu[1024];
 	size_t count;
 	size_t count1;
@@ -64,6 +66,16 @@ bool_t apduTest()
 			if (apduCmdDec(cmd1, apdu, count) != count1 ||
 				!memEq(cmd, cmd1, count1))
 				return FALSE;
+			if (!apduCmdView(0, apdu, count) ||
+				!apduCmdView(cmd_view, apdu, count) ||
+				cmd_view->cla != cmd->cla || cmd_view->ins != cmd->ins ||
+				cmd_view->p1 != cmd->p1 || cmd_view->p2 != cmd->p2 ||
+				cmd_view->rdf_len != cmd->rdf_len ||
+				cmd_view->cdf_len != cmd->cdf_len ||
+				cmd_view->cdf < apdu + 4 ||
+				cmd_view->cdf + cmd_view->cdf_len > apdu + count ||
+				!memEq(cmd_view->cdf, cmd->cdf, cmd->cdf_len))
+				return FALSE;
 		}
 	// resp: точечный тест
 	memSetZero(resp, sizeof(apdu_resp_t));
@@ -81,6 +93,13 @@ bool_t apduTest()
 		apduRespDec(resp1, apdu, count) != count1 ||
 		!memEq(resp, resp1, count1))
 		return FALSE;
+	if (!apduRespView(0, apdu, count) ||
+		!apduRespView(resp_view, apdu, count) ||
+		resp_view->sw1 != 0x90 || resp_view->sw2 != 0x00 ||
+		resp_view->rdf != apdu || resp_view->rdf_len != 20 ||
+		apduRespView(resp_view, apdu, 1) ||
+		apduCmdView(cmd_view, apdu, 3))
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
@@ -4,7 +4,7 @@
 \brief Tests for base64 encoding
 \project bee2/test
 \created 2016.06.16
-\version 2016.06.16
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -12,6 +12,8 @@
 
 #include <bee2/core/b64.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/str.h>
+#include <bee2/core/util.h>
 #include <bee2/crypto/belt.h>
 
 /*
@@ -20,11 +22,29 @@
 *******************************************************************************
 */
 
+static bool_t b64TestDecode(const char* b64, size_t step)
+{
+	octet state[64];
+	octet buf[64];
+	size_t len, t;
+	ASSERT(b64To_keep() <= sizeof(state));
+	b64ToStart(state);
+	for (len = strLen(b64); len; len -= t, b64 += t)
+	{
+		t = MIN2(len, step);
+		if (b64ToStep(buf, b64, t, state) == SIZE_MAX)
+			return FALSE;
+	}
+	return b64ToStop(state);
+}
+
 bool_t b64Test()
 {
 	octet buf[256];
 	char b64[255 / 3 * 4 + 1];
-	size_t count;
+	char b64s[255 / 3 * 4 + 8];
+	octet state[64];
+	size_t count, step;
 	// валидация
 	if (!b64IsValid("1234") ||
 		b64IsValid("AbC=") ||
@@ -51,6 +71,65 @@ bool_t b64Test()
 		if (!memEq(buf, beltH(), count))
 			return FALSE;
 	}
+	// потоковое кодирование / декодирование
+	if (b64From_keep() > sizeof(state) || b64To_keep() > sizeof(state))
+		return FALSE;
+	for (count = 0; count < 256; count += 17)
+		for (step = 1; step <= 7; ++step)
+		{
+			size_t pos, len, t;
+			b64From(b64, beltH(), count);
+			// кодировать фрагментами по step октетов
+			b64FromStart(state);
+			for (pos = len = 0; pos < count; pos += t)
+			{
+				t = MIN2(count - pos, step);
+				len += b64FromStep(b64s + len, beltH() + pos, t, state);
+			}
+			len += b64FromStop(b64s + len, state);
+			if (len != strLen(b64) || !memEq(b64s, b64, len))
+				return FALSE;
+			// декодировать фрагментами по step символов
+			b64ToStart(state);
+			for (pos = len = 0; pos < strLen(b64); pos += step)
+			{
+				t = MIN2(strLen(b64) - pos, step);
+				t = b64ToStep(buf + len, b64 + pos, t, state);
+				if (t == SIZE_MAX)
+					return FALSE;
+				len += t;
+			}
+			if (!b64ToStop(state) || len != count ||
+				!memEq(buf, beltH(), count))
+				return FALSE;
+		}
+	// потоковое декодирование: ошибки формата
+	for (step = 1; step <= 5; ++step)
+		if (!b64TestDecode("AbE=", step) ||
+			!b64TestDecode("AbCBDg==", step) ||
+			b64TestDecode("AbC=", step) ||
+			b64TestDecode("AbCBD4==", step) ||
+			b64TestDecode("A=BC", step) ||
+			b64TestDecode("AbE=AbE=", step) ||
+			b64TestDecode("AbC7===", step) ||
+			b64TestDecode("AbC78a8", step) ||
+			b64TestDecode("AbC78a8@", step))
+			return FALSE;
+	// недопустимые символы в длинной строке
+	b64From(b64, beltH(), 255);
+	for (count = 0; count < 255 / 3 * 4; count += 7)
+	{
+		char ch = b64[count];
+		b64[count] = '.';
+		if (b64IsValid(b64))
+			return FALSE;
+		b64[count] = '\x80';
+		if (b64IsValid(b64))
+			return FALSE;
+		b64[count] = ch;
+	}
+	if (!b64IsValid(b64))
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
@@ -0,0 +1,135 @@
+/*
+*******************************************************************************
+\file blob_test.c
+\brief Tests for blobs
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/util.h>
+
+/*
+*******************************************************************************
+Тестирование
+*******************************************************************************
+*/
+
+static bool_t blobTestInternal()
+{
+	blob_t b1;
+	blob_t b2;
+	blob_t b3;
+	// создание / изменение размера
+	b1 = blobCreate(100);
+	b2 = blobCreate(5000);
+	if (!b1 || !b2 || blobSize(b1) != 100 || blobSize(b2) != 5000 ||
+		!memIsZero(b1, 100) || !memIsZero(b2, 5000))
+		return FALSE;
+	memSet(b1, 0x36, 100);
+	memSet(b2, 0x5C, 5000);
+	b1 = blobResize(b1, 3000);
+	if (!b1 || blobSize(b1) != 3000 || !memIsRep(b1, 100, 0x36) ||
+		!memIsZero((octet*)b1 + 100, 2900))
+		return FALSE;
+	b1 = blobResize(b1, 50);
+	if (!b1 || blobSize(b1) != 50 || !memIsRep(b1, 50, 0x36))
+		return FALSE;
+	b1 = blobResize(b1, 90);
+	if (!b1 || !memIsRep(b1, 50, 0x36) || !memIsZero((octet*)b1 + 50, 40))
+		return FALSE;
+	// копирование / сравнение
+	b3 = blobCopy(0, b2);
+	if (!b3 || !blobEq(b2, b3) || blobCmp(b1, b2) >= 0)
+		return FALSE;
+	// повторное использование памяти
+	blobClose(b2);
+	b2 = blobCreate(4990);
+	if (!b2 || !memIsZero(b2, 4990))
+		return FALSE;
+	// большой блоб
+	blobClose(b3);
+	b3 = blobCreate(100000);
+	if (!b3 || !memIsZero(b3, 100000))
+		return FALSE;
+	// освобождение
+	blobClose(b1), blobClose(b2), blobClose(b3);
+	return TRUE;
+}
+
+bool_t blobTest()
+{
+	// блобы в куче
+	if (!blobTestInternal())
+		return FALSE;
+	// блобы в арене (арена может быть недоступна)
+	if (blobArenaCreate(100000))
+	{
+		blob_t b;
+		if (!blobArenaIsValid() || blobArenaCreate(100000) ||
+			!blobTestInternal())
+			return FALSE;
+		// арена исчерпана: блобы в куче
+		{
+			blob_t bs[4];
+			size_t i;
+			for (i = 0; i < COUNT_OF(bs); ++i)
+				if (!(bs[i] = blobCreate(60000)))
+					return FALSE;
+			for (i = 0; i < COUNT_OF(bs); ++i)
+				blobClose(bs[i]);
+		}
+		b = blobCreate(1);
+		if (!b)
+			return FALSE;
+		blobClose(b);
+		blobArenaClose();
+		if (blobArenaIsValid())
+			return FALSE;
+	}
+	// блобы в кэше потока
+	if (blobCacheSetMax(1 << 16))
+	{
+		blob_t b;
+		void* p;
+		if (!blobTestInternal())
+			return FALSE;
+		// повторное использование и обнуление
+		b = blobCreate(5000);
+		if (!b)
+			return FALSE;
+		memSet(b, 0x36, 5000);
+		p = b, blobClose(b);
+		b = blobCreate(4000);
+		if (b != p || !memIsZero(b, 4000))
+			return FALSE;
+		blobClose(b);
+		// очистка загрязненной части
+		b = blobCreate(40000);
+		if (!b)
+			return FALSE;
+		memSet(b, 0x36, 100), ((octet*)b)[30000] = 0x5C;
+		p = b, blobClose(b);
+		b = blobCreate(40000);
+		if (b != p || !memIsZero(b, 40000))
+			return FALSE;
+		blobClose(b);
+		b = blobCreate(20000);
+		if (b != p)
+			return FALSE;
+		memSet(b, 0x36, 20000);
+		blobClose(b);
+		b = blobCreate(40000);
+		if (b != p || !memIsZero(b, 40000))
+			return FALSE;
+		blobClose(b);
+		blobCacheSetMax(0);
+	}
+	// все нормально
+	return TRUE;
+}
@@ -4,7 +4,7 @@
 \brief Tests for DER encoding rules
 \project bee2/test
 \created 2021.04.12
-\version 2022.11.01
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -42,6 +42,54 @@
 }\
 
 
+static bool_t derTestStream(const octet der[], size_t count, size_t step,
+	size_t depth, const der_node_t nodes[], size_t n)
+{
+	octet state[512];
+	der_node_t node[1];
+	const octet* frag;
+	size_t len;
+	size_t offset;
+	size_t pos = 0;
+	size_t i = 0;
+	size_t open = 0;
+	size_t event;
+	if (derStream_keep(depth) > sizeof(state))
+		return FALSE;
+	derStreamStart(state, depth);
+	for (offset = 0; offset < count; offset += step)
+	{
+		derStreamStepI(der + offset, MIN2(step, count - offset), state);
+		while ((event = derStreamStepG(node, &frag, &len, state)) !=
+			DER_STREAM_MORE)
+		{
+			if (event == DER_STREAM_ERR)
+				return FALSE;
+			// фрагменты составляют код
+			if (len > count - pos || !memEq(frag, der + pos, len))
+				return FALSE;
+			pos += len;
+			// узлы совпадают с узлами индекса
+			if (event == DER_STREAM_OPEN)
+			{
+				if (i == n || node->tag != nodes[i].tag ||
+					node->depth != nodes[i].depth ||
+					node->pos != nodes[i].pos || node->val != nodes[i].val ||
+					node->len != nodes[i].len || node->next != SIZE_MAX ||
+					pos != node->val)
+					return FALSE;
+				++i, ++open;
+			}
+			else if (event == DER_STREAM_CLOSE)
+			{
+				if (open-- == 0 || pos != node->val + node->len)
+					return FALSE;
+			}
+		}
+	}
+	return pos == count && i == n && open == 0 && derStreamIsOver(state);
+}
+
 bool_t derTest()
 {
 	octet buf[1024];
@@ -243,6 +291,102 @@ bool_t derTest()
 		if (count != 0)
 			return FALSE;
 	}
+	// Seq3 ::= SEQUENCE { SEQUENCE { NULL, OCTET STRING(3) },
+	//   INTEGER, SEQUENCE {} }
+	{
+		der_node_t nodes[16];
+		const octet* v;
+		// подготовить код
+		hexTo(buf, "300E"
+			"30070500" "0403010203"
+			"020105"
+			"3000");
+		count = 16;
+		// индексировать
+		if (derIndex(nodes, COUNT_OF(nodes), buf, count) != 6 ||
+			nodes[0].tag != 0x30 || nodes[0].depth != 0 ||
+			nodes[0].val + nodes[0].len != count || nodes[0].next != 6 ||
+			nodes[1].depth != 1 || nodes[1].next != 4 ||
+			nodes[2].tag != 0x05 || nodes[2].depth != 2 ||
+			nodes[3].pos != 6 || nodes[3].len != 3 ||
+			nodes[5].next != 6 || nodes[5].len != 0)
+			return FALSE;
+		// перемещаться
+		if (derIndexChild(nodes, 6, 0, 0) != 1 ||
+			derIndexChild(nodes, 6, 0, 1) != 4 ||
+			derIndexChild(nodes, 6, 0, 2) != 5 ||
+			derIndexChild(nodes, 6, 0, 3) != SIZE_MAX ||
+			derIndexChild(nodes, 6, 1, 1) != 3 ||
+			derIndexChild(nodes, 6, 1, 2) != SIZE_MAX ||
+			derIndexChild(nodes, 6, 3, 0) != SIZE_MAX ||
+			derIndexChild(nodes, 6, 5, 0) != SIZE_MAX)
+			return FALSE;
+		// читать значения
+		if ((v = derIndexVal(&len, nodes, 6, 3, buf, 0x04)) != buf + 8 ||
+			len != 3 || derIndexVal(0, nodes, 6, 3, buf, 0x02) != 0 ||
+			derSIZEDec(&val.size, buf + nodes[4].pos, count) != 3 ||
+			val.size != 5)
+			return FALSE;
+		// ошибки: мало узлов, вложенная структура выходит за пределы,
+		// вложенные структуры не заполняют значение
+		if (derIndex(nodes, 5, buf, count) != SIZE_MAX)
+			return FALSE;
+		buf[3] = 8;
+		if (derIndex(nodes, COUNT_OF(nodes), buf, count) != SIZE_MAX)
+			return FALSE;
+		buf[3] = 6;
+		if (derIndex(nodes, COUNT_OF(nodes), buf, count) != SIZE_MAX)
+			return FALSE;
+	}
+	// Seq3 и OCTET STRING(300): потоковое декодирование
+	{
+		der_node_t nodes[16];
+		octet state[512];
+		size_t n, step;
+		// подготовить код и индекс
+		hexTo(buf, "300E"
+			"30070500" "0403010203"
+			"020105"
+			"3000"
+			"0482012C");
+		memSet(buf + 20, 0x5A, 300);
+		count = 320;
+		if (derIndex(nodes, COUNT_OF(nodes), buf, 16) != 6 ||
+			derIndex(nodes + 6, 1, buf + 16, count - 16) != 1)
+			return FALSE;
+		nodes[6].pos += 16, nodes[6].val += 16, n = 7;
+		// декодировать фрагментами разной длины
+		for (step = 1; step <= 8; ++step)
+			if (!derTestStream(buf, count, step, 3, nodes, n))
+				return FALSE;
+		if (!derTestStream(buf, count, count, 3, nodes, n) ||
+			!derTestStream(buf, 16, 5, 3, nodes, 6))
+			return FALSE;
+		// ошибки: превышена глубина, код оборван, вложенная структура
+		// выходит за пределы, лишний октет
+		if (derTestStream(buf, count, 3, 2, nodes, n) ||
+			derTestStream(buf, count - 1, 3, 3, nodes, n) ||
+			derTestStream(buf, 10, 3, 3, nodes, 6) ||
+			derTestStream(buf, 17, 3, 3, nodes, 6))
+			return FALSE;
+		buf[3] = 8;
+		if (derTestStream(buf, count, 4, 3, nodes, n))
+			return FALSE;
+		// ошибка: неявная форма длины на стыке фрагментов
+		buf[3] = 7, buf[17] = 0x80;
+		if (derTestStream(buf, count, 1, 3, nodes, n))
+			return FALSE;
+		ASSERT(derStream_keep(3) <= sizeof(state));
+		derStreamStart(state, 3);
+		derStreamStepI(buf + 16, 1, state);
+		if (derStreamStepG(0, 0, 0, state) != DER_STREAM_MORE)
+			return FALSE;
+		derStreamStepI(buf + 17, 3, state);
+		if (derStreamStepG(0, 0, 0, state) != DER_STREAM_ERR ||
+			derStreamStepG(0, 0, 0, state) != DER_STREAM_ERR ||
+			derStreamIsOver(state))
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
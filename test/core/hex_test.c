@@ -4,7 +4,7 @@
 \brief Tests for hexadecimal strings
 \project bee2/test
 \created 2016.06.17
-\version 2016.06.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -13,6 +13,7 @@
 #include <bee2/core/hex.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/str.h>
+#include <bee2/core/util.h>
 #include <bee2/crypto/belt.h>
 
 /*
@@ -21,12 +22,29 @@
 *******************************************************************************
 */
 
+static bool_t hexTestDecode(const char* hex, size_t step)
+{
+	octet state[16];
+	octet buf[16];
+	size_t len, t;
+	ASSERT(hexTo_keep() <= sizeof(state));
+	hexToStart(state);
+	for (len = strLen(hex); len; len -= t, hex += t)
+	{
+		t = MIN2(len, step);
+		if (hexToStep(buf, hex, t, state) == SIZE_MAX)
+			return FALSE;
+	}
+	return hexToStop(state);
+}
+
 bool_t hexTest()
 {
 	octet buf[256];
 	char hex[512 + 1];
 	char hex1[512 + 1];
-	size_t count;
+	octet state[16];
+	size_t count, step;
 	// валидация
 	if (!hexIsValid("1234") ||
 		hexIsValid("12345") ||
@@ -54,6 +72,49 @@ bool_t hexTest()
 		if (!strEq(hex, hex1))
 			return FALSE;
 	}
+	// потоковое декодирование
+	if (hexTo_keep() > sizeof(state))
+		return FALSE;
+	for (count = 0; count <= 256; count += 17)
+		for (step = 1; step <= 7; ++step)
+		{
+			size_t pos, len, t;
+			hexFrom(hex, beltH(), count);
+			hexToStart(state);
+			for (pos = len = 0; pos < 2 * count; pos += step)
+			{
+				t = MIN2(2 * count - pos, step);
+				t = hexToStep(buf + len, hex + pos, t, state);
+				if (t == SIZE_MAX)
+					return FALSE;
+				len += t;
+			}
+			if (!hexToStop(state) || len != count ||
+				!memEq(buf, beltH(), count))
+				return FALSE;
+		}
+	for (step = 1; step <= 5; ++step)
+		if (!hexTestDecode("0123456789ABCDEFabcdef", step) ||
+			hexTestDecode("12345", step) ||
+			hexTestDecode("abcdefgh", step) ||
+			hexTestDecode("1G", step) ||
+			hexTestDecode("G1", step))
+			return FALSE;
+	// недопустимые символы в длинной строке
+	hexFrom(hex, beltH(), 256);
+	for (count = 0; count < 512; count += 5)
+	{
+		char ch = hex[count];
+		hex[count] = 'G';
+		if (hexIsValid(hex))
+			return FALSE;
+		hex[count] = '/';
+		if (hexIsValid(hex))
+			return FALSE;
+		hex[count] = ch;
+	}
+	if (!hexIsValid(hex))
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
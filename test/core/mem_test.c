@@ -4,7 +4,7 @@
 \brief Tests for memory functions
 \project bee2/test
 \created 2014.02.01
-\version 2022.07.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -160,6 +160,44 @@ bool_t memTest()
 	memXor2(buf2, buf, 8);
 	if (!memIsRep(buf2, 8, 0) || buf2[8] != 0x08)
 		return FALSE;
+	// векторные реализации: длины до 100, отличие в каждой позиции
+	{
+		octet v1[101];
+		octet v2[101];
+		octet v3[101];
+		size_t n, j;
+		for (n = 1; n <= 100; ++n)
+		{
+			for (i = 0; i < n; ++i)
+				v1[i + 1] = (octet)(i * 7 + 1), v2[i + 1] = (octet)(i * 13);
+			memXor(v3 + 1, v1 + 1, v2 + 1, n);
+			for (i = 0; i < n; ++i)
+				if (v3[i + 1] != (v1[i + 1] ^ v2[i + 1]))
+					return FALSE;
+			memXor2(v3 + 1, v2 + 1, n);
+			if (!SAFE(memEq)(v3 + 1, v1 + 1, n) ||
+				!FAST(memEq)(v3 + 1, v1 + 1, n))
+				return FALSE;
+			for (j = 0; j < n; ++j)
+			{
+				v3[j + 1] ^= 0x10;
+				if (SAFE(memEq)(v3 + 1, v1 + 1, n) ||
+					FAST(memEq)(v3 + 1, v1 + 1, n))
+					return FALSE;
+				v3[j + 1] ^= 0x10;
+			}
+			memWipe(v3 + 1, n);
+			if (!SAFE(memIsZero)(v3 + 1, n) || !FAST(memIsZero)(v3 + 1, n))
+				return FALSE;
+			for (j = 0; j < n; ++j)
+			{
+				v3[j + 1] = 0x80;
+				if (SAFE(memIsZero)(v3 + 1, n) || FAST(memIsZero)(v3 + 1, n))
+					return FALSE;
+				v3[j + 1] = 0;
+			}
+		}
+	}
 	// все нормально
 	return TRUE;
 }
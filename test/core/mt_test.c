@@ -4,7 +4,7 @@
 \brief Tests for multithreading
 \project bee2/test
 \created 2021.05.15
-\version 2021.05.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -25,27 +25,221 @@ void init()
 	_inited = TRUE;
 }
 
+static void incr(void* ctr)
+{
+	mtAtomicIncr((size_t*)ctr);
+}
+
+static mt_spin_t _spin[1];
+static mt_rwl_t _rwl[1];
+
+static void spinIncr(void* ctr)
+{
+	size_t i;
+	for (i = 0; i < 1000; ++i)
+	{
+		mtSpinLock(_spin);
+		++*(size_t*)ctr;
+		mtSpinUnlock(_spin);
+	}
+}
+
+static void rwlIncr(void* ctr)
+{
+	size_t i;
+	for (i = 0; i < 1000; ++i)
+	{
+		mtRwlRdLock(_rwl);
+		mtRwlRdUnlock(_rwl);
+		mtRwlWrLock(_rwl);
+		++*(size_t*)ctr;
+		mtRwlWrUnlock(_rwl);
+	}
+}
+
+static mt_pool_t _pool;
+
+static void sumRange(size_t from, size_t to, void* sum)
+{
+	size_t t = 0;
+	for (; from < to; ++from)
+		t += from;
+	while (t--)
+		mtAtomicIncr((size_t*)sum);
+}
+
+static void nestedRange(size_t from, size_t to, void* sum)
+{
+	for (; from < to; ++from)
+		mtPoolFor(_pool, 10, sumRange, sum);
+}
+
+static size_t _exec_runs;
+
+static void execRun(void* ctx, size_t count,
+	void (*fn)(size_t from, size_t to, void* arg), void* arg)
+{
+	++*(size_t*)ctx;
+	fn(0, count, arg);
+}
+
+static mt_tls_t _tls[1];
+
+static void MT_CALLBACK tlsDtor(void* ctr)
+{
+	mtAtomicIncr((size_t*)ctr);
+}
+
+static void tlsSet(void* ctr)
+{
+	if (mtTlsGet(_tls) == 0)
+		mtTlsSet(_tls, ctr);
+}
+
 bool_t mtTest()
 {
 	mt_mtx_t mtx[1];
+	mt_thrd_t thrd[4];
+	bool_t created[4];
 	size_t ctr[1] = { SIZE_0 };
+	size_t i;
 	// мьютексы
 	if (!mtMtxCreate(mtx))
 		return FALSE;
 	mtMtxLock(mtx);
 	mtMtxUnlock(mtx);
 	mtMtxClose(mtx);
+	// блокировки чтения-записи
+	if (!mtRwlCreate(_rwl))
+		return FALSE;
+	mtRwlRdLock(_rwl);
+	mtRwlRdUnlock(_rwl);
+	mtRwlWrLock(_rwl);
+	mtRwlWrUnlock(_rwl);
 	// атомарные операции
 	mtAtomicIncr(ctr);
 	mtAtomicIncr(ctr);
 	mtAtomicDecr(ctr);
 	if (mtAtomicCmpSwap(ctr, 1, 0) != 1 || *ctr != SIZE_0)
 		return FALSE;
+	mtAtomicStore(ctr, 2);
+	if (mtAtomicLoad(ctr) != 2)
+		return FALSE;
+	mtAtomicStore(ctr, 0);
+	// спин-блокировки
+	*_spin = 0;
+	if (!mtSpinTryLock(_spin) || mtSpinTryLock(_spin))
+		return FALSE;
+	mtSpinUnlock(_spin);
+	mtSpinLock(_spin);
+	mtSpinUnlock(_spin);
 	// однократный вызов
 	if (!mtCallOnce(&_once, init) || !_inited)
 		return FALSE;
 	if (!mtCallOnce(&_once, init) || !_inited)
 		return FALSE;
+	// потоки
+	if (mtProcCount() == 0)
+		return FALSE;
+	for (i = 0; i < 4; ++i)
+		if (!(created[i] = mtThrdCreate(thrd + i, incr, ctr)))
+			incr(ctr);
+	for (i = 0; i < 4; ++i)
+		if (created[i])
+			mtThrdJoin(thrd + i);
+	if (*ctr != 4)
+		return FALSE;
+	// конкурентный доступ
+	for (i = 0; i < 4; ++i)
+		if (!(created[i] = mtThrdCreate(thrd + i, spinIncr, ctr)))
+			spinIncr(ctr);
+	for (i = 0; i < 4; ++i)
+		if (created[i])
+			mtThrdJoin(thrd + i);
+	if (*ctr != 4004)
+		return FALSE;
+	for (i = 0; i < 4; ++i)
+		if (!(created[i] = mtThrdCreate(thrd + i, rwlIncr, ctr)))
+			rwlIncr(ctr);
+	for (i = 0; i < 4; ++i)
+		if (created[i])
+			mtThrdJoin(thrd + i);
+	mtRwlClose(_rwl);
+	if (*ctr != 8004)
+		return FALSE;
+	*ctr = 4;
+	// пул потоков
+	if (!(_pool = mtPoolCreate(3)))
+		return FALSE;
+	*ctr = 0;
+	for (i = 0; i < 1000; ++i)
+		mtPoolSubmit(_pool, incr, ctr);
+	mtPoolWait(_pool);
+	if (*ctr != 1000)
+	{
+		mtPoolClose(_pool);
+		return FALSE;
+	}
+	*ctr = 0;
+	mtPoolFor(_pool, 1000, sumRange, ctr);
+	if (*ctr != 1000 * 999 / 2)
+	{
+		mtPoolClose(_pool);
+		return FALSE;
+	}
+	*ctr = 0;
+	mtPoolFor(_pool, 20, nestedRange, ctr);
+	mtPoolClose(_pool);
+	if (*ctr != 20 * 45)
+		return FALSE;
+	// пул без рабочих потоков
+	if (!(_pool = mtPoolCreate(0)))
+		return FALSE;
+	*ctr = 0;
+	mtPoolSubmit(_pool, incr, ctr);
+	mtPoolFor(_pool, 10, sumRange, ctr);
+	mtPoolWait(_pool);
+	mtPoolClose(_pool);
+	if (*ctr != 46)
+		return FALSE;
+	// пул по умолчанию
+	*ctr = 0;
+	mtPoolFor(0, 100, sumRange, ctr);
+	mtPoolSubmit(0, incr, ctr);
+	mtPoolWait(0);
+	if (*ctr != 100 * 99 / 2 + 1 || mtPoolThreads(0) + 1 > mtProcCount())
+		return FALSE;
+	// внешний исполнитель
+	{
+		mt_exec_t exec[1];
+		exec->ctx = &_exec_runs, exec->run = execRun;
+		mtExecSet(exec);
+		*ctr = 0;
+		mtPoolFor(0, 10, sumRange, ctr);
+		mtExecSet(0);
+		if (_exec_runs != 1 || *ctr != 45)
+			return FALSE;
+	}
+	*ctr = 4;
+	// локальная память потоков
+	if (!mtTlsCreate(_tls, tlsDtor))
+		return FALSE;
+	if (mtTlsGet(_tls) != 0 || !mtTlsSet(_tls, ctr) || mtTlsGet(_tls) != ctr)
+	{
+		mtTlsClose(_tls);
+		return FALSE;
+	}
+	mtTlsSet(_tls, 0);
+	for (i = 0; i < 4; ++i)
+		created[i] = mtThrdCreate(thrd + i, tlsSet, ctr);
+	for (i = 0; i < 4; ++i)
+		if (created[i])
+			mtThrdJoin(thrd + i);
+		else
+			tlsDtor(ctr);
+	mtTlsClose(_tls);
+	if (*ctr != 8)
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
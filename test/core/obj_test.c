@@ -4,7 +4,7 @@
 \brief Tests for compound objects
 \project bee2/test
 \created 2013.04.16
-\version 2015.04.25
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -79,6 +79,25 @@ bool_t objTest()
 	// проверить
 	if (memCmp(objPtr(t, 1, void), obj2->a2, sizeof(obj2->a2)) != 0)
 		return FALSE;
+	// реплики buf
+	{
+		size_t reps[16];
+		const void* rep;
+		const void* t1;
+		bool_t ok;
+		ASSERT(sizeof(reps) >= objReps_keep());
+		objRepsStart(reps, buf, objKeep(buf), 0);
+		rep = objRepsGet(reps);
+		t1 = objCPtr(rep, 0, void);
+		ok = rep != buf && objRepsGet(reps) == rep &&
+			objIsOperable(rep) && objKeep(rep) == objKeep(buf) &&
+			(const octet*)rep < (const octet*)t1 &&
+			(const octet*)t1 < (const octet*)rep + objKeep(rep) &&
+			memEq(objCPtr(t1, 1, void), obj2->a2, sizeof(obj2->a2));
+		objRepsClose(reps);
+		if (!ok)
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
@@ -4,16 +4,18 @@
 \brief Tests for object identifiers
 \project bee2/test
 \created 2013.04.01
-\version 2021.07.07
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/der.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/oid.h>
 #include <bee2/core/str.h>
+#include <bee2/core/util.h>
 
 /*
 *******************************************************************************
@@ -105,6 +107,37 @@ bool_t oidTest()
 		oidFromDER(str, buf, count) != strLen(str1) ||
 		!strEq(str, str1))
 		return FALSE;
+	// реестр
+	{
+		const char* oids[] = {
+			"1.2.112.0.2.0.34.101.31.81",
+			"1.2.112.0.2.0.34.101.45.3.3",
+			"1.2.112.0.2.0.1176.2.3.10.2",
+			"1.2.804.2.1.1.1.1.3.1.1.1.2.9",
+			"1.2.840.113549.1.5.13",
+		};
+		const octet* der;
+		size_t i;
+		for (i = 0; i < COUNT_OF(oids); ++i)
+		{
+			der = oidLookup(&count, oids[i]);
+			if (der == 0 ||
+				derOIDEnc(buf, oids[i]) != count ||
+				!memEq(buf, der, count) ||
+				oidToDER(buf, oids[i]) != count ||
+				!memEq(buf, der, count) ||
+				oidFromDER(str, buf, count) != strLen(oids[i]) ||
+				!strEq(str, oids[i]) ||
+				derOIDDec2(buf, count, oids[i]) != count ||
+				derOIDDec2(buf, count - 1, oids[i]) != SIZE_MAX ||
+				derOIDDec2(buf, count, oids[(i + 1) % COUNT_OF(oids)]) != 
+					SIZE_MAX)
+				return FALSE;
+		}
+		if (oidLookup(&count, "1.2.112.0.2.0.34.101.31") != 0 ||
+			oidLookup(&count, "1.2.112.0.2.0.34.101.31.811") != 0)
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
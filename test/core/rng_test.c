@@ -4,25 +4,75 @@
 \brief Tests for random number generators
 \project bee2/test
 \created 2014.10.10
-\version 2022.10.21
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include <stdio.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
+#include <bee2/core/mt.h>
 #include <bee2/core/prng.h>
 #include <bee2/core/rng.h>
 #include <bee2/core/util.h>
 
+#ifdef OS_UNIX
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
 /*
 *******************************************************************************
 Тестирование
 *******************************************************************************
 */
 
+static void rngThrdTest(void* buf)
+{
+	rngStepR2(buf, 2500, 0);
+	rngStepR((octet*)buf + 2500, 32, 0);
+}
+
+#ifdef OS_UNIX
+
+static bool_t rngForkTest()
+{
+	octet out[2][32];
+	int fd[2];
+	pid_t pid;
+	int status;
+	rngStepR2(out[0], 32, 0);
+	memSetZero(out, sizeof(out));
+	if (pipe(fd) != 0)
+		return FALSE;
+	if ((pid = fork()) < 0)
+		return FALSE;
+	if (pid == 0)
+	{
+		rngStepR2(out[1], 32, 0);
+		_exit(write(fd[1], out[1], 32) == 32 ? 0 : 1);
+	}
+	rngStepR2(out[0], 32, 0);
+	close(fd[1]);
+	if (read(fd[0], out[1], 32) != 32 ||
+		waitpid(pid, &status, 0) != pid || status != 0)
+		return FALSE;
+	close(fd[0]);
+	return !memEq(out[0], out[1], 32);
+}
+
+#else
+
+static bool_t rngForkTest()
+{
+	return TRUE;
+}
+
+#endif
+
 bool_t rngTest()
 {
 	const char* sources[] = { "trng", "trng2", "sys", "timer" };
@@ -75,6 +125,49 @@ bool_t rngTest()
 		rngTestFIPS2(buf) ? '+' : '-',
 		rngTestFIPS3(buf) ? '+' : '-',
 		rngTestFIPS4(buf) ? '+' : '-');
+	// политика обновления энтропии
+	{
+		size_t count = rngReseedCount();
+		rngSetReseedPolicy(0, 0);
+		rngStepR(buf, 32, 0);
+		if (rngReseedCount() != count + 1)
+			return FALSE;
+		rngSetReseedPolicy(64, 0);
+		rngStepR(buf, 32, 0);
+		if (rngReseedCount() != count + 1)
+			return FALSE;
+		rngStepR(buf, 32, 0);
+		rngReseed();
+		if (rngReseedCount() != count + 3)
+			return FALSE;
+		rngSetReseedPolicy(65536, 1000);
+	}
+	// ветвление процесса
+	if (!rngForkTest())
+		return FALSE;
+	// экземпляры потоков
+	{
+		octet bufs[4][2532];
+		mt_thrd_t thrd[4];
+		bool_t created[4];
+		size_t i, j;
+		for (i = 0; i < 4; ++i)
+			if (!(created[i] = mtThrdCreate(thrd + i, rngThrdTest, bufs[i])))
+				rngThrdTest(bufs[i]);
+		for (i = 0; i < 4; ++i)
+			if (created[i])
+				mtThrdJoin(thrd + i);
+		for (i = 0; i < 4; ++i)
+		{
+			if (!rngTestFIPS1(bufs[i]) || !rngTestFIPS2(bufs[i]) ||
+				!rngTestFIPS3(bufs[i]) || !rngTestFIPS4(bufs[i]))
+				return FALSE;
+			for (j = 0; j < i; ++j)
+				if (memEq(bufs[i], bufs[j], 32) ||
+					memEq(bufs[i] + 2500, bufs[j] + 2500, 32))
+					return FALSE;
+		}
+	}
 	if (rngCreate(0, 0) != ERR_OK)
 		return FALSE;
 	rngClose();
@@ -83,6 +176,30 @@ bool_t rngTest()
 	rngClose();
 	if (rngIsValid())
 		return FALSE;
+	// быстрый запуск
+	rngSetStartPolicy(TRUE);
+	if (rngCreate(0, 0) != ERR_OK || !rngIsValid())
+		return FALSE;
+	rngStepR(buf, 2500, 0);
+	if (!rngTestFIPS1(buf) || !rngTestFIPS4(buf))
+		return FALSE;
+	rngClose();
+	rngSetStartPolicy(FALSE);
+	// фоновая проверка работоспособности
+	{
+		err_t code;
+		if (rngESHealthResult(FALSE) != ERR_NOT_READY ||
+			rngESHealthResult(TRUE) != ERR_NOT_READY)
+			return FALSE;
+		if (rngESHealthStart() != ERR_OK || rngESHealthStart() != ERR_OK)
+			return FALSE;
+		code = rngESHealthResult(TRUE);
+		if (code != ERR_OK && code != ERR_NOT_ENOUGH_ENTROPY &&
+			code != ERR_BAD_ENTROPY)
+			return FALSE;
+		if (rngESHealthResult(FALSE) != code)
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
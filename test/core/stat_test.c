@@ -0,0 +1,144 @@
+/*
+*******************************************************************************
+\file stat_test.c
+\brief Tests for instrumentation counters
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
+#include <bee2/core/rng.h>
+#include <bee2/core/stat.h>
+#include <bee2/crypto/bash.h>
+#include <bee2/crypto/belt.h>
+
+/*
+*******************************************************************************
+Тестирование
+*******************************************************************************
+*/
+
+static void statTestBelt(void* arg)
+{
+	octet block[16];
+	memSetZero(block, 16);
+	beltBlockEncr(block, (const u32*)arg);
+	beltBlockDecr(block, (const u32*)arg);
+}
+
+bool_t statTest()
+{
+	u32 key[8];
+	octet blocks[64];
+	octet state[192];
+	stat_ctr_t ctrs[STAT_MAX];
+	stat_ctr_t all[STAT_MAX];
+	stat_hist_t hist[1];
+	mt_thrd_t thrd[1];
+	tm_ticks_t t;
+	size_t i;
+	// имена
+	for (i = 0; i < STAT_MAX; ++i)
+		if (!statName(i))
+			return FALSE;
+	if (statName(STAT_MAX))
+		return FALSE;
+	for (i = 0; i < STAT_API_MAX; ++i)
+		if (!statApiName(i))
+			return FALSE;
+	if (statApiName(STAT_API_MAX))
+		return FALSE;
+	// корзины гистограмм
+	for (i = 0; i + 1 < STAT_HIST_MAX; ++i)
+		if (statHistBound(i) >= statHistBound(i + 1) &&
+			statHistBound(i + 1) != (tm_ticks_t)-1)
+			return FALSE;
+	for (t = 1, i = 0; i < 60; ++i, t = t * 3 / 2 + 1)
+	{
+		size_t bucket = statHistBucket(t);
+		if (bucket >= STAT_HIST_MAX || statHistBound(bucket) > t ||
+			(bucket + 1 < STAT_HIST_MAX && statHistBound(bucket + 1) <= t))
+			return FALSE;
+	}
+	if (statHistBucket(0) != 0 || statHistBucket(5) != 5 ||
+		statHistBucket(1000) != 4 * 8 + 3)
+		return FALSE;
+	// квантили
+	memSetZero(hist, sizeof(stat_hist_t));
+	if (statHistQuantile(hist, 500) != 0)
+		return FALSE;
+	hist->buckets[10] = 3, hist->buckets[20] = 1, hist->calls = 4;
+	if (statHistQuantile(hist, 0) != statHistBound(10) ||
+		statHistQuantile(hist, 750) != statHistBound(10) ||
+		statHistQuantile(hist, 751) != statHistBound(20) ||
+		statHistQuantile(hist, 1000) != statHistBound(20))
+		return FALSE;
+	// без инструментирования счетчики нулевые
+	memSetZero(key, sizeof(key));
+	memSetZero(blocks, sizeof(blocks));
+	memSetZero(state, sizeof(state));
+	if (!statIsEnabled())
+	{
+		beltBlockEncr(blocks, key);
+		statGet(all), statGetThread(ctrs);
+		for (i = 0; i < STAT_MAX; ++i)
+			if (all[i].calls || ctrs[i].calls)
+				return FALSE;
+		statHistGet(hist, STAT_API_RNG);
+		if (hist->calls || hist->errors)
+			return FALSE;
+		return TRUE;
+	}
+	// счетчики текущего потока
+	statReset();
+	statTestBelt(key);
+	beltBlockEncrN(blocks, 4, key);
+	bashF(state, state);
+	statGetThread(ctrs);
+	if (ctrs[STAT_BELT_BLOCK].calls != 3 ||
+		ctrs[STAT_BELT_BLOCK].bytes != 96 ||
+		ctrs[STAT_BASH_F].calls != 1 ||
+		ctrs[STAT_BASH_F].bytes != 192 ||
+		ctrs[STAT_ZZ_POWERMOD].calls != 0)
+		return FALSE;
+	// счетчики завершенного потока
+	if (mtThrdCreate(thrd, statTestBelt, key))
+	{
+		mtThrdJoin(thrd);
+		statGet(all);
+		if (all[STAT_BELT_BLOCK].calls < 5 || all[STAT_BASH_F].calls < 1)
+			return FALSE;
+	}
+	// гистограмма
+	if (rngCreate(0, 0) == ERR_OK)
+	{
+		statReset();
+		rngStepR(blocks, 16, 0);
+		rngStepR2(blocks, 16, 0);
+		rngClose();
+		statHistGet(hist, STAT_API_RNG);
+		if (hist->calls != 2 || hist->errors != 0)
+			return FALSE;
+		statHistGet(hist, STAT_API_BIGN_SIGN);
+		if (hist->calls != 0)
+			return FALSE;
+	}
+	// сброс
+	statReset();
+	statGetThread(ctrs);
+	statGet(all);
+	for (i = 0; i < STAT_MAX; ++i)
+		if (ctrs[i].calls || ctrs[i].bytes || ctrs[i].ticks || all[i].calls)
+			return FALSE;
+	statHistGet(hist, STAT_API_RNG);
+	if (hist->calls != 0)
+		return FALSE;
+	// все нормально
+	return TRUE;
+}
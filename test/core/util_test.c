@@ -4,13 +4,14 @@
 \brief Tests for utilities
 \project bee2/test
 \created 2017.01.17
-\version 2021.05.18
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include <stdio.h>
+#include <bee2/core/str.h>
 #include <bee2/core/util.h>
 
 /*
@@ -39,9 +40,23 @@ const char* utilInfo()
 Тестирование
 
 Тест для FNV32: http://isthe.com/chongo/tech/comp/fnv/##zero-hash##67. 
+
+Быстрые реализации CRC32 (slicing-by-8, свертка) сравниваются с побитовым
+расчетом по определению на сообщениях разной длины, в том числе
+невыровненных.
 *******************************************************************************
 */
 
+static u32 crc32Ref(const octet* buf, size_t count)
+{
+	u32 state = 0xFFFFFFFF;
+	size_t i;
+	while (count--)
+		for (state ^= *buf++, i = 0; i < 8; ++i)
+			state = state & 1 ? 0xEDB88320 ^ state >> 1 : state >> 1;
+	return state ^ 0xFFFFFFFF;
+}
+
 static size_t _ctr = 5;
 
 static void destroy1()
@@ -59,6 +74,10 @@ static void destroy2()
 bool_t utilTest()
 {
 	printf("utilVersion: %s [%s]\n", utilVersion(), utilInfo());
+	printf("utilPlatform: %s\n", utilPlatform());
+	if (!strStartsWith(utilPlatform(), "version=") ||
+		!strStartsWith(utilPlatform() + 8, utilVersion()))
+		return FALSE;
 	if (utilMin(5, SIZE_1, (size_t)2, (size_t)3, SIZE_1, SIZE_0) != 0 ||
 		utilMax(5, SIZE_1, (size_t)2, (size_t)3, SIZE_1, SIZE_0) != 3)
 		return FALSE;
@@ -69,6 +88,20 @@ bool_t utilTest()
 	// контрольные суммы
 	if (utilCRC32("123456789", 9, 0) != 0xCBF43926)
 		return FALSE;
+	{
+		octet buf[1 + 1024];
+		size_t count;
+		for (count = 0; count < sizeof(buf); ++count)
+			buf[count] = (octet)(count * 0x9E3779B1 >> 13);
+		for (count = 0; count <= 1024; count += count < 300 ? 1 : 97)
+		{
+			u32 crc = crc32Ref(buf + 1, count);
+			if (utilCRC32(buf + 1, count, 0) != crc ||
+				utilCRC32(buf + 1 + count / 3, count - count / 3,
+					utilCRC32(buf + 1, count / 3, 0)) != crc)
+				return FALSE;
+		}
+	}
 	if (utilFNV32("3pjNqM", 6, 0x811C9DC5) != 0)
 		return FALSE;
 	// все нормально
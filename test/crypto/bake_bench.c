@@ -0,0 +1,232 @@
+/*
+*******************************************************************************
+\file bake_bench.c
+\brief Benchmarks for STB 34.101.66 (bake)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bake.h>
+#include <bee2/crypto/bign.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется время выполнения протоколов BMQV, BSTS и BPACE обеими сторонами
+(с подтверждением ключа) на уровнях стойкости l = 128, 192, 256. Шаги
+сторон выполняются поочередно, сообщения передаются через буферы.
+
+Сертификат стороны -- это ее открытый ключ.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	bign_params params[1];		/*!< долговременные параметры */
+	bake_settings settingsa[1];	/*!< настройки стороны A */
+	bake_settings settingsb[1];	/*!< настройки стороны B */
+	octet combo_state[256];		/*!< состояние генератора */
+	octet da[64];				/*!< личный ключ стороны A */
+	octet db[64];				/*!< личный ключ стороны B */
+	octet qa[128];				/*!< открытый ключ (сертификат) стороны A */
+	octet qb[128];				/*!< открытый ключ (сертификат) стороны B */
+	bake_cert certa[1];			/*!< сертификат стороны A */
+	bake_cert certb[1];			/*!< сертификат стороны B */
+	octet msg1[512];			/*!< сообщение */
+	octet msg2[512];			/*!< сообщение */
+	octet keya[32];				/*!< общий ключ стороны A */
+	octet keyb[32];				/*!< общий ключ стороны B */
+	void* statea;				/*!< состояние стороны A */
+	void* stateb;				/*!< состояние стороны B */
+	err_t code;					/*!< код ошибки */
+} bake_bench_st;
+
+static err_t bakeBenchCertVal(octet* pubkey, const bign_params* params,
+	const octet* data, size_t len)
+{
+	if (len != params->l / 2)
+		return ERR_BAD_CERT;
+	if (pubkey)
+		memCopy(pubkey, data, len);
+	return ERR_OK;
+}
+
+static err_t bakeBenchBMQVRun(bake_bench_st* b)
+{
+	err_t code;
+	code = bakeBMQVStart(b->statea, b->params, b->settingsa, b->da,
+		b->certa);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStart(b->stateb, b->params, b->settingsb, b->db,
+		b->certb);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStep2(b->msg1, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStep3(b->msg2, b->msg1, b->certb, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStep4(b->msg1, b->msg2, b->certa, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStep5(b->msg1, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStepG(b->keya, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBMQVStepG(b->keyb, b->stateb);
+	return code;
+}
+
+static void bakeBenchBMQV(void* arg, size_t reps)
+{
+	bake_bench_st* b = (bake_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = bakeBenchBMQVRun(b);
+}
+
+static err_t bakeBenchBSTSRun(bake_bench_st* b)
+{
+	const size_t l = b->params->l;
+	err_t code;
+	code = bakeBSTSStart(b->statea, b->params, b->settingsa, b->da,
+		b->certa);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStart(b->stateb, b->params, b->settingsb, b->db,
+		b->certb);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStep2(b->msg1, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStep3(b->msg2, b->msg1, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStep4(b->msg1, b->msg2, 3 * l / 4 + b->certa->len + 8,
+		bakeBenchCertVal, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStep5(b->msg1, l / 4 + b->certb->len + 8,
+		bakeBenchCertVal, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStepG(b->keya, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBSTSStepG(b->keyb, b->stateb);
+	return code;
+}
+
+static void bakeBenchBSTS(void* arg, size_t reps)
+{
+	bake_bench_st* b = (bake_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = bakeBenchBSTSRun(b);
+}
+
+static err_t bakeBenchBPACERun(bake_bench_st* b)
+{
+	err_t code;
+	code = bakeBPACEStart(b->statea, b->params, b->settingsa,
+		(const octet*)"8086", 4);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStart(b->stateb, b->params, b->settingsb,
+		(const octet*)"8086", 4);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStep2(b->msg1, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStep3(b->msg2, b->msg1, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStep4(b->msg1, b->msg2, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStep5(b->msg2, b->msg1, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStep6(b->msg2, b->stateb);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStepG(b->keya, b->statea);
+	ERR_CALL_CHECK(code);
+	code = bakeBPACEStepG(b->keyb, b->stateb);
+	return code;
+}
+
+static void bakeBenchBPACE(void* arg, size_t reps)
+{
+	bake_bench_st* b = (bake_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = bakeBenchBPACERun(b);
+}
+
+bool_t bakeBench()
+{
+	static const struct
+	{
+		const char* params;
+		const char* bmqv;
+		const char* bsts;
+		const char* bpace;
+	} levels[] =
+	{
+		{
+			"1.2.112.0.2.0.34.101.45.3.1",
+			"bakeBench::bmqv[128]", "bakeBench::bsts[128]",
+			"bakeBench::bpace[128]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.2",
+			"bakeBench::bmqv[192]", "bakeBench::bsts[192]",
+			"bakeBench::bpace[192]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.3",
+			"bakeBench::bmqv[256]", "bakeBench::bsts[256]",
+			"bakeBench::bpace[256]",
+		},
+	};
+	bake_bench_st* b;
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить память
+	if (!(b = (bake_bench_st*)blobCreate(sizeof(bake_bench_st))))
+		return FALSE;
+	b->statea = blobCreate(utilMax(3, bakeBMQV_keep(256), bakeBSTS_keep(256),
+		bakeBPACE_keep(256)));
+	b->stateb = blobCreate(utilMax(3, bakeBMQV_keep(256), bakeBSTS_keep(256),
+		bakeBPACE_keep(256)));
+	if (!b->statea || !b->stateb)
+	{
+		blobClose(b->stateb), blobClose(b->statea), blobClose(b);
+		return FALSE;
+	}
+	// настройки
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	b->settingsa->kca = b->settingsa->kcb = TRUE;
+	b->settingsb->kca = b->settingsb->kcb = TRUE;
+	b->settingsa->rng = b->settingsb->rng = prngCOMBOStepR;
+	b->settingsa->rng_state = b->settingsb->rng_state = b->combo_state;
+	b->certa->data = b->qa, b->certb->data = b->qb;
+	b->certa->val = b->certb->val = bakeBenchCertVal;
+	// цикл по уровням стойкости
+	for (i = 0; ret && i < COUNT_OF(levels); ++i)
+	{
+		b->code = ERR_OK;
+		if (bignStdParams(b->params, levels[i].params) != ERR_OK ||
+			bignGenKeypair(b->da, b->qa, b->params, prngCOMBOStepR,
+				b->combo_state) != ERR_OK ||
+			bignGenKeypair(b->db, b->qb, b->params, prngCOMBOStepR,
+				b->combo_state) != ERR_OK)
+		{
+			ret = FALSE;
+			break;
+		}
+		b->certa->len = b->certb->len = b->params->l / 2;
+		ret &= benchDo(levels[i].bmqv, "run", 1, bakeBenchBMQV, b);
+		ret &= benchDo(levels[i].bsts, "run", 1, bakeBenchBSTS, b);
+		ret &= benchDo(levels[i].bpace, "run", 1, bakeBenchBPACE, b);
+		ret &= b->code == ERR_OK;
+	}
+	// завершить
+	blobClose(b->stateb), blobClose(b->statea), blobClose(b);
+	return ret;
+}
@@ -4,19 +4,22 @@
 \brief Tests for STB 34.101.66 (bake)
 \project bee2/test
 \created 2014.04.23
-\version 2017.01.17
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
 #include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/prng.h>
+#include <bee2/core/stat.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
 #include <bee2/crypto/bake.h>
+#include <bee2/crypto/bign.h>
 
 /*
 *******************************************************************************
@@ -184,6 +187,247 @@ static err_t bakeTestCertVal(octet* pubkey, const bign_params* params,
 	return ERR_OK;
 }
 
+/*
+*******************************************************************************
+Пакетный шаг 3 BSTS
+
+Сторона B выполняет шаги 1, 2. Затем три экземпляра стороны A
+с одинаковыми генераторами выполняют шаг 3: первый -- по отдельности,
+остальные -- пакетом. Проверяется, что все сообщения M2 совпадают
+и принимаются стороной B, а шаги 3 и 4 не выделяют память.
+*******************************************************************************
+*/
+
+static bool_t bakeTestBSTSBatch2(octet state[], size_t keep, void* stack,
+	const bign_params* params, const octet da[], const octet db[],
+	const bake_cert* certa, const bake_cert* certb)
+{
+	const size_t len = 3 * params->l / 4 + certa->len + 8;
+	octet randa[48];
+	octet randb[48];
+	octet echo[4][64];
+	bake_settings settings[4];
+	octet in[128];
+	octet out[3][512];
+	octet* outs[2];
+	const octet* ins[2];
+	void* states[2];
+	err_t codes[2];
+	stat_mem_t mem[1];
+	size_t i;
+	// подготовить буферы
+	if (len > sizeof(out[0]) || params->l / 2 > sizeof(in))
+		return FALSE;
+	// настройки
+	hexTo(randa, _bsts_randa);
+	hexTo(randb, _bsts_randb);
+	for (i = 0; i < 4; ++i)
+	{
+		memSetZero(settings + i, sizeof(bake_settings));
+		settings[i].kca = settings[i].kcb = TRUE;
+		settings[i].rng = prngEchoStepR;
+		settings[i].rng_state = echo[i];
+		if (i == 0)
+			prngEchoStart(echo[i], randb, strLen(_bsts_randb) / 2);
+		else
+			prngEchoStart(echo[i], randa, strLen(_bsts_randa) / 2);
+	}
+	// B: шаги 1, 2
+	if (bakeBSTSStart(state, params, settings, db, certb) != ERR_OK ||
+		bakeBSTSStep2(in, state) != ERR_OK)
+		return FALSE;
+	// A: шаг 3 по отдельности и пакетом
+	for (i = 1; i < 4; ++i)
+		if (bakeBSTSStart(state + i * keep, params, settings + i, da,
+				certa) != ERR_OK)
+			return FALSE;
+	statReset();
+	if (bakeBSTSStep3(out[0], in, state + keep) != ERR_OK)
+		return FALSE;
+	for (i = 0; i < 2; ++i)
+	{
+		outs[i] = out[i + 1];
+		ins[i] = in;
+		states[i] = state + (i + 2) * keep;
+	}
+	if (bakeBSTSStep3Batch(outs, ins, states, 2, codes, stack) != ERR_OK ||
+		codes[0] != ERR_OK || codes[1] != ERR_OK ||
+		!memEq(out[0], out[1], len) || !memEq(out[0], out[2], len))
+		return FALSE;
+	// B: шаг 4
+	if (bakeBSTSStep4(out[0], out[2], len, certa->val, state) != ERR_OK)
+		return FALSE;
+	// шаги выполнены без выделения памяти?
+	statGetMem(mem);
+	return mem->allocs == 0;
+}
+
+static bool_t bakeTestBSTSBatch(const bign_params* params, const octet da[],
+	const octet db[], const bake_cert* certa, const bake_cert* certb)
+{
+	const size_t keep = bakeBSTS_keep(params->l);
+	octet* state;
+	bool_t ret;
+	state = (octet*)blobCreate(4 * keep +
+		bakeBSTSStep3Batch_deep(params->l, 2));
+	if (!state)
+		return FALSE;
+	ret = bakeTestBSTSBatch2(state, keep, state + 4 * keep, params, da, db,
+		certa, certb);
+	blobClose(state);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Неблокирующее выполнение
+
+Стороны A и B выполняют протокол proto с помощью машин состояний,
+обмениваясь сообщениями через буфер. Генераторы сторон перезапускаются
+с данными [rand_len]randa и [rand_len]randb. Проверяется, что стороны
+получают общий ключ и что этот ключ совпадает с key.
+*******************************************************************************
+*/
+
+static bool_t bakeTestSM2(octet buf[], void* states[2], void* sms[2],
+	size_t proto, const bign_params* params, const bake_settings* settings[2],
+	const octet* privkeys[2], const bake_cert* certs[2], const char* pwd,
+	const octet key[32])
+{
+	octet keys[2][32];
+	size_t len;
+	size_t i, j;
+	err_t code;
+	// старт
+	for (i = 0; i < 2; ++i)
+	{
+		if (proto == BAKE_BMQV)
+			code = bakeBMQVStart(states[i], params, settings[i], privkeys[i],
+				certs[i]);
+		else if (proto == BAKE_BSTS)
+			code = bakeBSTSStart(states[i], params, settings[i], privkeys[i],
+				certs[i]);
+		else
+			code = bakeBPACEStart(states[i], params, settings[i],
+				(const octet*)pwd, strLen(pwd));
+		if (code != ERR_OK ||
+			bakeSMStart(sms[i], states[i], proto, i == 1, certs[1 - i],
+				certs[1 - i]->val) != ERR_OK)
+			return FALSE;
+	}
+	// обмен сообщениями
+	for (j = 0; j < 8; ++j)
+		for (i = 2; i--;)
+		{
+			if (bakeSMWant(&len, sms[i]) != BAKE_SM_WRITE)
+				continue;
+			if (len > 512 ||
+				bakeSMStepW(buf, sms[i]) != ERR_OK ||
+				bakeSMWant(0, sms[1 - i]) != BAKE_SM_READ ||
+				bakeSMStepR(sms[1 - i], buf, len) != ERR_OK)
+				return FALSE;
+		}
+	// ключи
+	return bakeSMWant(0, sms[0]) == BAKE_SM_DONE &&
+		bakeSMWant(0, sms[1]) == BAKE_SM_DONE &&
+		bakeSMStepW(buf, sms[0]) == ERR_BAD_LOGIC &&
+		bakeSMStepG(keys[0], sms[0]) == ERR_OK &&
+		bakeSMStepG(keys[1], sms[1]) == ERR_OK &&
+		memEq(keys[0], key, 32) && memEq(keys[1], key, 32);
+}
+
+static bool_t bakeTestSM(size_t proto, const bign_params* params,
+	const bake_settings* settingsa, const bake_settings* settingsb,
+	const octet randa[], const octet randb[], size_t rand_len,
+	const octet da[], const octet db[], const bake_cert* certa,
+	const bake_cert* certb, const char* pwd, const octet key[32])
+{
+	const size_t keep = utilMax(3, bakeBMQV_keep(params->l),
+		bakeBSTS_keep(params->l), bakeBPACE_keep(params->l));
+	const size_t sm_keep = bakeSM_keep(params->l,
+		MAX2(certa->len, certb->len));
+	const bake_settings* settings[2];
+	const octet* privkeys[2];
+	const bake_cert* certs[2];
+	void* states[2];
+	void* sms[2];
+	octet* buf;
+	bool_t ret;
+	// подготовить память
+	buf = (octet*)blobCreate(512 + 2 * keep + 2 * sm_keep);
+	if (!buf)
+		return FALSE;
+	states[0] = buf + 512, states[1] = (octet*)states[0] + keep;
+	sms[0] = (octet*)states[1] + keep, sms[1] = (octet*)sms[0] + sm_keep;
+	// стороны
+	settings[0] = settingsa, settings[1] = settingsb;
+	privkeys[0] = da, privkeys[1] = db;
+	certs[0] = certa, certs[1] = certb;
+	prngEchoStart(settingsa->rng_state, randa, rand_len);
+	prngEchoStart(settingsb->rng_state, randb, rand_len);
+	// выполнить протокол
+	ret = bakeTestSM2(buf, states, sms, proto, params, settings, privkeys,
+		certs, pwd, key);
+	blobClose(buf);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Поставщик одноразовых ключей
+
+Протокол proto выполняется с помощью bakeTestSM(), причем одноразовые
+ключи сторон извлекаются из пулов bign (см. bignCtxPoolTake()). Пулы
+без рабочих потоков заполняются заранее генераторами, которые запущены
+с данными randa и randb. Поэтому общий ключ должен совпасть с key.
+*******************************************************************************
+*/
+
+static bool_t bakeTestEph(size_t proto, const bign_params* params,
+	bake_settings* settingsa, bake_settings* settingsb,
+	const octet randa[], const octet randb[], size_t rand_len,
+	const octet da[], const octet db[], const bake_cert* certa,
+	const bake_cert* certb, const octet key[32])
+{
+	const size_t keep = bignPool_keep(params->l, 1);
+	octet echo[2][64];
+	void* ctx;
+	octet* pools;
+	bool_t ret;
+	// подготовить контекст и пулы
+	ctx = blobCreate(bignCtx_keep(params->l));
+	pools = (octet*)blobCreate(2 * keep);
+	prngEchoStart(echo[0], randa, rand_len);
+	prngEchoStart(echo[1], randb, rand_len);
+	ret = ctx && pools &&
+		bignCtxStart(ctx, params) == ERR_OK &&
+		bignCtxPoolStart(pools, ctx, 1, 0, prngEchoStepR, echo[0]) ==
+			ERR_OK &&
+		bignCtxPoolFill(pools, ctx) == ERR_OK &&
+		bignCtxPoolStart(pools + keep, ctx, 1, 0, prngEchoStepR, echo[1]) ==
+			ERR_OK &&
+		bignCtxPoolFill(pools + keep, ctx) == ERR_OK;
+	// выполнить протокол
+	if (ret)
+	{
+		settingsa->eph = settingsb->eph = bignCtxPoolTake;
+		settingsa->eph_state = pools;
+		settingsb->eph_state = pools + keep;
+		ret = bakeTestSM(proto, params, settingsa, settingsb, randa, randb,
+			rand_len, da, db, certa, certb, 0, key) &&
+			bignCtxPoolCount(pools) == 0 &&
+			bignCtxPoolCount(pools + keep) == 0;
+		settingsa->eph = settingsb->eph = 0;
+		settingsa->eph_state = settingsb->eph_state = 0;
+		bignCtxPoolStop(pools);
+		bignCtxPoolStop(pools + keep);
+	}
+	// завершение
+	blobClose(pools);
+	blobClose(ctx);
+	return ret;
+}
+
 /*
 *******************************************************************************
 Самотестирование
@@ -217,6 +461,7 @@ bool_t bakeTest()
 	octet keyb[32];
 	octet secret[32];
 	octet iv[64];
+	size_t pass;
 	// загрузить долговременные параметры
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK)
 		return FALSE;
@@ -241,30 +486,44 @@ bool_t bakeTest()
 	certb->data = certdatab;
 	certb->len = strLen(_certb) / 2;
 	certa->val = certb->val = bakeTestCertVal;
-	// тест Б.2
-	hexTo(randa, _bmqv_randa);
-	hexTo(randb, _bmqv_randb);
-	fileMsgFlash();
-	do
+	// тест Б.2 (повторно с кэшем предвычислений: ключ запоминается,
+	// строится таблица, используется таблица)
+	for (pass = 0; pass < 4; ++pass)
 	{
-		filea->i = filea->offset = 0;
-		fileb->i = fileb->offset = 0;
-		prngEchoStart(echoa, randa, strLen(_bmqv_randb) / 2);
-		prngEchoStart(echob, randb, strLen(_bmqv_randb) / 2);
-		codeb = bakeBMQVRunB(keyb, params, settingsb, db, certb, certa,
-			fileMsgRead, fileMsgWrite, fileb);
-		if (codeb != ERR_OK && codeb != ERR_FILE_NOT_FOUND)
+		if (pass == 1 && !bakeBMQVCacheSetMax(4))
 			return FALSE;
-		codea = bakeBMQVRunA(keya, params, settingsa, da, certa, certb,
-			fileMsgRead, fileMsgWrite, filea);
-		if (codea != ERR_OK && codea != ERR_FILE_NOT_FOUND)
+		hexTo(randa, _bmqv_randa);
+		hexTo(randb, _bmqv_randb);
+		fileMsgFlash();
+		do
+		{
+			filea->i = filea->offset = 0;
+			fileb->i = fileb->offset = 0;
+			prngEchoStart(echoa, randa, strLen(_bmqv_randb) / 2);
+			prngEchoStart(echob, randb, strLen(_bmqv_randb) / 2);
+			codeb = bakeBMQVRunB(keyb, params, settingsb, db, certb, certa,
+				fileMsgRead, fileMsgWrite, fileb);
+			if (codeb != ERR_OK && codeb != ERR_FILE_NOT_FOUND)
+				return FALSE;
+			codea = bakeBMQVRunA(keya, params, settingsa, da, certa, certb,
+				fileMsgRead, fileMsgWrite, filea);
+			if (codea != ERR_OK && codea != ERR_FILE_NOT_FOUND)
+				return FALSE;
+		}
+		while (codea == ERR_FILE_NOT_FOUND || codeb == ERR_FILE_NOT_FOUND);
+		if (!memEq(keya, keyb, 32) ||
+			!hexEq(keya,
+				"C6F86D0E468D5EF1A9955B2EE0CF0581"
+				"050C81D1B47727092408E863C7EEB48C"))
 			return FALSE;
 	}
-	while (codea == ERR_FILE_NOT_FOUND || codeb == ERR_FILE_NOT_FOUND);
-	if (!memEq(keya, keyb, 32) ||
-		!hexEq(keya,
-			"C6F86D0E468D5EF1A9955B2EE0CF0581"
-			"050C81D1B47727092408E863C7EEB48C"))
+	if (!bakeBMQVCacheSetMax(0))
+		return FALSE;
+	if (!bakeTestSM(BAKE_BMQV, params, settingsa, settingsb, randa, randb,
+		strLen(_bmqv_randb) / 2, da, db, certa, certb, 0, keya))
+		return FALSE;
+	if (!bakeTestEph(BAKE_BMQV, params, settingsa, settingsb, randa, randb,
+		strLen(_bmqv_randb) / 2, da, db, certa, certb, keya))
 		return FALSE;
 	// тест Б.3
 	hexTo(randa, _bsts_randa);
@@ -291,6 +550,15 @@ bool_t bakeTest()
 			"78EF2C56BD6DA2116BB5BEE80CEE5C05"
 			"394E7609183CF7F76DF0C2DCFB25C4AD"))
 		return FALSE;
+	if (!bakeTestSM(BAKE_BSTS, params, settingsa, settingsb, randa, randb,
+		strLen(_bsts_randb) / 2, da, db, certa, certb, 0, keya))
+		return FALSE;
+	if (!bakeTestEph(BAKE_BSTS, params, settingsa, settingsb, randa, randb,
+		strLen(_bsts_randb) / 2, da, db, certa, certb, keya))
+		return FALSE;
+	// пакетный шаг 3 BSTS
+	if (!bakeTestBSTSBatch(params, da, db, certa, certb))
+		return FALSE;
 	// тест Б.4
 	hexTo(randa, _bpace_randa);
 	hexTo(randb, _bpace_randb);
@@ -316,6 +584,9 @@ bool_t bakeTest()
 			"DAC4D8F411F9C523D28BBAAB32A5270E"
 			"4DFA1F0F757EF8E0F30AF08FBDE1E7F4"))
 		return FALSE;
+	if (!bakeTestSM(BAKE_BPACE, params, settingsa, settingsb, randa, randb,
+		strLen(_bpace_randb) / 2, da, db, certa, certb, pwd, keya))
+		return FALSE;
 	// тест bakeKDF (по данным из теста Б.4)
 	hexTo(secret, 
 		"723356E335ED70620FFB1842752092C3"
@@ -334,6 +605,19 @@ bool_t bakeTest()
 			"54AC058284D679CF4C47D3D72651F3E4"
 			"EF0D61D1D0ED5BAF8FF30B8924E599D8"))
 		return FALSE;
+	// тест bakeKDFMulti
+	{
+		octet keys[32 * 70];
+		size_t i;
+		if (bakeKDFMulti(keys, secret, 32, iv, 64, 0, 70) != ERR_OK ||
+			!memEq(keys, keya, 32) ||
+			!memEq(keys + 32, keyb, 32))
+			return FALSE;
+		for (i = 2; i < 70; i += 67)
+			if (bakeKDF(keya, secret, 32, iv, 64, i) != ERR_OK ||
+				!memEq(keys + 32 * i, keya, 32))
+				return FALSE;
+	}
 	// тест bakeSWU (по данным из теста Б.4)
 	hexTo(secret, 
 		"AD1362A8F9A3D42FBE1B8E6F1C88AAD5"
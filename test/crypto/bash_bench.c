@@ -4,13 +4,15 @@
 \brief Benchmarks for STB 34.101.77 (bash)
 \project bee2/test
 \created 2014.07.15
-\version 2020.06.23
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include <stdio.h>
+#include <bee2/core/blob.h>
+#include <bee2/core/mem.h>
 #include <bee2/core/prng.h>
 #include <bee2/core/tm.h>
 #include <bee2/core/util.h>
@@ -18,6 +20,7 @@
 #include <bee2/crypto/belt.h>
 #include <bee2/math/pp.h>
 #include <bee2/math/ww.h>
+#include "../bench.h"
 
 /*
 *******************************************************************************
@@ -25,86 +28,187 @@
 *******************************************************************************
 */
 
-extern const char bash_platform[];
+#define BASH_BENCH_BIG (1 << 22)
+#define BASH_BENCH_CHUNK (1 << 16)
+
+typedef struct
+{
+	MEM_ALIGNED(MEM_ALIGN) octet state[1024];	/*!< состояние алгоритма */
+	octet buf[1024];		/*!< данные */
+	octet hash[64];			/*!< хэш-значение */
+	octet hashes[16 * 32];	/*!< хэш-значения */
+	const void* src[16];	/*!< сообщения */
+	size_t count[16];		/*!< длины сообщений */
+	size_t l;				/*!< уровень стойкости */
+	octet* big;				/*!< большой объект */
+	octet tags[BASH_BENCH_BIG / BASH_BENCH_CHUNK * 16];	/*!< имитовставки */
+} bash_bench_st;
+
+static void bashBenchBelt(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		beltHashStepH(b->buf, sizeof(b->buf), b->state);
+	beltHashStepG(b->hash, b->state);
+}
+
+static void bashBenchHash(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashHashStepH(b->buf, sizeof(b->buf), b->state);
+	bashHashStepG(b->hash, b->l / 4, b->state);
+}
+
+static void bashBenchHashU(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashHashStepH(b->buf, sizeof(b->buf), b->state + 8);
+	bashHashStepG(b->hash, b->l / 4, b->state + 8);
+}
+
+static void bashBenchHash16(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	size_t d;
+	while (reps--)
+		for (d = 0; d < 16; ++d)
+			bashHash(b->hashes + 32 * d, 128, b->src[d], b->count[d]);
+}
+
+static void bashBenchHashMulti(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashHashMulti(b->hashes, 128, 16, b->src, b->count);
+}
+
+static void bashBenchPrgHash(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashPrgAbsorbStep(b->buf, sizeof(b->buf), b->state);
+	bashPrgSqueeze(b->hash, b->l / 4, b->state);
+}
+
+static void bashBenchPrgAE(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	size_t i;
+	bashPrgEncrStart(b->state);
+	for (i = 0; i < reps; ++i)
+		bashPrgEncrStep(b->buf, sizeof(b->buf), b->state);
+	bashPrgDecrStart(b->state);
+	for (i = 0; i < reps; ++i)
+		bashPrgDecrStep(b->buf, sizeof(b->buf), b->state);
+}
+
+static void bashBenchPrgAEAD(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashPrgAEADWrap(b->big, b->hash, 128, 1, b->big, BASH_BENCH_BIG,
+			0, 0, 0, 0, b->buf, 16);
+}
+
+static void bashBenchPrgChunk(void* arg, size_t reps)
+{
+	bash_bench_st* b = (bash_bench_st*)arg;
+	while (reps--)
+		bashPrgChunkWrap(b->big, b->tags, b->hash, 128, 1, BASH_BENCH_CHUNK,
+			b->big, BASH_BENCH_BIG, 0, 0, 0, 0, b->buf, 16);
+}
 
 bool_t bashBench()
 {
-	octet belt_state[256];
-	octet bash_state[1024];
+	static const char* hash_names[] =
+	{
+		"bashBench::bash256",
+		"bashBench::bash384",
+		"bashBench::bash512",
+	};
+	static const char* prg_hash_names[] =
+	{
+		"bashBench::bash-prg-hash2561",
+		"bashBench::bash-prg-hash2562",
+		"bashBench::bash-prg-hash3841",
+		"bashBench::bash-prg-hash3842",
+		"bashBench::bash-prg-hash5121",
+		"bashBench::bash-prg-hash5122",
+	};
+	static const char* prg_ae_names[] =
+	{
+		"bashBench::bash-prg-ae1281",
+		"bashBench::bash-prg-ae1282",
+		"bashBench::bash-prg-ae1921",
+		"bashBench::bash-prg-ae1922",
+		"bashBench::bash-prg-ae2561",
+		"bashBench::bash-prg-ae2562",
+	};
 	octet combo_state[256];
-	octet buf[1024];
-	octet hash[64];
-	size_t l, d;
+	bash_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i, d;
 	// заполнить buf псевдослучайными числами
 	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
 	prngCOMBOStart(combo_state, utilNonce32());
-	prngCOMBOStepR(buf, sizeof(buf), combo_state);
-	// платформа
-	printf("bashBench::platform = %s\n", bash_platform);
-	// оценить скорость хэширования
+	prngCOMBOStepR(b->buf, sizeof(b->buf), combo_state);
+	// платформа (в stderr, чтобы не нарушать формат результатов)
+	if (benchIsSelected("bashBench::"))
+		fprintf(stderr, "bashBench::platform = %s\n", bashPlatform());
+	// эксперимент c belt
+	ASSERT(beltHash_keep() <= sizeof(b->state));
+	beltHashStart(b->state);
+	ret &= benchDo("bashBench::belt-hash", "B", sizeof(b->buf),
+		bashBenchBelt, b);
+	// эксперимент c bashHashLLL
+	ASSERT(bashHash_keep() <= sizeof(b->state));
+	for (i = 0, b->l = 128; b->l <= 256; ++i, b->l += 64)
+	{
+		bashHashStart(b->state, b->l);
+		ret &= benchDo(hash_names[i], "B", sizeof(b->buf),
+			bashBenchHash, b);
+	}
+	// эксперимент c bash256 на невыровненном состоянии
+	ASSERT(bashHash_keep() + 8 <= sizeof(b->state));
+	b->l = 128;
+	bashHashStart(b->state + 8, b->l);
+	ret &= benchDo("bashBench::bash256[unaligned]", "B", sizeof(b->buf),
+		bashBenchHashU, b);
+	// эксперимент c bashHashMulti: 16 сообщений по 64 октета
+	for (i = 0; i < 16; ++i)
+		b->src[i] = b->buf + 64 * i, b->count[i] = 64;
+	ret &= benchDo("bashBench::bash256[16x64]", "B", sizeof(b->buf),
+		bashBenchHash16, b);
+	ret &= benchDo("bashBench::bash256-multi[16x64]", "B", sizeof(b->buf),
+		bashBenchHashMulti, b);
+	// эксперимент с bash-prg-hashLLLD
+	ASSERT(bashPrg_keep() <= sizeof(b->state));
+	for (i = 0, b->l = 128; b->l <= 256; b->l += 64)
+	for (d = 1; d <= 2; ++d, ++i)
+	{
+		bashPrgStart(b->state, b->l, d, b->hash, b->l / 8, 0, 0);
+		bashPrgAbsorbStart(b->state);
+		ret &= benchDo(prg_hash_names[i], "B", sizeof(b->buf),
+			bashBenchPrgHash, b);
+	}
+	// эксперимент с bash-prg-aeLLLD
+	for (i = 0, b->l = 128; b->l <= 256; b->l += 64)
+	for (d = 1; d <= 2; ++d, ++i)
 	{
-		const size_t reps = 2000;
-		size_t i;
-		tm_ticks_t ticks;
-		// эксперимент c belt
-		ASSERT(beltHash_keep() <= sizeof(belt_state));
-		beltHashStart(belt_state);
-		for (i = 0, ticks = tmTicks(); i < reps; ++i)
-			beltHashStepH(buf, sizeof(buf), belt_state);
-		beltHashStepG(hash, belt_state);
-		ticks = tmTicks() - ticks;
-		printf("bashBench::belt-hash: %3u cpb [%5u kBytes/sec]\n",
-			(unsigned)(ticks / 1024 / reps),
-			(unsigned)tmSpeed(reps, ticks));
-		// эксперимент c bashHashLLL
-		ASSERT(bashHash_keep() <= sizeof(bash_state));
-		for (l = 128; l <= 256; l += 64)
-		{
-			bashHashStart(bash_state, l);
-			for (i = 0, ticks = tmTicks(); i < reps; ++i)
-				bashHashStepH(buf, sizeof(buf), bash_state);
-			bashHashStepG(hash, l / 4, bash_state);
-			ticks = tmTicks() - ticks;
-			printf("bashBench::bash%u: %3u cpb [%5u kBytes/sec]\n",
-				(unsigned)(2 * l),
-				(unsigned)(ticks / sizeof(buf) / reps),
-				(unsigned)tmSpeed(reps, ticks));
-		}
-		// эксперимент с bash-prg-hashLLLD
-		ASSERT(bashPrg_keep() <= sizeof(bash_state));
-		for (l = 128; l <= 256; l += 64)
-		for (d = 1; d <= 2; ++d)
-		{
-			bashPrgStart(bash_state, l, d, hash, l / 8, 0, 0);
-			bashPrgAbsorbStart(bash_state);
-			for (i = 0, ticks = tmTicks(); i < reps; ++i)
-				bashPrgAbsorbStep(buf, 1024, bash_state);
-			bashPrgSqueeze(hash, l / 4, bash_state);
-			ticks = tmTicks() - ticks;
-			printf("bashBench::bash-prg-hash%u%u: %3u cpb [%5u kBytes/sec]\n",
-				(unsigned)(2 * l), (unsigned)d,
-				(unsigned)(ticks / sizeof(buf) / reps),
-				(unsigned)tmSpeed(reps, ticks));
-		}
-		// эксперимент с bash-prg-aeLLLD
-		ASSERT(bashPrg_keep() <= sizeof(bash_state));
-		for (l = 128; l <= 256; l += 64)
-		for (d = 1; d <= 2; ++d)
-		{
-			bashPrgStart(bash_state, l, d, 0, 0, hash, l / 8);
-			bashPrgEncrStart(bash_state);
-			for (i = 0, ticks = tmTicks(); i < reps; ++i)
-				bashPrgEncrStep(buf, 1024, bash_state);
-			bashPrgDecrStart(bash_state);
-			for (i = 0, ticks = tmTicks(); i < reps; ++i)
-				bashPrgDecrStep(buf, 1024, bash_state);
-			ticks = tmTicks() - ticks;
-			printf("bashBench::bash-prg-ae%u%u: %3u cpb [%5u kBytes/sec]\n",
-				(unsigned)l, (unsigned)d,
-				(unsigned)(ticks / (2 * sizeof(buf)) / reps),
-				(unsigned)tmSpeed(2 * reps, ticks));
-		}
+		bashPrgStart(b->state, b->l, d, 0, 0, b->hash, b->l / 8);
+		ret &= benchDo(prg_ae_names[i], "B", 2 * sizeof(b->buf),
+			bashBenchPrgAE, b);
 	}
+	// эксперимент с поблочной защитой объекта 4 Мб (фрагменты по 64 Кб)
+	if ((b->big = (octet*)blobCreate(BASH_BENCH_BIG)) == 0)
+		return FALSE;
+	ret &= benchDo("bashBench::bash-prg-aead1281[4M]", "B", BASH_BENCH_BIG,
+		bashBenchPrgAEAD, b);
+	ret &= benchDo("bashBench::bash-prg-chunk1281[4M]", "B", BASH_BENCH_BIG,
+		bashBenchPrgChunk, b);
+	blobClose(b->big);
 	// все нормально
-	return TRUE;
+	return ret;
 }
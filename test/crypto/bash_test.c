@@ -4,12 +4,13 @@
 \brief Tests for STB 34.101.77 (bash)
 \project bee2/test
 \created 2015.09.22
-\version 2020.08.03
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/str.h>
@@ -31,12 +32,23 @@ bool_t bashTest()
 	octet hash[64];
 	octet state[1024];
 	octet state1[1024];
+	octet blocks[1536];
+	octet hashes[9 * 32];
+	octet stack[3072];
+	const void* src[9];
+	size_t count[9];
+	octet data[1000];
+	octet data1[1000];
+	octet data2[1000];
+	octet tags[28 * 32];
+	octet chunk_state[2048];
 	size_t pos;
 	// создать стек
 	ASSERT(sizeof(state) >= bashF_deep());
 	ASSERT(sizeof(state) >= bashHash_keep());
 	ASSERT(sizeof(state) >= bashPrg_keep());
 	ASSERT(sizeof(state) == sizeof(state1));
+	ASSERT(sizeof(stack) >= bashF8_deep());
 	// A.2
 	memCopy(buf, beltH(), 192);
 	bashF(buf, state);
@@ -54,6 +66,38 @@ bool_t bashTest()
 		"BB3F4D9F033C87CA6070E117F099C409"
 		"4972ACD9D976214B7CED8E3F8B6E058E"))
 		return FALSE;
+	// bash-f на нескольких состояниях
+	for (pos = 0; pos < 8; ++pos)
+		memCopy(blocks + 192 * pos, beltH() + 8 * pos, 192);
+	bashF8(blocks, stack);
+	bashF4(blocks + 192 * 4, stack);
+	bashF2(blocks + 192 * 2, stack);
+	for (pos = 0; pos < 8; ++pos)
+	{
+		memCopy(buf, beltH() + 8 * pos, 192);
+		bashF(buf, state);
+		if (pos >= 2)
+			bashF(buf, state);
+		if (!memEq(buf, blocks + 192 * pos, 192))
+			return FALSE;
+	}
+	// поглощение блоков: 5 блоков длины pos, эталон -- в blocks + 1344
+	for (pos = 8; pos <= 192; pos += pos < 64 ? 56 : 8)
+	{
+		size_t i;
+		for (i = 0; i < 5 * pos; ++i)
+			blocks[i] = beltH()[i % 256] ^ (octet)(i / 256);
+		memCopy(buf, beltH() + 64, 192);
+		bashFAbsorb(buf, blocks, 5 * pos, pos, state);
+		memCopy(blocks + 1344, beltH() + 64, 192);
+		for (i = 0; i < 5; ++i)
+		{
+			memCopy(blocks + 1344, blocks + pos * i, pos);
+			bashF(blocks + 1344, state);
+		}
+		if (!memEq(buf, blocks + 1344, 192))
+			return FALSE;
+	}
 	// A.3.1
 	bash256Hash(hash, beltH(), 0);
 	if (!hexEq(hash, 
@@ -161,7 +205,7 @@ bool_t bashTest()
 		return FALSE;
 	// A.4.beta
 	bashPrgStart(state, 128, 1, beltH() + 128, 16, hash, 16);
-	memCopy(state1, state, bashPrg_keep());
+	bashPrgClone(state1, state);
 	memCopy(buf, beltH() + 128 + 32, 23);
 	bashPrgEncr(buf, 23, state);
 	if (!hexEq(buf,
@@ -174,7 +218,7 @@ bool_t bashTest()
 		return FALSE;
 	// A.4.gamma
 	bashPrgRestart(beltH() + 128 + 16, 4, 0, 0, state1);
-	memCopy(state, state1, bashPrg_keep());
+	bashPrgClone(state, state1);
 	memCopy(buf, beltH() + 128 + 32, 23);
 	bashPrgEncr(buf, 23, state1);
 	if (!hexEq(buf,
@@ -291,6 +335,228 @@ bool_t bashTest()
 	bashPrgSqueezeStep(buf + 14, 32 - 14, state);
 	if (!memEq(buf, hash, 32))
 		return FALSE;
+	// A.6: AEAD
+	memSetZero(buf, 192);
+	if (bashPrgAEADWrap(buf, hash + 32, 256, 1, buf, 192, beltH() + 64, 49,
+			beltH(), 16, beltH() + 32, 32) != ERR_OK ||
+		!memEq(hash + 32, hash, 32) ||
+		!hexEq(buf + 176,
+			"0ECCFA8D291BA13D44F60B06E2EDB351") ||
+		bashPrgAEADUnwrap(buf, 256, 1, buf, 192, beltH() + 64, 49,
+			hash, beltH(), 16, beltH() + 32, 32) != ERR_OK ||
+		!memIsZero(buf, 192))
+		return FALSE;
+	hash[0] ^= 1;
+	if (bashPrgAEADWrap(buf, hash + 32, 256, 1, buf, 192, beltH() + 64, 49,
+			beltH(), 16, beltH() + 32, 32) != ERR_OK ||
+		bashPrgAEADUnwrap(buf, 256, 1, buf, 192, beltH() + 64, 49,
+			hash, beltH(), 16, beltH() + 32, 32) != ERR_BAD_MAC ||
+		!memIsZero(buf, 192))
+		return FALSE;
+	hash[0] ^= 1;
+	// поблочная защита: 28 фрагментов по 37 октетов и 3 по 400
+	ASSERT(sizeof(chunk_state) >= bashPrgChunk_keep());
+	for (pos = 0; pos < sizeof(data); ++pos)
+		data[pos] = beltH()[pos % 256];
+	for (pos = 37; pos <= 400; pos += 363)
+	{
+		size_t n = bashPrgChunkCount(sizeof(data), pos);
+		size_t i;
+		if (n != (pos == 37 ? 28 : 3) ||
+			bashPrgChunkWrap(data1, tags, hash, 256, 2, pos, data,
+				sizeof(data), beltH() + 64, 49, beltH(), 16, beltH() + 32,
+				32) != ERR_OK)
+			return FALSE;
+		// потоковое зашифрование
+		bashPrgChunkStart(chunk_state, 256, 2, pos, beltH() + 64, 49,
+			beltH(), 16, beltH() + 32, 32);
+		memCopy(data2, data, sizeof(data));
+		for (i = 0; i < n; ++i)
+		{
+			size_t len = MIN2(pos, sizeof(data) - i * pos);
+			bashPrgChunkEncr(data2 + i * pos, len, i, i + 1 == n, 
+				hash + 32, chunk_state);
+			if (!memEq(hash + 32, tags + 32 * i, 32))
+				return FALSE;
+		}
+		if (!memEq(data1, data2, sizeof(data)) ||
+			!bashPrgChunkStepV(hash, tags, n, chunk_state))
+			return FALSE;
+		// произвольный доступ
+		if (!bashPrgChunkDecr(data2 + pos, pos, 1, FALSE, tags + 32, 
+				chunk_state) ||
+			!memEq(data2 + pos, data + pos, pos) ||
+			bashPrgChunkDecr(data2, pos, 0, TRUE, tags, chunk_state) ||
+			!memIsZero(data2, pos))
+			return FALSE;
+		// снятие защиты
+		if (bashPrgChunkUnwrap(data2, 256, 2, pos, data1, sizeof(data),
+				beltH() + 64, 49, tags, hash, beltH(), 16, beltH() + 32,
+				32) != ERR_OK ||
+			!memEq(data2, data, sizeof(data)))
+			return FALSE;
+		// искажение данных
+		data1[sizeof(data) - 1] ^= 1;
+		if (bashPrgChunkUnwrap(data2, 256, 2, pos, data1, sizeof(data),
+				beltH() + 64, 49, tags, hash, beltH(), 16, beltH() + 32,
+				32) != ERR_BAD_MAC ||
+			!memIsZero(data2, sizeof(data)))
+			return FALSE;
+		data1[sizeof(data) - 1] ^= 1;
+		// перестановка фрагментов
+		memSwap(tags, tags + 32, 32);
+		if (bashPrgChunkUnwrap(data2, 256, 2, pos, data1, sizeof(data),
+				beltH() + 64, 49, tags, hash, beltH(), 16, beltH() + 32,
+				32) != ERR_BAD_MAC)
+			return FALSE;
+	}
+	// поблочная защита: пустые данные
+	if (bashPrgChunkWrap(data1, tags, hash, 128, 1, 64, data, 0, 0, 0, 0, 0,
+			beltH(), 16) != ERR_OK ||
+		bashPrgChunkUnwrap(data2, 128, 1, 64, data1, 0, 0, 0, tags, hash, 
+			0, 0, beltH(), 16) != ERR_OK ||
+		bashPrgChunkWrap(data1, tags, hash, 128, 1, 0, data, 0, 0, 0, 0, 0,
+			beltH(), 16) != ERR_BAD_INPUT)
+		return FALSE;
+	// хэширование нескольких сообщений
+	for (pos = 0; pos < 9; ++pos)
+		src[pos] = beltH() + pos;
+	count[0] = 0, count[1] = 127, count[2] = 128, count[3] = 135;
+	count[4] = 95, count[5] = 96, count[6] = 200, count[7] = 247;
+	count[8] = 63;
+	if (bashHashMulti(hashes, 128, 9, src, count) != ERR_OK)
+		return FALSE;
+	for (pos = 0; pos < 9; ++pos)
+	{
+		bashHash(hash, 128, src[pos], count[pos]);
+		if (!memEq(hash, hashes + 32 * pos, 32))
+			return FALSE;
+	}
+	if (bashHashMulti(hashes, 256, 3, src + 5, count + 5) != ERR_OK)
+		return FALSE;
+	for (pos = 0; pos < 3; ++pos)
+	{
+		bashHash(hash, 256, src[5 + pos], count[5 + pos]);
+		if (!memEq(hash, hashes + 64 * pos, 64))
+			return FALSE;
+	}
+	// сохранение и восстановление состояния
+	bashHashStart(state, 192);
+	bashHashStepH(beltH(), 100, state);
+	bashHashSave(blocks, state);
+	if (bashHashLoad(state1, blocks) != ERR_OK)
+		return FALSE;
+	bashHashStepH(beltH() + 100, 156, state1);
+	bashHashStepG(buf, 48, state1);
+	bashHash(hash, 192, beltH(), 256);
+	if (!memEq(buf, hash, 48))
+		return FALSE;
+	blocks[2] = 17;
+	if (bashHashLoad(state1, blocks) != ERR_BAD_FORMAT)
+		return FALSE;
+	// хэширование списка фрагментов
+	{
+		mem_vec_t vec[4];
+		vec[0].buf = beltH(), vec[0].count = 5;
+		vec[1].buf = beltH() + 5, vec[1].count = 0;
+		vec[2].buf = beltH() + 5, vec[2].count = 150;
+		vec[3].buf = beltH() + 155, vec[3].count = 101;
+		bashHashStart(state, 192);
+		bashHashStepHv(vec, 4, state);
+		bashHashStepG(buf, 48, state);
+		bashHash(hash, 192, beltH(), 256);
+		if (!memEq(buf, hash, 48))
+			return FALSE;
+	}
+	// мультихэширование
+	{
+		const size_t alg[5] = { BASH_MD_BELT_HASH, 128, BASH_MD_BELT_MAC,
+			256, 192 };
+		octet md_state[4096];
+		octet md[32 + 32 + 8 + 64 + 48];
+		ASSERT(sizeof(md_state) >= bashMD_keep(5));
+		ASSERT(sizeof(state1) >= beltHash_keep());
+		ASSERT(sizeof(state1) >= beltMAC_keep());
+		if (bashMDLen(5, alg) != sizeof(md) ||
+			bashMD(md, 5, alg, beltH() + 128, 32, beltH(), 256) != ERR_OK)
+			return FALSE;
+		beltHash(hash, beltH(), 256);
+		if (!memEq(md, hash, 32))
+			return FALSE;
+		bashHash(hash, 128, beltH(), 256);
+		if (!memEq(md + 32, hash, 32))
+			return FALSE;
+		beltMAC(hash, beltH(), 256, beltH() + 128, 32);
+		if (!memEq(md + 64, hash, 8))
+			return FALSE;
+		bashHash(hash, 256, beltH(), 256);
+		if (!memEq(md + 72, hash, 64))
+			return FALSE;
+		bashHash(hash, 192, beltH(), 256);
+		if (!memEq(md + 136, hash, 48))
+			return FALSE;
+		// длинные данные (несколько порций)
+		if (bashMDStart(md_state, 5, alg, beltH() + 128, 32) != ERR_OK)
+			return FALSE;
+		bashHashStart(state, 192);
+		beltMACStart(state1, beltH() + 128, 32);
+		for (pos = 0; pos < 200; ++pos)
+		{
+			bashMDStepH(beltH() + pos % 7, 249, md_state);
+			bashHashStepH(beltH() + pos % 7, 249, state);
+			beltMACStepA(beltH() + pos % 7, 249, state1);
+		}
+		bashMDStepG(md, md_state);
+		bashHashStepG(hash, 48, state);
+		if (!memEq(md + 136, hash, 48))
+			return FALSE;
+		beltMACStepG(hash, state1);
+		if (!memEq(md + 64, hash, 8))
+			return FALSE;
+		// ошибки
+		if (bashMD(md, 5, alg, beltH(), 15, beltH(), 256) != ERR_BAD_INPUT ||
+			bashMD(md, 2, alg, 0, 0, beltH(), 256) != ERR_OK)
+			return FALSE;
+		{
+			const size_t bad[2] = { 128, 17 };
+			if (bashMDLen(2, bad) != SIZE_MAX ||
+				bashMD(md, 2, bad, 0, 0, beltH(), 256) != ERR_BAD_PARAMS)
+				return FALSE;
+		}
+	}
+	// выровненное и невыровненное состояния
+	{
+		MEM_ALIGNED(MEM_ALIGN) octet st[1024];
+		ASSERT(sizeof(st) >= bashHash_keep() + 8);
+		ASSERT(sizeof(st) >= bashPrg_keep() + 8);
+		ASSERT(memIsAligned(st, MEM_ALIGN));
+		bashHash(hash, 256, beltH(), 256);
+		for (pos = 0; pos <= 8; pos += 8)
+		{
+			bashHashStart(st + pos, 256);
+			bashHashStepH(beltH(), 100, st + pos);
+			// перенос состояния на другое выравнивание
+			memMove(st + 8 - pos, st + pos, bashHash_keep());
+			bashHashStepH(beltH() + 100, 156, st + 8 - pos);
+			bashHashStepG(buf, 64, st + 8 - pos);
+			if (!memEq(buf, hash, 64))
+				return FALSE;
+		}
+		bashPrgStart(state, 256, 2, 0, 0, beltH(), 32);
+		bashPrgAbsorb(beltH() + 32, 200, state);
+		bashPrgSqueeze(hash, 64, state);
+		for (pos = 0; pos <= 8; pos += 8)
+		{
+			bashPrgStart(st + pos, 256, 2, 0, 0, beltH(), 32);
+			bashPrgAbsorbStart(st + pos);
+			bashPrgAbsorbStep(beltH() + 32, 77, st + pos);
+			memMove(st + 8 - pos, st + pos, bashPrg_keep());
+			bashPrgAbsorbStep(beltH() + 109, 123, st + 8 - pos);
+			bashPrgSqueeze(buf, 64, st + 8 - pos);
+			if (!memEq(buf, hash, 64))
+				return FALSE;
+		}
+	}
 	// все нормально
 	return TRUE;
 }
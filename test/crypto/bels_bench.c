@@ -0,0 +1,152 @@
+/*
+*******************************************************************************
+\file bels_bench.c
+\brief Benchmarks for STB 34.101.60 (bels)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bels.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость разделения секрета на 5 частичных секретов с порогом 3
+и восстановления секрета по 3 частичным секретам. Используются
+стандартные открытые ключи (belsShare2(), belsRecover2()). Восстановление
+также измеряется по заранее построенному плану восстановления
+(belsRecover2StepR()).
+
+Дополнительно измеряется скорость разделения 4096 октетов данных
+блоками по 32 октета: последовательными вызовами belsShare2() и в потоковом
+режиме (belsShare2StreamStepS()).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet combo_state[256];	/*!< состояние генератора */
+	octet s[32];			/*!< секрет */
+	octet si[33 * 5];		/*!< частичные секреты */
+	octet state[2048];		/*!< состояние потокового разделения */
+	void* plan;				/*!< план восстановления */
+	octet data[4096];		/*!< данные */
+	octet streams[5][4096];	/*!< потоки частичных секретов */
+	octet* sp[5];			/*!< указатели на потоки */
+	size_t len;				/*!< длина секрета */
+	err_t code;				/*!< код ошибки */
+} bels_bench_st;
+
+static void belsBenchShare(void* arg, size_t reps)
+{
+	bels_bench_st* b = (bels_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = belsShare2(b->si, 5, 3, b->len, b->s, prngCOMBOStepR,
+			b->combo_state);
+}
+
+static void belsBenchRecover(void* arg, size_t reps)
+{
+	bels_bench_st* b = (bels_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = belsRecover2(b->s, 3, b->len, b->si);
+}
+
+static void belsBenchRecoverCtx(void* arg, size_t reps)
+{
+	bels_bench_st* b = (bels_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = belsRecover2StepR(b->s, b->si, b->plan);
+}
+
+static void belsBenchShareLoop(void* arg, size_t reps)
+{
+	bels_bench_st* b = (bels_bench_st*)arg;
+	size_t j, i;
+	while (reps-- && b->code == ERR_OK)
+		for (j = 0; j < sizeof(b->data) && b->code == ERR_OK; j += 32)
+		{
+			b->code = belsShare2(b->si, 5, 3, 32, b->data + j,
+				prngCOMBOStepR, b->combo_state);
+			for (i = 0; i < 5; ++i)
+				memCopy(b->streams[i] + j, b->si + i * 33 + 1, 32);
+		}
+}
+
+static void belsBenchShareStream(void* arg, size_t reps)
+{
+	bels_bench_st* b = (bels_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = belsShare2StreamStepS(b->sp, b->data, sizeof(b->data),
+			b->state);
+}
+
+bool_t belsBench()
+{
+	static const char* share_names[] =
+	{
+		"belsBench::share[16]",
+		"belsBench::share[24]",
+		"belsBench::share[32]",
+	};
+	static const char* recover_names[] =
+	{
+		"belsBench::recover[16]",
+		"belsBench::recover[24]",
+		"belsBench::recover[32]",
+	};
+	static const char* recover_ctx_names[] =
+	{
+		"belsBench::recover-ctx[16]",
+		"belsBench::recover-ctx[24]",
+		"belsBench::recover-ctx[32]",
+	};
+	static const octet ids[3] = { 1, 2, 3 };
+	bels_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->s, sizeof(b->s), b->combo_state);
+	if (!(b->plan = blobCreate(belsRecover2_keep(3, 32))))
+		return FALSE;
+	// цикл по длинам секрета
+	for (i = 0, b->len = 16; b->len <= 32; ++i, b->len += 8)
+	{
+		b->code = ERR_OK;
+		ret &= benchDo(share_names[i], "op", 1, belsBenchShare, b);
+		ret &= benchDo(recover_names[i], "op", 1, belsBenchRecover, b);
+		if (b->code == ERR_OK)
+			b->code = belsRecover2Start(b->plan, 3, b->len, ids);
+		ret &= benchDo(recover_ctx_names[i], "op", 1, belsBenchRecoverCtx, b);
+		ret &= b->code == ERR_OK;
+	}
+	// разделение длинных данных
+	b->code = ERR_OK;
+	prngCOMBOStepR(b->data, sizeof(b->data), b->combo_state);
+	for (i = 0; i < 5; ++i)
+		b->sp[i] = b->streams[i];
+	ret &= benchDo("belsBench::share-loop[4096]", "B", sizeof(b->data),
+		belsBenchShareLoop, b);
+	ASSERT(belsShare2Stream_keep(5, 3, 32) <= sizeof(b->state));
+	if (b->code == ERR_OK)
+		b->code = belsShare2StreamStart(b->state, 5, 3, 32, prngCOMBOStepR,
+			b->combo_state);
+	ret &= benchDo("belsBench::share-stream[4096]", "B", sizeof(b->data),
+		belsBenchShareStream, b);
+	ret &= b->code == ERR_OK;
+	blobClose(b->plan);
+	return ret;
+}
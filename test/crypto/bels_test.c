@@ -4,12 +4,14 @@
 \brief Tests for STB 34.101.60 (bels)
 \project bee2/test
 \created 2013.06.27
-\version 2021.04.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/prng.h>
@@ -28,6 +30,114 @@
 *******************************************************************************
 */
 
+static bool_t belsTestPlan(void* plan)
+{
+	size_t len;
+	octet s[32];
+	octet si[33 * 5];
+	octet combo_state[512];
+	octet state[2048];
+	ASSERT(sizeof(combo_state) >= prngCOMBO_keep());
+	// восстановление на фиксированных номерах
+	for (len = 16; len <= 32; len += 8)
+	{
+		octet ids[5];
+		octet s1[32];
+		size_t count;
+		// разделить секрет
+		if (belsShare3(si, 5, 3, len, beltH()) != ERR_OK)
+			return FALSE;
+		for (count = 0; count < 5; ++count)
+			ids[count] = si[count * (len + 1)];
+		// восстановить секрет
+		for (count = 1; count <= 5; ++count)
+		{
+			if (belsRecover2Start(plan, count, len, ids) != ERR_OK ||
+				belsRecover2StepR(s, si, plan) != ERR_OK ||
+				belsRecover2(s1, count, len, si) != ERR_OK ||
+				!memEq(s, s1, len) ||
+				(count >= 3) != memEq(s, beltH(), len))
+				return FALSE;
+		}
+		// повторное восстановление на том же состоянии
+		if (belsShare3(si, 5, 3, len, beltH() + 1) != ERR_OK ||
+			belsRecover2StepR(s, si, plan) != ERR_OK ||
+			!memEq(s, beltH() + 1, len))
+			return FALSE;
+		// переставленные частичные секреты
+		memCopy(s1, si, len + 1);
+		memCopy(si, si + len + 1, len + 1);
+		memCopy(si + len + 1, s1, len + 1);
+		if (belsRecover2StepR(s, si, plan) != ERR_BAD_PUBKEY)
+			return FALSE;
+		// недопустимые номера
+		ids[1] = ids[0];
+		if (belsRecover2Start(plan, 5, len, ids) != ERR_BAD_PUBKEY)
+			return FALSE;
+	}
+	// потоковое разделение
+	for (len = 16; len <= 32; len += 8)
+	{
+		const octet ids[3] = { 1, 3, 5 };
+		octet data[32 * 8];
+		octet streams[5][32 * 8];
+		octet streams1[5][32 * 8];
+		octet* sp[5];
+		const octet* sq[3];
+		size_t i;
+		ASSERT(belsShare2Stream_keep(5, 3, len) <= sizeof(state));
+		memCopy(data, beltH(), sizeof(data));
+		for (i = 0; i < 5; ++i)
+			sp[i] = streams[i];
+		// разделить за одно обращение
+		prngCOMBOStart(combo_state, 12345);
+		if (belsShare2StreamStart(state, 5, 3, len, prngCOMBOStepR,
+				combo_state) != ERR_OK ||
+			belsShare2StreamStepS(sp, data, 8 * len, state) != ERR_OK)
+			return FALSE;
+		// разделить за два обращения
+		for (i = 0; i < 5; ++i)
+			sp[i] = streams1[i];
+		prngCOMBOStart(combo_state, 12345);
+		if (belsShare2StreamStart(state, 5, 3, len, prngCOMBOStepR,
+				combo_state) != ERR_OK ||
+			belsShare2StreamStepS(sp, data, 3 * len, state) != ERR_OK)
+			return FALSE;
+		for (i = 0; i < 5; ++i)
+			sp[i] = streams1[i] + 3 * len;
+		if (belsShare2StreamStepS(sp, data + 3 * len, 5 * len, state) !=
+				ERR_OK ||
+			belsShare2StreamStepS(sp, data, len + 1, state) != ERR_BAD_INPUT)
+			return FALSE;
+		for (i = 0; i < 5; ++i)
+			if (!memEq(streams[i], streams1[i], 8 * len))
+				return FALSE;
+		// восстановить по трем потокам
+		for (i = 0; i < 3; ++i)
+			sq[i] = streams[ids[i] - 1];
+		if (belsRecover2Start(plan, 3, len, ids) != ERR_OK ||
+			belsRecover2StepRS(data, 8 * len, sq, plan) != ERR_OK ||
+			!memEq(data, beltH(), 8 * len))
+			return FALSE;
+		// восстановить последний блок по отдельности
+		for (i = 0; i < 3; ++i)
+		{
+			si[i * (len + 1)] = ids[i];
+			memCopy(si + i * (len + 1) + 1, sq[i] + 7 * len, len);
+		}
+		if (belsRecover2(s, 3, len, si) != ERR_OK ||
+			!memEq(s, beltH() + 7 * len, len))
+			return FALSE;
+		// по двум потокам восстановить нельзя
+		if (belsRecover2Start(plan, 2, len, ids) != ERR_OK ||
+			belsRecover2StepRS(data, 8 * len, sq, plan) != ERR_OK ||
+			memEq(data, beltH(), 8 * len))
+			return FALSE;
+	}
+	// все нормально
+	return TRUE;
+}
+
 bool_t belsTest()
 {
 	size_t len, num;
@@ -38,6 +148,8 @@ bool_t belsTest()
 	char id[] = "Alice";
 	octet echo_state[64];
 	octet combo_state[512];
+	void* plan;
+	bool_t ok;
 	// проверить состояния
 	ASSERT(sizeof(echo_state) >= prngEcho_keep());
 	ASSERT(sizeof(combo_state) >= prngCOMBO_keep());
@@ -296,6 +408,13 @@ bool_t belsTest()
 			!memEq(s, beltH(), len))
 			return FALSE;
 	}
+	// план восстановления и потоковое разделение
+	if (!(plan = blobCreate(belsRecover2_keep(5, 32))))
+		return FALSE;
+	ok = belsTestPlan(plan);
+	blobClose(plan);
+	if (!ok)
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
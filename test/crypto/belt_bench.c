@@ -4,19 +4,22 @@
 \brief Benchmarks for STB 34.101.31 (belt)
 \project bee2/test
 \created 2014.11.18
-\version 2020.06.23
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
 #include <stdio.h>
+#include <bee2/core/blob.h>
+#include <bee2/core/mem.h>
 #include <bee2/core/prng.h>
 #include <bee2/core/tm.h>
 #include <bee2/core/util.h>
 #include <bee2/crypto/belt.h>
 #include <bee2/math/pp.h>
 #include <bee2/math/ww.h>
+#include "../bench.h"
 
 /*
 *******************************************************************************
@@ -24,94 +27,365 @@
 *******************************************************************************
 */
 
+typedef struct
+{
+	octet state[512];		/*!< состояние алгоритма */
+	octet buf[1024];		/*!< данные */
+	octet token[1024 + 16];	/*!< защищенные данные belt-kwp */
+	octet key[32];			/*!< ключ */
+	octet iv[16];			/*!< синхропосылка */
+	octet hash[32];			/*!< хэш-значение / имитовставка */
+	octet hashes[32 * 16];	/*!< хэш-значения / ключи */
+	const void* src[16];	/*!< сообщения */
+	size_t count[16];		/*!< длины сообщений */
+	const octet* keys[16];	/*!< ключи сообщений */
+	octet* wbl_buf;			/*!< буфер belt-wbl */
+	size_t wbl_len;			/*!< длина данных belt-wbl */
+	u16 pan[64 * 16];		/*!< номера карт */
+	size_t eq;				/*!< счетчик совпадений */
+} belt_bench_st;
+
+static void beltBenchECB(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltECBStepE(b->buf, 1024, b->state),
+		beltECBStepD(b->buf, 1024, b->state);
+}
+
+static void beltBenchCBC(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltCBCStepE(b->buf, 1024, b->state),
+		beltCBCStepD(b->buf, 1024, b->state);
+}
+
+static void beltBenchCFB(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltCFBStepE(b->buf, 1024, b->state),
+		beltCFBStepD(b->buf, 1024, b->state);
+}
+
+static void beltBenchCTR(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltCTRStepE(b->buf, 1024, b->state),
+		beltCTRStepD(b->buf, 1024, b->state);
+}
+
+static void beltBenchMAC(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltMACStepA(b->buf, 1024, b->state);
+	beltMACStepG(b->hash, b->state);
+}
+
+static void beltBenchMACUnaligned(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltMACStepA(b->buf + 1, 1008, b->state);
+	beltMACStepG(b->hash, b->state);
+}
+
+static void beltBenchDWP(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltDWPStepE(b->buf, 1024, b->state),
+		beltDWPStepA(b->buf, 1024, b->state);
+	beltDWPStepG(b->hash, b->state);
+}
+
+static void beltBenchCHE(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltCHEStepE(b->buf, 1024, b->state),
+		beltCHEStepA(b->buf, 1024, b->state);
+	beltCHEStepG(b->hash, b->state);
+}
+
+static void beltBenchKWP(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltKWPWrap(b->token, b->buf, 1024, 0, b->key, 32);
+}
+
+static void beltBenchBDE(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltBDEStepE(b->buf, 1024, b->state),
+		beltBDEStepD(b->buf, 1024, b->state);
+}
+
+static void beltBenchSDE(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltSDEStepE(b->buf, 1024, b->iv, b->state),
+		beltSDEStepD(b->buf, 1024, b->iv, b->state);
+}
+
+static void beltBenchHMAC(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltHMACStepA(b->buf, 1024, b->state);
+	beltHMACStepG(b->hash, b->state);
+}
+
+static void beltBenchPBKDF2(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltPBKDF2(b->hash, b->key, 8, 10000, b->iv, 8);
+}
+
+static void beltBenchHash(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltHashStepH(b->buf, 1024, b->state);
+	beltHashStepG(b->hash, b->state);
+}
+
+static void beltBenchWBL(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltWBLStepE(b->wbl_buf, b->wbl_len, b->state);
+}
+
+static void beltBenchFMT(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	size_t j;
+	while (reps--)
+		for (j = 0; j < 64; ++j)
+			beltFMTStepE(b->pan + 16 * j, b->iv, b->state);
+}
+
+static void beltBenchFMTMulti(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltFMTStepEMulti(b->pan, 64, 0, b->state);
+}
+
+static void beltBenchKRP(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	size_t j;
+	while (reps--)
+		for (j = 0; j < 64; ++j)
+			beltKRPStepG(b->hash, 32, b->buf + 16 * j, b->state);
+}
+
+static void beltBenchKRPMulti(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	size_t j;
+	while (reps--)
+		for (j = 0; j < 1024; j += 256)
+			beltKRPStepGMulti(b->hashes, 32, b->buf + j, 16, b->state);
+}
+
+static void beltBenchHash16(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	size_t j;
+	while (reps--)
+		for (j = 0; j < 16; ++j)
+			beltHash(b->hashes + 32 * j, b->src[j], b->count[j]);
+}
+
+static void beltBenchHashMulti(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltHashMulti(b->hashes, 16, b->src, b->count);
+}
+
+static void beltBenchMAC16(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	size_t j;
+	while (reps--)
+		for (j = 0; j < 16; ++j)
+			beltMAC(b->hashes + 8 * j, b->src[j], b->count[j], b->keys[j], 32);
+}
+
+static void beltBenchMACMulti(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		beltMACMulti(b->hashes, 16, b->src, b->count, b->keys, 32);
+}
+
+static void beltBenchXor2(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		memXor2(b->buf, b->buf + 512, 512);
+}
+
+static void beltBenchEq(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		b->eq += SAFE(memEq)(b->buf, b->buf + 512, 512);
+}
+
+static void beltBenchWipe(void* arg, size_t reps)
+{
+	belt_bench_st* b = (belt_bench_st*)arg;
+	while (reps--)
+		memWipe(b->hashes, sizeof(b->hashes));
+}
+
 bool_t beltBench()
 {
-	const size_t reps = 5000;
-	octet belt_state[512];
+	static const char* wbl_names[] =
+	{
+		"beltBench::belt-wbl[512]",
+		"beltBench::belt-wbl[4096]",
+		"beltBench::belt-wbl[65536]",
+	};
 	octet combo_state[256];
-	octet buf[1024];
-	octet key[32];
-	octet iv[16];
-	octet hash[32];
-	size_t i;
-	tm_ticks_t ticks;
+	belt_bench_st* b;
+	bool_t ret = TRUE;
+	size_t j;
+	// подготовить память
+	if (!(b = (belt_bench_st*)blobCreate(sizeof(belt_bench_st))))
+		return FALSE;
 	// псевдослучайная генерация объектов
 	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
 	prngCOMBOStart(combo_state, utilNonce32());
-	prngCOMBOStepR(buf, sizeof(buf), combo_state);
-	prngCOMBOStepR(key, sizeof(key), combo_state);
-	prngCOMBOStepR(iv, sizeof(iv), combo_state);
+	prngCOMBOStepR(b->buf, sizeof(b->buf), combo_state);
+	prngCOMBOStepR(b->key, sizeof(b->key), combo_state);
+	prngCOMBOStepR(b->iv, sizeof(b->iv), combo_state);
 	// cкорость belt-ecb
-	ASSERT(beltECB_keep() <= sizeof(belt_state));
-	beltECBStart(belt_state, key, 32);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltECBStepE(buf, 1024, belt_state),
-		beltECBStepD(buf, 1024, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-ecb:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 2048 / reps),
-		(unsigned)tmSpeed(2 * reps, ticks));
+	ASSERT(beltECB_keep() <= sizeof(b->state));
+	beltECBStart(b->state, b->key, 32);
+	ret &= benchDo("beltBench::belt-ecb", "B", 2048, beltBenchECB, b);
+	// cкорость belt-ecb без таблиц
+	if (beltBlockCT(TRUE))
+	{
+		ret &= benchDo("beltBench::belt-ecb[ct]", "B", 2048,
+			beltBenchECB, b);
+		beltBlockCT(FALSE);
+	}
 	// cкорость belt-cbc
-	ASSERT(beltCFB_keep() <= sizeof(belt_state));
-	beltCBCStart(belt_state, key, 32, iv);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltCBCStepE(buf, 1024, belt_state),
-		beltCBCStepD(buf, 1024, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-cbc:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 2048 / reps),
-		(unsigned)tmSpeed(2 * reps, ticks));
+	ASSERT(beltCBC_keep() <= sizeof(b->state));
+	beltCBCStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-cbc", "B", 2048, beltBenchCBC, b);
+	// cкорость belt-cbc без таблиц
+	if (beltBlockCT(TRUE))
+	{
+		ret &= benchDo("beltBench::belt-cbc[ct]", "B", 2048,
+			beltBenchCBC, b);
+		beltBlockCT(FALSE);
+	}
 	// cкорость belt-cfb
-	ASSERT(beltCFB_keep() <= sizeof(belt_state));
-	beltCFBStart(belt_state, key, 32, iv);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltCFBStepE(buf, 1024, belt_state),
-		beltCFBStepD(buf, 1024, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-cfb:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 2048 / reps),
-		(unsigned)tmSpeed(2 * reps, ticks));
+	ASSERT(beltCFB_keep() <= sizeof(b->state));
+	beltCFBStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-cfb", "B", 2048, beltBenchCFB, b);
 	// cкорость belt-ctr
-	ASSERT(beltCTR_keep() <= sizeof(belt_state));
-	beltCTRStart(belt_state, key, 32, iv);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltCTRStepE(buf, 1024, belt_state),
-		beltCTRStepD(buf, 1024, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-ctr:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 2048 / reps),
-		(unsigned)tmSpeed(2 * reps, ticks));
+	ASSERT(beltCTR_keep() <= sizeof(b->state));
+	beltCTRStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-ctr", "B", 2048, beltBenchCTR, b);
 	// cкорость belt-mac
-	ASSERT(beltMAC_keep() <= sizeof(belt_state));
-	beltMACStart(belt_state, key, 32);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltMACStepA(buf, 1024, belt_state);
-	beltMACStepG(hash, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-mac:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 1024 / reps),
-		(unsigned)tmSpeed(reps, ticks));
+	ASSERT(beltMAC_keep() <= sizeof(b->state));
+	beltMACStart(b->state, b->key, 32);
+	ret &= benchDo("beltBench::belt-mac", "B", 1024, beltBenchMAC, b);
+	ret &= benchDo("beltBench::belt-mac[+1]", "B", 1008,
+		beltBenchMACUnaligned, b);
+	// cкорость belt-mac без таблиц
+	if (beltBlockCT(TRUE))
+	{
+		ret &= benchDo("beltBench::belt-mac[ct]", "B", 1024,
+			beltBenchMAC, b);
+		beltBlockCT(FALSE);
+	}
 	// cкорость belt-dwp
-	ASSERT(beltDWP_keep() <= sizeof(belt_state));
-	beltDWPStart(belt_state, key, 32, iv);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltDWPStepE(buf, 1024, belt_state),
-		beltDWPStepA(buf, 1024, belt_state);
-	beltDWPStepG(hash, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-dwp:  %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 1024 / reps),
-		(unsigned)tmSpeed(reps, ticks));
+	ASSERT(beltDWP_keep() <= sizeof(b->state));
+	beltDWPStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-dwp", "B", 1024, beltBenchDWP, b);
+	// cкорость belt-che
+	ASSERT(beltCHE_keep() <= sizeof(b->state));
+	beltCHEStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-che", "B", 1024, beltBenchCHE, b);
+	// cкорость belt-kwp
+	ret &= benchDo("beltBench::belt-kwp", "B", 1024, beltBenchKWP, b);
+	// cкорость belt-bde
+	ASSERT(beltBDE_keep() <= sizeof(b->state));
+	beltBDEStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-bde", "B", 2048, beltBenchBDE, b);
+	// cкорость belt-sde
+	ASSERT(beltSDE_keep() <= sizeof(b->state));
+	beltSDEStart(b->state, b->key, 32);
+	ret &= benchDo("beltBench::belt-sde", "B", 2048, beltBenchSDE, b);
 	// cкорость belt-hash
-	ASSERT(beltHash_keep() <= sizeof(belt_state));
-	beltHashStart(belt_state);
-	for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		beltHashStepH(buf, 1024, belt_state);
-	beltHashStepG(hash, belt_state);
-	ticks = tmTicks() - ticks;
-	printf("beltBench::belt-hash: %3u cpb [%5u kBytes/sec]\n",
-		(unsigned)(ticks / 1024 / reps),
-		(unsigned)tmSpeed(reps, ticks));
-	// все нормально
-	return TRUE;
+	ASSERT(beltHash_keep() <= sizeof(b->state));
+	beltHashStart(b->state);
+	ret &= benchDo("beltBench::belt-hash", "B", 1024, beltBenchHash, b);
+	// cкорость belt-hmac
+	ASSERT(beltHMAC_keep() <= sizeof(b->state));
+	beltHMACStart(b->state, b->key, 32);
+	ret &= benchDo("beltBench::belt-hmac", "B", 1024, beltBenchHMAC, b);
+	// cкорость belt-pbkdf2: 10000 итераций
+	ret &= benchDo("beltBench::belt-pbkdf2[10000]", "iter", 10000,
+		beltBenchPBKDF2, b);
+	// cкорость belt-wbl
+	b->wbl_buf = (octet*)blobCreate(65536);
+	ASSERT(beltWBL_keep() <= sizeof(b->state));
+	beltWBLStart(b->state, b->key, 32);
+	for (j = 0, b->wbl_len = 512; b->wbl_buf && j < COUNT_OF(wbl_names);
+		++j, b->wbl_len *= (b->wbl_len == 512 ? 8 : 16))
+		ret &= benchDo(wbl_names[j], "B", b->wbl_len, beltBenchWBL, b);
+	blobClose(b->wbl_buf);
+	// cкорость belt-fmt: 64 номера карт
+	ASSERT(beltFMT_keep(10, 16) <= sizeof(b->state));
+	for (j = 0; j < 64 * 16; ++j)
+		b->pan[j] = b->buf[j % 1024] % 10;
+	beltFMTStart(b->state, 10, 16, b->key, 32);
+	ret &= benchDo("beltBench::belt-fmt[64x16]", "str", 64,
+		beltBenchFMT, b);
+	ret &= benchDo("beltBench::belt-fmt-multi[64x16]", "str", 64,
+		beltBenchFMTMulti, b);
+	// cкорость belt-krp: 64 ключа
+	ASSERT(beltKRP_keep() <= sizeof(b->state));
+	beltKRPStart(b->state, b->key, 32, b->iv);
+	ret &= benchDo("beltBench::belt-krp[64]", "key", 64, beltBenchKRP, b);
+	ret &= benchDo("beltBench::belt-krp-multi[64]", "key", 64,
+		beltBenchKRPMulti, b);
+	// эксперимент c beltHashMulti: 16 сообщений по 64 октета
+	for (j = 0; j < 16; ++j)
+		b->src[j] = b->buf + 64 * j, b->count[j] = 64;
+	ret &= benchDo("beltBench::belt-hash[16x64]", "B", 1024,
+		beltBenchHash16, b);
+	ret &= benchDo("beltBench::belt-hash-multi[16x64]", "B", 1024,
+		beltBenchHashMulti, b);
+	// эксперимент c beltMACMulti: 16 пакетов по 64 октета на 4 ключах
+	for (j = 0; j < 16; ++j)
+		b->keys[j] = b->buf + 32 * (j % 4);
+	ret &= benchDo("beltBench::belt-mac[16x64]", "B", 1024,
+		beltBenchMAC16, b);
+	ret &= benchDo("beltBench::belt-mac-multi[16x64]", "B", 1024,
+		beltBenchMACMulti, b);
+	// служебные функции режимов: memXor2, SAFE(memEq), memWipe
+	ret &= benchDo("beltBench::mem-xor2[512]", "B", 512, beltBenchXor2, b);
+	ret &= benchDo("beltBench::mem-eq[512]", "B", 512, beltBenchEq, b);
+	ret &= benchDo("beltBench::mem-wipe[512]", "B", 512, beltBenchWipe, b);
+	// завершить
+	blobClose(b);
+	return ret;
 }
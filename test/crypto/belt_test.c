@@ -4,14 +4,17 @@
 \brief Tests for STB 34.101.31 (belt)
 \project bee2/test
 \created 2012.06.20
-\version 2020.04.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
+#include <bee2/core/str.h>
 #include <bee2/core/u32.h>
 #include <bee2/core/util.h>
 #include <bee2/core/word.h>
@@ -117,13 +120,16 @@ static bool_t beltZerosumTest()
 	и из приложения Б к СТБ 34.101.47.
 -#	Номера тестов соответствуют номерам таблиц приложений.
 -#	Дополнительно выполняется тест Zerosum.
+-#	Тесты повторяются для реализации belt-block без таблиц
+	(если она поддерживается платформой).
 *******************************************************************************
 */
 
-bool_t beltTest()
+static bool_t beltTestImpl()
 {
 	octet buf[128];
 	octet buf1[128];
+	octet blocks[16 * 71];
 	octet mac[8];
 	octet mac1[8];
 	octet hash[32];
@@ -185,6 +191,46 @@ bool_t beltTest()
 	u32To(buf, 16, block);
 	if (!memEq(buf, beltH(), 16))
 		return FALSE;
+	// belt-block: несколько блоков
+	memCopy(buf, beltH(), 128);
+	beltBlockEncrN(buf, 8, key);
+	for (count = 0; count < 8; ++count)
+	{
+		memCopy(buf1 + 16 * count, beltH() + 16 * count, 16);
+		beltBlockEncr(buf1 + 16 * count, key);
+	}
+	if (!memEq(buf, buf1, 128))
+		return FALSE;
+	beltBlockDecrN(buf, 7, key);
+	beltBlockDecr(buf + 112, key);
+	if (!memEq(buf, beltH(), 128))
+		return FALSE;
+	// belt-block: пакеты блоков
+	for (count = 0; count < sizeof(blocks); count += 16)
+		memCopy(blocks + count, beltH() + count % 256, 16);
+	beltBlockEncrN(blocks, 71, key);
+	for (count = 0; count < sizeof(blocks); count += 16)
+	{
+		memCopy(buf, beltH() + count % 256, 16);
+		beltBlockEncr(buf, key);
+		if (!memEq(blocks + count, buf, 16))
+			return FALSE;
+	}
+	beltBlockDecrN(blocks, 71, key);
+	for (count = 0; count < sizeof(blocks); count += 16)
+		if (!memEq(blocks + count, beltH() + count % 256, 16))
+			return FALSE;
+	memSetZero(blocks, sizeof(blocks));
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCTRStepE(blocks, sizeof(blocks), state);
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	for (count = 0; count < sizeof(blocks); count += 16)
+	{
+		memSetZero(buf, 16);
+		beltCTRStepE(buf, 16, state);
+		if (!memEq(blocks + count, buf, 16))
+			return FALSE;
+	}
 	// belt-block: тест A.4
 	memCopy(buf, beltH() + 64, 16);
 	beltKeyExpand2(key, beltH() + 128 + 32, 32);
@@ -425,6 +471,120 @@ bool_t beltTest()
 		beltH() + 192 + 16);
 	if (!memEq(buf, buf1, 44))
 		return FALSE;
+	// belt-ecb, belt-cfb, belt-ctr: длинные сообщения
+	memCopy(buf, beltH(), 128);
+	beltECBStart(state, beltH() + 128, 32);
+	beltECBStepE(buf, 128, state);
+	memCopy(buf1, beltH(), 128);
+	for (count = 0; count < 128; count += 16)
+		beltECBStepE(buf1 + count, 16, state);
+	if (!memEq(buf, buf1, 128))
+		return FALSE;
+	beltECBStepD(buf, 128, state);
+	if (!memEq(buf, beltH(), 128))
+		return FALSE;
+	memCopy(buf, beltH(), 128);
+	beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCFBStepE(buf, 128, state);
+	beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCFBStepD(buf, 13, state);
+	beltCFBStepD(buf + 13, 128 - 13, state);
+	if (!memEq(buf, beltH(), 128))
+		return FALSE;
+	memCopy(buf, beltH(), 128);
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCTRStepE(buf, 128, state);
+	memCopy(buf1, beltH(), 128);
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	for (count = 0; count < 128; count += 16)
+		beltCTRStepE(buf1 + count, 16, state);
+	if (!memEq(buf, buf1, 128))
+		return FALSE;
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCTRStepD(buf, 5, state);
+	beltCTRStepD(buf + 5, 128 - 5, state);
+	if (!memEq(buf, beltH(), 128))
+		return FALSE;
+	// belt-ctr: позиционирование
+	memCopy(buf, beltH(), 128);
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCTRStepE(buf, 128, state);
+	beltCTRSeek(state, 37);
+	memCopy(buf1, buf + 37, 50);
+	beltCTRStepD(buf1, 50, state);
+	if (!memEq(buf1, beltH() + 37, 50))
+		return FALSE;
+	beltCTRSeek(state, 96);
+	memCopy(buf1, buf + 96, 32);
+	beltCTRStepD(buf1, 32, state);
+	beltCTRSeek(state, 0);
+	beltCTRStepD(buf, 3, state);
+	if (!memEq(buf1, beltH() + 96, 32) || !memEq(buf, beltH(), 3))
+		return FALSE;
+	// belt-ctr: параллельное шифрование
+	{
+		const size_t len = ((size_t)1 << 20) + 37;
+		octet* big = (octet*)blobCreate(2 * len);
+		if (!big)
+			return FALSE;
+		for (count = 0; count < len; ++count)
+			big[count] = beltH()[count % 256];
+		memCopy(big + len, big, len);
+		beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCTRStepE(big, 5, state);
+		beltCTRStepE(big + 5, len - 5 - 16, state);
+		beltCTRStepE(big + len - 16, 16, state);
+		beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCTRStepEMulti(big + len, 5, state);
+		beltCTRStepEMulti(big + len + 5, len - 5 - 16, state);
+		beltCTRStepE(big + 2 * len - 16, 16, state);
+		if (!memEq(big, big + len, len))
+		{
+			blobClose(big);
+			return FALSE;
+		}
+		beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCTRStepDMulti(big, len, state);
+		for (count = 0; count < len; ++count)
+			if (big[count] != beltH()[count % 256])
+				break;
+		if (count != len)
+		{
+			blobClose(big);
+			return FALSE;
+		}
+		// belt-cbc, belt-cfb: параллельное расшифрование
+		beltCBCStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCBCStepE(big, len, state);
+		memCopy(big + len, big, len);
+		beltCBCStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCBCStepD(big, 64, state);
+		beltCBCStepDMulti(big + 64, len - 64, state);
+		beltCBCStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCBCStepD(big + len, len, state);
+		if (!memEq(big, big + len, len) || big[len - 1] !=
+			beltH()[(len - 1) % 256])
+		{
+			blobClose(big);
+			return FALSE;
+		}
+		beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCFBStepE(big, len, state);
+		memCopy(big + len, big, len);
+		beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCFBStepD(big, 7, state);
+		beltCFBStepDMulti(big + 7, len - 7 - 16, state);
+		beltCFBStepD(big + len - 16, 16, state);
+		beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+		beltCFBStepD(big + len, len, state);
+		if (!memEq(big, big + len, len) || big[len - 1] !=
+			beltH()[(len - 1) % 256])
+		{
+			blobClose(big);
+			return FALSE;
+		}
+		blobClose(big);
+	}
 	// belt-mac: тест A.17-1
 	beltMACStart(state, beltH() + 128, 32);
 	beltMACStepA(beltH(), 13, state);
@@ -538,6 +698,216 @@ bool_t beltTest()
 		beltH() + 128 + 32, 32, beltH() + 192 + 16);
 	if (!memEq(buf1, beltH() + 64, 20) || !memEq(mac, mac1, 8))
 		return FALSE;
+	// belt-dwp, belt-che: длинные сообщения
+	beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+	beltDWPStepI(beltH(), 128 + 5, state);
+	beltDWPStepA(beltH() + 7, 121, state);
+	beltDWPStepG(mac, state);
+	beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+	for (count = 0; count < 128 + 5; count += 19)
+		beltDWPStepI(beltH() + count, MIN2(19, 128 + 5 - count), state);
+	for (count = 0; count < 121; count += 16)
+		beltDWPStepA(beltH() + 7 + count, MIN2(16, 121 - count), state);
+	if (!beltDWPStepV(mac, state))
+		return FALSE;
+	beltCHEStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCHEStepI(beltH(), 128 + 5, state);
+	beltCHEStepA(beltH() + 7, 121, state);
+	beltCHEStepG(mac, state);
+	beltCHEStart(state, beltH() + 128, 32, beltH() + 192);
+	for (count = 0; count < 128 + 5; count += 19)
+		beltCHEStepI(beltH() + count, MIN2(19, 128 + 5 - count), state);
+	for (count = 0; count < 121; count += 16)
+		beltCHEStepA(beltH() + 7 + count, MIN2(16, 121 - count), state);
+	if (!beltCHEStepV(mac, state))
+		return FALSE;
+	memCopy(buf, beltH(), 128);
+	beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+	beltDWPStepI(beltH() + 128, 16, state);
+	beltDWPStepE(buf, 128, state);
+	beltDWPStepA(buf, 128, state);
+	beltDWPStepG(mac, state);
+	memCopy(buf1, beltH(), 128);
+	beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+	beltDWPStepI(beltH() + 128, 16, state);
+	beltDWPStepEA(buf1, 5, state);
+	beltDWPStepEA(buf1 + 5, 128 - 5, state);
+	if (!memEq(buf, buf1, 128) || !beltDWPStepV(mac, state))
+		return FALSE;
+	memCopy(buf, beltH(), 128);
+	beltCHEStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCHEStepI(beltH() + 128, 16, state);
+	beltCHEStepE(buf, 128, state);
+	beltCHEStepA(buf, 128, state);
+	beltCHEStepG(mac, state);
+	memCopy(buf1, beltH(), 128);
+	beltCHEStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCHEStepI(beltH() + 128, 16, state);
+	beltCHEStepEA(buf1, 5, state);
+	beltCHEStepEA(buf1 + 5, 128 - 5, state);
+	if (!memEq(buf, buf1, 128) || !beltCHEStepV(mac, state))
+		return FALSE;
+	// объект ключа
+	ASSERT(sizeof(state) >= 2 * beltKey_keep() + beltDWP_keep());
+	beltKeyStart(state + 512, beltH() + 128, 32);
+	memCopy(buf, beltH(), 48);
+	beltECBStartK(state, state + 512);
+	beltECBStepE(buf, 48, state);
+	if (!hexEq(buf,
+		"69CCA1C93557C9E3D66BC3E0FA88FA6E"
+		"5F23102EF109710775017F73806DA9DC"
+		"46FB2ED2CE771F26DCB5E5D1569F9AB0"))
+		return FALSE;
+	memCopy(buf, beltH(), 128);
+	memCopy(buf1, beltH(), 128);
+	beltCTRStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCTRStepE(buf, 128, state);
+	beltCTRStartK(state, state + 512, beltH() + 192);
+	beltCTRStepE(buf1, 128, state);
+	if (!memEq(buf, buf1, 128))
+		return FALSE;
+	beltCBCStartK(state, state + 512, beltH() + 192);
+	beltCBCStepE(buf1, 128, state);
+	beltCBCStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCBCStepD(buf1, 128, state);
+	beltCFBStartK(state, state + 512, beltH() + 192);
+	beltCFBStepE(buf1, 128, state);
+	beltCFBStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCFBStepD(buf1, 128, state);
+	if (!memEq(buf, buf1, 128))
+		return FALSE;
+	beltMACStart(state, beltH() + 128, 32);
+	beltMACStepA(buf, 128, state);
+	beltMACStepG(mac, state);
+	beltMACStartK(state, state + 512);
+	beltMACStepA(buf, 128, state);
+	if (!beltMACStepV(mac, state))
+		return FALSE;
+	beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+	beltDWPStepI(beltH(), 37, state);
+	beltDWPStepEA(buf1, 128, state);
+	beltDWPStepG(mac, state);
+	beltDWPStartK(state, state + 512, beltH() + 192);
+	beltDWPStepI(beltH(), 37, state);
+	beltDWPStepA(buf1, 128, state);
+	if (!beltDWPStepV(mac, state))
+		return FALSE;
+	beltCHEStart(state, beltH() + 128, 32, beltH() + 192);
+	beltCHEStepI(beltH(), 37, state);
+	beltCHEStepA(buf, 128, state);
+	beltCHEStepG(mac, state);
+	beltCHEStartK(state, state + 512, beltH() + 192);
+	beltCHEStepI(beltH(), 37, state);
+	beltCHEStepA(buf, 128, state);
+	if (!beltCHEStepV(mac, state))
+		return FALSE;
+	// списки фрагментов
+	{
+		mem_vec_t vec[4];
+		vec[0].buf = beltH(), vec[0].count = 7;
+		vec[1].buf = beltH() + 7, vec[1].count = 0;
+		vec[2].buf = beltH() + 7, vec[2].count = 41;
+		vec[3].buf = beltH() + 48, vec[3].count = 80;
+		beltMACStart(state, beltH() + 128, 32);
+		beltMACStepAv(vec, 4, state);
+		beltMACStepG(mac, state);
+		beltMAC(mac1, beltH(), 128, beltH() + 128, 32);
+		if (!memEq(mac, mac1, 8))
+			return FALSE;
+		beltHashStart(state);
+		beltHashStepHv(vec, 4, state);
+		beltHashStepG(hash, state);
+		beltHash(hash1, beltH(), 128);
+		if (!memEq(hash, hash1, 32))
+			return FALSE;
+		beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+		beltDWPStepIv(vec, 2, state);
+		beltDWPStepAv(vec + 2, 2, state);
+		beltDWPStepG(mac, state);
+		beltDWPStart(state, beltH() + 128, 32, beltH() + 192);
+		beltDWPStepI(beltH(), 7, state);
+		beltDWPStepA(beltH() + 7, 121, state);
+		if (!beltDWPStepV(mac, state))
+			return FALSE;
+	}
+	// belt-mac: несколько сообщений
+	{
+		const size_t lens[9] = { 0, 1, 15, 16, 17, 32, 33, 100, 250 };
+		const void* src[9];
+		const octet* key[9];
+		octet macs[9 * 8];
+		for (count = 0; count < 9; ++count)
+			src[count] = beltH() + count,
+			key[count] = beltH() + 128 + 16 * (count % 3);
+		if (beltMACMulti(macs, 9, src, lens, key, 32) != ERR_OK)
+			return FALSE;
+		for (count = 0; count < 9; ++count)
+		{
+			beltMAC(mac, src[count], lens[count], key[count], 32);
+			if (!memEq(mac, macs + 8 * count, 8))
+				return FALSE;
+		}
+		if (beltMACMulti(macs, 5, src + 4, lens + 4, key, 24) != ERR_OK)
+			return FALSE;
+		for (count = 4; count < 9; ++count)
+		{
+			beltMAC(mac, src[count], lens[count], key[count - 4], 24);
+			if (!memEq(mac, macs + 8 * (count - 4), 8))
+				return FALSE;
+		}
+	}
+	// belt-hash: несколько сообщений
+	{
+		const size_t lens[9] = { 0, 1, 31, 32, 33, 64, 100, 128, 250 };
+		const void* src[9];
+		octet hashes[9 * 32];
+		for (count = 0; count < 9; ++count)
+			src[count] = beltH() + count;
+		if (beltHashMulti(hashes, 9, src, lens) != ERR_OK)
+			return FALSE;
+		for (count = 0; count < 9; ++count)
+		{
+			beltHash(hash, src[count], lens[count]);
+			if (!memEq(hash, hashes + 32 * count, 32))
+				return FALSE;
+		}
+	}
+	// belt-pbkdf: несколько ключей
+	{
+		const size_t pwd_len[6] = { 0, 3, 32, 33, 64, 3 };
+		const size_t salt_len[6] = { 8, 8, 0, 16, 8, 40 };
+		const octet* pwd[6];
+		const octet* salt[6];
+		octet keys[6 * 32];
+		size_t i;
+		for (count = 0; count < 6; ++count)
+			pwd[count] = beltH() + count, salt[count] = beltH() + 64 + count;
+		if (beltPBKDF2Multi(keys, 6, pwd, pwd_len, 100, salt, salt_len) !=
+				ERR_OK)
+			return FALSE;
+		for (count = 0; count < 6; ++count)
+		{
+			// эталон: непосредственное вычисление HMAC
+			octet t[32];
+			beltHMACStart(state, pwd[count], pwd_len[count]);
+			beltHMACStepA(salt[count], salt_len[count], state);
+			memSetZero(t, 4), t[3] = 1;
+			beltHMACStepA(t, 4, state);
+			beltHMACStepG(t, state);
+			memCopy(hash, t, 32);
+			for (i = 1; i < 100; ++i)
+			{
+				beltHMAC(t, t, 32, pwd[count], pwd_len[count]);
+				memXor2(hash, t, 32);
+			}
+			if (!memEq(hash, keys + 32 * count, 32))
+				return FALSE;
+			beltPBKDF2(t, pwd[count], pwd_len[count], 100, salt[count],
+				salt_len[count]);
+			if (!memEq(t, hash, 32))
+				return FALSE;
+		}
+	}
 	// belt-kwp: тест A.21
 	beltKWPStart(state, beltH() + 128, 32);
 	memCopy(buf, beltH(), 32);
@@ -566,6 +936,64 @@ bool_t beltTest()
 		beltH() + 128 + 32, 32) != ERR_OK ||
 		!memEq(buf, buf1, 32))
 		return FALSE;
+	// belt-wbl: несколько широких блоков
+	beltWBLStart(state, beltH() + 128, 32);
+	for (count = 32; count <= 64; count += 16)
+	{
+		size_t len = count == 48 ? 47 : count;
+		size_t i;
+		ASSERT(17 * len <= sizeof(blocks));
+		for (i = 0; i < 17 * len; ++i)
+			blocks[i] = beltH()[i % 256] ^ (octet)(i / 256);
+		beltWBLStepEMulti(blocks, len, 17, state);
+		for (i = 0; i < 17; ++i)
+		{
+			size_t j;
+			for (j = 0; j < len; ++j)
+				buf[j] = beltH()[(len * i + j) % 256] ^
+					(octet)((len * i + j) / 256);
+			beltWBLStepE(buf, len, state);
+			if (!memEq(buf, blocks + len * i, len))
+				return FALSE;
+		}
+		beltWBLStepDMulti(blocks, len, 17, state);
+		for (i = 0; i < 17 * len; ++i)
+			if (blocks[i] != (beltH()[i % 256] ^ (octet)(i / 256)))
+				return FALSE;
+	}
+	// belt-kwp: перезащита нескольких ключей
+	{
+		octet* hdr = blocks + 17 * 48;
+		size_t i;
+		ASSERT(17 * 48 + 17 * 16 <= sizeof(blocks));
+		memCopy(hdr, beltH(), 256);
+		memCopy(hdr + 256, beltH(), 16);
+		for (i = 0; i < 17; ++i)
+			beltKWPWrap(blocks + 48 * i, beltH() + 8 * i, 32, hdr + 16 * i,
+				beltH() + 128, 32);
+		if (beltKWPRewrapMulti(blocks, blocks, 48, 17, hdr,
+			beltH() + 128, 32, beltH() + 160, 24) != ERR_OK)
+			return FALSE;
+		for (i = 0; i < 17; ++i)
+			if (beltKWPUnwrap(buf, blocks + 48 * i, 48, hdr + 16 * i,
+				beltH() + 160, 24) != ERR_OK ||
+				!memEq(buf, beltH() + 8 * i, 32))
+				return FALSE;
+		blocks[48 * 5 + 7] ^= 1;
+		if (beltKWPRewrapMulti(blocks, blocks, 48, 17, hdr,
+			beltH() + 160, 24, beltH() + 128, 32) != ERR_BAD_KEYTOKEN ||
+			!memIsZero(blocks + 48 * 5, 48))
+			return FALSE;
+		for (i = 0; i < 17; ++i)
+			if (i != 5 && (beltKWPUnwrap(buf, blocks + 48 * i, 48,
+				hdr + 16 * i, beltH() + 128, 32) != ERR_OK ||
+				!memEq(buf, beltH() + 8 * i, 32)))
+				return FALSE;
+		if (beltKWPRewrapMulti(blocks, blocks, 48, 17, 0,
+			beltH() + 128, 32, beltH() + 160, 24) != ERR_BAD_KEYTOKEN ||
+			!memIsZero(blocks, 48 * 17))
+			return FALSE;
+	}
 	// belt-hash: тест A.23-1
 	beltHashStart(state);
 	beltHashStepH(beltH(), 13, state);
@@ -601,6 +1029,19 @@ bool_t beltTest()
 	beltHash(hash1, beltH(), 48);
 	if (!memEq(hash, hash1, 32))
 		return FALSE;
+	// belt-hash: сохранение и восстановление состояния
+	beltHashStart(state);
+	beltHashStepH(beltH(), 11, state);
+	beltHashSave(buf, state);
+	memSetZero(state, beltHash_keep());
+	if (beltHashLoad(state, buf) != ERR_OK)
+		return FALSE;
+	beltHashStepH(beltH() + 11, 48 - 11, state);
+	if (!beltHashStepV(hash, state))
+		return FALSE;
+	buf[1] ^= 1;
+	if (beltHashLoad(state, buf) != ERR_BAD_FORMAT)
+		return FALSE;
 	// belt-bde: тест A.24-1
 	memCopy(buf, beltH(), 48);
 	beltBDEStart(state, beltH() + 128, 32, beltH() + 192);
@@ -665,6 +1106,49 @@ bool_t beltTest()
 	beltSDEEncr(buf, buf1, 48, beltH() + 128 + 32, 32, beltH() + 192 + 16);
 	if (!memEq(buf, beltH() + 64, 48))
 		return FALSE;
+	// belt-bde/belt-sde: несколько секторов
+	{
+		octet iv[16];
+		octet iv1[16];
+		size_t len, pos;
+		memCopy(iv, beltH() + 192, 16);
+		memSet(iv, 0xFF, 4);
+		for (len = 0; len < 2; ++len)
+		{
+			memCopy(buf, beltH(), 128);
+			if (len == 0)
+			{
+				beltBDEStart(state, beltH() + 128, 32, iv);
+				beltBDEStepEMulti(buf, 32, 4, iv, state);
+			}
+			else
+			{
+				beltSDEStart(state, beltH() + 128, 32);
+				beltSDEStepEMulti(buf, 32, 4, iv, state);
+			}
+			memCopy(iv1, iv, 16);
+			for (count = 0; count < 4; ++count)
+			{
+				memCopy(buf1 + 32 * count, beltH() + 32 * count, 32);
+				if (len == 0)
+				{
+					beltBDEStart(state + 512, beltH() + 128, 32, iv1);
+					beltBDEStepE(buf1 + 32 * count, 32, state + 512);
+				}
+				else
+					beltSDEStepE(buf1 + 32 * count, 32, iv1, state);
+				for (pos = 0; pos < 16 && ++iv1[pos] == 0; ++pos);
+			}
+			if (!memEq(buf, buf1, 128))
+				return FALSE;
+			if (len == 0)
+				beltBDEStepDMulti(buf, 32, 4, iv, state);
+			else
+				beltSDEStepDMulti(buf, 32, 4, iv, state);
+			if (!memEq(buf, beltH(), 128))
+				return FALSE;
+		}
+	}
 	// belt-fmt: тест A.26
 	{
 		u16 str[21] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,};
@@ -717,6 +1201,43 @@ bool_t beltTest()
 		if (!memEq(str, str1, 9 * 2))
 			return FALSE;
 	}
+	// belt-fmt: несколько строк
+	{
+		u16 strs[18 * 21];
+		u16 str1[21];
+		octet ivs[18 * 16];
+		const u32 mods[2] = { 10, 58 };
+		const size_t counts[2] = { 16, 21 };
+		size_t i, j;
+		for (i = 0; i < 2; ++i)
+		{
+			ASSERT(beltFMT_keep(mods[i], counts[i]) <= sizeof(state));
+			for (j = 0; j < 18 * counts[i]; ++j)
+				strs[j] = (u16)(beltH()[j % 256] % mods[i]);
+			for (j = 0; j < sizeof(ivs); ++j)
+				ivs[j] = beltH()[(j + 7 * i) % 256];
+			beltFMTStart(state, mods[i], counts[i], beltH() + 128, 32);
+			beltFMTStepEMulti(strs, 18, ivs, state);
+			for (j = 0; j < 18; ++j)
+			{
+				for (count = 0; count < counts[i]; ++count)
+					str1[count] = (u16)
+						(beltH()[(counts[i] * j + count) % 256] % mods[i]);
+				beltFMTStepE(str1, ivs + 16 * j, state);
+				if (!memEq(str1, strs + counts[i] * j, 2 * counts[i]))
+					return FALSE;
+			}
+			beltFMTStepDMulti(strs, 18, ivs, state);
+			for (j = 0; j < 18 * counts[i]; ++j)
+				if (strs[j] != beltH()[j % 256] % mods[i])
+					return FALSE;
+			beltFMTStepEMulti(strs, 3, 0, state);
+			beltFMTStepDMulti(strs, 3, 0, state);
+			for (j = 0; j < 3 * counts[i]; ++j)
+				if (strs[j] != beltH()[j % 256] % mods[i])
+					return FALSE;
+		}
+	}
 	// belt-keyrep: тест A.28-1
 	memSetZero(level, 12);
 	level[0] = 1;
@@ -746,6 +1267,14 @@ bool_t beltTest()
 	beltKRP(buf1, 32, beltH() + 128, 32, level, beltH() + 32);
 	if (!memEq(buf, buf1, 32))
 		return FALSE;
+	// belt-krp: несколько ключей
+	beltKRPStepGMulti(buf1, 16, beltH(), 7, state);
+	for (count = 0; count < 7; ++count)
+	{
+		beltKRPStepG(buf, 16, beltH() + 16 * count, state);
+		if (!memEq(buf, buf1 + 16 * count, 16))
+			return FALSE;
+	}
 	// belt-hmac: тест Б.1-1
 	beltHMACStart(state, beltH() + 128, 29);
 	beltHMACStepA(beltH() + 128 + 64, 32, state);
@@ -782,9 +1311,40 @@ bool_t beltTest()
 	beltHMAC(hash1, beltH() + 128 + 64, 32, beltH() + 128, 42);
 	if (!memEq(hash, hash1, 32))
 		return FALSE;
+	// belt-hmac: объект ключа
+	ASSERT(beltHMAC_keep() + beltHMACKey_keep() <= sizeof(state));
+	for (count = 29; count <= 42; count += 13)
+	{
+		beltHMACKeyStart(state + beltHMAC_keep(), beltH() + 128, count);
+		beltHMACStartK(state, state + beltHMAC_keep());
+		beltHMACStepA(beltH() + 128 + 64, 32, state);
+		beltHMACStepG(hash, state);
+		beltHMAC(hash1, beltH() + 128 + 64, 32, beltH() + 128, count);
+		if (!memEq(hash, hash1, 32))
+			return FALSE;
+		beltHMACStartK(state, state + beltHMAC_keep());
+		beltHMACStepA(beltH() + 128 + 64, 17, state);
+		if (beltHMACStepV(hash, state))
+			return FALSE;
+	}
 	// zerosum
 	if (!beltZerosumTest())
 		return FALSE;
 	// все нормально
 	return TRUE;
 }
+
+bool_t beltTest()
+{
+	bool_t ret;
+	// табличная реализация
+	if (!strEq(beltPlatform(), "BELT_TABLE") || !beltTestImpl())
+		return FALSE;
+	// реализация без таблиц
+	if (!beltBlockCT(TRUE))
+		return TRUE;
+	ret = (strEq(beltPlatform(), "BELT_SSSE3") ||
+		strEq(beltPlatform(), "BELT_AVX512")) && beltTestImpl();
+	beltBlockCT(FALSE);
+	return ret;
+}
@@ -0,0 +1,266 @@
+/*
+*******************************************************************************
+\file bign_bench.c
+\brief Benchmarks for STB 34.101.45 (bign)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bign.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Для каждого уровня стойкости l = 128, 192, 256 измеряется скорость
+генерации ключей (поштучно и пакетами из BIGN_BENCH_WRAP пар,
+bignGenKeypairBatch(), единица -- пара), выработки (bignSign(), bignSign2()) и проверки подписи,
+построения общего ключа (bignDH()), создания и разбора токена ключа
+(bignKeyWrap(), bignKeyUnwrap()), а также пакетного построения общих
+ключей и создания токенов для BIGN_BENCH_WRAP сторон (bignDHBatch(),
+bignKeyWrapBatch(), единица -- ключ / токен).
+Проверка открытых ключей измеряется поштучно (bignValPubkey()) и пакетами
+из BIGN_BENCH_WRAP ключей (bignValPubkeyBatch(), единица -- ключ).
+Выработка и проверка подписи дополнительно измеряются при отключенном
+кэше контекстов (см. bignCtxCacheSetMax()).
+*******************************************************************************
+*/
+
+#define BIGN_BENCH_WRAP 16
+
+typedef struct
+{
+	bign_params params[1];	/*!< долговременные параметры */
+	octet combo_state[256];	/*!< состояние генератора */
+	octet oid_der[16];		/*!< DER-код идентификатора хэш-алгоритма */
+	size_t oid_len;			/*!< длина oid_der */
+	octet privkey[64];		/*!< личный ключ */
+	octet pubkey[128];		/*!< открытый ключ */
+	octet hash[64];			/*!< хэш-значение */
+	octet sig[96];			/*!< подпись */
+	octet key[32];			/*!< общий / транспортируемый ключ */
+	octet token[32 + 16 + 64];	/*!< токен ключа */
+	octet pubkeys[BIGN_BENCH_WRAP * 128];	/*!< ключи получателей */
+	octet tokens[BIGN_BENCH_WRAP * (32 + 16 + 64)];	/*!< токены ключа */
+	octet keys[BIGN_BENCH_WRAP * 32];	/*!< общие ключи */
+	octet gen_privkeys[BIGN_BENCH_WRAP * 64];	/*!< личные ключи пакета */
+	octet gen_pubkeys[BIGN_BENCH_WRAP * 128];	/*!< открытые ключи пакета */
+	octet valid[(BIGN_BENCH_WRAP + 7) / 8];	/*!< результаты проверки */
+	err_t code;				/*!< код ошибки */
+} bign_bench_st;
+
+static void bignBenchSetCode(bign_bench_st* b, err_t code)
+{
+	if (b->code == ERR_OK)
+		b->code = code;
+}
+
+static void bignBenchGen(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignGenKeypair(b->privkey, b->pubkey, b->params,
+			prngCOMBOStepR, b->combo_state));
+}
+
+static void bignBenchGenBatch(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignGenKeypairBatch(b->gen_privkeys,
+			b->gen_pubkeys, b->params, BIGN_BENCH_WRAP, prngCOMBOStepR,
+			b->combo_state));
+}
+
+static void bignBenchSign(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignSign(b->sig, b->params, b->oid_der,
+			b->oid_len, b->hash, b->privkey, prngCOMBOStepR, b->combo_state));
+}
+
+static void bignBenchSign2(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignSign2(b->sig, b->params, b->oid_der,
+			b->oid_len, b->hash, b->privkey, 0, 0));
+}
+
+static void bignBenchVerify(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignVerify(b->params, b->oid_der, b->oid_len,
+			b->hash, b->sig, b->pubkey));
+}
+
+static void bignBenchDH(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignDH(b->key, b->params, b->privkey, b->pubkey,
+			32));
+}
+
+static void bignBenchDHBatch(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignDHBatch(b->keys, b->params, b->privkey,
+			BIGN_BENCH_WRAP, b->pubkeys, 32));
+}
+
+static void bignBenchKeyWrap(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignKeyWrap(b->token, b->params, b->key, 32, 0,
+			b->pubkey, prngCOMBOStepR, b->combo_state));
+}
+
+static void bignBenchKeyWrapBatch(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignKeyWrapBatch(b->tokens, b->params, b->key,
+			32, 0, BIGN_BENCH_WRAP, b->pubkeys, prngCOMBOStepR,
+			b->combo_state));
+}
+
+static void bignBenchValPubkey(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignValPubkey(b->params, b->pubkey));
+}
+
+static void bignBenchValPubkeyBatch(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignValPubkeyBatch(b->valid, b->params,
+			BIGN_BENCH_WRAP, b->pubkeys));
+}
+
+static void bignBenchKeyUnwrap(void* arg, size_t reps)
+{
+	bign_bench_st* b = (bign_bench_st*)arg;
+	while (reps--)
+		bignBenchSetCode(b, bignKeyUnwrap(b->key, b->params, b->token,
+			32 + 16 + b->params->l / 4, 0, b->privkey));
+}
+
+bool_t bignBench()
+{
+	static const struct
+	{
+		const char* params;
+		const char* gen;
+		const char* gen_batch;
+		const char* sign;
+		const char* sign2;
+		const char* verify;
+		const char* dh;
+		const char* dh_batch;
+		const char* wrap;
+		const char* wrap_batch;
+		const char* unwrap;
+		const char* val;
+		const char* val_batch;
+		const char* sign_nc;
+		const char* verify_nc;
+	} levels[] =
+	{
+		{
+			"1.2.112.0.2.0.34.101.45.3.1",
+			"bignBench::gen[128]", "bignBench::gen-batch[128]",
+			"bignBench::sign[128]", "bignBench::sign2[128]",
+			"bignBench::verify[128]", "bignBench::dh[128]",
+			"bignBench::dh-batch[128]", "bignBench::keywrap[128]",
+			"bignBench::keywrap-batch[128]", "bignBench::keyunwrap[128]",
+			"bignBench::val-pubkey[128]", "bignBench::val-pubkey-batch[128]",
+			"bignBench::sign-nocache[128]", "bignBench::verify-nocache[128]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.2",
+			"bignBench::gen[192]", "bignBench::gen-batch[192]",
+			"bignBench::sign[192]", "bignBench::sign2[192]",
+			"bignBench::verify[192]", "bignBench::dh[192]",
+			"bignBench::dh-batch[192]", "bignBench::keywrap[192]",
+			"bignBench::keywrap-batch[192]", "bignBench::keyunwrap[192]",
+			"bignBench::val-pubkey[192]", "bignBench::val-pubkey-batch[192]",
+			"bignBench::sign-nocache[192]", "bignBench::verify-nocache[192]",
+		},
+		{
+			"1.2.112.0.2.0.34.101.45.3.3",
+			"bignBench::gen[256]", "bignBench::gen-batch[256]",
+			"bignBench::sign[256]", "bignBench::sign2[256]",
+			"bignBench::verify[256]", "bignBench::dh[256]",
+			"bignBench::dh-batch[256]", "bignBench::keywrap[256]",
+			"bignBench::keywrap-batch[256]", "bignBench::keyunwrap[256]",
+			"bignBench::val-pubkey[256]", "bignBench::val-pubkey-batch[256]",
+			"bignBench::sign-nocache[256]", "bignBench::verify-nocache[256]",
+		},
+	};
+	bign_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i, j;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->hash, sizeof(b->hash), b->combo_state);
+	b->oid_len = sizeof(b->oid_der);
+	if (bignOidToDER(b->oid_der, &b->oid_len,
+		"1.2.112.0.2.0.34.101.31.81") != ERR_OK)
+		return FALSE;
+	// цикл по уровням стойкости
+	for (i = 0; i < COUNT_OF(levels); ++i)
+	{
+		b->code = ERR_OK;
+		if (bignStdParams(b->params, levels[i].params) != ERR_OK ||
+			bignGenKeypair(b->privkey, b->pubkey, b->params,
+				prngCOMBOStepR, b->combo_state) != ERR_OK ||
+			bignSign2(b->sig, b->params, b->oid_der, b->oid_len, b->hash,
+				b->privkey, 0, 0) != ERR_OK ||
+			bignKeyWrap(b->token, b->params, b->key, 32, 0, b->pubkey,
+				prngCOMBOStepR, b->combo_state) != ERR_OK)
+			return FALSE;
+		for (j = 0; j < BIGN_BENCH_WRAP; ++j)
+			memCopy(b->pubkeys + j * b->params->l / 2, b->pubkey,
+				b->params->l / 2);
+		ret &= benchDo(levels[i].sign, "op", 1, bignBenchSign, b);
+		ret &= benchDo(levels[i].sign2, "op", 1, bignBenchSign2, b);
+		ret &= benchDo(levels[i].verify, "op", 1, bignBenchVerify, b);
+		ret &= benchDo(levels[i].dh, "op", 1, bignBenchDH, b);
+		ret &= benchDo(levels[i].dh_batch, "key", BIGN_BENCH_WRAP,
+			bignBenchDHBatch, b);
+		ret &= benchDo(levels[i].wrap, "op", 1, bignBenchKeyWrap, b);
+		ret &= benchDo(levels[i].wrap_batch, "token", BIGN_BENCH_WRAP,
+			bignBenchKeyWrapBatch, b);
+		ret &= benchDo(levels[i].unwrap, "op", 1, bignBenchKeyUnwrap, b);
+		ret &= benchDo(levels[i].val, "op", 1, bignBenchValPubkey, b);
+		ret &= benchDo(levels[i].val_batch, "key", BIGN_BENCH_WRAP,
+			bignBenchValPubkeyBatch, b);
+		ret &= benchDo(levels[i].gen, "op", 1, bignBenchGen, b);
+		ret &= benchDo(levels[i].gen_batch, "pair", BIGN_BENCH_WRAP,
+			bignBenchGenBatch, b);
+		// без кэша контекстов
+		ret &= bignCtxCacheSetMax(0);
+		ret &= benchDo(levels[i].sign_nc, "op", 1, bignBenchSign, b);
+		ret &= benchDo(levels[i].verify_nc, "op", 1, bignBenchVerify, b);
+		ret &= bignCtxCacheSetMax(BIGN_CTX_CACHE_DEFAULT);
+		ret &= b->code == ERR_OK;
+	}
+	return ret;
+}
@@ -4,21 +4,30 @@
 \brief Tests for STB 34.101.45 (bign)
 \project bee2/test
 \created 2012.08.27
-\version 2020.11.25
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/mt.h>
+#include <bee2/core/obj.h>
 #include <bee2/core/hex.h>
+#include <bee2/core/prng.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
+#include <bee2/math/ecp.h>
+#include <bee2/math/gfp.h>
 #include <bee2/math/ww.h>
+#include <bee2/math/zm.h>
 #include <bee2/math/zz.h>
 #include <bee2/crypto/bign.h>
 #include <bee2/crypto/belt.h>
 #include <bee2/crypto/brng.h>
+#include <crypto/bign_lcl.h>
 
 /*
 *******************************************************************************
@@ -78,6 +87,333 @@ static void brngCTRXStepR(void* buf, size_t count, void* stack)
 	brngCTRStepR(buf, count, s->state_ex);
 }
 
+/*
+*******************************************************************************
+Готовые таблицы предвычислений
+
+Для стандартных кривых контекст ссылается на готовую таблицу гребенчатого
+метода (см. bign_pre.c). Функция bignTestStdPreTable() заново строит 
+таблицу так, как она была построена при подготовке bign_pre.c: поле 
+с редукцией Крэндалла, кривая в якобиановых координатах, функция 
+ecCombPrecA() с шириной гребня 6. Построенная таблица сравнивается 
+с готовой.
+
+Дополнительно проверяется, что открытые ключи, рассчитанные в контексте
+(с таблицей), совпадают с ключами, рассчитанными функцией bignGenKeypair()
+без таблицы. Чтобы bignGenKeypair() не взяла ту же таблицу из кэша 
+контекстов, кэш на время теста отключается. Личные ключи случайны, 
+поэтому в расчетах участвуют все точки таблицы.
+*******************************************************************************
+*/
+
+static bool_t bignTestStdPreTable(const bign_params* params)
+{
+	const size_t no = O_OF_B(2 * params->l);
+	const size_t n = W_OF_B(2 * params->l);
+	const size_t f_keep = gfpCreate_keep(no);
+	const size_t f_deep = gfpCreate_deep(no);
+	const size_t ec_keep = ecpCreateJ_keep(n);
+	const size_t ec_deep = ecpCreateJ_deep(n, f_deep);
+	const size_t pre_keep = ecCombPrecA_keep(n, 6);
+	const word* std_pre = bignStdPre(params->l);
+	void* state;
+	qr_o* f;
+	ec_o* ec;
+	word* pre;
+	void* stack;
+	bool_t ok;
+	// таблицы нет (LEAN_ENABLED или big-endian)?
+	if (!std_pre)
+		return TRUE;
+	// раскладка состояния
+	state = blobCreate(f_keep + ec_keep + pre_keep +
+		utilMax(4,
+			f_deep,
+			ec_deep,
+			ecCreateGroup_deep(f_deep),
+			ecCombPrecA_deep(n, 3, ec_deep)));
+	if (!state)
+		return FALSE;
+	f = (qr_o*)state;
+	ec = (ec_o*)((octet*)f + f_keep);
+	pre = (word*)((octet*)ec + ec_keep);
+	stack = (octet*)pre + pre_keep;
+	// построить таблицу и сравнить с готовой
+	ok = zmCreateRed(f, params->p, no, ZM_RED_CRAND, stack) &&
+		ecpCreateJ(ec, f, params->a, params->b, stack) &&
+		ecCreateGroup(ec, 0, params->yG, params->q, no, 1, stack) &&
+		ecCombPrecA(pre, ec->base, ec, 6, stack) &&
+		memEq(pre, std_pre, pre_keep);
+	blobClose(state);
+	return ok;
+}
+
+static bool_t bignTestStdPre()
+{
+	static const char* const names[] =
+	{
+		"1.2.112.0.2.0.34.101.45.3.1",
+		"1.2.112.0.2.0.34.101.45.3.2",
+		"1.2.112.0.2.0.34.101.45.3.3",
+	};
+	bign_params params[1];
+	octet combo_state[256];
+	octet privkey[64];
+	octet pubkey[128];
+	octet pubkey1[128];
+	void* ctx;
+	size_t i, j;
+	bool_t ok = TRUE;
+	// подготовить генератор
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// эталонные ключи строятся без таблиц (кэш контекстов отключен)
+	if (!bignCtxCacheSetMax(0))
+		return FALSE;
+	// цикл по кривым
+	for (i = 0; ok && i < COUNT_OF(names); ++i)
+	{
+		if (bignStdParams(params, names[i]) != ERR_OK)
+		{
+			ok = FALSE;
+			break;
+		}
+		if (!bignTestStdPreTable(params))
+		{
+			ok = FALSE;
+			break;
+		}
+		ctx = blobCreate(bignCtx_keep(params->l));
+		ok = ctx && bignCtxStart(ctx, params) == ERR_OK;
+		for (j = 0; ok && j < 16; ++j)
+			ok = bignGenKeypair(privkey, pubkey, params, prngCOMBOStepR,
+					combo_state) == ERR_OK &&
+				bignCtxCalcPubkey(pubkey1, ctx, privkey) == ERR_OK &&
+				memEq(pubkey, pubkey1, params->l / 2);
+		blobClose(ctx);
+	}
+	// восстановить размер кэша по умолчанию
+	ok &= bignCtxCacheSetMax(BIGN_CTX_CACHE_DEFAULT);
+	return ok;
+}
+
+/*
+*******************************************************************************
+Кэш контекстов
+
+Функции bignXXX() выполняются с разными размерами кэша контекстов (в том
+числе в нескольких потоках) и сравниваются с функциями bignXXX() при
+отключенном кэше. На каждом уровне стойкости используются три набора 
+параметров: стандартный, стандартный с другим seed и нестандартный 
+(с базовой точкой -G).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	bign_params params[3];		/*!< параметры */
+	size_t no;					/*!< длина элемента поля в октетах */
+	octet oid_der[16];			/*!< DER-код идентификатора хэш-алгоритма */
+	size_t oid_len;				/*!< длина oid_der */
+	octet privkey[64];			/*!< личный ключ */
+	octet pubkeys[3][128];		/*!< открытые ключи */
+	octet sigs[3][96];			/*!< подписи */
+} bign_test_cache_st;
+
+static bool_t bignTestCtxCacheRun(const bign_test_cache_st* st, size_t reps)
+{
+	octet pubkey[128];
+	octet sig[96];
+	size_t i;
+	for (i = 0; i < 3 * reps; ++i)
+	{
+		const bign_params* params = st->params + i % 3;
+		if (bignCalcPubkey(pubkey, params, st->privkey) != ERR_OK ||
+			!memEq(pubkey, st->pubkeys[i % 3], 2 * st->no) ||
+			bignSign2(sig, params, st->oid_der, st->oid_len, beltH(),
+				st->privkey, 0, 0) != ERR_OK ||
+			!memEq(sig, st->sigs[i % 3], st->no + st->no / 2) ||
+			bignVerify(params, st->oid_der, st->oid_len, beltH(), sig,
+				pubkey) != ERR_OK)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+typedef struct
+{
+	const bign_test_cache_st* st;	/*!< параметры и эталоны */
+	bool_t ok;						/*!< результат */
+} bign_test_thrd_st;
+
+static void bignTestCtxCacheThrd(void* arg)
+{
+	bign_test_thrd_st* t = (bign_test_thrd_st*)arg;
+	t->ok = bignTestCtxCacheRun(t->st, 8);
+}
+
+static bool_t bignTestCtxCacheLevel(const char* name)
+{
+	bign_test_cache_st st[1];
+	word p[W_OF_O(64)];
+	word y[W_OF_O(64)];
+	size_t no, i;
+	bool_t ok;
+	// подготовить параметры
+	if (bignStdParams(st->params, name) != ERR_OK)
+		return FALSE;
+	st->no = no = st->params->l / 4;
+	memCopy(st->params + 1, st->params, sizeof(bign_params));
+	st->params[1].seed[0] ^= 1;
+	memCopy(st->params + 2, st->params, sizeof(bign_params));
+	wwFrom(p, st->params[2].p, no);
+	wwFrom(y, st->params[2].yG, no);
+	zzSub(y, p, y, W_OF_O(no));
+	wwTo(st->params[2].yG, no, y);
+	st->oid_len = sizeof(st->oid_der);
+	if (bignOidToDER(st->oid_der, &st->oid_len,
+		"1.2.112.0.2.0.34.101.31.81") != ERR_OK)
+		return FALSE;
+	memCopy(st->privkey, beltH() + 32, no);
+	st->privkey[no - 1] = 0;
+	// эталоны без кэша
+	if (!bignCtxCacheSetMax(0))
+		return FALSE;
+	for (i = 0; i < 3; ++i)
+		if (bignCalcPubkey(st->pubkeys[i], st->params + i, st->privkey) !=
+				ERR_OK ||
+			bignSign2(st->sigs[i], st->params + i, st->oid_der, st->oid_len,
+				beltH(), st->privkey, 0, 0) != ERR_OK)
+			return FALSE;
+	if (!memEq(st->pubkeys[0], st->pubkeys[1], 2 * no) ||
+		memEq(st->pubkeys[0], st->pubkeys[2], 2 * no))
+		return FALSE;
+	// кэш достаточного размера, очистка, вытеснение
+	ok = bignCtxCacheSetMax(BIGN_CTX_CACHE_MAX) &&
+		bignTestCtxCacheRun(st, 3);
+	bignCtxCacheFlush();
+	ok = ok && bignTestCtxCacheRun(st, 2) &&
+		bignCtxCacheSetMax(1) && bignTestCtxCacheRun(st, 3) &&
+		bignCtxCacheSetMax(2) && bignTestCtxCacheRun(st, 3);
+	// несколько потоков, вытеснение
+	if (ok)
+	{
+		bign_test_thrd_st args[4];
+		mt_thrd_t thrd[4];
+		bool_t created[4];
+		for (i = 0; i < 4; ++i)
+		{
+			args[i].st = st, args[i].ok = FALSE;
+			if (!(created[i] = mtThrdCreate(thrd + i, bignTestCtxCacheThrd,
+				args + i)))
+				bignTestCtxCacheThrd(args + i);
+		}
+		for (i = 0; i < 4; ++i)
+			if (created[i])
+				mtThrdJoin(thrd + i);
+		for (i = 0; i < 4; ++i)
+			ok &= args[i].ok;
+	}
+	return ok;
+}
+
+static bool_t bignTestCtxCache()
+{
+	bool_t ok;
+	// недопустимый размер
+	if (bignCtxCacheSetMax(BIGN_CTX_CACHE_MAX + 1))
+		return FALSE;
+	// уровни стойкости
+	ok = bignTestCtxCacheLevel("1.2.112.0.2.0.34.101.45.3.1") &&
+		bignTestCtxCacheLevel("1.2.112.0.2.0.34.101.45.3.2") &&
+		bignTestCtxCacheLevel("1.2.112.0.2.0.34.101.45.3.3");
+	// восстановить размер по умолчанию
+	ok &= bignCtxCacheSetMax(BIGN_CTX_CACHE_DEFAULT);
+	return ok;
+}
+
+/*
+*******************************************************************************
+Конверты
+
+Данные из 3 * 16 + 5 октетов упаковываются в конверт с фрагментами длины
+16. Фрагменты распаковываются в обратном порядке. Проверяется, что
+обнаруживаются перестановка фрагментов, усечение конверта (ложный признак
+последнего фрагмента) и искажение описания. Дополнительно проверяется
+конверт с данными, длина которых кратна длине фрагмента.
+*******************************************************************************
+*/
+
+static bool_t bignTestEnv()
+{
+	bign_params params[1];
+	octet combo_state[256];
+	octet privkey[32];
+	octet pubkey[64];
+	octet state[256];
+	octet head[128 / 4 + 64];
+	octet env[4 * (16 + 8)];
+	octet buf[3 * 16 + 5];
+	size_t i;
+	// подготовить ключи
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	ASSERT(bignEnv_keep() <= sizeof(state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
+		bignGenKeypair(privkey, pubkey, params, prngCOMBOStepR,
+			combo_state) != ERR_OK)
+		return FALSE;
+	// упаковать
+	if (bignEnvWrapStart(head, state, params, 0, pubkey, prngCOMBOStepR,
+			combo_state) != ERR_BAD_INPUT ||
+		bignEnvWrapStart(head, state, params, 16, pubkey, prngCOMBOStepR,
+			combo_state) != ERR_OK ||
+		bignEnvChunk(state) != 16)
+		return FALSE;
+	for (i = 0; i < 4; ++i)
+		if (bignEnvChunkWrap(env + i * 24, beltH() + i * 16,
+				i < 3 ? 16 : 5, i, i == 3, state) != ERR_OK)
+			return FALSE;
+	if (bignEnvChunkWrap(env, beltH(), 16, 0, TRUE, state) != ERR_BAD_INPUT)
+		return FALSE;
+	// распаковать в обратном порядке
+	memSetZero(state, sizeof(state));
+	if (bignEnvUnwrapStart(state, params, head, privkey) != ERR_OK ||
+		bignEnvChunk(state) != 16)
+		return FALSE;
+	for (i = 4; i--;)
+		if (bignEnvChunkUnwrap(buf + i * 16, env + i * 24, i < 3 ? 16 : 5,
+				i, i == 3, state) != ERR_OK)
+			return FALSE;
+	if (!memEq(buf, beltH(), sizeof(buf)))
+		return FALSE;
+	// перестановка и усечение
+	if (bignEnvChunkUnwrap(buf, env + 24, 16, 0, FALSE, state) !=
+			ERR_BAD_MAC ||
+		bignEnvChunkUnwrap(buf, env + 48, 16, 2, TRUE, state) !=
+			ERR_BAD_INPUT ||
+		bignEnvChunkUnwrap(buf, env + 72, 5, 2, TRUE, state) != ERR_BAD_MAC)
+		return FALSE;
+	// искажение описания
+	head[8] ^= 1;
+	if (bignEnvUnwrapStart(state, params, head, privkey) != ERR_BAD_FORMAT)
+		return FALSE;
+	head[8] ^= 1, head[4] ^= 1;
+	if (bignEnvUnwrapStart(state, params, head, privkey) != ERR_BAD_KEYTOKEN)
+		return FALSE;
+	// длина данных кратна длине фрагмента
+	if (bignEnvWrapStart(head, state, params, 16, pubkey, prngCOMBOStepR,
+			combo_state) != ERR_OK ||
+		bignEnvChunkWrap(env, beltH(), 16, 0, FALSE, state) != ERR_OK ||
+		bignEnvChunkWrap(env + 24, beltH(), 0, 1, TRUE, state) != ERR_OK ||
+		bignEnvUnwrapStart(state, params, head, privkey) != ERR_OK ||
+		bignEnvChunkUnwrap(env, env, 16, 0, FALSE, state) != ERR_OK ||
+		bignEnvChunkUnwrap(env + 24, env + 24, 0, 1, TRUE, state) != ERR_OK ||
+		!memEq(env, beltH(), 16))
+		return FALSE;
+	return TRUE;
+}
+
 /*
 *******************************************************************************
 Самотестирование
@@ -113,19 +449,71 @@ bool_t bignTest()
 	char pwd[] = "B194BAC80A08F53B";
 	size_t iter = 10000;
 	octet key[32];
+	octet batch[5 * (32 + 48 + 64)];
+	err_t codes[5];
+	octet valid[2];
+	size_t i;
+	void* ctx;
 	// создать стек
 	ASSERT(sizeof(brng_state) >= brngCTRX_keep());
 	ASSERT(sizeof(zz_stack) >= zzMulMod_deep(W_OF_O(32)));
+	// готовые таблицы предвычислений
+	if (!bignTestStdPre())
+		return FALSE;
+	// кэш контекстов
+	if (!bignTestCtxCache())
+		return FALSE;
+	// конверты
+	if (!bignTestEnv())
+		return FALSE;
 	// проверить таблицы Б.1, Б.2, Б.3
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.3") != ERR_OK ||
+		bignValParamsFull(params) != ERR_OK ||
 		bignValParams(params) != ERR_OK)
 		return FALSE;
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.2") != ERR_OK ||
+		bignValParamsFull(params) != ERR_OK ||
 		bignValParams(params) != ERR_OK)
 		return FALSE;
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
+		bignValParamsFull(params) != ERR_OK ||
 		bignValParams(params) != ERR_OK)
 		return FALSE;
+	// искаженные параметры не признаются стандартными и не кэшируются
+	params->seed[0] ^= 1;
+	if (bignValParams(params) != ERR_BAD_PARAMS ||
+		bignValParams(params) != ERR_BAD_PARAMS)
+		return FALSE;
+	params->seed[0] ^= 1;
+	params->yG[0] ^= 1;
+	if (bignValParams(params) != ERR_BAD_PARAMS)
+		return FALSE;
+	// пошаговая проверка: искаженная базовая точка отвергается на шаге 3,
+	// стандартные параметры признаются корректными на первом шаге
+	{
+		void* state = blobCreate(bignValParams_keep(params->l));
+		size_t steps;
+		err_t code;
+		if (!state)
+			return FALSE;
+		code = bignValParamsStart(state, params);
+		for (steps = 0; code == ERR_OK || code == ERR_NOT_READY; ++steps)
+			if ((code = bignValParamsStep(state)) != ERR_NOT_READY)
+				break;
+		if (code != ERR_BAD_PARAMS || steps != 2 ||
+			bignValParamsStep(state) != ERR_BAD_PARAMS)
+		{
+			blobClose(state);
+			return FALSE;
+		}
+		params->yG[0] ^= 1;
+		code = bignValParamsStart(state, params);
+		if (code == ERR_OK)
+			code = bignValParamsStep(state);
+		blobClose(state);
+		if (code != ERR_OK)
+			return FALSE;
+	}
 	// идентификатор объекта
 	oid_len = sizeof(oid_der);
 	if (bignOidToDER(oid_der, &oid_len, "1.2.112.0.2.0.34.101.31.81") 
@@ -159,6 +547,12 @@ bool_t bignTest()
 		"7AC6A60361E8C8173491686D461B2826"
 		"190C2EDA5909054A9AB84D2AB9D99A90"))
 		return FALSE;
+	// сжатие открытого ключа
+	if (bignPubkeyCompress(id_pubkey, params, pubkey) != ERR_OK ||
+		!memEq(id_pubkey, pubkey, 32) || id_pubkey[32] != (pubkey[32] & 1) ||
+		bignPubkeyDecompress(id_pubkey, params, id_pubkey) != ERR_OK ||
+		!memEq(id_pubkey, pubkey, 64))
+		return FALSE;
 	memSetZero(pubkey, 32);
 	memCopy(pubkey + 32, params->yG, 32);
 	if (bignDH(pubkey, params, privkey, pubkey, 64) != ERR_OK)
@@ -382,6 +776,673 @@ bool_t bignTest()
 		"E48329259BC1211DDAC2EF1DADFFC993"
 		"2702A92F1DD66C14A9BA1D7300C8713C"))
 		return FALSE;
+	// контекст: повторить тесты Г.1, Г.2, Г.4
+	ctx = blobCreate(bignCtx_keep(params->l));
+	if (!ctx || bignCtxStart(ctx, params) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+		beltH(), 8 * 32, brng_state);
+	if (bignCtxGenKeypair(privkey, pubkey, ctx, brngCTRXStepR, 
+			brng_state) != ERR_OK ||
+		!hexEq(privkey,
+		"1F66B5B84B7339674533F0329C74F218"
+		"34281FED0732429E0C79235FC273E269") || 
+		bignCtxValKeypair(ctx, privkey, pubkey) != ERR_OK ||
+		bignCtxValPubkey(ctx, pubkey) != ERR_OK ||
+		bignCtxCalcPubkey(id_pubkey, ctx, privkey) != ERR_OK ||
+		!memEq(id_pubkey, pubkey, 64))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	if (beltHash(hash, beltH(), 13) != ERR_OK ||
+		bignCtxSign(sig, ctx, oid_der, oid_len, hash, privkey, 
+			brngCTRXStepR, brng_state) != ERR_OK ||
+		!hexEq(sig, 
+		"E36B7F0377AE4C524027C387FADF1B20"
+		"CE72F1530B71F2B5FD3A8C584FE2E1AE"
+		"D20082E30C8AF65011F4FB54649DFD3D") ||
+		bignCtxVerify(ctx, oid_der, oid_len, hash, sig, pubkey) != ERR_OK ||
+		bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0) 
+			!= ERR_OK ||
+		bignCtxVerify(ctx, oid_der, oid_len, hash, sig, pubkey) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	sig[0] ^= 1;
+	if (bignCtxVerify(ctx, oid_der, oid_len, hash, sig, pubkey) == ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// пакетная проверка: (верная, неверная, верная)
+	memCopy(batch, hash, 32);
+	memCopy(batch + 32, hash, 32);
+	memCopy(batch + 64, hash, 32);
+	memCopy(batch + 96 + 48, sig, 48);
+	sig[0] ^= 1;
+	memCopy(batch + 96, sig, 48);
+	memCopy(batch + 96 + 96, sig, 48);
+	memCopy(batch + 240, pubkey, 64);
+	memCopy(batch + 240 + 64, pubkey, 64);
+	memCopy(batch + 240 + 128, pubkey, 64);
+	if (bignCtxVerifyBatch(ctx, oid_der, oid_len, 3, batch, batch + 96,
+			batch + 240, codes) != ERR_BAD_SIG ||
+		codes[0] != ERR_OK || codes[1] != ERR_BAD_SIG || codes[2] != ERR_OK ||
+		bignVerifyBatch(params, oid_der, oid_len, 3, batch, batch + 96,
+			batch + 240, 0) != ERR_BAD_SIG ||
+		bignVerifyBatch(params, oid_der, oid_len, 1, batch, batch + 96,
+			batch + 240, codes) != ERR_OK ||
+		bignCtxVerifyBatch(ctx, oid_der, oid_len, 0, batch, batch + 96,
+			batch + 240, 0) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	if (bignCtxKeyWrap(token, ctx, beltH(), 18, beltH() + 32, pubkey,
+			brngCTRXStepR, brng_state) != ERR_OK ||
+		!hexEq(token,
+		"9B4EA669DABDF100A7D4B6E6EB76EE52"
+		"51912531F426750AAC8A9DBB51C54D8D"
+		"EB9289B50A46952D0531861E45A8814B"
+		"008FDC65DE9FF1FA2A1F16B6A280E957"
+		"A814") ||
+		bignCtxKeyUnwrap(token, ctx, token, 18 + 16 + 32, beltH() + 32,
+			privkey) != ERR_OK ||
+		!memEq(token, beltH(), 18))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	if (bignCtxDH(key, ctx, privkey, pubkey, 32) != ERR_OK ||
+		bignDH(token, params, privkey, pubkey, 32) != ERR_OK ||
+		!memEq(key, token, 32))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// внешний стек: совпадение с bignCtxXXX()
+	{
+		void* stack = blobCreate(bignCtxStack_keep(params->l));
+		bool_t ok = stack != 0;
+		ok = ok &&
+			bignCtxValPubkeyW(ctx, pubkey, stack) == ERR_OK &&
+			bignCtxCalcPubkeyW(id_pubkey, ctx, privkey, stack) == ERR_OK &&
+			memEq(id_pubkey, pubkey, 64) &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxSign2W(token, ctx, oid_der, oid_len, hash, privkey, 0, 0,
+				stack) == ERR_OK &&
+			memEq(token, sig, 48) &&
+			bignCtxVerifyW(ctx, oid_der, oid_len, hash, sig, pubkey, stack)
+				== ERR_OK &&
+			bignCtxSignW(sig, ctx, oid_der, oid_len, hash, privkey,
+				brngCTRXStepR, brng_state, stack) == ERR_OK &&
+			bignCtxVerifyW(ctx, oid_der, oid_len, hash, sig, pubkey, stack)
+				== ERR_OK &&
+			bignCtxDHW(token, ctx, privkey, pubkey, 32, stack) == ERR_OK &&
+			memEq(token, key, 32) &&
+			bignCtxKeyWrapW(token, ctx, beltH(), 18, beltH() + 32, pubkey,
+				brngCTRXStepR, brng_state, stack) == ERR_OK &&
+			bignCtxKeyUnwrapW(token, ctx, token, 18 + 16 + 32, beltH() + 32,
+				privkey, stack) == ERR_OK &&
+			memEq(token, beltH(), 18);
+		blobClose(stack);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// образ контекста: загрузка, совпадение с bignCtxXXX(), искажения
+	{
+		size_t count;
+		void* image;
+		void* ctx1;
+		bool_t ok;
+		ok = bignCtxSave(0, &count, ctx) == ERR_OK;
+		image = ok ? blobCreate(count) : 0;
+		ctx1 = blobCreate(bignCtxLoad_keep(params->l));
+		ok = ok && image && ctx1 &&
+			bignCtxSave(image, &count, ctx) == ERR_OK &&
+			bignCtxLoad(ctx1, params, image, count) == ERR_OK &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxSign2(token, ctx1, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			memEq(token, sig, 48) &&
+			bignCtxVerify(ctx1, oid_der, oid_len, hash, sig, pubkey)
+				== ERR_OK &&
+			bignCtxDH(token, ctx1, privkey, pubkey, 32) == ERR_OK &&
+			memEq(token, key, 32);
+		if (ok)
+		{
+			((octet*)image)[count / 2] ^= 1;
+			ok = bignCtxLoad(ctx1, params, image, count) == ERR_BAD_HASH;
+			((octet*)image)[count / 2] ^= 1;
+			((octet*)image)[4] ^= 1;
+			ok = ok &&
+				bignCtxLoad(ctx1, params, image, count) == ERR_BAD_FORMAT &&
+				bignCtxLoad(ctx1, params, image, count - 1) == ERR_BAD_FORMAT;
+			((octet*)image)[4] ^= 1;
+		}
+		// подмена опорной точки таблицы: точка на кривой, хэш пересчитан
+		if (ok)
+		{
+			const size_t pt_len = 2 * O_PER_W * W_OF_B(2 * params->l);
+			octet* pre = (octet*)image + 64;
+			memSwap(pre + pt_len, pre + 2 * pt_len, pt_len);
+			beltHash((octet*)image + count - 32, image, count - 32);
+			ok = bignCtxLoad(ctx1, params, image, count) == ERR_BAD_FORMAT;
+		}
+		blobClose(ctx1);
+		blobClose(image);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// реплики контекста: совпадение с bignCtxXXX()
+	{
+		void* reps;
+		const void* rep;
+		bool_t ok;
+		reps = blobCreate(objReps_keep());
+		ok = reps && bignCtxRepsStart(reps, ctx) == ERR_OK &&
+			(rep = objRepsGet(reps)) != ctx &&
+			objRepsGet(reps) == rep &&
+			bignCtxSign2(token, rep, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			memEq(token, sig, 48) &&
+			bignCtxVerify(rep, oid_der, oid_len, hash, sig, pubkey)
+				== ERR_OK &&
+			bignCtxDH(token, rep, privkey, pubkey, 32) == ERR_OK &&
+			memEq(token, key, 32);
+		if (reps)
+			objRepsClose(reps);
+		blobClose(reps);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// описатель открытого ключа
+	{
+		void* pk;
+		void* pk1;
+		bool_t ok;
+		pk = blobCreate(2 * bignPubkey_keep(params->l));
+		pk1 = (octet*)pk + bignPubkey_keep(params->l);
+		ok = pk &&
+			bignCtxPubkeyStart(pk, ctx, pubkey) == ERR_OK &&
+			bignCtxDHPk(token, ctx, privkey, pk, 32) == ERR_OK &&
+			memEq(token, key, 32) &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxVerifyPk(ctx, oid_der, oid_len, hash, sig, pk) == ERR_OK &&
+			(sig[0] ^= 1) != 0 &&
+			bignCtxVerifyPk(ctx, oid_der, oid_len, hash, sig, pk) ==
+				ERR_BAD_SIG &&
+			(sig[0] ^= 1) != 0 &&
+			bignCtxKeyWrapPk(token, ctx, beltH(), 18, beltH() + 32, pk,
+				brngCTRXStepR, brng_state) == ERR_OK &&
+			bignCtxKeyUnwrap(token, ctx, token, 18 + 16 + 32, beltH() + 32,
+				privkey) == ERR_OK &&
+			memEq(token, beltH(), 18);
+		// некорректный ключ
+		if (ok)
+		{
+			memCopy(id_pubkey, pubkey, 64);
+			id_pubkey[0] ^= 1;
+			ok = bignCtxPubkeyStart(pk1, ctx, id_pubkey) == ERR_BAD_PUBKEY &&
+				bignCtxDHPk(token, ctx, privkey, pk1, 32) == ERR_BAD_PUBKEY &&
+				bignCtxVerifyPk(ctx, oid_der, oid_len, hash, sig, pk1) ==
+					ERR_BAD_PUBKEY &&
+				bignCtxKeyWrapPk(token, ctx, beltH(), 18, 0, pk1,
+					brngCTRXStepR, brng_state) == ERR_BAD_PUBKEY;
+		}
+		// чужой контекст
+		if (ok)
+		{
+			void* ctx1 = blobCreate(bignCtx_keep(params->l));
+			ok = ctx1 && bignCtxStart(ctx1, params) == ERR_OK &&
+				bignCtxDHPk(token, ctx1, privkey, pk, 32) == ERR_BAD_INPUT;
+			blobClose(ctx1);
+		}
+		blobClose(pk);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// описатель личного ключа
+	{
+		void* sk;
+		void* sk1;
+		octet sig1[48];
+		bool_t ok;
+		sk = blobCreate(2 * bignPrivkey_keep(params->l));
+		sk1 = (octet*)sk + bignPrivkey_keep(params->l);
+		ok = sk &&
+			bignCtxPrivkeyStart(sk, ctx, privkey) == ERR_OK &&
+			bignCtxDHSk(token, ctx, sk, pubkey, 32) == ERR_OK &&
+			memEq(token, key, 32) &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxSign2Sk(sig1, ctx, oid_der, oid_len, hash, sk, 0, 0)
+				== ERR_OK &&
+			memEq(sig, sig1, 48) &&
+			bignCtxSign2Sk(sig1, ctx, oid_der, oid_len, hash, sk, beltH(), 23)
+				== ERR_OK &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey,
+				beltH(), 23) == ERR_OK &&
+			memEq(sig, sig1, 48) &&
+			bignCtxSignSk(sig, ctx, oid_der, oid_len, hash, sk,
+				brngCTRXStepR, brng_state) == ERR_OK &&
+			bignCtxVerify(ctx, oid_der, oid_len, hash, sig, pubkey) == ERR_OK &&
+			bignCtxKeyWrap(token, ctx, beltH(), 18, beltH() + 32, pubkey,
+				brngCTRXStepR, brng_state) == ERR_OK &&
+			bignCtxKeyUnwrapSk(token, ctx, token, 18 + 16 + 32, beltH() + 32,
+				sk) == ERR_OK &&
+			memEq(token, beltH(), 18);
+		// некорректный ключ
+		if (ok)
+		{
+			memSetZero(id_privkey, 32);
+			ok = bignCtxPrivkeyStart(sk1, ctx, id_privkey) ==
+					ERR_BAD_PRIVKEY &&
+				bignCtxDHSk(token, ctx, sk1, pubkey, 32) == ERR_BAD_PRIVKEY &&
+				bignCtxSignSk(sig, ctx, oid_der, oid_len, hash, sk1,
+					brngCTRXStepR, brng_state) == ERR_BAD_PRIVKEY &&
+				bignCtxSign2Sk(sig, ctx, oid_der, oid_len, hash, sk1, 0, 0)
+					== ERR_BAD_PRIVKEY;
+		}
+		// чужой контекст
+		if (ok)
+		{
+			void* ctx1 = blobCreate(bignCtx_keep(params->l));
+			ok = ctx1 && bignCtxStart(ctx1, params) == ERR_OK &&
+				bignCtxDHSk(token, ctx1, sk, pubkey, 32) == ERR_BAD_INPUT;
+			blobClose(ctx1);
+		}
+		// очистка
+		if (ok)
+		{
+			bignPrivkeyStop(sk);
+			ok = memIsZero(sk, bignPrivkey_keep(params->l));
+		}
+		blobClose(sk);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// описатель открытого ключа с таблицей
+	{
+		void* pk;
+		void* pk1;
+		octet id_privkey1[32];
+		octet id_pubkey1[64];
+		bool_t ok;
+		pk = blobCreate(bignPubkey_keep(params->l) + 
+			bignPubkeyPre_keep(params->l));
+		pk1 = (octet*)pk + bignPubkey_keep(params->l);
+		ok = pk &&
+			bignCtxPubkeyStart(pk, ctx, pubkey) == ERR_OK &&
+			bignCtxPubkeyPreStart(pk1, ctx, pubkey) == ERR_OK &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxVerifyPk(ctx, oid_der, oid_len, hash, sig, pk1) == ERR_OK &&
+			(sig[0] ^= 1) != 0 &&
+			bignCtxVerifyPk(ctx, oid_der, oid_len, hash, sig, pk1) ==
+				ERR_BAD_SIG &&
+			bignCtxDHPk(token, ctx, privkey, pk1, 32) == ERR_OK &&
+			memEq(token, key, 32);
+		// идентификационная подпись
+		ok = ok &&
+			bignCtxSign2(sig, ctx, oid_der, oid_len, id_hash, privkey, 0, 0)
+				== ERR_OK &&
+			bignCtxIdExtract(id_privkey, id_pubkey, ctx, oid_der, oid_len,
+				id_hash, sig, pubkey) == ERR_OK &&
+			bignCtxIdExtractPk(id_privkey1, id_pubkey1, ctx, oid_der, 
+				oid_len, id_hash, sig, pk) == ERR_OK &&
+			memEq(id_privkey, id_privkey1, 32) &&
+			memEq(id_pubkey, id_pubkey1, 64) &&
+			bignCtxIdExtractPk(id_privkey1, id_pubkey1, ctx, oid_der, 
+				oid_len, id_hash, sig, pk1) == ERR_OK &&
+			memEq(id_privkey, id_privkey1, 32) &&
+			memEq(id_pubkey, id_pubkey1, 64) &&
+			bignCtxIdSign2(id_sig, ctx, oid_der, oid_len, id_hash, hash,
+				id_privkey, 0, 0) == ERR_OK &&
+			bignCtxIdVerify(ctx, oid_der, oid_len, id_hash, hash, id_sig,
+				id_pubkey, pubkey) == ERR_OK &&
+			bignCtxIdVerifyPk(ctx, oid_der, oid_len, id_hash, hash, id_sig,
+				id_pubkey, pk) == ERR_OK &&
+			bignCtxIdVerifyPk(ctx, oid_der, oid_len, id_hash, hash, id_sig,
+				id_pubkey, pk1) == ERR_OK &&
+			(id_sig[0] ^= 1) != 0 &&
+			bignCtxIdVerifyPk(ctx, oid_der, oid_len, id_hash, hash, id_sig,
+				id_pubkey, pk) == ERR_BAD_SIG &&
+			bignCtxIdVerifyPk(ctx, oid_der, oid_len, id_hash, hash, id_sig,
+				id_pubkey, pk1) == ERR_BAD_SIG &&
+			(id_sig[0] ^= 1) != 0 &&
+			(sig[0] ^= 1) != 0 &&
+			bignCtxIdExtractPk(id_privkey1, id_pubkey1, ctx, oid_der, 
+				oid_len, id_hash, sig, pk1) == ERR_BAD_SIG;
+		// некорректный ключ
+		if (ok)
+		{
+			memCopy(id_pubkey1, pubkey, 64);
+			id_pubkey1[0] ^= 1;
+			ok = bignCtxPubkeyPreStart(pk1, ctx, id_pubkey1) ==
+					ERR_BAD_PUBKEY &&
+				bignCtxIdVerifyPk(ctx, oid_der, oid_len, id_hash, hash, 
+					id_sig, id_pubkey, pk1) == ERR_BAD_PUBKEY;
+		}
+		blobClose(pk);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// пакетное восстановление: (pubkey, G, некорректный ключ)
+	memSetZero(batch + 100, 32);
+	memCopy(batch + 132, params->yG, 32);
+	if (bignCtxPubkeyCompress(batch, ctx, pubkey) != ERR_OK ||
+		bignCtxPubkeyCompress(batch + 33, ctx, batch + 100) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	memCopy(batch + 66, batch, 33);
+	batch[98] = 2;
+	if (bignCtxPubkeyDecompressBatch(batch + 100, ctx, 3, batch, codes) !=
+			ERR_BAD_PUBKEY ||
+		codes[0] != ERR_OK || codes[1] != ERR_OK || 
+		codes[2] != ERR_BAD_PUBKEY ||
+		!memEq(batch + 100, pubkey, 64) ||
+		!memIsZero(batch + 164, 32) ||
+		!memEq(batch + 196, params->yG, 32) ||
+		bignPubkeyDecompressBatch(batch + 100, params, 2, batch, 0) != 
+			ERR_OK ||
+		bignCtxPubkeyDecompress(batch + 100, ctx, batch + 33) != ERR_OK ||
+		!memEq(batch + 132, params->yG, 32))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// пакетная проверка: (pubkey, G, искаженный pubkey) x 3, pubkey
+	for (i = 0; i < 10; ++i)
+		if (i % 3 == 1)
+			memSetZero(batch + 64 * i, 32),
+			memCopy(batch + 64 * i + 32, params->yG, 32);
+		else
+			memCopy(batch + 64 * i, pubkey, 64),
+			batch[64 * i] ^= (octet)(i % 3 == 2);
+	if (bignValPubkeyBatch(valid, params, 10, batch) != ERR_BAD_PUBKEY ||
+		!hexEq(valid, "DB02") ||
+		bignCtxValPubkeyBatch(valid, ctx, 2, batch) != ERR_OK ||
+		!hexEq(valid, "0302") ||
+		bignCtxValPubkeyBatch(valid, ctx, 0, batch) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// пакетная выработка: 5 подписей (совпадают с bignSign())
+	for (i = 0; i < 5; ++i)
+		memCopy(batch + 32 * i, hash, 32), batch[32 * i] ^= (octet)i;
+	brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+		beltH(), 8 * 32, brng_state);
+	if (bignSignBatch(batch + 160, params, oid_der, oid_len, 5, batch,
+		privkey, brngCTRXStepR, brng_state) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+		beltH(), 8 * 32, brng_state);
+	for (i = 0; i < 5; ++i)
+		if (bignSign(sig, params, oid_der, oid_len, batch + 32 * i, privkey,
+				brngCTRXStepR, brng_state) != ERR_OK ||
+			!memEq(sig, batch + 160 + 48 * i, 48))
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+		beltH(), 8 * 32, brng_state);
+	if (bignCtxSignBatch(batch + 400, ctx, oid_der, oid_len, 5, batch,
+			privkey, brngCTRXStepR, brng_state) != ERR_OK ||
+		!memEq(batch + 400, batch + 160, 5 * 48))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// пакетная проверка: (верная, верная, верная, неверная, верная)
+	for (i = 0; i < 5; ++i)
+		memCopy(batch + 400 + 64 * i, pubkey, 64);
+	batch[160 + 48 * 3] ^= 1;
+	if (bignVerifyBatch(params, oid_der, oid_len, 5, batch, batch + 160,
+			batch + 400, codes) != ERR_BAD_SIG ||
+		codes[0] != ERR_OK || codes[1] != ERR_OK || codes[2] != ERR_OK ||
+		codes[3] != ERR_BAD_SIG || codes[4] != ERR_OK ||
+		bignVerifyBatch(params, oid_der, oid_len, 5, batch, batch + 160,
+			batch + 400, 0) != ERR_BAD_SIG ||
+		bignVerifyBatch(params, oid_der, oid_len, 3, batch, batch + 160,
+			batch + 400, 0) != ERR_OK ||
+		bignCtxVerifyBatch(ctx, oid_der, oid_len, 5, batch, batch + 160,
+			batch + 400, codes) != ERR_BAD_SIG ||
+		codes[3] != ERR_BAD_SIG || codes[4] != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// пакетное создание токенов: 10 получателей (pubkey, G, pubkey, ...)
+	{
+		octet* tokens;
+		octet* pubkeys;
+		bool_t ok;
+		tokens = (octet*)blobCreate(2 * 10 * 80 + 10 * 64);
+		pubkeys = tokens + 2 * 10 * 80;
+		ok = tokens != 0;
+		for (i = 0; ok && i < 10; ++i)
+			if (i % 2)
+				memSetZero(pubkeys + 64 * i, 32),
+				memCopy(pubkeys + 64 * i + 32, params->yG, 32);
+			else
+				memCopy(pubkeys + 64 * i, pubkey, 64);
+		// совпадение с bignCtxKeyWrap()
+		if (ok)
+		{
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			ok = bignCtxKeyWrapBatch(tokens, ctx, beltH(), 32, beltH() + 32,
+				10, pubkeys, brngCTRXStepR, brng_state) == ERR_OK;
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			for (i = 0; ok && i < 10; ++i)
+				ok = bignCtxKeyWrap(tokens + 800 + 80 * i, ctx, beltH(), 32,
+					beltH() + 32, pubkeys + 64 * i, brngCTRXStepR,
+					brng_state) == ERR_OK;
+			ok = ok && memEq(tokens, tokens + 800, 800);
+		}
+		// совпадение с bignKeyWrapBatch()
+		if (ok)
+		{
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			ok = bignKeyWrapBatch(tokens + 800, params, beltH(), 32,
+				beltH() + 32, 10, pubkeys, brngCTRXStepR, brng_state) ==
+					ERR_OK &&
+				memEq(tokens, tokens + 800, 800);
+		}
+		// разбор
+		memSetZero(id_privkey, 32), id_privkey[0] = 1;
+		for (i = 0; ok && i < 10; ++i)
+			ok = bignCtxKeyUnwrap(key, ctx, tokens + 80 * i, 80, beltH() + 32,
+				i % 2 ? id_privkey : privkey) == ERR_OK &&
+				memEq(key, beltH(), 32);
+		// некорректный ключ
+		if (ok)
+		{
+			pubkeys[64 * 9 + 32] ^= 1;
+			ok = bignCtxKeyWrapBatch(tokens, ctx, beltH(), 32, 0, 10,
+				pubkeys, brngCTRXStepR, brng_state) == ERR_BAD_PUBKEY;
+		}
+		blobClose(tokens);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// пакетная генерация: 20 пар (совпадают с bignGenKeypair())
+	{
+		octet* keys;
+		bool_t ok;
+		keys = (octet*)blobCreate(3 * 20 * 96);
+		ok = keys != 0;
+		if (ok)
+		{
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			ok = bignGenKeypairBatch(keys, keys + 20 * 32, params, 20,
+				brngCTRXStepR, brng_state) == ERR_OK;
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			for (i = 0; ok && i < 20; ++i)
+				ok = bignGenKeypair(keys + 1920 + 32 * i,
+					keys + 1920 + 640 + 64 * i, params, brngCTRXStepR,
+					brng_state) == ERR_OK;
+			ok = ok && memEq(keys, keys + 1920, 1920);
+		}
+		if (ok)
+		{
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			ok = bignCtxGenKeypairBatch(keys + 3840, keys + 3840 + 640, ctx,
+				20, brngCTRXStepR, brng_state) == ERR_OK &&
+				memEq(keys, keys + 3840, 1920) &&
+				bignCtxGenKeypairBatch(keys, keys + 640, ctx, 0,
+					brngCTRXStepR, brng_state) == ERR_OK &&
+				bignGenKeypairBatch(keys, keys + 640, params, 1, 0, 0) ==
+					ERR_BAD_RNG;
+		}
+		for (i = 0; ok && i < 20; ++i)
+			ok = bignCtxValKeypair(ctx, keys + 3840 + 32 * i,
+				keys + 3840 + 640 + 64 * i) == ERR_OK;
+		blobClose(keys);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// пакетное построение общих ключей: 20 сторон (pubkey, G, pubkey, ...)
+	{
+		octet* keys;
+		octet* pubkeys;
+		bool_t ok;
+		keys = (octet*)blobCreate(2 * 20 * 64 + 20 * 64);
+		pubkeys = keys + 2 * 20 * 64;
+		ok = keys != 0;
+		for (i = 0; ok && i < 20; ++i)
+			if (i % 2)
+				memSetZero(pubkeys + 64 * i, 32),
+				memCopy(pubkeys + 64 * i + 32, params->yG, 32);
+			else
+				memCopy(pubkeys + 64 * i, pubkey, 64);
+		// совпадение с bignDH()
+		ok = ok &&
+			bignDHBatch(keys, params, privkey, 20, pubkeys, 64) == ERR_OK;
+		for (i = 0; ok && i < 20; ++i)
+			ok = bignDH(keys + 1280 + 64 * i, params, privkey,
+				pubkeys + 64 * i, 64) == ERR_OK;
+		ok = ok && memEq(keys, keys + 1280, 1280);
+		// контекст, короткие ключи
+		ok = ok &&
+			bignCtxDHBatch(keys + 1280, ctx, privkey, 20, pubkeys, 24) ==
+				ERR_OK;
+		for (i = 0; ok && i < 20; ++i)
+			ok = memEq(keys + 1280 + 24 * i, keys + 64 * i, 24);
+		// ошибки
+		if (ok)
+		{
+			pubkeys[64 * 17 + 32] ^= 1;
+			ok = bignCtxDHBatch(keys, ctx, privkey, 0, pubkeys, 32) ==
+					ERR_OK &&
+				bignCtxDHBatch(keys, ctx, privkey, 20, pubkeys, 65) ==
+					ERR_BAD_SHAREDKEY &&
+				bignDHBatch(keys, params, privkey, 20, pubkeys, 32) ==
+					ERR_BAD_PUBKEY &&
+				bignCtxDHBatch(keys, ctx, privkey, 17, pubkeys, 32) ==
+					ERR_OK;
+		}
+		blobClose(keys);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	// пул одноразовых ключей
+	{
+		void* pool;
+		bool_t ok;
+		pool = blobCreate(bignPool_keep(params->l, 8));
+		ok = pool != 0;
+		// без потоков: совпадение с bignCtxSign()
+		if (ok)
+		{
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			ok = bignCtxPoolStart(pool, ctx, 3, 0, brngCTRXStepR,
+				brng_state) == ERR_OK &&
+				bignCtxPoolFill(pool, ctx) == ERR_OK &&
+				bignCtxPoolCount(pool) == 3;
+			for (i = 0; ok && i < 4; ++i)
+				ok = bignCtxSignPool(batch + 160 + 48 * i, ctx, pool, oid_der,
+					oid_len, batch + 32 * i, privkey) == ERR_OK;
+			ok = ok && bignCtxPoolCount(pool) == 0 &&
+				bignCtxPoolStop(pool) == ERR_OK;
+			brngCTRXStart(beltH() + 128, beltH() + 128 + 64,
+				beltH(), 8 * 32, brng_state);
+			for (i = 0; ok && i < 4; ++i)
+				ok = bignCtxSign(sig, ctx, oid_der, oid_len, batch + 32 * i,
+					privkey, brngCTRXStepR, brng_state) == ERR_OK &&
+					memEq(sig, batch + 160 + 48 * i, 48);
+		}
+		// с потоками: ожидание заполнения, проверка подписей
+		if (ok)
+		{
+			ok = bignCtxPoolStart(pool, ctx, 8, 2, brngCTRXStepR,
+				brng_state) == ERR_OK;
+			for (i = 0; ok && i < 5000 && bignCtxPoolCount(pool) < 8; ++i)
+				mtSleep(1);
+			for (i = 0; ok && i < 10; ++i)
+				ok = bignCtxSignPool(sig, ctx, pool, oid_der, oid_len,
+					batch + 32 * (i % 5), privkey) == ERR_OK &&
+					bignCtxVerify(ctx, oid_der, oid_len, batch + 32 * (i % 5),
+						sig, pubkey) == ERR_OK;
+			ok = bignCtxPoolStop(pool) == ERR_OK && ok;
+		}
+		blobClose(pool);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	blobClose(ctx);
 	// все нормально
 	return TRUE;
 }
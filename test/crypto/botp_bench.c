@@ -0,0 +1,171 @@
+/*
+*******************************************************************************
+\file botp_bench.c
+\brief Benchmarks for STB 34.101.47/botp
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/botp.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость построения одноразовых паролей в режимах HOTP, TOTP
+и OCRA, а также скорость проверки неверного пароля в окне из 11 счетчиков
+HOTP (полный перебор окна). Сравнивается скорость проверки паролей TOTP
+разных пользователей по одному (botpTOTPVerify()) и пакетами
+из BOTP_BENCH_BATCH паролей (botpTOTPStepVMulti()). Для OCRA сравнивается
+скорость проверки пароля с разбором описателя (botpOCRAVerify())
+и по заранее разобранному описателю (botpOCRAVerifyS()).
+*******************************************************************************
+*/
+
+#define BOTP_BENCH_BATCH 64
+
+typedef struct
+{
+	octet state[2048];		/*!< состояние алгоритма */
+	char otp[16];			/*!< одноразовый пароль */
+	tm_time_t t;			/*!< отметка времени */
+	const octet* keys[BOTP_BENCH_BATCH];	/*!< ключи пакета */
+	size_t key_lens[BOTP_BENCH_BATCH];		/*!< длины ключей пакета */
+	char otps[BOTP_BENCH_BATCH][16];		/*!< пароли пакета */
+	const char* otp_ptrs[BOTP_BENCH_BATCH];	/*!< указатели на пароли */
+	tm_time_t ts[BOTP_BENCH_BATCH];			/*!< отметки времени пакета */
+	bool_t rets[BOTP_BENCH_BATCH];			/*!< результаты проверки */
+	octet hsuite[128];		/*!< объект описателя OCRA */
+	bool_t ok;				/*!< признак успеха */
+} botp_bench_st;
+
+static const char botp_bench_suite[] = "OCRA-1:HOTP-HBELT-8:C-QN08-T1M";
+
+static void botpBenchHOTP(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		botpHOTPStepR(b->otp, b->state);
+}
+
+static void botpBenchTOTP(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		botpTOTPStepR(b->otp, b->t++, b->state);
+}
+
+static void botpBenchHOTPVerifyW(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	size_t offset;
+	while (reps--)
+		if (botpHOTPVerifyW(&offset, "00000000", beltH() + 128, 32,
+			beltH() + 192, 10) == ERR_OK)
+			b->otp[0] = 0;
+}
+
+static void botpBenchTOTPVerify(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	size_t i;
+	while (reps--)
+		for (i = 0; i < BOTP_BENCH_BATCH; ++i)
+			b->rets[i] = botpTOTPVerify(b->otp_ptrs[i], b->keys[i],
+				b->key_lens[i], b->ts[i]) == ERR_OK;
+}
+
+static void botpBenchTOTPVerifyMulti(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		botpTOTPStepVMulti(b->rets, BOTP_BENCH_BATCH, b->keys, b->key_lens,
+			b->otp_ptrs, b->ts, b->state);
+}
+
+static void botpBenchOCRA(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		botpOCRAStepR(b->otp, (const octet*)"12345678", 8, b->t++,
+			b->state);
+}
+
+static void botpBenchOCRAVerify(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		b->ok &= botpOCRAVerify(b->otp, botp_bench_suite, beltH() + 128, 32,
+			(const octet*)"12345678", 8, beltH(), 0, 0, b->t) == ERR_OK;
+}
+
+static void botpBenchOCRAVerifyS(void* arg, size_t reps)
+{
+	botp_bench_st* b = (botp_bench_st*)arg;
+	while (reps--)
+		b->ok &= botpOCRAVerifyS(b->otp, b->hsuite, beltH() + 128, 32,
+			(const octet*)"12345678", 8, beltH(), 0, 0, b->t) == ERR_OK;
+}
+
+bool_t botpBench()
+{
+	botp_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	memSetZero(b, sizeof(b));
+	b->t = 1000000;
+	for (i = 0; i < BOTP_BENCH_BATCH; ++i)
+	{
+		b->keys[i] = beltH() + i;
+		b->key_lens[i] = 32;
+		b->ts[i] = b->t + i;
+		botpTOTPRand(b->otps[i], 8, b->keys[i], 32, b->ts[i]);
+		b->otp_ptrs[i] = b->otps[i];
+		b->rets[i] = TRUE;
+	}
+	// HOTP
+	ASSERT(botpHOTP_keep() <= sizeof(b->state));
+	botpHOTPStart(b->state, 8, beltH() + 128, 32);
+	ret &= benchDo("botpBench::hotp", "otp", 1, botpBenchHOTP, b);
+	ret &= benchDo("botpBench::hotp-verify[11]", "otp", 1,
+		botpBenchHOTPVerifyW, b);
+	// TOTP
+	ASSERT(botpTOTP_keep() <= sizeof(b->state));
+	botpTOTPStart(b->state, 8, beltH() + 128, 32);
+	ret &= benchDo("botpBench::totp", "otp", 1, botpBenchTOTP, b);
+	ret &= benchDo("botpBench::totp-verify", "otp", BOTP_BENCH_BATCH,
+		botpBenchTOTPVerify, b);
+	ASSERT(botpTOTPMulti_keep() <= sizeof(b->state));
+	ret &= benchDo("botpBench::totp-verify-multi", "otp", BOTP_BENCH_BATCH,
+		botpBenchTOTPVerifyMulti, b);
+	for (i = 0; i < BOTP_BENCH_BATCH; ++i)
+		ret &= b->rets[i];
+	// OCRA
+	ASSERT(botpOCRA_keep() <= sizeof(b->state));
+	if (!botpOCRAStart(b->state, botp_bench_suite, beltH() + 128, 32))
+		return FALSE;
+	ret &= benchDo("botpBench::ocra", "otp", 1, botpBenchOCRA, b);
+	// OCRA: проверка
+	ASSERT(botpOCRASuite_keep() <= sizeof(b->hsuite));
+	if (!botpOCRASuiteStart(b->hsuite, botp_bench_suite) ||
+		botpOCRARand(b->otp, botp_bench_suite, beltH() + 128, 32,
+			(const octet*)"12345678", 8, beltH(), 0, 0, b->t) != ERR_OK)
+		return FALSE;
+	b->ok = TRUE;
+	ret &= benchDo("botpBench::ocra-verify", "otp", 1, botpBenchOCRAVerify,
+		b);
+	ret &= benchDo("botpBench::ocra-verify-suite", "otp", 1,
+		botpBenchOCRAVerifyS, b);
+	ret &= b->ok;
+	return ret;
+}
@@ -4,12 +4,13 @@
 \brief Tests for STB 34.101.47/botp
 \project bee2/test
 \created 2015.11.06
-\version 2019.08.30
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/str.h>
@@ -27,19 +28,30 @@
 
 bool_t botpTest()
 {
-	octet ctr[8];
+	octet ctr[8], ctr1[8];
 	char otp[16], otp1[16], otp2[16], otp3[16];
 	const char suite[] = "OCRA-1:HOTP-HBELT-8:C-QN08-PHBELT-S064-T1M";
 	char q[32];
 	octet p[32];
 	char p_str[72];
 	char s_str[136];
-	tm_time_t t;
+	tm_time_t t, tw, t1;
+	size_t offset;
+	const octet* keys[7];
+	size_t key_lens[7];
+	char otps[7][16];
+	const char* otp_ptrs[7];
+	tm_time_t ts[7];
+	bool_t rets[7];
+	size_t i;
+	octet hsuite[128];
 	octet state[2048];
 	// создать стек
 	ASSERT(sizeof(state) >= botpHOTP_keep());
 	ASSERT(sizeof(state) >= botpTOTP_keep());
 	ASSERT(sizeof(state) >= botpOCRA_keep());
+	ASSERT(sizeof(state) >= botpTOTPMulti_keep());
+	ASSERT(sizeof(hsuite) >= botpOCRASuite_keep());
 	// HOTP.1
 	memCopy(ctr, beltH() + 192, 8); 
 	botpHOTPStart(state, 8, beltH() + 128, 32);
@@ -64,6 +76,24 @@ bool_t botpTest()
 	if (!strEq(otp3, "26078636"))
 		return FALSE;
 	botpHOTPStepG(ctr, state);
+	// HOTP.window
+	if (botpHOTPVerifyW(&offset, otp3, beltH() + 128, 32, beltH() + 192,
+			1) == ERR_OK ||
+		botpHOTPVerifyW(&offset, otp3, beltH() + 128, 32, beltH() + 192,
+			10) != ERR_OK || offset != 2)
+		return FALSE;
+	botpHOTPStart(state, 8, beltH() + 128, 32);
+	botpHOTPStepS(state, beltH() + 192);
+	if (botpHOTPStepW(&offset, otp3, 1, state))
+		return FALSE;
+	botpHOTPStepG(ctr1, state);
+	if (!memEq(ctr1, beltH() + 192, 8) ||
+		!botpHOTPStepW(&offset, otp2, 10, state) || offset != 1 ||
+		!botpHOTPStepW(&offset, otp3, 10, state) || offset != 0)
+		return FALSE;
+	botpHOTPStepG(ctr1, state);
+	if (!memEq(ctr1, ctr, 8))
+		return FALSE;
 	// TOTP.1
 	t = 1449165288;
 	ASSERT(t != TIME_ERR);
@@ -89,6 +119,41 @@ bool_t botpTest()
 	botpTOTPStepR(otp, t / 60, state);
 	if (!strEq(otp, "55973851"))
 		return FALSE;
+	// TOTP.window
+	tw = 1449165288 / 60;
+	if (botpTOTPVerifyW(&t1, "94431522", beltH() + 128, 32, tw, 1, 0) ==
+			ERR_OK ||
+		botpTOTPVerifyW(&t1, "94431522", beltH() + 128, 32, tw, 0, 1) !=
+			ERR_OK || t1 != tw + 1 ||
+		botpTOTPVerifyW(&t1, "97660664", beltH() + 128, 32, tw + 2, 2, 2) !=
+			ERR_OK || t1 != tw)
+		return FALSE;
+	botpTOTPStart(state, 8, beltH() + 128, 32);
+	if (!botpTOTPStepW(&t1, "55973851", tw, 1, 2, state) || t1 != tw + 2 ||
+		botpTOTPStepW(&t1, "55973851", tw, 2, 1, state) ||
+		!botpTOTPStepW(0, "97660664", tw + 1, 1, 0, state) ||
+		botpTOTPStepW(&t1, "97660664", 1, 3, 0, state))
+		return FALSE;
+	// TOTP.multi
+	for (i = 0; i < 7; ++i)
+	{
+		keys[i] = beltH() + 16 * i;
+		key_lens[i] = (i % 3 == 2) ? 33 + 10 * i : 32 - 3 * i;
+		ts[i] = tw + i;
+		botpTOTPRand(otps[i], 6 + i % 3, keys[i], key_lens[i], ts[i]);
+		otp_ptrs[i] = otps[i];
+	}
+	otps[3][0] = otps[3][0] == '0' ? '1' : '0';
+	otps[4][5] = 0;
+	ts[5] = TIME_ERR;
+	botpTOTPStepVMulti(rets, 7, keys, key_lens, otp_ptrs, ts, state);
+	for (i = 0; i < 7; ++i)
+		if (rets[i] != (i < 3 || i == 6))
+			return FALSE;
+	memSetZero(rets, sizeof(rets));
+	if (botpTOTPVerifyMulti(rets, 3, keys, key_lens, otp_ptrs, ts) !=
+		ERR_OK || !rets[0] || !rets[1] || !rets[2])
+		return FALSE;
 	// OCRA.format
 	if (botpOCRAStart(state, "OCRA-:HOTP-HBELT-6:C-QN08", beltH(), 32) ||
 		botpOCRAStart(state, "OCRA-1:HOTP-HBELT-3:C-QN08", beltH(), 32) ||
@@ -124,6 +189,7 @@ bool_t botpTest()
 	if (botpOCRAVerify(otp, suite, beltH() + 128, 32, (const octet*)q, strLen(q), 
 		ctr, p, beltH(), t) != ERR_OK)
 		return FALSE;
+	tw = t;
 	// OCRA.2
 	strCopy(q, otp2);
 	strCopy(q + strLen(q), otp3);
@@ -136,6 +202,26 @@ bool_t botpTest()
 	botpOCRAStepR(otp, (const octet*)q, strLen(q), ++t, state);
 	if (!strEq(otp, "21318915"))
 		return FALSE;
+	// OCRA.suite
+	if (botpOCRASuiteStart(hsuite, "OCRA-1:HOTP-HBELT-8:QN08-T51H") ||
+		!botpOCRASuiteStart(hsuite, suite))
+		return FALSE;
+	strCopy(q, otp1);
+	botpOCRAStartS(state, hsuite, beltH() + 128, 32);
+	botpOCRAStepS(state, ctr, p, beltH());
+	botpOCRAStepR(otp, (const octet*)q, strLen(q), tw, state);
+	if (!strEq(otp, "85199085"))
+		return FALSE;
+	botpOCRARandS(otp, hsuite, beltH() + 128, 32, (const octet*)q,
+		strLen(q), ctr, p, beltH(), tw);
+	if (!strEq(otp, "85199085") ||
+		botpOCRAVerifyS(otp, hsuite, beltH() + 128, 32, (const octet*)q,
+			strLen(q), ctr, p, beltH(), tw) != ERR_OK ||
+		botpOCRAVerifyS(otp, hsuite, beltH() + 128, 32, (const octet*)q,
+			strLen(q), ctr, p, beltH(), tw + 1) != ERR_BAD_PWD ||
+		botpOCRAVerifyS(otp, hsuite, beltH() + 128, 32, (const octet*)q,
+			2, ctr, p, beltH(), tw) != ERR_BAD_PARAMS)
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
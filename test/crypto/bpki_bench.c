@@ -0,0 +1,67 @@
+/*
+*******************************************************************************
+\file bpki_bench.c
+\brief Benchmarks for STB 34.101.78 (bpki) helpers
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bpki.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость разбора контейнера с личным ключом (l = 128,
+10000 итераций PBKDF2) без кэша ключей защиты и с кэшем.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet epki[1024];		/*!< контейнер */
+	size_t epki_len;		/*!< длина контейнера */
+	octet privkey[32];		/*!< личный ключ */
+	err_t code;				/*!< код ошибки */
+} bpki_bench_st;
+
+static void bpkiBenchUnwrap(void* arg, size_t reps)
+{
+	bpki_bench_st* b = (bpki_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = bpkiPrivkeyUnwrap(b->privkey, 0, b->epki, b->epki_len,
+			(const octet*)"zed", 3);
+}
+
+bool_t bpkiBench()
+{
+	bpki_bench_st b[1];
+	octet combo_state[256];
+	bool_t ret = TRUE;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	b->code = bpkiPrivkeyWrap(b->epki, &b->epki_len, beltH(), 32,
+		(const octet*)"zed", 3, beltH() + 32, 10000);
+	if (b->code != ERR_OK)
+		return FALSE;
+	// без кэша
+	ret &= benchDo("bpkiBench::privkey-unwrap", "op", 1, bpkiBenchUnwrap, b);
+	// с кэшем
+	if (b->code == ERR_OK)
+		b->code = bpkiCacheStart(60, prngCOMBOStepR, combo_state);
+	ret &= benchDo("bpkiBench::privkey-unwrap-cached", "op", 1,
+		bpkiBenchUnwrap, b);
+	bpkiCacheStop();
+	ret &= b->code == ERR_OK;
+	return ret;
+}
@@ -4,13 +4,15 @@
 \brief Tests for STB 34.101.78 (bpki) helpers
 \project bee2/test
 \created 2021.04.13
-\version 2022.07.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
 #include <bee2/crypto/belt.h>
@@ -21,6 +23,8 @@ bool_t bpkiTest()
 	octet epki[1024];
 	octet key[65];
 	octet pwd[] = { 'z', 'e', 'd' };
+	octet pwd1[] = { 'z', 'e', 'e' };
+	octet combo_state[256];
 	size_t epki_len, key_len;
 	// создать контейнер с личным ключом (l = 128)
 	if (bpkiPrivkeyWrap(epki, &epki_len, beltH(), 32,
@@ -81,6 +85,36 @@ bool_t bpkiTest()
 		return FALSE;
 	ASSERT(epki_len <= sizeof(epki));
 	// разобрать контейнер с частичным секретом (l = 128)
+	if (bpkiShareUnwrap(key, &key_len, epki, epki_len,
+			pwd, sizeof(pwd)) != ERR_OK ||
+		key_len != 33 || !memEq(key + 1, beltH(), 32) || key[0] != 16)
+		return FALSE;
+	// кэш ключей защиты
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	if (bpkiCacheStart(0, prngCOMBOStepR, combo_state) != ERR_BAD_INPUT ||
+		bpkiCacheStart(60, 0, 0) != ERR_BAD_RNG ||
+		bpkiCacheStart(60, prngCOMBOStepR, combo_state) != ERR_OK)
+		return FALSE;
+	// неверный пароль не попадает в кэш
+	if (bpkiShareUnwrap(key, &key_len, epki, epki_len,
+			pwd1, sizeof(pwd1)) == ERR_OK)
+		return FALSE;
+	// верный пароль: построение ключа защиты и его извлечение из кэша
+	for (key_len = 0; key_len < 2; ++key_len)
+	{
+		memSetZero(key, sizeof(key));
+		if (bpkiShareUnwrap(key, 0, epki, epki_len,
+				pwd, sizeof(pwd)) != ERR_OK ||
+			!memEq(key + 1, beltH(), 32) || key[0] != 16)
+			return FALSE;
+	}
+	// неверный пароль при наличии записи в кэше
+	if (bpkiShareUnwrap(key, &key_len, epki, epki_len,
+			pwd1, sizeof(pwd1)) == ERR_OK)
+		return FALSE;
+	// после выключения кэша
+	bpkiCacheStop();
 	if (bpkiShareUnwrap(key, &key_len, epki, epki_len,
 			pwd, sizeof(pwd)) != ERR_OK ||
 		key_len != 33 || !memEq(key + 1, beltH(), 32) || key[0] != 16)
@@ -0,0 +1,83 @@
+/*
+*******************************************************************************
+\file brng_bench.c
+\brief Benchmarks for STB 34.101.47 (brng)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/brng.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость генерации в режимах CTR и HMAC. Данные вырабатываются
+порциями по 32 октета (одноразовый ключ подписи) и по 1024 октета.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet state_ctr[1024];		/*!< состояние brng-ctr */
+	octet state_hmac[1024];		/*!< состояние brng-hmac */
+	octet buf[1024];			/*!< выходные данные */
+	size_t count;				/*!< длина порции */
+} brng_bench_st;
+
+static void brngBenchCTR(void* arg, size_t reps)
+{
+	brng_bench_st* b = (brng_bench_st*)arg;
+	while (reps--)
+		brngCTRStepR(b->buf, b->count, b->state_ctr);
+}
+
+static void brngBenchHMAC(void* arg, size_t reps)
+{
+	brng_bench_st* b = (brng_bench_st*)arg;
+	while (reps--)
+		brngHMACStepR(b->buf, b->count, b->state_hmac);
+}
+
+bool_t brngBench()
+{
+	static const size_t counts[] = { 32, 1024 };
+	static const char* const ctr_names[] =
+	{
+		"brngBench::brng-ctr[32]",
+		"brngBench::brng-ctr[1024]",
+	};
+	static const char* const hmac_names[] =
+	{
+		"brngBench::brng-hmac[32]",
+		"brngBench::brng-hmac[1024]",
+	};
+	brng_bench_st* b;
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	if (!(b = (brng_bench_st*)blobCreate(sizeof(brng_bench_st))))
+		return FALSE;
+	ASSERT(brngCTR_keep() <= sizeof(b->state_ctr));
+	ASSERT(brngHMAC_keep() <= sizeof(b->state_hmac));
+	brngCTRStart(b->state_ctr, beltH() + 128, beltH() + 192);
+	brngHMACStart(b->state_hmac, beltH() + 128, 32, beltH() + 192, 32);
+	// замеры
+	for (i = 0; i < COUNT_OF(counts); ++i)
+	{
+		b->count = counts[i];
+		ret &= benchDo(ctr_names[i], "B", counts[i], brngBenchCTR, b);
+		ret &= benchDo(hmac_names[i], "B", counts[i], brngBenchHMAC, b);
+	}
+	blobClose(b);
+	return ret;
+}
@@ -0,0 +1,170 @@
+/*
+*******************************************************************************
+\file btok_bench.c
+\brief Benchmarks for STB 34.101.79 (btok)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/apdu.h>
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/btok.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость обмена защищенными APDU (SM): за одну операцию
+терминал устанавливает защиту команды (ответа), а КТ снимает ее.
+Длина данных команды (ответа) -- 16, 64 и 255 октетов. Варианты view
+снимают защиту на месте (btokSMCmdUnwrapView(), btokSMRespUnwrapView())
+без копирования данных.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	octet state_t[1024];	/*!< состояние SM терминала */
+	octet state_ct[1024];	/*!< состояние SM КТ */
+	octet cmd[1024];		/*!< команда */
+	octet cmd1[1024];		/*!< снятая команда */
+	octet resp[1024];		/*!< ответ */
+	octet resp1[1024];		/*!< снятый ответ */
+	octet apdu[1024];		/*!< код команды (ответа) */
+	bool_t ok;				/*!< признак успеха */
+} btok_bench_st;
+
+static void btokBenchCmd(void* arg, size_t reps)
+{
+	btok_bench_st* b = (btok_bench_st*)arg;
+	size_t count;
+	while (reps--)
+	{
+		// команда (нечетный счетчик)
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		b->ok &= btokSMCmdWrap(b->apdu, &count, (apdu_cmd_t*)b->cmd,
+			b->state_t) == ERR_OK;
+		b->ok &= btokSMCmdUnwrap((apdu_cmd_t*)b->cmd1, 0, b->apdu, count,
+			b->state_ct) == ERR_OK;
+		// пропуск ответа (четный счетчик)
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+	}
+}
+
+static void btokBenchResp(void* arg, size_t reps)
+{
+	btok_bench_st* b = (btok_bench_st*)arg;
+	size_t count;
+	while (reps--)
+	{
+		// пропуск команды (нечетный счетчик)
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		// ответ (четный счетчик)
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		b->ok &= btokSMRespWrap(b->apdu, &count, (apdu_resp_t*)b->resp,
+			b->state_ct) == ERR_OK;
+		b->ok &= btokSMRespUnwrap((apdu_resp_t*)b->resp1, 0, b->apdu, count,
+			b->state_t) == ERR_OK;
+	}
+}
+
+static void btokBenchCmdView(void* arg, size_t reps)
+{
+	btok_bench_st* b = (btok_bench_st*)arg;
+	apdu_cmd_view_t view[1];
+	size_t count;
+	while (reps--)
+	{
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		b->ok &= btokSMCmdWrap(b->apdu, &count, (apdu_cmd_t*)b->cmd,
+			b->state_t) == ERR_OK;
+		b->ok &= btokSMCmdUnwrapView(view, b->apdu, count, b->state_ct) ==
+			ERR_OK;
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+	}
+}
+
+static void btokBenchRespView(void* arg, size_t reps)
+{
+	btok_bench_st* b = (btok_bench_st*)arg;
+	apdu_resp_view_t view[1];
+	size_t count;
+	while (reps--)
+	{
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		btokSMCtrInc(b->state_t), btokSMCtrInc(b->state_ct);
+		b->ok &= btokSMRespWrap(b->apdu, &count, (apdu_resp_t*)b->resp,
+			b->state_ct) == ERR_OK;
+		b->ok &= btokSMRespUnwrapView(view, b->apdu, count, b->state_t) ==
+			ERR_OK;
+	}
+}
+
+bool_t btokBench()
+{
+	static const size_t lens[] = { 16, 64, 255 };
+	static const char* const cmd_names[] =
+	{
+		"btokBench::sm-cmd[16]",
+		"btokBench::sm-cmd[64]",
+		"btokBench::sm-cmd[255]",
+	};
+	static const char* const resp_names[] =
+	{
+		"btokBench::sm-resp[16]",
+		"btokBench::sm-resp[64]",
+		"btokBench::sm-resp[255]",
+	};
+	static const char* const cmd_view_names[] =
+	{
+		"btokBench::sm-cmd-view[16]",
+		"btokBench::sm-cmd-view[64]",
+		"btokBench::sm-cmd-view[255]",
+	};
+	static const char* const resp_view_names[] =
+	{
+		"btokBench::sm-resp-view[16]",
+		"btokBench::sm-resp-view[64]",
+		"btokBench::sm-resp-view[255]",
+	};
+	btok_bench_st* b;
+	apdu_cmd_t* cmd;
+	apdu_resp_t* resp;
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	if (!(b = (btok_bench_st*)blobCreate(sizeof(btok_bench_st))))
+		return FALSE;
+	ASSERT(btokSM_keep() <= sizeof(b->state_t));
+	btokSMStart(b->state_t, beltH());
+	btokSMStart(b->state_ct, beltH());
+	b->ok = TRUE;
+	cmd = (apdu_cmd_t*)b->cmd;
+	cmd->cla = 0x00, cmd->ins = 0xD6, cmd->p1 = 0x00, cmd->p2 = 0x00;
+	cmd->rdf_len = 0;
+	memCopy(cmd->cdf, beltH(), 255);
+	resp = (apdu_resp_t*)b->resp;
+	resp->sw1 = 0x90, resp->sw2 = 0x00;
+	memCopy(resp->rdf, beltH() + 1, 255);
+	// замеры
+	for (i = 0; i < COUNT_OF(lens); ++i)
+	{
+		cmd->cdf_len = resp->rdf_len = lens[i];
+		ret &= benchDo(cmd_names[i], "apdu", 1, btokBenchCmd, b);
+		ret &= benchDo(resp_names[i], "apdu", 1, btokBenchResp, b);
+		ret &= benchDo(cmd_view_names[i], "apdu", 1, btokBenchCmdView, b);
+		ret &= benchDo(resp_view_names[i], "apdu", 1, btokBenchRespView, b);
+	}
+	ret &= b->ok;
+	blobClose(b);
+	return ret;
+}
@@ -4,12 +4,13 @@
 \brief Tests for STB 34.101.79 (btok)
 \project bee2/test
 \created 2022.07.07
-\version 2022.12.12
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
 #include <bee2/core/err.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/mem.h>
@@ -108,6 +109,7 @@ static bool_t btokCVCTest()
 	btok_cvc_t cvc0[1];
 	btok_cvc_t cvc1[1];
 	btok_cvc_t cvc2[1];
+	btok_cvc_t cvc3[1];
 	bign_params params[1];
 	octet privkey0[64];
 	octet privkey1[48];
@@ -115,6 +117,12 @@ static bool_t btokCVCTest()
 	octet cert0[400]; size_t cert0_len;
 	octet cert1[400]; size_t cert1_len;
 	octet cert2[400]; size_t cert2_len;
+	octet cert3[400]; size_t cert3_len;
+	octet chain[1200]; size_t chain_len;
+	octet h0[1024];
+	octet h1[1024];
+	octet h2[1024];
+	size_t i;
 	// запустить ГПСЧ
 	prngEchoStart(echo, beltH(), 256);
 	// определить максимальную длину сертификата
@@ -216,6 +224,30 @@ static bool_t btokCVCTest()
 			privkey1, 48) != ERR_OK)
 		return FALSE;
 	ASSERT(cert2_len <= sizeof(cert2));
+	// выпустить cert2 повторно (пакетный выпуск)
+	{
+		void* state;
+		bool_t ok;
+		state = blobCreate(btokCVCIss_keep(64));
+		memCopy(cvc3, cvc2, sizeof(btok_cvc_t));
+		ok = state &&
+			btokCVCIssStart(state, cert1, cert1_len, privkey0, 64) ==
+				ERR_BAD_KEYPAIR &&
+			btokCVCIssStart(state, cert1, cert1_len, privkey2, 32) ==
+				ERR_BAD_KEYPAIR &&
+			btokCVCIssStart(state, cert1, cert1_len, privkey1, 48) ==
+				ERR_OK &&
+			btokCVCIssStep(cert3, &cert3_len, cvc1, state) != ERR_OK &&
+			btokCVCIssStep(0, &cert3_len, cvc3, state) == ERR_OK &&
+			cert3_len == cert2_len &&
+			btokCVCIssStep(cert3, 0, cvc3, state) == ERR_OK &&
+			btokCVCVal(cert3, cert3_len, cert1, cert1_len, 0) == ERR_OK;
+		if (state)
+			memWipe(state, btokCVCIss_keep(64));
+		blobClose(state);
+		if (!ok)
+			return FALSE;
+	}
 	// проверить сертификаты
 	if (btokCVCVal(cert1, cert1_len, cert0, cert0_len, 0) != ERR_OK ||
 		btokCVCVal(cert2, cert2_len, cert1, cert1_len, 0) != ERR_OK ||
@@ -224,6 +256,97 @@ static bool_t btokCVCTest()
 		btokCVCVal2(cvc2, cert2, cert2_len, cvc1, 0) != ERR_OK ||
 		btokCVCVal2(cvc2, cert2, cert2_len, cvc1, cvc0->until) == ERR_OK)
 		return FALSE;
+	// проверить сертификаты с кэшем
+	if (btokCVCCacheSetMax(BTOK_CVC_CACHE_MAX + 1) ||
+		!btokCVCCacheSetMax(2))
+		return FALSE;
+	for (i = 0; i < 3; ++i)
+		if (btokCVCVal2(cvc1, cert1, cert1_len, cvc0, 0) != ERR_OK ||
+			btokCVCVal2(cvc3, cert2, cert2_len, cvc1, 0) != ERR_OK ||
+			!memEq(cvc3, cvc2, sizeof(btok_cvc_t)) ||
+			btokCVCVal(cert2, cert2_len, cert1, cert1_len, 0) != ERR_OK ||
+			btokCVCVal2(cvc3, cert2, cert2_len, cvc0, 0) == ERR_OK ||
+			btokCVCVal2(cvc3, cert2, cert2_len, cvc1, cvc0->from) == ERR_OK)
+			return FALSE;
+	btokCVCCacheFlush();
+	if (btokCVCVal2(cvc3, cert2, cert2_len, cvc1, 0) != ERR_OK ||
+		!btokCVCCacheSetMax(0) ||
+		btokCVCVal2(cvc3, cert2, cert2_len, cvc1, 0) != ERR_OK)
+		return FALSE;
+	// проверить сертификаты с помощью дескрипторов
+	ASSERT(btokCVCH_keep() <= sizeof(h0));
+	if (btokCVCHStart(h0, cert0, cert0_len) != ERR_OK ||
+		btokCVCHStart(h1, cert1, cert1_len) != ERR_OK ||
+		btokCVCHStart(h2, cert2, cert2_len) != ERR_OK ||
+		btokCVCHStart(h2, cert2, cert2_len - 1) == ERR_OK ||
+		btokCVCHStart(h2, cert2, cert2_len) != ERR_OK ||
+		!memEq(btokCVCHCvc(h2), cvc2, sizeof(btok_cvc_t)))
+		return FALSE;
+	for (i = 0; i < 2; ++i)
+		if (btokCVCHVal(h0, 0, 0) != ERR_OK ||
+			btokCVCHVal(h1, h0, 0) != ERR_OK ||
+			btokCVCHVal(h2, h1, 0) != ERR_OK ||
+			btokCVCHVal(h2, h1, cvc0->until) == ERR_OK ||
+			btokCVCHVal(h2, h0, 0) == ERR_OK ||
+			btokCVCHVal(h1, 0, 0) == ERR_OK ||
+			btokCVCHMatch(h0, privkey0, 64) != ERR_OK ||
+			btokCVCHMatch(h1, privkey1, 48) != ERR_OK ||
+			btokCVCHMatch(h2, privkey2, 32) != ERR_OK ||
+			btokCVCHMatch(h2, privkey1, 48) == ERR_OK)
+			return FALSE;
+	// проверить цепочку
+	ASSERT(cert0_len + cert1_len + cert2_len <= sizeof(chain));
+	memCopy(chain, cert0, cert0_len);
+	memCopy(chain + cert0_len, cert1, cert1_len);
+	memCopy(chain + cert0_len + cert1_len, cert2, cert2_len);
+	chain_len = cert0_len + cert1_len + cert2_len;
+	if (btokCVCValChain(&i, cvc3, chain, chain_len, 0, 0) != ERR_OK ||
+		i != SIZE_MAX || !memEq(cvc3, cvc2, sizeof(btok_cvc_t)) ||
+		btokCVCValChain(0, 0, chain + cert0_len, chain_len - cert0_len,
+			cvc0, 0) != ERR_OK ||
+		btokCVCValChain(&i, 0, chain, chain_len, 0, cvc0->from) == ERR_OK ||
+		i != 2 ||
+		btokCVCValChain(&i, 0, chain, chain_len - 1, 0, 0) == ERR_OK ||
+		i != 2 ||
+		btokCVCValChain(&i, 0, chain + cert0_len, chain_len - cert0_len,
+			cvc1, 0) == ERR_OK || i != 0)
+		return FALSE;
+	// загрузить цепочку в хранилище
+	{
+		void* store;
+		void* h;
+		void* ha;
+		bool_t ok;
+		store = blobCreate(btokCVCStore_keep(3, chain_len));
+		ok = store &&
+			btokCVCStoreCount(chain, chain_len) == 3 &&
+			btokCVCStoreCount(chain, chain_len - 1) == SIZE_MAX &&
+			btokCVCStoreStart(store, chain, chain_len) == ERR_OK &&
+			(h = btokCVCStoreFind(store, cert2, cert2_len)) != 0 &&
+			btokCVCStoreFind(store, cert2, cert2_len - 1) == 0 &&
+			memEq(btokCVCHCvc(h), cvc2, sizeof(btok_cvc_t)) &&
+			btokCVCStoreByHolder(store, cvc2->holder, 0) == h &&
+			btokCVCStoreByHolder(store, cvc2->holder, h) == 0 &&
+			btokCVCStoreByHolder(store, "BYCA99999999", 0) == 0 &&
+			(ha = btokCVCStoreByHolder(store, cvc2->authority, 0)) != 0 &&
+			btokCVCStoreFind(store, cert1, cert1_len) == ha &&
+			btokCVCStoreByAuthority(store, cvc1->holder, 0) == h &&
+			btokCVCHVal(h, ha, 0) == ERR_OK &&
+			(ha = btokCVCStoreByHolder(store, cvc1->authority, 0)) != 0 &&
+			btokCVCStoreByAuthority(store, cvc1->authority, 0) == ha &&
+			btokCVCStoreByAuthority(store, cvc1->authority, ha) ==
+				btokCVCStoreFind(store, cert1, cert1_len) &&
+			btokCVCStoreByAuthority(store, cvc1->authority,
+				btokCVCStoreFind(store, cert1, cert1_len)) == 0 &&
+			btokCVCHVal(ha, 0, 0) == ERR_OK;
+		blobClose(store);
+		if (!ok)
+			return FALSE;
+	}
+	chain[cert0_len + cert1_len - 1] ^= 1;
+	if (btokCVCValChain(&i, 0, chain, chain_len, 0, 0) == ERR_OK ||
+		i != 1)
+		return FALSE;
 	// все хорошо
 	return TRUE;
 }
@@ -326,6 +449,60 @@ static bool_t btokSMTest()
 		size != sizeof(apdu_resp_t) + 20 ||
 		!memEq(resp, resp1, size))
 		return FALSE;
+	// снятие защиты на месте
+	{
+		apdu_cmd_view_t cv[1];
+		apdu_resp_view_t rv[1];
+		octet apdu1[64];
+		// без защиты
+		if (btokSMCmdWrap(apdu, &count, cmd, 0) != ERR_OK ||
+			btokSMCmdUnwrapView(cv, apdu, count, 0) != ERR_OK ||
+			cv->cdf != apdu + 5 || cv->cdf_len != 4 ||
+			cv->rdf_len != 256 || !memEq(cv->cdf, cmd->cdf, 4) ||
+			btokSMRespWrap(apdu, &count, resp, 0) != ERR_OK ||
+			btokSMRespUnwrapView(rv, apdu, count, 0) != ERR_OK ||
+			rv->rdf != apdu || rv->rdf_len != 20 ||
+			!memEq(rv->rdf, resp->rdf, 20))
+			return FALSE;
+		// команда
+		btokSMCtrInc(state_t), btokSMCtrInc(state_ct);
+		if (btokSMCmdWrap(apdu, &count, cmd, state_t) != ERR_OK ||
+			btokSMCmdUnwrapView(0, apdu, count, state_ct) != ERR_OK ||
+			btokSMCmdUnwrapView(cv, apdu, count, state_ct) != ERR_OK ||
+			cv->cla != cmd->cla || cv->ins != cmd->ins ||
+			cv->p1 != cmd->p1 || cv->p2 != cmd->p2 ||
+			cv->rdf_len != cmd->rdf_len || cv->cdf_len != cmd->cdf_len ||
+			cv->cdf < apdu || cv->cdf + cv->cdf_len > apdu + count ||
+			!memEq(cv->cdf, cmd->cdf, cmd->cdf_len))
+			return FALSE;
+		// ответ
+		btokSMCtrInc(state_ct), btokSMCtrInc(state_t);
+		if (btokSMRespWrap(apdu, &count, resp, state_ct) != ERR_OK ||
+			btokSMRespUnwrapView(0, apdu, count, state_t) != ERR_OK ||
+			btokSMRespUnwrapView(rv, apdu, count, state_t) != ERR_OK ||
+			rv->sw1 != resp->sw1 || rv->sw2 != resp->sw2 ||
+			rv->rdf_len != resp->rdf_len ||
+			rv->rdf < apdu || rv->rdf + rv->rdf_len > apdu + count ||
+			!memEq(rv->rdf, resp->rdf, resp->rdf_len))
+			return FALSE;
+		// нарушение целостности команды
+		btokSMCtrInc(state_t), btokSMCtrInc(state_ct);
+		if (btokSMCmdWrap(apdu, &count, cmd, state_t) != ERR_OK)
+			return FALSE;
+		apdu[count - 2] ^= 1;
+		if (btokSMCmdUnwrapView(cv, apdu, count, state_ct) != ERR_BAD_MAC)
+			return FALSE;
+		// нарушение целостности ответа: код не изменяется
+		btokSMCtrInc(state_ct), btokSMCtrInc(state_t);
+		if (btokSMRespWrap(apdu, &count, resp, state_ct) != ERR_OK)
+			return FALSE;
+		ASSERT(count <= sizeof(apdu1));
+		apdu[count - 3] ^= 1;
+		memCopy(apdu1, apdu, count);
+		if (btokSMRespUnwrapView(rv, apdu, count, state_t) != ERR_BAD_MAC ||
+			!memEq(apdu, apdu1, count))
+			return FALSE;
+	}
 	// защита команд и ответов: сочетания длин
 	cmd->cla = 0x00, cmd->ins = 0xA4, cmd->p1 = 0x04, cmd->p2 = 0x04;
 	for (cmd->cdf_len = 0; cmd->cdf_len <= 257; ++cmd->cdf_len)
@@ -353,6 +530,46 @@ static bool_t btokSMTest()
 			if (!memEq(resp, resp1, size))
 				return FALSE;
 		}
+	// защита цепочки команд
+	{
+		const apdu_cmd_t* cmds[3];
+		apdu_cmd_t* cmds1[3];
+		size_t counts[3];
+		cmd->cdf_len = 100, cmd->rdf_len = 0;
+		memCopy(cmd->cdf, beltH(), 100);
+		cmds[0] = cmds[1] = cmds[2] = cmd;
+		cmds1[0] = cmd1;
+		cmds1[1] = (apdu_cmd_t*)(stack + 1024 + 512);
+		cmds1[2] = (apdu_cmd_t*)(stack + 3 * 1024);
+		if (btokSMCmdWrapChain(0, counts, cmds, 3, state_t) != ERR_OK ||
+			btokSMCmdWrap(0, &count, cmd, state_t) != ERR_OK ||
+			counts[0] != count || counts[1] != count || counts[2] != count ||
+			btokSMCmdWrapChain(apdu, counts, cmds, 3, state_t) != ERR_OK ||
+			btokSMCmdUnwrapChain(cmds1, apdu, counts, 3, state_ct) != ERR_OK ||
+			!memEq(cmd, cmds1[0], sizeof(apdu_cmd_t) + 100) ||
+			!memEq(cmd, cmds1[1], sizeof(apdu_cmd_t) + 100) ||
+			!memEq(cmd, cmds1[2], sizeof(apdu_cmd_t) + 100) ||
+			memEq(apdu, apdu + count, count) ||
+			btokSMCmdWrapChain(apdu, counts, cmds, 3, state_t) != 
+				ERR_BAD_LOGIC)
+			return FALSE;
+		// ответ на последнюю команду
+		resp->rdf_len = 20;
+		btokSMCtrInc(state_ct);
+		if (btokSMRespWrap(apdu, &count, resp, state_ct) != ERR_OK)
+			return FALSE;
+		btokSMCtrInc(state_t);
+		if (btokSMRespUnwrap(resp1, &size, apdu, count, state_t) != ERR_OK ||
+			!memEq(resp, resp1, size))
+			return FALSE;
+		// нарушение целостности
+		if (btokSMCmdWrapChain(apdu, counts, cmds, 3, state_t) != ERR_OK)
+			return FALSE;
+		apdu[counts[0] + 20] ^= 1;
+		if (btokSMCmdUnwrapChain(cmds1, apdu, counts, 3, state_ct) != 
+			ERR_BAD_MAC)
+			return FALSE;
+	}
 	// все хорошо
 	return TRUE;
 }
@@ -417,9 +634,12 @@ bool_t btokBAUTHTest()
 	bake_cert certb[1];
 	octet keya[32];
 	octet keyb[32];
+	octet key0[32];
 	octet statea[20000];
 	octet stateb[20000];
+	octet ctx[20000];
 	octet buf[1000];
+	size_t i;
 	// загрузить долговременные параметры
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK)
 		return FALSE;
@@ -470,6 +690,34 @@ bool_t btokBAUTHTest()
 		btokBAuthTStepG(keya, statea) != ERR_OK ||
 		!memEq(keya, keyb, 32))
 		return FALSE;
+	memCopy(key0, keya, 32);
+	// контекст терминала
+	ASSERT(btokBAuthTCtx_keep(params->l) <= sizeof(ctx));
+	if (btokBAuthTCtxStart(ctx, params, da, certa) != ERR_OK)
+		return FALSE;
+	// несколько сеансов в контексте
+	for (i = 0; i < 3; ++i)
+	{
+		memSetZero(statea, sizeof(statea));
+		memSetZero(stateb, sizeof(stateb));
+		memSetZero(keya, sizeof(keya));
+		memSetZero(keyb, sizeof(keyb));
+		prngEchoStart(echoa, beltH(), 128);
+		prngEchoStart(echob, beltH() + 128, 128);
+		if (btokBAuthTCtxSession(statea, ctx, settingsa) != ERR_OK ||
+			btokBAuthCTStart(stateb, params, settingsb, db, certb) != ERR_OK)
+			return FALSE;
+		if (btokBAuthCTStep2(buf, certa, stateb) != ERR_OK ||
+			btokBAuthTStep3(buf, buf, statea) != ERR_OK ||
+			btokBAuthCTStep4(buf, buf, stateb) != ERR_OK ||
+			btokBAuthTStep5(buf, 8 + 32 + certb->len,
+				bakeTestCertVal, statea) != ERR_OK)
+			return FALSE;
+		if (btokBAuthCTStepG(keyb, stateb) != ERR_OK ||
+			btokBAuthTStepG(keya, statea) != ERR_OK ||
+			!memEq(keya, keyb, 32) || !memEq(keya, key0, 32))
+			return FALSE;
+	}
 	// очистка
 	memSetZero(statea, sizeof(statea));
 	memSetZero(stateb, sizeof(stateb));
@@ -0,0 +1,200 @@
+/*
+*******************************************************************************
+\file dstu_bench.c
+\brief Benchmarks for DSTU 4145-2002 (Ukraine)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/dstu.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость выработки и проверки подписи на кривых 257pb и 431pb.
+Базовые точки кривых генерируются. Замеры выполняются без контекста
+(sign, verify) и в контексте (ctx-sign, ctx-verify). Кроме того,
+замеряется проверка подписи по сжатому открытому ключу: с восстановлением
+ключа (recover-verify) и пакетная проверка в контексте (ctx-verify-batch).
+*******************************************************************************
+*/
+
+#define DSTU_BENCH_BATCH 16
+
+typedef struct
+{
+	dstu_params params[1];			/*!< долговременные параметры */
+	octet combo_state[256];			/*!< состояние генератора */
+	octet privkey[DSTU_SIZE];		/*!< личный ключ */
+	octet pubkey[2 * DSTU_SIZE];	/*!< открытый ключ */
+	octet xpubkeys[DSTU_BENCH_BATCH * DSTU_SIZE];	/*!< сжатые ключи */
+	octet hashes[DSTU_BENCH_BATCH][32];	/*!< хэш-значения */
+	octet sigs[DSTU_BENCH_BATCH][2 * DSTU_SIZE];	/*!< подписи */
+	octet hash[32];					/*!< хэш-значение */
+	octet sig[2 * DSTU_SIZE];		/*!< подпись */
+	size_t ld;						/*!< длина подписи в битах */
+	void* ctx;						/*!< контекст */
+	err_t code;						/*!< код ошибки */
+} dstu_bench_st;
+
+static void dstuBenchSign(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = dstuSign(b->sig, b->params, b->ld, b->hash,
+			sizeof(b->hash), b->privkey, prngCOMBOStepR, b->combo_state);
+}
+
+static void dstuBenchVerify(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = dstuVerify(b->params, b->ld, b->hash, sizeof(b->hash),
+			b->sig, b->pubkey);
+}
+
+static void dstuBenchCtxSign(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = dstuCtxSign(b->sig, b->ctx, b->ld, b->hash,
+			sizeof(b->hash), b->privkey, prngCOMBOStepR, b->combo_state);
+}
+
+static void dstuBenchCtxVerify(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = dstuCtxVerify(b->ctx, b->ld, b->hash, sizeof(b->hash),
+			b->sig, b->pubkey);
+}
+
+static void dstuBenchRecoverVerify(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	octet pubkey[2 * DSTU_SIZE];
+	size_t i;
+	while (reps-- && b->code == ERR_OK)
+		for (i = 0; i < DSTU_BENCH_BATCH && b->code == ERR_OK; ++i)
+		{
+			b->code = dstuRecoverPoint(pubkey, b->params,
+				b->xpubkeys + i * O_OF_B(b->params->p[0]));
+			if (b->code == ERR_OK)
+				b->code = dstuVerify(b->params, b->ld, b->hashes[i],
+					sizeof(b->hashes[i]), b->sigs[i], pubkey);
+		}
+}
+
+static void dstuBenchCtxVerifyBatch(void* arg, size_t reps)
+{
+	dstu_bench_st* b = (dstu_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = dstuCtxVerifyBatch(b->ctx, b->ld, DSTU_BENCH_BATCH,
+			b->hashes[0], sizeof(b->hashes[0]), b->sigs[0], b->xpubkeys,
+			0);
+}
+
+bool_t dstuBench()
+{
+	static const struct
+	{
+		const char* params;
+		const char* sign;
+		const char* verify;
+		const char* ctx_sign;
+		const char* ctx_verify;
+		const char* recover_verify;
+		const char* ctx_verify_batch;
+	} curves[] =
+	{
+		{
+			"1.2.804.2.1.1.1.1.3.1.1.1.2.6",
+			"dstuBench::sign[257pb]", "dstuBench::verify[257pb]",
+			"dstuBench::ctx-sign[257pb]", "dstuBench::ctx-verify[257pb]",
+			"dstuBench::recover-verify[257pb]",
+			"dstuBench::ctx-verify-batch[257pb]",
+		},
+		{
+			"1.2.804.2.1.1.1.1.3.1.1.1.2.9",
+			"dstuBench::sign[431pb]", "dstuBench::verify[431pb]",
+			"dstuBench::ctx-sign[431pb]", "dstuBench::ctx-verify[431pb]",
+			"dstuBench::recover-verify[431pb]",
+			"dstuBench::ctx-verify-batch[431pb]",
+		},
+	};
+	dstu_bench_st* b;
+	bool_t ret = TRUE;
+	size_t i, j;
+	// подготовить объекты
+	if (!(b = (dstu_bench_st*)blobCreate(sizeof(dstu_bench_st))))
+		return FALSE;
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->hash, sizeof(b->hash), b->combo_state);
+	b->ld = B_OF_O(2 * DSTU_SIZE);
+	// цикл по кривым
+	for (i = 0; i < COUNT_OF(curves); ++i)
+	{
+		b->code = ERR_OK;
+		if (dstuStdParams(b->params, curves[i].params) != ERR_OK ||
+			dstuGenPoint(b->params->P, b->params, prngCOMBOStepR,
+				b->combo_state) != ERR_OK ||
+			dstuGenKeypair(b->privkey, b->pubkey, b->params,
+				prngCOMBOStepR, b->combo_state) != ERR_OK ||
+			dstuSign(b->sig, b->params, b->ld, b->hash, sizeof(b->hash),
+				b->privkey, prngCOMBOStepR, b->combo_state) != ERR_OK)
+		{
+			blobClose(b);
+			return FALSE;
+		}
+		// пакет
+		for (j = 0; j < DSTU_BENCH_BATCH; ++j)
+		{
+			octet privkey[DSTU_SIZE];
+			octet pubkey[2 * DSTU_SIZE];
+			prngCOMBOStepR(b->hashes[j], sizeof(b->hashes[j]),
+				b->combo_state);
+			if (dstuGenKeypair(privkey, pubkey, b->params, prngCOMBOStepR,
+					b->combo_state) != ERR_OK ||
+				dstuSign(b->sigs[j], b->params, b->ld, b->hashes[j],
+					sizeof(b->hashes[j]), privkey, prngCOMBOStepR,
+					b->combo_state) != ERR_OK ||
+				dstuCompressPoint(b->xpubkeys + j * O_OF_B(b->params->p[0]),
+					b->params, pubkey) != 
+					ERR_OK)
+			{
+				blobClose(b);
+				return FALSE;
+			}
+		}
+		ret &= benchDo(curves[i].sign, "op", 1, dstuBenchSign, b);
+		ret &= benchDo(curves[i].verify, "op", 1, dstuBenchVerify, b);
+		// контекст
+		if (!(b->ctx = blobCreate(dstuCtx_keep(b->params->p[0]))) ||
+			dstuCtxStart(b->ctx, b->params) != ERR_OK)
+		{
+			blobClose(b->ctx), blobClose(b);
+			return FALSE;
+		}
+		ret &= benchDo(curves[i].ctx_sign, "op", 1, dstuBenchCtxSign, b);
+		ret &= benchDo(curves[i].ctx_verify, "op", 1, dstuBenchCtxVerify, b);
+		ret &= benchDo(curves[i].recover_verify, "op", DSTU_BENCH_BATCH,
+			dstuBenchRecoverVerify, b);
+		ret &= benchDo(curves[i].ctx_verify_batch, "op", DSTU_BENCH_BATCH,
+			dstuBenchCtxVerifyBatch, b);
+		blobClose(b->ctx);
+		ret &= b->code == ERR_OK;
+	}
+	blobClose(b);
+	return ret;
+}
@@ -4,12 +4,14 @@
 \brief Tests for DSTU 4145-2002 (Ukraine)
 \project bee2/test
 \created 2012.03.01
-\version 2016.07.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/prng.h>
@@ -32,11 +34,142 @@ COMBO-генератор
 -#	Дополнительно проверяются кривые в полиномиальном базисе, заданные 
 	в приложении Г.
 
+Функции dstuCtxXXX() сравниваются с функциями dstuXXX(): при одинаковых
+выходах генератора результаты должны совпадать.
+
+Пакетная проверка подписи сравнивается с поэлементной. Число подписей
+в пакете больше размера порции, на которые пакет разбивается при проверке.
+
 \warning Ошибка в примере Б.1: x-координата открытого ключа должна 
 заканчиваться на ...BDC2DA (в примере BD2DA)
 *******************************************************************************
 */
 
+static bool_t dstuTestCtx(const dstu_params* params, const octet d[],
+	const octet k[], size_t ld, const octet hash[], size_t hash_len)
+{
+	const size_t order_no = memNonZeroSize(params->n, O_OF_B(params->p[0]));
+	octet privkey[2][DSTU_SIZE];
+	octet pubkey[2][2 * DSTU_SIZE];
+	octet sig[2][2 * DSTU_SIZE];
+	octet echo[256];
+	void* ctx;
+	bool_t ret;
+	// создать контекст
+	if (!(ctx = blobCreate(dstuCtx_keep(params->p[0]))))
+		return FALSE;
+	if (dstuCtxStart(ctx, params) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// ключи
+	ASSERT(sizeof(echo) >= prngEcho_keep());
+	prngEchoStart(echo, d, order_no);
+	ret = dstuCtxGenKeypair(privkey[0], pubkey[0], ctx, prngEchoStepR,
+		echo) == ERR_OK;
+	prngEchoStart(echo, d, order_no);
+	ret = ret && dstuGenKeypair(privkey[1], pubkey[1], params, 
+		prngEchoStepR, echo) == ERR_OK &&
+		memEq(privkey[0], privkey[1], order_no) &&
+		memEq(pubkey[0], pubkey[1], 2 * O_OF_B(params->p[0]));
+	// подписи
+	prngEchoStart(echo, k, order_no);
+	ret = ret && dstuCtxSign(sig[0], ctx, ld, hash, hash_len, privkey[0],
+		prngEchoStepR, echo) == ERR_OK;
+	prngEchoStart(echo, k, order_no);
+	ret = ret && dstuSign(sig[1], params, ld, hash, hash_len, privkey[0],
+		prngEchoStepR, echo) == ERR_OK &&
+		memEq(sig[0], sig[1], O_OF_B(ld));
+	// проверка подписей
+	ret = ret && 
+		dstuCtxVerify(ctx, ld, hash, hash_len, sig[0], pubkey[0]) == 
+			ERR_OK &&
+		(sig[0][0] ^= 1, dstuCtxVerify(ctx, ld, hash, hash_len, sig[0],
+			pubkey[0]) == ERR_BAD_SIG);
+	// завершение
+	blobClose(ctx);
+	return ret;
+}
+
+static bool_t dstuTestBatch(const dstu_params* params, size_t ld,
+	octet combo_state[])
+{
+	const size_t count = 21;
+	const size_t no = O_OF_B(params->p[0]);
+	octet privkey[DSTU_SIZE];
+	octet pubkey[2 * DSTU_SIZE];
+	octet points[3 * 2 * DSTU_SIZE];
+	octet valid[1];
+	octet* hashes;
+	octet* sigs;
+	octet* xpubkeys;
+	err_t* codes;
+	void* ctx;
+	void* state;
+	bool_t ret = TRUE;
+	size_t i;
+	// создать состояние
+	state = blobCreate(count * (32 + O_OF_B(ld) + no + sizeof(err_t)));
+	ctx = blobCreate(dstuCtx_keep(params->p[0]));
+	if (!state || !ctx || dstuCtxStart(ctx, params) != ERR_OK)
+	{
+		blobClose(ctx), blobClose(state);
+		return FALSE;
+	}
+	codes = (err_t*)state;
+	hashes = (octet*)(codes + count);
+	sigs = hashes + count * 32;
+	xpubkeys = sigs + count * O_OF_B(ld);
+	// подписать
+	for (i = 0; ret && i < count; ++i)
+	{
+		combo_rng(hashes + i * 32, 32, combo_state);
+		ret = dstuGenKeypair(privkey, pubkey, params, combo_rng,
+			combo_state) == ERR_OK &&
+			dstuSign(sigs + i * O_OF_B(ld), params, ld, hashes + i * 32, 32,
+				privkey, combo_rng, combo_state) == ERR_OK &&
+			dstuCompressPoint(xpubkeys + i * no, params, pubkey) == ERR_OK;
+	}
+	// проверить все подписи
+	ret = ret &&
+		dstuVerifyBatch(params, ld, count, hashes, 32, sigs, xpubkeys,
+			0) == ERR_OK &&
+		dstuCtxVerifyBatch(ctx, ld, count, hashes, 32, sigs, xpubkeys,
+			codes) == ERR_OK;
+	for (i = 0; ret && i < count; ++i)
+		ret = codes[i] == ERR_OK;
+	// испортить подпись
+	sigs[17 * O_OF_B(ld)] ^= 1;
+	ret = ret &&
+		dstuVerifyBatch(params, ld, count, hashes, 32, sigs, xpubkeys,
+			0) == ERR_BAD_SIG &&
+		dstuCtxVerifyBatch(ctx, ld, count, hashes, 32, sigs, xpubkeys,
+			codes) == ERR_BAD_SIG;
+	for (i = 0; ret && i < count; ++i)
+	{
+		ret = codes[i] == (i == 17 ? ERR_BAD_SIG : ERR_OK);
+		// сравнить с поэлементной проверкой
+		ret = ret && 
+			dstuRecoverPoint(pubkey, params, xpubkeys + i * no) == ERR_OK &&
+			dstuVerify(params, ld, hashes + i * 32, 32, sigs + i * O_OF_B(ld),
+				pubkey) == codes[i];
+	}
+	// проверить точки: (pubkey, P, искаженный pubkey)
+	memCopy(points, pubkey, 2 * no);
+	memCopy(points + 2 * no, params->P, 2 * no);
+	memCopy(points + 4 * no, pubkey, 2 * no);
+	points[4 * no] ^= 1;
+	ret = ret &&
+		dstuValPointBatch(valid, params, 3, points) == ERR_BAD_POINT &&
+		valid[0] == 3 &&
+		dstuValPointBatch(valid, params, 2, points) == ERR_OK &&
+		valid[0] == 3;
+	// завершение
+	blobClose(ctx), blobClose(state);
+	return ret;
+}
+
 bool_t dstuTest()
 {
 	dstu_params params[1];
@@ -85,6 +218,9 @@ bool_t dstuTest()
 			"00000000000000000000000274EA2C0C"
 			"AA014A0D80A424F59ADE7A93068D08A7"))
 		return FALSE;
+	// тест Б.1 [контекст]
+	if (!dstuTestCtx(params, privkey, buf, ld, hash, 21))
+		return FALSE;
 	// тест Б.1 [проверка ЭЦП]
 	if (dstuVerify(params, ld, hash, 21, sig, pubkey) != ERR_OK)
 		return FALSE;
@@ -94,6 +230,9 @@ bool_t dstuTest()
 	// создать генератор COMBO
 	ASSERT(sizeof(state) >= prngCOMBO_keep());
 	prngCOMBOStart(state, utilNonce32());
+	// тест Б.1 [пакетная проверка]
+	if (!dstuTestBatch(params, ld, state))
+		return FALSE;
 	// максимальная длина ЭЦП
 	ld = B_OF_O(2 * DSTU_SIZE);
 	// сгенерировать hash
@@ -236,6 +375,13 @@ bool_t dstuTest()
 		dstuVerify(params, ld, hash, 32, sig, pubkey) != ERR_OK ||
 		(sig[0] ^= 1, dstuVerify(params, ld, hash, 32, sig, pubkey) == ERR_OK))
 		return FALSE;
+	// контекст на кривой dstu_431pb
+	combo_rng(buf, sizeof(buf), state);
+	if (!dstuTestCtx(params, privkey, buf, ld, hash, 32))
+		return FALSE;
+	// пакетная проверка на кривой dstu_431pb
+	if (!dstuTestBatch(params, ld, state))
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
@@ -0,0 +1,155 @@
+/*
+*******************************************************************************
+\file eng_bench.c
+\brief Benchmarks for engines
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bign.h>
+#include <bee2/crypto/eng.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Высокоуровневые функции, перехватываемые движками, замеряются без движка
+(none) и с эталонным движком (soft). Разница между none и soft --
+накладные расходы на обращение к движку. Замеры soft служат точкой
+отсчета для сравнения с внешними движками. Подпись и общий ключ
+замеряются на уровне стойкости 128.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	bign_params params[1];	/*!< долговременные параметры */
+	octet combo_state[256];	/*!< состояние генератора */
+	octet oid_der[16];		/*!< DER-код идентификатора хэш-алгоритма */
+	size_t oid_len;			/*!< длина oid_der */
+	octet privkey[32];		/*!< личный ключ */
+	octet pubkey[64];		/*!< открытый ключ */
+	octet hash[32];			/*!< хэш-значение */
+	octet sig[48];			/*!< подпись */
+	octet key[32];			/*!< ключ */
+	octet buf[1024];		/*!< данные */
+	err_t code;				/*!< код ошибки */
+} eng_bench_st;
+
+static void engBenchSetCode(eng_bench_st* b, err_t code)
+{
+	if (b->code == ERR_OK)
+		b->code = code;
+}
+
+static void engBenchECB(void* arg, size_t reps)
+{
+	eng_bench_st* b = (eng_bench_st*)arg;
+	while (reps--)
+		engBenchSetCode(b, beltECBEncr(b->buf, b->buf, sizeof(b->buf),
+			b->key, 32));
+}
+
+static void engBenchHash(void* arg, size_t reps)
+{
+	eng_bench_st* b = (eng_bench_st*)arg;
+	while (reps--)
+		engBenchSetCode(b, beltHash(b->hash, b->buf, sizeof(b->buf)));
+}
+
+static void engBenchSign(void* arg, size_t reps)
+{
+	eng_bench_st* b = (eng_bench_st*)arg;
+	while (reps--)
+		engBenchSetCode(b, bignSign(b->sig, b->params, b->oid_der,
+			b->oid_len, b->hash, b->privkey, prngCOMBOStepR, b->combo_state));
+}
+
+static void engBenchVerify(void* arg, size_t reps)
+{
+	eng_bench_st* b = (eng_bench_st*)arg;
+	while (reps--)
+		engBenchSetCode(b, bignVerify(b->params, b->oid_der, b->oid_len,
+			b->hash, b->sig, b->pubkey));
+}
+
+static void engBenchDH(void* arg, size_t reps)
+{
+	eng_bench_st* b = (eng_bench_st*)arg;
+	while (reps--)
+		engBenchSetCode(b, bignDH(b->key, b->params, b->privkey, b->pubkey,
+			32));
+}
+
+bool_t engBench()
+{
+	static const struct
+	{
+		const char* name;
+		const char* ecb;
+		const char* hash;
+		const char* sign;
+		const char* verify;
+		const char* dh;
+	} engs[] =
+	{
+		{
+			0,
+			"engBench::belt-ecb[none]", "engBench::belt-hash[none]",
+			"engBench::bign-sign[none]", "engBench::bign-verify[none]",
+			"engBench::bign-dh[none]",
+		},
+		{
+			"soft",
+			"engBench::belt-ecb[soft]", "engBench::belt-hash[soft]",
+			"engBench::bign-sign[soft]", "engBench::bign-verify[soft]",
+			"engBench::bign-dh[soft]",
+		},
+	};
+	eng_bench_st b[1];
+	const eng_t* active;
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->hash, sizeof(b->hash), b->combo_state);
+	prngCOMBOStepR(b->buf, sizeof(b->buf), b->combo_state);
+	prngCOMBOStepR(b->key, sizeof(b->key), b->combo_state);
+	b->oid_len = sizeof(b->oid_der);
+	if (bignOidToDER(b->oid_der, &b->oid_len,
+			"1.2.112.0.2.0.34.101.31.81") != ERR_OK ||
+		bignStdParams(b->params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
+		bignGenKeypair(b->privkey, b->pubkey, b->params, prngCOMBOStepR,
+			b->combo_state) != ERR_OK ||
+		bignSign(b->sig, b->params, b->oid_der, b->oid_len, b->hash,
+			b->privkey, prngCOMBOStepR, b->combo_state) != ERR_OK)
+		return FALSE;
+	// цикл по движкам
+	active = engActive();
+	for (i = 0; i < COUNT_OF(engs); ++i)
+	{
+		b->code = engSelect(engs[i].name);
+		if (b->code != ERR_OK)
+			break;
+		ret &= benchDo(engs[i].ecb, "B", sizeof(b->buf), engBenchECB, b);
+		ret &= benchDo(engs[i].hash, "B", sizeof(b->buf), engBenchHash, b);
+		ret &= benchDo(engs[i].sign, "op", 1, engBenchSign, b);
+		ret &= benchDo(engs[i].verify, "op", 1, engBenchVerify, b);
+		ret &= benchDo(engs[i].dh, "op", 1, engBenchDH, b);
+		if (b->code != ERR_OK)
+			break;
+	}
+	// восстановить движок
+	ret &= engSelect(active ? active->name : 0) == ERR_OK;
+	return ret && b->code == ERR_OK;
+}
@@ -0,0 +1,251 @@
+/*
+*******************************************************************************
+\file eng_test.c
+\brief Tests for engines
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/hex.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/rng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bign.h>
+#include <bee2/crypto/eng.h>
+
+/*
+*******************************************************************************
+Тестовый движок
+
+Перехватчики тестового движка считают обращения и передают управление
+эталонному движку. Перехватчик bign_dh отказывается обслуживать
+уровень стойкости 256 (ERR_NOT_IMPLEMENTED). Источник случайности
+выдает повторяющийся октет.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	size_t calls;		/*!< число обращений к перехватчикам */
+	size_t reads;		/*!< число обращений к источнику */
+} eng_test_st;
+
+static err_t engTestECBEncr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len)
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->belt_ecb_encr(0, dest, src, count, key, len);
+}
+
+static err_t engTestECBDecr(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len)
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->belt_ecb_decr(0, dest, src, count, key, len);
+}
+
+static err_t engTestCTR(void* state, void* dest, const void* src,
+	size_t count, const octet key[], size_t len, const octet iv[16])
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->belt_ctr(0, dest, src, count, key, len, iv);
+}
+
+static err_t engTestHash(void* state, octet hash[32], const void* src,
+	size_t count)
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->belt_hash(0, hash, src, count);
+}
+
+static err_t engTestSign(void* state, octet sig[], const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet privkey[], gen_i rng, void* rng_state)
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->bign_sign(0, sig, params, oid_der, oid_len, hash,
+		privkey, rng, rng_state);
+}
+
+static err_t engTestVerify(void* state, const bign_params* params,
+	const octet oid_der[], size_t oid_len, const octet hash[],
+	const octet sig[], const octet pubkey[])
+{
+	++((eng_test_st*)state)->calls;
+	return engSoft()->bign_verify(0, params, oid_der, oid_len, hash, sig,
+		pubkey);
+}
+
+static err_t engTestDH(void* state, octet key[], const bign_params* params,
+	const octet privkey[], const octet pubkey[], size_t key_len)
+{
+	++((eng_test_st*)state)->calls;
+	if (params->l == 256)
+		return ERR_NOT_IMPLEMENTED;
+	return engSoft()->bign_dh(0, key, params, privkey, pubkey, key_len);
+}
+
+static err_t engTestRead(size_t* read, void* buf, size_t count, void* file)
+{
+	++((eng_test_st*)file)->reads;
+	memSet(buf, 0x5A, count);
+	*read = count;
+	return ERR_OK;
+}
+
+/*
+*******************************************************************************
+Самотестирование
+*******************************************************************************
+*/
+
+bool_t engTest()
+{
+	eng_test_st st[1];
+	eng_t eng[1];
+	bign_params params[1];
+	octet combo_state[256];
+	octet oid_der[16];
+	size_t oid_len = sizeof(oid_der);
+	octet privkey[64];
+	octet pubkey[128];
+	octet buf[64];
+	octet buf1[64];
+	octet sig[96];
+	octet sig1[96];
+	octet hash[32];
+	// подготовить память
+	if (sizeof(combo_state) < prngCOMBO_keep())
+		return FALSE;
+	// движок
+	memSetZero(st, sizeof(st));
+	memSetZero(eng, sizeof(eng));
+	eng->name = "test";
+	eng->state = st;
+	eng->belt_ecb_encr = engTestECBEncr;
+	eng->belt_ecb_decr = engTestECBDecr;
+	eng->belt_ctr = engTestCTR;
+	eng->belt_hash = engTestHash;
+	eng->bign_sign = engTestSign;
+	eng->bign_verify = engTestVerify;
+	eng->bign_dh = engTestDH;
+	eng->rng_read = engTestRead;
+	// регистрация
+	if (engActive() != 0 ||
+		engReg(eng) != ERR_OK ||
+		engReg(eng) != ERR_BAD_INPUT ||
+		engReg(engSoft()) != ERR_BAD_INPUT ||
+		engSelect("none") != ERR_BAD_INPUT ||
+		engActive() != 0)
+		return FALSE;
+	eng->name = "";
+	if (engReg(eng) != ERR_BAD_INPUT)
+		return FALSE;
+	eng->name = "test";
+	// назначение
+	if (engSelect("test") != ERR_OK ||
+		engActive() != eng ||
+		st->reads == 0 ||
+		!rngIsValid())
+		return FALSE;
+	// belt-ecb: тест A.9-1
+	if (beltECBEncr(buf, beltH(), 48, beltH() + 128, 32) != ERR_OK ||
+		!hexEq(buf,
+		"69CCA1C93557C9E3D66BC3E0FA88FA6E"
+		"5F23102EF109710775017F73806DA9DC"
+		"46FB2ED2CE771F26DCB5E5D1569F9AB0") ||
+		beltECBDecr(buf, buf, 48, beltH() + 128, 32) != ERR_OK ||
+		!memEq(buf, beltH(), 48) ||
+		st->calls != 2)
+		return FALSE;
+	// belt-ctr: совпадение с программной реализацией
+	if (beltCTR(buf, beltH(), 48, beltH() + 128, 32, beltH() + 192) !=
+			ERR_OK ||
+		engSelect(0) != ERR_OK ||
+		engActive() != 0 ||
+		beltCTR(buf1, beltH(), 48, beltH() + 128, 32, beltH() + 192) !=
+			ERR_OK ||
+		!memEq(buf, buf1, 48) ||
+		st->calls != 3)
+		return FALSE;
+	// belt-hash: без движка, с движком
+	if (beltHash(buf, beltH(), 13) != ERR_OK ||
+		engSelect("test") != ERR_OK ||
+		beltHash(buf1, beltH(), 13) != ERR_OK ||
+		!memEq(buf, buf1, 32) ||
+		st->calls != 4)
+		return FALSE;
+	// belt-mac: перехватчика нет
+	if (beltMAC(buf, beltH(), 13, beltH() + 128, 32) != ERR_OK ||
+		!hexEq(buf, "7260DA60138F96C9") ||
+		st->calls != 4)
+		return FALSE;
+	// ошибка в перехватчике возвращается вызывающей стороне
+	if (beltECBEncr(buf, beltH(), 15, beltH() + 128, 32) != ERR_BAD_INPUT ||
+		st->calls != 5)
+		return FALSE;
+	// bign: подпись с движком и без движка
+	prngCOMBOStart(combo_state, utilNonce32());
+	prngCOMBOStepR(hash, sizeof(hash), combo_state);
+	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
+		bignOidToDER(oid_der, &oid_len, "1.2.112.0.2.0.34.101.31.81") !=
+			ERR_OK ||
+		bignGenKeypair(privkey, pubkey, params, prngCOMBOStepR,
+			combo_state) != ERR_OK)
+		return FALSE;
+	prngCOMBOStart(combo_state, 1);
+	if (bignSign(sig, params, oid_der, oid_len, hash, privkey,
+			prngCOMBOStepR, combo_state) != ERR_OK ||
+		bignVerify(params, oid_der, oid_len, hash, sig, pubkey) != ERR_OK)
+		return FALSE;
+	if (st->calls != 7 || engSelect(0) != ERR_OK)
+		return FALSE;
+	prngCOMBOStart(combo_state, 1);
+	if (bignSign(sig1, params, oid_der, oid_len, hash, privkey,
+			prngCOMBOStepR, combo_state) != ERR_OK ||
+		!memEq(sig, sig1, 48))
+		return FALSE;
+	// bign: искаженная подпись
+	sig[0] ^= 1;
+	if (engSelect("test") != ERR_OK ||
+		bignVerify(params, oid_der, oid_len, hash, sig, pubkey) !=
+			ERR_BAD_SIG ||
+		st->calls != 8)
+		return FALSE;
+	// bign-dh: с движком, отказ движка (l = 256)
+	if (bignDH(buf, params, privkey, pubkey, 32) != ERR_OK ||
+		engSelect(0) != ERR_OK ||
+		bignDH(buf1, params, privkey, pubkey, 32) != ERR_OK ||
+		!memEq(buf, buf1, 32) ||
+		st->calls != 9)
+		return FALSE;
+	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.3") != ERR_OK ||
+		bignGenKeypair(privkey, pubkey, params, prngCOMBOStepR,
+			combo_state) != ERR_OK ||
+		engSelect("test") != ERR_OK ||
+		bignDH(buf, params, privkey, pubkey, 64) != ERR_OK ||
+		st->calls != 10 ||
+		engSelect(0) != ERR_OK ||
+		bignDH(buf1, params, privkey, pubkey, 64) != ERR_OK ||
+		!memEq(buf, buf1, 64))
+		return FALSE;
+	// эталонный движок
+	if (engSelect("soft") != ERR_OK ||
+		engActive() != engSoft() ||
+		beltHash(buf, beltH(), 13) != ERR_OK ||
+		!hexEq(buf,
+		"ABEF9725D4C5A83597A367D14494CC25"
+		"42F20F659DDFECC961A3EC550CBA8C75") ||
+		engSelect(0) != ERR_OK ||
+		st->calls != 10)
+		return FALSE;
+	// все нормально
+	return TRUE;
+}
@@ -0,0 +1,127 @@
+/*
+*******************************************************************************
+\file g12s_bench.c
+\brief Benchmarks for GOST R 34.10-2012 (Russia)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/g12s.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость выработки и проверки подписи на кривых с l = 256
+и l = 512: без контекста (sign, verify) и в контексте (ctx-sign, 
+ctx-verify).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	g12s_params params[1];					/*!< долговременные параметры */
+	octet combo_state[256];					/*!< состояние генератора */
+	octet privkey[G12S_ORDER_SIZE];			/*!< личный ключ */
+	octet pubkey[2 * G12S_FIELD_SIZE];		/*!< открытый ключ */
+	octet hash[G12S_ORDER_SIZE];			/*!< хэш-значение */
+	octet sig[2 * G12S_ORDER_SIZE];			/*!< подпись */
+	void* ctx;								/*!< контекст */
+	err_t code;								/*!< код ошибки */
+} g12s_bench_st;
+
+static void g12sBenchSign(void* arg, size_t reps)
+{
+	g12s_bench_st* b = (g12s_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = g12sSign(b->sig, b->params, b->hash, b->privkey,
+			prngCOMBOStepR, b->combo_state);
+}
+
+static void g12sBenchVerify(void* arg, size_t reps)
+{
+	g12s_bench_st* b = (g12s_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = g12sVerify(b->params, b->hash, b->sig, b->pubkey);
+}
+
+static void g12sBenchCtxSign(void* arg, size_t reps)
+{
+	g12s_bench_st* b = (g12s_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = g12sCtxSign(b->sig, b->ctx, b->hash, b->privkey,
+			prngCOMBOStepR, b->combo_state);
+}
+
+static void g12sBenchCtxVerify(void* arg, size_t reps)
+{
+	g12s_bench_st* b = (g12s_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = g12sCtxVerify(b->ctx, b->hash, b->sig, b->pubkey);
+}
+
+bool_t g12sBench()
+{
+	static const struct
+	{
+		const char* params;
+		const char* sign;
+		const char* verify;
+		const char* ctx_sign;
+		const char* ctx_verify;
+	} curves[] =
+	{
+		{
+			"1.2.643.2.2.35.1",
+			"g12sBench::sign[256]", "g12sBench::verify[256]",
+			"g12sBench::ctx-sign[256]", "g12sBench::ctx-verify[256]",
+		},
+		{
+			"1.2.643.7.1.2.1.2.1",
+			"g12sBench::sign[512]", "g12sBench::verify[512]",
+			"g12sBench::ctx-sign[512]", "g12sBench::ctx-verify[512]",
+		},
+	};
+	g12s_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	prngCOMBOStepR(b->hash, sizeof(b->hash), b->combo_state);
+	// цикл по кривым
+	for (i = 0; i < COUNT_OF(curves); ++i)
+	{
+		b->code = ERR_OK;
+		if (g12sStdParams(b->params, curves[i].params) != ERR_OK ||
+			g12sGenKeypair(b->privkey, b->pubkey, b->params,
+				prngCOMBOStepR, b->combo_state) != ERR_OK ||
+			g12sSign(b->sig, b->params, b->hash, b->privkey,
+				prngCOMBOStepR, b->combo_state) != ERR_OK)
+			return FALSE;
+		ret &= benchDo(curves[i].sign, "op", 1, g12sBenchSign, b);
+		ret &= benchDo(curves[i].verify, "op", 1, g12sBenchVerify, b);
+		// контекст
+		if (!(b->ctx = blobCreate(g12sCtx_keep(b->params->l))))
+			return FALSE;
+		if (g12sCtxStart(b->ctx, b->params) != ERR_OK)
+		{
+			blobClose(b->ctx);
+			return FALSE;
+		}
+		ret &= benchDo(curves[i].ctx_sign, "op", 1, g12sBenchCtxSign, b);
+		ret &= benchDo(curves[i].ctx_verify, "op", 1, g12sBenchCtxVerify, b);
+		blobClose(b->ctx);
+		ret &= b->code == ERR_OK;
+	}
+	return ret;
+}
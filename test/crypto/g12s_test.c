@@ -4,12 +4,14 @@
 \brief Tests for GOST R 34.10-2012 (Russia)
 \project bee2/test
 \created 2014.04.07
-\version 2016.07.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/prng.h>
@@ -21,10 +23,82 @@
 Самотестирование
 
 -#	Выполняются тесты из приложения A к ГОСТ Р 34.10-2012.
+-#	Функции g12sCtxXXX() сравниваются с функциями g12sXXX().
 -#	Дополнительно проверяются стандартные кривые.
 *******************************************************************************
 */
 
+static bool_t g12sTestCtx(const g12s_params* params, const octet d[],
+	const octet k[], const octet hash[])
+{
+	const size_t mo = params->l / 8;
+	octet privkey[2][G12S_ORDER_SIZE];
+	octet pubkey[2][2 * G12S_FIELD_SIZE];
+	octet sig[2][2 * G12S_ORDER_SIZE];
+	octet echo[64];
+	void* ctx;
+	bool_t ret;
+	// создать контекст
+	if (!(ctx = blobCreate(g12sCtx_keep(params->l))))
+		return FALSE;
+	if (g12sCtxStart(ctx, params) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// ключи
+	memSetZero(pubkey, sizeof(pubkey));
+	ASSERT(sizeof(echo) >= prngEcho_keep());
+	prngEchoStart(echo, d, mo);
+	ret = g12sCtxGenKeypair(privkey[0], pubkey[0], ctx, prngEchoStepR,
+		echo) == ERR_OK;
+	prngEchoStart(echo, d, mo);
+	ret = ret && g12sGenKeypair(privkey[1], pubkey[1], params, 
+		prngEchoStepR, echo) == ERR_OK &&
+		memEq(privkey[0], privkey[1], mo) &&
+		memEq(pubkey[0], pubkey[1], sizeof(pubkey[0]));
+	// подписи
+	prngEchoStart(echo, k, mo);
+	ret = ret && g12sCtxSign(sig[0], ctx, hash, privkey[0], prngEchoStepR,
+		echo) == ERR_OK;
+	prngEchoStart(echo, k, mo);
+	ret = ret && g12sSign(sig[1], params, hash, privkey[0], prngEchoStepR,
+		echo) == ERR_OK &&
+		memEq(sig[0], sig[1], 2 * mo);
+	// проверка подписей
+	ret = ret && g12sCtxVerify(ctx, hash, sig[0], pubkey[0]) == ERR_OK &&
+		(sig[0][mo] ^= 1, g12sCtxVerify(ctx, hash, sig[0], pubkey[0]) ==
+			ERR_BAD_SIG);
+	// образ контекста
+	if (ret)
+	{
+		size_t count;
+		void* image;
+		void* ctx1;
+		ret = g12sCtxSave(0, &count, ctx) == ERR_OK;
+		image = ret ? blobCreate(count) : 0;
+		ctx1 = blobCreate(g12sCtxLoad_keep(params->l));
+		prngEchoStart(echo, k, mo);
+		ret = ret && image && ctx1 &&
+			g12sCtxSave(image, &count, ctx) == ERR_OK &&
+			g12sCtxLoad(ctx1, params, image, count) == ERR_OK &&
+			g12sCtxSign(sig[0], ctx1, hash, privkey[0], prngEchoStepR,
+				echo) == ERR_OK &&
+			memEq(sig[0], sig[1], 2 * mo) &&
+			g12sCtxVerify(ctx1, hash, sig[0], pubkey[0]) == ERR_OK;
+		if (ret)
+		{
+			((octet*)image)[count - 1] ^= 1;
+			ret = g12sCtxLoad(ctx1, params, image, count) == ERR_BAD_HASH;
+		}
+		blobClose(ctx1);
+		blobClose(image);
+	}
+	// завершение
+	blobClose(ctx);
+	return ret;
+}
+
 bool_t g12sTest()
 {
 	g12s_params params[1];
@@ -69,6 +143,9 @@ bool_t g12sTest()
 			"01456C64BA4642A1653C235A98A60249"
 			"BCD6D3F746B631DF928014F6C5BF9C40"))
 		return FALSE;
+	// тест A.1 [контекст]
+	if (!g12sTestCtx(params, privkey, buf, hash))
+		return FALSE;
 	// тест A.1 [проверка ЭЦП]
 	if (g12sVerify(params, hash, sig, pubkey) != ERR_OK ||
 		(sig[0] ^= 1, g12sVerify(params, hash, sig, pubkey) == ERR_OK))
@@ -125,6 +202,9 @@ bool_t g12sTest()
 			"823CE288E8C4F362526080DF7F70CE40"
 			"6A6EEB1F56919CB92A9853BDE73E5B4A"))
 		return FALSE;
+	// тест A.2 [контекст]
+	if (!g12sTestCtx(params, privkey, buf, hash))
+		return FALSE;
 	// тест A.2 [проверка ЭЦП]
 	if (g12sVerify(params, hash, sig, pubkey) != ERR_OK ||
 		(sig[0] ^= 1, g12sVerify(params, hash, sig, pubkey) == ERR_OK))
@@ -0,0 +1,196 @@
+/*
+*******************************************************************************
+\file keep_test.c
+\brief Tables of state and stack sizes
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <stdio.h>
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/stat.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bake.h>
+#include <bee2/crypto/bash.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/bign.h>
+#include <bee2/crypto/botp.h>
+#include <bee2/crypto/brng.h>
+#include <bee2/crypto/btok.h>
+#include <bee2/crypto/mht.h>
+#include <bee2/crypto/pfok.h>
+
+/*
+*******************************************************************************
+Таблицы
+
+Печатаются размеры состояний (_keep) и стеков (_deep), которые
+возвращают открытые функции модулей crypto, для всех уровней стойкости
+и стандартных параметров. Если библиотека собрана с опцией BUILD_STAT,
+то дополнительно печатаются число выделений памяти и пиковый объем памяти
+(см. statGetMem()), которые требуются функциям верхнего уровня bign
+и pfok. При этом проверяется, что вся выделенная память освобождена.
+*******************************************************************************
+*/
+
+static void keepTestPrint(const char* name, size_t l, size_t size)
+{
+	if (l)
+		printf("keepTest::%s[%u]: %u\n", name, (unsigned)l, (unsigned)size);
+	else
+		printf("keepTest::%s: %u\n", name, (unsigned)size);
+}
+
+static bool_t keepTestMem(const char* name, size_t l, err_t code)
+{
+	stat_mem_t mem[1];
+	statGetMem(mem);
+	printf("keepTest::%s[%u]: peak = %u, allocs = %u\n", name, (unsigned)l,
+		(unsigned)mem->peak, (unsigned)mem->allocs);
+	return code == ERR_OK && mem->allocs == mem->frees &&
+		(mem->allocs == 0 || mem->peak > 0);
+}
+
+static void keepTestConst()
+{
+	keepTestPrint("beltKey_keep", 0, beltKey_keep());
+	keepTestPrint("beltECB_keep", 0, beltECB_keep());
+	keepTestPrint("beltCBC_keep", 0, beltCBC_keep());
+	keepTestPrint("beltCFB_keep", 0, beltCFB_keep());
+	keepTestPrint("beltCTR_keep", 0, beltCTR_keep());
+	keepTestPrint("beltMAC_keep", 0, beltMAC_keep());
+	keepTestPrint("beltDWP_keep", 0, beltDWP_keep());
+	keepTestPrint("beltCHE_keep", 0, beltCHE_keep());
+	keepTestPrint("beltHash_keep", 0, beltHash_keep());
+	keepTestPrint("beltCompr_deep", 0, beltCompr_deep());
+	keepTestPrint("beltWBL_keep", 0, beltWBL_keep());
+	keepTestPrint("beltBDE_keep", 0, beltBDE_keep());
+	keepTestPrint("beltSDE_keep", 0, beltSDE_keep());
+	keepTestPrint("beltFMT_keep", 10, beltFMT_keep(10, 16));
+	keepTestPrint("beltKRP_keep", 0, beltKRP_keep());
+	keepTestPrint("beltHMAC_keep", 0, beltHMAC_keep());
+	keepTestPrint("beltHMACKey_keep", 0, beltHMACKey_keep());
+	keepTestPrint("bashF_deep", 0, bashF_deep());
+	keepTestPrint("bashHash_keep", 0, bashHash_keep());
+	keepTestPrint("bashPrg_keep", 0, bashPrg_keep());
+	keepTestPrint("brngCTR_keep", 0, brngCTR_keep());
+	keepTestPrint("brngHMAC_keep", 0, brngHMAC_keep());
+	keepTestPrint("botpHOTP_keep", 0, botpHOTP_keep());
+	keepTestPrint("botpTOTP_keep", 0, botpTOTP_keep());
+	keepTestPrint("botpTOTPMulti_keep", 0, botpTOTPMulti_keep());
+	keepTestPrint("botpOCRA_keep", 0, botpOCRA_keep());
+	keepTestPrint("btokSM_keep", 0, btokSM_keep());
+	keepTestPrint("mht_keep", 0, mht_keep());
+}
+
+static bool_t keepTestBign(size_t l, const char* name, octet combo_state[])
+{
+	bign_params params[1];
+	octet oid_der[16];
+	size_t oid_len = sizeof(oid_der);
+	octet privkey[64];
+	octet pubkey[128];
+	octet hash[64];
+	octet sig[96];
+	octet key[32];
+	octet token[32 + 16 + 64];
+	bool_t ret = TRUE;
+	err_t code;
+	// таблица
+	keepTestPrint("bignCtx_keep", l, bignCtx_keep(l));
+	keepTestPrint("bignCtxStack_keep", l, bignCtxStack_keep(l));
+	keepTestPrint("bignCtxLoad_keep", l, bignCtxLoad_keep(l));
+	keepTestPrint("bignPubkey_keep", l, bignPubkey_keep(l));
+	keepTestPrint("bignPubkeyPre_keep", l, bignPubkeyPre_keep(l));
+	keepTestPrint("bignPrivkey_keep", l, bignPrivkey_keep(l));
+	keepTestPrint("bignValParams_keep", l, bignValParams_keep(l));
+	keepTestPrint("bakeBMQV_keep", l, bakeBMQV_keep(l));
+	keepTestPrint("bakeBSTS_keep", l, bakeBSTS_keep(l));
+	keepTestPrint("bakeBPACE_keep", l, bakeBPACE_keep(l));
+	keepTestPrint("btokBAuthT_keep", l, btokBAuthT_keep(l));
+	keepTestPrint("btokBAuthCT_keep", l, btokBAuthCT_keep(l));
+	keepTestPrint("btokCVCIss_keep", l, btokCVCIss_keep(l / 4));
+	if (!statIsEnabled())
+		return TRUE;
+	// замеры
+	if (bignStdParams(params, name) != ERR_OK ||
+		bignOidToDER(oid_der, &oid_len, "1.2.112.0.2.0.34.101.31.81") !=
+			ERR_OK)
+		return FALSE;
+	prngCOMBOStepR(hash, sizeof(hash), combo_state);
+	statReset();
+	code = bignGenKeypair(privkey, pubkey, params, prngCOMBOStepR,
+		combo_state);
+	ret &= keepTestMem("bignGenKeypair", l, code);
+	statReset();
+	code = bignSign(sig, params, oid_der, oid_len, hash, privkey,
+		prngCOMBOStepR, combo_state);
+	ret &= keepTestMem("bignSign", l, code);
+	statReset();
+	code = bignSign2(sig, params, oid_der, oid_len, hash, privkey, 0, 0);
+	ret &= keepTestMem("bignSign2", l, code);
+	statReset();
+	code = bignVerify(params, oid_der, oid_len, hash, sig, pubkey);
+	ret &= keepTestMem("bignVerify", l, code);
+	statReset();
+	code = bignDH(key, params, privkey, pubkey, 32);
+	ret &= keepTestMem("bignDH", l, code);
+	statReset();
+	code = bignKeyWrap(token, params, key, 32, 0, pubkey, prngCOMBOStepR,
+		combo_state);
+	ret &= keepTestMem("bignKeyWrap", l, code);
+	statReset();
+	code = bignKeyUnwrap(key, params, token, 32 + 16 + l / 4, 0, privkey);
+	ret &= keepTestMem("bignKeyUnwrap", l, code);
+	return ret;
+}
+
+static bool_t keepTestPfok(const char* name, octet combo_state[])
+{
+	pfok_params params[1];
+	pfok_seed seed[1];
+	octet x[48];
+	octet y[368];
+	octet key[48];
+	bool_t ret = TRUE;
+	err_t code;
+	// таблица
+	if (pfokStdParams(params, seed, name) != ERR_OK)
+		return FALSE;
+	keepTestPrint("pfokCtx_keep", params->l, pfokCtx_keep(params->l));
+	keepTestPrint("pfokGenParams_keep", params->l,
+		pfokGenParams_keep(seed, 1));
+	if (!statIsEnabled())
+		return TRUE;
+	// замеры
+	statReset();
+	code = pfokGenKeypair(x, y, params, prngCOMBOStepR, combo_state);
+	ret &= keepTestMem("pfokGenKeypair", params->l, code);
+	statReset();
+	code = pfokDH(key, params, x, y);
+	ret &= keepTestMem("pfokDH", params->l, code);
+	return ret;
+}
+
+bool_t keepTest()
+{
+	octet combo_state[256];
+	bool_t ret = TRUE;
+	// подготовить генератор
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// таблицы
+	keepTestConst();
+	ret &= keepTestBign(128, "1.2.112.0.2.0.34.101.45.3.1", combo_state);
+	ret &= keepTestBign(192, "1.2.112.0.2.0.34.101.45.3.2", combo_state);
+	ret &= keepTestBign(256, "1.2.112.0.2.0.34.101.45.3.3", combo_state);
+	ret &= keepTestPfok("1.2.112.0.2.0.1176.2.3.3.2", combo_state);
+	ret &= keepTestPfok("1.2.112.0.2.0.1176.2.3.6.2", combo_state);
+	ret &= keepTestPfok("1.2.112.0.2.0.1176.2.3.10.2", combo_state);
+	return ret;
+}
@@ -0,0 +1,107 @@
+/*
+*******************************************************************************
+\file mht_bench.c
+\brief Benchmarks for Merkle hash trees
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/mht.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Добавление листьев в дерево замеряется в двух режимах: по одному листу
+(внутренние узлы хэшируются последовательно) и пакетом (узлы одного уровня
+хэшируются одновременно). В обоих режимах хэширований одинаковое число.
+Единица данных -- лист.
+*******************************************************************************
+*/
+
+#define MHT_BENCH_N 1024
+
+typedef struct
+{
+	size_t alg;								/*!< алгоритм хэширования */
+	octet state[8192];						/*!< состояние дерева */
+	octet leaves[MHT_BENCH_N * MHT_HASH_MAX];	/*!< хэш-значения листьев */
+	err_t code;								/*!< код ошибки */
+} mht_bench_st;
+
+static void mhtBenchSetCode(mht_bench_st* b, err_t code)
+{
+	if (b->code == ERR_OK)
+		b->code = code;
+}
+
+static void mhtBenchOne(void* arg, size_t reps)
+{
+	mht_bench_st* b = (mht_bench_st*)arg;
+	const size_t hlen = mhtHashLen(b->alg);
+	size_t i;
+	while (reps--)
+	{
+		mhtBenchSetCode(b, mhtStart(b->state, b->alg));
+		for (i = 0; i < MHT_BENCH_N; ++i)
+			mhtBenchSetCode(b, mhtAppendH(b->state, b->leaves + i * hlen, 1));
+	}
+}
+
+static void mhtBenchBatch(void* arg, size_t reps)
+{
+	mht_bench_st* b = (mht_bench_st*)arg;
+	while (reps--)
+	{
+		mhtBenchSetCode(b, mhtStart(b->state, b->alg));
+		mhtBenchSetCode(b, mhtAppendH(b->state, b->leaves, MHT_BENCH_N));
+	}
+}
+
+bool_t mhtBench()
+{
+	static const struct
+	{
+		size_t alg;
+		const char* one;
+		const char* batch;
+	} algs[] =
+	{
+		{ MHT_BELT, "mhtBench::append-belt[1]", "mhtBench::append-belt[1024]" },
+		{ 128, "mhtBench::append-bash128[1]", "mhtBench::append-bash128[1024]" },
+		{ 256, "mhtBench::append-bash256[1]", "mhtBench::append-bash256[1024]" },
+	};
+	octet combo_state[256];
+	mht_bench_st* b;
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	if (mht_keep() > sizeof(b->state) || prngCOMBO_keep() > sizeof(combo_state))
+		return FALSE;
+	b = (mht_bench_st*)blobCreate(sizeof(mht_bench_st));
+	if (b == 0)
+		return FALSE;
+	prngCOMBOStart(combo_state, utilNonce32());
+	prngCOMBOStepR(b->leaves, sizeof(b->leaves), combo_state);
+	b->code = ERR_OK;
+	// цикл по алгоритмам
+	for (i = 0; i < COUNT_OF(algs) && b->code == ERR_OK; ++i)
+	{
+		b->alg = algs[i].alg;
+		ret &= benchDo(algs[i].one, "leaf", MHT_BENCH_N, mhtBenchOne, b);
+		ret &= benchDo(algs[i].batch, "leaf", MHT_BENCH_N, mhtBenchBatch, b);
+	}
+	// завершить
+	ret &= b->code == ERR_OK;
+	blobClose(b);
+	return ret;
+}
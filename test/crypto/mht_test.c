@@ -0,0 +1,208 @@
+/*
+*******************************************************************************
+\file mht_test.c
+\brief Tests for Merkle hash trees
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/bash.h>
+#include <bee2/crypto/belt.h>
+#include <bee2/crypto/mht.h>
+
+/*
+*******************************************************************************
+Эталонный корень
+
+Корень MTH вычисляется рекурсивно, строго по определению RFC 9162, с
+помощью beltHash() и bashHash().
+*******************************************************************************
+*/
+
+static bool_t mhtTestMTH(octet root[], size_t alg, const octet leaves[],
+	size_t n)
+{
+	const size_t hlen = mhtHashLen(alg);
+	octet buf[1 + 2 * MHT_HASH_MAX];
+	size_t k;
+	if (n == 0)
+		return (alg == MHT_BELT ? beltHash(root, buf, 0) :
+			bashHash(root, alg, buf, 0)) == ERR_OK;
+	if (n == 1)
+		return memCopy(root, leaves, hlen), TRUE;
+	for (k = 1; k < n - k; k <<= 1);
+	buf[0] = 0x01;
+	if (!mhtTestMTH(buf + 1, alg, leaves, k) ||
+		!mhtTestMTH(buf + 1 + hlen, alg, leaves + k * hlen, n - k))
+		return FALSE;
+	return (alg == MHT_BELT ? beltHash(root, buf, 1 + 2 * hlen) :
+		bashHash(root, alg, buf, 1 + 2 * hlen)) == ERR_OK;
+}
+
+/*
+*******************************************************************************
+Тестирование алгоритма alg на n записях
+*******************************************************************************
+*/
+
+static bool_t mhtTestAlg(size_t alg, size_t n)
+{
+	octet state[8192];
+	octet recs[40][40];
+	const void* src[40];
+	size_t count[40];
+	octet leaves[40 * MHT_HASH_MAX];
+	octet proof[(B_PER_S + 1) * MHT_HASH_MAX];
+	octet root[MHT_HASH_MAX];
+	octet root1[MHT_HASH_MAX];
+	octet buf[11 + B_PER_S * MHT_HASH_MAX];
+	size_t hlen, size, len, i, j, k;
+	// подготовить записи
+	hlen = mhtHashLen(alg);
+	if (hlen == SIZE_MAX || n > 40 || mht_keep() > sizeof(state))
+		return FALSE;
+	for (i = 0; i < n; ++i)
+	{
+		memSet(recs[i], (octet)i, i);
+		src[i] = recs[i], count[i] = i;
+		if (mhtLeaf(leaves + i * hlen, alg, src[i], count[i]) != ERR_OK)
+			return FALSE;
+	}
+	// пустое дерево
+	if (mhtStart(state, alg) != ERR_OK ||
+		mhtSize(state) != 0 ||
+		mhtRoot(root, state) != ERR_OK ||
+		!mhtTestMTH(root1, alg, leaves, 0) ||
+		!memEq(root, root1, hlen) ||
+		mhtRootOf(root, alg, leaves, 0) != ERR_OK ||
+		!memEq(root, root1, hlen))
+		return FALSE;
+	// наращивание пакетами 1, 2, 3,...
+	for (size = 0, k = 1; size < n; size += k, ++k)
+	{
+		k = MIN2(k, n - size);
+		if (mhtAppend(state, src + size, count + size, k) != ERR_OK ||
+			mhtSize(state) != size + k ||
+			mhtRoot(root, state) != ERR_OK ||
+			!mhtTestMTH(root1, alg, leaves, size + k) ||
+			!memEq(root, root1, hlen) ||
+			mhtRootOf(root, alg, leaves, size + k) != ERR_OK ||
+			!memEq(root, root1, hlen))
+			return FALSE;
+	}
+	// наращивание по одному листу с сохранением и восстановлением
+	if (mhtStart(state, alg) != ERR_OK)
+		return FALSE;
+	for (size = 0; size < n; ++size)
+	{
+		len = mhtSave(0, state);
+		if (len > sizeof(buf) ||
+			mhtSave(buf, state) != len ||
+			mhtLoad(state, buf, len - 1) != ERR_BAD_FORMAT ||
+			mhtLoad(state, buf, len) != ERR_OK ||
+			mhtAppendH(state, leaves + size * hlen, 1) != ERR_OK ||
+			mhtRoot(root, state) != ERR_OK ||
+			!mhtTestMTH(root1, alg, leaves, size + 1) ||
+			!memEq(root, root1, hlen))
+			return FALSE;
+	}
+	// доказательства включения
+	for (size = 1; size <= n; ++size)
+	{
+		if (!mhtTestMTH(root, alg, leaves, size))
+			return FALSE;
+		for (i = 0; i < size; ++i)
+		{
+			if (mhtProve(0, &len, alg, leaves, size, i) != ERR_OK ||
+				mhtProve(proof, &j, alg, leaves, size, i) != ERR_OK ||
+				j != len ||
+				mhtVerify(alg, root, size, i, leaves + i * hlen, proof,
+					len) != ERR_OK)
+				return FALSE;
+			// другой лист, другой номер, искаженное доказательство
+			if (size > 1 &&
+				(mhtVerify(alg, root, size, i,
+					leaves + (i + 1) % size * hlen, proof, len) !=
+						ERR_BAD_HASH ||
+				mhtVerify(alg, root, size, (i + 1) % size,
+					leaves + i * hlen, proof, len) != ERR_BAD_HASH))
+				return FALSE;
+			if (len)
+			{
+				proof[len * hlen - 1] ^= 1;
+				if (mhtVerify(alg, root, size, i, leaves + i * hlen, proof,
+					len) != ERR_BAD_HASH)
+					return FALSE;
+			}
+		}
+		if (mhtProve(proof, &len, alg, leaves, size, size) != ERR_BAD_INPUT)
+			return FALSE;
+	}
+	// доказательства согласованности
+	for (size = 1; size <= n; ++size)
+	{
+		if (!mhtTestMTH(root, alg, leaves, size))
+			return FALSE;
+		for (i = 1; i <= size; ++i)
+		{
+			if (!mhtTestMTH(root1, alg, leaves, i) ||
+				mhtProveC(0, &len, alg, leaves, size, i) != ERR_OK ||
+				mhtProveC(proof, &j, alg, leaves, size, i) != ERR_OK ||
+				j != len || (i == size) != (len == 0) ||
+				mhtVerifyC(alg, root1, i, root, size, proof, len) != ERR_OK)
+				return FALSE;
+			// другой префикс, искаженное доказательство
+			if (i < size &&
+				mhtVerifyC(alg, root, i, root, size, proof, len) !=
+					ERR_BAD_HASH)
+				return FALSE;
+			if (len)
+			{
+				proof[0] ^= 1;
+				if (mhtVerifyC(alg, root1, i, root, size, proof, len) !=
+					ERR_BAD_HASH)
+					return FALSE;
+			}
+		}
+		if (mhtProveC(proof, &len, alg, leaves, size, 0) != ERR_BAD_INPUT)
+			return FALSE;
+	}
+	// все нормально
+	return TRUE;
+}
+
+/*
+*******************************************************************************
+Самотестирование
+*******************************************************************************
+*/
+
+bool_t mhtTest()
+{
+	octet state[8192];
+	octet hash[MHT_HASH_MAX];
+	// длины хэш-значений
+	if (mhtHashLen(MHT_BELT) != 32 || mhtHashLen(128) != 32 ||
+		mhtHashLen(256) != 64 || mhtHashLen(100) != SIZE_MAX ||
+		mhtHashLen(272) != SIZE_MAX)
+		return FALSE;
+	// недопустимые алгоритмы
+	if (mhtStart(state, 100) != ERR_BAD_PARAMS ||
+		mhtLeaf(hash, 272, hash, 0) != ERR_BAD_PARAMS ||
+		mhtRootOf(hash, 8, hash, 0) != ERR_BAD_PARAMS)
+		return FALSE;
+	// алгоритмы
+	if (!mhtTestAlg(MHT_BELT, 37) ||
+		!mhtTestAlg(128, 23) ||
+		!mhtTestAlg(256, 17))
+		return FALSE;
+	// все нормально
+	return TRUE;
+}
@@ -0,0 +1,107 @@
+/*
+*******************************************************************************
+\file pfok_bench.c
+\brief Benchmarks for Draft of RD_RB (pfok)
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/err.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/crypto/pfok.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется скорость генерации ключей и построения общего ключа (протоколы
+DH и MTI) на стандартных параметрах уровней 3, 6 и 10.
+*******************************************************************************
+*/
+
+typedef struct
+{
+	pfok_params params[1];	/*!< долговременные параметры */
+	octet combo_state[256];	/*!< состояние генератора */
+	octet ua[368];			/*!< личный ключ стороны A */
+	octet xa[368];			/*!< одноразовый личный ключ стороны A */
+	octet vb[368];			/*!< открытый ключ стороны B */
+	octet yb[368];			/*!< одноразовый открытый ключ стороны B */
+	octet key[368];			/*!< общий ключ */
+	err_t code;				/*!< код ошибки */
+} pfok_bench_st;
+
+static void pfokBenchGen(void* arg, size_t reps)
+{
+	pfok_bench_st* b = (pfok_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = pfokGenKeypair(b->xa, b->yb, b->params, prngCOMBOStepR,
+			b->combo_state);
+}
+
+static void pfokBenchDH(void* arg, size_t reps)
+{
+	pfok_bench_st* b = (pfok_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = pfokDH(b->key, b->params, b->ua, b->vb);
+}
+
+static void pfokBenchMTI(void* arg, size_t reps)
+{
+	pfok_bench_st* b = (pfok_bench_st*)arg;
+	while (reps-- && b->code == ERR_OK)
+		b->code = pfokMTI(b->key, b->params, b->ua, b->xa, b->vb, b->yb);
+}
+
+bool_t pfokBench()
+{
+	static const struct
+	{
+		const char* params;
+		const char* gen;
+		const char* dh;
+		const char* mti;
+	} levels[] =
+	{
+		{
+			"1.2.112.0.2.0.1176.2.3.3.2",
+			"pfokBench::gen[3]", "pfokBench::dh[3]", "pfokBench::mti[3]",
+		},
+		{
+			"1.2.112.0.2.0.1176.2.3.6.2",
+			"pfokBench::gen[6]", "pfokBench::dh[6]", "pfokBench::mti[6]",
+		},
+		{
+			"1.2.112.0.2.0.1176.2.3.10.2",
+			"pfokBench::gen[10]", "pfokBench::dh[10]", "pfokBench::mti[10]",
+		},
+	};
+	pfok_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i;
+	// подготовить объекты
+	ASSERT(prngCOMBO_keep() <= sizeof(b->combo_state));
+	prngCOMBOStart(b->combo_state, utilNonce32());
+	// цикл по уровням
+	for (i = 0; i < COUNT_OF(levels); ++i)
+	{
+		b->code = ERR_OK;
+		if (pfokStdParams(b->params, 0, levels[i].params) != ERR_OK ||
+			pfokGenKeypair(b->ua, b->vb, b->params, prngCOMBOStepR,
+				b->combo_state) != ERR_OK ||
+			pfokGenKeypair(b->xa, b->yb, b->params, prngCOMBOStepR,
+				b->combo_state) != ERR_OK)
+			return FALSE;
+		ret &= benchDo(levels[i].gen, "op", 1, pfokBenchGen, b);
+		ret &= benchDo(levels[i].dh, "op", 1, pfokBenchDH, b);
+		ret &= benchDo(levels[i].mti, "op", 1, pfokBenchMTI, b);
+		ret &= b->code == ERR_OK;
+	}
+	return ret;
+}
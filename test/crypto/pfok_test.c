@@ -4,20 +4,26 @@
 \brief Tests for Draft of RD_RB (pfok)
 \project bee2/test
 \created 2014.07.08
-\version 2022.06.07
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
+#include <bee2/core/err.h>
 #include <bee2/core/mem.h>
+#include <bee2/core/obj.h>
 #include <bee2/core/hex.h>
 #include <bee2/core/prng.h>
 #include <bee2/core/str.h>
 #include <bee2/core/util.h>
+#include <bee2/math/qr.h>
 #include <bee2/math/ww.h>
+#include <bee2/math/zm.h>
 #include <bee2/math/zz.h>
 #include <bee2/crypto/pfok.h>
+#include <crypto/pfok_lcl.h>
 
 /*
 *******************************************************************************
@@ -59,6 +65,41 @@ bool_t pfokTestTestParams()
 		!memEq(params->p, params1->p, O_OF_B(params->l)) ||
 		params->l != params1->l || params->r != params1->r)
 		return FALSE;
+	// тест PFOK.GENP.1 в нескольких потоках
+	if (pfokGenParamsMT(params, seed, _on_q_silent, 4) != ERR_OK ||
+		!memEq(params->p, params1->p, O_OF_B(params->l)) ||
+		!memEq(params->g, params1->g, O_OF_B(params->l)))
+		return FALSE;
+	// тест PFOK.GENP.1 по шагам
+	{
+		void* state;
+		size_t steps;
+		err_t code;
+		state = blobCreate(pfokGenParams_keep(seed, 1));
+		if (!state)
+			return FALSE;
+		code = pfokGenParamsStart(state, seed, 0, 1);
+		for (steps = 0; code == ERR_OK || code == ERR_NOT_READY; ++steps)
+			if ((code = pfokGenParamsStep(params, state)) == ERR_OK)
+				break;
+		if (code != ERR_OK || steps < 2 ||
+			pfokGenParamsNum(state) == 0 ||
+			pfokGenParamsStep(params, state) != ERR_OK ||
+			!memEq(params->p, params1->p, O_OF_B(params->l)) ||
+			!memEq(params->g, params1->g, O_OF_B(params->l)) ||
+			params->l != params1->l || params->r != params1->r)
+		{
+			blobClose(state);
+			return FALSE;
+		}
+		// некорректные затравочные данные
+		seed->lt[0] += 1;
+		code = pfokGenParamsStart(state, seed, 0, 1);
+		seed->lt[0] -= 1;
+		blobClose(state);
+		if (code != ERR_BAD_PARAMS)
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
@@ -91,6 +132,94 @@ bool_t pfokTestStdParams()
 	return TRUE;
 }
 
+/*
+*******************************************************************************
+Готовые таблицы предвычислений
+
+Функция pfokTestStdPreTable() заново строит таблицу так, как она была 
+построена при подготовке pfok_pre.c: кольцо Монтгомери с R = 2^{l + 2},
+функция qrCombPrec() с шириной гребня 6. Построенная таблица сравнивается 
+с готовой (см. pfokStdPre()).
+
+Дополнительно проверяется, что открытые ключи, рассчитанные в контексте 
+(с таблицей), совпадают с ключами, рассчитанными функцией pfokDH() 
+без таблицы.
+*******************************************************************************
+*/
+
+static bool_t pfokTestStdPreTable(const pfok_params* params)
+{
+	const size_t no = O_OF_B(params->l);
+	const size_t n = W_OF_B(params->l);
+	const size_t qr_keep = zmMontCreate_keep(no);
+	const size_t qr_deep = zmMontCreate_deep(no);
+	const size_t pre_keep = qrCombPrec_keep(n, 6);
+	const word* std_pre = pfokStdPre(params->l);
+	void* state;
+	qr_o* qr;
+	word* g;
+	word* pre;
+	void* stack;
+	bool_t ok;
+	// таблицы нет (big-endian)?
+	if (!std_pre)
+		return TRUE;
+	// раскладка состояния
+	state = blobCreate(qr_keep + O_OF_W(n) + pre_keep +
+		utilMax(2,
+			qr_deep,
+			qrCombPrec_deep(n, qr_deep)));
+	if (!state)
+		return FALSE;
+	qr = (qr_o*)state;
+	g = (word*)((octet*)qr + qr_keep);
+	pre = g + n;
+	stack = (octet*)pre + pre_keep;
+	// построить таблицу и сравнить с готовой
+	zmMontCreate(qr, params->p, no, params->l + 2, stack);
+	wwFrom(g, params->g, no);
+	qrCombPrec(pre, g, params->r, 6, qr, stack);
+	ok = memEq(pre, std_pre, pre_keep);
+	blobClose(state);
+	return ok;
+}
+
+bool_t pfokTestStdPre()
+{
+	static const char* const names[] =
+	{
+		"1.2.112.0.2.0.1176.2.3.3.2",
+		"1.2.112.0.2.0.1176.2.3.6.2",
+	};
+	pfok_params params[1];
+	octet combo_state[128];
+	octet x[O_OF_B(194)];
+	octet y[O_OF_B(1534)];
+	octet key[32];
+	void* ctx;
+	size_t i, j;
+	bool_t ok = TRUE;
+	// подготовить генератор
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// степени g в контексте (с готовой таблицей) и в pfokDH() (без таблицы)
+	for (i = 0; ok && i < COUNT_OF(names); ++i)
+	{
+		if (pfokStdParams(params, 0, names[i]) != ERR_OK ||
+			!pfokTestStdPreTable(params))
+			return FALSE;
+		ctx = blobCreate(pfokCtx_keep(params->l));
+		ok = ctx && pfokCtxStart(ctx, params) == ERR_OK;
+		for (j = 0; ok && j < 16; ++j)
+			ok = pfokCtxGenKeypair(x, y, ctx, prngCOMBOStepR, combo_state)
+					== ERR_OK &&
+				pfokDH(key, params, x, params->g) == ERR_OK &&
+				memEq(key, y, sizeof(key));
+		blobClose(ctx);
+	}
+	return ok;
+}
+
 bool_t pfokTest()
 {
 	pfok_params params[1];
@@ -100,9 +229,14 @@ bool_t pfokTest()
 	octet vb[O_OF_B(638)];
 	octet yb[O_OF_B(638)];
 	octet key[32];
+	octet key1[32];
+	void* ctx;
 	// тест PFOK.GENP.1
 	if (!pfokTestTestParams())
 		return FALSE;
+	// готовые таблицы предвычислений
+	if (!pfokTestStdPre())
+		return FALSE;
 	// тест PFOK.GENG.1
 	if (pfokStdParams(params, 0, "test") != ERR_OK ||
 		pfokValParams(params) != ERR_OK ||
@@ -138,6 +272,55 @@ bool_t pfokTest()
 		pfokCalcPubkey(yb, params, ua) != ERR_OK ||
 		!memEq(vb, yb, O_OF_B(params->l)))
 		return FALSE;
+	// ключи в контексте
+	ctx = blobCreate(pfokCtx_keep(params->l));
+	if (!ctx || pfokCtxStart(ctx, params) != ERR_OK)
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	if (pfokCtxCalcPubkey(yb, ctx, ua) != ERR_OK ||
+		!memEq(vb, yb, O_OF_B(params->l)) ||
+		pfokCtxGenKeypair(ua, vb, ctx, prngCOMBOStepR, combo_state) != ERR_OK ||
+		pfokCalcPubkey(yb, params, ua) != ERR_OK ||
+		!memEq(vb, yb, O_OF_B(params->l)))
+	{
+		blobClose(ctx);
+		return FALSE;
+	}
+	// ключи в реплике контекста
+	{
+		void* reps;
+		const void* rep;
+		bool_t ok;
+		reps = blobCreate(objReps_keep());
+		ok = reps && pfokCtxRepsStart(reps, ctx) == ERR_OK &&
+			(rep = objRepsGet(reps)) != ctx &&
+			pfokCtxCalcPubkey(yb, rep, ua) == ERR_OK &&
+			memEq(vb, yb, O_OF_B(params->l));
+		if (reps)
+			objRepsClose(reps);
+		blobClose(reps);
+		if (!ok)
+		{
+			blobClose(ctx);
+			return FALSE;
+		}
+	}
+	blobClose(ctx);
+	// ключи по копии параметров (кэш контекстов)
+	if (pfokCalcPubkey(yb, params, ua) != ERR_OK ||
+		pfokStdParams(params, 0, "test") != ERR_OK ||
+		pfokCalcPubkey(vb, params, ua) != ERR_OK ||
+		!memEq(vb, yb, O_OF_B(params->l)))
+		return FALSE;
+	// согласованность с pfokDH()
+	if (pfokGenKeypair(xa, yb, params, prngCOMBOStepR, combo_state) !=
+			ERR_OK ||
+		pfokDH(key, params, ua, yb) != ERR_OK ||
+		pfokDH(key1, params, xa, vb) != ERR_OK ||
+		!memEq(key, key1, sizeof(key)))
+		return FALSE;
 	// тест PFOK.ANON.1
 	hexToRev(ua, 
 		"01"
@@ -0,0 +1,249 @@
+/*
+*******************************************************************************
+\file ec2_bench.c
+\brief Benchmarks for elliptic curves over binary fields
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <stdio.h>
+#include <bee2/core/mem.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/math/ec2.h>
+#include <bee2/math/gf2.h>
+#include <bee2/math/ww.h>
+#include <bee2/math/zz.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Кривые Коблица
+
+Кривые K-163 и K-233 из FIPS 186-4 (приложение D.1.3).
+*******************************************************************************
+*/
+
+static const struct
+{
+	const char* name;
+	size_t p[4];
+	octet A[30];
+	octet xbase[30];
+	octet ybase[30];
+	octet order[30];
+	u32 cofactor;
+} _curves[] =
+{
+	{
+		"k163", {163, 7, 6, 3},
+		{0x01},
+		{
+			0xE8, 0xEE, 0x94, 0x5C, 0x5E, 0x6D, 0x4E, 0xDE,
+			0x93, 0xD7, 0x07, 0xAA, 0xAC, 0x11, 0xBC, 0x7B,
+			0x53, 0xC0, 0x13, 0xFE, 0x02,
+		},
+		{
+			0xD9, 0xA3, 0xDA, 0xCC, 0x38, 0xD5, 0x36, 0x05,
+			0x80, 0x2E, 0x1F, 0x32, 0x58, 0xFF, 0x38, 0x5D,
+			0xB0, 0x0F, 0x07, 0x89, 0x02,
+		},
+		{
+			0xEF, 0xA5, 0xF8, 0x99, 0x0D, 0xCC, 0xE0, 0xA2,
+			0x08, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x04,
+		},
+		2,
+	},
+	{
+		"k233", {233, 74, 0, 0},
+		{0x00},
+		{
+			0x26, 0x61, 0xAD, 0xEF, 0x6E, 0x9D, 0x4C, 0x0A,
+			0xF5, 0x6B, 0xC2, 0x19, 0xA4, 0x63, 0x95, 0x14,
+			0xF4, 0x2F, 0xF2, 0x29, 0xF1, 0x1A, 0x73, 0x7E,
+			0x3A, 0x85, 0xBA, 0x32, 0x72, 0x01,
+		},
+		{
+			0xA3, 0xE6, 0xFA, 0x56, 0x10, 0xC1, 0xE0, 0x56,
+			0x9B, 0xEB, 0x8A, 0xF1, 0x9B, 0xCD, 0xA8, 0x27,
+			0xC4, 0x67, 0x5A, 0x55, 0x0F, 0xF7, 0xB7, 0x19,
+			0xE8, 0xEC, 0x7D, 0x53, 0xDB, 0x01,
+		},
+		{
+			0xDF, 0xAB, 0x73, 0xF1, 0xD5, 0x1A, 0xFB, 0x6E,
+			0xD4, 0xBC, 0x15, 0xB9, 0x5B, 0x9D, 0x06, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x80,
+		},
+		4,
+	},
+};
+
+/*
+*******************************************************************************
+Потребности в стеке
+*******************************************************************************
+*/
+
+static size_t _ec2Bench_deep(size_t m)
+{
+	const size_t n = W_OF_B(m);
+	const size_t f_deep = gf2Create_deep(m);
+	const size_t ec_deep = ec2CreateLD_deep(n, f_deep);
+	return utilMax(6,
+		f_deep,
+		ec_deep,
+		ecCreateGroup_deep(f_deep),
+		ecMulA_deep(n, 3, ec_deep, n),
+		ec2MulAKoblitz_deep(n, f_deep, ec_deep, n),
+		ec2MulAX_deep(n, f_deep, ec_deep, n));
+}
+
+typedef struct
+{
+	ec_o* ec;				/*!< описание кривой */
+	octet* combo_state;		/*!< состояние генератора COMBO */
+	word* pt;				/*!< кратная точка */
+	word* d;				/*!< кратность */
+	void* stack;			/*!< стек */
+} ec2_bench_st;
+
+static void ec2BenchSafe(void* arg, size_t reps)
+{
+	ec2_bench_st* b = (ec2_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		SAFE(ecMulA)(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+static void ec2BenchFast(void* arg, size_t reps)
+{
+	ec2_bench_st* b = (ec2_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		FAST(ecMulA)(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+static void ec2BenchTNAF(void* arg, size_t reps)
+{
+	ec2_bench_st* b = (ec2_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		ec2MulAKoblitz(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+static void ec2BenchLadder(void* arg, size_t reps)
+{
+	ec2_bench_st* b = (ec2_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		ec2MulAX(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+bool_t ec2Bench()
+{
+	// состояние
+	octet state[40000];
+	ec2_bench_st b[1];
+	char name[64];
+	bool_t ret = TRUE;
+	size_t c;
+	// цикл по кривым
+	for (c = 0; c < COUNT_OF(_curves); ++c)
+	{
+		const size_t m = _curves[c].p[0];
+		const size_t no = O_OF_B(m);
+		qr_o* f;
+		ec_o* ec;
+		octet* combo_state;
+		word* pt;
+		word* pt1;
+		word* d;
+		void* stack;
+		// раскладка состояния
+		ASSERT(gf2Create_keep(m) + ec2CreateLD_keep(W_OF_B(m)) +
+			prngCOMBO_keep() + O_OF_W(5 * W_OF_B(m)) + _ec2Bench_deep(m) <=
+			sizeof(state));
+		f = (qr_o*)state;
+		ec = (ec_o*)((octet*)f + gf2Create_keep(m));
+		combo_state = (octet*)ec + ec2CreateLD_keep(W_OF_B(m));
+		pt = (word*)(combo_state + prngCOMBO_keep());
+		pt1 = pt + 2 * W_OF_B(m);
+		d = pt1 + 2 * W_OF_B(m);
+		stack = d + W_OF_B(m);
+		// создать кривую
+		memSetZero(pt, no);
+		((octet*)pt)[0] = 1;
+		if (!gf2Create(f, _curves[c].p, stack) ||
+			!ec2CreateLD(ec, f, _curves[c].A, (octet*)pt, stack) ||
+			!ecCreateGroup(ec, _curves[c].xbase, _curves[c].ybase,
+				_curves[c].order, no, _curves[c].cofactor, stack) ||
+			!ec2IsKoblitz(ec) ||
+			!ec2IsOnA(ec->base, ec, stack) ||
+			!ecHasOrderA(ec->base, ec, ec->order, f->n, stack))
+			return FALSE;
+		// создать генератор COMBO
+		prngCOMBOStart(combo_state, utilNonce32());
+		// сверить кратные точки
+		{
+			size_t i;
+			for (i = 0; i < 8; ++i)
+			{
+				prngCOMBOStepR(d, no, combo_state);
+				wwFrom(d, d, no);
+				if (ec2MulAKoblitz(pt, ec->base, ec, d, f->n, stack) !=
+						FAST(ecMulA)(pt1, ec->base, ec, d, f->n, stack) ||
+					!wwEq(pt, pt1, 2 * f->n))
+					return FALSE;
+			}
+			if (ec2MulAKoblitz(pt, ec->base, ec, ec->order, f->n, stack))
+				return FALSE;
+			// лестница: d = 0, 1, 2, q - 1, q, случайные
+			for (i = 0; i < 13; ++i)
+			{
+				if (i < 3)
+					wwSetW(d, f->n, (word)i);
+				else if (i < 5)
+					wwCopy(d, ec->order, f->n), zzSubW2(d, f->n, 4 - i);
+				else
+				{
+					prngCOMBOStepR(d, no, combo_state);
+					wwFrom(d, d, no);
+				}
+				if (ec2MulAX(pt, ec->base, ec, d, f->n, stack) !=
+						FAST(ecMulA)(pt1, ec->base, ec, d, f->n, stack) ||
+					(i != 0 && i != 4 && !wwEq(pt, pt1, 2 * f->n)))
+					return FALSE;
+			}
+		}
+		// оценить число кратных точек в секунду
+		b->ec = ec, b->combo_state = combo_state;
+		b->pt = pt, b->d = d, b->stack = stack;
+		sprintf(name, "ec2Bench::%s::safe", _curves[c].name);
+		ret &= benchDo(name, "mulpoint", 1, ec2BenchSafe, b);
+		sprintf(name, "ec2Bench::%s::fast", _curves[c].name);
+		ret &= benchDo(name, "mulpoint", 1, ec2BenchFast, b);
+		sprintf(name, "ec2Bench::%s::tnaf", _curves[c].name);
+		ret &= benchDo(name, "mulpoint", 1, ec2BenchTNAF, b);
+		sprintf(name, "ec2Bench::%s::ladder", _curves[c].name);
+		ret &= benchDo(name, "mulpoint", 1, ec2BenchLadder, b);
+	}
+	return ret;
+}
@@ -4,7 +4,7 @@
 \brief Benchmarks for elliptic curves over prime fields
 \project bee2/test
 \created 2013.10.17
-\version 2020.02.05
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -19,6 +19,8 @@
 #include <crypto/bign_lcl.h>
 #include <bee2/math/ecp.h>
 #include <bee2/math/gfp.h>
+#include <bee2/math/ww.h>
+#include "../bench.h"
 
 /*
 *******************************************************************************
@@ -29,8 +31,54 @@
 static size_t _ecpBench_deep(size_t n, size_t f_deep, size_t ec_d, 
 	size_t ec_deep)
 {
-	return O_OF_W(3 * n) + prngCOMBO_keep() +
-		ecMulA_deep(n, ec_d, ec_deep, n);
+	return O_OF_W(21 * n + 4) + prngCOMBO_keep() +
+		utilMax(2,
+			ecMulA_deep(n, ec_d, ec_deep, n),
+			ecpAddMulAX4_deep(n, f_deep, 1));
+}
+
+typedef struct
+{
+	ec_o* ec;				/*!< описание кривой */
+	octet* combo_state;		/*!< состояние генератора COMBO */
+	word* pt;				/*!< кратные точки */
+	word* d;				/*!< кратности */
+	word* a;				/*!< базовые точки (4 полосы) */
+	void* stack;			/*!< стек */
+} ecp_bench_st;
+
+static void ecpBenchSafe(void* arg, size_t reps)
+{
+	ecp_bench_st* b = (ecp_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		SAFE(ecMulA)(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+static void ecpBenchFast(void* arg, size_t reps)
+{
+	ecp_bench_st* b = (ecp_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, ec->f->no, b->combo_state);
+		FAST(ecMulA)(b->pt, ec->base, ec, b->d, ec->f->n, b->stack);
+	}
+}
+
+static void ecpBenchX4(void* arg, size_t reps)
+{
+	ecp_bench_st* b = (ecp_bench_st*)arg;
+	ec_o* ec = b->ec;
+	while (reps--)
+	{
+		prngCOMBOStepR(b->d, 4 * ec->f->no, b->combo_state);
+		ecpAddMulAX4(b->pt, ec, b->a, b->d, b->a, b->a + 8 * ec->f->n, 1,
+			b->stack);
+	}
 }
 
 bool_t ecpBench()
@@ -38,43 +86,35 @@ bool_t ecpBench()
 	// описание кривой
 	bign_params params[1];
 	// состояние
-	octet state[6000];
+	octet state[20000];
+	ecp_bench_st b[1];
 	ec_o* ec;
-	octet* combo_state;
-	word* pt;
-	word* d;
-	void* stack;
+	bool_t ret = TRUE;
 	// загрузить параметры и создать описание кривой
 	ASSERT(bignStart_keep(128, _ecpBench_deep) <= sizeof(state));
 	if (bignStdParams(params, "1.2.112.0.2.0.34.101.45.3.1") != ERR_OK ||
 		bignStart(state, params) != ERR_OK)
 		return FALSE;
 	// раскладка состояния
-	ec = (ec_o*)state;
+	ec = b->ec = (ec_o*)state;
 	ec->tpl = 0;
-	combo_state = objEnd(ec, octet);
-	pt = (word*)(combo_state + prngCOMBO_keep());
-	d = pt + 2 * ec->f->n;
-	stack = d + ec->f->n;
+	b->combo_state = objEnd(ec, octet);
+	b->pt = (word*)(b->combo_state + prngCOMBO_keep());
+	b->d = b->pt + 8 * ec->f->n;
+	b->a = b->d + 4 * ec->f->n;
+	b->stack = b->a + 8 * ec->f->n + 4;
 	// создать генератор COMBO
-	prngCOMBOStart(combo_state, utilNonce32());
+	prngCOMBOStart(b->combo_state, utilNonce32());
 	// оценить число кратных точек в секунду
+	ret &= benchDo("ecpBench::safe", "mulpoint", 1, ecpBenchSafe, b);
+	ret &= benchDo("ecpBench::fast", "mulpoint", 1, ecpBenchFast, b);
+	if (ecpIsOperableX4(ec))
 	{
-		const size_t reps = 1000;
 		size_t i;
-		tm_ticks_t ticks;
-		// эксперимент
-		for (i = 0, ticks = tmTicks(); i < reps; ++i)
-		{
-			prngCOMBOStepR(d, ec->f->no, combo_state);
-			ecMulA(pt, ec->base, ec, d, ec->f->n, stack);
-		}
-		ticks = tmTicks() - ticks;
-		// печать результатов
-		printf("ecpBench: %u cycles/mulpoint [%u mulpoints/sec]\n", 
-			(unsigned)(ticks / reps),
-			(unsigned)tmSpeed(reps, ticks));
+		for (i = 0; i < 4; ++i)
+			wwCopy(b->a + 2 * ec->f->n * i, ec->base, 2 * ec->f->n);
+		wwSetZero(b->a + 8 * ec->f->n, 4);
+		ret &= benchDo("ecpBench::x4", "mulpoint", 4, ecpBenchX4, b);
 	}
-	// все нормально
-	return TRUE;
+	return ret;
 }
@@ -4,17 +4,23 @@
 \brief Tests for elliptic curves over prime fields
 \project bee2/test
 \created 2017.05.29
-\version 2017.08.23
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
 */
 
+#include <bee2/core/blob.h>
 #include <bee2/core/hex.h>
+#include <bee2/core/mem.h>
 #include <bee2/core/obj.h>
+#include <bee2/core/str.h>
 #include <bee2/core/util.h>
 #include <bee2/math/gfp.h>
 #include <bee2/math/ecp.h>
+#include <bee2/math/ww.h>
+#include <bee2/math/zm.h>
+#include <bee2/math/zz.h>
 
 /*
 *******************************************************************************
@@ -36,6 +42,449 @@ static char xbase[] =
 static char ybase[] = 
 	"B0E9804939D7C2E931D4CE052CCC6B6B692514CCADBA44940484EEA5F52D9268";
 static u32 cofactor = 1;
+/*
+*******************************************************************************
+Сумма кратных точек: массивы
+
+Слагаемыми являются точки G, 2G, G, 2G,... Результат сравнивается с
+кратной точкой (\sum d[i] + \sum_{i нечетно} d[i])G.
+*******************************************************************************
+*/
+
+static bool_t ecpTestAddMulAV(const ec_o* ec, size_t k)
+{
+	const size_t n = ec->f->n;
+	size_t i;
+	bool_t ret;
+	word* a;
+	word* d;
+	word* e;
+	word* b;
+	void* stack;
+	// подготовить память
+	a = (word*)blobCreate(O_OF_W(2 * n * k + k + n + 4 * n) + 
+		utilMax(3,
+			ecAddMulAV_deep(n, ec->d, ec->deep, k, 1),
+			ecAddMulA_deep(n, ec->d, ec->deep, 3, 1, 1, 1),
+			ecMulA_deep(n, ec->d, ec->deep, n)));
+	if (!a)
+		return FALSE;
+	d = a + 2 * n * k;
+	e = d + k;
+	b = e + n;
+	stack = b + 4 * n;
+	// a[i] <- G или 2G, d[i] <- псевдослучайное, e <- \sum
+	wwSetW(e, n, 2);
+	if (!ecMulA(b, ec->base, ec, e, n, stack))
+	{
+		blobClose(a);
+		return FALSE;
+	}
+	wwSetZero(e, n);
+	for (i = 0; i < k; ++i)
+	{
+		wwCopy(a + 2 * n * i, i % 2 ? b : ec->base, 2 * n);
+		d[i] = (word)((i + 1) * 0x9E3779B9u) ^ (word)(i << 7);
+		wwSetW(b + 2 * n, n, d[i]);
+		zzAddMod(e, e, b + 2 * n, ec->order, n);
+		if (i % 2)
+			zzAddMod(e, e, b + 2 * n, ec->order, n);
+	}
+	// b <- \sum d[i] a[i] == e G?
+	ret = ecAddMulAV(b, ec, k, a, d, 1, stack) &&
+		ecMulA(b + 2 * n, ec->base, ec, e, n, stack) &&
+		wwEq(b, b + 2 * n, 2 * n);
+	// сравнить с ecAddMulA()
+	if (ret && k == 3)
+		ret = ecAddMulA(b + 2 * n, ec, stack, 3, a, d, SIZE_1,
+			a + 2 * n, d + 1, SIZE_1, a + 4 * n, d + 2, SIZE_1) &&
+			wwEq(b, b + 2 * n, 2 * n);
+	blobClose(a);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Однородные координаты
+
+По описанию ec в якобиановых координатах строится описание той же кривой 
+в однородных координатах. Кратные точки сравниваются. Проверяются 
+исключительные для якобиановых формул ситуации: a + a, a - a, O + a.
+*******************************************************************************
+*/
+
+static bool_t ecpTestCreateP(const ec_o* ec)
+{
+	const size_t n = ec->f->n;
+	size_t i;
+	bool_t ret;
+	octet* state;
+	ec_o* ecp;
+	word* a;
+	word* b;
+	word* c;
+	word* u;
+	word* d;
+	void* stack;
+	// подготовить память
+	state = (octet*)blobCreate(ecpCreateP_keep(n) + objKeep(ec->f) + 
+		O_OF_W(11 * n) + 
+		utilMax(3,
+			ecpCreateP_deep(n, ec->f->deep),
+			ecMulA_deep(n, 3, ecpCreateP_deep(n, ec->f->deep), n),
+			ecMulA_deep(n, ec->d, ec->deep, n)));
+	if (!state)
+		return FALSE;
+	ecp = (ec_o*)state;
+	a = (word*)(state + ecpCreateP_keep(n) + objKeep(ec->f));
+	b = a + 2 * n;
+	c = b + 2 * n;
+	u = c + 3 * n;
+	d = u + 3 * n;
+	stack = d + n;
+	// создать кривую и группу точек
+	qrTo((octet*)a, ec->A, ec->f, stack);
+	qrTo((octet*)b, ec->B, ec->f, stack);
+	qrTo((octet*)c, ecX(ec->base), ec->f, stack);
+	qrTo((octet*)c + ec->f->no, ecY(ec->base, n), ec->f, stack);
+	wwTo(u, O_OF_W(n + 1), ec->order);
+	if (!ecpCreateP(ecp, ec->f, (octet*)a, (octet*)b, stack) ||
+		!ecCreateGroup(ecp, (octet*)c, (octet*)c + ec->f->no, (octet*)u, 
+			O_OF_W(n + 1), (u32)ec->cofactor, stack))
+	{
+		blobClose(state);
+		return FALSE;
+	}
+	objAppend(ecp, ec->f, 0);
+	// кратные точки: d <- 1, q - 1, (q - 1) / 2, ...
+	for (i = 0, ret = TRUE; ret && i < 6; ++i)
+	{
+		if (i == 0)
+			wwSetW(d, n, 1);
+		else
+		{
+			wwCopy(d, ec->order, n), zzSubW2(d, n, 1);
+			wwShLo(d, n, i - 1);
+			if (i > 2)
+				d[0] ^= (word)0xA5A5A5A5;
+		}
+		ret = ecMulA(a, ec->base, ecp, d, n, stack) &&
+			ecMulA(b, ec->base, ec, d, n, stack) &&
+			wwEq(a, b, 2 * n) &&
+			FAST(ecMulA)(a, ec->base, ecp, d, n, stack) &&
+			wwEq(a, b, 2 * n);
+	}
+	// a + a == 2a?
+	if (ret)
+	{
+		ecFromA(c, ec->base, ecp, stack);
+		ecAdd(u, c, c, ecp, stack);
+		ecToA(a, u, ecp, stack);
+		ecDblA(u, ec->base, ecp, stack);
+		ecToA(b, u, ecp, stack);
+		ret = wwEq(a, b, 2 * n);
+	}
+	// a - a == O, a + (-a) == O?
+	if (ret)
+	{
+		ecSub(u, c, c, ecp, stack);
+		ret = !ecToA(a, u, ecp, stack);
+		ecSubA(u, c, ec->base, ecp, stack);
+		ret &= !ecToA(a, u, ecp, stack);
+	}
+	// O + a == a, 2O == O?
+	if (ret)
+	{
+		ecSetO(u, ecp);
+		ecAdd(u, u, c, ecp, stack);
+		ret = ecToA(a, u, ecp, stack) && wwEq(a, ec->base, 2 * n);
+		ecSetO(u, ecp);
+		ecAddA(u, u, ec->base, ecp, stack);
+		ret &= ecToA(a, u, ecp, stack) && wwEq(a, ec->base, 2 * n);
+		ecSetO(u, ecp);
+		ecDbl(u, u, ecp, stack);
+		ret &= !ecToA(a, u, ecp, stack);
+	}
+	blobClose(state);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Пакетная сумма кратных точек
+
+Первые слагаемые: G, 2G, G, 2G. Вторые: 2G, G, 2G, G. Кратности первых 
+слагаемых -- псевдослучайные числа длины n, вторых -- длины n / 2 + 1. 
+В полосе 2 вторая кратность нулевая, в полосе 3 сумма равняется O. 
+Результаты сравниваются с ecAddMulA().
+*******************************************************************************
+*/
+
+static bool_t ecpTestAddMulAX4(const ec_o* ec)
+{
+	const size_t n = ec->f->n;
+	const size_t m = n / 2 + 1;
+	size_t i, j;
+	size_t mask;
+	bool_t ret;
+	word* a;
+	word* c;
+	word* d;
+	word* e;
+	word* b;
+	void* stack;
+	if (!ecpIsOperableX4(ec))
+		return FALSE;
+	// подготовить память
+	a = (word*)blobCreate(O_OF_W(8 * n + 8 * n + 4 * n + 4 * m + 10 * n) + 
+		utilMax(3,
+			ecpAddMulAX4_deep(n, ec->f->deep, m),
+			ecAddMulA_deep(n, ec->d, ec->deep, 2, n, m),
+			ecMulA_deep(n, ec->d, ec->deep, n)));
+	if (!a)
+		return FALSE;
+	c = a + 8 * n;
+	d = c + 8 * n;
+	e = d + 4 * n;
+	b = e + 4 * m;
+	stack = b + 10 * n;
+	// a[j], c[j] <- G или 2G
+	wwSetW(d, n, 2);
+	if (!ecMulA(b, ec->base, ec, d, n, stack))
+	{
+		blobClose(a);
+		return FALSE;
+	}
+	for (j = 0; j < 4; ++j)
+	{
+		wwCopy(a + 2 * n * j, j % 2 ? b : ec->base, 2 * n);
+		wwCopy(c + 2 * n * j, j % 2 ? ec->base : b, 2 * n);
+	}
+	// d[j], e[j] <- псевдослучайные
+	for (i = 0; i < 4 * n; ++i)
+		d[i] = (word)((i + 1) * 0x9E3779B9u) ^ (word)(i << 11);
+	for (i = 0; i < 4 * m; ++i)
+		e[i] = (word)((i + 3) * 0x85EBCA6Bu) ^ (word)(i << 5);
+	wwSetZero(e + 2 * m, m);
+	// полоса 3: (q - 1)(2G) + 2G == O
+	wwCopy(d + 3 * n, ec->order, n), zzSubW2(d + 3 * n, n, 1);
+	wwSetW(e + 3 * m, m, 2);
+	// сравнить с ecAddMulA()
+	mask = ecpAddMulAX4(b, ec, a, d, c, e, m, stack);
+	for (ret = (mask == 7), j = 0; ret && j < 4; ++j)
+		if (ecAddMulA(b + 8 * n, ec, stack, 2, a + 2 * n * j, d + n * j, n,
+			c + 2 * n * j, e + m * j, m))
+			ret = j < 3 && wwEq(b + 2 * n * j, b + 8 * n, 2 * n);
+		else
+			ret = j == 3;
+	blobClose(a);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Ядра фиксированной длины
+
+Кривая ec пересоздается над полями с редукциями Крэндалла, Барретта,
+Монтгомери и обычной (см. zmCreateRed()), а также над полем с редукцией, 
+выбранной по результатам настройки (см. zmTune()). С редукциями Крэндалла
+и Монтгомери используются специализированные формулы (см. ecpCreateJ()), 
+с остальными -- общие. Дополнительно проверяется, что zmCreateRed()
+отказывается строить кольца с неподходящими редукциями.
+Кратные точки, суммы и разности (в том числе в исключительных ситуациях
+P + P и P - P) сравниваются с вычисленными над исходным полем ec->f.
+*******************************************************************************
+*/
+
+static bool_t ecpTestFix(const ec_o* ec)
+{
+	const size_t n = ec->f->n;
+	const size_t f_keep = utilMax(4, zmCreateCrand_keep(no),
+		zmCreateBarr_keep(no), zmCreateMont_keep(no), zmCreatePlain_keep(no));
+	const size_t f_deep = utilMax(4, zmCreateCrand_deep(no),
+		zmCreateBarr_deep(no), zmCreateMont_deep(no), zmCreatePlain_deep(no));
+	const size_t reds[4] = 
+		{ ZM_RED_CRAND, ZM_RED_BARR, ZM_RED_MONT, ZM_RED_PLAIN };
+	size_t i, j;
+	bool_t ret = TRUE;
+	octet* t;
+	word* d;
+	word* pt;
+	qr_o* f;
+	ec_o* ec1;
+	void* stack;
+	// подготовить память
+	t = (octet*)blobCreate(96 + O_OF_W(n + 15 * n) + f_keep + 
+		ecpCreateJ_keep(n) + 
+		utilMax(4,
+			f_deep,
+			ecpCreateJ_deep(n, f_deep),
+			ecMulA_deep(n, ec->d, ec->deep, n),
+			ecMulA_deep(n, ec->d, ecpCreateJ_deep(n, f_deep), n)));
+	if (!t)
+		return FALSE;
+	d = (word*)(t + 96);
+	pt = d + n;
+	f = (qr_o*)(pt + 15 * n);
+	ec1 = (ec_o*)((octet*)f + f_keep);
+	stack = (octet*)ec1 + ecpCreateJ_keep(n);
+	// неподходящие редукции: Монтгомери для четного модуля, Крэндалла
+	// для модуля не вида B^n - c
+	hexToRev(t, p);
+	t[0] ^= 1;
+	ret &= !zmCreateRed(f, t, no, ZM_RED_MONT, stack);
+	t[0] ^= 1, t[O_PER_W] ^= 1;
+	ret &= !zmCreateRed(f, t, no, ZM_RED_CRAND, stack);
+	for (j = 0; ret && j < 5; ++j)
+	{
+		// создать f
+		hexToRev(t, p);
+		if (j < 4)
+		{
+			if (!zmCreateRed(f, t, no, reds[j], stack) || zmRed(f) != reds[j])
+			{
+				ret = FALSE;
+				break;
+			}
+		}
+		else
+		{
+			// настроенный выбор
+			zmTune(TRUE);
+			zmCreate(f, t, no, stack);
+			zmTune(FALSE);
+			if (zmRed(f) != zmTuned(n, TRUE) || zmRed(f) == ZM_RED_PLAIN)
+			{
+				ret = FALSE;
+				break;
+			}
+		}
+		// создать ec1 = EC_{ab}(f)
+		hexToRev(t, a), hexToRev(t + 32, b);
+		if (!ecpCreateJ(ec1, f, t, t + 32, stack))
+		{
+			ret = FALSE;
+			break;
+		}
+		hexToRev(t, xbase), hexToRev(t + 32, ybase), hexToRev(t + 64, q);
+		if (!ecCreateGroup(ec1, t, t + 32, t + 64, no, cofactor, stack))
+		{
+			ret = FALSE;
+			break;
+		}
+		for (i = 0; ret && i < 4; ++i)
+		{
+			// d <- псевдослучайное
+			wwCopy(d, ec->order, n), wwShLo(d, n, i + 1);
+			d[0] ^= (word)((i + 1) * 0x85EBCA6Bu);
+			// pt[0] <- dG над ec, pt[2] <- dG над ec1
+			ret &= ecMulA(pt, ec->base, ec, d, n, stack) &&
+				ecMulA(pt + 2 * n, ec1->base, ec1, d, n, stack);
+			if (!ret)
+				break;
+			// совпадают?
+			qrTo(t, ecX(pt), ec->f, stack);
+			qrTo(t + 32, ecY(pt, n), ec->f, stack);
+			qrTo(t + 64, ecX(pt + 2 * n), ec1->f, stack);
+			ret &= memEq(t, t + 64, 32);
+			qrTo(t + 64, ecY(pt + 2 * n, n), ec1->f, stack);
+			ret &= memEq(t + 32, t + 64, 32);
+			// P + P == 2P, P + P(A) == 2P, P - P == P - P(A) == O
+			ecFromA(pt + 4 * n, pt + 2 * n, ec1, stack);
+			ecDbl(pt + 7 * n, pt + 4 * n, ec1, stack);
+			ecAdd(pt + 10 * n, pt + 4 * n, pt + 4 * n, ec1, stack);
+			ret &= ecToA(pt, pt + 7 * n, ec1, stack) &&
+				ecToA(pt + 13 * n, pt + 10 * n, ec1, stack) &&
+				wwEq(pt, pt + 13 * n, 2 * n);
+			ecAddA(pt + 10 * n, pt + 4 * n, pt + 2 * n, ec1, stack);
+			ret &= ecToA(pt + 13 * n, pt + 10 * n, ec1, stack) &&
+				wwEq(pt, pt + 13 * n, 2 * n);
+			ecSub(pt + 10 * n, pt + 4 * n, pt + 4 * n, ec1, stack);
+			ret &= ecIsO(pt + 10 * n, ec1);
+			ecSubA(pt + 10 * n, pt + 4 * n, pt + 2 * n, ec1, stack);
+			ret &= ecIsO(pt + 10 * n, ec1);
+			// 2P + P == 3P
+			ecAddA(pt + 10 * n, pt + 7 * n, pt + 2 * n, ec1, stack);
+			ecAdd(pt + 7 * n, pt + 10 * n, pt + 4 * n, ec1, stack);
+			ecSub(pt + 7 * n, pt + 7 * n, pt + 4 * n, ec1, stack);
+			ret &= ecToA(pt + 13 * n, pt + 7 * n, ec1, stack) &&
+				ecToA(pt, pt + 10 * n, ec1, stack) &&
+				wwEq(pt, pt + 13 * n, 2 * n);
+		}
+	}
+	blobClose(t);
+	return ret;
+}
+
+/*
+*******************************************************************************
+Квадратные корни
+
+Проверяется gfpSqrt() над полями проверочной кривой (p \equiv 3 \mod 4),
+GF(2^255 - 19) (p \equiv 5 \mod 8) и GF(2^224 - 2^96 + 1) 
+(p - 1 делится на 2^96, алгоритм Тонелли -- Шенкса). Элементы 
+x_{i + 1} = x_i^2 + 3 возводятся в квадрат, из квадратов извлекаются корни.
+Для элементов x_i корень должен существовать тогда и только тогда, когда 
+символ Якоби (x_i / p), вычисленный с помощью zzJacobi(), равняется 1.
+*******************************************************************************
+*/
+
+static bool_t ecpTestSqrt(const char* mod)
+{
+	const size_t no = strLen(mod) / 2;
+	const size_t n = W_OF_O(no);
+	octet state[512];
+	octet stack[4096];
+	octet t[32];
+	word x[W_OF_O(32)];
+	word y[W_OF_O(32)];
+	word z[W_OF_O(32)];
+	size_t i;
+	qr_o* f;
+	// pre
+	ASSERT(no <= sizeof(t) && n <= COUNT_OF(x));
+	ASSERT(gfpCreate_keep(no) <= sizeof(state));
+	ASSERT(gfpCreate_deep(no) <= sizeof(stack));
+	ASSERT(gfpSqrt_deep(n, gfpCreate_deep(no)) <= sizeof(stack));
+	ASSERT(zzJacobi_deep(n, n) <= sizeof(stack));
+	// создать поле
+	f = (qr_o*)state;
+	hexToRev(t, mod);
+	if (!gfpCreate(f, t, no, stack))
+		return FALSE;
+	// sqrt(0) == 0
+	qrSetZero(x, f);
+	if (!gfpSqrt(y, x, f, stack) || !qrIsZero(y, f))
+		return FALSE;
+	// x <- 1
+	qrSetUnity(x, f);
+	for (i = 0; i < 50; ++i)
+	{
+		// y <- x^2, z <- sqrt(y), z == \pm x?
+		qrSqr(y, x, f, stack);
+		if (!gfpSqrt(z, y, f, stack))
+			return FALSE;
+		if (qrCmp(z, x, f) != 0)
+		{
+			qrNeg(z, z, f);
+			if (qrCmp(z, x, f) != 0)
+				return FALSE;
+		}
+		// x -- вычет <=> (x / p) == 1?
+		qrTo(t, x, f, stack);
+		wwFrom(y, t, no);
+		if (gfpSqrt(z, x, f, stack) !=
+			(zzJacobi(y, n, f->mod, n, stack) == 1))
+			return FALSE;
+		// x <- x^2 + 3
+		qrSqr(x, x, f, stack);
+		qrAddUnity(x, x, f);
+		qrAddUnity(x, x, f);
+		qrAddUnity(x, x, f);
+	}
+	return TRUE;
+}
+
 /*
 *******************************************************************************
 Тестирование
@@ -52,8 +501,13 @@ bool_t ecpTest()
 	const size_t ec_deep = ecpCreateJ_deep(n, f_deep);
 	// состояние и стек
 	octet state[2048];
-	octet stack[2048];
+	octet stack[8192];
 	octet t[96];
+	octet pre[512];
+	word d[8];
+	word pt[2][16];
+	word w[32];
+	size_t i;
 	// поле и эк
 	qr_o* f;
 	ec_o* ec;
@@ -70,9 +524,10 @@ bool_t ecpTest()
 	ec = (ec_o*)state;
 	if (!ecpCreateJ(ec, f, t, t + 32, stack))
 		return FALSE;
-	// создать группу точек ec
+	// создать группу точек ec (с параметром Барретта для ecModOrder())
 	hexToRev(t, xbase), hexToRev(t + 32, ybase), hexToRev(t + 64, q);
-	if (!ecCreateGroup(ec, t, t + 32, t + 64, no, cofactor, stack))
+	ASSERT(ecCreateGroupBarr_deep(n, f_deep) <= sizeof(stack));
+	if (!ecCreateGroupBarr(ec, t, t + 32, t + 64, no, cofactor, stack))
 		return FALSE;
 	// присоединить f к ec
 	objAppend(ec, f, 0);
@@ -92,6 +547,79 @@ bool_t ecpTest()
 	ASSERT(ecHasOrderA_deep(n, ec->d, ec_deep, n) <= sizeof(stack));
 	if (!ecHasOrderA(ec->base, ec, ec->order, n, stack))
 		return FALSE;
+	// приведение по модулю порядка: сравнение с zzMod()
+	ASSERT(3 * n <= COUNT_OF(w));
+	ASSERT(ecModOrder_deep(n) <= sizeof(stack));
+	ASSERT(zzMod_deep(3 * n, n) <= sizeof(stack));
+	for (i = 0; i < 3 * n; ++i)
+		w[i] = ~ec->order[i % n] ^ (word)(0x9E3779B9u * (i + 1));
+	for (i = 1; i <= 3 * n; ++i)
+	{
+		ecModOrder(d, w, i, ec, stack);
+		zzMod(pt[0], w, i, ec->order, n, stack);
+		if (!wwEq(d, pt[0], n))
+			return FALSE;
+	}
+	// гребенчатый метод
+	ASSERT(ecCombPrecA_keep(n, 4) <= sizeof(pre));
+	ASSERT(ecCombPrecA_deep(n, ec->d, ec_deep) <= sizeof(stack));
+	ASSERT(ecCombMulA_deep(n, ec->d, ec_deep, 4) <= sizeof(stack));
+	ASSERT(ecMulA_deep(n, ec->d, ec_deep, n) <= sizeof(stack));
+	if (!ecCombPrecA((word*)pre, ec->base, ec, 4, stack))
+		return FALSE;
+	for (i = 0; i < 6; ++i)
+	{
+		// d <- 1, 2, q - 1, q - 2, (q - 1) / 2, ...
+		if (i < 2)
+			wwSetW(d, n, (word)(i + 1));
+		else if (i < 4)
+			wwCopy(d, ec->order, n), zzSubW2(d, n, (word)(i - 1));
+		else
+		{
+			wwCopy(d, ec->order, n), wwShLo(d, n, i - 3);
+			d[0] ^= (word)0x5A5A5A5A;
+		}
+		if (!ecCombMulA(pt[0], (word*)pre, ec, 4, d, n, stack) ||
+			!ecMulA(pt[1], ec->base, ec, d, n, stack) ||
+			!wwEq(pt[0], pt[1], 2 * n))
+			return FALSE;
+	}
+	wwSetZero(d, n);
+	if (ecCombMulA(pt[0], (word*)pre, ec, 4, d, n, stack))
+		return FALSE;
+	// сумма кратных: алгоритм 3.51 и метод Пиппенджера
+	if (!ecpTestAddMulAV(ec, 3) || !ecpTestAddMulAV(ec, 400))
+		return FALSE;
+	// однородные координаты
+	if (!ecpTestCreateP(ec))
+		return FALSE;
+	// пакетная сумма кратных
+	if (!ecpTestAddMulAX4(ec))
+		return FALSE;
+	// ядра фиксированной длины
+	if (!ecpTestFix(ec))
+		return FALSE;
+	// квадратные корни
+	if (!ecpTestSqrt(p) ||
+		!ecpTestSqrt(
+			"7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED") ||
+		!ecpTestSqrt(
+			"FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001"))
+		return FALSE;
+	// алгоритм SWU
+	ASSERT(ecpSWU_deep(n, f_deep) <= sizeof(stack));
+	ASSERT(ecpIsOnA_deep(n, f_deep) <= sizeof(stack));
+	for (i = 0; i < 8; ++i)
+	{
+		// d <- псевдослучайный элемент f
+		wwCopy(d, f->mod, n), wwShLo(d, n, i + 1);
+		d[0] ^= (word)((i + 1) * 0x9E3779B9u);
+		if (!zmIsIn(d, f))
+			return FALSE;
+		ecpSWU(pt[0], d, ec, stack);
+		if (!ecpIsOnA(pt[0], ec, stack))
+			return FALSE;
+	}
 	// все нормально
 	return TRUE;
 }
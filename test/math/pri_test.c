@@ -4,7 +4,7 @@
 \brief Tests for prime numbers
 \project bee2/test
 \created 2014.07.07
-\version 2016.07.15
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -28,9 +28,11 @@ bool_t priTest()
 	size_t i;
 	word a[W_OF_B(521)];
 	word p[W_OF_B(289)];
+	word p1[W_OF_B(289)];
 	word mods[1024];
 	octet combo_state[32];
-	octet stack[4096];
+	octet combo_state1[32];
+	octet stack[8192];
 	// инициализировать генератор COMBO
 	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
 	prngCOMBOStart(combo_state, utilNonce32());
@@ -93,6 +95,17 @@ bool_t priTest()
 		a[0] != WORD_MAX - 356 ||
 		!wwIsRepW(a + 1, W_OF_B(256) - 1, WORD_MAX))
 		return FALSE;
+	// найти то же простое серией вызовов по 7 кандидатов
+	memSet(a, 0xFF, O_OF_B(256));
+	zzSubW2(a, W_OF_B(256), 400);
+	for (i = 0; !priNextPrime(a, a, W_OF_B(256), 7, 10, B_PER_IMPOSSIBLE,
+		stack); ++i)
+		if (i == 3 || wwBitSize(a, W_OF_B(256)) != 256)
+			return FALSE;
+	if (i != 3 ||
+		a[0] != WORD_MAX - 356 ||
+		!wwIsRepW(a + 1, W_OF_B(256) - 1, WORD_MAX))
+		return FALSE;
 	// найти простое число 2^256 - 189
 	zzAddW2(a, W_OF_B(256), 1);
 	if (!priNextPrime(a, a, W_OF_B(256), 200, 10, B_PER_IMPOSSIBLE, stack) ||
@@ -124,6 +137,27 @@ bool_t priTest()
 	if (!priExtendPrime(p, 5, a, 1, SIZE_MAX, 0, 
 		prngCOMBOStepR, combo_state, stack) || p[0] != 23)
 		return FALSE;
+	// найти простое число 2^256 - 357 в 4 потоках
+	ASSERT(priNextPrimeMT_deep(W_OF_B(256), 10, 4) <= sizeof(stack));
+	memSet(a, 0xFF, O_OF_B(256));
+	zzSubW2(a, W_OF_B(256), 400);
+	if (!priNextPrimeMT(a, a, W_OF_B(256), 50, 10, B_PER_IMPOSSIBLE, 4,
+			stack) ||
+		a[0] != WORD_MAX - 356 ||
+		!wwIsRepW(a + 1, W_OF_B(256) - 1, WORD_MAX))
+		return FALSE;
+	// построить 289-битовое простое вида 2r(2^256 - 189) + 1 в 4 потоках
+	// и сравнить с однопоточным построением
+	ASSERT(priExtendPrime_deep(289, W_OF_B(256), 10) <= sizeof(stack));
+	ASSERT(priExtendPrimeMT_deep(289, W_OF_B(256), 10, 4) <= sizeof(stack));
+	a[0] = WORD_MAX - 188;
+	memCopy(combo_state1, combo_state, sizeof(combo_state));
+	if (!priExtendPrime(p, 289, a, W_OF_B(256), SIZE_MAX, 10, 
+			prngCOMBOStepR, combo_state, stack) ||
+		!priExtendPrimeMT(p1, 289, a, W_OF_B(256), SIZE_MAX, 10, 4,
+			prngCOMBOStepR, combo_state1, stack) ||
+		!wwEq(p, p1, W_OF_B(289)))
+		return FALSE;
 	// все нормально
 	return TRUE;
 }
@@ -0,0 +1,216 @@
+/*
+*******************************************************************************
+\file ww_bench.c
+\brief Benchmarks for arbitrary length words and multiple-precision integers
+\project bee2/test
+\created 2026.10.15
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/core/word.h>
+#include <bee2/math/ww.h>
+#include <bee2/math/zz.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Замер производительности
+
+Измеряется время выполнения операций над словами (ww) и числами (zz)
+длины 256 и 512 битов. Выбор из таблицы (wwSelect()) выполняется над 
+16 элементами длины 3 * 256 и 3 * 512 битов (точки в проективных 
+координатах). Операции по модулю выполняются над вычетами
+по случайному нечетному модулю со старшим битом 1.
+*******************************************************************************
+*/
+
+#define WW_BENCH_MAX_N W_OF_B(512)
+
+typedef struct
+{
+	word a[2 * WW_BENCH_MAX_N];		/*!< первый операнд */
+	word b[2 * WW_BENCH_MAX_N];		/*!< второй операнд */
+	word c[3 * WW_BENCH_MAX_N];		/*!< результат (в том числе выбора) */
+	word mod[WW_BENCH_MAX_N];		/*!< модуль */
+	word e[WW_BENCH_MAX_N];			/*!< показатель степени */
+	word table[16 * 3 * WW_BENCH_MAX_N];	/*!< таблица для выбора */
+	size_t n;						/*!< длина операндов в словах */
+	size_t acc;						/*!< накопитель результатов */
+	octet stack[4096];				/*!< стек */
+} ww_bench_st;
+
+static void wwBenchXor2(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		wwXor2(b->c, b->a, b->n);
+}
+
+static void wwBenchCmp(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		b->acc += (size_t)wwCmp(b->a, b->b, b->n);
+}
+
+static void wwBenchShLo(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		wwShLo(b->c, b->n, 17);
+}
+
+static void wwBenchBitSize(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		b->acc += wwBitSize(b->a, b->n);
+}
+
+static void wwBenchSelect(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		wwSelect(b->c, b->table, 16, (b->acc++) & 15, 3 * b->n);
+}
+
+static void zzBenchAdd(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		b->acc += zzAdd(b->c, b->a, b->b, b->n);
+}
+
+static void zzBenchSub(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		b->acc += zzSub(b->c, b->a, b->b, b->n);
+}
+
+static void zzBenchMul(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzMul(b->c, b->a, b->n, b->b, b->n, b->stack);
+}
+
+static void zzBenchSqr(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzSqr(b->c, b->a, b->n, b->stack);
+}
+
+static void zzBenchMod(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzMod(b->c, b->a, 2 * b->n, b->mod, b->n, b->stack);
+}
+
+static void zzBenchMulMod(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzMulMod(b->c, b->b, b->c, b->mod, b->n, b->stack);
+}
+
+static void zzBenchInvMod(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzInvMod(b->c, b->b, b->mod, b->n, b->stack);
+}
+
+static void zzBenchPowerMod(void* arg, size_t reps)
+{
+	ww_bench_st* b = (ww_bench_st*)arg;
+	while (reps--)
+		zzPowerMod(b->c, b->b, b->n, b->e, b->n, b->mod, b->stack);
+}
+
+bool_t wwBench()
+{
+	static const struct
+	{
+		size_t n;
+		const char* names[13];
+	} sizes[] =
+	{
+		{
+			W_OF_B(256),
+			{
+				"wwBench::ww-xor2[256]", "wwBench::ww-cmp[256]",
+				"wwBench::ww-shlo[256]", "wwBench::ww-bitsize[256]",
+				"wwBench::ww-select[16x768]",
+				"wwBench::zz-add[256]", "wwBench::zz-sub[256]",
+				"wwBench::zz-mul[256]", "wwBench::zz-sqr[256]",
+				"wwBench::zz-mod[512/256]", "wwBench::zz-mulmod[256]",
+				"wwBench::zz-invmod[256]", "wwBench::zz-powermod[256]",
+			},
+		},
+		{
+			W_OF_B(512),
+			{
+				"wwBench::ww-xor2[512]", "wwBench::ww-cmp[512]",
+				"wwBench::ww-shlo[512]", "wwBench::ww-bitsize[512]",
+				"wwBench::ww-select[16x1536]",
+				"wwBench::zz-add[512]", "wwBench::zz-sub[512]",
+				"wwBench::zz-mul[512]", "wwBench::zz-sqr[512]",
+				"wwBench::zz-mod[1024/512]", "wwBench::zz-mulmod[512]",
+				"wwBench::zz-invmod[512]", "wwBench::zz-powermod[512]",
+			},
+		},
+	};
+	static void (*const fns[13])(void*, size_t) =
+	{
+		wwBenchXor2, wwBenchCmp, wwBenchShLo, wwBenchBitSize, wwBenchSelect,
+		zzBenchAdd, zzBenchSub, zzBenchMul, zzBenchSqr,
+		zzBenchMod, zzBenchMulMod, zzBenchInvMod, zzBenchPowerMod,
+	};
+	octet combo_state[256];
+	ww_bench_st b[1];
+	bool_t ret = TRUE;
+	size_t i, j;
+	// pre
+	ASSERT(zzMul_deep(WW_BENCH_MAX_N, WW_BENCH_MAX_N) <= sizeof(b->stack));
+	ASSERT(zzSqr_deep(WW_BENCH_MAX_N) <= sizeof(b->stack));
+	ASSERT(zzMod_deep(2 * WW_BENCH_MAX_N, WW_BENCH_MAX_N) <=
+		sizeof(b->stack));
+	ASSERT(zzMulMod_deep(WW_BENCH_MAX_N) <= sizeof(b->stack));
+	ASSERT(zzInvMod_deep(WW_BENCH_MAX_N) <= sizeof(b->stack));
+	ASSERT(zzIsCoprime_deep(WW_BENCH_MAX_N, WW_BENCH_MAX_N) <=
+		sizeof(b->stack));
+	ASSERT(zzPowerMod_deep(WW_BENCH_MAX_N, WW_BENCH_MAX_N) <=
+		sizeof(b->stack));
+	// инициализировать генератор COMBO
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	b->acc = 0;
+	// цикл по длинам
+	for (i = 0; i < COUNT_OF(sizes); ++i)
+	{
+		const size_t n = b->n = sizes[i].n;
+		// операнды
+		prngCOMBOStepR(b->a, O_OF_W(2 * n), combo_state);
+		prngCOMBOStepR(b->mod, O_OF_W(n), combo_state);
+		prngCOMBOStepR(b->e, O_OF_W(n), combo_state);
+		prngCOMBOStepR(b->table, sizeof(b->table), combo_state);
+		b->mod[n - 1] |= WORD_BIT_HI, b->mod[0] |= 1;
+		do
+			prngCOMBOStepR(b->b, O_OF_W(n), combo_state),
+			zzMod(b->b, b->b, n, b->mod, n, b->stack);
+		while (!zzIsCoprime(b->b, n, b->mod, n, b->stack));
+		zzMod(b->c, b->a, n, b->mod, n, b->stack);
+		// эксперименты
+		for (j = 0; j < COUNT_OF(fns); ++j)
+			ret &= benchDo(sizes[i].names[j], "op", 1, fns[j], b);
+	}
+	return ret;
+}
@@ -0,0 +1,134 @@
+/*
+*******************************************************************************
+\file zz_bench.c
+\brief Benchmarks for multiple-precision unsigned integers
+\project bee2/test
+\created 2026.10.14
+\version 2026.10.15
+\copyright The Bee2 authors
+\license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
+*******************************************************************************
+*/
+
+#include <stdio.h>
+#include <bee2/core/prng.h>
+#include <bee2/core/util.h>
+#include <bee2/core/word.h>
+#include <bee2/math/zz.h>
+#include <bee2/math/ww.h>
+#include <math/zz/zz_lcl.h>
+#include "../bench.h"
+
+/*
+*******************************************************************************
+Умножение: школьный алгоритм / алгоритм Карацубы
+
+Измеряется число тактов на умножение (возведение в квадрат) чисел из
+n слов. По результатам выбираются пороги ZZ_KARA_THRESHOLD
+и ZZ_KARA_SQR_THRESHOLD (см. zz_lcl.h): наименьшие n, начиная с которых
+алгоритм Карацубы быстрее школьного. В именах экспериментов длина чисел
+указывается в битах.
+
+Обращение по модулю: zzInvMod() (шаги divstep, см. zz_gcd.c) и
+возведение в степень mod - 2 (обращение по малой теореме Ферма).
+*******************************************************************************
+*/
+
+typedef struct
+{
+	word a[96];				/*!< первый операнд */
+	word b[96];				/*!< второй операнд */
+	word c[192];			/*!< результат */
+	size_t n;				/*!< длина операндов в словах */
+	octet stack[8192];		/*!< стек */
+} zz_bench_st;
+
+static void zzBenchMulSchool(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzMulSchool(b->c, b->a, b->n, b->b, b->n), b->a[0] ^= b->c[b->n];
+}
+
+static void zzBenchMulKara(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzMulKara(b->c, b->a, b->n, b->b, b->n, b->stack),
+		b->a[0] ^= b->c[b->n];
+}
+
+static void zzBenchSqrSchool(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzSqrSchool(b->c, b->a, b->n), b->a[0] ^= b->c[b->n];
+}
+
+static void zzBenchSqrKara(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzSqrKara(b->c, b->a, b->n, b->stack), b->a[0] ^= b->c[b->n];
+}
+
+static void zzBenchInvDivsteps(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzInvMod(b->b, b->b, b->a, b->n, b->stack);
+}
+
+static void zzBenchInvPower(void* arg, size_t reps)
+{
+	zz_bench_st* b = (zz_bench_st*)arg;
+	while (reps--)
+		zzPowerMod(b->c + b->n, b->b, b->n, b->c, b->n, b->a, b->stack);
+}
+
+bool_t zzBench()
+{
+	octet combo_state[32];
+	zz_bench_st b[1];
+	char name[64];
+	bool_t ret = TRUE;
+	// pre
+	ASSERT(zzMulKara_deep(96, 96) <= sizeof(b->stack));
+	ASSERT(zzSqrKara_deep(96) <= sizeof(b->stack));
+	ASSERT(zzInvMod_deep(W_OF_B(512)) <= sizeof(b->stack));
+	ASSERT(zzIsCoprime_deep(W_OF_B(512), W_OF_B(512)) <= sizeof(b->stack));
+	ASSERT(zzPowerMod_deep(W_OF_B(512), W_OF_B(512)) <= sizeof(b->stack));
+	// инициализировать генератор COMBO
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	prngCOMBOStepR(b->a, sizeof(b->a), combo_state);
+	prngCOMBOStepR(b->b, sizeof(b->b), combo_state);
+	// умножение / возведение в квадрат
+	for (b->n = 16; b->n <= 96; b->n += 16)
+	{
+		sprintf(name, "zzBench::mul-school[%u]", (unsigned)B_OF_W(b->n));
+		ret &= benchDo(name, "op", 1, zzBenchMulSchool, b);
+		sprintf(name, "zzBench::mul-kara[%u]", (unsigned)B_OF_W(b->n));
+		ret &= benchDo(name, "op", 1, zzBenchMulKara, b);
+		sprintf(name, "zzBench::sqr-school[%u]", (unsigned)B_OF_W(b->n));
+		ret &= benchDo(name, "op", 1, zzBenchSqrSchool, b);
+		sprintf(name, "zzBench::sqr-kara[%u]", (unsigned)B_OF_W(b->n));
+		ret &= benchDo(name, "op", 1, zzBenchSqrKara, b);
+	}
+	// обращение: шаги divstep / малая теорема Ферма
+	for (b->n = W_OF_B(256); b->n <= W_OF_B(512); b->n += W_OF_B(128))
+	{
+		const size_t n = b->n;
+		b->a[n - 1] |= WORD_BIT_HI, b->a[0] |= 1;
+		do
+			prngCOMBOStepR(b->b, O_OF_W(n), combo_state),
+			zzMod(b->b, b->b, n, b->a, n, b->stack);
+		while (!zzIsCoprime(b->b, n, b->a, n, b->stack));
+		wwCopy(b->c, b->a, n), zzSubW2(b->c, n, 2);
+		sprintf(name, "zzBench::inv-divsteps[%u]", (unsigned)B_OF_W(n));
+		ret &= benchDo(name, "op", 1, zzBenchInvDivsteps, b);
+		sprintf(name, "zzBench::inv-power[%u]", (unsigned)B_OF_W(n));
+		ret &= benchDo(name, "op", 1, zzBenchInvPower, b);
+	}
+	return ret;
+}
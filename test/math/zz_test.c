@@ -4,7 +4,7 @@
 \brief Tests for multiple-precision unsigned integers
 \project bee2/test
 \created 2014.07.15
-\version 2023.02.10
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -16,6 +16,8 @@
 #include <bee2/core/word.h>
 #include <bee2/math/zz.h>
 #include <bee2/math/ww.h>
+#include <math/ww_lcl.h>
+#include <math/zz/zz_lcl.h>
 
 /*
 *******************************************************************************
@@ -200,6 +202,49 @@ static bool_t zzTestMul()
 	return TRUE;
 }
 
+static bool_t zzTestKara()
+{
+	const size_t n = 40;
+	size_t reps;
+	word a[40];
+	word b[40];
+	word c[80];
+	word c1[80];
+	octet combo_state[32];
+	octet stack[4096];
+	// pre
+	ASSERT(zzMulKara_deep(n, n) <= sizeof(stack));
+	ASSERT(zzSqrKara_deep(n) <= sizeof(stack));
+	// инициализировать генератор COMBO
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// zzMulKara / zzSqrKara
+	for (reps = 0; reps < 10; ++reps)
+	{
+		size_t na, nb;
+		prngCOMBOStepR(a, O_OF_W(n), combo_state);
+		prngCOMBOStepR(b, O_OF_W(n), combo_state);
+		if (reps == 0)
+			wwRepW(a, n, WORD_MAX), wwRepW(b, n, WORD_MAX);
+		for (na = 4; na <= n; ++na)
+		{
+			zzSqrKara(c, a, na, stack);
+			zzSqrSchool(c1, a, na);
+			if (!wwEq(c, c1, na + na))
+				return FALSE;
+			for (nb = (na + 1) / 2 + 2; nb <= n; ++nb)
+			{
+				zzMulKara(c, a, na, b, nb, stack);
+				zzMulSchool(c1, a, na, b, nb);
+				if (!wwEq(c, c1, na + nb))
+					return FALSE;
+			}
+		}
+	}
+	// все нормально
+	return TRUE;
+}
+
 static bool_t zzTestMod()
 {
 	const size_t n = 8;
@@ -317,7 +362,12 @@ static bool_t zzTestMod()
 		// zzMulMod / zzDivMod / zzInvMod
 		zzGCD(t, a, n, mod, n, stack);
 		if (wwCmpW(t, n, 1) != 0)
+		{
+			zzInvMod(t, a, mod, n, stack);
+			if (!wwIsZero(t, n))
+				return FALSE;
 			continue;
+		}
 		if (!zzIsCoprime(a, n, mod, n, stack))
 			return FALSE;
 		zzInvMod(t, a, mod, n, stack);
@@ -494,6 +544,216 @@ static bool_t zzTestRed()
 	return TRUE;
 }
 
+static bool_t zzTestMont()
+{
+	const size_t n = 7;
+	size_t reps;
+	word a[7];
+	word b[7];
+	word c[7];
+	word mod[7];
+	word t[14];
+	octet combo_state[32];
+	octet stack[2048];
+	// pre
+	ASSERT(zzMod_deep(n, n) <= sizeof(stack));
+	ASSERT(zzRedMont_deep(n) <= sizeof(stack));
+	ASSERT(zzMulMont_deep(n) <= sizeof(stack));
+	ASSERT(zzSqrMont_deep(n) <= sizeof(stack));
+	// инициализировать генератор COMBO
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// умножение Монтгомери
+	for (reps = 0; reps < 500; ++reps)
+	{
+		word mont_param;
+		// генерация
+		prngCOMBOStepR(mod, O_OF_W(n), combo_state);
+		prngCOMBOStepR(a, O_OF_W(n), combo_state);
+		prngCOMBOStepR(b, O_OF_W(n), combo_state);
+		mod[0] |= 1;
+		mod[n - 1] = mod[n - 1] ? mod[n - 1] : 1;
+		mont_param = wordNegInv(mod[0]);
+		zzMod(a, a, n, mod, n, stack);
+		zzMod(b, b, n, mod, n, stack);
+		// zzMul + zzRedMont / zzMulMont
+		zzMul(t, a, n, b, n, stack);
+		zzRedMont(t, mod, n, mont_param, stack);
+		SAFE(zzMulMont)(c, a, b, mod, n, mont_param, stack);
+		if (!wwEq(c, t, n))
+			return FALSE;
+		FAST(zzMulMont)(c, a, b, mod, n, mont_param, stack);
+		if (!wwEq(c, t, n))
+			return FALSE;
+		// zzSqr + zzRedMont / zzSqrMont
+		zzSqr(t, a, n, stack);
+		zzRedMont(t, mod, n, mont_param, stack);
+		wwCopy(c, a, n);
+		SAFE(zzSqrMont)(c, c, mod, n, mont_param, stack);
+		if (!wwEq(c, t, n))
+			return FALSE;
+		wwCopy(c, a, n);
+		FAST(zzSqrMont)(c, c, mod, n, mont_param, stack);
+		if (!wwEq(c, t, n))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static bool_t zzTestFix()
+{
+	size_t n;
+	size_t reps;
+	word a[8];
+	word b[8];
+	word mod[8];
+	word t[16];
+	word t1[16];
+	octet combo_state[32];
+	octet stack[512];
+	// pre
+	ASSERT(zzRed_deep(8) <= sizeof(stack));
+	ASSERT(zzRedCrand_deep(8) <= sizeof(stack));
+	ASSERT(zzRedMont_deep(8) <= sizeof(stack));
+	// инициализировать генератор COMBO
+	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
+	prngCOMBOStart(combo_state, utilNonce32());
+	// ядра фиксированной длины
+	for (n = 4; n <= 8; n += 2)
+	for (reps = 0; reps < 500; ++reps)
+	{
+		prngCOMBOStepR(a, O_OF_W(n), combo_state);
+		prngCOMBOStepR(b, O_OF_W(n), combo_state);
+		prngCOMBOStepR(mod, O_OF_W(n), combo_state);
+		if (reps % 8 == 0)
+			wwRepW(a, n, WORD_MAX), wwRepW(b, n, WORD_MAX);
+		// wwXXX / wwXXXFix
+		if (reps % 8 == 2)
+			wwCopy(b, a, n), b[reps % n] ^= WORD_BIT_POS(reps % B_PER_W);
+		wwXor(t, a, b, n);
+		wwXorFix(t1, a, b, n);
+		if (!wwEq(t, t1, n) || wwIsZeroFix(t1, n) != wwIsZero(t, n))
+			return FALSE;
+		wwXor2Fix(t1, b, n);
+		if (!wwEqFix(t1, a, n) || wwEqFix(a, b, n) != wwEq(a, b, n) ||
+			wwCmpFix(a, b, n) != wwCmp(a, b, n) ||
+			wwCmpFix(b, a, n) != wwCmp(b, a, n) || wwCmpFix(a, a, n) != 0)
+			return FALSE;
+		wwCopyFix(t1, a, n), wwCopy(t, a, n);
+		wwShLoFix(t1, n, reps % (B_PER_W - 1) + 1);
+		wwShLo(t, n, reps % (B_PER_W - 1) + 1);
+		if (!wwEq(t, t1, n))
+			return FALSE;
+		wwCopyFix(t1, a, n), wwCopy(t, a, n);
+		wwShHiFix(t1, n, reps % (B_PER_W - 1) + 1);
+		wwShHi(t, n, reps % (B_PER_W - 1) + 1);
+		if (!wwEq(t, t1, n))
+			return FALSE;
+		wwSetZero(t, n);
+		if (!wwIsZeroFix(t, n))
+			return FALSE;
+		// zzMul / zzMulN
+		zzMul(t, a, n, b, n, stack);
+		if (n == 4)
+			zzMul4(t1, a, b);
+		else if (n == 6)
+			zzMul6(t1, a, b);
+		else
+			zzMul8(t1, a, b);
+		if (!wwEq(t, t1, 2 * n))
+			return FALSE;
+		// zzSqr / zzSqrN
+		zzSqr(t, a, n, stack);
+		if (n == 4)
+			zzSqr4(t1, a);
+		else if (n == 6)
+			zzSqr6(t1, a);
+		else
+			zzSqr8(t1, a);
+		if (!wwEq(t, t1, 2 * n))
+			return FALSE;
+		// zzRedMont / zzRedMontN
+		mod[0] |= 1, mod[n - 1] |= WORD_BIT_HI;
+		wwCopy(t1, t, 2 * n);
+		SAFE(zzRedMont)(t, mod, n, wordNegInv(mod[0]), stack);
+		if (n == 4)
+			zzRedMont4(t1, mod, wordNegInv(mod[0]));
+		else if (n == 6)
+			zzRedMont6(t1, mod, wordNegInv(mod[0]));
+		else
+			zzRedMont8(t1, mod, wordNegInv(mod[0]));
+		if (!wwEq(t, t1, n))
+			return FALSE;
+		// zzRedCrand / zzRedCrandN
+		if (n == 4)
+			zzMul4(t, a, b);
+		else if (n == 6)
+			zzMul6(t, a, b);
+		else
+			zzMul8(t, a, b);
+		wwRepW(mod + 1, n - 1, WORD_MAX);
+		wwCopy(t1, t, 2 * n);
+		zzRed(t, mod, n, stack);
+		if (n == 4)
+			zzRedCrand4(t1, mod);
+		else if (n == 6)
+			zzRedCrand6(t1, mod);
+		else
+			zzRedCrand8(t1, mod);
+		if (!wwEq(t, t1, n))
+			return FALSE;
+#if (B_PER_W == 64)
+		// zzRed / zzRedBignN
+		mod[0] = WORD_0 - (n == 4 ? 189 : n == 6 ? 317 : 569);
+		if (reps % 8 == 1)
+			wwRepW(t, 2 * n, WORD_MAX);
+		else
+			prngCOMBOStepR(t, O_OF_W(2 * n), combo_state);
+		wwCopy(t1, t, 2 * n);
+		zzRed(t, mod, n, stack);
+		if (n == 4)
+			zzRedBign128(t1);
+		else if (n == 6)
+			zzRedBign192(t1);
+		else
+			zzRedBign256(t1);
+		if (!wwEq(t, t1, n))
+			return FALSE;
+		// zzAddMod / zzAddModBignN, zzSubMod / zzSubModBignN
+		if (wwCmp(b, mod, n) >= 0)
+			wwCopy(b, mod, n), --b[0];
+		zzAddMod(a, t, b, mod, n);
+		if (n == 4)
+			zzAddModBign128(t1, t, b);
+		else if (n == 6)
+			zzAddModBign192(t1, t, b);
+		else
+			zzAddModBign256(t1, t, b);
+		if (!wwEq(a, t1, n))
+			return FALSE;
+		zzSubMod(a, t, b, mod, n);
+		if (n == 4)
+			zzSubModBign128(t1, t, b);
+		else if (n == 6)
+			zzSubModBign192(t1, t, b);
+		else
+			zzSubModBign256(t1, t, b);
+		if (!wwEq(a, t1, n))
+			return FALSE;
+		zzSubMod(a, b, t, mod, n);
+		if (n == 4)
+			zzSubModBign128(t1, b, t);
+		else if (n == 6)
+			zzSubModBign192(t1, b, t);
+		else
+			zzSubModBign256(t1, b, t);
+		if (!wwEq(a, t1, n))
+			return FALSE;
+#endif
+	}
+	return TRUE;
+}
+
 static bool_t zzTestEtc()
 {
 	const size_t n = 8;
@@ -513,6 +773,58 @@ static bool_t zzTestEtc()
 	// инициализировать генератор COMBO
 	ASSERT(prngCOMBO_keep() <= sizeof(combo_state));
 	prngCOMBOStart(combo_state, utilNonce32());
+	// регулярный выбор: все длины блоков, выход за границы таблицы
+	for (reps = 1; reps <= n; ++reps)
+	{
+		size_t i;
+		prngCOMBOStepR(b, O_OF_W(2 * n), combo_state);
+		for (i = 0; i <= 2 * n / reps; ++i)
+		{
+			wwSelect(t, b, 2 * n / reps, i, reps);
+			if (i < 2 * n / reps ? !wwEq(t, b + i * reps, reps) :
+				!wwIsZero(t, reps))
+				return FALSE;
+		}
+	}
+	// запись битов: поле пересекает границу слов
+	for (reps = 1; reps < B_PER_W; ++reps)
+	{
+		size_t width = utilMin(2, B_PER_W - reps + 1 + reps % 3, B_PER_W);
+		size_t i;
+		prngCOMBOStepR(a, O_OF_W(2), combo_state);
+		prngCOMBOStepR(b, O_OF_W(1), combo_state);
+		wwCopy(t, a, 2);
+		wwSetBits(a, reps, width, b[0]);
+		for (i = 0; i < 2 * B_PER_W; ++i)
+			if (wwTestBit(a, i) != (i < reps || i >= reps + width ?
+				wwTestBit(t, i) : wwTestBit(b, i - reps)))
+				return FALSE;
+	}
+	// символ Якоби: малые числа, сравнение с критерием Эйлера
+	for (reps = 3; reps < 200; reps += 2)
+	{
+		word u, v;
+		int j, k;
+		// reps -- простое?
+		for (u = 3; u * u <= reps && reps % u; u += 2);
+		if (u * u <= reps)
+			continue;
+		for (u = 0; u < 2 * reps; ++u)
+		{
+			// k <- u^{(reps - 1) / 2} \mod reps
+			for (v = 1, j = 0; (size_t)j < (reps - 1) / 2; ++j)
+				v = v * u % reps;
+			k = v == 0 ? 0 : (v == 1 ? 1 : -1);
+			// (u / reps) == k? (u / 3 reps) == k (u / 3)?
+			v = (word)reps;
+			if (zzJacobi(&u, 1, &v, 1, stack) != k)
+				return FALSE;
+			v *= 3;
+			j = u % 3 == 0 ? 0 : (u % 3 == 1 ? 1 : -1);
+			if (zzJacobi(&u, 1, &v, 1, stack) != k * j)
+				return FALSE;
+		}
+	}
 	// символ Якоби
 	for (reps = 0; reps < 500; ++reps)
 	{
@@ -556,8 +868,11 @@ bool_t zzTest()
 {
 	return zzTestAdd() && 
 		zzTestMul() && 
+		zzTestKara() &&
 		zzTestMod() && 
 		zzTestGCD() && 
 		zzTestRed() &&
+		zzTestMont() &&
+		zzTestFix() &&
 		zzTestEtc();
 }
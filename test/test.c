@@ -4,7 +4,7 @@
 \brief Bee2 testing
 \project bee2/test
 \created 2014.04.02
-\version 2022.10.31
+\version 2026.10.15
 \copyright The Bee2 authors
 \license Licensed under the Apache License, Version 2.0 (see LICENSE.txt).
 *******************************************************************************
@@ -21,6 +21,7 @@
 
 extern bool_t apduTest();
 extern bool_t b64Test();
+extern bool_t blobTest();
 extern bool_t decTest();
 extern bool_t derTest();
 extern bool_t hexTest();
@@ -30,6 +31,7 @@ extern bool_t objTest();
 extern bool_t oidTest();
 extern bool_t prngTest();
 extern bool_t rngTest();
+extern bool_t statTest();
 extern bool_t strTest();
 extern bool_t tmTest();
 extern bool_t u16Test();
@@ -43,6 +45,7 @@ int testCore()
 	int ret = 0;
 	printf("apduTest: %s\n", (code = apduTest()) ? "OK" : "Err"), ret |= !code;
 	printf("b64Test: %s\n", (code = b64Test()) ? "OK" : "Err"), ret |= !code;
+	printf("blobTest: %s\n", (code = blobTest()) ? "OK" : "Err"), ret |= !code;
 	printf("decTest: %s\n", (code = decTest()) ? "OK" : "Err"), ret |= !code;
 	printf("derTest: %s\n", (code = derTest()) ? "OK" : "Err"), ret |= !code;
 	printf("hexTest: %s\n", (code = hexTest()) ? "OK" : "Err"), ret |= !code;
@@ -52,6 +55,7 @@ int testCore()
 	printf("oidTest: %s\n", (code = oidTest()) ? "OK" : "Err"), ret |= !code;
 	printf("genTest: %s\n", (code = prngTest()) ? "OK" : "Err"), ret |= !code;
 	printf("rngTest: %s\n", (code = rngTest()) ? "OK" : "Err"), ret |= !code;
+	printf("statTest: %s\n", (code = statTest()) ? "OK" : "Err"), ret |= !code;
 	printf("strTest: %s\n", (code = strTest()) ? "OK" : "Err"), ret |= !code;
 	printf("tmTest: %s\n", (code = tmTest()) ? "OK" : "Err"), ret |= !code;
 	printf("u16Test: %s\n", (code = u16Test()) ? "OK" : "Err"), ret |= !code;
@@ -72,6 +76,8 @@ extern bool_t zzTest();
 extern bool_t wordTest();
 extern bool_t ecpTest();
 extern bool_t ecpBench();
+extern bool_t ec2Bench();
+extern bool_t zzBench();
 
 int testMath()
 {
@@ -82,6 +88,8 @@ int testMath()
 	printf("wordTest: %s\n", (code = wordTest()) ? "OK" : "Err"), ret |= !code;
 	printf("ecpTest: %s\n", (code = ecpTest()) ? "OK" : "Err"), ret |= !code;
 	code = ecpBench(), ret |= !code;
+	code = ec2Bench(), ret |= !code;
+	code = zzBench(), ret |= !code;
 	return ret;
 }
 
@@ -104,7 +112,10 @@ extern bool_t botpTest();
 extern bool_t bpkiTest();
 extern bool_t btokTest();
 extern bool_t dstuTest();
+extern bool_t engTest();
 extern bool_t g12sTest();
+extern bool_t keepTest();
+extern bool_t mhtTest();
 extern bool_t pfokTest();
 extern bool_t pfokTestStdParams();
 
@@ -124,8 +135,11 @@ int testCrypto()
 	printf("bpkiTest: %s\n", (code = bpkiTest()) ? "OK" : "Err"), ret |= !code;
 	printf("btokTest: %s\n", (code = btokTest()) ? "OK" : "Err"), ret |= !code;
 	printf("dstuTest: %s\n", (code = dstuTest()) ? "OK" : "Err"), ret |= !code;
+	printf("engTest: %s\n", (code = engTest()) ? "OK" : "Err"), ret |= !code;
 	printf("g12sTest: %s\n", (code = g12sTest()) ? "OK" : "Err"), ret |= !code;
+	printf("mhtTest: %s\n", (code = mhtTest()) ? "OK" : "Err"), ret |= !code;
 	printf("pfokTest: %s\n", (code = pfokTest()) ? "OK" : "Err"), ret |= !code;
+	printf("keepTest: %s\n", (code = keepTest()) ? "OK" : "Err"), ret |= !code;
 	return ret;
 }
 